@@ -11,13 +11,22 @@
 @7
 // Primary constant buffer (with additional material parameters)
 META_CB_BEGIN(0, Data)
-float4x4 WorldMatrix;
-float4x4 InvWorld;
 float4x4 SVPositionToWorld;
+uint InstanceOffset;
+float3 Dummy0;
 @1META_CB_END
 
+// Per-decal data (decals using the same material are drawn in a single instanced draw)
+struct DecalInstance
+{
+	float4 World[3]; // Transposed world matrix (3x4)
+	float4 InvWorld[3]; // Transposed inverse world matrix (3x4)
+	float4 Data; // x=PerInstanceRandom
+};
+
 // Use depth buffer for per-pixel decal layering
 Texture2D DepthBuffer : register(t0);
+StructuredBuffer<DecalInstance> DecalInstances : register(t1);
 
 // Material shader resources
 @2
@@ -31,8 +40,15 @@ struct MaterialInput
 	float4 SvPosition;
 	float3 PreSkinnedPosition;
 	float3 PreSkinnedNormal;
+	uint InstanceIndex;
 };
 
+float3x4 GetDecalWorld(MaterialInput input)
+{
+	DecalInstance instance = DecalInstances[input.InstanceIndex];
+	return float3x4(instance.World[0], instance.World[1], instance.World[2]);
+}
+
 // Transforms a vector from tangent space to world space
 float3 TransformTangentVectorToWorld(MaterialInput input, float3 tangentVector)
 {
@@ -60,21 +76,22 @@ float3 TransformViewVectorToWorld(MaterialInput input, float3 viewVector)
 // Transforms a vector from local space to world space
 float3 TransformLocalVectorToWorld(MaterialInput input, float3 localVector)
 {
-	float3x3 localToWorld = (float3x3)WorldMatrix;
-	return mul(localVector, localToWorld);
+	float3x3 localToWorld = (float3x3)GetDecalWorld(input);
+	return mul(localToWorld, localVector);
 }
 
 // Transforms a vector from local space to world space
 float3 TransformWorldVectorToLocal(MaterialInput input, float3 worldVector)
 {
-	float3x3 localToWorld = (float3x3)WorldMatrix;
-	return mul(localToWorld, worldVector);
+	float3x3 localToWorld = (float3x3)GetDecalWorld(input);
+	return mul(worldVector, localToWorld);
 }
 
 // Gets the current object position (supports instancing)
 float3 GetObjectPosition(MaterialInput input)
 {
-	return WorldMatrix[3].xyz;
+	float3x4 world = GetDecalWorld(input);
+	return float3(world[0].w, world[1].w, world[2].w);
 }
 
 // Gets the current object size
@@ -86,7 +103,7 @@ float3 GetObjectSize(MaterialInput input)
 // Get the current object random value supports instancing)
 float GetPerInstanceRandom(MaterialInput input)
 {
-	return 0;
+	return DecalInstances[input.InstanceIndex].Data.x;
 }
 
 // Get the current object LOD transition dither factor (supports instancing)
@@ -119,10 +136,12 @@ Material GetMaterialPS(MaterialInput input)
 // Vertex Shader function for decals rendering
 META_VS(true, FEATURE_LEVEL_ES2)
 META_VS_IN_ELEMENT(POSITION, 0, R32G32B32_FLOAT, 0, 0, PER_VERTEX, 0, true)
-void VS_Decal(in float3 Position : POSITION0, out float4 SvPosition : SV_Position)
+void VS_Decal(in float3 Position : POSITION0, in uint InstanceId : SV_InstanceID, out float4 SvPosition : SV_Position, out nointerpolation uint InstanceIndex : TEXCOORD0)
 {
 	// Compute world space vertex position
-	float3 worldPosition = mul(float4(Position.xyz, 1), WorldMatrix).xyz;
+	InstanceIndex = InstanceOffset + InstanceId;
+	DecalInstance instance = DecalInstances[InstanceIndex];
+	float3 worldPosition = mul(float3x4(instance.World[0], instance.World[1], instance.World[2]), float4(Position.xyz, 1));
 
 	// Compute clip space position
 	SvPosition = mul(float4(worldPosition.xyz, 1), ViewProjectionMatrix);
@@ -132,6 +151,7 @@ void VS_Decal(in float3 Position : POSITION0, out float4 SvPosition : SV_Positio
 META_PS(true, FEATURE_LEVEL_ES2)
 void PS_Decal(
 	in float4 SvPosition : SV_Position
+	, in nointerpolation uint InstanceIndex : TEXCOORD0
 	, out float4 Out0 : SV_Target0
 #if DECAL_BLEND_MODE == DECAL_BLEND_MODE_TRANSLUCENT
 	, out float4 Out1 : SV_Target1
@@ -149,7 +169,8 @@ void PS_Decal(
 
 	float4 positionHS = mul(float4(SvPosition.xyz, 1), SVPositionToWorld);
 	float3 positionWS = positionHS.xyz / positionHS.w;
-	float3 positionOS = mul(float4(positionWS, 1), InvWorld).xyz;
+	DecalInstance instance = DecalInstances[InstanceIndex];
+	float3 positionOS = mul(float3x4(instance.InvWorld[0], instance.InvWorld[1], instance.InvWorld[2]), float4(positionWS, 1));
 
 	clip(0.5 - abs(positionOS.xyz));
 	float2 decalUVs = positionOS.xz + 0.5f;
@@ -160,6 +181,7 @@ void PS_Decal(
 	materialInput.TexCoord = decalUVs;
 	materialInput.TwoSidedSign = 1;
 	materialInput.SvPosition = SvPosition;
+	materialInput.InstanceIndex = InstanceIndex;
 	
 	// Build tangent to world transformation matrix
 	float3 ddxWp = ddx(positionWS);
@@ -7,6 +7,7 @@
 #include "./Flax/Common.hlsl"
 #include "./Flax/MaterialCommon.hlsl"
 #include "./Flax/GBufferCommon.hlsl"
+#include "./Flax/Quaternion.hlsl"
 @7
 // Primary constant buffer (with additional material parameters)
 META_CB_BEGIN(0, Data)
@@ -16,7 +17,7 @@ float3 Dummy0;
 float WorldDeterminantSign;
 float MeshMinZ;
 float Segment;
-float ChunksPerSegment;
+float Dummy1;
 float PerInstanceRandom;
 float3 GeometrySize;
 float MeshMaxZ;
@@ -24,9 +25,49 @@ float MeshMaxZ;
 
 // Shader resources
 @2
-// The spline deformation buffer (stored as 4x3, 3 float4 behind each other)
+// The spline deformation buffer with the Bezier curve control points of each spline segment (translations, orientations and scales, 4 float4 each)
 Buffer<float4> SplineDeformation : register(t0);
 
+// Evaluates the spline segment transformation (rotation and scale in rows, translation) at the given position along the segment
+float3x3 GetSplineTransform(int segment, float t, out float3 translation)
+{
+	int index = segment * 12;
+	float3 p0 = SplineDeformation[index].xyz;
+	float3 p1 = SplineDeformation[index + 1].xyz;
+	float3 p2 = SplineDeformation[index + 2].xyz;
+	float3 p3 = SplineDeformation[index + 3].xyz;
+	float u = 1.0f - t;
+	float4 w = float4(u * u * u, 3 * u * u * t, 3 * u * t * t, t * t * t);
+	translation = w.x * p0 + w.y * p1 + w.z * p2 + w.w * p3;
+	float3 scale = w.x * SplineDeformation[index + 8].xyz + w.y * SplineDeformation[index + 9].xyz + w.z * SplineDeformation[index + 10].xyz + w.w * SplineDeformation[index + 11].xyz;
+
+	// Evaluate orientation of the curve (De Casteljau's algorithm with slerp)
+	float4 q0 = SplineDeformation[index + 4], q1 = SplineDeformation[index + 5], q2 = SplineDeformation[index + 6], q3 = SplineDeformation[index + 7];
+	float4 q01 = QuaternionSlerp(q0, q1, t), q12 = QuaternionSlerp(q1, q2, t), q23 = QuaternionSlerp(q2, q3, t);
+	float4 orientation = QuaternionSlerp(QuaternionSlerp(q01, q12, t), QuaternionSlerp(q12, q23, t), t);
+
+	// Align with the spline direction (from position 1st derivative, fallback to the segment direction if curve is flat at the end)
+	float3 direction = 3 * u * u * (p1 - p0) + 6 * u * t * (p2 - p1) + 3 * t * t * (p3 - p2);
+	if (dot(direction, direction) < 0.000001f)
+		direction = p3 - p0;
+	float3x3 look = float3x3(1, 0, 0, 0, 1, 0, 0, 0, 1);
+	if (dot(direction, direction) >= 0.000001f)
+	{
+		float3 forward = normalize(direction);
+		if (forward.y >= 0.999f)
+		{
+			look = float3x3(1, 0, 0, 0, 0, -1, 0, 1, 0);
+		}
+		else
+		{
+			float3 right = normalize(cross(cross(cross(forward, float3(0, 1, 0)), forward), forward));
+			look = float3x3(right, cross(forward, right), forward);
+		}
+	}
+	float3x3 rotation = mul(QuaternionToMatrix(orientation), look);
+	return float3x3(rotation[0] * scale.x, rotation[1] * scale.y, rotation[2] * scale.z);
+}
+
 // Geometry data passed though the graphics rendering stages up to the pixel shader
 struct GeometryData
 {
@@ -282,12 +323,11 @@ VertexOutput VS_SplineModel(ModelInput input)
 
 	// Apply spline curve deformation
 	float splineAlpha = saturate((position.z - MeshMinZ) / (MeshMaxZ - MeshMinZ));
-	int splineIndex = (int)((Segment + splineAlpha) * ChunksPerSegment);
-	position.z = splineAlpha;
-	float3x4 splineMatrix = float3x4(SplineDeformation[splineIndex * 3], SplineDeformation[splineIndex * 3 + 1], SplineDeformation[splineIndex * 3 + 2]);
-	position = mul(splineMatrix, float4(position, 1));
-	float4x3 splineMatrixT = transpose(splineMatrix);
-	world = mul(world, float4x4(float4(splineMatrixT[0], 0), float4(splineMatrixT[1], 0), float4(splineMatrixT[2], 0), float4(splineMatrixT[3], 1)));
+	float3 splineTranslation;
+	float3x3 splineMatrix = GetSplineTransform((int)Segment, splineAlpha, splineTranslation);
+	position.z = 0;
+	position = mul(position, splineMatrix) + splineTranslation;
+	world = mul(world, float4x4(float4(splineMatrix[0], 0), float4(splineMatrix[1], 0), float4(splineMatrix[2], 0), float4(splineTranslation, 1)));
 
 	// Compute world space vertex position
 	output.Geometry.WorldPosition = mul(float4(position, 1), WorldMatrix).xyz;
@@ -14,6 +14,7 @@
 #include "./Flax/Lighting.hlsl"
 #include "./Flax/ShadowsSampling.hlsl"
 #include "./Flax/ExponentialHeightFog.hlsl"
+#include "./Flax/ClusteredLighting.hlsl"
 @2// Forward Shading: Constants
 LightData DirectionalLight;
 LightShadowData DirectionalLightShadow;
@@ -23,10 +24,15 @@ ExponentialHeightFogData ExponentialHeightFog;
 float3 Dummy2;
 uint LocalLightsCount;
 LightData LocalLights[MAX_LOCAL_LIGHTS];
+ClusteredLightingData ClusteredLighting;
 @3// Forward Shading: Resources
 TextureCube EnvProbe : register(t__SRV__);
 TextureCube SkyLightTexture : register(t__SRV__);
 Texture2DArray DirectionalLightShadowMap : register(t__SRV__);
+#if CAN_USE_COMPUTE_SHADER
+StructuredBuffer<LightData> ClusteredLights : register(t__SRV__);
+Buffer<uint> ClusteredLightsGrid : register(t__SRV__);
+#endif
 @4// Forward Shading: Utilities
 DECLARE_LIGHTSHADOWDATA_ACCESS(DirectionalLightShadow);
 @5// Forward Shading: Shaders
@@ -91,6 +97,23 @@ void PS_Forward(
 	light += GetSkyLightLighting(SkyLight, gBuffer, SkyLightTexture);
 
 	// Calculate lighting from local lights
+#if CAN_USE_COMPUTE_SHADER
+	BRANCH
+	if (ClusteredLighting.LightsCount > 0)
+	{
+		// Use lights from the cluster containing this pixel
+		uint clusterOffset = GetClusterOffset(ClusteredLighting, materialInput.SvPosition.xy * ScreenSize.zw, gBuffer.ViewPos.z);
+		uint clusterLightsCount = ClusteredLightsGrid[clusterOffset];
+		LOOP
+		for (uint clusterLightIndex = 0; clusterLightIndex < clusterLightsCount; clusterLightIndex++)
+		{
+			const LightData localLight = ClusteredLights[ClusteredLightsGrid[clusterOffset + 1 + clusterLightIndex]];
+			bool isSpotLight = localLight.SpotAngles.x > -2.0f;
+			shadowMask = 1.0f;
+			light += GetLighting(ViewPos, localLight, gBuffer, shadowMask, true, isSpotLight);
+		}
+	}
+#endif
 	LOOP
 	for (uint localLightIndex = 0; localLightIndex < LocalLightsCount; localLightIndex++)
 	{
@@ -12,11 +12,16 @@
 META_CB_BEGIN(0, Data)
 float4x4 WorldMatrix;
 float4x4 PrevWorldMatrix;
-float2 Dummy0;
+uint BonesOffset;
+uint PrevBonesOffset;
 float LODDitherFactor;
 float PerInstanceRandom;
 float3 GeometrySize;
 float WorldDeterminantSign;
+float3 QuantizationOffset;
+float Dummy0;
+float3 QuantizationScale;
+float Dummy1;
 @1META_CB_END
 
 // Shader resources
@@ -306,11 +311,24 @@ float3x3 CalcTangentToWorld(float4x4 world, float3x3 tangentToLocal)
 	return mul(tangentToLocal, localToWorld); 
 }
 
+#if USE_QUANTIZED_POSITIONS
+
+// Decodes the vertex position quantized into 16-bit normalized values relative to the mesh bounds
+float3 DecodeQuantizedPosition(float3 position)
+{
+	return QuantizationOffset + position * QuantizationScale;
+}
+
+#endif
+
 // Vertex Shader function for GBuffer Pass and Depth Pass (with full vertex data)
 META_VS(true, FEATURE_LEVEL_ES2)
-META_PERMUTATION_1(USE_INSTANCING=0)
-META_PERMUTATION_1(USE_INSTANCING=1)
-META_VS_IN_ELEMENT(POSITION, 0, R32G32B32_FLOAT,   0, 0,     PER_VERTEX, 0, true)
+META_PERMUTATION_3(USE_INSTANCING=0, USE_FLOAT_POSITIONS=1, USE_QUANTIZED_POSITIONS=0)
+META_PERMUTATION_3(USE_INSTANCING=1, USE_FLOAT_POSITIONS=1, USE_QUANTIZED_POSITIONS=0)
+META_PERMUTATION_3(USE_INSTANCING=0, USE_FLOAT_POSITIONS=0, USE_QUANTIZED_POSITIONS=1)
+META_PERMUTATION_3(USE_INSTANCING=1, USE_FLOAT_POSITIONS=0, USE_QUANTIZED_POSITIONS=1)
+META_VS_IN_ELEMENT(POSITION, 0, R32G32B32_FLOAT,   0, 0,     PER_VERTEX, 0, USE_FLOAT_POSITIONS)
+META_VS_IN_ELEMENT(POSITION, 0, R16G16B16A16_UNORM,0, 0,     PER_VERTEX, 0, USE_QUANTIZED_POSITIONS)
 META_VS_IN_ELEMENT(TEXCOORD, 0, R16G16_FLOAT,      1, 0,     PER_VERTEX, 0, true)
 META_VS_IN_ELEMENT(NORMAL,   0, R10G10B10A2_UNORM, 1, ALIGN, PER_VERTEX, 0, true)
 META_VS_IN_ELEMENT(TANGENT,  0, R10G10B10A2_UNORM, 1, ALIGN, PER_VERTEX, 0, true)
@@ -324,6 +342,9 @@ META_VS_IN_ELEMENT(ATTRIBUTE,4, R16G16B16A16_FLOAT,3, ALIGN, PER_INSTANCE, 1, US
 VertexOutput VS(ModelInput input)
 {
 	VertexOutput output;
+#if USE_QUANTIZED_POSITIONS
+	input.Position = DecodeQuantizedPosition(input.Position);
+#endif
 
 	// Compute world space vertex position
 	CalculateInstanceTransform(input);
@@ -389,9 +410,12 @@ VertexOutput VS(ModelInput input)
 
 // Vertex Shader function for Depth Pass
 META_VS(true, FEATURE_LEVEL_ES2)
-META_PERMUTATION_1(USE_INSTANCING=0)
-META_PERMUTATION_1(USE_INSTANCING=1)
-META_VS_IN_ELEMENT(POSITION, 0, R32G32B32_FLOAT,   0, 0,     PER_VERTEX, 0, true)
+META_PERMUTATION_3(USE_INSTANCING=0, USE_FLOAT_POSITIONS=1, USE_QUANTIZED_POSITIONS=0)
+META_PERMUTATION_3(USE_INSTANCING=1, USE_FLOAT_POSITIONS=1, USE_QUANTIZED_POSITIONS=0)
+META_PERMUTATION_3(USE_INSTANCING=0, USE_FLOAT_POSITIONS=0, USE_QUANTIZED_POSITIONS=1)
+META_PERMUTATION_3(USE_INSTANCING=1, USE_FLOAT_POSITIONS=0, USE_QUANTIZED_POSITIONS=1)
+META_VS_IN_ELEMENT(POSITION, 0, R32G32B32_FLOAT,   0, 0,     PER_VERTEX, 0, USE_FLOAT_POSITIONS)
+META_VS_IN_ELEMENT(POSITION, 0, R16G16B16A16_UNORM,0, 0,     PER_VERTEX, 0, USE_QUANTIZED_POSITIONS)
 META_VS_IN_ELEMENT(ATTRIBUTE,0, R32G32B32A32_FLOAT,3, 0,     PER_INSTANCE, 1, USE_INSTANCING)
 META_VS_IN_ELEMENT(ATTRIBUTE,1, R32G32B32A32_FLOAT,3, ALIGN, PER_INSTANCE, 1, USE_INSTANCING)
 META_VS_IN_ELEMENT(ATTRIBUTE,2, R32G32B32_FLOAT,   3, ALIGN, PER_INSTANCE, 1, USE_INSTANCING)
@@ -403,6 +427,9 @@ float4 VS_Depth(ModelInput_PosOnly input) : SV_Position
 	float4x4 world = GetInstanceTransform(input);
 #else
 	float4x4 world = WorldMatrix;
+#endif
+#if USE_QUANTIZED_POSITIONS
+	input.Position = DecodeQuantizedPosition(input.Position);
 #endif
 	float3 worldPosition = mul(float4(input.Position.xyz, 1), world).xyz;
 	float4 position = mul(float4(worldPosition, 1), ViewProjectionMatrix);
@@ -411,7 +438,7 @@ float4 VS_Depth(ModelInput_PosOnly input) : SV_Position
 
 #if USE_SKINNING
 
-// The skeletal bones matrix buffer (stored as 4x3, 3 float4 behind each other)
+// The skeletal bones matrix buffer (stored as 4x3, 3 float4 behind each other, starting at BonesOffset)
 Buffer<float4> BoneMatrices : register(t0);
 
 #if PER_BONE_MOTION_BLUR
@@ -421,9 +448,10 @@ Buffer<float4> PrevBoneMatrices : register(t1);
 
 float3x4 GetPrevBoneMatrix(int index)
 {
-	float4 a = PrevBoneMatrices[index * 3];
-	float4 b = PrevBoneMatrices[index * 3 + 1];
-	float4 c = PrevBoneMatrices[index * 3 + 2];
+	uint i = PrevBonesOffset + index * 3;
+	float4 a = PrevBoneMatrices[i];
+	float4 b = PrevBoneMatrices[i + 1];
+	float4 c = PrevBoneMatrices[i + 2];
 	return float3x4(a, b, c);
 }
 
@@ -444,9 +472,10 @@ float3 SkinPrevPosition(ModelInput_Skinned input)
 // Calculates the transposed transform matrix for the given bone index
 float3x4 GetBoneMatrix(int index)
 {
-	float4 a = BoneMatrices[index * 3];
-	float4 b = BoneMatrices[index * 3 + 1];
-	float4 c = BoneMatrices[index * 3 + 2];
+	uint i = BonesOffset + index * 3;
+	float4 a = BoneMatrices[i];
+	float4 b = BoneMatrices[i + 1];
+	float4 c = BoneMatrices[i + 2];
 	return float3x4(a, b, c);
 }
 
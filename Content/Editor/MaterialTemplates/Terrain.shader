@@ -11,6 +11,9 @@
 #define TERRAIN_LAYERS_DATA_SIZE 2
 #define USE_TERRAIN_LAYERS (TERRAIN_LAYERS_DATA_SIZE > 0)
 
+// Enables/disables sampling the pre-rendered material properties for distant chunks (see TerrainMaterialCache)
+#define USE_TERRAIN_MATERIAL_CACHE (MATERIAL_BLEND == MATERIAL_BLEND_OPAQUE && MATERIAL_SHADING_MODEL == SHADING_MODEL_LIT)
+
 #include "./Flax/Common.hlsl"
 #include "./Flax/MaterialCommon.hlsl"
 #include "./Flax/GBufferCommon.hlsl"
@@ -27,13 +30,19 @@ float TerrainChunkSizeLOD0;
 float4 HeightmapUVScaleBias;
 float4 NeighborLOD;
 float2 OffsetUV;
-float2 Dummy0;
+float CachePage;
+float Dummy0;
 @1META_CB_END
 
 // Terrain data
 Texture2D Heightmap : register(t0);
 Texture2D Splatmap0 : register(t1);
 Texture2D Splatmap1 : register(t2);
+#if USE_TERRAIN_MATERIAL_CACHE
+Texture2DArray MaterialCache0 : register(t3);
+Texture2DArray MaterialCache1 : register(t4);
+Texture2DArray MaterialCache2 : register(t5);
+#endif
 
 // Shader resources
 @2
@@ -239,6 +248,31 @@ float4 GetVertexColor(MaterialInput input)
 
 @8
 
+#if USE_TERRAIN_MATERIAL_CACHE
+
+// Gets the material properties from the cache page (pre-rendered GBuffer data of the whole chunk)
+Material GetCachedMaterial(MaterialInput input)
+{
+	float2 uv = input.TexCoord - OffsetUV;
+	float3 cacheUV = float3(uv.x, 1.0f - uv.y, CachePage);
+	float4 cache0 = MaterialCache0.Sample(SamplerLinearClamp, cacheUV);
+	float4 cache1 = MaterialCache1.Sample(SamplerLinearClamp, cacheUV);
+	float4 cache2 = MaterialCache2.Sample(SamplerLinearClamp, cacheUV);
+	Material material = (Material)0;
+	material.Color = cache0.rgb;
+	material.AO = cache0.a;
+	material.WorldNormal = normalize(cache1.rgb * 2.0f - 1.0f);
+	material.TangentNormal = TransformWorldVectorToTangent(input, material.WorldNormal);
+	material.Roughness = cache2.r;
+	material.Metalness = cache2.g;
+	material.Specular = cache2.b;
+	material.Opacity = 1.0f;
+	material.Mask = input.HolesMask;
+	return material;
+}
+
+#endif
+
 // Get material properties function (for vertex shader)
 Material GetMaterialVS(MaterialInput input)
 {
@@ -254,6 +288,10 @@ Material GetMaterialDS(MaterialInput input)
 // Get material properties function (for pixel shader)
 Material GetMaterialPS(MaterialInput input)
 {
+#if USE_TERRAIN_MATERIAL_CACHE
+	if (CachePage >= 0)
+		return GetCachedMaterial(input);
+#endif
 @4
 }
 
@@ -5,26 +5,34 @@
 #include "Engine/Core/DeleteMe.h"
 #include "Engine/Core/Utilities.h"
 #include "Engine/Core/Collections/Sorting.h"
+#include "Engine/Core/Collections/HashSet.h"
 #include "Engine/Platform/FileSystem.h"
 #include "Engine/Content/Content.h"
 #include "Engine/Content/Asset.h"
 #include "Engine/Content/BinaryAsset.h"
 #include "Engine/Content/JsonAsset.h"
 #include "Engine/Content/AssetReference.h"
+#include "Engine/Content/ContentPrefetch.h"
 #include "Engine/Content/Assets/Material.h"
 #include "Engine/Content/Assets/Shader.h"
 #include "Engine/Content/Assets/Texture.h"
 #include "Engine/Content/Assets/CubeTexture.h"
+#include "Engine/Content/Assets/Model.h"
+#include "Engine/Content/Assets/SkinnedModel.h"
 #include "Engine/Render2D/SpriteAtlas.h"
 #include "Engine/Content/Storage/FlaxFile.h"
 #include "Engine/Particles/ParticleEmitter.h"
+#include "Engine/Level/Scene/SceneAsset.h"
+#include "Engine/Level/Scene/SceneWorldPartition.h"
 #include "Engine/Utilities/Encryption.h"
 #include "Engine/Serialization/JsonWriters.h"
+#include "Engine/Serialization/JsonBinary.h"
 #include "Engine/Serialization/FileWriteStream.h"
 #include "Engine/Serialization/MemoryWriteStream.h"
 #include "Engine/Core/Config/PlatformSettings.h"
 #include "Engine/Core/Config/GameSettings.h"
 #include "Engine/Core/Config/BuildSettings.h"
+#include "Engine/Core/Config/GraphicsSettings.h"
 #include "Engine/Streaming/StreamingSettings.h"
 #include "Engine/ShadersCompilation/ShadersCompilation.h"
 #include "Engine/Graphics/RenderTools.h"
@@ -37,6 +45,7 @@
 #include "Engine/Engine/Globals.h"
 #include "Engine/Tools/TextureTool/TextureTool.h"
 #include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Threading/JobSystem.h"
 #include "Engine/Scripting/Enums.h"
 #if PLATFORM_TOOLS_WINDOWS
 #include "Engine/Platform/Windows/WindowsPlatformSettings.h"
@@ -50,6 +59,15 @@
 #include "FlaxEngine.Gen.h"
 
 Dictionary<String, CookAssetsStep::ProcessAssetFunc> CookAssetsStep::AssetProcessors;
+HashSet<String> CookAssetsStep::ConcurrentAssetProcessors;
+
+int32 GetShadersMaxShadowsQuality(const BuildSettings* buildSettings)
+{
+    // Shadows quality above the limit is never used by the game so those shader permutations can be stripped
+    if (!buildSettings->StripShaderPermutations)
+        return (int32)Quality::Ultra;
+    return Math::Max((int32)buildSettings->MaxShadowsQuality, (int32)GraphicsSettings::Get()->ShadowsQuality);
+}
 
 void IBuildCache::InvalidateCacheShaders()
 {
@@ -235,6 +253,11 @@ void CookAssetsStep::CacheData::Load(CookingData& data)
         LOG(Info, "{0} option has been modified.", TEXT("ShadersGenerateDebugData"));
         invalidateShaders = true;
     }
+    if (GetShadersMaxShadowsQuality(buildSettings) != Settings.Global.ShadersMaxShadowsQuality)
+    {
+        LOG(Info, "{0} option has been modified.", TEXT("StripShaderPermutations"));
+        invalidateShaders = true;
+    }
 #if PLATFORM_TOOLS_WINDOWS
     if (data.Platform == BuildPlatform::Windows32 || data.Platform == BuildPlatform::Windows64)
     {
@@ -324,6 +347,39 @@ void CookAssetsStep::CacheData::Save(CookingData& data)
     file->WriteInt32(13);
 }
 
+// Json assets up to this size (in bytes) use the shared compression dictionaries in packages
+#define COOK_JSON_DICTIONARY_MAX_SIZE (16 * 1024)
+
+bool LoadJsonAssetDocument(CookAssetsStep::AssetCookData& options, JsonAssetBase* asset, rapidjson_flax::Document& document)
+{
+    // Use compact json
+    rapidjson_flax::StringBuffer buffer;
+    CompactJsonWriter writerObj(buffer);
+    asset->Save(writerObj);
+    document.Parse(buffer.GetString(), buffer.GetSize());
+    if (document.HasParseError())
+    {
+        LOG(Error, "Failed to parse json asset '{0}'", options.Asset->ToString());
+        return true;
+    }
+    return false;
+}
+
+void SaveJsonAssetDocument(CookAssetsStep::AssetCookData& options, const rapidjson_flax::Document& document)
+{
+    // Convert into binary format so game can load it without parsing the text
+    MemoryWriteStream stream(1024);
+    JsonBinary::Write(document, stream);
+
+    // Store json data in the first chunk
+    auto chunk = New<FlaxChunk>();
+    chunk->Flags = FlaxChunkFlags::CompressedLZ4; // Compress json data (internal storage layer will handle it)
+    if (stream.GetPosition() <= COOK_JSON_DICTIONARY_MAX_SIZE)
+        chunk->Flags |= FlaxChunkFlags::CompressionDictionary; // Small assets compress much better with the shared dictionary
+    chunk->Data.Copy(stream.GetHandle(), (int32)stream.GetPosition());
+    options.InitData.Header.Chunks[0] = chunk;
+}
+
 bool CookAssetsStep::ProcessDefaultAsset(AssetCookData& options)
 {
     const auto asBinaryAsset = dynamic_cast<BinaryAsset*>(options.Asset);
@@ -345,17 +401,10 @@ bool CookAssetsStep::ProcessDefaultAsset(AssetCookData& options)
     const auto asJsonAsset = dynamic_cast<JsonAssetBase*>(options.Asset);
     if (asJsonAsset)
     {
-        // Use compact json
-        rapidjson_flax::StringBuffer buffer;
-        CompactJsonWriter writerObj(buffer);
-        asJsonAsset->Save(writerObj);
-
-        // Store json data in the first chunk
-        auto chunk = New<FlaxChunk>();
-        chunk->Flags = FlaxChunkFlags::CompressedLZ4; // Compress json data (internal storage layer will handle it)
-        chunk->Data.Copy((byte*)buffer.GetString(), (int32)buffer.GetSize());
-        options.InitData.Header.Chunks[0] = chunk;
-
+        rapidjson_flax::Document document;
+        if (LoadJsonAssetDocument(options, asJsonAsset, document))
+            return true;
+        SaveJsonAssetDocument(options, document);
         return false;
     }
 
@@ -416,6 +465,11 @@ bool ProcessShaderBase(CookAssetsStep::AssetCookData& data, ShaderAssetBase* ass
     options.GenerateDebugData = data.Cache.Settings.Global.ShadersGenerateDebugData;
     options.TreatWarningsAsErrors = false;
     options.Output = &cacheStream;
+
+    // Strip shadows quality permutations that cannot be reached by the game
+    static const char* QualityDefines[] = { "0", "1", "2", "3" };
+    for (int32 quality = data.Cache.Settings.Global.ShadersMaxShadowsQuality + 1; quality <= (int32)Quality::Ultra; quality++)
+        options.StrippedPermutations.Add({ "SHADOWS_QUALITY", QualityDefines[quality] });
     Array<String> includes;
 
 #define COMPILE_PROFILE(profile, cacheChunk) \
@@ -638,6 +692,19 @@ bool ProcessParticleEmitter(CookAssetsStep::AssetCookData& data)
     return ProcessShaderBase(data, asset);
 }
 
+bool ProcessScene(CookAssetsStep::AssetCookData& data)
+{
+    rapidjson_flax::Document document;
+    if (LoadJsonAssetDocument(data, (JsonAssetBase*)data.Asset, document))
+        return true;
+
+    // Split the scene objects into the world partition grid cells (if enabled)
+    SceneWorldPartition::BuildCells(document);
+
+    SaveJsonAssetDocument(data, document);
+    return false;
+}
+
 bool ProcessTextureBase(CookAssetsStep::AssetCookData& data)
 {
     const auto asset = static_cast<TextureBase*>(data.Asset);
@@ -782,6 +849,14 @@ CookAssetsStep::CookAssetsStep()
     AssetProcessors.Add(Texture::TypeName, ProcessTextureBase);
     AssetProcessors.Add(CubeTexture::TypeName, ProcessTextureBase);
     AssetProcessors.Add(SpriteAtlas::TypeName, ProcessTextureBase);
+    AssetProcessors.Add(SceneAsset::TypeName, ProcessScene);
+    ConcurrentAssetProcessors.Add(Material::TypeName);
+    ConcurrentAssetProcessors.Add(Shader::TypeName);
+    ConcurrentAssetProcessors.Add(ParticleEmitter::TypeName);
+    ConcurrentAssetProcessors.Add(Texture::TypeName);
+    ConcurrentAssetProcessors.Add(CubeTexture::TypeName);
+    ConcurrentAssetProcessors.Add(SpriteAtlas::TypeName);
+    ConcurrentAssetProcessors.Add(SceneAsset::TypeName);
 }
 
 bool CookAssetsStep::Process(CookingData& data, CacheData& cache, BinaryAsset* asset)
@@ -826,8 +901,11 @@ bool CookAssetsStep::Process(CookingData& data, CacheData& cache, BinaryAsset* a
 
     // Save cache
     String cachedFilePath;
-    auto& entry = cache.CreateEntry(asset, cachedFilePath);
-    entry.FileDependencies = MoveTemp(fileDependencies);
+    {
+        ScopeLock lock(cache.Locker);
+        auto& entry = cache.CreateEntry(asset, cachedFilePath);
+        entry.FileDependencies = MoveTemp(fileDependencies);
+    }
     const bool result = FlaxStorage::Create(cachedFilePath, initData);
 
     // Cleanup allocated data chunks
@@ -870,8 +948,11 @@ bool CookAssetsStep::Process(CookingData& data, CacheData& cache, JsonAssetBase*
 
     // Save cache
     String cachedFilePath;
-    auto& entry = cache.CreateEntry(asset, cachedFilePath);
-    entry.FileDependencies = MoveTemp(fileDependencies);
+    {
+        ScopeLock lock(cache.Locker);
+        auto& entry = cache.CreateEntry(asset, cachedFilePath);
+        entry.FileDependencies = MoveTemp(fileDependencies);
+    }
     const bool result = FlaxStorage::Create(cachedFilePath, initData);
 
     // Cleanup allocated data chunks
@@ -885,9 +966,36 @@ bool CookAssetsStep::Process(CookingData& data, CacheData& cache, JsonAssetBase*
     return false;
 }
 
+bool CookAssetsStep::Process(CookingData& data, CacheData& cache, const Array<AssetReference<Asset>>& assets)
+{
+    PROFILE_CPU();
+
+    // Cook assets on job threads (cache entries are guarded by the lock, packages are written later by the cooking thread)
+    volatile int64 failed = 0;
+    const Function<void(int32)> job = [&](int32 i)
+    {
+        if (Process(data, cache, assets[i].Get()))
+            Platform::AtomicStore(&failed, 1);
+    };
+    JobSystem::Wait(JobSystem::Dispatch(job, assets.Count()));
+    if (Platform::AtomicRead(&failed))
+        return true;
+
+    data.Stats.CookedAssets += assets.Count();
+    return false;
+}
+
+bool CookAssetsStep::CanProcessConcurrently(const StringView& typeName)
+{
+    return ConcurrentAssetProcessors.Contains(typeName) || !AssetProcessors.ContainsKey(typeName);
+}
+
 /// <summary>
 /// Helper utility to build a package of set of assets (using limits parameters).
 /// </summary>
+// The amount of the smallest texture mips kept together with the always-resident assets data in packages (up to 64x64)
+#define COOK_RESIDENT_TEXTURE_MIPS 7
+
 class PackageBuilder : public NonCopyable
 {
 private:
@@ -1012,6 +1120,61 @@ class PackageBuilder : public NonCopyable
             }
         }
 
+        // Apply the chunks compression and layout policy per asset type
+        const auto buildSettings = BuildSettings::Get();
+        for (int32 i = 0; i < count; i++)
+        {
+            const AssetHeader& header = assetsData[i].Header;
+            const bool isMesh = header.TypeName == Model::TypeName || header.TypeName == SkinnedModel::TypeName;
+            const bool isTexture = header.TypeName == Texture::TypeName || header.TypeName == CubeTexture::TypeName || header.TypeName == SpriteAtlas::TypeName;
+            for (FlaxChunk* chunk : header.Chunks)
+            {
+                if (!chunk)
+                    continue;
+                if (isMesh && buildSettings->CompressMeshData)
+                    chunk->Flags |= FlaxChunkFlags::CompressedLZ4;
+                if (!buildSettings->UseCompressionDictionaries)
+                    chunk->Flags &= ~FlaxChunkFlags::CompressionDictionary;
+            }
+
+            // Mark high-quality mips/LODs as streamed to place them after the data that is always loaded with the asset
+            if (isTexture)
+            {
+                // Mips are in 0-13 chunks, the smallest ones get loaded first by the streaming
+                int32 mipsCount = 0;
+                while (mipsCount < 14 && header.Chunks[mipsCount])
+                    mipsCount++;
+                if (buildSettings->CompressTextureData && assetsData[i].CustomData.Length() == sizeof(TextureHeader))
+                {
+                    // Compress mips with the bytes grouped by the offset within the format block (eg. BC endpoints and indices) which compresses much better
+                    const PixelFormat format = ((const TextureHeader*)assetsData[i].CustomData.Get())->Format;
+                    const int32 blockSize = PixelFormatExtensions::ComputeBlockSize(format);
+                    const int32 stride = PixelFormatExtensions::IsCompressedASTC(format) ? 16 : PixelFormatExtensions::SizeInBits(format) * blockSize * blockSize / 8;
+                    for (int32 mipIndex = 0; mipIndex < mipsCount; mipIndex++)
+                    {
+                        FlaxChunk* chunk = header.Chunks[mipIndex];
+                        chunk->Flags |= FlaxChunkFlags::CompressedLZ4;
+                        if (stride > 1)
+                        {
+                            chunk->Flags |= FlaxChunkFlags::ShuffledBlocks;
+                            chunk->ShuffleStride = stride;
+                        }
+                    }
+                }
+                for (int32 mipIndex = 0; mipIndex < mipsCount - COOK_RESIDENT_TEXTURE_MIPS; mipIndex++)
+                    header.Chunks[mipIndex]->Flags |= FlaxChunkFlags::Streamed;
+            }
+            else if (isMesh)
+            {
+                // The lowest LOD gets loaded first by the streaming
+                int32 lodsCount = 0;
+                while (lodsCount < MODEL_MAX_LODS && header.Chunks[MODEL_LOD_TO_CHUNK_INDEX(lodsCount)])
+                    lodsCount++;
+                for (int32 lodIndex = 0; lodIndex < lodsCount - 1; lodIndex++)
+                    header.Chunks[MODEL_LOD_TO_CHUNK_INDEX(lodIndex)]->Flags |= FlaxChunkFlags::Streamed;
+            }
+        }
+
         // Create package
         // Note: FlaxStorage::Create overrides chunks locations in file so don't use files anymore (only readonly)
         const String localPath = String::Format(TEXT("Content/Data_{0}.{1}"), _packageIndex, PACKAGE_FILES_EXTENSION);
@@ -1084,6 +1247,7 @@ bool CookAssetsStep::Perform(CookingData& data)
     {
         cache.Settings.Global.ShadersNoOptimize = buildSettings->ShadersNoOptimize;
         cache.Settings.Global.ShadersGenerateDebugData = buildSettings->ShadersGenerateDebugData;
+        cache.Settings.Global.ShadersMaxShadowsQuality = GetShadersMaxShadowsQuality(buildSettings);
         cache.Settings.Global.StreamingSettingsAssetId = gameSettings->Streaming;
         cache.Settings.Global.ShadersVersion = GPU_SHADER_CACHE_VERSION;
         cache.Settings.Global.MaterialGraphVersion = MATERIAL_GRAPH_VERSION;
@@ -1101,6 +1265,15 @@ bool CookAssetsStep::Perform(CookingData& data)
     int32 subStepIndex = 0;
     AssetReference<Asset> assetRef;
     assetRef.Unload.Bind([]() { LOG(Error, "Asset gets unloaded while cooking it!"); Platform::Sleep(100); });
+
+    // Assets with thread-safe processors are cooked in batches on job threads, others are cooked one by one on this thread (never together with the batch)
+    const int32 batchSize = Math::Max(JobSystem::GetThreadsCount(), 1) * 2;
+    Array<AssetReference<Asset>> batch;
+    batch.Resize(batchSize);
+    for (auto& e : batch)
+        e.Unload.Bind([]() { LOG(Error, "Asset gets unloaded while cooking it!"); Platform::Sleep(100); });
+    int32 batchCount = 0;
+    int32 savedCookedAssets = 0;
     for (auto i = data.Assets.Begin(); i.IsNotEnd(); ++i)
     {
         BUILD_STEP_CANCEL_CHECK;
@@ -1167,19 +1340,52 @@ bool CookAssetsStep::Perform(CookingData& data)
         e.Info.TypeName = assetRef->GetTypeName();
 
         // Cook asset
-        if (Process(data, cache, assetRef.Get()))
+        if (CanProcessConcurrently(e.Info.TypeName))
         {
-            cache.Save(data);
-            return true;
+            // Assets load in the background while the batch gets filled
+            batch[batchCount++] = assetRef.Get();
+            if (batchCount == batchSize)
+            {
+                const bool failed = Process(data, cache, batch);
+                for (auto& ref : batch)
+                    ref = nullptr;
+                batchCount = 0;
+                if (failed)
+                {
+                    cache.Save(data);
+                    return true;
+                }
+            }
+        }
+        else
+        {
+            if (Process(data, cache, assetRef.Get()))
+            {
+                cache.Save(data);
+                return true;
+            }
+            data.Stats.CookedAssets++;
         }
-        data.Stats.CookedAssets++;
+        assetRef = nullptr;
 
         // Auto save build cache after every few cooked assets (reduces next build time if cooking fails later)
-        if (data.Stats.CookedAssets % 50 == 0)
+        if (data.Stats.CookedAssets - savedCookedAssets >= 50)
         {
+            savedCookedAssets = data.Stats.CookedAssets;
             cache.Save(data);
         }
     }
+    if (batchCount != 0)
+    {
+        batch.Resize(batchCount);
+        const bool failed = Process(data, cache, batch);
+        batch.Clear();
+        if (failed)
+        {
+            cache.Save(data);
+            return true;
+        }
+    }
 
     // Save build cache header
     cache.Save(data);
@@ -1225,13 +1431,46 @@ bool CookAssetsStep::Perform(CookingData& data)
     {
         PackageBuilder packageBuilder(buildSettings->MaxAssetsPerPackage, buildSettings->MaxPackageSizeMB, contentKey);
 
+        // Order assets by the runtime access locality: each scene followed by the assets recorded in its prefetch manifest (starting from the first scene), then the remaining assets
+        Array<Guid> packagingOrder;
+        {
+            Array<Guid> scenes;
+            if (AssetsRegistry.ContainsKey(gameSettings->FirstScene))
+                scenes.Add(gameSettings->FirstScene);
+            for (auto i = AssetsRegistry.Begin(); i.IsNotEnd(); ++i)
+            {
+                if (i->Value.Info.TypeName == TEXT("FlaxEngine.SceneAsset") && i->Key != gameSettings->FirstScene)
+                    scenes.Add(i->Key);
+            }
+            HashSet<Guid> ordered;
+            Array<Guid> prefetchAssets;
+            for (const Guid& sceneId : scenes)
+            {
+                if (ordered.Add(sceneId))
+                    packagingOrder.Add(sceneId);
+                prefetchAssets.Clear();
+                if (ContentPrefetch::LoadManifest(sceneId, prefetchAssets))
+                    continue;
+                for (const Guid& assetId : prefetchAssets)
+                {
+                    if (AssetsRegistry.ContainsKey(assetId) && ordered.Add(assetId))
+                        packagingOrder.Add(assetId);
+                }
+            }
+            for (auto i = AssetsRegistry.Begin(); i.IsNotEnd(); ++i)
+            {
+                if (!ordered.Contains(i->Key))
+                    packagingOrder.Add(i->Key);
+            }
+        }
+
         subStepIndex = 0;
-        for (auto i = AssetsRegistry.Begin(); i.IsNotEnd(); ++i)
+        for (const Guid& assetId : packagingOrder)
         {
             BUILD_STEP_CANCEL_CHECK;
 
             data.StepProgress(Step2Info, Math::Lerp(Step2ProgressStart, Step2ProgressEnd, static_cast<float>(subStepIndex++) / AssetsRegistry.Count()));
-            const auto assetId = i->Key;
+            auto& entry = AssetsRegistry[assetId];
 
             String cookedFilePath;
             cache.GetFilePath(assetId, cookedFilePath);
@@ -1242,11 +1481,11 @@ bool CookAssetsStep::Perform(CookingData& data)
                 continue;
             }
 
-            auto& assetStats = data.Stats.AssetStats[i->Value.Info.TypeName];
+            auto& assetStats = data.Stats.AssetStats[entry.Info.TypeName];
             assetStats.Count++;
             assetStats.ContentSize += FileSystem::GetFileSize(cookedFilePath);
 
-            if (packageBuilder.Add(data, i->Value, cookedFilePath))
+            if (packageBuilder.Add(data, entry, cookedFilePath))
                 return true;
         }
         if (packageBuilder.Package(data))
@@ -1290,6 +1529,22 @@ bool CookAssetsStep::Perform(CookingData& data)
         return true;
     }
 
+    // Deploy the scenes prefetch manifests recorded in Editor (skip assets not included in the build)
+    for (auto i = AssetsRegistry.Begin(); i.IsNotEnd(); ++i)
+    {
+        Array<Guid> prefetchAssets;
+        if (i->Value.Info.TypeName != TEXT("FlaxEngine.SceneAsset") || ContentPrefetch::LoadManifest(i->Key, prefetchAssets))
+            continue;
+        for (int32 j = prefetchAssets.Count() - 1; j >= 0; j--)
+        {
+            if (!AssetsRegistry.ContainsKey(prefetchAssets[j]))
+                prefetchAssets.RemoveAtKeepOrder(j);
+        }
+        const String manifestPath = data.DataOutputPath / TEXT("Content/Prefetch") / i->Key.ToString(Guid::FormatType::N) + TEXT(".bin");
+        if (ContentPrefetch::SaveManifest(manifestPath, prefetchAssets))
+            LOG(Warning, "Failed to deploy prefetch manifest for scene {0}", i->Key);
+    }
+
     // Print stats
     LOG(Info, "Cooked {0} assets, total assets: {1}, total content packages size: {2} MB", data.Stats.CookedAssets, AssetsRegistry.Count(), data.Stats.ContentSizeMB);
     {
@@ -7,7 +7,10 @@
 #include "Engine/Core/Types/Pair.h"
 #include "Engine/Core/Types/DateTime.h"
 #include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Core/Collections/HashSet.h"
+#include "Engine/Platform/CriticalSection.h"
 #include "Engine/Content/AssetInfo.h"
+#include "Engine/Content/AssetReference.h"
 #include "Engine/Content/Cache/AssetsCache.h"
 
 class Asset;
@@ -97,6 +100,7 @@ class FLAXENGINE_API CookAssetsStep : public GameCooker::BuildStep
             {
                 bool ShadersNoOptimize;
                 bool ShadersGenerateDebugData;
+                int32 ShadersMaxShadowsQuality;
                 Guid StreamingSettingsAssetId;
                 int32 ShadersVersion;
                 int32 MaterialGraphVersion;
@@ -109,6 +113,11 @@ class FLAXENGINE_API CookAssetsStep : public GameCooker::BuildStep
         /// </summary>
         Dictionary<Guid, CacheEntry> Entries;
 
+        /// <summary>
+        /// The cached entries access lock (assets can be cooked concurrently).
+        /// </summary>
+        CriticalSection Locker;
+
     public:
 
         /// <summary>
@@ -122,7 +131,7 @@ class FLAXENGINE_API CookAssetsStep : public GameCooker::BuildStep
         }
 
         /// <summary>
-        /// Creates the new entry for the cooked asset file.
+        /// Creates the new entry for the cooked asset file. Requires Locker to be taken by the caller.
         /// </summary>
         /// <param name="asset">The asset.</param>
         /// <param name="cachedFilePath">The cached file path to use for creating cache storage.</param>
@@ -130,7 +139,7 @@ class FLAXENGINE_API CookAssetsStep : public GameCooker::BuildStep
         CacheEntry& CreateEntry(const JsonAssetBase* asset, String& cachedFilePath);
 
         /// <summary>
-        /// Creates the new entry for the cooked asset file.
+        /// Creates the new entry for the cooked asset file. Requires Locker to be taken by the caller.
         /// </summary>
         /// <param name="asset">The asset.</param>
         /// <param name="cachedFilePath">The cached file path to use for creating cache storage.</param>
@@ -169,6 +178,11 @@ class FLAXENGINE_API CookAssetsStep : public GameCooker::BuildStep
     /// </summary>
     static Dictionary<String, ProcessAssetFunc> AssetProcessors;
 
+    /// <summary>
+    /// The asset types (full typename) with thread-safe processors that can cook multiple assets at once on job threads. Assets using the default processor are always cooked concurrently, other assets are cooked one by one.
+    /// </summary>
+    static HashSet<String> ConcurrentAssetProcessors;
+
     static bool ProcessDefaultAsset(AssetCookData& options);
     
 private:
@@ -179,6 +193,8 @@ class FLAXENGINE_API CookAssetsStep : public GameCooker::BuildStep
     bool Process(CookingData& data, CacheData& cache, Asset* asset);
     bool Process(CookingData& data, CacheData& cache, BinaryAsset* asset);
     bool Process(CookingData& data, CacheData& cache, JsonAssetBase* asset);
+    bool Process(CookingData& data, CacheData& cache, const Array<AssetReference<Asset>>& assets);
+    static bool CanProcessConcurrently(const StringView& typeName);
 
 public:
 
@@ -30,6 +30,13 @@ bool DeployDataStep::Perform(CookingData& data)
         Platform::Sleep(10);
     }
     FileSystem::CreateDirectory(contentDir);
+    if (data.Platform == BuildPlatform::Windows32 || data.Platform == BuildPlatform::Windows64)
+    {
+        // Deploy pipeline states recorded in Editor to create them ahead in game (DirectX 12)
+        const String pipelinesList = Globals::ProjectCacheFolder / TEXT("DX12Pipeline.list");
+        if (FileSystem::FileExists(pipelinesList))
+            FileSystem::CopyFile(contentDir / TEXT("DX12Pipeline.list"), pipelinesList);
+    }
     const String dstMono = data.DataOutputPath / TEXT("Mono");
 #if USE_NETCORE
     {
@@ -335,6 +342,10 @@ bool DeployDataStep::Perform(CookingData& data)
     data.AddRootEngineAsset(TEXT("Shaders/MotionBlur"));
     data.AddRootEngineAsset(TEXT("Shaders/BitonicSort"));
     data.AddRootEngineAsset(TEXT("Shaders/GPUParticlesSorting"));
+    data.AddRootEngineAsset(TEXT("Shaders/GPUDrivenCulling"));
+    data.AddRootEngineAsset(TEXT("Shaders/HiZ"));
+    data.AddRootEngineAsset(TEXT("Shaders/ClusteredLighting"));
+    data.AddRootEngineAsset(TEXT("Shaders/VariableRateShading"));
     data.AddRootEngineAsset(TEXT("Shaders/GlobalSignDistanceField"));
     data.AddRootEngineAsset(TEXT("Shaders/GI/GlobalSurfaceAtlas"));
     data.AddRootEngineAsset(TEXT("Shaders/GI/DDGI"));
@@ -1333,6 +1333,16 @@ public void BuildNavMesh()
             Scene.MarkSceneEdited(scenes);
         }
 
+        /// <summary>
+        /// Builds HLOD proxy models for all open scenes.
+        /// </summary>
+        public void BuildHLODs()
+        {
+            var scenes = Level.Scenes;
+            scenes.ToList().ForEach(x => x.BuildHLOD());
+            Scene.MarkSceneEdited(scenes);
+        }
+
         /// <summary>
         /// Builds SDF for all static models in the scene.
         /// </summary>
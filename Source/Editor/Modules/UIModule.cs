@@ -74,6 +74,7 @@ public sealed class UIModule : EditorModule
         private ContextMenuButton _menuToolsBuildCSGMesh;
         private ContextMenuButton _menuToolsBuildNavMesh;
         private ContextMenuButton _menuToolsBuildAllMeshesSDF;
+        private ContextMenuButton _menuToolsBuildHLODs;
         private ContextMenuButton _menuToolsCancelBuilding;
         private ContextMenuButton _menuToolsProfilerWindow;
         private ContextMenuButton _menuToolsSetTheCurrentSceneViewAsDefault;
@@ -610,6 +611,7 @@ private void InitMainMenu(RootControl mainWindow)
             _menuToolsBuildCSGMesh = cm.AddButton("Build CSG mesh", inputOptions.BuildCSG, Editor.BuildCSG);
             _menuToolsBuildNavMesh = cm.AddButton("Build Nav Mesh", inputOptions.BuildNav, Editor.BuildNavMesh);
             _menuToolsBuildAllMeshesSDF = cm.AddButton("Build all meshes SDF", inputOptions.BuildSDF, Editor.BuildAllMeshesSDF);
+            _menuToolsBuildHLODs = cm.AddButton("Build HLODs", Editor.BuildHLODs);
             cm.AddSeparator();
             cm.AddButton("Game Cooker", Editor.Windows.GameCookerWin.FocusOrShow);
             _menuToolsCancelBuilding = cm.AddButton("Cancel building game", () => GameCooker.Cancel());
@@ -943,6 +945,7 @@ private void OnMenuToolsShowHide(Control control)
             _menuToolsClearLightmaps.Enabled = canEdit;
             _menuToolsBakeAllEnvProbes.Enabled = canEdit;
             _menuToolsBuildAllMeshesSDF.Enabled = canEdit && !isBakingLightmaps;
+            _menuToolsBuildHLODs.Enabled = canEdit && !isBakingLightmaps;
             _menuToolsBuildCSGMesh.Enabled = canEdit;
             _menuToolsBuildNavMesh.Enabled = canEdit;
             _menuToolsCancelBuilding.Enabled = GameCooker.IsRunning;
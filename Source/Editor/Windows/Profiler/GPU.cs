@@ -113,17 +113,41 @@ public GPU()
                         TitleColor = textColor,
                         FormatValue = FormatCountLong,
                     },
+                    new ColumnDefinition
+                    {
+                        Title = "Barriers",
+                        TitleBackgroundColor = headerColor,
+                        TitleColor = textColor,
+                        FormatValue = FormatCountLong,
+                    },
+                    new ColumnDefinition
+                    {
+                        Title = "PS Invocations",
+                        TitleBackgroundColor = headerColor,
+                        TitleColor = textColor,
+                        FormatValue = FormatCountLong,
+                    },
+                    new ColumnDefinition
+                    {
+                        Title = "CS Invocations",
+                        TitleBackgroundColor = headerColor,
+                        TitleColor = textColor,
+                        FormatValue = FormatCountLong,
+                    },
                 },
                 Parent = layout,
             };
             _table.Splits = new[]
             {
-                0.5f,
-                0.1f,
-                0.1f,
-                0.1f,
-                0.1f,
-                0.1f,
+                0.36f,
+                0.08f,
+                0.08f,
+                0.08f,
+                0.08f,
+                0.08f,
+                0.08f,
+                0.08f,
+                0.08f,
             };
         }
 
@@ -341,8 +365,8 @@ private void UpdateTableInner()
                 {
                     row = new Row
                     {
-                        Values = new object[6],
-                        BackgroundColors = new Color[6],
+                        Values = new object[9],
+                        BackgroundColors = new Color[9],
                     };
                     for (int k = 0; k < row.BackgroundColors.Length; k++)
                         row.BackgroundColors[k] = Color.Transparent;
@@ -367,6 +391,15 @@ private void UpdateTableInner()
 
                     // Vertices
                     row.Values[5] = e.Stats.Vertices;
+
+                    // Barriers
+                    row.Values[6] = e.Stats.ResourceBarriers;
+
+                    // PS Invocations (pipeline statistics)
+                    row.Values[7] = e.Stats.PSInvocations;
+
+                    // CS Invocations (pipeline statistics)
+                    row.Values[8] = e.Stats.CSInvocations;
                 }
                 row.Depth = e.Depth;
                 row.Width = _table.Width;
@@ -1,6 +1,7 @@
 // Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
 
 using System;
+using FlaxEngine;
 using FlaxEngine.GUI;
 
 namespace FlaxEditor.Windows.Profiler
@@ -13,6 +14,7 @@ internal sealed class Memory : ProfilerMode
     {
         private readonly SingleChart _nativeAllocationsChart;
         private readonly SingleChart _managedAllocationsChart;
+        private readonly SingleChart[] _memoryTagsCharts;
 
         public Memory()
         : base("Memory")
@@ -47,6 +49,21 @@ public Memory()
                 Parent = layout,
             };
             _managedAllocationsChart.SelectedSampleChanged += OnSelectedSampleChanged;
+
+            // Native memory per tag
+            var tags = (MemoryTag[])Enum.GetValues(typeof(MemoryTag));
+            _memoryTagsCharts = new SingleChart[(int)MemoryTag.MAX];
+            for (int i = 0; i < _memoryTagsCharts.Length; i++)
+            {
+                var chart = new SingleChart
+                {
+                    Title = "Native Memory: " + tags[i],
+                    FormatSample = v => Utilities.Utils.FormatBytesCount((ulong)v),
+                    Parent = layout,
+                };
+                chart.SelectedSampleChanged += OnSelectedSampleChanged;
+                _memoryTagsCharts[i] = chart;
+            }
         }
 
         /// <inheritdoc />
@@ -54,6 +71,8 @@ public override void Clear()
         {
             _nativeAllocationsChart.Clear();
             _managedAllocationsChart.Clear();
+            for (int i = 0; i < _memoryTagsCharts.Length; i++)
+                _memoryTagsCharts[i].Clear();
         }
 
         /// <inheritdoc />
@@ -81,6 +100,11 @@ public override void Update(ref SharedUpdateData sharedData)
 
             _nativeAllocationsChart.AddSample(nativeMemoryAllocation);
             _managedAllocationsChart.AddSample(managedMemoryAllocation);
+
+            // Native memory usage per tag
+            var memoryTags = ProfilingTools.MemoryTagsStats;
+            for (int i = 0; i < _memoryTagsCharts.Length; i++)
+                _memoryTagsCharts[i].AddSample(memoryTags != null && i < memoryTags.Length ? memoryTags[i].CurrentBytes : 0);
         }
 
         /// <inheritdoc />
@@ -88,6 +112,8 @@ public override void UpdateView(int selectedFrame, bool showOnlyLastUpdateEvents
         {
             _nativeAllocationsChart.SelectedSampleIndex = selectedFrame;
             _managedAllocationsChart.SelectedSampleIndex = selectedFrame;
+            for (int i = 0; i < _memoryTagsCharts.Length; i++)
+                _memoryTagsCharts[i].SelectedSampleIndex = selectedFrame;
         }
     }
 }
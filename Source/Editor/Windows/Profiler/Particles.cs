@@ -0,0 +1,105 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+using FlaxEngine;
+using FlaxEngine.GUI;
+
+namespace FlaxEditor.Windows.Profiler
+{
+    /// <summary>
+    /// The particles simulation profiling mode with effects and particles budgets usage charts.
+    /// </summary>
+    /// <seealso cref="FlaxEditor.Windows.Profiler.ProfilerMode" />
+    internal sealed class Particles : ProfilerMode
+    {
+        private readonly SingleChart _effectsChart;
+        private readonly SingleChart _updatedEffectsChart;
+        private readonly SingleChart _culledEffectsChart;
+        private readonly SingleChart _cpuParticlesChart;
+        private readonly SingleChart _gpuParticlesChart;
+        private readonly SingleChart _cpuBudgetChart;
+        private readonly SingleChart _gpuBudgetChart;
+
+        public Particles()
+        : base("Particles")
+        {
+            // Layout
+            var panel = new Panel(ScrollBars.Vertical)
+            {
+                AnchorPreset = AnchorPresets.StretchAll,
+                Offsets = Margin.Zero,
+                Parent = this,
+            };
+            var layout = new VerticalPanel
+            {
+                AnchorPreset = AnchorPresets.HorizontalStretchTop,
+                Offsets = Margin.Zero,
+                IsScrollable = true,
+                Parent = panel,
+            };
+
+            // Charts
+            _effectsChart = AddChart(layout, "Effects");
+            _updatedEffectsChart = AddChart(layout, "Updated Effects");
+            _culledEffectsChart = AddChart(layout, "Culled Effects (over budget)");
+            _cpuParticlesChart = AddChart(layout, "CPU Particles");
+            _gpuParticlesChart = AddChart(layout, "GPU Particles");
+            _cpuBudgetChart = AddChart(layout, "CPU Particles Budget Usage", v => Mathf.RoundToInt(v) + "%");
+            _gpuBudgetChart = AddChart(layout, "GPU Particles Budget Usage", v => Mathf.RoundToInt(v) + "%");
+        }
+
+        private SingleChart AddChart(VerticalPanel layout, string title, System.Func<float, string> formatSample = null)
+        {
+            var chart = new SingleChart
+            {
+                Title = title,
+                Parent = layout,
+            };
+            if (formatSample != null)
+                chart.FormatSample = formatSample;
+            chart.SelectedSampleChanged += OnSelectedSampleChanged;
+            return chart;
+        }
+
+        private static float GetBudgetUsage(int count, int budget)
+        {
+            return budget > 0 ? count * 100.0f / budget : 0.0f;
+        }
+
+        /// <inheritdoc />
+        public override void Clear()
+        {
+            _effectsChart.Clear();
+            _updatedEffectsChart.Clear();
+            _culledEffectsChart.Clear();
+            _cpuParticlesChart.Clear();
+            _gpuParticlesChart.Clear();
+            _cpuBudgetChart.Clear();
+            _gpuBudgetChart.Clear();
+        }
+
+        /// <inheritdoc />
+        public override void Update(ref SharedUpdateData sharedData)
+        {
+            ref var stats = ref sharedData.Stats.Particles;
+            _effectsChart.AddSample(stats.EffectsCount);
+            _updatedEffectsChart.AddSample(stats.UpdatedEffectsCount);
+            _culledEffectsChart.AddSample(stats.CulledEffectsCount);
+            _cpuParticlesChart.AddSample(stats.CPUParticlesCount);
+            _gpuParticlesChart.AddSample(stats.GPUParticlesCount);
+            _cpuBudgetChart.AddSample(GetBudgetUsage(stats.CPUParticlesCount, stats.CPUParticlesBudget));
+            _gpuBudgetChart.AddSample(GetBudgetUsage(stats.GPUParticlesCount, stats.GPUParticlesBudget));
+        }
+
+        /// <inheritdoc />
+        public override void UpdateView(int selectedFrame, bool showOnlyLastUpdateEvents)
+        {
+            _effectsChart.SelectedSampleIndex = selectedFrame;
+            _updatedEffectsChart.SelectedSampleIndex = selectedFrame;
+            _culledEffectsChart.SelectedSampleIndex = selectedFrame;
+            _cpuParticlesChart.SelectedSampleIndex = selectedFrame;
+            _gpuParticlesChart.SelectedSampleIndex = selectedFrame;
+            _cpuBudgetChart.SelectedSampleIndex = selectedFrame;
+            _gpuBudgetChart.SelectedSampleIndex = selectedFrame;
+        }
+    }
+}
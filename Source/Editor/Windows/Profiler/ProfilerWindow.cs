@@ -211,8 +211,11 @@ public override void OnInit()
             AddMode(new MemoryGPU());
             AddMode(new Memory());
             AddMode(new Assets());
+            AddMode(new Streaming());
+            AddMode(new Particles());
             AddMode(new Network());
             AddMode(new Physics());
+            AddMode(new Threads());
 
             // Init view
             _frameIndex = -1;
@@ -0,0 +1,120 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+using FlaxEngine;
+using FlaxEngine.GUI;
+
+namespace FlaxEditor.Windows.Profiler
+{
+    /// <summary>
+    /// The content streaming profiling mode with resources residency, I/O and GPU uploads charts.
+    /// </summary>
+    /// <seealso cref="FlaxEditor.Windows.Profiler.ProfilerMode" />
+    internal sealed class Streaming : ProfilerMode
+    {
+        private readonly SingleChart _streamingResourcesChart;
+        private readonly SingleChart _streamingTexturesChart;
+        private readonly SingleChart _streamingModelsChart;
+        private readonly SingleChart _budgetLimitedChart;
+        private readonly SingleChart _texturesMemoryChart;
+        private readonly SingleChart _requestedBytesChart;
+        private readonly SingleChart _uploadedBytesChart;
+        private readonly SingleChart _evictionsChart;
+        private readonly SingleChart _updatesChart;
+        private readonly SingleChart _updateTimeChart;
+        private readonly SingleChart _timeToResidencyChart;
+
+        public Streaming()
+        : base("Streaming")
+        {
+            // Layout
+            var panel = new Panel(ScrollBars.Vertical)
+            {
+                AnchorPreset = AnchorPresets.StretchAll,
+                Offsets = Margin.Zero,
+                Parent = this,
+            };
+            var layout = new VerticalPanel
+            {
+                AnchorPreset = AnchorPresets.HorizontalStretchTop,
+                Offsets = Margin.Zero,
+                IsScrollable = true,
+                Parent = panel,
+            };
+
+            // Charts
+            _streamingResourcesChart = AddChart(layout, "Streaming Resources");
+            _streamingTexturesChart = AddChart(layout, "Streaming Textures");
+            _streamingModelsChart = AddChart(layout, "Streaming Models");
+            _budgetLimitedChart = AddChart(layout, "Budget Limited Resources");
+            _texturesMemoryChart = AddChart(layout, "Textures Memory", v => Utilities.Utils.FormatBytesCount((ulong)v));
+            _requestedBytesChart = AddChart(layout, "Requested Data", v => Utilities.Utils.FormatBytesCount((ulong)v));
+            _uploadedBytesChart = AddChart(layout, "Uploaded Data (GPU)", v => Utilities.Utils.FormatBytesCount((ulong)v));
+            _evictionsChart = AddChart(layout, "Evictions");
+            _updatesChart = AddChart(layout, "Updated Resources");
+            _updateTimeChart = AddChart(layout, "Update Time", v => (Mathf.RoundToInt(v * 100.0f) / 100.0f) + " ms");
+            _timeToResidencyChart = AddChart(layout, "Time To Residency (90th percentile)", v => Mathf.RoundToInt(v) + " ms");
+        }
+
+        private SingleChart AddChart(VerticalPanel layout, string title, System.Func<float, string> formatSample = null)
+        {
+            var chart = new SingleChart
+            {
+                Title = title,
+                Parent = layout,
+            };
+            if (formatSample != null)
+                chart.FormatSample = formatSample;
+            chart.SelectedSampleChanged += OnSelectedSampleChanged;
+            return chart;
+        }
+
+        /// <inheritdoc />
+        public override void Clear()
+        {
+            _streamingResourcesChart.Clear();
+            _streamingTexturesChart.Clear();
+            _streamingModelsChart.Clear();
+            _budgetLimitedChart.Clear();
+            _texturesMemoryChart.Clear();
+            _requestedBytesChart.Clear();
+            _uploadedBytesChart.Clear();
+            _evictionsChart.Clear();
+            _updatesChart.Clear();
+            _updateTimeChart.Clear();
+            _timeToResidencyChart.Clear();
+        }
+
+        /// <inheritdoc />
+        public override void Update(ref SharedUpdateData sharedData)
+        {
+            ref var stats = ref sharedData.Stats.Streaming;
+            _streamingResourcesChart.AddSample(stats.StreamingResourcesCount);
+            _streamingTexturesChart.AddSample(stats.StreamingTexturesCount);
+            _streamingModelsChart.AddSample(stats.StreamingModelsCount + stats.StreamingSkinnedModelsCount);
+            _budgetLimitedChart.AddSample(stats.BudgetLimitedResourcesCount);
+            _texturesMemoryChart.AddSample(stats.TexturesMemoryUsage);
+            _requestedBytesChart.AddSample(stats.RequestedBytes);
+            _uploadedBytesChart.AddSample(stats.UploadedBytes);
+            _evictionsChart.AddSample(stats.EvictionsCount);
+            _updatesChart.AddSample(stats.UpdatedResourcesCount);
+            _updateTimeChart.AddSample(stats.UpdateTimeMs);
+            _timeToResidencyChart.AddSample(stats.TimeToResidencyP90);
+        }
+
+        /// <inheritdoc />
+        public override void UpdateView(int selectedFrame, bool showOnlyLastUpdateEvents)
+        {
+            _streamingResourcesChart.SelectedSampleIndex = selectedFrame;
+            _streamingTexturesChart.SelectedSampleIndex = selectedFrame;
+            _streamingModelsChart.SelectedSampleIndex = selectedFrame;
+            _budgetLimitedChart.SelectedSampleIndex = selectedFrame;
+            _texturesMemoryChart.SelectedSampleIndex = selectedFrame;
+            _requestedBytesChart.SelectedSampleIndex = selectedFrame;
+            _uploadedBytesChart.SelectedSampleIndex = selectedFrame;
+            _evictionsChart.SelectedSampleIndex = selectedFrame;
+            _updatesChart.SelectedSampleIndex = selectedFrame;
+            _updateTimeChart.SelectedSampleIndex = selectedFrame;
+            _timeToResidencyChart.SelectedSampleIndex = selectedFrame;
+        }
+    }
+}
@@ -0,0 +1,155 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+using System;
+using FlaxEngine;
+using FlaxEngine.GUI;
+
+namespace FlaxEditor.Windows.Profiler
+{
+    /// <summary>
+    /// The worker threads (Job System and Thread Pool) profiling mode.
+    /// </summary>
+    /// <seealso cref="FlaxEditor.Windows.Profiler.ProfilerMode" />
+    internal sealed class Threads : ProfilerMode
+    {
+        private readonly SingleChart _jobsUsageChart;
+        private readonly SingleChart _jobsMinUsageChart;
+        private readonly SingleChart _jobsCountChart;
+        private readonly SingleChart _jobsStealsChart;
+        private readonly SingleChart _jobsQueueChart;
+        private readonly SingleChart _jobsLatencyChart;
+        private readonly SingleChart _poolUsageChart;
+        private readonly SingleChart _poolCountChart;
+        private readonly SingleChart _poolQueueChart;
+        private readonly SingleChart _poolLatencyChart;
+
+        public Threads()
+        : base("Threads")
+        {
+            // Layout
+            var panel = new Panel(ScrollBars.Vertical)
+            {
+                AnchorPreset = AnchorPresets.StretchAll,
+                Offsets = Margin.Zero,
+                Parent = this,
+            };
+            var layout = new VerticalPanel
+            {
+                AnchorPreset = AnchorPresets.HorizontalStretchTop,
+                Offsets = Margin.Zero,
+                IsScrollable = true,
+                Parent = panel,
+            };
+
+            // Charts
+            _jobsUsageChart = AddChart(layout, "Job System Usage", FormatPercentage);
+            _jobsMinUsageChart = AddChart(layout, "Job System Usage (least busy thread)", FormatPercentage);
+            _jobsCountChart = AddChart(layout, "Job System Jobs", null);
+            _jobsStealsChart = AddChart(layout, "Job System Steals", null);
+            _jobsQueueChart = AddChart(layout, "Job System Queue Depth", null);
+            _jobsLatencyChart = AddChart(layout, "Job System Latency", FormatTime);
+            _poolUsageChart = AddChart(layout, "Thread Pool Usage", FormatPercentage);
+            _poolCountChart = AddChart(layout, "Thread Pool Tasks", null);
+            _poolQueueChart = AddChart(layout, "Thread Pool Queue Depth", null);
+            _poolLatencyChart = AddChart(layout, "Thread Pool Latency", FormatTime);
+        }
+
+        private SingleChart AddChart(VerticalPanel layout, string title, Func<float, string> format)
+        {
+            var chart = new SingleChart
+            {
+                Title = title,
+                Parent = layout,
+            };
+            if (format != null)
+                chart.FormatSample = format;
+            chart.SelectedSampleChanged += OnSelectedSampleChanged;
+            return chart;
+        }
+
+        private static string FormatPercentage(float v)
+        {
+            return Mathf.RoundToInt(v) + "%";
+        }
+
+        private static string FormatTime(float v)
+        {
+            return (Mathf.RoundToInt(v * 1000.0f) / 1000.0f) + " ms";
+        }
+
+        /// <inheritdoc />
+        public override void Clear()
+        {
+            _jobsUsageChart.Clear();
+            _jobsMinUsageChart.Clear();
+            _jobsCountChart.Clear();
+            _jobsStealsChart.Clear();
+            _jobsQueueChart.Clear();
+            _jobsLatencyChart.Clear();
+            _poolUsageChart.Clear();
+            _poolCountChart.Clear();
+            _poolQueueChart.Clear();
+            _poolLatencyChart.Clear();
+        }
+
+        /// <inheritdoc />
+        public override void Update(ref SharedUpdateData sharedData)
+        {
+            var stats = ProfilingTools.WorkersStats;
+            if (stats == null)
+                return;
+            float jobsBusy = 0, jobsTotal = 0, jobsMinUsage = 100.0f, jobsLatency = 0;
+            float poolBusy = 0, poolTotal = 0, poolLatency = 0;
+            int jobsCount = 0, jobsSteals = 0, jobsQueue = 0, poolCount = 0, poolQueue = 0;
+            for (int i = 0; i < stats.Length; i++)
+            {
+                ref var e = ref stats[i];
+                var total = e.BusyTimeMs + e.IdleTimeMs;
+                if (e.Name.StartsWith("Job System"))
+                {
+                    jobsBusy += e.BusyTimeMs;
+                    jobsTotal += total;
+                    jobsMinUsage = Mathf.Min(jobsMinUsage, total > 0 ? e.BusyTimeMs / total * 100.0f : 0.0f);
+                    jobsLatency += e.LatencyMs * e.JobsCount;
+                    jobsCount += e.JobsCount;
+                    jobsSteals += e.StealsCount;
+                    jobsQueue += e.QueueDepth;
+                }
+                else
+                {
+                    poolBusy += e.BusyTimeMs;
+                    poolTotal += total;
+                    poolLatency += e.LatencyMs * e.JobsCount;
+                    poolCount += e.JobsCount;
+                    poolQueue = e.QueueDepth; // Shared queue
+                }
+            }
+
+            _jobsUsageChart.AddSample(jobsTotal > 0 ? jobsBusy / jobsTotal * 100.0f : 0.0f);
+            _jobsMinUsageChart.AddSample(jobsTotal > 0 ? jobsMinUsage : 0.0f);
+            _jobsCountChart.AddSample(jobsCount);
+            _jobsStealsChart.AddSample(jobsSteals);
+            _jobsQueueChart.AddSample(jobsQueue);
+            _jobsLatencyChart.AddSample(jobsCount > 0 ? jobsLatency / jobsCount : 0.0f);
+            _poolUsageChart.AddSample(poolTotal > 0 ? poolBusy / poolTotal * 100.0f : 0.0f);
+            _poolCountChart.AddSample(poolCount);
+            _poolQueueChart.AddSample(poolQueue);
+            _poolLatencyChart.AddSample(poolCount > 0 ? poolLatency / poolCount : 0.0f);
+        }
+
+        /// <inheritdoc />
+        public override void UpdateView(int selectedFrame, bool showOnlyLastUpdateEvents)
+        {
+            _jobsUsageChart.SelectedSampleIndex = selectedFrame;
+            _jobsMinUsageChart.SelectedSampleIndex = selectedFrame;
+            _jobsCountChart.SelectedSampleIndex = selectedFrame;
+            _jobsStealsChart.SelectedSampleIndex = selectedFrame;
+            _jobsQueueChart.SelectedSampleIndex = selectedFrame;
+            _jobsLatencyChart.SelectedSampleIndex = selectedFrame;
+            _poolUsageChart.SelectedSampleIndex = selectedFrame;
+            _poolCountChart.SelectedSampleIndex = selectedFrame;
+            _poolQueueChart.SelectedSampleIndex = selectedFrame;
+            _poolLatencyChart.SelectedSampleIndex = selectedFrame;
+        }
+    }
+}
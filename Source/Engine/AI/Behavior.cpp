@@ -22,6 +22,7 @@ class BehaviorService : public EngineService
 {
 public:
     Array<Behavior*> UpdateList;
+    uint32 StaggerIndex = 0;
 
     BehaviorService()
         : EngineService(TEXT("Behaviors"), 0)
@@ -125,9 +126,13 @@ void Behavior::StartLogic()
 
     // Setup state
     _result = BehaviorUpdateResult::Running;
-    _accumulatedTime = 0.0f;
     _totalTime = 0;
 
+    // Stagger the update phase (via Fibonacci hashing of the start index) to spread behaviors with the same update rate evenly across frames
+    const float updateDeltaTime = 1.0f / Math::Max(tree->Graph.Root->UpdateFPS * UpdateRateScale, ZeroTolerance);
+    const float phase = (float)((BehaviorServiceInstance.StaggerIndex++ * 2654435769u) >> 8) * (1.0f / 16777216.0f);
+    _accumulatedTime = updateDeltaTime * phase;
+
     // Init knowledge
     _knowledge.InitMemory(tree);
 }
@@ -152,6 +152,7 @@ void BehaviorKnowledge::InitMemory(BehaviorTree* tree)
     Blackboard = Variant::NewValue(tree->Graph.Root->BlackboardType);
     RelevantNodes.Resize(tree->Graph.NodesCount, false);
     RelevantNodes.SetAll(false);
+    Version++;
     if (!Memory && tree->Graph.NodesStatesSize)
     {
         Memory = Allocator::Allocate(tree->Graph.NodesStatesSize);
@@ -188,6 +189,8 @@ void BehaviorKnowledge::FreeMemory()
     for (Variant& goal : Goals)
         goal.DeleteValue();
     Goals.Resize(0);
+    _cachedConditions.Clear();
+    Version++;
     Tree = nullptr;
 }
 
@@ -198,7 +201,30 @@ bool BehaviorKnowledge::Get(const StringAnsiView& path, Variant& value) const
 
 bool BehaviorKnowledge::Set(const StringAnsiView& path, const Variant& value)
 {
-    return AccessBehaviorKnowledge(this, path, const_cast<Variant&>(value), true);
+    if (!AccessBehaviorKnowledge(this, path, const_cast<Variant&>(value), true))
+        return false;
+    Version++;
+    return true;
+}
+
+bool BehaviorKnowledge::GetCachedCondition(const BehaviorTreeNode* node, bool& result) const
+{
+    if (!Tree || !Tree->Graph.Root->CacheConditions)
+        return false;
+    const CachedCondition* e = _cachedConditions.TryGet(node);
+    if (!e || e->Version != Version)
+        return false;
+    result = e->Result;
+    return true;
+}
+
+void BehaviorKnowledge::SetCachedCondition(const BehaviorTreeNode* node, bool result)
+{
+    if (!Tree || !Tree->Graph.Root->CacheConditions)
+        return;
+    CachedCondition& e = _cachedConditions[node];
+    e.Version = Version;
+    e.Result = result;
 }
 
 bool BehaviorKnowledge::HasGoal(ScriptingTypeHandle type) const
@@ -234,6 +260,7 @@ void BehaviorKnowledge::AddGoal(Variant&& goal)
     if (i == Goals.Count())
         Goals.AddDefault();
     Goals.Get()[i] = MoveTemp(goal);
+    Version++;
 }
 
 void BehaviorKnowledge::RemoveGoal(ScriptingTypeHandle type)
@@ -244,6 +271,7 @@ void BehaviorKnowledge::RemoveGoal(ScriptingTypeHandle type)
         if (goalType == type)
         {
             Goals.RemoveAt(i);
+            Version++;
             break;
         }
     }
@@ -5,10 +5,12 @@
 #include "Engine/Core/Types/Variant.h"
 #include "Engine/Core/Collections/Array.h"
 #include "Engine/Core/Collections/BitArray.h"
+#include "Engine/Core/Collections/Dictionary.h"
 #include "Engine/Scripting/ScriptingObject.h"
 
 class Behavior;
 class BehaviorTree;
+class BehaviorTreeNode;
 enum class BehaviorValueComparison;
 
 /// <summary>
@@ -49,6 +51,20 @@ API_CLASS() class FLAXENGINE_API BehaviorKnowledge : public ScriptingObject
     /// </summary>
     API_FIELD() Array<Variant> Goals;
 
+    /// <summary>
+    /// Knowledge modification counter. Incremented on every change made via knowledge API (eg. Set, AddGoal or RemoveGoal) to invalidate cached conditions.
+    /// </summary>
+    API_FIELD(ReadOnly) uint32 Version = 0;
+
+private:
+    struct CachedCondition
+    {
+        uint32 Version;
+        bool Result;
+    };
+
+    Dictionary<const BehaviorTreeNode*, CachedCondition> _cachedConditions;
+
 public:
     /// <summary>
     /// Initializes the knowledge for a certain tree.
@@ -78,6 +94,20 @@ API_CLASS() class FLAXENGINE_API BehaviorKnowledge : public ScriptingObject
     /// <returns>True if set value, otherwise false.</returns>
     API_FUNCTION() bool Set(const StringAnsiView& path, const Variant& value);
 
+    /// <summary>
+    /// Marks the knowledge as modified to invalidate any cached conditions. Should be called after modifying Blackboard or Goals directly (without using Set, AddGoal or RemoveGoal).
+    /// </summary>
+    API_FUNCTION() void NotifyChanged()
+    {
+        Version++;
+    }
+
+    // Tries to get the cached result of the knowledge condition evaluated by the node. Returns true if got up-to-date value, otherwise false.
+    bool GetCachedCondition(const BehaviorTreeNode* node, bool& result) const;
+
+    // Caches the result of the knowledge condition evaluated by the node (valid until the knowledge gets modified).
+    void SetCachedCondition(const BehaviorTreeNode* node, bool result);
+
 public:
     /// <summary>
     /// Checks if knowledge has a given goal (exact type match without base class check).
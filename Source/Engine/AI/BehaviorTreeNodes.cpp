@@ -698,19 +698,33 @@ void BehaviorTreeCooldownDecorator::PostUpdate(const BehaviorUpdateContext& cont
 
 bool BehaviorTreeKnowledgeConditionalDecorator::CanUpdate(const BehaviorUpdateContext& context)
 {
-    return BehaviorKnowledge::CompareValues((float)ValueA.Get(context.Knowledge), ValueB, Comparison);
+    bool result;
+    if (context.Knowledge->GetCachedCondition(this, result))
+        return result;
+    result = BehaviorKnowledge::CompareValues((float)ValueA.Get(context.Knowledge), ValueB, Comparison);
+    context.Knowledge->SetCachedCondition(this, result);
+    return result;
 }
 
 bool BehaviorTreeKnowledgeValuesConditionalDecorator::CanUpdate(const BehaviorUpdateContext& context)
 {
-    return BehaviorKnowledge::CompareValues((float)ValueA.Get(context.Knowledge), (float)ValueB.Get(context.Knowledge), Comparison);
+    bool result;
+    if (context.Knowledge->GetCachedCondition(this, result))
+        return result;
+    result = BehaviorKnowledge::CompareValues((float)ValueA.Get(context.Knowledge), (float)ValueB.Get(context.Knowledge), Comparison);
+    context.Knowledge->SetCachedCondition(this, result);
+    return result;
 }
 
 bool BehaviorTreeKnowledgeBooleanDecorator::CanUpdate(const BehaviorUpdateContext& context)
 {
+    bool result;
+    if (context.Knowledge->GetCachedCondition(this, result))
+        return result;
     Variant value = Value.Get(context.Knowledge);
-    bool result = (bool)value;
+    result = (bool)value;
     result ^= Invert;
+    context.Knowledge->SetCachedCondition(this, result);
     return result;
 }
 
@@ -726,6 +740,11 @@ bool BehaviorTreeHasTagDecorator::CanUpdate(const BehaviorUpdateContext& context
 
 bool BehaviorTreeHasGoalDecorator::CanUpdate(const BehaviorUpdateContext& context)
 {
+    bool result;
+    if (context.Knowledge->GetCachedCondition(this, result))
+        return result;
     Variant value; // TODO: use HasGoal in Knowledge to optimize this (goal struct is copied by selector accessor)
-    return Goal.TryGet(context.Knowledge, value);
+    result = Goal.TryGet(context.Knowledge, value);
+    context.Knowledge->SetCachedCondition(this, result);
+    return result;
 }
@@ -96,6 +96,10 @@ API_CLASS(Sealed) class FLAXENGINE_API BehaviorTreeRootNode : public BehaviorTre
     // The target amount of the behavior logic updates per second.
     API_FIELD(Attributes="EditorOrder(100)")
     float UpdateFPS = 10.0f;
+
+    // If checked, the results of the knowledge checks (eg. Knowledge Conditional or Has Goal decorators) are cached and re-evaluated only when the knowledge gets modified (via Set, AddGoal, RemoveGoal or NotifyChanged). Reduces the cost of large trees but requires calling NotifyChanged after direct Blackboard modifications.
+    API_FIELD(Attributes="EditorOrder(110)")
+    bool CacheConditions = false;
 };
 
 /// <summary>
@@ -1,6 +1,7 @@
 // Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
 
 #include "AnimationData.h"
+#include "Engine/Core/SIMD.h"
 
 void NodeAnimationData::Evaluate(float time, Transform* result, bool loop) const
 {
@@ -39,9 +40,250 @@ uint64 NodeAnimationData::GetMemoryUsage() const
     return NodeName.Length() * sizeof(Char) + Position.GetMemoryUsage() + Rotation.GetMemoryUsage() + Scale.GetMemoryUsage();
 }
 
+namespace
+{
+    template<typename T>
+    void SampleCurve(const LinearCurve<T>& curve, int32 framesCount, Array<Float4>& samples)
+    {
+        samples.Resize(framesCount);
+        T value;
+        for (int32 frame = 0; frame < framesCount; frame++)
+        {
+            curve.Evaluate(value, (float)frame, false);
+            samples[frame] = Float4(value.X, value.Y, value.Z, 0.0f);
+        }
+    }
+
+    void SampleCurve(const LinearCurve<Quaternion>& curve, int32 framesCount, Array<Float4>& samples)
+    {
+        samples.Resize(framesCount);
+        Quaternion value, prev = Quaternion::Identity;
+        for (int32 frame = 0; frame < framesCount; frame++)
+        {
+            curve.Evaluate(value, (float)frame, false);
+            value.Normalize();
+
+            // Keep the rotations in the same hemisphere so interpolation between the samples takes the shortest path
+            if (frame != 0 && Quaternion::Dot(prev, value) < 0.0f)
+                value = value * -1.0f;
+            prev = value;
+            samples[frame] = Float4(value.X, value.Y, value.Z, value.W);
+        }
+    }
+
+    FORCE_INLINE SimdVector4 DecodeSample(const CompressedAnimationData::Track& track, const byte* data)
+    {
+        const SimdVector4 min = SIMD::Load(track.Min.X, track.Min.Y, track.Min.Z, track.Min.W);
+        const SimdVector4 step = SIMD::Load(track.Step.X, track.Step.Y, track.Step.Z, track.Step.W);
+        SimdVector4 value;
+        switch (track.Type)
+        {
+        case CompressedAnimationData::TrackType::Quantized8:
+            value = SIMD::Load((float)data[0], (float)data[1], (float)data[2], track.Components == 4 ? (float)data[3] : 0.0f);
+            return SIMD::Add(min, SIMD::Mul(value, step));
+        case CompressedAnimationData::TrackType::Quantized16:
+        {
+            const uint16* q = (const uint16*)data;
+            value = SIMD::Load((float)q[0], (float)q[1], (float)q[2], track.Components == 4 ? (float)q[3] : 0.0f);
+            return SIMD::Add(min, SIMD::Mul(value, step));
+        }
+        default:
+        {
+            const float* f = (const float*)data;
+            return SIMD::Load(f[0], f[1], f[2], track.Components == 4 ? f[3] : 0.0f);
+        }
+        }
+    }
+}
+
+void CompressedAnimationData::Build(const Array<NodeAnimationData>& channels, double duration, float tolerance)
+{
+    Dispose();
+    FramesCount = Math::Max((int32)Math::Ceil((float)duration), 0) + 1;
+    tolerance = Math::Max(tolerance, ZeroTolerance);
+    Tracks.Resize(channels.Count() * 3);
+
+    // Sample and classify tracks
+    Array<Array<Float4>> samples;
+    samples.Resize(Tracks.Count());
+    for (int32 i = 0; i < Tracks.Count(); i++)
+    {
+        Track& track = Tracks[i];
+        const NodeAnimationData& channel = channels[i / 3];
+        Array<Float4>& trackSamples = samples[i];
+        switch (i % 3)
+        {
+        case 0:
+            if (channel.Position.GetKeyframes().IsEmpty())
+                continue;
+            SampleCurve(channel.Position, FramesCount, trackSamples);
+            track.Components = 3;
+            break;
+        case 1:
+            if (channel.Rotation.GetKeyframes().IsEmpty())
+                continue;
+            SampleCurve(channel.Rotation, FramesCount, trackSamples);
+            track.Components = 4;
+            break;
+        case 2:
+            if (channel.Scale.GetKeyframes().IsEmpty())
+                continue;
+            SampleCurve(channel.Scale, FramesCount, trackSamples);
+            track.Components = 3;
+            break;
+        }
+        Float4 min = trackSamples[0], max = trackSamples[0];
+        for (const Float4& e : trackSamples)
+        {
+            min = Float4(Math::Min(min.X, e.X), Math::Min(min.Y, e.Y), Math::Min(min.Z, e.Z), Math::Min(min.W, e.W));
+            max = Float4(Math::Max(max.X, e.X), Math::Max(max.Y, e.Y), Math::Max(max.Z, e.Z), Math::Max(max.W, e.W));
+        }
+        const Float4 extent = max - min;
+        const float maxExtent = Math::Max(Math::Max(extent.X, extent.Y), Math::Max(extent.Z, extent.W));
+        if (maxExtent <= tolerance * 2.0f)
+        {
+            // Static track
+            track.Type = TrackType::Constant;
+            track.Min = min + extent * 0.5f;
+            continue;
+        }
+
+        // Pick the smallest quantization that stays within the tolerance (error is half of the step)
+        track.Min = min;
+        if (maxExtent / MAX_uint8 * 0.5f <= tolerance)
+        {
+            track.Type = TrackType::Quantized8;
+            track.Step = extent / (float)MAX_uint8;
+        }
+        else if (maxExtent / MAX_uint16 * 0.5f <= tolerance)
+        {
+            track.Type = TrackType::Quantized16;
+            track.Step = extent / (float)MAX_uint16;
+        }
+        else
+        {
+            track.Type = TrackType::Raw;
+        }
+    }
+
+    // Layout frame data (larger components first to keep them aligned)
+    FrameStride = 0;
+    const TrackType layoutOrder[] = { TrackType::Raw, TrackType::Quantized16, TrackType::Quantized8 };
+    for (TrackType type : layoutOrder)
+    {
+        const int32 componentSize = type == TrackType::Raw ? sizeof(float) : type == TrackType::Quantized16 ? sizeof(uint16) : sizeof(uint8);
+        for (Track& track : Tracks)
+        {
+            if (track.Type == type)
+            {
+                track.Offset = FrameStride;
+                FrameStride += track.Components * componentSize;
+            }
+        }
+    }
+    FrameStride = Math::AlignUp(FrameStride, 4);
+
+    // Write quantized samples
+    Frames.Resize(FrameStride * FramesCount);
+    Platform::MemoryClear(Frames.Get(), Frames.Count());
+    for (int32 i = 0; i < Tracks.Count(); i++)
+    {
+        const Track& track = Tracks[i];
+        if (track.Type == TrackType::Empty || track.Type == TrackType::Constant)
+            continue;
+        for (int32 frame = 0; frame < FramesCount; frame++)
+        {
+            const float* value = samples[i][frame].Raw;
+            byte* dst = Frames.Get() + frame * FrameStride + track.Offset;
+            for (int32 c = 0; c < track.Components; c++)
+            {
+                switch (track.Type)
+                {
+                case TrackType::Quantized8:
+                    dst[c] = (byte)Math::Clamp(Math::RoundToInt((value[c] - track.Min.Raw[c]) / Math::Max(track.Step.Raw[c], ZeroTolerance)), 0, (int32)MAX_uint8);
+                    break;
+                case TrackType::Quantized16:
+                    ((uint16*)dst)[c] = (uint16)Math::Clamp(Math::RoundToInt((value[c] - track.Min.Raw[c]) / Math::Max(track.Step.Raw[c], ZeroTolerance)), 0, (int32)MAX_uint16);
+                    break;
+                default:
+                    ((float*)dst)[c] = value[c];
+                    break;
+                }
+            }
+        }
+    }
+}
+
+void CompressedAnimationData::Evaluate(int32 channelIndex, float time, Transform* result, bool loop) const
+{
+    // Find the frames to interpolate
+    const int32 lastFrame = FramesCount - 1;
+    if (loop && lastFrame > 0)
+    {
+        time = Math::Mod(time, (float)lastFrame);
+        if (time < 0.0f)
+            time += (float)lastFrame;
+    }
+    time = Math::Clamp(time, 0.0f, (float)lastFrame);
+    const int32 frame0 = Math::Min((int32)time, lastFrame);
+    const int32 frame1 = Math::Min(frame0 + 1, lastFrame);
+    const SimdVector4 alpha = SIMD::Splat(time - (float)frame0);
+    const byte* data0 = Frames.Get() + frame0 * FrameStride;
+    const byte* data1 = Frames.Get() + frame1 * FrameStride;
+
+    // Decode tracks
+    alignas(16) float value[4];
+    const Track* tracks = Tracks.Get() + channelIndex * 3;
+    for (int32 i = 0; i < 3; i++)
+    {
+        const Track& track = tracks[i];
+        if (track.Type == TrackType::Empty)
+            continue;
+        if (track.Type == TrackType::Constant)
+        {
+            value[0] = track.Min.X;
+            value[1] = track.Min.Y;
+            value[2] = track.Min.Z;
+            value[3] = track.Min.W;
+        }
+        else
+        {
+            const SimdVector4 v0 = DecodeSample(track, data0 + track.Offset);
+            const SimdVector4 v1 = DecodeSample(track, data1 + track.Offset);
+            SIMD::Store(value, SIMD::Add(v0, SIMD::Mul(SIMD::Sub(v1, v0), alpha)));
+        }
+        switch (i)
+        {
+        case 0:
+            result->Translation = Vector3(value[0], value[1], value[2]);
+            break;
+        case 1:
+            result->Orientation = Quaternion(value[0], value[1], value[2], value[3]);
+            result->Orientation.Normalize();
+            break;
+        case 2:
+            result->Scale = Float3(value[0], value[1], value[2]);
+            break;
+        }
+    }
+}
+
+uint64 CompressedAnimationData::GetMemoryUsage() const
+{
+    return Tracks.Capacity() * sizeof(Track) + Frames.Capacity();
+}
+
+void CompressedAnimationData::Dispose()
+{
+    Tracks.Resize(0);
+    Frames.Resize(0);
+    FramesCount = 0;
+    FrameStride = 0;
+}
+
 uint64 AnimationData::GetMemoryUsage() const
 {
-    uint64 result = (Name.Length() + RootNodeName.Length()) * sizeof(Char) + Channels.Capacity() * sizeof(NodeAnimationData);
+    uint64 result = (Name.Length() + RootNodeName.Length()) * sizeof(Char) + Channels.Capacity() * sizeof(NodeAnimationData) + Compressed.GetMemoryUsage();
     for (const auto& e : Channels)
         result += e.GetMemoryUsage();
     return result;
@@ -63,14 +305,37 @@ NodeAnimationData* AnimationData::GetChannel(const StringView& name)
     return nullptr;
 }
 
+void AnimationData::BuildCompressed()
+{
+    Compressed.Dispose();
+    if (!Compress || Channels.IsEmpty())
+        return;
+    Compressed.Build(Channels, Duration, CompressionTolerance);
+#if !USE_EDITOR
+    // Source curves are not used at runtime
+    for (NodeAnimationData& channel : Channels)
+    {
+        channel.Position.Clear();
+        channel.Rotation.Clear();
+        channel.Scale.Clear();
+    }
+#endif
+}
+
 void AnimationData::Swap(AnimationData& other)
 {
     ::Swap(Duration, other.Duration);
     ::Swap(FramesPerSecond, other.FramesPerSecond);
     ::Swap(RootMotionFlags, other.RootMotionFlags);
+    ::Swap(Compress, other.Compress);
+    ::Swap(CompressionTolerance, other.CompressionTolerance);
     ::Swap(Name, other.Name);
     ::Swap(RootNodeName, other.RootNodeName);
     Channels.Swap(other.Channels);
+    Compressed.Tracks.Swap(other.Compressed.Tracks);
+    Compressed.Frames.Swap(other.Compressed.Frames);
+    ::Swap(Compressed.FramesCount, other.Compressed.FramesCount);
+    ::Swap(Compressed.FrameStride, other.Compressed.FrameStride);
 }
 
 void AnimationData::Dispose()
@@ -80,5 +345,7 @@ void AnimationData::Dispose()
     FramesPerSecond = 0.0;
     RootNodeName.Clear();
     RootMotionFlags = AnimationRootMotionFlags::None;
+    Compress = false;
     Channels.Resize(0);
+    Compressed.Dispose();
 }
@@ -5,6 +5,7 @@
 #include "Engine/Core/Types/String.h"
 #include "Engine/Core/Types/Pair.h"
 #include "Engine/Core/Math/Transform.h"
+#include "Engine/Core/Math/Vector4.h"
 #include "Engine/Animations/Curve.h"
 
 /// <summary>
@@ -69,6 +70,87 @@ struct NodeAnimationData
     uint64 GetMemoryUsage() const;
 };
 
+/// <summary>
+/// Compressed animation tracks. Node channels are uniformly resampled at the animation frame rate and quantized (8 or 16 bits per component, picked per track to stay within the error tolerance, or raw floats if quantization would exceed it). Constant tracks are stored as a single value and empty tracks are stripped. Samples of all animated tracks for a single frame are stored next to each other so sampling the whole pose reads a contiguous memory block.
+/// </summary>
+struct FLAXENGINE_API CompressedAnimationData
+{
+    enum class TrackType : byte
+    {
+        Empty,
+        Constant,
+        Quantized8,
+        Quantized16,
+        Raw,
+    };
+
+    struct Track
+    {
+        TrackType Type = TrackType::Empty;
+        // The amount of components (3 for position and scale, 4 for rotation).
+        byte Components = 0;
+        // The byte offset of the track samples within the frame.
+        uint32 Offset = 0;
+        // The minimum value of the track (or the constant value).
+        Float4 Min = Float4::Zero;
+        // The quantization step of the track.
+        Float4 Step = Float4::Zero;
+    };
+
+    /// <summary>
+    /// The tracks (3 tracks per node channel: position, rotation and scale).
+    /// </summary>
+    Array<Track> Tracks;
+
+    /// <summary>
+    /// The frames samples data.
+    /// </summary>
+    Array<byte> Frames;
+
+    /// <summary>
+    /// The amount of the frames.
+    /// </summary>
+    int32 FramesCount = 0;
+
+    /// <summary>
+    /// The size of the single frame samples (in bytes).
+    /// </summary>
+    int32 FrameStride = 0;
+
+public:
+    /// <summary>
+    /// Determines whether the compressed data is valid.
+    /// </summary>
+    FORCE_INLINE bool IsValid() const
+    {
+        return FramesCount != 0;
+    }
+
+    /// <summary>
+    /// Compresses the animation channels.
+    /// </summary>
+    /// <param name="channels">The node channels.</param>
+    /// <param name="duration">The animation duration (in frames).</param>
+    /// <param name="tolerance">The maximum error allowed per value component.</param>
+    void Build(const Array<NodeAnimationData>& channels, double duration, float tolerance);
+
+    /// <summary>
+    /// Evaluates the animation transformation of the node channel at the specified time (only for the non-empty tracks).
+    /// </summary>
+    /// <param name="channelIndex">The node channel index.</param>
+    /// <param name="time">The time to evaluate the tracks at (in frames).</param>
+    /// <param name="result">The interpolated value from the tracks at provided time.</param>
+    /// <param name="loop">If true the tracks will loop when it goes past the end or beginning. Otherwise the value will be clamped.</param>
+    void Evaluate(int32 channelIndex, float time, Transform* result, bool loop = true) const;
+
+    uint64 GetMemoryUsage() const;
+
+    /// <summary>
+    /// Releases data.
+    /// </summary>
+    void Dispose();
+};
+
 /// <summary>
 /// Single track with events.
 /// </summary>
@@ -130,11 +212,26 @@ struct AnimationData
     /// </summary>
     String RootNodeName;
 
+    /// <summary>
+    /// Enables the compressed storage of the node channels (see CompressedAnimationData). Reduces memory usage and speeds up sampling at the cost of the precision.
+    /// </summary>
+    bool Compress = false;
+
+    /// <summary>
+    /// The maximum error allowed per value component when compressing the node channels.
+    /// </summary>
+    float CompressionTolerance = 0.001f;
+
     /// <summary>
     /// The per-skeleton node animation channels.
     /// </summary>
     Array<NodeAnimationData> Channels;
 
+    /// <summary>
+    /// The compressed node animation channels (runtime-only, valid if Compress is used).
+    /// </summary>
+    CompressedAnimationData Compressed;
+
     /// <summary>
     /// The animation event tracks.
     /// </summary>
@@ -161,6 +258,26 @@ struct AnimationData
 
     NodeAnimationData* GetChannel(const StringView& name);
 
+    /// <summary>
+    /// Evaluates the node channel animation transformation at the specified time (only for the curves with non-empty data). Uses the compressed data if available.
+    /// </summary>
+    /// <param name="channelIndex">The node channel index.</param>
+    /// <param name="time">The time to evaluate the curves at.</param>
+    /// <param name="result">The interpolated value from the curve at provided time.</param>
+    /// <param name="loop">If true the curve will loop when it goes past the end or beginning. Otherwise the curve value will be clamped.</param>
+    FORCE_INLINE void EvaluateChannel(int32 channelIndex, float time, Transform* result, bool loop = true) const
+    {
+        if (Compressed.IsValid())
+            Compressed.Evaluate(channelIndex, time, result, loop);
+        else
+            Channels.Get()[channelIndex].Evaluate(time, result, loop);
+    }
+
+    /// <summary>
+    /// Builds the compressed node channels (if Compress is used). In game builds the source curves keyframes are released after compression.
+    /// </summary>
+    void BuildCompressed();
+
     /// <summary>
     /// Swaps the contents of object with the other object without copy operation. Performs fast internal data exchange.
     /// </summary>
@@ -2,8 +2,12 @@
 
 #include "Animations.h"
 #include "AnimEvent.h"
+#include "Config.h"
 #include "Engine/Engine/Engine.h"
+#include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Core/Collections/Sorting.h"
 #include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Profiler/ProfilerMemory.h"
 #include "Engine/Level/Actors/AnimatedModel.h"
 #include "Engine/Engine/Time.h"
 #include "Engine/Engine/EngineService.h"
@@ -13,6 +17,10 @@ class AnimationsService : public EngineService
 {
 public:
     Array<AnimatedModel*> UpdateList;
+    // Models that copy the pose evaluated by the other model (grouped by the source model from UpdateList)
+    Array<AnimatedModel*> SharedList;
+    // Ranges of SharedList for each model from UpdateList (start indices, UpdateList.Count() + 1 elements)
+    Array<int32> SharedRanges;
 
     AnimationsService()
         : EngineService(TEXT("Animations"), -10)
@@ -28,6 +36,9 @@ class AnimationsSystem : public TaskGraphSystem
 public:
     float DeltaTime, UnscaledDeltaTime, Time, UnscaledTime;
 
+    void ApplyBudget();
+    void SharePoses();
+    void SharePose(AnimatedModel* source, AnimatedModel* animatedModel);
     void Job(int32 index);
     void Execute(TaskGraph* graph) override;
     void PostExecute(TaskGraph* graph) override;
@@ -35,6 +46,17 @@ class AnimationsSystem : public TaskGraphSystem
 
 namespace
 {
+    struct ModelPriority
+    {
+        AnimatedModel* Model;
+        float Priority;
+
+        bool operator<(const ModelPriority& other) const
+        {
+            return Priority > other.Priority;
+        }
+    };
+
     FORCE_INLINE bool CanUpdateModel(const AnimatedModel* animatedModel)
     {
         auto skinnedModel = animatedModel->SkinnedModel.Get();
@@ -47,10 +69,68 @@ namespace
 #endif
                 && animGraph->Graph.IsReady();
     }
+
+    FORCE_INLINE uint32 QuantizeParameter(float value)
+    {
+        const float step = Animations::PoseSharingQuantization;
+        return step > 0.0f ? (uint32)(int32)Math::Floor(value / step + 0.5f) : GetHash(value);
+    }
+
+    uint32 GetPoseSharingKey(const AnimatedModel* animatedModel)
+    {
+        uint32 hash = GetHash(animatedModel->AnimationGraph.Get());
+        CombineHash(hash, animatedModel->SkinnedModel.Get());
+        CombineHash(hash, (uint32)animatedModel->PoseSharingGroup);
+        CombineHash(hash, animatedModel->UseTimeScale ? 1 : 0);
+        CombineHash(hash, GetHash(animatedModel->UpdateSpeed));
+        for (const AnimGraphParameter& param : animatedModel->GraphInstance.Parameters)
+        {
+            const Variant& value = param.Value;
+            switch (value.Type.Type)
+            {
+            case VariantType::Float:
+                CombineHash(hash, QuantizeParameter(value.AsFloat));
+                break;
+            case VariantType::Double:
+                CombineHash(hash, QuantizeParameter((float)value.AsDouble));
+                break;
+            case VariantType::Float2:
+                CombineHash(hash, QuantizeParameter(value.AsFloat2().X));
+                CombineHash(hash, QuantizeParameter(value.AsFloat2().Y));
+                break;
+            case VariantType::Float3:
+                CombineHash(hash, QuantizeParameter(value.AsFloat3().X));
+                CombineHash(hash, QuantizeParameter(value.AsFloat3().Y));
+                CombineHash(hash, QuantizeParameter(value.AsFloat3().Z));
+                break;
+            case VariantType::Float4:
+                CombineHash(hash, QuantizeParameter(value.AsFloat4().X));
+                CombineHash(hash, QuantizeParameter(value.AsFloat4().Y));
+                CombineHash(hash, QuantizeParameter(value.AsFloat4().Z));
+                CombineHash(hash, QuantizeParameter(value.AsFloat4().W));
+                break;
+            default:
+                CombineHash(hash, GetHash(value));
+                break;
+            }
+        }
+        return hash;
+    }
+
+    FORCE_INLINE bool CanSharePose(const AnimatedModel* a, const AnimatedModel* b)
+    {
+        return a->AnimationGraph.Get() == b->AnimationGraph.Get()
+                && a->SkinnedModel.Get() == b->SkinnedModel.Get()
+                && a->PoseSharingGroup == b->PoseSharingGroup
+                && a->UseTimeScale == b->UseTimeScale
+                && a->UpdateSpeed == b->UpdateSpeed;
+    }
 }
 
 AnimationsService AnimationManagerInstance;
 TaskGraphSystem* Animations::System = nullptr;
+int32 Animations::BonesBudget = 0;
+float Animations::PoseSharingQuantization = 0.05f;
 #if USE_EDITOR
 Delegate<Animations::DebugFlowInfo> Animations::DebugFlow;
 #endif
@@ -75,12 +155,15 @@ bool AnimationsService::Init()
 void AnimationsService::Dispose()
 {
     UpdateList.Resize(0);
+    SharedList.Resize(0);
+    SharedRanges.Resize(0);
     SAFE_DELETE(Animations::System);
 }
 
 void AnimationsSystem::Job(int32 index)
 {
     PROFILE_CPU_NAMED("Animations.Job");
+    PROFILE_MEM(Animation);
     auto animatedModel = AnimationManagerInstance.UpdateList[index];
     if (CanUpdateModel(animatedModel))
     {
@@ -92,6 +175,9 @@ void AnimationsSystem::Job(int32 index)
 
         // Prepare skinning data
         animatedModel->SetupSkinningData();
+        animatedModel->_isUpdateDeferred = false;
+        if (animatedModel->InterpolatePose)
+            animatedModel->_posePrev = animatedModel->_skinningData.Data;
 
         // Animation delta time can be based on a time since last update or the current delta
         float dt = animatedModel->UseTimeScale ? DeltaTime : UnscaledDeltaTime;
@@ -109,9 +195,144 @@ void AnimationsSystem::Job(int32 index)
 
         // Update gameplay
         animatedModel->OnAnimationUpdated_Async();
+
+        // Copy the evaluated pose to the models that share it (before the pose interpolation is applied)
+        const auto& sharedRanges = AnimationManagerInstance.SharedRanges;
+        if (sharedRanges.HasItems())
+        {
+            for (int32 i = sharedRanges[index]; i < sharedRanges[index + 1]; i++)
+                SharePose(animatedModel, AnimationManagerInstance.SharedList[i]);
+        }
+
+        animatedModel->UpdatePoseInterpolation(true);
+    }
+}
+
+void AnimationsSystem::SharePose(AnimatedModel* source, AnimatedModel* animatedModel)
+{
+    ANIM_GRAPH_PROFILE_EVENT("Share Pose");
+    animatedModel->SetupSkinningData();
+    animatedModel->_isUpdateDeferred = false;
+    if (animatedModel->InterpolatePose)
+        animatedModel->_posePrev = animatedModel->_skinningData.Data;
+
+    // Copy the pose and the final bones transformations (the same skinned model is used)
+    auto& instance = animatedModel->GraphInstance;
+    const auto& sourceInstance = source->GraphInstance;
+    instance.LastUpdateTime = sourceInstance.LastUpdateTime;
+    instance.NodesPose = sourceInstance.NodesPose;
+    instance.RootTransform = sourceInstance.RootTransform;
+    instance.RootMotion = sourceInstance.RootMotion;
+    animatedModel->_skinningData.Data = source->_skinningData.Data;
+    animatedModel->_skinningData.OnDataChanged(!animatedModel->PerBoneMotionBlur);
+    animatedModel->UpdateBounds();
+    animatedModel->UpdatePoseInterpolation(true);
+}
+
+void AnimationsSystem::ApplyBudget()
+{
+    auto& updateList = AnimationManagerInstance.UpdateList;
+    int32 totalNodes = 0;
+    for (const AnimatedModel* animatedModel : updateList)
+        totalNodes += animatedModel->SkinnedModel ? animatedModel->SkinnedModel->Skeleton.Nodes.Count() : 0;
+    if (totalNodes <= Animations::BonesBudget)
+        return;
+    PROFILE_CPU_NAMED("Animations.ApplyBudget");
+
+    // Sort models by the significance scaled by the time since the last evaluation (models waiting longer rise up so updates get staggered across the ticks)
+    Array<ModelPriority> priorities;
+    priorities.Resize(updateList.Count());
+    const uint64 frame = Engine::UpdateCount;
+    for (int32 i = 0; i < updateList.Count(); i++)
+    {
+        AnimatedModel* animatedModel = updateList[i];
+        priorities[i].Model = animatedModel;
+        priorities[i].Priority = animatedModel->_significance * (float)Math::Min<uint64>(frame - animatedModel->_lastEvalFrame, 1000);
+    }
+    Sorting::QuickSort(priorities);
+
+    // Update the most important models within the budget and defer the rest
+    updateList.Clear();
+    int32 nodesLeft = Animations::BonesBudget;
+    for (const ModelPriority& e : priorities)
+    {
+        const int32 nodes = e.Model->SkinnedModel ? e.Model->SkinnedModel->Skeleton.Nodes.Count() : 0;
+        if (nodes <= nodesLeft || updateList.IsEmpty())
+        {
+            updateList.Add(e.Model);
+            nodesLeft -= nodes;
+        }
+        else
+        {
+            e.Model->_isUpdateDeferred = true;
+        }
     }
 }
 
+void AnimationsSystem::SharePoses()
+{
+    auto& updateList = AnimationManagerInstance.UpdateList;
+    auto& sharedList = AnimationManagerInstance.SharedList;
+    auto& sharedRanges = AnimationManagerInstance.SharedRanges;
+    sharedList.Clear();
+    sharedRanges.Clear();
+    int32 sharingCount = 0;
+    for (const AnimatedModel* animatedModel : updateList)
+        sharingCount += animatedModel->PoseSharingGroup > 0 ? 1 : 0;
+    if (sharingCount < 2)
+        return;
+    PROFILE_CPU_NAMED("Animations.SharePoses");
+
+    // Pick a single model to evaluate the pose for each group of models with the same graph, skeleton and quantized parameters
+    Dictionary<uint32, int32> sourcesLookup;
+    Array<AnimatedModel*> sources;
+    Array<int32> sourceIndices;
+    sourceIndices.Resize(updateList.Count());
+    for (int32 i = 0; i < updateList.Count(); i++)
+    {
+        AnimatedModel* animatedModel = updateList[i];
+        sourceIndices[i] = -1;
+        if (animatedModel->PoseSharingGroup > 0 && !animatedModel->_masterPose && CanUpdateModel(animatedModel))
+        {
+            const uint32 key = GetPoseSharingKey(animatedModel);
+            int32 sourceIndex;
+            if (sourcesLookup.TryGet(key, sourceIndex) && CanSharePose(sources[sourceIndex], animatedModel))
+            {
+                sourceIndices[i] = sourceIndex;
+                continue;
+            }
+            sourcesLookup[key] = sources.Count();
+        }
+        sources.Add(animatedModel);
+    }
+    if (sources.Count() == updateList.Count())
+        return;
+
+    // Group the models that share the pose by the source model
+    sharedRanges.Resize(sources.Count() + 1);
+    Platform::MemoryClear(sharedRanges.Get(), sharedRanges.Count() * sizeof(int32));
+    for (const int32 sourceIndex : sourceIndices)
+    {
+        if (sourceIndex != -1)
+            sharedRanges[sourceIndex + 1]++;
+    }
+    for (int32 i = 1; i < sharedRanges.Count(); i++)
+        sharedRanges[i] += sharedRanges[i - 1];
+    sharedList.Resize(sharedRanges.Last());
+    Array<int32> sharedCounts;
+    sharedCounts.Resize(sources.Count());
+    Platform::MemoryClear(sharedCounts.Get(), sharedCounts.Count() * sizeof(int32));
+    for (int32 i = 0; i < updateList.Count(); i++)
+    {
+        const int32 sourceIndex = sourceIndices[i];
+        if (sourceIndex != -1)
+            sharedList[sharedRanges[sourceIndex] + sharedCounts[sourceIndex]++] = updateList[i];
+    }
+
+    // Evaluate only the source models
+    updateList.Swap(sources);
+}
+
 void AnimationsSystem::Execute(TaskGraph* graph)
 {
     if (AnimationManagerInstance.UpdateList.Count() == 0)
@@ -130,10 +351,17 @@ void AnimationsSystem::Execute(TaskGraph* graph)
         Animations::DebugFlow(Animations::DebugFlowInfo());
 #endif
 
+    // Limit the amount of animations evaluated within this tick
+    if (Animations::BonesBudget > 0)
+        ApplyBudget();
+
+    // Evaluate a single pose for the crowds of models with the same animation state
+    SharePoses();
+
     // Schedule work to update all animated models in async
     Function<void(int32)> job;
     job.Bind<AnimationsSystem, &AnimationsSystem::Job>(this);
-    graph->DispatchJob(job, AnimationManagerInstance.UpdateList.Count());
+    graph->DispatchJob(job, AnimationManagerInstance.UpdateList.Count(), 1, JobPriority::High);
 }
 
 void AnimationsSystem::PostExecute(TaskGraph* graph)
@@ -150,9 +378,16 @@ void AnimationsSystem::PostExecute(TaskGraph* graph)
             animatedModel->OnAnimationUpdated_Sync();
         }
     }
+    for (AnimatedModel* animatedModel : AnimationManagerInstance.SharedList)
+    {
+        // Anim events are invoked only by the model that evaluated the shared pose
+        animatedModel->OnAnimationUpdated_Sync();
+    }
 
     // Cleanup
     AnimationManagerInstance.UpdateList.Clear();
+    AnimationManagerInstance.SharedList.Clear();
+    AnimationManagerInstance.SharedRanges.Clear();
 }
 
 void Animations::AddToUpdate(AnimatedModel* obj)
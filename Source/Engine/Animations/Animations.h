@@ -21,6 +21,16 @@ API_CLASS(Static) class FLAXENGINE_API Animations
     /// </summary>
     API_FIELD(ReadOnly) static TaskGraphSystem* System;
 
+    /// <summary>
+    /// The budget of the skeleton nodes evaluated by the animation graphs within a single game update (summed over all updated animated models). When exceeded, the models with the lowest priority (significance based on the screen size and AnimatedModel.Significance, multiplied by the time since the last update) are deferred to the next updates. Keeps the animations cost constant when crowds gather. Use 0 to disable the limit.
+    /// </summary>
+    API_FIELD() static int32 BonesBudget;
+
+    /// <summary>
+    /// The quantization step of the Anim Graph parameter values used to match the animated models that can share the evaluated pose (see AnimatedModel.PoseSharingGroup). Models with parameter values that differ less than this step share the same pose. Use 0 to share only for the exactly equal parameters.
+    /// </summary>
+    API_FIELD() static float PoseSharingQuantization;
+
 #if USE_EDITOR
     // Data wrapper for the debug flow information.
     API_STRUCT(NoDefault) struct DebugFlowInfo
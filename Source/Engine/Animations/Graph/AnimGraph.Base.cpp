@@ -135,6 +135,30 @@ bool AnimGraphBase::onNodeLoaded(Node* n)
     ((AnimGraphNode*)n)->Graph = _graph;
     switch (n->GroupID)
     {
+    // Constants, Math, Packing, Boolean, Bitwise, Comparisons
+    case 2:
+    case 3:
+    case 4:
+    case 10:
+    case 11:
+    case 12:
+        // Pure nodes can be constant-folded (see AnimGraphExecutor::eatBox)
+        if (n->Boxes.Count() <= 64)
+            n->FoldedValues.Resize(n->Boxes.Count());
+        break;
+    // Parameters
+    case 6:
+        switch (n->TypeID)
+        {
+        // Get
+        case 1:
+            // Resolve parameter slot to skip the lookup by ID during evaluation
+            n->Data.Parameter.Index = INVALID_INDEX;
+            if (n->Values.HasItems())
+                _graph->GetParameter((Guid)n->Values[0], n->Data.Parameter.Index);
+            break;
+        }
+        break;
     // Tools
     case 7:
         switch (n->TypeID)
@@ -6,10 +6,12 @@
 #include "Engine/Content/Assets/SkinnedModel.h"
 #include "Engine/Graphics/Models/SkeletonData.h"
 #include "Engine/Scripting/Scripting.h"
+#include "Engine/Threading/Threading.h"
 
 extern void RetargetSkeletonNode(const SkeletonData& sourceSkeleton, const SkeletonData& targetSkeleton, const SkinnedModel::SkeletonMapping& sourceMapping, Transform& node, int32 i);
 
 ThreadLocal<AnimGraphContext*> AnimGraphExecutor::Context;
+static CriticalSection FoldLocker;
 
 Transform AnimGraphImpulse::GetNodeModelTransformation(SkeletonData& skeleton, int32 nodeIndex) const
 {
@@ -473,9 +475,34 @@ VisjectExecutor::Value AnimGraphExecutor::eatBox(Node* caller, Box* box)
 
     // Call per group custom processing event
     Value value;
-    const auto parentNode = box->GetParent<Node>();
-    const ProcessBoxHandler func = _perGroupProcessCall[parentNode->GroupID];
-    (this->*func)(box, parentNode, value);
+    const auto parentNode = box->GetParent<AnimGraphNode>();
+    const int64 foldedBit = 1ll << (box->ID & 63);
+    if (Platform::AtomicRead(&parentNode->FoldedBoxes) & foldedBit)
+    {
+        // Use constant-folded value
+        value = parentNode->FoldedValues[box->ID];
+    }
+    else
+    {
+        const uint32 nonConstantCounter = context.NonConstantCounter;
+        const ProcessBoxHandler func = _perGroupProcessCall[parentNode->GroupID];
+        (this->*func)(box, parentNode, value);
+        if (parentNode->FoldedValues.IsEmpty())
+        {
+            // Value depends on the graph state or instance data so any node that used it cannot be folded
+            context.NonConstantCounter++;
+        }
+        else if (nonConstantCounter == context.NonConstantCounter && !context.StackOverFlow)
+        {
+            // Pure node evaluated only from constant inputs so cache the value for all graph instances
+            ScopeLock lock(FoldLocker);
+            if ((parentNode->FoldedBoxes & foldedBit) == 0)
+            {
+                parentNode->FoldedValues[box->ID] = value;
+                Platform::AtomicStore(&parentNode->FoldedBoxes, parentNode->FoldedBoxes | foldedBit);
+            }
+        }
+    }
 
     // Remove from the calling stack
     context.CallStack.RemoveLast();
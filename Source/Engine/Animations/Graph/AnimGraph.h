@@ -522,6 +522,14 @@ class AnimGraphNode : public VisjectGraphNode<AnimGraphBox>
         int32 DstNodeIndex;
     };
 
+    struct ParameterData
+    {
+        /// <summary>
+        /// The index of the graph parameter (resolved on load), or -1 if missing.
+        /// </summary>
+        int32 Index;
+    };
+
     /// <summary>
     /// Custom cached data per node type. Compact to use as small amount of memory as possible.
     /// </summary>
@@ -539,6 +547,7 @@ class AnimGraphNode : public VisjectGraphNode<AnimGraphBox>
             AnimationGraphFunctionData AnimationGraphFunction;
             TransformNodeData TransformNode;
             CopyNodeData CopyNode;
+            ParameterData Parameter;
         };
     };
 
@@ -558,6 +567,16 @@ class AnimGraphNode : public VisjectGraphNode<AnimGraphBox>
     /// </summary>
     AdditionalData Data;
 
+    /// <summary>
+    /// The bit mask of the output boxes (by ID) with the constant-folded value cached in FoldedValues.
+    /// </summary>
+    volatile int64 FoldedBoxes = 0;
+
+    /// <summary>
+    /// The constant-folded values of the output boxes (indexed by box ID). Allocated on load only for the pure nodes (eg. constants or math) which output depends only on the inputs. When all the node inputs are constant the output is evaluated once and shared by all graph instances.
+    /// </summary>
+    Array<Variant> FoldedValues;
+
 public:
     AnimGraphNode()
     {
@@ -765,6 +784,7 @@ struct AnimGraphContext
     AnimGraphImpulse EmptyNodes;
     AnimGraphTransitionData TransitionData;
     bool StackOverFlow;
+    uint32 NonConstantCounter = 0;
     Array<VisjectExecutor::Node*, FixedAllocation<ANIM_GRAPH_MAX_CALL_STACK>> CallStack;
     Array<VisjectExecutor::Graph*, FixedAllocation<32>> GraphStack;
     Array<uint32, FixedAllocation<ANIM_GRAPH_MAX_CALL_STACK>> NodePath;
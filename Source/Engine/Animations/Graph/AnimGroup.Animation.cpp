@@ -8,6 +8,7 @@
 #include "Engine/Animations/AlphaBlend.h"
 #include "Engine/Animations/AnimEvent.h"
 #include "Engine/Animations/InverseKinematics.h"
+#include "Engine/Animations/PoseBlending.h"
 #include "Engine/Level/Actors/AnimatedModel.h"
 
 namespace
@@ -23,10 +24,7 @@ namespace
 
     FORCE_INLINE void NormalizeRotations(AnimGraphImpulse* nodes, RootMotionExtraction rootMotionMode)
     {
-        for (int32 i = 0; i < nodes->Nodes.Count(); i++)
-        {
-            nodes->Nodes.Get()[i].Orientation.Normalize();
-        }
+        PoseBlending::NormalizeRotations(nodes->Nodes.Get(), nodes->Nodes.Count());
         if (rootMotionMode != RootMotionExtraction::NoExtraction)
         {
             nodes->RootMotion.Orientation.Normalize();
@@ -295,7 +293,7 @@ void AnimGraphExecutor::ProcessAnimation(AnimGraphImpulse* nodes, AnimGraphNode*
         if (nodeToChannel != -1)
         {
             // Calculate the animated node transformation
-            anim->Data.Channels[nodeToChannel].Evaluate(animPos, &srcNode, false);
+            anim->Data.EvaluateChannel(nodeToChannel, animPos, &srcNode, false);
 
             // Optionally retarget animation into the skeleton used by the Anim Graph
             if (retarget)
@@ -357,8 +355,7 @@ void AnimGraphExecutor::ProcessAnimation(AnimGraphImpulse* nodes, AnimGraphNode*
         {
             // Get the root bone transformation
             Transform rootBefore = refPose;
-            const NodeAnimationData& rootChannel = anim->Data.Channels[nodeToChannel];
-            rootChannel.Evaluate(animPrevPos, &rootBefore, false);
+            anim->Data.EvaluateChannel(nodeToChannel, animPrevPos, &rootBefore, false);
 
             // Check if animation looped
             if (animPos < animPrevPos)
@@ -366,10 +363,10 @@ void AnimGraphExecutor::ProcessAnimation(AnimGraphImpulse* nodes, AnimGraphNode*
                 const float endPos = (float)(anim->GetLength() * anim->Data.FramesPerSecond);
 
                 Transform rootBegin = refPose;
-                rootChannel.Evaluate(0, &rootBegin, false);
+                anim->Data.EvaluateChannel(nodeToChannel, 0, &rootBegin, false);
 
                 Transform rootEnd = refPose;
-                rootChannel.Evaluate(endPos, &rootEnd, false);
+                anim->Data.EvaluateChannel(nodeToChannel, endPos, &rootEnd, false);
 
                 // Complex motion calculation to preserve the looped movement
                 // (end - before + now - begin)
@@ -526,10 +523,7 @@ Variant AnimGraphExecutor::Blend(AnimGraphNode* node, const Value& poseA, const
     if (!ANIM_GRAPH_IS_VALID_PTR(poseB))
         nodesB = GetEmptyNodes();
 
-    for (int32 i = 0; i < nodes->Nodes.Count(); i++)
-    {
-        Transform::Lerp(nodesA->Nodes[i], nodesB->Nodes[i], alpha, nodes->Nodes[i]);
-    }
+    PoseBlending::Lerp(nodesA->Nodes.Get(), nodesB->Nodes.Get(), alpha, nodes->Nodes.Get(), nodes->Nodes.Count());
     Transform::Lerp(nodesA->RootMotion, nodesB->RootMotion, alpha, nodes->RootMotion);
     nodes->Position = Math::Lerp(nodesA->Position, nodesB->Position, alpha);
     nodes->Length = Math::Lerp(nodesA->Length, nodesB->Length, alpha);
@@ -700,8 +694,8 @@ void AnimGraphExecutor::ProcessGroupParameters(Box* box, Node* node, Value& valu
     case 1:
     {
         // Get parameter
-        int32 paramIndex;
-        const auto param = _graph.GetParameter((Guid)node->Values[0], paramIndex);
+        const int32 paramIndex = node->Data.Parameter.Index;
+        const auto param = paramIndex != INVALID_INDEX ? &_graph.Parameters[paramIndex] : nullptr;
         if (param)
         {
             value = context.Data->Parameters[paramIndex].Value;
@@ -1122,10 +1116,7 @@ void AnimGraphExecutor::ProcessGroupAnimation(Box* boxBase, Node* nodeBase, Valu
             if (!ANIM_GRAPH_IS_VALID_PTR(valueB))
                 nodesB = GetEmptyNodes();
 
-            for (int32 i = 0; i < nodes->Nodes.Count(); i++)
-            {
-                Transform::Lerp(nodesA->Nodes[i], nodesB->Nodes[i], alpha, nodes->Nodes[i]);
-            }
+            PoseBlending::Lerp(nodesA->Nodes.Get(), nodesB->Nodes.Get(), alpha, nodes->Nodes.Get(), nodes->Nodes.Count());
             Transform::Lerp(nodesA->RootMotion, nodesB->RootMotion, alpha, nodes->RootMotion);
             value = nodes;
         }
@@ -1162,22 +1153,7 @@ void AnimGraphExecutor::ProcessGroupAnimation(Box* boxBase, Node* nodeBase, Valu
                 const auto basePoseNodes = static_cast<AnimGraphImpulse*>(valueA.AsPointer);
                 const auto blendPoseNodes = static_cast<AnimGraphImpulse*>(valueB.AsPointer);
                 const auto& refNodes = _graph.BaseModel.Get()->GetNodes();
-                Transform t, basePoseTransform, blendPoseTransform, refTransform;
-                for (int32 i = 0; i < nodes->Nodes.Count(); i++)
-                {
-                    basePoseTransform = basePoseNodes->Nodes[i];
-                    blendPoseTransform = blendPoseNodes->Nodes[i];
-                    refTransform = refNodes[i].LocalTransform;
-
-                    // base + (blend - reference)
-                    t.Translation = basePoseTransform.Translation + (blendPoseTransform.Translation - refTransform.Translation);
-                    auto diff = Quaternion::Invert(refTransform.Orientation) * blendPoseTransform.Orientation;
-                    t.Orientation = basePoseTransform.Orientation * diff;
-                    t.Scale = basePoseTransform.Scale + (blendPoseTransform.Scale - refTransform.Scale);
-
-                    // Lerp base and transform
-                    Transform::Lerp(basePoseTransform, t, alpha, nodes->Nodes[i]);
-                }
+                PoseBlending::Additive(basePoseNodes->Nodes.Get(), blendPoseNodes->Nodes.Get(), refNodes.Get(), alpha, nodes->Nodes.Get(), nodes->Nodes.Count());
                 Transform::Lerp(basePoseNodes->RootMotion, basePoseNodes->RootMotion + blendPoseNodes->RootMotion, alpha, nodes->RootMotion);
                 value = nodes;
             }
@@ -1220,21 +1196,7 @@ void AnimGraphExecutor::ProcessGroupAnimation(Box* boxBase, Node* nodeBase, Valu
             const auto nodesB = static_cast<AnimGraphImpulse*>(valueB.AsPointer);
 
             // Blend all nodes masked by the user
-            Transform tA, tB;
-            auto& nodesMask = mask->GetNodesMask();
-            for (int32 nodeIndex = 0; nodeIndex < nodes->Nodes.Count(); nodeIndex++)
-            {
-                tA = nodesA->Nodes[nodeIndex];
-                if (nodesMask[nodeIndex])
-                {
-                    tB = nodesB->Nodes[nodeIndex];
-                    Transform::Lerp(tA, tB, alpha, nodes->Nodes[nodeIndex]);
-                }
-                else
-                {
-                    nodes->Nodes[nodeIndex] = tA;
-                }
-            }
+            PoseBlending::LerpMasked(nodesA->Nodes.Get(), nodesB->Nodes.Get(), mask->GetNodesMask(), alpha, nodes->Nodes.Get(), nodes->Nodes.Count());
             Transform::Lerp(nodesA->RootMotion, nodesB->RootMotion, alpha, nodes->RootMotion);
 
             value = nodes;
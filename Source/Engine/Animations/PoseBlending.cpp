@@ -0,0 +1,191 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "PoseBlending.h"
+#include "Engine/Core/SIMD.h"
+#include "Engine/Core/Math/Transform.h"
+#include "Engine/Graphics/Models/SkeletonData.h"
+
+namespace
+{
+    // Pose of 4 nodes transposed into the SIMD vectors (structure-of-arrays).
+    struct PoseSoA
+    {
+        SimdVector4 TX, TY, TZ;
+        SimdVector4 QX, QY, QZ, QW;
+        SimdVector4 SX, SY, SZ;
+    };
+
+    FORCE_INLINE void Gather(const Transform* nodes, int32 start, int32 count, PoseSoA& result)
+    {
+        // Tail lanes repeat the last node (they are not written back)
+        const Transform& n0 = nodes[start];
+        const Transform& n1 = nodes[Math::Min(start + 1, count - 1)];
+        const Transform& n2 = nodes[Math::Min(start + 2, count - 1)];
+        const Transform& n3 = nodes[Math::Min(start + 3, count - 1)];
+        result.TX = SIMD::Load((float)n0.Translation.X, (float)n1.Translation.X, (float)n2.Translation.X, (float)n3.Translation.X);
+        result.TY = SIMD::Load((float)n0.Translation.Y, (float)n1.Translation.Y, (float)n2.Translation.Y, (float)n3.Translation.Y);
+        result.TZ = SIMD::Load((float)n0.Translation.Z, (float)n1.Translation.Z, (float)n2.Translation.Z, (float)n3.Translation.Z);
+        result.QX = SIMD::Load(n0.Orientation.X, n1.Orientation.X, n2.Orientation.X, n3.Orientation.X);
+        result.QY = SIMD::Load(n0.Orientation.Y, n1.Orientation.Y, n2.Orientation.Y, n3.Orientation.Y);
+        result.QZ = SIMD::Load(n0.Orientation.Z, n1.Orientation.Z, n2.Orientation.Z, n3.Orientation.Z);
+        result.QW = SIMD::Load(n0.Orientation.W, n1.Orientation.W, n2.Orientation.W, n3.Orientation.W);
+        result.SX = SIMD::Load(n0.Scale.X, n1.Scale.X, n2.Scale.X, n3.Scale.X);
+        result.SY = SIMD::Load(n0.Scale.Y, n1.Scale.Y, n2.Scale.Y, n3.Scale.Y);
+        result.SZ = SIMD::Load(n0.Scale.Z, n1.Scale.Z, n2.Scale.Z, n3.Scale.Z);
+    }
+
+    FORCE_INLINE void Scatter(const PoseSoA& pose, Transform* nodes, int32 start, int32 count)
+    {
+        alignas(16) float data[10][4];
+        SIMD::Store(data[0], pose.TX);
+        SIMD::Store(data[1], pose.TY);
+        SIMD::Store(data[2], pose.TZ);
+        SIMD::Store(data[3], pose.QX);
+        SIMD::Store(data[4], pose.QY);
+        SIMD::Store(data[5], pose.QZ);
+        SIMD::Store(data[6], pose.QW);
+        SIMD::Store(data[7], pose.SX);
+        SIMD::Store(data[8], pose.SY);
+        SIMD::Store(data[9], pose.SZ);
+        const int32 lanes = Math::Min(count - start, 4);
+        for (int32 lane = 0; lane < lanes; lane++)
+        {
+            Transform& node = nodes[start + lane];
+            node.Translation = Vector3(data[0][lane], data[1][lane], data[2][lane]);
+            node.Orientation = Quaternion(data[3][lane], data[4][lane], data[5][lane], data[6][lane]);
+            node.Scale = Float3(data[7][lane], data[8][lane], data[9][lane]);
+        }
+    }
+
+    FORCE_INLINE SimdVector4 LerpV(SimdVector4 a, SimdVector4 b, SimdVector4 alpha)
+    {
+        return SIMD::Add(a, SIMD::Mul(SIMD::Sub(b, a), alpha));
+    }
+
+    FORCE_INLINE void NormalizeQ(PoseSoA& pose)
+    {
+        const SimdVector4 lengthSq = SIMD::Add(SIMD::Add(SIMD::Mul(pose.QX, pose.QX), SIMD::Mul(pose.QY, pose.QY)), SIMD::Add(SIMD::Mul(pose.QZ, pose.QZ), SIMD::Mul(pose.QW, pose.QW)));
+        const SimdVector4 invLength = SIMD::Div(SIMD::Splat(1.0f), SIMD::Sqrt(SIMD::Max(lengthSq, SIMD::Splat(ZeroTolerance))));
+        pose.QX = SIMD::Mul(pose.QX, invLength);
+        pose.QY = SIMD::Mul(pose.QY, invLength);
+        pose.QZ = SIMD::Mul(pose.QZ, invLength);
+        pose.QW = SIMD::Mul(pose.QW, invLength);
+    }
+
+    // Blends the whole transformations (rotation uses normalized lerp over the shortest path).
+    FORCE_INLINE void LerpPose(const PoseSoA& a, const PoseSoA& b, SimdVector4 alpha, PoseSoA& result)
+    {
+        const SimdVector4 dot = SIMD::Add(SIMD::Add(SIMD::Mul(a.QX, b.QX), SIMD::Mul(a.QY, b.QY)), SIMD::Add(SIMD::Mul(a.QZ, b.QZ), SIMD::Mul(a.QW, b.QW)));
+        const SimdVector4 sign = SIMD::Select(SIMD::Less(dot, SIMD::Splat(0.0f)), SIMD::Splat(-1.0f), SIMD::Splat(1.0f));
+        result.TX = LerpV(a.TX, b.TX, alpha);
+        result.TY = LerpV(a.TY, b.TY, alpha);
+        result.TZ = LerpV(a.TZ, b.TZ, alpha);
+        result.QX = LerpV(a.QX, SIMD::Mul(b.QX, sign), alpha);
+        result.QY = LerpV(a.QY, SIMD::Mul(b.QY, sign), alpha);
+        result.QZ = LerpV(a.QZ, SIMD::Mul(b.QZ, sign), alpha);
+        result.QW = LerpV(a.QW, SIMD::Mul(b.QW, sign), alpha);
+        result.SX = LerpV(a.SX, b.SX, alpha);
+        result.SY = LerpV(a.SY, b.SY, alpha);
+        result.SZ = LerpV(a.SZ, b.SZ, alpha);
+        NormalizeQ(result);
+    }
+
+    // Multiplies quaternions (the same as Quaternion::Multiply).
+    FORCE_INLINE void MultiplyQ(SimdVector4 lx, SimdVector4 ly, SimdVector4 lz, SimdVector4 lw, SimdVector4 rx, SimdVector4 ry, SimdVector4 rz, SimdVector4 rw, PoseSoA& result)
+    {
+        const SimdVector4 a = SIMD::Sub(SIMD::Mul(ly, rz), SIMD::Mul(lz, ry));
+        const SimdVector4 b = SIMD::Sub(SIMD::Mul(lz, rx), SIMD::Mul(lx, rz));
+        const SimdVector4 c = SIMD::Sub(SIMD::Mul(lx, ry), SIMD::Mul(ly, rx));
+        const SimdVector4 d = SIMD::Add(SIMD::Add(SIMD::Mul(lx, rx), SIMD::Mul(ly, ry)), SIMD::Mul(lz, rz));
+        result.QX = SIMD::Add(SIMD::Add(SIMD::Mul(lx, rw), SIMD::Mul(rx, lw)), a);
+        result.QY = SIMD::Add(SIMD::Add(SIMD::Mul(ly, rw), SIMD::Mul(ry, lw)), b);
+        result.QZ = SIMD::Add(SIMD::Add(SIMD::Mul(lz, rw), SIMD::Mul(rz, lw)), c);
+        result.QW = SIMD::Sub(SIMD::Mul(lw, rw), d);
+    }
+}
+
+void PoseBlending::Lerp(const Transform* a, const Transform* b, float alpha, Transform* result, int32 count)
+{
+    const SimdVector4 alphaV = SIMD::Splat(alpha);
+    PoseSoA poseA, poseB, pose;
+    for (int32 i = 0; i < count; i += 4)
+    {
+        Gather(a, i, count, poseA);
+        Gather(b, i, count, poseB);
+        LerpPose(poseA, poseB, alphaV, pose);
+        Scatter(pose, result, i, count);
+    }
+}
+
+void PoseBlending::LerpMasked(const Transform* a, const Transform* b, const BitArray<>& mask, float alpha, Transform* result, int32 count)
+{
+    const SimdVector4 zero = SIMD::Splat(0.0f);
+    const int32 maskCount = mask.Count();
+    PoseSoA poseA, poseB, pose;
+    for (int32 i = 0; i < count; i += 4)
+    {
+        // Masked out nodes use zero alpha
+        const float m0 = i < maskCount && mask[i] ? alpha : 0.0f;
+        const float m1 = i + 1 < maskCount && mask[i + 1] ? alpha : 0.0f;
+        const float m2 = i + 2 < maskCount && mask[i + 2] ? alpha : 0.0f;
+        const float m3 = i + 3 < maskCount && mask[i + 3] ? alpha : 0.0f;
+        const SimdVector4 alphaV = SIMD::Load(m0, m1, m2, m3);
+        if (SIMD::MoveMask(SIMD::Less(zero, alphaV)) == 0)
+        {
+            // Copy first pose
+            if (result != a)
+            {
+                for (int32 j = i; j < Math::Min(i + 4, count); j++)
+                    result[j] = a[j];
+            }
+            continue;
+        }
+        Gather(a, i, count, poseA);
+        Gather(b, i, count, poseB);
+        LerpPose(poseA, poseB, alphaV, pose);
+        Scatter(pose, result, i, count);
+    }
+}
+
+void PoseBlending::Additive(const Transform* base, const Transform* additive, const SkeletonNode* reference, float alpha, Transform* result, int32 count)
+{
+    const SimdVector4 alphaV = SIMD::Splat(alpha);
+    Transform refNodes[4];
+    PoseSoA poseBase, poseAdditive, poseRef, pose;
+    for (int32 i = 0; i < count; i += 4)
+    {
+        const int32 lanes = Math::Min(count - i, 4);
+        for (int32 lane = 0; lane < lanes; lane++)
+            refNodes[lane] = reference[i + lane].LocalTransform;
+        Gather(base, i, count, poseBase);
+        Gather(additive, i, count, poseAdditive);
+        Gather(refNodes, 0, lanes, poseRef);
+
+        // base + (additive - reference)
+        pose.TX = SIMD::Add(poseBase.TX, SIMD::Sub(poseAdditive.TX, poseRef.TX));
+        pose.TY = SIMD::Add(poseBase.TY, SIMD::Sub(poseAdditive.TY, poseRef.TY));
+        pose.TZ = SIMD::Add(poseBase.TZ, SIMD::Sub(poseAdditive.TZ, poseRef.TZ));
+        pose.SX = SIMD::Add(poseBase.SX, SIMD::Sub(poseAdditive.SX, poseRef.SX));
+        pose.SY = SIMD::Add(poseBase.SY, SIMD::Sub(poseAdditive.SY, poseRef.SY));
+        pose.SZ = SIMD::Add(poseBase.SZ, SIMD::Sub(poseAdditive.SZ, poseRef.SZ));
+
+        // base * (inverse(reference) * additive)
+        const SimdVector4 negOne = SIMD::Splat(-1.0f);
+        MultiplyQ(SIMD::Mul(poseRef.QX, negOne), SIMD::Mul(poseRef.QY, negOne), SIMD::Mul(poseRef.QZ, negOne), poseRef.QW, poseAdditive.QX, poseAdditive.QY, poseAdditive.QZ, poseAdditive.QW, poseRef);
+        MultiplyQ(poseBase.QX, poseBase.QY, poseBase.QZ, poseBase.QW, poseRef.QX, poseRef.QY, poseRef.QZ, poseRef.QW, pose);
+
+        LerpPose(poseBase, pose, alphaV, pose);
+        Scatter(pose, result, i, count);
+    }
+}
+
+void PoseBlending::NormalizeRotations(Transform* nodes, int32 count)
+{
+    PoseSoA pose;
+    for (int32 i = 0; i < count; i += 4)
+    {
+        Gather(nodes, i, count, pose);
+        NormalizeQ(pose);
+        Scatter(pose, nodes, i, count);
+    }
+}
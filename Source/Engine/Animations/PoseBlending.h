@@ -0,0 +1,54 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Core/Types/BaseTypes.h"
+#include "Engine/Core/Collections/BitArray.h"
+
+struct Transform;
+struct SkeletonNode;
+
+/// <summary>
+/// Whole-pose blending kernels used by the Anim Graph. Process 4 nodes at once using SIMD (nodes are transposed into the structure-of-arrays streams: translation xyz, rotation xyzw and scale xyz). Rotations are blended with normalized lerp (shortest path).
+/// </summary>
+namespace PoseBlending
+{
+    /// <summary>
+    /// Blends two poses: result = lerp(a, b, alpha).
+    /// </summary>
+    /// <param name="a">The first pose nodes.</param>
+    /// <param name="b">The second pose nodes.</param>
+    /// <param name="alpha">The blend alpha (normalized to range 0-1).</param>
+    /// <param name="result">The output pose nodes (can be the same as a or b).</param>
+    /// <param name="count">The amount of nodes.</param>
+    FLAXENGINE_API void Lerp(const Transform* a, const Transform* b, float alpha, Transform* result, int32 count);
+
+    /// <summary>
+    /// Blends two poses only for the nodes enabled in the mask (other nodes are copied from the first pose).
+    /// </summary>
+    /// <param name="a">The first pose nodes.</param>
+    /// <param name="b">The second pose nodes.</param>
+    /// <param name="mask">The per-node mask.</param>
+    /// <param name="alpha">The blend alpha (normalized to range 0-1).</param>
+    /// <param name="result">The output pose nodes (can be the same as a or b).</param>
+    /// <param name="count">The amount of nodes.</param>
+    FLAXENGINE_API void LerpMasked(const Transform* a, const Transform* b, const BitArray<>& mask, float alpha, Transform* result, int32 count);
+
+    /// <summary>
+    /// Applies the additive pose: result = lerp(base, base + (additive - reference), alpha).
+    /// </summary>
+    /// <param name="base">The base pose nodes.</param>
+    /// <param name="additive">The additive pose nodes.</param>
+    /// <param name="reference">The reference pose skeleton nodes (local transformation of the nodes is used).</param>
+    /// <param name="alpha">The blend alpha (normalized to range 0-1).</param>
+    /// <param name="result">The output pose nodes (can be the same as base).</param>
+    /// <param name="count">The amount of nodes.</param>
+    FLAXENGINE_API void Additive(const Transform* base, const Transform* additive, const SkeletonNode* reference, float alpha, Transform* result, int32 count);
+
+    /// <summary>
+    /// Normalizes the rotations of the pose nodes.
+    /// </summary>
+    /// <param name="nodes">The pose nodes.</param>
+    /// <param name="count">The amount of nodes.</param>
+    FLAXENGINE_API void NormalizeRotations(Transform* nodes, int32 count);
+}
@@ -21,12 +21,17 @@
 #include "Engine/Scripting/ManagedCLR/MClass.h"
 #include "Engine/Scripting/ManagedCLR/MMethod.h"
 #include "Engine/Scripting/Internal/ManagedSerialization.h"
+#include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Threading/JobSystem.h"
 
 // This could be Update, LateUpdate or FixedUpdate
 #define UPDATE_POINT Update
 #define REGISTER_TICK GetScene()->Ticking.UPDATE_POINT.AddTick<SceneAnimationPlayer, &SceneAnimationPlayer::Tick>(this)
 #define UNREGISTER_TICK GetScene()->Ticking.UPDATE_POINT.RemoveTick(this)
 
+// The minimum amount of the property tracks to sample them in parallel via Job System
+#define SCENE_ANIMATION_PARALLEL_TRACKS_MIN 32
+
 SceneAnimationPlayer::SceneAnimationPlayer(const SpawnParams& params)
     : Actor(params)
 {
@@ -196,6 +201,7 @@ void SceneAnimationPlayer::Tick(float dt)
     _cameraCutCam = nullptr;
 
     // Tick the animation
+    SampleTracks(anim, time);
     CallStack callStack;
     Tick(anim, time, dt, 0, callStack);
 #if !BUILD_RELEASE
@@ -605,6 +611,57 @@ bool SceneAnimationPlayer::TickPropertyTrack(int32 trackIndex, int32 stateIndexO
     return true;
 }
 
+void SceneAnimationPlayer::SampleTracks(SceneAnimation* anim, float time)
+{
+#if USE_CSHARP
+    // Unlink tracks sampled in the previous update
+    for (const auto& e : _sampledTracks)
+    {
+        if (e.StateIndex < _tracks.Count())
+            _tracks[e.StateIndex].SampledTrackIndex = -1;
+    }
+    _sampledTracks.Clear();
+
+    // Gather property tracks that can be sampled without scripting (curves and keyframes of POD values), only the ones that are set directly on the object
+    int32 dataSize = 0;
+    for (int32 j = 0; j < anim->Tracks.Count(); j++)
+    {
+        const auto& track = anim->Tracks[j];
+        if (track.Disabled || track.ParentIndex == -1 || anim->Tracks[track.ParentIndex].Type == SceneAnimation::Track::Types::StructProperty)
+            continue;
+        const auto runtimeData = track.GetRuntimeData<SceneAnimation::PropertyTrack::Runtime>();
+        if (track.Type == SceneAnimation::Track::Types::CurveProperty ||
+            (track.Type == SceneAnimation::Track::Types::KeyframesProperty && runtimeData->ValueSize != 0))
+        {
+            auto& e = _sampledTracks.AddOne();
+            e.TrackIndex = j;
+            e.StateIndex = track.TrackStateIndex;
+            e.DataOffset = dataSize;
+            e.DataSize = Math::Max(runtimeData->ValueSize, (int32)sizeof(Double4));
+            e.Valid = false;
+            dataSize += Math::AlignUp(e.DataSize, 16);
+        }
+    }
+    if (_sampledTracks.Count() < SCENE_ANIMATION_PARALLEL_TRACKS_MIN)
+    {
+        // Not worth the jobs overhead
+        _sampledTracks.Clear();
+        return;
+    }
+    PROFILE_CPU();
+
+    // Sample tracks in parallel (only values are evaluated, properties are set during update on the main thread)
+    _sampledData.Resize(dataSize, false);
+    JobSystem::Execute([this, anim, time](int32 i)
+    {
+        auto& e = _sampledTracks[i];
+        e.Valid = TickPropertyTrack(e.TrackIndex, 0, anim, time, anim->Tracks[e.TrackIndex], _tracks[e.StateIndex], _sampledData.Get() + e.DataOffset);
+    }, _sampledTracks.Count(), 8);
+    for (int32 i = 0; i < _sampledTracks.Count(); i++)
+        _tracks[_sampledTracks[i].StateIndex].SampledTrackIndex = i;
+#endif
+}
+
 void SceneAnimationPlayer::Tick(SceneAnimation* anim, float time, float dt, int32 stateIndexOffset, CallStack& callStack)
 {
 #if USE_CSHARP
@@ -936,9 +993,17 @@ void SceneAnimationPlayer::Tick(SceneAnimation* anim, float time, float dt, int3
                 }
             }
 
+            // Cache value type
+            if (!state.ValueType)
+            {
+                state.ValueType = state.Property ? state.Property->GetType() : state.Field->GetType();
+                state.ValueSize = MCore::Type::GetSize(state.ValueType);
+                state.ValueIsObject = MCore::Type::GetType(state.ValueType) == MTypes::Object || MCore::Type::IsPointer(state.ValueType);
+            }
+
             // Get stack memory for data value
-            MType* valueType = state.Property ? state.Property->GetType() : state.Field->GetType();
-            int32 valueSize = MCore::Type::GetSize(valueType);
+            MType* valueType = state.ValueType;
+            const int32 valueSize = state.ValueSize;
             _tracksDataStack.AddDefault(valueSize);
             void* value = &_tracksDataStack[_tracksDataStack.Count() - valueSize];
 
@@ -1003,12 +1068,23 @@ void SceneAnimationPlayer::Tick(SceneAnimation* anim, float time, float dt, int3
                 }
             }
 
-            // Sample track
-            if (TickPropertyTrack(j, stateIndexOffset, anim, time, track, state, value))
+            // Sample track (use the value sampled ahead if available)
+            bool hasValue;
+            if (state.SampledTrackIndex != -1)
+            {
+                const auto& sampled = _sampledTracks[state.SampledTrackIndex];
+                hasValue = sampled.Valid && valueSize <= sampled.DataSize;
+                if (hasValue)
+                    Platform::MemoryCopy(value, _sampledData.Get() + sampled.DataOffset, valueSize);
+            }
+            else
+            {
+                hasValue = TickPropertyTrack(j, stateIndexOffset, anim, time, track, state, value);
+            }
+            if (hasValue)
             {
                 // Set the value
-                auto valueTypes = MCore::Type::GetType(valueType);
-                if (valueTypes == MTypes::Object || MCore::Type::IsPointer(valueType))
+                if (state.ValueIsObject)
                     value = (void*)*(intptr*)value;
                 if (state.Property)
                 {
@@ -1189,6 +1265,7 @@ void SceneAnimationPlayer::ResetState()
         actor->DeleteObject();
     _subActors.Resize(0);
     _tracks.Resize(0);
+    _sampledTracks.Resize(0);
     _restoreData.Resize(0);
 }
 
@@ -47,7 +47,11 @@ class FLAXENGINE_API SceneAnimationPlayer : public Actor, public IPostFxSettings
         MProperty* Property = nullptr;
         MField* Field = nullptr;
         MMethod* Method = nullptr;
+        MType* ValueType = nullptr;
+        int32 ValueSize = 0;
+        bool ValueIsObject = false;
         int32 RestoreStateIndex = -1;
+        int32 SampledTrackIndex = -1;
         bool Warn = true;
 
         TrackInstance()
@@ -55,11 +59,23 @@ class FLAXENGINE_API SceneAnimationPlayer : public Actor, public IPostFxSettings
         }
     };
 
+    // Property track sampled ahead of the tracks update (in parallel). Value data is stored in _sampledData.
+    struct SampledTrack
+    {
+        int32 TrackIndex;
+        int32 StateIndex;
+        int32 DataOffset;
+        int32 DataSize;
+        bool Valid;
+    };
+
     float _time = 0.0f;
     float _lastTime = 0.0f;
     PlayState _state = PlayState::Stopped;
     Array<TrackInstance> _tracks;
     Array<byte> _tracksDataStack;
+    Array<SampledTrack> _sampledTracks;
+    Array<byte> _sampledData;
     Array<Actor*> _subActors;
     Array<byte> _restoreData;
     Camera* _cameraCutCam = nullptr;
@@ -209,6 +225,7 @@ class FLAXENGINE_API SceneAnimationPlayer : public Actor, public IPostFxSettings
 private:
     void Restore(SceneAnimation* anim, int32 stateIndexOffset);
     bool TickPropertyTrack(int32 trackIndex, int32 stateIndexOffset, SceneAnimation* anim, float time, const SceneAnimation::Track& track, TrackInstance& state, void* target);
+    void SampleTracks(SceneAnimation* anim, float time);
     typedef Array<SceneAnimation*, FixedAllocation<8>> CallStack;
     void Tick(SceneAnimation* anim, float time, float dt, int32 stateIndexOffset, CallStack& callStack);
     void Tick();
@@ -3,15 +3,21 @@
 #include "Audio.h"
 #include "AudioBackend.h"
 #include "AudioSettings.h"
+#include "AudioListener.h"
+#include "AudioSource.h"
 #include "FlaxEngine.Gen.h"
 #include "Engine/Scripting/ScriptingType.h"
 #include "Engine/Scripting/BinaryModule.h"
 #include "Engine/Level/Level.h"
 #include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Profiler/ProfilerMemory.h"
 #include "Engine/Engine/Engine.h"
 #include "Engine/Engine/CommandLine.h"
 #include "Engine/Core/Log.h"
+#include "Engine/Core/Collections/Sorting.h"
 #include "Engine/Engine/EngineService.h"
+#include "Engine/Engine/Time.h"
+#include "Engine/Streaming/Streaming.h"
 #if AUDIO_API_NONE
 #include "None/AudioBackendNone.h"
 #endif
@@ -50,6 +56,26 @@ namespace
     int32 ActiveDeviceIndex = -1;
     bool MuteOnFocusLoss = true;
     bool EnableHRTF = true;
+    int32 MaxVoices = 64;
+
+    struct AudioVoiceEntry
+    {
+        AudioSource* Source;
+        float Audibility;
+
+        bool operator<(const AudioVoiceEntry& other) const
+        {
+            // Sort by priority first and then by audibility (descending)
+            const int32 priority = Source->GetPriority();
+            const int32 otherPriority = other.Source->GetPriority();
+            if (priority != otherPriority)
+                return priority > otherPriority;
+            return Audibility > other.Audibility;
+        }
+    };
+
+    Array<AudioVoiceEntry> VoicesCache;
+    AudioSourcesBatch SourcesBatch;
 }
 
 class AudioService : public EngineService
@@ -59,10 +85,13 @@ class AudioService : public EngineService
     AudioService()
         : EngineService(TEXT("Audio"), -50)
     {
+        ParallelInit = true;
+        Dependencies.Add(TEXT("GameSettings"));
     }
 
     bool Init() override;
     void Update() override;
+    void LateUpdate() override;
     void Dispose() override;
 };
 
@@ -79,11 +108,79 @@ namespace
     {
         AudioBackend::SetVolume(Volume);
     }
+
+    float GetAudibility(const AudioSource* source)
+    {
+        if (source->GetState() != AudioSource::States::Playing || !source->Clip || !source->Clip->IsLoaded())
+            return -1.0f;
+        float audibility = source->GetVolume();
+        if (source->Is3D() && Audio::Listeners.HasItems())
+        {
+            // Calculate attenuation to the closest listener (OpenAL formula for mode: AL_INVERSE_DISTANCE_CLAMPED)
+            const Vector3 position = source->GetPosition();
+            float distance = MAX_float;
+            for (const AudioListener* listener : Audio::Listeners)
+                distance = Math::Min(distance, (float)Vector3::Distance(position, listener->GetPosition()));
+            const float minDistance = source->GetMinDistance();
+            distance = Math::Clamp(distance, minDistance, MAX_float);
+            const float dst = minDistance + source->GetAttenuation() * (distance - minDistance);
+            if (dst > 0)
+                audibility *= Math::Saturate(minDistance / dst);
+        }
+        if (source->SourceIDs.HasItems())
+        {
+            // Favor sources that already have a voice to prevent swapping voices between similar sources every frame
+            audibility *= 1.25f;
+        }
+        return audibility;
+    }
+
+    void UpdateVoices()
+    {
+        PROFILE_CPU();
+        const float dt = Time::Update.UnscaledDeltaTime.GetTotalSeconds();
+        auto& sources = Audio::Sources;
+        if (MaxVoices <= 0 || sources.Count() <= MaxVoices)
+        {
+            // All sources fit within the limit
+            for (AudioSource* source : sources)
+            {
+                if (source->IsVirtual())
+                {
+                    source->UpdateVirtual(dt);
+                    if (source->Clip && source->Clip->IsLoaded())
+                        source->Devirtualize();
+                }
+            }
+            return;
+        }
+
+        // Rank sources by priority and audibility
+        VoicesCache.Clear();
+        for (AudioSource* source : sources)
+        {
+            if (source->IsVirtual())
+                source->UpdateVirtual(dt);
+            VoicesCache.Add({ source, GetAudibility(source) });
+        }
+        Sorting::QuickSort(VoicesCache.Get(), VoicesCache.Count());
+
+        // Release voices of the least audible sources before giving them to the most audible ones
+        for (int32 i = MaxVoices; i < VoicesCache.Count(); i++)
+            VoicesCache[i].Source->Virtualize();
+        for (int32 i = 0; i < MaxVoices; i++)
+        {
+            AudioSource* source = VoicesCache[i].Source;
+            if (source->IsVirtual() && source->Clip && source->Clip->IsLoaded())
+                source->Devirtualize();
+        }
+    }
 }
 
 void AudioSettings::Apply()
 {
     ::MuteOnFocusLoss = MuteOnFocusLoss;
+    ::MaxVoices = MaxVoices;
     if (AudioBackend::Instance != nullptr)
     {
         Audio::SetDopplerFactor(DopplerFactor);
@@ -190,7 +287,7 @@ bool AudioService::Init()
 {
     PROFILE_CPU_NAMED("Audio.Init");
     const auto settings = AudioSettings::Get();
-    const bool mute = CommandLine::Options.Mute.IsTrue() || settings->DisableAudio;
+    const bool mute = CommandLine::Options.Mute.IsTrue() || settings->DisableAudio || !Streaming::IsEnabled();
 
     // Pick a backend to use
     AudioBackend* backend = nullptr;
@@ -248,6 +345,7 @@ bool AudioService::Init()
 void AudioService::Update()
 {
     PROFILE_CPU_NAMED("Audio.Update");
+    PROFILE_MEM(Audio);
 
     // Update the master volume
     float masterVolume = MasterVolume;
@@ -262,6 +360,35 @@ void AudioService::Update()
         AudioBackend::SetVolume(masterVolume);
     }
 
+    // Limit the amount of the audio backend voices in use
+    UpdateVoices();
+}
+
+void AudioService::LateUpdate()
+{
+    PROFILE_CPU_NAMED("Audio.LateUpdate");
+    PROFILE_MEM(Audio);
+
+    // Gather sources spatial changes made during the frame and submit them to the audio backend at once
+    auto& batch = SourcesBatch;
+    batch.Clear();
+    for (AudioSource* source : Audio::Sources)
+    {
+        const byte changes = source->_pendingChanges;
+        if (changes == AudioSourcesBatch::None)
+            continue;
+        source->_pendingChanges = AudioSourcesBatch::None;
+        if (source->SourceIDs.IsEmpty())
+            continue;
+        batch.Sources.Add(source);
+        batch.Changes.Add(changes);
+        batch.Positions.Add(source->GetPosition());
+        batch.Orientations.Add(source->GetOrientation());
+        batch.Velocities.Add(source->GetVelocity());
+    }
+    if (batch.Count() != 0)
+        AudioBackend::Source::UpdateBatch(batch);
+
     AudioBackend::Update();
 }
 
@@ -270,6 +397,8 @@ void AudioService::Dispose()
     ASSERT(Audio::Sources.IsEmpty() && Audio::Listeners.IsEmpty());
 
     // Cleanup
+    VoicesCache.Resize(0);
+    SourcesBatch.Clear();
     Audio::Devices.Resize(0);
     if (AudioBackend::Instance)
     {
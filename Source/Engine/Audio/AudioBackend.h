@@ -5,6 +5,42 @@
 #include "Config.h"
 #include "Types.h"
 #include "Engine/Core/Types/BaseTypes.h"
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Core/Math/Vector3.h"
+#include "Engine/Core/Math/Quaternion.h"
+
+/// <summary>
+/// The batch of audio sources spatial state changes accumulated during a frame (structure of arrays). Submitted to the audio backend at once instead of a backend call per change.
+/// </summary>
+struct AudioSourcesBatch
+{
+    enum ChangeFlags : byte
+    {
+        None = 0,
+        TransformChanged = 1,
+        VelocityChanged = 2,
+    };
+
+    Array<AudioSource*> Sources;
+    Array<byte> Changes;
+    Array<Vector3> Positions;
+    Array<Quaternion> Orientations;
+    Array<Vector3> Velocities;
+
+    FORCE_INLINE int32 Count() const
+    {
+        return Sources.Count();
+    }
+
+    void Clear()
+    {
+        Sources.Clear();
+        Changes.Clear();
+        Positions.Clear();
+        Orientations.Clear();
+        Velocities.Clear();
+    }
+};
 
 /// <summary>
 /// The helper class for that handles active audio backend operations.
@@ -56,6 +92,16 @@ class AudioBackend
     virtual void Source_GetQueuedBuffersCount(AudioSource* source, int32& queuedBuffersCount) = 0;
     virtual void Source_QueueBuffer(AudioSource* source, uint32 bufferId) = 0;
     virtual void Source_DequeueProcessedBuffers(AudioSource* source) = 0;
+    virtual void Source_UpdateBatch(const AudioSourcesBatch& batch)
+    {
+        for (int32 i = 0; i < batch.Count(); i++)
+        {
+            if (batch.Changes[i] & AudioSourcesBatch::TransformChanged)
+                Source_TransformChanged(batch.Sources[i]);
+            if (batch.Changes[i] & AudioSourcesBatch::VelocityChanged)
+                Source_VelocityChanged(batch.Sources[i]);
+        }
+    }
 
     // Buffer
     virtual uint32 Buffer_Create() = 0;
@@ -218,6 +264,11 @@ class AudioBackend
         {
             Instance->Source_DequeueProcessedBuffers(source);
         }
+
+        FORCE_INLINE static void UpdateBatch(const AudioSourcesBatch& batch)
+        {
+            Instance->Source_UpdateBatch(batch);
+        }
     };
 
     class Buffer
@@ -7,7 +7,9 @@
 #include "Engine/Core/Log.h"
 #include "Engine/Content/Upgraders/AudioClipUpgrader.h"
 #include "Engine/Content/Factories/BinaryAssetFactory.h"
+#include "Engine/Content/Loading/ContentLoadTask.h"
 #include "Engine/Scripting/ManagedCLR/MUtils.h"
+#include "Engine/Streaming/Streaming.h"
 #include "Engine/Streaming/StreamingGroup.h"
 #include "Engine/Serialization/MemoryReadStream.h"
 #include "Engine/Tools/AudioTool/OggVorbisDecoder.h"
@@ -269,9 +271,10 @@ Task* AudioClip::CreateStreamingTask(int32 residency)
         const int32 idx = StreamingQueue[i];
         if (Buffers[idx] == AUDIO_BUFFER_ID_INVALID)
         {
-            const auto task = (Task*)RequestChunkDataAsync(idx);
+            const auto task = RequestChunkDataAsync(idx);
             if (task)
             {
+                task->Priority = ContentLoadPriority::Normal; // Playback is waiting for the data
                 if (result)
                     result->ContinueWith(task);
                 else
@@ -358,6 +361,10 @@ Asset::LoadResult AudioClip::load()
     }
 #endif
 
+    // Skip audio data on dedicated server (audio is muted)
+    if (!Streaming::IsEnabled())
+        return LoadResult::Ok;
+
     // Check if use audio streaming
     if (AudioHeader.Streamable)
     {
@@ -370,6 +377,14 @@ Asset::LoadResult AudioClip::load()
     if (LoadChunk(0))
         return LoadResult::CannotLoadData;
 
+    // Keep long compressed audio in memory and decode it during playback (by audio sources)
+    if (AudioHeader.Format == AudioFormat::Vorbis && GetLength() >= AUDIO_DECODE_MIN_CLIP_LENGTH)
+    {
+        const auto chunk = GetChunk(0);
+        _compressedData.Set(chunk->Get(), chunk->Size());
+        return LoadResult::Ok;
+    }
+
     // Create single buffer
     Buffers[0] = AudioBackend::Buffer::Create();
 
@@ -392,7 +407,10 @@ void AudioClip::unload(bool isReloading)
     {
         const auto src = Audio::Sources[sourceIndex];
         if (src->Clip == this)
+        {
             src->Stop();
+            src->ReleaseDecoder();
+        }
     }
 
     StopStreaming();
@@ -406,6 +424,7 @@ void AudioClip::unload(bool isReloading)
         }
     }
     Buffers.Clear();
+    _compressedData.SetCapacity(0, false);
     _totalChunks = 0;
     Platform::MemoryClear(&AudioHeader, sizeof(AudioHeader));
 }
@@ -428,7 +447,7 @@ bool AudioClip::WriteBuffer(int32 chunkIndex)
         return true;
     }
     Span<byte> data;
-    Array<byte> tmp1, tmp2;
+    Array<byte> tmp1;
     AudioDataInfo info = AudioHeader.Info;
     const uint32 bytesPerSample = info.BitDepth / 8;
 
@@ -462,19 +481,27 @@ bool AudioClip::WriteBuffer(int32 chunkIndex)
     }
     info.NumSamples = Math::AlignDown(data.Length() / bytesPerSample, info.NumChannels * bytesPerSample);
 
+    WriteSamples(bufferId, data, info);
+    return false;
+}
+
+void AudioClip::WriteSamples(AUDIO_BUFFER_ID_TYPE bufferId, Span<byte> data, AudioDataInfo info) const
+{
+    Array<byte> tmp;
+    const uint32 bytesPerSample = info.BitDepth / 8;
+
     // Convert to Mono if used as 3D source and backend doesn't support it
     if (Is3D() && info.NumChannels > 1 && EnumHasNoneFlags(AudioBackend::Features(), AudioBackend::FeatureFlags::SpatialMultiChannel))
     {
         const uint32 samplesPerChannel = info.NumSamples / info.NumChannels;
         const uint32 monoBufferSize = samplesPerChannel * bytesPerSample;
-        tmp2.Resize(monoBufferSize);
-        AudioTool::ConvertToMono(data.Get(), tmp2.Get(), info.BitDepth, samplesPerChannel, info.NumChannels);
+        tmp.Resize(monoBufferSize);
+        AudioTool::ConvertToMono(data.Get(), tmp.Get(), info.BitDepth, samplesPerChannel, info.NumChannels);
         info.NumChannels = 1;
         info.NumSamples = samplesPerChannel;
-        data = Span<byte>(tmp2.Get(), tmp2.Count());
+        data = Span<byte>(tmp.Get(), tmp.Count());
     }
 
     // Write samples to the audio buffer
     AudioBackend::Buffer::Write(bufferId, data.Get(), info);
-    return false;
 }
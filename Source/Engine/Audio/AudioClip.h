@@ -72,6 +72,7 @@ API_CLASS(NoSpawn) class FLAXENGINE_API AudioClip : public BinaryAsset, public S
     int32 _totalChunksSize;
     StreamingTask* _streamingTask;
     float _buffersStartTimes[ASSET_FILE_DATA_CHUNKS + 1];
+    Array<byte> _compressedData;
 
 public:
     /// <summary>
@@ -136,6 +137,14 @@ API_CLASS(NoSpawn) class FLAXENGINE_API AudioClip : public BinaryAsset, public S
         return _streamingTask != nullptr;
     }
 
+    /// <summary>
+    /// Returns true if the audio clip data is kept compressed in memory and gets decoded by the audio sources during playback (used by the long non-streamable clips).
+    /// </summary>
+    API_PROPERTY() FORCE_INLINE bool IsCompressedInMemory() const
+    {
+        return _compressedData.HasItems();
+    }
+
     /// <summary>
     /// Gets the length of the audio clip (in seconds).
     /// </summary>
@@ -160,6 +169,22 @@ API_CLASS(NoSpawn) class FLAXENGINE_API AudioClip : public BinaryAsset, public S
     /// <returns>The buffer index.</returns>
     int32 GetFirstBufferIndex(float time, float& offset) const;
 
+    /// <summary>
+    /// Gets the compressed audio data kept in memory (valid only if clip is compressed in memory).
+    /// </summary>
+    FORCE_INLINE Span<byte> GetCompressedData()
+    {
+        return Span<byte>(_compressedData.Get(), _compressedData.Count());
+    }
+
+    /// <summary>
+    /// Writes the decoded audio samples into the audio backend buffer and handles format conversion for runtime playback.
+    /// </summary>
+    /// <param name="bufferId">The audio backend buffer.</param>
+    /// <param name="data">The raw PCM samples data.</param>
+    /// <param name="info">The samples data information.</param>
+    void WriteSamples(AUDIO_BUFFER_ID_TYPE bufferId, Span<byte> data, AudioDataInfo info) const;
+
 public:
     /// <summary>
     /// Extracts the source audio data from the asset storage. Loads the whole asset. The result data is in an asset format.
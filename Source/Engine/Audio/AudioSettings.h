@@ -31,6 +31,12 @@ API_CLASS(sealed, Namespace="FlaxEditor.Content.Settings") class FLAXENGINE_API
     API_FIELD(Attributes="EditorOrder(200), DefaultValue(true), EditorDisplay(\"General\", \"Mute On Focus Loss\")")
     bool MuteOnFocusLoss = true;
 
+    /// <summary>
+    /// The maximum amount of audio sources that can use audio backend voices at once. The least audible sources above this limit are virtualized (they keep tracking the playback time but are not mixed). Use 0 for unlimited.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(250), DefaultValue(64), Limit(0, 4096), EditorDisplay(\"General\")")
+    int32 MaxVoices = 64;
+
     /// <summary>
     /// Enables or disables HRTF audio for in-engine processing of 3D audio (if supported by platform).
     /// If enabled, the user should be using two-channel/headphones audio output and have all other surround virtualization disabled (Atmos, DTS:X, vendor specific, etc.)
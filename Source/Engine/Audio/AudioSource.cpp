@@ -9,6 +9,7 @@
 #include "Engine/Level/Scene/Scene.h"
 #include "Engine/Profiler/ProfilerCPU.h"
 #include "AudioBackend.h"
+#include "AudioStreamDecoder.h"
 #include "Audio.h"
 
 AudioSource::AudioSource(const SpawnParams& params)
@@ -116,6 +117,11 @@ void AudioSource::SetAllowSpatialization(bool value)
         AudioBackend::Source::SpatialSetupChanged(this);
 }
 
+void AudioSource::SetPriority(int32 value)
+{
+    _priority = value;
+}
+
 void AudioSource::Play()
 {
     auto state = _state;
@@ -126,6 +132,14 @@ void AudioSource::Play()
         LOG(Warning, "Cannot play audio source without a clip ({0})", GetNamePath());
         return;
     }
+    if (_isVirtual)
+    {
+        // Virtual source only tracks the playback (Audio manager will give it a voice if it's audible enough)
+        if (state == States::Stopped)
+            _savedTime = 0.0f;
+        _state = States::Playing;
+        return;
+    }
 
     _state = States::Playing;
     _isActuallyPlayingSth = false;
@@ -154,9 +168,20 @@ void AudioSource::Play()
     }
     else if (SourceIDs.HasItems())
     {
-        // Play it right away
-        SetNonStreamingBuffer();
-        PlayInternal();
+        if (Clip->IsCompressedInMemory())
+        {
+            // Decode the audio during update (resume if has some buffers decoded already)
+            if (!_decoder)
+                _decoder = New<AudioStreamDecoder>(Clip.Get());
+            if (state == States::Paused && _decoder->HasQueuedBuffers())
+                PlayInternal();
+        }
+        else
+        {
+            // Play it right away
+            SetNonStreamingBuffer();
+            PlayInternal();
+        }
     }
     else
     {
@@ -190,12 +215,18 @@ void AudioSource::Stop()
 
     if (SourceIDs.HasItems())
         AudioBackend::Source::Stop(this);
+    if (_decoder)
+        _decoder->Reset(0.0f);
 }
 
 float AudioSource::GetTime() const
 {
+    if (_isVirtual)
+        return _state == States::Stopped ? 0.0f : _savedTime;
     if (_state == States::Stopped || SourceIDs.IsEmpty() || !Clip->IsLoaded())
         return 0.0f;
+    if (_decoder)
+        return _decoder->GetTime(this);
 
     float time = AudioBackend::Source::GetCurrentBufferTime(this);
 
@@ -216,6 +247,20 @@ void AudioSource::SetTime(float time)
 {
     if (_state == States::Stopped)
         return;
+    if (_isVirtual)
+    {
+        _savedTime = Clip && Clip->IsLoaded() ? Math::Clamp(time, 0.0f, Clip->GetLength()) : time;
+        return;
+    }
+    if (_decoder)
+    {
+        // Restart decoding from the new position (update queues the buffers and resumes the playback)
+        if (SourceIDs.HasItems())
+            AudioBackend::Source::Stop(this);
+        _isActuallyPlayingSth = false;
+        _decoder->Reset(time);
+        return;
+    }
 
     const bool isActuallyPlayingSth = _isActuallyPlayingSth;
     const auto state = _state;
@@ -264,17 +309,66 @@ void AudioSource::Cleanup()
     _savedState = GetState();
     _savedTime = GetTime();
     Stop();
+    ReleaseDecoder();
 
     if (SourceIDs.HasItems())
     {
         AudioBackend::Source::Cleanup(this);
         SourceIDs.Clear();
     }
+    _isVirtual = false;
+}
+
+void AudioSource::Virtualize()
+{
+    if (_isVirtual || SourceIDs.IsEmpty())
+        return;
+
+    // Release the voice but keep the playback going
+    const States state = _state;
+    Cleanup();
+    _state = state;
+    _isVirtual = true;
+}
+
+void AudioSource::Devirtualize()
+{
+    if (!_isVirtual)
+        return;
+    _isVirtual = false;
+
+    // Audio backend restores the saved state and time after creating the voice
+    _savedState = _state;
+    _state = States::Stopped;
+    AudioBackend::Source::OnAdd(this);
+}
+
+void AudioSource::UpdateVirtual(float dt)
+{
+    if (_state != States::Playing || !Clip || !Clip->IsLoaded())
+        return;
+
+    _savedTime += dt * _pitch;
+    const float length = Clip->GetLength();
+    if (_savedTime >= length)
+    {
+        // Loop over the clip or end play
+        if (_loop && length > ZeroTolerance)
+        {
+            _savedTime = Math::Mod(_savedTime, length);
+        }
+        else
+        {
+            _state = States::Stopped;
+            _savedTime = 0.0f;
+        }
+    }
 }
 
 void AudioSource::OnClipChanged()
 {
     Stop();
+    ReleaseDecoder();
     _clipChanged = true;
 }
 
@@ -290,6 +384,12 @@ void AudioSource::OnClipLoaded()
             // Request faster streaming update
             Clip->RequestStreamingUpdate();
         }
+        else if (Clip->IsCompressedInMemory())
+        {
+            // Decode the audio during update
+            if (!_decoder)
+                _decoder = New<AudioStreamDecoder>(Clip.Get());
+        }
         else
         {
             // Play it right away
@@ -301,11 +401,12 @@ void AudioSource::OnClipLoaded()
 
 bool AudioSource::UseStreaming() const
 {
-    return Clip && Clip->IsLoaded() && Clip->IsStreamable();
+    return Clip && Clip->IsLoaded() && (Clip->IsStreamable() || Clip->IsCompressedInMemory());
 }
 
 void AudioSource::Restore()
 {
+    _isVirtual = false;
     if (Clip)
     {
         if (_savedState != States::Stopped)
@@ -320,6 +421,18 @@ void AudioSource::Restore()
     }
 }
 
+void AudioSource::ReleaseDecoder()
+{
+    if (!_decoder)
+        return;
+
+    // Unbind the decoded buffers from the source before deleting them
+    if (_decoder->HasQueuedBuffers() && SourceIDs.HasItems())
+        AudioBackend::Source::Stop(this);
+    Delete(_decoder);
+    _decoder = nullptr;
+}
+
 void AudioSource::SetNonStreamingBuffer()
 {
     ASSERT(Clip && !Clip->IsStreamable());
@@ -374,6 +487,7 @@ void AudioSource::Serialize(SerializeStream& stream, const void* otherObj)
     SERIALIZE_MEMBER(PlayOnStart, _playOnStart);
     SERIALIZE_MEMBER(StartTime, _startTime);
     SERIALIZE_MEMBER(AllowSpatialization, _allowSpatialization);
+    SERIALIZE_MEMBER(Priority, _priority);
 }
 
 void AudioSource::Deserialize(DeserializeStream& stream, ISerializeModifier* modifier)
@@ -391,6 +505,7 @@ void AudioSource::Deserialize(DeserializeStream& stream, ISerializeModifier* mod
     DESERIALIZE_MEMBER(PlayOnStart, _playOnStart);
     DESERIALIZE_MEMBER(StartTime, _startTime);
     DESERIALIZE_MEMBER(AllowSpatialization, _allowSpatialization);
+    DESERIALIZE_MEMBER(Priority, _priority);
     DESERIALIZE(Clip);
 }
 
@@ -416,7 +531,20 @@ void AudioSource::Update()
     _prevPos = pos;
     if (_velocity != prevVelocity)
     {
-        AudioBackend::Source::VelocityChanged(this);
+        _pendingChanges |= AudioSourcesBatch::VelocityChanged;
+    }
+
+    // Handle the compressed audio decoding
+    if (_decoder)
+    {
+        if (_state == States::Playing && SourceIDs.HasItems())
+        {
+            if (_decoder->Update(this, _loop) || (!_isActuallyPlayingSth && _decoder->HasQueuedBuffers()))
+                PlayInternal();
+            else if (_decoder->IsEnded())
+                Stop();
+        }
+        return;
     }
 
     // Skip other update logic if it's not valid streamable source
@@ -537,7 +665,7 @@ void AudioSource::OnTransformChanged()
 
     if (IsActiveInHierarchy() && SourceIDs.HasItems())
     {
-        AudioBackend::Source::TransformChanged(this);
+        _pendingChanges |= AudioSourcesBatch::TransformChanged;
     }
 }
 
@@ -7,6 +7,8 @@
 #include "AudioClip.h"
 #include "Config.h"
 
+class AudioStreamDecoder;
+
 /// <summary>
 /// Represents a source for emitting audio. Audio can be played spatially (gun shot), or normally (music). Each audio source must have an AudioClip to play - back, and it can also have a position in the case of spatial(3D) audio.
 /// </summary>
@@ -19,6 +21,7 @@ class FLAXENGINE_API AudioSource : public Actor
     DECLARE_SCENE_OBJECT(AudioSource);
     friend class AudioStreamingHandler;
     friend class AudioClip;
+    friend class AudioService;
 public:
     /// <summary>
     /// Valid states in which AudioSource can be in.
@@ -55,6 +58,9 @@ class FLAXENGINE_API AudioSource : public Actor
     float _startTime;
     bool _allowSpatialization;
     bool _clipChanged = false;
+    bool _isVirtual = false;
+    byte _pendingChanges = 0; // AudioSourcesBatch::ChangeFlags submitted to the audio backend during the Audio late update
+    int32 _priority = 0;
 
     bool _isActuallyPlayingSth = false;
     bool _needToUpdateStreamingBuffers = false;
@@ -63,6 +69,7 @@ class FLAXENGINE_API AudioSource : public Actor
     States _savedState = States::Stopped;
     float _savedTime = 0;
     int32 _streamingFirstChunk = 0;
+    AudioStreamDecoder* _decoder = nullptr;
 
 public:
     /// <summary>
@@ -224,6 +231,20 @@ class FLAXENGINE_API AudioSource : public Actor
     /// </summary>
     API_PROPERTY() void SetAllowSpatialization(bool value);
 
+    /// <summary>
+    /// Gets the playback priority of the source. When there are more playing sources than the available voices, sources with higher priority are kept audible first, then the loudest ones.
+    /// </summary>
+    API_PROPERTY(Attributes="EditorOrder(85), DefaultValue(0), EditorDisplay(\"Audio Source\")")
+    FORCE_INLINE int32 GetPriority() const
+    {
+        return _priority;
+    }
+
+    /// <summary>
+    /// Sets the playback priority of the source. When there are more playing sources than the available voices, sources with higher priority are kept audible first, then the loudest ones.
+    /// </summary>
+    API_PROPERTY() void SetPriority(int32 value);
+
 public:
     /// <summary>
     /// Starts playing the currently assigned audio clip.
@@ -265,7 +286,7 @@ class FLAXENGINE_API AudioSource : public Actor
     API_PROPERTY() bool Is3D() const;
 
     /// <summary>
-    /// Returns true if audio clip is valid, loaded and uses dynamic data streaming.
+    /// Returns true if audio clip is valid, loaded and uses dynamic data streaming (chunks streaming or decoding of the compressed audio during playback).
     /// </summary>
     API_PROPERTY() bool UseStreaming() const;
 
@@ -283,6 +304,14 @@ class FLAXENGINE_API AudioSource : public Actor
         return _isActuallyPlayingSth;
     }
 
+    /// <summary>
+    /// Determines whether this audio source is virtual. Virtual source has no audio backend voice (it was released to be used by more audible sources) but it still tracks the playback state and time.
+    /// </summary>
+    API_PROPERTY() FORCE_INLINE bool IsVirtual() const
+    {
+        return _isVirtual;
+    }
+
     /// <summary>
     /// Requests the audio streaming buffers update. Rises tha flag to synchronize audio backend buffers of the emitter during next game logic update.
     /// </summary>
@@ -293,9 +322,26 @@ class FLAXENGINE_API AudioSource : public Actor
     /// </summary>
     void Cleanup();
 
+    /// <summary>
+    /// Releases the audio backend voice but keeps the playback state and time. Called by the Audio manager.
+    /// </summary>
+    void Virtualize();
+
+    /// <summary>
+    /// Acquires the audio backend voice and resumes the playback from the tracked time. Called by the Audio manager.
+    /// </summary>
+    void Devirtualize();
+
+    /// <summary>
+    /// Advances the playback time of the virtual source. Called by the Audio manager.
+    /// </summary>
+    /// <param name="dt">The delta time (in seconds).</param>
+    void UpdateVirtual(float dt);
+
 private:
     void OnClipChanged();
     void OnClipLoaded();
+    void ReleaseDecoder();
 
     /// <summary>
     /// Sets the single buffer from the audio clip that is not using dynamic streaming
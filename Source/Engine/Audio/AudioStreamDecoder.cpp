@@ -0,0 +1,211 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "AudioStreamDecoder.h"
+#include "AudioClip.h"
+#include "AudioSource.h"
+#include "AudioBackend.h"
+#include "Engine/Core/Log.h"
+#include "Engine/Core/Math/Math.h"
+#include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Threading/Task.h"
+
+AudioStreamDecoder::AudioStreamDecoder(AudioClip* clip)
+    : _clip(clip)
+{
+    Platform::MemoryClear(&_info, sizeof(_info));
+    for (auto& buffer : _buffers)
+    {
+        buffer.ID = AUDIO_BUFFER_ID_INVALID;
+        buffer.State = BufferStates::Free;
+        buffer.StartTime = 0.0f;
+        buffer.Length = 0.0f;
+    }
+
+#if COMPILE_WITH_OGG_VORBIS
+    const Span<byte> data = clip->GetCompressedData();
+    _stream.Init(data.Get(), data.Length());
+    if (!_decoder.Open(&_stream, _info) || _info.NumChannels == 0)
+    {
+        LOG(Warning, "Audio data decode failed (OggVorbisDecoder).");
+        return;
+    }
+    for (auto& buffer : _buffers)
+        buffer.ID = AudioBackend::Buffer::Create();
+    _isValid = true;
+#else
+    LOG(Warning, "OggVorbisDecoder is disabled.");
+#endif
+}
+
+AudioStreamDecoder::~AudioStreamDecoder()
+{
+    WaitForDecoding();
+    if (AudioBackend::Instance)
+    {
+        for (const auto& buffer : _buffers)
+        {
+            if (buffer.ID != AUDIO_BUFFER_ID_INVALID)
+                AudioBackend::Buffer::Delete(buffer.ID);
+        }
+    }
+}
+
+bool AudioStreamDecoder::IsEnded() const
+{
+    return _ended && _queuedCount == 0 && _buffers[_queueIndex].State != BufferStates::Ready && Platform::AtomicRead(&_isDecoding) == 0;
+}
+
+float AudioStreamDecoder::GetTime(const AudioSource* source) const
+{
+    if (_queuedCount == 0)
+        return _buffers[_playIndex].StartTime;
+
+    // Offset the oldest queued buffer start by the playback progress of the source (limited to the queued buffers)
+    float queuedLength = 0.0f;
+    for (int32 i = 0; i < _queuedCount; i++)
+        queuedLength += _buffers[(_playIndex + i) % AUDIO_DECODE_BUFFERS].Length;
+    float time = _buffers[_playIndex].StartTime + Math::Clamp(AudioBackend::Source::GetCurrentBufferTime(source), 0.0f, queuedLength);
+    const float length = _clip->GetLength();
+    if (time >= length && length > ZeroTolerance)
+        time = Math::Mod(time, length);
+    return time;
+}
+
+void AudioStreamDecoder::Reset(float time)
+{
+    WaitForDecoding();
+    if (!_isValid)
+        return;
+
+    // Seek to the sample at the given time
+    const uint32 channels = _info.NumChannels;
+    const uint32 totalFrames = _info.NumSamples / channels;
+    const uint32 frame = Math::Min((uint32)Math::Max(time * (float)_info.SampleRate, 0.0f), totalFrames);
+    _position = frame * channels;
+#if COMPILE_WITH_OGG_VORBIS
+    _decoder.Seek(_position);
+#endif
+
+    // Release all buffers
+    for (auto& buffer : _buffers)
+    {
+        buffer.State = BufferStates::Free;
+        buffer.StartTime = (float)frame / (float)Math::Max(1U, _info.SampleRate);
+        buffer.Length = 0.0f;
+    }
+    _decodeIndex = 0;
+    _queueIndex = 0;
+    _playIndex = 0;
+    _queuedCount = 0;
+    _ended = false;
+}
+
+bool AudioStreamDecoder::Update(AudioSource* source, bool loop)
+{
+    if (!_isValid)
+        return false;
+
+    // Release the played buffers
+    int32 processedCount = 0;
+    AudioBackend::Source::GetProcessedBuffersCount(source, processedCount);
+    processedCount = Math::Min(processedCount, _queuedCount);
+    if (processedCount > 0)
+    {
+        AudioBackend::Source::DequeueProcessedBuffers(source);
+        for (int32 i = 0; i < processedCount; i++)
+        {
+            _buffers[_playIndex].State = BufferStates::Free;
+            _playIndex = (_playIndex + 1) % AUDIO_DECODE_BUFFERS;
+        }
+        _queuedCount -= processedCount;
+    }
+    if (Platform::AtomicRead(&_isDecoding) != 0)
+        return false;
+
+    // Return buffers that were not decoded (reached the audio end)
+    for (int32 i = 0; i < AUDIO_DECODE_BUFFERS; i++)
+    {
+        auto& buffer = _buffers[(_decodeIndex + i) % AUDIO_DECODE_BUFFERS];
+        if (buffer.State != BufferStates::Decoding)
+            break;
+        buffer.State = BufferStates::Free;
+    }
+
+    // Queue the decoded buffers (in the ring order)
+    const bool wasEmpty = _queuedCount == 0;
+    while (_queuedCount < AUDIO_DECODE_BUFFERS && _buffers[_queueIndex].State == BufferStates::Ready)
+    {
+        auto& buffer = _buffers[_queueIndex];
+        AudioBackend::Source::QueueBuffer(source, buffer.ID);
+        buffer.State = BufferStates::Queued;
+        _queueIndex = (_queueIndex + 1) % AUDIO_DECODE_BUFFERS;
+        _queuedCount++;
+    }
+
+    // Decode the next buffers on a worker thread
+    if (!_ended || loop)
+    {
+        int32 freeCount = 0;
+        while (freeCount < AUDIO_DECODE_BUFFERS && _buffers[(_decodeIndex + freeCount) % AUDIO_DECODE_BUFFERS].State == BufferStates::Free)
+            _buffers[(_decodeIndex + freeCount++) % AUDIO_DECODE_BUFFERS].State = BufferStates::Decoding;
+        if (freeCount != 0)
+        {
+            _ended = false;
+            Platform::AtomicStore(&_isDecoding, 1);
+            Function<void()> action = [this, freeCount, loop]
+            {
+                Decode(freeCount, loop);
+            };
+            Task::StartNew(action);
+        }
+    }
+
+    return wasEmpty && _queuedCount != 0;
+}
+
+void AudioStreamDecoder::WaitForDecoding()
+{
+    while (Platform::AtomicRead(&_isDecoding) != 0)
+        Platform::Sleep(0);
+}
+
+void AudioStreamDecoder::Decode(int32 count, bool loop)
+{
+    PROFILE_CPU();
+#if COMPILE_WITH_OGG_VORBIS
+    const uint32 channels = _info.NumChannels;
+    const uint32 bytesPerSample = _info.BitDepth / 8;
+    const uint32 bufferSamples = Math::Max((uint32)(AUDIO_DECODE_BUFFER_LENGTH * (float)_info.SampleRate), 1U) * channels;
+    const float samplesToTime = 1.0f / (float)Math::Max(1U, _info.SampleRate * channels);
+    for (int32 i = 0; i < count; i++)
+    {
+        uint32 samples = Math::Min(bufferSamples, _info.NumSamples - _position);
+        if (samples == 0 && loop)
+        {
+            // Loop over the clip
+            _decoder.Seek(0);
+            _position = 0;
+            samples = Math::Min(bufferSamples, _info.NumSamples);
+        }
+        if (samples == 0)
+        {
+            _ended = true;
+            break;
+        }
+
+        // Decode samples and write them to the audio buffer
+        _samples.Resize(samples * bytesPerSample, false);
+        _decoder.Read(_samples.Get(), samples);
+        auto& buffer = _buffers[_decodeIndex];
+        buffer.StartTime = (float)_position * samplesToTime;
+        buffer.Length = (float)samples * samplesToTime;
+        _position += samples;
+        AudioDataInfo info = _info;
+        info.NumSamples = samples;
+        _clip->WriteSamples(buffer.ID, Span<byte>(_samples.Get(), _samples.Count()), info);
+        buffer.State = BufferStates::Ready;
+        _decodeIndex = (_decodeIndex + 1) % AUDIO_DECODE_BUFFERS;
+    }
+#endif
+    Platform::AtomicStore(&_isDecoding, 0);
+}
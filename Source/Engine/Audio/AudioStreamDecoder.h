@@ -0,0 +1,102 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Types.h"
+#include "Config.h"
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Serialization/MemoryReadStream.h"
+#if COMPILE_WITH_OGG_VORBIS
+#include "Engine/Tools/AudioTool/OggVorbisDecoder.h"
+#endif
+
+/// <summary>
+/// Incremental decoder of the compressed audio clip data that is kept in memory. Decodes the audio on a worker thread into a small ring of audio backend buffers that are queued to the audio source for playback.
+/// </summary>
+class AudioStreamDecoder
+{
+private:
+    enum class BufferStates : byte
+    {
+        Free,
+        Decoding,
+        Ready,
+        Queued,
+    };
+
+    struct Buffer
+    {
+        AUDIO_BUFFER_ID_TYPE ID;
+        BufferStates State;
+        float StartTime;
+        float Length;
+    };
+
+    AudioClip* _clip;
+    AudioDataInfo _info;
+    MemoryReadStream _stream;
+#if COMPILE_WITH_OGG_VORBIS
+    OggVorbisDecoder _decoder;
+#endif
+    Array<byte> _samples;
+    Buffer _buffers[AUDIO_DECODE_BUFFERS];
+    int32 _decodeIndex = 0; // The next buffer in the ring to decode
+    int32 _queueIndex = 0; // The next buffer in the ring to queue to the source
+    int32 _playIndex = 0; // The oldest buffer queued to the source
+    int32 _queuedCount = 0;
+    uint32 _position = 0; // The decoded samples offset (for all channels)
+    bool _isValid = false;
+    bool _ended = false;
+    volatile int64 _isDecoding = 0;
+
+public:
+    AudioStreamDecoder(AudioClip* clip);
+    ~AudioStreamDecoder();
+
+public:
+    /// <summary>
+    /// Determines whether the decoder has been properly initialized.
+    /// </summary>
+    FORCE_INLINE bool IsValid() const
+    {
+        return _isValid;
+    }
+
+    /// <summary>
+    /// Determines whether any decoded buffers are queued to the source.
+    /// </summary>
+    FORCE_INLINE bool HasQueuedBuffers() const
+    {
+        return _queuedCount != 0;
+    }
+
+    /// <summary>
+    /// Determines whether the whole audio has been decoded and played.
+    /// </summary>
+    bool IsEnded() const;
+
+    /// <summary>
+    /// Gets the current playback time (in seconds).
+    /// </summary>
+    /// <param name="source">The audio source that plays the decoded buffers.</param>
+    /// <returns>The playback time.</returns>
+    float GetTime(const AudioSource* source) const;
+
+    /// <summary>
+    /// Resets the decoding to start from the given time. Source must have no buffers queued (eg. stopped by the audio backend).
+    /// </summary>
+    /// <param name="time">The playback time (in seconds).</param>
+    void Reset(float time);
+
+    /// <summary>
+    /// Updates the source buffers queue: releases the played buffers, queues the decoded ones and starts decoding of the next buffers.
+    /// </summary>
+    /// <param name="source">The audio source that plays the decoded buffers.</param>
+    /// <param name="loop">True if loop the playback.</param>
+    /// <returns>True if the source needs to start the playback because it had no buffers queued before.</returns>
+    bool Update(AudioSource* source, bool loop);
+
+private:
+    void WaitForDecoding();
+    void Decode(int32 count, bool loop);
+};
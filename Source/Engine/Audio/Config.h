@@ -18,3 +18,12 @@
 
 // The buffer ID that is invalid (unused)
 #define AUDIO_BUFFER_ID_INVALID 0
+
+// The minimum length (in seconds) of the non-streamable compressed audio clip to keep it compressed in memory and decode it during playback
+#define AUDIO_DECODE_MIN_CLIP_LENGTH 5.0f
+
+// The amount of decoded audio buffers used per audio source that plays compressed audio clip
+#define AUDIO_DECODE_BUFFERS 3
+
+// The length (in seconds) of a single decoded audio buffer used by the audio source that plays compressed audio clip
+#define AUDIO_DECODE_BUFFER_LENGTH 0.25f
@@ -61,7 +61,10 @@ namespace ALC
 {
     ALCdevice* Device = nullptr;
     Array<ALCcontext*, FixedAllocation<AUDIO_MAX_LISTENERS>> Contexts;
+    Array<uint32> SourcesPool[AUDIO_MAX_LISTENERS]; // Released sources (per-context) to reuse instead of creating new ones
     AudioBackend::FeatureFlags Features = AudioBackend::FeatureFlags::None;
+    LPALDEFERUPDATESSOFT DeferUpdatesSOFT = nullptr;
+    LPALPROCESSUPDATESSOFT ProcessUpdatesSOFT = nullptr;
 
     bool IsExtensionSupported(const char* extension)
     {
@@ -103,6 +106,17 @@ namespace ALC
 
     void ClearContexts()
     {
+        for (int32 i = 0; i < Contexts.Count(); i++)
+        {
+            auto& pool = SourcesPool[i];
+            if (pool.HasItems())
+            {
+                alcMakeContextCurrent(Contexts[i]);
+                alDeleteSources(pool.Count(), pool.Get());
+                pool.Clear();
+            }
+        }
+
         alcMakeContextCurrent(nullptr);
 
         for (ALCcontext* context : Contexts)
@@ -132,7 +146,10 @@ namespace ALC
 
             ALC_FOR_EACH_CONTEXT()
                 uint32 sourceID = 0;
-                alGenSources(1, &sourceID);
+                if (SourcesPool[i].HasItems())
+                    sourceID = SourcesPool[i].Pop();
+                else
+                    alGenSources(1, &sourceID);
 
                 source->SourceIDs.Add(sourceID);
             }
@@ -159,6 +176,9 @@ namespace ALC
                 }
                 else
                 {
+#ifdef AL_SOFT_source_spatialize
+                    alSourcei(sourceID, AL_SOURCE_SPATIALIZE_SOFT, AL_AUTO_SOFT);
+#endif
                     alSourcef(sourceID, AL_ROLLOFF_FACTOR, 0.0f);
                     alSourcef(sourceID, AL_DOPPLER_FACTOR, 1.0f);
                     alSourcef(sourceID, AL_REFERENCE_DISTANCE, 0.0f);
@@ -457,9 +477,8 @@ void AudioBackendOAL::Source_ClipLoaded(AudioSource* source)
 {
     if (source->SourceIDs.Count() < ALC::Contexts.Count())
         return;
-    const auto clip = source->Clip.Get();
     const bool is3D = source->Is3D();
-    const bool loop = source->GetIsLooping() && !clip->IsStreamable();
+    const bool loop = source->GetIsLooping() && !source->UseStreaming();
 
     ALC_FOR_EACH_CONTEXT()
         const uint32 sourceID = source->SourceIDs[i];
@@ -472,10 +491,12 @@ void AudioBackendOAL::Source_Cleanup(AudioSource* source)
 {
     ALC_FOR_EACH_CONTEXT()
         const uint32 sourceID = source->SourceIDs[i];
+        alSourceStop(sourceID);
         alSourcei(sourceID, AL_BUFFER, 0);
         ALC_CHECK_ERROR(alSourcei);
-        alDeleteSources(1, &sourceID);
-        ALC_CHECK_ERROR(alDeleteSources);
+
+        // Keep the source for reuse (Rebuild resets its properties)
+        ALC::SourcesPool[i].Add(sourceID);
     }
 }
 
@@ -600,6 +621,32 @@ void AudioBackendOAL::Source_DequeueProcessedBuffers(AudioSource* source)
     }
 }
 
+void AudioBackendOAL::Source_UpdateBatch(const AudioSourcesBatch& batch)
+{
+    PROFILE_CPU();
+    ALC_FOR_EACH_CONTEXT()
+        // Defer the mixer updates to apply all the changes at once
+        if (ALC::DeferUpdatesSOFT)
+            ALC::DeferUpdatesSOFT();
+
+        for (int32 j = 0; j < batch.Count(); j++)
+        {
+            const AudioSource* source = batch.Sources[j];
+            if (!source->Is3D())
+                continue;
+            const uint32 sourceID = source->SourceIDs[i];
+            const byte changes = batch.Changes[j];
+            if (changes & AudioSourcesBatch::TransformChanged)
+                alSource3f(sourceID, AL_POSITION, FLAX_POS_TO_OAL(batch.Positions[j]));
+            if (changes & AudioSourcesBatch::VelocityChanged)
+                alSource3f(sourceID, AL_VELOCITY, FLAX_VEL_TO_OAL(batch.Velocities[j]));
+        }
+
+        if (ALC::ProcessUpdatesSOFT)
+            ALC::ProcessUpdatesSOFT();
+    }
+}
+
 uint32 AudioBackendOAL::Buffer_Create()
 {
     uint32 bufferId;
@@ -869,6 +916,18 @@ bool AudioBackendOAL::Base_Init()
     if (ALC::IsExtensionSupported("AL_SOFT_source_spatialize"))
         ALC::Features = EnumAddFlags(ALC::Features, FeatureFlags::SpatialMultiChannel);
 #endif
+#ifdef AL_SOFT_deferred_updates
+    if (ALC::IsExtensionSupported("AL_SOFT_deferred_updates"))
+    {
+        ALC::DeferUpdatesSOFT = (LPALDEFERUPDATESSOFT)alGetProcAddress("alDeferUpdatesSOFT");
+        ALC::ProcessUpdatesSOFT = (LPALPROCESSUPDATESSOFT)alGetProcAddress("alProcessUpdatesSOFT");
+        if (!ALC::DeferUpdatesSOFT || !ALC::ProcessUpdatesSOFT)
+        {
+            ALC::DeferUpdatesSOFT = nullptr;
+            ALC::ProcessUpdatesSOFT = nullptr;
+        }
+    }
+#endif
 
     // Log service info
     LOG(Info, "{0} ({1})", String(alGetString(AL_RENDERER)), String(alGetString(AL_VERSION)));
@@ -886,6 +945,7 @@ void AudioBackendOAL::Base_Update()
 
 void AudioBackendOAL::Base_Dispose()
 {
+    ALC::ClearContexts();
     if (ALC::Device != nullptr)
     {
         alcCloseDevice(ALC::Device);
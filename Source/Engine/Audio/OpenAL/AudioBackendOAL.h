@@ -40,6 +40,7 @@ class AudioBackendOAL : public AudioBackend
     void Source_GetQueuedBuffersCount(AudioSource* source, int32& queuedBuffersCount) override;
     void Source_QueueBuffer(AudioSource* source, uint32 bufferId) override;
     void Source_DequeueProcessedBuffers(AudioSource* source) override;
+    void Source_UpdateBatch(const AudioSourcesBatch& batch) override;
     uint32 Buffer_Create() override;
     void Buffer_Delete(uint32 bufferId) override;
     void Buffer_Write(uint32 bufferId, byte* samples, const AudioDataInfo& info) override;
@@ -11,6 +11,8 @@
 #include "Engine/Audio/AudioSource.h"
 #include "Engine/Audio/AudioListener.h"
 #include "Engine/Threading/Threading.h"
+#include "Engine/Threading/JobSystem.h"
+#include "Engine/Profiler/ProfilerCPU.h"
 
 #if PLATFORM_WINDOWS
 // Tweak Win ver
@@ -28,6 +30,8 @@
 #define MAX_INPUT_CHANNELS 2
 #define MAX_OUTPUT_CHANNELS 2
 #define MAX_CHANNELS_MATRIX_SIZE (MAX_INPUT_CHANNELS*MAX_OUTPUT_CHANNELS)
+#define VOICES_OPERATION_SET 1 // Operation set used to commit all voices changes at once
+#define VOICES_JOB_MIN_COUNT 64 // Minimum amount of dirty voices to calculate their mix in a job
 #if ENABLE_ASSERTION
 #define XAUDIO2_CHECK_ERROR(method) \
     if (hr != 0) \
@@ -192,6 +196,8 @@ namespace XAudio2
     CriticalSection Locker;
     ChunkedArray<Source, 32> Sources;
     ChunkedArray<Buffer*, 64> Buffers; // TODO: use ChunkedArray for better performance or use buffers pool?
+    Array<int32> DirtySources;
+    Array<AudioBackendTools::SoundMix> DirtyMixes;
     EngineCallback Callback;
 
     Listener* GetListener()
@@ -686,12 +692,31 @@ void AudioBackendXAudio2::Source_DequeueProcessedBuffers(AudioSource* source)
     auto aSource = XAudio2::GetSource(source);
     if (aSource && aSource->Voice)
     {
-        const HRESULT hr = aSource->Voice->FlushSourceBuffers();
-        XAUDIO2_CHECK_ERROR(FlushSourceBuffers);
+        // Voice removes the played buffers from its queue on its own (flushing would drop the pending buffers too)
         aSource->BuffersProcessed = 0;
     }
 }
 
+void AudioBackendXAudio2::Source_UpdateBatch(const AudioSourcesBatch& batch)
+{
+    ScopeLock lock(XAudio2::Locker);
+    for (int32 i = 0; i < batch.Count(); i++)
+    {
+        auto aSource = XAudio2::GetSource(batch.Sources[i]);
+        if (!aSource)
+            continue;
+        const byte changes = batch.Changes[i];
+        if (changes & AudioSourcesBatch::TransformChanged)
+        {
+            aSource->Position = batch.Positions[i];
+            aSource->Orientation = batch.Orientations[i];
+        }
+        if (changes & AudioSourcesBatch::VelocityChanged)
+            aSource->Velocity = batch.Velocities[i];
+        aSource->IsDirty = true;
+    }
+}
+
 uint32 AudioBackendXAudio2::Buffer_Create()
 {
     uint32 bufferId;
@@ -820,24 +845,56 @@ bool AudioBackendXAudio2::Base_Init()
 
 void AudioBackendXAudio2::Base_Update()
 {
-    // Update dirty voices
-    const auto listener = XAudio2::GetListener();
-    float outputMatrix[MAX_CHANNELS_MATRIX_SIZE];
+    PROFILE_CPU();
+    ScopeLock lock(XAudio2::Locker);
+
+    // Gather dirty voices
+    auto& dirtySources = XAudio2::DirtySources;
+    dirtySources.Clear();
     for (int32 i = 0; i < XAudio2::Sources.Count(); i++)
     {
-        auto& source = XAudio2::Sources[i];
-        if (source.IsFree() || !(source.IsDirty || XAudio2::ForceDirty))
-            continue;
+        const auto& source = XAudio2::Sources[i];
+        if (!source.IsFree() && (source.IsDirty || XAudio2::ForceDirty))
+            dirtySources.Add(i);
+    }
 
-        auto mix = AudioBackendTools::CalculateSoundMix(XAudio2::Settings, *listener, source, XAudio2::Channels);
+    // Calculate the spatialization of the dirty voices (in parallel if there are many of them)
+    const auto listener = XAudio2::GetListener();
+    auto& dirtyMixes = XAudio2::DirtyMixes;
+    dirtyMixes.Resize(dirtySources.Count(), false);
+    const auto calculateMix = [&](int32 i)
+    {
+        const auto& source = XAudio2::Sources[dirtySources[i]];
+        auto& mix = dirtyMixes[i];
+        mix = AudioBackendTools::CalculateSoundMix(XAudio2::Settings, *listener, source, XAudio2::Channels);
         mix.VolumeIntoChannels();
+    };
+    if (dirtySources.Count() >= VOICES_JOB_MIN_COUNT)
+        JobSystem::Execute(calculateMix, dirtySources.Count());
+    else
+    {
+        for (int32 i = 0; i < dirtySources.Count(); i++)
+            calculateMix(i);
+    }
+
+    // Submit all voices changes in a single operation set
+    float outputMatrix[MAX_CHANNELS_MATRIX_SIZE];
+    for (int32 i = 0; i < dirtySources.Count(); i++)
+    {
+        auto& source = XAudio2::Sources[dirtySources[i]];
+        auto& mix = dirtyMixes[i];
         AudioBackendTools::MapChannels(source.Channels, XAudio2::Channels, mix.Channels, outputMatrix);
 
-        source.Voice->SetFrequencyRatio(mix.Pitch);
-        source.Voice->SetOutputMatrix(XAudio2::MasteringVoice, source.Channels, XAudio2::Channels, outputMatrix);
+        source.Voice->SetFrequencyRatio(mix.Pitch, VOICES_OPERATION_SET);
+        source.Voice->SetOutputMatrix(XAudio2::MasteringVoice, source.Channels, XAudio2::Channels, outputMatrix, VOICES_OPERATION_SET);
 
         source.IsDirty = false;
     }
+    if (dirtySources.HasItems())
+    {
+        const HRESULT hr = XAudio2::Instance->CommitChanges(VOICES_OPERATION_SET);
+        XAUDIO2_CHECK_ERROR(CommitChanges);
+    }
 
     // Clear flag
     XAudio2::ForceDirty = false;
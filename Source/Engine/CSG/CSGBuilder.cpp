@@ -4,8 +4,11 @@
 #include "CSGMesh.h"
 #include "CSGData.h"
 #include "Engine/Level/Level.h"
-#include "Engine/Level/SceneQuery.h"
 #include "Engine/Level/Actor.h"
+#include "Engine/Level/Scene/Scene.h"
+#include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Core/Collections/Sorting.h"
+#include "Engine/Core/Math/Vector2.h"
 #include "Engine/Core/Log.h"
 #include "Engine/Core/Types/TimeSpan.h"
 #include "Engine/Graphics/Models/ModelData.h"
@@ -18,6 +21,8 @@
 #include "Engine/Engine/Engine.h"
 #include "Engine/Engine/EngineService.h"
 #include "Engine/Serialization/MemoryWriteStream.h"
+#include "Engine/Threading/JobSystem.h"
+#include "Engine/Threading/Task.h"
 #if USE_EDITOR
 #include "Editor/Editor.h"
 #endif
@@ -26,19 +31,146 @@
 
 using namespace CSG;
 
-// Enable/disable locking scene during building CSG brushes nodes
-#define CSG_USE_SCENE_LOCKS 0
-
 struct BuildData;
 
 namespace CSGBuilderImpl
 {
+    // Snapshot of the brush data (captured on a main thread to build CSG on a job thread)
+    class BrushSnapshot : public Brush
+    {
+    public:
+        Guid ID;
+        Mode BrushMode;
+        Array<Surface> Surfaces;
+
+        uint32 GetDataHash() const
+        {
+            uint32 hash = GetHash(ID);
+            CombineHash(hash, (uint32)BrushMode);
+            for (const Surface& e : Surfaces)
+            {
+                CombineHash(hash, GetHash(e.Normal.X));
+                CombineHash(hash, GetHash(e.Normal.Y));
+                CombineHash(hash, GetHash(e.Normal.Z));
+                CombineHash(hash, GetHash(e.D));
+                CombineHash(hash, GetHash(e.Material));
+            }
+            return hash;
+        }
+
+        bool DataEquals(const BrushSnapshot& other) const
+        {
+            if (ID != other.ID || BrushMode != other.BrushMode || Surfaces.Count() != other.Surfaces.Count())
+                return false;
+            for (int32 i = 0; i < Surfaces.Count(); i++)
+            {
+                const Surface& a = Surfaces[i];
+                const Surface& b = other.Surfaces[i];
+                if (a.Normal != b.Normal || a.D != b.D || a.Material != b.Material ||
+                    a.TexCoordScale != b.TexCoordScale || a.TexCoordOffset != b.TexCoordOffset ||
+                    a.TexCoordRotation != b.TexCoordRotation || a.ScaleInLightmap != b.ScaleInLightmap)
+                    return false;
+            }
+            return true;
+        }
+
+        // [Brush]
+        Scene* GetBrushScene() const override
+        {
+            return nullptr;
+        }
+
+        Guid GetBrushID() const override
+        {
+            return ID;
+        }
+
+        Mode GetBrushMode() const override
+        {
+            return BrushMode;
+        }
+
+        void GetSurfaces(Array<Surface, HeapAllocation>& surfaces) override
+        {
+            surfaces.Resize(Surfaces.Count(), false);
+            for (int32 i = 0; i < Surfaces.Count(); i++)
+                surfaces[i] = Surfaces[i];
+        }
+
+        int32 GetSurfacesCount() override
+        {
+            return Surfaces.Count();
+        }
+    };
+
+    // Snapshot of the scene hierarchy node (only actors that contain brushes in their subtree), stored in pre-order
+    struct BrushNode
+    {
+        int32 Brush; // Index of the brush or -1 if actor is not a brush
+        int32 Parent; // Index of the parent node or -1 if root
+        int32 Depth;
+        int32 End; // Index of the next node after this node subtree
+    };
+
+    // Cached CSG geometry of the spatial cluster of brushes (brushes that overlap with each other)
+    struct ClusterCache
+    {
+        uint32 Hash;
+        Array<Int2> Layout; // Hierarchy nodes (depth and the cluster brush index or -1) in pre-order
+        Array<BrushSnapshot*> Brushes;
+        RawData* Data = nullptr;
+
+        ~ClusterCache()
+        {
+            Brushes.ClearDelete();
+            if (Data)
+                Delete(Data);
+        }
+
+        bool Equals(const ClusterCache& other) const
+        {
+            if (Hash != other.Hash || Layout.Count() != other.Layout.Count() || Brushes.Count() != other.Brushes.Count())
+                return false;
+            for (int32 i = 0; i < Layout.Count(); i++)
+            {
+                if (Layout[i] != other.Layout[i])
+                    return false;
+            }
+            for (int32 i = 0; i < Brushes.Count(); i++)
+            {
+                if (!Brushes[i]->DataEquals(*other.Brushes[i]))
+                    return false;
+            }
+            return true;
+        }
+    };
+
+    // Brush bounds sorted along X axis (for clustering)
+    struct SortedBrush
+    {
+        int32 Index;
+        AABB Bounds;
+
+        bool operator<(const SortedBrush& other) const
+        {
+            return Bounds.MinX < other.Bounds.MinX;
+        }
+    };
+
     Array<Scene*> ScenesToRebuild;
+    Dictionary<Scene*, Array<ClusterCache*>> Caches;
+    BuildData* Building = nullptr;
+    Task* BuildTask = nullptr;
+    volatile int64 BuildDone = 0;
 
     void onSceneUnloading(Scene* scene, const Guid& sceneId);
-    bool buildInner(Scene* scene, BuildData& data);
-    void build(Scene* scene);
-    bool generateRawDataAsset(Scene* scene, RawData& meshData, Guid& assetId, const String& assetPath);
+    void snapshotTree(Actor* actor, BuildData& data, int32 parent, int32 depth);
+    void startBuild(Scene* scene);
+    void buildJob();
+    bool buildInner(BuildData& data);
+    void endBuild();
+    void waitForBuild();
+    bool generateRawDataAsset(RawData& meshData, Guid& assetId, const String& assetPath);
 }
 
 using namespace CSGBuilderImpl;
@@ -53,16 +185,55 @@ class CSGBuilderService : public EngineService
 
     bool Init() override;
     void Update() override;
+    void Dispose() override;
 };
 
 CSGBuilderService CSGBuilderServiceInstance;
 
 Delegate<Brush*> Builder::OnBrushModified;
 
+struct BuildData
+{
+    Scene* Scene;
+    DateTime StartTime;
+    String DataFolderPath;
+    Transform SceneTransform;
+    Matrix WorldToLocal;
+    Array<BrushSnapshot*> Brushes;
+    Array<BrushNode> Nodes;
+    MeshesArray Meshes;
+    Array<ClusterCache*> PrevClusters;
+    Array<ClusterCache*> Clusters;
+    int32 RebuiltClusters = 0;
+    Guid outputModelAssetId = Guid::Empty;
+    Guid outputRawDataAssetId = Guid::Empty;
+    Guid outputCollisionDataAssetId = Guid::Empty;
+
+    ~BuildData()
+    {
+        Brushes.ClearDelete();
+        Meshes.ClearDelete();
+        PrevClusters.ClearDelete();
+        Clusters.ClearDelete();
+    }
+};
+
 void CSGBuilderImpl::onSceneUnloading(Scene* scene, const Guid& sceneId)
 {
     // Ensure to remove scene (prevent crashes)
     ScenesToRebuild.Remove(scene);
+    if (Building && Building->Scene == scene)
+    {
+        waitForBuild();
+        Delete(Building);
+        Building = nullptr;
+    }
+    Array<ClusterCache*>* cache = Caches.TryGet(scene);
+    if (cache)
+    {
+        cache->ClearDelete();
+        Caches.Remove(scene);
+    }
 }
 
 bool CSGBuilderService::Init()
@@ -74,8 +245,12 @@ bool CSGBuilderService::Init()
 
 void CSGBuilderService::Update()
 {
-    // Check if build is pending
-    if (ScenesToRebuild.HasItems() && Engine::IsReady())
+    // Apply the finished build results
+    if (Building && Platform::AtomicRead(&BuildDone))
+        endBuild();
+
+    // Check if build is pending (one scene at once)
+    if (ScenesToRebuild.HasItems() && Engine::IsReady() && !Building)
     {
         auto now = DateTime::NowUTC();
 
@@ -86,15 +261,29 @@ void CSGBuilderService::Update()
             {
                 scene->CSGData.BuildTime.Ticks = 0;
                 ScenesToRebuild.RemoveAt(i--);
-                build(scene);
+                startBuild(scene);
+                break;
             }
         }
     }
 }
 
+void CSGBuilderService::Dispose()
+{
+    if (Building)
+    {
+        waitForBuild();
+        Delete(Building);
+        Building = nullptr;
+    }
+    for (auto& e : Caches)
+        e.Value.ClearDelete();
+    Caches.Clear();
+}
+
 bool Builder::IsActive()
 {
-    return ScenesToRebuild.HasItems();
+    return ScenesToRebuild.HasItems() || Building;
 }
 
 void Builder::Build(Scene* scene, float timeoutMs)
@@ -118,53 +307,24 @@ void Builder::Build(Scene* scene, float timeoutMs)
 
 namespace CSG
 {
-    typedef Dictionary<Actor*, Mesh*> MeshesLookup;
-
-    bool walkTree(Actor* actor, MeshesArray& meshes, MeshesLookup& cache)
-    {
-        // Check if actor is a brush
-        auto brush = dynamic_cast<Brush*>(actor);
-        if (brush)
-        {
-            // Check if can build it
-            if (brush->CanUseCSG())
-            {
-                // Skip subtract/common meshes from the beginning (they have no effect)
-                if (meshes.Count() > 0 || brush->GetBrushMode() == Mode::Additive)
-                {
-                    // Create new mesh and build for given brush
-                    auto mesh = New<CSG::Mesh>();
-                    mesh->Build(brush);
-
-                    // Save results
-                    meshes.Add(mesh);
-                    cache.Add(actor, mesh);
-                }
-                else
-                {
-                    // Info
-                    LOG(Info, "Skipping CSG brush '{0}'", actor->ToString());
-                }
-            }
-        }
-
-        return true;
-    }
+    typedef Dictionary<int32, Mesh*> MeshesLookup;
 
-    Mesh* Combine(Actor* actor, MeshesLookup& cache, Mesh* combineParent)
+    Mesh* Combine(const BuildData& data, const Array<bool>& contains, MeshesLookup& cache, int32 nodeIndex, Mesh* combineParent)
     {
-        ASSERT(actor);
+        const BrushNode& node = data.Nodes[nodeIndex];
         Mesh* result = nullptr;
         Mesh* myBrush = nullptr;
-        cache.TryGet(actor, myBrush);
+        cache.TryGet(nodeIndex, myBrush);
 
         // Get first child mesh with valid data (has additive brush)
-        int32 childIndex = 0;
-        while (childIndex < actor->Children.Count())
+        int32 childIndex = nodeIndex + 1;
+        while (childIndex < node.End)
         {
-            auto child = Combine(actor->Children[childIndex], cache, combineParent);
-
-            childIndex++;
+            const int32 index = childIndex;
+            childIndex = data.Nodes[index].End;
+            if (!contains[index])
+                continue;
+            auto child = Combine(data, contains, cache, index, combineParent);
             if (child)
             {
                 // If brush was based on additive brush or current actor is a brush we can stop searching
@@ -197,16 +357,18 @@ namespace CSG
             }
 
             // Merge with the other children
-            while (childIndex < actor->Children.Count())
+            while (childIndex < node.End)
             {
-                auto child = Combine(actor->Children[childIndex], cache, result);
+                const int32 index = childIndex;
+                childIndex = data.Nodes[index].End;
+                if (!contains[index])
+                    continue;
+                auto child = Combine(data, contains, cache, index, result);
                 if (child)
                 {
                     // Combine
                     result->PerformOperation(child);
                 }
-
-                childIndex++;
             }
         }
         else
@@ -217,163 +379,358 @@ namespace CSG
 
         return result;
     }
+}
 
-    Mesh* Combine(Scene* scene, MeshesLookup& cache)
+void CSGBuilderImpl::snapshotTree(Actor* actor, BuildData& data, int32 parent, int32 depth)
+{
+    const int32 nodeIndex = data.Nodes.Count();
     {
-#if CSG_USE_SCENE_LOCKS
-		auto Level = Level::Instance();
-		Level->Lock();
-#endif
+        auto& node = data.Nodes.AddOne();
+        node.Brush = -1;
+        node.Parent = parent;
+        node.Depth = depth;
+    }
 
-        Mesh* result = Combine(scene, cache, nullptr);
+    // Check if actor is a brush
+    auto brush = dynamic_cast<Brush*>(actor);
+    if (brush && brush->CanUseCSG())
+    {
+        // Skip subtract/common meshes from the beginning (they have no effect)
+        if (data.Brushes.HasItems() || brush->GetBrushMode() == Mode::Additive)
+        {
+            auto snapshot = New<BrushSnapshot>();
+            snapshot->ID = brush->GetBrushID();
+            snapshot->BrushMode = brush->GetBrushMode();
+            brush->GetSurfaces(snapshot->Surfaces);
+            data.Nodes[nodeIndex].Brush = data.Brushes.Count();
+            data.Brushes.Add(snapshot);
+        }
+        else
+        {
+            // Info
+            LOG(Info, "Skipping CSG brush '{0}'", actor->ToString());
+        }
+    }
 
-#if CSG_USE_SCENE_LOCKS
-		Level->Unlock();
-#endif
+    for (int32 i = 0; i < actor->Children.Count(); i++)
+        snapshotTree(actor->Children.Get()[i], data, nodeIndex, depth + 1);
 
-        return result;
-    }
+    // Skip actors without brushes
+    if (data.Nodes[nodeIndex].Brush == -1 && data.Nodes.Count() == nodeIndex + 1)
+        data.Nodes.RemoveLast();
+    else
+        data.Nodes[nodeIndex].End = data.Nodes.Count();
 }
 
-struct BuildData
+void CSGBuilderImpl::startBuild(Scene* scene)
 {
-    MeshesArray meshes;
-    MeshesLookup cache;
-    Guid outputModelAssetId = Guid::Empty;
-    Guid outputRawDataAssetId = Guid::Empty;
-    Guid outputCollisionDataAssetId = Guid::Empty;
+    LOG(Info, "Start building CSG...");
 
-    BuildData(int32 meshesCapacity = 32)
-        : meshes(meshesCapacity * 32)
-        , cache(meshesCapacity * 4)
+    // Capture scene state on a main thread
+    Building = New<BuildData>();
+    BuildData& data = *Building;
+    data.Scene = scene;
+    data.StartTime = DateTime::Now();
+    data.DataFolderPath = scene->GetDataFolderPath();
+    data.SceneTransform = scene->GetTransform();
+    scene->GetWorldToLocalMatrix(data.WorldToLocal);
+    data.outputModelAssetId = scene->CSGData.Model.GetID();
+    data.outputRawDataAssetId = scene->CSGData.Data.GetID();
+    data.outputCollisionDataAssetId = scene->CSGData.CollisionData.GetID();
+    snapshotTree(scene, data, -1, 0);
+    Array<ClusterCache*>* cache = Caches.TryGet(scene);
+    if (cache)
     {
+        data.PrevClusters = MoveTemp(*cache);
+        cache->Clear();
     }
-};
 
-bool CSGBuilderImpl::buildInner(Scene* scene, BuildData& data)
+    // Build on a job thread
+    Platform::AtomicStore(&BuildDone, 0);
+    BuildTask = Task::StartNew(buildJob);
+}
+
+void CSGBuilderImpl::buildJob()
 {
-    // Setup CSG meshes list and build them
-    {
-        Function<bool(Actor*, MeshesArray&, MeshesLookup&)> treeWalkFunction(walkTree);
-        SceneQuery::TreeExecute<Array<CSG::Mesh*>&, MeshesLookup&>(treeWalkFunction, data.meshes, data.cache);
-    }
-    if (data.meshes.IsEmpty())
-        return false;
+    buildInner(*Building);
+    Platform::AtomicStore(&BuildDone, 1);
+}
 
-    // Process all meshes (performs actual CSG opterations on geometry in tree structure)
-    CSG::Mesh* combinedMesh = Combine(scene, data.cache);
-    if (combinedMesh == nullptr)
+bool CSGBuilderImpl::buildInner(BuildData& data)
+{
+    // Build CSG meshes for all brushes
+    const int32 brushesCount = data.Brushes.Count();
+    data.Meshes.Resize(brushesCount);
+    JobSystem::Execute([&data](int32 i)
+    {
+        auto mesh = New<CSG::Mesh>();
+        mesh->Build(data.Brushes[i]);
+        data.Meshes[i] = mesh;
+    }, brushesCount);
+    if (data.Meshes.IsEmpty())
+    {
+        data.outputModelAssetId = data.outputRawDataAssetId = data.outputCollisionDataAssetId = Guid::Empty;
         return false;
+    }
 
-    // TODO: split too big meshes (too many verts, to far parts, etc.)
+    // Group brushes into spatial clusters (brushes that don't overlap don't affect each other so each cluster can be built separately)
+    Array<int32> brushCluster;
+    brushCluster.Resize(brushesCount);
+    for (int32 i = 0; i < brushesCount; i++)
+        brushCluster[i] = i;
+    auto findRoot = [&brushCluster](int32 i)
+    {
+        while (brushCluster[i] != i)
+            i = brushCluster[i] = brushCluster[brushCluster[i]];
+        return i;
+    };
+    bool hasCommon = false;
+    for (const BrushSnapshot* brush : data.Brushes)
+        hasCommon |= brush->BrushMode == Mode::Common;
+    if (hasCommon)
+    {
+        // Intersection brushes affect the whole geometry so use a single cluster
+        for (int32 i = 0; i < brushesCount; i++)
+            brushCluster[i] = 0;
+    }
+    else
+    {
+        // Sweep and prune over the bounds sorted along X axis
+        Array<SortedBrush> sorted;
+        sorted.Resize(brushesCount);
+        for (int32 i = 0; i < brushesCount; i++)
+        {
+            sorted[i].Index = i;
+            sorted[i].Bounds = data.Meshes[i]->GetBounds();
+        }
+        Sorting::QuickSort(sorted);
+        for (int32 i = 0; i < brushesCount; i++)
+        {
+            const AABB& a = sorted[i].Bounds;
+            for (int32 j = i + 1; j < brushesCount; j++)
+            {
+                const AABB& b = sorted[j].Bounds;
+                if (b.MinX > a.MaxX)
+                    break;
+                if (a.MinY <= b.MaxY && b.MinY <= a.MaxY && a.MinZ <= b.MaxZ && b.MinZ <= a.MaxZ)
+                {
+                    const int32 rootA = findRoot(sorted[i].Index);
+                    const int32 rootB = findRoot(sorted[j].Index);
+                    if (rootA != rootB)
+                        brushCluster[Math::Max(rootA, rootB)] = Math::Min(rootA, rootB);
+                }
+            }
+        }
+    }
+    Dictionary<int32, int32> clusterIndices;
+    for (int32 i = 0; i < brushesCount; i++)
+    {
+        const int32 root = findRoot(i);
+        int32 clusterIndex;
+        if (!clusterIndices.TryGet(root, clusterIndex))
+        {
+            clusterIndex = clusterIndices.Count();
+            clusterIndices.Add(root, clusterIndex);
+        }
+        brushCluster[i] = clusterIndex;
+    }
 
-    // Triangulate meshes
+    // Build clusters (reuse geometry from the previous build for clusters that didn't change)
+    const int32 nodesCount = data.Nodes.Count();
+    Array<bool> contains;
+    Array<int32> localBrushIndex;
+    localBrushIndex.Resize(brushesCount);
+    Array<RawModelVertex> vertexBuffer;
+    MeshesLookup cache;
+    for (int32 clusterIndex = 0; clusterIndex < clusterIndices.Count(); clusterIndex++)
     {
-        // TODO: setup valid loop for splited meshes
-
-        // Convert CSG meshes into raw triangles data
-        RawData meshData;
-        Array<RawModelVertex> vertexBuffer;
-        combinedMesh->Triangulate(meshData, vertexBuffer);
-        meshData.RemoveEmptySlots();
-        if (meshData.Slots.HasItems())
+        // Find the hierarchy nodes that contain brushes from this cluster
+        contains.Clear();
+        contains.Resize(nodesCount);
+        for (int32 i = nodesCount - 1; i >= 0; i--)
         {
-            const auto sceneDataFolderPath = scene->GetDataFolderPath();
+            const BrushNode& node = data.Nodes[i];
+            if (node.Brush != -1 && brushCluster[node.Brush] == clusterIndex)
+                contains[i] = true;
+            else if (!contains[i])
+                continue;
+            if (node.Parent != -1)
+                contains[node.Parent] = true;
+        }
 
-            // Convert CSG mesh data to common storage type
-            ModelData modelData;
-            meshData.ToModelData(modelData);
+        // Setup cluster description
+        auto cluster = New<ClusterCache>();
+        cluster->Hash = 0;
+        for (int32 i = 0; i < nodesCount; i++)
+        {
+            if (!contains[i])
+                continue;
+            const BrushNode& node = data.Nodes[i];
+            int32 brushIndex = -1;
+            if (node.Brush != -1 && brushCluster[node.Brush] == clusterIndex)
+            {
+                brushIndex = cluster->Brushes.Count();
+                localBrushIndex[node.Brush] = brushIndex;
+                cluster->Brushes.Add(data.Brushes[node.Brush]);
+                CombineHash(cluster->Hash, data.Brushes[node.Brush]->GetDataHash());
+            }
+            cluster->Layout.Add(Int2(node.Depth, brushIndex));
+            CombineHash(cluster->Hash, node.Depth);
+        }
 
-            // Convert CSG mesh to the local transformation of the scene
-            if (!scene->GetTransform().IsIdentity())
+        // Reuse cached geometry
+        ClusterCache* prevCluster = nullptr;
+        for (int32 i = 0; i < data.PrevClusters.Count(); i++)
+        {
+            if (data.PrevClusters[i]->Equals(*cluster))
             {
-                Matrix t;
-                scene->GetWorldToLocalMatrix(t);
-                modelData.TransformBuffer(t);
+                prevCluster = data.PrevClusters[i];
+                data.PrevClusters.RemoveAt(i);
+                break;
             }
+        }
+        if (prevCluster)
+        {
+            cluster->Brushes.Clear();
+            Delete(cluster);
+            data.Clusters.Add(prevCluster);
+            continue;
+        }
+        data.Clusters.Add(cluster);
+        data.RebuiltClusters++;
+
+        // Process all meshes (performs actual CSG opterations on geometry in tree structure)
+        cache.Clear();
+        for (int32 i = 0; i < nodesCount; i++)
+        {
+            const BrushNode& node = data.Nodes[i];
+            if (node.Brush != -1 && brushCluster[node.Brush] == clusterIndex)
+                cache.Add(i, data.Meshes[node.Brush]);
+        }
+        cluster->Data = New<RawData>();
+        CSG::Mesh* combinedMesh = contains[0] ? Combine(data, contains, cache, 0, nullptr) : nullptr;
+        if (combinedMesh)
+        {
+            // Convert CSG meshes into raw triangles data
+            vertexBuffer.Clear();
+            combinedMesh->Triangulate(*cluster->Data, vertexBuffer);
+            cluster->Data->RemoveEmptySlots();
+        }
+    }
+
+    // Take ownership of the brushes used by the rebuilt clusters (the others are no longer used)
+    for (int32 i = 0; i < brushesCount; i++)
+    {
+        const BrushSnapshot* brush = data.Brushes[i];
+        const ClusterCache* cluster = data.Clusters[brushCluster[i]];
+        if (cluster->Brushes[localBrushIndex[i]] != brush)
+            Delete(data.Brushes[i]);
+        data.Brushes[i] = nullptr;
+    }
+    data.Brushes.Clear();
 
-            // Import model data to the asset
+    // Merge clusters geometry
+    RawData meshData;
+    for (const ClusterCache* cluster : data.Clusters)
+        meshData.Append(*cluster->Data);
+    meshData.RemoveEmptySlots();
+
+    // TODO: split too big meshes (too many verts, to far parts, etc.)
+
+    if (meshData.Slots.HasItems())
+    {
+        const auto& sceneDataFolderPath = data.DataFolderPath;
+
+        // Convert CSG mesh data to common storage type
+        ModelData modelData;
+        meshData.ToModelData(modelData);
+
+        // Convert CSG mesh to the local transformation of the scene
+        if (!data.SceneTransform.IsIdentity())
+        {
+            modelData.TransformBuffer(data.WorldToLocal);
+        }
+
+        // Import model data to the asset
+        {
+            Guid modelDataAssetId = data.outputModelAssetId;
+            if (!modelDataAssetId.IsValid())
+                modelDataAssetId = Guid::New();
+            const String modelDataAssetPath = sceneDataFolderPath / TEXT("CSG_Mesh") + ASSET_FILES_EXTENSION_WITH_DOT;
+            if (AssetsImportingManager::Create(AssetsImportingManager::CreateModelTag, modelDataAssetPath, modelDataAssetId, &modelData))
             {
-                Guid modelDataAssetId = scene->CSGData.Model.GetID();
-                if (!modelDataAssetId.IsValid())
-                    modelDataAssetId = Guid::New();
-                const String modelDataAssetPath = sceneDataFolderPath / TEXT("CSG_Mesh") + ASSET_FILES_EXTENSION_WITH_DOT;
-                if (AssetsImportingManager::Create(AssetsImportingManager::CreateModelTag, modelDataAssetPath, modelDataAssetId, &modelData))
-                {
-                    LOG(Warning, "Failed to import CSG mesh data");
-                    return true;
-                }
-                data.outputModelAssetId = modelDataAssetId;
+                LOG(Warning, "Failed to import CSG mesh data");
+                return true;
             }
+            data.outputModelAssetId = modelDataAssetId;
+        }
 
-            // Generate asset with CSG mesh metadata (for collisions and brush queries)
+        // Generate asset with CSG mesh metadata (for collisions and brush queries)
+        {
+            Guid rawDataAssetId = data.outputRawDataAssetId;
+            if (!rawDataAssetId.IsValid())
+                rawDataAssetId = Guid::New();
+            const String rawDataAssetPath = sceneDataFolderPath / TEXT("CSG_Data") + ASSET_FILES_EXTENSION_WITH_DOT;
+            if (generateRawDataAsset(meshData, rawDataAssetId, rawDataAssetPath))
             {
-                Guid rawDataAssetId = scene->CSGData.Data.GetID();
-                if (!rawDataAssetId.IsValid())
-                    rawDataAssetId = Guid::New();
-                const String rawDataAssetPath = sceneDataFolderPath / TEXT("CSG_Data") + ASSET_FILES_EXTENSION_WITH_DOT;
-                if (generateRawDataAsset(scene, meshData, rawDataAssetId, rawDataAssetPath))
-                {
-                    LOG(Warning, "Failed to create raw CSG data");
-                    return true;
-                }
-                data.outputRawDataAssetId = rawDataAssetId;
+                LOG(Warning, "Failed to create raw CSG data");
+                return true;
             }
+            data.outputRawDataAssetId = rawDataAssetId;
+        }
 
-            // Generate CSG mesh collision asset
+        // Generate CSG mesh collision asset
+        {
+            // Convert CSG mesh to scene local space (fix issues when scene has transformation applied)
+            if (!data.SceneTransform.IsIdentity())
             {
-                // Convert CSG mesh to scene local space (fix issues when scene has transformation applied)
-                if (!scene->GetTransform().IsIdentity())
-                {
-                    Matrix m1, m2;
-                    scene->GetTransform().GetWorld(m1);
-                    Matrix::Invert(m1, m2);
+                Matrix m1, m2;
+                data.SceneTransform.GetWorld(m1);
+                Matrix::Invert(m1, m2);
 
-                    for (int32 lodIndex = 0; lodIndex < modelData.LODs.Count(); lodIndex++)
+                for (int32 lodIndex = 0; lodIndex < modelData.LODs.Count(); lodIndex++)
+                {
+                    auto lod = &modelData.LODs[lodIndex];
+                    for (int32 meshIndex = 0; meshIndex < lod->Meshes.Count(); meshIndex++)
                     {
-                        auto lod = &modelData.LODs[lodIndex];
-                        for (int32 meshIndex = 0; meshIndex < lod->Meshes.Count(); meshIndex++)
-                        {
-                            Array<Float3>& v = lod->Meshes[meshIndex]->Positions;
-                            for (int32 i = 0; i < v.Count(); i++)
-                                Float3::Transform(v[i], m2, v[i]);
-                        }
+                        Array<Float3>& v = lod->Meshes[meshIndex]->Positions;
+                        for (int32 i = 0; i < v.Count(); i++)
+                            Float3::Transform(v[i], m2, v[i]);
                     }
                 }
+            }
 
 #if COMPILE_WITH_PHYSICS_COOKING
-                CollisionCooking::Argument arg;
-                arg.Type = CollisionDataType::TriangleMesh;
-                arg.OverrideModelData = &modelData;
-                Guid collisionDataAssetId = scene->CSGData.CollisionData.GetID();
-                if (!collisionDataAssetId.IsValid())
-                    collisionDataAssetId = Guid::New();
-                const String collisionDataAssetPath = sceneDataFolderPath / TEXT("CSG_Collision") + ASSET_FILES_EXTENSION_WITH_DOT;
-                if (AssetsImportingManager::Create(AssetsImportingManager::CreateCollisionDataTag, collisionDataAssetPath, collisionDataAssetId, &arg))
-                {
-                    LOG(Warning, "Failed to cook CSG mesh collision data");
-                    return true;
-                }
-                data.outputCollisionDataAssetId = collisionDataAssetId;
+            CollisionCooking::Argument arg;
+            arg.Type = CollisionDataType::TriangleMesh;
+            arg.OverrideModelData = &modelData;
+            Guid collisionDataAssetId = data.outputCollisionDataAssetId;
+            if (!collisionDataAssetId.IsValid())
+                collisionDataAssetId = Guid::New();
+            const String collisionDataAssetPath = sceneDataFolderPath / TEXT("CSG_Collision") + ASSET_FILES_EXTENSION_WITH_DOT;
+            if (AssetsImportingManager::Create(AssetsImportingManager::CreateCollisionDataTag, collisionDataAssetPath, collisionDataAssetId, &arg))
+            {
+                LOG(Warning, "Failed to cook CSG mesh collision data");
+                return true;
+            }
+            data.outputCollisionDataAssetId = collisionDataAssetId;
 #else
-                data.outputCollisionDataAssetId = Guid::Empty;
+            data.outputCollisionDataAssetId = Guid::Empty;
 #endif
-            }
         }
     }
+    else
+    {
+        data.outputModelAssetId = data.outputRawDataAssetId = data.outputCollisionDataAssetId = Guid::Empty;
+    }
 
     return false;
 }
 
-void CSGBuilderImpl::build(Scene* scene)
+void CSGBuilderImpl::endBuild()
 {
-    // Start
-    auto startTime = DateTime::Now();
-    LOG(Info, "Start building CSG...");
-
-    // Build
-    BuildData data;
-    bool failed = buildInner(scene, data);
+    BuildData& data = *Building;
+    Scene* scene = data.Scene;
 
     // Link new (or empty) CSG mesh
     scene->CSGData.Data = Content::LoadAsync<RawDataAsset>(data.outputRawDataAssetId);
@@ -382,13 +739,26 @@ void CSGBuilderImpl::build(Scene* scene)
     // TODO: also set CSGData.InstanceBuffer - lightmap scales for the entries so csg mesh gets better quality in lightmaps
     scene->CSGData.PostCSGBuild();
 
+    // Cache clusters for the next build
+    Caches[scene] = MoveTemp(data.Clusters);
+    data.Clusters.Clear();
+
     // End
-    data.meshes.ClearDelete();
     auto endTime = DateTime::Now();
-    LOG(Info, "CSG build in {0} ms! {1} brush(es)", (endTime - startTime).GetTotalMilliseconds(), data.meshes.Count());
+    LOG(Info, "CSG build in {0} ms! {1} brush(es), {2}/{3} cluster(s) rebuilt", (endTime - data.StartTime).GetTotalMilliseconds(), data.Meshes.Count(), data.RebuiltClusters, Caches[scene].Count());
+    Delete(Building);
+    Building = nullptr;
+    BuildTask = nullptr;
+}
+
+void CSGBuilderImpl::waitForBuild()
+{
+    if (BuildTask && !Platform::AtomicRead(&BuildDone))
+        BuildTask->Wait();
+    BuildTask = nullptr;
 }
 
-bool CSGBuilderImpl::generateRawDataAsset(Scene* scene, RawData& meshData, Guid& assetId, const String& assetPath)
+bool CSGBuilderImpl::generateRawDataAsset(RawData& meshData, Guid& assetId, const String& assetPath)
 {
     // Prepare data
     MemoryWriteStream stream(4096);
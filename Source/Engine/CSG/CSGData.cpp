@@ -94,6 +94,17 @@ void RawData::AddSurface(Brush* brush, int32 brushSurfaceIndex, const Guid& surf
     }
 }
 
+void RawData::Append(const RawData& other)
+{
+    for (const Slot* otherSlot : other.Slots)
+    {
+        auto slot = GetOrAddSlot(otherSlot->Material);
+        slot->Surfaces.Add(otherSlot->Surfaces);
+    }
+    for (const auto& e : other.Brushes)
+        Brushes[e.Key] = e.Value;
+}
+
 void RawData::ToModelData(ModelData& modelData) const
 {
     // Generate lightmap UVs (single chart for the whole mesh)
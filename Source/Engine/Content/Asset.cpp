@@ -5,13 +5,14 @@
 #include "SoftAssetReference.h"
 #include "Cache/AssetsCache.h"
 #include "Loading/ContentLoadingManager.h"
+#include "Loading/ContentLoadingTrace.h"
 #include "Loading/Tasks/LoadAssetTask.h"
 #include "Engine/Core/Log.h"
 #include "Engine/Engine/Engine.h"
 #include "Engine/Threading/Threading.h"
 #include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Profiler/ProfilerHitchDetector.h"
 #include "Engine/Threading/MainThreadTask.h"
-#include "Engine/Threading/ConcurrentTaskQueue.h"
 #include "Engine/Scripting/ManagedCLR/MCore.h"
 
 AssetReferenceBase::~AssetReferenceBase()
@@ -378,7 +379,7 @@ void Asset::Reload()
 
 namespace ContentLoadingManagerImpl
 {
-    extern ConcurrentTaskQueue<ContentLoadTask> Tasks;
+    extern bool RemoveTask(ContentLoadTask* task);
 };
 
 bool Asset::WaitForLoaded(double timeoutInMilliseconds) const
@@ -428,6 +429,10 @@ bool Asset::WaitForLoaded(double timeoutInMilliseconds) const
     }
 
     PROFILE_CPU();
+#if COMPILE_WITH_PROFILER
+    if (IsInMainThread() && ProfilerHitchDetector::GetEnabled())
+        ProfilerHitchDetector::ReportHitch(String::Format(TEXT("Asset load on main thread: {0}"), ToString()));
+#endif
 
     // Check if call is made from the Loading Thread and task has not been taken yet
     auto thread = ContentLoadingManager::GetCurrentLoadThread();
@@ -439,45 +444,14 @@ bool Asset::WaitForLoaded(double timeoutInMilliseconds) const
         const double timeoutInSeconds = timeoutInMilliseconds * 0.001;
         const double startTime = Platform::GetTimeSeconds();
         Task* task = loadingTask;
-        Array<ContentLoadTask*, InlinedAllocation<64>> localQueue;
 #define CHECK_CONDITIONS() (!Engine::ShouldExit() && (timeoutInSeconds <= 0.0 || Platform::GetTimeSeconds() - startTime < timeoutInSeconds))
         do
         {
-            // Try to execute content tasks
-            while (task->IsQueued() && CHECK_CONDITIONS())
-            {
-                // Dequeue task from the loading queue
-                ContentLoadTask* tmp;
-                if (ContentLoadingManagerImpl::Tasks.try_dequeue(tmp))
-                {
-                    if (tmp == task)
-                    {
-                        if (localQueue.Count() != 0)
-                        {
-                            // Put back queued tasks
-                            ContentLoadingManagerImpl::Tasks.enqueue_bulk(localQueue.Get(), localQueue.Count());
-                            localQueue.Clear();
-                        }
-
-                        thread->Run(tmp);
-                    }
-                    else
-                    {
-                        localQueue.Add(tmp);
-                    }
-                }
-                else
-                {
-                    // No task in queue but it's queued so other thread could have stolen it into own local queue
-                    break;
-                }
-            }
-            if (localQueue.Count() != 0)
-            {
-                // Put back queued tasks
-                ContentLoadingManagerImpl::Tasks.enqueue_bulk(localQueue.Get(), localQueue.Count());
-                localQueue.Clear();
-            }
+            // Take the task from the loading queue and execute it on this thread (if other thread hasn't taken it yet)
+            if (task->IsQueued() && ContentLoadingManagerImpl::RemoveTask((ContentLoadTask*)task))
+                thread->Run((ContentLoadTask*)task);
+            else if (!task->IsEnded())
+                Platform::Sleep(0);
 
             // Check if task is done
             if (task->IsEnded())
@@ -500,7 +474,8 @@ bool Asset::WaitForLoaded(double timeoutInMilliseconds) const
     }
     else
     {
-        // Wait for task end
+        // Move the task to the front of the loading queue and wait for it to end
+        loadingTask->Promote(ContentLoadPriority::High);
         loadingTask->Wait(timeoutInMilliseconds);
     }
 
@@ -573,6 +548,7 @@ void Asset::startLoading()
     auto loadingTask = createLoadingTask();
     ASSERT(loadingTask != nullptr);
     Platform::AtomicStore(&_loadingTask, (intptr)loadingTask);
+    ContentLoadingTrace::OnQueued(this);
     loadingTask->Start();
 }
 
@@ -54,6 +54,7 @@ Animation::InfoData Animation::GetInfo() const
             info.MemoryUsage += e.Rotation.GetKeyframes().Capacity() * sizeof(LinearCurveKeyframe<Quaternion>);
             info.MemoryUsage += e.Scale.GetKeyframes().Capacity() * sizeof(LinearCurveKeyframe<Float3>);
         }
+        info.MemoryUsage += Data.Compressed.GetMemoryUsage();
     }
     else
     {
@@ -389,6 +390,7 @@ bool Animation::SaveTimeline(BytesContainer& data)
     {
         LOG(Warning, "Invalid animation timeline data length.");
     }
+    Data.BuildCompressed();
 
     return Save();
 }
@@ -413,11 +415,13 @@ bool Animation::Save(const StringView& path)
         MemoryWriteStream stream(4096);
 
         // Info
-        stream.WriteInt32(103);
+        stream.WriteInt32(104);
         stream.WriteDouble(Data.Duration);
         stream.WriteDouble(Data.FramesPerSecond);
         stream.WriteByte((byte)Data.RootMotionFlags);
         stream.WriteString(Data.RootNodeName, 13);
+        stream.WriteByte(Data.Compress ? 1 : 0);
+        stream.WriteFloat(Data.CompressionTolerance);
 
         // Animation channels
         stream.WriteInt32(Data.Channels.Count());
@@ -511,7 +515,7 @@ void Animation::OnScriptingDispose()
         {
             if (k.Value.Instance)
             {
-                Delete(k.Value.Instance);
+                ScriptingObjectsPool::Delete(k.Value.Instance);
                 k.Value.Instance = nullptr;
             }
         }
@@ -532,6 +536,19 @@ Asset::LoadResult Animation::load()
     int32 headerVersion = *(int32*)stream.GetPositionHandle();
     switch (headerVersion)
     {
+    case 104:
+    {
+        stream.ReadInt32(&headerVersion);
+        stream.ReadDouble(&Data.Duration);
+        stream.ReadDouble(&Data.FramesPerSecond);
+        stream.ReadByte((byte*)&Data.RootMotionFlags);
+        stream.ReadString(&Data.RootNodeName, 13);
+        byte compressionFlags;
+        stream.ReadByte(&compressionFlags);
+        Data.Compress = compressionFlags & 1;
+        stream.ReadFloat(&Data.CompressionTolerance);
+        break;
+    }
     case 103:
         stream.ReadInt32(&headerVersion);
         stream.ReadDouble(&Data.Duration);
@@ -578,6 +595,7 @@ Asset::LoadResult Animation::load()
             return LoadResult::Failed;
         }
     }
+    Data.BuildCompressed();
 
     // Animation events
     if (headerVersion >= 101)
@@ -665,7 +683,7 @@ void Animation::unload(bool isReloading)
         for (const auto& k : e.Second.GetKeyframes())
         {
             if (k.Value.Instance)
-                Delete(k.Value.Instance);
+                ScriptingObjectsPool::Delete(k.Value.Instance);
         }
     }
     Events.Clear();
@@ -20,7 +20,10 @@ Asset::LoadResult AnimationGraphFunction::load()
     const auto surfaceChunk = GetChunk(0);
     if (!surfaceChunk || !surfaceChunk->IsLoaded())
         return LoadResult::MissingDataChunk;
-    GraphData.Swap(surfaceChunk->Data);
+    if (surfaceChunk->Data.IsAllocated())
+        GraphData.Swap(surfaceChunk->Data);
+    else
+        GraphData.Copy(surfaceChunk->Data); // Chunk data can reference the memory-mapped package file
 
     // Load graph
     MemoryReadStream stream(GraphData.Get(), GraphData.Length());
@@ -24,6 +24,10 @@ API_CLASS(Abstract, NoSpawn) class FLAXENGINE_API MaterialBase : public BinaryAs
     /// </summary>
     Action ParamsChanged;
 
+    // The maximum screen size (in pixels) of the objects drawn with this material during the last frame and the index of that frame. Used by the textures streaming feedback (see Streaming::ReportMaterialScreenSize).
+    float StreamingScreenSize = 0.0f;
+    volatile int64 StreamingFrame = -1;
+
     /// <summary>
     /// Returns true if material is an material instance.
     /// </summary>
@@ -5,21 +5,25 @@
 #include "Engine/Engine/Engine.h"
 #include "Engine/Serialization/MemoryReadStream.h"
 #include "Engine/Content/WeakAssetReference.h"
+#include "Engine/Content/Assets/MaterialBase.h"
 #include "Engine/Content/Upgraders/ModelAssetUpgrader.h"
 #include "Engine/Content/Factories/BinaryAssetFactory.h"
 #include "Engine/Debug/DebugDraw.h"
 #include "Engine/Graphics/RenderTools.h"
 #include "Engine/Graphics/RenderTask.h"
 #include "Engine/Graphics/Models/ModelInstanceEntry.h"
+#include "Engine/Streaming/Streaming.h"
 #include "Engine/Streaming/StreamingGroup.h"
 #include "Engine/Debug/Exceptions/ArgumentOutOfRangeException.h"
 #include "Engine/Graphics/GPUDevice.h"
+#include "Engine/Graphics/GPUBuffer.h"
 #include "Engine/Graphics/Async/GPUTask.h"
 #include "Engine/Graphics/Async/Tasks/GPUUploadTextureMipTask.h"
 #include "Engine/Graphics/Textures/GPUTexture.h"
 #include "Engine/Graphics/Textures/TextureData.h"
 #include "Engine/Profiler/ProfilerCPU.h"
 #include "Engine/Renderer/DrawCall.h"
+#include "Engine/Renderer/RenderList.h"
 #include "Engine/Threading/Threading.h"
 #include "Engine/Tools/ModelTool/ModelTool.h"
 #include "Engine/Tools/ModelTool/MeshAccelerationStructure.h"
@@ -156,7 +160,7 @@ Model::Model(const SpawnParams& params, const AssetInfo* info)
 {
     if (EnableModelSDF == 0 && GPUDevice::Instance)
     {
-        const bool enable = GPUDevice::Instance->GetFeatureLevel() >= FeatureLevel::SM5;
+        const bool enable = GPUDevice::Instance->GetFeatureLevel() >= FeatureLevel::SM5 && Streaming::IsEnabled();
         EnableModelSDF = enable ? 1 : 2;
     }
 }
@@ -310,7 +314,123 @@ void Model::Draw(const RenderContext& renderContext, const Mesh::DrawInfo& info)
 
 void Model::Draw(const RenderContextBatch& renderContextBatch, const Mesh::DrawInfo& info)
 {
-    ModelDraw(this, renderContextBatch.GetMainContext(), renderContextBatch, info);
+    const RenderContext& mainRenderContext = renderContextBatch.GetMainContext();
+    const int32 contextsCount = renderContextBatch.Contexts.Count();
+    if (contextsCount > 1 && info.ForcedLOD == -1 && !info.ContextsMask && CanBeRendered())
+    {
+        const int32 lodIndex = RenderTools::ComputeModelLOD(this, info.Bounds.Center, (float)info.Bounds.Radius, mainRenderContext);
+        if (lodIndex != -1)
+        {
+            // Select LOD for each shadow projection (lights can use own shadows LOD bias, far shadow LODs can use proxy mesh)
+            const int32 proxyLOD = MODEL_MAX_LODS;
+            const ShadowsCastingMode proxyMode = ShadowProxy.VertexBuffer ? GetShadowProxyMode(info) : ShadowsCastingMode::None;
+            const int32 mainLOD = ClampLODIndex(lodIndex + info.LODBias + mainRenderContext.View.ModelLODBias);
+            Array<int32, InlinedAllocation<64>> contextsLOD;
+            contextsLOD.Resize(contextsCount);
+            contextsLOD[0] = mainLOD;
+            bool anyOtherLOD = false;
+            for (int32 i = 1; i < contextsCount; i++)
+            {
+                int32 contextLOD = lodIndex + info.LODBias + renderContextBatch.Contexts.Get()[i].View.ModelLODBias;
+                if (proxyMode != ShadowsCastingMode::None && contextLOD >= ShadowProxy.MinLOD)
+                    contextLOD = proxyLOD;
+                else
+                    contextLOD = ClampLODIndex(contextLOD);
+                contextsLOD[i] = contextLOD;
+                anyOtherLOD |= contextLOD != mainLOD;
+            }
+            if (anyOtherLOD)
+            {
+                Array<bool, InlinedAllocation<64>> contextsMask;
+                contextsMask.Resize(contextsCount);
+                Mesh::DrawInfo maskedInfo = info;
+                maskedInfo.ContextsMask = contextsMask.Get();
+
+                // Draw main view with shadow projections that use the same LOD (handles LOD transitions)
+                for (int32 i = 0; i < contextsCount; i++)
+                    contextsMask[i] = contextsLOD[i] == mainLOD;
+                ModelDraw(this, mainRenderContext, renderContextBatch, maskedInfo);
+
+                // Draw remaining shadow projections grouped by LOD
+                for (int32 lod = 0; lod <= proxyLOD; lod++)
+                {
+                    if (lod == mainLOD)
+                        continue;
+                    bool any = false;
+                    for (int32 i = 0; i < contextsCount; i++)
+                    {
+                        contextsMask[i] = contextsLOD[i] == lod;
+                        any |= contextsMask[i];
+                    }
+                    if (!any)
+                        continue;
+                    if (lod != proxyLOD)
+                    {
+                        LODs.Get()[lod].Draw(renderContextBatch, maskedInfo, 0.0f);
+                        continue;
+                    }
+
+                    // Draw shadow proxy mesh
+                    DrawCall drawCall;
+                    drawCall.Geometry.IndexBuffer = ShadowProxy.IndexBuffer;
+                    drawCall.Geometry.VertexBuffers[0] = ShadowProxy.VertexBuffer;
+                    drawCall.Geometry.VertexBuffers[1] = nullptr;
+                    drawCall.Geometry.VertexBuffers[2] = nullptr;
+                    drawCall.Draw.IndicesCount = ShadowProxy.Triangles * 3;
+                    drawCall.InstanceCount = 1;
+                    drawCall.Material = GPUDevice::Instance->GetDefaultMaterial();
+                    drawCall.World = *info.World;
+                    drawCall.ObjectPosition = drawCall.World.GetTranslation();
+                    drawCall.ObjectRadius = (float)info.Bounds.Radius;
+                    drawCall.Surface.GeometrySize = GetBox().GetSize();
+                    drawCall.Surface.PrevWorld = info.DrawState->PrevWorld;
+                    drawCall.Surface.Lightmap = nullptr;
+                    drawCall.Surface.LightmapUVsArea = Rectangle::Empty;
+                    drawCall.Surface.Skinning = nullptr;
+                    drawCall.Surface.LODDitherFactor = 0.0f;
+                    drawCall.WorldDeterminantSign = Math::FloatSelect(drawCall.World.RotDeterminant(), 1, -1);
+                    drawCall.PerInstanceRandom = info.PerInstanceRandom;
+                    mainRenderContext.List->AddDrawCall(renderContextBatch, DrawPass::Depth, info.Flags, proxyMode, info.Bounds, drawCall, false, info.SortOrder, RenderList::GetBatchKey(drawCall), contextsMask.Get());
+                }
+                return;
+            }
+        }
+    }
+    ModelDraw(this, mainRenderContext, renderContextBatch, info);
+}
+
+ShadowsCastingMode Model::GetShadowProxyMode(const Mesh::DrawInfo& info) const
+{
+    // Proxy geometry has positions only so it can replace only the opaque materials that don't modify the surface in depth pass
+    if (info.Deformation || LODs.IsEmpty() || (info.DrawModes & DrawPass::Depth) == DrawPass::None)
+        return ShadowsCastingMode::None;
+    ShadowsCastingMode result = ShadowsCastingMode::None;
+    const auto& meshes = LODs.Get()[0].Meshes;
+    for (int32 meshIndex = 0; meshIndex < meshes.Count(); meshIndex++)
+    {
+        const int32 slotIndex = meshes[meshIndex].GetMaterialSlotIndex();
+        const auto& entry = info.Buffer->At(slotIndex);
+        const MaterialSlot& slot = MaterialSlots[slotIndex];
+        const ShadowsCastingMode shadowsMode = entry.ShadowsMode & slot.ShadowsMode;
+        if (!entry.Visible || (meshIndex != 0 && shadowsMode != result))
+            return ShadowsCastingMode::None;
+        result = shadowsMode;
+        MaterialBase* material;
+        if (entry.Material && entry.Material->IsLoaded())
+            material = entry.Material;
+        else if (slot.Material && slot.Material->IsLoaded())
+            material = slot.Material;
+        else
+            return ShadowsCastingMode::None;
+        const MaterialInfo& materialInfo = material->GetInfo();
+        if (materialInfo.Domain != MaterialDomain::Surface ||
+            materialInfo.BlendMode != MaterialBlendMode::Opaque ||
+            materialInfo.CullMode != CullMode::Normal ||
+            EnumHasAnyFlags(materialInfo.UsageFlags, MaterialUsageFlags::UseMask | MaterialUsageFlags::UsePositionOffset | MaterialUsageFlags::UseDisplacement) ||
+            (material->GetDrawModes() & DrawPass::Depth) == DrawPass::None)
+            return ShadowsCastingMode::None;
+    }
+    return result;
 }
 
 bool Model::SetupLODs(const Span<int32>& meshesCountPerLod)
@@ -506,7 +626,7 @@ bool Model::Save(bool withMeshDataFromGpu, const StringView& path)
                     uint32 vertices = mesh.GetVertexCount();
                     uint32 triangles = mesh.GetTriangleCount();
                     bool hasColors = meshData.VB2.IsValid();
-                    uint32 vb0Size = vertices * sizeof(VB0ElementType);
+                    uint32 vb0Size = vertices * mesh.GetVB0Stride();
                     uint32 vb1Size = vertices * sizeof(VB1ElementType);
                     uint32 vb2Size = vertices * sizeof(VB2ElementType);
                     uint32 indicesCount = triangles * 3;
@@ -601,6 +721,54 @@ bool Model::Save(bool withMeshDataFromGpu, const StringView& path)
             }
             sdfChunk->Data.Copy(sdfStream.GetHandle(), sdfStream.GetPosition());
         }
+
+        // Save meshes triangle clusters
+        bool hasMeshlets = false;
+        for (const auto& lod : LODs)
+        {
+            for (const auto& mesh : lod.Meshes)
+                hasMeshlets |= mesh.GetMeshlets().HasItems();
+        }
+        if (hasMeshlets)
+        {
+            auto meshletsChunk = GET_CHUNK(14);
+            if (meshletsChunk == nullptr)
+                return true;
+            MemoryWriteStream meshletsStream;
+            meshletsStream.WriteInt32(1); // Version
+            for (const auto& lod : LODs)
+            {
+                for (const auto& mesh : lod.Meshes)
+                {
+                    const auto& meshlets = mesh.GetMeshlets();
+                    meshletsStream.WriteInt32(meshlets.Count());
+                    meshletsStream.WriteBytes(meshlets.Get(), meshlets.Count() * sizeof(Meshlet));
+                }
+            }
+            meshletsChunk->Data.Copy(meshletsStream.GetHandle(), meshletsStream.GetPosition());
+        }
+
+        // Save meshes positions quantization (GPU vertex buffers hold quantized data)
+        bool hasQuantization = false;
+        for (const auto& lod : LODs)
+        {
+            for (const auto& mesh : lod.Meshes)
+                hasQuantization |= mesh.GetPositionsQuantization().IsValid();
+        }
+        if (hasQuantization)
+        {
+            auto quantizationChunk = GET_CHUNK(13);
+            if (quantizationChunk == nullptr)
+                return true;
+            MemoryWriteStream quantizationStream;
+            quantizationStream.WriteInt32(1); // Version
+            for (const auto& lod : LODs)
+            {
+                for (const auto& mesh : lod.Meshes)
+                    quantizationStream.WriteBytes(&mesh.GetPositionsQuantization(), sizeof(PositionsQuantization));
+            }
+            quantizationChunk->Data.Copy(quantizationStream.GetHandle(), quantizationStream.GetPosition());
+        }
     }
     else
     {
@@ -611,6 +779,14 @@ bool Model::Save(bool withMeshDataFromGpu, const StringView& path)
                 return true;
         }
 
+        // Meshes triangle clusters
+        if (HasChunk(14) && LoadChunk(14))
+            return true;
+
+        // Meshes positions quantization
+        if (HasChunk(13) && LoadChunk(13))
+            return true;
+
         if (SDF.Texture)
         {
             // SDF data from file (only if has no cached texture data)
@@ -624,6 +800,10 @@ bool Model::Save(bool withMeshDataFromGpu, const StringView& path)
         }
     }
 
+    // Shadow proxy mesh (generated during import)
+    if (HasChunk(12) && LoadChunk(12))
+        return true;
+
     // Set mesh header data
     auto headerChunk = GET_CHUNK(0);
     ASSERT(headerChunk != nullptr);
@@ -650,7 +830,7 @@ bool Model::Save(bool withMeshDataFromGpu, const StringView& path)
 
 #endif
 
-bool Model::GenerateSDF(float resolutionScale, int32 lodIndex, bool cacheData, float backfacesThreshold)
+bool Model::GenerateSDF(float resolutionScale, int32 lodIndex, bool cacheData, float backfacesThreshold, bool useGPU)
 {
     if (EnableModelSDF == 2)
         return true; // Not supported
@@ -673,7 +853,7 @@ bool Model::GenerateSDF(float resolutionScale, int32 lodIndex, bool cacheData, f
 #else
     class MemoryWriteStream* outputStream = nullptr;
 #endif
-    if (ModelTool::GenerateModelSDF(this, nullptr, resolutionScale, lodIndex, &SDF, outputStream, GetPath(), backfacesThreshold))
+    if (ModelTool::GenerateModelSDF(this, nullptr, resolutionScale, lodIndex, &SDF, outputStream, GetPath(), backfacesThreshold, useGPU))
         return true;
 
 #if USE_EDITOR
@@ -965,6 +1145,107 @@ Asset::LoadResult Model::load()
         }
     }
 
+    // Load meshes triangle clusters (used when creating mesh buffers during streaming)
+    auto chunk14 = GetChunk(14);
+    if (chunk14 && chunk14->IsLoaded())
+    {
+        MemoryReadStream meshletsStream(chunk14->Get(), chunk14->Size());
+        int32 version;
+        meshletsStream.ReadInt32(&version);
+        switch (version)
+        {
+        case 1:
+            for (int32 lodIndex = 0; lodIndex < LODs.Count(); lodIndex++)
+            {
+                auto& lod = LODs[lodIndex];
+                for (int32 meshIndex = 0; meshIndex < lod.Meshes.Count(); meshIndex++)
+                {
+                    int32 meshletsCount;
+                    meshletsStream.ReadInt32(&meshletsCount);
+                    const Meshlet* meshlets = meshletsStream.Move<Meshlet>(meshletsCount);
+                    lod.Meshes[meshIndex].SetMeshlets(meshlets, meshletsCount);
+                }
+            }
+            break;
+        default:
+            LOG(Warning, "Unknown meshlets data version {0} in {1}", version, ToString());
+            break;
+        }
+        ReleaseChunk(14);
+    }
+
+    // Load meshes positions quantization (defines the vertex buffers layout used during streaming)
+    auto chunk13 = GetChunk(13);
+    if (chunk13 && chunk13->IsLoaded())
+    {
+        MemoryReadStream quantizationStream(chunk13->Get(), chunk13->Size());
+        int32 version;
+        quantizationStream.ReadInt32(&version);
+        switch (version)
+        {
+        case 1:
+            for (int32 lodIndex = 0; lodIndex < LODs.Count(); lodIndex++)
+            {
+                auto& lod = LODs[lodIndex];
+                for (int32 meshIndex = 0; meshIndex < lod.Meshes.Count(); meshIndex++)
+                {
+                    PositionsQuantization quantization;
+                    quantizationStream.ReadBytes(&quantization, sizeof(quantization));
+                    lod.Meshes[meshIndex].SetPositionsQuantization(quantization);
+                }
+            }
+            break;
+        default:
+            LOG(Error, "Unknown positions quantization data version {0} in {1}", version, ToString());
+            return LoadResult::InvalidData;
+        }
+        ReleaseChunk(13);
+    }
+
+    // Load shadow proxy mesh
+    auto chunk12 = GetChunk(12);
+    if (chunk12 && chunk12->IsLoaded())
+    {
+        MemoryReadStream proxyStream(chunk12->Get(), chunk12->Size());
+        int32 version;
+        proxyStream.ReadInt32(&version);
+        switch (version)
+        {
+        case 1:
+        {
+            int32 minLOD, vertexCount, indexCount;
+            proxyStream.ReadInt32(&minLOD);
+            proxyStream.ReadInt32(&vertexCount);
+            proxyStream.ReadInt32(&indexCount);
+            const bool use16BitIndexBuffer = vertexCount <= MAX_uint16;
+            const uint32 ibStride = use16BitIndexBuffer ? sizeof(uint16) : sizeof(uint32);
+            const Float3* vb = proxyStream.Move<Float3>(vertexCount);
+            const byte* ib = proxyStream.Move<byte>(indexCount * ibStride);
+#if GPU_ENABLE_RESOURCE_NAMING
+            ShadowProxy.VertexBuffer = GPUDevice::Instance->CreateBuffer(GetPath() + TEXT(".ShadowProxy.VB"));
+            ShadowProxy.IndexBuffer = GPUDevice::Instance->CreateBuffer(GetPath() + TEXT(".ShadowProxy.IB"));
+#else
+            ShadowProxy.VertexBuffer = GPUDevice::Instance->CreateBuffer(String::Empty);
+            ShadowProxy.IndexBuffer = GPUDevice::Instance->CreateBuffer(String::Empty);
+#endif
+            if (ShadowProxy.VertexBuffer->Init(GPUBufferDescription::Vertex(sizeof(Float3), vertexCount, vb)) ||
+                ShadowProxy.IndexBuffer->Init(GPUBufferDescription::Index(ibStride, indexCount, ib)))
+            {
+                SAFE_DELETE_GPU_RESOURCE(ShadowProxy.VertexBuffer);
+                SAFE_DELETE_GPU_RESOURCE(ShadowProxy.IndexBuffer);
+                return LoadResult::Failed;
+            }
+            ShadowProxy.Triangles = indexCount / 3;
+            ShadowProxy.MinLOD = minLOD;
+            break;
+        }
+        default:
+            LOG(Warning, "Unknown shadow proxy data version {0} in {1}", version, ToString());
+            break;
+        }
+        ReleaseChunk(12);
+    }
+
     // Load SDF
     auto chunk15 = GetChunk(15);
     if (chunk15 && chunk15->IsLoaded() && EnableModelSDF == 1)
@@ -1043,6 +1324,9 @@ void Model::unload(bool isReloading)
 
     // Cleanup
     SAFE_DELETE_GPU_RESOURCE(SDF.Texture);
+    SAFE_DELETE_GPU_RESOURCE(ShadowProxy.VertexBuffer);
+    SAFE_DELETE_GPU_RESOURCE(ShadowProxy.IndexBuffer);
+    ShadowProxy.Triangles = 0;
     MaterialSlots.Resize(0);
     for (int32 i = 0; i < LODs.Count(); i++)
         LODs[i].Dispose();
@@ -1065,7 +1349,12 @@ bool Model::init(AssetInitData& initData)
 AssetChunksFlag Model::getChunksToPreload() const
 {
     // Note: we don't preload any LODs here because it's done by the Streaming Manager
-    return GET_CHUNK_FLAG(0) | GET_CHUNK_FLAG(15);
+    if (!Streaming::IsEnabled())
+    {
+        // Server content profile uses only bounds, material slots and LODs info (meshes data is still accessible via DownloadData)
+        return GET_CHUNK_FLAG(0);
+    }
+    return GET_CHUNK_FLAG(0) | GET_CHUNK_FLAG(12) | GET_CHUNK_FLAG(13) | GET_CHUNK_FLAG(14) | GET_CHUNK_FLAG(15);
 }
 
 void ModelBase::SetupMaterialSlots(int32 slotsCount)
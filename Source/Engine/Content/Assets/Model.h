@@ -8,6 +8,32 @@
 class Mesh;
 class StreamModelLODTask;
 
+/// <summary>
+/// The simplified position-only geometry used to draw the model shadows (all meshes merged). Generated during model import.
+/// </summary>
+struct FLAXENGINE_API ModelShadowProxy
+{
+    /// <summary>
+    /// The vertex buffer with positions (the same layout as the mesh vertex buffer 0). Null if model has no shadow proxy.
+    /// </summary>
+    GPUBuffer* VertexBuffer = nullptr;
+
+    /// <summary>
+    /// The index buffer.
+    /// </summary>
+    GPUBuffer* IndexBuffer = nullptr;
+
+    /// <summary>
+    /// The amount of triangles.
+    /// </summary>
+    int32 Triangles = 0;
+
+    /// <summary>
+    /// The index of the first shadow LOD that uses the proxy geometry.
+    /// </summary>
+    int32 MinLOD = 0;
+};
+
 /// <summary>
 /// Model asset that contains model object made of meshes which can rendered on the GPU.
 /// </summary>
@@ -31,6 +57,11 @@ API_CLASS(NoSpawn) class FLAXENGINE_API Model : public ModelBase
     /// </summary>
     API_FIELD(ReadOnly) SDFData SDF;
 
+    /// <summary>
+    /// The shadow proxy mesh for this model (optional, generated during import).
+    /// </summary>
+    ModelShadowProxy ShadowProxy;
+
 public:
     /// <summary>
     /// Finalizes an instance of the <see cref="Model"/> class.
@@ -168,9 +199,10 @@ API_CLASS(NoSpawn) class FLAXENGINE_API Model : public ModelBase
     /// </summary>
     /// <param name="context">GPU context to draw with.</param>
     /// <param name="lodIndex">The Level Of Detail index.</param>
-    void Render(GPUContext* context, int32 lodIndex = 0)
+    /// <param name="instanceCount">The amount of instances to draw.</param>
+    void Render(GPUContext* context, int32 lodIndex = 0, int32 instanceCount = 1)
     {
-        LODs[lodIndex].Render(context);
+        LODs[lodIndex].Render(context, instanceCount);
     }
 
     /// <summary>
@@ -222,13 +254,14 @@ API_CLASS(NoSpawn) class FLAXENGINE_API Model : public ModelBase
     /// <summary>
     /// Generates the Sign Distant Field for this model.
     /// </summary>
-    /// <remarks>Can be called in async in case of SDF generation on a CPU (assuming model is not during rendering).</remarks>
+    /// <remarks>Can be called in async in case of SDF generation on a CPU (assuming model is not during rendering). GPU generation is used only when called from other than main thread.</remarks>
     /// <param name="resolutionScale">The SDF texture resolution scale. Use higher values for more precise data but with significant performance and memory overhead.</param>
     /// <param name="lodIndex">The index of the LOD to use for the SDF building.</param>
     /// <param name="cacheData">If true, the generated SDF texture data will be cached on CPU (in asset chunk storage) to allow saving it later, otherwise it will be runtime for GPU-only. Ignored for virtual assets or in build.</param>
     /// <param name="backfacesThreshold">Custom threshold (in range 0-1) for adjusting mesh internals detection based on the percentage of test rays hit triangle backfaces. Use lower value for more dense mesh.</param>
+    /// <param name="useGPU">If true, the SDF will be generated on a GPU with compute shader (much faster). Fallbacks to CPU if GPU is not available.</param>
     /// <returns>True if failed, otherwise false.</returns>
-    API_FUNCTION() bool GenerateSDF(float resolutionScale = 1.0f, int32 lodIndex = 6, bool cacheData = true, float backfacesThreshold = 0.6f);
+    API_FUNCTION() bool GenerateSDF(float resolutionScale = 1.0f, int32 lodIndex = 6, bool cacheData = true, float backfacesThreshold = 0.6f, bool useGPU = true);
 
     /// <summary>
     /// Sets set SDF data (releases the current one).
@@ -243,6 +276,9 @@ API_CLASS(NoSpawn) class FLAXENGINE_API Model : public ModelBase
     /// <returns>True if failed, otherwise false.</returns>
     bool Init(const Span<int32>& meshesCountPerLod);
 
+    // Gets the shadows casting mode of the model instance if it can be drawn with the shadow proxy mesh (opaque materials only), otherwise returns ShadowsCastingMode::None.
+    ShadowsCastingMode GetShadowProxyMode(const Mesh::DrawInfo& info) const;
+
 public:
     // [ModelBase]
     void SetupMaterialSlots(int32 slotsCount) override;
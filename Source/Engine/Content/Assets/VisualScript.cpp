@@ -49,10 +49,22 @@ Action VisualScripting::DebugFlow;
 static_assert(TIsPODType<VisualScripting::StackFrame>::Value, "VisualScripting::StackFrame must be POD type.");
 static_assert(TIsPODType<VisualScriptThread>::Value, "VisualScriptThread must be POD type.");
 
+bool VisualScriptGraph::Load(ReadStream* stream, bool loadMeta)
+{
+    if (VisjectGraph::Load(stream, loadMeta))
+        return true;
+    CompilePrograms();
+    return false;
+}
+
 bool VisualScriptGraph::onNodeLoaded(Node* n)
 {
     switch (n->GroupID)
     {
+    // Math
+    case 3:
+        n->Data.Program.Index = -1;
+        break;
     // Function
     case 16:
         switch (n->TypeID)
@@ -73,6 +85,162 @@ bool VisualScriptGraph::onNodeLoaded(Node* n)
     return VisjectGraph<VisualScriptGraphNode, VisjectGraphBox, VisjectGraphParameter>::onNodeLoaded(n);
 }
 
+void VisualScriptGraph::CompilePrograms()
+{
+    Programs.Clear();
+    for (Node& node : Nodes)
+    {
+        if (node.GroupID != 3 || node.FastType == VariantType::Null)
+            continue;
+        VisualScriptProgram program;
+        if (CompileValue(program, &node, nullptr) == -1)
+            continue;
+        node.Data.Program.Index = Programs.Count();
+        Programs.Add(program);
+    }
+}
+
+int32 VisualScriptGraph::CompileValue(VisualScriptProgram& program, Node* node, Box* box)
+{
+    if (program.Ops.Count() == VISUAL_SCRIPT_MAX_PROGRAM_OPS)
+        return -1;
+    VisualScriptProgram::Op op;
+    op.MathOp = 0;
+    op.A = op.B = -1;
+    op.Parameter = -1;
+    Platform::MemoryClear(&op.Value, sizeof(op.Value));
+    switch (node->GroupID)
+    {
+    // Constants
+    case 2:
+    {
+        Variant value;
+        switch (node->TypeID)
+        {
+        // Float
+        case 3:
+            value = node->Values[0];
+            break;
+        // Float2/3/4, Color
+        case 4:
+        case 5:
+        case 6:
+        case 7:
+            value = node->Values[0];
+            if (box && box->ID != 0)
+                value = ((Float4)value).Raw[box->ID - 1];
+            break;
+        // PI
+        case 10:
+            value = PI;
+            break;
+        default:
+            return -1;
+        }
+        const VariantType::Types type = GraphUtilities::GetFastMathType(value.Type.Type);
+        if (type == VariantType::Null || !GraphUtilities::LoadFastValue(value, type, op.Value))
+            return -1;
+        op.Code = VisualScriptProgram::OpCodes::Constant;
+        break;
+    }
+    // Parameters
+    case 6:
+    {
+        // Get Parameter
+        if (node->TypeID != 3)
+            return -1;
+        const auto param = GetParameter((Guid)node->Values[0], op.Parameter);
+        if (!param)
+            return -1;
+        op.Value.Type = GraphUtilities::GetFastMathType(param->Type.Type);
+        if (op.Value.Type == VariantType::Null)
+            return -1;
+        op.Code = VisualScriptProgram::OpCodes::Parameter;
+        program.UsesParameters = true;
+        break;
+    }
+    // Math
+    case 3:
+    {
+        if (node->FastType == VariantType::Null)
+            return -1;
+        GraphUtilities::FastValue tmp;
+        tmp.Type = node->FastType;
+        Platform::MemoryClear(tmp.Components, sizeof(tmp.Components));
+        op.MathOp = node->TypeID;
+        op.Value.Type = node->FastType;
+        if (GraphUtilities::ApplyMathFast(node->TypeID, op.Value, tmp))
+        {
+            // Unary operation (the same as the typed fast-path of VisjectExecutor::ProcessGroupMath)
+            if (!node->GetBox(0)->HasConnection())
+                return -1;
+            op.Code = VisualScriptProgram::OpCodes::Math1;
+            op.A = (int16)CompileInput(program, node, 0, true);
+            if (op.A == -1)
+                return -1;
+        }
+        else if (GraphUtilities::ApplyMathFast(node->TypeID, op.Value, tmp, tmp))
+        {
+            // Binary operation
+            const bool primaryA = node->GetBox(0)->HasConnection();
+            op.Code = VisualScriptProgram::OpCodes::Math2;
+            op.A = (int16)CompileInput(program, node, 0, primaryA);
+            if (op.A == -1)
+                return -1;
+            op.B = (int16)CompileInput(program, node, 1, !primaryA);
+            if (op.B == -1)
+                return -1;
+        }
+        else
+        {
+            return -1;
+        }
+        if (program.Ops.Count() == VISUAL_SCRIPT_MAX_PROGRAM_OPS)
+            return -1;
+        break;
+    }
+    default:
+        return -1;
+    }
+    program.Ops.Add(op);
+    return program.Ops.Count() - 1;
+}
+
+int32 VisualScriptGraph::CompileInput(VisualScriptProgram& program, Node* node, int32 index, bool primary)
+{
+    const Box* box = node->GetBox(index);
+    if (box->HasConnection())
+    {
+        // Connected value of the other type is converted by the interpreter (only scalar broadcast is supported)
+        Box* source = box->FirstConnection();
+        const int32 result = CompileValue(program, source->GetParent<Node>(), source);
+        if (result == -1)
+            return -1;
+        const VariantType::Types type = program.Ops[result].Value.Type;
+        if (type != node->FastType && (primary || type != VariantType::Float))
+            return -1;
+        return result;
+    }
+
+    // Default value
+    if (node->Values.Count() <= index)
+        return -1;
+    const Variant& value = node->Values[index];
+    if (primary && value.Type.Type != node->FastType)
+        return -1;
+    if (program.Ops.Count() == VISUAL_SCRIPT_MAX_PROGRAM_OPS)
+        return -1;
+    VisualScriptProgram::Op op;
+    op.Code = VisualScriptProgram::OpCodes::Constant;
+    op.MathOp = 0;
+    op.A = op.B = -1;
+    op.Parameter = -1;
+    if (!GraphUtilities::LoadFastValue(value, node->FastType, op.Value))
+        return -1;
+    program.Ops.Add(op);
+    return program.Ops.Count() - 1;
+}
+
 VisualScriptExecutor::VisualScriptExecutor()
 {
     _perGroupProcessCall[6] = (ProcessBoxHandler)&VisualScriptExecutor::ProcessGroupParameters;
@@ -140,6 +308,18 @@ VisjectExecutor::Value VisualScriptExecutor::eatBox(Node* caller, Box* box)
 #endif
     const auto parentNode = box->GetParent<Node>();
 
+    // Evaluate the compiled math expression (interpreter is used when debugging to visualize the signal flow)
+#if VISUAL_SCRIPT_DEBUGGING
+    if (parentNode->GroupID == 3 && parentNode->Data.Program.Index != -1 && !VisualScripting::DebugFlow.IsBinded())
+#else
+    if (parentNode->GroupID == 3 && parentNode->Data.Program.Index != -1)
+#endif
+    {
+        Value value;
+        if (!ExecuteProgram(stack.Stack->Script->Graph.Programs[parentNode->Data.Program.Index], value))
+            return value;
+    }
+
     // Add to the calling stack
     VisualScripting::StackFrame frame = *stack.Stack;
     frame.Node = parentNode;
@@ -165,6 +345,76 @@ VisjectExecutor::Value VisualScriptExecutor::eatBox(Node* caller, Box* box)
     return value;
 }
 
+bool VisualScriptExecutor::ExecuteProgram(const VisualScriptProgram& program, Value& result)
+{
+    auto& stack = ThreadStacks.Get();
+    VisualScript* script = stack.Stack->Script;
+    const Array<Variant>* params = nullptr;
+    if (program.UsesParameters)
+    {
+        // Resolve the instance parameters once for the whole program (errors are reported by the interpreter)
+        if (!stack.Stack->Instance)
+            return true;
+        script->Locker.Lock();
+        const auto instanceParams = script->_instances.Find(stack.Stack->Instance->GetID());
+        if (!instanceParams)
+        {
+            script->Locker.Unlock();
+            return true;
+        }
+        params = &instanceParams->Value.Params;
+    }
+
+    // Execute operations (each writes to its own register)
+    GraphUtilities::FastValue registers[VISUAL_SCRIPT_MAX_PROGRAM_OPS];
+    GraphUtilities::FastValue a, b;
+    bool failed = false;
+    const int32 opsCount = program.Ops.Count();
+    for (int32 i = 0; i < opsCount && !failed; i++)
+    {
+        const VisualScriptProgram::Op& op = program.Ops.Get()[i];
+        GraphUtilities::FastValue& r = registers[i];
+        switch (op.Code)
+        {
+        case VisualScriptProgram::OpCodes::Constant:
+            r = op.Value;
+            break;
+        case VisualScriptProgram::OpCodes::Parameter:
+            failed = !GraphUtilities::LoadFastValue(params->At(op.Parameter), op.Value.Type, r);
+            break;
+        case VisualScriptProgram::OpCodes::Math1:
+            GraphUtilities::ApplyMathFast(op.MathOp, r, registers[op.A]);
+            break;
+        case VisualScriptProgram::OpCodes::Math2:
+        {
+            // Scalar inputs are broadcast to the operation type
+            const GraphUtilities::FastValue* ra = &registers[op.A];
+            const GraphUtilities::FastValue* rb = &registers[op.B];
+            if (ra->Type != op.Value.Type)
+            {
+                a.Type = op.Value.Type;
+                a.Components[0] = a.Components[1] = a.Components[2] = a.Components[3] = ra->Components[0];
+                ra = &a;
+            }
+            if (rb->Type != op.Value.Type)
+            {
+                b.Type = op.Value.Type;
+                b.Components[0] = b.Components[1] = b.Components[2] = b.Components[3] = rb->Components[0];
+                rb = &b;
+            }
+            GraphUtilities::ApplyMathFast(op.MathOp, r, *ra, *rb);
+            break;
+        }
+        }
+    }
+    if (params)
+        script->Locker.Unlock();
+    if (failed)
+        return true;
+    GraphUtilities::StoreFastValue(registers[opsCount - 1], result);
+    return false;
+}
+
 VisjectExecutor::Graph* VisualScriptExecutor::GetCurrentGraph() const
 {
     auto& stack = ThreadStacks.Get();
@@ -1525,7 +1775,7 @@ void VisualScript::unload(bool isReloading)
         auto& type = VisualScriptingModule.Types[_scriptingTypeHandle.TypeIndex];
         if (type.Script.DefaultInstance)
         {
-            Delete(type.Script.DefaultInstance);
+            ScriptingObjectsPool::Delete(type.Script.DefaultInstance);
             type.Script.DefaultInstance = nullptr;
         }
         VisualScriptingModule.TypeNameToTypeIndex.RemoveValue(_scriptingTypeHandle.TypeIndex);
@@ -1715,7 +1965,7 @@ void VisualScriptingBinaryModule::OnScriptsReloading()
             auto& type = VisualScriptingModule.Types[script->_scriptingTypeHandle.TypeIndex];
             if (type.Script.DefaultInstance)
             {
-                Delete(type.Script.DefaultInstance);
+                ScriptingObjectsPool::Delete(type.Script.DefaultInstance);
                 type.Script.DefaultInstance = nullptr;
             }
             VisualScriptingModule.TypeNameToTypeIndex.RemoveValue(script->_scriptingTypeHandle.TypeIndex);
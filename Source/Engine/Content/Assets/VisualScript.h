@@ -12,18 +12,63 @@
 #define VISUAL_SCRIPT_GRAPH_MAX_CALL_STACK 250
 #define VISUAL_SCRIPT_DEBUGGING USE_EDITOR
 
+#define VISUAL_SCRIPT_MAX_PROGRAM_OPS 16
+
 #define VisualScriptGraphNode VisjectGraphNode<>
 
 class VisualScripting;
 class VisualScriptingBinaryModule;
 
+/// <summary>
+/// The compiled Visual Script data-flow program. Pure math expressions (constants, parameters and math nodes) are compiled on graph load into a linear list of operations on typed registers (one register per operation) evaluated without the per-node interpreter overhead (stack frames, boxes lookup and Variant casting).
+/// </summary>
+struct VisualScriptProgram
+{
+    enum class OpCodes : byte
+    {
+        // Constant value (Value).
+        Constant,
+        // Script instance parameter value (Parameter index, Value.Type).
+        Parameter,
+        // Math operation on a single register (MathOp, A).
+        Math1,
+        // Math operation on two registers (MathOp, A, B).
+        Math2,
+    };
+
+    struct Op
+    {
+        OpCodes Code;
+        uint16 MathOp;
+        int16 A;
+        int16 B;
+        int32 Parameter;
+        GraphUtilities::FastValue Value;
+    };
+
+    Array<Op, FixedAllocation<VISUAL_SCRIPT_MAX_PROGRAM_OPS>> Ops;
+    bool UsesParameters = false;
+};
+
 /// <summary>
 /// The Visual Script graph data.
 /// </summary>
 class VisualScriptGraph : public VisjectGraph<VisualScriptGraphNode, VisjectGraphBox, VisjectGraphParameter>
 {
 public:
+    /// <summary>
+    /// The compiled data-flow programs (indexed by the math nodes Data.Program.Index).
+    /// </summary>
+    Array<VisualScriptProgram> Programs;
+
+public:
+    bool Load(ReadStream* stream, bool loadMeta) override;
     bool onNodeLoaded(Node* n) override;
+
+private:
+    void CompilePrograms();
+    int32 CompileValue(VisualScriptProgram& program, Node* node, Box* box);
+    int32 CompileInput(VisualScriptProgram& program, Node* node, int32 index, bool primary);
 };
 
 /// <summary>
@@ -49,6 +94,7 @@ class VisualScriptExecutor : public VisjectExecutor
     void ProcessGroupTools(Box* box, Node* node, Value& value);
     void ProcessGroupFunction(Box* boxBase, Node* node, Value& value);
     void ProcessGroupFlow(Box* boxBase, Node* node, Value& value);
+    bool ExecuteProgram(const VisualScriptProgram& program, Value& result);
 };
 
 /// <summary>
@@ -240,8 +240,10 @@ ContentLoadTask* BinaryAsset::RequestChunkDataAsync(int32 index)
         return nullptr;
     }
 
-    // Spawn loading task
-    return New<LoadAssetDataTask>(this, GET_CHUNK_FLAG(index));
+    // Spawn loading task (streaming requests shouldn't block the regular content loading)
+    auto task = New<LoadAssetDataTask>(this, GET_CHUNK_FLAG(index));
+    task->Priority = ContentLoadPriority::Background;
+    return task;
 }
 
 void BinaryAsset::GetChunkData(int32 index, BytesContainer& data) const
@@ -285,7 +287,9 @@ bool BinaryAsset::LoadChunks(AssetChunksFlag chunks)
     if (chunks == 0)
         return false;
 
-    // Load all missing marked chunks
+    // Load all missing marked chunks (in a single batch)
+    FlaxChunk* toLoad[ASSET_FILE_DATA_CHUNKS];
+    int32 toLoadCount = 0;
     for (int32 i = 0; i < ASSET_FILE_DATA_CHUNKS; i++)
     {
         auto chunk = _header.Chunks[i];
@@ -294,12 +298,11 @@ bool BinaryAsset::LoadChunks(AssetChunksFlag chunks)
             && chunk->IsMissing()
             && chunk->ExistsInFile())
         {
-            if (Storage->LoadAssetChunk(chunk))
-                return true;
+            toLoad[toLoadCount++] = chunk;
         }
     }
 
-    return false;
+    return Storage->LoadAssetChunks(Span<FlaxChunk*>(toLoad, toLoadCount));
 }
 
 #if USE_EDITOR
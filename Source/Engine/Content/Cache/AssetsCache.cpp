@@ -2,146 +2,252 @@
 
 #include "AssetsCache.h"
 #include "Engine/Core/Log.h"
-#include "Engine/Core/DeleteMe.h"
 #include "Engine/Core/Types/TimeSpan.h"
 #include "Engine/Core/Types/DateTime.h"
 #include "Engine/Core/Types/Stopwatch.h"
+#include "Engine/Platform/File.h"
 #include "Engine/Platform/FileSystem.h"
+#include "Engine/Core/Collections/Sorting.h"
 #include "Engine/Serialization/FileWriteStream.h"
-#include "Engine/Serialization/FileReadStream.h"
 #include "Engine/Content/Content.h"
 #include "Engine/Content/Storage/ContentStorageManager.h"
 #include "Engine/Content/Storage/JsonStorageProxy.h"
 #include "Engine/Profiler/ProfilerCPU.h"
 #include "Engine/Threading/Threading.h"
 #include "Engine/Engine/Globals.h"
+#include "Engine/Engine/CommandLine.h"
 #include "FlaxEngine.Gen.h"
 
-void AssetsCache::Init()
+// 'FACI' - Flax Assets Cache Index
+#define ASSETS_CACHE_INDEX_MAGIC 0x49434146
+#define ASSETS_CACHE_STRING_LOCK 13
+
+namespace
 {
-    Entry e;
-    int32 count;
-    Stopwatch stopwatch;
-#if USE_EDITOR
-    _path = Globals::ProjectCacheFolder / TEXT("AssetsCache.dat");
-#else
-    _path = Globals::ProjectContentFolder / TEXT("AssetsCache.dat");
-#endif
-    LOG(Info, "Loading Asset Cache {0}...", _path);
+    // Layout: header, entries (sorted by ID), entries paths (sorted by hash), paths mapping (sorted by hash), strings
+    struct IndexHeader
+    {
+        int32 Magic;
+        int32 Version;
+        int32 Flags;
+        int32 EnginePath;
+        int32 ProjectPath;
+        int32 EntriesCount;
+        int32 MappingsCount;
+        int32 StringsSize;
+    };
+
+    struct IndexEntry
+    {
+        Guid ID;
+        int32 TypeName;
+        int32 Path;
+        int64 FileModified;
+    };
 
-    // Check if assets registry exists
-    if (!FileSystem::FileExists(_path))
+    struct IndexPath
     {
-        _isDirty = true;
-        LOG(Warning, "Cannot find assets cache file");
-        return;
+        uint32 Hash;
+        int32 Index;
+    };
+
+    struct IndexMapping
+    {
+        uint32 Hash;
+        int32 Path;
+        Guid ID;
+    };
+
+    static_assert(sizeof(IndexEntry) == 32, "Invalid assets cache index entry size.");
+
+    FORCE_INLINE const IndexHeader& GetIndexHeader(const byte* index)
+    {
+        return *(const IndexHeader*)index;
     }
 
-    // Open file
-    FileReadStream* stream = FileReadStream::Open(_path);
-    DeleteMe<FileReadStream> deleteStream(stream);
+    FORCE_INLINE const IndexEntry* GetIndexEntries(const byte* index)
+    {
+        return (const IndexEntry*)(index + sizeof(IndexHeader));
+    }
 
-    // Load version
-    int32 version;
-    stream->ReadInt32(&version);
-    if (version != FLAXENGINE_VERSION_BUILD)
+    FORCE_INLINE const IndexPath* GetIndexPaths(const byte* index)
     {
-        LOG(Warning, "Corrupted or not supported Asset Cache file. Version: {0}", version);
-        return;
+        return (const IndexPath*)(GetIndexEntries(index) + GetIndexHeader(index).EntriesCount);
     }
 
-    // Load paths
-    String enginePath, projectPath;
-    stream->ReadString(&enginePath, -410);
-    stream->ReadString(&projectPath, -410);
+    FORCE_INLINE const IndexMapping* GetIndexMappings(const byte* index)
+    {
+        return (const IndexMapping*)(GetIndexPaths(index) + GetIndexHeader(index).EntriesCount);
+    }
 
-    // Flags
-    AssetsCacheFlags flags;
-    stream->ReadInt32((int32*)&flags);
+    FORCE_INLINE const byte* GetIndexStrings(const byte* index)
+    {
+        return (const byte*)(GetIndexMappings(index) + GetIndexHeader(index).MappingsCount);
+    }
 
-    // Check if other workspace instance used this cache
-    if (EnumHasNoneFlags(flags, AssetsCacheFlags::RelativePaths) && enginePath != Globals::StartupFolder)
+    FORCE_INLINE uint64 GetIndexSize(const IndexHeader& header)
     {
-        LOG(Warning, "Assets cache generated by the different {1} installation in \'{0}\'", enginePath, TEXT("engine"));
-        return;
+        return sizeof(IndexHeader) + (uint64)header.EntriesCount * (sizeof(IndexEntry) + sizeof(IndexPath)) + (uint64)header.MappingsCount * sizeof(IndexMapping) + header.StringsSize;
     }
-    if (EnumHasNoneFlags(flags, AssetsCacheFlags::RelativePaths) && projectPath != Globals::ProjectFolder)
+
+    int32 CompareIds(const Guid& a, const Guid& b)
     {
-        LOG(Warning, "Assets cache generated by the different {1} installation in \'{0}\'", projectPath, TEXT("project"));
-        return;
+        for (int32 i = 0; i < 4; i++)
+        {
+            if (a.Values[i] != b.Values[i])
+                return a.Values[i] < b.Values[i] ? -1 : 1;
+        }
+        return 0;
     }
 
-    ScopeLock lock(_locker);
-    _isDirty = false;
+    bool SortEntriesById(const AssetsCache::Entry* const& a, const AssetsCache::Entry* const& b)
+    {
+        return CompareIds(a->Info.ID, b->Info.ID) < 0;
+    }
 
-    // Load elements count
-    stream->ReadInt32(&count);
-    _registry.Clear();
-    _registry.EnsureCapacity(count);
+    bool SortPathsByHash(const IndexPath& a, const IndexPath& b)
+    {
+        return a.Hash < b.Hash;
+    }
 
-    // Load data
-    int32 rejectedCount = 0;
-    for (int32 i = 0; i < count; i++)
+    bool SortMappingsByHash(const IndexMapping& a, const IndexMapping& b)
     {
-        stream->Read(e.Info.ID);
-        stream->ReadString(&e.Info.TypeName, i - 13);
-        stream->ReadString(&e.Info.Path, i);
-#if ENABLE_ASSETS_DISCOVERY
-        stream->Read(e.FileModified);
-#else
-        DateTime tmp1;
-        stream->Read(tmp1);
-#endif
+        return a.Hash < b.Hash;
+    }
 
-        if (EnumHasAnyFlags(flags, AssetsCacheFlags::RelativePaths) && e.Info.Path.HasChars())
+    // Finds the first item with the given hash (or the count if missing) in the array sorted by hash
+    template<typename T>
+    int32 FindFirstHash(const T* items, int32 count, uint32 hash)
+    {
+        int32 low = 0, high = count;
+        while (low < high)
         {
-            // Convert to absolute path
-            e.Info.Path = Globals::StartupFolder / e.Info.Path;
+            const int32 mid = (low + high) / 2;
+            if (items[mid].Hash < hash)
+                low = mid + 1;
+            else
+                high = mid;
         }
-
-        // Use only valid entries
-        if (IsEntryValid(e))
-            _registry.Add(e.Info.ID, e);
-        else
-            rejectedCount++;
+        return low;
     }
 
-    // Paths mapping
-    stream->ReadInt32(&count);
-    _pathsMapping.Clear();
-    _pathsMapping.EnsureCapacity(count);
-    for (int32 i = 0; i < count; i++)
+    struct IndexStringsBuilder
     {
-        Guid id;
-        stream->Read(id);
-        String mappedPath;
-        stream->ReadString(&mappedPath, i + 73);
+        Array<byte> Data;
+        Dictionary<String, int32> Lookup;
 
-        if (EnumHasAnyFlags(flags, AssetsCacheFlags::RelativePaths) && mappedPath.HasChars())
+        int32 Add(const String& str)
         {
-            // Convert to absolute path
-            mappedPath = Globals::StartupFolder / mappedPath;
+            int32 offset;
+            if (Lookup.TryGet(str, offset))
+                return offset;
+            offset = Data.Count();
+            const int32 length = str.Length();
+            const int32 size = Math::AlignUp<int32>(sizeof(int32) + length * sizeof(Char), 4);
+            Data.AddZeroed(size);
+            *(int32*)(Data.Get() + offset) = length;
+            Char* dst = (Char*)(Data.Get() + offset + sizeof(int32));
+            for (int32 i = 0; i < length; i++)
+                dst[i] = str[i] ^ ASSETS_CACHE_STRING_LOCK;
+            Lookup.Add(str, offset);
+            return offset;
         }
+    };
+}
+
+AssetsCache::~AssetsCache()
+{
+    ReleaseIndex();
+}
+
+void AssetsCache::Init()
+{
+    Stopwatch stopwatch;
+#if USE_EDITOR
+    _path = Globals::ProjectCacheFolder / TEXT("AssetsCache.dat");
+#else
+    _path = Globals::ProjectContentFolder / TEXT("AssetsCache.dat");
+#endif
+    LOG(Info, "Loading Asset Cache {0}...", _path);
 
-        _pathsMapping.Add(mappedPath, id);
+    // Check if assets registry exists
+    if (!FileSystem::FileExists(_path))
+    {
+        _isDirty = true;
+        LOG(Warning, "Cannot find assets cache file");
+        return;
     }
 
-    // Check errors
-    const bool hasError = stream->HasError();
-    deleteStream.Delete();
-    if (hasError)
+    ScopeLock lock(_locker);
+    ReleaseIndex();
+    _registry.Clear();
+    _pathsMapping.Clear();
+
+    // Map the index file (entries are read in place so it doesn't need to parse the whole file)
+    if (File::MapReadOnly(_path, _index, _indexSize, CommandLine::Options.SharedContent.IsTrue()))
+    {
+        if (File::ReadAllBytes(_path, _indexBuffer))
+        {
+            LOG(Warning, "Cannot read assets cache file");
+            return;
+        }
+        _index = _indexBuffer.Get();
+        _indexSize = _indexBuffer.Count();
+    }
+    else
+    {
+        _indexMapped = true;
+    }
+
+    // Validate header
+    if (_indexSize < sizeof(IndexHeader) || GetIndexHeader(_index).Magic != ASSETS_CACHE_INDEX_MAGIC || GetIndexHeader(_index).Version != FLAXENGINE_VERSION_BUILD)
+    {
+        LOG(Warning, "Corrupted or not supported Asset Cache file. Version: {0}", _indexSize >= sizeof(IndexHeader) ? GetIndexHeader(_index).Version : 0);
+        ReleaseIndex();
+        return;
+    }
+    const IndexHeader& header = GetIndexHeader(_index);
+    if (header.EntriesCount < 0 || header.MappingsCount < 0 || header.StringsSize < 0 || GetIndexSize(header) > _indexSize)
     {
+        ReleaseIndex();
         _isDirty = true;
-        _registry.Clear();
         LOG(Warning, "Asset Cache file has an error. Removing it.");
         if (FileSystem::DeleteFile(_path))
         {
             LOG(Error, "Cannot delete registry file after reading error.");
         }
+        return;
+    }
+
+    // Check if other workspace instance used this cache
+    _indexFlags = (AssetsCacheFlags)header.Flags;
+    if (EnumHasNoneFlags(_indexFlags, AssetsCacheFlags::RelativePaths))
+    {
+        String enginePath, projectPath;
+        ReadIndexString(header.EnginePath, enginePath);
+        ReadIndexString(header.ProjectPath, projectPath);
+        if (enginePath != Globals::StartupFolder)
+        {
+            LOG(Warning, "Assets cache generated by the different {1} installation in \'{0}\'", enginePath, TEXT("engine"));
+            ReleaseIndex();
+            return;
+        }
+        if (projectPath != Globals::ProjectFolder)
+        {
+            LOG(Warning, "Assets cache generated by the different {1} installation in \'{0}\'", projectPath, TEXT("project"));
+            ReleaseIndex();
+            return;
+        }
     }
 
+    _isDirty = false;
+    _indexPending = header.EntriesCount;
+    _indexMappingsPending = true;
+    _indexVisited.Resize(header.EntriesCount, false);
+    _indexVisited.SetAll(false);
+
     stopwatch.Stop();
-    LOG(Info, "Asset Cache loaded {0} entries in {1}ms ({2} rejected)", _registry.Count(), stopwatch.GetMilliseconds(), rejectedCount);
+    LOG(Info, "Asset Cache opened with {0} entries and {1} paths mappings in {2}ms", header.EntriesCount, header.MappingsCount, stopwatch.GetMilliseconds());
 }
 
 bool AssetsCache::Save()
@@ -155,6 +261,9 @@ bool AssetsCache::Save()
 
     ScopeLock lock(_locker);
 
+    // Materialize all entries and release the file mapping before overwriting it
+    LoadIndex();
+
     if (Save(_path, _registry, _pathsMapping))
         return true;
 
@@ -171,64 +280,251 @@ bool AssetsCache::Save(const StringView& path, const Registry& entries, const Pa
 
     LOG(Info, "Saving assets cache to \'{0}\', entries: {1}", path, entries.Count());
 
+    // Build index
+    IndexStringsBuilder strings;
+    IndexHeader header;
+    header.Magic = ASSETS_CACHE_INDEX_MAGIC;
+    header.Version = FLAXENGINE_VERSION_BUILD;
+    header.Flags = (int32)flags;
+    header.EnginePath = strings.Add(Globals::StartupFolder);
+    header.ProjectPath = strings.Add(Globals::ProjectFolder);
+    header.EntriesCount = entries.Count();
+    header.MappingsCount = pathsMapping.Count();
+    Array<const Entry*> sortedEntries;
+    sortedEntries.EnsureCapacity(entries.Count());
+    for (auto i = entries.Begin(); i.IsNotEnd(); ++i)
+        sortedEntries.Add(&i->Value);
+    Sorting::QuickSort(sortedEntries.Get(), sortedEntries.Count(), &SortEntriesById);
+    Array<IndexEntry> indexEntries;
+    Array<IndexPath> indexPaths;
+    indexEntries.Resize(sortedEntries.Count());
+    indexPaths.Resize(sortedEntries.Count());
+    for (int32 i = 0; i < sortedEntries.Count(); i++)
+    {
+        const Entry& e = *sortedEntries[i];
+        IndexEntry& indexEntry = indexEntries[i];
+        indexEntry.ID = e.Info.ID;
+        indexEntry.TypeName = strings.Add(e.Info.TypeName);
+        indexEntry.Path = strings.Add(e.Info.Path);
+#if ENABLE_ASSETS_DISCOVERY
+        indexEntry.FileModified = e.FileModified.Ticks;
+#else
+        indexEntry.FileModified = 0;
+#endif
+        indexPaths[i].Hash = GetHash(StringView(e.Info.Path));
+        indexPaths[i].Index = i;
+    }
+    Sorting::QuickSort(indexPaths.Get(), indexPaths.Count(), &SortPathsByHash);
+    Array<IndexMapping> indexMappings;
+    indexMappings.EnsureCapacity(pathsMapping.Count());
+    for (auto i = pathsMapping.Begin(); i.IsNotEnd(); ++i)
+    {
+        IndexMapping& indexMapping = indexMappings.AddOne();
+        indexMapping.Hash = GetHash(StringView(i->Key));
+        indexMapping.Path = strings.Add(i->Key);
+        indexMapping.ID = i->Value;
+    }
+    Sorting::QuickSort(indexMappings.Get(), indexMappings.Count(), &SortMappingsByHash);
+    header.StringsSize = strings.Data.Count();
+
     // Open file
     auto stream = FileWriteStream::Open(path);
     if (stream == nullptr)
         return true;
 
-    // Version
-    stream->WriteInt32(FLAXENGINE_VERSION_BUILD);
+    // Write index
+    stream->WriteBytes(&header, sizeof(header));
+    stream->WriteBytes(indexEntries.Get(), indexEntries.Count() * sizeof(IndexEntry));
+    stream->WriteBytes(indexPaths.Get(), indexPaths.Count() * sizeof(IndexPath));
+    stream->WriteBytes(indexMappings.Get(), indexMappings.Count() * sizeof(IndexMapping));
+    stream->WriteBytes(strings.Data.Get(), strings.Data.Count());
 
-    // Paths
-    stream->WriteString(Globals::StartupFolder, -410);
-    stream->WriteString(Globals::ProjectFolder, -410);
+    // Cleanup
+    stream->Flush();
+    Delete(stream);
 
-    // Flags
-    stream->WriteInt32((int32)flags);
+    return false;
+}
 
-    // Items count
-    stream->WriteInt32(entries.Count());
+StringView AssetsCache::ToIndexPath(const StringView& path) const
+{
+    // Cooked cache stores paths relative to the startup folder
+    const String& startupFolder = Globals::StartupFolder;
+    if (EnumHasAnyFlags(_indexFlags, AssetsCacheFlags::RelativePaths) && path.Length() > startupFolder.Length() + 1 && path.StartsWith(startupFolder) && path[startupFolder.Length()] == '/')
+        return path.Substring(startupFolder.Length() + 1);
+    return path;
+}
 
-    // Data
-    int32 index = 0;
-    for (auto i = entries.Begin(); i.IsNotEnd(); ++i)
+void AssetsCache::ReadIndexString(int32 offset, String& result) const
+{
+    const IndexHeader& header = GetIndexHeader(_index);
+    const byte* strings = GetIndexStrings(_index);
+    int32 length = 0;
+    if (offset >= 0 && offset + (int32)sizeof(int32) <= header.StringsSize)
+        length = *(const int32*)(strings + offset);
+    if (length <= 0 || offset + sizeof(int32) + (uint64)length * sizeof(Char) > (uint64)header.StringsSize)
     {
-        auto& e = i->Value;
-        stream->Write(e.Info.ID);
-        stream->WriteString(e.Info.TypeName, index - 13);
-        stream->WriteString(e.Info.Path, index);
+        result.Clear();
+        return;
+    }
+    result.ReserveSpace(length);
+    const Char* src = (const Char*)(strings + offset + sizeof(int32));
+    Char* dst = result.Get();
+    for (int32 i = 0; i < length; i++)
+        dst[i] = src[i] ^ ASSETS_CACHE_STRING_LOCK;
+}
+
+void AssetsCache::LoadIndexEntry(int32 index)
+{
+    _indexVisited.Set(index, true);
+    _indexPending--;
+    const IndexEntry& src = GetIndexEntries(_index)[index];
+    if (_registry.ContainsKey(src.ID))
+        return; // Already registered with the newer info
+
+    Entry e;
+    e.Info.ID = src.ID;
+    ReadIndexString(src.TypeName, e.Info.TypeName);
+    ReadIndexString(src.Path, e.Info.Path);
 #if ENABLE_ASSETS_DISCOVERY
-        stream->Write(e.FileModified);
-#else
-        stream->WriteInt64(0);
+    e.FileModified = DateTime(src.FileModified);
 #endif
-        index++;
+    if (EnumHasAnyFlags(_indexFlags, AssetsCacheFlags::RelativePaths) && e.Info.Path.HasChars())
+    {
+        // Convert to absolute path
+        e.Info.Path = Globals::StartupFolder / e.Info.Path;
     }
 
-    // Paths mapping
-    index = 0;
-    stream->WriteInt32(pathsMapping.Count());
-    for (auto i = pathsMapping.Begin(); i.IsNotEnd(); ++i)
+    // Use only valid entries
+    if (IsEntryValid(e))
+        _registry.Add(e.Info.ID, e);
+}
+
+void AssetsCache::LoadIndexEntries(const Guid& id)
+{
+    if (_indexPending == 0)
+        return;
+    const IndexEntry* entries = GetIndexEntries(_index);
+    int32 low = 0, high = GetIndexHeader(_index).EntriesCount - 1;
+    while (low <= high)
     {
-        stream->Write(i->Value);
-        stream->WriteString(i->Key, index + 73);
-        index++;
+        const int32 mid = (low + high) / 2;
+        const int32 compare = CompareIds(entries[mid].ID, id);
+        if (compare == 0)
+        {
+            if (!_indexVisited.Get(mid))
+                LoadIndexEntry(mid);
+            return;
+        }
+        if (compare < 0)
+            low = mid + 1;
+        else
+            high = mid - 1;
     }
+}
 
-    // Cleanup
-    stream->Flush();
-    Delete(stream);
+void AssetsCache::LoadIndexEntries(const StringView& path)
+{
+    if (_indexPending == 0)
+        return;
+    const StringView indexPath = ToIndexPath(path);
+    const uint32 hash = GetHash(indexPath);
+    const IndexEntry* entries = GetIndexEntries(_index);
+    const IndexPath* paths = GetIndexPaths(_index);
+    const int32 count = GetIndexHeader(_index).EntriesCount;
+    String entryPath;
+    for (int32 i = FindFirstHash(paths, count, hash); i < count && paths[i].Hash == hash; i++)
+    {
+        const int32 index = paths[i].Index;
+        if (index < 0 || index >= count || _indexVisited.Get(index))
+            continue;
+        ReadIndexString(entries[index].Path, entryPath);
+        if (entryPath == indexPath)
+            LoadIndexEntry(index);
+    }
+}
 
+bool AssetsCache::FindIndexMapping(const StringView& path, Guid& id) const
+{
+    if (!_indexMappingsPending)
+        return _pathsMapping.TryGet(path, id);
+    const StringView indexPath = ToIndexPath(path);
+    const uint32 hash = GetHash(indexPath);
+    const IndexMapping* mappings = GetIndexMappings(_index);
+    const int32 count = GetIndexHeader(_index).MappingsCount;
+    String mappingPath;
+    for (int32 i = FindFirstHash(mappings, count, hash); i < count && mappings[i].Hash == hash; i++)
+    {
+        ReadIndexString(mappings[i].Path, mappingPath);
+        if (mappingPath == indexPath)
+        {
+            id = mappings[i].ID;
+            return true;
+        }
+    }
     return false;
 }
 
+void AssetsCache::LoadIndexMappings()
+{
+    if (!_indexMappingsPending)
+        return;
+    _indexMappingsPending = false;
+    const IndexMapping* mappings = GetIndexMappings(_index);
+    const int32 count = GetIndexHeader(_index).MappingsCount;
+    _pathsMapping.EnsureCapacity(_pathsMapping.Count() + count);
+    String mappedPath;
+    for (int32 i = 0; i < count; i++)
+    {
+        ReadIndexString(mappings[i].Path, mappedPath);
+        if (EnumHasAnyFlags(_indexFlags, AssetsCacheFlags::RelativePaths) && mappedPath.HasChars())
+        {
+            // Convert to absolute path
+            mappedPath = Globals::StartupFolder / mappedPath;
+        }
+        _pathsMapping[mappedPath] = mappings[i].ID;
+    }
+}
+
+void AssetsCache::LoadIndex()
+{
+    if (!_index)
+        return;
+    PROFILE_CPU();
+    const int32 count = GetIndexHeader(_index).EntriesCount;
+    _registry.EnsureCapacity(_registry.Count() + _indexPending);
+    for (int32 i = 0; i < count && _indexPending != 0; i++)
+    {
+        if (!_indexVisited.Get(i))
+            LoadIndexEntry(i);
+    }
+    LoadIndexMappings();
+    ReleaseIndex();
+}
+
+void AssetsCache::ReleaseIndex()
+{
+    if (_indexMapped)
+        File::Unmap(_index, _indexSize);
+    _indexBuffer.Resize(0);
+    _index = nullptr;
+    _indexSize = 0;
+    _indexMapped = false;
+    _indexMappingsPending = false;
+    _indexFlags = AssetsCacheFlags::None;
+    _indexVisited.Resize(0);
+    _indexPending = 0;
+}
+
 const String& AssetsCache::GetEditorAssetPath(const Guid& id) const
 {
     ScopeLock lock(_locker);
 #if USE_EDITOR
+    const_cast<AssetsCache*>(this)->LoadIndexEntries(id);
     auto e = _registry.TryGet(id);
     return e ? e->Info.Path : String::Empty;
 #else
+    const_cast<AssetsCache*>(this)->LoadIndexMappings();
     for (auto& e : _pathsMapping)
     {
         if (e.Value == id)
@@ -248,7 +544,7 @@ bool AssetsCache::FindAsset(const StringView& path, AssetInfo& info)
 
     // Check if asset has direct mapping to id (used for some cooked assets)
     Guid id;
-    if (_pathsMapping.TryGet(path, id))
+    if (FindIndexMapping(path, id))
     {
         return FindAsset(id, info);
     }
@@ -257,7 +553,7 @@ bool AssetsCache::FindAsset(const StringView& path, AssetInfo& info)
     {
         // Additional check if user provides path relative to the project folder (eg. Content/SomeAssets/MyFile.json)
         const String absolutePath = Globals::ProjectFolder / *path;
-        if (_pathsMapping.TryGet(absolutePath, id))
+        if (FindIndexMapping(absolutePath, id))
         {
             return FindAsset(id, info);
         }
@@ -265,6 +561,7 @@ bool AssetsCache::FindAsset(const StringView& path, AssetInfo& info)
 #endif
 
     // Find asset in registry
+    LoadIndexEntries(path);
     for (auto i = _registry.Begin(); i.IsNotEnd(); ++i)
     {
         auto& e = i->Value;
@@ -294,6 +591,7 @@ bool AssetsCache::FindAsset(const Guid& id, AssetInfo& info)
     PROFILE_CPU();
     bool result = false;
     ScopeLock lock(_locker);
+    LoadIndexEntries(id);
     auto e = _registry.TryGet(id);
     if (e != nullptr)
     {
@@ -316,6 +614,7 @@ void AssetsCache::GetAll(Array<Guid>& result) const
 {
     PROFILE_CPU();
     ScopeLock lock(_locker);
+    const_cast<AssetsCache*>(this)->LoadIndex();
     _registry.GetKeys(result);
 }
 
@@ -323,6 +622,7 @@ void AssetsCache::GetAllByTypeName(const StringView& typeName, Array<Guid>& resu
 {
     PROFILE_CPU();
     ScopeLock lock(_locker);
+    const_cast<AssetsCache*>(this)->LoadIndex();
     for (auto i = _registry.Begin(); i.IsNotEnd(); ++i)
     {
         if (i->Value.Info.TypeName == typeName)
@@ -343,6 +643,11 @@ void AssetsCache::RegisterAssets(FlaxStorage* storage)
 
     ScopeLock lock(_locker);
     auto storagePath = storage->GetPath();
+#if PLATFORM_WINDOWS
+    LoadIndex(); // Paths comparison ignores the case so registry has to be complete
+#else
+    LoadIndexEntries(storagePath);
+#endif
 
     // Remove all old entries from that location
     for (auto i = _registry.Begin(); i.IsNotEnd(); ++i)
@@ -440,6 +745,8 @@ void AssetsCache::RegisterAsset(const Guid& id, const String& typeName, const St
 {
     PROFILE_CPU();
     ScopeLock lock(_locker);
+    LoadIndexEntries(id);
+    LoadIndexEntries(path);
 
     // Check if asset has been already added to the registry
     bool isMissing = true;
@@ -492,6 +799,7 @@ bool AssetsCache::DeleteAsset(const StringView& path, AssetInfo* info)
 {
     bool result = false;
     _locker.Lock();
+    LoadIndexEntries(path);
 
     for (auto i = _registry.Begin(); i.IsNotEnd(); ++i)
     {
@@ -514,6 +822,7 @@ bool AssetsCache::DeleteAsset(const Guid& id, AssetInfo* info)
 {
     bool result = false;
     _locker.Lock();
+    LoadIndexEntries(id);
 
     const auto e = _registry.TryGet(id);
     if (e != nullptr)
@@ -533,6 +842,7 @@ bool AssetsCache::RenameAsset(const StringView& oldPath, const StringView& newPa
 {
     bool result = false;
     _locker.Lock();
+    LoadIndexEntries(oldPath);
 
     for (auto i = _registry.Begin(); i.IsNotEnd(); ++i)
     {
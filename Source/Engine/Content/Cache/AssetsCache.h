@@ -10,6 +10,8 @@
 #endif
 #include "Engine/Core/Types/String.h"
 #include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Core/Collections/BitArray.h"
 #include "Engine/Platform/CriticalSection.h"
 
 struct AssetHeader;
@@ -35,7 +37,7 @@ enum class AssetsCacheFlags
 DECLARE_ENUM_OPERATORS(AssetsCacheFlags);
 
 /// <summary>
-/// Flax Game Engine assets cache container
+/// Flax Game Engine assets cache container. The cache file is a binary index (entries sorted by ID and hashed paths) that is memory-mapped and queried in place, so the entries are materialized into the registry only when accessed and the startup time doesn't scale with the amount of assets.
 /// </summary>
 class FLAXENGINE_API AssetsCache
 {
@@ -80,14 +82,29 @@ class FLAXENGINE_API AssetsCache
     PathsMapping _pathsMapping;
     String _path;
 
+    // The read-only index loaded from the cache file (mapped or read into the buffer), released once all entries get materialized
+    const byte* _index = nullptr;
+    uint64 _indexSize = 0;
+    bool _indexMapped = false;
+    bool _indexMappingsPending = false;
+    AssetsCacheFlags _indexFlags = AssetsCacheFlags::None;
+    Array<byte> _indexBuffer;
+    BitArray<> _indexVisited;
+    int32 _indexPending = 0;
+
 public:
     /// <summary>
-    /// Gets amount of registered assets.
+    /// Finalizes an instance of the <see cref="AssetsCache"/> class.
+    /// </summary>
+    ~AssetsCache();
+
+    /// <summary>
+    /// Gets amount of registered assets (including not yet validated entries from the cache file).
     /// </summary>
     int32 Size() const
     {
         _locker.Lock();
-        const int32 result = _registry.Count();
+        const int32 result = _registry.Count() + _indexPending;
         _locker.Unlock();
         return result;
     }
@@ -230,4 +247,15 @@ class FLAXENGINE_API AssetsCache
     /// <param name="e">The asset entry.</param>
     /// <returns>True if is valid, otherwise false.</returns>
     bool IsEntryValid(Entry& e);
+
+private:
+    StringView ToIndexPath(const StringView& path) const;
+    void ReadIndexString(int32 offset, String& result) const;
+    void LoadIndexEntry(int32 index);
+    void LoadIndexEntries(const Guid& id);
+    void LoadIndexEntries(const StringView& path);
+    bool FindIndexMapping(const StringView& path, Guid& id) const;
+    void LoadIndexMappings();
+    void LoadIndex();
+    void ReleaseIndex();
 };
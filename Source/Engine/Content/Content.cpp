@@ -3,6 +3,7 @@
 #include "Content.h"
 #include "JsonAsset.h"
 #include "SceneReference.h"
+#include "ContentPrefetch.h"
 #include "Engine/Serialization/Serialization.h"
 #include "Cache/AssetsCache.h"
 #include "Storage/ContentStorageManager.h"
@@ -18,6 +19,7 @@
 #include "Engine/Graphics/Graphics.h"
 #include "Engine/Engine/Time.h"
 #include "Engine/Engine/Globals.h"
+#include "Engine/Engine/StartupTrace.h"
 #include "Engine/Level/Types.h"
 #include "Engine/Profiler/ProfilerCPU.h"
 #include "Engine/Scripting/ManagedCLR/MClass.h"
@@ -53,7 +55,7 @@ void FLAXENGINE_API Serialization::Deserialize(ISerializable::DeserializeStream&
 namespace
 {
     // Assets
-    CriticalSection AssetsLocker;
+    CriticalSection AssetsLocker("Content.Assets");
     Dictionary<Guid, Asset*> Assets(2048);
     Array<Guid> LoadCallAssets(PLATFORM_THREADS_LIMIT);
     CriticalSection LoadedAssetsToInvokeLocker;
@@ -97,6 +99,7 @@ ContentService ContentServiceInstance;
 bool ContentService::Init()
 {
     // Load assets registry
+    STARTUP_TRACE_SCOPE("Assets Cache");
     Cache.Init();
 
     return false;
@@ -957,6 +960,7 @@ Asset* Content::LoadAsync(const Guid& id, const ScriptingTypeHandle& type)
 {
     if (!id.IsValid())
         return nullptr;
+    ContentPrefetch::OnAssetAccess(id);
 
     // Check if asset has been already loaded
     Asset* result = nullptr;
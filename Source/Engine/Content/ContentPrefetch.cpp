@@ -0,0 +1,187 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "ContentPrefetch.h"
+#include "Content.h"
+#include "AssetReference.h"
+#include "Loading/ContentLoadingManager.h"
+#include "Engine/Core/Log.h"
+#include "Engine/Core/Collections/HashSet.h"
+#include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Engine/EngineService.h"
+#include "Engine/Engine/Globals.h"
+#include "Engine/Platform/CriticalSection.h"
+#include "Engine/Platform/FileSystem.h"
+#include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Serialization/FileReadStream.h"
+#include "Engine/Serialization/FileWriteStream.h"
+
+#define CONTENT_PREFETCH_MANIFEST_VERSION 1
+
+namespace
+{
+    CriticalSection Locker;
+    volatile int64 IsRecording = 0;
+    Guid RecordingScene;
+    Array<Guid> RecordedAssets;
+    HashSet<Guid> RecordedAssetsSet;
+    Dictionary<Guid, Array<AssetReference<Asset>>> PrefetchedAssets;
+
+    void FlushRecording()
+    {
+        // Note: call with Locker acquired
+        if (Platform::AtomicRead(&IsRecording) == 0)
+            return;
+        Platform::AtomicStore(&IsRecording, 0);
+        if (RecordedAssets.HasItems())
+            ContentPrefetch::SaveManifest(RecordingScene, RecordedAssets);
+        RecordingScene = Guid::Empty;
+        RecordedAssets.Clear();
+        RecordedAssetsSet.Clear();
+    }
+}
+
+class ContentPrefetchService : public EngineService
+{
+public:
+    ContentPrefetchService()
+        : EngineService(TEXT("Content Prefetch"), -590)
+    {
+    }
+
+    void Update() override;
+    void Dispose() override;
+};
+
+ContentPrefetchService ContentPrefetchServiceInstance;
+
+#if USE_EDITOR
+bool ContentPrefetch::EnableRecording = true;
+#else
+bool ContentPrefetch::EnableRecording = false;
+#endif
+bool ContentPrefetch::EnablePrefetch = true;
+
+void ContentPrefetch::BeginRecording(const Guid& sceneId)
+{
+    ScopeLock lock(Locker);
+    FlushRecording();
+    RecordingScene = sceneId;
+    Platform::AtomicStore(&IsRecording, 1);
+}
+
+void ContentPrefetch::EndRecording()
+{
+    ScopeLock lock(Locker);
+    FlushRecording();
+}
+
+String ContentPrefetch::GetManifestPath(const Guid& sceneId)
+{
+#if USE_EDITOR
+    const String& folder = Globals::ProjectCacheFolder;
+#else
+    const String& folder = Globals::ProjectContentFolder;
+#endif
+    return folder / TEXT("Prefetch") / sceneId.ToString(Guid::FormatType::N) + TEXT(".bin");
+}
+
+bool ContentPrefetch::LoadManifest(const Guid& sceneId, Array<Guid>& assets)
+{
+    const String path = GetManifestPath(sceneId);
+    if (!FileSystem::FileExists(path))
+        return true;
+    auto stream = FileReadStream::Open(path);
+    if (!stream)
+        return true;
+    int32 version;
+    stream->ReadInt32(&version);
+    if (version == CONTENT_PREFETCH_MANIFEST_VERSION)
+        stream->ReadArray(&assets);
+    const bool failed = version != CONTENT_PREFETCH_MANIFEST_VERSION || stream->HasError();
+    Delete(stream);
+    return failed;
+}
+
+bool ContentPrefetch::SaveManifest(const Guid& sceneId, const Array<Guid>& assets)
+{
+    return SaveManifest(GetManifestPath(sceneId), assets);
+}
+
+bool ContentPrefetch::SaveManifest(const StringView& path, const Array<Guid>& assets)
+{
+    const String folder = StringUtils::GetDirectoryName(path);
+    if (!FileSystem::DirectoryExists(folder) && FileSystem::CreateDirectory(folder))
+        return true;
+    auto stream = FileWriteStream::Open(path);
+    if (!stream)
+        return true;
+    stream->WriteInt32(CONTENT_PREFETCH_MANIFEST_VERSION);
+    stream->WriteArray(assets);
+    const bool failed = stream->HasError();
+    Delete(stream);
+    return failed;
+}
+
+int32 ContentPrefetch::PrefetchScene(const Guid& sceneId)
+{
+    if (!EnablePrefetch)
+        return 0;
+    PROFILE_CPU();
+    Array<Guid> assets;
+    if (LoadManifest(sceneId, assets))
+        return 0;
+
+    // Start loading all assets at once (loading threads process them in parallel)
+    Array<AssetReference<Asset>> prefetched;
+    prefetched.EnsureCapacity(assets.Count());
+    AssetInfo info;
+    for (const Guid& id : assets)
+    {
+        if (!Content::GetAssetInfo(id, info))
+            continue; // Asset could be removed since the manifest was recorded
+        Asset* asset = Content::LoadAsync(id, ScriptingTypeHandle());
+        if (asset)
+            prefetched.Add(asset);
+    }
+    const int32 count = prefetched.Count();
+    LOG(Info, "Prefetching {0} assets for scene {1}", count, sceneId);
+
+    ScopeLock lock(Locker);
+    PrefetchedAssets[sceneId] = MoveTemp(prefetched);
+    return count;
+}
+
+void ContentPrefetch::ReleasePrefetched(const Guid& sceneId)
+{
+    ScopeLock lock(Locker);
+    PrefetchedAssets.Remove(sceneId);
+}
+
+void ContentPrefetch::OnAssetAccess(const Guid& id)
+{
+    if (Platform::AtomicRead(&IsRecording) == 0)
+        return;
+    ScopeLock lock(Locker);
+    if (Platform::AtomicRead(&IsRecording) != 0 && !RecordedAssetsSet.Contains(id))
+    {
+        RecordedAssetsSet.Add(id);
+        RecordedAssets.Add(id);
+    }
+}
+
+void ContentPrefetchService::Update()
+{
+    // End recording once all the scene assets (and their dependencies) got loaded
+    if (Platform::AtomicRead(&IsRecording) != 0 && ContentLoadingManager::GetTasksCount() == 0 && Content::GetStats().LoadingAssetsCount == 0)
+    {
+        ScopeLock lock(Locker);
+        FlushRecording();
+    }
+}
+
+void ContentPrefetchService::Dispose()
+{
+    ScopeLock lock(Locker);
+    FlushRecording();
+    PrefetchedAssets.Clear();
+}
@@ -0,0 +1,86 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Scripting/ScriptingType.h"
+#include "Engine/Core/Types/Guid.h"
+#include "Engine/Core/Collections/Array.h"
+
+/// <summary>
+/// Records the assets accessed when loading a scene into the manifest and uses it to start loading all of them up front next time the scene gets loaded (instead of discovering assets one by one while loading their dependencies).
+/// </summary>
+/// <remarks>Manifests are saved into the project cache in Editor (recorded in play mode) and deployed with the cooked game.</remarks>
+API_CLASS(Static) class FLAXENGINE_API ContentPrefetch
+{
+    DECLARE_SCRIPTING_TYPE_MINIMAL(ContentPrefetch);
+
+    /// <summary>
+    /// If checked, the scene loading records the accessed assets into the scene manifest. Enabled by default in Editor.
+    /// </summary>
+    API_FIELD() static bool EnableRecording;
+
+    /// <summary>
+    /// If checked, the scene loading starts loading all the assets from the scene manifest (if exists).
+    /// </summary>
+    API_FIELD() static bool EnablePrefetch;
+
+public:
+    /// <summary>
+    /// Starts recording the assets accessed for the scene. Recording ends once the content loading goes idle (or when calling EndRecording) and saves the scene manifest.
+    /// </summary>
+    /// <param name="sceneId">The scene asset identifier.</param>
+    API_FUNCTION() static void BeginRecording(const Guid& sceneId);
+
+    /// <summary>
+    /// Ends the active recording and saves the scene manifest.
+    /// </summary>
+    API_FUNCTION() static void EndRecording();
+
+    /// <summary>
+    /// Gets the path of the manifest file for the scene.
+    /// </summary>
+    /// <param name="sceneId">The scene asset identifier.</param>
+    /// <returns>The manifest file path.</returns>
+    API_FUNCTION() static String GetManifestPath(const Guid& sceneId);
+
+    /// <summary>
+    /// Loads the scene manifest.
+    /// </summary>
+    /// <param name="sceneId">The scene asset identifier.</param>
+    /// <param name="assets">The output list of assets (in the order of the first access).</param>
+    /// <returns>True if failed or manifest is missing, otherwise false.</returns>
+    API_FUNCTION() static bool LoadManifest(const Guid& sceneId, API_PARAM(Out) Array<Guid, HeapAllocation>& assets);
+
+    /// <summary>
+    /// Saves the scene manifest.
+    /// </summary>
+    /// <param name="sceneId">The scene asset identifier.</param>
+    /// <param name="assets">The list of assets (in the order of the first access).</param>
+    /// <returns>True if failed, otherwise false.</returns>
+    API_FUNCTION() static bool SaveManifest(const Guid& sceneId, const Array<Guid, HeapAllocation>& assets);
+
+    /// <summary>
+    /// Starts loading all the assets from the scene manifest. Assets are kept referenced (to not be unloaded before the scene uses them) until ReleasePrefetched.
+    /// </summary>
+    /// <param name="sceneId">The scene asset identifier.</param>
+    /// <returns>The amount of prefetched assets.</returns>
+    API_FUNCTION() static int32 PrefetchScene(const Guid& sceneId);
+
+    /// <summary>
+    /// Releases the references to the assets prefetched for the scene.
+    /// </summary>
+    /// <param name="sceneId">The scene asset identifier.</param>
+    API_FUNCTION() static void ReleasePrefetched(const Guid& sceneId);
+
+public:
+    /// <summary>
+    /// Saves the manifest file.
+    /// </summary>
+    /// <param name="path">The manifest file path.</param>
+    /// <param name="assets">The list of assets (in the order of the first access).</param>
+    /// <returns>True if failed, otherwise false.</returns>
+    static bool SaveManifest(const StringView& path, const Array<Guid, HeapAllocation>& assets);
+
+    // Called by the content when loading the asset.
+    static void OnAssetAccess(const Guid& id);
+};
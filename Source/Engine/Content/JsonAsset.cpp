@@ -14,6 +14,7 @@
 #include "Engine/Core/Log.h"
 #include "Engine/Core/Config/Settings.h"
 #include "Engine/Serialization/JsonTools.h"
+#include "Engine/Serialization/JsonBinary.h"
 #include "Engine/Serialization/JsonWriters.h"
 #include "Engine/Content/Factories/JsonAssetFactory.h"
 #include "Engine/Core/Cache.h"
@@ -241,6 +242,7 @@ Asset::LoadResult JsonAssetBase::loadAsset()
     {
         return LoadResult::MissingDataChunk;
     }
+    const bool referenceData = false;
 #else
     // Get the asset storage container but don't load it now
     const auto storage = ContentStorageManager::GetStorage(_path, true);
@@ -259,17 +261,37 @@ Asset::LoadResult JsonAssetBase::loadAsset()
     if (storage->LoadAssetChunk(chunk))
         return LoadResult::CannotLoadData;
     auto& data = chunk->Data;
+
+    // Reference the strings in the memory-mapped package instead of copying them (pages are shared with the other processes that load the same content)
+    const bool referenceData = storage->IsChunkMapped(chunk) && JsonBinary::IsBinary(data.Get(), data.Length());
+    if (referenceData)
+    {
+        storage->AddMappingRef();
+        _mappedStorage = storage;
+    }
 #endif
 
-    // Parse json document
+    // Parse json document (cooked assets use binary format)
+    if (JsonBinary::IsBinary(data.Get(), data.Length()))
     {
-        PROFILE_CPU_NAMED("Json.Parse");
-        Document.Parse(data.Get<char>(), data.Length());
+        PROFILE_CPU_NAMED("Json.ReadBinary");
+        if (JsonBinary::Read(data.Get(), data.Length(), Document, !referenceData))
+        {
+            LOG(Warning, "Invalid binary json data. {0}", ToString());
+            return LoadResult::InvalidData;
+        }
     }
-    if (Document.HasParseError())
+    else
     {
-        Log::JsonParseException(Document.GetParseError(), Document.GetErrorOffset());
-        return LoadResult::CannotLoadData;
+        {
+            PROFILE_CPU_NAMED("Json.Parse");
+            Document.Parse(data.Get<char>(), data.Length());
+        }
+        if (Document.HasParseError())
+        {
+            Log::JsonParseException(Document.GetParseError(), Document.GetErrorOffset());
+            return LoadResult::CannotLoadData;
+        }
     }
 
     // Gather information from the header
@@ -294,9 +316,18 @@ Asset::LoadResult JsonAssetBase::loadAsset()
 
 void JsonAssetBase::unload(bool isReloading)
 {
-    ISerializable::SerializeDocument tmp;
-    Document.Swap(tmp);
+    {
+        ISerializable::SerializeDocument tmp;
+        Document.Swap(tmp);
+    }
     Data = nullptr;
+#if !USE_EDITOR
+    if (_mappedStorage)
+    {
+        _mappedStorage->RemoveMappingRef();
+        _mappedStorage = nullptr;
+    }
+#endif
     DataTypeName.Clear();
     DataEngineBuild = 0;
     _isVirtualDocument = false;
@@ -474,7 +505,7 @@ void JsonAsset::DeleteInstance()
     }
     else
     {
-        Delete((ScriptingObject*)Instance);
+        ScriptingObjectsPool::Delete((ScriptingObject*)Instance);
     }
     InstanceType = ScriptingTypeHandle();
     Instance = nullptr;
@@ -5,6 +5,9 @@
 #include "Asset.h"
 #include "Engine/Core/ISerializable.h"
 #include "Engine/Serialization/Json.h"
+#if !USE_EDITOR
+#include "Storage/FlaxStorageReference.h"
+#endif
 
 /// <summary>
 /// Base class for all Json-format assets.
@@ -16,6 +19,9 @@ API_CLASS(Abstract, NoSpawn) class FLAXENGINE_API JsonAssetBase : public Asset
 protected:
     String _path;
     bool _isVirtualDocument = false;
+#if !USE_EDITOR
+    FlaxStorageReference _mappedStorage = nullptr; // Package with the memory-mapped file pinned while the document strings reference it
+#endif
 
 protected:
     /// <summary>
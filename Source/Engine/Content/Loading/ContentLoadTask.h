@@ -7,6 +7,29 @@
 class Asset;
 class LoadingThread;
 
+/// <summary>
+/// The content loading tasks priorities. Queued tasks with higher priority are executed first.
+/// </summary>
+enum class ContentLoadPriority
+{
+    /// <summary>
+    /// The streaming and prefetching requests (eg. texture mips or model LODs).
+    /// </summary>
+    Background = 0,
+
+    /// <summary>
+    /// The regular loading (eg. assets used by the scene objects).
+    /// </summary>
+    Normal = 1,
+
+    /// <summary>
+    /// The loading that blocks other thread (eg. waiting for the asset to be loaded).
+    /// </summary>
+    High = 2,
+
+    MAX
+};
+
 /// <summary>
 /// Describes content loading task object.
 /// </summary>
@@ -20,6 +43,26 @@ class ContentLoadTask : public Task
     /// </summary>
     DECLARE_ENUM_5(Result, Ok, AssetLoadError, MissingReferences, LoadDataError, TaskFailed);
 
+public:
+    /// <summary>
+    /// The task priority. Can be modified before starting the task (use Promote for the queued tasks).
+    /// </summary>
+    ContentLoadPriority Priority = ContentLoadPriority::Normal;
+
+    /// <summary>
+    /// Raises the priority of the task (and its content loading continuations). Queued task is moved to the higher priority queue.
+    /// </summary>
+    /// <param name="priority">The priority to use.</param>
+    void Promote(ContentLoadPriority priority);
+
+    /// <summary>
+    /// Checks if the task target has been released before running it (eg. asset has been unloaded). Obsolete tasks are cancelled instead of being executed.
+    /// </summary>
+    virtual bool IsObsolete() const
+    {
+        return false;
+    }
+
 protected:
     virtual Result run() = 0;
 
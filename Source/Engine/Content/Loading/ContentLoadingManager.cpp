@@ -7,11 +7,11 @@
 #include "Engine/Core/Collections/Array.h"
 #include "Engine/Platform/CPUInfo.h"
 #include "Engine/Platform/Thread.h"
-#include "Engine/Platform/ConditionVariable.h"
 #include "Engine/Content/Config.h"
 #include "Engine/Engine/EngineService.h"
 #include "Engine/Threading/Threading.h"
-#include "Engine/Threading/ConcurrentTaskQueue.h"
+#include "Engine/Platform/ConditionVariable.h"
+#include "Engine/Profiler/ProfilerMemory.h"
 #if USE_EDITOR && PLATFORM_WINDOWS
 #include "Engine/Platform/Win32/IncludeWindowsHeaders.h"
 #include <propidlbase.h>
@@ -22,9 +22,18 @@ namespace ContentLoadingManagerImpl
     THREADLOCAL LoadingThread* ThisThread = nullptr;
     LoadingThread* MainThread = nullptr;
     Array<LoadingThread*> Threads;
-    ConcurrentTaskQueue<ContentLoadTask> Tasks;
+
+    // Queued tasks per priority (FIFO order within the same priority)
+    CriticalSection TasksLocker;
     ConditionVariable TasksSignal;
-    CriticalSection TasksMutex;
+    Array<ContentLoadTask*> Tasks[(int32)ContentLoadPriority::MAX];
+    volatile int64 TasksCount = 0;
+
+    bool TryDequeueTask(ContentLoadTask*& task);
+    bool DequeueTask(ContentLoadTask*& task, const volatile int64& exitFlag);
+    bool RemoveTask(ContentLoadTask* task);
+    void NotifyAllTasks();
+    void CancelAllTasks();
 };
 
 using namespace ContentLoadingManagerImpl;
@@ -95,6 +104,7 @@ bool LoadingThread::Start(const String& name)
 void LoadingThread::Run(ContentLoadTask* job)
 {
     ASSERT(job);
+    PROFILE_MEM(Content);
 
     job->Execute();
     _totalTasksDoneCount++;
@@ -123,18 +133,13 @@ int32 LoadingThread::Run()
     ContentLoadTask* task;
     ThisThread = this;
 
-    while (HasExitFlagClear())
+    while (DequeueTask(task, _exitFlag))
     {
-        if (Tasks.try_dequeue(task))
-        {
-            Run(task);
-        }
+        // Skip loading if nothing needs it anymore
+        if (task->IsObsolete())
+            task->Cancel();
         else
-        {
-            TasksMutex.Lock();
-            TasksSignal.Wait(TasksMutex);
-            TasksMutex.Unlock();
-        }
+            Run(task);
     }
 
     ThisThread = nullptr;
@@ -155,7 +160,65 @@ LoadingThread* ContentLoadingManager::GetCurrentLoadThread()
 
 int32 ContentLoadingManager::GetTasksCount()
 {
-    return Tasks.Count();
+    return (int32)Platform::AtomicRead(&TasksCount);
+}
+
+bool ContentLoadingManagerImpl::TryDequeueTask(ContentLoadTask*& task)
+{
+    ScopeLock lock(TasksLocker);
+    for (int32 i = (int32)ContentLoadPriority::MAX - 1; i >= 0; i--)
+    {
+        auto& queue = Tasks[i];
+        if (queue.HasItems())
+        {
+            task = queue[0];
+            queue.RemoveAtKeepOrder(0);
+            Platform::InterlockedDecrement(&TasksCount);
+            return true;
+        }
+    }
+    return false;
+}
+
+bool ContentLoadingManagerImpl::DequeueTask(ContentLoadTask*& task, const volatile int64& exitFlag)
+{
+    ScopeLock lock(TasksLocker);
+    while (Platform::AtomicRead(&exitFlag) == 0)
+    {
+        if (TryDequeueTask(task))
+            return true;
+        TasksSignal.Wait(TasksLocker);
+    }
+    return false;
+}
+
+bool ContentLoadingManagerImpl::RemoveTask(ContentLoadTask* task)
+{
+    ScopeLock lock(TasksLocker);
+    for (auto& queue : Tasks)
+    {
+        const int32 index = queue.Find(task);
+        if (index != -1)
+        {
+            queue.RemoveAtKeepOrder(index);
+            Platform::InterlockedDecrement(&TasksCount);
+            return true;
+        }
+    }
+    return false;
+}
+
+void ContentLoadingManagerImpl::NotifyAllTasks()
+{
+    ScopeLock lock(TasksLocker);
+    TasksSignal.NotifyAll();
+}
+
+void ContentLoadingManagerImpl::CancelAllTasks()
+{
+    ContentLoadTask* task;
+    while (TryDequeueTask(task))
+        task->Cancel();
 }
 
 bool ContentLoadingManagerService::Init()
@@ -191,7 +254,7 @@ void ContentLoadingManagerService::BeforeExit()
     // Signal threads to end work soon
     for (int32 i = 0; i < Threads.Count(); i++)
         Threads[i]->NotifyExit();
-    TasksSignal.NotifyAll();
+    NotifyAllTasks();
 }
 
 void ContentLoadingManagerService::Dispose()
@@ -199,7 +262,7 @@ void ContentLoadingManagerService::Dispose()
     // Exit all threads
     for (int32 i = 0; i < Threads.Count(); i++)
         Threads[i]->NotifyExit();
-    TasksSignal.NotifyAll();
+    NotifyAllTasks();
     for (int32 i = 0; i < Threads.Count(); i++)
         Threads[i]->Join();
     Threads.ClearDelete();
@@ -208,7 +271,7 @@ void ContentLoadingManagerService::Dispose()
     ThisThread = nullptr;
 
     // Cancel all remaining tasks (no chance to execute them)
-    Tasks.CancelAll();
+    CancelAllTasks();
 }
 
 String ContentLoadTask::ToString() const
@@ -216,9 +279,31 @@ String ContentLoadTask::ToString() const
     return String::Format(TEXT("Content Load Task ({})"), (int32)GetState());
 }
 
+void ContentLoadTask::Promote(ContentLoadPriority priority)
+{
+    for (Task* task = this; task; task = task->GetContinueWithTask())
+    {
+        auto contentTask = dynamic_cast<ContentLoadTask*>(task);
+        if (!contentTask)
+            break;
+        ScopeLock lock(TasksLocker);
+        if (contentTask->Priority >= priority)
+            continue;
+        contentTask->Priority = priority;
+        if (RemoveTask(contentTask))
+        {
+            // Move to the end of the higher priority queue
+            Tasks[(int32)priority].Add(contentTask);
+            Platform::InterlockedIncrement(&TasksCount);
+        }
+    }
+}
+
 void ContentLoadTask::Enqueue()
 {
-    Tasks.Add(this);
+    ScopeLock lock(TasksLocker);
+    Tasks[(int32)Priority].Add(this);
+    Platform::InterlockedIncrement(&TasksCount);
     TasksSignal.NotifyOne();
 }
 
@@ -0,0 +1,320 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "ContentLoadingTrace.h"
+#include "ContentLoadingManager.h"
+#include "Engine/Content/Asset.h"
+#include "Engine/Core/Log.h"
+#include "Engine/Core/Utilities.h"
+#include "Engine/Core/Math/Math.h"
+#include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Core/Collections/HashSet.h"
+#include "Engine/Core/Collections/Sorting.h"
+#include "Engine/Core/Types/StringBuilder.h"
+#include "Engine/Engine/CommandLine.h"
+#include "Engine/Engine/EngineService.h"
+#include "Engine/Graphics/GPUResource.h"
+#include "Engine/Platform/CriticalSection.h"
+#include "Engine/Platform/File.h"
+
+// The time (in seconds) without any loading activity after which the loading is considered finished
+#define CONTENT_LOADING_TRACE_IDLE_TIME 1.0
+// The maximum length of the dependency chain (protects against the cyclic references)
+#define CONTENT_LOADING_TRACE_MAX_CHAIN 64
+
+bool ContentLoadingTrace::Enabled = false;
+int32 ContentLoadingTrace::SummaryCount = 10;
+
+namespace
+{
+    struct Chain
+    {
+        int32 Leaf;
+        double Time;
+    };
+
+    THREADLOCAL ContentLoadingTrace::Scope* CurrentScope = nullptr;
+    CriticalSection Locker;
+    Dictionary<Guid, ContentLoadingTraceRecord> Records;
+    Array<ContentLoadingTraceRecord> LastRecords;
+    double LastActivityTime = 0.0;
+    volatile int64 ActiveScopes = 0;
+
+    ContentLoadingTraceRecord& GetRecord(const Guid& id, double time)
+    {
+        ContentLoadingTraceRecord* record = Records.TryGet(id);
+        if (!record)
+        {
+            // Loading has been requested before enabling the tracing
+            record = &Records[id];
+            record->ID = id;
+            record->QueuedTime = time;
+        }
+        return *record;
+    }
+
+    bool SortByTotalTime(const ContentLoadingTraceRecord& a, const ContentLoadingTraceRecord& b)
+    {
+        return a.GetTotalTime() + a.UploadTime > b.GetTotalTime() + b.UploadTime;
+    }
+
+    bool SortByChainTime(const Chain& a, const Chain& b)
+    {
+        return a.Time > b.Time;
+    }
+
+    String GetName(const ContentLoadingTraceRecord& record)
+    {
+        return record.Path.HasChars() ? record.Path : record.ID.ToString();
+    }
+}
+
+class ContentLoadingTraceService : public EngineService
+{
+public:
+    ContentLoadingTraceService()
+        : EngineService(TEXT("Content Loading Trace"), -490)
+    {
+    }
+
+    bool Init() override
+    {
+        if (CommandLine::Options.ContentTrace.IsTrue())
+            ContentLoadingTrace::Enabled = true;
+        return false;
+    }
+
+    void Update() override
+    {
+        if (!ContentLoadingTrace::Enabled || Records.IsEmpty())
+            return;
+
+        // Log the summary once the loading ends
+        if (ContentLoadingManager::GetTasksCount() == 0 &&
+            Platform::AtomicRead(&ActiveScopes) == 0 &&
+            Platform::GetTimeSeconds() - LastActivityTime > CONTENT_LOADING_TRACE_IDLE_TIME)
+        {
+            ContentLoadingTrace::Summary();
+        }
+    }
+};
+
+ContentLoadingTraceService ContentLoadingTraceServiceInstance;
+
+ContentLoadingTrace::Scope::Scope(const Asset* asset, bool isData)
+{
+    if (!Enabled || !asset)
+    {
+        Start = -1.0;
+        return;
+    }
+    Previous = CurrentScope;
+    ID = asset->GetID();
+    IsData = isData;
+    Start = Platform::GetTimeSeconds();
+    CurrentScope = this;
+    Platform::InterlockedIncrement(&ActiveScopes);
+}
+
+ContentLoadingTrace::Scope::~Scope()
+{
+    if (Start < 0.0)
+        return;
+    CurrentScope = Previous;
+    Platform::InterlockedDecrement(&ActiveScopes);
+    const double time = Platform::GetTimeSeconds();
+    const double elapsed = time - Start;
+    if (Previous)
+        Previous->Nested += elapsed;
+
+    // Time not spent in the timed phases (nor nested assets loading) is attributed to the scope task type
+    const double exclusive = Math::Max(elapsed - Read - Decompress - Nested, 0.0);
+
+    ScopeLock lock(Locker);
+    ContentLoadingTraceRecord& record = GetRecord(ID, Start);
+    if (record.StartTime <= 0.0)
+        record.StartTime = Start;
+    record.EndTime = Math::Max(record.EndTime, time);
+    record.ReadTime += Read + (IsData ? exclusive : 0.0);
+    record.DecompressTime += Decompress;
+    record.InitTime += IsData ? 0.0 : exclusive;
+    record.ReadBytes += ReadBytes;
+    LastActivityTime = time;
+}
+
+ContentLoadingTrace::PhaseTimer::PhaseTimer(Phase phase, uint64 bytes)
+    : Target(CurrentScope)
+    , Type(phase)
+    , Bytes(bytes)
+{
+    if (Target)
+        Start = Platform::GetTimeSeconds();
+}
+
+ContentLoadingTrace::PhaseTimer::~PhaseTimer()
+{
+    if (!Target)
+        return;
+    const double elapsed = Platform::GetTimeSeconds() - Start;
+    switch (Type)
+    {
+    case Phase::Read:
+        Target->Read += elapsed;
+        Target->ReadBytes += Bytes;
+        break;
+    case Phase::Decompress:
+        Target->Decompress += elapsed;
+        break;
+    }
+}
+
+ContentLoadingTrace::UploadTimer::UploadTimer(const GPUResource* resource, uint64 bytes)
+    : Resource(Enabled && resource && resource->GetOwnerId().IsValid() ? resource : nullptr)
+    , Bytes(bytes)
+{
+    if (Resource)
+        Start = Platform::GetTimeSeconds();
+}
+
+ContentLoadingTrace::UploadTimer::~UploadTimer()
+{
+    if (!Resource)
+        return;
+    const double time = Platform::GetTimeSeconds();
+    ScopeLock lock(Locker);
+    ContentLoadingTraceRecord* record = Records.TryGet(Resource->GetOwnerId());
+    if (record)
+    {
+        record->UploadTime += time - Start;
+        record->UploadBytes += Bytes;
+        LastActivityTime = time;
+    }
+}
+
+Array<ContentLoadingTraceRecord> ContentLoadingTrace::GetRecords()
+{
+    ScopeLock lock(Locker);
+    if (Records.IsEmpty())
+        return LastRecords;
+    Array<ContentLoadingTraceRecord> result;
+    Records.GetValues(result);
+    return result;
+}
+
+bool ContentLoadingTrace::SaveToFile(const StringView& path)
+{
+    const Array<ContentLoadingTraceRecord> records = GetRecords();
+    StringBuilder text;
+    text.Append(TEXT("ID,Parent,Path,Type,Queued,QueueWait,Read,ReadBytes,Decompress,Init,Upload,UploadBytes,Total\n"));
+    for (const ContentLoadingTraceRecord& e : records)
+    {
+        text.AppendFormat(TEXT("{0},{1},\"{2}\",{3},{4:.6f},{5:.6f},{6:.6f},{7},{8:.6f},{9:.6f},{10:.6f},{11},{12:.6f}\n"),
+                          e.ID, e.ParentID, e.Path, e.TypeName, e.QueuedTime, e.GetQueueWaitTime(), e.ReadTime, e.ReadBytes,
+                          e.DecompressTime, e.InitTime, e.UploadTime, e.UploadBytes, e.GetTotalTime());
+    }
+    return File::WriteAllText(path, text, Encoding::ANSI);
+}
+
+void ContentLoadingTrace::Summary()
+{
+    Array<ContentLoadingTraceRecord> records;
+    {
+        ScopeLock lock(Locker);
+        Records.GetValues(records);
+        Records.Clear();
+        LastRecords = records;
+    }
+    if (records.IsEmpty())
+        return;
+
+    // Totals
+    ContentLoadingTraceRecord total;
+    double queueWait = 0.0;
+    double start = MAX_double, end = 0.0;
+    for (const ContentLoadingTraceRecord& e : records)
+    {
+        start = Math::Min(start, e.QueuedTime);
+        end = Math::Max(end, e.EndTime);
+        queueWait += e.GetQueueWaitTime();
+        total.ReadTime += e.ReadTime;
+        total.ReadBytes += e.ReadBytes;
+        total.DecompressTime += e.DecompressTime;
+        total.InitTime += e.InitTime;
+        total.UploadTime += e.UploadTime;
+        total.UploadBytes += e.UploadBytes;
+    }
+    LOG(Info, "Content loading summary: {0} assets in {1:.2f} ms (summed per-asset times: queue wait {2:.2f} ms, read {3:.2f} ms ({4}), decompress {5:.2f} ms, init {6:.2f} ms, GPU upload {7:.2f} ms ({8}))",
+        records.Count(), (end - start) * 1000.0, queueWait * 1000.0, total.ReadTime * 1000.0, Utilities::BytesToText(total.ReadBytes),
+        total.DecompressTime * 1000.0, total.InitTime * 1000.0, total.UploadTime * 1000.0, Utilities::BytesToText(total.UploadBytes));
+
+    // Slowest assets
+    Sorting::QuickSort(records.Get(), records.Count(), &SortByTotalTime);
+    const int32 count = Math::Min(SummaryCount, records.Count());
+    LOG(Info, "Slowest assets:");
+    for (int32 i = 0; i < count; i++)
+    {
+        const ContentLoadingTraceRecord& e = records[i];
+        LOG(Info, "  {0:.2f} ms: {1} ({2}) - queue wait {3:.2f} ms, read {4:.2f} ms ({5}), decompress {6:.2f} ms, init {7:.2f} ms, GPU upload {8:.2f} ms ({9})",
+            (e.GetTotalTime() + e.UploadTime) * 1000.0, GetName(e), e.TypeName, e.GetQueueWaitTime() * 1000.0, e.ReadTime * 1000.0, Utilities::BytesToText(e.ReadBytes),
+            e.DecompressTime * 1000.0, e.InitTime * 1000.0, e.UploadTime * 1000.0, Utilities::BytesToText(e.UploadBytes));
+    }
+
+    // Slowest dependency chains (from the root loading request to the end of the last dependency loading)
+    Dictionary<Guid, int32> indices;
+    HashSet<Guid> parents;
+    for (int32 i = 0; i < records.Count(); i++)
+    {
+        indices[records[i].ID] = i;
+        if (records[i].ParentID.IsValid())
+            parents.Add(records[i].ParentID);
+    }
+    Array<Chain> chains;
+    for (int32 i = 0; i < records.Count(); i++)
+    {
+        const ContentLoadingTraceRecord& e = records[i];
+        if (parents.Contains(e.ID) || !indices.ContainsKey(e.ParentID))
+            continue;
+        int32 root = i;
+        int32 parent;
+        for (int32 depth = 0; depth < CONTENT_LOADING_TRACE_MAX_CHAIN && indices.TryGet(records[root].ParentID, parent); depth++)
+            root = parent;
+        chains.Add({ i, e.EndTime - records[root].QueuedTime });
+    }
+    if (chains.IsEmpty())
+        return;
+    Sorting::QuickSort(chains.Get(), chains.Count(), &SortByChainTime);
+    LOG(Info, "Slowest dependency chains:");
+    StringBuilder text;
+    Array<int32, InlinedAllocation<16>> chain;
+    for (int32 i = 0; i < Math::Min(SummaryCount, chains.Count()); i++)
+    {
+        chain.Clear();
+        int32 index = chains[i].Leaf;
+        do
+        {
+            chain.Add(index);
+        } while (chain.Count() < CONTENT_LOADING_TRACE_MAX_CHAIN && indices.TryGet(records[index].ParentID, index));
+        text.Clear();
+        for (int32 j = chain.Count() - 1; j >= 0; j--)
+        {
+            const ContentLoadingTraceRecord& e = records[chain[j]];
+            text.AppendFormat(j != 0 ? TEXT("{0} ({1:.2f} ms) -> ") : TEXT("{0} ({1:.2f} ms)"), GetName(e), e.GetTotalTime() * 1000.0);
+        }
+        LOG(Info, "  {0:.2f} ms: {1}", chains[i].Time * 1000.0, text.ToStringView());
+    }
+}
+
+void ContentLoadingTrace::OnQueued(const Asset* asset)
+{
+    if (!Enabled)
+        return;
+    const double time = Platform::GetTimeSeconds();
+    ScopeLock lock(Locker);
+    ContentLoadingTraceRecord& record = Records[asset->GetID()];
+    record = ContentLoadingTraceRecord();
+    record.ID = asset->GetID();
+    record.ParentID = CurrentScope ? CurrentScope->ID : Guid::Empty;
+    record.Path = asset->GetPath();
+    record.TypeName = asset->GetTypeName();
+    record.QueuedTime = time;
+    LastActivityTime = time;
+}
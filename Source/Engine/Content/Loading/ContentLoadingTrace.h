@@ -0,0 +1,199 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Core/Types/Guid.h"
+#include "Engine/Core/Types/String.h"
+#include "Engine/Core/Collections/Array.h"
+
+class Asset;
+class GPUResource;
+
+/// <summary>
+/// The per-asset content loading timings.
+/// </summary>
+struct ContentLoadingTraceRecord
+{
+    /// <summary>
+    /// The asset identifier.
+    /// </summary>
+    Guid ID;
+
+    /// <summary>
+    /// The asset that requested loading this asset (during its own loading). Empty if loading was requested from outside the content loading.
+    /// </summary>
+    Guid ParentID;
+
+    /// <summary>
+    /// The asset path.
+    /// </summary>
+    String Path;
+
+    /// <summary>
+    /// The asset type name.
+    /// </summary>
+    String TypeName;
+
+    /// <summary>
+    /// The time (in seconds) when the asset loading has been requested.
+    /// </summary>
+    double QueuedTime = 0.0;
+
+    /// <summary>
+    /// The time (in seconds) when the first asset loading task has started.
+    /// </summary>
+    double StartTime = 0.0;
+
+    /// <summary>
+    /// The time (in seconds) when the last asset loading task has ended.
+    /// </summary>
+    double EndTime = 0.0;
+
+    /// <summary>
+    /// The time (in seconds) spent on reading the asset data from the storage.
+    /// </summary>
+    double ReadTime = 0.0;
+
+    /// <summary>
+    /// The time (in seconds) spent on decompressing the asset data.
+    /// </summary>
+    double DecompressTime = 0.0;
+
+    /// <summary>
+    /// The time (in seconds) spent on deserializing and initializing the asset (eg. json parsing, GPU resources creation).
+    /// </summary>
+    double InitTime = 0.0;
+
+    /// <summary>
+    /// The time (in seconds) spent on uploading the asset data to the GPU by the async GPU tasks.
+    /// </summary>
+    double UploadTime = 0.0;
+
+    /// <summary>
+    /// The amount of bytes read from the storage.
+    /// </summary>
+    uint64 ReadBytes = 0;
+
+    /// <summary>
+    /// The amount of bytes uploaded to the GPU by the async GPU tasks.
+    /// </summary>
+    uint64 UploadBytes = 0;
+
+    /// <summary>
+    /// Gets the time (in seconds) the asset loading has been waiting in the queue.
+    /// </summary>
+    double GetQueueWaitTime() const
+    {
+        return StartTime > QueuedTime ? StartTime - QueuedTime : 0.0;
+    }
+
+    /// <summary>
+    /// Gets the total time (in seconds) from the loading request to the loading end (excluding the GPU upload).
+    /// </summary>
+    double GetTotalTime() const
+    {
+        return EndTime > QueuedTime ? EndTime - QueuedTime : 0.0;
+    }
+};
+
+/// <summary>
+/// Content loading timeline trace. Records per-asset timings of the loading stages (queue wait, read, decompress, init and GPU upload) and logs the summary with the slowest assets and dependency chains when the loading ends.
+/// </summary>
+/// <remarks>
+/// Can be enabled with the '-contenttrace' command line switch. Tracing has no cost when disabled.
+/// </remarks>
+class FLAXENGINE_API ContentLoadingTrace
+{
+public:
+    /// <summary>
+    /// The loading stage timed by the PhaseTimer.
+    /// </summary>
+    enum class Phase
+    {
+        Read,
+        Decompress,
+    };
+
+    /// <summary>
+    /// The asset loading task scope. Attributes the timings recorded on the current thread to the asset.
+    /// </summary>
+    struct FLAXENGINE_API Scope
+    {
+        Scope* Previous;
+        Guid ID;
+        bool IsData;
+        double Start;
+        double Read = 0.0;
+        double Decompress = 0.0;
+        double Nested = 0.0;
+        uint64 ReadBytes = 0;
+
+        /// <summary>
+        /// Starts the asset loading task scope.
+        /// </summary>
+        /// <param name="asset">The asset.</param>
+        /// <param name="isData">True if the task loads the asset data chunks (the remaining time is counted as reading), otherwise the remaining time is counted as the asset init.</param>
+        Scope(const Asset* asset, bool isData);
+        ~Scope();
+    };
+
+    /// <summary>
+    /// Times the loading stage and attributes it to the current asset loading scope (if any).
+    /// </summary>
+    struct FLAXENGINE_API PhaseTimer
+    {
+        Scope* Target;
+        Phase Type;
+        uint64 Bytes;
+        double Start;
+
+        PhaseTimer(Phase phase, uint64 bytes = 0);
+        ~PhaseTimer();
+    };
+
+    /// <summary>
+    /// Times the GPU data upload (CPU-side cost of the async GPU task) and attributes it to the asset that owns the resource (if traced).
+    /// </summary>
+    struct FLAXENGINE_API UploadTimer
+    {
+        const GPUResource* Resource;
+        uint64 Bytes;
+        double Start;
+
+        UploadTimer(const GPUResource* resource, uint64 bytes);
+        ~UploadTimer();
+    };
+
+public:
+    /// <summary>
+    /// True if content loading tracing is enabled.
+    /// </summary>
+    static bool Enabled;
+
+    /// <summary>
+    /// The amount of the slowest assets and dependency chains listed in the summary.
+    /// </summary>
+    static int32 SummaryCount;
+
+public:
+    /// <summary>
+    /// Gets the recorded assets timings of the ongoing loading (or of the last summarized loading if idle).
+    /// </summary>
+    static Array<ContentLoadingTraceRecord> GetRecords();
+
+    /// <summary>
+    /// Saves the recorded assets timings to the CSV file.
+    /// </summary>
+    /// <param name="path">The output file path.</param>
+    /// <returns>True if failed, otherwise false.</returns>
+    static bool SaveToFile(const StringView& path);
+
+    /// <summary>
+    /// Logs the summary of the recorded loading and clears the records.
+    /// </summary>
+    static void Summary();
+
+public:
+    // Called when asset loading is requested.
+    static void OnQueued(const Asset* asset);
+};
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "../ContentLoadTask.h"
+#include "../ContentLoadingTrace.h"
 #include "Engine/Core/Log.h"
 #include "Engine/Content/AssetReference.h"
 #include "Engine/Content/BinaryAsset.h"
@@ -39,6 +40,11 @@ class LoadAssetDataTask : public ContentLoadTask
         return obj == _asset;
     }
 
+    bool IsObsolete() const override
+    {
+        return _asset.Get() == nullptr;
+    }
+
 protected:
     // [ContentLoadTask]
     Result run() override
@@ -50,30 +56,35 @@ class LoadAssetDataTask : public ContentLoadTask
         AssetReference<BinaryAsset> ref = _asset.Get();
         if (ref == nullptr)
             return Result::MissingReferences;
+        ContentLoadingTrace::Scope traceScope(ref.Get(), true);
 #if TRACY_ENABLE
         const StringView name(ref->GetPath());
 #endif
 
-        // Load chunks
+        // Load chunks (in a single batch)
+        FlaxChunk* chunks[ASSET_FILE_DATA_CHUNKS];
+        int32 chunksCount = 0;
         for (int32 i = 0; i < ASSET_FILE_DATA_CHUNKS; i++)
         {
             if (GET_CHUNK_FLAG(i) & _chunks)
             {
                 const auto chunk = ref->GetChunk(i);
                 if (chunk != nullptr)
-                {
-                    if (IsCancelRequested())
-                        return Result::Ok;
+                    chunks[chunksCount++] = chunk;
+            }
+        }
+        if (chunksCount != 0)
+        {
+            if (IsCancelRequested())
+                return Result::Ok;
 #if TRACY_ENABLE
-                    ZoneScoped;
-                    ZoneName(*name, name.Length());
+            ZoneScoped;
+            ZoneName(*name, name.Length());
 #endif
-                    if (ref->Storage->LoadAssetChunk(chunk))
-                    {
-                        LOG(Warning, "Cannot load asset \'{0}\' chunk {1}.", ref->ToString(), i);
-                        return Result::LoadDataError;
-                    }
-                }
+            if (ref->Storage->LoadAssetChunks(Span<FlaxChunk*>(chunks, chunksCount)))
+            {
+                LOG(Warning, "Cannot load asset \'{0}\' data.", ref->ToString());
+                return Result::LoadDataError;
             }
         }
 
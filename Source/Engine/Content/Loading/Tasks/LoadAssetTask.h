@@ -3,6 +3,7 @@
 #pragma once
 
 #include "../ContentLoadTask.h"
+#include "../ContentLoadingTrace.h"
 #include "Engine/Content/Asset.h"
 #include "Engine/Content/AssetReference.h"
 #include "Engine/Content/WeakAssetReference.h"
@@ -50,6 +51,11 @@ class LoadAssetTask : public ContentLoadTask
         return obj == Asset;
     }
 
+    bool IsObsolete() const override
+    {
+        return Asset.Get() == nullptr;
+    }
+
 protected:
     // [ContentLoadTask]
     Result run() override
@@ -60,6 +66,7 @@ class LoadAssetTask : public ContentLoadTask
         AssetReference<::Asset> ref = Asset.Get();
         if (ref == nullptr)
             return Result::MissingReferences;
+        ContentLoadingTrace::Scope traceScope(ref.Get(), false);
 
         // Call loading
         if (ref->onLoad(this))
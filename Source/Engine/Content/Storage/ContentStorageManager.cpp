@@ -8,6 +8,7 @@
 #include "Engine/Engine/EngineService.h"
 #include "Engine/Engine/Globals.h"
 #include "Engine/Platform/FileSystem.h"
+#include "Engine/Core/Collections/Sorting.h"
 #include "Engine/Profiler/ProfilerCPU.h"
 #include "Engine/Threading/TaskGraph.h"
 #include "Engine/Threading/Threading.h"
@@ -44,14 +45,70 @@ class ContentStorageSystem : public TaskGraphSystem
     void Execute(TaskGraph* graph) override;
 };
 
+// Chunks used recently are not released by the memory budget (prevents reloading the data in use every frame)
+#define CHUNKS_BUDGET_MIN_AGE 1.0
+// Compressed chunks are more expensive to reload (decompression) so they are released as if they were used later by that amount of seconds
+#define CHUNKS_BUDGET_COMPRESSED_BIAS 5.0
+
 namespace
 {
     TaskGraphSystem* System = nullptr;
+
+    struct CachedChunk
+    {
+        FlaxStorage* Storage;
+        FlaxChunk* Chunk;
+        double Priority;
+
+        bool operator<(const CachedChunk& other) const
+        {
+            return Priority < other.Priority;
+        }
+    };
+
+    Array<FlaxChunk*> BudgetStorageChunks;
+    Array<CachedChunk> BudgetChunks;
+
+    // Releases the least recently used chunks data from all storage containers to fit into the memory budget (called within Locker)
+    void EnforceChunksBudget(double time, uint64 budget)
+    {
+        uint64 memoryUsage = 0;
+        BudgetChunks.Clear();
+        for (auto i = StorageMap.Begin(); i.IsNotEnd(); ++i)
+        {
+            FlaxStorage* storage = i->Value;
+            BudgetStorageChunks.Clear();
+            storage->GetCachedChunks(BudgetStorageChunks);
+            for (FlaxChunk* chunk : BudgetStorageChunks)
+            {
+                memoryUsage += chunk->Size();
+                if (time - chunk->LastAccessTime < CHUNKS_BUDGET_MIN_AGE)
+                    continue;
+                double priority = chunk->LastAccessTime;
+                if (EnumHasAnyFlags(chunk->Flags, FlaxChunkFlags::CompressedLZ4))
+                    priority += CHUNKS_BUDGET_COMPRESSED_BIAS;
+                BudgetChunks.Add({ storage, chunk, priority });
+            }
+        }
+        if (memoryUsage <= budget)
+            return;
+        PROFILE_CPU_NAMED("EnforceChunksBudget");
+
+        Sorting::QuickSort(BudgetChunks);
+        for (int32 i = 0; i < BudgetChunks.Count() && memoryUsage > budget; i++)
+        {
+            const CachedChunk& e = BudgetChunks[i];
+            const int32 size = e.Chunk->Size();
+            if (e.Storage->UnloadChunk(e.Chunk))
+                memoryUsage -= size;
+        }
+    }
 }
 
 ContentStorageService ContentStorageServiceInstance;
 
 TimeSpan ContentStorageManager::UnusedDataChunksLifetime = TimeSpan::FromSeconds(10);
+uint64 ContentStorageManager::ChunksMemoryBudget = 0;
 
 FlaxStorageReference ContentStorageManager::GetStorage(const StringView& path, bool loadIt)
 {
@@ -275,6 +332,11 @@ void ContentStorageSystem::Job(int32 index)
             storage->Tick(time);
         }
     }
+
+    // Limit the total memory used by the chunks from all storage containers
+    const uint64 chunksMemoryBudget = ContentStorageManager::ChunksMemoryBudget;
+    if (chunksMemoryBudget != 0)
+        EnforceChunksBudget(time, chunksMemoryBudget);
 }
 
 void ContentStorageSystem::Execute(TaskGraph* graph)
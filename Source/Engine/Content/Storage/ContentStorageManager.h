@@ -19,6 +19,11 @@ class FLAXENGINE_API ContentStorageManager
     /// </summary>
     static TimeSpan UnusedDataChunksLifetime;
 
+    /// <summary>
+    /// The memory budget (in bytes) for the loaded chunks data of all storage containers. Once exceeded the least recently used chunks get released (before reaching UnusedDataChunksLifetime), chunks locked by the assets are skipped. Use 0 to disable the limit (eg. set it on memory constrained platforms).
+    /// </summary>
+    static uint64 ChunksMemoryBudget;
+
 public:
     /// <summary>
     /// Gets the assets data storage container.
@@ -19,6 +19,21 @@ enum class FlaxChunkFlags
     /// Compress chunk data using LZ4 algorithm.
     /// </summary>
     CompressedLZ4 = 1,
+
+    /// <summary>
+    /// Compress chunk data (used with CompressedLZ4) using the dictionary shared by the chunks of the same asset type within the package. Improves compression of many small assets with similar contents (eg. json).
+    /// </summary>
+    CompressionDictionary = 2,
+
+    /// <summary>
+    /// The chunk data is streamed on demand (eg. high-resolution texture mips or high-quality model LODs). Packages place such chunks after the always-resident data to keep the assets loading reads sequential.
+    /// </summary>
+    Streamed = 4,
+
+    /// <summary>
+    /// Compress chunk data (used with CompressedLZ4) after grouping the bytes of the fixed-size data blocks by their offset within the block (eg. GPU texture compression blocks or pixels). Improves compression ratio of the structured data.
+    /// </summary>
+    ShuffledBlocks = 8,
 };
 
 DECLARE_ENUM_OPERATORS(FlaxChunkFlags);
@@ -82,6 +97,11 @@ class FLAXENGINE_API FlaxChunk
     /// </summary>
     double LastAccessTime = 0.0;
 
+    /// <summary>
+    /// The size of the data block (in bytes) used when compressing chunk with ShuffledBlocks flag.
+    /// </summary>
+    int32 ShuffleStride = 0;
+
     /// <summary>
     /// The chunk data.
     /// </summary>
@@ -6,12 +6,17 @@
 #include "ContentStorageManager.h"
 #include "Engine/Core/Log.h"
 #include "Engine/Core/Types/TimeSpan.h"
+#include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Core/Collections/Sorting.h"
 #include "Engine/Platform/File.h"
 #include "Engine/Profiler/ProfilerCPU.h"
 #include "Engine/Serialization/FileWriteStream.h"
 #include "Engine/Content/Asset.h"
 #include "Engine/Content/Content.h"
+#include "Engine/Content/Loading/ContentLoadingTrace.h"
 #include "Engine/Threading/Threading.h"
+#include "Engine/Utilities/Crc.h"
+#include "Engine/Engine/CommandLine.h"
 #if USE_EDITOR
 #include "Engine/Serialization/JsonWriter.h"
 #include "Engine/Serialization/JsonWriters.h"
@@ -54,6 +59,40 @@ void FlaxChunk::RegisterUsage()
     LastAccessTime = Platform::GetTimeSeconds();
 }
 
+namespace
+{
+#if USE_EDITOR
+    // Groups the bytes of the fixed-size blocks by their offset within the block (the remaining tail bytes are copied)
+    void ShuffleBlocks(const byte* src, byte* dst, int32 size, int32 stride)
+    {
+        const int32 blocksCount = size / stride;
+        for (int32 offset = 0; offset < stride; offset++)
+        {
+            const byte* srcPtr = src + offset;
+            byte* dstPtr = dst + offset * blocksCount;
+            for (int32 block = 0; block < blocksCount; block++)
+                dstPtr[block] = srcPtr[block * stride];
+        }
+        const int32 tail = blocksCount * stride;
+        Platform::MemoryCopy(dst + tail, src + tail, size - tail);
+    }
+#endif
+
+    void UnshuffleBlocks(const byte* src, byte* dst, int32 size, int32 stride)
+    {
+        const int32 blocksCount = size / stride;
+        for (int32 offset = 0; offset < stride; offset++)
+        {
+            const byte* srcPtr = src + offset * blocksCount;
+            byte* dstPtr = dst + offset;
+            for (int32 block = 0; block < blocksCount; block++)
+                dstPtr[block * stride] = srcPtr[block];
+        }
+        const int32 tail = blocksCount * stride;
+        Platform::MemoryCopy(dst + tail, src + tail, size - tail);
+    }
+}
+
 const int32 FlaxStorage::MagicCode = 1180124739;
 
 FlaxStorage::LockData FlaxStorage::LockData::Invalid(nullptr);
@@ -353,6 +392,32 @@ bool FlaxStorage::Load()
             AddChunk(chunk);
         }
 
+        // Packages share the deduplicated chunks (the same location in file) between the assets so the data is loaded into memory once
+        if (IsPackage())
+        {
+            Dictionary<uint64, int32> locations;
+            for (int32 i = 0; i < _chunks.Count(); i++)
+            {
+                const FlaxChunk* chunk = _chunks[i];
+                const uint64 key = ((uint64)chunk->LocationInFile.Address << 32) | chunk->LocationInFile.Size;
+                int32 sharedIndex;
+                if (!locations.TryGet(key, sharedIndex))
+                {
+                    locations.Add(key, i);
+                    continue;
+                }
+                if (_chunks[sharedIndex]->Flags != chunk->Flags)
+                    continue;
+                if (_chunksRedirects.IsEmpty())
+                {
+                    _chunksRedirects.Resize(_chunks.Count());
+                    for (int32 j = 0; j < _chunksRedirects.Count(); j++)
+                        _chunksRedirects[j] = j;
+                }
+                _chunksRedirects[i] = sharedIndex;
+            }
+        }
+
         break;
     }
     case 8:
@@ -641,6 +706,35 @@ bool FlaxStorage::LoadAssetChunk(FlaxChunk* chunk)
 
     LockChunks();
 
+    // Read-only packages use the memory-mapped file (no file handles nor temporary buffers)
+    const byte* mappedData = GetMappedData();
+    if (mappedData)
+    {
+        if ((uint64)chunk->LocationInFile.Address + chunk->LocationInFile.Size > _mappedSize)
+        {
+            UnlockChunks();
+            LOG(Warning, "Cannot load chunk from {0}. Invalid location in file.", ToString());
+            return true;
+        }
+        const byte* data = mappedData + chunk->LocationInFile.Address;
+        bool failed = false;
+        if (EnumHasAnyFlags(chunk->Flags, FlaxChunkFlags::CompressedLZ4))
+        {
+            // Compressed
+            failed = DecompressChunk(chunk, data, chunk->LocationInFile.Size);
+        }
+        else
+        {
+            // Raw data (pages are loaded by the system on access so only the size is known)
+            ContentLoadingTrace::PhaseTimer traceRead(ContentLoadingTrace::Phase::Read, chunk->LocationInFile.Size);
+            chunk->Data.Link(data, chunk->LocationInFile.Size);
+        }
+        if (!failed)
+            chunk->RegisterUsage();
+        UnlockChunks();
+        return failed;
+    }
+
     // Open file
     auto stream = OpenFile();
     bool failed = stream == nullptr;
@@ -681,39 +775,215 @@ bool FlaxStorage::LoadAssetChunk(FlaxChunk* chunk)
         if (EnumHasAnyFlags(chunk->Flags, FlaxChunkFlags::CompressedLZ4))
         {
             // Compressed
-            size -= sizeof(int32); // Don't count original size int
-            int32 originalSize;
-            stream->ReadInt32(&originalSize);
             Array<byte> tmpBuf;
             tmpBuf.Resize(size); // TODO: maybe use thread local or content loading pool with sharable temp buffers for the decompression?
-            stream->ReadBytes(tmpBuf.Get(), size);
-
-            // Decompress data
-            PROFILE_CPU_NAMED("DecompressLZ4");
-            chunk->Data.Allocate(originalSize);
-            const int32 res = LZ4_decompress_safe((const char*)tmpBuf.Get(), chunk->Data.Get<char>(), size, originalSize);
-            if (res <= 0)
             {
-                UnlockChunks();
-                LOG(Warning, "Cannot load chunk from {0}. Failed to decompress it data. Result: {1}.", ToString(), res);
-                return true;
+                ContentLoadingTrace::PhaseTimer traceRead(ContentLoadingTrace::Phase::Read, size);
+                stream->ReadBytes(tmpBuf.Get(), size);
             }
-            chunk->Data.SetLength(res);
+            failed = DecompressChunk(chunk, tmpBuf.Get(), size);
         }
         else
         {
             // Raw data
+            ContentLoadingTrace::PhaseTimer traceRead(ContentLoadingTrace::Phase::Read, size);
             chunk->Data.Read(stream, size);
         }
-        ASSERT(chunk->IsLoaded());
-        chunk->RegisterUsage();
+        if (!failed)
+        {
+            ASSERT(chunk->IsLoaded());
+            chunk->RegisterUsage();
+        }
+    }
+
+    UnlockChunks();
+
+    return failed;
+}
+
+// Chunks separated by up to that amount of bytes are read with a single request (the gap is read and skipped)
+#define CHUNKS_MERGE_MAX_GAP (64 * 1024)
+// Max size of the merged chunks read request
+#define CHUNKS_MERGE_MAX_SIZE (16 * 1024 * 1024)
+
+namespace
+{
+    struct ChunksRange
+    {
+        int32 First, Last;
+        uint32 Start, End;
+    };
+
+    bool SortChunksByLocation(FlaxChunk* const& a, FlaxChunk* const& b)
+    {
+        return a->LocationInFile.Address < b->LocationInFile.Address;
+    }
+}
+
+bool FlaxStorage::LoadAssetChunks(const Span<FlaxChunk*>& chunks)
+{
+    ASSERT(IsLoaded());
+
+    // Gather missing chunks in the file order
+    Array<FlaxChunk*, InlinedAllocation<ASSET_FILE_DATA_CHUNKS>> toLoad;
+    for (FlaxChunk* chunk : chunks)
+    {
+        if (chunk && chunk->IsMissing() && chunk->ExistsInFile())
+            toLoad.Add(chunk);
+    }
+    if (toLoad.Count() <= 1)
+        return toLoad.HasItems() && LoadAssetChunk(toLoad[0]);
+    PROFILE_CPU();
+    Sorting::QuickSort(toLoad.Get(), toLoad.Count(), &SortChunksByLocation);
+
+    // Merge adjacent chunks into ranges
+    Array<ChunksRange, InlinedAllocation<ASSET_FILE_DATA_CHUNKS>> ranges;
+    for (int32 i = 0; i < toLoad.Count(); i++)
+    {
+        const FlaxChunk::Location& location = toLoad[i]->LocationInFile;
+        if (ranges.HasItems())
+        {
+            ChunksRange& range = ranges.Last();
+            if (location.Address <= range.End + CHUNKS_MERGE_MAX_GAP && location.Address + location.Size - range.Start <= CHUNKS_MERGE_MAX_SIZE)
+            {
+                range.Last = i;
+                range.End = Math::Max(range.End, location.Address + location.Size);
+                continue;
+            }
+        }
+        ranges.Add({ i, i, location.Address, location.Address + location.Size });
     }
 
+    LockChunks();
+    bool failed = false;
+    const byte* mappedData = GetMappedData();
+    if (mappedData)
+    {
+        // Start reading all ranges at once, then load chunks in order (each waits only for its own pages)
+        for (const ChunksRange& range : ranges)
+        {
+            if (range.End <= _mappedSize)
+                File::Prefetch(mappedData + range.Start, range.End - range.Start);
+        }
+        for (int32 i = 0; i < toLoad.Count() && !failed; i++)
+            failed = LoadAssetChunk(toLoad[i]);
+    }
+    else
+    {
+        // Read each range with a single request and split it into chunks
+        FileReadStream* stream = OpenFile();
+        Array<byte> buffer;
+        for (int32 rangeIndex = 0; rangeIndex < ranges.Count() && !failed; rangeIndex++)
+        {
+            const ChunksRange& range = ranges[rangeIndex];
+            if (range.First == range.Last || !stream)
+            {
+                for (int32 i = range.First; i <= range.Last && !failed; i++)
+                    failed = LoadAssetChunk(toLoad[i]);
+                continue;
+            }
+            const int32 size = (int32)(range.End - range.Start);
+            buffer.Resize(size, false);
+            {
+                ContentLoadingTrace::PhaseTimer traceRead(ContentLoadingTrace::Phase::Read, size);
+                stream->SetPosition(range.Start);
+                stream->ReadBytes(buffer.Get(), size);
+            }
+            if (stream->HasError())
+            {
+                // Fallback to reading chunks one by one
+                stream = OpenFile();
+                for (int32 i = range.First; i <= range.Last && !failed; i++)
+                    failed = LoadAssetChunk(toLoad[i]);
+                continue;
+            }
+            for (int32 i = range.First; i <= range.Last && !failed; i++)
+            {
+                FlaxChunk* chunk = toLoad[i];
+                if (chunk->IsLoaded())
+                    continue;
+                const byte* data = buffer.Get() + (chunk->LocationInFile.Address - range.Start);
+                if (EnumHasAnyFlags(chunk->Flags, FlaxChunkFlags::CompressedLZ4))
+                    failed = DecompressChunk(chunk, data, chunk->LocationInFile.Size);
+                else
+                    chunk->Data.Copy(data, chunk->LocationInFile.Size);
+                if (!failed)
+                    chunk->RegisterUsage();
+            }
+        }
+    }
     UnlockChunks();
 
     return failed;
 }
 
+bool FlaxStorage::DecompressChunk(FlaxChunk* chunk, const byte* data, int32 size)
+{
+    // Compressed chunk data starts with the size of the original data (and the dictionary chunk index and the shuffle stride if used)
+    int32 originalSize;
+    Platform::MemoryCopy(&originalSize, data, sizeof(int32));
+    data += sizeof(int32);
+    size -= sizeof(int32);
+    const char* dictionary = nullptr;
+    int32 dictionarySize = 0;
+    if (EnumHasAnyFlags(chunk->Flags, FlaxChunkFlags::CompressionDictionary))
+    {
+        int32 dictionaryIndex;
+        Platform::MemoryCopy(&dictionaryIndex, data, sizeof(int32));
+        data += sizeof(int32);
+        size -= sizeof(int32);
+        if (dictionaryIndex != -1)
+        {
+            FlaxChunk* dictionaryChunk = dictionaryIndex >= 0 && dictionaryIndex < _chunks.Count() ? _chunks[dictionaryIndex] : nullptr;
+            if (!dictionaryChunk || dictionaryChunk == chunk || EnumHasAnyFlags(dictionaryChunk->Flags, FlaxChunkFlags::CompressedLZ4) || LoadAssetChunk(dictionaryChunk))
+            {
+                LOG(Warning, "Cannot load chunk from {0}. Missing compression dictionary.", ToString());
+                return true;
+            }
+            dictionary = dictionaryChunk->Get<char>();
+            dictionarySize = dictionaryChunk->Size();
+        }
+    }
+    int32 shuffleStride = 0;
+    if (EnumHasAnyFlags(chunk->Flags, FlaxChunkFlags::ShuffledBlocks))
+    {
+        Platform::MemoryCopy(&shuffleStride, data, sizeof(int32));
+        data += sizeof(int32);
+        size -= sizeof(int32);
+        chunk->ShuffleStride = shuffleStride;
+    }
+
+    // Decompress data
+    PROFILE_CPU_NAMED("DecompressLZ4");
+    ContentLoadingTrace::PhaseTimer traceDecompress(ContentLoadingTrace::Phase::Decompress);
+    chunk->Data.Allocate(originalSize);
+    Array<byte> shuffled;
+    char* output = chunk->Data.Get<char>();
+    if (shuffleStride > 1)
+    {
+        shuffled.Resize(originalSize);
+        output = (char*)shuffled.Get();
+    }
+    int32 res;
+    if (dictionary)
+        res = LZ4_decompress_safe_usingDict((const char*)data, output, size, originalSize, dictionary, dictionarySize);
+    else
+        res = LZ4_decompress_safe((const char*)data, output, size, originalSize);
+    if (res <= 0)
+    {
+        chunk->Data.Release();
+        LOG(Warning, "Cannot load chunk from {0}. Failed to decompress it data. Result: {1}.", ToString(), res);
+        return true;
+    }
+    if (shuffleStride > 1)
+    {
+        PROFILE_CPU_NAMED("UnshuffleBlocks");
+        UnshuffleBlocks(shuffled.Get(), chunk->Data.Get(), res, shuffleStride);
+    }
+    chunk->Data.SetLength(res);
+    return false;
+}
+
 #if USE_EDITOR
 
 bool FlaxStorage::ChangeAssetID(Entry& e, const Guid& newId)
@@ -838,6 +1108,52 @@ bool FlaxStorage::Create(const StringView& path, const AssetInitData* data, int3
     return result;
 }
 
+// LZ4 uses up to the last 64kB of the dictionary
+#define COMPRESSION_DICTIONARY_MAX_SIZE (64 * 1024)
+#define COMPRESSION_DICTIONARY_MIN_CHUNKS 8
+#define COMPRESSION_DICTIONARY_SAMPLE_MIN_SIZE 256
+
+namespace
+{
+    void BuildCompressionDictionaries(const AssetInitData* data, const Array<FlaxChunk*>& chunks, const Array<int32>& chunksAssets, Array<FlaxChunk>& dictionaries, Array<int32>& chunksDictionaries)
+    {
+        // Group chunks that use dictionary by the asset type
+        Dictionary<String, Array<int32>> typeChunks;
+        for (int32 i = 0; i < chunks.Count(); i++)
+        {
+            const FlaxChunk* chunk = chunks[i];
+            if (EnumHasAllFlags(chunk->Flags, FlaxChunkFlags::CompressedLZ4 | FlaxChunkFlags::CompressionDictionary) && chunk->Size() > 0)
+                typeChunks[data[chunksAssets[i]].Header.TypeName].Add(i);
+        }
+        chunksDictionaries.Resize(chunks.Count());
+        for (int32& e : chunksDictionaries)
+            e = -1;
+        for (auto& e : typeChunks)
+        {
+            const Array<int32>& group = e.Value;
+            if (group.Count() < COMPRESSION_DICTIONARY_MIN_CHUNKS)
+                continue; // Not worth it, dictionary would be bigger than the gain
+            PROFILE_CPU_NAMED("BuildDictionary");
+
+            // Sample the beginning of each chunk (most of the similar data is there, eg. common json properties and type names)
+            const int32 sampleSize = Math::Max(COMPRESSION_DICTIONARY_MAX_SIZE / group.Count(), COMPRESSION_DICTIONARY_SAMPLE_MIN_SIZE);
+            Array<byte> samples;
+            for (int32 i = 0; i < group.Count() && samples.Count() < COMPRESSION_DICTIONARY_MAX_SIZE; i++)
+            {
+                const FlaxChunk* chunk = chunks[group[i]];
+                const int32 size = Math::Min(Math::Min(sampleSize, chunk->Size()), COMPRESSION_DICTIONARY_MAX_SIZE - samples.Count());
+                samples.Add(chunk->Get(), size);
+            }
+
+            const int32 dictionaryIndex = chunks.Count() + dictionaries.Count();
+            FlaxChunk& dictionary = dictionaries.AddOne();
+            dictionary.Data.Copy(samples);
+            for (const int32 i : group)
+                chunksDictionaries[i] = dictionaryIndex;
+        }
+    }
+}
+
 bool FlaxStorage::Create(WriteStream* stream, const AssetInitData* data, int32 dataCount, const CustomData* customData)
 {
     // Validate inputs
@@ -852,9 +1168,37 @@ bool FlaxStorage::Create(WriteStream* stream, const AssetInitData* data, int32 d
     entries.Resize(dataCount);
     Array<FlaxChunk*> chunks;
 
-    // Get all chunks
+    // Get all chunks (always-resident data first in assets order, followed by the streamed chunks to keep the assets loading reads sequential)
+    Array<int32> chunksAssets;
+    Array<FlaxChunk*> streamedChunks;
+    Array<int32> streamedChunksAssets;
     for (int32 i = 0; i < dataCount; i++)
-        data[i].Header.GetLoadedChunks(chunks);
+    {
+        for (FlaxChunk* chunk : data[i].Header.Chunks)
+        {
+            if (!chunk || !chunk->IsLoaded())
+                continue;
+            if (EnumHasAnyFlags(chunk->Flags, FlaxChunkFlags::Streamed))
+            {
+                streamedChunks.Add(chunk);
+                streamedChunksAssets.Add(i);
+            }
+            else
+            {
+                chunks.Add(chunk);
+                chunksAssets.Add(i);
+            }
+        }
+    }
+    chunks.Add(streamedChunks);
+    chunksAssets.Add(streamedChunksAssets);
+
+    // Build compression dictionaries from the small chunks of the same asset type (added as extra raw chunks)
+    Array<FlaxChunk> dictionaries;
+    Array<int32> chunksDictionaries;
+    BuildCompressionDictionaries(data, chunks, chunksAssets, dictionaries, chunksDictionaries);
+    for (FlaxChunk& dictionary : dictionaries)
+        chunks.Add(&dictionary);
     int32 chunksCount = chunks.Count();
 
     // TODO: sort chunks by size? smaller ones first?
@@ -891,6 +1235,8 @@ bool FlaxStorage::Create(WriteStream* stream, const AssetInitData* data, int32 d
     // Compress chunks
     Array<Array<byte>> compressedChunks;
     compressedChunks.Resize(chunksCount);
+    LZ4_stream_t* lz4Stream = nullptr;
+    Array<byte> shuffled;
     for (int32 i = 0; i < chunksCount; i++)
     {
         const FlaxChunk* chunk = chunks[i];
@@ -899,25 +1245,108 @@ bool FlaxStorage::Create(WriteStream* stream, const AssetInitData* data, int32 d
             PROFILE_CPU_NAMED("CompressLZ4");
             const int32 srcSize = chunk->Data.Length();
             const int32 maxSize = LZ4_compressBound(srcSize);
+            const char* srcData = chunk->Data.Get<char>();
+            if (EnumHasAnyFlags(chunk->Flags, FlaxChunkFlags::ShuffledBlocks) && chunk->ShuffleStride > 1)
+            {
+                shuffled.Resize(srcSize);
+                ShuffleBlocks(chunk->Data.Get(), shuffled.Get(), srcSize, chunk->ShuffleStride);
+                srcData = (const char*)shuffled.Get();
+            }
             auto& chunkCompressed = compressedChunks[i];
             chunkCompressed.Resize(maxSize);
-            const int32 dstSize = LZ4_compress_default(chunk->Data.Get<char>(), (char*)chunkCompressed.Get(), srcSize, maxSize);
+            int32 dstSize;
+            const int32 dictionaryIndex = i < chunksDictionaries.Count() ? chunksDictionaries[i] : -1;
+            if (dictionaryIndex != -1)
+            {
+                if (!lz4Stream)
+                    lz4Stream = LZ4_createStream();
+                const FlaxChunk& dictionary = dictionaries[dictionaryIndex - (chunksCount - dictionaries.Count())];
+                LZ4_resetStream(lz4Stream);
+                LZ4_loadDict(lz4Stream, dictionary.Get<char>(), dictionary.Size());
+                dstSize = LZ4_compress_fast_continue(lz4Stream, srcData, (char*)chunkCompressed.Get(), srcSize, maxSize, 1);
+            }
+            else
+            {
+                dstSize = LZ4_compress_default(srcData, (char*)chunkCompressed.Get(), srcSize, maxSize);
+            }
             if (dstSize <= 0)
             {
                 chunkCompressed.Resize(0);
+                if (lz4Stream)
+                    LZ4_freeStream(lz4Stream);
                 LOG(Warning, "Chunk data LZ4 compression failed.");
                 return true;
             }
             chunkCompressed.Resize(dstSize);
         }
     }
+    if (lz4Stream)
+        LZ4_freeStream(lz4Stream);
+
+    // Find chunks with the same stored data (eg. imported variants of the same texture or identical collision meshes) to write it once at the shared location
+    Array<int32> chunksSources;
+    chunksSources.Resize(chunksCount);
+    int32 duplicatesCount = 0;
+    uint64 duplicatesSize = 0;
+    {
+        PROFILE_CPU_NAMED("Deduplicate");
+        Dictionary<uint32, int32> hashes;
+        for (int32 i = 0; i < chunksCount; i++)
+        {
+            chunksSources[i] = -1;
+            const bool isCompressed = compressedChunks[i].HasItems();
+            const byte* payload = isCompressed ? compressedChunks[i].Get() : chunks[i]->Data.Get();
+            const int32 payloadSize = isCompressed ? compressedChunks[i].Count() : chunks[i]->Data.Length();
+            const int32 dictionaryIndex = i < chunksDictionaries.Count() ? chunksDictionaries[i] : -1;
+            uint32 hash = Crc::MemCrc32(payload, payloadSize);
+            hash = Crc::MemCrc32(&dictionaryIndex, sizeof(dictionaryIndex), hash);
+            int32 sourceIndex;
+            if (!hashes.TryGet(hash, sourceIndex))
+            {
+                hashes.Add(hash, i);
+                continue;
+            }
+
+            // Validate the whole stored data (the same hash doesn't guarantee the same data)
+            const FlaxChunk* source = chunks[sourceIndex];
+            const FlaxChunkFlags storageFlags = FlaxChunkFlags::CompressedLZ4 | FlaxChunkFlags::CompressionDictionary | FlaxChunkFlags::ShuffledBlocks;
+            const bool isSourceCompressed = compressedChunks[sourceIndex].HasItems();
+            const byte* sourcePayload = isSourceCompressed ? compressedChunks[sourceIndex].Get() : source->Data.Get();
+            const int32 sourcePayloadSize = isSourceCompressed ? compressedChunks[sourceIndex].Count() : source->Data.Length();
+            if (isCompressed != isSourceCompressed ||
+                (chunks[i]->Flags & storageFlags) != (source->Flags & storageFlags) ||
+                (sourceIndex < chunksDictionaries.Count() ? chunksDictionaries[sourceIndex] : -1) != dictionaryIndex ||
+                (EnumHasAnyFlags(source->Flags, FlaxChunkFlags::ShuffledBlocks) && chunks[i]->ShuffleStride != source->ShuffleStride) ||
+                chunks[i]->Data.Length() != source->Data.Length() ||
+                payloadSize != sourcePayloadSize ||
+                Platform::MemoryCompare(payload, sourcePayload, payloadSize) != 0)
+                continue;
+            chunksSources[i] = sourceIndex;
+            duplicatesCount++;
+            duplicatesSize += payloadSize;
+        }
+    }
+    if (duplicatesCount != 0)
+        LOG(Info, "Deduplicated {0} chunks ({1} kB)", duplicatesCount, duplicatesSize / 1024);
 
     // Initialize chunks locations in file
     for (int32 i = 0; i < chunksCount; i++)
     {
+        if (chunksSources[i] != -1)
+        {
+            // Share the location of the chunk with the same data
+            chunks[i]->LocationInFile = chunks[chunksSources[i]]->LocationInFile;
+            continue;
+        }
         int32 size = chunks[i]->Size();
         if (compressedChunks[i].HasItems())
+        {
             size = compressedChunks[i].Count() + sizeof(int32); // Add original data size
+            if (EnumHasAnyFlags(chunks[i]->Flags, FlaxChunkFlags::CompressionDictionary))
+                size += sizeof(int32); // Add dictionary chunk index
+            if (EnumHasAnyFlags(chunks[i]->Flags, FlaxChunkFlags::ShuffledBlocks))
+                size += sizeof(int32); // Add shuffle stride
+        }
         ASSERT(size > 0);
         chunks[i]->LocationInFile = FlaxChunk::Location(currentAddress, size);
         currentAddress += size;
@@ -1010,10 +1439,19 @@ bool FlaxStorage::Create(WriteStream* stream, const AssetInitData* data, int32 d
     // Write chunks data
     for (int32 i = 0; i < chunksCount; i++)
     {
+        if (chunksSources[i] != -1)
+        {
+            // Duplicated chunk data
+            continue;
+        }
         if (compressedChunks[i].HasItems())
         {
-            // Compressed chunk data (write additional size of the original data)
+            // Compressed chunk data (write additional size of the original data, the dictionary chunk index and the shuffle stride)
             stream->WriteInt32(chunks[i]->Data.Length());
+            if (EnumHasAnyFlags(chunks[i]->Flags, FlaxChunkFlags::CompressionDictionary))
+                stream->WriteInt32(i < chunksDictionaries.Count() ? chunksDictionaries[i] : -1);
+            if (EnumHasAnyFlags(chunks[i]->Flags, FlaxChunkFlags::ShuffledBlocks))
+                stream->WriteInt32(chunks[i]->ShuffleStride);
             stream->WriteBytes(compressedChunks[i].Get(), compressedChunks[i].Count());
         }
         else
@@ -1092,6 +1530,8 @@ bool FlaxStorage::LoadAssetHeader(const Entry& e, AssetInitData& data)
                 LOG(Warning, "Invalid chunks mapping.");
                 return true;
             }
+            if (chunkIndex != INVALID_INDEX && _chunksRedirects.HasItems())
+                chunkIndex = _chunksRedirects[chunkIndex];
             data.Header.Chunks[i] = chunkIndex == INVALID_INDEX ? nullptr : _chunks[chunkIndex];
         }
 
@@ -1333,9 +1773,38 @@ FileReadStream* FlaxStorage::OpenFile()
     return stream;
 }
 
+const byte* FlaxStorage::GetMappedData()
+{
+    if (_mappedData || _mappingFailed || !IsPackage())
+        return _mappedData;
+    ScopeLock lock(_loadLocker);
+    if (!_mappedData && !_mappingFailed)
+    {
+        // Map the whole package file once (fallback to the file streams if platform doesn't support it)
+        const byte* data;
+        uint64 size;
+        if (File::MapReadOnly(_path, data, size, CommandLine::Options.SharedContent.IsTrue()))
+        {
+            _mappingFailed = true;
+        }
+        else
+        {
+            _mappedSize = size;
+            _mappedData = data;
+        }
+    }
+    return _mappedData;
+}
+
+bool FlaxStorage::IsChunkMapped(const FlaxChunk* chunk) const
+{
+    const byte* data = chunk->Data.Get();
+    return _mappedData && chunk->IsLoaded() && !chunk->Data.IsAllocated() && data >= _mappedData && data < _mappedData + _mappedSize;
+}
+
 bool FlaxStorage::CloseFileHandles()
 {
-    if (Platform::AtomicRead(&_chunksLock) == 0 && Platform::AtomicRead(&_files) == 0)
+    if (Platform::AtomicRead(&_chunksLock) == 0 && Platform::AtomicRead(&_files) == 0 && _mappedData == nullptr)
     {
         return false;
     }
@@ -1368,6 +1837,8 @@ bool FlaxStorage::CloseFileHandles()
         Platform::Sleep(1);
     if (Platform::AtomicRead(&_chunksLock) != 0)
         return true; // Failed, someone is still accessing the file
+    if (Platform::AtomicRead(&_mappingRefs) != 0)
+        return true; // Failed, someone still references the mapped file data
 
     // Close file handles (from all threads)
     Array<FileReadStream*, InlinedAllocation<8>> streams;
@@ -1379,6 +1850,19 @@ bool FlaxStorage::CloseFileHandles()
     }
     _file.Clear();
     Platform::AtomicStore(&_files, 0);
+
+    // Release the file mapping (unload chunks that reference it)
+    if (_mappedData)
+    {
+        for (FlaxChunk* chunk : _chunks)
+        {
+            if (chunk->IsLoaded() && !chunk->Data.IsAllocated())
+                chunk->Unload();
+        }
+        File::Unmap(_mappedData, _mappedSize);
+        _mappedData = nullptr;
+        _mappedSize = 0;
+    }
     return false;
 }
 
@@ -1395,6 +1879,7 @@ void FlaxStorage::Dispose()
 
     // Release data
     _chunks.ClearDelete();
+    _chunksRedirects.Clear();
     _version = 0;
 }
 
@@ -1418,12 +1903,32 @@ void FlaxStorage::Tick(double time)
     }
 
     // Release file handles in none of chunks is in use
-    if (!wasAnyUsed && Platform::AtomicRead(&_chunksLock) == 0)
+    if (!wasAnyUsed && Platform::AtomicRead(&_chunksLock) == 0 && Platform::AtomicRead(&_mappingRefs) == 0)
     {
         CloseFileHandles();
     }
 }
 
+void FlaxStorage::GetCachedChunks(Array<FlaxChunk*>& result) const
+{
+    if (Platform::AtomicRead((int64*)&_chunksLock) != 0)
+        return;
+    for (int32 i = 0; i < _chunks.Count(); i++)
+    {
+        FlaxChunk* chunk = _chunks.Get()[i];
+        if (chunk->Data.IsAllocated())
+            result.Add(chunk);
+    }
+}
+
+bool FlaxStorage::UnloadChunk(FlaxChunk* chunk)
+{
+    if (Platform::AtomicRead(&_chunksLock) != 0)
+        return false;
+    chunk->Unload();
+    return true;
+}
+
 #if USE_EDITOR
 
 void FlaxStorage::OnRename(const StringView& newPath)
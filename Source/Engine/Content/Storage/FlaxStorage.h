@@ -89,6 +89,7 @@ class FLAXENGINE_API FlaxStorage : public Object
     // State
     int64 _refCount = 0;
     int64 _chunksLock = 0;
+    int64 _mappingRefs = 0;
     int64 _files = 0;
     double _lastRefLostTime;
     CriticalSection _loadLocker;
@@ -96,6 +97,10 @@ class FLAXENGINE_API FlaxStorage : public Object
     // Storage
     ThreadLocal<FileReadStream*> _file;
     Array<FlaxChunk*> _chunks;
+    Array<int32> _chunksRedirects; // Maps the chunks with the deduplicated data to the shared chunk (empty if package has no duplicates)
+    const byte* _mappedData = nullptr;
+    uint64 _mappedSize = 0;
+    bool _mappingFailed = false;
 
     // Metadata
     uint32 _version = 0;
@@ -142,6 +147,29 @@ class FLAXENGINE_API FlaxStorage : public Object
         Platform::InterlockedDecrement(&_chunksLock);
     }
 
+    /// <summary>
+    /// Pins the memory-mapped file to keep the data that references the mapped pages valid (eg. after the chunk linked to them gets unloaded). File handles are not released on tick while mapping is pinned.
+    /// </summary>
+    FORCE_INLINE void AddMappingRef()
+    {
+        Platform::InterlockedIncrement(&_mappingRefs);
+    }
+
+    /// <summary>
+    /// Unpins the memory-mapped file.
+    /// </summary>
+    FORCE_INLINE void RemoveMappingRef()
+    {
+        Platform::InterlockedDecrement(&_mappingRefs);
+    }
+
+    /// <summary>
+    /// Checks if the loaded chunk data is linked to the memory-mapped file pages (read-only, shared with the other processes that map the same file) rather than owned by the storage.
+    /// </summary>
+    /// <param name="chunk">The chunk (owned by this storage).</param>
+    /// <returns>True if chunk data references the mapped file, otherwise false.</returns>
+    bool IsChunkMapped(const FlaxChunk* chunk) const;
+
     /// <summary>
     /// Locks storage data via LockChunks/UnlockChunks. Prevents from releasing chunks data cache.
     /// </summary>
@@ -384,6 +412,13 @@ class FLAXENGINE_API FlaxStorage : public Object
     /// <returns>True if cannot load data, otherwise false</returns>
     bool LoadAssetChunk(FlaxChunk* chunk);
 
+    /// <summary>
+    /// Loads the asset chunks in a batch. Chunks are read in the file order and the adjacent ones are merged into a single read request (or prefetched at once for memory-mapped packages) to keep the drive busy.
+    /// </summary>
+    /// <param name="chunks">The chunks.</param>
+    /// <returns>True if cannot load data, otherwise false</returns>
+    bool LoadAssetChunks(const Span<FlaxChunk*>& chunks);
+
 #if USE_EDITOR
 
     /// <summary>
@@ -418,6 +453,19 @@ class FLAXENGINE_API FlaxStorage : public Object
     /// </summary>
     void Tick(double time);
 
+    /// <summary>
+    /// Gets the chunks with the data loaded into the memory owned by the storage (excludes chunks linked to the memory-mapped file). Returns none if chunks are locked (pinned by LockChunks).
+    /// </summary>
+    /// <param name="result">The output chunks list.</param>
+    void GetCachedChunks(Array<FlaxChunk*>& result) const;
+
+    /// <summary>
+    /// Releases the loaded chunk data unless the storage chunks are locked (pinned by LockChunks).
+    /// </summary>
+    /// <param name="chunk">The chunk (owned by this storage).</param>
+    /// <returns>True if chunk data has been released, otherwise false.</returns>
+    bool UnloadChunk(FlaxChunk* chunk);
+
 #if USE_EDITOR
     void OnRename(const StringView& newPath);
 #endif
@@ -487,5 +535,7 @@ class FLAXENGINE_API FlaxStorage : public Object
     void AddChunk(FlaxChunk* chunk);
     virtual void AddEntry(Entry& e) = 0;
     FileReadStream* OpenFile();
+    const byte* GetMappedData();
+    bool DecompressChunk(FlaxChunk* chunk, const byte* data, int32 size);
     virtual bool GetEntry(const Guid& id, Entry& e) = 0;
 };
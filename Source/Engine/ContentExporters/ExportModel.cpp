@@ -53,7 +53,8 @@ ExportAssetResult AssetExporters::ExportModel(ExportAssetContext& context)
         uint32 ibStride = use16BitIndexBuffer ? sizeof(uint16) : sizeof(uint32);
         if (vertices == 0 || triangles == 0)
             return ExportAssetResult::Error;
-        auto vb0 = stream.Move<VB0ElementType>(vertices);
+        const PositionsQuantization& quantization = mesh.GetPositionsQuantization();
+        auto vb0 = stream.Move<byte>(vertices * mesh.GetVB0Stride());
         auto vb1 = stream.Move<VB1ElementType>(vertices);
         bool hasColors = stream.ReadBool();
         VB2ElementType18* vb2 = nullptr;
@@ -67,7 +68,7 @@ ExportAssetResult AssetExporters::ExportModel(ExportAssetContext& context)
 
         for (uint32 i = 0; i < vertices; i++)
         {
-            auto v = vb0[i].Position;
+            auto v = quantization.IsValid() ? quantization.Decode(((const VB0QuantizedElementType*)vb0)[i]) : ((const VB0ElementType*)vb0)[i].Position;
             output->WriteText(StringAnsi::Format("v {0} {1} {2}\n", v.X, v.Y, v.Z));
         }
 
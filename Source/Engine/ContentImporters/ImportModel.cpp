@@ -574,11 +574,84 @@ CreateAssetResult ImportModel::CreateModel(CreateAssetContext& context, ModelDat
         context.Data.Header.Chunks[chunkIndex]->Data.Copy(stream.GetHandle(), stream.GetPosition());
     }
 
+    // Pack meshes triangle clusters
+    bool hasMeshlets = false;
+    for (int32 lodIndex = 0; lodIndex < lodCount && !hasMeshlets; lodIndex++)
+    {
+        for (const MeshData* mesh : modelData.LODs[lodIndex].Meshes)
+            hasMeshlets |= mesh->Meshlets.HasItems();
+    }
+    if (hasMeshlets)
+    {
+        stream.SetPosition(0);
+        stream.WriteInt32(1); // Version
+        for (int32 lodIndex = 0; lodIndex < lodCount; lodIndex++)
+        {
+            for (const MeshData* mesh : modelData.LODs[lodIndex].Meshes)
+            {
+                stream.WriteInt32(mesh->Meshlets.Count());
+                stream.WriteBytes(mesh->Meshlets.Get(), mesh->Meshlets.Count() * sizeof(Meshlet));
+            }
+        }
+        if (context.AllocateChunk(14))
+            return CreateAssetResult::CannotAllocateChunk;
+        context.Data.Header.Chunks[14]->Data.Copy(stream.GetHandle(), stream.GetPosition());
+    }
+
+    // Pack meshes positions quantization
+    bool hasQuantization = false;
+    for (int32 lodIndex = 0; lodIndex < lodCount && !hasQuantization; lodIndex++)
+    {
+        for (const MeshData* mesh : modelData.LODs[lodIndex].Meshes)
+            hasQuantization |= mesh->Quantization.IsValid();
+    }
+    if (hasQuantization)
+    {
+        stream.SetPosition(0);
+        stream.WriteInt32(1); // Version
+        for (int32 lodIndex = 0; lodIndex < lodCount; lodIndex++)
+        {
+            for (const MeshData* mesh : modelData.LODs[lodIndex].Meshes)
+                stream.WriteBytes(&mesh->Quantization, sizeof(PositionsQuantization));
+        }
+        if (context.AllocateChunk(13))
+            return CreateAssetResult::CannotAllocateChunk;
+        context.Data.Header.Chunks[13]->Data.Copy(stream.GetHandle(), stream.GetPosition());
+    }
+
+    // Generate shadow proxy mesh
+    if (options && options->GenerateShadowProxy)
+    {
+        MeshData proxy;
+        if (!ModelTool::GenerateShadowProxy(modelData, options->ShadowProxyTriangleReduction, proxy))
+        {
+            stream.SetPosition(0);
+            stream.WriteInt32(1); // Version
+            stream.WriteInt32(options->ShadowProxyLOD);
+            stream.WriteInt32(proxy.Positions.Count());
+            stream.WriteInt32(proxy.Indices.Count());
+            stream.WriteBytes(proxy.Positions.Get(), proxy.Positions.Count() * sizeof(Float3));
+            if (proxy.Positions.Count() <= MAX_uint16)
+            {
+                for (const uint32 index : proxy.Indices)
+                    stream.WriteUint16((uint16)index);
+            }
+            else
+            {
+                stream.WriteBytes(proxy.Indices.Get(), proxy.Indices.Count() * sizeof(uint32));
+            }
+            if (context.AllocateChunk(12))
+                return CreateAssetResult::CannotAllocateChunk;
+            context.Data.Header.Chunks[12]->Data.Copy(stream.GetHandle(), stream.GetPosition());
+            LOG(Info, "Generated shadow proxy mesh with {0} triangles", proxy.Indices.Count() / 3);
+        }
+    }
+
     // Generate SDF
     if (options && options->GenerateSDF)
     {
         stream.SetPosition(0);
-        if (!ModelTool::GenerateModelSDF(nullptr, &modelData, options->SDFResolution, lodCount - 1, nullptr, &stream, context.TargetAssetPath))
+        if (!ModelTool::GenerateModelSDF(nullptr, &modelData, options->SDFResolution, lodCount - 1, nullptr, &stream, context.TargetAssetPath, 0.6f, options->SDFUseGPU))
         {
             if (context.AllocateChunk(15))
                 return CreateAssetResult::CannotAllocateChunk;
@@ -0,0 +1,731 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Core/Memory/Memory.h"
+#include "Engine/Core/Memory/Allocation.h"
+#include "Engine/Core/Collections/HashFunctions.h"
+#include "Engine/Core/Collections/FlatHashTable.h"
+#include "Engine/Core/Math/Math.h"
+
+/// <summary>
+/// Template for unordered dictionary with mapped key with value pairs. Uses open-addressing with separate control bytes probed in groups of 16 (SIMD) that keeps lookups fast at high load factors and doesn't degrade on insert/remove-heavy workloads.
+/// </summary>
+/// <remarks>Provides the same API as Dictionary (uses GetHash for keys). Pointers to buckets are invalidated when the collection grows.</remarks>
+/// <typeparam name="KeyType">The type of the keys in the dictionary.</typeparam>
+/// <typeparam name="ValueType">The type of the values in the dictionary.</typeparam>
+/// <typeparam name="AllocationType">The type of memory allocator.</typeparam>
+template<typename KeyType, typename ValueType, typename AllocationType = HeapAllocation>
+class FlatDictionary
+{
+    friend FlatDictionary;
+public:
+    /// <summary>
+    /// Describes single portion of space for the key and value pair in a hash map.
+    /// </summary>
+    struct Bucket
+    {
+        /// <summary>The key.</summary>
+        KeyType Key;
+        /// <summary>The value.</summary>
+        ValueType Value;
+    };
+
+    typedef typename AllocationType::template Data<Bucket> AllocationData;
+    typedef typename AllocationType::template Data<byte> ControlAllocationData;
+
+private:
+    int32 _elementsCount = 0;
+    int32 _deletedCount = 0;
+    int32 _size = 0;
+    ControlAllocationData _control;
+    AllocationData _allocation;
+
+public:
+    /// <summary>
+    /// Initializes a new instance of the <see cref="FlatDictionary"/> class.
+    /// </summary>
+    FlatDictionary()
+    {
+    }
+
+    /// <summary>
+    /// Initializes a new instance of the <see cref="FlatDictionary"/> class.
+    /// </summary>
+    /// <param name="capacity">The initial capacity (amount of elements to fit without growing).</param>
+    FlatDictionary(int32 capacity)
+    {
+        EnsureCapacity(capacity);
+    }
+
+    /// <summary>
+    /// Initializes a new instance of the <see cref="FlatDictionary"/> class.
+    /// </summary>
+    /// <param name="other">The other collection to move.</param>
+    FlatDictionary(FlatDictionary&& other) noexcept
+    {
+        MoveFrom(other);
+    }
+
+    /// <summary>
+    /// Initializes a new instance of the <see cref="FlatDictionary"/> class.
+    /// </summary>
+    /// <param name="other">Other collection to copy</param>
+    FlatDictionary(const FlatDictionary& other)
+    {
+        Clone(other);
+    }
+
+    /// <summary>
+    /// Clones the data from the other collection.
+    /// </summary>
+    /// <param name="other">The other collection to copy.</param>
+    /// <returns>The reference to this.</returns>
+    FlatDictionary& operator=(const FlatDictionary& other)
+    {
+        if (this != &other)
+            Clone(other);
+        return *this;
+    }
+
+    /// <summary>
+    /// Moves the data from the other collection.
+    /// </summary>
+    /// <param name="other">The other collection to move.</param>
+    /// <returns>The reference to this.</returns>
+    FlatDictionary& operator=(FlatDictionary&& other) noexcept
+    {
+        if (this != &other)
+        {
+            Clear();
+            FreeTable();
+            MoveFrom(other);
+        }
+        return *this;
+    }
+
+    /// <summary>
+    /// Finalizes an instance of the <see cref="FlatDictionary"/> class.
+    /// </summary>
+    ~FlatDictionary()
+    {
+        Clear();
+    }
+
+public:
+    /// <summary>
+    /// Gets the amount of the elements in the collection.
+    /// </summary>
+    FORCE_INLINE int32 Count() const
+    {
+        return _elementsCount;
+    }
+
+    /// <summary>
+    /// Gets the amount of the elements that can be contained by the collection (amount of slots).
+    /// </summary>
+    FORCE_INLINE int32 Capacity() const
+    {
+        return _size;
+    }
+
+    /// <summary>
+    /// Returns true if collection is empty.
+    /// </summary>
+    FORCE_INLINE bool IsEmpty() const
+    {
+        return _elementsCount == 0;
+    }
+
+    /// <summary>
+    /// Returns true if collection has one or more elements.
+    /// </summary>
+    FORCE_INLINE bool HasItems() const
+    {
+        return _elementsCount != 0;
+    }
+
+public:
+    /// <summary>
+    /// The FlatDictionary collection iterator.
+    /// </summary>
+    struct Iterator
+    {
+        friend FlatDictionary;
+    private:
+        FlatDictionary* _collection;
+        int32 _index;
+
+    public:
+        Iterator(FlatDictionary const* collection, const int32 index)
+            : _collection(const_cast<FlatDictionary*>(collection))
+            , _index(index)
+        {
+        }
+
+        Iterator()
+            : _collection(nullptr)
+            , _index(-1)
+        {
+        }
+
+    public:
+        FORCE_INLINE int32 Index() const
+        {
+            return _index;
+        }
+
+        FORCE_INLINE bool IsEnd() const
+        {
+            return _index == _collection->_size;
+        }
+
+        FORCE_INLINE bool IsNotEnd() const
+        {
+            return _index != _collection->_size;
+        }
+
+        FORCE_INLINE Bucket& operator*() const
+        {
+            return _collection->_allocation.Get()[_index];
+        }
+
+        FORCE_INLINE Bucket* operator->() const
+        {
+            return &_collection->_allocation.Get()[_index];
+        }
+
+        FORCE_INLINE explicit operator bool() const
+        {
+            return _index >= 0 && _index < _collection->_size;
+        }
+
+        FORCE_INLINE bool operator!() const
+        {
+            return !(bool)*this;
+        }
+
+        FORCE_INLINE bool operator==(const Iterator& v) const
+        {
+            return _index == v._index && _collection == v._collection;
+        }
+
+        FORCE_INLINE bool operator!=(const Iterator& v) const
+        {
+            return _index != v._index || _collection != v._collection;
+        }
+
+        Iterator& operator++()
+        {
+            const int32 capacity = _collection->_size;
+            if (_index != capacity)
+            {
+                const byte* control = _collection->_control.Get();
+                do
+                {
+                    _index++;
+                } while (_index != capacity && !FlatHashTable::IsFull(control[_index]));
+            }
+            return *this;
+        }
+
+        Iterator operator++(int)
+        {
+            Iterator i = *this;
+            ++*this;
+            return i;
+        }
+    };
+
+public:
+    /// <summary>
+    /// Gets element by the key (will add default ValueType element if key not found).
+    /// </summary>
+    /// <param name="key">The key of the element.</param>
+    /// <returns>The value that is at given index.</returns>
+    template<typename KeyComparableType>
+    ValueType& At(const KeyComparableType& key)
+    {
+        const uint32 hash = FlatHashTable::MixHash(GetHash(key));
+        int32 index = FindIndex(key, hash);
+        if (index == -1)
+        {
+            index = Insert(hash);
+            Bucket& bucket = _allocation.Get()[index];
+            Memory::ConstructItems(&bucket.Key, &key, 1);
+            Memory::ConstructItem(&bucket.Value);
+        }
+        return _allocation.Get()[index].Value;
+    }
+
+    /// <summary>
+    /// Gets the element by the key.
+    /// </summary>
+    /// <param name="key">The ky of the element.</param>
+    /// <returns>The value that is at given index.</returns>
+    template<typename KeyComparableType>
+    const ValueType& At(const KeyComparableType& key) const
+    {
+        const int32 index = FindIndex(key, FlatHashTable::MixHash(GetHash(key)));
+        ASSERT(index != -1);
+        return _allocation.Get()[index].Value;
+    }
+
+    /// <summary>
+    /// Gets or sets the element by the key.
+    /// </summary>
+    /// <param name="key">The key of the element.</param>
+    /// <returns>The value that is at given index.</returns>
+    template<typename KeyComparableType>
+    FORCE_INLINE ValueType& operator[](const KeyComparableType& key)
+    {
+        return At(key);
+    }
+
+    /// <summary>
+    /// Gets or sets the element by the key.
+    /// </summary>
+    /// <param name="key">The ky of the element.</param>
+    /// <returns>The value that is at given index.</returns>
+    template<typename KeyComparableType>
+    FORCE_INLINE const ValueType& operator[](const KeyComparableType& key) const
+    {
+        return At(key);
+    }
+
+    /// <summary>
+    /// Tries to get element with given key.
+    /// </summary>
+    /// <param name="key">The key of the element.</param>
+    /// <param name="result">The result value.</param>
+    /// <returns>True if element of given key has been found, otherwise false.</returns>
+    template<typename KeyComparableType>
+    bool TryGet(const KeyComparableType& key, ValueType& result) const
+    {
+        if (IsEmpty())
+            return false;
+        const int32 index = FindIndex(key, FlatHashTable::MixHash(GetHash(key)));
+        if (index == -1)
+            return false;
+        result = _allocation.Get()[index].Value;
+        return true;
+    }
+
+    /// <summary>
+    /// Tries to get pointer to the element with given key.
+    /// </summary>
+    /// <param name="key">The ky of the element.</param>
+    /// <returns>Pointer to the element value or null if cannot find it.</returns>
+    template<typename KeyComparableType>
+    ValueType* TryGet(const KeyComparableType& key) const
+    {
+        if (IsEmpty())
+            return nullptr;
+        const int32 index = FindIndex(key, FlatHashTable::MixHash(GetHash(key)));
+        if (index == -1)
+            return nullptr;
+        return (ValueType*)&_allocation.Get()[index].Value;
+    }
+
+public:
+    /// <summary>
+    /// Clears the collection but without changing its capacity (all inserted elements: keys and values will be removed).
+    /// </summary>
+    void Clear()
+    {
+        if (_elementsCount + _deletedCount != 0)
+        {
+            byte* control = _control.Get();
+            Bucket* data = _allocation.Get();
+            for (int32 i = 0; i < _size; i++)
+            {
+                if (FlatHashTable::IsFull(control[i]))
+                {
+                    Memory::DestructItem(&data[i].Key);
+                    Memory::DestructItem(&data[i].Value);
+                }
+                control[i] = FlatHashTable::Empty;
+            }
+            _elementsCount = _deletedCount = 0;
+        }
+    }
+
+    /// <summary>
+    /// Clears the collection and delete value objects.
+    /// Note: collection must contain pointers to the objects that have public destructor and be allocated using New method.
+    /// </summary>
+#if defined(_MSC_VER)
+    template<typename = typename TEnableIf<TIsPointer<ValueType>::Value>::Type>
+#endif
+    void ClearDelete()
+    {
+        for (Iterator i = Begin(); i.IsNotEnd(); ++i)
+        {
+            if (i->Value)
+                ::Delete(i->Value);
+        }
+        Clear();
+    }
+
+    /// <summary>
+    /// Changes the capacity of the collection.
+    /// </summary>
+    /// <param name="capacity">The new capacity (amount of slots, rounded up to the power of two).</param>
+    /// <param name="preserveContents">Enables preserving collection contents during resizing.</param>
+    void SetCapacity(int32 capacity, bool preserveContents = true)
+    {
+        if (!preserveContents)
+            Clear();
+        if (capacity <= 0 && _elementsCount == 0)
+        {
+            FreeTable();
+            return;
+        }
+        int32 size = FlatHashTable::MinCapacity;
+        while (size < capacity)
+            size *= 2;
+        while (FlatHashTable::GetMaxLoad(size) < _elementsCount)
+            size *= 2;
+        Rehash(size);
+    }
+
+    /// <summary>
+    /// Ensures that collection has given capacity.
+    /// </summary>
+    /// <param name="minCapacity">The minimum amount of elements that collection can store without growing.</param>
+    /// <param name="preserveContents">True if preserve collection data when changing its size, otherwise collection after resize will be empty.</param>
+    void EnsureCapacity(int32 minCapacity, bool preserveContents = true)
+    {
+        if (minCapacity <= FlatHashTable::GetMaxLoad(_size) - _deletedCount)
+            return;
+        if (!preserveContents)
+            Clear();
+        Rehash(FlatHashTable::CalculateCapacity(Math::Max(minCapacity, _elementsCount)));
+    }
+
+public:
+    /// <summary>
+    /// Add pair element to the collection.
+    /// </summary>
+    /// <param name="key">The key.</param>
+    /// <param name="value">The value.</param>
+    /// <returns>Weak reference to the stored bucket.</returns>
+    template<typename KeyComparableType>
+    Bucket* Add(const KeyComparableType& key, const ValueType& value)
+    {
+        Bucket* bucket = OnAdd(key);
+        Memory::ConstructItems(&bucket->Key, &key, 1);
+        Memory::ConstructItems(&bucket->Value, &value, 1);
+        return bucket;
+    }
+
+    /// <summary>
+    /// Add pair element to the collection.
+    /// </summary>
+    /// <param name="key">The key.</param>
+    /// <param name="value">The value.</param>
+    /// <returns>Weak reference to the stored bucket.</returns>
+    template<typename KeyComparableType>
+    Bucket* Add(const KeyComparableType& key, ValueType&& value)
+    {
+        Bucket* bucket = OnAdd(key);
+        Memory::ConstructItems(&bucket->Key, &key, 1);
+        Memory::MoveItems(&bucket->Value, &value, 1);
+        return bucket;
+    }
+
+    /// <summary>
+    /// Removes element with a specified key.
+    /// </summary>
+    /// <param name="key">The element key to remove.</param>
+    /// <returns>True if item has been removed, otherwise false if cannot find it.</returns>
+    template<typename KeyComparableType>
+    bool Remove(const KeyComparableType& key)
+    {
+        if (IsEmpty())
+            return false;
+        const int32 index = FindIndex(key, FlatHashTable::MixHash(GetHash(key)));
+        if (index == -1)
+            return false;
+        RemoveAt(index);
+        return true;
+    }
+
+    /// <summary>
+    /// Removes element at specified iterator.
+    /// </summary>
+    /// <param name="i">The element iterator to remove.</param>
+    /// <returns>True if item has been removed, otherwise false.</returns>
+    bool Remove(const Iterator& i)
+    {
+        ASSERT(i._collection == this);
+        if (i)
+        {
+            ASSERT(FlatHashTable::IsFull(_control.Get()[i._index]));
+            RemoveAt(i._index);
+            return true;
+        }
+        return false;
+    }
+
+public:
+    /// <summary>
+    /// Finds the element with given key in the collection.
+    /// </summary>
+    /// <param name="key">The key to find.</param>
+    /// <returns>The iterator for the found element or End if cannot find it.</returns>
+    template<typename KeyComparableType>
+    Iterator Find(const KeyComparableType& key) const
+    {
+        if (IsEmpty())
+            return End();
+        const int32 index = FindIndex(key, FlatHashTable::MixHash(GetHash(key)));
+        return index != -1 ? Iterator(this, index) : End();
+    }
+
+    /// <summary>
+    /// Checks if given key is in a collection.
+    /// </summary>
+    /// <param name="key">The key to find.</param>
+    /// <returns>True if key has been found in a collection, otherwise false.</returns>
+    template<typename KeyComparableType>
+    bool ContainsKey(const KeyComparableType& key) const
+    {
+        if (IsEmpty())
+            return false;
+        return FindIndex(key, FlatHashTable::MixHash(GetHash(key))) != -1;
+    }
+
+    /// <summary>
+    /// Clones other collection into this.
+    /// </summary>
+    /// <param name="other">The other collection to clone.</param>
+    void Clone(const FlatDictionary& other)
+    {
+        Clear();
+        EnsureCapacity(other.Count());
+        for (Iterator i = other.Begin(); i.IsNotEnd(); ++i)
+            Add(i->Key, i->Value);
+    }
+
+public:
+    Iterator Begin() const
+    {
+        Iterator i(this, -1);
+        ++i;
+        return i;
+    }
+
+    Iterator End() const
+    {
+        return Iterator(this, _size);
+    }
+
+    Iterator begin()
+    {
+        Iterator i(this, -1);
+        ++i;
+        return i;
+    }
+
+    FORCE_INLINE Iterator end()
+    {
+        return Iterator(this, _size);
+    }
+
+    const Iterator begin() const
+    {
+        Iterator i(this, -1);
+        ++i;
+        return i;
+    }
+
+    FORCE_INLINE const Iterator end() const
+    {
+        return Iterator(this, _size);
+    }
+
+private:
+    template<typename KeyComparableType>
+    int32 FindIndex(const KeyComparableType& key, uint32 hash) const
+    {
+        if (_size == 0)
+            return -1;
+        const byte* control = _control.Get();
+        const Bucket* data = _allocation.Get();
+        const byte h2 = FlatHashTable::H2(hash);
+        const uint32 groupsMask = (uint32)(_size / FlatHashTable::GroupSize) - 1;
+        uint32 group = FlatHashTable::H1(hash) & groupsMask;
+        for (uint32 step = 1; step <= groupsMask + 1; step++)
+        {
+            const byte* groupControl = control + group * FlatHashTable::GroupSize;
+            for (uint32 match = FlatHashTable::Match(groupControl, h2); match != 0; match &= match - 1)
+            {
+                const int32 index = (int32)(group * FlatHashTable::GroupSize) + FlatHashTable::LowestBit(match);
+                if (data[index].Key == key)
+                    return index;
+            }
+            if (FlatHashTable::MatchEmpty(groupControl) != 0)
+                break;
+            group = (group + step) & groupsMask;
+        }
+        return -1;
+    }
+
+    // Finds the free slot for the new item (table needs to have space)
+    int32 FindFreeIndex(uint32 hash) const
+    {
+        const byte* control = _control.Get();
+        const uint32 groupsMask = (uint32)(_size / FlatHashTable::GroupSize) - 1;
+        uint32 group = FlatHashTable::H1(hash) & groupsMask;
+        for (uint32 step = 1;; step++)
+        {
+            const uint32 match = FlatHashTable::MatchFree(control + group * FlatHashTable::GroupSize);
+            if (match != 0)
+                return (int32)(group * FlatHashTable::GroupSize) + FlatHashTable::LowestBit(match);
+            group = (group + step) & groupsMask;
+        }
+    }
+
+    // Reserves the slot for the new item with the given hash and returns its index
+    int32 Insert(uint32 hash)
+    {
+        if (_elementsCount + _deletedCount + 1 > FlatHashTable::GetMaxLoad(_size))
+        {
+            // Rehash in-place if there are many deleted slots, otherwise grow
+            Rehash(_deletedCount > _size / 4 ? Math::Max(_size, FlatHashTable::CalculateCapacity(_elementsCount + 1)) : Math::Max(_size * 2, (int32)FlatHashTable::MinCapacity));
+        }
+        const int32 index = FindFreeIndex(hash);
+        byte& control = _control.Get()[index];
+        if (control == FlatHashTable::Deleted)
+            _deletedCount--;
+        control = FlatHashTable::H2(hash);
+        _elementsCount++;
+        return index;
+    }
+
+    template<typename KeyComparableType>
+    Bucket* OnAdd(const KeyComparableType& key)
+    {
+        const uint32 hash = FlatHashTable::MixHash(GetHash(key));
+        ASSERT(FindIndex(key, hash) == -1 && "That key has been already added to the dictionary.");
+        const int32 index = Insert(hash);
+        return &_allocation.Get()[index];
+    }
+
+    void RemoveAt(int32 index)
+    {
+        byte* control = _control.Get();
+        Bucket& bucket = _allocation.Get()[index];
+        Memory::DestructItem(&bucket.Key);
+        Memory::DestructItem(&bucket.Value);
+        _elementsCount--;
+
+        // Slot can be marked as empty if its group has any empty slot (probing would stop on this group anyway), otherwise leave tombstone
+        const int32 groupStart = index & ~(FlatHashTable::GroupSize - 1);
+        if (FlatHashTable::MatchEmpty(control + groupStart) != 0)
+        {
+            control[index] = FlatHashTable::Empty;
+        }
+        else
+        {
+            control[index] = FlatHashTable::Deleted;
+            _deletedCount++;
+        }
+    }
+
+    void Rehash(int32 size)
+    {
+        const int32 oldSize = _size;
+        ControlAllocationData oldControl;
+        AllocationData oldAllocation;
+        if (oldSize != 0)
+            MoveToEmpty(oldControl, oldAllocation, oldSize);
+        _size = size;
+        _elementsCount = _deletedCount = 0;
+        _control.Allocate(size);
+        _allocation.Allocate(size);
+        Platform::MemorySet(_control.Get(), size, FlatHashTable::Empty);
+        if (oldSize != 0)
+        {
+            const byte* control = oldControl.Get();
+            Bucket* data = oldAllocation.Get();
+            for (int32 i = 0; i < oldSize; i++)
+            {
+                if (FlatHashTable::IsFull(control[i]))
+                {
+                    Bucket& oldBucket = data[i];
+                    const int32 index = Insert(FlatHashTable::MixHash(GetHash(oldBucket.Key)));
+                    Bucket& bucket = _allocation.Get()[index];
+                    Memory::MoveItems(&bucket.Key, &oldBucket.Key, 1);
+                    Memory::MoveItems(&bucket.Value, &oldBucket.Value, 1);
+                    Memory::DestructItem(&oldBucket.Key);
+                    Memory::DestructItem(&oldBucket.Value);
+                }
+            }
+            oldControl.Free();
+            oldAllocation.Free();
+        }
+    }
+
+    void MoveToEmpty(ControlAllocationData& toControl, AllocationData& to, int32 size)
+    {
+        if IF_CONSTEXPR (AllocationType::HasSwap)
+        {
+            toControl.Swap(_control);
+            to.Swap(_allocation);
+        }
+        else
+        {
+            toControl.Allocate(size);
+            to.Allocate(size);
+            byte* control = _control.Get();
+            Bucket* fromData = _allocation.Get();
+            Bucket* toData = to.Get();
+            for (int32 i = 0; i < size; i++)
+            {
+                if (FlatHashTable::IsFull(control[i]))
+                {
+                    Memory::MoveItems(&toData[i].Key, &fromData[i].Key, 1);
+                    Memory::MoveItems(&toData[i].Value, &fromData[i].Value, 1);
+                    Memory::DestructItem(&fromData[i].Key);
+                    Memory::DestructItem(&fromData[i].Value);
+                }
+            }
+            Platform::MemoryCopy(toControl.Get(), control, size);
+            _control.Free();
+            _allocation.Free();
+        }
+    }
+
+    void FreeTable()
+    {
+        if (_size != 0)
+        {
+            _control.Free();
+            _allocation.Free();
+            _size = 0;
+        }
+        _elementsCount = _deletedCount = 0;
+    }
+
+    void MoveFrom(FlatDictionary& other)
+    {
+        if IF_CONSTEXPR (AllocationType::HasSwap)
+        {
+            _control.Swap(other._control);
+            _allocation.Swap(other._allocation);
+            _size = other._size;
+            _elementsCount = other._elementsCount;
+            _deletedCount = other._deletedCount;
+            other._size = other._elementsCount = other._deletedCount = 0;
+        }
+        else
+        {
+            EnsureCapacity(other.Count());
+            for (Iterator i = other.Begin(); i.IsNotEnd(); ++i)
+                Add(i->Key, MoveTemp(i->Value));
+            other.Clear();
+        }
+    }
+};
@@ -0,0 +1,630 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Core/Memory/Memory.h"
+#include "Engine/Core/Memory/Allocation.h"
+#include "Engine/Core/Collections/HashFunctions.h"
+#include "Engine/Core/Collections/FlatHashTable.h"
+#include "Engine/Core/Math/Math.h"
+
+/// <summary>
+/// Template for unordered set of values (without duplicates with O(1) lookup access). Uses open-addressing with separate control bytes probed in groups of 16 (SIMD) that keeps lookups fast at high load factors and doesn't degrade on insert/remove-heavy workloads.
+/// </summary>
+/// <remarks>Provides the same API as HashSet (uses GetHash for items).</remarks>
+/// <typeparam name="T">The type of elements in the set.</typeparam>
+/// <typeparam name="AllocationType">The type of memory allocator.</typeparam>
+template<typename T, typename AllocationType = HeapAllocation>
+class FlatHashSet
+{
+    friend FlatHashSet;
+public:
+    /// <summary>
+    /// Describes single portion of space for the item in a hash set.
+    /// </summary>
+    struct Bucket
+    {
+        /// <summary>The item.</summary>
+        T Item;
+    };
+
+    typedef typename AllocationType::template Data<Bucket> AllocationData;
+    typedef typename AllocationType::template Data<byte> ControlAllocationData;
+
+private:
+    int32 _elementsCount = 0;
+    int32 _deletedCount = 0;
+    int32 _size = 0;
+    ControlAllocationData _control;
+    AllocationData _allocation;
+
+public:
+    /// <summary>
+    /// Initializes a new instance of the <see cref="FlatHashSet"/> class.
+    /// </summary>
+    FlatHashSet()
+    {
+    }
+
+    /// <summary>
+    /// Initializes a new instance of the <see cref="FlatHashSet"/> class.
+    /// </summary>
+    /// <param name="capacity">The initial capacity (amount of elements to fit without growing).</param>
+    FlatHashSet(int32 capacity)
+    {
+        EnsureCapacity(capacity);
+    }
+
+    /// <summary>
+    /// Initializes a new instance of the <see cref="FlatHashSet"/> class.
+    /// </summary>
+    /// <param name="other">The other collection to move.</param>
+    FlatHashSet(FlatHashSet&& other) noexcept
+    {
+        MoveFrom(other);
+    }
+
+    /// <summary>
+    /// Initializes a new instance of the <see cref="FlatHashSet"/> class.
+    /// </summary>
+    /// <param name="other">Other collection to copy</param>
+    FlatHashSet(const FlatHashSet& other)
+    {
+        Clone(other);
+    }
+
+    /// <summary>
+    /// Clones the data from the other collection.
+    /// </summary>
+    /// <param name="other">The other collection to copy.</param>
+    /// <returns>The reference to this.</returns>
+    FlatHashSet& operator=(const FlatHashSet& other)
+    {
+        if (this != &other)
+            Clone(other);
+        return *this;
+    }
+
+    /// <summary>
+    /// Moves the data from the other collection.
+    /// </summary>
+    /// <param name="other">The other collection to move.</param>
+    /// <returns>The reference to this.</returns>
+    FlatHashSet& operator=(FlatHashSet&& other) noexcept
+    {
+        if (this != &other)
+        {
+            Clear();
+            FreeTable();
+            MoveFrom(other);
+        }
+        return *this;
+    }
+
+    /// <summary>
+    /// Finalizes an instance of the <see cref="FlatHashSet"/> class.
+    /// </summary>
+    ~FlatHashSet()
+    {
+        Clear();
+    }
+
+public:
+    /// <summary>
+    /// Gets the amount of the elements in the collection.
+    /// </summary>
+    FORCE_INLINE int32 Count() const
+    {
+        return _elementsCount;
+    }
+
+    /// <summary>
+    /// Gets the amount of the elements that can be contained by the collection (amount of slots).
+    /// </summary>
+    FORCE_INLINE int32 Capacity() const
+    {
+        return _size;
+    }
+
+    /// <summary>
+    /// Returns true if collection is empty.
+    /// </summary>
+    FORCE_INLINE bool IsEmpty() const
+    {
+        return _elementsCount == 0;
+    }
+
+    /// <summary>
+    /// Returns true if collection has one or more elements.
+    /// </summary>
+    FORCE_INLINE bool HasItems() const
+    {
+        return _elementsCount != 0;
+    }
+
+public:
+    /// <summary>
+    /// The FlatHashSet collection iterator.
+    /// </summary>
+    struct Iterator
+    {
+        friend FlatHashSet;
+    private:
+        FlatHashSet* _collection;
+        int32 _index;
+
+    public:
+        Iterator(FlatHashSet const* collection, const int32 index)
+            : _collection(const_cast<FlatHashSet*>(collection))
+            , _index(index)
+        {
+        }
+
+        Iterator()
+            : _collection(nullptr)
+            , _index(-1)
+        {
+        }
+
+    public:
+        FORCE_INLINE int32 Index() const
+        {
+            return _index;
+        }
+
+        FORCE_INLINE bool IsEnd() const
+        {
+            return _index == _collection->_size;
+        }
+
+        FORCE_INLINE bool IsNotEnd() const
+        {
+            return _index != _collection->_size;
+        }
+
+        FORCE_INLINE Bucket& operator*() const
+        {
+            return _collection->_allocation.Get()[_index];
+        }
+
+        FORCE_INLINE Bucket* operator->() const
+        {
+            return &_collection->_allocation.Get()[_index];
+        }
+
+        FORCE_INLINE explicit operator bool() const
+        {
+            return _index >= 0 && _index < _collection->_size;
+        }
+
+        FORCE_INLINE bool operator!() const
+        {
+            return !(bool)*this;
+        }
+
+        FORCE_INLINE bool operator==(const Iterator& v) const
+        {
+            return _index == v._index && _collection == v._collection;
+        }
+
+        FORCE_INLINE bool operator!=(const Iterator& v) const
+        {
+            return _index != v._index || _collection != v._collection;
+        }
+
+        Iterator& operator++()
+        {
+            const int32 capacity = _collection->_size;
+            if (_index != capacity)
+            {
+                const byte* control = _collection->_control.Get();
+                do
+                {
+                    _index++;
+                } while (_index != capacity && !FlatHashTable::IsFull(control[_index]));
+            }
+            return *this;
+        }
+
+        Iterator operator++(int)
+        {
+            Iterator i = *this;
+            ++*this;
+            return i;
+        }
+    };
+
+public:
+    /// <summary>
+    /// Removes all elements from the collection.
+    /// </summary>
+    void Clear()
+    {
+        if (_elementsCount + _deletedCount != 0)
+        {
+            byte* control = _control.Get();
+            Bucket* data = _allocation.Get();
+            for (int32 i = 0; i < _size; i++)
+            {
+                if (FlatHashTable::IsFull(control[i]))
+                {
+                    Memory::DestructItem(&data[i].Item);
+                }
+                control[i] = FlatHashTable::Empty;
+            }
+            _elementsCount = _deletedCount = 0;
+        }
+    }
+
+    /// <summary>
+    /// Clears the collection and delete value objects.
+    /// Note: collection must contain pointers to the objects that have public destructor and be allocated using New method.
+    /// </summary>
+#if defined(_MSC_VER)
+    template<typename = typename TEnableIf<TIsPointer<T>::Value>::Type>
+#endif
+    void ClearDelete()
+    {
+        for (Iterator i = Begin(); i.IsNotEnd(); ++i)
+        {
+            if (i->Item)
+                ::Delete(i->Item);
+        }
+        Clear();
+    }
+
+    /// <summary>
+    /// Changes the capacity of the collection.
+    /// </summary>
+    /// <param name="capacity">The new capacity (amount of slots, rounded up to the power of two).</param>
+    /// <param name="preserveContents">Enables preserving collection contents during resizing.</param>
+    void SetCapacity(int32 capacity, bool preserveContents = true)
+    {
+        if (!preserveContents)
+            Clear();
+        if (capacity <= 0 && _elementsCount == 0)
+        {
+            FreeTable();
+            return;
+        }
+        int32 size = FlatHashTable::MinCapacity;
+        while (size < capacity)
+            size *= 2;
+        while (FlatHashTable::GetMaxLoad(size) < _elementsCount)
+            size *= 2;
+        Rehash(size);
+    }
+
+    /// <summary>
+    /// Ensures that collection has given capacity.
+    /// </summary>
+    /// <param name="minCapacity">The minimum amount of elements that collection can store without growing.</param>
+    /// <param name="preserveContents">True if preserve collection data when changing its size, otherwise collection after resize will be empty.</param>
+    void EnsureCapacity(int32 minCapacity, bool preserveContents = true)
+    {
+        if (minCapacity <= FlatHashTable::GetMaxLoad(_size) - _deletedCount)
+            return;
+        if (!preserveContents)
+            Clear();
+        Rehash(FlatHashTable::CalculateCapacity(Math::Max(minCapacity, _elementsCount)));
+    }
+
+public:
+    /// <summary>
+    /// Adds element to the collection.
+    /// </summary>
+    /// <param name="item">The element to add to the set.</param>
+    /// <returns>True if element has been added to the collection, otherwise false if the element is already present.</returns>
+    template<typename ItemType>
+    bool Add(const ItemType& item)
+    {
+        Bucket* bucket = OnAdd(item);
+        if (bucket)
+            Memory::ConstructItems(&bucket->Item, &item, 1);
+        return bucket != nullptr;
+    }
+
+    /// <summary>
+    /// Adds element to the collection.
+    /// </summary>
+    /// <param name="item">The element to add to the set.</param>
+    /// <returns>True if element has been added to the collection, otherwise false if the element is already present.</returns>
+    bool Add(T&& item)
+    {
+        Bucket* bucket = OnAdd(item);
+        if (bucket)
+            Memory::MoveItems(&bucket->Item, &item, 1);
+        return bucket != nullptr;
+    }
+
+    /// <summary>
+    /// Removes the specified element from the collection.
+    /// </summary>
+    /// <param name="item">The element to remove.</param>
+    /// <returns>True if item has been removed, otherwise false if cannot find it.</returns>
+    template<typename ItemType>
+    bool Remove(const ItemType& item)
+    {
+        if (IsEmpty())
+            return false;
+        const int32 index = FindIndex(item, FlatHashTable::MixHash(GetHash(item)));
+        if (index == -1)
+            return false;
+        RemoveAt(index);
+        return true;
+    }
+
+    /// <summary>
+    /// Removes element at specified iterator.
+    /// </summary>
+    /// <param name="i">The element iterator to remove.</param>
+    /// <returns>True if item has been removed, otherwise false.</returns>
+    bool Remove(const Iterator& i)
+    {
+        ASSERT(i._collection == this);
+        if (i)
+        {
+            ASSERT(FlatHashTable::IsFull(_control.Get()[i._index]));
+            RemoveAt(i._index);
+            return true;
+        }
+        return false;
+    }
+
+public:
+    /// <summary>
+    /// Finds the element in the collection.
+    /// </summary>
+    /// <param name="item">The item to find.</param>
+    /// <returns>The iterator for the found element or End if cannot find it.</returns>
+    template<typename ItemType>
+    Iterator Find(const ItemType& item) const
+    {
+        if (IsEmpty())
+            return End();
+        const int32 index = FindIndex(item, FlatHashTable::MixHash(GetHash(item)));
+        return index != -1 ? Iterator(this, index) : End();
+    }
+
+    /// <summary>
+    /// Determines whether a collection contains the specified element.
+    /// </summary>
+    /// <param name="item">The item to locate.</param>
+    /// <returns>True if item has been found in a collection, otherwise false.</returns>
+    template<typename ItemType>
+    bool Contains(const ItemType& item) const
+    {
+        if (IsEmpty())
+            return false;
+        return FindIndex(item, FlatHashTable::MixHash(GetHash(item))) != -1;
+    }
+
+    /// <summary>
+    /// Clones other collection into this.
+    /// </summary>
+    /// <param name="other">The other collection to clone.</param>
+    void Clone(const FlatHashSet& other)
+    {
+        Clear();
+        EnsureCapacity(other.Count());
+        for (Iterator i = other.Begin(); i.IsNotEnd(); ++i)
+            Add(i->Item);
+    }
+
+public:
+    Iterator Begin() const
+    {
+        Iterator i(this, -1);
+        ++i;
+        return i;
+    }
+
+    Iterator End() const
+    {
+        return Iterator(this, _size);
+    }
+
+    Iterator begin()
+    {
+        Iterator i(this, -1);
+        ++i;
+        return i;
+    }
+
+    FORCE_INLINE Iterator end()
+    {
+        return Iterator(this, _size);
+    }
+
+    const Iterator begin() const
+    {
+        Iterator i(this, -1);
+        ++i;
+        return i;
+    }
+
+    FORCE_INLINE const Iterator end() const
+    {
+        return Iterator(this, _size);
+    }
+
+private:
+    template<typename ItemType>
+    int32 FindIndex(const ItemType& item, uint32 hash) const
+    {
+        if (_size == 0)
+            return -1;
+        const byte* control = _control.Get();
+        const Bucket* data = _allocation.Get();
+        const byte h2 = FlatHashTable::H2(hash);
+        const uint32 groupsMask = (uint32)(_size / FlatHashTable::GroupSize) - 1;
+        uint32 group = FlatHashTable::H1(hash) & groupsMask;
+        for (uint32 step = 1; step <= groupsMask + 1; step++)
+        {
+            const byte* groupControl = control + group * FlatHashTable::GroupSize;
+            for (uint32 match = FlatHashTable::Match(groupControl, h2); match != 0; match &= match - 1)
+            {
+                const int32 index = (int32)(group * FlatHashTable::GroupSize) + FlatHashTable::LowestBit(match);
+                if (data[index].Item == item)
+                    return index;
+            }
+            if (FlatHashTable::MatchEmpty(groupControl) != 0)
+                break;
+            group = (group + step) & groupsMask;
+        }
+        return -1;
+    }
+
+    // Finds the free slot for the new item (table needs to have space)
+    int32 FindFreeIndex(uint32 hash) const
+    {
+        const byte* control = _control.Get();
+        const uint32 groupsMask = (uint32)(_size / FlatHashTable::GroupSize) - 1;
+        uint32 group = FlatHashTable::H1(hash) & groupsMask;
+        for (uint32 step = 1;; step++)
+        {
+            const uint32 match = FlatHashTable::MatchFree(control + group * FlatHashTable::GroupSize);
+            if (match != 0)
+                return (int32)(group * FlatHashTable::GroupSize) + FlatHashTable::LowestBit(match);
+            group = (group + step) & groupsMask;
+        }
+    }
+
+    // Reserves the slot for the new item with the given hash and returns its index
+    int32 Insert(uint32 hash)
+    {
+        if (_elementsCount + _deletedCount + 1 > FlatHashTable::GetMaxLoad(_size))
+        {
+            // Rehash in-place if there are many deleted slots, otherwise grow
+            Rehash(_deletedCount > _size / 4 ? Math::Max(_size, FlatHashTable::CalculateCapacity(_elementsCount + 1)) : Math::Max(_size * 2, (int32)FlatHashTable::MinCapacity));
+        }
+        const int32 index = FindFreeIndex(hash);
+        byte& control = _control.Get()[index];
+        if (control == FlatHashTable::Deleted)
+            _deletedCount--;
+        control = FlatHashTable::H2(hash);
+        _elementsCount++;
+        return index;
+    }
+
+    template<typename ItemType>
+    Bucket* OnAdd(const ItemType& item)
+    {
+        const uint32 hash = FlatHashTable::MixHash(GetHash(item));
+        if (FindIndex(item, hash) != -1)
+            return nullptr;
+        const int32 index = Insert(hash);
+        return &_allocation.Get()[index];
+    }
+
+    void RemoveAt(int32 index)
+    {
+        byte* control = _control.Get();
+        Bucket& bucket = _allocation.Get()[index];
+        Memory::DestructItem(&bucket.Item);
+        _elementsCount--;
+
+        // Slot can be marked as empty if its group has any empty slot (probing would stop on this group anyway), otherwise leave tombstone
+        const int32 groupStart = index & ~(FlatHashTable::GroupSize - 1);
+        if (FlatHashTable::MatchEmpty(control + groupStart) != 0)
+        {
+            control[index] = FlatHashTable::Empty;
+        }
+        else
+        {
+            control[index] = FlatHashTable::Deleted;
+            _deletedCount++;
+        }
+    }
+
+    void Rehash(int32 size)
+    {
+        const int32 oldSize = _size;
+        ControlAllocationData oldControl;
+        AllocationData oldAllocation;
+        if (oldSize != 0)
+            MoveToEmpty(oldControl, oldAllocation, oldSize);
+        _size = size;
+        _elementsCount = _deletedCount = 0;
+        _control.Allocate(size);
+        _allocation.Allocate(size);
+        Platform::MemorySet(_control.Get(), size, FlatHashTable::Empty);
+        if (oldSize != 0)
+        {
+            const byte* control = oldControl.Get();
+            Bucket* data = oldAllocation.Get();
+            for (int32 i = 0; i < oldSize; i++)
+            {
+                if (FlatHashTable::IsFull(control[i]))
+                {
+                    Bucket& oldBucket = data[i];
+                    const int32 index = Insert(FlatHashTable::MixHash(GetHash(oldBucket.Item)));
+                    Bucket& bucket = _allocation.Get()[index];
+                    Memory::MoveItems(&bucket.Item, &oldBucket.Item, 1);
+                    Memory::DestructItem(&oldBucket.Item);
+                }
+            }
+            oldControl.Free();
+            oldAllocation.Free();
+        }
+    }
+
+    void MoveToEmpty(ControlAllocationData& toControl, AllocationData& to, int32 size)
+    {
+        if IF_CONSTEXPR (AllocationType::HasSwap)
+        {
+            toControl.Swap(_control);
+            to.Swap(_allocation);
+        }
+        else
+        {
+            toControl.Allocate(size);
+            to.Allocate(size);
+            byte* control = _control.Get();
+            Bucket* fromData = _allocation.Get();
+            Bucket* toData = to.Get();
+            for (int32 i = 0; i < size; i++)
+            {
+                if (FlatHashTable::IsFull(control[i]))
+                {
+                    Memory::MoveItems(&toData[i].Item, &fromData[i].Item, 1);
+                    Memory::DestructItem(&fromData[i].Item);
+                }
+            }
+            Platform::MemoryCopy(toControl.Get(), control, size);
+            _control.Free();
+            _allocation.Free();
+        }
+    }
+
+    void FreeTable()
+    {
+        if (_size != 0)
+        {
+            _control.Free();
+            _allocation.Free();
+            _size = 0;
+        }
+        _elementsCount = _deletedCount = 0;
+    }
+
+    void MoveFrom(FlatHashSet& other)
+    {
+        if IF_CONSTEXPR (AllocationType::HasSwap)
+        {
+            _control.Swap(other._control);
+            _allocation.Swap(other._allocation);
+            _size = other._size;
+            _elementsCount = other._elementsCount;
+            _deletedCount = other._deletedCount;
+            other._size = other._elementsCount = other._deletedCount = 0;
+        }
+        else
+        {
+            EnsureCapacity(other.Count());
+            for (Iterator i = other.Begin(); i.IsNotEnd(); ++i)
+                Add(MoveTemp(i->Item));
+            other.Clear();
+        }
+    }
+};
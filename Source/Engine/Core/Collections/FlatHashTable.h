@@ -0,0 +1,160 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Platform/Defines.h"
+#include "Engine/Core/Types/BaseTypes.h"
+#if PLATFORM_SIMD_SSE2
+#include <emmintrin.h>
+#elif PLATFORM_SIMD_NEON
+#include <arm_neon.h>
+#endif
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+/// <summary>
+/// Shared utilities for open-addressing hash tables with separate control bytes (Swiss-table layout) used by FlatDictionary and FlatHashSet.
+/// </summary>
+/// <remarks>
+/// Each slot has a single control byte: empty, deleted or 7 bits of the item hash. Slots are grouped by 16 and the whole group of control bytes is tested at once (SSE2/NEON) so lookups touch only the items with the matching hash bits.
+/// </remarks>
+namespace FlatHashTable
+{
+    enum : byte
+    {
+        Empty = 0x80,
+        Deleted = 0xFE,
+    };
+
+    enum
+    {
+        // The amount of slots in a single group (probed together)
+        GroupSize = 16,
+        // The minimum capacity of the table
+        MinCapacity = GroupSize,
+    };
+
+    /// <summary>
+    /// Mixes the item hash to spread bits (engine hash functions for integers are identity).
+    /// </summary>
+    FORCE_INLINE uint32 MixHash(uint32 hash)
+    {
+        hash ^= hash >> 16;
+        hash *= 0x85ebca6b;
+        hash ^= hash >> 13;
+        hash *= 0xc2b2ae35;
+        hash ^= hash >> 16;
+        return hash;
+    }
+
+    /// <summary>
+    /// Gets the control byte for the hash of the occupied slot (7 lower bits).
+    /// </summary>
+    FORCE_INLINE byte H2(uint32 hash)
+    {
+        return (byte)(hash & 0x7F);
+    }
+
+    /// <summary>
+    /// Gets the index of the first group to probe for the hash.
+    /// </summary>
+    FORCE_INLINE uint32 H1(uint32 hash)
+    {
+        return hash >> 7;
+    }
+
+    FORCE_INLINE bool IsFull(byte control)
+    {
+        return (control & 0x80) == 0;
+    }
+
+    /// <summary>
+    /// Gets the index of the lowest set bit in the mask (mask cannot be zero).
+    /// </summary>
+    FORCE_INLINE int32 LowestBit(uint32 mask)
+    {
+#if defined(_MSC_VER) && !defined(__clang__)
+        unsigned long index;
+        _BitScanForward(&index, mask);
+        return (int32)index;
+#else
+        return __builtin_ctz(mask);
+#endif
+    }
+
+#if PLATFORM_SIMD_SSE2
+    // Gets the bitmask of the slots in group with the given control byte
+    FORCE_INLINE uint32 Match(const byte* group, byte value)
+    {
+        const __m128i ctrl = _mm_loadu_si128((const __m128i*)group);
+        return (uint32)_mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8((char)value)));
+    }
+
+    // Gets the bitmask of the empty or deleted slots in group
+    FORCE_INLINE uint32 MatchFree(const byte* group)
+    {
+        return (uint32)_mm_movemask_epi8(_mm_loadu_si128((const __m128i*)group));
+    }
+#elif PLATFORM_SIMD_NEON
+    FORCE_INLINE uint32 ToMask(uint8x16_t bytes)
+    {
+        // Convert lanes (0xFF or 0x00) into 16-bit mask
+        static const uint8 weights[16] = { 1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128 };
+        const uint8x16_t bits = vandq_u8(bytes, vld1q_u8(weights));
+        const uint8x8_t sum = vpadd_u8(vpadd_u8(vpadd_u8(vget_low_u8(bits), vget_high_u8(bits)), vdup_n_u8(0)), vdup_n_u8(0));
+        return (uint32)vget_lane_u8(sum, 0) | ((uint32)vget_lane_u8(sum, 1) << 8);
+    }
+
+    FORCE_INLINE uint32 Match(const byte* group, byte value)
+    {
+        return ToMask(vceqq_u8(vld1q_u8(group), vdupq_n_u8(value)));
+    }
+
+    FORCE_INLINE uint32 MatchFree(const byte* group)
+    {
+        return ToMask(vcltq_s8(vreinterpretq_s8_u8(vld1q_u8(group)), vdupq_n_s8(0)));
+    }
+#else
+    FORCE_INLINE uint32 Match(const byte* group, byte value)
+    {
+        uint32 mask = 0;
+        for (int32 i = 0; i < GroupSize; i++)
+            mask |= (uint32)(group[i] == value) << i;
+        return mask;
+    }
+
+    FORCE_INLINE uint32 MatchFree(const byte* group)
+    {
+        uint32 mask = 0;
+        for (int32 i = 0; i < GroupSize; i++)
+            mask |= (uint32)(group[i] >> 7) << i;
+        return mask;
+    }
+#endif
+
+    FORCE_INLINE uint32 MatchEmpty(const byte* group)
+    {
+        return Match(group, Empty);
+    }
+
+    /// <summary>
+    /// Calculates the table capacity (power of two, multiple of group size) to store the given amount of items within the max load factor (7/8).
+    /// </summary>
+    FORCE_INLINE int32 CalculateCapacity(int32 count)
+    {
+        int64 minCapacity = (int64)count + count / 7;
+        int64 capacity = MinCapacity;
+        while (capacity < minCapacity)
+            capacity *= 2;
+        return capacity > MAX_int32 / 2 ? MAX_int32 / 2 + 1 : (int32)capacity;
+    }
+
+    /// <summary>
+    /// Gets the maximum amount of used slots (occupied and deleted) before the table needs to grow.
+    /// </summary>
+    FORCE_INLINE int32 GetMaxLoad(int32 capacity)
+    {
+        return capacity - capacity / 8;
+    }
+}
@@ -0,0 +1,443 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Platform/Platform.h"
+#include "Engine/Core/Memory/Memory.h"
+#include "Engine/Core/Types/Span.h"
+
+// The alignment of each field array (in bytes). Matches cache line size and allows aligned SIMD loads.
+#define SOA_ARRAY_ALIGNMENT 64
+
+// The granularity of the capacity (in elements). Field arrays can be processed in blocks of 16 elements (eg. 4 SIMD vectors of floats) without the tail checks (items after Count are not initialized).
+#define SOA_ARRAY_CAPACITY_GRANULARITY 16
+
+namespace SoAArrayImpl
+{
+    template<int32 Index, typename... Fields>
+    struct FieldAt;
+
+    template<typename T, typename... Rest>
+    struct FieldAt<0, T, Rest...>
+    {
+        typedef T Type;
+    };
+
+    template<int32 Index, typename T, typename... Rest>
+    struct FieldAt<Index, T, Rest...>
+    {
+        typedef typename FieldAt<Index - 1, Rest...>::Type Type;
+    };
+
+    template<int32 Index, typename... Fields>
+    struct Ops
+    {
+        FORCE_INLINE static uint64 Layout(void** fields, byte* base, int32 capacity, uint64 offset)
+        {
+            return offset;
+        }
+
+        FORCE_INLINE static void Add(void** fields, int32 index)
+        {
+        }
+
+        FORCE_INLINE static void AddDefault(void** fields, int32 index)
+        {
+        }
+
+        FORCE_INLINE static void Copy(void** dst, void* const* src, int32 count)
+        {
+        }
+
+        FORCE_INLINE static void Move(void** dst, void** src, int32 count)
+        {
+        }
+
+        FORCE_INLINE static void Destruct(void** fields, int32 index, int32 count)
+        {
+        }
+
+        FORCE_INLINE static void MoveItem(void** fields, int32 dstIndex, int32 srcIndex)
+        {
+        }
+
+        FORCE_INLINE static void SwapItems(void** fields, int32 a, int32 b)
+        {
+        }
+    };
+
+    template<int32 Index, typename T, typename... Rest>
+    struct Ops<Index, T, Rest...>
+    {
+        typedef Ops<Index + 1, Rest...> Next;
+
+        static uint64 Layout(void** fields, byte* base, int32 capacity, uint64 offset)
+        {
+            offset = Math::AlignUp<uint64>(offset, SOA_ARRAY_ALIGNMENT);
+            fields[Index] = base ? base + offset : nullptr;
+            return Next::Layout(fields, base, capacity, offset + (uint64)capacity * sizeof(T));
+        }
+
+        template<typename Arg, typename... Args>
+        FORCE_INLINE static void Add(void** fields, int32 index, Arg&& value, Args&&... values)
+        {
+            new((T*)fields[Index] + index) T(Forward<Arg>(value));
+            Next::Add(fields, index, Forward<Args>(values)...);
+        }
+
+        FORCE_INLINE static void AddDefault(void** fields, int32 index)
+        {
+            Memory::ConstructItems((T*)fields[Index] + index, 1);
+            Next::AddDefault(fields, index);
+        }
+
+        FORCE_INLINE static void Copy(void** dst, void* const* src, int32 count)
+        {
+            Memory::ConstructItems((T*)dst[Index], (const T*)src[Index], count);
+            Next::Copy(dst, src, count);
+        }
+
+        FORCE_INLINE static void Move(void** dst, void** src, int32 count)
+        {
+            Memory::MoveItems((T*)dst[Index], (T*)src[Index], count);
+            Memory::DestructItems((T*)src[Index], count);
+            Next::Move(dst, src, count);
+        }
+
+        FORCE_INLINE static void Destruct(void** fields, int32 index, int32 count)
+        {
+            Memory::DestructItems((T*)fields[Index] + index, count);
+            Next::Destruct(fields, index, count);
+        }
+
+        FORCE_INLINE static void MoveItem(void** fields, int32 dstIndex, int32 srcIndex)
+        {
+            T* data = (T*)fields[Index];
+            data[dstIndex] = MoveTemp(data[srcIndex]);
+            Next::MoveItem(fields, dstIndex, srcIndex);
+        }
+
+        FORCE_INLINE static void SwapItems(void** fields, int32 a, int32 b)
+        {
+            T* data = (T*)fields[Index];
+            ::Swap(data[a], data[b]);
+            Next::SwapItems(fields, a, b);
+        }
+    };
+}
+
+/// <summary>
+/// Template for dynamic array with struct-of-arrays layout. Each field has its own contiguous memory (aligned to SOA_ARRAY_ALIGNMENT) so loops that read only a few fields of many items touch only the cache lines with that data and can process them with SIMD.
+/// </summary>
+/// <remarks>
+/// All fields are stored in a single allocation. Removing an item moves the last item into its place (order is not preserved) to keep the arrays dense.
+/// Example: SoAArray&lt;Actor*, BoundingSphere, uint32&gt; where Get&lt;1&gt;() returns the contiguous bounds of all items.
+/// </remarks>
+template<typename... Fields>
+class SoAArray
+{
+    static_assert(sizeof...(Fields) > 0, "SoAArray requires at least one field.");
+
+public:
+    /// <summary>
+    /// The type of the field at the given index.
+    /// </summary>
+    template<int32 Field>
+    using FieldType = typename SoAArrayImpl::FieldAt<Field, Fields...>::Type;
+
+    /// <summary>
+    /// The amount of fields.
+    /// </summary>
+    static constexpr int32 FieldsCount = sizeof...(Fields);
+
+private:
+    typedef SoAArrayImpl::Ops<0, Fields...> Ops;
+
+    int32 _count = 0;
+    int32 _capacity = 0;
+    void* _memory = nullptr;
+    void* _fields[FieldsCount] = {};
+
+public:
+    /// <summary>
+    /// Initializes an empty <see cref="SoAArray"/> without reserving any space.
+    /// </summary>
+    SoAArray()
+    {
+    }
+
+    /// <summary>
+    /// Initializes <see cref="SoAArray"/> by reserving space.
+    /// </summary>
+    /// <param name="capacity">The number of elements that can be added without a need to allocate more memory.</param>
+    explicit SoAArray(int32 capacity)
+    {
+        SetCapacity(capacity, false);
+    }
+
+    /// <summary>
+    /// Initializes <see cref="SoAArray"/> by copying the elements from the other collection.
+    /// </summary>
+    /// <param name="other">The other collection to copy.</param>
+    SoAArray(const SoAArray& other)
+    {
+        SetCapacity(other._count, false);
+        Ops::Copy(_fields, other._fields, other._count);
+        _count = other._count;
+    }
+
+    /// <summary>
+    /// Initializes <see cref="SoAArray"/> by moving the data from the other collection.
+    /// </summary>
+    /// <param name="other">The other collection to move.</param>
+    SoAArray(SoAArray&& other) noexcept
+    {
+        Swap(other);
+    }
+
+    /// <summary>
+    /// Finalizes an instance of the <see cref="SoAArray"/> class.
+    /// </summary>
+    ~SoAArray()
+    {
+        Ops::Destruct(_fields, 0, _count);
+        Allocator::Free(_memory);
+    }
+
+    SoAArray& operator=(const SoAArray& other)
+    {
+        if (this != &other)
+        {
+            Clear();
+            EnsureCapacity(other._count, false);
+            Ops::Copy(_fields, other._fields, other._count);
+            _count = other._count;
+        }
+        return *this;
+    }
+
+    SoAArray& operator=(SoAArray&& other) noexcept
+    {
+        if (this != &other)
+        {
+            Clear();
+            Swap(other);
+        }
+        return *this;
+    }
+
+public:
+    /// <summary>
+    /// Gets the amount of the elements in the collection.
+    /// </summary>
+    FORCE_INLINE int32 Count() const
+    {
+        return _count;
+    }
+
+    /// <summary>
+    /// Gets the amount of the elements that can be contained by the collection without resizing.
+    /// </summary>
+    FORCE_INLINE int32 Capacity() const
+    {
+        return _capacity;
+    }
+
+    /// <summary>
+    /// Returns true if the collection is empty.
+    /// </summary>
+    FORCE_INLINE bool IsEmpty() const
+    {
+        return _count == 0;
+    }
+
+    /// <summary>
+    /// Returns true if the collection has one or more elements.
+    /// </summary>
+    FORCE_INLINE bool HasItems() const
+    {
+        return _count != 0;
+    }
+
+    /// <summary>
+    /// Determines if given index is valid.
+    /// </summary>
+    /// <param name="index">The index.</param>
+    FORCE_INLINE bool IsValidIndex(int32 index) const
+    {
+        return index < _count && index >= 0;
+    }
+
+    /// <summary>
+    /// Gets the pointer to the first element of the given field array (aligned to SOA_ARRAY_ALIGNMENT).
+    /// </summary>
+    template<int32 Field>
+    FORCE_INLINE FieldType<Field>* Get()
+    {
+        return (FieldType<Field>*)_fields[Field];
+    }
+
+    /// <summary>
+    /// Gets the pointer to the first element of the given field array (aligned to SOA_ARRAY_ALIGNMENT).
+    /// </summary>
+    template<int32 Field>
+    FORCE_INLINE const FieldType<Field>* Get() const
+    {
+        return (const FieldType<Field>*)_fields[Field];
+    }
+
+    /// <summary>
+    /// Gets the field value of the element at the given index.
+    /// </summary>
+    /// <param name="index">The element index.</param>
+    template<int32 Field>
+    FORCE_INLINE FieldType<Field>& Get(int32 index)
+    {
+        ASSERT(index >= 0 && index < _count);
+        return ((FieldType<Field>*)_fields[Field])[index];
+    }
+
+    /// <summary>
+    /// Gets the field value of the element at the given index.
+    /// </summary>
+    /// <param name="index">The element index.</param>
+    template<int32 Field>
+    FORCE_INLINE const FieldType<Field>& Get(int32 index) const
+    {
+        ASSERT(index >= 0 && index < _count);
+        return ((const FieldType<Field>*)_fields[Field])[index];
+    }
+
+    /// <summary>
+    /// Gets the span with the given field values of all elements (data pointer is aligned to SOA_ARRAY_ALIGNMENT).
+    /// </summary>
+    template<int32 Field>
+    FORCE_INLINE Span<FieldType<Field>> GetSpan() const
+    {
+        return Span<FieldType<Field>>((const FieldType<Field>*)_fields[Field], _count);
+    }
+
+public:
+    /// <summary>
+    /// Adds the new element to the collection.
+    /// </summary>
+    /// <param name="values">The values of all element fields.</param>
+    /// <returns>The index of the added element.</returns>
+    template<typename... Args>
+    int32 Add(Args&&... values)
+    {
+        static_assert(sizeof...(Args) == FieldsCount, "SoAArray::Add requires the values for all fields.");
+        EnsureCapacity(_count + 1);
+        Ops::Add(_fields, _count, Forward<Args>(values)...);
+        return _count++;
+    }
+
+    /// <summary>
+    /// Adds the new element with default-constructed fields to the collection.
+    /// </summary>
+    /// <returns>The index of the added element.</returns>
+    int32 AddDefault()
+    {
+        EnsureCapacity(_count + 1);
+        Ops::AddDefault(_fields, _count);
+        return _count++;
+    }
+
+    /// <summary>
+    /// Removes the element at the given index. The last element is moved into its place (elements order is not preserved).
+    /// </summary>
+    /// <param name="index">The index of the element to remove.</param>
+    void RemoveAt(int32 index)
+    {
+        ASSERT(index >= 0 && index < _count);
+        const int32 last = --_count;
+        if (index != last)
+            Ops::MoveItem(_fields, index, last);
+        Ops::Destruct(_fields, last, 1);
+    }
+
+    /// <summary>
+    /// Swaps all fields of the two elements.
+    /// </summary>
+    /// <param name="a">The index of the first element.</param>
+    /// <param name="b">The index of the second element.</param>
+    void SwapItems(int32 a, int32 b)
+    {
+        ASSERT(a >= 0 && a < _count && b >= 0 && b < _count);
+        if (a != b)
+            Ops::SwapItems(_fields, a, b);
+    }
+
+    /// <summary>
+    /// Clears the collection without changing its capacity.
+    /// </summary>
+    void Clear()
+    {
+        Ops::Destruct(_fields, 0, _count);
+        _count = 0;
+    }
+
+    /// <summary>
+    /// Clears the collection and releases its memory.
+    /// </summary>
+    void ClearAndFree()
+    {
+        Clear();
+        SetCapacity(0, false);
+    }
+
+    /// <summary>
+    /// Changes the capacity of the collection (rounded up to SOA_ARRAY_CAPACITY_GRANULARITY).
+    /// </summary>
+    /// <param name="capacity">The new capacity.</param>
+    /// <param name="preserveContents">True if preserve collection data when changing its size, otherwise collection after resize will be empty.</param>
+    void SetCapacity(int32 capacity, bool preserveContents = true)
+    {
+        ASSERT(capacity >= 0);
+        capacity = Math::AlignUp(capacity, SOA_ARRAY_CAPACITY_GRANULARITY);
+        if (capacity == _capacity)
+            return;
+        const int32 count = preserveContents ? Math::Min(_count, capacity) : 0;
+        void* fields[FieldsCount] = {};
+        void* memory = nullptr;
+        if (capacity != 0)
+        {
+            const uint64 size = Ops::Layout(fields, nullptr, capacity, 0);
+            memory = Allocator::Allocate(size, SOA_ARRAY_ALIGNMENT);
+            if (!memory)
+                OUT_OF_MEMORY;
+            Ops::Layout(fields, (byte*)memory, capacity, 0);
+            Ops::Move(fields, _fields, count);
+        }
+        Ops::Destruct(_fields, count, _count - count);
+        Allocator::Free(_memory);
+        _memory = memory;
+        Platform::MemoryCopy(_fields, fields, sizeof(_fields));
+        _capacity = capacity;
+        _count = count;
+    }
+
+    /// <summary>
+    /// Ensures the collection has given capacity (or more).
+    /// </summary>
+    /// <param name="minCapacity">The minimum capacity.</param>
+    /// <param name="preserveContents">True if preserve collection data when changing its size, otherwise collection after resize will be empty.</param>
+    void EnsureCapacity(int32 minCapacity, bool preserveContents = true)
+    {
+        if (_capacity < minCapacity)
+            SetCapacity(Math::Max(minCapacity, _capacity * 2), preserveContents);
+    }
+
+    /// <summary>
+    /// Swaps the contents of collection with the other object without copy operation. Performs fast internal data exchange.
+    /// </summary>
+    /// <param name="other">The other collection.</param>
+    void Swap(SoAArray& other)
+    {
+        ::Swap(_count, other._count);
+        ::Swap(_capacity, other._capacity);
+        ::Swap(_memory, other._memory);
+        for (int32 i = 0; i < FieldsCount; i++)
+            ::Swap(_fields[i], other._fields[i]);
+    }
+};
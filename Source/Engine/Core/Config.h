@@ -35,6 +35,14 @@
 // Enable crash reporting service (stack trace and crash dump collecting)
 #define CRASH_LOG_ENABLE (!BUILD_RELEASE)
 
+// Enable locks contention profiling (wait and hold times per named lock, see ProfilerLocks). Adds overhead to every named lock so it's disabled by default.
+#ifndef COMPILE_WITH_LOCK_PROFILER
+#define COMPILE_WITH_LOCK_PROFILER 0
+#elif !COMPILE_WITH_PROFILER
+#undef COMPILE_WITH_LOCK_PROFILER
+#define COMPILE_WITH_LOCK_PROFILER 0
+#endif
+
 // Enable/disable assertion
 #define ENABLE_ASSERTION (!BUILD_RELEASE)
 
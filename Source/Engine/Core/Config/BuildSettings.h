@@ -7,6 +7,7 @@
 #include "Engine/Content/Asset.h"
 #include "Engine/Content/AssetReference.h"
 #include "Engine/Content/SceneReference.h"
+#include "Engine/Graphics/Enums.h"
 
 /// <summary>
 /// The game building rendering settings.
@@ -83,12 +84,42 @@ API_CLASS(sealed, Namespace="FlaxEditor.Content.Settings") class FLAXENGINE_API
     API_FIELD(Attributes="EditorOrder(2010), EditorDisplay(\"Content\")")
     bool ShadersGenerateDebugData = false;
 
+    /// <summary>
+    /// If checked, shader permutations that cannot be reached by the cooked game (eg. shadows quality levels above the Max Shadows Quality) are not compiled. Reduces build size and cooking time.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(2020), EditorDisplay(\"Content\")")
+    bool StripShaderPermutations = false;
+
+    /// <summary>
+    /// The maximum shadows quality that can be used by the cooked game (see Graphics.ShadowsQuality). Higher quality shader permutations are stripped if Strip Shader Permutations is checked. Default shadows quality from the Graphics Settings is always included.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(2030), EditorDisplay(\"Content\"), VisibleIf(nameof(StripShaderPermutations))")
+    Quality MaxShadowsQuality = Quality::Ultra;
+
     /// <summary>
     /// If checked, skips bundling default engine fonts for UI. Use if to reduce build size if you don't use default engine fonts but custom ones only.
     /// </summary>
     API_FIELD(Attributes="EditorOrder(2100), EditorDisplay(\"Content\")")
     bool SkipDefaultFonts = false;
 
+    /// <summary>
+    /// If checked, small json assets are compressed with the dictionaries shared by the assets of the same type within the package. Improves compression ratio of many small assets (eg. prefabs or game data assets).
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(2110), EditorDisplay(\"Content\")")
+    bool UseCompressionDictionaries = true;
+
+    /// <summary>
+    /// If checked, models and skinned models mesh data is compressed in the packages. Reduces build size and disk reads at the cost of decompression when loading meshes.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(2120), EditorDisplay(\"Content\")")
+    bool CompressMeshData = false;
+
+    /// <summary>
+    /// If checked, textures data is compressed in the packages (bytes of the GPU format blocks are grouped by the offset within the block before compression). Reduces build size and disk reads at the cost of decompression when streaming textures.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(2130), EditorDisplay(\"Content\")")
+    bool CompressTextureData = false;
+
     /// <summary>
     /// If checked, .NET Runtime won't be packaged with a game and will be required by user to be installed on system upon running game build. Available only on supported platforms such as Windows, Linux and macOS.
     /// </summary>
@@ -65,6 +65,66 @@ API_CLASS(sealed, Namespace="FlaxEditor.Content.Settings", NoConstructor) class
     API_FIELD(Attributes="EditorOrder(1320), DefaultValue(false), EditorDisplay(\"Quality\", \"Allow CSM Blending\")")
     bool AllowCSMBlending = false;
 
+    /// <summary>
+    /// Enables caching the static geometry depth of the point and spot light shadow maps (in a shadow atlas with per-light tiles scaled by the light screen size). Only dynamic objects are redrawn every frame, unless light or static objects around it change.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(1325), DefaultValue(false), EditorDisplay(\"Quality\", \"Static Shadows Caching\")")
+    bool StaticShadowsCaching = false;
+
+    /// <summary>
+    /// Enables GPU-driven culling of the instanced draw calls (eg. many static meshes using the same model). Instances are culled and compacted by the compute shader and drawn with indirect draw calls.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(1330), DefaultValue(false), EditorDisplay(\"Quality\", \"GPU-Driven Culling\")")
+    bool GPUDrivenCulling = false;
+
+    /// <summary>
+    /// Enables occlusion culling of the objects hidden behind the other geometry. Uses the hierarchical depth buffer (HiZ) of the previous frame to cull objects on a CPU and within GPU-driven culling.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(1340), DefaultValue(false), EditorDisplay(\"Quality\", \"Occlusion Culling\")")
+    bool OcclusionCulling = false;
+
+    /// <summary>
+    /// Enables recording of the scene draw calls from multiple job threads into the parallel GPU contexts (if supported by the graphics backend). Reduces rendering thread time for scenes with a lot of draw calls.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(1350), DefaultValue(false), EditorDisplay(\"Quality\", \"Parallel Command Recording\")")
+    bool ParallelCommandRecording = false;
+
+    /// <summary>
+    /// Enables running the compute passes (eg. Global SDF) on the async compute queue (if supported by the graphics backend) to overlap them with the graphics work (eg. shadow maps rendering).
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(1360), DefaultValue(false), EditorDisplay(\"Quality\", \"Async Compute\")")
+    bool AsyncCompute = false;
+
+    /// <summary>
+    /// Enables variable rate shading (if supported by the GPU) that lowers the shading rate of the screen regions with low contrast or fast motion (based on the previous frame). Improves performance in the GPU-bound scenes.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(1370), DefaultValue(false), EditorDisplay(\"Quality\", \"Variable Rate Shading\")")
+    bool VariableRateShading = false;
+
+    /// <summary>
+    /// Enables submitting the GPU commands and presenting the frame on a job thread while the next frame gets updated (game logic and rendering submission overlap). Code that uses the main GPU context outside the frame drawing needs to call GPUDevice::WaitForPresent first.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(1380), DefaultValue(false), EditorDisplay(\"Quality\", \"Async Present\")")
+    bool AsyncPresent = false;
+
+    /// <summary>
+    /// Enables checkerboard rendering of the screen-space effects that support it (eg. screen space reflections ray tracing). Each frame renders only half of the pixels and the rest is reconstructed from the previous frame using motion vectors.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(1390), DefaultValue(false), EditorDisplay(\"Quality\", \"Checkerboard Rendering\")")
+    bool CheckerboardRendering = false;
+
+    /// <summary>
+    /// Enables pre-skinning of the animated models with a compute shader. Skinned vertices are written once per frame into the cached vertex buffers and all passes (eg. GBuffer, shadow maps) draw them as static meshes, instead of skinning the vertices in every pass.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(1400), DefaultValue(false), EditorDisplay(\"Quality\", \"Compute Pre-Skinning\")")
+    bool PreSkinning = false;
+
+    /// <summary>
+    /// Enables the global bones palette. Bone matrices of all animated models drawn within a frame are stored in a single buffer uploaded with a single copy, instead of updating a separate buffer per model.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(1410), DefaultValue(false), EditorDisplay(\"Quality\", \"Global Bones Palette\")")
+    bool GlobalBonesPalette = false;
+
     /// <summary>
     /// Default probes cubemap resolution (use for Environment Probes, can be overriden per-actor).
     /// </summary>
@@ -77,6 +137,18 @@ API_CLASS(sealed, Namespace="FlaxEditor.Content.Settings", NoConstructor) class
     API_FIELD(Attributes = "EditorOrder(1502), EditorDisplay(\"Quality\")")
     bool UseHDRProbes = false;
 
+    /// <summary>
+    /// The GPU time budget (in milliseconds) per frame for updating the realtime Environment Probes. The probe update (cube faces rendering and filtering) is spread across frames to fit the budget and the probes closer to the camera are updated first.
+    /// </summary>
+    API_FIELD(Attributes = "EditorOrder(1503), Limit(0.1f, 100.0f, 0.1f), EditorDisplay(\"Quality\")")
+    float RealtimeProbesBudget = 2.0f;
+
+    /// <summary>
+    /// If checked, realtime Environment Probes are compressed on the GPU into the BC6H format. Reduces the probes memory usage and bandwidth (4-8 times) at the small cost of the quality.
+    /// </summary>
+    API_FIELD(Attributes = "EditorOrder(1504), EditorDisplay(\"Quality\")")
+    bool CompressRealtimeProbes = true;
+
     /// <summary>
     /// If checked, enables Global SDF rendering. This can be used in materials, shaders, and particles.
     /// </summary>
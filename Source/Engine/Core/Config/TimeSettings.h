@@ -3,6 +3,7 @@
 #pragma once
 
 #include "Engine/Core/Config/Settings.h"
+#include "Engine/Engine/FramePacer.h"
 
 /// <summary>
 /// Time and game simulation settings container.
@@ -43,6 +44,12 @@ API_CLASS(sealed, Namespace="FlaxEditor.Content.Settings") class FLAXENGINE_API
     API_FIELD(Attributes="EditorOrder(20), Limit(0.1f, 1000.0f, 0.01f), EditorDisplay(\"General\")")
     float MaxUpdateDeltaTime = 0.1f;
 
+    /// <summary>
+    /// The main loop frame pacing mode. Precise pacing gives even frame times at high refresh rates, low latency mode additionally delays the frame start (and input sampling) to reduce the input latency.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(30), EditorDisplay(\"General\")")
+    FramePacingMode FramePacing = FramePacingMode::Precise;
+
 public:
     /// <summary>
     /// Gets the instance of the settings asset (default value if missing). Object returned by this method is always loaded with valid data to use.
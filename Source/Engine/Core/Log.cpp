@@ -8,6 +8,9 @@
 #include "Engine/Engine/Globals.h"
 #include "Engine/Platform/FileSystem.h"
 #include "Engine/Platform/CriticalSection.h"
+#include "Engine/Platform/ConditionVariable.h"
+#include "Engine/Platform/Thread.h"
+#include "Engine/Threading/IRunnable.h"
 #include "Engine/Serialization/FileWriteStream.h"
 #include "Engine/Debug/Exceptions/Exceptions.h"
 #if USE_EDITOR
@@ -17,13 +20,166 @@
 
 #define LOG_ENABLE_FILE (!PLATFORM_SWITCH)
 
+// The capacity of the pending log messages queue (must be power of two)
+#define LOG_QUEUE_SIZE 4096
+
+// The maximum time (in milliseconds) the log thread waits for the new messages
+#define LOG_THREAD_WAIT_TIME 100
+
 namespace
 {
-    bool LogAfterInit = false, IsDuringLog = false;
+    struct LogQueueEntry
+    {
+        // Even value (2 * turn) if free to write in the given queue turn, odd value (2 * turn + 1) if message is ready to read
+        volatile int64 Sequence;
+        Char* Data;
+        int32 Length;
+    };
+
+    bool LogAfterInit = false;
+    THREADLOCAL bool IsDuringLog = false;
     int LogTotalErrorsCnt = 0;
     FileWriteStream* LogFile = nullptr;
-    CriticalSection LogLocker;
+    CriticalSection LogLocker("Log");
     DateTime LogStartTime;
+    Thread* LogThread = nullptr;
+    volatile int64 LogThreadExit = 0;
+    volatile int64 LogFlushRequested = 0;
+    CriticalSection LogSignalLocker;
+    ConditionVariable LogSignal;
+    volatile int64 LogQueueHead = 0;
+    volatile int64 LogQueueTail = 0;
+    LogQueueEntry LogQueue[LOG_QUEUE_SIZE];
+
+    // Lock-free multi-producer queue push, returns false if the queue is full
+    bool EnqueueMessage(Char* data, int32 length)
+    {
+        int64 pos = Platform::AtomicRead(&LogQueueHead);
+        while (true)
+        {
+            LogQueueEntry& entry = LogQueue[pos & (LOG_QUEUE_SIZE - 1)];
+            const int64 turn = (pos / LOG_QUEUE_SIZE) * 2;
+            const int64 sequence = Platform::AtomicRead(&entry.Sequence);
+            if (sequence == turn)
+            {
+                const int64 prev = Platform::InterlockedCompareExchange(&LogQueueHead, pos + 1, pos);
+                if (prev == pos)
+                {
+                    entry.Data = data;
+                    entry.Length = length;
+                    Platform::AtomicStore(&entry.Sequence, turn + 1);
+                    return true;
+                }
+                pos = prev;
+            }
+            else if (sequence < turn)
+            {
+                // Not yet read from the previous turn
+                return false;
+            }
+            else
+            {
+                pos = Platform::AtomicRead(&LogQueueHead);
+            }
+        }
+    }
+
+    void WriteMessage(const Char* ptr, int32 length)
+    {
+        // Send message to standard process output
+        if (CommandLine::Options.Std)
+        {
+#if PLATFORM_TEXT_IS_CHAR16
+            StringAnsi ansi(ptr, length);
+            ansi += PLATFORM_LINE_TERMINATOR;
+            printf("%s", ansi.Get());
+#else
+            std::wcout.write(ptr, length);
+            std::wcout.write(TEXT(PLATFORM_LINE_TERMINATOR), ARRAY_COUNT(PLATFORM_LINE_TERMINATOR) - 1);
+#endif
+        }
+
+        // Send message to platform logging
+        Platform::Log(StringView(ptr, length));
+
+        // Write message to log file
+        if (LogAfterInit)
+        {
+            LogFile->WriteBytes(ptr, length * sizeof(Char));
+            LogFile->WriteBytes(TEXT(PLATFORM_LINE_TERMINATOR), (ARRAY_COUNT(PLATFORM_LINE_TERMINATOR) - 1) * sizeof(Char));
+        }
+    }
+
+    // Writes all pending messages to the outputs (LogLocker must be locked), returns the amount of written messages
+    int32 DrainQueue()
+    {
+        if (IsDuringLog)
+            return 0;
+        IsDuringLog = true;
+        int32 count = 0;
+        while (true)
+        {
+            const int64 pos = Platform::AtomicRead(&LogQueueTail);
+            LogQueueEntry& entry = LogQueue[pos & (LOG_QUEUE_SIZE - 1)];
+            const int64 turn = (pos / LOG_QUEUE_SIZE) * 2;
+            if (Platform::AtomicRead(&entry.Sequence) != turn + 1)
+                break;
+            Char* data = entry.Data;
+            const int32 length = entry.Length;
+            Platform::AtomicStore(&entry.Sequence, turn + 2);
+            Platform::AtomicStore(&LogQueueTail, pos + 1);
+            WriteMessage(data, length);
+            Allocator::Free(data);
+            count++;
+        }
+        IsDuringLog = false;
+        return count;
+    }
+
+    void FlushFile()
+    {
+        Platform::AtomicStore(&LogFlushRequested, 0);
+        if (LogFile)
+            LogFile->Flush();
+    }
+
+    class LogThreadRunnable : public IRunnable
+    {
+    public:
+        // [IRunnable]
+        String ToString() const override
+        {
+            return TEXT("LogThread");
+        }
+
+        int32 Run() override
+        {
+            while (Platform::AtomicRead(&LogThreadExit) == 0)
+            {
+                LogLocker.Lock();
+                const int32 count = DrainQueue();
+#if LOG_ENABLE_AUTO_FLUSH
+                // Flush once per batch of messages rather than after every line
+                if (count != 0 || Platform::AtomicRead(&LogFlushRequested) != 0)
+#else
+                if (Platform::AtomicRead(&LogFlushRequested) != 0)
+#endif
+                    FlushFile();
+                LogLocker.Unlock();
+
+                LogSignalLocker.Lock();
+                if (Platform::AtomicRead(&LogQueueHead) == Platform::AtomicRead(&LogQueueTail) && Platform::AtomicRead(&LogFlushRequested) == 0 && Platform::AtomicRead(&LogThreadExit) == 0)
+                    LogSignal.Wait(LogSignalLocker, LOG_THREAD_WAIT_TIME);
+                LogSignalLocker.Unlock();
+            }
+            return 0;
+        }
+
+        void AfterWork(bool wasKilled) override
+        {
+            Delete(this);
+        }
+    };
 }
 
 String Log::Logger::LogFilePath;
@@ -34,6 +190,13 @@ bool Log::Logger::Init()
 {
     LogStartTime = Time::StartupTime;
 
+    // Start the background thread that writes the log messages
+    if (!LogThread)
+    {
+        Platform::AtomicStore(&LogThreadExit, 0);
+        LogThread = Thread::Create(New<LogThreadRunnable>(), TEXT("Log"), ThreadPriority::BelowNormal);
+    }
+
     // Skip if disabled
     if (!IsLogEnabled())
         return false;
@@ -105,47 +268,35 @@ bool Log::Logger::Init()
 
 void Log::Logger::Write(const StringView& msg)
 {
-    const auto ptr = msg.Get();
     const auto length = msg.Length();
-    if (length <= 0)
+    if (length <= 0 || IsDuringLog)
         return;
 
-    LogLocker.Lock();
-    if (IsDuringLog)
+    // Copy message to the queue for the log thread so the caller doesn't wait for the I/O
+    Char* data = (Char*)Allocator::Allocate(length * sizeof(Char));
+    Platform::MemoryCopy(data, msg.Get(), length * sizeof(Char));
+    while (!EnqueueMessage(data, length))
     {
+        // Queue is full so help the log thread with writing the messages
+        LogLocker.Lock();
+        DrainQueue();
         LogLocker.Unlock();
-        return;
     }
-    IsDuringLog = true;
 
-    // Send message to standard process output
-    if (CommandLine::Options.Std)
+    if (LogThread)
     {
-#if PLATFORM_TEXT_IS_CHAR16
-        StringAnsi ansi(msg);
-        ansi += PLATFORM_LINE_TERMINATOR;
-        printf("%s", ansi.Get());
-#else
-        std::wcout.write(ptr, length);
-        std::wcout.write(TEXT(PLATFORM_LINE_TERMINATOR), ARRAY_COUNT(PLATFORM_LINE_TERMINATOR) - 1);
-#endif
+        LogSignal.NotifyOne();
     }
-
-    // Send message to platform logging
-    Platform::Log(msg);
-
-    // Write message to log file
-    if (LogAfterInit)
+    else
     {
-        LogFile->WriteBytes(ptr, length * sizeof(Char));
-        LogFile->WriteBytes(TEXT(PLATFORM_LINE_TERMINATOR), (ARRAY_COUNT(PLATFORM_LINE_TERMINATOR) - 1) * sizeof(Char));
+        // Write message directly before the log thread start and after its end
+        LogLocker.Lock();
+        DrainQueue();
 #if LOG_ENABLE_AUTO_FLUSH
-        LogFile->Flush();
+        FlushFile();
 #endif
+        LogLocker.Unlock();
     }
-
-    IsDuringLog = false;
-    LogLocker.Unlock();
 }
 
 void Log::Logger::Write(const Exception& exception)
@@ -155,13 +306,27 @@ void Log::Logger::Write(const Exception& exception)
 
 void Log::Logger::Dispose()
 {
-    LogLocker.Lock();
-
     // Write ending info
     WriteFloor();
     Write(String::Format(TEXT(" Total errors: {0}\n Closing file"), LogTotalErrorsCnt, DateTime::Now().ToString()));
     WriteFloor();
 
+    // Stop the log thread
+    if (LogThread)
+    {
+        Thread* thread = LogThread;
+        LogThread = nullptr;
+        Platform::AtomicStore(&LogThreadExit, 1);
+        LogSignalLocker.Lock();
+        LogSignal.NotifyAll();
+        LogSignalLocker.Unlock();
+        thread->Join();
+        Delete(thread);
+    }
+
+    LogLocker.Lock();
+    DrainQueue();
+
     // Close
     if (LogAfterInit)
     {
@@ -185,9 +350,10 @@ bool Log::Logger::IsLogEnabled()
 
 void Log::Logger::Flush()
 {
+    // Write all pending messages on the calling thread (eg. on crash the log thread might never get to them)
     LogLocker.Lock();
-    if (LogFile)
-        LogFile->Flush();
+    DrainQueue();
+    FlushFile();
     LogLocker.Unlock();
 }
 
@@ -251,9 +417,19 @@ void Log::Logger::Write(LogType type, const StringView& msg)
         OnError(type, msg);
     }
 
-    // Ensure the error gets written to the disk
-    if (type == LogType::Fatal || type == LogType::Error)
-        Flush();
+    // Ensure the error gets written to the disk (fatal error flushes immediately as the process is going down)
+    if (isError)
+    {
+        if (type == LogType::Fatal || !LogThread)
+        {
+            Flush();
+        }
+        else
+        {
+            Platform::AtomicStore(&LogFlushRequested, 1);
+            LogSignal.NotifyOne();
+        }
+    }
 
     // Check if need to show message box with that log message
     if (type == LogType::Fatal)
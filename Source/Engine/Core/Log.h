@@ -7,7 +7,7 @@
 #include "Engine/Core/Types/String.h"
 #include "Engine/Core/Types/StringView.h"
 
-// Enable/disable auto flush function
+// Enable/disable auto flush function (log file is flushed after every batch of written messages)
 #define LOG_ENABLE_AUTO_FLUSH 1
 
 /// <summary>
@@ -111,7 +111,7 @@ namespace Log
         static bool IsLogEnabled();
 
         /// <summary>
-        /// Flushes log file with a memory buffer.
+        /// Writes all the pending log messages and flushes log file with a memory buffer. Blocks the calling thread until it's done.
         /// </summary>
         static void Flush();
 
@@ -171,6 +171,7 @@ namespace Log
         /// <summary>
         /// Writes a custom message to the log.
         /// </summary>
+        /// <remarks>The message is queued and written to the outputs (file, console and platform log) on a log thread. Use Flush to write it immediately.</remarks>
         /// <param name="msg">The message text.</param>
         static void Write(const StringView& msg);
 
@@ -0,0 +1,76 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "FrustumCulling.h"
+#include "Engine/Core/SIMD.h"
+
+static_assert(FrustumCulling::BatchSize % 4 == 0, "Culling batch size has to be multiple of SIMD vector width.");
+
+void FrustumCulling::Planes::Setup(const BoundingFrustum& frustum)
+{
+    for (int32 i = 0; i < 6; i++)
+    {
+        const Plane plane = frustum.GetPlane(i);
+        for (int32 j = 0; j < 4; j++)
+        {
+            NormalX[i][j] = (float)plane.Normal.X;
+            NormalY[i][j] = (float)plane.Normal.Y;
+            NormalZ[i][j] = (float)plane.Normal.Z;
+            D[i][j] = (float)plane.D;
+        }
+    }
+}
+
+namespace
+{
+    FORCE_INLINE int32 CullSpheres4(const FrustumCulling::Planes& planes, SimdVector4 centerX, SimdVector4 centerY, SimdVector4 centerZ, SimdVector4 radius)
+    {
+        // Sphere is outside if it's behind any plane (distance to plane < -radius), sign bit of (distance + radius) gives the result for 4 spheres at once
+        int32 outside = 0;
+        for (int32 i = 0; i < 6; i++)
+        {
+            SimdVector4 distance = SIMD::Mul(SIMD::Load(planes.NormalX[i]), centerX);
+            distance = SIMD::Add(distance, SIMD::Mul(SIMD::Load(planes.NormalY[i]), centerY));
+            distance = SIMD::Add(distance, SIMD::Mul(SIMD::Load(planes.NormalZ[i]), centerZ));
+            distance = SIMD::Add(distance, SIMD::Load(planes.D[i]));
+            outside |= SIMD::MoveMask(SIMD::Add(distance, radius));
+        }
+        return ~outside & 0xf;
+    }
+
+    FORCE_INLINE uint64 GetBatchMask(int32 count)
+    {
+        return count >= FrustumCulling::BatchSize ? ~0ull : (1ull << count) - 1;
+    }
+}
+
+uint64 FrustumCulling::CullSpheres(const Planes& planes, const Spheres& spheres)
+{
+    uint64 result = 0;
+    for (int32 i = 0; i < spheres.Count; i += 4)
+    {
+        const SimdVector4 centerX = SIMD::Load(spheres.CenterX + i);
+        const SimdVector4 centerY = SIMD::Load(spheres.CenterY + i);
+        const SimdVector4 centerZ = SIMD::Load(spheres.CenterZ + i);
+        const SimdVector4 radius = SIMD::Load(spheres.Radius + i);
+        result |= (uint64)CullSpheres4(planes, centerX, centerY, centerZ, radius) << i;
+    }
+    return result & GetBatchMask(spheres.Count);
+}
+
+uint64 FrustumCulling::CullSpheres(const Planes* planes, int32 planesCount, const Spheres& spheres)
+{
+    const uint64 batchMask = GetBatchMask(spheres.Count);
+    uint64 result = 0;
+    for (int32 i = 0; i < spheres.Count; i += 4)
+    {
+        const SimdVector4 centerX = SIMD::Load(spheres.CenterX + i);
+        const SimdVector4 centerY = SIMD::Load(spheres.CenterY + i);
+        const SimdVector4 centerZ = SIMD::Load(spheres.CenterZ + i);
+        const SimdVector4 radius = SIMD::Load(spheres.Radius + i);
+        int32 visible = 0;
+        for (int32 j = 0; j < planesCount && visible != 0xf; j++)
+            visible |= CullSpheres4(planes[j], centerX, centerY, centerZ, radius);
+        result |= (uint64)visible << i;
+    }
+    return result & batchMask;
+}
@@ -0,0 +1,124 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "BoundingFrustum.h"
+#include "BoundingSphere.h"
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+/// <summary>
+/// Batched frustum culling utilities. Tests multiple bounding spheres (stored in SoA layout) against frustum planes at once using SIMD and outputs the visibility bitmask.
+/// </summary>
+class FLAXENGINE_API FrustumCulling
+{
+public:
+    enum
+    {
+        // The maximum amount of spheres in a single batch (bits in visibility mask).
+        BatchSize = 64,
+    };
+
+    /// <summary>
+    /// The frustum planes prepared for SIMD tests (in SoA layout, each plane component replicated 4 times).
+    /// </summary>
+    struct alignas(16) Planes
+    {
+        float NormalX[6][4];
+        float NormalY[6][4];
+        float NormalZ[6][4];
+        float D[6][4];
+
+        Planes()
+        {
+        }
+
+        Planes(const BoundingFrustum& frustum)
+        {
+            Setup(frustum);
+        }
+
+        void Setup(const BoundingFrustum& frustum);
+    };
+
+    /// <summary>
+    /// The batch of bounding spheres in SoA layout (single precision, relative to the view origin).
+    /// </summary>
+    struct alignas(16) Spheres
+    {
+        float CenterX[BatchSize];
+        float CenterY[BatchSize];
+        float CenterZ[BatchSize];
+        float Radius[BatchSize];
+        int32 Count = 0;
+
+        FORCE_INLINE bool IsFull() const
+        {
+            return Count == BatchSize;
+        }
+
+        FORCE_INLINE void Clear()
+        {
+            Count = 0;
+        }
+
+        FORCE_INLINE void Add(const BoundingSphere& sphere)
+        {
+            CenterX[Count] = (float)sphere.Center.X;
+            CenterY[Count] = (float)sphere.Center.Y;
+            CenterZ[Count] = (float)sphere.Center.Z;
+            Radius[Count] = (float)sphere.Radius;
+            Count++;
+        }
+
+        FORCE_INLINE void Add(const BoundingSphere& sphere, const Vector3& origin)
+        {
+            CenterX[Count] = (float)(sphere.Center.X - origin.X);
+            CenterY[Count] = (float)(sphere.Center.Y - origin.Y);
+            CenterZ[Count] = (float)(sphere.Center.Z - origin.Z);
+            Radius[Count] = (float)sphere.Radius;
+            Count++;
+        }
+
+        FORCE_INLINE void Set(int32 index, const BoundingSphere& sphere)
+        {
+            CenterX[index] = (float)sphere.Center.X;
+            CenterY[index] = (float)sphere.Center.Y;
+            CenterZ[index] = (float)sphere.Center.Z;
+            Radius[index] = (float)sphere.Radius;
+        }
+    };
+
+public:
+    /// <summary>
+    /// Tests the spheres batch against the frustum.
+    /// </summary>
+    /// <param name="planes">The frustum planes.</param>
+    /// <param name="spheres">The spheres batch.</param>
+    /// <returns>The visibility mask (bit at index of each sphere that intersects or is contained by the frustum).</returns>
+    static uint64 CullSpheres(const Planes& planes, const Spheres& spheres);
+
+    /// <summary>
+    /// Tests the spheres batch against the list of frustums (eg. all render views in a batch).
+    /// </summary>
+    /// <param name="planes">The frustums planes.</param>
+    /// <param name="planesCount">The amount of frustums.</param>
+    /// <param name="spheres">The spheres batch.</param>
+    /// <returns>The visibility mask (bit at index of each sphere that intersects any of the frustums).</returns>
+    static uint64 CullSpheres(const Planes* planes, int32 planesCount, const Spheres& spheres);
+
+    /// <summary>
+    /// Gets the index of the lowest set bit in the visibility mask (mask cannot be zero). Used to iterate over visible items.
+    /// </summary>
+    FORCE_INLINE static int32 GetFirstVisible(uint64 mask)
+    {
+#if defined(_MSC_VER) && !defined(__clang__)
+        unsigned long index;
+        _BitScanForward64(&index, mask);
+        return (int32)index;
+#else
+        return __builtin_ctzll(mask);
+#endif
+    }
+};
@@ -0,0 +1,135 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "Allocation.h"
+#include "Engine/Platform/Platform.h"
+
+#define FRAME_ALLOCATOR_PAGE_SIZE (256 * 1024)
+#define FRAME_ALLOCATOR_MAX_SIZE (FRAME_ALLOCATOR_PAGE_SIZE / 4) // Bigger allocations use heap
+#define FRAME_ALLOCATOR_ALIGNMENT 16
+
+namespace
+{
+    struct FrameArena;
+
+    struct FramePage
+    {
+        FramePage* Next;
+        uint64 Padding;
+    };
+
+    // Header placed before each allocation
+    struct FrameAllocationHeader
+    {
+        // Arena that owns the allocation (null if allocated from heap)
+        FrameArena* Arena;
+        uint64 Size;
+    };
+
+    static_assert(sizeof(FramePage) % FRAME_ALLOCATOR_ALIGNMENT == 0, "Invalid frame allocator page header size.");
+    static_assert(sizeof(FrameAllocationHeader) == FRAME_ALLOCATOR_ALIGNMENT, "Invalid frame allocator header size.");
+
+    // Per-thread arena (POD to be used as thread-local)
+    struct FrameArena
+    {
+        FramePage* First;
+        FramePage* Current;
+        uint64 Offset;
+        void* Last;
+        // Amount of allocations not yet freed (can be decremented by other threads)
+        volatile int64 LiveCount;
+    };
+
+    THREADLOCAL FrameArena Arena;
+
+    FORCE_INLINE uint64 AlignSize(uint64 size)
+    {
+        return (size + (FRAME_ALLOCATOR_ALIGNMENT - 1)) & ~(uint64)(FRAME_ALLOCATOR_ALIGNMENT - 1);
+    }
+}
+
+void* FrameAllocator::Allocate(uint64 size)
+{
+    const uint64 totalSize = AlignSize(size) + sizeof(FrameAllocationHeader);
+    FrameAllocationHeader* header;
+    if (totalSize > FRAME_ALLOCATOR_MAX_SIZE)
+    {
+        header = (FrameAllocationHeader*)Allocator::Allocate(totalSize, FRAME_ALLOCATOR_ALIGNMENT);
+        if (!header)
+            OUT_OF_MEMORY;
+        header->Arena = nullptr;
+        header->Size = size;
+        return header + 1;
+    }
+    FrameArena& arena = Arena;
+
+    // Reset arena in bulk once all memory has been freed (only the owning thread allocates so it's safe to rewind)
+    if (Platform::AtomicRead(&arena.LiveCount) == 0)
+    {
+        arena.Current = arena.First;
+        arena.Offset = sizeof(FramePage);
+        arena.Last = nullptr;
+    }
+
+    // Move to the next page if the current one is full
+    if (!arena.Current || arena.Offset + totalSize > FRAME_ALLOCATOR_PAGE_SIZE)
+    {
+        FramePage* page = arena.Current ? arena.Current->Next : nullptr;
+        if (!page)
+        {
+            page = (FramePage*)Allocator::Allocate(FRAME_ALLOCATOR_PAGE_SIZE, FRAME_ALLOCATOR_ALIGNMENT);
+            if (!page)
+                OUT_OF_MEMORY;
+            page->Next = nullptr;
+            if (arena.Current)
+                arena.Current->Next = page;
+            else
+                arena.First = page;
+        }
+        arena.Current = page;
+        arena.Offset = sizeof(FramePage);
+    }
+
+    header = (FrameAllocationHeader*)((byte*)arena.Current + arena.Offset);
+    header->Arena = &arena;
+    header->Size = size;
+    arena.Offset += totalSize;
+    arena.Last = header + 1;
+    Platform::InterlockedIncrement(&arena.LiveCount);
+    return header + 1;
+}
+
+void FrameAllocator::Free(void* ptr)
+{
+    if (!ptr)
+        return;
+    FrameAllocationHeader* header = (FrameAllocationHeader*)ptr - 1;
+    FrameArena* arena = header->Arena;
+    if (!arena)
+    {
+        Allocator::Free(header);
+        return;
+    }
+
+    // Pop the last allocation when freed on the owning thread (eg. temporary array inside a loop)
+    if (arena == &Arena && arena->Last == ptr)
+    {
+        arena->Offset = (uint64)((byte*)header - (byte*)arena->Current);
+        arena->Last = nullptr;
+    }
+    Platform::InterlockedDecrement(&arena->LiveCount);
+}
+
+bool FrameAllocator::Resize(void* ptr, uint64 size)
+{
+    FrameAllocationHeader* header = (FrameAllocationHeader*)ptr - 1;
+    FrameArena* arena = header->Arena;
+    if (arena != &Arena || arena->Last != ptr)
+        return false;
+    const uint64 offset = (uint64)((byte*)ptr - (byte*)arena->Current);
+    const uint64 newOffset = offset + AlignSize(size);
+    if (newOffset > FRAME_ALLOCATOR_PAGE_SIZE || AlignSize(size) + sizeof(FrameAllocationHeader) > FRAME_ALLOCATOR_MAX_SIZE)
+        return false;
+    header->Size = size;
+    arena->Offset = newOffset;
+    return true;
+}
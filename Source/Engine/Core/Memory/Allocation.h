@@ -173,6 +173,121 @@ class HeapAllocation
     };
 };
 
+/// <summary>
+/// The thread-local linear memory allocator for short-lived allocations (eg. temporary arrays used within a job or a single frame). Allocations are carved from per-thread memory pages by bumping the pointer and the whole thread arena gets reset in bulk once all of its allocations are freed (usually once per frame).
+/// </summary>
+/// <remarks>Memory can be freed from any thread. Big allocations fallback to the default heap allocator.</remarks>
+class FLAXENGINE_API FrameAllocator
+{
+public:
+    /// <summary>
+    /// Allocates memory from the current thread arena (aligned to 16 bytes).
+    /// </summary>
+    /// <param name="size">The size of the allocation (in bytes).</param>
+    /// <returns>The allocated memory.</returns>
+    static void* Allocate(uint64 size);
+
+    /// <summary>
+    /// Frees the memory allocated via FrameAllocator. Can be called from any thread.
+    /// </summary>
+    /// <param name="ptr">The pointer to the memory (can be null).</param>
+    static void Free(void* ptr);
+
+    /// <summary>
+    /// Tries to resize the allocation in-place (possible only for the last allocation from the current thread arena).
+    /// </summary>
+    /// <param name="ptr">The pointer to the memory.</param>
+    /// <param name="size">The new size of the allocation (in bytes).</param>
+    /// <returns>True if allocation has been resized, otherwise false.</returns>
+    static bool Resize(void* ptr, uint64 size);
+};
+
+/// <summary>
+/// The memory allocation policy that uses thread-local linear frame arena (see FrameAllocator). Use it for temporary collections (eg. within a job) to skip heap allocations on hot paths.
+/// </summary>
+class FrameAllocation
+{
+public:
+    enum { HasSwap = true };
+
+    template<typename T>
+    class Data
+    {
+    private:
+        T* _data = nullptr;
+
+    public:
+        FORCE_INLINE Data()
+        {
+        }
+
+        FORCE_INLINE ~Data()
+        {
+            FrameAllocator::Free(_data);
+        }
+
+        FORCE_INLINE T* Get()
+        {
+            return _data;
+        }
+
+        FORCE_INLINE const T* Get() const
+        {
+            return _data;
+        }
+
+        FORCE_INLINE int32 CalculateCapacityGrow(int32 capacity, int32 minCapacity) const
+        {
+            uint64 capacity64 = capacity ? (uint64)capacity * 2 : 16;
+            if (capacity64 < (uint64)minCapacity)
+                capacity64 = minCapacity;
+            if (capacity64 > MAX_int32)
+                capacity64 = MAX_int32;
+            return (int32)capacity64;
+        }
+
+        FORCE_INLINE void Allocate(int32 capacity)
+        {
+#if  ENABLE_ASSERTION_LOW_LAYERS
+            ASSERT(!_data);
+#endif
+            _data = (T*)FrameAllocator::Allocate(capacity * sizeof(T));
+        }
+
+        FORCE_INLINE void Relocate(int32 capacity, int32 oldCount, int32 newCount)
+        {
+            // Try to grow the last allocation in-place to skip items moving
+            if (_data && capacity != 0 && FrameAllocator::Resize(_data, capacity * sizeof(T)))
+            {
+                if (oldCount > newCount)
+                    Memory::DestructItems(_data + newCount, oldCount - newCount);
+                return;
+            }
+
+            T* newData = capacity != 0 ? (T*)FrameAllocator::Allocate(capacity * sizeof(T)) : nullptr;
+            if (oldCount)
+            {
+                if (newCount > 0)
+                    Memory::MoveItems(newData, _data, newCount);
+                Memory::DestructItems(_data, oldCount);
+            }
+            FrameAllocator::Free(_data);
+            _data = newData;
+        }
+
+        FORCE_INLINE void Free()
+        {
+            FrameAllocator::Free(_data);
+            _data = nullptr;
+        }
+
+        FORCE_INLINE void Swap(Data& other)
+        {
+            ::Swap(_data, other._data);
+        }
+    };
+};
+
 /// <summary>
 /// The memory allocation policy that uses inlined memory of the fixed size and supports using additional allocation to increase its capacity (eg. via heap allocation).
 /// </summary>
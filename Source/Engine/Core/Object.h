@@ -16,6 +16,8 @@ enum class ObjectFlags : uint32
     IsManagedType = 1 << 3,
     IsDuringPlay = 1 << 4,
     IsCustomScriptingType = 1 << 5,
+    IsPooled = 1 << 6,
+    AllowAsyncDelete = 1 << 7,
 };
 
 DECLARE_ENUM_OPERATORS(ObjectFlags);
@@ -2,12 +2,17 @@
 
 #include "ObjectsRemovalService.h"
 #include "Utilities.h"
+#include "Collections/Array.h"
 #include "Collections/Dictionary.h"
 #include "Engine/Engine/Time.h"
 #include "Engine/Engine/EngineService.h"
 #include "Engine/Platform/CriticalSection.h"
 #include "Engine/Profiler/ProfilerCPU.h"
 #include "Engine/Scripting/ScriptingObject.h"
+#include "Engine/Scripting/ManagedCLR/MCore.h"
+#include "Engine/Threading/JobSystem.h"
+
+#define ASYNC_BATCH_JOB_SIZE 64
 
 const Char* BytesSizesData[] = { TEXT("b"), TEXT("Kb"), TEXT("Mb"), TEXT("Gb"), TEXT("Tb"), TEXT("Pb"), TEXT("Eb"), TEXT("Zb"), TEXT("Yb") };
 const Char* HertzSizesData[] = { TEXT("Hz"), TEXT("KHz"), TEXT("MHz"), TEXT("GHz"), TEXT("THz"), TEXT("PHz"), TEXT("EHz"), TEXT("ZHz"), TEXT("YHz") };
@@ -21,8 +26,34 @@ namespace
     float LastUpdateGameTime;
     Dictionary<Object*, float> Pool(8192);
     uint64 PoolCounter = 0;
+    Array<Object*> AsyncBatch;
+    int64 AsyncBatchLabel = 0;
+
+    void DeleteAsyncBatchJob(int32 index)
+    {
+        PROFILE_CPU_NAMED("Delete Objects");
+        const int32 start = index * ASYNC_BATCH_JOB_SIZE;
+        const int32 end = Math::Min(start + ASYNC_BATCH_JOB_SIZE, AsyncBatch.Count());
+        MCore::GCHandle::BeginFreeBatch();
+        for (int32 i = start; i < end; i++)
+            AsyncBatch.Get()[i]->OnDeleteObject();
+        MCore::GCHandle::EndFreeBatch();
+    }
+
+    void WaitForAsyncBatch()
+    {
+        if (AsyncBatchLabel == 0)
+            return;
+        PROFILE_CPU_NAMED("Wait For Async Delete");
+        JobSystem::Wait(AsyncBatchLabel);
+        AsyncBatchLabel = 0;
+        AsyncBatch.Clear();
+    }
 }
 
+float ObjectsRemovalService::TimeBudget = 0.002f;
+int32 ObjectsRemovalService::AsyncBatchThreshold = 256;
+
 class ObjectsRemoval : public EngineService
 {
 public:
@@ -67,49 +98,72 @@ void ObjectsRemovalService::Add(Object* obj, float timeToLive, bool useGameTime)
     PoolLocker.Unlock();
 }
 
-void ObjectsRemovalService::Flush(float dt, float gameDelta)
+void ObjectsRemovalService::Flush(float dt, float gameDelta, float timeBudget)
 {
     PROFILE_CPU();
 
+    // Finish deleting the previous background batch (before deleting any other objects that might reference them)
+    WaitForAsyncBatch();
+
     PoolLocker.Lock();
-    PoolCounter = 0;
+    MCore::GCHandle::BeginFreeBatch();
 
-    // Update timeouts and delete objects that timed out
+    // Update timeouts
+    bool anyTimedOut = false;
     for (auto i = Pool.Begin(); i.IsNotEnd(); ++i)
     {
         auto& bucket = *i;
-        Object* obj = bucket.Key;
-        const float ttl = bucket.Value - ((obj->Flags & ObjectFlags::UseGameTimeForDelete) != ObjectFlags::None ? gameDelta : dt);
-        if (ttl <= 0.0f)
-        {
-            Pool.Remove(i);
-            obj->OnDeleteObject();
-        }
-        else
-        {
-            bucket.Value = ttl;
-        }
+        bucket.Value -= (bucket.Key->Flags & ObjectFlags::UseGameTimeForDelete) != ObjectFlags::None ? gameDelta : dt;
+        anyTimedOut |= bucket.Value <= 0.0f;
     }
 
-    // If any object was added to the pool while removing objects (by this thread) then retry removing any nested objects (but without delta time)
-    if (PoolCounter != 0)
+    // Delete objects that timed out (within the time budget, remaining objects will be deleted in the next flush)
+    const double deadline = timeBudget > 0.0f ? Platform::GetTimeSeconds() + timeBudget : 0.0;
+    int32 deletedCount = 0;
+    bool budgetExceeded = false;
+    while (anyTimedOut && !budgetExceeded)
     {
-    RETRY:
         PoolCounter = 0;
         for (auto i = Pool.Begin(); i.IsNotEnd(); ++i)
         {
-            if (i->Value <= 0.0f)
+            if (i->Value > 0.0f)
+                continue;
+            Object* obj = i->Key;
+            Pool.Remove(i);
+            if ((obj->Flags & ObjectFlags::AllowAsyncDelete) != ObjectFlags::None)
             {
-                Object* obj = i->Key;
-                Pool.Remove(i);
-                obj->OnDeleteObject();
+                AsyncBatch.Add(obj);
+                continue;
+            }
+            obj->OnDeleteObject();
+            if (deadline > 0.0 && (++deletedCount & 15) == 0 && Platform::GetTimeSeconds() >= deadline)
+            {
+                budgetExceeded = true;
+                break;
             }
         }
-        if (PoolCounter != 0)
-            goto RETRY;
+
+        // If any object was added to the pool while removing objects (by this thread) then retry removing any nested objects
+        anyTimedOut = PoolCounter != 0;
     }
 
     PoolLocker.Unlock();
+
+    // Delete objects with thread-safe destruction in a background
+    if (AsyncBatch.Count() >= AsyncBatchThreshold)
+    {
+        const int32 jobCount = (AsyncBatch.Count() + ASYNC_BATCH_JOB_SIZE - 1) / ASYNC_BATCH_JOB_SIZE;
+        AsyncBatchLabel = JobSystem::Dispatch(DeleteAsyncBatchJob, jobCount);
+    }
+    else if (AsyncBatch.HasItems())
+    {
+        for (Object* obj : AsyncBatch)
+            obj->OnDeleteObject();
+        AsyncBatch.Clear();
+    }
+
+    // Release managed handles of the deleted objects
+    MCore::GCHandle::EndFreeBatch();
 }
 
 bool ObjectsRemoval::Init()
@@ -129,13 +183,14 @@ void ObjectsRemoval::LateUpdate()
     float gameDelta = Time::Update.DeltaTime.GetTotalSeconds();
     if (Time::GetGamePaused())
         gameDelta = 0;
-    ObjectsRemovalService::Flush(dt, gameDelta);
+    ObjectsRemovalService::Flush(dt, gameDelta, ObjectsRemovalService::TimeBudget);
     LastUpdate = now;
 }
 
 void ObjectsRemoval::Dispose()
 {
-    // Collect new objects
+    // Collect new objects (job system is already disposed so delete everything on a main thread)
+    ObjectsRemovalService::AsyncBatchThreshold = MAX_int32;
     ObjectsRemovalService::Flush();
 
     // Delete all remaining objects
@@ -9,6 +9,17 @@
 /// </summary>
 class FLAXENGINE_API ObjectsRemovalService
 {
+public:
+    /// <summary>
+    /// The time budget (in seconds) for objects destruction during a single frame update. Objects that timed out but didn't fit into the budget are deleted in the next frames. Use 0 to disable limit.
+    /// </summary>
+    static float TimeBudget;
+
+    /// <summary>
+    /// The minimum amount of objects that can be deleted with ObjectFlags::AllowAsyncDelete at once to be moved into the background batch. Smaller batches are deleted on a main thread.
+    /// </summary>
+    static int32 AsyncBatchThreshold;
+
 public:
     /// <summary>
     /// Determines whether object has been registered in the pool for the removing.
@@ -42,9 +53,11 @@ class FLAXENGINE_API ObjectsRemovalService
     /// <summary>
     /// Flushes the objects pool.
     /// </summary>
+    /// <remarks>Objects with ObjectFlags::AllowAsyncDelete (thread-safe OnDeleteObject) can be deleted in a background batch which is finished before the next flush.</remarks>
     /// <param name="dt">The delta time (in seconds).</param>
     /// <param name="gameDelta">The game update delta time (in seconds).</param>
-    static void Flush(float dt, float gameDelta);
+    /// <param name="timeBudget">The time budget (in seconds) for objects destruction. Use 0 to delete all timed out objects.</param>
+    static void Flush(float dt, float gameDelta, float timeBudget = 0.0f);
 
     /// <summary>
     /// Forces the flush the all objects from the pool.
@@ -18,10 +18,13 @@
 #include "Engine/Graphics/RenderBuffers.h"
 #include "Engine/Graphics/RenderTools.h"
 #include "Engine/Graphics/DynamicBuffer.h"
+#include "Engine/Graphics/GPUBuffer.h"
 #include "Engine/Graphics/Shaders/GPUConstantBuffer.h"
 #include "Engine/Graphics/Shaders/GPUShader.h"
 #include "Engine/Animations/AnimationUtils.h"
 #include "Engine/Profiler/Profiler.h"
+#include "Engine/Threading/Threading.h"
+#include "Engine/Threading/ThreadLocal.h"
 #include "Engine/Debug/DebugLog.h"
 #include "Engine/Render2D/Render2D.h"
 #include "Engine/Render2D/FontAsset.h"
@@ -31,6 +34,7 @@
 
 // Debug draw service configuration
 #define DEBUG_DRAW_INITIAL_VB_CAPACITY (4 * 1024)
+#define DEBUG_DRAW_INITIAL_INSTANCES_CAPACITY 256
 //
 #define DEBUG_DRAW_SPHERE_LOD0_RESOLUTION 64
 #define DEBUG_DRAW_SPHERE_LOD0_SCREEN_SIZE 0.2f
@@ -101,6 +105,36 @@ struct DebugTriangle
     float TimeLeft;
 };
 
+// Template meshes drawn with instancing (unit shapes transformed on a GPU)
+enum class DebugShape
+{
+    WireSphereLOD0,
+    WireSphereLOD1,
+    WireSphereLOD2,
+    WireBox,
+    Sphere,
+    Box,
+    MAX,
+    FirstSolid = Sphere,
+};
+
+// Instance of the template mesh (rows of the 3x4 affine transformation and color are uploaded to the GPU as-is)
+struct DebugShapeInstance
+{
+    Float4 Row0;
+    Float4 Row1;
+    Float4 Row2;
+    Color32 Color;
+    float TimeLeft;
+
+    void SetTransform(const Float3& center, const Float3& axisX, const Float3& axisY, const Float3& axisZ)
+    {
+        Row0 = Float4(axisX.X, axisY.X, axisZ.X, center.X);
+        Row1 = Float4(axisX.Y, axisY.Y, axisZ.Y, center.Y);
+        Row2 = Float4(axisX.Z, axisY.Z, axisZ.Z, center.Z);
+    }
+};
+
 struct DebugText2D
 {
     Array<Char, InlinedAllocation<64>> Text;
@@ -227,6 +261,26 @@ void TeleportList(const Float3& delta, Array<DebugText3D>& list)
     }
 }
 
+void TeleportList(const Float3& delta, Array<DebugShapeInstance>& list)
+{
+    for (auto& v : list)
+    {
+        v.Row0.W += delta.X;
+        v.Row1.W += delta.Y;
+        v.Row2.W += delta.Z;
+    }
+}
+
+template<typename T>
+void MergeList(Array<T>& dst, Array<T>& src)
+{
+    if (src.HasItems())
+    {
+        dst.Add(src.Get(), src.Count());
+        src.Clear();
+    }
+}
+
 struct DebugDrawData
 {
     Array<DebugLine> DefaultLines;
@@ -239,10 +293,12 @@ struct DebugDrawData
     Array<DebugText2D> OneFrameText2D;
     Array<DebugText3D> DefaultText3D;
     Array<DebugText3D> OneFrameText3D;
+    Array<DebugShapeInstance> DefaultShapes[(int32)DebugShape::MAX];
+    Array<DebugShapeInstance> OneFrameShapes[(int32)DebugShape::MAX];
 
     inline int32 Count() const
     {
-        return LinesCount() + TrianglesCount() + TextCount();
+        return LinesCount() + TrianglesCount() + TextCount() + ShapesCount();
     }
 
     inline int32 LinesCount() const
@@ -260,6 +316,22 @@ struct DebugDrawData
         return DefaultText2D.Count() + OneFrameText2D.Count() + DefaultText3D.Count() + OneFrameText3D.Count();
     }
 
+    inline int32 ShapesCount() const
+    {
+        int32 result = 0;
+        for (int32 i = 0; i < (int32)DebugShape::MAX; i++)
+            result += DefaultShapes[i].Count() + OneFrameShapes[i].Count();
+        return result;
+    }
+
+    inline DebugShapeInstance& AddShape(DebugShape shape, float duration)
+    {
+        auto& list = duration > 0 ? DefaultShapes[(int32)shape] : OneFrameShapes[(int32)shape];
+        auto& instance = list.AddOne();
+        instance.TimeLeft = duration;
+        return instance;
+    }
+
     inline void Add(const DebugTriangle& t)
     {
         if (t.TimeLeft > 0)
@@ -283,12 +355,35 @@ struct DebugDrawData
         UpdateList(deltaTime, DefaultWireTriangles);
         UpdateList(deltaTime, DefaultText2D);
         UpdateList(deltaTime, DefaultText3D);
+        for (auto& list : DefaultShapes)
+            UpdateList(deltaTime, list);
 
         OneFrameLines.Clear();
         OneFrameTriangles.Clear();
         OneFrameWireTriangles.Clear();
         OneFrameText2D.Clear();
         OneFrameText3D.Clear();
+        for (auto& list : OneFrameShapes)
+            list.Clear();
+    }
+
+    void Merge(DebugDrawData& other)
+    {
+        MergeList(DefaultLines, other.DefaultLines);
+        MergeList(OneFrameLines, other.OneFrameLines);
+        MergeList(DefaultTriangles, other.DefaultTriangles);
+        MergeList(OneFrameTriangles, other.OneFrameTriangles);
+        MergeList(DefaultWireTriangles, other.DefaultWireTriangles);
+        MergeList(OneFrameWireTriangles, other.OneFrameWireTriangles);
+        MergeList(DefaultText2D, other.DefaultText2D);
+        MergeList(OneFrameText2D, other.OneFrameText2D);
+        MergeList(DefaultText3D, other.DefaultText3D);
+        MergeList(OneFrameText3D, other.OneFrameText3D);
+        for (int32 i = 0; i < (int32)DebugShape::MAX; i++)
+        {
+            MergeList(DefaultShapes[i], other.DefaultShapes[i]);
+            MergeList(OneFrameShapes[i], other.OneFrameShapes[i]);
+        }
     }
 
     void Teleport(const Float3& delta)
@@ -301,6 +396,11 @@ struct DebugDrawData
         TeleportList(delta, OneFrameWireTriangles);
         TeleportList(delta, DefaultText3D);
         TeleportList(delta, OneFrameText3D);
+        for (int32 i = 0; i < (int32)DebugShape::MAX; i++)
+        {
+            TeleportList(delta, DefaultShapes[i]);
+            TeleportList(delta, OneFrameShapes[i]);
+        }
     }
 
     inline void Clear()
@@ -315,6 +415,11 @@ struct DebugDrawData
         OneFrameText2D.Clear();
         DefaultText3D.Clear();
         OneFrameText3D.Clear();
+        for (int32 i = 0; i < (int32)DebugShape::MAX; i++)
+        {
+            DefaultShapes[i].Clear();
+            OneFrameShapes[i].Clear();
+        }
     }
 
     inline void Release()
@@ -329,6 +434,11 @@ struct DebugDrawData
         OneFrameText2D.Resize(0);
         DefaultText3D.Resize(0);
         OneFrameText3D.Resize(0);
+        for (int32 i = 0; i < (int32)DebugShape::MAX; i++)
+        {
+            DefaultShapes[i].Resize(0);
+            OneFrameShapes[i].Resize(0);
+        }
     }
 };
 
@@ -341,10 +451,25 @@ struct DebugDrawContext
     Matrix LastViewProj = Matrix::Identity;
 };
 
+// Recording buffers of the thread other than the main thread (merged into the global context by the main thread)
+struct DebugDrawThreadContext
+{
+    CriticalSection Locker;
+    DebugDrawData DebugDrawDefault;
+    DebugDrawData DebugDrawDepthTest;
+};
+
+struct DebugDrawCall
+{
+    int32 StartVertex;
+    int32 VertexCount;
+};
+
 namespace
 {
     DebugDrawContext GlobalContext;
     DebugDrawContext* Context;
+    ThreadLocal<DebugDrawThreadContext*> ThreadContexts;
     AssetReference<Shader> DebugDrawShader;
     AssetReference<FontAsset> DebugDrawFont;
     PsData DebugDrawPsLinesDefault;
@@ -353,10 +478,18 @@ namespace
     PsData DebugDrawPsWireTrianglesDepthTest;
     PsData DebugDrawPsTrianglesDefault;
     PsData DebugDrawPsTrianglesDepthTest;
+    PsData DebugDrawPsLinesInstancedDefault;
+    PsData DebugDrawPsLinesInstancedDepthTest;
+    PsData DebugDrawPsTrianglesInstancedDefault;
+    PsData DebugDrawPsTrianglesInstancedDepthTest;
     DynamicVertexBuffer* DebugDrawVB = nullptr;
+    DynamicVertexBuffer* DebugDrawInstancesVB = nullptr;
+    GPUBuffer* DebugDrawShapesVB = nullptr;
     Float3 CircleCache[DEBUG_DRAW_CIRCLE_VERTICES];
     Array<Float3> SphereTriangleCache;
     DebugSphereCache SphereCache[3];
+    Array<Float3> ShapesVertices;
+    DebugDrawCall ShapesTemplates[(int32)DebugShape::MAX];
 
 #if COMPILE_WITH_DEV_ENV
     void OnShaderReloading(Asset* obj)
@@ -367,11 +500,61 @@ namespace
         DebugDrawPsWireTrianglesDepthTest.Release();
         DebugDrawPsTrianglesDefault.Release();
         DebugDrawPsTrianglesDepthTest.Release();
+        DebugDrawPsLinesInstancedDefault.Release();
+        DebugDrawPsLinesInstancedDepthTest.Release();
+        DebugDrawPsTrianglesInstancedDefault.Release();
+        DebugDrawPsTrianglesInstancedDepthTest.Release();
     }
 
 #endif
 };
 
+// Scope of the debug shapes recording. Main thread writes to the current context directly while other threads write to their own buffers to not contend with each other.
+struct DebugDrawScope
+{
+    DebugDrawThreadContext* Thread = nullptr;
+
+    DebugDrawScope()
+    {
+        if (!IsInMainThread())
+        {
+            auto& thread = ThreadContexts.Get();
+            if (!thread)
+                thread = New<DebugDrawThreadContext>();
+            Thread = thread;
+            Thread->Locker.Lock();
+        }
+    }
+
+    ~DebugDrawScope()
+    {
+        if (Thread)
+            Thread->Locker.Unlock();
+    }
+
+    FORCE_INLINE DebugDrawData& Get(bool depthTest) const
+    {
+        if (Thread)
+            return depthTest ? Thread->DebugDrawDepthTest : Thread->DebugDrawDefault;
+        return depthTest ? Context->DebugDrawDepthTest : Context->DebugDrawDefault;
+    }
+};
+
+// Moves the debug shapes recorded by other threads into the global context.
+void MergeThreadContexts()
+{
+    Array<DebugDrawThreadContext*, InlinedAllocation<64>> threads;
+    ThreadContexts.GetValues(threads);
+    for (DebugDrawThreadContext* thread : threads)
+    {
+        if (!thread)
+            continue;
+        ScopeLock lock(thread->Locker);
+        GlobalContext.DebugDrawDefault.Merge(thread->DebugDrawDefault);
+        GlobalContext.DebugDrawDepthTest.Merge(thread->DebugDrawDepthTest);
+    }
+}
+
 extern int32 BoxTrianglesIndicesCache[];
 
 int32 BoxLineIndicesCache[] =
@@ -392,12 +575,6 @@ int32 BoxLineIndicesCache[] =
     // @formatter:on
 };
 
-struct DebugDrawCall
-{
-    int32 StartVertex;
-    int32 VertexCount;
-};
-
 DebugDrawCall WriteList(int32& vertexCounter, const Array<Vertex>& list)
 {
     DebugDrawCall drawCall;
@@ -441,6 +618,26 @@ DebugDrawCall WriteList(int32& vertexCounter, const Array<DebugTriangle>& list)
     return drawCall;
 }
 
+// Writes the instances of the shape into the instances buffer (draw call vertex range is the instances range)
+DebugDrawCall WriteShapes(int32& instanceCounter, const Array<DebugShapeInstance>& listA, const Array<DebugShapeInstance>& listB)
+{
+    DebugDrawCall drawCall;
+    drawCall.StartVertex = instanceCounter;
+    drawCall.VertexCount = listA.Count() + listB.Count();
+    DebugDrawInstancesVB->Write(listA.Get(), sizeof(DebugShapeInstance) * listA.Count());
+    DebugDrawInstancesVB->Write(listB.Get(), sizeof(DebugShapeInstance) * listB.Count());
+    instanceCounter += drawCall.VertexCount;
+    return drawCall;
+}
+
+void AddShapeTemplate(DebugShape shape, const Float3* vertices, int32 count)
+{
+    auto& drawCall = ShapesTemplates[(int32)shape];
+    drawCall.StartVertex = ShapesVertices.Count();
+    drawCall.VertexCount = count;
+    ShapesVertices.Add(vertices, count);
+}
+
 template<typename T, typename U>
 DebugDrawCall WriteLists(int32& vertexCounter, const Array<T>& listA, const Array<U>& listB)
 {
@@ -452,18 +649,24 @@ DebugDrawCall WriteLists(int32& vertexCounter, const Array<T>& listA, const Arra
     return drawCall;
 }
 
-FORCE_INLINE DebugTriangle* AppendTriangles(int32 count, float duration, bool depthTest)
+FORCE_INLINE DebugTriangle* AppendTriangles(DebugDrawData& debugDrawData, int32 count, float duration)
 {
-    Array<DebugTriangle>* list;
-    if (depthTest)
-        list = duration > 0 ? &Context->DebugDrawDepthTest.DefaultTriangles : &Context->DebugDrawDepthTest.OneFrameTriangles;
-    else
-        list = duration > 0 ? &Context->DebugDrawDefault.DefaultTriangles : &Context->DebugDrawDefault.OneFrameTriangles;
+    Array<DebugTriangle>* list = duration > 0 ? &debugDrawData.DefaultTriangles : &debugDrawData.OneFrameTriangles;
     const int32 startIndex = list->Count();
     list->AddUninitialized(count);
     return list->Get() + startIndex;
 }
 
+// Sets the transformation of the unit box instance to match the oriented box
+void SetBoxTransform(DebugShapeInstance& instance, const OrientedBoundingBox& box)
+{
+    const Float3 centerF = box.Transformation.Translation - Context->Origin;
+    const Float3 axisX = box.Transformation.LocalToWorldVector(Vector3(box.Extents.X, 0, 0));
+    const Float3 axisY = box.Transformation.LocalToWorldVector(Vector3(0, box.Extents.Y, 0));
+    const Float3 axisZ = box.Transformation.LocalToWorldVector(Vector3(0, 0, box.Extents.Z));
+    instance.SetTransform(centerF, axisX, axisY, axisZ);
+}
+
 inline void DrawText3D(const DebugText3D& t, const RenderContext& renderContext, const Float3& viewUp, const Matrix& f, const Matrix& vp, const Viewport& viewport, GPUContext* context, GPUTextureView* target, GPUTextureView* depthBuffer)
 {
     Matrix w, fw, m;
@@ -605,11 +808,33 @@ bool DebugDrawService::Init()
         }
     }
 
+    // Init unit shapes used as template meshes for the instanced drawing
+    {
+        Vector3 corners[8];
+        BoundingBox(Vector3(-1.0f), Vector3(1.0f)).GetCorners(corners);
+        Float3 boxLines[ARRAY_COUNT(BoxLineIndicesCache)];
+        for (uint32 i = 0; i < ARRAY_COUNT(BoxLineIndicesCache); i++)
+            boxLines[i] = corners[BoxLineIndicesCache[i]];
+        Float3 boxTriangles[36];
+        for (int32 i = 0; i < 36; i++)
+            boxTriangles[i] = corners[BoxTrianglesIndicesCache[i]];
+        ShapesVertices.Clear();
+        AddShapeTemplate(DebugShape::WireSphereLOD0, SphereCache[0].Vertices.Get(), SphereCache[0].Vertices.Count());
+        AddShapeTemplate(DebugShape::WireSphereLOD1, SphereCache[1].Vertices.Get(), SphereCache[1].Vertices.Count());
+        AddShapeTemplate(DebugShape::WireSphereLOD2, SphereCache[2].Vertices.Get(), SphereCache[2].Vertices.Count());
+        AddShapeTemplate(DebugShape::WireBox, boxLines, ARRAY_COUNT(boxLines));
+        AddShapeTemplate(DebugShape::Sphere, SphereTriangleCache.Get(), SphereTriangleCache.Count());
+        AddShapeTemplate(DebugShape::Box, boxTriangles, ARRAY_COUNT(boxTriangles));
+    }
+
     return false;
 }
 
 void DebugDrawService::Update()
 {
+    // Collect shapes recorded by other threads (shapes not drawn since the last frame are not kept)
+    MergeThreadContexts();
+
     // Special case for Null renderer
     if (GPUDevice::Instance->GetRendererType() == RendererType::Null)
     {
@@ -673,6 +898,22 @@ void DebugDrawService::Update()
         desc.Wireframe = true;
         failed |= DebugDrawPsWireTrianglesDepthTest.Create(desc);
 
+        // Instanced shapes
+        desc.Wireframe = false;
+        desc.VS = shader->GetVS("VS_Instanced");
+        desc.PS = shader->GetPS("PS", 0);
+        desc.PrimitiveTopology = PrimitiveTopologyType::Line;
+        failed |= DebugDrawPsLinesInstancedDefault.Create(desc);
+        desc.PS = shader->GetPS("PS", 1);
+        desc.PrimitiveTopology = PrimitiveTopologyType::Triangle;
+        failed |= DebugDrawPsTrianglesInstancedDefault.Create(desc);
+        desc.PS = shader->GetPS("PS", 2);
+        desc.PrimitiveTopology = PrimitiveTopologyType::Line;
+        failed |= DebugDrawPsLinesInstancedDepthTest.Create(desc);
+        desc.PS = shader->GetPS("PS", 3);
+        desc.PrimitiveTopology = PrimitiveTopologyType::Triangle;
+        failed |= DebugDrawPsTrianglesInstancedDepthTest.Create(desc);
+
         if (failed)
         {
             LOG(Fatal, "Cannot setup DebugDraw service!");
@@ -681,7 +922,23 @@ void DebugDrawService::Update()
 
     // Vertex buffer
     if (DebugDrawVB == nullptr)
+    {
         DebugDrawVB = New<DynamicVertexBuffer>((uint32)(DEBUG_DRAW_INITIAL_VB_CAPACITY * sizeof(Vertex)), (uint32)sizeof(Vertex), TEXT("DebugDraw.VB"));
+        DebugDrawVB->SetTransient(true);
+    }
+    if (DebugDrawInstancesVB == nullptr)
+    {
+        DebugDrawInstancesVB = New<DynamicVertexBuffer>((uint32)(DEBUG_DRAW_INITIAL_INSTANCES_CAPACITY * sizeof(DebugShapeInstance)), (uint32)sizeof(DebugShapeInstance), TEXT("DebugDraw.InstancesVB"));
+        DebugDrawInstancesVB->SetTransient(true);
+    }
+    if (DebugDrawShapesVB == nullptr)
+    {
+        DebugDrawShapesVB = GPUDevice::Instance->CreateBuffer(TEXT("DebugDraw.ShapesVB"));
+        if (DebugDrawShapesVB->Init(GPUBufferDescription::Vertex(sizeof(Float3), ShapesVertices.Count(), ShapesVertices.Get())))
+        {
+            LOG(Fatal, "Cannot setup DebugDraw service!");
+        }
+    }
 }
 
 void DebugDrawService::Dispose()
@@ -689,16 +946,33 @@ void DebugDrawService::Dispose()
     // Clear lists
     GlobalContext.DebugDrawDefault.Release();
     GlobalContext.DebugDrawDepthTest.Release();
+    {
+        Array<DebugDrawThreadContext*, InlinedAllocation<64>> threads;
+        ThreadContexts.GetValues(threads);
+        for (DebugDrawThreadContext* thread : threads)
+        {
+            if (thread)
+                Delete(thread);
+        }
+        ThreadContexts.Clear();
+    }
 
     // Release resources
     SphereTriangleCache.Resize(0);
+    ShapesVertices.Resize(0);
     DebugDrawPsLinesDefault.Release();
     DebugDrawPsLinesDepthTest.Release();
     DebugDrawPsWireTrianglesDefault.Release();
     DebugDrawPsWireTrianglesDepthTest.Release();
     DebugDrawPsTrianglesDefault.Release();
     DebugDrawPsTrianglesDepthTest.Release();
+    DebugDrawPsLinesInstancedDefault.Release();
+    DebugDrawPsLinesInstancedDepthTest.Release();
+    DebugDrawPsTrianglesInstancedDefault.Release();
+    DebugDrawPsTrianglesInstancedDepthTest.Release();
     SAFE_DELETE(DebugDrawVB);
+    SAFE_DELETE(DebugDrawInstancesVB);
+    SAFE_DELETE_GPU_RESOURCE(DebugDrawShapesVB);
     DebugDrawShader = nullptr;
 }
 
@@ -736,13 +1010,15 @@ void DebugDraw::SetContext(void* context)
 void DebugDraw::Draw(RenderContext& renderContext, GPUTextureView* target, GPUTextureView* depthBuffer, bool enableDepthTest)
 {
     PROFILE_GPU_CPU("Debug Draw");
+    if (Context == &GlobalContext)
+        MergeThreadContexts();
 
     // Ensure to have shader loaded and any lines to render
     const int32 debugDrawDepthTestCount = Context->DebugDrawDepthTest.Count();
     const int32 debugDrawDefaultCount = Context->DebugDrawDefault.Count();
     if (DebugDrawShader == nullptr || !DebugDrawShader->IsLoaded() || debugDrawDepthTestCount + debugDrawDefaultCount == 0 || DebugDrawPsWireTrianglesDepthTest.Depth == nullptr)
         return;
-    if (renderContext.Buffers == nullptr || !DebugDrawVB)
+    if (renderContext.Buffers == nullptr || !DebugDrawVB || !DebugDrawInstancesVB || !DebugDrawShapesVB)
         return;
     auto context = GPUDevice::Instance->GetMainContext();
     const RenderView& view = renderContext.View;
@@ -764,6 +1040,8 @@ void DebugDraw::Draw(RenderContext& renderContext, GPUTextureView* target, GPUTe
 
     // Fill vertex buffer and upload data
     DebugDrawCall depthTestLines, defaultLines, depthTestTriangles, defaultTriangles, depthTestWireTriangles, defaultWireTriangles;
+    DebugDrawCall depthTestShapes[(int32)DebugShape::MAX], defaultShapes[(int32)DebugShape::MAX];
+    int32 depthTestShapesCount = 0, defaultShapesCount = 0;
     {
         PROFILE_CPU_NAMED("Update Buffer");
         DebugDrawVB->Clear();
@@ -774,9 +1052,22 @@ void DebugDraw::Draw(RenderContext& renderContext, GPUTextureView* target, GPUTe
         defaultTriangles = WriteLists(vertexCounter, Context->DebugDrawDefault.DefaultTriangles, Context->DebugDrawDefault.OneFrameTriangles);
         depthTestWireTriangles = WriteLists(vertexCounter, Context->DebugDrawDepthTest.DefaultWireTriangles, Context->DebugDrawDepthTest.OneFrameWireTriangles);
         defaultWireTriangles = WriteLists(vertexCounter, Context->DebugDrawDefault.DefaultWireTriangles, Context->DebugDrawDefault.OneFrameWireTriangles);
+        DebugDrawInstancesVB->Clear();
+        int32 instanceCounter = 0;
+        for (int32 i = 0; i < (int32)DebugShape::MAX; i++)
+        {
+            depthTestShapes[i] = WriteShapes(instanceCounter, Context->DebugDrawDepthTest.DefaultShapes[i], Context->DebugDrawDepthTest.OneFrameShapes[i]);
+            depthTestShapesCount += depthTestShapes[i].VertexCount;
+        }
+        for (int32 i = 0; i < (int32)DebugShape::MAX; i++)
+        {
+            defaultShapes[i] = WriteShapes(instanceCounter, Context->DebugDrawDefault.DefaultShapes[i], Context->DebugDrawDefault.OneFrameShapes[i]);
+            defaultShapesCount += defaultShapes[i].VertexCount;
+        }
         {
             PROFILE_CPU_NAMED("Flush");
             DebugDrawVB->Flush(context);
+            DebugDrawInstancesVB->Flush(context);
         }
     }
 
@@ -791,9 +1082,10 @@ void DebugDraw::Draw(RenderContext& renderContext, GPUTextureView* target, GPUTe
     context->UpdateCB(cb, &data);
     context->BindCB(0, cb);
     auto vb = DebugDrawVB->GetBuffer();
+    GPUBuffer* shapesVBs[2] = { DebugDrawShapesVB, DebugDrawInstancesVB->GetBuffer() };
 
     // Draw with depth test
-    if (depthTestLines.VertexCount + depthTestTriangles.VertexCount + depthTestWireTriangles.VertexCount > 0)
+    if (depthTestLines.VertexCount + depthTestTriangles.VertexCount + depthTestWireTriangles.VertexCount + depthTestShapesCount > 0)
     {
         if (data.EnableDepthTest)
             context->BindSR(0, renderContext.Buffers->DepthBuffer);
@@ -828,12 +1120,29 @@ void DebugDraw::Draw(RenderContext& renderContext, GPUTextureView* target, GPUTe
             context->Draw(depthTestTriangles.StartVertex, depthTestTriangles.VertexCount);
         }
 
+        // Shapes
+        if (depthTestShapesCount)
+        {
+            auto linesState = data.EnableDepthTest ? &DebugDrawPsLinesInstancedDepthTest : &DebugDrawPsLinesInstancedDefault;
+            auto trianglesState = data.EnableDepthTest ? &DebugDrawPsTrianglesInstancedDepthTest : &DebugDrawPsTrianglesInstancedDefault;
+            context->BindVB(ToSpan(shapesVBs, 2));
+            for (int32 i = 0; i < (int32)DebugShape::MAX; i++)
+            {
+                const DebugDrawCall& instances = depthTestShapes[i];
+                if (instances.VertexCount == 0)
+                    continue;
+                const DebugDrawCall& shape = ShapesTemplates[i];
+                context->SetState((i < (int32)DebugShape::FirstSolid ? linesState : trianglesState)->Get(enableDepthWrite, true));
+                context->DrawInstanced(shape.VertexCount, instances.VertexCount, instances.StartVertex, shape.StartVertex);
+            }
+        }
+
         if (data.EnableDepthTest)
             context->UnBindSR(0);
     }
 
     // Draw without depth
-    if (defaultLines.VertexCount + defaultTriangles.VertexCount + defaultWireTriangles.VertexCount > 0)
+    if (defaultLines.VertexCount + defaultTriangles.VertexCount + defaultWireTriangles.VertexCount + defaultShapesCount > 0)
     {
         context->SetRenderTarget(target);
 
@@ -860,6 +1169,21 @@ void DebugDraw::Draw(RenderContext& renderContext, GPUTextureView* target, GPUTe
             context->BindVB(ToSpan(&vb, 1));
             context->Draw(defaultTriangles.StartVertex, defaultTriangles.VertexCount);
         }
+
+        // Shapes
+        if (defaultShapesCount)
+        {
+            context->BindVB(ToSpan(shapesVBs, 2));
+            for (int32 i = 0; i < (int32)DebugShape::MAX; i++)
+            {
+                const DebugDrawCall& instances = defaultShapes[i];
+                if (instances.VertexCount == 0)
+                    continue;
+                const DebugDrawCall& shape = ShapesTemplates[i];
+                context->SetState((i < (int32)DebugShape::FirstSolid ? DebugDrawPsLinesInstancedDefault : DebugDrawPsTrianglesInstancedDefault).Get(false, false));
+                context->DrawInstanced(shape.VertexCount, instances.VertexCount, instances.StartVertex, shape.StartVertex);
+            }
+        }
     }
 
     // Text
@@ -986,7 +1310,8 @@ void DebugDraw::DrawRay(const Ray& ray, const Color& color, float length, float
 void DebugDraw::DrawLine(const Vector3& start, const Vector3& end, const Color& color, float duration, bool depthTest)
 {
     const Float3 startF = start - Context->Origin, endF = end - Context->Origin;
-    auto& debugDrawData = depthTest ? Context->DebugDrawDepthTest : Context->DebugDrawDefault;
+    DebugDrawScope scope;
+    auto& debugDrawData = scope.Get(depthTest);
     if (duration > 0)
     {
         DebugLine l = { startF, endF, Color32(color), duration };
@@ -1004,7 +1329,8 @@ void DebugDraw::DrawLine(const Vector3& start, const Vector3& end, const Color&
 void DebugDraw::DrawLine(const Vector3& start, const Vector3& end, const Color& startColor, const Color& endColor, float duration, bool depthTest)
 {
     const Float3 startF = start - Context->Origin, endF = end - Context->Origin;
-    auto& debugDrawData = depthTest ? Context->DebugDrawDepthTest : Context->DebugDrawDefault;
+    DebugDrawScope scope;
+    auto& debugDrawData = scope.Get(depthTest);
     if (duration > 0)
     {
         // TODO: separate start/end colors for persistent lines
@@ -1033,7 +1359,8 @@ void DebugDraw::DrawLines(const Span<Float3>& lines, const Matrix& transform, co
 
     // Draw lines
     const Float3* p = lines.Get();
-    auto& debugDrawData = depthTest ? Context->DebugDrawDepthTest : Context->DebugDrawDefault;
+    DebugDrawScope scope;
+    auto& debugDrawData = scope.Get(depthTest);
     const Matrix transformF = transform * Matrix::Translation(-Context->Origin);
     if (duration > 0)
     {
@@ -1077,7 +1404,8 @@ void DebugDraw::DrawLines(const Span<Double3>& lines, const Matrix& transform, c
 
     // Draw lines
     const Double3* p = lines.Get();
-    auto& debugDrawData = depthTest ? Context->DebugDrawDepthTest : Context->DebugDrawDefault;
+    DebugDrawScope scope;
+    auto& debugDrawData = scope.Get(depthTest);
     const Matrix transformF = transform * Matrix::Translation(-Context->Origin);
     if (duration > 0)
     {
@@ -1122,7 +1450,8 @@ void DebugDraw::DrawBezier(const Vector3& p1, const Vector3& p2, const Vector3&
     const float segmentCountInv = 1.0f / (float)segmentCount;
 
     // Draw segmented curve from lines
-    auto& debugDrawData = depthTest ? Context->DebugDrawDepthTest : Context->DebugDrawDefault;
+    DebugDrawScope scope;
+    auto& debugDrawData = scope.Get(depthTest);
     if (duration > 0)
     {
         DebugLine l = { p1F, Float3::Zero, Color32(color), duration };
@@ -1155,36 +1484,12 @@ void DebugDraw::DrawBezier(const Vector3& p1, const Vector3& p2, const Vector3&
 
 void DebugDraw::DrawWireBox(const BoundingBox& box, const Color& color, float duration, bool depthTest)
 {
-    // Get corners
-    Vector3 corners[8];
-    box.GetCorners(corners);
-    for (Vector3& c : corners)
-        c -= Context->Origin;
-
-    // Draw lines
-    auto& debugDrawData = depthTest ? Context->DebugDrawDepthTest : Context->DebugDrawDefault;
-    if (duration > 0)
-    {
-        DebugLine l = { Float3::Zero, Float3::Zero, Color32(color), duration };
-        for (uint32 i = 0; i < ARRAY_COUNT(BoxLineIndicesCache);)
-        {
-            l.Start = corners[BoxLineIndicesCache[i++]];
-            l.End = corners[BoxLineIndicesCache[i++]];
-            debugDrawData.DefaultLines.Add(l);
-        }
-    }
-    else
-    {
-        // TODO: draw lines as strips to reuse vertices with a single draw call
-        Vertex l = { Float3::Zero, Color32(color) };
-        for (uint32 i = 0; i < ARRAY_COUNT(BoxLineIndicesCache);)
-        {
-            l.Position = corners[BoxLineIndicesCache[i++]];
-            debugDrawData.OneFrameLines.Add(l);
-            l.Position = corners[BoxLineIndicesCache[i++]];
-            debugDrawData.OneFrameLines.Add(l);
-        }
-    }
+    const Float3 centerF = box.GetCenter() - Context->Origin;
+    const Float3 extentsF = box.GetSize() * 0.5f;
+    DebugDrawScope scope;
+    auto& instance = scope.Get(depthTest).AddShape(DebugShape::WireBox, duration);
+    instance.SetTransform(centerF, Float3(extentsF.X, 0, 0), Float3(0, extentsF.Y, 0), Float3(0, 0, extentsF.Z));
+    instance.Color = Color32(color);
 }
 
 void DebugDraw::DrawWireFrustum(const BoundingFrustum& frustum, const Color& color, float duration, bool depthTest)
@@ -1196,7 +1501,8 @@ void DebugDraw::DrawWireFrustum(const BoundingFrustum& frustum, const Color& col
         c -= Context->Origin;
 
     // Draw lines
-    auto& debugDrawData = depthTest ? Context->DebugDrawDepthTest : Context->DebugDrawDefault;
+    DebugDrawScope scope;
+    auto& debugDrawData = scope.Get(depthTest);
     if (duration > 0)
     {
         DebugLine l = { Float3::Zero, Float3::Zero, Color32(color), duration };
@@ -1223,100 +1529,43 @@ void DebugDraw::DrawWireFrustum(const BoundingFrustum& frustum, const Color& col
 
 void DebugDraw::DrawWireBox(const OrientedBoundingBox& box, const Color& color, float duration, bool depthTest)
 {
-    // Get corners
-    Vector3 corners[8];
-    box.GetCorners(corners);
-    for (Vector3& c : corners)
-        c -= Context->Origin;
-
-    // Draw lines
-    auto& debugDrawData = depthTest ? Context->DebugDrawDepthTest : Context->DebugDrawDefault;
-    if (duration > 0)
-    {
-        DebugLine l = { Float3::Zero, Float3::Zero, Color32(color), duration };
-        for (uint32 i = 0; i < ARRAY_COUNT(BoxLineIndicesCache);)
-        {
-            l.Start = corners[BoxLineIndicesCache[i++]];
-            l.End = corners[BoxLineIndicesCache[i++]];
-            debugDrawData.DefaultLines.Add(l);
-        }
-    }
-    else
-    {
-        // TODO: draw lines as strips to reuse vertices with a single draw call
-        Vertex l = { Float3::Zero, Color32(color) };
-        for (uint32 i = 0; i < ARRAY_COUNT(BoxLineIndicesCache);)
-        {
-            l.Position = corners[BoxLineIndicesCache[i++]];
-            debugDrawData.OneFrameLines.Add(l);
-            l.Position = corners[BoxLineIndicesCache[i++]];
-            debugDrawData.OneFrameLines.Add(l);
-        }
-    }
+    DebugShapeInstance instance;
+    SetBoxTransform(instance, box);
+    instance.Color = Color32(color);
+    instance.TimeLeft = duration;
+    DebugDrawScope scope;
+    scope.Get(depthTest).AddShape(DebugShape::WireBox, duration) = instance;
 }
 
 void DebugDraw::DrawWireSphere(const BoundingSphere& sphere, const Color& color, float duration, bool depthTest)
 {
     // Select LOD
-    int32 index;
+    DebugShape shape;
     const Float3 centerF = sphere.Center - Context->Origin;
     const float radiusF = (float)sphere.Radius;
     const float screenRadiusSquared = RenderTools::ComputeBoundsScreenRadiusSquared(centerF, radiusF, Context->LastViewPos, Context->LastViewProj);
     if (screenRadiusSquared > DEBUG_DRAW_SPHERE_LOD0_SCREEN_SIZE * DEBUG_DRAW_SPHERE_LOD0_SCREEN_SIZE * 0.25f)
-        index = 0;
+        shape = DebugShape::WireSphereLOD0;
     else if (screenRadiusSquared > DEBUG_DRAW_SPHERE_LOD1_SCREEN_SIZE * DEBUG_DRAW_SPHERE_LOD1_SCREEN_SIZE * 0.25f)
-        index = 1;
+        shape = DebugShape::WireSphereLOD1;
     else
-        index = 2;
-    auto& cache = SphereCache[index];
+        shape = DebugShape::WireSphereLOD2;
 
-    // Draw lines of the unit sphere after linear transform
-    auto& debugDrawData = depthTest ? Context->DebugDrawDepthTest : Context->DebugDrawDefault;
-    if (duration > 0)
-    {
-        DebugLine l = { Float3::Zero, Float3::Zero, Color32(color), duration };
-        for (int32 i = 0; i < cache.Vertices.Count();)
-        {
-            l.Start = centerF + cache.Vertices.Get()[i++] * radiusF;
-            l.End = centerF + cache.Vertices.Get()[i++] * radiusF;
-            debugDrawData.DefaultLines.Add(l);
-        }
-    }
-    else
-    {
-        Vertex l = { Float3::Zero, Color32(color) };
-        for (int32 i = 0; i < cache.Vertices.Count();)
-        {
-            l.Position = centerF + cache.Vertices.Get()[i++] * radiusF;
-            debugDrawData.OneFrameLines.Add(l);
-            l.Position = centerF + cache.Vertices.Get()[i++] * radiusF;
-            debugDrawData.OneFrameLines.Add(l);
-        }
-    }
+    // Draw instance of the unit sphere lines
+    DebugDrawScope scope;
+    auto& instance = scope.Get(depthTest).AddShape(shape, duration);
+    instance.SetTransform(centerF, Float3(radiusF, 0, 0), Float3(0, radiusF, 0), Float3(0, 0, radiusF));
+    instance.Color = Color32(color);
 }
 
 void DebugDraw::DrawSphere(const BoundingSphere& sphere, const Color& color, float duration, bool depthTest)
 {
-    DebugTriangle t;
-    t.Color = Color32(color);
-    t.TimeLeft = duration;
-
-    Array<DebugTriangle>* list;
-    if (depthTest)
-        list = duration > 0 ? &Context->DebugDrawDepthTest.DefaultTriangles : &Context->DebugDrawDepthTest.OneFrameTriangles;
-    else
-        list = duration > 0 ? &Context->DebugDrawDefault.DefaultTriangles : &Context->DebugDrawDefault.OneFrameTriangles;
-    list->EnsureCapacity(list->Count() + SphereTriangleCache.Count());
-
     const Float3 centerF = sphere.Center - Context->Origin;
     const float radiusF = (float)sphere.Radius;
-    for (int32 i = 0; i < SphereTriangleCache.Count();)
-    {
-        t.V0 = centerF + SphereTriangleCache[i++] * radiusF;
-        t.V1 = centerF + SphereTriangleCache[i++] * radiusF;
-        t.V2 = centerF + SphereTriangleCache[i++] * radiusF;
-        list->Add(t);
-    }
+    DebugDrawScope scope;
+    auto& instance = scope.Get(depthTest).AddShape(DebugShape::Sphere, duration);
+    instance.SetTransform(centerF, Float3(radiusF, 0, 0), Float3(0, radiusF, 0), Float3(0, 0, radiusF));
+    instance.Color = Color32(color);
 }
 
 void DebugDraw::DrawCircle(const Vector3& position, const Float3& normal, float radius, const Color& color, float duration, bool depthTest)
@@ -1338,7 +1587,8 @@ void DebugDraw::DrawCircle(const Vector3& position, const Float3& normal, float
 
     // Draw lines of the unit circle after linear transform
     Float3 prev = Float3::Transform(CircleCache[0], matrix);
-    auto& debugDrawData = depthTest ? Context->DebugDrawDepthTest : Context->DebugDrawDefault;
+    DebugDrawScope scope;
+    auto& debugDrawData = scope.Get(depthTest);
     for (int32 i = 1; i < DEBUG_DRAW_CIRCLE_VERTICES;)
     {
         Float3 cur = Float3::Transform(CircleCache[i++], matrix);
@@ -1373,10 +1623,8 @@ void DebugDraw::DrawTriangle(const Vector3& v0, const Vector3& v1, const Vector3
     t.V0 = v0 - Context->Origin;
     t.V1 = v1 - Context->Origin;
     t.V2 = v2 - Context->Origin;
-    if (depthTest)
-        Context->DebugDrawDepthTest.Add(t);
-    else
-        Context->DebugDrawDefault.Add(t);
+    DebugDrawScope scope;
+    scope.Get(depthTest).Add(t);
 }
 
 void DebugDraw::DrawTriangles(const Span<Float3>& vertices, const Color& color, float duration, bool depthTest)
@@ -1385,7 +1633,8 @@ void DebugDraw::DrawTriangles(const Span<Float3>& vertices, const Color& color,
     DebugTriangle t;
     t.Color = Color32(color);
     t.TimeLeft = duration;
-    auto dst = AppendTriangles(vertices.Length() / 3, duration, depthTest);
+    DebugDrawScope scope;
+    auto dst = AppendTriangles(scope.Get(depthTest), vertices.Length() / 3, duration);
     const Float3 origin = Context->Origin;
     for (int32 i = 0; i < vertices.Length();)
     {
@@ -1402,7 +1651,8 @@ void DebugDraw::DrawTriangles(const Span<Float3>& vertices, const Matrix& transf
     DebugTriangle t;
     t.Color = Color32(color);
     t.TimeLeft = duration;
-    auto dst = AppendTriangles(vertices.Length() / 3, duration, depthTest);
+    DebugDrawScope scope;
+    auto dst = AppendTriangles(scope.Get(depthTest), vertices.Length() / 3, duration);
     const Matrix transformF = transform * Matrix::Translation(-Context->Origin);
     for (int32 i = 0; i < vertices.Length();)
     {
@@ -1429,7 +1679,8 @@ void DebugDraw::DrawTriangles(const Span<Float3>& vertices, const Span<int32>& i
     DebugTriangle t;
     t.Color = Color32(color);
     t.TimeLeft = duration;
-    auto dst = AppendTriangles(indices.Length() / 3, duration, depthTest);
+    DebugDrawScope scope;
+    auto dst = AppendTriangles(scope.Get(depthTest), indices.Length() / 3, duration);
     const Float3 origin = Context->Origin;
     for (int32 i = 0; i < indices.Length();)
     {
@@ -1446,7 +1697,8 @@ void DebugDraw::DrawTriangles(const Span<Float3>& vertices, const Span<int32>& i
     DebugTriangle t;
     t.Color = Color32(color);
     t.TimeLeft = duration;
-    auto dst = AppendTriangles(indices.Length() / 3, duration, depthTest);
+    DebugDrawScope scope;
+    auto dst = AppendTriangles(scope.Get(depthTest), indices.Length() / 3, duration);
     const Matrix transformF = transform * Matrix::Translation(-Context->Origin);
     for (int32 i = 0; i < indices.Length();)
     {
@@ -1473,7 +1725,8 @@ void DebugDraw::DrawTriangles(const Span<Double3>& vertices, const Color& color,
     DebugTriangle t;
     t.Color = Color32(color);
     t.TimeLeft = duration;
-    auto dst = AppendTriangles(vertices.Length() / 3, duration, depthTest);
+    DebugDrawScope scope;
+    auto dst = AppendTriangles(scope.Get(depthTest), vertices.Length() / 3, duration);
     const Double3 origin = Context->Origin;
     for (int32 i = 0; i < vertices.Length();)
     {
@@ -1490,7 +1743,8 @@ void DebugDraw::DrawTriangles(const Span<Double3>& vertices, const Matrix& trans
     DebugTriangle t;
     t.Color = Color32(color);
     t.TimeLeft = duration;
-    auto dst = AppendTriangles(vertices.Length() / 3, duration, depthTest);
+    DebugDrawScope scope;
+    auto dst = AppendTriangles(scope.Get(depthTest), vertices.Length() / 3, duration);
     const Matrix transformF = transform * Matrix::Translation(-Context->Origin);
     for (int32 i = 0; i < vertices.Length();)
     {
@@ -1517,7 +1771,8 @@ void DebugDraw::DrawTriangles(const Span<Double3>& vertices, const Span<int32>&
     DebugTriangle t;
     t.Color = Color32(color);
     t.TimeLeft = duration;
-    auto dst = AppendTriangles(indices.Length() / 3, duration, depthTest);
+    DebugDrawScope scope;
+    auto dst = AppendTriangles(scope.Get(depthTest), indices.Length() / 3, duration);
     const Double3 origin = Context->Origin;
     for (int32 i = 0; i < indices.Length();)
     {
@@ -1534,7 +1789,8 @@ void DebugDraw::DrawTriangles(const Span<Double3>& vertices, const Span<int32>&
     DebugTriangle t;
     t.Color = Color32(color);
     t.TimeLeft = duration;
-    auto dst = AppendTriangles(indices.Length() / 3, duration, depthTest);
+    DebugDrawScope scope;
+    auto dst = AppendTriangles(scope.Get(depthTest), indices.Length() / 3, duration);
     const Matrix transformF = transform * Matrix::Translation(-Context->Origin);
     for (int32 i = 0; i < indices.Length();)
     {
@@ -1561,7 +1817,8 @@ void DebugDraw::DrawWireTriangles(const Span<Float3>& vertices, const Color& col
     DebugTriangle t;
     t.Color = Color32(color);
     t.TimeLeft = duration;
-    auto dst = AppendTriangles(vertices.Length() / 3, duration, depthTest);
+    DebugDrawScope scope;
+    auto dst = AppendTriangles(scope.Get(depthTest), vertices.Length() / 3, duration);
     const Float3 origin = Context->Origin;
     for (int32 i = 0; i < vertices.Length();)
     {
@@ -1583,7 +1840,8 @@ void DebugDraw::DrawWireTriangles(const Span<Float3>& vertices, const Span<int32
     DebugTriangle t;
     t.Color = Color32(color);
     t.TimeLeft = duration;
-    auto dst = AppendTriangles(indices.Length() / 3, duration, depthTest);
+    DebugDrawScope scope;
+    auto dst = AppendTriangles(scope.Get(depthTest), indices.Length() / 3, duration);
     const Float3 origin = Context->Origin;
     for (int32 i = 0; i < indices.Length();)
     {
@@ -1605,7 +1863,8 @@ void DebugDraw::DrawWireTriangles(const Span<Double3>& vertices, const Color& co
     DebugTriangle t;
     t.Color = Color32(color);
     t.TimeLeft = duration;
-    auto dst = AppendTriangles(vertices.Length() / 3, duration, depthTest);
+    DebugDrawScope scope;
+    auto dst = AppendTriangles(scope.Get(depthTest), vertices.Length() / 3, duration);
     const Double3 origin = Context->Origin;
     for (int32 i = 0; i < vertices.Length();)
     {
@@ -1627,7 +1886,8 @@ void DebugDraw::DrawWireTriangles(const Span<Double3>& vertices, const Span<int3
     DebugTriangle t;
     t.Color = Color32(color);
     t.TimeLeft = duration;
-    auto dst = AppendTriangles(indices.Length() / 3, duration, depthTest);
+    DebugDrawScope scope;
+    auto dst = AppendTriangles(scope.Get(depthTest), indices.Length() / 3, duration);
     const Double3 origin = Context->Origin;
     for (int32 i = 0; i < indices.Length();)
     {
@@ -1684,7 +1944,8 @@ void DebugDraw::DrawWireTube(const Vector3& position, const Quaternion& orientat
         Matrix::Multiply(rotation, translation, world);
 
         // Write vertices
-        auto& debugDrawData = depthTest ? Context->DebugDrawDepthTest : Context->DebugDrawDefault;
+        DebugDrawScope scope;
+        auto& debugDrawData = scope.Get(depthTest);
         Color32 color32(color);
         if (duration > 0)
         {
@@ -1896,41 +2157,33 @@ namespace
 
 void DebugDraw::DrawCylinder(const Vector3& position, const Quaternion& orientation, float radius, float height, const Color& color, float duration, bool depthTest)
 {
-    Array<DebugTriangle>* list;
-    if (depthTest)
-        list = duration > 0 ? &Context->DebugDrawDepthTest.DefaultTriangles : &Context->DebugDrawDepthTest.OneFrameTriangles;
-    else
-        list = duration > 0 ? &Context->DebugDrawDefault.DefaultTriangles : &Context->DebugDrawDefault.OneFrameTriangles;
+    DebugDrawScope scope;
+    auto& debugDrawData = scope.Get(depthTest);
+    Array<DebugTriangle>* list = duration > 0 ? &debugDrawData.DefaultTriangles : &debugDrawData.OneFrameTriangles;
     ::DrawCylinder(list, position, orientation, radius, height, color, duration);
 }
 
 void DebugDraw::DrawWireCylinder(const Vector3& position, const Quaternion& orientation, float radius, float height, const Color& color, float duration, bool depthTest)
 {
-    Array<DebugTriangle>* list;
-    if (depthTest)
-        list = duration > 0 ? &Context->DebugDrawDepthTest.DefaultWireTriangles : &Context->DebugDrawDepthTest.OneFrameWireTriangles;
-    else
-        list = duration > 0 ? &Context->DebugDrawDefault.DefaultWireTriangles : &Context->DebugDrawDefault.OneFrameWireTriangles;
+    DebugDrawScope scope;
+    auto& debugDrawData = scope.Get(depthTest);
+    Array<DebugTriangle>* list = duration > 0 ? &debugDrawData.DefaultWireTriangles : &debugDrawData.OneFrameWireTriangles;
     ::DrawCylinder(list, position, orientation, radius, height, color, duration);
 }
 
 void DebugDraw::DrawCone(const Vector3& position, const Quaternion& orientation, float radius, float angleXY, float angleXZ, const Color& color, float duration, bool depthTest)
 {
-    Array<DebugTriangle>* list;
-    if (depthTest)
-        list = duration > 0 ? &Context->DebugDrawDepthTest.DefaultTriangles : &Context->DebugDrawDepthTest.OneFrameTriangles;
-    else
-        list = duration > 0 ? &Context->DebugDrawDefault.DefaultTriangles : &Context->DebugDrawDefault.OneFrameTriangles;
+    DebugDrawScope scope;
+    auto& debugDrawData = scope.Get(depthTest);
+    Array<DebugTriangle>* list = duration > 0 ? &debugDrawData.DefaultTriangles : &debugDrawData.OneFrameTriangles;
     ::DrawCone(list, position, orientation, radius, angleXY, angleXZ, color, duration);
 }
 
 void DebugDraw::DrawWireCone(const Vector3& position, const Quaternion& orientation, float radius, float angleXY, float angleXZ, const Color& color, float duration, bool depthTest)
 {
-    Array<DebugTriangle>* list;
-    if (depthTest)
-        list = duration > 0 ? &Context->DebugDrawDepthTest.DefaultWireTriangles : &Context->DebugDrawDepthTest.OneFrameWireTriangles;
-    else
-        list = duration > 0 ? &Context->DebugDrawDefault.DefaultWireTriangles : &Context->DebugDrawDefault.OneFrameWireTriangles;
+    DebugDrawScope scope;
+    auto& debugDrawData = scope.Get(depthTest);
+    Array<DebugTriangle>* list = duration > 0 ? &debugDrawData.DefaultWireTriangles : &debugDrawData.OneFrameWireTriangles;
     ::DrawCone(list, position, orientation, radius, angleXY, angleXZ, color, duration);
 }
 
@@ -1940,11 +2193,9 @@ void DebugDraw::DrawArc(const Vector3& position, const Quaternion& orientation,
         return;
     if (angle > TWO_PI)
         angle = TWO_PI;
-    Array<DebugTriangle>* list;
-    if (depthTest)
-        list = duration > 0 ? &Context->DebugDrawDepthTest.DefaultTriangles : &Context->DebugDrawDepthTest.OneFrameTriangles;
-    else
-        list = duration > 0 ? &Context->DebugDrawDefault.DefaultTriangles : &Context->DebugDrawDefault.OneFrameTriangles;
+    DebugDrawScope scope;
+    auto& debugDrawData = scope.Get(depthTest);
+    Array<DebugTriangle>* list = duration > 0 ? &debugDrawData.DefaultTriangles : &debugDrawData.OneFrameTriangles;
     const int32 resolution = Math::CeilToInt((float)DEBUG_DRAW_CONE_RESOLUTION / TWO_PI * angle);
     const float angleStep = angle / (float)resolution;
     const Float3 positionF = position - Context->Origin;
@@ -2014,65 +2265,31 @@ void DebugDraw::DrawWireArrow(const Vector3& position, const Quaternion& orienta
 
 void DebugDraw::DrawBox(const BoundingBox& box, const Color& color, float duration, bool depthTest)
 {
-    // Get corners
-    Vector3 corners[8];
-    box.GetCorners(corners);
-    for (Vector3& c : corners)
-        c -= Context->Origin;
-
-    // Draw triangles
-    DebugTriangle t;
-    t.Color = Color32(color);
-    t.TimeLeft = duration;
-    Array<DebugTriangle>* list;
-    if (depthTest)
-        list = duration > 0 ? &Context->DebugDrawDepthTest.DefaultTriangles : &Context->DebugDrawDepthTest.OneFrameTriangles;
-    else
-        list = duration > 0 ? &Context->DebugDrawDefault.DefaultTriangles : &Context->DebugDrawDefault.OneFrameTriangles;
-    list->EnsureCapacity(list->Count() + 36);
-    for (int i0 = 0; i0 < 36;)
-    {
-        t.V0 = corners[BoxTrianglesIndicesCache[i0++]];
-        t.V1 = corners[BoxTrianglesIndicesCache[i0++]];
-        t.V2 = corners[BoxTrianglesIndicesCache[i0++]];
-
-        list->Add(t);
-    }
+    const Float3 centerF = box.GetCenter() - Context->Origin;
+    const Float3 extentsF = box.GetSize() * 0.5f;
+    DebugDrawScope scope;
+    auto& instance = scope.Get(depthTest).AddShape(DebugShape::Box, duration);
+    instance.SetTransform(centerF, Float3(extentsF.X, 0, 0), Float3(0, extentsF.Y, 0), Float3(0, 0, extentsF.Z));
+    instance.Color = Color32(color);
 }
 
 void DebugDraw::DrawBox(const OrientedBoundingBox& box, const Color& color, float duration, bool depthTest)
 {
-    // Get corners
-    Vector3 corners[8];
-    box.GetCorners(corners);
-    for (Vector3& c : corners)
-        c -= Context->Origin;
-
-    // Draw triangles
-    DebugTriangle t;
-    t.Color = Color32(color);
-    t.TimeLeft = duration;
-    Array<DebugTriangle>* list;
-    if (depthTest)
-        list = duration > 0 ? &Context->DebugDrawDepthTest.DefaultTriangles : &Context->DebugDrawDepthTest.OneFrameTriangles;
-    else
-        list = duration > 0 ? &Context->DebugDrawDefault.DefaultTriangles : &Context->DebugDrawDefault.OneFrameTriangles;
-    list->EnsureCapacity(list->Count() + 36);
-    for (int i0 = 0; i0 < 36;)
-    {
-        t.V0 = corners[BoxTrianglesIndicesCache[i0++]];
-        t.V1 = corners[BoxTrianglesIndicesCache[i0++]];
-        t.V2 = corners[BoxTrianglesIndicesCache[i0++]];
-
-        list->Add(t);
-    }
+    DebugShapeInstance instance;
+    SetBoxTransform(instance, box);
+    instance.Color = Color32(color);
+    instance.TimeLeft = duration;
+    DebugDrawScope scope;
+    scope.Get(depthTest).AddShape(DebugShape::Box, duration) = instance;
 }
 
 void DebugDraw::DrawText(const StringView& text, const Float2& position, const Color& color, int32 size, float duration)
 {
     if (text.Length() == 0 || size < 4)
         return;
-    Array<DebugText2D>* list = duration > 0 ? &Context->DebugDrawDefault.DefaultText2D : &Context->DebugDrawDefault.OneFrameText2D;
+    DebugDrawScope scope;
+    auto& debugDrawData = scope.Get(false);
+    Array<DebugText2D>* list = duration > 0 ? &debugDrawData.DefaultText2D : &debugDrawData.OneFrameText2D;
     auto& t = list->AddOne();
     t.Text.Resize(text.Length() + 1);
     Platform::MemoryCopy(t.Text.Get(), text.Get(), text.Length() * sizeof(Char));
@@ -2087,7 +2304,9 @@ void DebugDraw::DrawText(const StringView& text, const Vector3& position, const
 {
     if (text.Length() == 0 || size < 4)
         return;
-    Array<DebugText3D>* list = duration > 0 ? &Context->DebugDrawDefault.DefaultText3D : &Context->DebugDrawDefault.OneFrameText3D;
+    DebugDrawScope scope;
+    auto& debugDrawData = scope.Get(false);
+    Array<DebugText3D>* list = duration > 0 ? &debugDrawData.DefaultText3D : &debugDrawData.OneFrameText3D;
     auto& t = list->AddOne();
     t.Text.Resize(text.Length() + 1);
     Platform::MemoryCopy(t.Text.Get(), text.Get(), text.Length() * sizeof(Char));
@@ -2104,7 +2323,9 @@ void DebugDraw::DrawText(const StringView& text, const Transform& transform, con
 {
     if (text.Length() == 0 || size < 4)
         return;
-    Array<DebugText3D>* list = duration > 0 ? &Context->DebugDrawDefault.DefaultText3D : &Context->DebugDrawDefault.OneFrameText3D;
+    DebugDrawScope scope;
+    auto& debugDrawData = scope.Get(false);
+    Array<DebugText3D>* list = duration > 0 ? &debugDrawData.DefaultText3D : &debugDrawData.OneFrameText3D;
     auto& t = list->AddOne();
     t.Text.Resize(text.Length() + 1);
     Platform::MemoryCopy(t.Text.Get(), text.Get(), text.Length() * sizeof(Char));
@@ -19,6 +19,9 @@ struct Transform;
 /// <summary>
 /// The debug shapes rendering service. Not available in final game. For use only in the editor.
 /// </summary>
+/// <remarks>
+/// Shapes can be drawn from any thread. Threads other than the main thread record into their own buffers that are merged into the global context before drawing.
+/// </remarks>
 API_CLASS(Static) class FLAXENGINE_API DebugDraw
 {
     DECLARE_SCRIPTING_TYPE_NO_SPAWN(DebugDraw);
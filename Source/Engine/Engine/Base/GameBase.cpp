@@ -7,6 +7,7 @@
 #include "Engine/Engine/Time.h"
 #include "Engine/Engine/Engine.h"
 #include "Engine/Engine/Globals.h"
+#include "Engine/Engine/StartupTrace.h"
 #include "Engine/Platform/Window.h"
 #include "Engine/Profiler/Profiler.h"
 #include "Engine/Level/Level.h"
@@ -34,6 +35,7 @@ namespace GameBaseImpl
     void OnMainWindowClosed();
     void OnPostRender(GPUContext* context, RenderContext& renderContext);
     void OnSplashScreenEnd();
+    void OnFirstSceneLoaded(Scene* scene, const Guid& sceneId);
 }
 
 bool GameBase::IsShowingSplashScreen()
@@ -153,6 +155,7 @@ void GameBase::BeforeRun()
             Platform::Fatal(TEXT("Missing main rendering task object."));
         GameBaseImpl::SplashScreenTime = 0;
         MainRenderTask::Instance->PostRender.Bind(&GameBaseImpl::OnPostRender);
+        StartupTrace::BeginPending(TEXT("Splash Screen"));
     }
     else
     {
@@ -265,11 +268,18 @@ void GameBaseImpl::OnSplashScreenEnd()
     SplashScreenTime = 0;
     SplashScreen = nullptr;
     MainRenderTask::Instance->PostRender.Unbind(&OnPostRender);
+    StartupTrace::EndPending(TEXT("Splash Screen"));
 
     // Load the first scene
     LOG(Info, "Loading the first scene");
     const auto sceneId = FirstScene ? FirstScene.GetID() : Guid::Empty;
     FirstScene = nullptr;
+    if (StartupTrace::IsActive() && sceneId.IsValid())
+    {
+        StartupTrace::BeginPending(TEXT("First Scene"));
+        Level::SceneActivated.Bind(&OnFirstSceneLoaded);
+        Level::SceneLoadError.Bind(&OnFirstSceneLoaded);
+    }
     if (Level::LoadSceneAsync(sceneId))
     {
         LOG(Fatal, "Cannot load the first scene.");
@@ -277,4 +287,11 @@ void GameBaseImpl::OnSplashScreenEnd()
     }
 }
 
+void GameBaseImpl::OnFirstSceneLoaded(Scene* scene, const Guid& sceneId)
+{
+    Level::SceneActivated.Unbind(&OnFirstSceneLoaded);
+    Level::SceneLoadError.Unbind(&OnFirstSceneLoaded);
+    StartupTrace::EndPending(TEXT("First Scene"));
+}
+
 #endif
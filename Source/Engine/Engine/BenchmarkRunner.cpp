@@ -0,0 +1,457 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#if !USE_EDITOR
+
+#include "CommandLine.h"
+#include "Engine.h"
+#include "EngineService.h"
+#include "Replay.h"
+#include "Time.h"
+#include "Engine/Core/Log.h"
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Core/Collections/Sorting.h"
+#include "Engine/Core/Math/Quaternion.h"
+#include "Engine/Core/Math/Vector3.h"
+#include "Engine/Graphics/GPUDevice.h"
+#include "Engine/Level/Level.h"
+#include "Engine/Level/Scene/Scene.h"
+#include "Engine/Level/Actors/Camera.h"
+#include "Engine/Platform/File.h"
+#include "Engine/Platform/MemoryStats.h"
+#include "Engine/Serialization/JsonTools.h"
+#include "Engine/Serialization/JsonWriters.h"
+#include "Engine/Debug/Exceptions/JsonParseException.h"
+#if COMPILE_WITH_PROFILER
+#include "Engine/Profiler/ProfilingTools.h"
+#endif
+#include <ThirdParty/rapidjson/document.h>
+
+// The maximum time (in seconds) to wait for the game to load its first scene before starting the benchmark
+#define BENCHMARK_SCENE_WAIT_TIME 30.0
+
+// The amount of the most expensive profiler zones to output if the benchmark config doesn't list them
+#define BENCHMARK_TOP_ZONES 20
+
+/// <summary>
+/// Deterministic scene benchmark runner (enabled with -benchmark !path! command line option). Loads the scene from the benchmark config, moves the main camera along the recorded path using a fixed timestep and captures frame timings, profiler zones, memory peaks and rendering stats. Writes results (with p50/p95/p99 percentiles) to the json file and exits with non-zero code on budget violations.
+/// When combined with the replay playback (-replayplay !path!) the game is driven by the replay instead of the camera path and the capture lasts until the end of the replay.
+/// </summary>
+class BenchmarkRunnerService : public EngineService
+{
+public:
+    enum class States
+    {
+        Loading,
+        Warmup,
+        Capture,
+        Done,
+    };
+
+    struct CameraKey
+    {
+        float Time;
+        Vector3 Position;
+        Quaternion Orientation;
+
+        bool operator<(const CameraKey& other) const
+        {
+            return Time < other.Time;
+        }
+    };
+
+    struct Budget
+    {
+        String Metric;
+        float Value;
+    };
+
+    struct Samples
+    {
+        const char* Name;
+        Array<float> Values;
+    };
+
+    // Config
+    String OutputPath;
+    Guid SceneId = Guid::Empty;
+    float FixedDeltaTime = 1.0f / 60.0f;
+    int32 WarmupFrames = 60;
+    int32 CaptureFrames = 600;
+    Array<CameraKey> CameraPath;
+    Array<Budget> Budgets;
+    Array<String> Zones;
+
+    // State
+    States State = States::Done;
+    bool UseReplay = false;
+    int32 Frame = 0;
+    double StartTime = 0.0;
+    double LastFrameTime = 0.0;
+    Samples FrameTimes = { "FrameTimeMs" };
+    Samples UpdateTimes = { "UpdateTimeMs" };
+    Samples DrawTimes = { "DrawTimeMs" };
+    Samples GPUTimes = { "GPUTimeMs" };
+    Samples DrawCalls = { "DrawCalls" };
+    Samples Triangles = { "Triangles" };
+    uint64 PeakMemoryCPU = 0;
+    uint64 PeakMemoryGPU = 0;
+    Dictionary<String, double> ZoneTotals;
+
+    BenchmarkRunnerService()
+        : EngineService(TEXT("Benchmark Runner"), 10000)
+    {
+    }
+
+    bool LoadConfig(const String& path);
+    bool StartBenchmark();
+    void UpdateCamera(float time);
+    void CaptureFrame();
+    void Finish();
+
+    bool Init() override;
+    void Update() override;
+};
+
+BenchmarkRunnerService BenchmarkRunnerServiceInstance;
+
+namespace
+{
+    // Sorts profiler zones from the most expensive
+    bool CompareZones(const String& a, const String& b)
+    {
+        return BenchmarkRunnerServiceInstance.ZoneTotals[a] > BenchmarkRunnerServiceInstance.ZoneTotals[b];
+    }
+}
+
+bool BenchmarkRunnerService::LoadConfig(const String& path)
+{
+    Array<byte> fileData;
+    if (File::ReadAllBytes(path, fileData))
+    {
+        LOG(Error, "Failed to load benchmark config file '{0}'", path);
+        return true;
+    }
+    rapidjson_flax::Document document;
+    document.Parse((const char*)fileData.Get(), fileData.Count());
+    if (document.HasParseError())
+    {
+        Log::JsonParseException(document.GetParseError(), document.GetErrorOffset(), path);
+        return true;
+    }
+
+    SceneId = JsonTools::GetGuid(document, "Scene");
+    FixedDeltaTime = Math::Max(JsonTools::GetFloat(document, "FixedDeltaTime", FixedDeltaTime), ZeroTolerance);
+    WarmupFrames = Math::Max(JsonTools::GetInt(document, "WarmupFrames", WarmupFrames), 0);
+    CaptureFrames = Math::Max(JsonTools::GetInt(document, "Frames", CaptureFrames), 1);
+    OutputPath = JsonTools::GetString(document, "Output", String(StringUtils::GetDirectoryName(path)) / TEXT("BenchmarkResults.json"));
+    const auto cameraPathMember = document.FindMember("CameraPath");
+    if (cameraPathMember != document.MemberEnd() && cameraPathMember->value.IsArray())
+    {
+        for (const auto& e : cameraPathMember->value.GetArray())
+        {
+            auto& key = CameraPath.AddOne();
+            key.Time = JsonTools::GetFloat(e, "Time", 0.0f);
+            const auto position = e.FindMember("Position");
+            key.Position = position != e.MemberEnd() ? JsonTools::GetVector3(position->value) : Vector3::Zero;
+            const auto orientation = e.FindMember("Orientation");
+            key.Orientation = orientation != e.MemberEnd() ? JsonTools::GetQuaternion(orientation->value) : Quaternion::Identity;
+        }
+        Sorting::QuickSort(CameraPath.Get(), CameraPath.Count());
+    }
+    const auto budgetsMember = document.FindMember("Budgets");
+    if (budgetsMember != document.MemberEnd() && budgetsMember->value.IsObject())
+    {
+        for (auto i = budgetsMember->value.MemberBegin(); i != budgetsMember->value.MemberEnd(); ++i)
+        {
+            if (i->value.IsNumber())
+                Budgets.Add({ String(i->name.GetText()), i->value.GetFloat() });
+        }
+    }
+    const auto zonesMember = document.FindMember("Zones");
+    if (zonesMember != document.MemberEnd() && zonesMember->value.IsArray())
+    {
+        for (const auto& e : zonesMember->value.GetArray())
+        {
+            if (e.IsString())
+                Zones.Add(e.GetText());
+        }
+    }
+    return false;
+}
+
+bool BenchmarkRunnerService::StartBenchmark()
+{
+    // Load the benchmarked scene
+    if (SceneId.IsValid() && !Level::FindScene(SceneId))
+    {
+        Level::UnloadAllScenes();
+        if (Level::LoadScene(SceneId))
+        {
+            LOG(Error, "Failed to load benchmark scene {0}", SceneId);
+            return true;
+        }
+    }
+
+    // Replay drives the game with the recorded input and timing
+    UseReplay = Replay::IsPlaying();
+    if (UseReplay)
+    {
+#if COMPILE_WITH_PROFILER
+        ProfilingTools::SetEnabled(true);
+#endif
+        LOG(Info, "Running benchmark with replay ({0} warmup frames, until the replay end)", WarmupFrames);
+        return false;
+    }
+
+    // Setup camera for the recorded path
+    if (CameraPath.HasItems() && !Camera::GetMainCamera() && Level::Scenes.HasItems())
+    {
+        auto camera = New<Camera>();
+        camera->SetParent(Level::Scenes[0], false, false);
+        Camera::OverrideMainCamera = camera;
+    }
+
+    // Run with a fixed timestep to get deterministic simulation
+    Time::SetFixedDeltaTime(true, FixedDeltaTime);
+#if COMPILE_WITH_PROFILER
+    ProfilingTools::SetEnabled(true);
+#endif
+    LOG(Info, "Running benchmark ({0} warmup frames, {1} frames, timestep {2}s)", WarmupFrames, CaptureFrames, FixedDeltaTime);
+    return false;
+}
+
+void BenchmarkRunnerService::UpdateCamera(float time)
+{
+    Camera* camera = Camera::GetMainCamera();
+    if (!camera || CameraPath.IsEmpty() || UseReplay)
+        return;
+    int32 index = 0;
+    while (index < CameraPath.Count() - 1 && CameraPath[index + 1].Time <= time)
+        index++;
+    const CameraKey& a = CameraPath[index];
+    const CameraKey& b = CameraPath[Math::Min(index + 1, CameraPath.Count() - 1)];
+    const float alpha = b.Time > a.Time ? Math::Saturate((time - a.Time) / (b.Time - a.Time)) : 0.0f;
+    Quaternion orientation;
+    Quaternion::Slerp(a.Orientation, b.Orientation, alpha, orientation);
+    camera->SetPosition(Vector3::Lerp(a.Position, b.Position, alpha));
+    camera->SetOrientation(orientation);
+}
+
+void BenchmarkRunnerService::CaptureFrame()
+{
+    // Frame timings (from the previous frame)
+    const double time = Platform::GetTimeSeconds();
+    FrameTimes.Values.Add((float)((time - LastFrameTime) * 1000.0));
+    UpdateTimes.Values.Add((float)(Time::Update.LastLength * 1000.0));
+    DrawTimes.Values.Add((float)(Time::Draw.LastLength * 1000.0));
+#if COMPILE_WITH_PROFILER
+    const auto& stats = ProfilingTools::Stats;
+    GPUTimes.Values.Add(stats.DrawGPUTimeMs);
+    DrawCalls.Values.Add((float)stats.DrawStats.DrawCalls);
+    Triangles.Values.Add((float)stats.DrawStats.Triangles);
+
+    // Profiler zones
+    for (const auto& thread : ProfilingTools::EventsCPU)
+    {
+        for (const auto& e : thread.Events)
+            ZoneTotals[StringView(e.Name)] += e.End - e.Start;
+    }
+#endif
+
+    // Memory peaks
+    PeakMemoryCPU = Math::Max(PeakMemoryCPU, Platform::GetProcessMemoryStats().UsedPhysicalMemory);
+    if (GPUDevice::Instance)
+        PeakMemoryGPU = Math::Max(PeakMemoryGPU, GPUDevice::Instance->GetMemoryUsage());
+}
+
+void BenchmarkRunnerService::Finish()
+{
+    Dictionary<String, float> metrics;
+    rapidjson_flax::StringBuffer buffer;
+    PrettyJsonWriter writerObj(buffer);
+    JsonWriter& writer = writerObj;
+    writer.StartObject();
+    writer.JKEY("Scene");
+    writer.Guid(SceneId);
+    writer.JKEY("Frames");
+    writer.Int(CaptureFrames);
+    writer.JKEY("FixedDeltaTime");
+    writer.Float(FixedDeltaTime);
+
+    // Percentiles of the per-frame samples
+    Samples* samples[] = { &FrameTimes, &UpdateTimes, &DrawTimes, &GPUTimes, &DrawCalls, &Triangles };
+    for (Samples* e : samples)
+    {
+        auto& values = e->Values;
+        if (values.IsEmpty())
+            continue;
+        float sum = 0.0f;
+        for (const float v : values)
+            sum += v;
+        Sorting::QuickSort(values.Get(), values.Count());
+        const String name(e->Name);
+        const auto percentile = [&values](float p)
+        {
+            return values[Math::Clamp(Math::CeilToInt(p * (float)values.Count()) - 1, 0, values.Count() - 1)];
+        };
+        const float p50 = percentile(0.5f), p95 = percentile(0.95f), p99 = percentile(0.99f);
+        const float max = values.Last(), average = sum / (float)values.Count();
+        metrics[name + TEXT(".P50")] = p50;
+        metrics[name + TEXT(".P95")] = p95;
+        metrics[name + TEXT(".P99")] = p99;
+        metrics[name + TEXT(".Max")] = max;
+        metrics[name + TEXT(".Average")] = average;
+        writer.Key(e->Name);
+        writer.StartObject();
+        writer.JKEY("P50");
+        writer.Float(p50);
+        writer.JKEY("P95");
+        writer.Float(p95);
+        writer.JKEY("P99");
+        writer.Float(p99);
+        writer.JKEY("Max");
+        writer.Float(max);
+        writer.JKEY("Average");
+        writer.Float(average);
+        writer.EndObject();
+    }
+
+    // Memory peaks (in megabytes)
+    metrics[TEXT("PeakMemoryCPU")] = (float)((double)PeakMemoryCPU / (1024.0 * 1024.0));
+    metrics[TEXT("PeakMemoryGPU")] = (float)((double)PeakMemoryGPU / (1024.0 * 1024.0));
+    writer.JKEY("PeakMemoryCPU");
+    writer.Float(metrics[TEXT("PeakMemoryCPU")]);
+    writer.JKEY("PeakMemoryGPU");
+    writer.Float(metrics[TEXT("PeakMemoryGPU")]);
+
+    // Profiler zones (average time per frame in milliseconds)
+    Array<String> zones(Zones);
+    if (zones.IsEmpty())
+    {
+        for (const auto& e : ZoneTotals)
+            zones.Add(e.Key);
+        Sorting::QuickSort(zones.Get(), zones.Count(), &CompareZones);
+        if (zones.Count() > BENCHMARK_TOP_ZONES)
+            zones.Resize(BENCHMARK_TOP_ZONES);
+    }
+    writer.JKEY("Zones");
+    writer.StartObject();
+    for (const String& zone : zones)
+    {
+        double total = 0.0;
+        ZoneTotals.TryGet(zone, total);
+        const float value = (float)(total / CaptureFrames);
+        metrics[TEXT("Zones.") + zone] = value;
+        writer.Key(zone);
+        writer.Float(value);
+    }
+    writer.EndObject();
+
+    // Check budgets
+    int32 violations = 0;
+    writer.JKEY("Budgets");
+    writer.StartArray();
+    for (const Budget& budget : Budgets)
+    {
+        float value = 0.0f;
+        const bool found = metrics.TryGet(budget.Metric, value);
+        const bool passed = found && value <= budget.Value;
+        if (!passed)
+        {
+            violations++;
+            if (found)
+                LOG(Error, "Benchmark budget violation: {0} = {1} (budget: {2})", budget.Metric, value, budget.Value);
+            else
+                LOG(Error, "Benchmark budget uses unknown metric {0}", budget.Metric);
+        }
+        writer.StartObject();
+        writer.JKEY("Metric");
+        writer.String(budget.Metric);
+        writer.JKEY("Value");
+        writer.Float(value);
+        writer.JKEY("Budget");
+        writer.Float(budget.Value);
+        writer.JKEY("Passed");
+        writer.Bool(passed);
+        writer.EndObject();
+    }
+    writer.EndArray();
+    writer.JKEY("Passed");
+    writer.Bool(violations == 0);
+    writer.EndObject();
+
+    // Save results and exit
+    if (File::WriteAllBytes(OutputPath, (const byte*)buffer.GetString(), (int32)buffer.GetSize()))
+    {
+        LOG(Error, "Failed to save benchmark results to '{0}'", OutputPath);
+        violations++;
+    }
+    else
+    {
+        LOG(Info, "Benchmark results saved to '{0}' (frame time p50: {1}ms, p95: {2}ms, p99: {3}ms)", OutputPath, metrics[TEXT("FrameTimeMs.P50")], metrics[TEXT("FrameTimeMs.P95")], metrics[TEXT("FrameTimeMs.P99")]);
+    }
+    Engine::RequestExit(violations != 0 ? 1 : 0);
+}
+
+bool BenchmarkRunnerService::Init()
+{
+    if (!CommandLine::Options.Benchmark.HasValue())
+        return false;
+    if (LoadConfig(CommandLine::Options.Benchmark.GetValue()))
+    {
+        Engine::RequestExit(1);
+        return false;
+    }
+    State = States::Loading;
+    StartTime = Platform::GetTimeSeconds();
+    return false;
+}
+
+void BenchmarkRunnerService::Update()
+{
+    switch (State)
+    {
+    case States::Loading:
+        // Wait for the game to load its first scene (or the timeout if game doesn't load any)
+        if (Level::IsAnyActionPending() || (!Level::IsAnySceneLoaded() && Platform::GetTimeSeconds() - StartTime < BENCHMARK_SCENE_WAIT_TIME))
+            break;
+        if (StartBenchmark())
+        {
+            State = States::Done;
+            Engine::RequestExit(1);
+            break;
+        }
+        State = States::Warmup;
+        Frame = 0;
+        UpdateCamera(0.0f);
+        break;
+    case States::Warmup:
+        if (++Frame >= WarmupFrames)
+        {
+            State = States::Capture;
+            Frame = 0;
+        }
+        UpdateCamera(0.0f);
+        break;
+    case States::Capture:
+        if (Frame != 0)
+            CaptureFrame();
+        if (UseReplay ? !Replay::IsPlaying() : Frame == CaptureFrames)
+        {
+            if (UseReplay)
+                CaptureFrames = Math::Max(Frame, 1);
+            State = States::Done;
+            Finish();
+            break;
+        }
+        Frame++;
+        UpdateCamera((float)Frame * FixedDeltaTime);
+        break;
+    default:
+        break;
+    }
+    LastFrameTime = Platform::GetTimeSeconds();
+}
+
+#endif
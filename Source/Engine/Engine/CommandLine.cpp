@@ -145,6 +145,20 @@ bool CommandLine::Parse(const Char* cmdLine)
     PARSE_BOOL_SWITCH("-monolog ", MonoLog);
     PARSE_BOOL_SWITCH("-mute ", Mute);
     PARSE_BOOL_SWITCH("-lowdpi ", LowDPI);
+    PARSE_ARG_SWITCH("-metricsport ", MetricsPort);
+    PARSE_BOOL_SWITCH("-sharedcontent ", SharedContent);
+    PARSE_BOOL_SWITCH("-contenttrace ", ContentTrace);
+    PARSE_ARG_OPT_SWITCH("-startuptrace ", StartupTrace);
+    PARSE_BOOL_SWITCH("-serialinit ", SerialInit);
+    PARSE_ARG_SWITCH("-replayrecord ", ReplayRecord);
+    PARSE_ARG_SWITCH("-replayplay ", ReplayPlay);
+#if !USE_EDITOR
+    PARSE_ARG_SWITCH("-benchmark ", Benchmark);
+#endif
+#if COMPILE_WITH_PROFILER
+    PARSE_ARG_OPT_SWITCH("-trace ", Trace);
+    PARSE_BOOL_SWITCH("-hitchdetector ", HitchDetector);
+#endif
 
 #if USE_EDITOR
 
@@ -156,6 +170,8 @@ bool CommandLine::Parse(const Char* cmdLine)
     PARSE_ARG_SWITCH("-build ", Build);
     PARSE_BOOL_SWITCH("-skipcompile ", SkipCompile);
     PARSE_BOOL_SWITCH("-shaderdebug ", ShaderDebug);
+    PARSE_ARG_SWITCH("-shadercache ", ShaderCache);
+    PARSE_ARG_SWITCH("-texturecache ", TextureCache);
     PARSE_ARG_OPT_SWITCH("-play ", Play);
 
 #endif
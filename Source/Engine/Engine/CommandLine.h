@@ -127,6 +127,64 @@ class CommandLine
         /// </summary>
         Nullable<bool> LowDPI;
 
+        /// <summary>
+        /// -metricsport !port! (starts the performance counters endpoint on the given TCP port, used by the remote monitoring of the dedicated servers)
+        /// </summary>
+        Nullable<String> MetricsPort;
+
+        /// <summary>
+        /// -sharedcontent (maps the content packages as shared read-only memory so the multiple processes on the same host, eg. dedicated servers, share the physical memory of the cooked content)
+        /// </summary>
+        Nullable<bool> SharedContent;
+
+        /// <summary>
+        /// -contenttrace (enables the content loading trace that logs the per-asset loading timings summary after loading)
+        /// </summary>
+        Nullable<bool> ContentTrace;
+
+        /// <summary>
+        /// -startuptrace [path] (saves the startup timeline trace to the file, uses the logs folder if path is not specified)
+        /// </summary>
+        Nullable<String> StartupTrace;
+
+        /// <summary>
+        /// -serialinit (initializes all engine services on the main thread, disables the parallel initialization of the independent services)
+        /// </summary>
+        Nullable<bool> SerialInit;
+
+        /// <summary>
+        /// -replayrecord !path! (records the input, network messages, ticks timing and random seed to the replay file)
+        /// </summary>
+        Nullable<String> ReplayRecord;
+
+        /// <summary>
+        /// -replayplay !path! (plays the session from the replay file instead of the real input, network traffic and timing)
+        /// </summary>
+        Nullable<String> ReplayPlay;
+
+#if !USE_EDITOR
+
+        /// <summary>
+        /// -benchmark !path! (runs the scene benchmark described by the json config file, saves results and exits, used by CI)
+        /// </summary>
+        Nullable<String> Benchmark;
+
+#endif
+
+#if COMPILE_WITH_PROFILER
+
+        /// <summary>
+        /// -trace [path] (starts the profiler trace capture to the file, uses the default location if path is not specified)
+        /// </summary>
+        Nullable<String> Trace;
+
+        /// <summary>
+        /// -hitchdetector (enables the automatic hitch detector that saves the last frames profiler data when a hitch happens)
+        /// </summary>
+        Nullable<bool> HitchDetector;
+
+#endif
+
 #if USE_EDITOR
 
         /// <summary>
@@ -169,6 +227,16 @@ class CommandLine
         /// </summary>
         Nullable<bool> ShaderDebug;
 
+        /// <summary>
+        /// -shadercache !path! (overrides the compiled shaders cache folder, eg. with a network location shared by the team)
+        /// </summary>
+        Nullable<String> ShaderCache;
+
+        /// <summary>
+        /// -texturecache !path! (overrides the compressed textures cache folder, eg. with a network location shared by the team)
+        /// </summary>
+        Nullable<String> TextureCache;
+
         /// <summary>
         /// -play !guid! ( Scene to play, can be empty to use default )
         /// </summary>
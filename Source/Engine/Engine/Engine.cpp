@@ -6,6 +6,9 @@
 #include "CommandLine.h"
 #include "Globals.h"
 #include "EngineService.h"
+#include "StartupTrace.h"
+#include "FramePacer.h"
+#include "Replay.h"
 #include "Application.h"
 #include "FlaxEngine.Gen.h"
 #include "Engine/Core/Core.h"
@@ -100,6 +103,7 @@ int32 Engine::Main(const Char* cmdLine)
         return -1;
     }
 
+    StartupTrace::Start();
     Platform::SetHighDpiAwarenessEnabled(!CommandLine::Options.LowDPI.IsTrue());
     Time::StartupTime = DateTime::Now();
     Globals::StartupFolder = Globals::BinariesFolder = Platform::GetMainDirectory();
@@ -124,13 +128,17 @@ int32 Engine::Main(const Char* cmdLine)
 
     // Load game info or project info
     {
+        STARTUP_TRACE_SCOPE("Load Product");
         const int32 result = Application::LoadProduct();
         if (result != 0)
             return result;
     }
 
-    EngineImpl::InitPaths();
-    EngineImpl::InitLog();
+    {
+        STARTUP_TRACE_SCOPE("Init Log");
+        EngineImpl::InitPaths();
+        EngineImpl::InitLog();
+    }
 
 #if USE_EDITOR
     if (Editor::CheckProjectUpgrade())
@@ -144,14 +152,23 @@ int32 Engine::Main(const Char* cmdLine)
 
     // Initialize engine
     UpdateGraph = New<TaskGraph>();
-    EngineService::OnInit();
-    if (Application::Init())
-        return -10;
+    {
+        STARTUP_TRACE_SCOPE("Engine Services");
+        EngineService::OnInit();
+    }
+    {
+        STARTUP_TRACE_SCOPE("Application Init");
+        if (Application::Init())
+            return -10;
+    }
 
     // Become ready before run
-    Platform::BeforeRun();
-    EngineImpl::InitMainWindow();
-    Application::BeforeRun();
+    {
+        STARTUP_TRACE_SCOPE("Main Window");
+        Platform::BeforeRun();
+        EngineImpl::InitMainWindow();
+        Application::BeforeRun();
+    }
 #if !USE_EDITOR && (PLATFORM_WINDOWS || PLATFORM_LINUX || PLATFORM_MAC)
     EngineImpl::RunInBackground = PlatformSettings::Get()->RunInBackground;
 #endif
@@ -161,21 +178,12 @@ int32 Engine::Main(const Char* cmdLine)
     EngineImpl::IsReady = true;
 
     // Main engine loop
-    const bool useSleep = true; // TODO: this should probably be a platform setting
     while (!ShouldExit())
     {
         // Reduce CPU usage by introducing idle time if the engine is running very fast and has enough time to spend
-        if ((useSleep && Time::UpdateFPS > ZeroTolerance) || !Platform::GetHasFocus())
+        if (Time::UpdateFPS > ZeroTolerance || !Platform::GetHasFocus())
         {
-            double nextTick = Time::GetNextTick();
-            double timeToTick = nextTick - Platform::GetTimeSeconds();
-
-            // Sleep less than needed, some platforms may sleep slightly more than requested
-            if (timeToTick > 0.002)
-            {
-                PROFILE_CPU_NAMED("Idle");
-                Platform::Sleep(1);
-            }
+            FramePacer::Wait();
         }
 
         // App paused logic
@@ -194,6 +202,8 @@ int32 Engine::Main(const Char* cmdLine)
 
         // Use the same time for all ticks to improve synchronization
         const double time = Platform::GetTimeSeconds();
+        if (Replay::IsActive())
+            Replay::OnFrame();
 
         // Update game logic
         if (Time::OnBeginUpdate(time))
@@ -216,6 +226,7 @@ int32 Engine::Main(const Char* cmdLine)
         {
             OnDraw();
             Time::OnEndDraw();
+            FramePacer::OnDraw(time);
             FrameMark;
         }
     }
@@ -317,11 +328,13 @@ void Engine::OnUpdate()
     {
         isGameRunning = EngineImpl::RunInBackground;
     }
+    if (Replay::IsPlaying())
+        isGameRunning = true;
     Time::SetGamePaused(!isGameRunning);
 #endif
 
     // Determine if application has focus (flag used by the other parts of the engine)
-    HasFocus = (mainWindow && mainWindow->IsFocused()) || Platform::GetHasFocus();
+    HasFocus = (mainWindow && mainWindow->IsFocused()) || Platform::GetHasFocus() || Replay::IsPlaying();
 
     // Simulate lags
     //Platform::Sleep(100);
@@ -357,6 +370,7 @@ void Engine::OnDraw()
     FrameCount++;
     const double time = Platform::GetTimeSeconds();
     auto device = GPUDevice::Instance;
+    device->WaitForPresent();
     device->Locker.Lock();
 #if COMPILE_WITH_PROFILER
     ProfilerGPU::BeginFrame();
@@ -365,10 +379,9 @@ void Engine::OnDraw()
     device->Draw();
 
     // End frame rendering
-#if COMPILE_WITH_PROFILER
-    ProfilerGPU::EndFrame();
-#endif
     device->Locker.Unlock();
+    if (StartupTrace::IsActive())
+        StartupTrace::OnFrame();
 
     // Calculate FPS
     EngineImpl::FpsAccumulatedFrames++;
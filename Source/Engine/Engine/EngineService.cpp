@@ -1,9 +1,13 @@
 // Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
 
 #include "EngineService.h"
+#include "StartupTrace.h"
+#include "CommandLine.h"
 #include "Engine/Core/Log.h"
 #include "Engine/Core/Collections/Array.h"
 #include "Engine/Core/Collections/Sorting.h"
+#include "Engine/Platform/StringUtils.h"
+#include "Engine/Threading/JobSystem.h"
 #include <ThirdParty/tracy/tracy/Tracy.hpp>
 
 static bool CompareEngineServices(EngineService* const& a, EngineService* const& b)
@@ -65,33 +69,87 @@ bool EngineService::Init()
     return false;
 }
 
+bool EngineService::CanInitParallel(int32 index) const
+{
+    if (!ParallelInit)
+        return false;
+    const auto& services = GetServices();
+    for (const Char* dependency : Dependencies)
+    {
+        for (int32 i = 0; i < services.Count(); i++)
+        {
+            if (StringUtils::Compare(services[i]->Name, dependency) == 0)
+            {
+                // Dependency initialized later has to be initialized serially (at the service order)
+                if (i > index || services[i]->InitState != InitStates::Done)
+                    return false;
+                break;
+            }
+        }
+    }
+    return true;
+}
+
+void EngineService::InitService()
+{
+    const StringView name(Name);
+#if TRACY_ENABLE
+    ZoneScoped;
+    int32 nameBufferLength = 0;
+    Char nameBuffer[100];
+    for (int32 j = 0; j < name.Length(); j++)
+        if (name[j] != ' ')
+            nameBuffer[nameBufferLength++] = name[j];
+    Platform::MemoryCopy(nameBuffer + nameBufferLength, TEXT("::Init"), 7 * sizeof(Char));
+    nameBufferLength += 7;
+    ZoneName(nameBuffer, nameBufferLength);
+#endif
+    LOG(Info, "Initialize {0}...", name);
+    StartupTrace::Scope startupTraceScope(Name);
+    IsInitialized = true;
+    InitFailed = Init();
+}
+
+void EngineService::InitJob(int32 index)
+{
+    InitService();
+}
+
 void EngineService::OnInit()
 {
     ZoneScoped;
     Sort();
 
-    // Init services from front to back
+    // Init services from front to back (services with parallel init start on the job system once their dependencies are ready and are waited for at their order)
     auto& services = GetServices();
+    const bool parallel = !CommandLine::Options.SerialInit.IsTrue();
     for (int32 i = 0; i < services.Count(); i++)
     {
         const auto service = services[i];
-        const StringView name(service->Name);
-#if TRACY_ENABLE
-        ZoneScoped;
-        int32 nameBufferLength = 0;
-        Char nameBuffer[100];
-        for (int32 j = 0; j < name.Length(); j++)
-            if (name[j] != ' ')
-                nameBuffer[nameBufferLength++] = name[j];
-        Platform::MemoryCopy(nameBuffer + nameBufferLength, TEXT("::Init"), 7 * sizeof(Char));
-        nameBufferLength += 7;
-        ZoneName(nameBuffer, nameBufferLength);
-#endif
-        LOG(Info, "Initialize {0}...", name);
-        service->IsInitialized = true;
-        if (service->Init())
+        if (service->InitState == InitStates::Running)
+            JobSystem::Wait(service->InitLabel);
+        else if (service->InitState == InitStates::None)
+            service->InitService();
+        service->InitState = InitStates::Done;
+        if (service->InitFailed)
+        {
+            Platform::Fatal(String::Format(TEXT("Failed to initialize {0}."), StringView(service->Name)));
+        }
+
+        // Start parallel init of the following services that got all dependencies ready
+        if (parallel && JobSystem::GetThreadsCount() > 1)
         {
-            Platform::Fatal(String::Format(TEXT("Failed to initialize {0}."), name));
+            for (int32 j = i + 1; j < services.Count(); j++)
+            {
+                const auto next = services[j];
+                if (next->InitState == InitStates::None && next->CanInitParallel(j))
+                {
+                    Function<void(int32)> func;
+                    func.Bind<EngineService, &EngineService::InitJob>(next);
+                    next->InitState = InitStates::Running;
+                    next->InitLabel = JobSystem::Dispatch(func, 1, 1, JobPriority::High);
+                }
+            }
         }
     }
 
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "Engine/Core/Types/BaseTypes.h"
+#include "Engine/Core/Collections/Array.h"
 
 /// <summary>
 /// Engine service object.
@@ -26,7 +27,21 @@ class EngineService
 
 private:
 
+    enum class InitStates : byte
+    {
+        None,
+        Running,
+        Done,
+    };
+
     bool IsInitialized = false;
+    bool InitFailed = false;
+    InitStates InitState = InitStates::None;
+    int64 InitLabel = 0;
+
+    bool CanInitParallel(int32 index) const;
+    void InitService();
+    void InitJob(int32 index);
 
 protected:
 
@@ -39,6 +54,16 @@ class EngineService
     const Char* Name;
     int32 Order;
 
+    /// <summary>
+    /// True if the service Init is thread-safe and doesn't require the main thread. Such service is initialized on the job system as soon as its dependencies are ready (concurrently with other services) and it's waited for at its order, so the following services see it initialized.
+    /// </summary>
+    bool ParallelInit = false;
+
+    /// <summary>
+    /// The names of the services that have to be initialized before the parallel initialization of this service. Dependencies must have lower order.
+    /// </summary>
+    Array<const Char*, FixedAllocation<8>> Dependencies;
+
 #define DECLARE_ENGINE_SERVICE_EVENT(result, name) virtual result name(); static void On##name();
     DECLARE_ENGINE_SERVICE_EVENT(bool, Init);
     DECLARE_ENGINE_SERVICE_EVENT(void, FixedUpdate);
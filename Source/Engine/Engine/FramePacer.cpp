@@ -0,0 +1,90 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "FramePacer.h"
+#include "Engine.h"
+#include "Time.h"
+#include "Engine/Core/Math/Math.h"
+#include "Engine/Platform/Platform.h"
+#include "Engine/Platform/Window.h"
+#include "Engine/Graphics/GPUSwapChain.h"
+#include "Engine/Profiler/ProfilerCPU.h"
+
+// The initial time (in seconds) before the tick at which the pacer stops sleeping and spins (adapted to the measured oversleep)
+#define FRAME_PACER_SPIN_TIME 0.001
+// The limit for the spin time (in seconds) to not burn the CPU on systems with a coarse scheduler
+#define FRAME_PACER_SPIN_TIME_MAX 0.002
+
+FramePacingMode FramePacer::Mode = FramePacingMode::Precise;
+double FramePacer::LowLatencyMargin = 0.001;
+
+namespace
+{
+    double SpinTime = FRAME_PACER_SPIN_TIME;
+    double FrameCost = 0.0;
+
+    double GetJustInTimeStart(double nextTick, double time)
+    {
+        // Predict the next present using the main window presentation timing (or the draw rate limit)
+        double interval = Time::DrawFPS > ZeroTolerance ? 1.0 / Time::DrawFPS : 0.0;
+        double deadline = nextTick + interval;
+        const GPUSwapChain* swapChain = Engine::MainWindow ? Engine::MainWindow->GetSwapChain() : nullptr;
+        if (swapChain && swapChain->GetLastPresentTime() > 0.0 && swapChain->GetPresentInterval() > 0.0)
+        {
+            interval = Math::Max(interval, swapChain->GetPresentInterval());
+            deadline = swapChain->GetLastPresentTime() + interval;
+            while (deadline < time)
+                deadline += interval;
+        }
+        if (interval <= 0.0)
+            return nextTick;
+
+        // Start the frame as late as possible to finish right before the present (but no later than one interval after the tick)
+        const double start = deadline - FrameCost - FramePacer::LowLatencyMargin;
+        return Math::Clamp(start, nextTick, nextTick + interval);
+    }
+}
+
+void FramePacer::Wait()
+{
+    double target = Time::GetNextTick();
+    if (target <= 0.0)
+        return;
+    double time = Platform::GetTimeSeconds();
+    if (Mode == FramePacingMode::LowLatency)
+        target = GetJustInTimeStart(target, time);
+    if (target <= time)
+        return;
+    PROFILE_CPU_NAMED("Idle");
+
+    if (Mode == FramePacingMode::Sleep)
+    {
+        // Sleep less than needed, some platforms may sleep slightly more than requested
+        if (target - time > 0.002)
+            Platform::Sleep(1);
+        return;
+    }
+
+    // Sleep with the high-resolution timer until close to the target
+    while (target - time > SpinTime)
+    {
+        const double sleepTime = target - time - SpinTime;
+        Platform::SleepMicroseconds((int64)(sleepTime * 1000000.0));
+        const double wakeTime = Platform::GetTimeSeconds();
+
+        // Adapt the spin time to the scheduler wake-up latency (oversleep) on this system
+        const double oversleep = wakeTime - time - sleepTime;
+        SpinTime = Math::Clamp(Math::Lerp(SpinTime, oversleep * 1.5, 0.1), 0.0001, FRAME_PACER_SPIN_TIME_MAX);
+        time = wakeTime;
+    }
+
+    // Spin for the remaining time
+    while (time < target)
+        time = Platform::GetTimeSeconds();
+}
+
+void FramePacer::OnDraw(double frameStart)
+{
+    // Track the frame cost (react to spikes immediately and decay slowly to not miss the present in low latency mode)
+    const double cost = Platform::GetTimeSeconds() - frameStart;
+    FrameCost = cost > FrameCost ? cost : Math::Lerp(FrameCost, cost, 0.05);
+}
@@ -0,0 +1,56 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Core/Config.h"
+#include "Engine/Core/Types/BaseTypes.h"
+
+/// <summary>
+/// The main loop frame pacing modes (how the engine waits for the next update or draw when running faster than the target rate).
+/// </summary>
+API_ENUM() enum class FramePacingMode
+{
+    /// <summary>
+    /// Sleeps with the 1 millisecond granularity. Lowest CPU usage but the frame times are quantized to the scheduler granularity (uneven at high refresh rates).
+    /// </summary>
+    Sleep,
+
+    /// <summary>
+    /// Sleeps with the high-resolution timer and spins for the last fraction of a millisecond to start the frame on time.
+    /// </summary>
+    Precise,
+
+    /// <summary>
+    /// Precise pacing that additionally delays the frame start (and input sampling) to finish the frame just in time before the next present. Reduces the input latency at the cost of the frame time headroom.
+    /// </summary>
+    LowLatency,
+};
+
+/// <summary>
+/// The main loop frame pacer. Waits for the next update or draw tick using the high-resolution timers and the present-timing feedback from the main window swap chain.
+/// </summary>
+class FLAXENGINE_API FramePacer
+{
+public:
+    /// <summary>
+    /// The frame pacing mode.
+    /// </summary>
+    static FramePacingMode Mode;
+
+    /// <summary>
+    /// The safety margin (in seconds) left before the predicted present when using the low latency mode.
+    /// </summary>
+    static double LowLatencyMargin;
+
+public:
+    /// <summary>
+    /// Waits for the next tick (update, physics or draw). Called by the engine main loop.
+    /// </summary>
+    static void Wait();
+
+    /// <summary>
+    /// Called by the engine main loop after drawing the frame to measure the frame cost.
+    /// </summary>
+    /// <param name="frameStart">The time when the frame started (in seconds).</param>
+    static void OnDraw(double frameStart);
+};
@@ -1194,6 +1194,55 @@ internal static void FreeGCHandle(ManagedHandle valueHandle)
             valueHandle.Free();
         }
 
+        [UnmanagedCallersOnly]
+        internal static void NewGCHandles(ManagedHandle* valueHandles, ulong* handles, int count, byte pinned)
+        {
+            var type = pinned != 0 ? GCHandleType.Pinned : GCHandleType.Normal;
+            for (int i = 0; i < count; i++)
+                handles[i] = (ulong)(long)ManagedHandle.ToIntPtr(valueHandles[i].Target, type);
+        }
+
+        [UnmanagedCallersOnly]
+        internal static void FreeGCHandles(ulong* handles, int count)
+        {
+            for (int i = 0; i < count; i++)
+                ManagedHandle.FromIntPtr((IntPtr)(long)handles[i]).Free();
+        }
+
+        [UnmanagedCallersOnly]
+        internal static void InvokeScriptsTick(IntPtr* scripts, int count, int scriptVTableIndex, IntPtr* tickObject)
+        {
+            // Scripts list contains pairs of managed instance handle and native object pointer
+            for (int i = 0; i < count; i++)
+            {
+                *tickObject = scripts[i * 2 + 1];
+                try
+                {
+                    var script = Unsafe.As<Script>(ManagedHandle.FromIntPtr(scripts[i * 2]).Target);
+                    switch (scriptVTableIndex)
+                    {
+                    case 8:
+                        script.OnUpdate();
+                        break;
+                    case 9:
+                        script.OnLateUpdate();
+                        break;
+                    case 10:
+                        script.OnFixedUpdate();
+                        break;
+                    case 11:
+                        script.OnLateFixedUpdate();
+                        break;
+                    }
+                }
+                catch (Exception ex)
+                {
+                    Debug.LogException(ex);
+                }
+            }
+            *tickObject = IntPtr.Zero;
+        }
+
         [UnmanagedCallersOnly]
         internal static void GCCollect(int generation, int mode, bool blocking, bool compacting)
         {
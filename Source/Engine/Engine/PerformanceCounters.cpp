@@ -0,0 +1,279 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "PerformanceCounters.h"
+#include "Engine.h"
+#include "EngineService.h"
+#include "CommandLine.h"
+#include "Time.h"
+#include "Engine/Core/Log.h"
+#include "Engine/Core/Types/StringBuilder.h"
+#include "Engine/Platform/CriticalSection.h"
+#include "Engine/Platform/MemoryStats.h"
+#include "Engine/Platform/Network.h"
+#include "Engine/Platform/Thread.h"
+#include "Engine/Platform/StringUtils.h"
+#include "Engine/Streaming/Streaming.h"
+#include "Engine/Threading/IRunnable.h"
+
+// The maximum time (in milliseconds) to wait for the remote query request data
+#define PERFORMANCE_COUNTERS_REQUEST_TIMEOUT 200
+
+int64 volatile PerformanceCounters::Values[PERFORMANCE_COUNTERS_MAX];
+
+namespace
+{
+    struct CounterInfo
+    {
+        String Name;
+        PerformanceCounterType Type;
+    };
+
+    CriticalSection CountersLocker;
+    CounterInfo Counters[PERFORMANCE_COUNTERS_MAX];
+    int64 LastFrameValues[PERFORMANCE_COUNTERS_MAX];
+    volatile int64 CountersCount = 0;
+
+    // Engine counters
+    int32 FPSCounter = -1;
+    int32 FrameCounter = -1;
+    int32 UpdateTimeCounter = -1;
+    int32 DrawTimeCounter = -1;
+    int32 PhysicsTimeCounter = -1;
+    int32 MemoryCounter = -1;
+    int32 StreamingResourcesCounter = -1;
+    int32 StreamingInCounter = -1;
+
+    // Remote query endpoint
+    NetworkSocket ServerSocket;
+    Thread* ServerThread = nullptr;
+    volatile int64 ServerExit = 0;
+
+    void WriteResponse(NetworkSocket& socket, const StringAnsi& data)
+    {
+        byte* ptr = (byte*)data.Get();
+        int32 left = data.Length();
+        for (int32 retries = 0; left > 0 && retries < 100; retries++)
+        {
+            const int32 written = Network::WriteSocket(socket, ptr, left);
+            if (written > 0)
+            {
+                ptr += written;
+                left -= written;
+            }
+            else
+            {
+                Platform::Sleep(1);
+            }
+        }
+    }
+
+    void HandleRequest(NetworkSocket& socket)
+    {
+        // Consume the request (the same response is sent for any request)
+        for (int32 time = 0; time < PERFORMANCE_COUNTERS_REQUEST_TIMEOUT && !Network::IsReadable(socket); time++)
+            Platform::Sleep(1);
+        byte buffer[1024];
+        if (Network::IsReadable(socket))
+            Network::ReadSocket(socket, buffer, sizeof(buffer));
+
+        // Write counters in the Prometheus text format (names sanitized to [a-zA-Z0-9_])
+        StringBuilder body;
+        const Array<PerformanceCounterValue> values = PerformanceCounters::GetValues();
+        String name;
+        for (const PerformanceCounterValue& e : values)
+        {
+            name = TEXT("flax_") + e.Name;
+            for (int32 i = 0; i < name.Length(); i++)
+            {
+                if (!StringUtils::IsAlnum(name[i]))
+                    name[i] = '_';
+            }
+            body.AppendFormat(TEXT("# TYPE {0} {1}\n{0} {2}\n"), name, e.Type == PerformanceCounterType::Counter ? TEXT("counter") : TEXT("gauge"), e.Value);
+        }
+        const StringAnsi bodyAnsi(body.ToStringView());
+        const StringAnsi header = StringAnsi::Format("HTTP/1.0 200 OK\r\nContent-Type: text/plain; version=0.0.4\r\nContent-Length: {0}\r\nConnection: close\r\n\r\n", bodyAnsi.Length());
+        WriteResponse(socket, header);
+        WriteResponse(socket, bodyAnsi);
+    }
+
+    class ServerRunnable : public IRunnable
+    {
+    public:
+        // [IRunnable]
+        String ToString() const override
+        {
+            return TEXT("PerformanceCountersServer");
+        }
+
+        int32 Run() override
+        {
+            while (Platform::AtomicRead(&ServerExit) == 0)
+            {
+                if (!Network::IsReadable(ServerSocket))
+                {
+                    Platform::Sleep(50);
+                    continue;
+                }
+                NetworkSocket client;
+                NetworkEndPoint clientEndPoint;
+                if (Network::Accept(ServerSocket, client, clientEndPoint))
+                    continue;
+                HandleRequest(client);
+                Network::DestroySocket(client);
+            }
+            return 0;
+        }
+
+        void AfterWork(bool wasKilled) override
+        {
+            Delete(this);
+        }
+    };
+
+    bool StartServer(const String& port)
+    {
+        NetworkEndPoint endPoint;
+        if (Network::CreateSocket(ServerSocket, NetworkProtocol::Tcp, NetworkIPVersion::IPv4))
+            return true;
+        Network::SetSocketOption(ServerSocket, NetworkSocketOption::ReuseAddr, 1);
+        if (Network::CreateEndPoint(String::Empty, port, NetworkIPVersion::IPv4, endPoint, true) ||
+            Network::BindSocket(ServerSocket, endPoint) ||
+            Network::Listen(ServerSocket, 8))
+        {
+            Network::DestroySocket(ServerSocket);
+            return true;
+        }
+        Platform::AtomicStore(&ServerExit, 0);
+        ServerThread = Thread::Create(New<ServerRunnable>(), TEXT("Performance Counters Server"), ThreadPriority::Lowest);
+        LOG(Info, "Performance counters available on port {0}", port);
+        return false;
+    }
+}
+
+class PerformanceCountersService : public EngineService
+{
+public:
+    PerformanceCountersService()
+        : EngineService(TEXT("Performance Counters"), -10000)
+    {
+    }
+
+    bool Init() override;
+    void Update() override;
+    void Dispose() override;
+};
+
+PerformanceCountersService PerformanceCountersServiceInstance;
+
+bool PerformanceCountersService::Init()
+{
+    FPSCounter = PerformanceCounters::Register(TEXT("Engine.FPS"), PerformanceCounterType::Gauge);
+    FrameCounter = PerformanceCounters::Register(TEXT("Engine.Frames"), PerformanceCounterType::Counter);
+    UpdateTimeCounter = PerformanceCounters::Register(TEXT("Engine.UpdateTimeUs"), PerformanceCounterType::Gauge);
+    DrawTimeCounter = PerformanceCounters::Register(TEXT("Engine.DrawTimeUs"), PerformanceCounterType::Gauge);
+    PhysicsTimeCounter = PerformanceCounters::Register(TEXT("Engine.PhysicsTimeUs"), PerformanceCounterType::Gauge);
+    MemoryCounter = PerformanceCounters::Register(TEXT("Memory.UsedPhysical"), PerformanceCounterType::Gauge);
+    StreamingResourcesCounter = PerformanceCounters::Register(TEXT("Streaming.Resources"), PerformanceCounterType::Gauge);
+    StreamingInCounter = PerformanceCounters::Register(TEXT("Streaming.StreamingResources"), PerformanceCounterType::Gauge);
+
+    if (CommandLine::Options.MetricsPort.HasValue())
+    {
+        if (StartServer(CommandLine::Options.MetricsPort.GetValue()))
+            LOG(Error, "Failed to start performance counters server on port {0}", CommandLine::Options.MetricsPort.GetValue());
+    }
+
+    return false;
+}
+
+void PerformanceCountersService::Update()
+{
+    // Swap the frame counters (the last frame values are reported until the next frame end)
+    const int32 count = (int32)Platform::AtomicRead(&CountersCount);
+    for (int32 i = 0; i < count; i++)
+    {
+        if (Counters[i].Type == PerformanceCounterType::FrameCounter)
+            LastFrameValues[i] = Platform::InterlockedExchange(&PerformanceCounters::Values[i], 0);
+    }
+
+    // Update engine counters
+    PerformanceCounters::Set(FPSCounter, Engine::GetFramesPerSecond());
+    PerformanceCounters::Set(FrameCounter, (int64)Engine::FrameCount);
+    PerformanceCounters::Set(UpdateTimeCounter, (int64)(Time::Update.LastLength * 1000000.0));
+    PerformanceCounters::Set(DrawTimeCounter, (int64)(Time::Draw.LastLength * 1000000.0));
+    PerformanceCounters::Set(PhysicsTimeCounter, (int64)(Time::Physics.LastLength * 1000000.0));
+    PerformanceCounters::Set(MemoryCounter, (int64)Platform::GetProcessMemoryStats().UsedPhysicalMemory);
+    const StreamingStats streaming = Streaming::GetStats();
+    PerformanceCounters::Set(StreamingResourcesCounter, streaming.ResourcesCount);
+    PerformanceCounters::Set(StreamingInCounter, streaming.StreamingResourcesCount);
+}
+
+void PerformanceCountersService::Dispose()
+{
+    if (ServerThread)
+    {
+        Platform::AtomicStore(&ServerExit, 1);
+        ServerThread->Join();
+        Delete(ServerThread);
+        ServerThread = nullptr;
+        Network::DestroySocket(ServerSocket);
+    }
+}
+
+int32 PerformanceCounters::Register(const StringView& name, PerformanceCounterType type)
+{
+    ScopeLock lock(CountersLocker);
+    const int32 count = (int32)Platform::AtomicRead(&CountersCount);
+    for (int32 i = 0; i < count; i++)
+    {
+        if (Counters[i].Name == name)
+            return i;
+    }
+    if (count == PERFORMANCE_COUNTERS_MAX)
+    {
+        LOG(Warning, "Cannot register performance counter {0}. Limit of {1} counters reached.", name, PERFORMANCE_COUNTERS_MAX);
+        return -1;
+    }
+    Counters[count].Name = name;
+    Counters[count].Type = type;
+    Values[count] = 0;
+    LastFrameValues[count] = 0;
+    Platform::AtomicStore(&CountersCount, count + 1);
+    return count;
+}
+
+int32 PerformanceCounters::Find(const StringView& name)
+{
+    ScopeLock lock(CountersLocker);
+    const int32 count = (int32)Platform::AtomicRead(&CountersCount);
+    for (int32 i = 0; i < count; i++)
+    {
+        if (Counters[i].Name == name)
+            return i;
+    }
+    return -1;
+}
+
+int64 PerformanceCounters::Get(int32 counter)
+{
+    if (counter < 0 || counter >= (int32)Platform::AtomicRead(&CountersCount))
+        return 0;
+    if (Counters[counter].Type == PerformanceCounterType::FrameCounter)
+        return LastFrameValues[counter];
+    return Platform::AtomicRead(&Values[counter]);
+}
+
+Array<PerformanceCounterValue> PerformanceCounters::GetValues()
+{
+    ScopeLock lock(CountersLocker);
+    const int32 count = (int32)Platform::AtomicRead(&CountersCount);
+    Array<PerformanceCounterValue> result;
+    result.Resize(count);
+    for (int32 i = 0; i < count; i++)
+    {
+        auto& e = result[i];
+        e.Name = Counters[i].Name;
+        e.Type = Counters[i].Type;
+        e.Value = Get(i);
+    }
+    return result;
+}
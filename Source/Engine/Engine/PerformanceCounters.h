@@ -0,0 +1,126 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Core/Types/String.h"
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Platform/Platform.h"
+#include "Engine/Scripting/ScriptingType.h"
+
+// The maximum amount of the registered performance counters
+#define PERFORMANCE_COUNTERS_MAX 1024
+
+/// <summary>
+/// The performance counter types.
+/// </summary>
+API_ENUM() enum class PerformanceCounterType : byte
+{
+    /// <summary>
+    /// The cumulative counter that only grows (eg. total amount of sent bytes).
+    /// </summary>
+    Counter,
+
+    /// <summary>
+    /// The counter reset every frame. Reports the value accumulated during the last frame (eg. amount of spawned actors within a frame).
+    /// </summary>
+    FrameCounter,
+
+    /// <summary>
+    /// The gauge that holds the last value set (eg. memory usage or queue size).
+    /// </summary>
+    Gauge,
+};
+
+/// <summary>
+/// The performance counter value.
+/// </summary>
+API_STRUCT(NoDefault) struct FLAXENGINE_API PerformanceCounterValue
+{
+    DECLARE_SCRIPTING_TYPE_MINIMAL(PerformanceCounterValue);
+
+    /// <summary>
+    /// The counter name.
+    /// </summary>
+    API_FIELD() String Name;
+
+    /// <summary>
+    /// The counter type.
+    /// </summary>
+    API_FIELD() PerformanceCounterType Type;
+
+    /// <summary>
+    /// The counter value.
+    /// </summary>
+    API_FIELD() int64 Value;
+};
+
+/// <summary>
+/// The registry of the named performance counters and gauges. Updating a registered counter is a single atomic operation so it can be used on hot paths and from any thread.
+/// </summary>
+/// <remarks>
+/// Counters can be queried remotely when the '-metricsport !port!' command line switch is used (eg. on dedicated servers). The endpoint responds to any HTTP request with the current values in the plain text format (compatible with Prometheus scrapers).
+/// </remarks>
+API_CLASS(Static) class FLAXENGINE_API PerformanceCounters
+{
+    DECLARE_SCRIPTING_TYPE_NO_SPAWN(PerformanceCounters);
+public:
+    // The counters values storage (indexed with the counter identifier).
+    static int64 volatile Values[PERFORMANCE_COUNTERS_MAX];
+
+public:
+    /// <summary>
+    /// Registers the performance counter. Returns the existing counter if the one with the same name has been already registered.
+    /// </summary>
+    /// <param name="name">The counter name (eg. 'Network.SentBytes').</param>
+    /// <param name="type">The counter type.</param>
+    /// <returns>The counter identifier or -1 if failed (the registry is full).</returns>
+    API_FUNCTION() static int32 Register(const StringView& name, PerformanceCounterType type);
+
+    /// <summary>
+    /// Finds the registered performance counter by name.
+    /// </summary>
+    /// <param name="name">The counter name.</param>
+    /// <returns>The counter identifier or -1 if missing.</returns>
+    API_FUNCTION() static int32 Find(const StringView& name);
+
+    /// <summary>
+    /// Adds the value to the counter.
+    /// </summary>
+    /// <param name="counter">The counter identifier.</param>
+    /// <param name="value">The value to add.</param>
+    API_FUNCTION() FORCE_INLINE static void Add(int32 counter, int64 value = 1)
+    {
+        if (counter >= 0)
+            Platform::InterlockedAdd(&Values[counter], value);
+    }
+
+    /// <summary>
+    /// Sets the counter value (eg. for gauges).
+    /// </summary>
+    /// <param name="counter">The counter identifier.</param>
+    /// <param name="value">The value to set.</param>
+    API_FUNCTION() FORCE_INLINE static void Set(int32 counter, int64 value)
+    {
+        if (counter >= 0)
+            Platform::AtomicStore(&Values[counter], value);
+    }
+
+    /// <summary>
+    /// Gets the counter value. Frame counters report the value accumulated during the last frame.
+    /// </summary>
+    /// <param name="counter">The counter identifier.</param>
+    /// <returns>The counter value.</returns>
+    API_FUNCTION() static int64 Get(int32 counter);
+
+    /// <summary>
+    /// Gets the values of all the registered counters.
+    /// </summary>
+    /// <returns>The counters values.</returns>
+    API_FUNCTION() static Array<PerformanceCounterValue> GetValues();
+};
+
+// Adds the value to the named performance counter (registered on the first use).
+#define PERFORMANCE_COUNTER_ADD(name, type, value) { static const int32 _performanceCounter = PerformanceCounters::Register(TEXT(name), type); PerformanceCounters::Add(_performanceCounter, value); }
+
+// Sets the value of the named performance gauge (registered on the first use).
+#define PERFORMANCE_GAUGE_SET(name, value) { static const int32 _performanceCounter = PerformanceCounters::Register(TEXT(name), PerformanceCounterType::Gauge); PerformanceCounters::Set(_performanceCounter, value); }
@@ -11,9 +11,9 @@ namespace FlaxEngine
     public static class RandomUtil
     {
         /// <summary>
-        /// Random numbers generator.
+        /// Random numbers generator. Uses the replay random seed when recording or playing the replay (see <see cref="Replay"/>).
         /// </summary>
-        public static readonly Random Random = new Random();
+        public static readonly Random Random = Replay.IsActive ? new Random((int)Replay.RandomSeed) : new Random();
 
         /// <summary>
         /// Generates a pseudo-random number from normalized range [0;1].
@@ -0,0 +1,236 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "Replay.h"
+#include "CommandLine.h"
+#include "EngineService.h"
+#include "Engine/Core/Log.h"
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Platform/File.h"
+#include "Engine/Platform/Platform.h"
+#include "Engine/Serialization/FileWriteStream.h"
+#include "Engine/Profiler/ProfilerCPU.h"
+#include <stdlib.h>
+
+#define REPLAY_MAGIC 0x4C505246 // 'FRPL'
+#define REPLAY_VERSION 1
+
+// Replay file layout:
+// [Header] uint32 Magic, int32 Version, uint32 RandomSeed
+// [Frame] int32 Size, Records...
+// [Record] byte Type, uint32 Channel, int32 Size, Data...
+
+enum class ReplayMode : byte
+{
+    None = 0,
+    Record = 1,
+    Playback = 2,
+};
+
+byte Replay::_mode = (byte)ReplayMode::None;
+uint32 Replay::_randomSeed = 0;
+uint32 Replay::_frame = 0;
+
+namespace
+{
+    struct RecordInfo
+    {
+        ReplayRecordType Type;
+        bool Read;
+        uint32 Channel;
+        int32 Offset;
+        int32 Size;
+    };
+
+    // Recording
+    FileWriteStream* Output = nullptr;
+    Array<byte> FrameData;
+
+    // Playback
+    Array<byte> Input;
+    int32 InputPosition = 0;
+    Array<RecordInfo> FrameRecords;
+
+    bool LoadFrame()
+    {
+        FrameRecords.Clear();
+        if (InputPosition + (int32)sizeof(int32) > Input.Count())
+            return true;
+        int32 frameSize;
+        Platform::MemoryCopy(&frameSize, Input.Get() + InputPosition, sizeof(int32));
+        InputPosition += sizeof(int32);
+        const int32 frameEnd = InputPosition + frameSize;
+        if (frameSize < 0 || frameEnd > Input.Count())
+        {
+            LOG(Warning, "Corrupted replay data at frame {0}", Replay::GetFrame());
+            return true;
+        }
+        while (InputPosition + (int32)(sizeof(byte) + sizeof(uint32) + sizeof(int32)) <= frameEnd)
+        {
+            RecordInfo& record = FrameRecords.AddOne();
+            const byte* ptr = Input.Get() + InputPosition;
+            record.Type = (ReplayRecordType)ptr[0];
+            record.Read = false;
+            Platform::MemoryCopy(&record.Channel, ptr + 1, sizeof(uint32));
+            Platform::MemoryCopy(&record.Size, ptr + 1 + sizeof(uint32), sizeof(int32));
+            record.Offset = InputPosition + sizeof(byte) + sizeof(uint32) + sizeof(int32);
+            InputPosition = record.Offset + record.Size;
+        }
+        InputPosition = frameEnd;
+        return false;
+    }
+}
+
+class ReplayService : public EngineService
+{
+public:
+    ReplayService()
+        : EngineService(TEXT("Replay"), -950)
+    {
+    }
+
+    bool Init() override
+    {
+        // Start replay before any game code runs to capture the whole session
+        if (CommandLine::Options.ReplayPlay.HasValue())
+            Replay::StartPlayback(CommandLine::Options.ReplayPlay.GetValue());
+        else if (CommandLine::Options.ReplayRecord.HasValue())
+            Replay::StartRecording(CommandLine::Options.ReplayRecord.GetValue());
+        return false;
+    }
+
+    void Dispose() override
+    {
+        Replay::Stop();
+    }
+};
+
+ReplayService ReplayServiceInstance;
+
+bool Replay::StartRecording(const StringView& path)
+{
+    Stop();
+    Output = FileWriteStream::Open(path);
+    if (!Output)
+    {
+        LOG(Error, "Failed to create replay file '{0}'", path);
+        return true;
+    }
+
+    // Reseed the engine random numbers generator to replay the same random values
+    _randomSeed = (uint32)Platform::GetTimeCycles();
+    srand(_randomSeed);
+
+    Output->WriteUint32(REPLAY_MAGIC);
+    Output->WriteInt32(REPLAY_VERSION);
+    Output->WriteUint32(_randomSeed);
+    _mode = (byte)ReplayMode::Record;
+    _frame = 0;
+    LOG(Info, "Recording replay to '{0}'", path);
+    return false;
+}
+
+bool Replay::StartPlayback(const StringView& path)
+{
+    Stop();
+    if (File::ReadAllBytes(path, Input))
+    {
+        LOG(Error, "Failed to load replay file '{0}'", path);
+        return true;
+    }
+    uint32 magic = 0;
+    int32 version = 0;
+    if (Input.Count() >= 12)
+    {
+        Platform::MemoryCopy(&magic, Input.Get(), sizeof(uint32));
+        Platform::MemoryCopy(&version, Input.Get() + 4, sizeof(int32));
+        Platform::MemoryCopy(&_randomSeed, Input.Get() + 8, sizeof(uint32));
+    }
+    if (magic != REPLAY_MAGIC || version != REPLAY_VERSION)
+    {
+        LOG(Error, "Invalid replay file '{0}' (version {1})", path, version);
+        Input.Resize(0);
+        return true;
+    }
+    InputPosition = 12;
+    srand(_randomSeed);
+    _mode = (byte)ReplayMode::Playback;
+    _frame = 0;
+    LOG(Info, "Playing replay from '{0}'", path);
+    return false;
+}
+
+void Replay::Stop()
+{
+    if (Output)
+    {
+        OnFrame();
+        LOG(Info, "Replay recording ended after {0} frames", _frame);
+        Delete(Output);
+        Output = nullptr;
+        FrameData.Resize(0);
+        FrameData.SetCapacity(0);
+    }
+    if (_mode == (byte)ReplayMode::Playback)
+    {
+        LOG(Info, "Replay playback ended after {0} frames", _frame);
+        Input.Resize(0);
+        Input.SetCapacity(0);
+        FrameRecords.Resize(0);
+        FrameRecords.SetCapacity(0);
+    }
+    _mode = (byte)ReplayMode::None;
+}
+
+void Replay::OnFrame()
+{
+    if (Output)
+    {
+        // Save the previous frame (skip iterations that didn't tick the engine)
+        if (FrameData.HasItems())
+        {
+            PROFILE_CPU_NAMED("Replay.Save");
+            Output->WriteInt32(FrameData.Count());
+            Output->WriteBytes(FrameData.Get(), FrameData.Count());
+            FrameData.Clear();
+            _frame++;
+        }
+    }
+    else if (_mode == (byte)ReplayMode::Playback)
+    {
+        // Load the next frame
+        if (LoadFrame())
+        {
+            Stop();
+            return;
+        }
+        _frame++;
+    }
+}
+
+void Replay::Write(ReplayRecordType type, uint32 channel, const void* data, int32 size)
+{
+    ASSERT_LOW_LAYER(_mode == (byte)ReplayMode::Record && size >= 0);
+    const int32 start = FrameData.Count();
+    FrameData.AddUninitialized(sizeof(byte) + sizeof(uint32) + sizeof(int32) + size);
+    byte* ptr = FrameData.Get() + start;
+    ptr[0] = (byte)type;
+    Platform::MemoryCopy(ptr + 1, &channel, sizeof(uint32));
+    Platform::MemoryCopy(ptr + 1 + sizeof(uint32), &size, sizeof(int32));
+    if (size != 0)
+        Platform::MemoryCopy(ptr + 1 + sizeof(uint32) + sizeof(int32), data, size);
+}
+
+bool Replay::Read(ReplayRecordType type, uint32 channel, Span<byte>& data)
+{
+    ASSERT_LOW_LAYER(_mode == (byte)ReplayMode::Playback);
+    for (RecordInfo& record : FrameRecords)
+    {
+        if (!record.Read && record.Type == type && record.Channel == channel)
+        {
+            record.Read = true;
+            data = Span<byte>(Input.Get() + record.Offset, record.Size);
+            return true;
+        }
+    }
+    return false;
+}
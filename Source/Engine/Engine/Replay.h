@@ -0,0 +1,110 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Core/Types/BaseTypes.h"
+#include "Engine/Core/Types/Span.h"
+#include "Engine/Core/Types/StringView.h"
+#include "Engine/Scripting/ScriptingType.h"
+
+/// <summary>
+/// The types of the data recorded in the replay.
+/// </summary>
+enum class ReplayRecordType : byte
+{
+    // The engine tick (channel is the tick type: 0 - update, 1 - physics, 2 - draw) with the unscaled delta time.
+    Tick = 0,
+    // The input device event (channel is the device: 0 - mouse, 1 - keyboard).
+    InputEvent = 1,
+    // The gamepad state (channel is the gamepad index).
+    GamepadState = 2,
+    // The received network peer event (channel is the peer host id).
+    NetworkEvent = 3,
+};
+
+/// <summary>
+/// Deterministic input and network replay for performance issues reproduction. Records the engine ticks timing, input events, gamepads state, received network messages and random seed into a replay file. Playback re-drives the game with the recorded data (ignoring the real input, network traffic and the wall clock) so the same session can be profiled on a development machine.
+/// </summary>
+/// <remarks>
+/// Use the '-replayrecord !path!' command line switch to record the session and '-replayplay !path!' to play it back (can be combined with '-benchmark' and '-hitchdetector'). The recorded data is consumed in order per main loop iteration so the game code needs to be deterministic for the given input (eg. use the engine random numbers).
+/// </remarks>
+API_CLASS(Static) class FLAXENGINE_API Replay
+{
+    DECLARE_SCRIPTING_TYPE_NO_SPAWN(Replay);
+    friend class ReplayService;
+
+private:
+    static byte _mode;
+    static uint32 _randomSeed;
+    static uint32 _frame;
+
+public:
+    /// <summary>
+    /// Returns true if the session is being recorded.
+    /// </summary>
+    API_PROPERTY() FORCE_INLINE static bool IsRecording()
+    {
+        return _mode == 1;
+    }
+
+    /// <summary>
+    /// Returns true if the session is being played from the replay.
+    /// </summary>
+    API_PROPERTY() FORCE_INLINE static bool IsPlaying()
+    {
+        return _mode == 2;
+    }
+
+    /// <summary>
+    /// Returns true if the session is being recorded or played from the replay.
+    /// </summary>
+    API_PROPERTY() FORCE_INLINE static bool IsActive()
+    {
+        return _mode != 0;
+    }
+
+    /// <summary>
+    /// Gets the random numbers seed of the replay session (valid only when replay is active). Can be used by the game to seed own random number generators.
+    /// </summary>
+    API_PROPERTY() FORCE_INLINE static uint32 GetRandomSeed()
+    {
+        return _randomSeed;
+    }
+
+    /// <summary>
+    /// Gets the index of the current replay frame (main loop iteration that ticked the engine).
+    /// </summary>
+    API_PROPERTY() FORCE_INLINE static uint32 GetFrame()
+    {
+        return _frame;
+    }
+
+    /// <summary>
+    /// Starts recording the session to the replay file. Should be called at the game startup to capture the whole session.
+    /// </summary>
+    /// <param name="path">The output file path.</param>
+    /// <returns>True if failed, otherwise false.</returns>
+    API_FUNCTION() static bool StartRecording(const StringView& path);
+
+    /// <summary>
+    /// Starts playing the session from the replay file. Should be called at the game startup to replay the whole session.
+    /// </summary>
+    /// <param name="path">The replay file path.</param>
+    /// <returns>True if failed, otherwise false.</returns>
+    API_FUNCTION() static bool StartPlayback(const StringView& path);
+
+    /// <summary>
+    /// Stops the recording (and saves the replay file) or the playback.
+    /// </summary>
+    API_FUNCTION() static void Stop();
+
+public:
+    // Called by the engine main loop at the beginning of every iteration. Saves the previous frame data or loads the next frame data.
+    static void OnFrame();
+
+    // Adds the data record to the current frame (when recording). Must be called on the main thread.
+    static void Write(ReplayRecordType type, uint32 channel, const void* data, int32 size);
+
+    // Pops the next unread data record of the given type and channel from the current frame (when playing). Must be called on the main thread. Returns false if there is no more data.
+    static bool Read(ReplayRecordType type, uint32 channel, Span<byte>& data);
+};
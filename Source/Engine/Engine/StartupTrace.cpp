@@ -0,0 +1,191 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "StartupTrace.h"
+#include "Engine.h"
+#include "CommandLine.h"
+#include "Globals.h"
+#include "Engine/Core/Log.h"
+#include "Engine/Core/Math/Math.h"
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Core/Collections/Sorting.h"
+#include "Engine/Core/Types/DateTime.h"
+#include "Engine/Core/Types/TimeSpan.h"
+#include "Engine/Core/Types/StringBuilder.h"
+#include "Engine/Platform/CriticalSection.h"
+#include "Engine/Platform/File.h"
+#include "Engine/Platform/FileSystem.h"
+#include "Engine/Platform/StringUtils.h"
+
+// The maximum time (in seconds) to wait for the pending stages after the first frame
+#define STARTUP_TRACE_TIMEOUT 120.0
+// The minimum stage duration (in milliseconds) to be listed in the log summary
+#define STARTUP_TRACE_SUMMARY_MIN_TIME 1.0
+
+bool StartupTrace::_active = false;
+
+namespace
+{
+    struct StartupEvent
+    {
+        const Char* Name;
+        double Start;
+        double End;
+        uint64 ThreadID;
+        int32 Depth;
+    };
+
+    CriticalSection Locker;
+    Array<StartupEvent> Events;
+    Array<StartupEvent> Pending;
+    THREADLOCAL int32 Depth = 0;
+    double StartTime = 0.0;
+    double FirstFrameTime = 0.0;
+
+    void AddEvent(const Char* name, double start, double end, int32 depth)
+    {
+        ScopeLock lock(Locker);
+        Events.Add({ name, start, end, Platform::GetCurrentThreadID(), depth });
+    }
+
+    bool SortByStart(const StartupEvent& a, const StartupEvent& b)
+    {
+        return a.Start < b.Start || (a.Start == b.Start && a.Depth < b.Depth);
+    }
+
+    void Save(const String& path)
+    {
+        // Chrome trace format (view in chrome://tracing or ui.perfetto.dev)
+        StringBuilder json;
+        json.Append(TEXT("{\"traceEvents\":[\n"));
+        json.AppendFormat(TEXT("{{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":{0},\"args\":{{\"name\":\"Main\"}}}}"), Globals::MainThreadID);
+        for (const StartupEvent& e : Events)
+        {
+            json.AppendFormat(TEXT(",\n{{\"name\":\"{0}\",\"ph\":\"X\",\"pid\":0,\"tid\":{1},\"ts\":{2:.3f},\"dur\":{3:.3f}}}"),
+                              e.Name, e.ThreadID, (e.Start - StartTime) * 1000000.0, (e.End - e.Start) * 1000000.0);
+        }
+        json.AppendFormat(TEXT(",\n{{\"name\":\"First Frame\",\"ph\":\"i\",\"s\":\"g\",\"pid\":0,\"tid\":{0},\"ts\":{1:.3f}}}"), Globals::MainThreadID, (FirstFrameTime - StartTime) * 1000000.0);
+        json.Append(TEXT("\n]}\n"));
+        if (File::WriteAllText(path, json, Encoding::ANSI))
+            LOG(Warning, "Failed to save startup trace to {0}", path);
+        else
+            LOG(Info, "Startup trace saved to {0}", path);
+    }
+
+    void Finish()
+    {
+        const double endTime = Platform::GetTimeSeconds();
+        ScopeLock lock(Locker);
+        for (const StartupEvent& e : Pending)
+        {
+            LOG(Warning, "Startup stage {0} didn't end within {1} seconds after the first frame", e.Name, STARTUP_TRACE_TIMEOUT);
+            Events.Add({ e.Name, e.Start, endTime, e.ThreadID, 0 });
+        }
+        Pending.Clear();
+        Sorting::QuickSort(Events.Get(), Events.Count(), &SortByStart);
+
+        // Log summary
+        LOG(Info, "Startup time: {0:.2f} ms to the first frame, {1:.2f} ms total", (FirstFrameTime - StartTime) * 1000.0, (endTime - StartTime) * 1000.0);
+        for (const StartupEvent& e : Events)
+        {
+            const double time = (e.End - e.Start) * 1000.0;
+            if (time >= STARTUP_TRACE_SUMMARY_MIN_TIME)
+                LOG(Info, "  {0}{1}: {2:.2f} ms (at {3:.2f} ms)", StringView(TEXT("                "), Math::Min(e.Depth * 2, 16)), e.Name, time, (e.Start - StartTime) * 1000.0);
+        }
+
+        // Export trace
+        String path;
+        if (CommandLine::Options.StartupTrace.HasValue())
+            path = CommandLine::Options.StartupTrace.GetValue();
+        if (path.IsEmpty() && (CommandLine::Options.StartupTrace.HasValue() || !BUILD_RELEASE))
+        {
+#if USE_EDITOR
+            const String folder = Globals::ProjectFolder / TEXT("Logs");
+#else
+            const String folder = Globals::ProductLocalFolder / TEXT("Logs");
+#endif
+            FileSystem::CreateDirectory(folder);
+            path = folder / TEXT("StartupTrace.json");
+        }
+        if (path.HasChars())
+            Save(path);
+
+        Events.Resize(0);
+        Events.SetCapacity(0);
+    }
+}
+
+StartupTrace::Scope::Scope(const Char* name)
+    : Name(name)
+{
+    if (_active)
+    {
+        Start = Platform::GetTimeSeconds();
+        Depth++;
+    }
+    else
+    {
+        Start = -1.0;
+    }
+}
+
+StartupTrace::Scope::~Scope()
+{
+    if (Start < 0.0)
+        return;
+    Depth--;
+    if (_active)
+        AddEvent(Name, Start, Platform::GetTimeSeconds(), Depth);
+}
+
+void StartupTrace::Start()
+{
+    // Include the time before the platform timer initialization
+    const double time = Platform::GetTimeSeconds();
+    StartTime = time - (DateTime::Now() - Engine::StartupTime).GetTotalSeconds();
+    Events.EnsureCapacity(128);
+    AddEvent(TEXT("Platform Init"), StartTime, time, 0);
+    _active = true;
+}
+
+void StartupTrace::BeginPending(const Char* name)
+{
+    if (!_active)
+        return;
+    ScopeLock lock(Locker);
+    Pending.Add({ name, Platform::GetTimeSeconds(), 0.0, Platform::GetCurrentThreadID(), 0 });
+}
+
+void StartupTrace::EndPending(const Char* name)
+{
+    if (!_active)
+        return;
+    ScopeLock lock(Locker);
+    for (int32 i = 0; i < Pending.Count(); i++)
+    {
+        StartupEvent& e = Pending[i];
+        if (StringUtils::Compare(e.Name, name) == 0)
+        {
+            e.End = Platform::GetTimeSeconds();
+            Events.Add(e);
+            Pending.RemoveAt(i);
+            break;
+        }
+    }
+}
+
+void StartupTrace::OnFrame()
+{
+    if (!_active)
+        return;
+    const double time = Platform::GetTimeSeconds();
+    if (FirstFrameTime <= 0.0)
+        FirstFrameTime = time;
+    Locker.Lock();
+    const bool hasPending = Pending.HasItems();
+    Locker.Unlock();
+    if (!hasPending || time - FirstFrameTime > STARTUP_TRACE_TIMEOUT)
+    {
+        _active = false;
+        Finish();
+    }
+}
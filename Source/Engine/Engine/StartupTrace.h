@@ -0,0 +1,64 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Core/Types/BaseTypes.h"
+
+/// <summary>
+/// Startup timeline trace. Records the durations of the engine startup stages (services init, content and scripting loading, shader caches, splash screen and first scene load) until the first presented frame. Logs the summary and exports the timeline as a Chrome trace (.json).
+/// </summary>
+/// <remarks>
+/// The trace file is saved to the logs folder in non-release builds or when using the '-startuptrace [path]' command line switch.
+/// </remarks>
+class FLAXENGINE_API StartupTrace
+{
+public:
+    /// <summary>
+    /// Records the startup stage that covers the scope lifetime.
+    /// </summary>
+    struct FLAXENGINE_API Scope
+    {
+        const Char* Name;
+        double Start;
+
+        Scope(const Char* name);
+        ~Scope();
+    };
+
+private:
+    static bool _active;
+
+public:
+    /// <summary>
+    /// Returns true if the startup is being traced (until the first frame gets presented and the pending stages end).
+    /// </summary>
+    FORCE_INLINE static bool IsActive()
+    {
+        return _active;
+    }
+
+    /// <summary>
+    /// Starts the trace. Called by the engine after the platform initialization.
+    /// </summary>
+    static void Start();
+
+    /// <summary>
+    /// Begins the startup stage that ends in the later frames (eg. first scene loading).
+    /// </summary>
+    /// <param name="name">The stage name. Must be a static string.</param>
+    static void BeginPending(const Char* name);
+
+    /// <summary>
+    /// Ends the startup stage started with BeginPending.
+    /// </summary>
+    /// <param name="name">The stage name.</param>
+    static void EndPending(const Char* name);
+
+    /// <summary>
+    /// Called by the engine after drawing the frame. Ends the trace after the first frame once all pending stages end.
+    /// </summary>
+    static void OnFrame();
+};
+
+// Records the startup stage that covers the current scope
+#define STARTUP_TRACE_SCOPE(name) StartupTrace::Scope startupTraceScope(TEXT(name))
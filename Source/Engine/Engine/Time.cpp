@@ -2,6 +2,7 @@
 
 #include "Time.h"
 #include "EngineService.h"
+#include "Replay.h"
 #include "Engine/Core/Math/Math.h"
 #include "Engine/Platform/Platform.h"
 #include "Engine/Core/Config/TimeSettings.h"
@@ -12,6 +13,26 @@ namespace
     bool FixedDeltaTimeEnable;
     float FixedDeltaTimeValue;
     float MaxUpdateDeltaTime = 0.1f;
+
+    bool TickBegin(Time::TickData& data, uint32 tick, double time, float targetFps, float maxDeltaTime)
+    {
+        if (Replay::IsPlaying())
+        {
+            // Use the recorded ticks instead of the wall clock
+            Span<byte> record;
+            if (!Replay::Read(ReplayRecordType::Tick, tick, record) || record.Length() != sizeof(int64))
+                return false;
+            int64 ticks;
+            Platform::MemoryCopy(&ticks, record.Get(), sizeof(int64));
+            data.Advance(time, ((double)ticks + 0.5) / TimeSpan::TicksPerSecond);
+            return true;
+        }
+        if (!data.OnTickBegin(time, targetFps, maxDeltaTime))
+            return false;
+        if (Replay::IsRecording())
+            Replay::Write(ReplayRecordType::Tick, tick, &data.UnscaledDeltaTime.Ticks, sizeof(int64));
+        return true;
+    }
 }
 
 bool Time::_gamePaused = false;
@@ -52,6 +73,7 @@ void TimeSettings::Apply()
     Time::DrawFPS = DrawFPS;
     Time::TimeScale = TimeScale;
     ::MaxUpdateDeltaTime = MaxUpdateDeltaTime;
+    FramePacer::Mode = FramePacing;
 }
 
 void Time::TickData::Synchronize(float targetFps, double currentTime)
@@ -249,7 +271,7 @@ void Time::Synchronize()
 
 bool Time::OnBeginUpdate(double time)
 {
-    if (Update.OnTickBegin(time, UpdateFPS, MaxUpdateDeltaTime))
+    if (TickBegin(Update, 0, time, UpdateFPS, MaxUpdateDeltaTime))
     {
         Current = &Update;
         return true;
@@ -259,7 +281,7 @@ bool Time::OnBeginUpdate(double time)
 
 bool Time::OnBeginPhysics(double time)
 {
-    if (Physics.OnTickBegin(time, PhysicsFPS, _physicsMaxDeltaTime))
+    if (TickBegin(Physics, 1, time, PhysicsFPS, _physicsMaxDeltaTime))
     {
         Current = &Physics;
         return true;
@@ -269,7 +291,7 @@ bool Time::OnBeginPhysics(double time)
 
 bool Time::OnBeginDraw(double time)
 {
-    if (Draw.OnTickBegin(time, DrawFPS, 1.0f))
+    if (TickBegin(Draw, 2, time, DrawFPS, 1.0f))
     {
         Current = &Draw;
         return true;
@@ -79,7 +79,11 @@ API_CLASS(Static) class FLAXENGINE_API Time
         virtual bool OnTickBegin(double time, float targetFps, float maxDeltaTime);
         virtual void OnTickEnd();
 
-    protected:
+        /// <summary>
+        /// Advances the tick time by the given delta (eg. recorded in the replay).
+        /// </summary>
+        /// <param name="time">The tick start time.</param>
+        /// <param name="deltaTime">The unscaled delta time (in seconds).</param>
         void Advance(double time, double deltaTime);
     };
 
@@ -24,3 +24,6 @@ struct FoliageInstance;
 
 // Size of the cluster container for instances
 #define FOLIAGE_CLUSTER_CAPACITY (64)
+
+// Minimal amount of incremental instances edits (add, remove or move) after which the foliage type quad-tree gets rebuilt to stay balanced (scales with the instances count)
+#define FOLIAGE_CLUSTER_REBALANCE_EDITS (4096)
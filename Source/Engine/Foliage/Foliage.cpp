@@ -5,14 +5,19 @@
 #include "FoliageCluster.h"
 #include "Engine/Core/Log.h"
 #include "Engine/Core/Random.h"
+#include "Engine/Core/Math/FrustumCulling.h"
 #include "Engine/Engine/Engine.h"
 #include "Engine/Graphics/RenderTask.h"
 #if !FOLIAGE_USE_SINGLE_QUAD_TREE
 #include "Engine/Threading/JobSystem.h"
 #if FOLIAGE_USE_DRAW_CALLS_BATCHING
+#include "Engine/Graphics/Graphics.h"
 #include "Engine/Graphics/RenderTools.h"
+#include "Engine/Graphics/GPUBuffer.h"
+#include "Engine/Graphics/GPUContext.h"
 #include "Engine/Graphics/GPUDevice.h"
 #include "Engine/Renderer/RenderList.h"
+#include "Engine/Renderer/Utils/GPUDrivenCulling.h"
 #endif
 #endif
 #include "Engine/Level/SceneQuery.h"
@@ -24,6 +29,89 @@
 
 #define FOLIAGE_GET_DRAW_MODES(renderContext, type) (type.DrawModes & renderContext.View.Pass & renderContext.View.GetShadowsDrawPassMask(type.ShadowsMode))
 #define FOLIAGE_CAN_DRAW(renderContext, type) (type.IsReady() && FOLIAGE_GET_DRAW_MODES(renderContext, type) != DrawPass::None && type.Model->CanBeRendered())
+#if FOLIAGE_USE_SINGLE_QUAD_TREE
+#define FOLIAGE_GET_CLUSTERS(type) Clusters
+#define FOLIAGE_GET_ROOT(type) Root
+#else
+#define FOLIAGE_GET_CLUSTERS(type) type.Clusters
+#define FOLIAGE_GET_ROOT(type) type.Root
+#endif
+
+namespace
+{
+    typedef Array<FoliageCluster*, InlinedAllocation<32>> ClusterPath;
+
+    void UpdateInstanceBounds(FoliageInstance& instance, const FoliageType& type, const Transform& transform)
+    {
+        instance.Bounds = BoundingSphere::Empty;
+        Vector3 corners[8];
+        auto& meshes = type.Model->LODs[0].Meshes;
+        for (int32 j = 0; j < meshes.Count(); j++)
+        {
+            meshes[j].GetBox().GetCorners(corners);
+
+            for (int32 k = 0; k < 8; k++)
+            {
+                Vector3::Transform(corners[k], transform, corners[k]);
+            }
+            BoundingSphere meshBounds;
+            BoundingSphere::FromPoints(corners, 8, meshBounds);
+            ASSERT(meshBounds.Radius > ZeroTolerance);
+
+            BoundingSphere::Merge(instance.Bounds, meshBounds, instance.Bounds);
+        }
+        instance.Bounds.Radius += ZeroTolerance;
+    }
+
+    // Finds the leaf cluster for the given location (instances are placed in quad-tree by their bounds center) and optionally collects the clusters on the way down
+    FoliageCluster* FindLeafCluster(FoliageCluster* cluster, const Vector3& position, ClusterPath* path = nullptr)
+    {
+        if (path)
+            path->Add(cluster);
+        while (cluster->Children[0])
+        {
+            cluster = cluster->GetChild(position);
+            if (path)
+                path->Add(cluster);
+        }
+        return cluster;
+    }
+
+    // Refits the cached clusters bounds from the leaf up to the root
+    void RefitClusters(const ClusterPath& path)
+    {
+        for (int32 i = path.Count() - 1; i >= 0; i--)
+            path[i]->RefitTotalBoundsAndCullDistance();
+    }
+}
+
+#if !FOLIAGE_USE_SINGLE_QUAD_TREE && FOLIAGE_USE_DRAW_CALLS_BATCHING
+
+namespace
+{
+    MaterialBase* GetMeshMaterial(const FoliageType& type, const Mesh& mesh)
+    {
+        // Check entry visibility
+        const auto& entry = type.Entries[mesh.GetMaterialSlotIndex()];
+        if (!entry.Visible || !mesh.IsInitialized())
+            return nullptr;
+        const MaterialSlot& slot = type.Model->MaterialSlots[mesh.GetMaterialSlotIndex()];
+
+        // Select material
+        MaterialBase* material;
+        if (entry.Material && entry.Material->IsLoaded())
+            material = entry.Material;
+        else if (slot.Material && slot.Material->IsLoaded())
+            material = slot.Material;
+        else
+            material = GPUDevice::Instance->GetDefaultMaterial();
+        if (!material || !material->IsSurface())
+            return nullptr;
+        return material;
+    }
+}
+
+#endif
 
 Foliage::Foliage(const SpawnParams& params)
     : Actor(params)
@@ -38,26 +126,23 @@ Foliage::Foliage(const SpawnParams& params)
 #endif
 }
 
+Foliage::~Foliage()
+{
+#if !FOLIAGE_USE_SINGLE_QUAD_TREE && FOLIAGE_USE_DRAW_CALLS_BATCHING
+    for (GPUType& gpuType : _gpuTypes)
+        SAFE_DELETE_GPU_RESOURCE(gpuType.Instances);
+    SAFE_DELETE_GPU_RESOURCE(_gpuInstanceBuffer);
+    SAFE_DELETE_GPU_RESOURCE(_gpuArgsBuffer);
+#endif
+}
+
 void Foliage::AddToCluster(ChunkedArray<FoliageCluster, FOLIAGE_CLUSTER_CHUNKS_SIZE>& clusters, FoliageCluster* cluster, FoliageInstance& instance)
 {
     ASSERT(instance.Bounds.Radius > ZeroTolerance);
-    ASSERT(cluster->Bounds.Intersects(instance.Bounds));
 
-    // Find target cluster
+    // Find target cluster (instances outside the root bounds are placed in the closest border cell)
     while (cluster->Children[0])
-    {
-#define CHECK_CHILD(idx) \
-			if (cluster->Children[idx]->Bounds.Intersects(instance.Bounds)) \
-			{ \
-				cluster = cluster->Children[idx]; \
-				continue; \
-			}
-        CHECK_CHILD(0);
-        CHECK_CHILD(1);
-        CHECK_CHILD(2);
-        CHECK_CHILD(3);
-#undef CHECK_CHILD
-    }
+        cluster = cluster->GetChild(instance.Bounds.Center);
 
     // Check if it's not full
     if (cluster->Instances.Count() != FOLIAGE_CLUSTER_CAPACITY)
@@ -165,27 +250,66 @@ void Foliage::DrawCluster(RenderContext& renderContext, FoliageCluster* cluster,
     else
     {
         // Draw visible instances
-        const auto frame = Engine::FrameCount;
+        const uint32 frame = (uint32)Engine::FrameCount;
         const auto model = type.Model.Get();
-        for (int32 i = 0; i < cluster->Instances.Count(); i++)
+        const FrustumCulling::Planes frustum(renderContext.View.CullingFrustum);
+        FrustumCulling::Spheres spheres;
+        FoliageInstance* const* instances = cluster->Instances.Get();
+        const int32 instancesCount = cluster->Instances.Count();
+        for (int32 start = 0; start < instancesCount; start += FrustumCulling::BatchSize)
         {
-            auto& instance = *cluster->Instances.Get()[i];
-            BoundingSphere sphere = instance.Bounds;
-            sphere.Center -= viewOrigin;
-            if (Float3::Distance(renderContext.View.Position, sphere.Center) - (float)sphere.Radius < instance.CullDistance &&
-                renderContext.View.CullingFrustum.Intersects(sphere))
+            // Frustum cull the batch of instances at once
+            const int32 batchSize = Math::Min(instancesCount - start, (int32)FrustumCulling::BatchSize);
+            spheres.Clear();
+            for (int32 i = 0; i < batchSize; i++)
+                spheres.Add(instances[start + i]->Bounds, viewOrigin);
+            for (uint64 visible = FrustumCulling::CullSpheres(frustum, spheres); visible != 0; visible &= visible - 1)
             {
-                const auto modelFrame = instance.DrawState.PrevFrame + 1;
-
-                // Select a proper LOD index (model may be culled)
-                int32 lodIndex = RenderTools::ComputeModelLOD(model, sphere.Center, (float)sphere.Radius, renderContext);
-                if (lodIndex == -1)
+                auto& instance = *instances[start + FrustumCulling::GetFirstVisible(visible)];
+                BoundingSphere sphere = instance.Bounds;
+                sphere.Center -= viewOrigin;
+                if (Float3::Distance(renderContext.View.Position, sphere.Center) - (float)sphere.Radius < instance.CullDistance)
                 {
-                    // Handling model fade-out transition
-                    if (modelFrame == frame && instance.DrawState.PrevLOD != -1)
+                    const auto modelFrame = instance.DrawState.PrevFrame + 1;
+
+                    // Select a proper LOD index (model may be culled)
+                    int32 lodIndex = RenderTools::ComputeModelLOD(model, sphere.Center, (float)sphere.Radius, renderContext);
+                    if (lodIndex == -1)
+                    {
+                        // Handling model fade-out transition
+                        if (modelFrame == frame && instance.DrawState.PrevLOD != -1)
+                        {
+                            // Check if start transition
+                            if (instance.DrawState.LODTransition == 255)
+                            {
+                                instance.DrawState.LODTransition = 0;
+                            }
+
+                            RenderTools::UpdateModelLODTransition(instance.DrawState.LODTransition);
+
+                            // Check if end transition
+                            if (instance.DrawState.LODTransition == 255)
+                            {
+                                instance.DrawState.PrevLOD = lodIndex;
+                            }
+                            else
+                            {
+                                const auto prevLOD = model->ClampLODIndex(instance.DrawState.PrevLOD);
+                                const float normalizedProgress = static_cast<float>(instance.DrawState.LODTransition) * (1.0f / 255.0f);
+                                DrawInstance(renderContext, instance, type, model, prevLOD, normalizedProgress, drawCallsLists, result);
+                            }
+                        }
+                        instance.DrawState.PrevFrame = frame;
+                        continue;
+                    }
+                    lodIndex += renderContext.View.ModelLODBias;
+                    lodIndex = model->ClampLODIndex(lodIndex);
+
+                    // Check if it's the new frame and could update the drawing state (note: model instance could be rendered many times per frame to different viewports)
+                    if (modelFrame == frame)
                     {
                         // Check if start transition
-                        if (instance.DrawState.LODTransition == 255)
+                        if (instance.DrawState.PrevLOD != lodIndex && instance.DrawState.LODTransition == 255)
                         {
                             instance.DrawState.LODTransition = 0;
                         }
@@ -197,65 +321,222 @@ void Foliage::DrawCluster(RenderContext& renderContext, FoliageCluster* cluster,
                         {
                             instance.DrawState.PrevLOD = lodIndex;
                         }
-                        else
-                        {
-                            const auto prevLOD = model->ClampLODIndex(instance.DrawState.PrevLOD);
-                            const float normalizedProgress = static_cast<float>(instance.DrawState.LODTransition) * (1.0f / 255.0f);
-                            DrawInstance(renderContext, instance, type, model, prevLOD, normalizedProgress, drawCallsLists, result);
-                        }
                     }
-                    instance.DrawState.PrevFrame = frame;
-                    continue;
-                }
-                lodIndex += renderContext.View.ModelLODBias;
-                lodIndex = model->ClampLODIndex(lodIndex);
-
-                // Check if it's the new frame and could update the drawing state (note: model instance could be rendered many times per frame to different viewports)
-                if (modelFrame == frame)
-                {
-                    // Check if start transition
-                    if (instance.DrawState.PrevLOD != lodIndex && instance.DrawState.LODTransition == 255)
+                    // Check if there was a gap between frames in drawing this model instance
+                    else if (modelFrame < frame || instance.DrawState.PrevLOD == -1)
                     {
-                        instance.DrawState.LODTransition = 0;
+                        // Reset state
+                        instance.DrawState.PrevLOD = lodIndex;
+                        instance.DrawState.LODTransition = 255;
                     }
 
-                    RenderTools::UpdateModelLODTransition(instance.DrawState.LODTransition);
-
-                    // Check if end transition
-                    if (instance.DrawState.LODTransition == 255)
+                    // Draw
+                    if (instance.DrawState.PrevLOD == lodIndex)
                     {
-                        instance.DrawState.PrevLOD = lodIndex;
+                        DrawInstance(renderContext, instance, type, model, lodIndex, 0.0f, drawCallsLists, result);
+                    }
+                    else if (instance.DrawState.PrevLOD == -1)
+                    {
+                        const float normalizedProgress = static_cast<float>(instance.DrawState.LODTransition) * (1.0f / 255.0f);
+                        DrawInstance(renderContext, instance, type, model, lodIndex, 1.0f - normalizedProgress, drawCallsLists, result);
+                    }
+                    else
+                    {
+                        const auto prevLOD = model->ClampLODIndex(instance.DrawState.PrevLOD);
+                        const float normalizedProgress = static_cast<float>(instance.DrawState.LODTransition) * (1.0f / 255.0f);
+                        DrawInstance(renderContext, instance, type, model, prevLOD, normalizedProgress, drawCallsLists, result);
+                        DrawInstance(renderContext, instance, type, model, lodIndex, normalizedProgress - 1.0f, drawCallsLists, result);
                     }
-                }
-                // Check if there was a gap between frames in drawing this model instance
-                else if (modelFrame < frame || instance.DrawState.PrevLOD == -1)
-                {
-                    // Reset state
-                    instance.DrawState.PrevLOD = lodIndex;
-                    instance.DrawState.LODTransition = 255;
-                }
 
-                // Draw
-                if (instance.DrawState.PrevLOD == lodIndex)
-                {
-                    DrawInstance(renderContext, instance, type, model, lodIndex, 0.0f, drawCallsLists, result);
-                }
-                else if (instance.DrawState.PrevLOD == -1)
-                {
-                    const float normalizedProgress = static_cast<float>(instance.DrawState.LODTransition) * (1.0f / 255.0f);
-                    DrawInstance(renderContext, instance, type, model, lodIndex, 1.0f - normalizedProgress, drawCallsLists, result);
-                }
-                else
-                {
-                    const auto prevLOD = model->ClampLODIndex(instance.DrawState.PrevLOD);
-                    const float normalizedProgress = static_cast<float>(instance.DrawState.LODTransition) * (1.0f / 255.0f);
-                    DrawInstance(renderContext, instance, type, model, prevLOD, normalizedProgress, drawCallsLists, result);
-                    DrawInstance(renderContext, instance, type, model, lodIndex, normalizedProgress - 1.0f, drawCallsLists, result);
+                    //DebugDraw::DrawSphere(instance.Bounds, Color::YellowGreen);
+
+                    instance.DrawState.PrevFrame = frame;
                 }
+            }
+        }
+    }
+}
+
+bool Foliage::CanDrawTypeOnGPU(const RenderContext& renderContext, const FoliageType& type) const
+{
+    // Lightmapped instances use different lightmaps, transparent materials need sorting and distortion and motion vectors passes don't use instancing
+    if (EnumHasAnyFlags(_staticFlags, StaticFlags::Lightmap))
+        return false;
+    DrawPass unsupportedModes = DrawPass::Forward | DrawPass::Distortion;
+    if ((_staticFlags & StaticFlags::Transform) == StaticFlags::None)
+        unsupportedModes |= DrawPass::MotionVectors;
+    const DrawPass typeDrawModes = FOLIAGE_GET_DRAW_MODES(renderContext, type);
+    for (const auto& modelLod : type.Model->LODs)
+    {
+        for (const auto& mesh : modelLod.Meshes)
+        {
+            const MaterialBase* material = GetMeshMaterial(type, mesh);
+            if (material && EnumHasAnyFlags(typeDrawModes & material->GetDrawModes(), unsupportedModes))
+                return false;
+        }
+    }
+    return true;
+}
+
+void Foliage::UpdateGPUType(GPUContext* context, const FoliageType& type, GPUType& gpuType)
+{
+    PROFILE_CPU();
+    gpuType.Dirty = false;
+
+    // Collect instances of the foliage type that are added to the clusters (positions are relative to the type bounds center to keep precision in large worlds)
+    Array<GPUDrivenCulling::LODInstance> data;
+    gpuType.Origin = type.Root->Bounds.GetCenter();
+    gpuType.MaxRadius = 0.0f;
+    const float densityScale = type.UseDensityScaling ? GetGlobalDensityScale() * type.DensityScalingScale : 1.0f;
+    for (auto i = Instances.Begin(); i.IsNotEnd(); ++i)
+    {
+        const FoliageInstance& instance = *i;
+        if (instance.Type != type.Index || instance.Random >= densityScale)
+            continue;
+        Matrix world;
+        const Transform transform = _transform.LocalToWorld(instance.Transform);
+        const Float3 translation = transform.Translation - gpuType.Origin;
+        Matrix::Transformation(transform.Scale, transform.Orientation, translation, world);
+        auto& e = data.AddOne();
+        e.Origin = Float3(world.M41, world.M42, world.M43);
+        e.Random = instance.Random;
+        e.Transform1 = Float3(world.M11, world.M12, world.M13);
+        e.CullDistance = instance.CullDistance;
+        e.Transform2 = Float3(world.M21, world.M22, world.M23);
+        e.Radius = (float)instance.Bounds.Radius;
+        e.Transform3 = Float3(world.M31, world.M32, world.M33);
+        e.Padding0 = 0.0f;
+        e.Center = Float3(instance.Bounds.Center - gpuType.Origin);
+        e.Padding1 = 0.0f;
+        gpuType.MaxRadius = Math::Max(gpuType.MaxRadius, e.Radius);
+    }
+
+    // Upload instances
+    gpuType.InstancesCount = 0;
+    if (data.IsEmpty())
+        return;
+    if (!gpuType.Instances)
+        gpuType.Instances = GPUDevice::Instance->CreateBuffer(TEXT("Foliage.Instances"));
+    const uint32 size = data.Count() * sizeof(GPUDrivenCulling::LODInstance);
+    if (gpuType.Instances->GetSize() < size && gpuType.Instances->Init(GPUBufferDescription::Structured(data.Count(), sizeof(GPUDrivenCulling::LODInstance))))
+    {
+        LOG(Error, "Failed to setup foliage instances buffer.");
+        return;
+    }
+    context->UpdateBuffer(gpuType.Instances, data.Get(), size);
+    gpuType.InstancesCount = data.Count();
+}
+
+void Foliage::CullOnGPU(RenderContext& renderContext)
+{
+    for (GPUType& gpuType : _gpuTypes)
+        gpuType.CulledList = nullptr;
+    if (!Graphics::GPUDrivenCulling || !GPUDrivenCulling::Instance()->CanUse())
+        return;
+    PROFILE_CPU();
+    GPUContext* context = GPUDevice::Instance->GetMainContext();
+    for (int32 i = FoliageTypes.Count(); i < _gpuTypes.Count(); i++)
+        SAFE_DELETE_GPU_RESOURCE(_gpuTypes[i].Instances);
+    _gpuTypes.Resize(FoliageTypes.Count());
+
+    // Collect foliage types that can be culled and drawn on a GPU
+    Array<GPUDrivenCulling::LODInstances, RendererAllocation> batches;
+    Array<int32, RendererAllocation> batchTypes;
+    for (int32 i = 0; i < FoliageTypes.Count(); i++)
+    {
+        const FoliageType& type = FoliageTypes[i];
+        GPUType& gpuType = _gpuTypes[i];
+        if (!type.Root || !FOLIAGE_CAN_DRAW(renderContext, type) || !CanDrawTypeOnGPU(renderContext, type))
+            continue;
+        if (gpuType.Dirty)
+            UpdateGPUType(context, type, gpuType);
+        if (gpuType.InstancesCount == 0)
+            continue;
 
-                //DebugDraw::DrawSphere(instance.Bounds, Color::YellowGreen);
+        // Report the screen size of the nearest instance to the model streaming (LOD is selected on a GPU)
+        BoundingBox bounds = type.Root->TotalBounds;
+        bounds.Minimum -= renderContext.View.Origin;
+        bounds.Maximum -= renderContext.View.Origin;
+        const Vector3 nearest = CollisionsHelper::ClosestPointBoxPoint(bounds, Vector3(renderContext.View.Position));
+        RenderTools::ComputeModelLOD(type.Model.Get(), Float3(nearest), gpuType.MaxRadius, renderContext);
+
+        auto& batch = batches.AddOne();
+        batch.Instances = gpuType.Instances;
+        batch.InstancesCount = gpuType.InstancesCount;
+        batch.Origin = gpuType.Origin;
+        batch.Model = type.Model.Get();
+        batch.ArgsOffset = 0;
+        batchTypes.Add(i);
+    }
+    if (batches.IsEmpty())
+        return;
 
-                instance.DrawState.PrevFrame = frame;
+    // Cull instances and select LODs (types that failed fallback to drawing on a CPU)
+    if (!_gpuInstanceBuffer)
+    {
+        _gpuInstanceBuffer = GPUDevice::Instance->CreateBuffer(TEXT("Foliage.CulledInstances"));
+        _gpuArgsBuffer = GPUDevice::Instance->CreateBuffer(TEXT("Foliage.CulledArgs"));
+    }
+    if (GPUDrivenCulling::Instance()->CullLODInstances(context, renderContext, batches, _gpuInstanceBuffer, _gpuArgsBuffer))
+        return;
+    for (int32 i = 0; i < batches.Count(); i++)
+    {
+        GPUType& gpuType = _gpuTypes[batchTypes[i]];
+        gpuType.ArgsOffset = batches[i].ArgsOffset;
+        gpuType.CulledList = renderContext.List;
+    }
+}
+
+void Foliage::DrawTypeGPU(RenderContext& renderContext, const FoliageType& type, const GPUType& gpuType)
+{
+    const DrawPass typeDrawModes = FOLIAGE_GET_DRAW_MODES(renderContext, type);
+    PROFILE_CPU_ASSET(type.Model);
+
+    // Draw instances culled on a GPU with the indirect draw arguments for each mesh of each LOD
+    uint32 argsOffset = gpuType.ArgsOffset;
+    for (const auto& modelLod : type.Model->LODs)
+    {
+        for (const auto& mesh : modelLod.Meshes)
+        {
+            const uint32 meshArgsOffset = argsOffset;
+            argsOffset += sizeof(GPUDrawIndexedIndirectArgs);
+            MaterialBase* material = GetMeshMaterial(type, mesh);
+            if (!material)
+                continue;
+            const auto& entry = type.Entries[mesh.GetMaterialSlotIndex()];
+            const MaterialSlot& slot = type.Model->MaterialSlots[mesh.GetMaterialSlotIndex()];
+            const auto shadowsMode = entry.ShadowsMode & slot.ShadowsMode;
+            const auto drawModes = typeDrawModes & renderContext.View.GetShadowsDrawPassMask(shadowsMode) & material->GetDrawModes();
+            if (!EnumHasAnyFlags(drawModes, DrawPass::Depth | DrawPass::GBuffer))
+                continue;
+
+            // Setup draw call
+            BatchedDrawCall batch;
+            DrawCall& drawCall = batch.DrawCall;
+            drawCall.Material = material;
+            mesh.GetDrawCallGeometry(drawCall);
+            drawCall.InstanceCount = 0;
+            drawCall.Draw.IndirectArgsBuffer = _gpuArgsBuffer;
+            drawCall.Draw.IndirectArgsOffset = meshArgsOffset;
+            drawCall.World = Matrix::Identity;
+            drawCall.ObjectPosition = Float3(gpuType.Origin - renderContext.View.Origin);
+            drawCall.Surface.PrevWorld = drawCall.World;
+            drawCall.Surface.GeometrySize = mesh.GetBox().GetSize();
+            drawCall.WorldDeterminantSign = 1;
+            batch.InstanceBuffer = _gpuInstanceBuffer;
+
+            // Add draw call batch to proper draw lists
+            const int32 batchIndex = renderContext.List->BatchedDrawCalls.Add(MoveTemp(batch));
+            if (EnumHasAnyFlags(drawModes, DrawPass::Depth))
+            {
+                renderContext.List->DrawCallsLists[(int32)DrawCallsListType::Depth].PreBatchedDrawCalls.Add(batchIndex);
+            }
+            if (EnumHasAnyFlags(drawModes, DrawPass::GBuffer))
+            {
+                if (entry.ReceiveDecals)
+                    renderContext.List->DrawCallsLists[(int32)DrawCallsListType::GBuffer].PreBatchedDrawCalls.Add(batchIndex);
+                else
+                    renderContext.List->DrawCallsLists[(int32)DrawCallsListType::GBufferNoDecals].PreBatchedDrawCalls.Add(batchIndex);
             }
         }
     }
@@ -295,40 +576,51 @@ void Foliage::DrawCluster(RenderContext& renderContext, FoliageCluster* cluster,
     {
         // Draw visible instances
         const auto frame = Engine::FrameCount;
-        for (int32 i = 0; i < cluster->Instances.Count(); i++)
+        const FrustumCulling::Planes frustum(renderContext.View.CullingFrustum);
+        FrustumCulling::Spheres spheres;
+        FoliageInstance* const* instances = cluster->Instances.Get();
+        const int32 instancesCount = cluster->Instances.Count();
+        for (int32 start = 0; start < instancesCount; start += FrustumCulling::BatchSize)
         {
-            auto& instance = *cluster->Instances[i];
-            auto& type = FoliageTypes[instance.Type];
-            BoundingSphere sphere = instance.Bounds;
-            sphere.Center -= viewOrigin;
-
-            // Check if can draw this instance
-            if (type._canDraw &&
-                Float3::Distance(renderContext.View.Position, sphere.Center) - (float)sphere.Radius < instance.CullDistance &&
-                renderContext.View.CullingFrustum.Intersects(sphere))
+            // Frustum cull the batch of instances at once
+            const int32 batchSize = Math::Min(instancesCount - start, (int32)FrustumCulling::BatchSize);
+            spheres.Clear();
+            for (int32 i = 0; i < batchSize; i++)
+                spheres.Add(instances[start + i]->Bounds, viewOrigin);
+            for (uint64 visible = FrustumCulling::CullSpheres(frustum, spheres); visible != 0; visible &= visible - 1)
             {
-                Matrix world;
-                const Transform transform = _transform.LocalToWorld(instance.Transform);
-                const Float3 translation = transform.Translation - renderContext.View.Origin;
-                Matrix::Transformation(transform.Scale, transform.Orientation, translation, world);
-
-                // Disable motion blur
-                instance.DrawState.PrevWorld = world;
-
-                // Draw model
-                draw.Lightmap = _scene->LightmapsData.GetReadyLightmap(instance.Lightmap.TextureIndex);
-                draw.LightmapUVs = &instance.Lightmap.UVsArea;
-                draw.Buffer = &type.Entries;
-                draw.World = &world;
-                draw.DrawState = &instance.DrawState;
-                draw.Bounds = sphere;
-                draw.PerInstanceRandom = instance.Random;
-                draw.DrawModes = type._drawModes;
-                type.Model->Draw(renderContext, draw);
-
-                //DebugDraw::DrawSphere(instance.Bounds, Color::YellowGreen);
-
-                instance.DrawState.PrevFrame = frame;
+                auto& instance = *instances[start + FrustumCulling::GetFirstVisible(visible)];
+                auto& type = FoliageTypes[instance.Type];
+                BoundingSphere sphere = instance.Bounds;
+                sphere.Center -= viewOrigin;
+
+                // Check if can draw this instance
+                if (type._canDraw &&
+                    Float3::Distance(renderContext.View.Position, sphere.Center) - (float)sphere.Radius < instance.CullDistance)
+                {
+                    Matrix world;
+                    const Transform transform = _transform.LocalToWorld(instance.Transform);
+                    const Float3 translation = transform.Translation - renderContext.View.Origin;
+                    Matrix::Transformation(transform.Scale, transform.Orientation, translation, world);
+
+                    // Disable motion blur
+                    instance.DrawState.PrevWorld = world;
+
+                    // Draw model
+                    draw.Lightmap = _scene->LightmapsData.GetReadyLightmap(instance.Lightmap.TextureIndex);
+                    draw.LightmapUVs = &instance.Lightmap.UVsArea;
+                    draw.Buffer = &type.Entries;
+                    draw.World = &world;
+                    draw.DrawState = &instance.DrawState;
+                    draw.Bounds = sphere;
+                    draw.PerInstanceRandom = instance.Random;
+                    draw.DrawModes = type._drawModes;
+                    type.Model->Draw(renderContext, draw);
+
+                    //DebugDraw::DrawSphere(instance.Bounds, Color::YellowGreen);
+
+                    instance.DrawState.PrevFrame = frame;
+                }
             }
         }
     }
@@ -406,7 +698,16 @@ void Foliage::DrawFoliageJob(int32 i)
     {
         DrawCallsList drawCallsLists[MODEL_MAX_LODS];
         for (RenderContext& renderContext : _renderContextBatch->Contexts)
+        {
+#if FOLIAGE_USE_DRAW_CALLS_BATCHING
+            if (i < _gpuTypes.Count() && _gpuTypes[i].CulledList == renderContext.List)
+            {
+                DrawTypeGPU(renderContext, type, _gpuTypes[i]);
+                continue;
+            }
+#endif
             DrawType(renderContext, type, drawCallsLists);
+        }
     }
 }
 
@@ -431,24 +732,12 @@ void Foliage::DrawType(RenderContext& renderContext, const FoliageType& type, Dr
             const auto& mesh = meshes.Get()[meshIndex];
             auto& drawCall = drawCallsList.Get()[meshIndex];
             drawCall.DrawCall.Material = nullptr;
-
-            // Check entry visibility
-            const auto& entry = type.Entries[mesh.GetMaterialSlotIndex()];
-            if (!entry.Visible || !mesh.IsInitialized())
+            MaterialBase* material = GetMeshMaterial(type, mesh);
+            if (!material)
                 continue;
+            const auto& entry = type.Entries[mesh.GetMaterialSlotIndex()];
             const MaterialSlot& slot = type.Model->MaterialSlots[mesh.GetMaterialSlotIndex()];
 
-            // Select material
-            MaterialBase* material;
-            if (entry.Material && entry.Material->IsLoaded())
-                material = entry.Material;
-            else if (slot.Material && slot.Material->IsLoaded())
-                material = slot.Material;
-            else
-                material = GPUDevice::Instance->GetDefaultMaterial();
-            if (!material || !material->IsSurface())
-                continue;
-
             // Select draw modes
             const auto shadowsMode = entry.ShadowsMode & slot.ShadowsMode;
             const auto drawModes = typeDrawModes & renderContext.View.GetShadowsDrawPassMask(shadowsMode) & material->GetDrawModes();
@@ -543,6 +832,15 @@ void Foliage::DrawType(RenderContext& renderContext, const FoliageType& type, Dr
 #endif
 }
 
+void Foliage::InvalidateGPU()
+{
+#if !FOLIAGE_USE_SINGLE_QUAD_TREE && FOLIAGE_USE_DRAW_CALLS_BATCHING
+    // Upload instances again before the next GPU culling
+    for (GPUType& gpuType : _gpuTypes)
+        gpuType.Dirty = true;
+#endif
+}
+
 int32 Foliage::GetInstancesCount() const
 {
     return Instances.Count();
@@ -659,29 +957,38 @@ void Foliage::AddInstance(const FoliageInstance& instance)
         return;
 
     // Update bounds
-    Vector3 corners[8];
-    auto& meshes = type->Model->LODs[0].Meshes;
-    const Transform transform = _transform.LocalToWorld(data->Transform);
-    for (int32 j = 0; j < meshes.Count(); j++)
-    {
-        meshes[j].GetBox().GetCorners(corners);
+    UpdateInstanceBounds(*data, *type, _transform.LocalToWorld(data->Transform));
 
-        for (int32 k = 0; k < 8; k++)
-        {
-            Vector3::Transform(corners[k], transform, corners[k]);
-        }
-        BoundingSphere meshBounds;
-        BoundingSphere::FromPoints(corners, 8, meshBounds);
-        ASSERT(meshBounds.Radius > ZeroTolerance);
-
-        BoundingSphere::Merge(data->Bounds, meshBounds, data->Bounds);
-    }
-    data->Bounds.Radius += ZeroTolerance;
+    // Insert into the quad-tree
+    if (CanAddToClusters(*type, *data))
+        InsertToClusters(*type, *data);
+    InvalidateGPU();
 }
 
 void Foliage::RemoveInstance(ChunkedArray<FoliageInstance, FOLIAGE_INSTANCE_CHUNKS_SIZE>::Iterator i)
 {
+    auto& instance = *i;
+    auto& type = FoliageTypes[instance.Type];
+
+    // Remove from the quad-tree
+    bool failed = RemoveFromClusters(type, instance);
+
+    // Last instance gets moved into the removed slot so update the reference to it
+    FoliageInstance* last = &Instances[Instances.Count() - 1];
+    if (last != &instance)
+        failed |= ReplaceInClusters(FoliageTypes[last->Type], last, &instance);
+
     Instances.Remove(i);
+    InvalidateGPU();
+    if (failed)
+    {
+        // Clusters are out of sync so rebuild them
+        RebuildClusters();
+    }
+    else
+    {
+        OnClustersEdited(type, 1);
+    }
 }
 
 void Foliage::SetInstanceTransform(int32 index, const Transform& value)
@@ -689,31 +996,122 @@ void Foliage::SetInstanceTransform(int32 index, const Transform& value)
     auto& instance = Instances[index];
     auto type = &FoliageTypes[instance.Type];
 
+    // Remove from the quad-tree (using the old bounds)
+    const bool failed = RemoveFromClusters(*type, instance);
+
     // Change transform
     instance.Transform = value;
+    InvalidateGPU();
 
     // Update bounds
     instance.Bounds = BoundingSphere::Empty;
-    if (!type->IsReady())
-        return;
-    Vector3 corners[8];
-    auto& meshes = type->Model->LODs[0].Meshes;
-    const Transform transform = _transform.LocalToWorld(instance.Transform);
-    for (int32 j = 0; j < meshes.Count(); j++)
+    if (type->IsReady())
+        UpdateInstanceBounds(instance, *type, _transform.LocalToWorld(instance.Transform));
+
+    // Insert into the quad-tree (using the new bounds)
+    if (failed)
+        RebuildClusters();
+    else if (CanAddToClusters(*type, instance))
+        InsertToClusters(*type, instance);
+}
+
+bool Foliage::CanAddToClusters(const FoliageType& type, const FoliageInstance& instance) const
+{
+    const float densityScale = type.UseDensityScaling ? GetGlobalDensityScale() * type.DensityScalingScale : 1.0f;
+    return type.IsReady() && instance.Random < densityScale;
+}
+
+void Foliage::InsertToClusters(FoliageType& type, FoliageInstance& instance)
+{
+    auto& clusters = FOLIAGE_GET_CLUSTERS(type);
+    auto& root = FOLIAGE_GET_ROOT(type);
+    BoundingBox box;
+    BoundingBox::FromSphere(instance.Bounds, box);
+    int32 edits = 1;
+    if (!root)
+    {
+        // Setup first and topmost cluster
+        clusters.Resize(1);
+        root = &clusters[0];
+        root->Init(box);
+    }
+    else if (root->Bounds.Contains(box) != ContainmentType::Contains)
     {
-        meshes[j].GetBox().GetCorners(corners);
+        // Instances outside the root cluster end up in the border cells which degrades the quad-tree so rebalance it sooner
+        edits = FOLIAGE_CLUSTER_CAPACITY;
+    }
 
-        for (int32 k = 0; k < 8; k++)
-        {
-            Vector3::Transform(corners[k], transform, corners[k]);
-        }
-        BoundingSphere meshBounds;
-        BoundingSphere::FromPoints(corners, 8, meshBounds);
-        ASSERT(meshBounds.Radius > ZeroTolerance);
+    // Insert into the leaf cluster
+    ClusterPath path;
+    FoliageCluster* cluster = FindLeafCluster(root, instance.Bounds.Center, &path);
+    if (cluster->Instances.Count() == FOLIAGE_CLUSTER_CAPACITY)
+    {
+        // Subdivide cluster
+        AddToCluster(clusters, cluster, instance);
+        cluster->UpdateTotalBoundsAndCullDistance();
+        path.RemoveLast();
+    }
+    else
+    {
+        cluster->Instances.Add(&instance);
+    }
+    RefitClusters(path);
 
-        BoundingSphere::Merge(instance.Bounds, meshBounds, instance.Bounds);
+    // Update bounds of the foliage
+    if (_box.Contains(box) != ContainmentType::Contains)
+    {
+        if (Instances.Count() == 1)
+            _box = box;
+        else
+            BoundingBox::Merge(_box, box, _box);
+        BoundingSphere::FromBox(_box, _sphere);
+        if (_sceneRenderingKey != -1)
+            GetSceneRendering()->UpdateActor(this, _sceneRenderingKey);
     }
-    instance.Bounds.Radius += ZeroTolerance;
+
+    OnClustersEdited(type, edits);
+}
+
+bool Foliage::RemoveFromClusters(FoliageType& type, FoliageInstance& instance)
+{
+    FoliageCluster* root = FOLIAGE_GET_ROOT(type);
+    if (!root || !CanAddToClusters(type, instance))
+        return false;
+    ClusterPath path;
+    FoliageCluster* cluster = FindLeafCluster(root, instance.Bounds.Center, &path);
+    const int32 index = cluster->Instances.Find(&instance);
+    if (index == -1)
+        return true;
+    cluster->Instances.RemoveAt(index);
+    RefitClusters(path);
+    return false;
+}
+
+bool Foliage::ReplaceInClusters(FoliageType& type, FoliageInstance* instance, FoliageInstance* replacement)
+{
+    FoliageCluster* root = FOLIAGE_GET_ROOT(type);
+    if (!root || !CanAddToClusters(type, *instance))
+        return false;
+    FoliageCluster* cluster = FindLeafCluster(root, instance->Bounds.Center);
+    const int32 index = cluster->Instances.Find(instance);
+    if (index == -1)
+        return true;
+    cluster->Instances[index] = replacement;
+    return false;
+}
+
+void Foliage::OnClustersEdited(FoliageType& type, int32 edits)
+{
+    // Incremental edits don't rebalance the quad-tree so rebuild it once enough changes were made (amortized over many edits)
+    type._clusterEdits += edits;
+    if (type._clusterEdits < Math::Max(Instances.Count() / 4, FOLIAGE_CLUSTER_REBALANCE_EDITS))
+        return;
+#if FOLIAGE_USE_SINGLE_QUAD_TREE
+    RebuildClusters();
+#else
+    if (type.Root)
+        RebuildTypeClusters(type, type.Root->TotalBounds);
+#endif
 }
 
 void Foliage::OnFoliageTypeModelLoaded(int32 index)
@@ -775,19 +1173,30 @@ void Foliage::OnFoliageTypeModelLoaded(int32 index)
 #if FOLIAGE_USE_SINGLE_QUAD_TREE
     RebuildClusters();
 #else
+    RebuildTypeClusters(type, totalBoundsType);
+#endif
+}
+
+#if !FOLIAGE_USE_SINGLE_QUAD_TREE
+
+void Foliage::RebuildTypeClusters(FoliageType& type, const BoundingBox& bounds)
+{
+    PROFILE_CPU();
+    InvalidateGPU();
+    type._clusterEdits = 0;
     {
         PROFILE_CPU_NAMED("Setup");
 
         // Setup first and topmost cluster
         type.Clusters.Resize(1);
         type.Root = &type.Clusters[0];
-        type.Root->Init(totalBoundsType);
+        type.Root->Init(bounds);
 
         // Update bounds of the foliage
-        _box = totalBoundsType;
+        _box = bounds;
         for (auto& e : FoliageTypes)
         {
-            if (e.Index != index && e.Root)
+            if (e.Index != type.Index && e.Root)
                 BoundingBox::Merge(_box, e.Root->Bounds, _box);
         }
         BoundingSphere::FromBox(_box, _sphere);
@@ -799,11 +1208,11 @@ void Foliage::OnFoliageTypeModelLoaded(int32 index)
 
         // Create clusters for foliage type quad tree
         const float globalDensityScale = GetGlobalDensityScale();
+        const float densityScale = type.UseDensityScaling ? globalDensityScale * type.DensityScalingScale : 1.0f;
         for (auto i = Instances.Begin(); i.IsNotEnd(); ++i)
         {
             auto& instance = *i;
-            const float densityScale = type.UseDensityScaling ? globalDensityScale * type.DensityScalingScale : 1.0f;
-            if (instance.Type == index && instance.Random < densityScale)
+            if (instance.Type == type.Index && instance.Random < densityScale)
             {
                 AddToCluster(type.Clusters, type.Root, instance);
             }
@@ -813,12 +1222,16 @@ void Foliage::OnFoliageTypeModelLoaded(int32 index)
         PROFILE_CPU_NAMED("Update Cache");
         type.Root->UpdateTotalBoundsAndCullDistance();
     }
-#endif
 }
 
+#endif
+
 void Foliage::RebuildClusters()
 {
     PROFILE_CPU();
+    InvalidateGPU();
+    for (auto& type : FoliageTypes)
+        type._clusterEdits = 0;
 
     // Faster path if foliage is empty or no types is ready
     bool anyTypeReady = false;
@@ -1176,7 +1589,14 @@ void Foliage::Draw(RenderContext& renderContext)
         draw.LightmapUVs = &instance.Lightmap.UVsArea;
         draw.Buffer = &type.Entries;
         draw.World = &world;
+#if !FOLIAGE_USE_SINGLE_QUAD_TREE && FOLIAGE_USE_DRAW_CALLS_BATCHING
+        // Compact instance state has no previous frame transformation so use a temporary one
+        GeometryDrawStateData drawState;
+        drawState.PrevWorld = world;
+        draw.DrawState = &drawState;
+#else
         draw.DrawState = &instance.DrawState;
+#endif
         draw.Deformation = nullptr;
         draw.Bounds = instance.Bounds;
         draw.PerInstanceRandom = instance.Random;
@@ -1228,11 +1648,16 @@ void Foliage::Draw(RenderContextBatch& renderContextBatch)
             }
         }
 
+#if FOLIAGE_USE_DRAW_CALLS_BATCHING
+        // Cull instances for the main view on a GPU
+        CullOnGPU(renderContextBatch.GetMainContext());
+#endif
+
         // Run async job for each foliage type
         _renderContextBatch = &renderContextBatch;
         Function<void(int32)> func;
         func.Bind<Foliage, &Foliage::DrawFoliageJob>(this);
-        const uint64 waitLabel = JobSystem::Dispatch(func, FoliageTypes.Count());
+        const uint64 waitLabel = JobSystem::Dispatch(func, FoliageTypes.Count(), 1, JobPriority::High);
         renderContextBatch.WaitLabels.Add(waitLabel);
         return;
     }
@@ -8,6 +8,9 @@
 #include "FoliageType.h"
 #include "Engine/Level/Actor.h"
 
+class GPUBuffer;
+class RenderList;
+
 /// <summary>
 /// Represents a foliage actor that contains a set of instanced meshes.
 /// </summary>
@@ -18,8 +21,27 @@ API_CLASS() class FLAXENGINE_API Foliage final : public Actor
 private:
     bool _disableFoliageTypeEvents;
     int32 _sceneRenderingKey = -1;
+#if !FOLIAGE_USE_SINGLE_QUAD_TREE && FOLIAGE_USE_DRAW_CALLS_BATCHING
+    // Persistent instances of the foliage type for the GPU-driven culling
+    struct GPUType
+    {
+        GPUBuffer* Instances = nullptr;
+        int32 InstancesCount = 0;
+        Vector3 Origin = Vector3::Zero;
+        float MaxRadius = 0.0f;
+        bool Dirty = true;
+        uint32 ArgsOffset = 0;
+        const RenderList* CulledList = nullptr;
+    };
+
+    Array<GPUType> _gpuTypes;
+    GPUBuffer* _gpuInstanceBuffer = nullptr;
+    GPUBuffer* _gpuArgsBuffer = nullptr;
+#endif
 
 public:
+    ~Foliage();
+
     /// <summary>
     /// The allocated foliage instances. It's read-only.
     /// </summary>
@@ -90,14 +112,14 @@ API_CLASS() class FLAXENGINE_API Foliage final : public Actor
     API_FUNCTION() int32 GetFoliageTypeInstancesCount(int32 index) const;
 
     /// <summary>
-    /// Adds the new foliage instance. Ensure to always call <see cref="RebuildClusters"/> after editing foliage to sync cached data (call it once after editing one or more instances).
+    /// Adds the new foliage instance. Updates the clusters incrementally (calling <see cref="RebuildClusters"/> after editing is optional but can be used to rebalance them after bulk edits).
     /// </summary>
     /// <remarks>Input instance bounds, instance random and world matrix are ignored (recalculated).</remarks>
     /// <param name="instance">The instance.</param>
     API_FUNCTION() void AddInstance(API_PARAM(Ref) const FoliageInstance& instance);
 
     /// <summary>
-    /// Removes the foliage instance. Ensure to always call <see cref="RebuildClusters"/> after editing foliage to sync cached data (call it once after editing one or more instances).
+    /// Removes the foliage instance. Updates the clusters incrementally (calling <see cref="RebuildClusters"/> after editing is optional but can be used to rebalance them after bulk edits).
     /// </summary>
     /// <param name="index">The zero-based index of the instance to remove.</param>
     API_FUNCTION() void RemoveInstance(int32 index)
@@ -106,13 +128,13 @@ API_CLASS() class FLAXENGINE_API Foliage final : public Actor
     }
 
     /// <summary>
-    /// Removes the foliage instance. Ensure to always call <see cref="RebuildClusters"/> after editing foliage to sync cached data (call it once after editing one or more instances).
+    /// Removes the foliage instance. Updates the clusters incrementally (calling <see cref="RebuildClusters"/> after editing is optional but can be used to rebalance them after bulk edits).
     /// </summary>
     /// <param name="i">The iterator from foliage instances that points to the instance to remove.</param>
     void RemoveInstance(ChunkedArray<FoliageInstance, FOLIAGE_INSTANCE_CHUNKS_SIZE>::Iterator i);
 
     /// <summary>
-    /// Sets the foliage instance transformation. Ensure to always call <see cref="RebuildClusters"/> after editing foliage to sync cached data (call it once after editing one or more instances).
+    /// Sets the foliage instance transformation. Updates the clusters incrementally (calling <see cref="RebuildClusters"/> after editing is optional but can be used to rebalance them after bulk edits).
     /// </summary>
     /// <param name="index">The zero-based index of the foliage instance.</param>
     /// <param name="value">The value.</param>
@@ -125,7 +147,7 @@ API_CLASS() class FLAXENGINE_API Foliage final : public Actor
     void OnFoliageTypeModelLoaded(int32 index);
 
     /// <summary>
-    /// Rebuilds the foliage clusters used as internal acceleration structures (quad tree).
+    /// Rebuilds the foliage clusters used as internal acceleration structures (quad tree). Instances edits update clusters incrementally and rebalance them from time to time, full rebuild is required only after changing instances data directly.
     /// </summary>
     API_FUNCTION() void RebuildClusters();
 
@@ -147,6 +169,14 @@ API_CLASS() class FLAXENGINE_API Foliage final : public Actor
 
 private:
     void AddToCluster(ChunkedArray<FoliageCluster, FOLIAGE_CLUSTER_CHUNKS_SIZE>& clusters, FoliageCluster* cluster, FoliageInstance& instance);
+    bool CanAddToClusters(const FoliageType& type, const FoliageInstance& instance) const;
+    void InsertToClusters(FoliageType& type, FoliageInstance& instance);
+    bool RemoveFromClusters(FoliageType& type, FoliageInstance& instance);
+    bool ReplaceInClusters(FoliageType& type, FoliageInstance* instance, FoliageInstance* replacement);
+    void OnClustersEdited(FoliageType& type, int32 edits);
+#if !FOLIAGE_USE_SINGLE_QUAD_TREE
+    void RebuildTypeClusters(FoliageType& type, const BoundingBox& bounds);
+#endif
 #if !FOLIAGE_USE_SINGLE_QUAD_TREE && FOLIAGE_USE_DRAW_CALLS_BATCHING
     struct DrawKey
     {
@@ -172,6 +202,10 @@ API_CLASS() class FLAXENGINE_API Foliage final : public Actor
     typedef Dictionary<DrawKey, struct BatchedDrawCall, class RendererAllocation> BatchedDrawCalls;
     void DrawInstance(RenderContext& renderContext, FoliageInstance& instance, const FoliageType& type, Model* model, int32 lod, float lodDitherFactor, DrawCallsList* drawCallsLists, BatchedDrawCalls& result) const;
     void DrawCluster(RenderContext& renderContext, FoliageCluster* cluster, const FoliageType& type, DrawCallsList* drawCallsLists, BatchedDrawCalls& result) const;
+    bool CanDrawTypeOnGPU(const RenderContext& renderContext, const FoliageType& type) const;
+    void UpdateGPUType(GPUContext* context, const FoliageType& type, GPUType& gpuType);
+    void CullOnGPU(RenderContext& renderContext);
+    void DrawTypeGPU(RenderContext& renderContext, const FoliageType& type, const GPUType& gpuType);
 #else
     void DrawCluster(RenderContext& renderContext, FoliageCluster* cluster, Mesh::DrawInfo& draw);
 #endif
@@ -182,6 +216,7 @@ API_CLASS() class FLAXENGINE_API Foliage final : public Actor
     RenderContextBatch* _renderContextBatch;
 #endif
     void DrawType(RenderContext& renderContext, const FoliageType& type, DrawCallsList* drawCallsLists);
+    void InvalidateGPU();
 
 public:
     /// <summary>
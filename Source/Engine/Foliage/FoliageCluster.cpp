@@ -28,7 +28,15 @@ void FoliageCluster::UpdateTotalBoundsAndCullDistance()
         Children[1]->UpdateTotalBoundsAndCullDistance();
         Children[2]->UpdateTotalBoundsAndCullDistance();
         Children[3]->UpdateTotalBoundsAndCullDistance();
+    }
+
+    RefitTotalBoundsAndCullDistance();
+}
 
+void FoliageCluster::RefitTotalBoundsAndCullDistance()
+{
+    if (Children[0])
+    {
         TotalBounds = Children[0]->TotalBounds;
         BoundingBox::Merge(TotalBounds, Children[1]->TotalBounds, TotalBounds);
         BoundingBox::Merge(TotalBounds, Children[2]->TotalBounds, TotalBounds);
@@ -60,6 +68,15 @@ void FoliageCluster::UpdateTotalBoundsAndCullDistance()
     BoundingSphere::FromBox(TotalBounds, TotalBoundsSphere);
 }
 
+FoliageCluster* FoliageCluster::GetChild(const Vector3& position) const
+{
+    // Matches the children layout created on cluster subdivision (split in half on X and Z axes)
+    const Vector3 center = Bounds.GetCenter();
+    const bool upperX = position.X >= center.X;
+    const bool upperZ = position.Z >= center.Z;
+    return Children[upperX ? (upperZ ? 1 : 2) : (upperZ ? 3 : 0)];
+}
+
 void FoliageCluster::UpdateCullDistance()
 {
     if (Children[0])
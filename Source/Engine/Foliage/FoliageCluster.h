@@ -55,6 +55,18 @@ class FLAXENGINE_API FoliageCluster
     /// </summary>
     void UpdateTotalBoundsAndCullDistance();
 
+    /// <summary>
+    /// Updates the total bounds and cull distance of the cluster using the attached instances or the cached data of the child clusters (without updating the children). Used to refit the clusters after incremental edits.
+    /// </summary>
+    void RefitTotalBoundsAndCullDistance();
+
+    /// <summary>
+    /// Gets the child cluster (quad-tree cell) that should contain the given location. Cluster must have children.
+    /// </summary>
+    /// <param name="position">The location (eg. foliage instance bounds center).</param>
+    /// <returns>The child cluster.</returns>
+    FoliageCluster* GetChild(const Vector3& position) const;
+
     /// <summary>
     /// Updates the cull distance for all foliage instances added to the cluster and its children.
     /// </summary>
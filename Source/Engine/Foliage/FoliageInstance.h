@@ -2,11 +2,47 @@
 
 #pragma once
 
+#include "Config.h"
 #include "Engine/Core/Math/Transform.h"
 #include "Engine/Core/Math/BoundingSphere.h"
 #include "Engine/Renderer/DrawCall.h"
 #include "Engine/Level/Scene/Lightmap.h"
 
+#if !FOLIAGE_USE_SINGLE_QUAD_TREE && FOLIAGE_USE_DRAW_CALLS_BATCHING
+
+/// <summary>
+/// The compact drawing state of the foliage instance. Batched foliage drawing doesn't use per-instance motion vectors so only LOD transition state is stored (instead of the full GeometryDrawStateData).
+/// </summary>
+struct FoliageDrawState
+{
+    /// <summary>
+    /// The previous frame index (lower 32-bits of Engine::FrameCount). Used to detect new frames and rendering gaps to reset state.
+    /// </summary>
+    uint32 PrevFrame = 0;
+
+    /// <summary>
+    /// The previous frame model LOD index used. It's locked during LOD transition to cache the transition start LOD.
+    /// </summary>
+    char PrevLOD = -1;
+
+    /// <summary>
+    /// The LOD transition timer. Value 255 means the end of the transition (aka no transition), value 0 means transition started.
+    /// </summary>
+    byte LODTransition = 255;
+};
+
+template<>
+struct TIsPODType<FoliageDrawState>
+{
+    enum { Value = true };
+};
+
+#else
+
+typedef GeometryDrawStateData FoliageDrawState;
+
+#endif
+
 /// <summary>
 /// Foliage instanced mesh instance. Packed data with very little of logic. Managed by the foliage chunks and foliage actor itself.
 /// </summary>
@@ -22,7 +58,7 @@ API_STRUCT(NoPod) struct FLAXENGINE_API FoliageInstance
     /// <summary>
     /// The model drawing state.
     /// </summary>
-    GeometryDrawStateData DrawState;
+    FoliageDrawState DrawState;
 
     /// <summary>
     /// The foliage type index. Foliage types are hold in foliage actor and shared by instances using the same model.
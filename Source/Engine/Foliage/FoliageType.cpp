@@ -12,6 +12,7 @@ FoliageType::FoliageType()
     , Index(-1)
 {
     _isReady = 0;
+    _clusterEdits = 0;
 
     ReceiveDecals = true;
     UseDensityScaling = false;
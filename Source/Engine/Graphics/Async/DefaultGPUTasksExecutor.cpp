@@ -30,11 +30,20 @@ void DefaultGPUTasksExecutor::FrameEnd()
     ASSERT(_context != nullptr);
 
     // Default implementation performs async operations on end of the frame which is synchronized with a rendering thread
+    // Note: when uploads are limited by size then more (small) tasks can be executed during a single frame
+    GPUTasksManager* manager = GPUDevice::Instance->GetTasksManager();
+    const int32 maxCount = GPUTasksManager::MaxUploadSizePerFrame != 0 ? 256 : 32;
     GPUTask* buffer[32];
-    const int32 count = GPUDevice::Instance->GetTasksManager()->RequestWork(buffer, 32);
-    for (int32 i = 0; i < count; i++)
+    for (int32 total = 0; total < maxCount;)
     {
-        _context->Run(buffer[i]);
+        const int32 count = manager->RequestWork(buffer, 32);
+        for (int32 i = 0; i < count; i++)
+        {
+            _context->Run(buffer[i]);
+        }
+        total += count;
+        if (count < 32 || (GPUTasksManager::MaxUploadSizePerFrame != 0 && manager->GetFrameUploadSize() >= GPUTasksManager::MaxUploadSizePerFrame))
+            break;
     }
 
     _context->OnFrameEnd();
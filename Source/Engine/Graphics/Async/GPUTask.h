@@ -83,6 +83,15 @@ class GPUTask : public Task
         return IsRunning() && _syncPoint != 0;
     }
 
+    /// <summary>
+    /// Gets the amount of data (in bytes) uploaded to the GPU by this task. Used to limit the uploads per frame.
+    /// </summary>
+    /// <returns>The upload size (in bytes).</returns>
+    virtual uint64 GetUploadSize() const
+    {
+        return 0;
+    }
+
 public:
     /// <summary>
     /// Executes this task.
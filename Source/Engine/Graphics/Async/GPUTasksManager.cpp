@@ -43,6 +43,8 @@ void GPUTask::Enqueue()
     GPUDevice::Instance->GetTasksManager()->_tasks.Add(this);
 }
 
+uint64 GPUTasksManager::MaxUploadSizePerFrame = 0;
+
 GPUTasksManager::GPUTasksManager()
 {
     _buffers[0].EnsureCapacity(64);
@@ -81,6 +83,7 @@ void GPUTasksManager::FrameBegin()
 
 void GPUTasksManager::FrameEnd()
 {
+    _frameUploadSize = 0;
     _executor->FrameEnd();
 }
 
@@ -113,9 +116,21 @@ int32 GPUTasksManager::RequestWork(GPUTask** buffer, int32 maxCount)
             // Skip task
             break;
         case TaskState::Queued:
+        {
+            // Keep the remaining tasks for the next frame when out of the upload budget
+            const uint64 uploadSize = task->GetUploadSize();
+            if (MaxUploadSizePerFrame != 0 && uploadSize != 0 && _frameUploadSize != 0 && _frameUploadSize + uploadSize > MaxUploadSizePerFrame)
+            {
+                maxCount = count;
+                b1.Add(task);
+                break;
+            }
+            _frameUploadSize += uploadSize;
+
             // Run queued task
             buffer[count++] = task;
             break;
+        }
         case TaskState::Created:
         case TaskState::Running:
         default:
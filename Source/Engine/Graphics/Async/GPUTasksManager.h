@@ -26,6 +26,7 @@ class GPUTasksManager : public Object, public NonCopyable
     ConcurrentTaskQueue<GPUTask> _tasks;
     Array<GPUTask*> _buffers[2];
     int32 _bufferIndex = 0;
+    uint64 _frameUploadSize = 0;
 
 public:
     GPUTasksManager();
@@ -70,6 +71,19 @@ class GPUTasksManager : public Object, public NonCopyable
     void FrameEnd();
 
 public:
+    /// <summary>
+    /// The maximum amount of data (in bytes) uploaded to the GPU by the async tasks per frame. Tasks over the limit wait for the next frame (at least a single task is executed every frame). Use 0 to disable the limit.
+    /// </summary>
+    static uint64 MaxUploadSizePerFrame;
+
+    /// <summary>
+    /// Gets the amount of data (in bytes) uploaded to the GPU by the async tasks during the current frame.
+    /// </summary>
+    FORCE_INLINE uint64 GetFrameUploadSize() const
+    {
+        return _frameUploadSize;
+    }
+
     /// <summary>
     /// Requests work to do. Should be used only by GPUTasksExecutor.
     /// </summary>
@@ -7,6 +7,7 @@
 #include "Engine/Graphics/GPUBuffer.h"
 #include "Engine/Graphics/GPUResourceProperty.h"
 #include "Engine/Core/Types/DataContainer.h"
+#include "Engine/Content/Loading/ContentLoadingTrace.h"
 
 /// <summary>
 /// GPU buffer upload task.
@@ -51,6 +52,10 @@ class GPUUploadBufferTask : public GPUTask
     {
         return _buffer == resource;
     }
+    uint64 GetUploadSize() const override
+    {
+        return _data.Length();
+    }
 
 protected:
     // [GPUTask]
@@ -58,6 +63,7 @@ class GPUUploadBufferTask : public GPUTask
     {
         if (!_buffer)
             return Result::MissingResources;
+        ContentLoadingTrace::UploadTimer traceUpload(_buffer.Get(), _data.Length());
         context->GPU->UpdateBuffer(_buffer, _data.Get(), _data.Length(), _offset);
         return Result::Ok;
     }
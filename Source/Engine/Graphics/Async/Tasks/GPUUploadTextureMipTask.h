@@ -7,6 +7,7 @@
 #include "Engine/Graphics/Textures/GPUTexture.h"
 #include "Engine/Graphics/GPUResourceProperty.h"
 #include "Engine/Core/Types/DataContainer.h"
+#include "Engine/Content/Loading/ContentLoadingTrace.h"
 
 /// <summary>
 /// GPU texture mip upload task.
@@ -55,6 +56,10 @@ class GPUUploadTextureMipTask : public GPUTask
     {
         return _texture == resource;
     }
+    uint64 GetUploadSize() const override
+    {
+        return _data.Length();
+    }
 
 protected:
     // [GPUTask]
@@ -66,6 +71,7 @@ class GPUUploadTextureMipTask : public GPUTask
         ASSERT(texture->IsAllocated());
 
         // Update all array slices
+        ContentLoadingTrace::UploadTimer traceUpload(texture, _data.Length());
         const byte* dataSource = _data.Get();
         const int32 arraySize = texture->ArraySize();
         ASSERT(_data.Length() >= _slicePitch * arraySize);
@@ -25,6 +25,9 @@
 // Maximum amount of binded vertex buffers at the same time
 #define GPU_MAX_VB_BINDED 4
 
+// Maximum amount of parallel GPU contexts used for multi-threaded commands recording
+#define GPU_MAX_PARALLEL_CONTEXTS 8
+
 // Maximum amount of thread groups per dimension for compute dispatch
 #define GPU_MAX_CS_DISPATCH_THREAD_GROUPS 65535
 
@@ -22,6 +22,16 @@ DynamicBuffer::~DynamicBuffer()
     SAFE_DELETE_GPU_RESOURCE(_buffer);
 }
 
+void DynamicBuffer::SetTransient(bool value)
+{
+    if (_transient == value)
+        return;
+    _transient = value;
+
+    // Recreate the buffer on the next flush
+    SAFE_DELETE_GPU_RESOURCE(_buffer);
+}
+
 void DynamicBuffer::Flush()
 {
     // Check if has sth to flush
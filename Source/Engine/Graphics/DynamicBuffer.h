@@ -14,6 +14,7 @@ class FLAXENGINE_API DynamicBuffer
     GPUBuffer* _buffer;
     String _name;
     uint32 _stride;
+    bool _transient = false;
 
 public:
     NON_COPYABLE(DynamicBuffer);
@@ -45,6 +46,20 @@ class FLAXENGINE_API DynamicBuffer
         return _buffer;
     }
 
+    /// <summary>
+    /// Gets a value indicating whether the buffer contents are valid only within the frame they were flushed in (see GPUBufferFlags::Transient).
+    /// </summary>
+    FORCE_INLINE bool IsTransient() const
+    {
+        return _transient;
+    }
+
+    /// <summary>
+    /// Sets the transient mode of the buffer. Transient buffers have to be flushed every frame they are used in, in return the data can be written directly into the per-frame upload memory (no copy into the GPU buffer). Use only for vertex/index data rebuilt every frame.
+    /// </summary>
+    /// <param name="value">True if use the transient mode, otherwise false.</param>
+    void SetTransient(bool value);
+
     /// <summary>
     /// Clear data (begin for writing)
     /// </summary>
@@ -136,6 +151,8 @@ class FLAXENGINE_API DynamicVertexBuffer : public DynamicBuffer
     void InitDesc(GPUBufferDescription& desc, int32 numElements) override
     {
         desc = GPUBufferDescription::Vertex(_stride, numElements, GPUResourceUsage::Dynamic);
+        if (_transient)
+            desc.Flags |= GPUBufferFlags::Transient;
     }
 };
 
@@ -161,6 +178,8 @@ class FLAXENGINE_API DynamicIndexBuffer : public DynamicBuffer
     void InitDesc(GPUBufferDescription& desc, int32 numElements) override
     {
         desc = GPUBufferDescription::Index(_stride, numElements, GPUResourceUsage::Dynamic);
+        if (_transient)
+            desc.Flags |= GPUBufferFlags::Transient;
     }
 };
 
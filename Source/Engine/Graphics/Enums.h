@@ -378,6 +378,47 @@ API_ENUM() enum class CullMode : byte
     TwoSided = 2,
 };
 
+/// <summary>
+/// Pixel shading rate used by the variable rate shading (amount of pixels covered by a single pixel shader invocation). Values match the encoding used by the shading rate image texels.
+/// </summary>
+API_ENUM() enum class ShadingRate : byte
+{
+    /// <summary>
+    /// Full shading rate (a pixel shader invocation per pixel).
+    /// </summary>
+    Rate1x1 = 0x0,
+
+    /// <summary>
+    /// A pixel shader invocation per 1x2 pixels.
+    /// </summary>
+    Rate1x2 = 0x1,
+
+    /// <summary>
+    /// A pixel shader invocation per 2x1 pixels.
+    /// </summary>
+    Rate2x1 = 0x4,
+
+    /// <summary>
+    /// A pixel shader invocation per 2x2 pixels.
+    /// </summary>
+    Rate2x2 = 0x5,
+
+    /// <summary>
+    /// A pixel shader invocation per 2x4 pixels. Requires GPULimits.HasAdditionalShadingRates.
+    /// </summary>
+    Rate2x4 = 0x6,
+
+    /// <summary>
+    /// A pixel shader invocation per 4x2 pixels. Requires GPULimits.HasAdditionalShadingRates.
+    /// </summary>
+    Rate4x2 = 0x9,
+
+    /// <summary>
+    /// A pixel shader invocation per 4x4 pixels. Requires GPULimits.HasAdditionalShadingRates.
+    /// </summary>
+    Rate4x4 = 0xA,
+};
+
 /// <summary>
 /// Render target blending mode descriptor.
 /// </summary>
@@ -60,6 +60,11 @@ API_ENUM(Attributes="Flags") enum class GPUBufferFlags
     /// </summary>
     RawBuffer = 0x100,
 
+    /// <summary>
+    /// Flag for vertex/index buffers which contents are valid only within the frame they were written in (eg. debug draw or UI geometry updated every frame). Allows the backend to sub-allocate the data from the per-frame ring of the persistently mapped upload memory instead of copying it into the buffer resource. Cannot be used with shader resource or unordered access buffers.
+    /// </summary>
+    Transient = 0x200,
+
     /// <summary>
     /// Creates a structured buffer that supports unordered access and append.
     /// </summary>
@@ -71,3 +71,20 @@ void GPUContext::SetResourceState(GPUResource* resource, uint64 state, int32 sub
 void GPUContext::ForceRebindDescriptors()
 {
 }
+
+void GPUContext::BeginParallel(GPUContext* parent)
+{
+}
+
+void GPUContext::ExecuteParallel(const Span<GPUContext*>& contexts)
+{
+}
+
+GPUSyncPoint GPUContext::ExecuteAsyncCompute(GPUContext* context)
+{
+    return 0;
+}
+
+void GPUContext::WaitAsyncCompute(GPUSyncPoint syncPoint)
+{
+}
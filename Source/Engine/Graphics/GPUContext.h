@@ -7,7 +7,9 @@
 #include "Engine/Core/Math/Rectangle.h"
 #include "Engine/Core/Math/Viewport.h"
 #include "PixelFormat.h"
+#include "Enums.h"
 #include "Config.h"
+#include "Async/GPUSyncPoint.h"
 
 class GPUConstantBuffer;
 class GPUShaderProgramCS;
@@ -327,6 +329,22 @@ API_CLASS(Sealed, NoSpawn) class FLAXENGINE_API GPUContext : public ScriptingObj
     /// <param name="value">Reference value to perform against when doing a depth-stencil test.</param>
     API_FUNCTION() virtual void SetStencilRef(uint32 value) = 0;
 
+    /// <summary>
+    /// Sets the pixel shading rate for the next draw calls. Ignored if device doesn't support variable rate shading (see GPULimits.HasVariableRateShading).
+    /// </summary>
+    /// <param name="rate">The shading rate.</param>
+    API_FUNCTION() virtual void SetShadingRate(ShadingRate rate)
+    {
+    }
+
+    /// <summary>
+    /// Sets the screen-space shading rate image for the next draw calls. The coarser rate from the image and the per-draw shading rate is used. Ignored if device doesn't support it (see GPULimits.HasVariableRateShadingImage).
+    /// </summary>
+    /// <param name="image">The shading rate image (R8_UInt format with ShadingRate values, a texel per tile of GPULimits.ShadingRateImageTileSize pixels) or null to disable it.</param>
+    API_FUNCTION() virtual void SetShadingRateImage(GPUTexture* image)
+    {
+    }
+
 public:
     /// <summary>
     /// Unbinds all shader resource slots and flushes the change with the driver (used to prevent driver detection of resource hazards, eg. when down-scaling the texture).
@@ -618,4 +636,30 @@ API_CLASS(Sealed, NoSpawn) class FLAXENGINE_API GPUContext : public ScriptingObj
     /// Forces graphics backend to rebind descriptors after command list was used by external graphics library.
     /// </summary>
     virtual void ForceRebindDescriptors();
+
+public:
+    /// <summary>
+    /// Begins the parallel commands recording into this context (obtained via GPUDevice::GetParallelContext or GPUDevice::GetComputeContext). Inherits the output state (render targets, viewport, scissor and stencil reference) from the parent context. Called on the rendering thread before recording jobs start.
+    /// </summary>
+    /// <param name="parent">The parent context that will submit the recorded commands.</param>
+    virtual void BeginParallel(GPUContext* parent);
+
+    /// <summary>
+    /// Submits the commands recorded by the parallel contexts (in the given order) after the commands recorded so far into this context. Called on the rendering thread after all recording jobs end.
+    /// </summary>
+    /// <param name="contexts">The parallel contexts to execute.</param>
+    virtual void ExecuteParallel(const Span<GPUContext*>& contexts);
+
+    /// <summary>
+    /// Submits the commands recorded by the async compute context after the commands recorded so far into this context. The compute work runs concurrently to the commands recorded later into this context, thus those cannot access resources used by the compute commands until WaitAsyncCompute is called. Resources are transitioned into the compute-compatible states before the submission and stay in the last state used by the compute commands.
+    /// </summary>
+    /// <param name="context">The async compute context (obtained via GPUDevice::GetComputeContext and started with BeginParallel).</param>
+    /// <returns>The sync point of the async compute work completion (for WaitAsyncCompute) or 0 if not supported.</returns>
+    virtual GPUSyncPoint ExecuteAsyncCompute(GPUContext* context);
+
+    /// <summary>
+    /// Makes the commands recorded later into this context wait (on a GPU) for the async compute work completion.
+    /// </summary>
+    /// <param name="syncPoint">The sync point returned by ExecuteAsyncCompute.</param>
+    virtual void WaitAsyncCompute(GPUSyncPoint syncPoint);
 };
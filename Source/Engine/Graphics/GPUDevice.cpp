@@ -2,6 +2,7 @@
 
 #include "GPUDevice.h"
 #include "RenderTargetPool.h"
+#include "GPUReadback.h"
 #include "GPUPipelineState.h"
 #include "GPUResourceProperty.h"
 #include "GPUSwapChain.h"
@@ -13,6 +14,7 @@
 #include "Async/GPUTasksManager.h"
 #include "Engine/Core/Log.h"
 #include "Engine/Core/Utilities.h"
+#include "Engine/Core/Collections/Sorting.h"
 #include "Engine/Core/Types/StringBuilder.h"
 #include "Engine/Content/Assets/Shader.h"
 #include "Engine/Content/Assets/Material.h"
@@ -25,6 +27,7 @@
 #include "Engine/Profiler/Profiler.h"
 #include "Engine/Renderer/RenderList.h"
 #include "Engine/Scripting/Enums.h"
+#include "Engine/Threading/JobSystem.h"
 
 GPUResourcePropertyBase::~GPUResourcePropertyBase()
 {
@@ -225,6 +228,23 @@ uint64 GPUResource::GetMemoryUsage() const
     return _memoryUsage;
 }
 
+GPUResourceCategory GPUResource::GetCategory() const
+{
+    if (_category == GPUResourceCategory::Other)
+    {
+        const GPUResourceType type = GetResourceType();
+        if (type == GPUResourceType::Shader || type == GPUResourceType::PipelineState)
+            return GPUResourceCategory::Shaders;
+    }
+    return _category;
+}
+
+void GPUResource::SetCategory(GPUResourceCategory category, const Guid& ownerId)
+{
+    _category = category;
+    _ownerId = ownerId;
+}
+
 static_assert((GPU_ENABLE_RESOURCE_NAMING) == (!BUILD_RELEASE), "Update build condition on around GPUResource Name property getter/setter.");
 
 #if GPU_ENABLE_RESOURCE_NAMING
@@ -313,6 +333,7 @@ GPUDevice::GPUDevice(RendererType type, ShaderProfile profile)
     , _isRendering(false)
     , _wasVSyncUsed(false)
     , _drawGpuEventIndex(0)
+    , _presentLabel(0)
     , _rendererType(type)
     , _shaderProfile(profile)
     , _featureLevel(RenderTools::GetFeatureLevel(profile))
@@ -441,6 +462,16 @@ void GPUDevice::DumpResourcesToLog() const
     output.AppendLine();
     output.AppendLine();
 
+    uint64 categoriesMemUsage[(int32)GPUResourceCategory::MAX] = {};
+    for (int32 i = 0; i < _resources.Count(); i++)
+        categoriesMemUsage[(int32)_resources[i]->GetCategory()] += _resources[i]->GetMemoryUsage();
+    for (int32 categoryIndex = 0; categoryIndex < (int32)GPUResourceCategory::MAX; categoryIndex++)
+    {
+        output.AppendFormat(TEXT("Category {0}: {1}"), ScriptingEnum::ToString((GPUResourceCategory)categoryIndex), Utilities::BytesToText(categoriesMemUsage[categoryIndex]));
+        output.AppendLine();
+    }
+    output.AppendLine();
+
     for (int32 typeIndex = 0; typeIndex < (int32)GPUResourceType::MAX; typeIndex++)
     {
         const auto type = static_cast<GPUResourceType>(typeIndex);
@@ -480,6 +511,7 @@ void GPUDevice::preDispose()
 {
     Locker.Lock();
     RenderTargetPool::Flush();
+    GPUReadback::Dispose();
 
     // Release resources
     _res->DefaultMaterial = nullptr;
@@ -585,6 +617,9 @@ void GPUDevice::DrawEnd()
     _isRendering = false;
 
     RenderTargetPool::Flush();
+#if COMPILE_WITH_PROFILER
+    ProfilerGPU::EndFrame();
+#endif
 }
 
 void GPUDevice::RenderBegin()
@@ -601,6 +636,16 @@ void GPUDevice::RenderEnd()
 #endif
 }
 
+GPUContext* GPUDevice::GetParallelContext(int32 index)
+{
+    return nullptr;
+}
+
+GPUContext* GPUDevice::GetComputeContext()
+{
+    return nullptr;
+}
+
 GPUTasksContext* GPUDevice::CreateTasksContext()
 {
     return New<GPUTasksContext>(this);
@@ -611,6 +656,25 @@ GPUTasksExecutor* GPUDevice::CreateTasksExecutor()
     return New<DefaultGPUTasksExecutor>();
 }
 
+GPUResource* GPUDevice::CreateTransientHeap(uint64 size, const StringView& name)
+{
+    return nullptr;
+}
+
+bool GPUDevice::GetTransientTextureMemory(const GPUTextureDescription& desc, uint64& size, uint64& alignment)
+{
+    return true;
+}
+
+GPUTexture* GPUDevice::CreateTransientTexture(GPUResource* heap, uint64 offset, const GPUTextureDescription& desc, const StringView& name)
+{
+    return nullptr;
+}
+
+void GPUDevice::ActivateTransientTexture(GPUTexture* texture)
+{
+}
+
 void GPUDevice::Draw()
 {
     DrawBegin();
@@ -621,6 +685,7 @@ void GPUDevice::Draw()
     context->FrameBegin();
     RenderBegin();
     _res->TasksManager.FrameBegin();
+    GPUReadback::Update();
     Render2D::BeginFrame();
 
     // Perform actual drawing
@@ -632,11 +697,37 @@ void GPUDevice::Draw()
     Render2D::EndFrame();
     _res->TasksManager.FrameEnd();
     RenderEnd();
+    if (Graphics::AsyncPresent)
+    {
+        // Submit GPU commands and present on a job thread while the next frame gets updated (GPU device lock is a sync point)
+        Function<void(int32)> func;
+        func.Bind<GPUDevice, &GPUDevice::PresentJob>(this);
+        _presentLabel = JobSystem::Dispatch(func, 1, 1, JobPriority::High);
+        return;
+    }
     context->FrameEnd();
 
     DrawEnd();
 }
 
+void GPUDevice::WaitForPresent()
+{
+    if (_presentLabel != 0)
+    {
+        PROFILE_CPU();
+        JobSystem::Wait(_presentLabel);
+        _presentLabel = 0;
+    }
+}
+
+void GPUDevice::PresentJob(int32)
+{
+    PROFILE_CPU_NAMED("GPUDevice.Present");
+    ScopeLock lock(Locker);
+    GetMainContext()->FrameEnd();
+    DrawEnd();
+}
+
 void GPUDevice::Dispose()
 {
     RenderList::CleanupCache();
@@ -661,6 +752,46 @@ Array<GPUResource*> GPUDevice::GetResources() const
     return result;
 }
 
+static bool SortByMemoryUsage(const GPUResourceMemoryInfo& a, const GPUResourceMemoryInfo& b)
+{
+    return a.MemoryUsage > b.MemoryUsage;
+}
+
+void GPUDevice::GetMemorySnapshot(Array<GPUResourceMemoryInfo>& resources, Array<GPUResourceCategoryMemoryInfo>& categories) const
+{
+    PROFILE_CPU();
+    resources.Clear();
+    categories.Resize((int32)GPUResourceCategory::MAX);
+    for (int32 i = 0; i < categories.Count(); i++)
+    {
+        auto& category = categories[i];
+        category.Category = (GPUResourceCategory)i;
+        category.Count = 0;
+        category.MemoryUsage = 0;
+    }
+
+    _resourcesLock.Lock();
+    resources.EnsureCapacity(_resources.Count());
+    for (const GPUResource* resource : _resources)
+    {
+        const uint64 memoryUsage = resource->GetMemoryUsage();
+        if (memoryUsage == 0)
+            continue;
+        auto& info = resources.AddOne();
+        info.Name = resource->ToString();
+        info.Type = resource->GetResourceType();
+        info.Category = resource->GetCategory();
+        info.OwnerId = resource->GetOwnerId();
+        info.MemoryUsage = memoryUsage;
+        auto& category = categories[(int32)info.Category];
+        category.Count++;
+        category.MemoryUsage += memoryUsage;
+    }
+    _resourcesLock.Unlock();
+
+    Sorting::QuickSort(resources.Get(), resources.Count(), &SortByMemoryUsage);
+}
+
 GPUTasksManager* GPUDevice::GetTasksManager() const
 {
     return &_res->TasksManager;
@@ -15,6 +15,8 @@
 class ITextureOwner;
 class RenderTask;
 class GPUResource;
+struct GPUResourceMemoryInfo;
+struct GPUResourceCategoryMemoryInfo;
 class GPUContext;
 class GPUShader;
 class GPUTimerQuery;
@@ -25,6 +27,7 @@ class GPUPipelineState;
 class GPUConstantBuffer;
 class GPUTasksContext;
 class GPUTasksExecutor;
+struct GPUTextureDescription;
 class GPUSwapChain;
 class GPUTasksManager;
 class Shader;
@@ -86,6 +89,7 @@ API_CLASS(Sealed, NoSpawn) class FLAXENGINE_API GPUDevice : public ScriptingObje
     bool _isRendering;
     bool _wasVSyncUsed;
     int32 _drawGpuEventIndex;
+    int64 _presentLabel;
     RendererType _rendererType;
     ShaderProfile _shaderProfile;
     FeatureLevel _featureLevel;
@@ -210,6 +214,19 @@ API_CLASS(Sealed, NoSpawn) class FLAXENGINE_API GPUDevice : public ScriptingObje
     /// </summary>
     API_PROPERTY() virtual GPUContext* GetMainContext() = 0;
 
+    /// <summary>
+    /// Gets the GPU context for the parallel commands recording (on a job thread). Commands recorded into it are submitted by the main context via GPUContext::ExecuteParallel.
+    /// </summary>
+    /// <param name="index">The parallel context index (in range 0 to GPU_MAX_PARALLEL_CONTEXTS-1). Each job thread should use a different one.</param>
+    /// <returns>The GPU context or null if the graphics backend doesn't support parallel commands recording.</returns>
+    virtual GPUContext* GetParallelContext(int32 index);
+
+    /// <summary>
+    /// Gets the GPU context for the async compute commands recording. Commands recorded into it are executed on a separate GPU queue (concurrently to the graphics work) and submitted by the main context via GPUContext::ExecuteAsyncCompute.
+    /// </summary>
+    /// <returns>The GPU context or null if the graphics backend doesn't support async compute.</returns>
+    virtual GPUContext* GetComputeContext();
+
     /// <summary>
     /// Gets the adapter device.
     /// </summary>
@@ -230,6 +247,13 @@ API_CLASS(Sealed, NoSpawn) class FLAXENGINE_API GPUDevice : public ScriptingObje
     /// </summary>
     API_PROPERTY() Array<GPUResource*> GetResources() const;
 
+    /// <summary>
+    /// Gets the snapshot of the GPU memory usage by the resources. Lists the resources sorted by the memory usage (from the largest) and the total memory usage per resources category.
+    /// </summary>
+    /// <param name="resources">The output list of the resources that use GPU memory.</param>
+    /// <param name="categories">The output memory usage per resources category (one entry for each category).</param>
+    API_FUNCTION() void GetMemorySnapshot(API_PARAM(Out) Array<GPUResourceMemoryInfo>& resources, API_PARAM(Out) Array<GPUResourceCategoryMemoryInfo>& categories) const;
+
     /// <summary>
     /// Gets the GPU asynchronous work manager.
     /// </summary>
@@ -309,6 +333,11 @@ API_CLASS(Sealed, NoSpawn) class FLAXENGINE_API GPUDevice : public ScriptingObje
     /// </summary>
     virtual void WaitForGPU() = 0;
 
+    /// <summary>
+    /// Waits for the previous frame GPU commands submission and present if they run asynchronously (see Graphics::AsyncPresent). Must be called before using the main GPU context outside the frame drawing.
+    /// </summary>
+    API_FUNCTION() void WaitForPresent();
+
 public:
     void AddResource(GPUResource* resource);
     void RemoveResource(GPUResource* resource);
@@ -341,6 +370,9 @@ API_CLASS(Sealed, NoSpawn) class FLAXENGINE_API GPUDevice : public ScriptingObje
     /// </summary>
     virtual void RenderEnd();
 
+private:
+    void PresentJob(int32);
+
 public:
     /// <summary>
     /// Creates the texture.
@@ -407,6 +439,40 @@ API_CLASS(Sealed, NoSpawn) class FLAXENGINE_API GPUDevice : public ScriptingObje
     /// </summary>
     /// <returns>The GPU tasks executor.</returns>
     virtual GPUTasksExecutor* CreateTasksExecutor();
+
+public:
+    /// <summary>
+    /// Creates the memory heap for the transient textures placed in the shared memory. Supported only if <see cref="GPULimits.HasResourceAliasing"/> is set.
+    /// </summary>
+    /// <param name="size">The heap size (in bytes).</param>
+    /// <param name="name">The resource name.</param>
+    /// <returns>The heap or null if failed or not supported.</returns>
+    virtual GPUResource* CreateTransientHeap(uint64 size, const StringView& name = StringView::Empty);
+
+    /// <summary>
+    /// Gets the memory size and alignment of the transient texture placed within the heap memory.
+    /// </summary>
+    /// <param name="desc">The texture description.</param>
+    /// <param name="size">The result memory size (in bytes).</param>
+    /// <param name="alignment">The result memory alignment (in bytes).</param>
+    /// <returns>True if failed or not supported, otherwise false.</returns>
+    virtual bool GetTransientTextureMemory(const GPUTextureDescription& desc, uint64& size, uint64& alignment);
+
+    /// <summary>
+    /// Creates the transient texture placed at the given offset within the heap memory. Transient textures with overlapping memory alias each other so only one of them can be used at once (see ActivateTransientTexture).
+    /// </summary>
+    /// <param name="heap">The memory heap (created with CreateTransientHeap).</param>
+    /// <param name="offset">The offset within the heap memory (in bytes, aligned as returned by GetTransientTextureMemory).</param>
+    /// <param name="desc">The texture description.</param>
+    /// <param name="name">The resource name.</param>
+    /// <returns>The initialized texture or null if failed or not supported.</returns>
+    virtual GPUTexture* CreateTransientTexture(GPUResource* heap, uint64 offset, const GPUTextureDescription& desc, const StringView& name = StringView::Empty);
+
+    /// <summary>
+    /// Activates the transient texture within its memory (textures placed in the overlapping memory become invalid). Previous memory contents are discarded before the first usage of the texture.
+    /// </summary>
+    /// <param name="texture">The transient texture (created with CreateTransientTexture).</param>
+    virtual void ActivateTransientTexture(GPUTexture* texture);
 };
 
 /// <summary>
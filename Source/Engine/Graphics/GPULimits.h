@@ -279,6 +279,31 @@ API_STRUCT() struct GPULimits
     /// </summary>
     API_FIELD() bool HasTypedUAVLoad;
 
+    /// <summary>
+    /// True if device supports variable rate shading with a per-draw shading rate.
+    /// </summary>
+    API_FIELD() bool HasVariableRateShading;
+
+    /// <summary>
+    /// True if device supports variable rate shading with a screen-space shading rate image.
+    /// </summary>
+    API_FIELD() bool HasVariableRateShadingImage;
+
+    /// <summary>
+    /// True if device supports the coarse shading rates (2x4, 4x2 and 4x4).
+    /// </summary>
+    API_FIELD() bool HasAdditionalShadingRates;
+
+    /// <summary>
+    /// The size of the screen tile (in pixels) covered by a single texel of the shading rate image.
+    /// </summary>
+    API_FIELD() int32 ShadingRateImageTileSize;
+
+    /// <summary>
+    /// True if device supports placing multiple render targets in the same memory (aliasing of the transient render targets which lifetimes don't overlap).
+    /// </summary>
+    API_FIELD() bool HasResourceAliasing;
+
     /// <summary>
     /// The maximum amount of texture mip levels.
     /// </summary>
@@ -101,7 +101,11 @@ class GPUPipelineStatePermutationsPs : public GPUPipelineStatePermutations<Size>
         {
             ASSERT(Base::States[i]);
 
-            desc.PS = shader->GetPS(psName, i);
+            // Permutations stripped during game cooking fallback to the closest lower permutation (eg. lower quality)
+            int32 permutationIndex = i;
+            while (permutationIndex > 0 && shader->IsStripped(psName, permutationIndex))
+                permutationIndex--;
+            desc.PS = shader->GetPS(psName, permutationIndex);
             if (Base::States[i]->Init(desc))
                 return true;
         }
@@ -0,0 +1,248 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "GPUReadback.h"
+#include "GPUDevice.h"
+#include "GPUContext.h"
+#include "GPUBuffer.h"
+#include "RenderTools.h"
+#include "Async/GPUSyncPoint.h"
+#include "Textures/GPUTexture.h"
+#include "Textures/TextureData.h"
+#include "Engine/Core/Log.h"
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Platform/CriticalSection.h"
+#include "Engine/Profiler/ProfilerCPU.h"
+
+// The amount of frames after which the unused staging resources are released
+#define GPU_READBACK_POOL_FRAMES 60
+
+namespace
+{
+    struct StagingEntry
+    {
+        GPUResource* Resource;
+        uint64 LastFrameUsed;
+        bool IsOccupied;
+    };
+
+    struct Request
+    {
+        GPUReadback::Callback Callback;
+        GPUResource* Staging;
+        uint64 Frame;
+        uint32 Size;
+    };
+
+    CriticalSection Locker;
+    Array<StagingEntry> Pool;
+    Array<Request> Requests;
+    uint64 Frame = 0;
+
+    GPUResource* AllocateStaging(uint32 size, const GPUTextureDescription* desc)
+    {
+        // Find a free staging resource of the matching size (buffers may be up to 2x bigger than requested)
+        for (StagingEntry& e : Pool)
+        {
+            if (e.IsOccupied)
+                continue;
+            bool matches;
+            if (desc)
+                matches = e.Resource->GetResourceType() != GPUResourceType::Buffer && ((GPUTexture*)e.Resource)->GetDescription() == *desc;
+            else
+                matches = e.Resource->GetResourceType() == GPUResourceType::Buffer && ((GPUBuffer*)e.Resource)->GetSize() >= size && ((GPUBuffer*)e.Resource)->GetSize() <= size * 2;
+            if (matches)
+            {
+                e.IsOccupied = true;
+                return e.Resource;
+            }
+        }
+
+        // Create a new staging resource
+        ScopeLock gpuLock(GPUDevice::Instance->Locker);
+        GPUResource* resource;
+        if (desc)
+        {
+            auto texture = GPUDevice::Instance->CreateTexture(TEXT("GPUReadback.Staging"));
+            if (texture->Init(*desc))
+            {
+                Delete(texture);
+                return nullptr;
+            }
+            resource = texture;
+        }
+        else
+        {
+            auto buffer = GPUDevice::Instance->CreateBuffer(TEXT("GPUReadback.Staging"));
+            if (buffer->Init(GPUBufferDescription::Buffer(size, GPUBufferFlags::None, PixelFormat::Unknown, nullptr, 0, GPUResourceUsage::StagingReadback)))
+            {
+                Delete(buffer);
+                return nullptr;
+            }
+            resource = buffer;
+        }
+        resource->SetCategory(GPUResourceCategory::Readback);
+        Pool.Add({ resource, Frame, true });
+        return resource;
+    }
+
+    void ReleaseStaging(GPUResource* resource)
+    {
+        for (StagingEntry& e : Pool)
+        {
+            if (e.Resource == resource)
+            {
+                e.IsOccupied = false;
+                e.LastFrameUsed = Frame;
+                break;
+            }
+        }
+    }
+
+    void Complete(Request& request, bool failed)
+    {
+        GPUReadbackResult result;
+        TextureMipData mipData;
+        void* mapped = nullptr;
+        if (!failed)
+        {
+            if (request.Staging->GetResourceType() == GPUResourceType::Buffer)
+            {
+                mapped = ((GPUBuffer*)request.Staging)->Map(GPUResourceMapMode::Read);
+                if (mapped)
+                    result.Data = Span<byte>((byte*)mapped, (int32)request.Size);
+            }
+            else if (!((GPUTexture*)request.Staging)->GetData(0, 0, mipData))
+            {
+                result.Data = Span<byte>(mipData.Data.Get(), mipData.Data.Length());
+                result.RowPitch = mipData.RowPitch;
+                result.DepthPitch = mipData.DepthPitch;
+            }
+            if (!result.IsValid())
+                LOG(Warning, "Failed to read the GPU readback data from {0}.", request.Staging->ToString());
+        }
+        request.Callback(result);
+        if (mapped)
+            ((GPUBuffer*)request.Staging)->Unmap();
+    }
+
+    void Enqueue(GPUResource* staging, const GPUReadback::Callback& callback, uint32 size)
+    {
+        Request& request = Requests.AddOne();
+        request.Callback = callback;
+        request.Staging = staging;
+        request.Frame = Frame;
+        request.Size = size;
+    }
+}
+
+bool GPUReadback::ReadBuffer(GPUContext* context, GPUBuffer* buffer, const Callback& callback, uint32 offset, uint32 size)
+{
+    if (!context || !buffer || offset >= buffer->GetSize())
+        return true;
+    if (size == 0)
+        size = buffer->GetSize() - offset;
+    if (offset + size > buffer->GetSize())
+    {
+        LOG(Warning, "Invalid GPU readback range (offset: {0}, size: {1}) of {2}.", offset, size, buffer->ToString());
+        return true;
+    }
+    PROFILE_CPU();
+    ScopeLock lock(Locker);
+    auto staging = (GPUBuffer*)AllocateStaging(size, nullptr);
+    if (!staging)
+    {
+        LOG(Warning, "Cannot create staging resource for {0}.", buffer->ToString());
+        return true;
+    }
+    context->CopyBuffer(staging, buffer, size, 0, offset);
+    Enqueue(staging, callback, size);
+    return false;
+}
+
+bool GPUReadback::ReadTexture(GPUContext* context, GPUTexture* texture, const Callback& callback, int32 mipIndex, int32 arrayIndex)
+{
+    if (!context || !texture || !texture->IsAllocated() || texture->IsMultiSample() || mipIndex < 0 || mipIndex >= texture->MipLevels() || arrayIndex < 0 || arrayIndex >= texture->ArraySize())
+        return true;
+    PROFILE_CPU();
+
+    // Staging texture holds just a single subresource
+    GPUTextureDescription desc = texture->GetDescription().ToStagingReadback();
+    desc.Width = Math::Max(desc.Width >> mipIndex, 1);
+    desc.Height = Math::Max(desc.Height >> mipIndex, 1);
+    desc.Depth = desc.Dimensions == TextureDimensions::VolumeTexture ? Math::Max(desc.Depth >> mipIndex, 1) : 1;
+    if (desc.Dimensions == TextureDimensions::CubeTexture)
+        desc.Dimensions = TextureDimensions::Texture;
+    desc.MipLevels = 1;
+    desc.ArraySize = 1;
+
+    ScopeLock lock(Locker);
+    auto staging = (GPUTexture*)AllocateStaging(0, &desc);
+    if (!staging)
+    {
+        LOG(Warning, "Cannot create staging resource for {0}.", texture->ToString());
+        return true;
+    }
+    context->CopyTexture(staging, 0, 0, 0, 0, texture, RenderTools::CalcSubresourceIndex(mipIndex, arrayIndex, texture->MipLevels()));
+    Enqueue(staging, callback, 0);
+    return false;
+}
+
+int32 GPUReadback::GetPendingCount()
+{
+    ScopeLock lock(Locker);
+    return Requests.Count();
+}
+
+void GPUReadback::Update()
+{
+    Locker.Lock();
+    Frame++;
+    if (Requests.IsEmpty() && Pool.IsEmpty())
+    {
+        Locker.Unlock();
+        return;
+    }
+    PROFILE_CPU();
+
+    // Pick the requests that GPU has already finished (callbacks are invoked outside the lock so they can enqueue new readbacks)
+    Array<Request> completed;
+    for (int32 i = 0; i < Requests.Count(); i++)
+    {
+        if (Requests[i].Frame + GPU_ASYNC_LATENCY < Frame)
+        {
+            completed.Add(MoveTemp(Requests[i]));
+            Requests.RemoveAt(i--);
+        }
+    }
+    Locker.Unlock();
+    for (Request& request : completed)
+        Complete(request, false);
+    Locker.Lock();
+    for (const Request& request : completed)
+        ReleaseStaging(request.Staging);
+
+    // Release the staging resources unused for a while
+    for (int32 i = Pool.Count() - 1; i >= 0; i--)
+    {
+        const StagingEntry& e = Pool[i];
+        if (!e.IsOccupied && e.LastFrameUsed + GPU_READBACK_POOL_FRAMES < Frame)
+        {
+            e.Resource->DeleteObjectNow();
+            Pool.RemoveAt(i);
+        }
+    }
+    Locker.Unlock();
+}
+
+void GPUReadback::Dispose()
+{
+    Locker.Lock();
+    Array<Request> requests = MoveTemp(Requests);
+    Locker.Unlock();
+    for (Request& request : requests)
+        Complete(request, true);
+    ScopeLock lock(Locker);
+    for (const StagingEntry& e : Pool)
+        e.Resource->DeleteObjectNow();
+    Pool.Clear();
+}
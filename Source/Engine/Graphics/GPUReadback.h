@@ -0,0 +1,86 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Core/Delegate.h"
+#include "Engine/Core/Types/Span.h"
+
+class GPUContext;
+class GPUBuffer;
+class GPUTexture;
+
+/// <summary>
+/// The result of the async GPU readback passed to the completion callback.
+/// </summary>
+struct GPUReadbackResult
+{
+    /// <summary>
+    /// The read data. Valid only during the callback (copy it to keep). Empty if the readback failed (eg. graphics device has been disposed).
+    /// </summary>
+    Span<byte> Data;
+
+    /// <summary>
+    /// The texture data row pitch (in bytes). Zero for buffers.
+    /// </summary>
+    uint32 RowPitch = 0;
+
+    /// <summary>
+    /// The texture data depth slice pitch (in bytes). Zero for buffers.
+    /// </summary>
+    uint32 DepthPitch = 0;
+
+    /// <summary>
+    /// Returns true if the readback succeeded and data is valid.
+    /// </summary>
+    FORCE_INLINE bool IsValid() const
+    {
+        return Data.IsValid();
+    }
+};
+
+/// <summary>
+/// Asynchronous GPU data readback. Records the copy of the GPU resource data into a pooled staging resource and invokes the callback once the GPU finishes the copy a few frames later (without stalling the CPU on the GPU).
+/// </summary>
+/// <remarks>
+/// The completion is tracked with the frame sync points (the same latency as the GPU tasks, see GPU_ASYNC_LATENCY). Callbacks are invoked on the main thread at the beginning of the frame drawing.
+/// </remarks>
+class FLAXENGINE_API GPUReadback
+{
+public:
+    typedef Function<void(const GPUReadbackResult&)> Callback;
+
+public:
+    /// <summary>
+    /// Enqueues the async readback of the GPU buffer data.
+    /// </summary>
+    /// <param name="context">The GPU context to record the copy with (eg. during rendering).</param>
+    /// <param name="buffer">The source buffer.</param>
+    /// <param name="callback">The completion callback.</param>
+    /// <param name="offset">The source data offset (in bytes).</param>
+    /// <param name="size">The size of the data to read (in bytes). Use 0 to read the whole buffer after the offset.</param>
+    /// <returns>True if failed, otherwise false.</returns>
+    static bool ReadBuffer(GPUContext* context, GPUBuffer* buffer, const Callback& callback, uint32 offset = 0, uint32 size = 0);
+
+    /// <summary>
+    /// Enqueues the async readback of the GPU texture subresource data.
+    /// </summary>
+    /// <param name="context">The GPU context to record the copy with (eg. during rendering).</param>
+    /// <param name="texture">The source texture.</param>
+    /// <param name="callback">The completion callback.</param>
+    /// <param name="mipIndex">The source mip level index.</param>
+    /// <param name="arrayIndex">The source array slice index.</param>
+    /// <returns>True if failed, otherwise false.</returns>
+    static bool ReadTexture(GPUContext* context, GPUTexture* texture, const Callback& callback, int32 mipIndex = 0, int32 arrayIndex = 0);
+
+    /// <summary>
+    /// Gets the amount of the readbacks waiting for the GPU.
+    /// </summary>
+    static int32 GetPendingCount();
+
+public:
+    // Called by the graphics device at the beginning of the frame drawing. Invokes callbacks of the completed readbacks and releases unused staging resources.
+    static void Update();
+
+    // Called by the graphics device before releasing resources. Fails the pending readbacks and releases the staging resources.
+    static void Dispose();
+};
@@ -40,6 +40,87 @@ API_ENUM() enum class GPUResourceType
     MAX
 };
 
+/// <summary>
+/// GPU resources memory categories. Used to attribute the GPU memory usage to the engine systems.
+/// </summary>
+API_ENUM() enum class GPUResourceCategory : byte
+{
+    // Not categorized resource.
+    Other = 0,
+    // Texture assets (streamed).
+    Textures,
+    // Model and skinned model meshes buffers.
+    Meshes,
+    // Shaders and pipeline states.
+    Shaders,
+    // Temporary render targets from the RenderTargetPool.
+    RenderTargetPool,
+    // Per-view render buffers (eg. GBuffer, depth buffer).
+    RenderBuffers,
+    // Shadow maps and shadows atlases.
+    Shadows,
+    // Staging resources of the async GPU readback.
+    Readback,
+
+    MAX
+};
+
+/// <summary>
+/// The GPU resource memory usage information.
+/// </summary>
+API_STRUCT(NoDefault) struct FLAXENGINE_API GPUResourceMemoryInfo
+{
+    DECLARE_SCRIPTING_TYPE_MINIMAL(GPUResourceMemoryInfo);
+
+    /// <summary>
+    /// The resource name.
+    /// </summary>
+    API_FIELD() String Name;
+
+    /// <summary>
+    /// The resource type.
+    /// </summary>
+    API_FIELD() GPUResourceType Type;
+
+    /// <summary>
+    /// The resource memory category.
+    /// </summary>
+    API_FIELD() GPUResourceCategory Category;
+
+    /// <summary>
+    /// The owner object identifier (eg. texture or model asset). Empty if unknown.
+    /// </summary>
+    API_FIELD() Guid OwnerId;
+
+    /// <summary>
+    /// The GPU memory usage (in bytes).
+    /// </summary>
+    API_FIELD() uint64 MemoryUsage;
+};
+
+/// <summary>
+/// The GPU memory usage by the resources category.
+/// </summary>
+API_STRUCT(NoDefault) struct FLAXENGINE_API GPUResourceCategoryMemoryInfo
+{
+    DECLARE_SCRIPTING_TYPE_MINIMAL(GPUResourceCategoryMemoryInfo);
+
+    /// <summary>
+    /// The resources category.
+    /// </summary>
+    API_FIELD() GPUResourceCategory Category;
+
+    /// <summary>
+    /// The amount of resources (that use GPU memory) in the category.
+    /// </summary>
+    API_FIELD() int32 Count;
+
+    /// <summary>
+    /// The total GPU memory usage (in bytes).
+    /// </summary>
+    API_FIELD() uint64 MemoryUsage;
+};
+
 /// <summary>
 /// The base class for all GPU resources.
 /// </summary>
@@ -48,6 +129,8 @@ API_CLASS(Abstract, NoSpawn) class FLAXENGINE_API GPUResource : public Scripting
     DECLARE_SCRIPTING_TYPE_NO_SPAWN(GPUResource);
 protected:
     uint64 _memoryUsage = 0;
+    GPUResourceCategory _category = GPUResourceCategory::Other;
+    Guid _ownerId = Guid::Empty;
 #if GPU_ENABLE_RESOURCE_NAMING
     Char* _namePtr = nullptr;
     int32 _nameSize = 0, _nameCapacity = 0;
@@ -92,6 +175,26 @@ API_CLASS(Abstract, NoSpawn) class FLAXENGINE_API GPUResource : public Scripting
     /// </summary>
     API_PROPERTY() uint64 GetMemoryUsage() const;
 
+    /// <summary>
+    /// Gets the resource memory category. Shaders and pipeline states use the Shaders category if not specified.
+    /// </summary>
+    API_PROPERTY() GPUResourceCategory GetCategory() const;
+
+    /// <summary>
+    /// Gets the owner object identifier (eg. texture or model asset). Empty if unknown.
+    /// </summary>
+    API_PROPERTY() FORCE_INLINE const Guid& GetOwnerId() const
+    {
+        return _ownerId;
+    }
+
+    /// <summary>
+    /// Sets the resource memory category and the owner used to attribute the GPU memory usage.
+    /// </summary>
+    /// <param name="category">The memory category.</param>
+    /// <param name="ownerId">The owner object identifier (eg. texture or model asset).</param>
+    API_FUNCTION() void SetCategory(GPUResourceCategory category, const Guid& ownerId = Guid::Empty);
+
 #if !BUILD_RELEASE
     /// <summary>
     /// Gets the resource name.
@@ -91,6 +91,13 @@ void GPUSwapChain::Present(bool vsync)
 
     // Count amount of present calls
     _presentCount++;
+
+    // Track the presentation timing (used by the frame pacing)
+    const double time = Platform::GetTimeSeconds();
+    const double interval = time - _lastPresentTime;
+    if (_lastPresentTime > 0.0 && interval < 0.25)
+        _presentInterval = _presentInterval > 0.0 ? Math::Lerp(_presentInterval, interval, 0.1) : interval;
+    _lastPresentTime = time;
 }
 
 String GPUSwapChain::ToString() const
@@ -20,6 +20,8 @@ class FLAXENGINE_API GPUSwapChain : public GPUResource
     int32 _width = 0;
     int32 _height = 0;
     uint64 _presentCount = 0;
+    double _lastPresentTime = 0.0;
+    double _presentInterval = 0.0;
     PixelFormat _format = PixelFormat::Unknown;
     Window* _window = nullptr;
     Task* _downloadTask = nullptr;
@@ -83,6 +85,22 @@ class FLAXENGINE_API GPUSwapChain : public GPUResource
         return _presentCount;
     }
 
+    /// <summary>
+    /// Gets the time (in seconds, see Platform::GetTimeSeconds) when the last present call returned. Zero if not presented yet.
+    /// </summary>
+    FORCE_INLINE double GetLastPresentTime() const
+    {
+        return _lastPresentTime;
+    }
+
+    /// <summary>
+    /// Gets the average interval (in seconds) between the presents (eg. display refresh interval when using vsync). Zero if unknown.
+    /// </summary>
+    FORCE_INLINE double GetPresentInterval() const
+    {
+        return _presentInterval;
+    }
+
     /// <summary>
     /// True if running in fullscreen mode.
     /// </summary>
@@ -4,6 +4,25 @@
 
 #include "GPUResource.h"
 
+/// <summary>
+/// The GPU pipeline statistics collected by the query (amount of the primitives and shader invocations executed by the GPU).
+/// </summary>
+struct GPUPipelineStatistics
+{
+    // The vertices read by the input assembler.
+    uint64 InputVertices;
+    // The primitives read by the input assembler.
+    uint64 InputPrimitives;
+    // The primitives that passed the clipping stage and were sent to the rasterizer.
+    uint64 RasterizedPrimitives;
+    // The vertex shader invocations count.
+    uint64 VSInvocations;
+    // The pixel shader invocations count.
+    uint64 PSInvocations;
+    // The compute shader invocations count.
+    uint64 CSInvocations;
+};
+
 /// <summary>
 /// Represents a GPU query that measures execution time of GPU operations.
 /// The query will measure any GPU operations that take place between its Begin() and End() calls.
@@ -11,6 +30,12 @@
 /// <seealso cref="GPUResource" />
 class FLAXENGINE_API GPUTimerQuery : public GPUResource
 {
+public:
+    /// <summary>
+    /// True if query should collect the pipeline statistics (in addition to the timing) between Begin/End calls. Has to be set before calling Begin. Supported only by some graphics backends.
+    /// </summary>
+    bool PipelineStatistics = false;
+
 public:
     /// <summary>
     /// Finalizes an instance of the <see cref="GPUTimerQuery"/> class.
@@ -42,6 +67,16 @@ class FLAXENGINE_API GPUTimerQuery : public GPUResource
     /// <returns>The time in milliseconds.</returns>
     virtual float GetResult() = 0;
 
+    /// <summary>
+    /// Gets the query pipeline statistics collected between Begin/End calls. Valid only if <see cref="PipelineStatistics"/> was enabled and query has result.
+    /// </summary>
+    /// <param name="result">The result statistics.</param>
+    /// <returns>True if failed to get the statistics (eg. not supported), otherwise false.</returns>
+    virtual bool GetPipelineStatistics(GPUPipelineStatistics& result)
+    {
+        return true;
+    }
+
 public:
     // [GPUResource]
     String ToString() const override
@@ -18,6 +18,16 @@ Quality Graphics::VolumetricFogQuality = Quality::High;
 Quality Graphics::ShadowsQuality = Quality::Medium;
 Quality Graphics::ShadowMapsQuality = Quality::Medium;
 bool Graphics::AllowCSMBlending = false;
+bool Graphics::StaticShadowsCaching = false;
+bool Graphics::GPUDrivenCulling = false;
+bool Graphics::OcclusionCulling = false;
+bool Graphics::ParallelCommandRecording = false;
+bool Graphics::AsyncCompute = false;
+bool Graphics::VariableRateShading = false;
+bool Graphics::AsyncPresent = false;
+bool Graphics::CheckerboardRendering = false;
+bool Graphics::PreSkinning = false;
+bool Graphics::GlobalBonesPalette = false;
 Quality Graphics::GlobalSDFQuality = Quality::High;
 Quality Graphics::GIQuality = Quality::High;
 PostProcessSettings Graphics::PostProcessSettings;
@@ -66,6 +76,16 @@ void GraphicsSettings::Apply()
     Graphics::ShadowsQuality = ShadowsQuality;
     Graphics::ShadowMapsQuality = ShadowMapsQuality;
     Graphics::AllowCSMBlending = AllowCSMBlending;
+    Graphics::StaticShadowsCaching = StaticShadowsCaching;
+    Graphics::GPUDrivenCulling = GPUDrivenCulling;
+    Graphics::OcclusionCulling = OcclusionCulling;
+    Graphics::ParallelCommandRecording = ParallelCommandRecording;
+    Graphics::AsyncCompute = AsyncCompute;
+    Graphics::VariableRateShading = VariableRateShading;
+    Graphics::AsyncPresent = AsyncPresent;
+    Graphics::CheckerboardRendering = CheckerboardRendering;
+    Graphics::PreSkinning = PreSkinning;
+    Graphics::GlobalBonesPalette = GlobalBonesPalette;
     Graphics::GlobalSDFQuality = GlobalSDFQuality;
     Graphics::GIQuality = GIQuality;
     Graphics::PostProcessSettings = ::PostProcessSettings();
@@ -81,6 +101,7 @@ void Graphics::DisposeDevice()
     {
         // Clean any danging pointer to last task (might stay if engine is disposing after crash)
         GPUDevice::Instance->CurrentTask = nullptr;
+        GPUDevice::Instance->WaitForPresent();
 
         GPUDevice::Instance->Dispose();
         LOG_FLUSH();
@@ -53,6 +53,56 @@ API_CLASS(Static) class FLAXENGINE_API Graphics
     /// </summary>
     API_FIELD() static bool AllowCSMBlending;
 
+    /// <summary>
+    /// Enables caching the static geometry depth of the point and spot light shadow maps (in a shadow atlas with per-light tiles scaled by the light screen size). Only dynamic objects are redrawn every frame, unless light or static objects around it change.
+    /// </summary>
+    API_FIELD() static bool StaticShadowsCaching;
+
+    /// <summary>
+    /// Enables GPU-driven culling of the instanced draw calls (eg. many static meshes using the same model). Instances are culled and compacted by the compute shader and drawn with indirect draw calls.
+    /// </summary>
+    API_FIELD() static bool GPUDrivenCulling;
+
+    /// <summary>
+    /// Enables occlusion culling of the objects hidden behind the other geometry. Uses the hierarchical depth buffer (HiZ) of the previous frame to cull objects on a CPU and within GPU-driven culling.
+    /// </summary>
+    API_FIELD() static bool OcclusionCulling;
+
+    /// <summary>
+    /// Enables recording of the scene draw calls from multiple job threads into the parallel GPU contexts (if supported by the graphics backend). Reduces rendering thread time for scenes with a lot of draw calls.
+    /// </summary>
+    API_FIELD() static bool ParallelCommandRecording;
+
+    /// <summary>
+    /// Enables running the compute passes (eg. Global SDF) on the async compute queue (if supported by the graphics backend) to overlap them with the graphics work (eg. shadow maps rendering).
+    /// </summary>
+    API_FIELD() static bool AsyncCompute;
+
+    /// <summary>
+    /// Enables variable rate shading (if supported by the GPU) that lowers the shading rate of the screen regions with low contrast or fast motion (based on the previous frame). Improves performance in the GPU-bound scenes.
+    /// </summary>
+    API_FIELD() static bool VariableRateShading;
+
+    /// <summary>
+    /// Enables submitting the GPU commands and presenting the frame on a job thread while the next frame gets updated (game logic and rendering submission overlap). Code that uses the main GPU context outside the frame drawing needs to call GPUDevice::WaitForPresent first.
+    /// </summary>
+    API_FIELD() static bool AsyncPresent;
+
+    /// <summary>
+    /// Enables checkerboard rendering of the screen-space effects that support it (eg. screen space reflections ray tracing). Each frame renders only half of the pixels and the rest is reconstructed from the previous frame using motion vectors.
+    /// </summary>
+    API_FIELD() static bool CheckerboardRendering;
+
+    /// <summary>
+    /// Enables pre-skinning of the animated models with a compute shader. Skinned vertices are written once per frame into the cached vertex buffers and all passes (eg. GBuffer, shadow maps) draw them as static meshes, instead of skinning the vertices in every pass.
+    /// </summary>
+    API_FIELD() static bool PreSkinning;
+
+    /// <summary>
+    /// Enables the global bones palette. Bone matrices of all animated models drawn within a frame are stored in a single buffer uploaded with a single copy, instead of updating a separate buffer per model.
+    /// </summary>
+    API_FIELD() static bool GlobalBonesPalette;
+
     /// <summary>
     /// The Global SDF quality. Controls the volume texture resolution and amount of cascades to use.
     /// </summary>
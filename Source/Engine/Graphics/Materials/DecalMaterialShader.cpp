@@ -3,9 +3,9 @@
 #include "DecalMaterialShader.h"
 #include "MaterialParams.h"
 #include "Engine/Core/Log.h"
-#include "Engine/Core/Math/OrientedBoundingBox.h"
 #include "Engine/Graphics/GPUContext.h"
 #include "Engine/Graphics/GPUDevice.h"
+#include "Engine/Graphics/GPUBuffer.h"
 #include "Engine/Graphics/Shaders/GPUShader.h"
 #include "Engine/Graphics/RenderBuffers.h"
 #include "Engine/Graphics/RenderTask.h"
@@ -14,9 +14,9 @@
 #include "Engine/Renderer/DrawCall.h"
 
 PACK_STRUCT(struct DecalMaterialShaderData {
-    Matrix WorldMatrix;
-    Matrix InvWorld;
     Matrix SVPositionToWorld;
+    uint32 InstanceOffset;
+    Float3 Dummy0;
     });
 
 DrawPass DecalMaterialShader::GetDrawModes() const
@@ -34,8 +34,6 @@ void DecalMaterialShader::Bind(BindParameters& params)
     ASSERT_LOW_LAYER(cb.Length() >= sizeof(DecalMaterialShaderData));
     auto materialData = reinterpret_cast<DecalMaterialShaderData*>(cb.Get());
     cb = Span<byte>(cb.Get() + sizeof(DecalMaterialShaderData), cb.Length() - sizeof(DecalMaterialShaderData));
-    int32 srv = 0;
-    const bool isCameraInside = OrientedBoundingBox(Vector3::Half, params.FirstDrawCall->World).Contains(view.Position) == ContainmentType::Contains;
 
     // Setup parameters
     MaterialParameter::BindMeta bindMeta;
@@ -49,15 +47,11 @@ void DecalMaterialShader::Bind(BindParameters& params)
 
     // Decals use depth buffer to draw on top of the objects
     context->BindSR(0, GET_TEXTURE_VIEW_SAFE(params.RenderContext.Buffers->DepthBuffer));
+    context->BindSR(1, drawCall.DecalBatch.Instances ? drawCall.DecalBatch.Instances->View() : nullptr);
 
     // Setup material constants
     {
-        Matrix::Transpose(drawCall.World, materialData->WorldMatrix);
-
-        // Matrix for transformation from world space to decal object space
-        Matrix invWorld;
-        Matrix::Invert(drawCall.World, invWorld);
-        Matrix::Transpose(invWorld, materialData->InvWorld);
+        materialData->InstanceOffset = drawCall.DecalBatch.InstanceOffset;
 
         // Matrix for transformation from SV Position space to world space
         const Matrix offsetMatrix(
@@ -77,7 +71,7 @@ void DecalMaterialShader::Bind(BindParameters& params)
     }
 
     // Bind pipeline
-    context->SetState(isCameraInside ? _cache.Inside : _cache.Outside);
+    context->SetState(drawCall.DecalBatch.IsCameraInside ? _cache.Inside : _cache.Outside);
 }
 
 void DecalMaterialShader::Unload()
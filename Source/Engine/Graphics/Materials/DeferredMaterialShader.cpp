@@ -11,6 +11,7 @@
 #include "Engine/Graphics/GPUContext.h"
 #include "Engine/Graphics/Shaders/GPUConstantBuffer.h"
 #include "Engine/Graphics/Models/SkinnedMeshDrawData.h"
+#include "Engine/Graphics/Models/Types.h"
 #include "Engine/Graphics/GPUDevice.h"
 #include "Engine/Graphics/Shaders/GPUShader.h"
 #include "Engine/Graphics/GPULimits.h"
@@ -19,11 +20,16 @@
 PACK_STRUCT(struct DeferredMaterialShaderData {
     Matrix WorldMatrix;
     Matrix PrevWorldMatrix;
-    Float2 Dummy0;
+    uint32 BonesOffset;
+    uint32 PrevBonesOffset;
     float LODDitherFactor;
     float PerInstanceRandom;
     Float3 GeometrySize;
     float WorldDeterminantSign;
+    Float3 QuantizationOffset;
+    float Dummy0;
+    Float3 QuantizationScale;
+    float Dummy1;
     });
 
 DrawPass DeferredMaterialShader::GetDrawModes() const
@@ -49,7 +55,7 @@ void DeferredMaterialShader::Bind(BindParameters& params)
     auto context = params.GPUContext;
     auto& view = params.RenderContext.View;
     auto& drawCall = *params.FirstDrawCall;
-    Span<byte> cb(_cbData.Get(), _cbData.Count());
+    Span<byte> cb = GetCBData();
     ASSERT_LOW_LAYER(cb.Length() >= sizeof(DeferredMaterialShaderData));
     auto materialData = reinterpret_cast<DeferredMaterialShaderData*>(cb.Get());
     cb = Span<byte>(cb.Get() + sizeof(DeferredMaterialShaderData), cb.Length() - sizeof(DeferredMaterialShaderData));
@@ -78,25 +84,36 @@ void DeferredMaterialShader::Bind(BindParameters& params)
         materialData->GeometrySize = drawCall.Surface.GeometrySize;
     }
 
+    // Check if is using quantized positions
+    const bool useQuantization = drawCall.Geometry.Quantization != nullptr;
+    if (useQuantization)
+    {
+        materialData->QuantizationOffset = drawCall.Geometry.Quantization->Offset;
+        materialData->QuantizationScale = drawCall.Geometry.Quantization->Scale;
+    }
+
     // Check if is using mesh skinning
     const bool useSkinning = drawCall.Surface.Skinning != nullptr;
     bool perBoneMotionBlur = false;
+    uint32 bonesOffset = 0, prevBonesOffset = 0;
     if (useSkinning)
     {
-        // Bind skinning buffer
+        // Bind skinning buffer (per-instance buffer or global bones palette)
         ASSERT(drawCall.Surface.Skinning->IsReady());
-        context->BindSR(0, drawCall.Surface.Skinning->BoneMatrices->View());
-        if (drawCall.Surface.Skinning->PrevBoneMatrices && drawCall.Surface.Skinning->PrevBoneMatrices->IsAllocated())
+        context->BindSR(0, drawCall.Surface.Skinning->GetBoneMatrices(bonesOffset)->View());
+        if (GPUBuffer* prevBoneMatrices = drawCall.Surface.Skinning->GetPrevBoneMatrices(prevBonesOffset))
         {
-            context->BindSR(1, drawCall.Surface.Skinning->PrevBoneMatrices->View());
+            context->BindSR(1, prevBoneMatrices->View());
             perBoneMotionBlur = true;
         }
     }
+    materialData->BonesOffset = bonesOffset;
+    materialData->PrevBonesOffset = prevBonesOffset;
 
     // Bind constants
     if (_cb)
     {
-        context->UpdateCB(_cb, _cbData.Get());
+        context->UpdateCB(_cb, materialData);
         context->BindCB(0, _cb);
     }
 
@@ -116,7 +133,11 @@ void DeferredMaterialShader::Bind(BindParameters& params)
             cullMode = CullMode::Normal;
     }
     ASSERT_LOW_LAYER(!(useSkinning && params.DrawCallsCount > 1)); // No support for instancing skinned meshes
-    const auto cache = params.DrawCallsCount == 1 ? &_cache : &_cacheInstanced;
+    Cache* cache;
+    if (useQuantization)
+        cache = params.DrawCallsCount == 1 ? &_cacheQuantized : &_cacheInstancedQuantized;
+    else
+        cache = params.DrawCallsCount == 1 ? &_cache : &_cacheInstanced;
     PipelineStateCache* psCache = cache->GetPS(view.Pass, useLightmap, useSkinning, perBoneMotionBlur);
     ASSERT(psCache);
     GPUPipelineState* state = psCache->GetPS(cullMode, wireframe);
@@ -132,6 +153,8 @@ void DeferredMaterialShader::Unload()
 
     _cache.Release();
     _cacheInstanced.Release();
+    _cacheQuantized.Release();
+    _cacheInstancedQuantized.Release();
 }
 
 bool DeferredMaterialShader::Load()
@@ -156,6 +179,17 @@ bool DeferredMaterialShader::Load()
     }
 #endif
 
+    // Quantized positions use separate vertex shader permutations (with 16-bit positions decoding)
+    const bool hasQuantization = _shader->HasShader("VS", 2);
+#define INIT_QUANTIZED(state, vs) \
+    if (hasQuantization) \
+    { \
+        psDesc.VS = _shader->GetVS(vs, 2); \
+        _cacheQuantized.state.Init(psDesc); \
+        psDesc.VS = _shader->GetVS(vs, 3); \
+        _cacheInstancedQuantized.state.Init(psDesc); \
+    }
+
     // GBuffer Pass
     psDesc.VS = _shader->GetVS("VS");
     failed |= psDesc.VS == nullptr;
@@ -164,6 +198,7 @@ bool DeferredMaterialShader::Load()
     psDesc.VS = _shader->GetVS("VS", 1);
     failed |= psDesc.VS == nullptr;
     _cacheInstanced.Default.Init(psDesc);
+    INIT_QUANTIZED(Default, "VS");
 
     // GBuffer Pass with lightmap (pixel shader permutation for USE_LIGHTMAP=1)
     psDesc.VS = _shader->GetVS("VS");
@@ -173,6 +208,7 @@ bool DeferredMaterialShader::Load()
     psDesc.VS = _shader->GetVS("VS", 1);
     failed |= psDesc.VS == nullptr;
     _cacheInstanced.DefaultLightmap.Init(psDesc);
+    INIT_QUANTIZED(DefaultLightmap, "VS");
 
     // GBuffer Pass with skinning
     psDesc.VS = _shader->GetVS("VS_Skinned");
@@ -190,6 +226,7 @@ bool DeferredMaterialShader::Load()
         _cacheInstanced.Depth.Init(psDesc);
         psDesc.VS = _shader->GetVS("VS_Skinned");
         _cache.QuadOverdrawSkinned.Init(psDesc);
+        INIT_QUANTIZED(QuadOverdraw, "VS");
     }
 #endif
 
@@ -200,6 +237,7 @@ bool DeferredMaterialShader::Load()
     psDesc.VS = _shader->GetVS("VS");
     psDesc.PS = _shader->GetPS("PS_MotionVectors");
     _cache.MotionVectors.Init(psDesc);
+    INIT_QUANTIZED(MotionVectors, "VS");
 
     // Motion Vectors pass with skinning
     psDesc.VS = _shader->GetVS("VS_Skinned");
@@ -217,24 +255,25 @@ bool DeferredMaterialShader::Load()
     psDesc.DepthFunc = ComparisonFunc::Less;
     psDesc.HS = nullptr;
     psDesc.DS = nullptr;
-    GPUShaderProgramVS* instancedDepthPassVS;
+    const char* depthPassVS;
     if (EnumHasAnyFlags(_info.UsageFlags, MaterialUsageFlags::UseMask | MaterialUsageFlags::UsePositionOffset))
     {
         // Materials with masking need full vertex buffer to get texcoord used to sample textures for per pixel masking.
         // Materials with world pos offset need full VB to apply offset using texcoord etc.
-        psDesc.VS = _shader->GetVS("VS");
-        instancedDepthPassVS = _shader->GetVS("VS", 1);
+        depthPassVS = "VS";
         psDesc.PS = _shader->GetPS("PS_Depth");
     }
     else
     {
-        psDesc.VS = _shader->GetVS("VS_Depth");
-        instancedDepthPassVS = _shader->GetVS("VS_Depth", 1);
+        depthPassVS = "VS_Depth";
         psDesc.PS = nullptr;
     }
+    psDesc.VS = _shader->GetVS(depthPassVS);
     _cache.Depth.Init(psDesc);
-    psDesc.VS = instancedDepthPassVS;
+    psDesc.VS = _shader->GetVS(depthPassVS, 1);
     _cacheInstanced.Depth.Init(psDesc);
+    INIT_QUANTIZED(Depth, depthPassVS);
+#undef INIT_QUANTIZED
 
     // Depth Pass with skinning
     psDesc.VS = _shader->GetVS("VS_Skinned");
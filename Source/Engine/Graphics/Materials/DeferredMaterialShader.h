@@ -65,6 +65,8 @@ class DeferredMaterialShader : public MaterialShader
 private:
     Cache _cache;
     Cache _cacheInstanced;
+    Cache _cacheQuantized;
+    Cache _cacheInstancedQuantized;
 
 public:
     DeferredMaterialShader(const StringView& name)
@@ -21,7 +21,7 @@ PACK_STRUCT(struct DeformableMaterialShaderData {
     float WorldDeterminantSign;
     float MeshMinZ;
     float Segment;
-    float ChunksPerSegment;
+    float Dummy1;
     float PerInstanceRandom;
     Float3 GeometrySize;
     float MeshMaxZ;
@@ -38,7 +38,7 @@ void DeformableMaterialShader::Bind(BindParameters& params)
     auto context = params.GPUContext;
     auto& view = params.RenderContext.View;
     auto& drawCall = *params.FirstDrawCall;
-    Span<byte> cb(_cbData.Get(), _cbData.Count());
+    Span<byte> cb = GetCBData();
     ASSERT_LOW_LAYER(cb.Length() >= sizeof(DeformableMaterialShaderData));
     auto materialData = reinterpret_cast<DeformableMaterialShaderData*>(cb.Get());
     cb = Span<byte>(cb.Get() + sizeof(DeformableMaterialShaderData), cb.Length() - sizeof(DeformableMaterialShaderData));
@@ -64,7 +64,6 @@ void DeformableMaterialShader::Bind(BindParameters& params)
         Matrix::Transpose(drawCall.Deformable.LocalMatrix, materialData->LocalMatrix);
         materialData->WorldDeterminantSign = drawCall.WorldDeterminantSign;
         materialData->Segment = drawCall.Deformable.Segment;
-        materialData->ChunksPerSegment = drawCall.Deformable.ChunksPerSegment;
         materialData->MeshMinZ = drawCall.Deformable.MeshMinZ;
         materialData->MeshMaxZ = drawCall.Deformable.MeshMaxZ;
         materialData->PerInstanceRandom = drawCall.PerInstanceRandom;
@@ -77,7 +76,7 @@ void DeformableMaterialShader::Bind(BindParameters& params)
     // Bind constants
     if (_cb)
     {
-        context->UpdateCB(_cb, _cbData.Get());
+        context->UpdateCB(_cb, materialData);
         context->BindCB(0, _cb);
     }
 
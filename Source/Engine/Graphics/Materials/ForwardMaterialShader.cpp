@@ -9,6 +9,7 @@
 #include "Engine/Graphics/RenderView.h"
 #include "Engine/Graphics/RenderTask.h"
 #include "Engine/Graphics/Models/SkinnedMeshDrawData.h"
+#include "Engine/Graphics/Models/Types.h"
 #include "Engine/Graphics/Shaders/GPUConstantBuffer.h"
 #include "Engine/Graphics/Shaders/GPUShader.h"
 #include "Engine/Renderer/DrawCall.h"
@@ -20,11 +21,16 @@
 PACK_STRUCT(struct ForwardMaterialShaderData {
     Matrix WorldMatrix;
     Matrix PrevWorldMatrix;
-    Float2 Dummy0;
+    uint32 BonesOffset;
+    uint32 PrevBonesOffset;
     float LODDitherFactor;
     float PerInstanceRandom;
     Float3 GeometrySize;
     float WorldDeterminantSign;
+    Float3 QuantizationOffset;
+    float Dummy0;
+    Float3 QuantizationScale;
+    float Dummy1;
     });
 
 DrawPass ForwardMaterialShader::GetDrawModes() const
@@ -44,7 +50,7 @@ void ForwardMaterialShader::Bind(BindParameters& params)
     auto context = params.GPUContext;
     auto& view = params.RenderContext.View;
     auto& drawCall = *params.FirstDrawCall;
-    Span<byte> cb(_cbData.Get(), _cbData.Count());
+    Span<byte> cb = GetCBData();
     ASSERT_LOW_LAYER(cb.Length() >= sizeof(ForwardMaterialShaderData));
     auto materialData = reinterpret_cast<ForwardMaterialShaderData*>(cb.Get());
     cb = Span<byte>(cb.Get() + sizeof(ForwardMaterialShaderData), cb.Length() - sizeof(ForwardMaterialShaderData));
@@ -67,12 +73,15 @@ void ForwardMaterialShader::Bind(BindParameters& params)
 
     // Check if is using mesh skinning
     const bool useSkinning = drawCall.Surface.Skinning != nullptr;
+    uint32 bonesOffset = 0;
     if (useSkinning)
     {
-        // Bind skinning buffer
+        // Bind skinning buffer (per-instance buffer or global bones palette)
         ASSERT(drawCall.Surface.Skinning->IsReady());
-        context->BindSR(0, drawCall.Surface.Skinning->BoneMatrices->View());
+        context->BindSR(0, drawCall.Surface.Skinning->GetBoneMatrices(bonesOffset)->View());
     }
+    materialData->BonesOffset = bonesOffset;
+    materialData->PrevBonesOffset = 0;
 
     // Setup material constants
     {
@@ -84,10 +93,18 @@ void ForwardMaterialShader::Bind(BindParameters& params)
         materialData->GeometrySize = drawCall.Surface.GeometrySize;
     }
 
+    // Check if is using quantized positions
+    const bool useQuantization = drawCall.Geometry.Quantization != nullptr;
+    if (useQuantization)
+    {
+        materialData->QuantizationOffset = drawCall.Geometry.Quantization->Offset;
+        materialData->QuantizationScale = drawCall.Geometry.Quantization->Scale;
+    }
+
     // Bind constants
     if (_cb)
     {
-        context->UpdateCB(_cb, _cbData.Get());
+        context->UpdateCB(_cb, materialData);
         context->BindCB(0, _cb);
     }
 
@@ -107,7 +124,11 @@ void ForwardMaterialShader::Bind(BindParameters& params)
             cullMode = CullMode::Normal;
     }
     ASSERT_LOW_LAYER(!(useSkinning && params.DrawCallsCount > 1)); // No support for instancing skinned meshes
-    const auto cacheObj = params.DrawCallsCount == 1 ? &_cache : &_cacheInstanced;
+    Cache* cacheObj;
+    if (useQuantization)
+        cacheObj = params.DrawCallsCount == 1 ? &_cacheQuantized : &_cacheInstancedQuantized;
+    else
+        cacheObj = params.DrawCallsCount == 1 ? &_cache : &_cacheInstanced;
     PipelineStateCache* psCache = cacheObj->GetPS(view.Pass, useSkinning);
     ASSERT(psCache);
     GPUPipelineState* state = psCache->GetPS(cullMode, wireframe);
@@ -123,6 +144,8 @@ void ForwardMaterialShader::Unload()
 
     _cache.Release();
     _cacheInstanced.Release();
+    _cacheQuantized.Release();
+    _cacheInstancedQuantized.Release();
 }
 
 bool ForwardMaterialShader::Load()
@@ -143,6 +166,9 @@ bool ForwardMaterialShader::Load()
     }
 #endif
 
+    // Quantized positions use separate vertex shader permutations (with 16-bit positions decoding)
+    const bool hasQuantization = _shader->HasShader("VS", 2);
+
 #if USE_EDITOR
     if (_shader->HasShader("PS_QuadOverdraw"))
     {
@@ -154,6 +180,11 @@ bool ForwardMaterialShader::Load()
         _cacheInstanced.Depth.Init(psDesc);
         psDesc.VS = _shader->GetVS("VS_Skinned");
         _cache.QuadOverdrawSkinned.Init(psDesc);
+        if (hasQuantization)
+        {
+            psDesc.VS = _shader->GetVS("VS", 2);
+            _cacheQuantized.QuadOverdraw.Init(psDesc);
+        }
     }
 #endif
 
@@ -172,6 +203,11 @@ bool ForwardMaterialShader::Load()
         //_cacheInstanced.Distortion.Init(psDesc);
         psDesc.VS = _shader->GetVS("VS_Skinned");
         _cache.DistortionSkinned.Init(psDesc);
+        if (hasQuantization)
+        {
+            psDesc.VS = _shader->GetVS("VS", 2);
+            _cacheQuantized.Distortion.Init(psDesc);
+        }
     }
 
     // Forward Pass
@@ -198,6 +234,11 @@ bool ForwardMaterialShader::Load()
     //_cacheInstanced.Default.Init(psDesc);
     psDesc.VS = _shader->GetVS("VS_Skinned");
     _cache.DefaultSkinned.Init(psDesc);
+    if (hasQuantization)
+    {
+        psDesc.VS = _shader->GetVS("VS", 2);
+        _cacheQuantized.Default.Init(psDesc);
+    }
 
     // Depth Pass
     psDesc = GPUPipelineState::Description::Default;
@@ -215,6 +256,13 @@ bool ForwardMaterialShader::Load()
     _cacheInstanced.Depth.Init(psDesc);
     psDesc.VS = _shader->GetVS("VS_Skinned");
     _cache.DepthSkinned.Init(psDesc);
+    if (hasQuantization)
+    {
+        psDesc.VS = _shader->GetVS("VS", 2);
+        _cacheQuantized.Depth.Init(psDesc);
+        psDesc.VS = _shader->GetVS("VS", 3);
+        _cacheInstancedQuantized.Depth.Init(psDesc);
+    }
 
     return false;
 }
@@ -56,6 +56,8 @@ class ForwardMaterialShader : public MaterialShader
 private:
     Cache _cache;
     Cache _cacheInstanced;
+    Cache _cacheQuantized;
+    Cache _cacheInstancedQuantized;
     DrawPass _drawModes = DrawPass::None;
 
 public:
@@ -293,6 +293,14 @@ API_CLASS(NoSpawn) class FLAXENGINE_API MaterialParameter : public ScriptingObje
     /// <param name="value">The value.</param>
     API_PROPERTY() void SetValue(const Variant& value);
 
+    /// <summary>
+    /// Gets the asset used as a parameter value (eg. texture). Null if not assigned or parameter type doesn't use assets.
+    /// </summary>
+    FORCE_INLINE Asset* GetValueAsset() const
+    {
+        return _asAsset.Get();
+    }
+
 public:
     /// <summary>
     /// The material parameter binding metadata.
@@ -10,6 +10,8 @@
 #include "Engine/Graphics/Shaders/GPUConstantBuffer.h"
 #include "Engine/Graphics/Shaders/GPUShader.h"
 #include "Engine/Engine/Time.h"
+#include "Engine/Threading/Threading.h"
+#include "Engine/Threading/ThreadLocal.h"
 #include "DecalMaterialShader.h"
 #include "PostFxMaterialShader.h"
 #include "ForwardMaterialShader.h"
@@ -93,12 +95,25 @@ void IMaterial::BindParameters::BindViewData()
     GPUContext->BindCB(1, PerViewConstants);
 }
 
+namespace
+{
+    // Use a cached storage for the constant buffer data (one per thread to support binding materials from multiple threads)
+    ThreadLocal<Array<byte>*> CBDataScratch;
+}
+
 GPUPipelineState* MaterialShader::PipelineStateCache::InitPS(CullMode mode, bool wireframe)
 {
+    // Material can be bound from multiple threads (eg. parallel commands recording)
+    ScopeLock lock(GPUDevice::Instance->Locker);
+    const int32 index = static_cast<int32>(mode) + (wireframe ? 3 : 0);
+    auto ps = PS[index];
+    if (ps)
+        return ps;
     Desc.CullMode = mode;
     Desc.Wireframe = wireframe;
-    auto ps = GPUDevice::Instance->CreatePipelineState();
+    ps = GPUDevice::Instance->CreatePipelineState();
     ps->Init(Desc);
+    PS[index] = ps;
     return ps;
 }
 
@@ -110,6 +125,16 @@ MaterialShader::MaterialShader(const StringView& name)
     _shader = GPUDevice::Instance->CreateShader(name);
 }
 
+Span<byte> MaterialShader::GetCBData() const
+{
+    Array<byte>*& data = CBDataScratch.Get();
+    if (!data)
+        data = New<Array<byte>>();
+    data->Resize(_cbData.Count(), false);
+    Platform::MemoryCopy(data->Get(), _cbData.Get(), _cbData.Count());
+    return Span<byte>(data->Get(), data->Count());
+}
+
 MaterialShader::~MaterialShader()
 {
     ASSERT(!_isLoaded && _shader);
@@ -10,7 +10,7 @@
 /// <summary>
 /// Current materials shader version.
 /// </summary>
-#define MATERIAL_GRAPH_VERSION 162
+#define MATERIAL_GRAPH_VERSION 168
 
 class Material;
 class GPUShader;
@@ -43,7 +43,7 @@ class MaterialShader : public IMaterial
             const int32 index = static_cast<int32>(mode) + (wireframe ? 3 : 0);
             auto ps = PS[index];
             if (!ps)
-                PS[index] = ps = InitPS(mode, wireframe);
+                ps = InitPS(mode, wireframe);
             return ps;
         }
 
@@ -69,6 +69,11 @@ class MaterialShader : public IMaterial
     /// <param name="name">Material resource name</param>
     MaterialShader(const StringView& name);
 
+    /// <summary>
+    /// Gets the memory for the material constant buffer data (initialized with the default values). Uses per-thread memory so material can be bound from multiple threads (eg. parallel commands recording).
+    /// </summary>
+    Span<byte> GetCBData() const;
+
 public:
     /// <summary>
     /// Finalizes an instance of the <see cref="MaterialShader"/> class.
@@ -5,6 +5,7 @@
 #include "Engine/Graphics/Textures/GPUTexture.h"
 #include "Engine/Renderer/RenderList.h"
 #include "Engine/Renderer/ShadowsPass.h"
+#include "Engine/Renderer/ClusteredLightingPass.h"
 #if USE_EDITOR
 #include "Engine/Renderer/Lightmaps.h"
 #endif
@@ -22,6 +23,8 @@ void ForwardShadingFeature::Bind(MaterialShader::BindParameters& params, Span<by
     const int32 envProbeShaderRegisterIndex = srv + 0;
     const int32 skyLightShaderRegisterIndex = srv + 1;
     const int32 dirLightShaderRegisterIndex = srv + 2;
+    const int32 clusteredLightsShaderRegisterIndex = srv + 3;
+    const int32 clustersShaderRegisterIndex = srv + 4;
     const bool canUseShadow = view.Pass != DrawPass::Depth;
 
     // Set fog input
@@ -99,24 +102,38 @@ void ForwardShadingFeature::Bind(MaterialShader::BindParameters& params, Span<by
 
     // Set local lights
     data.LocalLightsCount = 0;
-    const BoundingSphere objectBounds(drawCall.ObjectPosition, drawCall.ObjectRadius);
-    // TODO: optimize lights searching for a transparent material - use spatial cache for renderer to find it
-    for (int32 i = 0; i < cache->PointLights.Count() && data.LocalLightsCount < MaxLocalLights; i++)
+    ClusteredLightingPass::BindingData bindingDataClusters;
+    if (!ClusteredLightingPass::Instance()->Get(params.RenderContext.Buffers, bindingDataClusters))
     {
-        const auto& light = cache->PointLights[i];
-        if (CollisionsHelper::SphereIntersectsSphere(objectBounds, BoundingSphere(light.Position, light.Radius)))
-        {
-            light.SetupLightData(&data.LocalLights[data.LocalLightsCount], false);
-            data.LocalLightsCount++;
-        }
+        // Use lights culled per-cluster on a GPU
+        data.ClusteredLighting = bindingDataClusters.Constants;
+        params.GPUContext->BindSR(clusteredLightsShaderRegisterIndex, bindingDataClusters.Lights);
+        params.GPUContext->BindSR(clustersShaderRegisterIndex, bindingDataClusters.Clusters);
     }
-    for (int32 i = 0; i < cache->SpotLights.Count() && data.LocalLightsCount < MaxLocalLights; i++)
+    else
     {
-        const auto& light = cache->SpotLights[i];
-        if (CollisionsHelper::SphereIntersectsSphere(objectBounds, BoundingSphere(light.Position, light.Radius)))
+        // Fallback to searching lights affecting the object on a CPU (limited to a few lights per draw call)
+        data.ClusteredLighting.LightsCount = 0;
+        params.GPUContext->UnBindSR(clusteredLightsShaderRegisterIndex);
+        params.GPUContext->UnBindSR(clustersShaderRegisterIndex);
+        const BoundingSphere objectBounds(drawCall.ObjectPosition, drawCall.ObjectRadius);
+        for (int32 i = 0; i < cache->PointLights.Count() && data.LocalLightsCount < MaxLocalLights; i++)
         {
-            light.SetupLightData(&data.LocalLights[data.LocalLightsCount], false);
-            data.LocalLightsCount++;
+            const auto& light = cache->PointLights[i];
+            if (CollisionsHelper::SphereIntersectsSphere(objectBounds, BoundingSphere(light.Position, light.Radius)))
+            {
+                light.SetupLightData(&data.LocalLights[data.LocalLightsCount], false);
+                data.LocalLightsCount++;
+            }
+        }
+        for (int32 i = 0; i < cache->SpotLights.Count() && data.LocalLightsCount < MaxLocalLights; i++)
+        {
+            const auto& light = cache->SpotLights[i];
+            if (CollisionsHelper::SphereIntersectsSphere(objectBounds, BoundingSphere(light.Position, light.Radius)))
+            {
+                light.SetupLightData(&data.LocalLights[data.LocalLightsCount], false);
+                data.LocalLightsCount++;
+            }
         }
     }
 
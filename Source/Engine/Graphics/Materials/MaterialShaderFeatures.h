@@ -6,6 +6,7 @@
 #include "Engine/Core/Math/Rectangle.h"
 #include "Engine/Core/Types/Span.h"
 #include "Engine/Renderer/GI/DynamicDiffuseGlobalIllumination.h"
+#include "Engine/Renderer/ClusteredLightingPass.h"
 
 // Material shader features are plugin-based functionalities that are reusable between different material domains.
 struct MaterialShaderFeature
@@ -23,7 +24,7 @@ struct ForwardShadingFeature : MaterialShaderFeature
 {
     enum { MaxLocalLights = 4 };
 
-    enum { SRVs = 3 };
+    enum { SRVs = 5 };
 
     PACK_STRUCT(struct Data
         {
@@ -35,6 +36,7 @@ struct ForwardShadingFeature : MaterialShaderFeature
         Float3 Dummy2;
         uint32 LocalLightsCount;
         LightData LocalLights[MaxLocalLights];
+        ClusteredLightingPass::ConstantsData ClusteredLighting;
         });
 
     static void Bind(MaterialShader::BindParameters& params, Span<byte>& cb, int32& srv);
@@ -14,6 +14,7 @@
 #include "Engine/Level/Scene/Lightmap.h"
 #include "Engine/Renderer/DrawCall.h"
 #include "Engine/Terrain/TerrainPatch.h"
+#include "Engine/Terrain/TerrainMaterialCache.h"
 
 PACK_STRUCT(struct TerrainMaterialShaderData {
     Matrix WorldMatrix;
@@ -26,7 +27,8 @@ PACK_STRUCT(struct TerrainMaterialShaderData {
     Float4 HeightmapUVScaleBias; // xy-scale, zw-offset for chunk geometry UVs into heightmap UVs (as single MAD instruction)
     Float4 NeighborLOD; // Per component LOD index for chunk neighbors ordered: top, left, right, bottom
     Float2 OffsetUV; // Offset applied to the texture coordinates (used to implement seamless UVs based on chunk location relative to terrain root)
-    Float2 Dummy0;
+    float CachePage; // Index of the material cache page to sample instead of evaluating the material (-1 if unused)
+    float Dummy0;
     });
 
 DrawPass TerrainMaterialShader::GetDrawModes() const
@@ -45,11 +47,11 @@ void TerrainMaterialShader::Bind(BindParameters& params)
     auto context = params.GPUContext;
     auto& view = params.RenderContext.View;
     auto& drawCall = *params.FirstDrawCall;
-    Span<byte> cb(_cbData.Get(), _cbData.Count());
+    Span<byte> cb = GetCBData();
     ASSERT_LOW_LAYER(cb.Length() >= sizeof(TerrainMaterialShaderData));
     auto materialData = reinterpret_cast<TerrainMaterialShaderData*>(cb.Get());
     cb = Span<byte>(cb.Get() + sizeof(TerrainMaterialShaderData), cb.Length() - sizeof(TerrainMaterialShaderData));
-    int32 srv = 3;
+    int32 srv = 6;
 
     // Setup features
     const bool useLightmap = LightmapFeature::Bind(params, cb, srv);
@@ -82,6 +84,7 @@ void TerrainMaterialShader::Bind(BindParameters& params)
         materialData->HeightmapUVScaleBias = drawCall.Terrain.HeightmapUVScaleBias;
         materialData->NeighborLOD = drawCall.Terrain.NeighborLOD;
         materialData->OffsetUV = drawCall.Terrain.OffsetUV;
+        materialData->CachePage = (float)drawCall.Terrain.CachePage;
     }
 
     // Bind terrain textures
@@ -91,11 +94,19 @@ void TerrainMaterialShader::Bind(BindParameters& params)
     context->BindSR(0, heightmap);
     context->BindSR(1, splatmap0);
     context->BindSR(2, splatmap1);
+    if (drawCall.Terrain.CachePage != -1)
+    {
+        GPUTexture* cache[3];
+        TerrainMaterialCache::GetTextures(cache);
+        context->BindSR(3, cache[0]);
+        context->BindSR(4, cache[1]);
+        context->BindSR(5, cache[2]);
+    }
 
     // Bind constants
     if (_cb)
     {
-        context->UpdateCB(_cb, _cbData.Get());
+        context->UpdateCB(_cb, materialData);
         context->BindCB(0, _cb);
     }
 
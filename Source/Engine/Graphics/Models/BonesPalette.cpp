@@ -0,0 +1,115 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "BonesPalette.h"
+#include "SkinnedMeshDrawData.h"
+#include "Engine/Core/Log.h"
+#include "Engine/Core/Math/Vector4.h"
+#include "Engine/Engine/Engine.h"
+#include "Engine/Graphics/Graphics.h"
+#include "Engine/Graphics/GPUContext.h"
+#include "Engine/Graphics/GPUDevice.h"
+#include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Threading/Threading.h"
+
+namespace
+{
+    CriticalSection Locker;
+    Array<byte> Data;
+    uint32 UploadedSize = 0;
+    uint32 PrevUploadedSize = 0;
+    uint64 Frame = 0;
+    uint64 PrevFrame = 0;
+    GPUBuffer* Buffer = nullptr;
+    GPUBuffer* PrevBuffer = nullptr;
+
+    void BeginFrame(uint64 frame)
+    {
+        // Current frame palette becomes the history (only the uploaded part is valid)
+        PrevFrame = Frame;
+        PrevUploadedSize = UploadedSize;
+        Frame = frame;
+        UploadedSize = 0;
+        Data.Clear();
+        Swap(Buffer, PrevBuffer);
+    }
+}
+
+bool BonesPalette::IsEnabled()
+{
+    return Graphics::GlobalBonesPalette;
+}
+
+void BonesPalette::Write(SkinnedMeshDrawData& skinning)
+{
+    const uint64 frame = Engine::FrameCount;
+    if (skinning.PaletteFrame == frame)
+        return;
+    ScopeLock lock(Locker);
+    if (Frame != frame)
+        BeginFrame(frame);
+
+    // Allocate bones in the palette
+    const int32 size = skinning.Data.Count();
+    const int32 offset = Data.Count();
+    Data.Resize(offset + size);
+    Platform::MemoryCopy(Data.Get() + offset, skinning.Data.Get(), size);
+
+    // Link the bones written in the previous frame as a history (if uploaded)
+    const bool hasHistory = !skinning._dropPaletteHistory && skinning.PaletteFrame == PrevFrame && skinning.PaletteOffset >= 0 && (uint32)(skinning.PaletteOffset * sizeof(Float4) + size) <= PrevUploadedSize;
+    skinning.PrevPaletteOffset = hasHistory ? skinning.PaletteOffset : -1;
+    skinning.PaletteOffset = offset / sizeof(Float4);
+    skinning.PaletteFrame = frame;
+    skinning._dropPaletteHistory = false;
+}
+
+void BonesPalette::Flush(GPUContext* context)
+{
+    ScopeLock lock(Locker);
+    const uint32 size = Data.Count();
+    if (Frame != Engine::FrameCount || UploadedSize == size)
+        return;
+    PROFILE_CPU();
+
+    // Grow the buffer (the whole palette needs to be uploaded again)
+    if (!Buffer)
+        Buffer = GPUDevice::Instance->CreateBuffer(TEXT("BonesPalette"));
+    if (Buffer->GetSize() < size)
+    {
+        const uint32 elementsCount = Math::RoundUpToPowerOf2(size / (uint32)sizeof(Float4));
+        if (Buffer->Init(GPUBufferDescription::Typed((int32)Math::Max(elementsCount, 4096u), PixelFormat::R32G32B32A32_Float)))
+        {
+            LOG(Error, "Failed to initialize the bones palette buffer");
+            return;
+        }
+        UploadedSize = 0;
+    }
+
+    // Upload only the bones written since the last flush
+    context->UpdateBuffer(Buffer, Data.Get() + UploadedSize, size - UploadedSize, UploadedSize);
+    UploadedSize = size;
+}
+
+GPUBuffer* BonesPalette::GetBuffer()
+{
+    return Buffer;
+}
+
+GPUBuffer* BonesPalette::GetPrevBuffer()
+{
+    return PrevBuffer;
+}
+
+uint64 BonesPalette::GetFrame()
+{
+    return Frame;
+}
+
+void BonesPalette::Dispose()
+{
+    ScopeLock lock(Locker);
+    SAFE_DELETE_GPU_RESOURCE(Buffer);
+    SAFE_DELETE_GPU_RESOURCE(PrevBuffer);
+    Data.Resize(0);
+    UploadedSize = PrevUploadedSize = 0;
+    Frame = PrevFrame = 0;
+}
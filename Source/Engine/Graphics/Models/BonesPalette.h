@@ -0,0 +1,53 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Core/Types/BaseTypes.h"
+
+class GPUBuffer;
+class GPUContext;
+class SkinnedMeshDrawData;
+
+/// <summary>
+/// The global bones palette. Bone matrices of all skinned meshes drawn within a frame are allocated from a single large buffer and uploaded with a single copy, instead of updating a small buffer per animated model. The previous frame palette is kept for the per-bone motion vectors.
+/// </summary>
+class FLAXENGINE_API BonesPalette
+{
+public:
+    /// <summary>
+    /// Checks if the global bones palette is enabled (see Graphics::GlobalBonesPalette).
+    /// </summary>
+    static bool IsEnabled();
+
+    /// <summary>
+    /// Writes the bones of the skinned mesh into the current frame palette and updates the palette offsets of the skinning data. Bones are written once per frame, later calls are skipped.
+    /// </summary>
+    /// <param name="skinning">The skinning data.</param>
+    static void Write(SkinnedMeshDrawData& skinning);
+
+    /// <summary>
+    /// Uploads the bones written since the last flush to the GPU buffer. Called before executing draw calls (or dispatching compute shaders) that use the palette.
+    /// </summary>
+    /// <param name="context">The GPU context.</param>
+    static void Flush(GPUContext* context);
+
+    /// <summary>
+    /// Gets the current frame palette buffer (stored as 4x3, 3 float4 behind each other).
+    /// </summary>
+    static GPUBuffer* GetBuffer();
+
+    /// <summary>
+    /// Gets the previous frame palette buffer.
+    /// </summary>
+    static GPUBuffer* GetPrevBuffer();
+
+    /// <summary>
+    /// Gets the index of the frame that current palette data has been written for.
+    /// </summary>
+    static uint64 GetFrame();
+
+    /// <summary>
+    /// Releases the palette resources.
+    /// </summary>
+    static void Dispose();
+};
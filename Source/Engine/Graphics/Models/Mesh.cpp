@@ -15,6 +15,7 @@
 #include "Engine/Renderer/RenderList.h"
 #include "Engine/Scripting/ManagedCLR/MCore.h"
 #include "Engine/Serialization/MemoryReadStream.h"
+#include "Engine/Streaming/Streaming.h"
 #include "Engine/Threading/Task.h"
 #include "Engine/Threading/Threading.h"
 #if USE_EDITOR
@@ -23,6 +24,14 @@
 
 namespace
 {
+    void DecodePositions(const PositionsQuantization& quantization, const VB0QuantizedElementType* src, uint32 count, Array<byte>& result)
+    {
+        result.Resize(count * sizeof(VB0ElementType), false);
+        auto dst = (Float3*)result.Get();
+        for (uint32 i = 0; i < count; i++)
+            dst[i] = quantization.Decode(src[i]);
+    }
+
     template<typename IndexType>
     bool UpdateMesh(Mesh* mesh, uint32 vertexCount, uint32 triangleCount, const Float3* vertices, const IndexType* triangles, const Float3* normals, const Float3* tangents, const Float2* uvs, const Color32* colors)
     {
@@ -133,6 +142,8 @@ bool Mesh::UpdateMesh(uint32 vertexCount, uint32 triangleCount, const VB0Element
     auto model = (Model*)_model;
 
     Unload();
+    _meshlets.Resize(0);
+    _quantization = {};
 
     // Setup GPU resources
     model->LODs[_lodIndex]._verticesCount -= _vertices;
@@ -180,7 +191,10 @@ bool Mesh::UpdateTriangles(uint32 triangleCount, const void* ib, bool use16BitIn
     // TODO: update collision proxy
 
     // Initialize
+    indexBuffer->SetCategory(GPUResourceCategory::Meshes, GetModel()->GetID());
     SAFE_DELETE_GPU_RESOURCE(_indexBuffer);
+    SAFE_DELETE_GPU_RESOURCE(_meshletsBuffer);
+    _meshlets.Resize(0);
     _indexBuffer = indexBuffer;
     _triangles = triangleCount;
     _use16BitIndexBuffer = use16BitIndices;
@@ -204,6 +218,9 @@ void Mesh::Init(Model* model, int32 lodIndex, int32 index, int32 materialSlotInd
     _vertexBuffers[1] = nullptr;
     _vertexBuffers[2] = nullptr;
     _indexBuffer = nullptr;
+    _meshletsBuffer = nullptr;
+    _meshlets.Resize(0);
+    _quantization = {};
 }
 
 Mesh::~Mesh()
@@ -213,6 +230,7 @@ Mesh::~Mesh()
     SAFE_DELETE_GPU_RESOURCE(_vertexBuffers[1]);
     SAFE_DELETE_GPU_RESOURCE(_vertexBuffers[2]);
     SAFE_DELETE_GPU_RESOURCE(_indexBuffer);
+    SAFE_DELETE_GPU_RESOURCE(_meshletsBuffer);
 }
 
 bool Mesh::Load(uint32 vertices, uint32 triangles, const void* vb0, const void* vb1, const void* vb2, const void* ib, bool use16BitIndexBuffer)
@@ -225,6 +243,11 @@ bool Mesh::Load(uint32 vertices, uint32 triangles, const void* vb0, const void*
     GPUBuffer* vertexBuffer1 = nullptr;
     GPUBuffer* vertexBuffer2 = nullptr;
     GPUBuffer* indexBuffer = nullptr;
+    GPUBuffer* meshletsBuffer = nullptr;
+    GPUBufferDescription ibDesc;
+
+    // Use triangle clusters only if they match the index buffer
+    const bool useMeshlets = _meshlets.HasItems() && _meshlets.Last().StartIndex + _meshlets.Last().IndicesCount == indicesCount;
 
     // Create GPU buffers
 #if GPU_ENABLE_RESOURCE_NAMING
@@ -233,7 +256,7 @@ bool Mesh::Load(uint32 vertices, uint32 triangles, const void* vb0, const void*
 #define MESH_BUFFER_NAME(postfix) String::Empty
 #endif
     vertexBuffer0 = GPUDevice::Instance->CreateBuffer(MESH_BUFFER_NAME(".VB0"));
-    if (vertexBuffer0->Init(GPUBufferDescription::Vertex(sizeof(VB0ElementType), vertices, vb0)))
+    if (vertexBuffer0->Init(GPUBufferDescription::Vertex(GetVB0Stride(), vertices, vb0)))
         goto ERROR_LOAD_END;
     vertexBuffer1 = GPUDevice::Instance->CreateBuffer(MESH_BUFFER_NAME(".VB1"));
     if (vertexBuffer1->Init(GPUBufferDescription::Vertex(sizeof(VB1ElementType), vertices, vb1)))
@@ -245,13 +268,28 @@ bool Mesh::Load(uint32 vertices, uint32 triangles, const void* vb0, const void*
             goto ERROR_LOAD_END;
     }
     indexBuffer = GPUDevice::Instance->CreateBuffer(MESH_BUFFER_NAME(".IB"));
-    if (indexBuffer->Init(GPUBufferDescription::Index(ibStride, indicesCount, ib)))
+    ibDesc = GPUBufferDescription::Index(ibStride, indicesCount, ib);
+    if (useMeshlets)
+        ibDesc.Flags |= GPUBufferFlags::ShaderResource; // Read by the triangle clusters culling
+    if (indexBuffer->Init(ibDesc))
         goto ERROR_LOAD_END;
+    if (useMeshlets)
+    {
+        meshletsBuffer = GPUDevice::Instance->CreateBuffer(MESH_BUFFER_NAME(".Meshlets"));
+        if (meshletsBuffer->Init(GPUBufferDescription::Buffer(_meshlets.Count() * sizeof(Meshlet), GPUBufferFlags::Structured | GPUBufferFlags::ShaderResource, PixelFormat::Unknown, _meshlets.Get(), sizeof(Meshlet))))
+            goto ERROR_LOAD_END;
+    }
 
     // Init collision proxy
 #if USE_PRECISE_MESH_INTERSECTS
     if (!_collisionProxy.HasData())
     {
+        Array<byte> positions;
+        if (_quantization.IsValid())
+        {
+            DecodePositions(_quantization, (const VB0QuantizedElementType*)vb0, vertices, positions);
+            vb0 = positions.Get();
+        }
         if (use16BitIndexBuffer)
             _collisionProxy.Init<uint16>(vertices, triangles, (Float3*)vb0, (uint16*)ib);
         else
@@ -260,10 +298,16 @@ bool Mesh::Load(uint32 vertices, uint32 triangles, const void* vb0, const void*
 #endif
 
     // Initialize
+    for (GPUBuffer* buffer : { vertexBuffer0, vertexBuffer1, vertexBuffer2, indexBuffer, meshletsBuffer })
+    {
+        if (buffer)
+            buffer->SetCategory(GPUResourceCategory::Meshes, GetModel()->GetID());
+    }
     _vertexBuffers[0] = vertexBuffer0;
     _vertexBuffers[1] = vertexBuffer1;
     _vertexBuffers[2] = vertexBuffer2;
     _indexBuffer = indexBuffer;
+    _meshletsBuffer = meshletsBuffer;
     _triangles = triangles;
     _vertices = vertices;
     _use16BitIndexBuffer = use16BitIndexBuffer;
@@ -280,6 +324,7 @@ bool Mesh::Load(uint32 vertices, uint32 triangles, const void* vb0, const void*
     SAFE_DELETE_GPU_RESOURCE(vertexBuffer1);
     SAFE_DELETE_GPU_RESOURCE(vertexBuffer2);
     SAFE_DELETE_GPU_RESOURCE(indexBuffer);
+    SAFE_DELETE_GPU_RESOURCE(meshletsBuffer);
     return true;
 }
 
@@ -289,6 +334,7 @@ void Mesh::Unload()
     SAFE_DELETE_GPU_RESOURCE(_vertexBuffers[1]);
     SAFE_DELETE_GPU_RESOURCE(_vertexBuffers[2]);
     SAFE_DELETE_GPU_RESOURCE(_indexBuffer);
+    SAFE_DELETE_GPU_RESOURCE(_meshletsBuffer);
     _triangles = 0;
     _vertices = 0;
     _use16BitIndexBuffer = false;
@@ -371,18 +417,20 @@ void Mesh::GetDrawCallGeometry(DrawCall& drawCall) const
     drawCall.Geometry.VertexBuffersOffsets[0] = 0;
     drawCall.Geometry.VertexBuffersOffsets[1] = 0;
     drawCall.Geometry.VertexBuffersOffsets[2] = 0;
+    drawCall.Geometry.Meshlets = _meshletsBuffer;
+    drawCall.Geometry.Quantization = _quantization.IsValid() ? &_quantization : nullptr;
     drawCall.Draw.StartIndex = 0;
     drawCall.Draw.IndicesCount = _triangles * 3;
 }
 
-void Mesh::Render(GPUContext* context) const
+void Mesh::Render(GPUContext* context, int32 instanceCount) const
 {
     if (!IsInitialized())
         return;
 
     context->BindVB(ToSpan((GPUBuffer**)_vertexBuffers, 3));
     context->BindIB(_indexBuffer);
-    context->DrawIndexedInstanced(_triangles * 3, 1, 0, 0, 0);
+    context->DrawIndexedInstanced(_triangles * 3, instanceCount, 0, 0, 0);
 }
 
 void Mesh::Draw(const RenderContext& renderContext, MaterialBase* material, const Matrix& world, StaticFlags flags, bool receiveDecals, DrawPass drawModes, float perInstanceRandom, int16 sortOrder) const
@@ -399,6 +447,8 @@ void Mesh::Draw(const RenderContext& renderContext, MaterialBase* material, cons
     drawCall.Geometry.VertexBuffers[0] = _vertexBuffers[0];
     drawCall.Geometry.VertexBuffers[1] = _vertexBuffers[1];
     drawCall.Geometry.VertexBuffers[2] = _vertexBuffers[2];
+    drawCall.Geometry.Meshlets = _meshletsBuffer;
+    drawCall.Geometry.Quantization = _quantization.IsValid() ? &_quantization : nullptr;
     drawCall.Draw.IndicesCount = _triangles * 3;
     drawCall.InstanceCount = 1;
     drawCall.Material = material;
@@ -446,6 +496,8 @@ void Mesh::Draw(const RenderContext& renderContext, const DrawInfo& info, float
     const auto drawModes = info.DrawModes & renderContext.View.Pass & renderContext.View.GetShadowsDrawPassMask(shadowsMode) & material->GetDrawModes();
     if (drawModes == DrawPass::None)
         return;
+    if (EnumHasAnyFlags(drawModes, DrawPass::GBuffer | DrawPass::Forward))
+        Streaming::ReportMaterialScreenSize(material, renderContext.View, info.Bounds.Center, (float)info.Bounds.Radius);
 
     // Setup draw call
     DrawCall drawCall;
@@ -458,6 +510,12 @@ void Mesh::Draw(const RenderContext& renderContext, const DrawInfo& info, float
         info.Deformation->RunDeformers(this, MeshBufferType::Vertex0, drawCall.Geometry.VertexBuffers[0]);
         info.Deformation->RunDeformers(this, MeshBufferType::Vertex1, drawCall.Geometry.VertexBuffers[1]);
     }
+    if (drawCall.Geometry.VertexBuffers[0] == _vertexBuffers[0])
+    {
+        // Triangle clusters bounds and positions quantization are valid only for the original geometry (deformers output full-precision positions)
+        drawCall.Geometry.Meshlets = _meshletsBuffer;
+        drawCall.Geometry.Quantization = _quantization.IsValid() ? &_quantization : nullptr;
+    }
     if (info.VertexColors && info.VertexColors[_lodIndex])
     {
         // TODO: cache vertexOffset within the model LOD per-mesh
@@ -498,6 +556,47 @@ void Mesh::Draw(const RenderContextBatch& renderContextBatch, const DrawInfo& in
         return;
     const MaterialSlot& slot = _model->MaterialSlots[_materialSlotIndex];
 
+    // Try to use the retained draw call
+    MeshDrawCache::Entry* cached = nullptr;
+    MeshDrawCache* drawCache = info.DrawCache;
+#if USE_EDITOR
+    const ViewMode viewMode = renderContextBatch.GetMainContext().View.Mode;
+    if (viewMode == ViewMode::LightmapUVsDensity || viewMode == ViewMode::LODPreview)
+        drawCache = nullptr;
+#endif
+    if (drawCache)
+    {
+        auto& cachedLOD = drawCache->LODs[_lodIndex];
+        const int32 meshesCount = ((Model*)_model)->LODs[_lodIndex].Meshes.Count();
+        if (cachedLOD.Count() != meshesCount)
+        {
+            cachedLOD.Clear();
+            cachedLOD.Resize(meshesCount);
+        }
+        cached = &cachedLOD.Get()[_index];
+        if (cached->Call.Material &&
+            cached->EntryMaterial == entry.Material.Get() &&
+            cached->SlotMaterial == slot.Material.Get() &&
+            cached->IndexBuffer == _indexBuffer &&
+            Platform::MemoryCompare(cached->VertexBuffers, _vertexBuffers, sizeof(_vertexBuffers)) == 0 &&
+            ((MaterialBase*)cached->Call.Material)->IsLoaded())
+        {
+            DrawCall drawCall = cached->Call;
+            drawCall.Surface.PrevWorld = info.DrawState->PrevWorld;
+            drawCall.Surface.LODDitherFactor = lodDitherFactor;
+            const auto shadowsMode = entry.ShadowsMode & slot.ShadowsMode;
+            const auto drawModes = info.DrawModes & drawCall.Material->GetDrawModes();
+            if (drawModes != DrawPass::None)
+            {
+                const RenderContext& mainRenderContext = renderContextBatch.GetMainContext();
+                if (EnumHasAnyFlags(drawModes & mainRenderContext.View.Pass, DrawPass::GBuffer | DrawPass::Forward))
+                    Streaming::ReportMaterialScreenSize((MaterialBase*)drawCall.Material, mainRenderContext.View, info.Bounds.Center, (float)info.Bounds.Radius);
+                mainRenderContext.List->AddDrawCall(renderContextBatch, drawModes, info.Flags, shadowsMode, info.Bounds, drawCall, entry.ReceiveDecals, info.SortOrder, cached->BatchKey, info.ContextsMask);
+            }
+            return;
+        }
+    }
+
     // Select material
     MaterialBase* material;
     if (entry.Material && entry.Material->IsLoaded())
@@ -520,6 +619,12 @@ void Mesh::Draw(const RenderContextBatch& renderContextBatch, const DrawInfo& in
         info.Deformation->RunDeformers(this, MeshBufferType::Vertex0, drawCall.Geometry.VertexBuffers[0]);
         info.Deformation->RunDeformers(this, MeshBufferType::Vertex1, drawCall.Geometry.VertexBuffers[1]);
     }
+    if (drawCall.Geometry.VertexBuffers[0] == _vertexBuffers[0])
+    {
+        // Triangle clusters bounds and positions quantization are valid only for the original geometry (deformers output full-precision positions)
+        drawCall.Geometry.Meshlets = _meshletsBuffer;
+        drawCall.Geometry.Quantization = _quantization.IsValid() ? &_quantization : nullptr;
+    }
     if (info.VertexColors && info.VertexColors[_lodIndex])
     {
         // TODO: cache vertexOffset within the model LOD per-mesh
@@ -544,16 +649,33 @@ void Mesh::Draw(const RenderContextBatch& renderContextBatch, const DrawInfo& in
     drawCall.WorldDeterminantSign = Math::FloatSelect(drawCall.World.RotDeterminant(), 1, -1);
     drawCall.PerInstanceRandom = info.PerInstanceRandom;
 #if USE_EDITOR
-    const ViewMode viewMode = renderContextBatch.GetMainContext().View.Mode;
     if (viewMode == ViewMode::LightmapUVsDensity || viewMode == ViewMode::LODPreview)
         GBufferPass::AddIndexBufferToModelLOD(_indexBuffer, &((Model*)_model)->LODs[_lodIndex]);
 #endif
+    if (cached)
+    {
+        // Retain the draw call for the next frames (unless using the fallback material that will change once the proper one gets loaded)
+        const bool isFallback = material != entry.Material.Get() && material != slot.Material.Get();
+        cached->Call = drawCall;
+        cached->Call.Material = isFallback ? nullptr : material;
+        cached->BatchKey = RenderList::GetBatchKey(drawCall);
+        cached->EntryMaterial = entry.Material.Get();
+        cached->SlotMaterial = slot.Material.Get();
+        cached->IndexBuffer = _indexBuffer;
+        Platform::MemoryCopy(cached->VertexBuffers, _vertexBuffers, sizeof(_vertexBuffers));
+    }
 
     // Push draw call to the render lists
     const auto shadowsMode = entry.ShadowsMode & slot.ShadowsMode;
     const auto drawModes = info.DrawModes & material->GetDrawModes();
     if (drawModes != DrawPass::None)
-        renderContextBatch.GetMainContext().List->AddDrawCall(renderContextBatch, drawModes, info.Flags, shadowsMode, info.Bounds, drawCall, entry.ReceiveDecals, info.SortOrder);
+    {
+        const RenderContext& mainRenderContext = renderContextBatch.GetMainContext();
+        if (EnumHasAnyFlags(drawModes & mainRenderContext.View.Pass, DrawPass::GBuffer | DrawPass::Forward))
+            Streaming::ReportMaterialScreenSize(material, mainRenderContext.View, info.Bounds.Center, (float)info.Bounds.Radius);
+        const uint16 batchKey = cached ? cached->BatchKey : RenderList::GetBatchKey(drawCall);
+        mainRenderContext.List->AddDrawCall(renderContextBatch, drawModes, info.Flags, shadowsMode, info.Bounds, drawCall, entry.ReceiveDecals, info.SortOrder, batchKey, info.ContextsMask);
+    }
 }
 
 bool Mesh::DownloadDataGPU(MeshBufferType type, BytesContainer& result) const
@@ -640,7 +762,8 @@ bool Mesh::DownloadDataCPU(MeshBufferType type, BytesContainer& result, int32& c
                 LOG(Error, "Invalid mesh data.");
                 return true;
             }
-            auto vb0 = stream.Move<VB0ElementType>(vertices);
+            const Mesh& mesh = model->LODs[_lodIndex].Meshes[i];
+            auto vb0 = stream.Move<byte>(vertices * mesh.GetVB0Stride());
             auto vb1 = stream.Move<VB1ElementType>(vertices);
             bool hasColors = stream.ReadBool();
             VB2ElementType18* vb2 = nullptr;
@@ -653,10 +776,13 @@ bool Mesh::DownloadDataCPU(MeshBufferType type, BytesContainer& result, int32& c
             if (i != _index)
                 continue;
 
-            // Cache mesh data
+            // Cache mesh data (with decoded positions)
             _cachedIndexBufferCount = indicesCount;
             _cachedIndexBuffer.Set(ib, indicesCount * ibStride);
-            _cachedVertexBuffer[0].Set((const byte*)vb0, vertices * sizeof(VB0ElementType));
+            if (_quantization.IsValid())
+                DecodePositions(_quantization, (const VB0QuantizedElementType*)vb0, vertices, _cachedVertexBuffer[0]);
+            else
+                _cachedVertexBuffer[0].Set(vb0, vertices * sizeof(VB0ElementType));
             _cachedVertexBuffer[1].Set((const byte*)vb1, vertices * sizeof(VB1ElementType));
             if (hasColors)
                 _cachedVertexBuffer[2].Set((const byte*)vb2, vertices * sizeof(VB2ElementType));
@@ -776,6 +902,13 @@ MArray* Mesh::DownloadBuffer(bool forceGpu, MTypeObject* resultType, int32 typeI
             return nullptr;
         }
         model->Locker.Lock();
+        if (bufferType == MeshBufferType::Vertex0 && _quantization.IsValid())
+        {
+            // Decode positions
+            Array<byte> positions;
+            DecodePositions(_quantization, (const VB0QuantizedElementType*)data.Get(), data.Length() / sizeof(VB0QuantizedElementType), positions);
+            data.Copy(positions);
+        }
 
         // Extract elements count from result data
         switch (bufferType)
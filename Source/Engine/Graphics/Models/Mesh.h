@@ -22,6 +22,9 @@ API_CLASS(NoSpawn) class FLAXENGINE_API Mesh : public MeshBase
     bool _hasLightmapUVs;
     GPUBuffer* _vertexBuffers[3] = {};
     GPUBuffer* _indexBuffer = nullptr;
+    GPUBuffer* _meshletsBuffer = nullptr;
+    Array<Meshlet> _meshlets;
+    PositionsQuantization _quantization;
 #if USE_PRECISE_MESH_INTERSECTS
     CollisionProxy _collisionProxy;
 #endif
@@ -70,6 +73,57 @@ API_CLASS(NoSpawn) class FLAXENGINE_API Mesh : public MeshBase
         return _vertexBuffers[index];
     }
 
+    /// <summary>
+    /// Gets the triangle clusters buffer (structured buffer with Meshlet elements). Null if mesh has no clusters generated.
+    /// </summary>
+    FORCE_INLINE GPUBuffer* GetMeshletsBuffer() const
+    {
+        return _meshletsBuffer;
+    }
+
+    /// <summary>
+    /// Gets the triangle clusters of the mesh (index buffer triangles are sorted by clusters).
+    /// </summary>
+    FORCE_INLINE const Array<Meshlet>& GetMeshlets() const
+    {
+        return _meshlets;
+    }
+
+    /// <summary>
+    /// Sets the triangle clusters of the mesh. Used before loading mesh data (GPU buffer is created by Load).
+    /// </summary>
+    /// <param name="meshlets">The clusters.</param>
+    /// <param name="count">The clusters count.</param>
+    void SetMeshlets(const Meshlet* meshlets, int32 count)
+    {
+        _meshlets.Set(meshlets, count);
+    }
+
+    /// <summary>
+    /// Gets the vertex positions quantization. If valid, then the first vertex buffer uses VB0QuantizedElementType layout.
+    /// </summary>
+    FORCE_INLINE const PositionsQuantization& GetPositionsQuantization() const
+    {
+        return _quantization;
+    }
+
+    /// <summary>
+    /// Sets the vertex positions quantization. Used before loading mesh data (defines the first vertex buffer layout).
+    /// </summary>
+    /// <param name="quantization">The quantization.</param>
+    void SetPositionsQuantization(const PositionsQuantization& quantization)
+    {
+        _quantization = quantization;
+    }
+
+    /// <summary>
+    /// Gets the size (in bytes) of the single element in the first vertex buffer (positions).
+    /// </summary>
+    FORCE_INLINE uint32 GetVB0Stride() const
+    {
+        return _quantization.IsValid() ? sizeof(VB0QuantizedElementType) : sizeof(VB0ElementType);
+    }
+
     /// <summary>
     /// Determines whether this mesh is initialized (has vertex and index buffers initialized).
     /// </summary>
@@ -274,7 +328,8 @@ API_CLASS(NoSpawn) class FLAXENGINE_API Mesh : public MeshBase
     /// Draws the mesh. Binds vertex and index buffers and invokes the draw call.
     /// </summary>
     /// <param name="context">The GPU context.</param>
-    void Render(GPUContext* context) const;
+    /// <param name="instanceCount">The amount of instances to draw.</param>
+    void Render(GPUContext* context, int32 instanceCount = 1) const;
 
     /// <summary>
     /// Draws the mesh.
@@ -11,6 +11,7 @@
 #include "Engine/Scripting/ScriptingObject.h"
 
 struct GeometryDrawStateData;
+struct MeshDrawCache;
 struct RenderContext;
 struct RenderContextBatch;
 class Task;
@@ -241,5 +242,15 @@ API_CLASS(Abstract, NoSpawn) class FLAXENGINE_API MeshBase : public ScriptingObj
         /// The object sorting key.
         /// </summary>
         int16 SortOrder;
+
+        /// <summary>
+        /// The retained draw calls cache (optional, for static instances). Used only when drawing with the render context batch.
+        /// </summary>
+        MeshDrawCache* DrawCache = nullptr;
+
+        /// <summary>
+        /// The per-context draw mask (optional, array length equal to the render contexts count). Used only when drawing with the render context batch to skip contexts that draw other geometry (eg. shadow projections with a different LOD).
+        /// </summary>
+        const bool* ContextsMask = nullptr;
     };
 };
@@ -2,6 +2,10 @@
 
 #include "MeshDeformation.h"
 #include "Engine/Graphics/Models/MeshBase.h"
+#include "Engine/Graphics/Models/Types.h"
+#include "Engine/Graphics/GPUContext.h"
+#include "Engine/Graphics/GPUDevice.h"
+#include "Engine/Graphics/RenderTask.h"
 #include "Engine/Profiler/ProfilerCPU.h"
 
 struct Key
@@ -96,13 +100,67 @@ void MeshDeformation::RemoveDeformer(int32 lodIndex, int32 meshIndex, MeshBuffer
     Dirty(lodIndex, meshIndex, type);
 }
 
+void MeshDeformation::AddDeformerGPU(int32 lodIndex, int32 meshIndex, MeshBufferType type, const Function<void(const MeshBase* mesh, MeshDeformationData& deformation, GPUContext* context)>& deformer)
+{
+    const auto key = GetKey(lodIndex, meshIndex, type);
+    _deformersGPU[key].Bind(deformer);
+    Dirty(lodIndex, meshIndex, type);
+}
+
+void MeshDeformation::RemoveDeformerGPU(int32 lodIndex, int32 meshIndex, MeshBufferType type, const Function<void(const MeshBase* mesh, MeshDeformationData& deformation, GPUContext* context)>& deformer)
+{
+    const auto key = GetKey(lodIndex, meshIndex, type);
+    _deformersGPU[key].Unbind(deformer);
+    Dirty(lodIndex, meshIndex, type);
+}
+
+bool MeshDeformation::RunDeformersGPU(const MeshBase* mesh, MeshDeformationData* deformation, const Delegate<const MeshBase*, MeshDeformationData&, GPUContext*>& deformers, GPUBuffer* vertexBuffer)
+{
+    if (deformation->Dirty)
+    {
+        RenderContext::GPULocker.Lock();
+        auto context = GPUDevice::Instance->GetMainContext();
+
+        // Prepare the GPU vertex buffer (writable by compute shaders via raw view)
+        if (!deformation->GPUVertexBuffer)
+            deformation->GPUVertexBuffer = GPUDevice::Instance->CreateBuffer(TEXT("MeshDeformation"));
+        if (deformation->GPUVertexBuffer->GetSize() != vertexBuffer->GetSize())
+        {
+            const auto flags = GPUBufferFlags::VertexBuffer | GPUBufferFlags::RawBuffer | GPUBufferFlags::ShaderResource | GPUBufferFlags::UnorderedAccess;
+            if (deformation->GPUVertexBuffer->Init(GPUBufferDescription::Buffer(vertexBuffer->GetSize(), flags, PixelFormat::R32_Typeless, nullptr, vertexBuffer->GetStride())))
+            {
+                RenderContext::GPULocker.Unlock();
+                return true;
+            }
+        }
+
+        // Reset to the original mesh vertices
+        context->CopyBuffer(deformation->GPUVertexBuffer, vertexBuffer, vertexBuffer->GetSize());
+        deformation->DirtyMinIndex = 0; // CPU data is not initialized so keep it fully dirty in case of switching to the CPU deformers
+        deformation->DirtyMaxIndex = MAX_uint32 - 1;
+        deformation->Dirty = false;
+
+        // Run deformers
+        deformers(mesh, *deformation, context);
+
+        RenderContext::GPULocker.Unlock();
+    }
+    return false;
+}
+
 void MeshDeformation::RunDeformers(const MeshBase* mesh, MeshBufferType type, GPUBuffer*& vertexBuffer)
 {
     const auto key = GetKey(mesh->GetLODIndex(), mesh->GetIndex(), type);
     if (const auto* e = _deformers.TryGet(key))
     {
         PROFILE_CPU();
-        const int32 vertexStride = vertexBuffer->GetStride();
+        const auto* eGPU = _deformersGPU.TryGet(key);
+        int32 vertexStride = vertexBuffer->GetStride();
+
+        // Quantized positions are decoded for deformation (deformed vertex buffer uses full precision)
+        const bool quantized = type == MeshBufferType::Vertex0 && vertexStride == sizeof(VB0QuantizedElementType);
+        if (quantized)
+            vertexStride = sizeof(VB0ElementType);
 
         // Get mesh deformation container
         MeshDeformationData* deformation = nullptr;
@@ -123,16 +181,27 @@ void MeshDeformation::RunDeformers(const MeshBase* mesh, MeshBufferType type, GP
                 Delete(deformation);
             }
             _deformers.Remove(key);
+            _deformersGPU.Remove(key);
             return;
         }
         if (!deformation)
         {
             deformation = New<MeshDeformationData>(key, type, vertexStride);
-            deformation->VertexBuffer.Data.Resize(vertexBuffer->GetSize());
             deformation->Bounds = mesh->GetBox();
             _deformations.Add(deformation);
         }
 
+        // Deform vertices on a GPU if all deformers support it
+        if (eGPU && eGPU->Count() == e->Count() && vertexBuffer->IsAllocated() && !quantized)
+        {
+            if (!RunDeformersGPU(mesh, deformation, *eGPU, vertexBuffer))
+            {
+                // Override vertex buffer for draw call
+                vertexBuffer = deformation->GPUVertexBuffer;
+                return;
+            }
+        }
+
         if (deformation->Dirty)
         {
             // Get original mesh vertex buffer data (cached on CPU)
@@ -7,6 +7,8 @@
 #include "Engine/Graphics/Models/Types.h"
 #include "Engine/Graphics/DynamicBuffer.h"
 
+class GPUContext;
+
 /// <summary>
 /// The mesh deformation data container.
 /// </summary>
@@ -19,6 +21,7 @@ struct MeshDeformationData
     bool Dirty = true;
     BoundingBox Bounds;
     DynamicVertexBuffer VertexBuffer;
+    GPUBuffer* GPUVertexBuffer = nullptr;
 
     MeshDeformationData(uint64 key, MeshBufferType type, uint32 stride)
         : Key(key)
@@ -31,16 +34,19 @@ struct MeshDeformationData
 
     ~MeshDeformationData()
     {
+        SAFE_DELETE_GPU_RESOURCE(GPUVertexBuffer);
     }
 };
 
 /// <summary>
 /// The mesh deformation utility for editing or morphing models dynamically at runtime (eg. via Blend Shapes or Cloth).
+/// Deformers can provide the GPU implementation (eg. compute shader) that writes the vertex buffer directly on a GPU (GPUVertexBuffer initialized with the original mesh vertices). It's used only if all deformers of the mesh buffer support it, otherwise the CPU deformers are used.
 /// </summary>
 class FLAXENGINE_API MeshDeformation
 {
 private:
     Dictionary<uint32, Delegate<const MeshBase*, MeshDeformationData&>> _deformers;
+    Dictionary<uint32, Delegate<const MeshBase*, MeshDeformationData&, GPUContext*>> _deformersGPU;
     Array<MeshDeformationData*> _deformations;
 
 public:
@@ -56,5 +62,10 @@ class FLAXENGINE_API MeshDeformation
     void Dirty(int32 lodIndex, int32 meshIndex, MeshBufferType type, const BoundingBox& bounds);
     void AddDeformer(int32 lodIndex, int32 meshIndex, MeshBufferType type, const Function<void(const MeshBase* mesh, MeshDeformationData& deformation)>& deformer);
     void RemoveDeformer(int32 lodIndex, int32 meshIndex, MeshBufferType type, const Function<void(const MeshBase* mesh, MeshDeformationData& deformation)>& deformer);
+    void AddDeformerGPU(int32 lodIndex, int32 meshIndex, MeshBufferType type, const Function<void(const MeshBase* mesh, MeshDeformationData& deformation, GPUContext* context)>& deformer);
+    void RemoveDeformerGPU(int32 lodIndex, int32 meshIndex, MeshBufferType type, const Function<void(const MeshBase* mesh, MeshDeformationData& deformation, GPUContext* context)>& deformer);
     void RunDeformers(const MeshBase* mesh, MeshBufferType type, GPUBuffer*& vertexBuffer);
+
+private:
+    bool RunDeformersGPU(const MeshBase* mesh, MeshDeformationData* deformation, const Delegate<const MeshBase*, MeshDeformationData&, GPUContext*>& deformers, GPUBuffer* vertexBuffer);
 };
@@ -25,6 +25,8 @@ void MeshData::Clear()
     BlendIndices.Clear();
     BlendWeights.Clear();
     BlendShapes.Clear();
+    Meshlets.Clear();
+    Quantization = {};
 }
 
 void MeshData::EnsureCapacity(int32 vertices, int32 indices, bool preserveContents, bool withColors, bool withSkin)
@@ -53,6 +55,8 @@ void MeshData::SwapBuffers(MeshData& other)
     BlendIndices.Swap(other.BlendIndices);
     BlendWeights.Swap(other.BlendWeights);
     BlendShapes.Swap(other.BlendShapes);
+    Meshlets.Swap(other.Meshlets);
+    Swap(Quantization, other.Quantization);
 }
 
 void MeshData::Release()
@@ -69,6 +73,8 @@ void MeshData::Release()
     BlendIndices.Resize(0);
     BlendWeights.Resize(0);
     BlendShapes.Resize(0);
+    Meshlets.Resize(0);
+    Quantization = {};
 }
 
 void MeshData::InitFromModelVertices(ModelVertex19* vertices, uint32 verticesCount)
@@ -320,7 +326,19 @@ bool MeshData::Pack2Model(WriteStream* stream) const
     stream->WriteUint32(trianglesCount);
 
     // Vertex Buffer 0
-    stream->WriteBytes(Positions.Get(), sizeof(Float3) * verticiecCount);
+    if (Quantization.IsValid())
+    {
+        VB0QuantizedElementType vb0;
+        for (uint32 i = 0; i < verticiecCount; i++)
+        {
+            Quantization.Encode(Positions.Get()[i], vb0);
+            stream->WriteBytes(&vb0, sizeof(vb0));
+        }
+    }
+    else
+    {
+        stream->WriteBytes(Positions.Get(), sizeof(Float3) * verticiecCount);
+    }
 
     // Vertex Buffer 1
     VB1ElementType vb1;
@@ -572,6 +590,10 @@ void MeshData::NormalizeBlendWeights()
 
 void MeshData::Merge(MeshData& other)
 {
+    // Triangle clusters and positions quantization are not valid after merging
+    Meshlets.Clear();
+    Quantization = {};
+
     // Merge index buffer (and remap indices)
     const uint32 vertexIndexOffset = Positions.Count();
     const int32 indicesStart = Indices.Count();
@@ -937,11 +959,13 @@ bool ModelData::Pack2AnimationHeader(WriteStream* stream, int32 animIndex) const
     }
 
     // Info
-    stream->WriteInt32(103); // Header version (for fast version upgrades without serialization format change)
+    stream->WriteInt32(104); // Header version (for fast version upgrades without serialization format change)
     stream->WriteDouble(anim.Duration);
     stream->WriteDouble(anim.FramesPerSecond);
     stream->WriteByte((byte)anim.RootMotionFlags);
     stream->WriteString(anim.RootNodeName, 13);
+    stream->WriteByte(anim.Compress ? 1 : 0);
+    stream->WriteFloat(anim.CompressionTolerance);
 
     // Animation channels
     stream->WriteInt32(anim.Channels.Count());
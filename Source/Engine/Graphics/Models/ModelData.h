@@ -90,6 +90,16 @@ class FLAXENGINE_API MeshData
     /// </summary>
     Array<BlendShape> BlendShapes;
 
+    /// <summary>
+    /// Mesh triangle clusters (optional). If used, then index buffer triangles are sorted by clusters.
+    /// </summary>
+    Array<Meshlet> Meshlets;
+
+    /// <summary>
+    /// Mesh positions quantization (optional). If used, then vertex positions are packed into 16-bit normalized values relative to the mesh bounds.
+    /// </summary>
+    PositionsQuantization Quantization = {};
+
     /// <summary>
     /// Global translation for this mesh to be at it's local origin.
     /// </summary>
@@ -24,7 +24,7 @@ bool ModelLOD::Load(MemoryReadStream& stream)
         uint32 ibStride = use16BitIndexBuffer ? sizeof(uint16) : sizeof(uint32);
         if (vertices == 0 || triangles == 0)
             return true;
-        auto vb0 = stream.Move<VB0ElementType>(vertices);
+        auto vb0 = stream.Move<byte>(vertices * Meshes[i].GetVB0Stride());
         auto vb1 = stream.Move<VB1ElementType>(vertices);
         bool hasColors = stream.ReadBool();
         VB2ElementType18* vb2 = nullptr;
@@ -122,10 +122,11 @@ API_CLASS(NoSpawn) class FLAXENGINE_API ModelLOD : public ScriptingObject
     /// Draws the meshes. Binds vertex and index buffers and invokes the draw calls.
     /// </summary>
     /// <param name="context">The GPU context to draw with.</param>
-    FORCE_INLINE void Render(GPUContext* context)
+    /// <param name="instanceCount">The amount of instances to draw.</param>
+    FORCE_INLINE void Render(GPUContext* context, int32 instanceCount = 1)
     {
         for (int32 i = 0; i < Meshes.Count(); i++)
-            Meshes.Get()[i].Render(context);
+            Meshes.Get()[i].Render(context, instanceCount);
     }
 
     /// <summary>
@@ -3,16 +3,21 @@
 #include "SkinnedMesh.h"
 #include "MeshDeformation.h"
 #include "ModelInstanceEntry.h"
+#include "SkinnedMeshDrawData.h"
 #include "Engine/Content/Assets/Material.h"
 #include "Engine/Content/Assets/SkinnedModel.h"
 #include "Engine/Core/Log.h"
 #include "Engine/Graphics/GPUContext.h"
 #include "Engine/Graphics/GPUDevice.h"
+#include "Engine/Graphics/GPULimits.h"
+#include "Engine/Graphics/Graphics.h"
 #include "Engine/Graphics/RenderTask.h"
 #include "Engine/Graphics/RenderTools.h"
 #include "Engine/Level/Scene/Scene.h"
 #include "Engine/Renderer/RenderList.h"
+#include "Engine/Renderer/Utils/PreSkinning.h"
 #include "Engine/Serialization/MemoryReadStream.h"
+#include "Engine/Streaming/Streaming.h"
 #include "Engine/Profiler/ProfilerCPU.h"
 #include "Engine/Scripting/ManagedCLR/MCore.h"
 #include "Engine/Threading/Task.h"
@@ -103,6 +108,7 @@ SkinnedMesh::~SkinnedMesh()
 {
     SAFE_DELETE_GPU_RESOURCE(_vertexBuffer);
     SAFE_DELETE_GPU_RESOURCE(_indexBuffer);
+    SAFE_DELETE_GPU_RESOURCE(_blendShapesBuffer);
 }
 
 bool SkinnedMesh::Load(uint32 vertices, uint32 triangles, const void* vb0, const void* ib, bool use16BitIndexBuffer)
@@ -120,7 +126,14 @@ bool SkinnedMesh::Load(uint32 vertices, uint32 triangles, const void* vb0, const
 #else
 	vertexBuffer = GPUDevice::Instance->CreateBuffer(String::Empty);
 #endif
-    if (vertexBuffer->Init(GPUBufferDescription::Vertex(sizeof(VB0SkinnedElementType), vertices, vb0)))
+    auto vbDesc = GPUBufferDescription::Vertex(sizeof(VB0SkinnedElementType), vertices, vb0);
+    if (GPUDevice::Instance->Limits.HasCompute)
+    {
+        // Allow to read vertices in a compute shader (see PreSkinning)
+        vbDesc.Flags |= GPUBufferFlags::RawBuffer | GPUBufferFlags::ShaderResource;
+        vbDesc.Format = PixelFormat::R32_Typeless;
+    }
+    if (vertexBuffer->Init(vbDesc))
         goto ERROR_LOAD_END;
 
     // Create index buffer
@@ -133,6 +146,8 @@ bool SkinnedMesh::Load(uint32 vertices, uint32 triangles, const void* vb0, const
         goto ERROR_LOAD_END;
 
     // Initialize
+    vertexBuffer->SetCategory(GPUResourceCategory::Meshes, GetSkinnedModel()->GetID());
+    indexBuffer->SetCategory(GPUResourceCategory::Meshes, GetSkinnedModel()->GetID());
     _vertexBuffer = vertexBuffer;
     _indexBuffer = indexBuffer;
     _triangles = triangles;
@@ -152,6 +167,7 @@ void SkinnedMesh::Unload()
 {
     SAFE_DELETE_GPU_RESOURCE(_vertexBuffer);
     SAFE_DELETE_GPU_RESOURCE(_indexBuffer);
+    SAFE_DELETE_GPU_RESOURCE(_blendShapesBuffer);
     _cachedIndexBuffer.Clear();
     _cachedVertexBuffer.Clear();
     _triangles = 0;
@@ -201,6 +217,34 @@ bool SkinnedMesh::Intersects(const Ray& ray, const Transform& transform, Real& d
     return transformedBox.Intersects(ray, distance, normal);
 }
 
+GPUBuffer* SkinnedMesh::GetBlendShapesBuffer() const
+{
+    if (_blendShapesBuffer || BlendShapes.IsEmpty())
+        return _blendShapesBuffer;
+
+    // Pack vertices of all blend shapes into a single buffer
+    Array<BlendShapeVertex> vertices;
+    for (const BlendShape& blendShape : BlendShapes)
+        vertices.Add(blendShape.Vertices);
+    if (vertices.IsEmpty())
+        return nullptr;
+#if GPU_ENABLE_RESOURCE_NAMING
+    _blendShapesBuffer = GPUDevice::Instance->CreateBuffer(GetSkinnedModel()->GetPath() + TEXT(".BlendShapes"));
+#else
+    _blendShapesBuffer = GPUDevice::Instance->CreateBuffer(String::Empty);
+#endif
+    if (_blendShapesBuffer->Init(GPUBufferDescription::Raw(vertices.Get(), vertices.Count() * sizeof(BlendShapeVertex), GPUBufferFlags::ShaderResource)))
+    {
+        LOG(Error, "Failed to initialize the blend shapes buffer");
+        SAFE_DELETE_GPU_RESOURCE(_blendShapesBuffer);
+    }
+    else
+    {
+        _blendShapesBuffer->SetCategory(GPUResourceCategory::Meshes, GetSkinnedModel()->GetID());
+    }
+    return _blendShapesBuffer;
+}
+
 void SkinnedMesh::Render(GPUContext* context) const
 {
     ASSERT(IsInitialized());
@@ -210,6 +254,44 @@ void SkinnedMesh::Render(GPUContext* context) const
     context->DrawIndexed(_triangles * 3);
 }
 
+namespace
+{
+    bool SetupPreSkinning(const SkinnedMesh* mesh, GPUBuffer* vertexBuffer, SkinnedMeshDrawData* skinning, const DrawCall& drawCall, DrawCall& result)
+    {
+        // Deformed meshes (eg. blend shapes) use own vertex buffer so skin them in the vertex shader
+        if (!Graphics::PreSkinning || !skinning || drawCall.Geometry.VertexBuffers[0] != vertexBuffer || !PreSkinning::CanPreSkin(vertexBuffer))
+            return false;
+
+        // Materials that offset vertices might use the vertex position before skinning
+        const MaterialInfo& materialInfo = drawCall.Material->GetInfo();
+        if (EnumHasAnyFlags(materialInfo.UsageFlags, MaterialUsageFlags::UsePositionOffset | MaterialUsageFlags::UseDisplacement))
+            return false;
+
+        // Skin vertices with a compute shader (once per bones update) and draw mesh as a static geometry in all passes
+        GPUBuffer* vertexBuffer0 = nullptr;
+        GPUBuffer* vertexBuffer1 = nullptr;
+        RenderContext::GPULocker.Lock();
+        const bool failed = !PreSkinning::Instance()->CanUse() || PreSkinning::Instance()->GetVertexBuffers(GPUDevice::Instance->GetMainContext(), mesh, vertexBuffer, *skinning, vertexBuffer0, vertexBuffer1);
+        RenderContext::GPULocker.Unlock();
+        if (failed)
+            return false;
+        result = drawCall;
+        result.Geometry.VertexBuffers[0] = vertexBuffer0;
+        result.Geometry.VertexBuffers[1] = vertexBuffer1;
+        result.Surface.Skinning = nullptr;
+        return true;
+    }
+
+    DrawPass GetSkinnedDrawModes(const SkinnedMeshDrawData* skinning, DrawPass drawModes)
+    {
+        // Per-bone motion vectors use the previous frame bones so keep skinning in the vertex shader for that pass
+        uint32 prevBonesOffset;
+        if (skinning->GetPrevBoneMatrices(prevBonesOffset))
+            return drawModes & DrawPass::MotionVectors;
+        return DrawPass::None;
+    }
+}
+
 void SkinnedMesh::Draw(const RenderContext& renderContext, const DrawInfo& info, float lodDitherFactor) const
 {
     const auto& entry = info.Buffer->At(_materialSlotIndex);
@@ -233,6 +315,8 @@ void SkinnedMesh::Draw(const RenderContext& renderContext, const DrawInfo& info,
     const auto drawModes = info.DrawModes & renderContext.View.Pass & renderContext.View.GetShadowsDrawPassMask(shadowsMode) & material->GetDrawModes();
     if (drawModes == DrawPass::None)
         return;
+    if (EnumHasAnyFlags(drawModes, DrawPass::GBuffer | DrawPass::Forward))
+        Streaming::ReportMaterialScreenSize(material, renderContext.View, info.Bounds.Center, (float)info.Bounds.Radius);
 
     // Setup draw call
     DrawCall drawCall;
@@ -257,7 +341,15 @@ void SkinnedMesh::Draw(const RenderContext& renderContext, const DrawInfo& info,
     drawCall.PerInstanceRandom = info.PerInstanceRandom;
 
     // Push draw call to the render list
-    renderContext.List->AddDrawCall(renderContext, drawModes, StaticFlags::None, drawCall, entry.ReceiveDecals, info.SortOrder);
+    DrawPass skinnedDrawModes = drawModes;
+    DrawCall preSkinnedDrawCall;
+    if (SetupPreSkinning(this, _vertexBuffer, info.Skinning, drawCall, preSkinnedDrawCall))
+    {
+        skinnedDrawModes = GetSkinnedDrawModes(info.Skinning, drawModes);
+        renderContext.List->AddDrawCall(renderContext, drawModes & ~skinnedDrawModes, StaticFlags::None, preSkinnedDrawCall, entry.ReceiveDecals, info.SortOrder);
+    }
+    if (skinnedDrawModes != DrawPass::None)
+        renderContext.List->AddDrawCall(renderContext, skinnedDrawModes, StaticFlags::None, drawCall, entry.ReceiveDecals, info.SortOrder);
 }
 
 void SkinnedMesh::Draw(const RenderContextBatch& renderContextBatch, const DrawInfo& info, float lodDitherFactor) const
@@ -303,7 +395,20 @@ void SkinnedMesh::Draw(const RenderContextBatch& renderContextBatch, const DrawI
     const auto shadowsMode = entry.ShadowsMode & slot.ShadowsMode;
     const auto drawModes = info.DrawModes & material->GetDrawModes();
     if (drawModes != DrawPass::None)
-        renderContextBatch.GetMainContext().List->AddDrawCall(renderContextBatch, drawModes, StaticFlags::None, shadowsMode, info.Bounds, drawCall, entry.ReceiveDecals, info.SortOrder);
+    {
+        const RenderContext& mainRenderContext = renderContextBatch.GetMainContext();
+        if (EnumHasAnyFlags(drawModes & mainRenderContext.View.Pass, DrawPass::GBuffer | DrawPass::Forward))
+            Streaming::ReportMaterialScreenSize(material, mainRenderContext.View, info.Bounds.Center, (float)info.Bounds.Radius);
+        DrawPass skinnedDrawModes = drawModes;
+        DrawCall preSkinnedDrawCall;
+        if (SetupPreSkinning(this, _vertexBuffer, info.Skinning, drawCall, preSkinnedDrawCall))
+        {
+            skinnedDrawModes = GetSkinnedDrawModes(info.Skinning, drawModes);
+            mainRenderContext.List->AddDrawCall(renderContextBatch, drawModes & ~skinnedDrawModes, StaticFlags::None, shadowsMode, info.Bounds, preSkinnedDrawCall, entry.ReceiveDecals, info.SortOrder);
+        }
+        if (skinnedDrawModes != DrawPass::None)
+            mainRenderContext.List->AddDrawCall(renderContextBatch, skinnedDrawModes, StaticFlags::None, shadowsMode, info.Bounds, drawCall, entry.ReceiveDecals, info.SortOrder);
+    }
 }
 
 bool SkinnedMesh::DownloadDataGPU(MeshBufferType type, BytesContainer& result) const
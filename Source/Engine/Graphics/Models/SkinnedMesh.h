@@ -18,6 +18,7 @@ API_CLASS(NoSpawn) class FLAXENGINE_API SkinnedMesh : public MeshBase
     mutable Array<byte> _cachedIndexBuffer;
     mutable Array<byte> _cachedVertexBuffer;
     mutable int32 _cachedIndexBufferCount;
+    mutable GPUBuffer* _blendShapesBuffer = nullptr;
 
 public:
     SkinnedMesh(const SkinnedMesh& other)
@@ -155,6 +156,12 @@ API_CLASS(NoSpawn) class FLAXENGINE_API SkinnedMesh : public MeshBase
     /// <returns>True whether the two objects intersected</returns>
     bool Intersects(const Ray& ray, const Transform& transform, Real& distance, Vector3& normal) const;
 
+    /// <summary>
+    /// Gets the GPU buffer with the vertices of all blend shapes of the mesh (BlendShapeVertex elements of the BlendShapes stored one after another). Created on the first use. Used to deform the mesh with the blend shapes on a GPU.
+    /// </summary>
+    /// <returns>The raw buffer or null if mesh has no blend shapes.</returns>
+    GPUBuffer* GetBlendShapesBuffer() const;
+
 public:
     /// <summary>
     /// Draws the mesh. Binds vertex and index buffers and invokes the draw call.
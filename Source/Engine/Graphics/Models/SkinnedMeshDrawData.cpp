@@ -1,6 +1,7 @@
 // Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
 
 #include "SkinnedMeshDrawData.h"
+#include "BonesPalette.h"
 #include "Engine/Graphics/GPUDevice.h"
 #include "Engine/Animations/Config.h"
 #include "Engine/Core/Log.h"
@@ -15,6 +16,7 @@ SkinnedMeshDrawData::~SkinnedMeshDrawData()
 {
     SAFE_DELETE_GPU_RESOURCE(BoneMatrices);
     SAFE_DELETE_GPU_RESOURCE(PrevBoneMatrices);
+    ReleasePreSkinnedMeshes();
 }
 
 void SkinnedMeshDrawData::Setup(int32 bonesCount)
@@ -34,8 +36,10 @@ void SkinnedMeshDrawData::Setup(int32 bonesCount)
     BonesCount = bonesCount;
     _hasValidData = false;
     _isDirty = false;
+    _dropPaletteHistory = true;
     Data.Resize(BoneMatrices->GetSize());
     SAFE_DELETE_GPU_RESOURCE(PrevBoneMatrices);
+    ReleasePreSkinnedMeshes();
 }
 
 void SkinnedMeshDrawData::SetData(const Matrix* bones, bool dropHistory)
@@ -63,8 +67,11 @@ void SkinnedMeshDrawData::SetData(const Matrix* bones, bool dropHistory)
 
 void SkinnedMeshDrawData::OnDataChanged(bool dropHistory)
 {
+    // Bones palette keeps the previous frame bones on its own
+    _dropPaletteHistory |= dropHistory || !_hasValidData;
+
     // Setup previous frame bone matrices if needed
-    if (_hasValidData && !dropHistory)
+    if (_hasValidData && !dropHistory && !BonesPalette::IsEnabled())
     {
         ASSERT(BoneMatrices);
         if (PrevBoneMatrices == nullptr)
@@ -84,4 +91,37 @@ void SkinnedMeshDrawData::OnDataChanged(bool dropHistory)
 
     _isDirty = true;
     _hasValidData = true;
+    Version++;
+}
+
+GPUBuffer* SkinnedMeshDrawData::GetBoneMatrices(uint32& offset) const
+{
+    if (PaletteFrame != 0 && PaletteFrame == BonesPalette::GetFrame() && BonesPalette::GetBuffer())
+    {
+        offset = PaletteOffset;
+        return BonesPalette::GetBuffer();
+    }
+    offset = 0;
+    return BoneMatrices;
+}
+
+GPUBuffer* SkinnedMeshDrawData::GetPrevBoneMatrices(uint32& offset) const
+{
+    if (PaletteFrame != 0 && PaletteFrame == BonesPalette::GetFrame() && BonesPalette::GetBuffer())
+    {
+        offset = PrevPaletteOffset;
+        return PrevPaletteOffset >= 0 && BonesPalette::GetPrevBuffer() && BonesPalette::GetPrevBuffer()->IsAllocated() ? BonesPalette::GetPrevBuffer() : nullptr;
+    }
+    offset = 0;
+    return PrevBoneMatrices && PrevBoneMatrices->IsAllocated() ? PrevBoneMatrices : nullptr;
+}
+
+void SkinnedMeshDrawData::ReleasePreSkinnedMeshes()
+{
+    for (auto& e : PreSkinnedMeshes)
+    {
+        SAFE_DELETE_GPU_RESOURCE(e.VertexBuffer0);
+        SAFE_DELETE_GPU_RESOURCE(e.VertexBuffer1);
+    }
+    PreSkinnedMeshes.Clear();
 }
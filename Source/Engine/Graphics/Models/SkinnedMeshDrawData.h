@@ -10,9 +10,11 @@
 /// </summary>
 class FLAXENGINE_API SkinnedMeshDrawData
 {
+    friend class BonesPalette;
 private:
     bool _hasValidData = false;
     bool _isDirty = false;
+    bool _dropPaletteHistory = true;
 
 public:
     /// <summary>
@@ -35,6 +37,46 @@ class FLAXENGINE_API SkinnedMeshDrawData
     /// </summary>
     Array<byte> Data;
 
+    /// <summary>
+    /// The bones data version (incremented on every bones update). Used to skip redundant pre-skinning of the meshes.
+    /// </summary>
+    uint32 Version = 0;
+
+    /// <summary>
+    /// The offset (in float4 elements) of the bones in the global bones palette buffer (see BonesPalette). Valid only if PaletteFrame matches the current palette frame.
+    /// </summary>
+    int32 PaletteOffset = -1;
+
+    /// <summary>
+    /// The offset (in float4 elements) of the bones in the previous frame bones palette buffer, or -1 if not available.
+    /// </summary>
+    int32 PrevPaletteOffset = -1;
+
+    /// <summary>
+    /// The index of the frame when the bones have been written into the global bones palette.
+    /// </summary>
+    uint64 PaletteFrame = 0;
+
+    /// <summary>
+    /// The mesh vertices skinned by the compute shader (see PreSkinning) cached for the static geometry rendering.
+    /// </summary>
+    struct PreSkinnedMesh
+    {
+        // The mesh key (LOD index and mesh index).
+        uint64 Key;
+        // The bones data version used to skin the vertices.
+        uint32 Version;
+        // The vertex buffer with the skinned positions (layout of VB0ElementType).
+        GPUBuffer* VertexBuffer0;
+        // The vertex buffer with the skinned attributes (layout of VB1ElementType).
+        GPUBuffer* VertexBuffer1;
+    };
+
+    /// <summary>
+    /// The cached pre-skinned meshes.
+    /// </summary>
+    Array<PreSkinnedMesh> PreSkinnedMeshes;
+
 public:
     /// <summary>
     /// Initializes a new instance of the <see cref="SkinnedMeshDrawData"/> class.
@@ -63,6 +105,20 @@ class FLAXENGINE_API SkinnedMeshDrawData
         return _isDirty;
     }
 
+    /// <summary>
+    /// Gets the buffer with the bone matrices to use for drawing (global bones palette if bones have been written into it in this frame, otherwise the BoneMatrices buffer).
+    /// </summary>
+    /// <param name="offset">The result offset (in float4 elements) of the bones in the buffer.</param>
+    /// <returns>The bone matrices buffer.</returns>
+    GPUBuffer* GetBoneMatrices(uint32& offset) const;
+
+    /// <summary>
+    /// Gets the buffer with the bone matrices from the previous update (used by per-bone motion blur).
+    /// </summary>
+    /// <param name="offset">The result offset (in float4 elements) of the bones in the buffer.</param>
+    /// <returns>The previous bone matrices buffer or null if not available.</returns>
+    GPUBuffer* GetPrevBoneMatrices(uint32& offset) const;
+
     /// <summary>
     /// Setups the data container for the specified bones amount.
     /// </summary>
@@ -82,6 +138,11 @@ class FLAXENGINE_API SkinnedMeshDrawData
     /// <param name="dropHistory">True if drop previous update bones used for motion blur, otherwise will keep them and do the update.</param>
     void OnDataChanged(bool dropHistory);
 
+    /// <summary>
+    /// Releases the cached pre-skinned meshes.
+    /// </summary>
+    void ReleasePreSkinnedMeshes();
+
     /// <summary>
     /// After bones Data has been send to the GPU buffer.
     /// </summary>
@@ -144,6 +144,12 @@ PACK_STRUCT(struct VB2ElementType18
 typedef VB0ElementType18 VB0ElementType;
 typedef VB1ElementType18 VB1ElementType;
 typedef VB2ElementType18 VB2ElementType;
+
+// Vertex buffer 0 with the quantized positions (16-bit normalized values within the mesh bounds, see PositionsQuantization). The last component is unused (padding).
+PACK_STRUCT(struct VB0QuantizedElementType
+    {
+    uint16 Position[4];
+    });
 //
 
 // Vertex structure for all skinned models (versioned)
@@ -193,3 +199,76 @@ PACK_STRUCT(struct VB0SkinnedElementType2
 
 typedef VB0SkinnedElementType2 VB0SkinnedElementType;
 //
+
+/// <summary>
+/// The cluster of the mesh triangles (meshlet) used for GPU culling of the parts of high-poly meshes. Matches the shader type.
+/// </summary>
+struct Meshlet
+{
+    // The cluster bounding sphere center (in mesh local-space).
+    Float3 Center;
+    // The cluster bounding sphere radius.
+    float Radius;
+    // The cluster triangles normal cone axis (in mesh local-space).
+    Float3 ConeAxis;
+    // The cluster triangles normal cone cutoff (cosine of the cone angle). Value 1 disables backface culling of the cluster.
+    float ConeCutoff;
+    // The location of the first cluster triangle index in the mesh index buffer.
+    uint32 StartIndex;
+    // The amount of the cluster triangle indices.
+    uint32 IndicesCount;
+};
+
+/// <summary>
+/// The quantization of the mesh vertex positions into the 16-bit normalized values relative to the mesh bounds (see VB0QuantizedElementType). Decoded by the material vertex shader.
+/// </summary>
+struct PositionsQuantization
+{
+    // The quantization range start (mesh bounds minimum in mesh local-space).
+    Float3 Offset;
+    // The quantization range size (mesh bounds size in mesh local-space). Zero if positions are not quantized.
+    Float3 Scale;
+
+    /// <summary>
+    /// Returns true if the positions are quantized.
+    /// </summary>
+    FORCE_INLINE bool IsValid() const
+    {
+        return !Scale.IsZero();
+    }
+
+    /// <summary>
+    /// Initializes the quantization to cover the given bounds.
+    /// </summary>
+    /// <param name="min">The bounds minimum.</param>
+    /// <param name="max">The bounds maximum.</param>
+    void Init(const Float3& min, const Float3& max)
+    {
+        Offset = min;
+        Scale = Float3::Max(max - min, Float3(ZeroTolerance));
+    }
+
+    /// <summary>
+    /// Quantizes the position.
+    /// </summary>
+    /// <param name="position">The position (in mesh local-space).</param>
+    /// <param name="result">The quantized position.</param>
+    void Encode(const Float3& position, VB0QuantizedElementType& result) const
+    {
+        const Float3 normalized = Float3::Clamp((position - Offset) / Scale, Float3::Zero, Float3::One) * (float)MAX_uint16;
+        result.Position[0] = (uint16)Math::RoundToInt(normalized.X);
+        result.Position[1] = (uint16)Math::RoundToInt(normalized.Y);
+        result.Position[2] = (uint16)Math::RoundToInt(normalized.Z);
+        result.Position[3] = 0;
+    }
+
+    /// <summary>
+    /// Decodes the quantized position.
+    /// </summary>
+    /// <param name="value">The quantized position.</param>
+    /// <returns>The position (in mesh local-space).</returns>
+    FORCE_INLINE Float3 Decode(const VB0QuantizedElementType& value) const
+    {
+        return Offset + Float3(value.Position[0], value.Position[1], value.Position[2]) * (Scale / (float)MAX_uint16);
+    }
+};
@@ -13,7 +13,7 @@
 RenderBuffers::RenderBuffers(const SpawnParams& params)
     : ScriptingObject(params)
 {
-#define CREATE_TEXTURE(name) name = GPUDevice::Instance->CreateTexture(TEXT(#name)); _resources.Add(name)
+#define CREATE_TEXTURE(name) name = GPUDevice::Instance->CreateTexture(TEXT(#name)); name->SetCategory(GPUResourceCategory::RenderBuffers); _resources.Add(name)
     CREATE_TEXTURE(DepthBuffer);
     CREATE_TEXTURE(MotionVectors);
     CREATE_TEXTURE(GBuffer0);
@@ -6,17 +6,109 @@
 #include "Engine/Engine/Engine.h"
 #include "Engine/Profiler/ProfilerCPU.h"
 
+#define RENDER_TARGET_POOL_HEAP_SIZE (64 * 1024 * 1024) // Size of the transient memory heap (bigger render targets get a dedicated heap)
+
 struct Entry
 {
     GPUTexture* RT;
     uint64 LastFrameReleased;
     uint32 DescriptionHash;
     bool IsOccupied;
+    // The transient memory heap in which render target is placed (aliased with other render targets) or null if it owns memory.
+    GPUResource* Heap;
+    uint64 MemoryOffset;
+    uint64 MemorySize;
+};
+
+struct Heap
+{
+    GPUResource* Resource;
+    uint64 Size;
 };
 
 namespace
 {
     Array<Entry> TemporaryRTs;
+    Array<Heap> TransientHeaps;
+
+    bool CanAlias(const GPUTextureDescription& desc)
+    {
+        // Alias only render targets and depth buffers (some hardware cannot place them in the same heap as the other resources)
+        return GPUDevice::Instance->Limits.HasResourceAliasing &&
+                (desc.IsRenderTarget() || desc.IsDepthStencil()) &&
+                !desc.IsMultiSample() &&
+                desc.Usage == GPUResourceUsage::Default;
+    }
+
+    bool IsMemoryFree(GPUResource* heap, uint64 offset, uint64 size)
+    {
+        // Render targets released in the current frame can share memory with the ones allocated later because GPU executes commands in order
+        for (const Entry& e : TemporaryRTs)
+        {
+            if (e.IsOccupied && e.Heap == heap && offset < e.MemoryOffset + e.MemorySize && e.MemoryOffset < offset + size)
+                return false;
+        }
+        return true;
+    }
+
+    bool FindFreeMemory(const Heap& heap, uint64 size, uint64 alignment, uint64& offset)
+    {
+        // First-fit search between the occupied memory ranges
+        offset = 0;
+        bool moved = true;
+        while (moved && offset + size <= heap.Size)
+        {
+            moved = false;
+            for (const Entry& e : TemporaryRTs)
+            {
+                if (e.IsOccupied && e.Heap == heap.Resource && offset < e.MemoryOffset + e.MemorySize && e.MemoryOffset < offset + size)
+                {
+                    offset = Math::AlignUp<uint64>(e.MemoryOffset + e.MemorySize, alignment);
+                    moved = true;
+                }
+            }
+        }
+        return offset + size <= heap.Size;
+    }
+
+    GPUTexture* CreateTransient(const GPUTextureDescription& desc, const String& name, Entry& entry)
+    {
+        uint64 size, alignment;
+        if (GPUDevice::Instance->GetTransientTextureMemory(desc, size, alignment))
+            return nullptr;
+
+        // Place render target within the existing heap or create a new one
+        uint64 offset = 0;
+        const Heap* heap = nullptr;
+        for (const Heap& e : TransientHeaps)
+        {
+            if (FindFreeMemory(e, size, alignment, offset))
+            {
+                heap = &e;
+                break;
+            }
+        }
+        if (!heap)
+        {
+            Heap newHeap;
+            newHeap.Size = Math::Max<uint64>(size, RENDER_TARGET_POOL_HEAP_SIZE);
+            newHeap.Resource = GPUDevice::Instance->CreateTransientHeap(newHeap.Size, TEXT("RenderTargetPool.Heap"));
+            if (!newHeap.Resource)
+                return nullptr;
+            TransientHeaps.Add(newHeap);
+            heap = &TransientHeaps.Last();
+            offset = 0;
+        }
+
+        GPUTexture* rt = GPUDevice::Instance->CreateTransientTexture(heap->Resource, offset, desc, name);
+        if (rt)
+        {
+            entry.Heap = heap->Resource;
+            entry.MemoryOffset = offset;
+            entry.MemorySize = size;
+        }
+        return rt;
+    }
 }
 
 void RenderTargetPool::Flush(bool force, int32 framesOffset)
@@ -39,6 +131,20 @@ void RenderTargetPool::Flush(bool force, int32 framesOffset)
                 break;
         }
     }
+
+    // Release transient heaps without any render targets placed in them
+    for (int32 i = 0; i < TransientHeaps.Count(); i++)
+    {
+        GPUResource* heap = TransientHeaps[i].Resource;
+        bool used = false;
+        for (const Entry& e : TemporaryRTs)
+            used |= e.Heap == heap;
+        if (!used)
+        {
+            heap->DeleteObjectNow();
+            TransientHeaps.RemoveAt(i--);
+        }
+    }
 }
 
 GPUTexture* RenderTargetPool::Get(const GPUTextureDescription& desc)
@@ -50,10 +156,12 @@ GPUTexture* RenderTargetPool::Get(const GPUTextureDescription& desc)
     for (int32 i = 0; i < TemporaryRTs.Count(); i++)
     {
         auto& e = TemporaryRTs[i];
-        if (!e.IsOccupied && e.DescriptionHash == descHash)
+        if (!e.IsOccupied && e.DescriptionHash == descHash && (!e.Heap || IsMemoryFree(e.Heap, e.MemoryOffset, e.MemorySize)))
         {
             // Mark as used
             e.IsOccupied = true;
+            if (e.Heap)
+                GPUDevice::Instance->ActivateTransientTexture(e.RT);
             return e.RT;
         }
     }
@@ -65,18 +173,30 @@ GPUTexture* RenderTargetPool::Get(const GPUTextureDescription& desc)
     }
 #endif
 
-    // Create new rt
+    // Create new rt (placed in the transient memory shared with other render targets if possible)
+    Entry e;
+    e.Heap = nullptr;
+    e.MemoryOffset = e.MemorySize = 0;
     const String name = TEXT("TemporaryRT_") + StringUtils::ToString(TemporaryRTs.Count());
-    GPUTexture* rt = GPUDevice::Instance->CreateTexture(name);
-    if (rt->Init(desc))
+    GPUTexture* rt = CanAlias(desc) ? CreateTransient(desc, name, e) : nullptr;
+    if (rt)
     {
-        Delete(rt);
-        LOG(Error, "Cannot create temporary render target. Description: {0}", desc.ToString());
-        return nullptr;
+        GPUDevice::Instance->ActivateTransientTexture(rt);
+    }
+    else
+    {
+        rt = GPUDevice::Instance->CreateTexture(name);
+        if (rt->Init(desc))
+        {
+            Delete(rt);
+            LOG(Error, "Cannot create temporary render target. Description: {0}", desc.ToString());
+            return nullptr;
+        }
     }
 
+    rt->SetCategory(GPUResourceCategory::RenderTargetPool);
+
     // Create temporary rt entry
-    Entry e;
     e.IsOccupied = true;
     e.LastFrameReleased = 0;
     e.RT = rt;
@@ -4,6 +4,7 @@
 #include "RenderBuffers.h"
 #include "GPUDevice.h"
 #include "GPUSwapChain.h"
+#include "GPUTimerQuery.h"
 #include "PostProcessEffect.h"
 #include "Engine/Core/Collections/Sorting.h"
 #include "Engine/Debug/DebugLog.h"
@@ -150,6 +151,7 @@ SceneRenderTask::~SceneRenderTask()
 {
     if (Buffers)
         Buffers->DeleteObjectNow();
+    SAFE_DELETE_GPU_RESOURCES(_dynamicResolutionTimers);
     if (_customActorsScene)
         Delete(_customActorsScene);
 }
@@ -386,7 +388,50 @@ void SceneRenderTask::OnBegin(GPUContext* context)
 void SceneRenderTask::OnRender(GPUContext* context)
 {
     if (!IsCustomRendering && Buffers && Buffers->GetWidth() > 0)
-        Renderer::Render(this);
+    {
+        if (DynamicResolution)
+        {
+            // Collect the scene rendering GPU time from the previous frames (queries are resolved with a latency)
+            const int32 timersCount = ARRAY_COUNT(_dynamicResolutionTimers);
+            GPUTimerQuery*& timer = _dynamicResolutionTimers[_dynamicResolutionFrame++ % timersCount];
+            if (timer && timer->HasResult())
+            {
+                _dynamicResolutionTime += timer->GetResult();
+                _dynamicResolutionSamples++;
+            }
+            else if (!timer)
+            {
+                timer = GPUDevice::Instance->CreateTimerQuery();
+            }
+
+            timer->Begin();
+            Renderer::Render(this);
+            timer->End();
+
+            // Adjust the rendering resolution every few frames (rendering cost is proportional to the pixels count, thus use the square root of the time ratio)
+            if (_dynamicResolutionSamples >= 8)
+            {
+                const float time = _dynamicResolutionTime / (float)_dynamicResolutionSamples;
+                _dynamicResolutionTime = 0.0f;
+                _dynamicResolutionSamples = 0;
+                const float target = Math::Max(DynamicResolutionTargetTime, 0.1f);
+                if (time > 0.0f && Math::Abs(time - target) > target * 0.05f)
+                {
+                    // Limit the change per step and round it to reduce the render buffers reallocations
+                    const float scale = Math::Clamp(Math::Sqrt(target / time), 0.8f, 1.1f);
+                    const float minPercentage = Math::Clamp(DynamicResolutionMinPercentage, 0.1f, 1.0f);
+                    const float maxPercentage = Math::Clamp(DynamicResolutionMaxPercentage, minPercentage, 1.0f);
+                    RenderingPercentage = Math::Clamp(Math::Round(RenderingPercentage * scale * 40.0f) / 40.0f, minPercentage, maxPercentage);
+                }
+            }
+        }
+        else
+        {
+            _dynamicResolutionSamples = 0;
+            _dynamicResolutionTime = 0.0f;
+            Renderer::Render(this);
+        }
+    }
 
     RenderTask::OnRender(context);
 }
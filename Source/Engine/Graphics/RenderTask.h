@@ -15,6 +15,7 @@ class GPUDevice;
 class GPUContext;
 class GPUTexture;
 class GPUTextureView;
+class GPUTimerQuery;
 class GPUSwapChain;
 class RenderBuffers;
 class PostProcessEffect;
@@ -213,6 +214,10 @@ API_CLASS() class FLAXENGINE_API SceneRenderTask : public RenderTask
     DECLARE_SCRIPTING_TYPE(SceneRenderTask);
 protected:
     class SceneRendering* _customActorsScene = nullptr;
+    GPUTimerQuery* _dynamicResolutionTimers[3] = {};
+    int32 _dynamicResolutionFrame = 0;
+    int32 _dynamicResolutionSamples = 0;
+    float _dynamicResolutionTime = 0.0f;
 
 public:
     /// <summary>
@@ -271,6 +276,26 @@ API_CLASS() class FLAXENGINE_API SceneRenderTask : public RenderTask
     /// </summary>
     API_FIELD() RenderingUpscaleLocation UpscaleLocation = RenderingUpscaleLocation::AfterAntiAliasingPass;
 
+    /// <summary>
+    /// True if use dynamic resolution that adjusts the RenderingPercentage every few frames to keep the scene rendering GPU time close to the DynamicResolutionTargetTime.
+    /// </summary>
+    API_FIELD() bool DynamicResolution = false;
+
+    /// <summary>
+    /// The target GPU time of the scene rendering (in milliseconds) used by the dynamic resolution. For example, 16.6 for 60 FPS, but it's recommended to leave some headroom for the rest of the frame (eg. UI).
+    /// </summary>
+    API_FIELD(Attributes="Limit(0.1f, 1000.0f)") float DynamicResolutionTargetTime = 14.0f;
+
+    /// <summary>
+    /// The minimum rendering percentage used by the dynamic resolution.
+    /// </summary>
+    API_FIELD(Attributes="Limit(0.1f, 1.0f)") float DynamicResolutionMinPercentage = 0.5f;
+
+    /// <summary>
+    /// The maximum rendering percentage used by the dynamic resolution.
+    /// </summary>
+    API_FIELD(Attributes="Limit(0.1f, 1.0f)") float DynamicResolutionMaxPercentage = 1.0f;
+
 public:
     /// <summary>
     /// The custom set of actors to render. Used when ActorsSources::CustomActors flag is active.
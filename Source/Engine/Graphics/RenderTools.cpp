@@ -426,6 +426,12 @@ int32 RenderTools::ComputeModelLOD(const Model* model, const Float3& origin, flo
     if (model->LODs.Count() <= 1)
         return 0;
 
+    // Report the screen size to the models streaming (can be slightly off when racing with other threads but it's fine for the streaming)
+    auto& streaming = const_cast<Model*>(model)->Streaming;
+    const float screenSize = 2.0f * Math::Sqrt(screenRadiusSquared);
+    if (streaming.ScreenSize < screenSize)
+        streaming.ScreenSize = screenSize;
+
     // Iterate backwards and return the first matching LOD
     for (int32 lodIndex = model->LODs.Count() - 1; lodIndex >= 0; lodIndex--)
     {
@@ -451,6 +457,12 @@ int32 RenderTools::ComputeSkinnedModelLOD(const SkinnedModel* model, const Float
     if (model->LODs.Count() <= 1)
         return 0;
 
+    // Report the screen size to the models streaming (can be slightly off when racing with other threads but it's fine for the streaming)
+    auto& streaming = const_cast<SkinnedModel*>(model)->Streaming;
+    const float screenSize = 2.0f * Math::Sqrt(screenRadiusSquared);
+    if (streaming.ScreenSize < screenSize)
+        streaming.ScreenSize = screenSize;
+
     // Iterate backwards and return the first matching LOD
     for (int32 lodIndex = model->LODs.Count() - 1; lodIndex >= 0; lodIndex--)
     {
@@ -120,6 +120,13 @@ bool GPUShader::Create(MemoryReadStream& stream)
             // Read bindings
             stream.ReadBytes(&initializer.Bindings, sizeof(ShaderBindings));
 
+            // Skip permutations stripped by the game cooker (empty cache without custom data)
+            if (cacheSize == 0)
+            {
+                _strippedShaders.Add(GPUShaderProgramsContainer::CalculateHash(initializer.Name, permutationIndex));
+                continue;
+            }
+
             // Create shader program
             if (type == ShaderStage::Compute && !hasCompute)
             {
@@ -186,6 +193,8 @@ bool GPUShader::Create(MemoryReadStream& stream)
 GPUShaderProgram* GPUShader::GetShader(ShaderStage stage, const StringAnsiView& name, int32 permutationIndex) const
 {
     const auto shader = _shaders.Get(name, permutationIndex);
+    if (shader == nullptr && IsStripped(name, permutationIndex))
+        return nullptr;
 
 #if BUILD_RELEASE
 
@@ -225,4 +234,5 @@ void GPUShader::OnReleaseGPU()
     }
     _memoryUsage = 0;
     _shaders.Clear();
+    _strippedShaders.Clear();
 }
@@ -5,6 +5,7 @@
 #include "GPUShaderProgram.h"
 #include "Engine/Graphics/GPUResource.h"
 #include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Core/Collections/HashSet.h"
 
 class GPUConstantBuffer;
 class GPUShaderProgram;
@@ -72,6 +73,7 @@ API_CLASS(Sealed, NoSpawn) class FLAXENGINE_API GPUShader : public GPUResource
     DECLARE_SCRIPTING_TYPE_NO_SPAWN(GPUShader);
 protected:
     GPUShaderProgramsContainer _shaders;
+    HashSet<uint32> _strippedShaders;
     GPUConstantBuffer* _constantBuffers[MAX_CONSTANT_BUFFER_SLOTS];
 
     GPUShader();
@@ -185,6 +187,17 @@ API_CLASS(Sealed, NoSpawn) class FLAXENGINE_API GPUShader : public GPUResource
         return _shaders.Get(name, permutationIndex) != nullptr;
     }
 
+    /// <summary>
+    /// Determines whether the specified shader program permutation has been stripped from the shader during game cooking (never used by the game so it was not compiled).
+    /// </summary>
+    /// <param name="name">The shader program name.</param>
+    /// <param name="permutationIndex">The shader permutation index.</param>
+    /// <returns><c>true</c> if the shader permutation is stripped; otherwise, <c>false</c>.</returns>
+    FORCE_INLINE bool IsStripped(const StringAnsiView& name, int32 permutationIndex = 0) const
+    {
+        return _strippedShaders.Contains(GPUShaderProgramsContainer::CalculateHash(name, permutationIndex));
+    }
+
 protected:
     GPUShaderProgram* GetShader(ShaderStage stage, const StringAnsiView& name, int32 permutationIndex) const;
     virtual GPUShaderProgram* CreateGPUShaderProgram(ShaderStage type, const GPUShaderProgramInitializer& initializer, byte* cacheBytes, uint32 cacheSize, MemoryReadStream& stream) = 0;
@@ -146,6 +146,16 @@ uint64 StreamingTexture::GetTotalMemoryUsage() const
     return RenderTools::CalculateTextureMemoryUsage(_header.Format, _header.Width, _header.Height, _header.MipLevels) * arraySize;
 }
 
+uint64 StreamingTexture::GetMemoryUsage(int32 mipLevels) const
+{
+    mipLevels = Math::Min(mipLevels, _header.MipLevels);
+    if (mipLevels <= 0)
+        return 0;
+    const int32 mipIndex = _header.MipLevels - mipLevels;
+    const uint64 arraySize = _header.IsCubeMap ? 6 : 1;
+    return RenderTools::CalculateTextureMemoryUsage(_header.Format, Math::Max(_header.Width >> mipIndex, 1), Math::Max(_header.Height >> mipIndex, 1), mipLevels) * arraySize;
+}
+
 String StreamingTexture::ToString() const
 {
     return _texture->ToString();
@@ -277,6 +287,7 @@ Task* StreamingTexture::UpdateAllocation(int32 residency)
 #else
             texture = GPUDevice::Instance->CreateTexture();
 #endif
+            texture->SetCategory(_texture->GetCategory(), _texture->GetOwnerId());
         }
 
         // Create texture description
@@ -156,6 +156,14 @@ class FLAXENGINE_API StreamingTexture : public Object, public StreamableResource
     /// <returns>The amount of bytes.</returns>
     uint64 GetTotalMemoryUsage() const;
 
+    /// <summary>
+    /// Gets the memory usage that texture may have in use when loaded with a given amount of mip levels (the smallest ones).
+    /// Exact value may differ due to memory alignment and resource allocation policy.
+    /// </summary>
+    /// <param name="mipLevels">The amount of resident mip levels.</param>
+    /// <returns>The amount of bytes.</returns>
+    uint64 GetMemoryUsage(int32 mipLevels) const;
+
 public:
     FORCE_INLINE GPUTexture* operator->() const
     {
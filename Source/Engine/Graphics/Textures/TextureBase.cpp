@@ -177,6 +177,7 @@ TextureBase::TextureBase(const SpawnParams& params, const AssetInfo* info)
     , _customData(nullptr)
     , _parent(this)
 {
+    _texture.GetTexture()->SetCategory(GPUResourceCategory::Textures, GetID());
 }
 
 Float2 TextureBase::Size() const
@@ -76,6 +76,14 @@ API_CLASS(Abstract, NoSpawn) class FLAXENGINE_API TextureBase : public BinaryAss
         return &_texture;
     }
 
+    /// <summary>
+    /// Gets the streaming texture object handle.
+    /// </summary>
+    FORCE_INLINE class StreamingTexture* StreamingTexture()
+    {
+        return &_texture;
+    }
+
     /// <summary>
     /// Gets GPU texture object allocated by the asset.
     /// </summary>
@@ -111,6 +111,8 @@ bool GPUBufferDX11::OnInit()
     DX_SET_DEBUG_NAME(_resource, GetName());
     _memoryUsage = _desc.Size;
     int32 numElements = _desc.GetElementsCount();
+    if (EnumHasAnyFlags(_desc.Flags, GPUBufferFlags::RawBuffer))
+        numElements = _desc.Size / sizeof(uint32); // Raw views always address 32-bit elements (eg. vertex buffer with a raw view for compute)
 
     // Create views
     if (useSRV)
@@ -43,6 +43,8 @@ GPUTimerQueryDX11::~GPUTimerQueryDX11()
         _endQuery->Release();
     if (_disjointQuery)
         _disjointQuery->Release();
+    if (_statsQuery)
+        _statsQuery->Release();
 }
 
 void GPUTimerQueryDX11::OnReleaseGPU()
@@ -50,6 +52,8 @@ void GPUTimerQueryDX11::OnReleaseGPU()
     SAFE_RELEASE(_beginQuery);
     SAFE_RELEASE(_endQuery);
     SAFE_RELEASE(_disjointQuery);
+    SAFE_RELEASE(_statsQuery);
+    _statsActive = false;
 }
 
 ID3D11Resource* GPUTimerQueryDX11::GetResource()
@@ -63,6 +67,25 @@ void GPUTimerQueryDX11::Begin()
     context->Begin(_disjointQuery);
     context->End(_beginQuery);
 
+    // Optional pipeline statistics (query is created on demand)
+    _statsActive = false;
+    if (PipelineStatistics)
+    {
+        if (!_statsQuery)
+        {
+            D3D11_QUERY_DESC queryDesc;
+            queryDesc.Query = D3D11_QUERY_PIPELINE_STATISTICS;
+            queryDesc.MiscFlags = 0;
+            if (_device->GetDevice()->CreateQuery(&queryDesc, &_statsQuery) != S_OK)
+                _statsQuery = nullptr;
+        }
+        if (_statsQuery)
+        {
+            context->Begin(_statsQuery);
+            _statsActive = true;
+        }
+    }
+
     _endCalled = false;
 }
 
@@ -72,6 +95,8 @@ void GPUTimerQueryDX11::End()
         return;
 
     auto context = _device->GetIM();
+    if (_statsActive)
+        context->End(_statsQuery);
     context->End(_endQuery);
     context->End(_disjointQuery);
 
@@ -85,7 +110,9 @@ bool GPUTimerQueryDX11::HasResult()
         return false;
 
     D3D11_QUERY_DATA_TIMESTAMP_DISJOINT disjointData;
-    return _device->GetIM()->GetData(_disjointQuery, &disjointData, sizeof(disjointData), 0) == S_OK;
+    if (_device->GetIM()->GetData(_disjointQuery, &disjointData, sizeof(disjointData), 0) != S_OK)
+        return false;
+    return !_statsActive || _device->GetIM()->GetData(_statsQuery, nullptr, 0, 0) == S_OK;
 }
 
 float GPUTimerQueryDX11::GetResult()
@@ -128,4 +155,18 @@ float GPUTimerQueryDX11::GetResult()
     return _timeDelta;
 }
 
+bool GPUTimerQueryDX11::GetPipelineStatistics(GPUPipelineStatistics& result)
+{
+    D3D11_QUERY_DATA_PIPELINE_STATISTICS data;
+    if (!_statsActive || !_endCalled || _device->GetIM()->GetData(_statsQuery, &data, sizeof(data), 0) != S_OK)
+        return true;
+    result.InputVertices = data.IAVertices;
+    result.InputPrimitives = data.IAPrimitives;
+    result.RasterizedPrimitives = data.CPrimitives;
+    result.VSInvocations = data.VSInvocations;
+    result.PSInvocations = data.PSInvocations;
+    result.CSInvocations = data.CSInvocations;
+    return false;
+}
+
 #endif
@@ -21,6 +21,8 @@ class GPUTimerQueryDX11 : public GPUResourceDX11<GPUTimerQuery>
     ID3D11Query* _beginQuery = nullptr;
     ID3D11Query* _endQuery = nullptr;
     ID3D11Query* _disjointQuery = nullptr;
+    ID3D11Query* _statsQuery = nullptr;
+    bool _statsActive = false;
 
 public:
 
@@ -45,6 +47,7 @@ class GPUTimerQueryDX11 : public GPUResourceDX11<GPUTimerQuery>
     void End() override;
     bool HasResult() override;
     float GetResult() override;
+    bool GetPipelineStatistics(GPUPipelineStatistics& result) override;
 
 protected:
 
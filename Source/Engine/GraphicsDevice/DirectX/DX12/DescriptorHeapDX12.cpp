@@ -5,6 +5,7 @@
 #include "DescriptorHeapDX12.h"
 #include "GPUDeviceDX12.h"
 #include "Engine/GraphicsDevice/DirectX/RenderToolsDX.h"
+#include "Engine/Threading/Threading.h"
 
 D3D12_CPU_DESCRIPTOR_HANDLE DescriptorHeapWithSlotsDX12::Slot::CPU() const
 {
@@ -183,6 +184,7 @@ DescriptorHeapRingBufferDX12::DescriptorHeapRingBufferDX12(GPUDeviceDX12* device
     , _heap(nullptr)
     , _type(type)
     , _descriptorsCount(descriptorsCount)
+    , _wrapsCount(0)
     , _shaderVisible(shaderVisible)
 {
 }
@@ -214,6 +216,7 @@ bool DescriptorHeapRingBufferDX12::Init()
 DescriptorHeapRingBufferDX12::Allocation DescriptorHeapRingBufferDX12::AllocateTable(uint32 numDesc)
 {
     Allocation result;
+    ScopeLock lock(_locker);
 
     // Move the ring buffer pointer
     uint32 index = _firstFree;
@@ -225,6 +228,7 @@ DescriptorHeapRingBufferDX12::Allocation DescriptorHeapRingBufferDX12::AllocateT
         // Move to the begin
         index = 0;
         _firstFree = numDesc;
+        _wrapsCount++;
     }
 
     // Set pointers
@@ -238,6 +242,7 @@ void DescriptorHeapRingBufferDX12::OnReleaseGPU()
 {
     DX_SAFE_RELEASE_CHECK(_heap, 0);
     _firstFree = 0;
+    _wrapsCount++;
 }
 
 #endif
@@ -6,6 +6,7 @@
 
 #include "Engine/Core/Collections/Array.h"
 #include "Engine/Graphics/GPUResource.h"
+#include "Engine/Platform/CriticalSection.h"
 #include "../IncludeDirectXHeaders.h"
 
 class DescriptorHeapPoolDX12;
@@ -151,7 +152,9 @@ class DescriptorHeapRingBufferDX12 : public GPUResource
     uint32 _incrementSize;
     uint32 _descriptorsCount;
     uint32 _firstFree;
+    uint32 _wrapsCount;
     bool _shaderVisible;
+    CriticalSection _locker;
 
 public:
 
@@ -164,6 +167,14 @@ class DescriptorHeapRingBufferDX12 : public GPUResource
         return _heap;
     }
 
+    /// <summary>
+    /// Gets the amount of times the ring buffer has wrapped around. Allocations made before the wrap can be overwritten by the new ones.
+    /// </summary>
+    FORCE_INLINE uint32 GetWrapsCount() const
+    {
+        return _wrapsCount;
+    }
+
     bool Init();
     Allocation AllocateTable(uint32 numDesc);
 
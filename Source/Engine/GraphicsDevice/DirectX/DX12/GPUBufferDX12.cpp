@@ -3,6 +3,7 @@
 #if GRAPHICS_API_DIRECTX12
 
 #include "GPUBufferDX12.h"
+#include "UploadBufferDX12.h"
 #include "../RenderToolsDX.h"
 #include "Engine/Threading/Threading.h"
 #include "Engine/Graphics/PixelFormatExtensions.h"
@@ -26,6 +27,8 @@ uint64 GPUBufferDX12::GetSizeInBytes() const
 
 D3D12_GPU_VIRTUAL_ADDRESS GPUBufferDX12::GetLocation() const
 {
+    if (_transientLocation != 0 && _transientGeneration == _device->UploadBuffer->GetCurrentGeneration())
+        return _transientLocation;
     return _resource->GetGPUVirtualAddress();
 }
 
@@ -143,6 +146,8 @@ bool GPUBufferDX12::OnInit()
     DX_SET_DEBUG_NAME(_resource, GetName());
     _memoryUsage = _desc.Size;
     int32 numElements = _desc.GetElementsCount();
+    if (EnumHasAnyFlags(_desc.Flags, GPUBufferFlags::RawBuffer))
+        numElements = _desc.Size / sizeof(uint32); // Raw views always address 32-bit elements (eg. vertex buffer with a raw view for compute)
 
     // Check if set initial data
     if (_desc.InitData)
@@ -241,6 +246,7 @@ void GPUBufferDX12::OnReleaseGPU()
 {
     _view.Release();
     releaseResource();
+    _transientLocation = 0;
     SAFE_DELETE_GPU_RESOURCE(_counter);
 
     // Base
@@ -114,6 +114,8 @@ class GPUBufferDX12 : public GPUResourceDX12<GPUBuffer>, public ResourceOwnerDX1
     GPUBufferViewDX12 _view;
     GPUBufferDX12* _counter = nullptr;
     GPUResourceMapMode _lastMapMode = (GPUResourceMapMode)255;
+    D3D12_GPU_VIRTUAL_ADDRESS _transientLocation = 0;
+    uint64 _transientGeneration = 0;
 
 public:
 
@@ -159,6 +161,17 @@ class GPUBufferDX12 : public GPUResourceDX12<GPUBuffer>, public ResourceOwnerDX1
     /// </summary>
     D3D12_GPU_VIRTUAL_ADDRESS GetLocation() const;
 
+    /// <summary>
+    /// Sets the location of the transient buffer data sub-allocated from the upload buffer ring (valid only within the given generation).
+    /// </summary>
+    /// <param name="location">The data location in a GPU memory.</param>
+    /// <param name="generation">The upload buffer generation of the allocation.</param>
+    FORCE_INLINE void SetTransientLocation(D3D12_GPU_VIRTUAL_ADDRESS location, uint64 generation)
+    {
+        _transientLocation = location;
+        _transientGeneration = generation;
+    }
+
     /// <summary>
     /// Gets the counter resource.
     /// </summary>
@@ -61,6 +61,7 @@ static_assert(OFFSET_OF(GPUDrawIndexedIndirectArgs, StartInstance) == OFFSET_OF(
 GPUContextDX12::GPUContextDX12(GPUDeviceDX12* device, D3D12_COMMAND_LIST_TYPE type)
     : GPUContext(device)
     , _device(device)
+    , _queue(type == D3D12_COMMAND_LIST_TYPE_COMPUTE ? device->GetComputeQueue() : device->GetCommandQueue())
     , _commandList(nullptr)
     , _currentAllocator(nullptr)
     , _currentState(nullptr)
@@ -79,11 +80,19 @@ GPUContextDX12::GPUContextDX12(GPUDeviceDX12* device, D3D12_COMMAND_LIST_TYPE ty
     , _samplersDirtyFlag(0)
     , _rtDepth(nullptr)
     , _ibHandle(nullptr)
+    , _srTableCount(0)
+    , _shadingRate(ShadingRate::Rate1x1)
+    , _shadingRateImage(nullptr)
+    , _parallelParent(nullptr)
 {
     FrameFenceValues[0] = 0;
     FrameFenceValues[1] = 0;
-    _currentAllocator = _device->GetCommandQueue()->RequestAllocator();
+    _currentAllocator = _queue->RequestAllocator();
     VALIDATE_DIRECTX_CALL(device->GetDevice()->CreateCommandList(0, type, _currentAllocator, nullptr, IID_PPV_ARGS(&_commandList)));
+#if DX12_USE_VARIABLE_RATE_SHADING
+    if (FAILED(_commandList->QueryInterface(IID_PPV_ARGS(&_commandList5))))
+        _commandList5 = nullptr;
+#endif
 #if GPU_ENABLE_RESOURCE_NAMING
     _commandList->SetName(TEXT("GPUContextDX12::CommandList"));
 #endif
@@ -91,6 +100,10 @@ GPUContextDX12::GPUContextDX12(GPUDeviceDX12* device, D3D12_COMMAND_LIST_TYPE ty
 
 GPUContextDX12::~GPUContextDX12()
 {
+#if DX12_USE_VARIABLE_RATE_SHADING
+    if (_commandList5)
+        _commandList5->Release();
+#endif
     DX_SAFE_RELEASE_CHECK(_commandList, 0);
 }
 
@@ -109,6 +122,15 @@ void GPUContextDX12::AddTransitionBarrier(ResourceOwnerDX12* resource, const D3D
     const auto info = String::Format(TEXT("[DX12 Resource Barrier]: 0x{0:x} -> 0x{1:x}: {2} (subresource: {3})"), before, after, resourceName, subresourceIndex);
     Log::Logger::Write(LogType::Info, info);
 #endif
+#if COMPILE_WITH_PROFILER
+    {
+        const auto gpuResourceStat = resource->AsGPUResource();
+        uint64 size = gpuResourceStat ? gpuResourceStat->GetMemoryUsage() : 0;
+        if (subresourceIndex != D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES && resource->GetSubresourcesCount() > 1)
+            size /= resource->GetSubresourcesCount();
+        RENDER_STAT_RESOURCE_BARRIER(size);
+    }
+#endif
 
     D3D12_RESOURCE_BARRIER barrier;
     barrier.Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
@@ -150,6 +172,13 @@ void GPUContextDX12::SetResourceState(ResourceOwnerDX12* resource, D3D12_RESOURC
     auto nativeResource = resource->GetResource();
     if (nativeResource == nullptr)
         return;
+    if (_parallelParent)
+    {
+        setResourceStateParallel(resource, after, subresourceIndex);
+        return;
+    }
+    if (resource->AliasingPending)
+        activateAliasedResource(resource);
     auto& state = resource->State;
     if (subresourceIndex == -1)
     {
@@ -202,13 +231,74 @@ void GPUContextDX12::SetResourceState(ResourceOwnerDX12* resource, D3D12_RESOURC
     }
 }
 
+void GPUContextDX12::activateAliasedResource(ResourceOwnerDX12* resource)
+{
+    resource->AliasingPending = false;
+    if (_rbBufferSize == DX12_RB_BUFFER_SIZE)
+        flushRBs();
+
+    // Begin using the memory shared with other placed resources
+    D3D12_RESOURCE_BARRIER barrier;
+    barrier.Type = D3D12_RESOURCE_BARRIER_TYPE_ALIASING;
+    barrier.Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE;
+    barrier.Aliasing.pResourceBefore = nullptr;
+    barrier.Aliasing.pResourceAfter = resource->GetResource();
+#if DX12_ENABLE_RESOURCE_BARRIERS_BATCHING
+    _rbBuffer[_rbBufferSize++] = barrier;
+#else
+    _commandList->ResourceBarrier(1, &barrier);
+#endif
+
+    // Render targets and depth buffers placed in aliased memory have to be discarded (or cleared) before the first usage
+    const auto texture = static_cast<GPUTextureDX12*>(resource);
+    SetResourceState(resource, texture->IsDepthStencil() ? D3D12_RESOURCE_STATE_DEPTH_WRITE : D3D12_RESOURCE_STATE_RENDER_TARGET);
+    flushRBs();
+    _commandList->DiscardResource(resource->GetResource(), nullptr);
+}
+
+void GPUContextDX12::setResourceStateParallel(ResourceOwnerDX12* resource, D3D12_RESOURCE_STATES after, int32 subresourceIndex)
+{
+    if (_queue->_type == D3D12_COMMAND_LIST_TYPE_COMPUTE && (after & D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE) != 0)
+    {
+        // Compute command lists cannot use graphics-only states
+        after = (after & ~D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE) | D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE;
+    }
+
+    // Global resource state cannot be modified from the job thread (and the parent context commands will be executed before these ones) so track it locally
+    int32 index = -1, first = -1;
+    if (_parallelStatesLookup.TryGet(resource, first))
+    {
+        index = first;
+        while (index != -1 && _parallelStates[index].Subresource != subresourceIndex)
+            index = _parallelStates[index].Next;
+    }
+    if (index == -1)
+    {
+        // First usage so the parent context will transition the resource before executing these commands
+        auto& e = _parallelStates.AddOne();
+        e.Resource = resource;
+        e.Subresource = subresourceIndex;
+        e.Next = first;
+        e.Before = after;
+        e.After = after;
+        _parallelStatesLookup[resource] = _parallelStates.Count() - 1;
+        return;
+    }
+    auto& e = _parallelStates[index];
+    if (ResourceStateDX12::IsTransitionNeeded(e.After, after))
+    {
+        AddTransitionBarrier(resource, e.After, after, subresourceIndex);
+        e.After = after;
+    }
+}
+
 void GPUContextDX12::Reset()
 {
     // The command list persists, but we must request a new allocator
     ASSERT(_commandList != nullptr);
     if (_currentAllocator == nullptr)
     {
-        _currentAllocator = _device->GetCommandQueue()->RequestAllocator();
+        _currentAllocator = _queue->RequestAllocator();
         _commandList->Reset(_currentAllocator, nullptr);
     }
 
@@ -236,7 +326,16 @@ void GPUContextDX12::Reset()
     _ibHandle = nullptr;
     Platform::MemoryClear(&_cbHandles, sizeof(_cbHandles));
     Platform::MemoryClear(&_samplers, sizeof(_samplers));
+    Platform::MemoryClear(&_viewport, sizeof(_viewport));
+    Platform::MemoryClear(&_scissor, sizeof(_scissor));
+    _blendFactor = Float4::Zero;
+    _srTableCount = 0;
+    _shadingRate = ShadingRate::Rate1x1;
+    _shadingRateImage = nullptr;
     _swapChainsUsed = 0;
+    _parallelStates.Clear();
+    _parallelStatesLookup.Clear();
+    _parallelCBs.Clear();
 
     ForceRebindDescriptors();
 }
@@ -244,7 +343,7 @@ void GPUContextDX12::Reset()
 uint64 GPUContextDX12::Execute(bool waitForCompletion)
 {
     ASSERT(_currentAllocator != nullptr);
-    auto queue = _device->GetCommandQueue();
+    auto queue = _queue;
 
     // Flush remaining and buffered commands
     FlushState();
@@ -314,6 +413,7 @@ void GPUContextDX12::flushSRVs()
     // Fill table with source descriptors
     DxShaderHeader& header = _currentCompute ? ((GPUShaderProgramCSDX12*)_currentCompute)->Header : _currentState->Header;
     D3D12_CPU_DESCRIPTOR_HANDLE srcDescriptorRangeStarts[GPU_MAX_SR_BINDED];
+    ID3D12Resource* srcResources[GPU_MAX_SR_BINDED];
     for (uint32 i = 0; i < srCount; i++)
     {
         const auto handle = _srHandles[i];
@@ -322,6 +422,7 @@ void GPUContextDX12::flushSRVs()
         {
             ASSERT(handle->SrvDimension == dimensions);
             srcDescriptorRangeStarts[i] = handle->SRV();
+            srcResources[i] = handle->GetResourceOwner()->GetResource();
             // TODO: for setup states based on binding mode
             D3D12_RESOURCE_STATES states = D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE | D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE;
             if (handle->IsDepthStencilResource())
@@ -331,20 +432,35 @@ void GPUContextDX12::flushSRVs()
         else
         {
             srcDescriptorRangeStarts[i] = _device->NullSRV(dimensions);
+            srcResources[i] = nullptr;
         }
     }
 
-    // Allocate data for the table
-    auto allocation = _device->RingHeap_CBV_SRV_UAV.AllocateTable(srCount);
+    // Reuse the previous table if it has the same descriptors and it's still valid (ring buffer didn't wrap around since then)
+    auto& ringHeap = _device->RingHeap_CBV_SRV_UAV;
+    if (_srTableCount != srCount ||
+        _srTableWrapsCount != ringHeap.GetWrapsCount() ||
+        Platform::MemoryCompare(_srTableSources, srcDescriptorRangeStarts, srCount * sizeof(D3D12_CPU_DESCRIPTOR_HANDLE)) != 0 ||
+        Platform::MemoryCompare(_srTableResources, srcResources, srCount * sizeof(ID3D12Resource*)) != 0)
+    {
+        // Allocate data for the table
+        auto allocation = ringHeap.AllocateTable(srCount);
 
-    // Copy descriptors
-    _device->GetDevice()->CopyDescriptors(1, &allocation.CPU, &srCount, srCount, srcDescriptorRangeStarts, nullptr, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+        // Copy descriptors
+        _device->GetDevice()->CopyDescriptors(1, &allocation.CPU, &srCount, srCount, srcDescriptorRangeStarts, nullptr, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+
+        _srTableCount = srCount;
+        _srTableWrapsCount = ringHeap.GetWrapsCount();
+        _srTableGPU = allocation.GPU;
+        Platform::MemoryCopy(_srTableSources, srcDescriptorRangeStarts, srCount * sizeof(D3D12_CPU_DESCRIPTOR_HANDLE));
+        Platform::MemoryCopy(_srTableResources, srcResources, srCount * sizeof(ID3D12Resource*));
+    }
 
     // Flush SRV descriptors table
     if (_isCompute)
-        _commandList->SetComputeRootDescriptorTable(DX12_ROOT_SIGNATURE_SR, allocation.GPU);
+        _commandList->SetComputeRootDescriptorTable(DX12_ROOT_SIGNATURE_SR, _srTableGPU);
     else
-        _commandList->SetGraphicsRootDescriptorTable(DX12_ROOT_SIGNATURE_SR, allocation.GPU);
+        _commandList->SetGraphicsRootDescriptorTable(DX12_ROOT_SIGNATURE_SR, _srTableGPU);
 }
 
 void GPUContextDX12::flushRTVs()
@@ -459,8 +575,11 @@ void GPUContextDX12::flushCBs()
             const auto cb = _cbHandles[i];
             if (cb)
             {
-                ASSERT(cb->GPUAddress != 0);
-                _commandList->SetGraphicsRootConstantBufferView(DX12_ROOT_SIGNATURE_CB + i, cb->GPUAddress);
+                D3D12_GPU_VIRTUAL_ADDRESS address = cb->GPUAddress;
+                if (_parallelParent)
+                    _parallelCBs.TryGet(cb, address);
+                ASSERT(address != 0);
+                _commandList->SetGraphicsRootConstantBufferView(DX12_ROOT_SIGNATURE_CB + i, address);
             }
         }
     }
@@ -472,8 +591,11 @@ void GPUContextDX12::flushCBs()
             const auto cb = _cbHandles[i];
             if (cb)
             {
-                ASSERT(cb->GPUAddress != 0);
-                _commandList->SetComputeRootConstantBufferView(DX12_ROOT_SIGNATURE_CB + i, cb->GPUAddress);
+                D3D12_GPU_VIRTUAL_ADDRESS address = cb->GPUAddress;
+                if (_parallelParent)
+                    _parallelCBs.TryGet(cb, address);
+                ASSERT(address != 0);
+                _commandList->SetComputeRootConstantBufferView(DX12_ROOT_SIGNATURE_CB + i, address);
             }
         }
     }
@@ -556,6 +678,25 @@ void GPUContextDX12::flushPS()
     }
 }
 
+void GPUContextDX12::flushShadingRate()
+{
+#if DX12_USE_VARIABLE_RATE_SHADING
+    if (!_commandList5)
+        return;
+
+    // Use the coarser rate from the per-draw rate and the screen-space image
+    const D3D12_SHADING_RATE_COMBINER combiners[D3D12_RS_SET_SHADING_RATE_COMBINER_COUNT] =
+    {
+        D3D12_SHADING_RATE_COMBINER_PASSTHROUGH,
+        _shadingRateImage ? D3D12_SHADING_RATE_COMBINER_MAX : D3D12_SHADING_RATE_COMBINER_PASSTHROUGH,
+    };
+    _commandList5->RSSetShadingRate((D3D12_SHADING_RATE)_shadingRate, combiners);
+    if (_shadingRateImage)
+        SetResourceState(_shadingRateImage, D3D12_RESOURCE_STATE_SHADING_RATE_SOURCE);
+    _commandList5->RSSetShadingRateImage(_shadingRateImage ? _shadingRateImage->GetResource() : nullptr);
+#endif
+}
+
 void GPUContextDX12::OnDrawCall()
 {
     // Ensure state of the vertex and index buffers
@@ -613,8 +754,8 @@ void GPUContextDX12::OnDrawCall()
     flushSamplers();
 
 #if BUILD_DEBUG
-    // Additional verification of the state
-    if (_currentState)
+    // Additional verification of the state (resource states of the parallel context are resolved later)
+    if (_currentState && !_parallelParent)
     {
         for (int32 i = 0; i < _rtCount; i++)
         {
@@ -853,6 +994,7 @@ void GPUContextDX12::SetRenderTarget(GPUTextureView* depthBuffer, const Span<GPU
 
 void GPUContextDX12::SetBlendFactor(const Float4& value)
 {
+    _blendFactor = value;
     _commandList->OMSetBlendFactor(value.Raw);
 }
 
@@ -865,6 +1007,25 @@ void GPUContextDX12::SetStencilRef(uint32 value)
     }
 }
 
+void GPUContextDX12::SetShadingRate(ShadingRate rate)
+{
+    if (_shadingRate != rate && _device->Limits.HasVariableRateShading)
+    {
+        _shadingRate = rate;
+        flushShadingRate();
+    }
+}
+
+void GPUContextDX12::SetShadingRateImage(GPUTexture* image)
+{
+    const auto imageDX12 = static_cast<GPUTextureDX12*>(image);
+    if (_shadingRateImage != imageDX12 && _device->Limits.HasVariableRateShadingImage)
+    {
+        _shadingRateImage = imageDX12;
+        flushShadingRate();
+    }
+}
+
 void GPUContextDX12::ResetSR()
 {
     for (int32 slot = 0; slot < GPU_MAX_SR_BINDED; slot++)
@@ -1009,8 +1170,11 @@ void GPUContextDX12::UpdateCB(GPUConstantBuffer* cb, const void* data)
     // Copy data
     Platform::MemoryCopy(allocation.CPUAddress, data, allocation.Size);
 
-    // Cache GPU address of the allocation
-    cbDX12->GPUAddress = allocation.GPUAddress;
+    // Cache GPU address of the allocation (parallel context cannot modify the shared buffer)
+    if (_parallelParent)
+        _parallelCBs[cbDX12] = allocation.GPUAddress;
+    else
+        cbDX12->GPUAddress = allocation.GPUAddress;
 
     // Mark CB slot as dirty if this CB is binded to the pipeline
     for (uint32 i = 0; i < ARRAY_COUNT(_cbHandles); i++)
@@ -1146,17 +1310,17 @@ void GPUContextDX12::DrawIndexedInstancedIndirect(GPUBuffer* bufferForArgs, uint
 
 void GPUContextDX12::SetViewport(const Viewport& viewport)
 {
-    _commandList->RSSetViewports(1, (D3D12_VIEWPORT*)&viewport);
+    _viewport = *(D3D12_VIEWPORT*)&viewport;
+    _commandList->RSSetViewports(1, &_viewport);
 }
 
 void GPUContextDX12::SetScissor(const Rectangle& scissorRect)
 {
-    D3D12_RECT rect;
-    rect.left = (LONG)scissorRect.GetLeft();
-    rect.right = (LONG)scissorRect.GetRight();
-    rect.top = (LONG)scissorRect.GetTop();
-    rect.bottom = (LONG)scissorRect.GetBottom();
-    _commandList->RSSetScissorRects(1, &rect);
+    _scissor.left = (LONG)scissorRect.GetLeft();
+    _scissor.right = (LONG)scissorRect.GetRight();
+    _scissor.top = (LONG)scissorRect.GetTop();
+    _scissor.bottom = (LONG)scissorRect.GetBottom();
+    _commandList->RSSetScissorRects(1, &_scissor);
 }
 
 GPUPipelineState* GPUContextDX12::GetState() const
@@ -1217,6 +1381,17 @@ void GPUContextDX12::UpdateBuffer(GPUBuffer* buffer, const void* data, uint32 si
 
     auto bufferDX12 = (GPUBufferDX12*)buffer;
 
+    if (EnumHasAnyFlags(buffer->GetFlags(), GPUBufferFlags::Transient) && !buffer->IsShaderResource() && !buffer->IsUnorderedAccess())
+    {
+        // Write transient data directly into the upload buffer ring (GPU reads it from there so no copy nor barriers are needed)
+        const DynamicAllocation allocation = _device->UploadBuffer->Allocate(buffer->GetSize(), 4);
+        if (allocation.IsInvalid())
+            return;
+        Platform::MemoryCopy((byte*)allocation.CPUAddress + offset, data, size);
+        bufferDX12->SetTransientLocation(allocation.GPUAddress, allocation.Generation);
+        return;
+    }
+
     SetResourceState(bufferDX12, D3D12_RESOURCE_STATE_COPY_DEST);
     flushRBs();
 
@@ -1453,7 +1628,8 @@ void GPUContextDX12::SetResourceState(GPUResource* resource, uint64 state, int32
 void GPUContextDX12::ForceRebindDescriptors()
 {
     // Bind Root Signature
-    _commandList->SetGraphicsRootSignature(_device->GetRootSignature());
+    if (_queue->_type != D3D12_COMMAND_LIST_TYPE_COMPUTE)
+        _commandList->SetGraphicsRootSignature(_device->GetRootSignature());
     _commandList->SetComputeRootSignature(_device->GetRootSignature());
 
     // Bind heaps
@@ -1461,4 +1637,173 @@ void GPUContextDX12::ForceRebindDescriptors()
     _commandList->SetDescriptorHeaps(ARRAY_COUNT(ppHeaps), ppHeaps);
 }
 
+void GPUContextDX12::transitionParallelStates(GPUContextDX12* context)
+{
+    // Transition resources into the states expected by the parallel commands (exact states as they were used for the barriers recorded within the parallel commands)
+    for (const auto& e : context->_parallelStates)
+    {
+        auto& state = e.Resource->State;
+        if (e.Subresource == -1 && !state.AreAllSubresourcesSame())
+        {
+            for (int32 j = 0; j < state.GetSubresourcesCount(); j++)
+            {
+                const D3D12_RESOURCE_STATES before = state.GetSubresourceState(j);
+                if (before != e.Before)
+                    AddTransitionBarrier(e.Resource, before, e.Before, j);
+            }
+        }
+        else
+        {
+            const D3D12_RESOURCE_STATES before = state.GetSubresourceState(e.Subresource);
+            if (before != e.Before)
+                AddTransitionBarrier(e.Resource, before, e.Before, e.Subresource);
+        }
+        state.SetSubresourceState(e.Subresource, e.Before);
+    }
+}
+
+void GPUContextDX12::endParallel(GPUContextDX12* context)
+{
+    context->_parallelParent = nullptr;
+    for (const auto& e : context->_parallelStates)
+        e.Resource->State.SetSubresourceState(e.Subresource, e.After);
+    context->_parallelStates.Clear();
+    context->_parallelStatesLookup.Clear();
+    context->_parallelCBs.Clear();
+}
+
+void GPUContextDX12::resumeRecording(GPUPipelineStateDX12* currentState)
+{
+    // Continue recording with a new allocator
+    if (_currentAllocator == nullptr)
+    {
+        _currentAllocator = _queue->RequestAllocator();
+        _commandList->Reset(_currentAllocator, nullptr);
+    }
+
+    // Restore the state in the new command list
+    ForceRebindDescriptors();
+    _currentState = currentState;
+    _primitiveTopology = D3D_PRIMITIVE_TOPOLOGY_UNDEFINED;
+    _rtDirtyFlag = true;
+    _psDirtyFlag = true;
+    _cbGraphicsDirtyFlag = true;
+    _cbComputeDirtyFlag = true;
+    _samplersDirtyFlag = true;
+    _srMaskDirtyGraphics = MAX_uint32;
+    _srMaskDirtyCompute = MAX_uint32;
+    if (_viewport.Width > 0 && _viewport.Height > 0)
+        _commandList->RSSetViewports(1, &_viewport);
+    if (_scissor.right > _scissor.left && _scissor.bottom > _scissor.top)
+        _commandList->RSSetScissorRects(1, &_scissor);
+    _commandList->OMSetStencilRef(_stencilRef);
+    _commandList->OMSetBlendFactor(_blendFactor.Raw);
+    if (_shadingRate != ShadingRate::Rate1x1 || _shadingRateImage)
+        flushShadingRate();
+    if (_vbCount != 0)
+        _commandList->IASetVertexBuffers(0, _vbCount, _vbViews);
+    if (_ibHandle)
+        _commandList->IASetIndexBuffer(&_ibView);
+}
+
+void GPUContextDX12::BeginParallel(GPUContext* parent)
+{
+    const auto parentDX12 = static_cast<GPUContextDX12*>(parent);
+    ASSERT(parentDX12 && parentDX12 != this && parentDX12->_parallelParent == nullptr);
+
+    // Start a new command list
+    Reset();
+    _parallelParent = parentDX12;
+
+    // Inherit the shared bindings
+    Platform::MemoryCopy(_cbHandles, parentDX12->_cbHandles, sizeof(_cbHandles));
+    Platform::MemoryCopy(_samplers, parentDX12->_samplers, sizeof(_samplers));
+    _cbGraphicsDirtyFlag = true;
+    _cbComputeDirtyFlag = true;
+    _samplersDirtyFlag = true;
+    if (_queue->_type == D3D12_COMMAND_LIST_TYPE_COMPUTE)
+        return;
+
+    // Inherit the output state
+    _rtCount = parentDX12->_rtCount;
+    _rtDepth = parentDX12->_rtDepth;
+    Platform::MemoryCopy(_rtHandles, parentDX12->_rtHandles, sizeof(_rtHandles));
+    _rtDirtyFlag = true;
+    _viewport = parentDX12->_viewport;
+    _scissor = parentDX12->_scissor;
+    if (_viewport.Width > 0 && _viewport.Height > 0)
+        _commandList->RSSetViewports(1, &_viewport);
+    if (_scissor.right > _scissor.left && _scissor.bottom > _scissor.top)
+        _commandList->RSSetScissorRects(1, &_scissor);
+    SetStencilRef(parentDX12->_stencilRef);
+    SetBlendFactor(parentDX12->_blendFactor);
+    if (parentDX12->_shadingRate != ShadingRate::Rate1x1 || parentDX12->_shadingRateImage)
+    {
+        _shadingRate = parentDX12->_shadingRate;
+        _shadingRateImage = parentDX12->_shadingRateImage;
+        flushShadingRate();
+    }
+}
+
+void GPUContextDX12::ExecuteParallel(const Span<GPUContext*>& contexts)
+{
+    ASSERT(_currentAllocator != nullptr && _parallelParent == nullptr);
+    if (contexts.Length() == 0)
+        return;
+    const auto currentState = _currentState;
+
+    for (int32 i = 0; i < contexts.Length(); i++)
+    {
+        const auto context = static_cast<GPUContextDX12*>(contexts[i]);
+        ASSERT(context->_parallelParent == this && context->_queue == _queue);
+        transitionParallelStates(context);
+
+        // Submit commands recorded so far and then the parallel ones
+        Execute(false);
+        context->Execute(false);
+        endParallel(context);
+
+        // Continue recording with a new allocator
+        _currentAllocator = _queue->RequestAllocator();
+        _commandList->Reset(_currentAllocator, nullptr);
+    }
+
+    resumeRecording(currentState);
+}
+
+GPUSyncPoint GPUContextDX12::ExecuteAsyncCompute(GPUContext* context)
+{
+    ASSERT(_currentAllocator != nullptr && _parallelParent == nullptr);
+    const auto contextDX12 = static_cast<GPUContextDX12*>(context);
+    ASSERT(contextDX12 && contextDX12->_parallelParent == this && contextDX12->_queue != _queue);
+    const auto currentState = _currentState;
+
+    // Transition resources on this queue (compute queue cannot transition from/to graphics states, eg. render target or pixel shader resource)
+    transitionParallelStates(contextDX12);
+
+    // Submit commands recorded so far and make the compute queue wait for them, then submit the compute commands
+    const uint64 fenceValue = Execute(false);
+    _queue->_fence.WaitGPU(contextDX12->_queue, fenceValue);
+    const uint64 computeFenceValue = contextDX12->Execute(false);
+    endParallel(contextDX12);
+
+    resumeRecording(currentState);
+    return computeFenceValue;
+}
+
+void GPUContextDX12::WaitAsyncCompute(GPUSyncPoint syncPoint)
+{
+    ASSERT(_currentAllocator != nullptr && _parallelParent == nullptr);
+    const auto computeQueue = _device->GetComputeQueue();
+    if (syncPoint == 0 || !computeQueue)
+        return;
+    const auto currentState = _currentState;
+
+    // Submit commands recorded so far (executed concurrently to the compute work) and make the next ones wait for the compute work
+    Execute(false);
+    computeQueue->_fence.WaitGPU(_queue, syncPoint);
+
+    resumeRecording(currentState);
+}
+
 #endif
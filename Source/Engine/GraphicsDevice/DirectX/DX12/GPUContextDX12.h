@@ -5,15 +5,19 @@
 #include "Engine/Graphics/GPUContext.h"
 #include "IShaderResourceDX12.h"
 #include "DescriptorHeapDX12.h"
+#include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Core/Math/Vector4.h"
 #include "../IncludeDirectXHeaders.h"
 
 #if GRAPHICS_API_DIRECTX12
 
 class GPUDeviceDX12;
+class CommandQueueDX12;
 class GPUPipelineStateDX12;
 class GPUBufferDX12;
 class GPUSamplerDX12;
 class GPUConstantBufferDX12;
+class GPUTextureDX12;
 class GPUTextureViewDX12;
 
 /// <summary>
@@ -21,6 +25,13 @@ class GPUTextureViewDX12;
 /// </summary>
 #define DX12_RB_BUFFER_SIZE 16
 
+// Enables using variable rate shading (requires D3D12 headers with ID3D12GraphicsCommandList5)
+#ifdef __ID3D12GraphicsCommandList5_INTERFACE_DEFINED__
+#define DX12_USE_VARIABLE_RATE_SHADING 1
+#else
+#define DX12_USE_VARIABLE_RATE_SHADING 0
+#endif
+
 /// <summary>
 /// GPU Commands Context implementation for DirectX 12
 /// </summary>
@@ -34,8 +45,25 @@ class GPUContextDX12 : public GPUContext
 
 private:
 
+    // The resource state used by the parallel commands recording (tracked locally and resolved by the parent context on submission).
+    struct ParallelResourceState
+    {
+        ResourceOwnerDX12* Resource;
+        int32 Subresource;
+        // Index of the next state entry for the same resource (other subresource) or -1.
+        int32 Next;
+        // The state expected by the first command that used the resource.
+        D3D12_RESOURCE_STATES Before;
+        // The state after the last command that used the resource.
+        D3D12_RESOURCE_STATES After;
+    };
+
     GPUDeviceDX12* _device;
+    CommandQueueDX12* _queue;
     ID3D12GraphicsCommandList* _commandList;
+#if DX12_USE_VARIABLE_RATE_SHADING
+    ID3D12GraphicsCommandList5* _commandList5;
+#endif
     ID3D12CommandAllocator* _currentAllocator;
     GPUPipelineStateDX12* _currentState;
     GPUShaderProgramCS* _currentCompute;
@@ -68,6 +96,23 @@ class GPUContextDX12 : public GPUContext
     D3D12_RESOURCE_BARRIER _rbBuffer[DX12_RB_BUFFER_SIZE];
     GPUConstantBufferDX12* _cbHandles[GPU_MAX_CB_BINDED];
     GPUSamplerDX12* _samplers[GPU_MAX_SAMPLER_BINDED - GPU_STATIC_SAMPLERS_COUNT];
+    D3D12_VIEWPORT _viewport;
+    D3D12_RECT _scissor;
+    Float4 _blendFactor;
+    ShadingRate _shadingRate;
+    GPUTextureDX12* _shadingRateImage;
+
+    // The last SRV descriptors table (reused when the same resources are bound, eg. in consecutive draws with the same material)
+    uint32 _srTableCount;
+    uint32 _srTableWrapsCount;
+    D3D12_GPU_DESCRIPTOR_HANDLE _srTableGPU;
+    D3D12_CPU_DESCRIPTOR_HANDLE _srTableSources[GPU_MAX_SR_BINDED];
+    ID3D12Resource* _srTableResources[GPU_MAX_SR_BINDED];
+
+    GPUContextDX12* _parallelParent;
+    Array<ParallelResourceState> _parallelStates;
+    Dictionary<ResourceOwnerDX12*, int32> _parallelStatesLookup;
+    Dictionary<GPUConstantBufferDX12*, D3D12_GPU_VIRTUAL_ADDRESS> _parallelCBs;
 
 public:
 
@@ -138,6 +183,11 @@ class GPUContextDX12 : public GPUContext
 
 private:
 
+    void activateAliasedResource(ResourceOwnerDX12* resource);
+    void setResourceStateParallel(ResourceOwnerDX12* resource, D3D12_RESOURCE_STATES after, int32 subresourceIndex);
+    void transitionParallelStates(GPUContextDX12* context);
+    void endParallel(GPUContextDX12* context);
+    void resumeRecording(GPUPipelineStateDX12* currentState);
     void flushSRVs();
     void flushRTVs();
     void flushUAVs();
@@ -145,6 +195,7 @@ class GPUContextDX12 : public GPUContext
     void flushSamplers();
     void flushRBs();
     void flushPS();
+    void flushShadingRate();
     void OnDrawCall();
 
 public:
@@ -170,6 +221,8 @@ class GPUContextDX12 : public GPUContext
     void SetRenderTarget(GPUTextureView* depthBuffer, const Span<GPUTextureView*>& rts) override;
     void SetBlendFactor(const Float4& value) override;
     void SetStencilRef(uint32 value) override;
+    void SetShadingRate(ShadingRate rate) override;
+    void SetShadingRateImage(GPUTexture* image) override;
     void ResetSR() override;
     void ResetUA() override;
     void ResetCB() override;
@@ -204,6 +257,10 @@ class GPUContextDX12 : public GPUContext
     void CopySubresource(GPUResource* dstResource, uint32 dstSubresource, GPUResource* srcResource, uint32 srcSubresource) override;
     void SetResourceState(GPUResource* resource, uint64 state, int32 subresource) override;
     void ForceRebindDescriptors() override;
+    void BeginParallel(GPUContext* parent) override;
+    void ExecuteParallel(const Span<GPUContext*>& contexts) override;
+    GPUSyncPoint ExecuteAsyncCompute(GPUContext* context) override;
+    void WaitAsyncCompute(GPUSyncPoint syncPoint) override;
 };
 
 #endif
@@ -23,6 +23,7 @@
 #include "Engine/Core/Utilities.h"
 #include "Engine/Threading/Threading.h"
 #include "CommandSignatureDX12.h"
+#include "PipelineLibraryDX12.h"
 
 static bool CheckDX12Support(IDXGIAdapter* adapter)
 {
@@ -228,6 +229,7 @@ GPUDeviceDX12::GPUDeviceDX12(IDXGIFactory4* dxgiFactory, GPUAdapterDX* adapter)
     , _mainContext(nullptr)
     , UploadBuffer(nullptr)
     , TimestampQueryHeap(this, D3D12_QUERY_HEAP_TYPE_TIMESTAMP, DX12_BACK_BUFFER_COUNT * 1024)
+    , PipelineStatisticsQueryHeap(this, D3D12_QUERY_HEAP_TYPE_PIPELINE_STATISTICS, DX12_BACK_BUFFER_COUNT * 512)
     , Heap_CBV_SRV_UAV(this, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV, 4 * 1024, false)
     , Heap_RTV(this, D3D12_DESCRIPTOR_HEAP_TYPE_RTV, 1 * 1024, false)
     , Heap_DSV(this, D3D12_DESCRIPTOR_HEAP_TYPE_DSV, 64, false)
@@ -235,6 +237,9 @@ GPUDeviceDX12::GPUDeviceDX12(IDXGIFactory4* dxgiFactory, GPUAdapterDX* adapter)
     , RingHeap_CBV_SRV_UAV(this, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV, 512 * 1024, true)
     , RingHeap_Sampler(this, D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER, 1 * 1024, true)
 {
+    Platform::MemoryClear(_parallelContexts, sizeof(_parallelContexts));
+    _computeQueue = nullptr;
+    _computeContext = nullptr;
 }
 
 bool GPUDeviceDX12::Init()
@@ -393,6 +398,18 @@ bool GPUDeviceDX12::Init()
         limits.MaximumTexture3DSize = D3D12_REQ_TEXTURE3D_U_V_OR_W_DIMENSION;
         limits.MaximumTextureCubeSize = D3D12_REQ_TEXTURECUBE_DIMENSION;
         limits.MaximumSamplerAnisotropy = D3D12_DEFAULT_MAX_ANISOTROPY;
+#if DX12_USE_VARIABLE_RATE_SHADING
+        D3D12_FEATURE_DATA_D3D12_OPTIONS6 options6 = {};
+        if (SUCCEEDED(_device->CheckFeatureSupport(D3D12_FEATURE_D3D12_OPTIONS6, &options6, sizeof(options6))))
+        {
+            LOG(Info, "Variable Shading Rate Tier: {0}", (int32)options6.VariableShadingRateTier);
+            limits.HasVariableRateShading = options6.VariableShadingRateTier >= D3D12_VARIABLE_SHADING_RATE_TIER_1;
+            limits.HasVariableRateShadingImage = options6.VariableShadingRateTier >= D3D12_VARIABLE_SHADING_RATE_TIER_2;
+            limits.HasAdditionalShadingRates = options6.AdditionalShadingRatesSupported != FALSE;
+            limits.ShadingRateImageTileSize = (int32)options6.ShadingRateImageTileSize;
+        }
+#endif
+        limits.HasResourceAliasing = true;
 
         for (int32 i = 0; i < static_cast<int32>(PixelFormat::MAX); i++)
         {
@@ -420,6 +437,12 @@ bool GPUDeviceDX12::Init()
     if (_commandQueue->Init())
         return true;
     _mainContext = New<GPUContextDX12>(this, D3D12_COMMAND_LIST_TYPE_DIRECT);
+    _computeQueue = New<CommandQueueDX12>(this, D3D12_COMMAND_LIST_TYPE_COMPUTE);
+    if (_computeQueue->Init())
+    {
+        LOG(Warning, "Failed to create async compute queue.");
+        SAFE_DELETE(_computeQueue);
+    }
     if (RingHeap_CBV_SRV_UAV.Init())
         return true;
     if (RingHeap_Sampler.Init())
@@ -669,10 +692,14 @@ bool GPUDeviceDX12::Init()
         VALIDATE_DIRECTX_CALL(_device->CreateRootSignature(0, signature->GetBufferPointer(), signature->GetBufferSize(), IID_PPV_ARGS(&_rootSignature)));
     }
 
+    // Pipeline states cache
+    PipelineLibrary = New<PipelineLibraryDX12>(this);
+    PipelineLibrary->Init();
+
     // Upload buffer
     UploadBuffer = New<UploadBufferDX12>(this);
 
-    if (TimestampQueryHeap.Init())
+    if (TimestampQueryHeap.Init() || PipelineStatisticsQueryHeap.Init())
         return true;
 
     // Cached command signatures
@@ -703,6 +730,11 @@ void GPUDeviceDX12::DrawBegin()
         //_commandQueue->WaitForGPU();
         _commandQueue->WaitForFence(_mainContext->FrameFenceValues[1]);
     }
+    if (_computeQueue)
+    {
+        // Graphics work always waits for the async compute work so just refresh the completed fence value (for the allocators reuse)
+        _computeQueue->GetSyncPoint().IsComplete();
+    }
 
     // Base
     GPUDeviceDX::DrawBegin();
@@ -716,8 +748,9 @@ void GPUDeviceDX12::RenderEnd()
     // Base
     GPUDeviceDX::RenderEnd();
 
-    // Resolve the timestamp queries
+    // Resolve the timestamp and pipeline statistics queries
     TimestampQueryHeap.EndQueryBatchAndResolveQueryData(_mainContext);
+    PipelineStatisticsQueryHeap.EndQueryBatchAndResolveQueryData(_mainContext);
 }
 
 GPUDeviceDX12::~GPUDeviceDX12()
@@ -736,6 +769,28 @@ D3D12_CPU_DESCRIPTOR_HANDLE GPUDeviceDX12::NullUAV() const
     return _nullUav.CPU();
 }
 
+GPUContext* GPUDeviceDX12::GetParallelContext(int32 index)
+{
+    ASSERT(index >= 0 && index < GPU_MAX_PARALLEL_CONTEXTS);
+    auto& context = _parallelContexts[index];
+    if (context == nullptr)
+    {
+        // Lazy-init (parallel contexts record direct command lists that are submitted by the main context)
+        context = New<GPUContextDX12>(this, D3D12_COMMAND_LIST_TYPE_DIRECT);
+    }
+    return context;
+}
+
+GPUContext* GPUDeviceDX12::GetComputeContext()
+{
+    if (_computeContext == nullptr && _computeQueue)
+    {
+        // Lazy-init (async compute context records compute command lists that are executed on the compute queue)
+        _computeContext = New<GPUContextDX12>(this, D3D12_COMMAND_LIST_TYPE_COMPUTE);
+    }
+    return _computeContext;
+}
+
 ID3D12GraphicsCommandList* GPUDeviceDX12::GetCommandList() const
 {
     return _mainContext->GetCommandList();
@@ -766,11 +821,19 @@ void GPUDeviceDX12::Dispose()
     // Release all late dispose resources (if state is Disposing all are released)
     updateRes2Dispose();
 
+    // Save pipeline states cache
+    if (PipelineLibrary)
+    {
+        PipelineLibrary->Dispose();
+        SAFE_DELETE(PipelineLibrary);
+    }
+
     // Clear pipeline objects
     for (auto& srv : _nullSrv)
         srv.Release();
     _nullUav.Release();
     TimestampQueryHeap.Destroy();
+    PipelineStatisticsQueryHeap.Destroy();
     DX_SAFE_RELEASE_CHECK(_rootSignature, 0);
     Heap_CBV_SRV_UAV.ReleaseGPU();
     Heap_RTV.ReleaseGPU();
@@ -780,7 +843,11 @@ void GPUDeviceDX12::Dispose()
     RingHeap_Sampler.ReleaseGPU();
     SAFE_DELETE(UploadBuffer);
     SAFE_DELETE(DrawIndirectCommandSignature);
+    for (auto& context : _parallelContexts)
+        SAFE_DELETE(context);
+    SAFE_DELETE(_computeContext);
     SAFE_DELETE(_mainContext);
+    SAFE_DELETE(_computeQueue);
     SAFE_DELETE(_commandQueue);
 
     // Clear DirectX stuff
@@ -797,6 +864,8 @@ void GPUDeviceDX12::Dispose()
 
 void GPUDeviceDX12::WaitForGPU()
 {
+    if (_computeQueue)
+        _computeQueue->WaitForGPU();
     _commandQueue->WaitForGPU();
 }
 
@@ -840,6 +909,47 @@ GPUConstantBuffer* GPUDeviceDX12::CreateConstantBuffer(uint32 size, const String
     return New<GPUConstantBufferDX12>(this, size, name);
 }
 
+GPUResource* GPUDeviceDX12::CreateTransientHeap(uint64 size, const StringView& name)
+{
+    auto heap = New<GPUTransientHeapDX12>(this, name);
+    if (heap->Init(size))
+    {
+        Delete(heap);
+        return nullptr;
+    }
+    return heap;
+}
+
+bool GPUDeviceDX12::GetTransientTextureMemory(const GPUTextureDescription& desc, uint64& size, uint64& alignment)
+{
+    D3D12_RESOURCE_DESC resourceDesc;
+    GPUTextureDX12::GetResourceDesc(desc, resourceDesc);
+    const D3D12_RESOURCE_ALLOCATION_INFO info = _device->GetResourceAllocationInfo(0, 1, &resourceDesc);
+    if (info.SizeInBytes == UINT64_MAX)
+        return true;
+    size = info.SizeInBytes;
+    alignment = info.Alignment;
+    return false;
+}
+
+GPUTexture* GPUDeviceDX12::CreateTransientTexture(GPUResource* heap, uint64 offset, const GPUTextureDescription& desc, const StringView& name)
+{
+    auto texture = New<GPUTextureDX12>(this, name);
+    texture->SetPlacement(((GPUTransientHeapDX12*)heap)->GetHeap(), offset);
+    if (texture->Init(desc))
+    {
+        Delete(texture);
+        return nullptr;
+    }
+    return texture;
+}
+
+void GPUDeviceDX12::ActivateTransientTexture(GPUTexture* texture)
+{
+    // Aliasing barrier and discard are inserted by the context before the first usage of the texture
+    static_cast<GPUTextureDX12*>(texture)->AliasingPending = true;
+}
+
 void GPUDeviceDX12::AddResourceToLateRelease(IGraphicsUnknown* resource, uint32 safeFrameCount)
 {
     if (resource == nullptr)
@@ -29,6 +29,7 @@ class GPUSwapChainDX12;
 class UploadBufferDX12;
 class CommandQueueDX12;
 class CommandSignatureDX12;
+class PipelineLibraryDX12;
 
 /// <summary>
 /// Implementation of Graphics Device for DirectX 12 rendering system
@@ -58,6 +59,9 @@ class GPUDeviceDX12 : public GPUDeviceDX
     ID3D12RootSignature* _rootSignature;
     CommandQueueDX12* _commandQueue;
     GPUContextDX12* _mainContext;
+    GPUContextDX12* _parallelContexts[GPU_MAX_PARALLEL_CONTEXTS];
+    CommandQueueDX12* _computeQueue;
+    GPUContextDX12* _computeContext;
 
     // Heaps
     DescriptorHeapWithSlotsDX12::Slot _nullSrv[D3D12_SRV_DIMENSION_TEXTURECUBEARRAY + 1];
@@ -81,11 +85,21 @@ class GPUDeviceDX12 : public GPUDeviceDX
     /// </summary>
     QueryHeapDX12 TimestampQueryHeap;
 
+    /// <summary>
+    /// The pipeline statistics queries heap.
+    /// </summary>
+    QueryHeapDX12 PipelineStatisticsQueryHeap;
+
     bool AllowTearing = false;
     CommandSignatureDX12* DispatchIndirectCommandSignature = nullptr;
     CommandSignatureDX12* DrawIndexedIndirectCommandSignature = nullptr;
     CommandSignatureDX12* DrawIndirectCommandSignature = nullptr;
 
+    /// <summary>
+    /// The persistent pipeline states cache (null if not used).
+    /// </summary>
+    PipelineLibraryDX12* PipelineLibrary = nullptr;
+
     D3D12_CPU_DESCRIPTOR_HANDLE NullSRV(D3D12_SRV_DIMENSION dimension) const;
     D3D12_CPU_DESCRIPTOR_HANDLE NullUAV() const;
 
@@ -120,6 +134,14 @@ class GPUDeviceDX12 : public GPUDeviceDX
         return _commandQueue;
     }
 
+    /// <summary>
+    /// Gets async compute command queue (null if not supported).
+    /// </summary>
+    FORCE_INLINE CommandQueueDX12* GetComputeQueue() const
+    {
+        return _computeQueue;
+    }
+
     /// <summary>
     /// Gets DirectX 12 command queue object.
     /// </summary>
@@ -181,6 +203,8 @@ class GPUDeviceDX12 : public GPUDeviceDX
     {
         return reinterpret_cast<GPUContext*>(_mainContext);
     }
+    GPUContext* GetParallelContext(int32 index) override;
+    GPUContext* GetComputeContext() override;
     void* GetNativePtr() const override
     {
         return _device;
@@ -198,6 +222,10 @@ class GPUDeviceDX12 : public GPUDeviceDX
     GPUSampler* CreateSampler() override;
     GPUSwapChain* CreateSwapChain(Window* window) override;
     GPUConstantBuffer* CreateConstantBuffer(uint32 size, const StringView& name) override;
+    GPUResource* CreateTransientHeap(uint64 size, const StringView& name) override;
+    bool GetTransientTextureMemory(const GPUTextureDescription& desc, uint64& size, uint64& alignment) override;
+    GPUTexture* CreateTransientTexture(GPUResource* heap, uint64 offset, const GPUTextureDescription& desc, const StringView& name) override;
+    void ActivateTransientTexture(GPUTexture* texture) override;
 };
 
 /// <summary>
@@ -5,9 +5,13 @@
 #include "GPUPipelineStateDX12.h"
 #include "GPUShaderProgramDX12.h"
 #include "GPUTextureDX12.h"
+#include "PipelineLibraryDX12.h"
 #include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Profiler/RenderStats.h"
+#include "Engine/Utilities/Crc.h"
 #include "Engine/GraphicsDevice/DirectX/RenderToolsDX.h"
 #include "Engine/Graphics/PixelFormatExtensions.h"
+#include "Engine/Threading/Threading.h"
 
 static D3D12_STENCIL_OP ToStencilOp(StencilOperation value)
 {
@@ -60,7 +64,8 @@ ID3D12PipelineState* GPUPipelineStateDX12::GetState(GPUTextureViewDX12* depth, i
     for (int32 i = rtCount; i < GPU_MAX_RT_BINDED; i++)
         key.RTVsFormats[i] = PixelFormat::Unknown;
 
-    // Try reuse cached version
+    // Try reuse cached version (locked to support parallel commands recording)
+    ScopeLock lock(_locker);
     ID3D12PipelineState* state = nullptr;
     if (_states.TryGet(key, state))
     {
@@ -73,6 +78,13 @@ ID3D12PipelineState* GPUPipelineStateDX12::GetState(GPUTextureViewDX12* depth, i
         return state;
     }
 
+    // Create a new one (pipeline wasn't prepared ahead)
+    RENDER_STAT_PS_STATE_MISS();
+    return CreateState(key);
+}
+
+ID3D12PipelineState* GPUPipelineStateDX12::CreateState(const GPUPipelineStateKeyDX12& key)
+{
     PROFILE_CPU_NAMED("Create Pipeline State");
 
     // Update description to match the pipeline
@@ -84,11 +96,18 @@ ID3D12PipelineState* GPUPipelineStateDX12::GetState(GPUTextureViewDX12* depth, i
     _desc.SampleMask = D3D12_DEFAULT_SAMPLE_MASK;
     _desc.DSVFormat = RenderToolsDX::ToDxgiFormat(PixelFormatExtensions::FindDepthStencilFormat(key.DepthFormat));
 
-    // Create object
-    const HRESULT result = _device->GetDevice()->CreateGraphicsPipelineState(&_desc, IID_PPV_ARGS(&state));
-    LOG_DIRECTX_RESULT(result);
-    if (FAILED(result))
-        return nullptr;
+    // Try to load it from the pipeline states cache or create a new object
+    const auto library = _device->PipelineLibrary;
+    ID3D12PipelineState* state = library ? library->Load(_descHash, key, _desc) : nullptr;
+    if (!state)
+    {
+        const HRESULT result = _device->GetDevice()->CreateGraphicsPipelineState(&_desc, IID_PPV_ARGS(&state));
+        LOG_DIRECTX_RESULT(result);
+        if (FAILED(result))
+            return nullptr;
+        if (library)
+            library->Store(_descHash, key, state);
+    }
 #if GPU_ENABLE_RESOURCE_NAMING && BUILD_DEBUG
     Array<char, InlinedAllocation<200>> name;
     if (DebugDesc.VS)
@@ -254,10 +273,45 @@ bool GPUPipelineStateDX12::Init(const Description& desc)
     // Cache description
     _desc = psDesc;
 
+    // Calculate description hash that is stable between the application runs (used by the pipeline states cache)
+    uint32 hash = Crc::MemCrc32(&psDesc.BlendState, sizeof(psDesc.BlendState));
+    hash = Crc::MemCrc32(&psDesc.RasterizerState, sizeof(psDesc.RasterizerState), hash);
+    hash = Crc::MemCrc32(&psDesc.DepthStencilState, sizeof(psDesc.DepthStencilState), hash);
+    hash = Crc::MemCrc32(&psDesc.PrimitiveTopologyType, sizeof(psDesc.PrimitiveTopologyType), hash);
+    const D3D12_SHADER_BYTECODE* stages[] = { &psDesc.VS, &psDesc.HS, &psDesc.DS, &psDesc.GS, &psDesc.PS };
+    for (const D3D12_SHADER_BYTECODE* stage : stages)
+    {
+        if (stage->pShaderBytecode)
+            hash = Crc::MemCrc32(stage->pShaderBytecode, (int32)stage->BytecodeLength, hash);
+    }
+    for (uint32 i = 0; i < psDesc.InputLayout.NumElements; i++)
+    {
+        const D3D12_INPUT_ELEMENT_DESC& element = psDesc.InputLayout.pInputElementDescs[i];
+        hash = Crc::MemCrc32(element.SemanticName, StringUtils::Length(element.SemanticName), hash);
+        hash = Crc::MemCrc32(&element.SemanticIndex, sizeof(D3D12_INPUT_ELEMENT_DESC) - offsetof(D3D12_INPUT_ELEMENT_DESC, SemanticIndex), hash);
+    }
+    _descHash = hash;
+
     // Set non-zero memory usage
     _memoryUsage = sizeof(D3D12_GRAPHICS_PIPELINE_STATE_DESC);
 
-    return GPUPipelineState::Init(desc);
+    if (GPUPipelineState::Init(desc))
+        return true;
+
+    // Create pipeline permutations used in the previous runs ahead (eg. during content loading instead of on the first draw)
+    if (_device->PipelineLibrary)
+    {
+        Array<GPUPipelineStateKeyDX12> keys;
+        _device->PipelineLibrary->GetPermutations(_descHash, keys);
+        ScopeLock lock(_locker);
+        for (const auto& key : keys)
+        {
+            if (!_states.ContainsKey(key))
+                CreateState(key);
+        }
+    }
+
+    return false;
 }
 
 #endif
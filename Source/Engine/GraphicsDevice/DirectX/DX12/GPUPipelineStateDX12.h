@@ -8,6 +8,7 @@
 #include "GPUDeviceDX12.h"
 #include "Types.h"
 #include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Platform/CriticalSection.h"
 #include "../IncludeDirectXHeaders.h"
 
 class GPUTextureViewDX12;
@@ -49,6 +50,8 @@ class GPUPipelineStateDX12 : public GPUResourceDX12<GPUPipelineState>
 
     Dictionary<GPUPipelineStateKeyDX12, ID3D12PipelineState*> _states;
     D3D12_GRAPHICS_PIPELINE_STATE_DESC _desc;
+    uint32 _descHash = 0;
+    CriticalSection _locker;
 
 public:
 
@@ -74,6 +77,10 @@ class GPUPipelineStateDX12 : public GPUResourceDX12<GPUPipelineState>
     bool IsValid() const override;
     bool Init(const Description& desc) override;
 
+private:
+
+    ID3D12PipelineState* CreateState(const GPUPipelineStateKeyDX12& key);
+
 protected:
 
     // [GPUResourceDX12]
@@ -69,14 +69,43 @@ bool GPUTextureDX12::GetData(int32 arrayOrDepthSliceIndex, int32 mipMapIndex, Te
     return false;
 }
 
+void GPUTextureDX12::GetResourceDesc(const GPUTextureDescription& desc, D3D12_RESOURCE_DESC& resourceDesc)
+{
+    resourceDesc.MipLevels = desc.MipLevels;
+    resourceDesc.Format = RenderToolsDX::ToDxgiFormat(PixelFormatExtensions::MakeTypeless(desc.Format));
+    resourceDesc.Width = desc.Width;
+    resourceDesc.Height = desc.Height;
+    resourceDesc.Flags = D3D12_RESOURCE_FLAG_NONE;
+    resourceDesc.DepthOrArraySize = desc.IsVolume() ? desc.Depth : desc.ArraySize;
+    resourceDesc.SampleDesc.Count = static_cast<UINT>(desc.MultiSampleLevel);
+    resourceDesc.SampleDesc.Quality = desc.IsMultiSample() ? GPUDeviceDX12::GetMaxMSAAQuality((int32)desc.MultiSampleLevel) : 0;
+    resourceDesc.Alignment = 0;
+    resourceDesc.Layout = D3D12_TEXTURE_LAYOUT_UNKNOWN;
+    resourceDesc.Dimension = desc.IsVolume() ? D3D12_RESOURCE_DIMENSION_TEXTURE3D : D3D12_RESOURCE_DIMENSION_TEXTURE2D;
+    if (desc.IsRenderTarget())
+    {
+        resourceDesc.Flags |= D3D12_RESOURCE_FLAG_ALLOW_RENDER_TARGET;
+    }
+    else if (desc.IsDepthStencil())
+    {
+        resourceDesc.Flags |= D3D12_RESOURCE_FLAG_ALLOW_DEPTH_STENCIL;
+        if (!desc.IsShaderResource())
+        {
+            resourceDesc.Flags |= D3D12_RESOURCE_FLAG_DENY_SHADER_RESOURCE;
+        }
+    }
+    if (desc.IsUnorderedAccess())
+    {
+        resourceDesc.Flags |= D3D12_RESOURCE_FLAG_ALLOW_UNORDERED_ACCESS;
+    }
+}
+
 bool GPUTextureDX12::OnInit()
 {
     ID3D12Resource* resource;
 
     // Cache formats
     const PixelFormat format = Format();
-    const PixelFormat typelessFormat = PixelFormatExtensions::MakeTypeless(format);
-    const DXGI_FORMAT dxgiFormat = RenderToolsDX::ToDxgiFormat(typelessFormat);
     _dxgiFormatDSV = RenderToolsDX::ToDxgiFormat(PixelFormatExtensions::FindDepthStencilFormat(format));
     _dxgiFormatSRV = RenderToolsDX::ToDxgiFormat(PixelFormatExtensions::FindShaderResourceFormat(format, _sRGB));
     _dxgiFormatRTV = _dxgiFormatSRV;
@@ -88,7 +117,6 @@ bool GPUTextureDX12::OnInit()
     bool useDSV = IsDepthStencil();
     bool useRTV = IsRenderTarget();
     bool useUAV = IsUnorderedAccess();
-    int32 depthOrArraySize = IsVolume() ? Depth() : ArraySize();
 
     if (IsStaging())
     {
@@ -121,38 +149,14 @@ bool GPUTextureDX12::OnInit()
     }
 
     D3D12_RESOURCE_STATES initialState = D3D12_RESOURCE_STATE_COMMON;
-
-    // Create texture description
-    D3D12_RESOURCE_DESC resourceDesc;
-    resourceDesc.MipLevels = _desc.MipLevels;
-    resourceDesc.Format = dxgiFormat;
-    resourceDesc.Width = _desc.Width;
-    resourceDesc.Height = _desc.Height;
-    resourceDesc.Flags = D3D12_RESOURCE_FLAG_NONE;
-    resourceDesc.DepthOrArraySize = depthOrArraySize;
-    resourceDesc.SampleDesc.Count = static_cast<UINT>(_desc.MultiSampleLevel);
-    resourceDesc.SampleDesc.Quality = IsMultiSample() ? GPUDeviceDX12::GetMaxMSAAQuality((int32)_desc.MultiSampleLevel) : 0;
-    resourceDesc.Alignment = 0;
-    resourceDesc.Layout = D3D12_TEXTURE_LAYOUT_UNKNOWN;
-    resourceDesc.Dimension = IsVolume() ? D3D12_RESOURCE_DIMENSION_TEXTURE3D : D3D12_RESOURCE_DIMENSION_TEXTURE2D;
     if (useRTV)
-    {
-        resourceDesc.Flags |= D3D12_RESOURCE_FLAG_ALLOW_RENDER_TARGET;
         initialState = D3D12_RESOURCE_STATE_RENDER_TARGET;
-    }
     else if (useDSV)
-    {
-        resourceDesc.Flags |= D3D12_RESOURCE_FLAG_ALLOW_DEPTH_STENCIL;
         initialState = D3D12_RESOURCE_STATE_DEPTH_WRITE;
-        if (!useSRV)
-        {
-            resourceDesc.Flags |= D3D12_RESOURCE_FLAG_DENY_SHADER_RESOURCE;
-        }
-    }
-    if (useUAV)
-    {
-        resourceDesc.Flags |= D3D12_RESOURCE_FLAG_ALLOW_UNORDERED_ACCESS;
-    }
+
+    // Create texture description
+    D3D12_RESOURCE_DESC resourceDesc;
+    GetResourceDesc(_desc, resourceDesc);
 
     // Create heap properties
     D3D12_HEAP_PROPERTIES heapProperties;
@@ -183,7 +187,11 @@ bool GPUTextureDX12::OnInit()
         initialState = D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE | D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE;
 
     // Create texture
-    auto result = device->CreateCommittedResource(&heapProperties, D3D12_HEAP_FLAG_NONE, &resourceDesc, initialState, clearValuePtr, IID_PPV_ARGS(&resource));
+    HRESULT result;
+    if (_placedHeap)
+        result = device->CreatePlacedResource(_placedHeap, _placedOffset, &resourceDesc, initialState, clearValuePtr, IID_PPV_ARGS(&resource));
+    else
+        result = device->CreateCommittedResource(&heapProperties, D3D12_HEAP_FLAG_NONE, &resourceDesc, initialState, clearValuePtr, IID_PPV_ARGS(&resource));
     LOG_DIRECTX_RESULT_WITH_RETURN(result, true);
 
     // Set state
@@ -191,7 +199,7 @@ bool GPUTextureDX12::OnInit()
     bool isWrite = useDSV || useRTV || useUAV;
     initResource(resource, initialState, resourceDesc, isRead && isWrite);
     DX_SET_DEBUG_NAME(_resource, GetName());
-    _memoryUsage = calculateMemoryUsage();
+    _memoryUsage = _placedHeap ? 1 : calculateMemoryUsage(); // Placed texture memory is owned by the heap
 
     // Initialize handles to the resource
     if (IsRegularTexture())
@@ -253,6 +261,7 @@ void GPUTextureDX12::OnReleaseGPU()
     _srv.Release();
     _uav.Release();
     releaseResource();
+    AliasingPending = false;
 
     // Base
     GPUTexture::OnReleaseGPU();
@@ -746,4 +755,46 @@ void GPUTextureDX12::initHandles()
     }
 }
 
+GPUTransientHeapDX12::GPUTransientHeapDX12(GPUDeviceDX12* device, const StringView& name)
+    : GPUResourceDX12<GPUResource>(device, name)
+{
+}
+
+bool GPUTransientHeapDX12::Init(uint64 size)
+{
+    ReleaseGPU();
+    D3D12_HEAP_DESC desc;
+    desc.SizeInBytes = size;
+    desc.Properties.Type = D3D12_HEAP_TYPE_DEFAULT;
+    desc.Properties.CPUPageProperty = D3D12_CPU_PAGE_PROPERTY_UNKNOWN;
+    desc.Properties.MemoryPoolPreference = D3D12_MEMORY_POOL_UNKNOWN;
+    desc.Properties.CreationNodeMask = 1;
+    desc.Properties.VisibleNodeMask = 1;
+    desc.Alignment = D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT;
+    desc.Flags = D3D12_HEAP_FLAG_ALLOW_ONLY_RT_DS_TEXTURES;
+    const HRESULT result = _device->GetDevice()->CreateHeap(&desc, IID_PPV_ARGS(&_heap));
+    LOG_DIRECTX_RESULT_WITH_RETURN(result, true);
+    DX_SET_DEBUG_NAME(_heap, GetName());
+    _memoryUsage = size;
+    return false;
+}
+
+GPUResourceType GPUTransientHeapDX12::GetResourceType() const
+{
+    return GPUResourceType::RenderTarget;
+}
+
+void GPUTransientHeapDX12::OnReleaseGPU()
+{
+    if (_heap)
+    {
+        // Release after the textures placed in the heap
+        _device->AddResourceToLateRelease(_heap, DX12_RESOURCE_DELETE_SAFE_FRAMES_COUNT + 1);
+        _heap = nullptr;
+    }
+
+    // Base
+    GPUResourceDX12::OnReleaseGPU();
+}
+
 #endif
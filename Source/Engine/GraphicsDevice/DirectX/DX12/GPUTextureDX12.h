@@ -145,6 +145,9 @@ class GPUTextureDX12 : public GPUResourceDX12<GPUTexture>, public ResourceOwnerD
     DXGI_FORMAT _dxgiFormatRTV;
     DXGI_FORMAT _dxgiFormatUAV;
 
+    ID3D12Heap* _placedHeap = nullptr;
+    uint64 _placedOffset = 0;
+
 public:
 
     GPUTextureDX12(GPUDeviceDX12* device, const StringView& name)
@@ -156,6 +159,26 @@ class GPUTextureDX12 : public GPUResourceDX12<GPUTexture>, public ResourceOwnerD
 
     void initHandles();
 
+public:
+
+    /// <summary>
+    /// Gets the native resource description for the texture.
+    /// </summary>
+    /// <param name="desc">The texture description.</param>
+    /// <param name="resourceDesc">The result resource description.</param>
+    static void GetResourceDesc(const GPUTextureDescription& desc, D3D12_RESOURCE_DESC& resourceDesc);
+
+    /// <summary>
+    /// Sets the memory heap to place the texture in (instead of allocating own memory). Must be called before initialization.
+    /// </summary>
+    /// <param name="heap">The memory heap.</param>
+    /// <param name="offset">The offset within the heap (in bytes).</param>
+    FORCE_INLINE void SetPlacement(ID3D12Heap* heap, uint64 offset)
+    {
+        _placedHeap = heap;
+        _placedOffset = offset;
+    }
+
 public:
 
     // [GPUTexture]
@@ -220,4 +243,45 @@ class GPUTextureDX12 : public GPUResourceDX12<GPUTexture>, public ResourceOwnerD
     void OnReleaseGPU() override;
 };
 
+/// <summary>
+/// The memory heap for DirectX 12 backend used to place the transient render targets that alias the same memory.
+/// </summary>
+class GPUTransientHeapDX12 : public GPUResourceDX12<GPUResource>
+{
+private:
+
+    ID3D12Heap* _heap = nullptr;
+
+public:
+
+    GPUTransientHeapDX12(GPUDeviceDX12* device, const StringView& name);
+
+public:
+
+    /// <summary>
+    /// Gets DirectX 12 heap object handle.
+    /// </summary>
+    FORCE_INLINE ID3D12Heap* GetHeap() const
+    {
+        return _heap;
+    }
+
+    /// <summary>
+    /// Creates the heap.
+    /// </summary>
+    /// <param name="size">The heap size (in bytes).</param>
+    /// <returns>True if failed, otherwise false.</returns>
+    bool Init(uint64 size);
+
+public:
+
+    // [GPUResource]
+    GPUResourceType GetResourceType() const override;
+
+protected:
+
+    // [GPUResource]
+    void OnReleaseGPU() override;
+};
+
 #endif
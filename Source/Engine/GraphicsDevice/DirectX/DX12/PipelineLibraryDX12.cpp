@@ -0,0 +1,193 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#if GRAPHICS_API_DIRECTX12
+
+#include "PipelineLibraryDX12.h"
+#include "Engine/Core/Log.h"
+#include "Engine/Engine/Globals.h"
+#include "Engine/Engine/StartupTrace.h"
+#include "Engine/Platform/File.h"
+#include "Engine/Platform/FileSystem.h"
+#include "Engine/GraphicsDevice/DirectX/RenderToolsDX.h"
+#include "Engine/Threading/Threading.h"
+
+#define DX12_PIPELINE_LIST_MAGIC 0x4C535050 // 'PPSL'
+#define DX12_PIPELINE_LIST_VERSION 1
+
+struct PipelineListHeaderDX12
+{
+    uint32 Magic;
+    uint32 Version;
+    int32 Count;
+};
+
+struct PipelineListEntryDX12
+{
+    uint32 DescHash;
+    GPUPipelineStateKeyDX12 Key;
+};
+
+static String GetPipelineCachePath(const Char* filename)
+{
+#if USE_EDITOR
+    return Globals::ProjectCacheFolder / filename;
+#else
+    return Globals::ProductLocalFolder / filename;
+#endif
+}
+
+PipelineLibraryDX12::PipelineLibraryDX12(GPUDeviceDX12* device)
+    : _device(device)
+{
+}
+
+void PipelineLibraryDX12::Init()
+{
+    STARTUP_TRACE_SCOPE("Pipeline Cache");
+#if DX12_USE_PIPELINE_LIBRARY
+    // Load pipeline library
+    ID3D12Device1* device1 = nullptr;
+    if (SUCCEEDED(_device->GetDevice()->QueryInterface(IID_PPV_ARGS(&device1))))
+    {
+        const String path = GetPipelineCachePath(TEXT("DX12Pipeline.cache"));
+        if (FileSystem::FileExists(path))
+        {
+            LOG(Info, "Trying to load DirectX 12 pipeline cache file {0}", path);
+            File::ReadAllBytes(path, _libraryData);
+        }
+        HRESULT result = E_FAIL;
+        if (_libraryData.HasItems())
+        {
+            result = device1->CreatePipelineLibrary(_libraryData.Get(), _libraryData.Count(), IID_PPV_ARGS(&_library));
+            if (FAILED(result))
+            {
+                // Cache is invalid (eg. driver has been updated)
+                LOG(Info, "Discarding DirectX 12 pipeline cache (result: {0:x})", static_cast<uint32>(result));
+                _libraryData.Resize(0);
+            }
+        }
+        if (FAILED(result))
+        {
+            result = device1->CreatePipelineLibrary(nullptr, 0, IID_PPV_ARGS(&_library));
+            LOG_DIRECTX_RESULT(result);
+        }
+        device1->Release();
+    }
+#endif
+
+    // Load pipeline permutations used in the previous runs (in cooked game fallback to the list recorded in Editor)
+    Array<byte> data;
+    String path = GetPipelineCachePath(TEXT("DX12Pipeline.list"));
+#if !USE_EDITOR
+    if (!FileSystem::FileExists(path))
+        path = Globals::ProjectContentFolder / TEXT("DX12Pipeline.list");
+#endif
+    if (FileSystem::FileExists(path) && !File::ReadAllBytes(path, data) && data.Count() >= (int32)sizeof(PipelineListHeaderDX12))
+    {
+        const auto header = (const PipelineListHeaderDX12*)data.Get();
+        const auto entries = (const PipelineListEntryDX12*)(data.Get() + sizeof(PipelineListHeaderDX12));
+        if (header->Magic == DX12_PIPELINE_LIST_MAGIC && header->Version == DX12_PIPELINE_LIST_VERSION && data.Count() == (int32)(sizeof(PipelineListHeaderDX12) + header->Count * sizeof(PipelineListEntryDX12)))
+        {
+            for (int32 i = 0; i < header->Count; i++)
+                _permutations[entries[i].DescHash].Add(entries[i].Key);
+        }
+    }
+}
+
+void PipelineLibraryDX12::Dispose()
+{
+    ScopeLock lock(_locker);
+
+#if DX12_USE_PIPELINE_LIBRARY
+    if (_library)
+    {
+        // Save pipeline library
+        if (_libraryDirty)
+        {
+            Array<byte> data;
+            data.Resize((int32)_library->GetSerializedSize());
+            const HRESULT result = _library->Serialize(data.Get(), data.Count());
+            LOG_DIRECTX_RESULT(result);
+            if (SUCCEEDED(result))
+                File::WriteAllBytes(GetPipelineCachePath(TEXT("DX12Pipeline.cache")), data);
+        }
+        _library->Release();
+        _library = nullptr;
+    }
+    _libraryData.Resize(0);
+#endif
+
+    // Save pipeline permutations
+    if (_permutationsDirty)
+    {
+        PipelineListHeaderDX12 header;
+        header.Magic = DX12_PIPELINE_LIST_MAGIC;
+        header.Version = DX12_PIPELINE_LIST_VERSION;
+        header.Count = 0;
+        Array<byte> data;
+        data.Add((const byte*)&header, sizeof(header));
+        for (auto& e : _permutations)
+        {
+            for (const auto& key : e.Value)
+            {
+                PipelineListEntryDX12 entry;
+                entry.DescHash = e.Key;
+                entry.Key = key;
+                data.Add((const byte*)&entry, sizeof(entry));
+                header.Count++;
+            }
+        }
+        Platform::MemoryCopy(data.Get(), &header, sizeof(header));
+        File::WriteAllBytes(GetPipelineCachePath(TEXT("DX12Pipeline.list")), data);
+    }
+    _permutations.Clear();
+}
+
+ID3D12PipelineState* PipelineLibraryDX12::Load(uint32 descHash, const GPUPipelineStateKeyDX12& key, const D3D12_GRAPHICS_PIPELINE_STATE_DESC& desc)
+{
+    ScopeLock lock(_locker);
+    AddPermutation(descHash, key);
+    ID3D12PipelineState* state = nullptr;
+#if DX12_USE_PIPELINE_LIBRARY
+    if (_library)
+    {
+        const String name = String::Format(TEXT("{0:x}_{1:x}"), descHash, GetHash(key));
+        if (FAILED(_library->LoadGraphicsPipeline(*name, &desc, IID_PPV_ARGS(&state))))
+            state = nullptr;
+    }
+#endif
+    return state;
+}
+
+void PipelineLibraryDX12::Store(uint32 descHash, const GPUPipelineStateKeyDX12& key, ID3D12PipelineState* state)
+{
+#if DX12_USE_PIPELINE_LIBRARY
+    ScopeLock lock(_locker);
+    if (_library)
+    {
+        const String name = String::Format(TEXT("{0:x}_{1:x}"), descHash, GetHash(key));
+        if (SUCCEEDED(_library->StorePipeline(*name, state)))
+            _libraryDirty = true;
+    }
+#endif
+}
+
+void PipelineLibraryDX12::GetPermutations(uint32 descHash, Array<GPUPipelineStateKeyDX12>& result)
+{
+    ScopeLock lock(_locker);
+    const Array<GPUPipelineStateKeyDX12>* keys = _permutations.TryGet(descHash);
+    if (keys)
+        result.Add(*keys);
+}
+
+void PipelineLibraryDX12::AddPermutation(uint32 descHash, const GPUPipelineStateKeyDX12& key)
+{
+    auto& keys = _permutations[descHash];
+    if (!keys.Contains(key))
+    {
+        keys.Add(key);
+        _permutationsDirty = true;
+    }
+}
+
+#endif
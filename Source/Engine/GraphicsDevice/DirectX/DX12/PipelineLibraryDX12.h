@@ -0,0 +1,73 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#if GRAPHICS_API_DIRECTX12
+
+#include "GPUPipelineStateDX12.h"
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Platform/CriticalSection.h"
+
+// Enables using ID3D12PipelineLibrary to store compiled pipeline states on disk
+#define DX12_USE_PIPELINE_LIBRARY PLATFORM_WINDOWS
+
+/// <summary>
+/// Persistent pipeline states cache for DirectX 12 backend. Stores the compiled pipeline states on disk between the application runs (via ID3D12PipelineLibrary) and records the used pipeline permutations (render targets setup per pipeline description) to create them ahead when pipeline state gets initialized (eg. during content loading) instead of on the first draw.
+/// </summary>
+class PipelineLibraryDX12
+{
+private:
+    GPUDeviceDX12* _device;
+    CriticalSection _locker;
+#if DX12_USE_PIPELINE_LIBRARY
+    ID3D12PipelineLibrary* _library = nullptr;
+    Array<byte> _libraryData; // Serialized library data has to be valid for the library lifetime
+    bool _libraryDirty = false;
+#endif
+    Dictionary<uint32, Array<GPUPipelineStateKeyDX12>> _permutations;
+    bool _permutationsDirty = false;
+
+public:
+    PipelineLibraryDX12(GPUDeviceDX12* device);
+
+public:
+    /// <summary>
+    /// Loads the pipeline states cache from disk.
+    /// </summary>
+    void Init();
+
+    /// <summary>
+    /// Saves the pipeline states cache to disk and releases it.
+    /// </summary>
+    void Dispose();
+
+    /// <summary>
+    /// Tries to load the compiled pipeline state from the cache.
+    /// </summary>
+    /// <param name="descHash">The pipeline description hash (stable between the application runs).</param>
+    /// <param name="key">The pipeline render targets setup.</param>
+    /// <param name="desc">The pipeline description.</param>
+    /// <returns>The pipeline state or null if not cached.</returns>
+    ID3D12PipelineState* Load(uint32 descHash, const GPUPipelineStateKeyDX12& key, const D3D12_GRAPHICS_PIPELINE_STATE_DESC& desc);
+
+    /// <summary>
+    /// Adds the compiled pipeline state to the cache.
+    /// </summary>
+    /// <param name="descHash">The pipeline description hash (stable between the application runs).</param>
+    /// <param name="key">The pipeline render targets setup.</param>
+    /// <param name="state">The pipeline state.</param>
+    void Store(uint32 descHash, const GPUPipelineStateKeyDX12& key, ID3D12PipelineState* state);
+
+    /// <summary>
+    /// Gets the pipeline permutations used in the previous runs for a given pipeline description.
+    /// </summary>
+    /// <param name="descHash">The pipeline description hash (stable between the application runs).</param>
+    /// <param name="result">The output list of pipeline render targets setups.</param>
+    void GetPermutations(uint32 descHash, Array<GPUPipelineStateKeyDX12>& result);
+
+private:
+    void AddPermutation(uint32 descHash, const GPUPipelineStateKeyDX12& key);
+};
+
+#endif
@@ -164,6 +164,13 @@ class QueryHeapDX12
     /// <param name="handle">The query handle.</param>
     void EndQuery(GPUContextDX12* context, ElementHandle& handle);
 
+    /// <summary>
+    /// Calls EndQuery on command list for the query heap slot that has been started with BeginQuery (doesn't allocate a new slot).
+    /// </summary>
+    /// <param name="context">The context.</param>
+    /// <param name="handle">The query handle returned by BeginQuery.</param>
+    void CloseQuery(GPUContextDX12* context, ElementHandle handle);
+
     /// <summary>
     /// Determines whether the specified query handle is ready to read data (command list has been executed by the GPU).
     /// </summary>
@@ -85,6 +85,11 @@ class ResourceOwnerDX12
     /// </summary>
     ResourceStateDX12 State;
 
+    /// <summary>
+    /// True if resource is placed in the memory aliased with other resources and it has been activated so the aliasing barrier and discard of the previous memory contents are pending before its first usage.
+    /// </summary>
+    bool AliasingPending = false;
+
 public:
 
     /// <summary>
@@ -4,6 +4,7 @@
 
 #include "GPUDeviceDX12.h"
 #include "ResourceOwnerDX12.h"
+#include "Engine/Platform/CriticalSection.h"
 
 #if GRAPHICS_API_DIRECTX12
 
@@ -160,6 +161,7 @@ class UploadBufferDX12
     UploadBufferPageDX12* _currentPage;
     uint64 _currentOffset;
     uint64 _currentGeneration;
+    CriticalSection _locker;
 
     Array<UploadBufferPageDX12*, InlinedAllocation<64>> _freePages;
     Array<UploadBufferPageDX12*, InlinedAllocation<64>> _usedPages;
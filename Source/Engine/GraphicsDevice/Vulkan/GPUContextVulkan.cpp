@@ -145,6 +145,16 @@ void GPUContextVulkan::AddImageBarrier(VkImage image, VkImageLayout srcLayout, V
     imageBarrier.newLayout = dstLayout;
     _barriers.SourceStage |= RenderToolsVulkan::GetImageBarrierFlags(srcLayout, imageBarrier.srcAccessMask);
     _barriers.DestStage |= RenderToolsVulkan::GetImageBarrierFlags(dstLayout, imageBarrier.dstAccessMask);
+#if COMPILE_WITH_PROFILER
+    {
+        const auto gpuResource = handle && handle->Owner ? handle->Owner->AsGPUResource() : nullptr;
+        uint64 size = gpuResource ? gpuResource->GetMemoryUsage() : 0;
+        const int32 subresourcesCount = handle && handle->Owner ? handle->Owner->State.GetSubresourcesCount() : 0;
+        if (subresourcesCount > 1)
+            size = size * Math::Min<uint64>(subresourceRange.levelCount * subresourceRange.layerCount, subresourcesCount) / subresourcesCount;
+        RENDER_STAT_RESOURCE_BARRIER(size);
+    }
+#endif
 #if VK_ENABLE_BARRIERS_DEBUG
     LOG(Warning, "Image Barrier: 0x{0:x}, {1} -> {2} for baseMipLevel: {3}, baseArrayLayer: {4}, levelCount: {5}, layerCount: {6} ({7})",
         (uintptr)image,
@@ -306,6 +316,7 @@ void GPUContextVulkan::AddBufferBarrier(GPUBufferVulkan* buffer, VkAccessFlags d
     _barriers.SourceStage |= RenderToolsVulkan::GetBufferBarrierFlags(buffer->Access);
     _barriers.DestStage |= RenderToolsVulkan::GetBufferBarrierFlags(dstAccess);
     buffer->Access = dstAccess;
+    RENDER_STAT_RESOURCE_BARRIER(buffer->GetSize());
 
 #if !VK_ENABLE_BARRIERS_BATCHING
     // Auto-flush without batching
@@ -31,6 +31,7 @@
 #include "Engine/Engine/Engine.h"
 #include "Engine/Engine/Globals.h"
 #include "Engine/Engine/CommandLine.h"
+#include "Engine/Engine/StartupTrace.h"
 #include "Engine/Utilities/StringConverter.h"
 #include "Engine/Profiler/ProfilerCPU.h"
 #include "Engine/Threading/Threading.h"
@@ -1885,6 +1886,7 @@ bool GPUDeviceVulkan::Init()
     MainContext = New<GPUContextVulkan>(this, GraphicsQueue);
     if (vkCreatePipelineCache)
     {
+        STARTUP_TRACE_SCOPE("Pipeline Cache");
         Array<uint8> data;
         String path;
         GetPipelineCachePath(path);
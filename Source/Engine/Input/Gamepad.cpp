@@ -1,6 +1,8 @@
 // Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
 
 #include "Gamepad.h"
+#include "Input.h"
+#include "Engine/Engine/Replay.h"
 
 void GamepadLayout::Init()
 {
@@ -49,6 +51,17 @@ bool Gamepad::Update(EventQueue& queue)
     // Gather current state
     if (UpdateState())
         return true;
+    if (Replay::IsActive())
+    {
+        const uint32 index = (uint32)Input::Gamepads.Find(this);
+        Span<byte> record;
+        if (Replay::IsRecording())
+            Replay::Write(ReplayRecordType::GamepadState, index, &_state, sizeof(State));
+        else if (Replay::Read(ReplayRecordType::GamepadState, index, record) && record.Length() == sizeof(State))
+            Platform::MemoryCopy(&_state, record.Get(), sizeof(State));
+        else
+            _state.Clear();
+    }
 
     // Map state
     for (int32 i = 0; i < (int32)GamepadButton::MAX; i++)
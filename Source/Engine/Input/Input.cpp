@@ -8,6 +8,7 @@
 #include "FlaxEngine.Gen.h"
 #include "Engine/Platform/Window.h"
 #include "Engine/Engine/Engine.h"
+#include "Engine/Engine/Replay.h"
 #include "Engine/Engine/EngineService.h"
 #include "Engine/Engine/Screen.h"
 #include "Engine/Engine/Time.h"
@@ -62,6 +63,31 @@ namespace InputImpl
     bool GamepadsChanged = true;
     Array<AxisEvaluation> AxesValues;
     InputDevice::EventQueue InputEvents;
+
+    void ReplayEvents(InputDevice* device, uint32 channel)
+    {
+        auto& queue = device->GetQueue();
+        if (Replay::IsRecording())
+        {
+            for (const InputDevice::Event& e : queue)
+            {
+                InputDevice::Event event(e);
+                event.Target = nullptr;
+                Replay::Write(ReplayRecordType::InputEvent, channel, &event, sizeof(event));
+            }
+        }
+        else
+        {
+            // Replace the real input with the recorded events
+            queue.Clear();
+            Span<byte> record;
+            while (Replay::Read(ReplayRecordType::InputEvent, channel, record))
+            {
+                if (record.Length() == sizeof(InputDevice::Event))
+                    Platform::MemoryCopy(&queue.AddOne(), record.Get(), sizeof(InputDevice::Event));
+            }
+        }
+    }
 }
 
 using namespace InputImpl;
@@ -650,6 +676,8 @@ void InputService::Update()
     // Update input devices state
     if (Input::Mouse)
     {
+        if (Replay::IsActive())
+            ReplayEvents(Input::Mouse, 0);
         if (Input::Mouse->Update(InputEvents))
         {
             Input::Mouse->DeleteObject();
@@ -658,6 +686,8 @@ void InputService::Update()
     }
     if (Input::Keyboard)
     {
+        if (Replay::IsActive())
+            ReplayEvents(Input::Keyboard, 1);
         if (Input::Keyboard->Update(InputEvents))
         {
             Input::Keyboard->DeleteObject();
@@ -707,6 +737,8 @@ void InputService::Update()
         }
     }
     WindowsManager::WindowsLocker.Unlock();
+    if (!defaultWindow && Replay::IsPlaying())
+        defaultWindow = Engine::MainWindow;
 
     // Send input events for the focused window
     WindowsManager::WindowsLocker.Lock();
@@ -98,6 +98,14 @@ API_CLASS(Abstract, NoSpawn) class FLAXENGINE_API InputDevice : public Scripting
         return _name;
     }
 
+    /// <summary>
+    /// Gets the pending input events queue (gathered since the last update).
+    /// </summary>
+    FORCE_INLINE EventQueue& GetQueue()
+    {
+        return _queue;
+    }
+
     /// <summary>
     /// Resets the input device state. Called when application looses focus.
     /// </summary>
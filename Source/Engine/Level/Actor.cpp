@@ -37,6 +37,9 @@
 
 namespace
 {
+    int32 TransformUpdatesDepth = 0;
+    Array<Actor*> TransformUpdatesActors;
+
     Actor* GetChildByPrefabObjectId(Actor* a, const Guid& prefabObjectId)
     {
         Actor* result = nullptr;
@@ -84,6 +87,7 @@ Actor::Actor(const SpawnParams& params)
 {
     _drawNoCulling = 0;
     _drawCategory = 0;
+    _isTransformDirty = 0;
 }
 
 SceneRendering* Actor::GetSceneRendering() const
@@ -145,6 +149,14 @@ String Actor::ToString() const
 
 void Actor::OnDeleteObject()
 {
+    // Remove from the pending transform updates
+    if (TransformUpdatesActors.HasItems())
+    {
+        const int32 index = TransformUpdatesActors.Find(this);
+        if (index != -1)
+            TransformUpdatesActors[index] = nullptr;
+    }
+
     // Check if actor is still in game (eg. user deletes actor object via Object.Delete)
     if (IsDuringPlay())
     {
@@ -257,6 +269,17 @@ void Actor::SetParent(Actor* value, bool worldPositionsStays, bool canBreakPrefa
     }
 #endif
 
+#if BUILD_DEBUG
+    SceneTicking::CheckParallelAccess(this);
+#endif
+
+    // Apply pending transformations to have valid world transform
+    if (TransformUpdatesDepth != 0)
+    {
+        FlushTransformUpdates(this);
+        FlushTransformUpdates(value);
+    }
+
     // Peek the previous state
     const Transform prevTransform = _transform;
     const bool wasActiveInTree = IsActiveInHierarchy();
@@ -493,19 +516,24 @@ bool Actor::HasTag(const StringView& tag) const
 
 void Actor::AddTag(const Tag& tag)
 {
-    Tags.AddUnique(tag);
+    if (Tags.Contains(tag))
+        return;
+    Tags.Add(tag);
+    if (IsDuringPlay())
+        Level::indexActorTags(this, true);
 }
 
 void Actor::AddTagRecursive(const Tag& tag)
 {
     for (const auto& child : Children)
         child->AddTagRecursive(tag);
-    Tags.AddUnique(tag);
+    AddTag(tag);
 }
 
 void Actor::RemoveTag(const Tag& tag)
 {
-    Tags.Remove(tag);
+    if (Tags.Remove(tag) && IsDuringPlay())
+        Level::indexActorTags(this, true);
 }
 
 PRAGMA_DISABLE_DEPRECATION_WARNINGS
@@ -519,6 +547,8 @@ void Actor::SetTag(const StringView& value)
 {
     const Tag tag = Tags::Get(value);
     Tags.Set(&tag, 1);
+    if (IsDuringPlay())
+        Level::indexActorTags(this, true);
 }
 
 PRAGMA_ENABLE_DEPRECATION_WARNINGS
@@ -600,6 +630,9 @@ Array<Script*> Actor::GetScripts(const MClass* type) const
 
 void Actor::SetIsActive(bool value)
 {
+#if BUILD_DEBUG
+    SceneTicking::CheckParallelAccess(this);
+#endif
     if (value != GetIsActive())
     {
         _isActive = value;
@@ -618,52 +651,60 @@ void Actor::SetStaticFlags(StaticFlags value)
 void Actor::SetTransform(const Transform& value)
 {
     CHECK(!value.IsNanOrInfinity());
+    if (TransformUpdatesDepth != 0)
+        FlushTransformUpdates(_parent);
     if (!(Vector3::NearEqual(_transform.Translation, value.Translation) && Quaternion::NearEqual(_transform.Orientation, value.Orientation, ACTOR_ORIENTATION_EPSILON) && Float3::NearEqual(_transform.Scale, value.Scale)))
     {
         if (_parent)
             _parent->_transform.WorldToLocal(value, _localTransform);
         else
             _localTransform = value;
-        OnTransformChanged();
+        OnLocalTransformChanged();
     }
 }
 
 void Actor::SetPosition(const Vector3& value)
 {
     CHECK(!value.IsNanOrInfinity());
+    if (TransformUpdatesDepth != 0)
+        FlushTransformUpdates(_parent);
     if (!Vector3::NearEqual(_transform.Translation, value))
     {
         if (_parent)
             _localTransform.Translation = _parent->_transform.WorldToLocal(value);
         else
             _localTransform.Translation = value;
-        OnTransformChanged();
+        OnLocalTransformChanged();
     }
 }
 
 void Actor::SetOrientation(const Quaternion& value)
 {
     CHECK(!value.IsNanOrInfinity());
+    if (TransformUpdatesDepth != 0)
+        FlushTransformUpdates(_parent);
     if (!Quaternion::NearEqual(_transform.Orientation, value, ACTOR_ORIENTATION_EPSILON))
     {
         if (_parent)
             _parent->_transform.WorldToLocal(value, _localTransform.Orientation);
         else
             _localTransform.Orientation = value;
-        OnTransformChanged();
+        OnLocalTransformChanged();
     }
 }
 
 void Actor::SetScale(const Float3& value)
 {
     CHECK(!value.IsNanOrInfinity());
+    if (TransformUpdatesDepth != 0)
+        FlushTransformUpdates(_parent);
     if (!Float3::NearEqual(_transform.Scale, value))
     {
         if (_parent)
             Float3::Divide(value, _parent->_transform.Scale, _localTransform.Scale);
         else
             _localTransform.Scale = value;
-        OnTransformChanged();
+        OnLocalTransformChanged();
     }
 }
 
@@ -698,6 +739,35 @@ void Actor::SetDirection(const Float3& value)
     SetOrientation(orientation);
 }
 
+void Actor::BeginTransformUpdates()
+{
+    ASSERT(IsInMainThread());
+    TransformUpdatesDepth++;
+}
+
+void Actor::EndTransformUpdates()
+{
+    ASSERT(IsInMainThread());
+    CHECK(TransformUpdatesDepth > 0);
+    if (--TransformUpdatesDepth != 0 || TransformUpdatesActors.IsEmpty())
+        return;
+    PROFILE_CPU();
+
+    // Update each modified hierarchy once (from the top-most modified actor)
+    for (int32 i = 0; i < TransformUpdatesActors.Count(); i++)
+    {
+        Actor* actor = TransformUpdatesActors.Get()[i];
+        if (actor && actor->_isTransformDirty)
+            FlushTransformUpdates(actor);
+    }
+    for (Actor* actor : TransformUpdatesActors)
+    {
+        if (actor)
+            actor->_isTransformDirty = 0;
+    }
+    TransformUpdatesActors.Clear();
+}
+
 void Actor::ResetLocalTransform()
 {
     SetLocalTransform(Transform::Identity);
@@ -709,7 +779,7 @@ void Actor::SetLocalTransform(const Transform& value)
     if (!(Vector3::NearEqual(_localTransform.Translation, value.Translation) && Quaternion::NearEqual(_localTransform.Orientation, value.Orientation, ACTOR_ORIENTATION_EPSILON) && Float3::NearEqual(_localTransform.Scale, value.Scale)))
     {
         _localTransform = value;
-        OnTransformChanged();
+        OnLocalTransformChanged();
     }
 }
 
@@ -719,7 +789,7 @@ void Actor::SetLocalPosition(const Vector3& value)
     if (!Vector3::NearEqual(_localTransform.Translation, value))
     {
         _localTransform.Translation = value;
-        OnTransformChanged();
+        OnLocalTransformChanged();
     }
 }
 
@@ -731,7 +801,7 @@ void Actor::SetLocalOrientation(const Quaternion& value)
     if (!Quaternion::NearEqual(_localTransform.Orientation, v, ACTOR_ORIENTATION_EPSILON))
     {
         _localTransform.Orientation = v;
-        OnTransformChanged();
+        OnLocalTransformChanged();
     }
 }
 
@@ -741,7 +811,7 @@ void Actor::SetLocalScale(const Float3& value)
     if (!Float3::NearEqual(_localTransform.Scale, value))
     {
         _localTransform.Scale = value;
-        OnTransformChanged();
+        OnLocalTransformChanged();
     }
 }
 
@@ -864,6 +934,7 @@ void Actor::BeginPlay(SceneBeginData* data)
 
     // Set flag
     Flags |= ObjectFlags::IsDuringPlay;
+    Level::indexActor(this, true);
 
     OnBeginPlay();
 
@@ -919,6 +990,7 @@ void Actor::EndPlay()
 
     // Clear flag
     Flags &= ~ObjectFlags::IsDuringPlay;
+    Level::indexActor(this, false);
 
     // Call event deeper
     for (int32 i = 0; i < Children.Count(); i++)
@@ -1044,11 +1116,14 @@ void Actor::Deserialize(DeserializeStream& stream, ISerializeModifier* modifier)
                 }
                 else
                 {
+                    // Lock hierarchy when loading scene objects on job threads
+                    Level::ScenesLock.Lock();
                     if (_parent)
                         _parent->Children.RemoveKeepOrder(this);
                     _parent = parent;
                     if (_parent)
                         _parent->Children.Add(this);
+                    Level::ScenesLock.Unlock();
                     OnParentChanged();
                 }
             }
@@ -1092,6 +1167,8 @@ void Actor::Deserialize(DeserializeStream& stream, ISerializeModifier* modifier)
             }
         }
     }
+    if (IsDuringPlay())
+        Level::indexActorTags(this, true);
 
     {
         const auto member = stream.FindMember("PrefabID");
@@ -1171,6 +1248,7 @@ void Actor::OnParentChanged()
 void Actor::OnTransformChanged()
 {
     ASSERT_LOW_LAYER(!_localTransform.IsNanOrInfinity());
+    _isTransformDirty = 0;
 
     if (_parent)
     {
@@ -1187,6 +1265,45 @@ void Actor::OnTransformChanged()
     }
 }
 
+void Actor::OnLocalTransformChanged()
+{
+#if BUILD_DEBUG
+    SceneTicking::CheckParallelAccess(this);
+#endif
+    if (TransformUpdatesDepth == 0)
+    {
+        OnTransformChanged();
+        return;
+    }
+
+    // Update only this actor and defer the hierarchy update
+    if (_parent)
+        _parent->_transform.LocalToWorld(_localTransform, _transform);
+    else
+        _transform = _localTransform;
+    if (!_isTransformDirty)
+    {
+        _isTransformDirty = 1;
+        TransformUpdatesActors.Add(this);
+    }
+}
+
+void Actor::FlushTransformUpdates(Actor* actor)
+{
+    // Find the top-most actor with pending transform update (it updates all children)
+    Actor* dirty = nullptr;
+    for (; actor; actor = actor->_parent)
+    {
+        if (actor->_isTransformDirty)
+            dirty = actor;
+    }
+    if (dirty)
+    {
+        dirty->_isTransformDirty = 0;
+        dirty->OnTransformChanged();
+    }
+}
+
 void Actor::OnActiveChanged()
 {
     const bool wasActiveInTree = IsActiveInHierarchy();
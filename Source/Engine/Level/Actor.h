@@ -39,6 +39,7 @@ API_CLASS(Abstract) class FLAXENGINE_API Actor : public SceneObject
     uint16 _isEnabled : 1;
     uint16 _drawNoCulling : 1;
     uint16 _drawCategory : 4;
+    uint16 _isTransformDirty : 1;
     byte _layer;
     StaticFlags _staticFlags;
     Transform _localTransform;
@@ -76,6 +77,9 @@ API_CLASS(Abstract) class FLAXENGINE_API Actor : public SceneObject
     /// <summary>
     /// Actor tags collection.
     /// </summary>
+    /// <remarks>
+    /// Use AddTag/RemoveTag to modify tags of the actor during play so they are updated in the tags index used by the Level queries.
+    /// </remarks>
     API_FIELD(Attributes="NoAnimate, EditorDisplay(\"General\"), EditorOrder(-68)") Array<Tag> Tags;
 
 public:
@@ -554,6 +558,17 @@ API_CLASS(Abstract) class FLAXENGINE_API Actor : public SceneObject
     /// <param name="value">The value to set.</param>
     API_PROPERTY() void SetDirection(const Float3& value);
 
+public:
+    /// <summary>
+    /// Begins the deferred transform updates. Until the matching EndTransformUpdates call, changing the actor transform updates only that actor world transform while the children transforms and the transform change events are resolved once per modified hierarchy at the end. Use it when moving the same hierarchy multiple times (eg. vehicle with many child actors). World transform of the child actors stays outdated until the end. Can be nested. Main thread only.
+    /// </summary>
+    API_FUNCTION() static void BeginTransformUpdates();
+
+    /// <summary>
+    /// Ends the deferred transform updates. Applies the pending transformations to the modified actor hierarchies.
+    /// </summary>
+    API_FUNCTION() static void EndTransformUpdates();
+
 public:
     /// <summary>
     /// Resets the actor local transform.
@@ -1060,6 +1075,8 @@ API_CLASS(Abstract) class FLAXENGINE_API Actor : public SceneObject
 
 private:
     void SetSceneInHierarchy(Scene* scene);
+    void OnLocalTransformChanged();
+    static void FlushTransformUpdates(Actor* actor);
     void OnEnableInHierarchy();
     void OnDisableInHierarchy();
 
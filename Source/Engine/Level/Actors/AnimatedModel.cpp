@@ -14,7 +14,10 @@
 #include "Engine/Graphics/GPUContext.h"
 #include "Engine/Graphics/GPUDevice.h"
 #include "Engine/Graphics/RenderTask.h"
+#include "Engine/Graphics/RenderTools.h"
 #include "Engine/Graphics/Models/MeshDeformation.h"
+#include "Engine/Graphics/Models/BonesPalette.h"
+#include "Engine/Renderer/Utils/PreSkinning.h"
 #include "Engine/Level/Scene/Scene.h"
 #include "Engine/Level/SceneObjectsFactory.h"
 #include "Engine/Serialization/Serialization.h"
@@ -348,6 +351,9 @@ void AnimatedModel::SetBlendShapeWeight(const StringView& name, float value)
         _deformation = New<MeshDeformation>();
     Function<void(const MeshBase*, MeshDeformationData&)> deformer;
     deformer.Bind<AnimatedModel, &AnimatedModel::RunBlendShapeDeformer>(this);
+    Function<void(const MeshBase*, MeshDeformationData&, GPUContext*)> deformerGPU;
+    deformerGPU.Bind<AnimatedModel, &AnimatedModel::RunBlendShapeDeformerGPU>(this);
+    const bool useGPU = GPUDevice::Instance && GPUDevice::Instance->Limits.HasCompute;
     for (int32 i = 0; i < _blendShapeWeights.Count(); i++)
     {
         auto& e = _blendShapeWeights[i];
@@ -375,6 +381,8 @@ void AnimatedModel::SetBlendShapeWeight(const StringView& name, float value)
                                         if (blendShapeMesh.Usages == 0)
                                         {
                                             _deformation->RemoveDeformer(blendShapeMesh.LODIndex, blendShapeMesh.MeshIndex, MeshBufferType::Vertex0, deformer);
+                                            if (useGPU)
+                                                _deformation->RemoveDeformerGPU(blendShapeMesh.LODIndex, blendShapeMesh.MeshIndex, MeshBufferType::Vertex0, deformerGPU);
                                             _blendShapeMeshes.RemoveAt(j);
                                         }
                                         break;
@@ -443,6 +451,8 @@ void AnimatedModel::SetBlendShapeWeight(const StringView& name, float value)
                             blendShapeMesh.MeshIndex = mesh.GetIndex();
                             blendShapeMesh.Usages = 1;
                             _deformation->AddDeformer(blendShapeMesh.LODIndex, blendShapeMesh.MeshIndex, MeshBufferType::Vertex0, deformer);
+                            if (useGPU)
+                                _deformation->AddDeformerGPU(blendShapeMesh.LODIndex, blendShapeMesh.MeshIndex, MeshBufferType::Vertex0, deformerGPU);
                         }
                         break;
                     }
@@ -458,8 +468,13 @@ void AnimatedModel::ClearBlendShapeWeights()
     {
         Function<void(const MeshBase*, MeshDeformationData&)> deformer;
         deformer.Bind<AnimatedModel, &AnimatedModel::RunBlendShapeDeformer>(this);
+        Function<void(const MeshBase*, MeshDeformationData&, GPUContext*)> deformerGPU;
+        deformerGPU.Bind<AnimatedModel, &AnimatedModel::RunBlendShapeDeformerGPU>(this);
         for (auto e : _blendShapeMeshes)
+        {
             _deformation->RemoveDeformer(e.LODIndex, e.MeshIndex, MeshBufferType::Vertex0, deformer);
+            _deformation->RemoveDeformerGPU(e.LODIndex, e.MeshIndex, MeshBufferType::Vertex0, deformerGPU);
+        }
     }
     _blendShapeWeights.Clear();
     _blendShapeMeshes.Clear();
@@ -682,6 +697,37 @@ void AnimatedModel::RunBlendShapeDeformer(const MeshBase* mesh, MeshDeformationD
     deformation.DirtyMaxIndex = Math::Max(maxVertexIndex, deformation.DirtyMaxIndex);
 }
 
+void AnimatedModel::RunBlendShapeDeformerGPU(const MeshBase* mesh, MeshDeformationData& deformation, GPUContext* context)
+{
+    PROFILE_CPU_NAMED("BlendShapes");
+    auto* skinnedMesh = (const SkinnedMesh*)mesh;
+
+    // Gather weights of the currently active blend shapes (only weights are uploaded, blend shapes vertices are cached on a GPU)
+    Array<float, InlinedAllocation<32>> weights;
+    weights.Resize(skinnedMesh->BlendShapes.Count());
+    for (int32 i = 0; i < skinnedMesh->BlendShapes.Count(); i++)
+    {
+        const BlendShape& blendShape = skinnedMesh->BlendShapes[i];
+        float weight = 0.0f;
+        for (auto& q : _blendShapeWeights)
+        {
+            if (q.First == blendShape.Name)
+            {
+                weight = q.Second * blendShape.Weight;
+                break;
+            }
+        }
+        weights[i] = weight;
+    }
+
+    // Blend all blend shapes
+    if (PreSkinning::Instance()->ApplyBlendShapes(context, skinnedMesh, ToSpan(weights), deformation.GPUVertexBuffer))
+    {
+        // Try again next frame (eg. shader is not loaded yet)
+        deformation.Dirty = true;
+    }
+}
+
 void AnimatedModel::BeginPlay(SceneBeginData* data)
 {
     if (SkinnedModel && SkinnedModel->IsLoaded())
@@ -900,10 +946,56 @@ void AnimatedModel::Update()
     default:
         break;
     }
+    // Calculate the significance used to prioritize updates within the animations budget
+    _significance = Significance * Math::Max(_lastMaxScreenSizeSqr, 0.0001f);
+
+    // Deferred updates (over the animations budget) are retried in the next tick
+    updateAnim |= _isUpdateDeferred && _actualMode != AnimationUpdateMode::Manual;
     if (updateAnim && (UpdateWhenOffscreen || _lastMinDstSqr < MAX_Real))
         UpdateAnimation();
+    else if (_poseAlpha < 1.0f)
+        UpdatePoseInterpolation(false);
 
     _lastMinDstSqr = MAX_Real;
+    _lastMaxScreenSizeSqr = 0.0f;
+}
+
+void AnimatedModel::UpdatePoseInterpolation(bool evaluated)
+{
+    if (evaluated)
+    {
+        // Interpolate over the same amount of ticks as it took since the last evaluation
+        const uint64 frame = Engine::UpdateCount;
+        const uint64 interval = _lastEvalFrame != 0 ? Math::Min<uint64>(frame - _lastEvalFrame, 16) : 1;
+        _lastEvalFrame = frame;
+        if (!InterpolatePose || interval <= 1 || _posePrev.Count() != _skinningData.Data.Count())
+        {
+            _poseAlpha = 1.0f;
+            return;
+        }
+        _poseNext = _skinningData.Data;
+        _poseAlphaStep = 1.0f / (float)interval;
+        _poseAlpha = _poseAlphaStep;
+    }
+    else
+    {
+        if (_poseNext.Count() != _skinningData.Data.Count())
+        {
+            _poseAlpha = 1.0f;
+            return;
+        }
+        _poseAlpha = Math::Min(_poseAlpha + _poseAlphaStep, 1.0f);
+    }
+
+    // Blend bone matrices between the previously displayed pose and the latest evaluated one
+    const int32 count = _skinningData.Data.Count() / sizeof(float);
+    const float* prev = (const float*)_posePrev.Get();
+    const float* next = (const float*)_poseNext.Get();
+    float* output = (float*)_skinningData.Data.Get();
+    for (int32 i = 0; i < count; i++)
+        output[i] = Math::Lerp(prev[i], next[i], _poseAlpha);
+    if (!evaluated)
+        _skinningData.OnDataChanged(!PerBoneMotionBlur);
 }
 
 void AnimatedModel::Draw(RenderContext& renderContext)
@@ -920,10 +1012,15 @@ void AnimatedModel::Draw(RenderContext& renderContext)
     GEOMETRY_DRAW_STATE_EVENT_BEGIN(_drawState, world);
 
     _lastMinDstSqr = Math::Min(_lastMinDstSqr, Vector3::DistanceSquared(_transform.Translation, renderContext.View.WorldPosition));
+    _lastMaxScreenSizeSqr = Math::Max(_lastMaxScreenSizeSqr, RenderTools::ComputeBoundsScreenRadiusSquared(_sphere.Center - renderContext.View.Origin, (float)_sphere.Radius, renderContext.View));
     if (_skinningData.IsReady())
     {
         // Flush skinning data with GPU
-        if (_skinningData.IsDirty())
+        if (BonesPalette::IsEnabled())
+        {
+            BonesPalette::Write(_skinningData);
+        }
+        else if (_skinningData.IsDirty())
         {
             RenderContext::GPULocker.Lock();
             GPUDevice::Instance->GetMainContext()->UpdateBuffer(_skinningData.BoneMatrices, _skinningData.Data.Get(), _skinningData.Data.Count());
@@ -963,10 +1060,15 @@ void AnimatedModel::Draw(RenderContextBatch& renderContextBatch)
     GEOMETRY_DRAW_STATE_EVENT_BEGIN(_drawState, world);
 
     _lastMinDstSqr = Math::Min(_lastMinDstSqr, Vector3::DistanceSquared(_transform.Translation, renderContext.View.WorldPosition));
+    _lastMaxScreenSizeSqr = Math::Max(_lastMaxScreenSizeSqr, RenderTools::ComputeBoundsScreenRadiusSquared(_sphere.Center - renderContext.View.Origin, (float)_sphere.Radius, renderContext.View));
     if (_skinningData.IsReady())
     {
         // Flush skinning data with GPU
-        if (_skinningData.IsDirty())
+        if (BonesPalette::IsEnabled())
+        {
+            BonesPalette::Write(_skinningData);
+        }
+        else if (_skinningData.IsDirty())
         {
             RenderContext::GPULocker.Lock();
             GPUDevice::Instance->GetMainContext()->UpdateBuffer(_skinningData.BoneMatrices, _skinningData.Data.Get(), _skinningData.Data.Count());
@@ -1095,6 +1197,9 @@ void AnimatedModel::Serialize(SerializeStream& stream, const void* otherObj)
     SERIALIZE(UpdateWhenOffscreen);
     SERIALIZE(UpdateSpeed);
     SERIALIZE(UpdateMode);
+    SERIALIZE(Significance);
+    SERIALIZE(InterpolatePose);
+    SERIALIZE(PoseSharingGroup);
     SERIALIZE(BoundsScale);
     SERIALIZE(CustomBounds);
     SERIALIZE(LODBias);
@@ -1122,6 +1227,9 @@ void AnimatedModel::Deserialize(DeserializeStream& stream, ISerializeModifier* m
     DESERIALIZE(UpdateWhenOffscreen);
     DESERIALIZE(UpdateSpeed);
     DESERIALIZE(UpdateMode);
+    DESERIALIZE(Significance);
+    DESERIALIZE(InterpolatePose);
+    DESERIALIZE(PoseSharingGroup);
     DESERIALIZE(BoundsScale);
     DESERIALIZE(CustomBounds);
     DESERIALIZE(LODBias);
@@ -67,8 +67,16 @@ class FLAXENGINE_API AnimatedModel : public ModelInstanceActor
     AnimationUpdateMode _actualMode;
     uint32 _counter;
     Real _lastMinDstSqr;
+    float _lastMaxScreenSizeSqr = 0.0f;
+    float _significance = 1.0f;
     bool _isDuringUpdateEvent = false;
+    bool _isUpdateDeferred = false;
     uint64 _lastUpdateFrame;
+    uint64 _lastEvalFrame = 0;
+    float _poseAlpha = 1.0f;
+    float _poseAlphaStep = 1.0f;
+    Array<byte> _posePrev;
+    Array<byte> _poseNext;
     mutable MeshDeformation* _deformation = nullptr;
     ScriptingObjectReference<AnimatedModel> _masterPose;
     Array<Pair<String, float>> _blendShapeWeights;
@@ -119,6 +127,24 @@ class FLAXENGINE_API AnimatedModel : public ModelInstanceActor
     API_FIELD(Attributes="EditorOrder(50), DefaultValue(AnimationUpdateMode.Auto), EditorDisplay(\"Skinned Model\")")
     AnimationUpdateMode UpdateMode = AnimationUpdateMode::Auto;
 
+    /// <summary>
+    /// The gameplay importance of the animation updates (eg. higher for the player or the characters in combat). Scales the model significance (based on the screen size) used to prioritize the updates when the animations bones budget is exceeded (see Animations.BonesBudget).
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(52), DefaultValue(1.0f), Limit(0, 100, 0.01f), EditorDisplay(\"Skinned Model\")")
+    float Significance = 1.0f;
+
+    /// <summary>
+    /// If checked, the skeleton pose will be interpolated between the animation updates when the model is not updated every game update (eg. due to update mode or the animations bones budget). Smooths the motion at the cost of a slight latency.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(55), DefaultValue(false), EditorDisplay(\"Skinned Model\")")
+    bool InterpolatePose = false;
+
+    /// <summary>
+    /// The pose sharing group for the crowds. Models with the same non-zero group, the same skinned model and animation graph and equal (quantized) graph parameters evaluate the graph once per update and share the result pose (each model keeps its own transform and root motion). Animation events are invoked only by the model that evaluated the shared pose. Use different groups to keep variety within the crowd (eg. time offsets of the animations). Use 0 to disable pose sharing.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(57), DefaultValue(0), Limit(0), EditorDisplay(\"Skinned Model\")")
+    int32 PoseSharingGroup = 0;
+
     /// <summary>
     /// The master scale parameter for the actor bounding box. Helps reducing mesh flickering effect on screen edges.
     /// </summary>
@@ -403,9 +429,11 @@ class FLAXENGINE_API AnimatedModel : public ModelInstanceActor
     void ApplyRootMotion(const Transform& rootMotionDelta);
     void SyncParameters();
     void RunBlendShapeDeformer(const MeshBase* mesh, struct MeshDeformationData& deformation);
+    void RunBlendShapeDeformerGPU(const MeshBase* mesh, struct MeshDeformationData& deformation, class GPUContext* context);
 
     void Update();
     void UpdateSockets();
+    void UpdatePoseInterpolation(bool evaluated);
     void OnAnimationUpdated_Async();
     void OnAnimationUpdated_Sync();
     void OnAnimationUpdated();
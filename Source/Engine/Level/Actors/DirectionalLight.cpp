@@ -45,9 +45,11 @@ void DirectionalLight::Draw(RenderContext& renderContext)
         data.Cascade2Spacing = Cascade2Spacing;
         data.Cascade3Spacing = Cascade3Spacing;
         data.Cascade4Spacing = Cascade4Spacing;
+        data.CascadeLODBias = CascadeLODBias;
 
         data.PartitionMode = PartitionMode;
         data.ContactShadowsLength = ContactShadowsLength;
+        data.ShadowsLODBias = ShadowsLODBias;
         data.StaticFlags = GetStaticFlags();
         data.ID = GetID();
         renderContext.List->DirectionalLights.Add(data);
@@ -66,6 +68,7 @@ void DirectionalLight::Serialize(SerializeStream& stream, const void* otherObj)
     SERIALIZE(Cascade2Spacing);
     SERIALIZE(Cascade3Spacing);
     SERIALIZE(Cascade4Spacing);
+    SERIALIZE(CascadeLODBias);
 
     SERIALIZE(PartitionMode);
 }
@@ -80,6 +83,7 @@ void DirectionalLight::Deserialize(DeserializeStream& stream, ISerializeModifier
     DESERIALIZE(Cascade2Spacing);
     DESERIALIZE(Cascade3Spacing);
     DESERIALIZE(Cascade4Spacing);
+    DESERIALIZE(CascadeLODBias);
 
     DESERIALIZE(PartitionMode);
 }
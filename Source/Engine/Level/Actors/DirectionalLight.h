@@ -48,6 +48,12 @@ class FLAXENGINE_API DirectionalLight : public LightWithShadow
     API_FIELD(Attributes = "EditorOrder(69), DefaultValue(1.0f), VisibleIf(nameof(ShowCascade4)), Limit(0, 1, 0.001f), EditorDisplay(\"Shadow\")")
     float Cascade4Spacing = 1.0f;
 
+    /// <summary>
+    /// The additional model LOD bias applied per shadow cascade (the cascade index multiplied by this value is added to the shadows LOD bias). Far cascades have lower resolution so they can use lower quality LODs.
+    /// </summary>
+    API_FIELD(Attributes = "EditorOrder(70), DefaultValue(0), Limit(0, 5), EditorDisplay(\"Shadow\", \"Cascade LOD Bias\")")
+    int32 CascadeLODBias = 0;
+
 public:
     // [LightWithShadow]
     void Draw(RenderContext& renderContext) override;
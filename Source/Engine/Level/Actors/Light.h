@@ -128,6 +128,12 @@ API_CLASS(Abstract) class FLAXENGINE_API LightWithShadow : public Light
     API_FIELD(Attributes="EditorOrder(99), EditorDisplay(\"Shadow\"), Limit(0.0f, 0.1f, 0.001f)")
     float ContactShadowsLength = 0.0f;
 
+    /// <summary>
+    /// The model LOD bias applied to the shadow casters rendered into the shadow maps of this light (added to the view LOD bias). Higher values use lower quality LODs and reduce the shadows rendering cost.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(97), EditorDisplay(\"Shadow\", \"LOD Bias\"), Limit(-5, 5)")
+    int32 ShadowsLODBias = 0;
+
     /// <summary>
     /// Describes how a visual element casts shadows.
     /// </summary>
@@ -110,6 +110,7 @@ void PointLight::Draw(RenderContext& renderContext)
         data.SourceRadius = SourceRadius;
         data.SourceLength = SourceLength;
         data.ContactShadowsLength = ContactShadowsLength;
+        data.ShadowsLODBias = ShadowsLODBias;
         data.IndirectLightingIntensity = IndirectLightingIntensity;
         data.IESTexture = IESTexture ? IESTexture->GetTexture() : nullptr;
         data.StaticFlags = GetStaticFlags();
@@ -12,6 +12,7 @@
 Ragdoll::Ragdoll(const SpawnParams& params)
     : Actor(params)
 {
+    _loadNoAsync = true; // Binds to the parent animated model
 }
 
 float Ragdoll::GetTotalMass() const
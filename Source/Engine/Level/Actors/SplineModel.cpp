@@ -3,7 +3,6 @@
 #include "SplineModel.h"
 #include "Spline.h"
 #include "Engine/Core/Log.h"
-#include "Engine/Core/Math/Matrix3x4.h"
 #include "Engine/Engine/Engine.h"
 #include "Engine/Serialization/Serialization.h"
 #include "Engine/Graphics/GPUBufferDescription.h"
@@ -20,12 +19,14 @@
 #include "Editor/Editor.h"
 #endif
 
-#define SPLINE_RESOLUTION 32.0f
+// The size of the spline segment data in the deformation buffer (in float4 elements): 4 Bezier curve control points (translations, orientations and scales)
+#define SPLINE_SEGMENT_STRIDE 12
 
 SplineModel::SplineModel(const SpawnParams& params)
     : ModelInstanceActor(params)
 {
     _drawCategory = SceneRendering::SceneDrawAsync;
+    _loadNoAsync = true; // Reads the parent spline
     Model.Changed.Bind<SplineModel, &SplineModel::OnModelChanged>(this);
     Model.Loaded.Bind<SplineModel, &SplineModel::OnModelLoaded>(this);
 }
@@ -58,10 +59,7 @@ float SplineModel::GetQuality() const
 void SplineModel::SetQuality(float value)
 {
     value = Math::Clamp(value, 0.0f, 100.0f);
-    if (Math::NearEqual(value, _quality))
-        return;
     _quality = value;
-    OnSplineUpdated();
 }
 
 float SplineModel::GetBoundsScale() const
@@ -128,8 +126,6 @@ void SplineModel::OnSplineUpdated()
     // Setup model instances over the spline segments
     const auto& keyframes = _spline->Curve.GetKeyframes();
     const int32 segments = keyframes.Count() - 1;
-    const int32 chunksPerSegment = Math::Clamp(Math::CeilToInt(SPLINE_RESOLUTION * _quality), 2, 1024);
-    const float chunksPerSegmentInv = 1.0f / (float)chunksPerSegment;
     const Transform splineTransform = GetTransform();
     _instances.Resize(segments, false);
     BoundingBox localModelBounds(Vector3::Maximum, Vector3::Minimum);
@@ -176,9 +172,8 @@ void SplineModel::OnSplineUpdated()
     }
     _meshMinZ = (float)localModelBounds.Minimum.Z;
     _meshMaxZ = (float)localModelBounds.Maximum.Z;
-    Transform chunkLocal, chunkWorld, leftTangent, rightTangent;
-    Array<Vector3> segmentPoints;
-    segmentPoints.Resize(chunksPerSegment);
+    const float splineScale = splineTransform.Scale.GetAbsolute().MaxValue();
+    Transform leftTangent, rightTangent;
     for (int32 segment = 0; segment < segments; segment++)
     {
         auto& instance = _instances[segment];
@@ -188,20 +183,18 @@ void SplineModel::OnSplineUpdated()
         AnimationUtils::GetTangent(start.Value, start.TangentOut, length, leftTangent);
         AnimationUtils::GetTangent(end.Value, end.TangentIn, length, rightTangent);
 
-        // Find maximum scale over the segment spline and collect the segment positions for bounds
-        segmentPoints.Clear();
-        segmentPoints.Add(end.Value.Translation);
-        float maxScale = end.Value.Scale.GetAbsolute().MaxValue();
-        for (int32 chunk = 0; chunk < chunksPerSegment; chunk++)
+        // Bezier curve lies within the convex hull of its control points so use them for the segment bounds (without sampling the curve)
+        const Transform* points[4] = { &start.Value, &leftTangent, &rightTangent, &end.Value };
+        Vector3 segmentPoints[4];
+        float maxScale = 0.0f;
+        for (int32 i = 0; i < 4; i++)
         {
-            const float alpha = (float)chunk * chunksPerSegmentInv;
-            AnimationUtils::Bezier(start.Value, leftTangent, rightTangent, end.Value, alpha, chunkLocal);
-            splineTransform.LocalToWorld(chunkLocal, chunkWorld);
-            segmentPoints.Add(chunkWorld.Translation);
-            maxScale = Math::Max(maxScale, chunkWorld.Scale.GetAbsolute().MaxValue());
+            segmentPoints[i] = splineTransform.LocalToWorld(points[i]->Translation);
+            maxScale = Math::Max(maxScale, points[i]->Scale.GetAbsolute().MaxValue());
         }
-        BoundingSphere::FromPoints(segmentPoints.Get(), segmentPoints.Count(), instance.Sphere);
-        instance.Sphere.Radius *= maxScale * _boundsScale;
+        BoundingSphere::FromPoints(segmentPoints, 4, instance.Sphere);
+        instance.Sphere.Radius *= maxScale * splineScale * _boundsScale;
+        instance.RotDeterminant = end.Value.Scale.X * end.Value.Scale.Y * end.Value.Scale.Z;
     }
 
     // Update deformation buffer during next drawing
@@ -220,14 +213,13 @@ void SplineModel::UpdateDeformationBuffer()
 {
     PROFILE_CPU();
 
-    // Deformation buffer contains precomputed matrices for each chunk of the spline segment (packed with transposed float3x4 matrix)
+    // Deformation buffer contains the Bezier curve control points of each spline segment (curve is evaluated per-vertex in the shader)
     _deformationDirty = false;
     if (!_deformationBuffer)
         _deformationBuffer = GPUDevice::Instance->CreateBuffer(GetName());
     const auto& keyframes = _spline->Curve.GetKeyframes();
     const int32 segments = keyframes.Count() - 1;
-    const int32 chunksPerSegment = Math::Clamp(Math::CeilToInt(SPLINE_RESOLUTION * _quality), 2, 1024);
-    const int32 count = (chunksPerSegment * segments + 1) * 3;
+    const int32 count = segments * SPLINE_SEGMENT_STRIDE;
     const uint32 size = count * sizeof(Float4);
     if (_deformationBuffer->GetSize() != size)
     {
@@ -244,71 +236,26 @@ void SplineModel::UpdateDeformationBuffer()
     }
     if (!_deformationBufferData)
         _deformationBufferData = Allocator::Allocate(size);
-    _chunksPerSegment = (float)chunksPerSegment;
 
-    // Update pre-calculated matrices for spline chunks
-    auto ptr = (Matrix3x4*)_deformationBufferData;
-    const float chunksPerSegmentInv = 1.0f / (float)chunksPerSegment;
-    Matrix m;
-    Transform transform, leftTangent, rightTangent;
+    // Write segments control points (translations, orientations and scales)
+    auto ptr = (Float4*)_deformationBufferData;
+    Transform leftTangent, rightTangent;
     for (int32 segment = 0; segment < segments; segment++)
     {
-        auto& instance = _instances[segment];
         const auto& start = keyframes[segment];
         const auto& end = keyframes[segment + 1];
         const float length = end.Time - start.Time;
         AnimationUtils::GetTangent(start.Value, start.TangentOut, length, leftTangent);
         AnimationUtils::GetTangent(end.Value, end.TangentIn, length, rightTangent);
-        for (int32 chunk = 0; chunk < chunksPerSegment; chunk++)
+        const Transform* points[4] = { &start.Value, &leftTangent, &rightTangent, &end.Value };
+        for (int32 i = 0; i < 4; i++)
         {
-            const float alpha = (chunk == chunksPerSegment - 1) ? 1.0f : ((float)chunk * chunksPerSegmentInv);
-
-            // Evaluate transformation at the curve
-            AnimationUtils::Bezier(start.Value, leftTangent, rightTangent, end.Value, alpha, transform);
-
-            // Apply spline direction (from position 1st derivative)
-            Vector3 direction;
-            AnimationUtils::BezierFirstDerivative(start.Value.Translation, leftTangent.Translation, rightTangent.Translation, end.Value.Translation, alpha, direction);
-            direction.Normalize();
-            Quaternion orientation;
-            if (direction.IsZero())
-                orientation = Quaternion::Identity;
-            else if (Vector3::Dot(direction, Vector3::Up) >= 0.999f)
-                Quaternion::RotationAxis(Vector3::Left, PI_HALF, orientation);
-            else
-                Quaternion::LookRotation(direction, Vector3::Cross(Vector3::Cross(direction, Vector3::Up), direction), orientation);
-            transform.Orientation = orientation * transform.Orientation;
-
-            // Write transform into deformation buffer
-            transform.GetWorld(m);
-            ptr->SetMatrixTranspose(m);
-            ptr++;
+            const Transform& point = *points[i];
+            ptr[i] = Float4(Float3(point.Translation), 0.0f);
+            ptr[i + 4] = Float4(point.Orientation.X, point.Orientation.Y, point.Orientation.Z, point.Orientation.W);
+            ptr[i + 8] = Float4(point.Scale, 0.0f);
         }
-        instance.RotDeterminant = m.RotDeterminant();
-    }
-
-    // Add last transformation to prevent issues when sampling spline deformation buffer with alpha=1
-    {
-        const auto& start = keyframes[segments - 1];
-        const auto& end = keyframes[segments];
-        const float length = end.Time - start.Time;
-        const float alpha = 1.0f - ZeroTolerance; // Offset to prevent zero derivative at the end of the curve
-        AnimationUtils::GetTangent(start.Value, start.TangentOut, length, leftTangent);
-        AnimationUtils::GetTangent(end.Value, end.TangentIn, length, rightTangent);
-        AnimationUtils::Bezier(start.Value, leftTangent, rightTangent, end.Value, alpha, transform);
-        Vector3 direction;
-        AnimationUtils::BezierFirstDerivative(start.Value.Translation, leftTangent.Translation, rightTangent.Translation, end.Value.Translation, alpha, direction);
-        direction.Normalize();
-        Quaternion orientation;
-        if (direction.IsZero())
-            orientation = Quaternion::Identity;
-        else if (Vector3::Dot(direction, Vector3::Up) >= 0.999f)
-            Quaternion::RotationAxis(Vector3::Left, PI_HALF, orientation);
-        else
-            Quaternion::LookRotation(direction, Vector3::Cross(Vector3::Cross(direction, Vector3::Up), direction), orientation);
-        transform.Orientation = orientation * transform.Orientation;
-        transform.GetWorld(m);
-        ptr->SetMatrixTranspose(m);
+        ptr += SPLINE_SEGMENT_STRIDE;
     }
 
     // Flush data with GPU
@@ -401,7 +348,6 @@ void SplineModel::Draw(RenderContext& renderContext)
     DrawCall drawCall;
     drawCall.InstanceCount = 1;
     drawCall.Deformable.SplineDeformation = _deformationBuffer;
-    drawCall.Deformable.ChunksPerSegment = _chunksPerSegment;
     drawCall.Deformable.MeshMinZ = _meshMinZ;
     drawCall.Deformable.MeshMaxZ = _meshMaxZ;
     drawCall.Deformable.GeometrySize = _box.GetSize();
@@ -443,7 +389,7 @@ void SplineModel::Draw(RenderContext& renderContext)
 
             // Cache data
             const auto& entry = Entries[mesh->GetMaterialSlotIndex()];
-            if (!entry.Visible || !mesh->IsInitialized())
+            if (!entry.Visible || !mesh->IsInitialized() || mesh->GetPositionsQuantization().IsValid()) // Deformable materials don't decode quantized positions
                 continue;
             const MaterialSlot& slot = model->MaterialSlots[mesh->GetMaterialSlotIndex()];
 
@@ -29,7 +29,7 @@ API_CLASS() class FLAXENGINE_API SplineModel : public ModelInstanceActor
     Spline* _spline = nullptr;
     GPUBuffer* _deformationBuffer = nullptr;
     void* _deformationBufferData = nullptr;
-    float _chunksPerSegment, _meshMinZ, _meshMaxZ;
+    float _meshMinZ, _meshMaxZ;
 
 public:
     ~SplineModel();
@@ -58,13 +58,13 @@ API_CLASS() class FLAXENGINE_API SplineModel : public ModelInstanceActor
     DrawPass DrawModes = DrawPass::Default;
 
     /// <summary>
-    /// Gets the spline model quality scale. Higher values improve the spline representation (better tessellation) but reduce performance.
+    /// Gets the spline model quality scale. Not used anymore (the spline curve is evaluated per-vertex on the GPU), kept for the compatibility.
     /// </summary>
-    API_PROPERTY(Attributes="EditorOrder(11), DefaultValue(1.0f), EditorDisplay(\"Model\"), Limit(0.1f, 100.0f, 0.1f)")
+    API_PROPERTY(Attributes="HideInEditor, DefaultValue(1.0f)")
     float GetQuality() const;
 
     /// <summary>
-    /// Sets the spline model quality scale. Higher values improve the spline representation (better tessellation) but reduce performance.
+    /// Sets the spline model quality scale. Not used anymore (the spline curve is evaluated per-vertex on the GPU), kept for the compatibility.
     /// </summary>
     API_PROPERTY() void SetQuality(float value);
 
@@ -220,6 +220,7 @@ void StaticModel::RemoveVertexColors()
         SAFE_DELETE_GPU_RESOURCE(_vertexColorsBuffer[lodIndex]);
     _vertexColorsCount = 0;
     _vertexColorsDirty = false;
+    _drawCache.Clear();
 }
 
 void StaticModel::OnModelChanged()
@@ -231,6 +232,7 @@ void StaticModel::OnModelChanged()
     }
     RemoveVertexColors();
     Entries.Release();
+    _drawCache.Clear();
     if (Model && !Model->IsLoaded())
         UpdateBounds();
     if (_deformation)
@@ -282,12 +284,14 @@ void StaticModel::UpdateBounds()
         _box = BoundingBox(_transform.Translation);
     }
     BoundingSphere::FromBox(_box, _sphere);
+    _drawCache.Clear();
     if (_sceneRenderingKey != -1)
         GetSceneRendering()->UpdateActor(this, _sceneRenderingKey);
 }
 
 void StaticModel::FlushVertexColors()
 {
+    _drawCache.Clear();
     RenderContext::GPULocker.Lock();
     for (int32 lodIndex = 0; lodIndex < _vertexColorsCount; lodIndex++)
     {
@@ -392,6 +396,13 @@ void StaticModel::Draw(RenderContextBatch& renderContextBatch)
     draw.SortOrder = _sortOrder;
     draw.VertexColors = _vertexColorsCount ? _vertexColorsBuffer : nullptr;
 
+    if (EnumHasAllFlags(_staticFlags, StaticFlags::Transform) && !_deformation)
+    {
+        // Reuse draw calls built in the previous frames for static objects
+        _drawCache.Prepare(renderContext.View.Origin, _staticFlags, draw.Lightmap, Lightmap.UVsArea);
+        draw.DrawCache = &_drawCache;
+    }
+
     Model->Draw(renderContextBatch, draw);
 
     GEOMETRY_DRAW_STATE_EVENT_END(_drawState, world);
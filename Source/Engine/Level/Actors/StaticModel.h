@@ -27,6 +27,7 @@ class FLAXENGINE_API StaticModel : public ModelInstanceActor
     GPUBuffer* _vertexColorsBuffer[MODEL_MAX_LODS];
     Model* _residencyChangedModel = nullptr;
     mutable MeshDeformation* _deformation = nullptr;
+    MeshDrawCache _drawCache;
 
 public:
     /// <summary>
@@ -6,9 +6,14 @@
 #include "SceneQuery.h"
 #include "SceneObjectsFactory.h"
 #include "Scene/Scene.h"
+#include "Actors/Camera.h"
 #include "Engine/Content/Content.h"
+#include "Engine/Content/ContentPrefetch.h"
 #include "Engine/Core/Cache.h"
 #include "Engine/Core/Collections/CollectionPoolCache.h"
+#include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Core/Collections/HashSet.h"
+#include "Engine/Core/Collections/Sorting.h"
 #include "Engine/Core/ObjectsRemovalService.h"
 #include "Engine/Core/Config/LayersTagsSettings.h"
 #include "Engine/Core/Types/LayersMask.h"
@@ -20,6 +25,7 @@
 #include "Engine/Engine/EngineService.h"
 #include "Engine/Threading/Threading.h"
 #include "Engine/Threading/JobSystem.h"
+#include "Engine/Threading/Task.h"
 #include "Engine/Platform/File.h"
 #include "Engine/Platform/FileSystem.h"
 #include "Engine/Profiler/ProfilerCPU.h"
@@ -34,6 +40,7 @@
 #include "Engine/Serialization/JsonTools.h"
 #include "Engine/Serialization/Serialization.h"
 #include "Engine/Serialization/JsonWriters.h"
+#include "Engine/Serialization/JsonBinary.h"
 #include "Prefabs/Prefab.h"
 #if USE_EDITOR
 #include "Editor/Editor.h"
@@ -74,6 +81,7 @@ enum class SceneEventType
     OnSceneLoadError = 5,
     OnSceneUnloading = 6,
     OnSceneUnloaded = 7,
+    OnSceneActivated = 8,
 };
 
 class SceneAction
@@ -110,6 +118,45 @@ namespace LevelImpl
     Array<SceneAction*> _sceneActions;
     CriticalSection _sceneActionsLocker;
     DateTime _lastSceneLoadTime(0);
+
+    // Scene actors that wait for the activation (see Level::SceneActivationTimeBudget)
+    struct PendingActivation
+    {
+        Guid SceneId;
+        int32 Index;
+        Array<Guid> Actors;
+    };
+
+    Array<PendingActivation> _pendingActivations;
+
+    // Scene saved asynchronously (snapshot captured on the main thread, formatting and file writing on a thread pool)
+    struct AsyncSceneSave
+    {
+        enum class States
+        {
+            Pending,
+            Writing,
+            Done,
+            Failed,
+        };
+
+        Guid SceneId;
+        String Path;
+        rapidjson_flax::StringBuffer Data;
+        Stopwatch Time;
+        States State = States::Pending;
+    };
+
+    CriticalSection _asyncSavesLocker;
+    Array<AsyncSceneSave*> _asyncSaves;
+    bool _asyncSavesRunning = false;
+
+    // Index of the scene objects during play (queries use it instead of traversing the scenes hierarchy)
+    CriticalSection _indexLocker;
+    Dictionary<Tag, HashSet<Actor*>> _indexTags;
+    Dictionary<Actor*, Array<Tag>> _indexActorTags;
+    Dictionary<const MClass*, HashSet<Actor*>> _indexActors;
+    Dictionary<const MClass*, HashSet<Script*>> _indexScripts;
 #if USE_EDITOR
     Array<ScriptsReloadObject> ScriptsReloadObjects;
 #endif
@@ -123,6 +170,10 @@ namespace LevelImpl
     bool saveScene(Scene* scene, const String& path);
     bool saveScene(Scene* scene, rapidjson_flax::StringBuffer& outBuffer, bool prettyJson);
     bool saveScene(Scene* scene, rapidjson_flax::StringBuffer& outBuffer, JsonWriter& writer);
+    bool saveSceneAsync(Scene* scene);
+    void writeAsyncSaves();
+    void finishAsyncSaves();
+    void waitForAsyncSaves();
     bool spawnActor(Actor* actor, Actor* parent);
     bool deleteActor(Actor* actor);
 }
@@ -149,6 +200,7 @@ LevelService LevelServiceInstanceService;
 CriticalSection Level::ScenesLock;
 Array<Scene*> Level::Scenes;
 bool Level::TickEnabled = true;
+float Level::SceneActivationTimeBudget = 0.0f;
 Delegate<Actor*> Level::ActorSpawned;
 Delegate<Actor*> Level::ActorDeleted;
 Delegate<Actor*, Actor*> Level::ActorParentChanged;
@@ -161,6 +213,7 @@ Delegate<Scene*, const Guid&> Level::SceneSaveError;
 Delegate<Scene*, const Guid&> Level::SceneLoading;
 Delegate<Scene*, const Guid&> Level::SceneLoaded;
 Delegate<Scene*, const Guid&> Level::SceneLoadError;
+Delegate<Scene*, const Guid&> Level::SceneActivated;
 Delegate<Scene*, const Guid&> Level::SceneUnloading;
 Delegate<Scene*, const Guid&> Level::SceneUnloaded;
 #if USE_EDITOR
@@ -273,6 +326,7 @@ void LayersAndTagsSettings::Apply()
 
 void LevelService::Update()
 {
+    Level::updateActivation(false);
     TICK_LEVEL(Update, "Level::Update")
     TICK_LEVEL_EDITOR(Update)
 }
@@ -282,6 +336,7 @@ void LevelService::LateUpdate()
     TICK_LEVEL(LateUpdate, "Level::LateUpdate")
     TICK_LEVEL_EDITOR(LateUpdate)
     flushActions();
+    finishAsyncSaves();
 }
 
 void LevelService::FixedUpdate()
@@ -303,11 +358,21 @@ void LevelService::Dispose()
 {
     ScopeLock lock(_sceneActionsLocker);
 
+    // Complete scenes saving
+    waitForAsyncSaves();
+    finishAsyncSaves();
+
     // Unload scenes
     unloadScenes();
 
     // Ensure that all scenes and actors has been destroyed (we don't leak!)
     ASSERT(Level::Scenes.IsEmpty());
+
+    // Clear scene objects index (objects types are unloaded with the scripting)
+    _indexTags.Clear();
+    _indexActorTags.Clear();
+    _indexActors.Clear();
+    _indexScripts.Clear();
 }
 
 bool Level::IsAnyActorInGame()
@@ -416,9 +481,21 @@ class LoadSceneAction : public SceneAction
             return true;
         }
 
+        // Record the assets used by the scene to prefetch them next time
+        bool record = ContentPrefetch::EnableRecording;
+#if USE_EDITOR
+        record &= Editor::IsPlayMode;
+#endif
+        if (record)
+            ContentPrefetch::BeginRecording(SceneId);
+
         // Load scene
-        if (Level::loadScene(SceneAsset))
+        const bool failed = Level::loadScene(SceneAsset);
+        ContentPrefetch::ReleasePrefetched(SceneId);
+        if (failed)
         {
+            if (record)
+                ContentPrefetch::EndRecording();
             LOG(Error, "Failed to deserialize scene {0}", SceneId);
             CallSceneEvent(SceneEventType::OnSceneLoadError, nullptr, SceneId);
             return true;
@@ -465,16 +542,18 @@ class SaveSceneAction : public SceneAction
 public:
     Scene* TargetScene;
     bool PrettyJson;
+    bool Async;
 
-    SaveSceneAction(Scene* scene, bool prettyJson = true)
+    SaveSceneAction(Scene* scene, bool prettyJson = true, bool async = false)
     {
         TargetScene = scene;
         PrettyJson = prettyJson;
+        Async = async;
     }
 
     bool Do() const override
     {
-        if (saveScene(TargetScene))
+        if (Async ? saveSceneAsync(TargetScene) : saveScene(TargetScene))
         {
             LOG(Error, "Failed to save scene {0}", TargetScene ? TargetScene->GetName() : String::Empty);
             return true;
@@ -703,6 +782,9 @@ void LevelImpl::CallSceneEvent(SceneEventType eventType, Scene* scene, Guid scen
     case SceneEventType::OnSceneUnloaded:
         Level::SceneUnloaded(scene, sceneId);
         break;
+    case SceneEventType::OnSceneActivated:
+        Level::SceneActivated(scene, sceneId);
+        break;
     }
 }
 
@@ -793,6 +875,14 @@ bool LevelImpl::unloadScene(Scene* scene)
 
     // Remove from scenes list
     Level::Scenes.Remove(scene);
+    for (int32 i = 0; i < _pendingActivations.Count(); i++)
+    {
+        if (_pendingActivations[i].SceneId == sceneId)
+        {
+            _pendingActivations.RemoveAtKeepOrder(i);
+            break;
+        }
+    }
 
     // Fire event
     CallSceneEvent(SceneEventType::OnSceneUnloaded, scene, sceneId);
@@ -838,16 +928,28 @@ bool Level::loadScene(const BytesContainer& sceneData, Scene** outScene)
         return true;
     }
 
-    // Parse scene JSON file
+    // Parse scene JSON file (or read the binary one)
     rapidjson_flax::Document document;
+    if (JsonBinary::IsBinary(sceneData.Get(), sceneData.Length()))
     {
-        PROFILE_CPU_NAMED("Json.Parse");
-        document.Parse(sceneData.Get<char>(), sceneData.Length());
+        PROFILE_CPU_NAMED("Json.ReadBinary");
+        if (JsonBinary::Read(sceneData.Get(), sceneData.Length(), document))
+        {
+            LOG(Error, "Invalid binary scene data.");
+            return true;
+        }
     }
-    if (document.HasParseError())
+    else
     {
-        Log::JsonParseException(document.GetParseError(), document.GetErrorOffset());
-        return true;
+        {
+            PROFILE_CPU_NAMED("Json.Parse");
+            document.Parse(sceneData.Get<char>(), sceneData.Length());
+        }
+        if (document.HasParseError())
+        {
+            Log::JsonParseException(document.GetParseError(), document.GetErrorOffset());
+            return true;
+        }
     }
 
     ScopeLock lock(ScenesLock);
@@ -939,6 +1041,7 @@ bool Level::loadScene(rapidjson_flax::Value& data, int32 engineBuild, Scene** ou
     // Spawn all scene objects
     SceneObjectsFactory::Context context(modifier.Value);
     context.Async = JobSystem::GetThreadsCount() > 1 && dataCount > 10;
+    const JobPriority jobsPriority = IsInMainThread() ? JobPriority::Normal : JobPriority::Background; // Don't delay frame jobs when loading in async
     {
         PROFILE_CPU_NAMED("Spawn");
         SceneObject** objects = sceneObjects->Get();
@@ -961,7 +1064,7 @@ bool Level::loadScene(rapidjson_flax::Value& data, int32 engineBuild, Scene** ou
                 }
                 else
                     SceneObjectsFactory::HandleObjectDeserializationError(stream);
-            }, dataCount - 1);
+            }, dataCount - 1, 1, jobsPriority);
             ScenesLock.Lock();
         }
         else
@@ -992,26 +1095,60 @@ bool Level::loadScene(rapidjson_flax::Value& data, int32 engineBuild, Scene** ou
     {
         PROFILE_CPU_NAMED("Deserialize");
         SceneObject** objects = sceneObjects->Get();
-        bool wasAsync = context.Async;
-        context.Async = false; // TODO: before doing full async for scene objects fix:
-        // TODO: - fix Actor's Scripts and Children order when loading objects data out of order via async jobs
-        // TODO: - add _loadNoAsync flag to SceneObject or Actor to handle non-async loading for those types (eg. UIControl/UICanvas)
         if (context.Async)
         {
+            // Deserialize objects on job threads except the ones that don't support it (eg. UIControl/UICanvas or managed types)
             ScenesLock.Unlock(); // Unlock scenes from Main Thread so Job Threads can use it to safely setup actors hierarchy (see Actor::Deserialize)
             JobSystem::Execute([&](int32 i)
             {
                 i++; // Start from 1. at index [0] was scene
                 auto obj = objects[i];
-                if (obj)
+                if (obj && !obj->_loadNoAsync)
                 {
                     auto& idMapping = Scripting::ObjectsLookupIdMapping.Get();
                     idMapping = &context.GetModifier()->IdsMapping;
                     SceneObjectsFactory::Deserialize(context, obj, data[i]);
                     idMapping = nullptr;
                 }
-            }, dataCount - 1);
+            }, dataCount - 1, 1, jobsPriority);
             ScenesLock.Lock();
+            {
+                PROFILE_CPU_NAMED("NoAsync");
+                Scripting::ObjectsLookupIdMapping.Set(&modifier.Value->IdsMapping);
+                for (int32 i = 1; i < dataCount; i++) // start from 1. at index [0] was scene
+                {
+                    auto obj = objects[i];
+                    if (obj && obj->_loadNoAsync)
+                        SceneObjectsFactory::Deserialize(context, obj, data[i]);
+                }
+                Scripting::ObjectsLookupIdMapping.Set(nullptr);
+            }
+
+            // Restore the order of children and scripts (objects got linked to their parents in order of deserialization)
+            // Objects added by prefabs synchronization were linked before deserialization so they go first
+            const int32 objectsCount = sceneObjects->Count();
+            for (int32 i = 0; i < objectsCount; i++)
+            {
+                if (auto actor = dynamic_cast<Actor*>(objects[i]))
+                {
+                    actor->Children.Clear();
+                    actor->Scripts.Clear();
+                }
+            }
+            auto linkObject = [](SceneObject* obj)
+            {
+                Actor* parent = obj ? obj->GetParent() : nullptr;
+                if (!parent)
+                    return;
+                if (auto actor = dynamic_cast<Actor*>(obj))
+                    parent->Children.Add(actor);
+                else if (auto script = dynamic_cast<Script*>(obj))
+                    parent->Scripts.Add(script);
+            };
+            for (int32 i = dataCount; i < objectsCount; i++)
+                linkObject(objects[i]);
+            for (int32 i = 1; i < dataCount; i++)
+                linkObject(objects[i]);
         }
         else
         {
@@ -1025,7 +1162,6 @@ bool Level::loadScene(rapidjson_flax::Value& data, int32 engineBuild, Scene** ou
             }
             Scripting::ObjectsLookupIdMapping.Set(nullptr);
         }
-        context.Async = wasAsync;
     }
 
     // /\ all above this has to be done on multiple threads at once
@@ -1068,6 +1204,43 @@ bool Level::loadScene(rapidjson_flax::Value& data, int32 engineBuild, Scene** ou
     // /\ all above this has to be done on an any thread
     // \/ all below this has to be done on a main thread
 
+    // Prepare time-sliced activation (actors are kept inactive in hierarchy during BeginPlay and get enabled within the next frames)
+    const bool timeSliced = SceneActivationTimeBudget > 0.0f;
+    if (timeSliced)
+    {
+        PROFILE_CPU_NAMED("Prepare Activation");
+        struct ActivationItem
+        {
+            Real Distance;
+            Actor* Target;
+
+            bool operator<(const ActivationItem& other) const
+            {
+                return Distance < other.Distance;
+            }
+        };
+        Array<ActivationItem> items;
+        items.EnsureCapacity(sceneObjects->Count());
+        const Camera* camera = Camera::GetMainCamera();
+        const Vector3 viewPosition = camera ? camera->GetPosition() : Vector3::Zero;
+        for (int32 i = 1; i < sceneObjects->Count(); i++)
+        {
+            auto actor = dynamic_cast<Actor*>(sceneObjects->At(i));
+            if (actor && actor->_isActiveInHierarchy)
+            {
+                actor->_isActiveInHierarchy = false;
+                items.Add({ Vector3::DistanceSquared(viewPosition, actor->GetPosition()), actor });
+            }
+        }
+        Sorting::QuickSort(items);
+        auto& pending = _pendingActivations.AddOne();
+        pending.SceneId = sceneId;
+        pending.Index = 0;
+        pending.Actors.Resize(items.Count());
+        for (int32 i = 0; i < items.Count(); i++)
+            pending.Actors[i] = items[i].Target->GetID();
+    }
+
     // Link scene and call init
     {
         PROFILE_CPU_NAMED("BeginPlay");
@@ -1081,6 +1254,8 @@ bool Level::loadScene(rapidjson_flax::Value& data, int32 engineBuild, Scene** ou
 
     // Fire event
     CallSceneEvent(SceneEventType::OnSceneLoaded, scene, sceneId);
+    if (!timeSliced)
+        CallSceneEvent(SceneEventType::OnSceneActivated, scene, sceneId);
 
     stopwatch.Stop();
     LOG(Info, "Scene loaded in {0}ms", stopwatch.GetMilliseconds());
@@ -1114,6 +1289,9 @@ bool LevelImpl::saveScene(Scene* scene, const String& path)
     LOG(Info, "Saving scene {0} to \'{1}\'", scene->GetName(), path);
     Stopwatch stopwatch;
 
+    // Ensure the async saves don't override the file afterwards
+    waitForAsyncSaves();
+
     // Serialize to json
     rapidjson_flax::StringBuffer buffer;
     if (saveScene(scene, buffer, true) && buffer.GetSize() > 0)
@@ -1201,6 +1379,144 @@ bool LevelImpl::saveScene(Scene* scene, rapidjson_flax::StringBuffer& outBuffer,
     return false;
 }
 
+bool LevelImpl::saveSceneAsync(Scene* scene)
+{
+#if USE_EDITOR
+    ASSERT(scene && EnumHasNoneFlags(scene->Flags, ObjectFlags::WasMarkedToDelete));
+    const auto path = scene->GetPath();
+    if (path.IsEmpty())
+    {
+        LOG(Error, "Missing scene path.");
+        return true;
+    }
+    const auto sceneId = scene->GetID();
+    LOG(Info, "Saving scene {0} to \'{1}\' (async)", scene->GetName(), path);
+
+    // Capture the scene snapshot as compact json (pretty formatting is done with the file writing on a thread pool)
+    auto save = New<AsyncSceneSave>();
+    save->SceneId = sceneId;
+    save->Path = path;
+    if (saveScene(scene, save->Data, false))
+    {
+        Delete(save);
+        CallSceneEvent(SceneEventType::OnSceneSaveError, scene, sceneId);
+        return true;
+    }
+    save->Time.Stop();
+    LOG(Info, "Scene snapshot captured in {0}ms", save->Time.GetMilliseconds());
+
+    // Writes are processed in order by a single task so the same file is never written concurrently
+    ScopeLock lock(_asyncSavesLocker);
+    _asyncSaves.Add(save);
+    if (!_asyncSavesRunning)
+    {
+        _asyncSavesRunning = true;
+        Task::StartNew(writeAsyncSaves);
+    }
+    return false;
+#else
+    LOG(Error, "Cannot save data to the cooked content.");
+    return false;
+#endif
+}
+
+void LevelImpl::writeAsyncSaves()
+{
+    PROFILE_CPU_NAMED("Level.WriteScenes");
+    while (true)
+    {
+        AsyncSceneSave* save = nullptr;
+        _asyncSavesLocker.Lock();
+        for (AsyncSceneSave* e : _asyncSaves)
+        {
+            if (e->State == AsyncSceneSave::States::Pending)
+            {
+                save = e;
+                break;
+            }
+        }
+        if (!save)
+        {
+            _asyncSavesRunning = false;
+            _asyncSavesLocker.Unlock();
+            return;
+        }
+        save->State = AsyncSceneSave::States::Writing;
+        _asyncSavesLocker.Unlock();
+
+        // Format json (streamed from the compact snapshot) and write to the temporary file that is moved into the scene location
+        rapidjson_flax::StringBuffer buffer;
+        PrettyJsonWriterImpl writer(buffer);
+        rapidjson::Reader reader;
+        rapidjson::StringStream stream(save->Data.GetString());
+        bool failed = reader.Parse<rapidjson::kParseNumbersAsStringsFlag>(stream, writer).IsError();
+        if (!failed)
+        {
+            const String tmpPath = save->Path + TEXT(".tmp");
+            failed = File::WriteAllBytes(tmpPath, (byte*)buffer.GetString(), (int32)buffer.GetSize()) || FileSystem::MoveFile(save->Path, tmpPath, true);
+        }
+        save->Data.Clear();
+
+        _asyncSavesLocker.Lock();
+        save->State = failed ? AsyncSceneSave::States::Failed : AsyncSceneSave::States::Done;
+        _asyncSavesLocker.Unlock();
+    }
+}
+
+void LevelImpl::finishAsyncSaves()
+{
+    // Fire events for the completed saves on the main thread
+    Array<AsyncSceneSave*, InlinedAllocation<8>> completed;
+    _asyncSavesLocker.Lock();
+    for (int32 i = 0; i < _asyncSaves.Count(); i++)
+    {
+        AsyncSceneSave* save = _asyncSaves[i];
+        if (save->State == AsyncSceneSave::States::Done || save->State == AsyncSceneSave::States::Failed)
+        {
+            completed.Add(save);
+            _asyncSaves.RemoveAtKeepOrder(i--);
+        }
+    }
+    _asyncSavesLocker.Unlock();
+    for (AsyncSceneSave* save : completed)
+    {
+        Scene* scene = Level::FindScene(save->SceneId);
+        if (save->State == AsyncSceneSave::States::Failed)
+        {
+            LOG(Error, "Cannot save scene file \'{0}\'", save->Path);
+            CallSceneEvent(SceneEventType::OnSceneSaveError, scene, save->SceneId);
+        }
+        else
+        {
+            save->Time.Stop();
+            LOG(Info, "Scene saved! Time {0}ms", save->Time.GetMilliseconds());
+#if USE_EDITOR
+            // Reload asset at the target location if is loaded
+            Asset* asset = Content::GetAsset(save->SceneId);
+            if (!asset)
+                asset = Content::GetAsset(save->Path);
+            if (asset)
+                asset->Reload();
+#endif
+            CallSceneEvent(SceneEventType::OnSceneSaved, scene, save->SceneId);
+        }
+        Delete(save);
+    }
+}
+
+void LevelImpl::waitForAsyncSaves()
+{
+    while (true)
+    {
+        _asyncSavesLocker.Lock();
+        const bool running = _asyncSavesRunning;
+        _asyncSavesLocker.Unlock();
+        if (!running)
+            break;
+        Platform::Sleep(1);
+    }
+}
+
 bool Level::SaveScene(Scene* scene, bool prettyJson)
 {
     ScopeLock lock(_sceneActionsLocker);
@@ -1244,7 +1560,7 @@ Array<byte> Level::SaveSceneToBytes(Scene* scene, bool prettyJson)
 void Level::SaveSceneAsync(Scene* scene)
 {
     ScopeLock lock(_sceneActionsLocker);
-    _sceneActions.Enqueue(New<SaveSceneAction>(scene));
+    _sceneActions.Enqueue(New<SaveSceneAction>(scene, true, true));
 }
 
 bool Level::SaveAllScenes()
@@ -1262,7 +1578,7 @@ void Level::SaveAllScenesAsync()
 {
     ScopeLock lock(_sceneActionsLocker);
     for (int32 i = 0; i < Scenes.Count(); i++)
-        _sceneActions.Enqueue(New<SaveSceneAction>(Scenes[i]));
+        _sceneActions.Enqueue(New<SaveSceneAction>(Scenes[i], true, true));
 }
 
 bool Level::LoadScene(const Guid& id)
@@ -1292,17 +1608,23 @@ bool Level::LoadScene(const Guid& id)
         return true;
     }
 
+    // Start loading all the assets known to be used by the scene
+    ContentPrefetch::PrefetchScene(id);
+
     // Preload scene asset
     const auto sceneAsset = Content::LoadAsync<JsonAsset>(id);
     if (sceneAsset == nullptr)
     {
+        ContentPrefetch::ReleasePrefetched(id);
         LOG(Error, "Cannot load scene asset.");
         return true;
     }
 
     // Load scene
     ScopeLock lock(ScenesLock);
-    if (loadScene(sceneAsset))
+    const bool failed = loadScene(sceneAsset);
+    ContentPrefetch::ReleasePrefetched(id);
+    if (failed)
     {
         LOG(Error, "Failed to deserialize scene {0}", id);
         CallSceneEvent(SceneEventType::OnSceneLoadError, nullptr, id);
@@ -1331,10 +1653,14 @@ bool Level::LoadSceneAsync(const Guid& id)
         return true;
     }
 
+    // Start loading all the assets known to be used by the scene
+    ContentPrefetch::PrefetchScene(id);
+
     // Preload scene asset
     const auto sceneAsset = Content::LoadAsync<JsonAsset>(id);
     if (sceneAsset == nullptr)
     {
+        ContentPrefetch::ReleasePrefetched(id);
         LOG(Error, "Cannot load scene asset.");
         return true;
     }
@@ -1345,6 +1671,156 @@ bool Level::LoadSceneAsync(const Guid& id)
     return false;
 }
 
+bool Level::IsSceneActivated(const Scene* scene)
+{
+    if (scene == nullptr)
+        return false;
+    for (const auto& e : _pendingActivations)
+    {
+        if (e.SceneId == scene->GetID())
+            return false;
+    }
+    return true;
+}
+
+void Level::ActivateScene(Scene* scene)
+{
+    if (scene == nullptr)
+    {
+        Log::ArgumentNullException();
+        return;
+    }
+    updateActivation(true, scene);
+}
+
+void Level::activateActor(Actor* actor)
+{
+    if (!actor->_isActive || actor->_isActiveInHierarchy || !actor->IsDuringPlay())
+        return;
+    Actor* parent = actor->GetParent();
+    if (!parent)
+        return;
+    if (!parent->_isActiveInHierarchy)
+    {
+        // Activate parents first
+        activateActor(parent);
+        if (!parent->_isActiveInHierarchy)
+            return;
+    }
+    actor->_isActiveInHierarchy = true;
+    if (actor->GetScene() && !actor->_isEnabled)
+        actor->OnEnable();
+}
+
+void Level::updateActivation(bool force, const Scene* scene)
+{
+    if (_pendingActivations.IsEmpty())
+        return;
+    PROFILE_CPU_NAMED("Level.Activation");
+    ScopeLock lock(ScenesLock);
+    force |= SceneActivationTimeBudget <= 0.0f;
+    const double endTime = Platform::GetTimeSeconds() + SceneActivationTimeBudget * 0.001;
+    for (int32 i = 0; i < _pendingActivations.Count(); i++)
+    {
+        auto& e = _pendingActivations[i];
+        if (scene && e.SceneId != scene->GetID())
+            continue;
+        while (e.Index < e.Actors.Count())
+        {
+            // Check the time budget every few actors
+            if (!force && e.Index % 16 == 0 && Platform::GetTimeSeconds() >= endTime)
+                return;
+            if (Actor* actor = Scripting::TryFindObject<Actor>(e.Actors[e.Index]))
+                activateActor(actor);
+            e.Index++;
+        }
+
+        // Scene is fully active
+        const Guid sceneId = e.SceneId;
+        _pendingActivations.RemoveAtKeepOrder(i--);
+        if (Scene* activatedScene = Scripting::TryFindObject<Scene>(sceneId))
+            CallSceneEvent(SceneEventType::OnSceneActivated, activatedScene, sceneId);
+    }
+}
+
+namespace
+{
+    template<typename T>
+    void RemoveFromIndex(Dictionary<const MClass*, HashSet<T*>>& index, const MClass* type, T* obj)
+    {
+        auto it = index.Find(type);
+        if (it.IsEnd())
+            return;
+        it->Value.Remove(obj);
+        if (it->Value.IsEmpty())
+            index.Remove(it); // Don't keep types that can be unloaded (eg. on scripts reload)
+    }
+
+    bool IsInLevel(const Actor* actor, bool activeOnly)
+    {
+        if (activeOnly && !actor->IsActiveInHierarchy())
+            return false;
+        Scene* scene = actor->GetScene();
+        return scene && Level::Scenes.Contains(scene);
+    }
+}
+
+void Level::indexActor(Actor* actor, bool add)
+{
+    const MClass* type = actor->GetClass();
+    ScopeLock lock(_indexLocker);
+    if (type)
+    {
+        if (add)
+            _indexActors[type].Add(actor);
+        else
+            RemoveFromIndex(_indexActors, type, actor);
+    }
+    indexActorTags(actor, add);
+}
+
+void Level::indexActorTags(Actor* actor, bool add)
+{
+    ScopeLock lock(_indexLocker);
+
+    // Remove previously indexed tags (tags collection could be modified directly)
+    auto it = _indexActorTags.Find(actor);
+    if (it.IsNotEnd())
+    {
+        for (const Tag& tag : it->Value)
+        {
+            auto e = _indexTags.Find(tag);
+            if (e.IsNotEnd())
+            {
+                e->Value.Remove(actor);
+                if (e->Value.IsEmpty())
+                    _indexTags.Remove(e);
+            }
+        }
+        _indexActorTags.Remove(it);
+    }
+
+    // Add current tags
+    if (add && actor->Tags.HasItems())
+    {
+        for (const Tag& tag : actor->Tags)
+            _indexTags[tag].Add(actor);
+        _indexActorTags[actor] = actor->Tags;
+    }
+}
+
+void Level::indexScript(Script* script, bool add)
+{
+    const MClass* type = script->GetClass();
+    if (!type)
+        return;
+    ScopeLock lock(_indexLocker);
+    if (add)
+        _indexScripts[type].Add(script);
+    else
+        RemoveFromIndex(_indexScripts, type, script);
+}
+
 bool Level::UnloadScene(Scene* scene)
 {
     return unloadScene(scene);
@@ -1396,21 +1872,37 @@ Actor* Level::FindActor(const StringView& name)
 Actor* Level::FindActor(const MClass* type, bool activeOnly)
 {
     CHECK_RETURN(type, nullptr);
-    Actor* result = nullptr;
     ScopeLock lock(ScenesLock);
-    for (int32 i = 0; result == nullptr && i < Scenes.Count(); i++)
-        result = Scenes[i]->FindActor(type, activeOnly);
-    return result;
+    ScopeLock indexLock(_indexLocker);
+    for (const auto& e : _indexActors)
+    {
+        if (!e.Key->IsSubClassOf(type))
+            continue;
+        for (const auto& actor : e.Value)
+        {
+            if (IsInLevel(actor.Item, activeOnly))
+                return actor.Item;
+        }
+    }
+    return nullptr;
 }
 
 Actor* Level::FindActor(const MClass* type, const StringView& name)
 {
     CHECK_RETURN(type, nullptr);
-    Actor* result = nullptr;
     ScopeLock lock(ScenesLock);
-    for (int32 i = 0; result == nullptr && i < Scenes.Count(); i++)
-        result = Scenes[i]->FindActor(type, name);
-    return result;
+    ScopeLock indexLock(_indexLocker);
+    for (const auto& e : _indexActors)
+    {
+        if (!e.Key->IsSubClassOf(type))
+            continue;
+        for (const auto& actor : e.Value)
+        {
+            if (actor.Item->GetName() == name && IsInLevel(actor.Item, false))
+                return actor.Item;
+        }
+    }
+    return nullptr;
 }
 
 Actor* FindActorRecursive(Actor* node, const Tag& tag, bool activeOnly)
@@ -1477,14 +1969,17 @@ Actor* Level::FindActor(const Tag& tag, bool activeOnly, Actor* root)
     PROFILE_CPU();
     if (root)
         return FindActorRecursive(root, tag, activeOnly);
-    Actor* result = nullptr;
-    for (Scene* scene : Scenes)
+    ScopeLock lock(ScenesLock);
+    ScopeLock indexLock(_indexLocker);
+    if (const HashSet<Actor*>* actors = _indexTags.TryGet(tag))
     {
-        result = FindActorRecursive(scene, tag, activeOnly);
-        if (result)
-            break;
+        for (const auto& actor : *actors)
+        {
+            if (actor.Item->HasTag(tag) && IsInLevel(actor.Item, activeOnly))
+                return actor.Item;
+        }
     }
-    return result;
+    return nullptr;
 }
 
 Actor* Level::FindActor(const MClass* type, const Tag& tag, bool activeOnly, Actor* root)
@@ -1492,11 +1987,17 @@ Actor* Level::FindActor(const MClass* type, const Tag& tag, bool activeOnly, Act
     CHECK_RETURN(type, nullptr);
     if (root)
         return FindActorRecursiveByType(root, type, tag, activeOnly);
-    Actor* result = nullptr;
     ScopeLock lock(ScenesLock);
-    for (int32 i = 0; result == nullptr && i < Scenes.Count(); i++)
-        result = Scenes[i]->FindActor(type, tag, activeOnly);
-    return result;
+    ScopeLock indexLock(_indexLocker);
+    if (const HashSet<Actor*>* actors = _indexTags.TryGet(tag))
+    {
+        for (const auto& actor : *actors)
+        {
+            if (actor.Item->HasTag(tag) && actor.Item->GetClass()->IsSubClassOf(type) && IsInLevel(actor.Item, activeOnly))
+                return actor.Item;
+        }
+    }
+    return nullptr;
 }
 
 void FindActorRecursive(Actor* node, const Tag& tag, Array<Actor*>& result)
@@ -1518,8 +2019,16 @@ Array<Actor*> Level::FindActors(const Tag& tag, const bool activeOnly, Actor* ro
     else
     {
         ScopeLock lock(ScenesLock);
-        for (Scene* scene : Scenes)
-            FindActorsRecursive(scene, tag, activeOnly, result);
+        ScopeLock indexLock(_indexLocker);
+        if (const HashSet<Actor*>* actors = _indexTags.TryGet(tag))
+        {
+            result.EnsureCapacity(actors->Count());
+            for (const auto& actor : *actors)
+            {
+                if (actor.Item->HasTag(tag) && IsInLevel(actor.Item, activeOnly))
+                    result.Add(actor.Item);
+            }
+        }
     }
     return result;
 }
@@ -1547,8 +2056,25 @@ Array<Actor*> Level::FindActorsByParentTag(const Tag& parentTag, const bool acti
     else
     {
         ScopeLock lock(ScenesLock);
-        for (Scene* scene : Scenes)
-            FindActorsRecursiveByParentTags(scene, subTags, activeOnly, result);
+        ScopeLock indexLock(_indexLocker);
+        for (int32 i = 0; i < subTags.Count(); i++)
+        {
+            const HashSet<Actor*>* actors = _indexTags.TryGet(subTags[i]);
+            if (!actors)
+                continue;
+            for (const auto& actor : *actors)
+            {
+                if (!actor.Item->HasTag(subTags[i]) || !IsInLevel(actor.Item, activeOnly))
+                    continue;
+
+                // Skip actors already added with the previous tags
+                bool added = false;
+                for (int32 j = 0; j < i && !added; j++)
+                    added = actor.Item->HasTag(subTags[j]);
+                if (!added)
+                    result.Add(actor.Item);
+            }
+        }
     }
 
     return result;
@@ -1557,33 +2083,20 @@ Array<Actor*> Level::FindActorsByParentTag(const Tag& parentTag, const bool acti
 Script* Level::FindScript(const MClass* type)
 {
     CHECK_RETURN(type, nullptr);
-    Script* result = nullptr;
     ScopeLock lock(ScenesLock);
-    for (int32 i = 0; result == nullptr && i < Scenes.Count(); i++)
-        result = Scenes[i]->FindScript(type);
-    return result;
-}
-
-namespace
-{
-    void GetActors(const MClass* type, Actor* actor, bool activeOnly, Array<Actor*>& result)
-    {
-        if (activeOnly && !actor->GetIsActive())
-            return;
-        if (actor->GetClass()->IsSubClassOf(type))
-            result.Add(actor);
-        for (auto child : actor->Children)
-            GetActors(type, child, activeOnly, result);
-    }
-
-    void GetScripts(const MClass* type, Actor* actor, Array<Script*>& result)
+    ScopeLock indexLock(_indexLocker);
+    for (const auto& e : _indexScripts)
     {
-        for (auto script : actor->Scripts)
-            if (script->GetClass()->IsSubClassOf(type))
-                result.Add(script);
-        for (auto child : actor->Children)
-            GetScripts(type, child, result);
+        if (!e.Key->IsSubClassOf(type))
+            continue;
+        for (const auto& script : e.Value)
+        {
+            const Actor* parent = script.Item->GetParent();
+            if (parent && IsInLevel(parent, false))
+                return script.Item;
+        }
     }
+    return nullptr;
 }
 
 Array<Actor*> Level::GetActors(const MClass* type, bool activeOnly)
@@ -1591,8 +2104,18 @@ Array<Actor*> Level::GetActors(const MClass* type, bool activeOnly)
     Array<Actor*> result;
     CHECK_RETURN(type, result);
     ScopeLock lock(ScenesLock);
-    for (int32 i = 0; i < Scenes.Count(); i++)
-        ::GetActors(type, Scenes[i], activeOnly, result);
+    ScopeLock indexLock(_indexLocker);
+    for (const auto& e : _indexActors)
+    {
+        if (!e.Key->IsSubClassOf(type))
+            continue;
+        result.EnsureCapacity(result.Count() + e.Value.Count());
+        for (const auto& actor : e.Value)
+        {
+            if (IsInLevel(actor.Item, activeOnly))
+                result.Add(actor.Item);
+        }
+    }
     return result;
 }
 
@@ -1601,8 +2124,19 @@ Array<Script*> Level::GetScripts(const MClass* type)
     Array<Script*> result;
     CHECK_RETURN(type, result);
     ScopeLock lock(ScenesLock);
-    for (int32 i = 0; i < Scenes.Count(); i++)
-        ::GetScripts(type, Scenes[i], result);
+    ScopeLock indexLock(_indexLocker);
+    for (const auto& e : _indexScripts)
+    {
+        if (!e.Key->IsSubClassOf(type))
+            continue;
+        result.EnsureCapacity(result.Count() + e.Value.Count());
+        for (const auto& script : e.Value)
+        {
+            const Actor* parent = script.Item->GetParent();
+            if (parent && IsInLevel(parent, false))
+                result.Add(script.Item);
+        }
+    }
     return result;
 }
 
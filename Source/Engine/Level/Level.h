@@ -26,10 +26,12 @@ API_CLASS(Static) class FLAXENGINE_API Level
     DECLARE_SCRIPTING_TYPE_NO_SPAWN(Level);
     friend Engine;
     friend Actor;
+    friend Script;
     friend PrefabManager;
     friend Prefab;
     friend PrefabInstanceData;
     friend class LoadSceneAction;
+    friend class LevelService;
 #if USE_EDITOR
     friend class ReloadScriptsAction;
 #endif
@@ -50,6 +52,11 @@ API_CLASS(Static) class FLAXENGINE_API Level
     /// </summary>
     API_FIELD() static bool TickEnabled;
 
+    /// <summary>
+    /// The time budget (in milliseconds) per frame for activating actors of the loaded scene (OnEnable events of actors and scripts that register them in rendering, physics and scripts ticking). Activation gets spread across multiple frames, starting from the actors closest to the main camera. Use 0 to activate the whole scene at once when it's loaded (default).
+    /// </summary>
+    API_FIELD() static float SceneActivationTimeBudget;
+
 public:
     /// <summary>
     /// Occurs when new actor gets spawned to the game.
@@ -206,6 +213,11 @@ API_CLASS(Static) class FLAXENGINE_API Level
     /// </summary>
     API_EVENT() static Delegate<Scene*, const Guid&> SceneLoadError;
 
+    /// <summary>
+    /// Fired when all actors of the loaded scene got activated. Called after SceneLoaded (in the later frames when using SceneActivationTimeBudget).
+    /// </summary>
+    API_EVENT() static Delegate<Scene*, const Guid&> SceneActivated;
+
     /// <summary>
     /// Fired when scene gets unloading.
     /// </summary>
@@ -273,7 +285,7 @@ API_CLASS(Static) class FLAXENGINE_API Level
     API_FUNCTION() static Array<byte> SaveSceneToBytes(Scene* scene, bool prettyJson = true);
 
     /// <summary>
-    /// Saves scene to the asset. Done in the background.
+    /// Saves scene to the asset. Done in the background: the scene snapshot is captured on the main thread and the json formatting and file writing run on a thread pool (SceneSaved event is called on the main thread once the file is written).
     /// </summary>
     /// <param name="scene">Scene to serialize.</param>
     API_FUNCTION() static void SaveSceneAsync(Scene* scene);
@@ -310,6 +322,19 @@ API_CLASS(Static) class FLAXENGINE_API Level
     /// <returns>True if loading cannot be done, otherwise false.</returns>
     API_FUNCTION() static bool LoadSceneAsync(const Guid& id);
 
+    /// <summary>
+    /// Checks if all actors of the loaded scene got activated (see SceneActivationTimeBudget).
+    /// </summary>
+    /// <param name="scene">The scene.</param>
+    /// <returns>True if scene is fully activated, otherwise false.</returns>
+    API_FUNCTION() static bool IsSceneActivated(const Scene* scene);
+
+    /// <summary>
+    /// Activates all the remaining actors of the loaded scene immediately (eg. when gameplay needs to wait for the full scene activation).
+    /// </summary>
+    /// <param name="scene">The scene.</param>
+    API_FUNCTION() static void ActivateScene(Scene* scene);
+
     /// <summary>
     /// Unloads given scene.
     /// </summary>
@@ -398,6 +423,7 @@ API_CLASS(Static) class FLAXENGINE_API Level
     /// <param name="activeOnly">Find only active actors.</param>
     /// <param name="root">The custom root actor to start searching from (hierarchical), otherwise null to search all loaded scenes.</param>
     /// <returns>Found actors or empty if none.</returns>
+    /// <remarks>Searching all loaded scenes uses the tags index of actors during play (without the scene hierarchy traversal) so the order of the found actors is not defined.</remarks>
     API_FUNCTION() static Array<Actor*> FindActors(const Tag& tag, const bool activeOnly = false, Actor* root = nullptr);
 
     /// <summary>
@@ -465,6 +491,7 @@ API_CLASS(Static) class FLAXENGINE_API Level
     /// <param name="type">Type of the actor to search for. Includes any actors derived from the type.</param>
     /// <param name="activeOnly">Finds only active actors in the scene.</param>
     /// <returns>Found actors list.</returns>
+    /// <remarks>Uses the types index of actors during play (without the scene hierarchy traversal) so the order of the found actors is not defined.</remarks>
     API_FUNCTION() static Array<Actor*> GetActors(API_PARAM(Attributes="TypeReference(typeof(Actor))") const MClass* type, bool activeOnly = false);
 
     /// <summary>
@@ -472,6 +499,7 @@ API_CLASS(Static) class FLAXENGINE_API Level
     /// </summary>
     /// <param name="type">Type of the script to search for. Includes any scripts derived from the type.</param>
     /// <returns>Found scripts list.</returns>
+    /// <remarks>Uses the types index of scripts during play (without the scene hierarchy traversal) so the order of the found scripts is not defined.</remarks>
     API_FUNCTION() static Array<Script*> GetScripts(API_PARAM(Attributes="TypeReference(typeof(Script))") const MClass* type);
 
     /// <summary>
@@ -546,6 +574,15 @@ API_CLASS(Static) class FLAXENGINE_API Level
 
     static void callActorEvent(ActorEventType eventType, Actor* a, Actor* b);
 
+    // Scene activation API
+    static void activateActor(Actor* actor);
+    static void updateActivation(bool force, const Scene* scene = nullptr);
+
+    // Scene objects index API (contains objects during play, used by the actors and scripts queries)
+    static void indexActor(Actor* actor, bool add);
+    static void indexActorTags(Actor* actor, bool add);
+    static void indexScript(Script* script, bool add);
+
     // All loadScene assume that ScenesLock has been taken by the calling thread
     static bool loadScene(JsonAsset* sceneAsset);
     static bool loadScene(const BytesContainer& sceneData, Scene** outScene = nullptr);
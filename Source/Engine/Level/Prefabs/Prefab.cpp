@@ -9,6 +9,7 @@
 #include "Engine/Level/Actor.h"
 #include "Engine/Threading/Threading.h"
 #include "Engine/Scripting/Scripting.h"
+#include "Engine/Profiler/ProfilerCPU.h"
 
 REGISTER_JSON_ASSET(Prefab, "FlaxEngine.Prefab", true);
 
@@ -17,6 +18,7 @@ Prefab::Prefab(const SpawnParams& params, const AssetInfo* info)
     , _isCreatingDefaultInstance(false)
     , _defaultInstance(nullptr)
     , ObjectsCount(0)
+    , RootObjectIndex(-1)
 {
 }
 
@@ -94,10 +96,42 @@ SceneObject* Prefab::GetDefaultInstance(const Guid& objectId)
     return result;
 }
 
+void Prefab::CacheSpawnData()
+{
+    ScopeLock lock(Locker);
+    if (ObjectsTypes.Count() == ObjectsCount)
+        return;
+    PROFILE_CPU();
+
+    // Find the root object
+    const Guid rootObjectId = GetRootObjectId();
+    RootObjectIndex = ObjectsIds.Find(rootObjectId);
+
+    // Resolve the objects types to skip type lookups when spawning prefab (nested prefab instances and old data format use the default path)
+    const auto& data = *Data;
+    ObjectsTypes.Resize(ObjectsCount);
+    for (int32 i = 0; i < ObjectsCount; i++)
+    {
+        ScriptingTypeHandle& type = ObjectsTypes[i];
+        type = ScriptingTypeHandle();
+        auto& objData = data[i];
+        if (JsonTools::GetGuid(objData, "PrefabObjectID").IsValid())
+            continue;
+        const auto typeNameMember = objData.FindMember("TypeName");
+        if (typeNameMember == objData.MemberEnd() || !typeNameMember->value.IsString())
+            continue;
+        const ScriptingTypeHandle objType = Scripting::FindScriptingType(typeNameMember->value.GetStringAnsiView());
+        if (objType && SceneObject::TypeInitializer.IsAssignableFrom(objType))
+            type = objType;
+    }
+}
+
 void Prefab::DeleteDefaultInstance()
 {
     ScopeLock lock(Locker);
     ObjectsCache.Clear();
+    ObjectsTypes.Resize(0);
+    RootObjectIndex = -1;
     if (_defaultInstance)
     {
         _defaultInstance->DeleteObject();
@@ -188,6 +222,8 @@ void Prefab::unload(bool isReloading)
     ObjectsDataCache.SetCapacity(0);
     ObjectsCache.Clear();
     ObjectsCache.SetCapacity(0);
+    ObjectsTypes.Resize(0);
+    RootObjectIndex = -1;
     if (_defaultInstance)
     {
         _defaultInstance->DeleteObject();
@@ -5,6 +5,7 @@
 #include "Engine/Content/JsonAsset.h"
 #include "Engine/Core/Collections/Array.h"
 #include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Scripting/ScriptingType.h"
 
 class Actor;
 class SceneObject;
@@ -46,6 +47,16 @@ API_CLASS(NoSpawn) class FLAXENGINE_API Prefab : public JsonAssetBase
     /// </summary>
     Dictionary<Guid, SceneObject*> ObjectsCache;
 
+    /// <summary>
+    /// The objects types resolved from the prefab data (matches ObjectsIds order). Used to spawn prefab objects without the data lookup. Contains invalid handle for objects that need to be spawned from data (eg. nested prefab instances). Valid only if asset is loaded and CacheSpawnData was called.
+    /// </summary>
+    Array<ScriptingTypeHandle> ObjectsTypes;
+
+    /// <summary>
+    /// The index of the prefab root object within ObjectsIds (or -1 if unknown). Valid only if asset is loaded and CacheSpawnData was called.
+    /// </summary>
+    int32 RootObjectIndex;
+
 public:
     /// <summary>
     /// Gets the root object identifier (prefab object ID). Asset must be loaded.
@@ -65,6 +76,11 @@ API_CLASS(NoSpawn) class FLAXENGINE_API Prefab : public JsonAssetBase
     /// <returns>The object of the prefab loaded from the prefab. Contains the default values. It's not added to gameplay but deserialized with postLoad and init event fired.</returns>
     API_FUNCTION() SceneObject* GetDefaultInstance(API_PARAM(Ref) const Guid& objectId);
 
+    /// <summary>
+    /// Resolves the data used to spawn the prefab objects (ObjectsTypes and RootObjectIndex). Skips if already done. Asset must be loaded.
+    /// </summary>
+    void CacheSpawnData();
+
 #if USE_EDITOR
     /// <summary>
     /// Applies the difference from the prefab object instance, saves the changes and synchronizes them with the active instances of the prefab asset.
@@ -126,10 +126,20 @@ Actor* PrefabManager::SpawnPrefab(Prefab* prefab, const Transform& transform, Ac
     // Deserialize prefab objects
     auto prevIdMapping = Scripting::ObjectsLookupIdMapping.Get();
     Scripting::ObjectsLookupIdMapping.Set(&modifier.Value->IdsMapping);
+    prefab->CacheSpawnData();
     for (int32 i = 0; i < dataCount; i++)
     {
         auto& stream = data[i];
-        SceneObject* obj = SceneObjectsFactory::Spawn(context, stream);
+        SceneObject* obj;
+        const ScriptingTypeHandle& type = prefab->ObjectsTypes.Get()[i];
+        if (type)
+        {
+            // Spawn object of the type resolved from prefab data
+            const ScriptingObjectSpawnParams params(modifier->IdsMapping.At(prefab->ObjectsIds.Get()[i]), type);
+            obj = (SceneObject*)type.GetType().Script.Spawn(params);
+        }
+        else
+            obj = SceneObjectsFactory::Spawn(context, stream);
         sceneObjects->At(i) = obj;
         if (obj)
             obj->RegisterObject();
@@ -163,12 +173,8 @@ Actor* PrefabManager::SpawnPrefab(Prefab* prefab, const Transform& transform, Ac
 
     // Pick prefab root object
     Actor* root = nullptr;
-    const Guid prefabRootObjectId = prefab->GetRootObjectId();
-    for (int32 i = 0; i < dataCount && !root; i++)
-    {
-        if (JsonTools::GetGuid(data[i], "ID") == prefabRootObjectId)
-            root = dynamic_cast<Actor*>(sceneObjects->At(i));
-    }
+    if (prefab->RootObjectIndex != -1)
+        root = dynamic_cast<Actor*>(sceneObjects->At(prefab->RootObjectIndex));
     if (!root)
     {
         // Fallback to the first actor that has no parent
@@ -0,0 +1,194 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "PrefabPool.h"
+#include "Prefab.h"
+#include "PrefabManager.h"
+#include "Engine/Core/Log.h"
+#include "Engine/Core/Cache.h"
+#include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Core/Collections/CollectionPoolCache.h"
+#include "Engine/Debug/Exceptions/ArgumentNullException.h"
+#include "Engine/Level/Level.h"
+#include "Engine/Level/ActorsCache.h"
+#include "Engine/Level/SceneQuery.h"
+#include "Engine/Level/SceneObjectsFactory.h"
+#include "Engine/Level/Scene/Scene.h"
+#include "Engine/Level/Actors/EmptyActor.h"
+#include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Scripting/Scripting.h"
+#include "Engine/Serialization/JsonTools.h"
+
+namespace
+{
+    // Pooled instances ids per prefab id (objects are found by id to handle instances deleted with the scene)
+    Dictionary<Guid, Array<Guid>> Pools;
+
+    // Hidden inactive actors that hold pooled instances per scene id
+    Dictionary<Guid, Guid> Holders;
+
+    Actor* GetHolder(Scene* scene)
+    {
+        Guid holderId;
+        if (Holders.TryGet(scene->GetID(), holderId))
+        {
+            if (Actor* holder = Scripting::TryFindObject<Actor>(holderId))
+                return holder;
+        }
+        Actor* holder = EmptyActor::Spawn(ScriptingObject::SpawnParams(Guid::New(), EmptyActor::TypeInitializer));
+        holder->SetName(TEXT("PrefabPool"));
+        holder->HideFlags = HideFlags::FullyHidden;
+        holder->SetIsActive(false);
+        holder->SetParent(scene, false);
+        Holders[scene->GetID()] = holder->GetID();
+        return holder;
+    }
+
+    void ResetInstance(Prefab* prefab, Actor* root, Actor* holder)
+    {
+        PROFILE_CPU_NAMED("Prefab.Reset");
+        const Guid prefabId = prefab->GetID();
+        CollectionPoolCache<ActorsCache::SceneObjectsListType>::ScopeCache sceneObjects = ActorsCache::SceneObjectsListCache.Get();
+        SceneQuery::GetAllSceneObjects(root, *sceneObjects);
+        CollectionPoolCache<ISerializeModifier, Cache::ISerializeModifierClearCallback>::ScopeCache modifier = Cache::ISerializeModifier.Get();
+        modifier->EngineBuild = prefab->DataEngineBuild;
+
+        // Map prefab objects to the instance objects (including objects of the nested prefabs)
+        for (int32 i = 0; i < sceneObjects->Count(); i++)
+        {
+            SceneObject* obj = sceneObjects->At(i);
+            const ISerializable::DeserializeStream* data;
+            if (obj->GetPrefabID() != prefabId || !prefab->ObjectsDataCache.TryGet(obj->GetPrefabObjectID(), data))
+            {
+                // Skip objects added at runtime
+                sceneObjects->At(i) = nullptr;
+                continue;
+            }
+            modifier->IdsMapping[obj->GetPrefabObjectID()] = obj->GetID();
+            Guid nestedPrefabObjectId;
+            if (JsonTools::GetGuidIfValid(nestedPrefabObjectId, *data, "PrefabObjectID"))
+                modifier->IdsMapping[nestedPrefabObjectId] = obj->GetID();
+        }
+
+        // Keep root linked to the pool holder
+        Guid rootParentId;
+        if (JsonTools::GetGuidIfValid(rootParentId, *prefab->ObjectsDataCache[root->GetPrefabObjectID()], "ParentID"))
+            modifier->IdsMapping[rootParentId] = holder->GetID();
+
+        // Restore the prefab defaults
+        SceneObjectsFactory::Context context(modifier.Value);
+        auto prevIdMapping = Scripting::ObjectsLookupIdMapping.Get();
+        Scripting::ObjectsLookupIdMapping.Set(&modifier.Value->IdsMapping);
+        for (SceneObject* obj : *sceneObjects)
+        {
+            if (obj)
+                SceneObjectsFactory::Deserialize(context, obj, *(ISerializable::DeserializeStream*)prefab->ObjectsDataCache[obj->GetPrefabObjectID()]);
+        }
+        Scripting::ObjectsLookupIdMapping.Set(prevIdMapping);
+        if (root->GetParent() != holder)
+            root->SetParent(holder, false);
+    }
+}
+
+void PrefabPool::Warm(Prefab* prefab, int32 count)
+{
+    PROFILE_CPU();
+    if (prefab == nullptr)
+    {
+        Log::ArgumentNullException();
+        return;
+    }
+    if (Level::Scenes.IsEmpty())
+    {
+        LOG(Warning, "Cannot warm prefab pool without a loaded scene.");
+        return;
+    }
+    Actor* holder = GetHolder(Level::Scenes[0]);
+    auto& pool = Pools[prefab->GetID()];
+    while (pool.Count() < count)
+    {
+        Actor* instance = PrefabManager::SpawnPrefab(prefab, holder, Transform::Identity);
+        if (!instance)
+            break;
+        pool.Add(instance->GetID());
+    }
+}
+
+Actor* PrefabPool::Spawn(Prefab* prefab, const Transform& transform)
+{
+    Actor* parent = Level::Scenes.Count() != 0 ? Level::Scenes.Get()[0] : nullptr;
+    return Spawn(prefab, parent, transform);
+}
+
+Actor* PrefabPool::Spawn(Prefab* prefab, Actor* parent, const Transform& transform)
+{
+    PROFILE_CPU();
+    if (prefab == nullptr)
+    {
+        Log::ArgumentNullException();
+        return nullptr;
+    }
+
+    // Reuse pooled instance
+    Array<Guid>* pool = Pools.TryGet(prefab->GetID());
+    while (pool && pool->HasItems() && parent && parent->GetScene())
+    {
+        const Guid instanceId = pool->Pop();
+        Actor* instance = Scripting::TryFindObject<Actor>(instanceId);
+        Actor* holder = instance ? instance->GetParent() : nullptr;
+        if (!holder || !holder->GetScene() || EnumHasAnyFlags(instance->Flags, ObjectFlags::WasMarkedToDelete))
+            continue;
+
+        // Update instance while it's still inactive and then enable it
+        ResetInstance(prefab, instance, holder);
+        instance->SetTransform(transform);
+        instance->SetParent(parent, true);
+        return instance;
+    }
+
+    return PrefabManager::SpawnPrefab(prefab, parent, transform);
+}
+
+void PrefabPool::Release(Actor* instance)
+{
+    PROFILE_CPU();
+    if (instance == nullptr)
+    {
+        Log::ArgumentNullException();
+        return;
+    }
+    if (EnumHasAnyFlags(instance->Flags, ObjectFlags::WasMarkedToDelete))
+        return;
+    Scene* scene = instance->GetScene();
+    if (!instance->IsPrefabRoot() || !scene)
+    {
+        instance->DeleteObject();
+        return;
+    }
+    Actor* holder = GetHolder(scene);
+    if (instance->GetParent() == holder)
+        return;
+    instance->SetParent(holder, true);
+    Pools[instance->GetPrefabID()].Add(instance->GetID());
+}
+
+int32 PrefabPool::GetCount(Prefab* prefab)
+{
+    const Array<Guid>* pool = prefab ? Pools.TryGet(prefab->GetID()) : nullptr;
+    return pool ? pool->Count() : 0;
+}
+
+void PrefabPool::Clear(Prefab* prefab)
+{
+    PROFILE_CPU();
+    for (auto& e : Pools)
+    {
+        if (prefab && e.Key != prefab->GetID())
+            continue;
+        for (const Guid& instanceId : e.Value)
+        {
+            if (Actor* instance = Scripting::TryFindObject<Actor>(instanceId))
+                instance->DeleteObject();
+        }
+        e.Value.Clear();
+    }
+}
@@ -0,0 +1,63 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Scripting/ScriptingType.h"
+
+class Prefab;
+class Actor;
+struct Transform;
+
+/// <summary>
+/// The pool of prefab instances for frequently spawned objects (eg. projectiles, hit effects or enemies). Released instances are deactivated (parented to the hidden inactive actor in the scene) instead of being destroyed and get reset to the prefab defaults when spawned again.
+/// </summary>
+/// <remarks>
+/// Pooled instance objects are created only once so their scripts receive OnAwake and OnStart once, while OnEnable and OnDisable are called on every spawn and release. Objects added to the instance at runtime (not from prefab) are kept as-is. Scripting API is not thread-safe and should be used only from the main thread.
+/// </remarks>
+API_CLASS(Static) class FLAXENGINE_API PrefabPool
+{
+    DECLARE_SCRIPTING_TYPE_NO_SPAWN(PrefabPool);
+
+    /// <summary>
+    /// Creates the prefab instances and adds them to the pool (up to the given amount of pooled instances).
+    /// </summary>
+    /// <param name="prefab">The prefab asset.</param>
+    /// <param name="count">The amount of the pooled prefab instances to have.</param>
+    API_FUNCTION() static void Warm(Prefab* prefab, int32 count);
+
+    /// <summary>
+    /// Spawns the instance of the prefab from the pool (or creates a new one if pool is empty). Prefab will be spawned to the first loaded scene.
+    /// </summary>
+    /// <param name="prefab">The prefab asset.</param>
+    /// <param name="transform">The spawn transformation in the world space.</param>
+    /// <returns>The spawned actor (root) or null if failed.</returns>
+    API_FUNCTION() static Actor* Spawn(Prefab* prefab, const Transform& transform);
+
+    /// <summary>
+    /// Spawns the instance of the prefab from the pool (or creates a new one if pool is empty).
+    /// </summary>
+    /// <param name="prefab">The prefab asset.</param>
+    /// <param name="parent">The parent actor to add spawned object instance.</param>
+    /// <param name="transform">The spawn transformation in the world space.</param>
+    /// <returns>The spawned actor (root) or null if failed.</returns>
+    API_FUNCTION() static Actor* Spawn(Prefab* prefab, Actor* parent, const Transform& transform);
+
+    /// <summary>
+    /// Releases the prefab instance back to the pool (deactivates it). Actors that are not prefab roots are destroyed.
+    /// </summary>
+    /// <param name="instance">The prefab instance root actor (spawned from the prefab).</param>
+    API_FUNCTION() static void Release(Actor* instance);
+
+    /// <summary>
+    /// Gets the amount of the pooled (not spawned) instances of the prefab.
+    /// </summary>
+    /// <param name="prefab">The prefab asset.</param>
+    /// <returns>The pooled instances count.</returns>
+    API_FUNCTION() static int32 GetCount(Prefab* prefab);
+
+    /// <summary>
+    /// Destroys the pooled instances of the prefab.
+    /// </summary>
+    /// <param name="prefab">The prefab asset. Null to clear all pools.</param>
+    API_FUNCTION() static void Clear(Prefab* prefab = nullptr);
+};
@@ -68,6 +68,8 @@ Scene::Scene(const SpawnParams& params)
     : Actor(params)
     , LightmapsData(this)
     , CSGData(this)
+    , WorldPartition(this)
+    , HLOD(this)
 {
     // Default name
     _name = TEXT("Scene");
@@ -94,6 +96,26 @@ void Scene::SetLightmapSettings(const LightmapSettings& value)
     Info.LightmapSettings = value;
 }
 
+WorldPartitionSettings Scene::GetWorldPartitionSettings() const
+{
+    return WorldPartition.Settings;
+}
+
+void Scene::SetWorldPartitionSettings(const WorldPartitionSettings& value)
+{
+    WorldPartition.Settings = value;
+}
+
+HLODSettings Scene::GetHLODSettings() const
+{
+    return HLOD.Settings;
+}
+
+void Scene::SetHLODSettings(const HLODSettings& value)
+{
+    HLOD.Settings = value;
+}
+
 void Scene::ClearLightmaps()
 {
     LightmapsData.ClearLightmaps();
@@ -142,6 +164,11 @@ Array<Guid> Scene::GetAssetReferences() const
     return result;
 }
 
+bool Scene::BuildHLOD()
+{
+    return HLOD.Build();
+}
+
 #endif
 
 MeshCollider* Scene::TryGetCsgCollider()
@@ -287,6 +314,14 @@ void Scene::Serialize(SerializeStream& stream, const void* otherObj)
         stream.JKEY("CSG");
         stream.Object(&CSGData, other ? &other->CSGData : nullptr);
     }
+
+    if (WorldPartition.Settings.Enabled)
+    {
+        stream.JKEY("WorldPartition");
+        stream.Object(&WorldPartition.Settings, other ? &other->WorldPartition.Settings : nullptr);
+    }
+
+    HLOD.Serialize(stream, other ? &other->HLOD : nullptr);
 }
 
 void Scene::Deserialize(DeserializeStream& stream, ISerializeModifier* modifier)
@@ -297,6 +332,8 @@ void Scene::Deserialize(DeserializeStream& stream, ISerializeModifier* modifier)
     Info.Deserialize(stream, modifier);
     LightmapsData.LoadLightmaps(Info.Lightmaps);
     CSGData.DeserializeIfExists(stream, "CSG", modifier);
+    WorldPartition.Deserialize(stream, modifier);
+    HLOD.Deserialize(stream, modifier);
 
     // [Deprecated on 13.01.2021, expires on 13.01.2023]
     if (modifier->EngineBuild <= 6215 && Navigation.Meshes.IsEmpty())
@@ -371,6 +408,10 @@ void Scene::BeginPlay(SceneBeginData* data)
         if (model == nullptr)
             CreateCsgModel();
     }
+
+    // Stream the world partition cells (created during game cooking)
+    if (WorldPartition.GetCells().HasItems())
+        Ticking.Update.AddTick<SceneWorldPartition, &SceneWorldPartition::Update>(&WorldPartition);
 }
 
 void Scene::EndPlay()
@@ -379,6 +420,7 @@ void Scene::EndPlay()
     Ticking.Clear();
     Rendering.Clear();
     Navigation.Clear();
+    WorldPartition.Release();
 
     // Base
     Actor::EndPlay();
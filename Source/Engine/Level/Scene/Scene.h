@@ -9,6 +9,8 @@
 #include "SceneRendering.h"
 #include "SceneTicking.h"
 #include "SceneNavigation.h"
+#include "SceneWorldPartition.h"
+#include "SceneHLOD.h"
 
 class MeshCollider;
 
@@ -57,6 +59,16 @@ API_CLASS() class FLAXENGINE_API Scene : public Actor
     /// </summary>
     CSG::SceneCSGData CSGData;
 
+    /// <summary>
+    /// The world partition (grid cells streaming) for this scene.
+    /// </summary>
+    SceneWorldPartition WorldPartition;
+
+    /// <summary>
+    /// The hierarchical level of detail (HLOD) proxies for this scene.
+    /// </summary>
+    SceneHLOD HLOD;
+
     /// <summary>
     /// Gets the lightmap settings (per scene).
     /// </summary>
@@ -68,6 +80,28 @@ API_CLASS() class FLAXENGINE_API Scene : public Actor
     /// </summary>
     API_PROPERTY() void SetLightmapSettings(const LightmapSettings& value);
 
+    /// <summary>
+    /// Gets the world partition settings (per scene).
+    /// </summary>
+    API_PROPERTY(Attributes="EditorDisplay(\"World Partition\", EditorDisplayAttribute.InlineStyle)")
+    WorldPartitionSettings GetWorldPartitionSettings() const;
+
+    /// <summary>
+    /// Sets the world partition settings (per scene).
+    /// </summary>
+    API_PROPERTY() void SetWorldPartitionSettings(const WorldPartitionSettings& value);
+
+    /// <summary>
+    /// Gets the HLOD settings (per scene).
+    /// </summary>
+    API_PROPERTY(Attributes="EditorDisplay(\"HLOD\", EditorDisplayAttribute.InlineStyle)")
+    HLODSettings GetHLODSettings() const;
+
+    /// <summary>
+    /// Sets the HLOD settings (per scene).
+    /// </summary>
+    API_PROPERTY() void SetHLODSettings(const HLODSettings& value);
+
 public:
     /// <summary>
     /// Removes all baked lightmap textures from the scene.
@@ -105,6 +139,12 @@ API_CLASS() class FLAXENGINE_API Scene : public Actor
     /// <returns>The collection of the asset ids referenced by this asset.</returns>
     API_FUNCTION() Array<Guid, HeapAllocation> GetAssetReferences() const;
 
+    /// <summary>
+    /// Builds the HLOD proxy models for the static models of the scene. Supported only in Editor.
+    /// </summary>
+    /// <returns>True if failed, otherwise false.</returns>
+    API_FUNCTION() bool BuildHLOD();
+
 #endif
 
 private:
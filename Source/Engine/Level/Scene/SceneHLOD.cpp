@@ -0,0 +1,297 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "SceneHLOD.h"
+#include "Scene.h"
+#include "Engine/Core/Log.h"
+#include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Serialization/JsonTools.h"
+#include "Engine/Serialization/Serialization.h"
+#if USE_EDITOR
+#include "Engine/Core/Types/DateTime.h"
+#include "Engine/Core/Types/TimeSpan.h"
+#include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Content/Content.h"
+#include "Engine/Graphics/Models/ModelData.h"
+#include "Engine/Level/Actors/StaticModel.h"
+#include "Engine/ContentImporters/AssetsImportingManager.h"
+#if COMPILE_WITH_MODEL_TOOL
+#include "Engine/Tools/ModelTool/ModelTool.h"
+#endif
+#endif
+
+#if USE_EDITOR
+
+namespace
+{
+    void GetStaticModels(Actor* actor, Array<StaticModel*>& result)
+    {
+        if (!actor->GetIsActive())
+            return;
+        const auto staticModel = ScriptingObject::Cast<StaticModel>(actor);
+        if (staticModel &&
+            EnumHasAllFlags(staticModel->GetStaticFlags(), StaticFlags::Transform) &&
+            EnumHasAnyFlags(staticModel->DrawModes, DrawPass::GBuffer) &&
+            !staticModel->HasVertexColors() &&
+            staticModel->Model &&
+            !staticModel->Model->WaitForLoaded() &&
+            !staticModel->Model->IsVirtual())
+        {
+            result.Add(staticModel);
+        }
+        for (Actor* child : actor->Children)
+            GetStaticModels(child, result);
+    }
+
+    bool BuildProxy(const Array<StaticModel*>& actors, const Vector3& origin, const HLODSettings& settings, ModelData& data)
+    {
+        PROFILE_CPU();
+        data.LODs.Resize(1);
+        auto& lod = data.LODs[0];
+        Dictionary<MaterialBase*, int32> materialToMesh;
+        for (StaticModel* actor : actors)
+        {
+            // Use the lowest LOD of the model as a base for the proxy
+            Model* model = actor->Model.Get();
+            const ModelLOD& srcLod = model->LODs.Last();
+            Transform transform = actor->GetTransform();
+            transform.Translation -= origin;
+            Matrix world;
+            transform.GetWorld(world);
+            for (const Mesh& mesh : srcLod.Meshes)
+            {
+                const int32 slotIndex = mesh.GetMaterialSlotIndex();
+                const ModelInstanceEntry* entry = slotIndex < actor->Entries.Count() ? &actor->Entries[slotIndex] : nullptr;
+                if (entry && !entry->Visible)
+                    continue;
+                const MaterialSlot& slot = model->MaterialSlots[slotIndex];
+                MaterialBase* material = entry && entry->Material ? entry->Material.Get() : slot.Material.Get();
+
+                // Get the mesh geometry (in the proxy space)
+                BytesContainer vb0, vb1, ib;
+                int32 vertices, vertices1, indices;
+                if (mesh.DownloadDataCPU(MeshBufferType::Vertex0, vb0, vertices) ||
+                    mesh.DownloadDataCPU(MeshBufferType::Vertex1, vb1, vertices1) ||
+                    mesh.DownloadDataCPU(MeshBufferType::Index, ib, indices))
+                {
+                    LOG(Warning, "Failed to get the mesh data of the model {0} for HLOD.", model->ToString());
+                    continue;
+                }
+                MeshData meshData;
+                meshData.InitFromModelVertices((VB0ElementType*)vb0.Get(), (VB1ElementType*)vb1.Get(), vertices);
+                meshData.SetIndexBuffer((void*)ib.Get(), indices);
+                meshData.TransformBuffer(world);
+
+                // Merge geometry using the same material into a single mesh
+                int32 meshIndex;
+                if (materialToMesh.TryGet(material, meshIndex))
+                {
+                    lod.Meshes[meshIndex]->Merge(meshData);
+                    continue;
+                }
+                meshIndex = lod.Meshes.Count();
+                materialToMesh.Add(material, meshIndex);
+                auto& materialSlot = data.Materials.AddOne();
+                materialSlot.Name = slot.Name;
+                materialSlot.AssetID = material ? material->GetID() : Guid::Empty;
+                materialSlot.ShadowsMode = entry ? entry->ShadowsMode & slot.ShadowsMode : slot.ShadowsMode;
+                auto dstMesh = New<MeshData>();
+                dstMesh->MaterialSlotIndex = meshIndex;
+                dstMesh->Name = slot.Name;
+                dstMesh->SwapBuffers(meshData);
+                lod.Meshes.Add(dstMesh);
+            }
+        }
+        if (lod.Meshes.IsEmpty())
+            return true;
+
+#if COMPILE_WITH_MODEL_TOOL
+        // Reduce the proxy triangles (sloppy mode to collapse small disjoint parts)
+        for (MeshData* mesh : lod.Meshes)
+            ModelTool::SimplifyMesh(*mesh, settings.TriangleReduction, 0.05f, true);
+#endif
+        return false;
+    }
+}
+
+#endif
+
+void HLODSettings::Serialize(SerializeStream& stream, const void* otherObj)
+{
+    SERIALIZE_GET_OTHER_OBJ(HLODSettings);
+
+    SERIALIZE(Enabled);
+    SERIALIZE(CellSize);
+    SERIALIZE(DrawDistance);
+    SERIALIZE(TriangleReduction);
+    SERIALIZE(MinModelsPerCell);
+}
+
+void HLODSettings::Deserialize(DeserializeStream& stream, ISerializeModifier* modifier)
+{
+    DESERIALIZE(Enabled);
+    DESERIALIZE(CellSize);
+    DESERIALIZE(DrawDistance);
+    DESERIALIZE(TriangleReduction);
+    DESERIALIZE(MinModelsPerCell);
+}
+
+SceneHLOD::SceneHLOD(Scene* scene)
+    : _scene(scene)
+{
+}
+
+void SceneHLOD::Clear()
+{
+    _clusters.Clear();
+    OnClustersChanged();
+}
+
+void SceneHLOD::Serialize(ISerializable::SerializeStream& stream, const SceneHLOD* other)
+{
+    stream.JKEY("HLOD");
+    stream.Object(&Settings, other ? &other->Settings : nullptr);
+
+    if (_clusters.IsEmpty())
+        return;
+    stream.JKEY("HLODClusters");
+    stream.StartArray();
+    for (const Cluster& cluster : _clusters)
+    {
+        stream.StartObject();
+        stream.JKEY("X");
+        stream.Int(cluster.Coord.X);
+        stream.JKEY("Y");
+        stream.Int(cluster.Coord.Y);
+        stream.JKEY("Z");
+        stream.Int(cluster.Coord.Z);
+        stream.JKEY("Model");
+        stream.Guid(cluster.Model.GetID());
+        stream.JKEY("Bounds");
+        stream.BoundingSphere(cluster.Bounds);
+        stream.JKEY("Actors");
+        stream.StartArray();
+        for (const Guid& id : cluster.Actors)
+            stream.Guid(id);
+        stream.EndArray();
+        stream.EndObject();
+    }
+    stream.EndArray();
+}
+
+void SceneHLOD::Deserialize(ISerializable::DeserializeStream& stream, ISerializeModifier* modifier)
+{
+    const auto settingsMember = stream.FindMember("HLOD");
+    if (settingsMember != stream.MemberEnd() && settingsMember->value.IsObject())
+        Settings.Deserialize(settingsMember->value, modifier);
+
+    const auto clustersMember = stream.FindMember("HLODClusters");
+    if (clustersMember == stream.MemberEnd() || !clustersMember->value.IsArray())
+        return;
+    auto& clustersData = clustersMember->value;
+    _clusters.Clear();
+    _clusters.EnsureCapacity((int32)clustersData.Size());
+    for (rapidjson::SizeType i = 0; i < clustersData.Size(); i++)
+    {
+        auto& clusterData = clustersData[i];
+        auto& cluster = _clusters.AddOne();
+        cluster.Coord = Int3(JsonTools::GetInt(clusterData, "X", 0), JsonTools::GetInt(clusterData, "Y", 0), JsonTools::GetInt(clusterData, "Z", 0));
+        cluster.Model = JsonTools::GetGuid(clusterData, "Model");
+        cluster.Bounds = JsonTools::GetBoundingSphere(clusterData, "Bounds", BoundingSphere::Empty);
+        const auto actorsMember = clusterData.FindMember("Actors");
+        if (actorsMember != clusterData.MemberEnd() && actorsMember->value.IsArray())
+        {
+            auto& actorsData = actorsMember->value;
+            cluster.Actors.Resize((int32)actorsData.Size());
+            for (rapidjson::SizeType j = 0; j < actorsData.Size(); j++)
+                cluster.Actors[j] = JsonTools::GetGuid(actorsData[j]);
+        }
+    }
+    OnClustersChanged();
+}
+
+#if USE_EDITOR
+
+bool SceneHLOD::Build()
+{
+    PROFILE_CPU();
+    const auto startTime = DateTime::NowUTC();
+
+    // Group static models into the grid cells
+    Array<StaticModel*> models;
+    GetStaticModels(_scene, models);
+    const Real cellSize = Math::Max(Settings.CellSize, 100.0f);
+    Dictionary<Int3, Array<StaticModel*>> cells;
+    for (StaticModel* model : models)
+    {
+        const Vector3 cellPos = model->GetSphere().Center / cellSize;
+        cells[Int3((int32)Math::Floor(cellPos.X), (int32)Math::Floor(cellPos.Y), (int32)Math::Floor(cellPos.Z))].Add(model);
+    }
+
+    // Build the proxy model for each cell
+    const String dataFolder = _scene->GetDataFolderPath();
+    Array<Cluster> clusters;
+    for (auto& e : cells)
+    {
+        const Array<StaticModel*>& actors = e.Value;
+        if (actors.Count() < Settings.MinModelsPerCell)
+            continue;
+        BoundingBox box = actors[0]->GetBox();
+        for (int32 i = 1; i < actors.Count(); i++)
+            BoundingBox::Merge(box, actors[i]->GetBox(), box);
+        const Vector3 origin = box.GetCenter();
+        ModelData data;
+        if (BuildProxy(actors, origin, Settings, data))
+            continue;
+
+        // Reuse the asset of the cell from the previous build
+        Guid modelId = Guid::Empty;
+        for (const Cluster& cluster : _clusters)
+        {
+            if (cluster.Coord == e.Key)
+                modelId = cluster.Model.GetID();
+        }
+        if (!modelId.IsValid())
+            modelId = Guid::New();
+        const String modelPath = dataFolder / String::Format(TEXT("HLOD_{0}_{1}_{2}"), e.Key.X, e.Key.Y, e.Key.Z) + ASSET_FILES_EXTENSION_WITH_DOT;
+        if (AssetsImportingManager::Create(AssetsImportingManager::CreateModelTag, modelPath, modelId, &data))
+        {
+            LOG(Warning, "Failed to create HLOD model {0}", modelPath);
+            continue;
+        }
+
+        auto& cluster = clusters.AddOne();
+        cluster.Coord = e.Key;
+        cluster.Model = Content::LoadAsync<Model>(modelId);
+        BoundingSphere::FromBox(box, cluster.Bounds);
+        cluster.Actors.Resize(actors.Count());
+        for (int32 i = 0; i < actors.Count(); i++)
+            cluster.Actors[i] = actors[i]->GetID();
+    }
+
+    // Remove models of the cells that are no longer used
+    Array<String> unusedModels;
+    for (const Cluster& oldCluster : _clusters)
+    {
+        bool used = false;
+        for (const Cluster& cluster : clusters)
+            used |= cluster.Coord == oldCluster.Coord;
+        if (!used && oldCluster.Model)
+            unusedModels.Add(oldCluster.Model->GetPath());
+    }
+    _clusters.Swap(clusters);
+    clusters.Clear();
+    for (const String& path : unusedModels)
+        Content::DeleteAsset(path);
+    OnClustersChanged();
+
+    const auto endTime = DateTime::NowUTC();
+    LOG(Info, "HLOD for scene {0} built in {1} ms ({2} proxy models for {3} static models)", _scene->GetName(), (int32)(endTime - startTime).GetTotalMilliseconds(), _clusters.Count(), models.Count());
+    return false;
+}
+
+#endif
+
+void SceneHLOD::OnClustersChanged()
+{
+    _scene->Rendering.SetHLOD(_clusters.HasItems() ? this : nullptr);
+}
@@ -0,0 +1,139 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Core/ISerializable.h"
+#include "Engine/Core/Types/Guid.h"
+#include "Engine/Core/Math/Vector3.h"
+#include "Engine/Core/Math/BoundingSphere.h"
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Content/AssetReference.h"
+#include "Engine/Content/Assets/Model.h"
+#include "Engine/Graphics/Models/ModelInstanceEntry.h"
+#include "Engine/Scripting/ScriptingType.h"
+
+class Scene;
+
+/// <summary>
+/// The hierarchical level of detail (HLOD) settings (per scene).
+/// </summary>
+API_STRUCT() struct FLAXENGINE_API HLODSettings : ISerializable
+{
+DECLARE_SCRIPTING_TYPE_MINIMAL(HLODSettings);
+
+    /// <summary>
+    /// Enables drawing the HLOD proxy meshes (built with Build HLOD tool in Editor) instead of the static models far from the view.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(0)")
+    bool Enabled = true;
+
+    /// <summary>
+    /// The size of the single grid cell (in world units). Static models are grouped into the cells based on their position and each cell gets a single proxy model.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(10), Limit(100.0f)")
+    float CellSize = 10000.0f;
+
+    /// <summary>
+    /// The distance from the view to the cell bounds after which the static models of the cell are replaced by the proxy model.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(20), Limit(0)")
+    float DrawDistance = 20000.0f;
+
+    /// <summary>
+    /// The target amount of triangles of the proxy model (relative to the lowest LODs of the source models, in range 0-1).
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(30), Limit(0, 1, 0.001f)")
+    float TriangleReduction = 0.5f;
+
+    /// <summary>
+    /// The minimum amount of static models in a cell to build the proxy model for it.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(40), Limit(2)")
+    int32 MinModelsPerCell = 4;
+
+public:
+    // [ISerializable]
+    void Serialize(SerializeStream& stream, const void* otherObj) override;
+    void Deserialize(DeserializeStream& stream, ISerializeModifier* modifier) override;
+};
+
+/// <summary>
+/// Scene hierarchical level of detail (HLOD) subsystem. Holds the proxy models that combine the static models (their lowest LODs, merged per material and simplified) of the scene grid cells. Scene rendering draws them instead of the source models far from the view to reduce the amount of draw calls and triangles.
+/// </summary>
+class FLAXENGINE_API SceneHLOD
+{
+public:
+    /// <summary>
+    /// The proxy of the static models within a single grid cell.
+    /// </summary>
+    struct Cluster
+    {
+        // The grid cell coordinates.
+        Int3 Coord;
+        // The combined model (mesh per material, relative to the bounds center).
+        AssetReference<Model> Model;
+        // The world-space bounds of the source models.
+        BoundingSphere Bounds;
+        // The source actors (ids) replaced by the proxy.
+        Array<Guid> Actors;
+        // The drawing state (runtime only).
+        ModelInstanceEntries Entries;
+        GeometryDrawStateData DrawState;
+    };
+
+private:
+    Scene* _scene;
+    Array<Cluster> _clusters;
+
+public:
+    /// <summary>
+    /// Initializes a new instance of the <see cref="SceneHLOD"/> class.
+    /// </summary>
+    /// <param name="scene">The parent scene.</param>
+    SceneHLOD(Scene* scene);
+
+public:
+    /// <summary>
+    /// The HLOD settings.
+    /// </summary>
+    HLODSettings Settings;
+
+    /// <summary>
+    /// Gets the proxy clusters.
+    /// </summary>
+    FORCE_INLINE Array<Cluster>& GetClusters()
+    {
+        return _clusters;
+    }
+
+public:
+    /// <summary>
+    /// Removes all the proxy clusters.
+    /// </summary>
+    void Clear();
+
+    /// <summary>
+    /// Saves the settings and the proxy clusters.
+    /// </summary>
+    /// <param name="stream">The scene data.</param>
+    /// <param name="other">The other object to diff against (optional).</param>
+    void Serialize(ISerializable::SerializeStream& stream, const SceneHLOD* other);
+
+    /// <summary>
+    /// Loads the settings and the proxy clusters from the serialized scene.
+    /// </summary>
+    /// <param name="stream">The scene data.</param>
+    /// <param name="modifier">The deserialization modifier.</param>
+    void Deserialize(ISerializable::DeserializeStream& stream, ISerializeModifier* modifier);
+
+#if USE_EDITOR
+    /// <summary>
+    /// Builds the proxy models for the static models of the scene (grouped into the grid cells). Proxy models are saved into the scene data folder.
+    /// </summary>
+    /// <returns>True if failed, otherwise false.</returns>
+    bool Build();
+#endif
+
+private:
+    void OnClustersChanged();
+};
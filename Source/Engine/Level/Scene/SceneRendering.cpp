@@ -3,9 +3,12 @@
 #define SCENE_RENDERING_USE_PROFILER_PER_ACTOR 0
 
 #include "SceneRendering.h"
+#include "SceneHLOD.h"
+#include "Engine/Engine/Engine.h"
 #include "Engine/Graphics/RenderTask.h"
 #include "Engine/Graphics/RenderView.h"
 #include "Engine/Renderer/RenderList.h"
+#include "Engine/Renderer/HiZPass.h"
 #include "Engine/Threading/JobSystem.h"
 #include "Engine/Threading/Threading.h"
 #include "Engine/Profiler/ProfilerCPU.h"
@@ -27,18 +30,6 @@ void ISceneRenderingListener::ListenSceneRendering(SceneRendering* scene)
     }
 }
 
-FORCE_INLINE bool FrustumsListCull(const BoundingSphere& bounds, const Array<BoundingFrustum>& frustums)
-{
-    const int32 count = frustums.Count();
-    const BoundingFrustum* data = frustums.Get();
-    for (int32 i = 0; i < count; i++)
-    {
-        if (data[i].Intersects(bounds))
-            return true;
-    }
-    return false;
-}
-
 void SceneRendering::Draw(RenderContextBatch& renderContextBatch, DrawCategory category)
 {
     ScopeLock lock(Locker);
@@ -59,23 +50,40 @@ void SceneRendering::Draw(RenderContextBatch& renderContextBatch, DrawCategory c
     auto& view = renderContextBatch.GetMainContext().View;
     auto& list = Actors[(int32)category];
     _drawListData = list.Get();
-    _drawListSize = list.Count();
     _drawBatch = &renderContextBatch;
+    _drawOcclusion = nullptr;
+    if ((category == SceneDraw || category == SceneDrawAsync) && EnumHasAnyFlags(view.Pass, DrawPass::GBuffer))
+        _drawOcclusion = HiZPass::Instance()->GetOcclusionData(renderContextBatch.GetMainContext());
+    DrawHLODs(renderContextBatch, category);
 
     // Setup frustum data
     const int32 frustumsCount = renderContextBatch.Contexts.Count();
     _drawFrustumsData.Resize(frustumsCount);
+    _drawFrustums.Resize(frustumsCount);
     for (int32 i = 0; i < frustumsCount; i++)
-        _drawFrustumsData.Get()[i] = renderContextBatch.Contexts.Get()[i].View.CullingFrustum;
+    {
+        const BoundingFrustum& frustum = renderContextBatch.Contexts.Get()[i].View.CullingFrustum;
+        _drawFrustumsData.Get()[i].Setup(frustum);
+        _drawFrustums.Get()[i] = frustum;
+    }
+
+    // Collect actors to cull (static actors from the visible tree nodes and all dynamic actors)
+    _drawNodes.Clear();
+    _drawKeys.Clear();
+    _staticActors[(int32)category].Cull(_drawFrustums.Get(), frustumsCount, view.Origin, _drawNodes);
+    for (const Span<int32>& keys : _drawNodes)
+        _drawKeys.Add(keys.Get(), keys.Length());
+    _drawKeys.Add(_dynamicActors[(int32)category]);
+    _drawListSize = _drawKeys.Count();
 
     // Draw all visual components
-    _drawListIndex = -1;
+    _drawListIndex = 0;
     if (_drawListSize >= 64 && category == SceneDrawAsync && renderContextBatch.EnableAsync)
     {
         // Run in async via Job System
         Function<void(int32)> func;
         func.Bind<SceneRendering, &SceneRendering::DrawActorsJob>(this);
-        const uint64 waitLabel = JobSystem::Dispatch(func, JobSystem::GetThreadsCount());
+        const uint64 waitLabel = JobSystem::Dispatch(func, JobSystem::GetThreadsCount(), 1, JobPriority::High);
         renderContextBatch.WaitLabels.Add(waitLabel);
     }
     else
@@ -132,11 +140,42 @@ void SceneRendering::Clear()
     _listeners.Clear();
     for (auto& e : Actors)
         e.Clear();
+    for (auto& e : _staticActors)
+        e.Clear();
+    for (auto& e : _dynamicActors)
+        e.Clear();
+    _hlodActors.Clear();
+    _hlod = nullptr;
 #if USE_EDITOR
     PhysicsDebug.Clear();
 #endif
 }
 
+void SceneRendering::SetHLOD(SceneHLOD* hlod)
+{
+    ScopeLock lock(Locker);
+    _hlod = hlod;
+    _hlodActors.Clear();
+    if (hlod)
+    {
+        const auto& clusters = hlod->GetClusters();
+        for (int32 i = 0; i < clusters.Count(); i++)
+        {
+            for (const Guid& id : clusters[i].Actors)
+                _hlodActors[id] = i;
+        }
+    }
+    for (auto& list : Actors)
+    {
+        for (auto& e : list)
+        {
+            e.HLOD = -1;
+            if (hlod && e.Actor)
+                _hlodActors.TryGet(e.Actor->GetID(), e.HLOD);
+        }
+    }
+}
+
 void SceneRendering::AddActor(Actor* a, int32& key)
 {
     if (key != -1)
@@ -158,6 +197,10 @@ void SceneRendering::AddActor(Actor* a, int32& key)
     e.LayerMask = a->GetLayerMask();
     e.Bounds = a->GetSphere();
     e.NoCulling = a->_drawNoCulling;
+    e.HLOD = -1;
+    if (_hlod)
+        _hlodActors.TryGet(a->GetID(), e.HLOD);
+    AddCulling(category, key, e);
     for (auto* listener : _listeners)
         listener->OnSceneRenderingAddActor(a);
 }
@@ -175,7 +218,25 @@ void SceneRendering::UpdateActor(Actor* a, int32& key)
         for (auto* listener : _listeners)
             listener->OnSceneRenderingUpdateActor(a, e.Bounds);
         e.LayerMask = a->GetLayerMask();
-        e.Bounds = a->GetSphere();
+        const BoundingSphere bounds = a->GetSphere();
+        if (e.HLOD != -1 && bounds != e.Bounds)
+        {
+            // Actor has been moved after HLOD build so draw it on its own
+            e.HLOD = -1;
+        }
+        e.Bounds = bounds;
+
+        // Move actor between static and dynamic actors if its static flags have changed
+        const bool isStatic = !e.NoCulling && EnumHasAllFlags(a->GetStaticFlags(), StaticFlags::Transform);
+        if (isStatic != (e.DynamicIndex == -1))
+        {
+            RemoveCulling(category, key, e);
+            AddCulling(category, key, e);
+        }
+        else if (isStatic)
+        {
+            _staticActors[category].Update(key, e.Bounds);
+        }
     }
 }
 
@@ -191,6 +252,7 @@ void SceneRendering::RemoveActor(Actor* a, int32& key)
         {
             for (auto* listener : _listeners)
                 listener->OnSceneRenderingRemoveActor(a);
+            RemoveCulling(category, key, e);
             e.Actor = nullptr;
             e.LayerMask = 0;
         }
@@ -198,9 +260,83 @@ void SceneRendering::RemoveActor(Actor* a, int32& key)
     key = -1;
 }
 
-#define FOR_EACH_BATCH_ACTOR const int64 count = _drawListSize; while (true) { const int64 index = Platform::InterlockedIncrement(&_drawListIndex); if (index >= count) break; auto e = _drawListData[index];
-#define CHECK_ACTOR ((view.RenderLayersMask.Mask & e.LayerMask) && (e.NoCulling || FrustumsListCull(e.Bounds, _drawFrustumsData)))
-#define CHECK_ACTOR_SINGLE_FRUSTUM ((view.RenderLayersMask.Mask & e.LayerMask) && (e.NoCulling || view.CullingFrustum.Intersects(e.Bounds)))
+void SceneRendering::AddCulling(int32 category, int32 key, DrawActor& e)
+{
+    if (!e.NoCulling && EnumHasAllFlags(e.Actor->GetStaticFlags(), StaticFlags::Transform))
+    {
+        e.DynamicIndex = -1;
+        _staticActors[category].Add(key, e.Bounds);
+    }
+    else
+    {
+        e.DynamicIndex = _dynamicActors[category].Count();
+        _dynamicActors[category].Add(key);
+    }
+}
+
+void SceneRendering::RemoveCulling(int32 category, int32 key, DrawActor& e)
+{
+    if (e.DynamicIndex == -1)
+    {
+        _staticActors[category].Remove(key);
+    }
+    else
+    {
+        auto& dynamicActors = _dynamicActors[category];
+        const int32 lastKey = dynamicActors.Last();
+        dynamicActors[e.DynamicIndex] = lastKey;
+        Actors[category][lastKey].DynamicIndex = e.DynamicIndex;
+        dynamicActors.RemoveLast();
+        e.DynamicIndex = -1;
+    }
+}
+
+void SceneRendering::DrawHLODs(RenderContextBatch& renderContextBatch, DrawCategory category)
+{
+    _drawHLODs.Clear();
+    auto& renderContext = renderContextBatch.GetMainContext();
+    const auto& view = renderContext.View;
+    if (!_hlod || !_hlod->Settings.Enabled || (category != SceneDraw && category != SceneDrawAsync) || view.IsOfflinePass || EnumHasAnyFlags(view.Pass, DrawPass::GlobalSDF | DrawPass::GlobalSurfaceAtlas))
+        return;
+    PROFILE_CPU();
+    auto& clusters = _hlod->GetClusters();
+    _drawHLODs.Resize(clusters.Count());
+    const RenderView& lodView = renderContext.LodProxyView ? *renderContext.LodProxyView : view;
+    const float drawDistance = _hlod->Settings.DrawDistance;
+    for (int32 i = 0; i < clusters.Count(); i++)
+    {
+        auto& cluster = clusters[i];
+        const Vector3 center = cluster.Bounds.Center - view.Origin;
+        const bool useProxy = cluster.Model && cluster.Model->IsLoaded() && Vector3::Distance(center, lodView.Position) - cluster.Bounds.Radius >= drawDistance;
+        _drawHLODs[i] = useProxy ? 1 : 0;
+        if (!useProxy || category != SceneDraw)
+            continue;
+
+        // Draw the proxy model instead of the source actors (they are skipped in DrawActorsJob)
+        cluster.Entries.SetupIfInvalid(cluster.Model.Get());
+        Matrix world;
+        Matrix::Translation((Float3)center, world);
+        GEOMETRY_DRAW_STATE_EVENT_BEGIN(cluster.DrawState, world);
+        Mesh::DrawInfo draw;
+        draw.Buffer = &cluster.Entries;
+        draw.World = &world;
+        draw.DrawState = &cluster.DrawState;
+        draw.Deformation = nullptr;
+        draw.Lightmap = nullptr;
+        draw.LightmapUVs = nullptr;
+        draw.VertexColors = nullptr;
+        draw.Flags = StaticFlags::FullyStatic;
+        draw.DrawModes = DrawPass::Default;
+        draw.Bounds = BoundingSphere(center, cluster.Bounds.Radius);
+        draw.PerInstanceRandom = 0.0f;
+        draw.LODBias = 0;
+        draw.ForcedLOD = -1;
+        draw.SortOrder = 0;
+        cluster.Model->Draw(renderContextBatch, draw);
+        GEOMETRY_DRAW_STATE_EVENT_END(cluster.DrawState, world);
+    }
+}
+
 #if SCENE_RENDERING_USE_PROFILER_PER_ACTOR
 #define DRAW_ACTOR(mode) PROFILE_CPU_ACTOR(e.Actor); e.Actor->Draw(mode)
 #else
@@ -212,50 +348,69 @@ void SceneRendering::DrawActorsJob(int32)
     PROFILE_CPU();
     auto& mainContext = _drawBatch->GetMainContext();
     const auto& view = mainContext.View;
-    if (view.IsOfflinePass)
+    const Vector3 origin = view.Origin;
+    const uint32 layersMask = view.RenderLayersMask.Mask;
+    const FrustumCulling::Planes* frustums = _drawFrustumsData.Get();
+    const int32 frustumsCount = _drawFrustumsData.Count();
+    const bool drawMainContext = !view.IsOfflinePass && origin.IsZero() && frustumsCount == 1; // Fast path for no origin shifting with a single context
+    const DrawActor* actors = _drawListData;
+    const HiZOcclusionData* occlusion = _drawOcclusion;
+    const byte* hlods = _drawHLODs.HasItems() ? _drawHLODs.Get() : nullptr;
+    const int64 count = _drawListSize;
+    FrustumCulling::Spheres spheres;
+    while (true)
     {
-        // Offline pass with additional static flags culling
-        FOR_EACH_BATCH_ACTOR
-            e.Bounds.Center -= view.Origin;
-            if (CHECK_ACTOR && (e.Actor->GetStaticFlags() & view.StaticFlagsMask) != StaticFlags::None)
-            {
-                DRAW_ACTOR(*_drawBatch);
-            }
+        // Pick the next batch of actors
+        const int64 start = Platform::InterlockedAdd(&_drawListIndex, FrustumCulling::BatchSize);
+        if (start >= count)
+            break;
+        const int32 batchSize = (int32)Math::Min<int64>(count - start, FrustumCulling::BatchSize);
+        const int32* keys = _drawKeys.Get() + start;
+
+        // Cull the whole batch at once
+        uint64 noCullingMask = 0, layersVisibleMask = 0;
+        spheres.Clear();
+        for (int32 i = 0; i < batchSize; i++)
+        {
+            const DrawActor& e = actors[keys[i]];
+            spheres.Add(e.Bounds, origin);
+            if (e.NoCulling)
+                noCullingMask |= 1ull << i;
+            if (e.LayerMask & layersMask && !(hlods && e.HLOD != -1 && hlods[e.HLOD]))
+                layersVisibleMask |= 1ull << i;
         }
-    }
-    else if (view.Origin.IsZero() && _drawFrustumsData.Count() == 1)
-    {
-        // Fast path for no origin shifting with a single context
-        FOR_EACH_BATCH_ACTOR
-            if (CHECK_ACTOR_SINGLE_FRUSTUM)
+        uint64 visible = frustumsCount == 1 ? FrustumCulling::CullSpheres(frustums[0], spheres) : FrustumCulling::CullSpheres(frustums, frustumsCount, spheres);
+        visible = (visible | noCullingMask) & layersVisibleMask;
+        if (occlusion && visible)
+        {
+            // Skip actors occluded in the main view (unless visible in other views, eg. shadow projections)
+            uint64 occluded = 0;
+            for (uint64 mask = visible & ~noCullingMask; mask != 0; mask &= mask - 1)
             {
-                DRAW_ACTOR(mainContext);
+                const int32 i = FrustumCulling::GetFirstVisible(mask);
+                if (occlusion->IsOccluded(actors[keys[i]].Bounds))
+                    occluded |= 1ull << i;
             }
+            if (occluded != 0 && frustumsCount > 1)
+                occluded &= ~FrustumCulling::CullSpheres(frustums + 1, frustumsCount - 1, spheres);
+            visible &= ~occluded;
         }
-    }
-    else if (view.Origin.IsZero())
-    {
-        // Fast path for no origin shifting
-        FOR_EACH_BATCH_ACTOR
-            if (CHECK_ACTOR)
+
+        // Draw visible actors
+        for (; visible != 0; visible &= visible - 1)
+        {
+            const DrawActor& e = actors[keys[FrustumCulling::GetFirstVisible(visible)]];
+            if (drawMainContext)
             {
-                DRAW_ACTOR(*_drawBatch);
+                DRAW_ACTOR(mainContext);
             }
-        }
-    }
-    else
-    {
-        // Generic case
-        FOR_EACH_BATCH_ACTOR
-            e.Bounds.Center -= view.Origin;
-            if (CHECK_ACTOR)
+            else if (!view.IsOfflinePass || (e.Actor->GetStaticFlags() & view.StaticFlagsMask) != StaticFlags::None)
             {
+                // Offline pass with additional static flags culling
                 DRAW_ACTOR(*_drawBatch);
             }
         }
     }
 }
 
-#undef FOR_EACH_BATCH_ACTOR
-#undef CHECK_ACTOR
 #undef DRAW_ACTOR
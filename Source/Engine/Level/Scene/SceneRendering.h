@@ -4,17 +4,21 @@
 
 #include "Engine/Core/Delegate.h"
 #include "Engine/Core/Collections/Array.h"
+#include "Engine/Core/Collections/Dictionary.h"
 #include "Engine/Core/Math/BoundingSphere.h"
-#include "Engine/Core/Math/BoundingFrustum.h"
+#include "Engine/Core/Math/FrustumCulling.h"
 #include "Engine/Level/Actor.h"
 #include "Engine/Platform/CriticalSection.h"
+#include "SceneRenderingTree.h"
 
 class SceneRenderTask;
 class SceneRendering;
+class SceneHLOD;
 struct PostProcessSettings;
 struct RenderContext;
 struct RenderContextBatch;
 struct RenderView;
+struct HiZOcclusionData;
 
 /// <summary>
 /// Interface for actors that can override the default rendering settings (eg. PostFxVolume actor).
@@ -74,6 +78,10 @@ class FLAXENGINE_API SceneRendering
         Actor* Actor;
         uint32 LayerMask;
         int8 NoCulling : 1;
+        // Index in the dynamic actors list or -1 if actor is stored in the static actors tree.
+        int32 DynamicIndex;
+        // Index of the HLOD cluster that replaces the actor far from the view or -1 if not used.
+        int32 HLOD;
         BoundingSphere Bounds;
     };
 
@@ -100,6 +108,14 @@ class FLAXENGINE_API SceneRendering
     Array<Actor*> ViewportIcons;
 #endif
 
+    // Culling structures - static actors are stored in the loose octree, dynamic actors (and without culling) in the flat list of keys
+    SceneRenderingTree _staticActors[MAX];
+    Array<int32> _dynamicActors[MAX];
+
+    // HLOD - static actors replaced by the proxy models far from the view (actor id to cluster index)
+    SceneHLOD* _hlod = nullptr;
+    Dictionary<Guid, int32> _hlodActors;
+
     // Listener - some rendering systems cache state of the scene (eg. in RenderBuffers::CustomBuffer), this extensions allows those systems to invalidate cache and handle scene changes
     friend ISceneRenderingListener;
     Array<ISceneRenderingListener*, InlinedAllocation<8>> _listeners;
@@ -123,6 +139,12 @@ class FLAXENGINE_API SceneRendering
     /// </summary>
     void Clear();
 
+    /// <summary>
+    /// Sets the HLOD proxies to draw instead of the static actors far from the view. Called when HLOD clusters get changed.
+    /// </summary>
+    /// <param name="hlod">The scene HLOD data or null if not used.</param>
+    void SetHLOD(SceneHLOD* hlod);
+
 public:
     void AddActor(Actor* a, int32& key);
     void UpdateActor(Actor* a, int32& key);
@@ -183,11 +205,19 @@ class FLAXENGINE_API SceneRendering
 #endif
 
 private:
-    Array<BoundingFrustum> _drawFrustumsData;
+    Array<FrustumCulling::Planes> _drawFrustumsData;
+    Array<BoundingFrustum> _drawFrustums;
+    Array<Span<int32>> _drawNodes;
+    Array<int32> _drawKeys;
     DrawActor* _drawListData;
     int64 _drawListSize;
     volatile int64 _drawListIndex;
     RenderContextBatch* _drawBatch;
+    const HiZOcclusionData* _drawOcclusion;
+    Array<byte> _drawHLODs;
 
+    void AddCulling(int32 category, int32 key, DrawActor& e);
+    void RemoveCulling(int32 category, int32 key, DrawActor& e);
+    void DrawHLODs(RenderContextBatch& renderContextBatch, DrawCategory category);
     void DrawActorsJob(int32);
 };
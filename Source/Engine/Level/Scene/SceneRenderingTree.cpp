@@ -0,0 +1,184 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "SceneRenderingTree.h"
+#include "Engine/Core/Math/BoundingBox.h"
+#include "Engine/Core/Math/BoundingFrustum.h"
+
+// The half-size of the root node tight bounds (items outside it are stored in the root node)
+#define SCENE_RENDERING_TREE_ROOT_HALF_SIZE 1000000.0f
+
+// The minimum half-size of the node tight bounds (nodes are not split further)
+#define SCENE_RENDERING_TREE_MIN_HALF_SIZE 1000.0f
+
+// The amount of items in the leaf node that causes the node split
+#define SCENE_RENDERING_TREE_SPLIT_COUNT 64
+
+void SceneRenderingTree::Add(int32 key, const BoundingSphere& bounds)
+{
+    ASSERT_LOW_LAYER(key >= 0 && !Contains(key));
+    if (_nodes.IsEmpty())
+    {
+        Node& root = _nodes.AddOne();
+        root.Center = Vector3::Zero;
+        root.HalfSize = SCENE_RENDERING_TREE_ROOT_HALF_SIZE;
+    }
+    if (key >= _locations.Count())
+        _locations.Resize(key + 1);
+    _locations.Get()[key].Bounds = bounds;
+
+    // Find the deepest node that can contain the item (split leaf nodes with too many items)
+    int32 nodeIndex = 0;
+    while (true)
+    {
+        if (_nodes[nodeIndex].Children == -1)
+        {
+            const Node& node = _nodes[nodeIndex];
+            if (node.Items.Count() < SCENE_RENDERING_TREE_SPLIT_COUNT || node.HalfSize * 0.5f < SCENE_RENDERING_TREE_MIN_HALF_SIZE)
+                break;
+            Split(nodeIndex);
+        }
+        const int32 childIndex = FindChild(_nodes[nodeIndex], bounds);
+        if (childIndex == -1)
+            break;
+        nodeIndex = childIndex;
+    }
+    AddToNode(nodeIndex, key);
+    _count++;
+}
+
+void SceneRenderingTree::Update(int32 key, const BoundingSphere& bounds)
+{
+    if (!Contains(key))
+        return;
+    Location& location = _locations[key];
+    location.Bounds = bounds;
+
+    // Keep item in the current node if it still fits in it
+    if (location.Node == 0 ? FindChild(_nodes[0], bounds) == -1 : Fits(_nodes[location.Node], bounds))
+        return;
+    RemoveFromNode(key);
+    _count--;
+    Add(key, bounds);
+}
+
+void SceneRenderingTree::Remove(int32 key)
+{
+    if (!Contains(key))
+        return;
+    RemoveFromNode(key);
+    _count--;
+    if (_count == 0)
+        Clear();
+}
+
+void SceneRenderingTree::Clear()
+{
+    _nodes.Clear();
+    _locations.Clear();
+    _count = 0;
+}
+
+void SceneRenderingTree::Cull(const BoundingFrustum* frustums, int32 frustumsCount, const Vector3& origin, Array<Span<int32>>& result) const
+{
+    if (_nodes.IsEmpty())
+        return;
+    Array<int32, InlinedAllocation<128>> stack;
+    stack.Add(0);
+    while (stack.HasItems())
+    {
+        const int32 nodeIndex = stack.Last();
+        stack.RemoveLast();
+        const Node& node = _nodes.Get()[nodeIndex];
+
+        // Test node loose bounds against frustums (root contains also the items outside its bounds so it's always visible)
+        if (nodeIndex != 0)
+        {
+            const Vector3 looseExtent(node.HalfSize * 2.0f);
+            const Vector3 center = node.Center - origin;
+            const BoundingBox bounds(center - looseExtent, center + looseExtent);
+            bool visible = false;
+            for (int32 i = 0; i < frustumsCount && !visible; i++)
+                visible = frustums[i].Intersects(bounds);
+            if (!visible)
+                continue;
+        }
+
+        if (node.Items.HasItems())
+            result.Add(Span<int32>(node.Items.Get(), node.Items.Count()));
+        if (node.Children != -1)
+        {
+            for (int32 i = 0; i < 8; i++)
+                stack.Add(node.Children + i);
+        }
+    }
+}
+
+int32 SceneRenderingTree::FindChild(const Node& node, const BoundingSphere& bounds) const
+{
+    if (node.Children == -1 || bounds.Radius > node.HalfSize * 0.5f)
+        return -1;
+    int32 childIndex = node.Children;
+    if (bounds.Center.X >= node.Center.X)
+        childIndex += 1;
+    if (bounds.Center.Y >= node.Center.Y)
+        childIndex += 2;
+    if (bounds.Center.Z >= node.Center.Z)
+        childIndex += 4;
+    return Fits(_nodes[childIndex], bounds) ? childIndex : -1;
+}
+
+bool SceneRenderingTree::Fits(const Node& node, const BoundingSphere& bounds) const
+{
+    return bounds.Radius <= node.HalfSize &&
+            Math::Abs(bounds.Center.X - node.Center.X) <= node.HalfSize &&
+            Math::Abs(bounds.Center.Y - node.Center.Y) <= node.HalfSize &&
+            Math::Abs(bounds.Center.Z - node.Center.Z) <= node.HalfSize;
+}
+
+void SceneRenderingTree::Split(int32 nodeIndex)
+{
+    const int32 children = _nodes.Count();
+    _nodes.Resize(children + 8);
+    Node& node = _nodes[nodeIndex];
+    node.Children = children;
+    const Real childHalfSize = node.HalfSize * 0.5f;
+    for (int32 i = 0; i < 8; i++)
+    {
+        Node& child = _nodes[children + i];
+        child.HalfSize = childHalfSize;
+        child.Center = node.Center + Vector3(i & 1 ? childHalfSize : -childHalfSize, i & 2 ? childHalfSize : -childHalfSize, i & 4 ? childHalfSize : -childHalfSize);
+    }
+
+    // Move items down to the children
+    for (int32 i = node.Items.Count() - 1; i >= 0; i--)
+    {
+        const int32 key = node.Items[i];
+        const int32 childIndex = FindChild(node, _locations[key].Bounds);
+        if (childIndex != -1)
+        {
+            RemoveFromNode(key);
+            AddToNode(childIndex, key);
+        }
+    }
+}
+
+void SceneRenderingTree::AddToNode(int32 nodeIndex, int32 key)
+{
+    Node& node = _nodes[nodeIndex];
+    Location& location = _locations[key];
+    location.Node = nodeIndex;
+    location.Index = node.Items.Count();
+    node.Items.Add(key);
+}
+
+void SceneRenderingTree::RemoveFromNode(int32 key)
+{
+    Location& location = _locations[key];
+    Node& node = _nodes[location.Node];
+    const int32 lastKey = node.Items.Last();
+    node.Items[location.Index] = lastKey;
+    _locations[lastKey].Index = location.Index;
+    node.Items.RemoveLast();
+    location.Node = -1;
+    location.Index = -1;
+}
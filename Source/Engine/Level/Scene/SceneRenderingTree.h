@@ -0,0 +1,97 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Core/Math/BoundingSphere.h"
+#include "Engine/Core/Types/Span.h"
+
+struct BoundingFrustum;
+
+/// <summary>
+/// Loose octree with the scene actors used by the scene rendering for hierarchical culling of the static objects. Items are identified by the actor key in the scene rendering actors list. Each item is placed in the deepest node that fully contains it within the node loose bounds (node bounds expanded by the half of the node size in every direction).
+/// </summary>
+class FLAXENGINE_API SceneRenderingTree
+{
+private:
+    struct Node
+    {
+        // The node tight bounds center.
+        Vector3 Center;
+        // The node tight bounds half-size (loose bounds are twice as big).
+        Real HalfSize;
+        // The index of the first of 8 child nodes or -1 if node is a leaf.
+        int32 Children = -1;
+        // The keys of the items in this node.
+        Array<int32> Items;
+    };
+
+    struct Location
+    {
+        int32 Node = -1;
+        int32 Index = -1;
+        BoundingSphere Bounds;
+    };
+
+    Array<Node> _nodes;
+    Array<Location> _locations;
+    int32 _count = 0;
+
+public:
+    /// <summary>
+    /// Gets the amount of items in the tree.
+    /// </summary>
+    FORCE_INLINE int32 Count() const
+    {
+        return _count;
+    }
+
+    /// <summary>
+    /// Checks if the given item is in the tree.
+    /// </summary>
+    FORCE_INLINE bool Contains(int32 key) const
+    {
+        return key < _locations.Count() && _locations.Get()[key].Node != -1;
+    }
+
+    /// <summary>
+    /// Adds the item to the tree.
+    /// </summary>
+    /// <param name="key">The item key (non-negative).</param>
+    /// <param name="bounds">The item bounds.</param>
+    void Add(int32 key, const BoundingSphere& bounds);
+
+    /// <summary>
+    /// Updates the item bounds (moves it to the other node if needed).
+    /// </summary>
+    /// <param name="key">The item key.</param>
+    /// <param name="bounds">The item bounds.</param>
+    void Update(int32 key, const BoundingSphere& bounds);
+
+    /// <summary>
+    /// Removes the item from the tree.
+    /// </summary>
+    /// <param name="key">The item key.</param>
+    void Remove(int32 key);
+
+    /// <summary>
+    /// Removes all the items and nodes.
+    /// </summary>
+    void Clear();
+
+    /// <summary>
+    /// Collects the items of the tree nodes that intersect with any of the given frustums. Items still need to be culled individually.
+    /// </summary>
+    /// <param name="frustums">The frustums (relative to the origin).</param>
+    /// <param name="frustumsCount">The amount of frustums.</param>
+    /// <param name="origin">The frustums origin (in world space).</param>
+    /// <param name="result">The output list of visible nodes items (appended).</param>
+    void Cull(const BoundingFrustum* frustums, int32 frustumsCount, const Vector3& origin, Array<Span<int32>>& result) const;
+
+private:
+    int32 FindChild(const Node& node, const BoundingSphere& bounds) const;
+    bool Fits(const Node& node, const BoundingSphere& bounds) const;
+    void Split(int32 nodeIndex);
+    void AddToNode(int32 nodeIndex, int32 key);
+    void RemoveFromNode(int32 key);
+};
@@ -2,17 +2,131 @@
 
 #include "SceneTicking.h"
 #include "Scene.h"
+#include "Engine/Core/Log.h"
+#include "Engine/Core/Math/Math.h"
+#include "Engine/Engine/Time.h"
+#include "Engine/Profiler/ProfilerCPU.h"
 #include "Engine/Scripting/Script.h"
+#include "Engine/Scripting/BinaryModule.h"
+#include "Engine/Scripting/ManagedCLR/MCore.h"
+#include "Engine/Threading/JobSystem.h"
 
-SceneTicking::TickData::TickData(int32 capacity)
+// The amount of scripts ticked in parallel by a single job
+#define PARALLEL_SCRIPTS_PER_JOB 32
+
+// The amount of C# scripts ticked with a single call to the managed runtime
+#define MANAGED_SCRIPTS_PER_BATCH 128
+
+namespace
+{
+    // Counter used to spread the first update of the scripts with tick interval
+    uint32 TickStaggerCounter = 0;
+
+    FORCE_INLINE int32 GetTickGroup(const Script* item)
+    {
+        return item->GetTickGroup();
+    }
+
+    FORCE_INLINE int32 GetTickGroup(const SceneTicking::TickData::IntervalScript& item)
+    {
+        return item.Instance->GetTickGroup();
+    }
+
+    template<typename T>
+    void AddSorted(Array<T>& items, const T& item)
+    {
+        // Insert after the last item with the same or lower tick group to keep the order of scripts within the group
+        const int32 group = GetTickGroup(item);
+        int32 index = items.Count();
+        while (index > 0 && GetTickGroup(items.Get()[index - 1]) > group)
+            index--;
+        items.Insert(index, item);
+    }
+
+    template<void(Script::*Method)()>
+    void TickScriptsBatched(Span<Script*> scripts, int32 scriptVTableIndex)
+    {
+#if USE_NETCORE
+        // Invoke consecutive C# scripts in batches to reduce transitions to the managed runtime (keeps the scripts order)
+        void* batch[MANAGED_SCRIPTS_PER_BATCH * 2];
+        int32 batchSize = 0;
+        for (Script* script : scripts)
+        {
+            const ScriptingType& type = script->GetType();
+            MObject* instance;
+            if (type.Script.Spawn == &ManagedBinaryModule::ManagedObjectSpawn &&
+                type.Script.ScriptVTable &&
+                type.Script.ScriptVTable[scriptVTableIndex] &&
+                (instance = script->GetOrCreateManagedInstance()) != nullptr)
+            {
+                batch[batchSize * 2] = instance;
+                batch[batchSize * 2 + 1] = script;
+                if (++batchSize == MANAGED_SCRIPTS_PER_BATCH)
+                {
+                    MCore::Scripts::InvokeTick(Span<void*>(batch, batchSize * 2), scriptVTableIndex);
+                    batchSize = 0;
+                }
+                continue;
+            }
+            if (batchSize != 0)
+            {
+                MCore::Scripts::InvokeTick(Span<void*>(batch, batchSize * 2), scriptVTableIndex);
+                batchSize = 0;
+            }
+            (script->*Method)();
+        }
+        if (batchSize != 0)
+            MCore::Scripts::InvokeTick(Span<void*>(batch, batchSize * 2), scriptVTableIndex);
+#else
+        for (Script* script : scripts)
+            (script->*Method)();
+#endif
+    }
+}
+
+#if BUILD_DEBUG
+namespace
+{
+    // The actor of the script that is ticked in parallel by the current thread
+    THREADLOCAL const Actor* ParallelScriptActor = nullptr;
+}
+
+#define CHECK_PARALLEL_TICKING() if (ParallelScriptActor) LOG(Error, "Cannot add or remove scripts from the scripts ticked in parallel (script on '{0}').", ParallelScriptActor->GetNamePath())
+#else
+#define CHECK_PARALLEL_TICKING()
+#endif
+
+SceneTicking::TickData::TickData(int32 capacity, bool parallel)
     : Scripts(capacity)
     , Ticks(capacity)
+    , _parallel(parallel)
 {
 }
 
 void SceneTicking::TickData::AddScript(Script* script)
 {
-    Scripts.Add(script);
+    CHECK_PARALLEL_TICKING();
+    _hasTickGroups |= script->_tickGroup != 0;
+    if (script->_tickInterval > 0.0f)
+    {
+        const Time::TickData* time = Time::GetCurrentSafe();
+        IntervalScript e;
+        e.Instance = script;
+        e.NextTick = script->_tickIntervalFrames ? (double)time->TicksCount : time->Time.GetTotalSeconds();
+        if (script->_tickStagger)
+        {
+            // Offset the first update by the golden ratio sequence to evenly distribute scripts with the same interval
+            const float offset = script->_tickInterval * Math::Frac((float)TickStaggerCounter++ * 0.618034f);
+            e.NextTick += script->_tickIntervalFrames ? Math::Floor(offset) : offset;
+        }
+        AddSorted(ScriptsInterval, e);
+    }
+    else if (_parallel && script->_parallelUpdate)
+        ScriptsParallel.Add(script);
+    else if (_hasTickGroups)
+        AddSorted(Scripts, script);
+    else
+        Scripts.Add(script);
 #if USE_EDITOR
     if (script->_executeInEditor)
         ScriptsExecuteInEditor.Add(script);
@@ -21,7 +135,24 @@ void SceneTicking::TickData::AddScript(Script* script)
 
 void SceneTicking::TickData::RemoveScript(Script* script)
 {
-    Scripts.Remove(script);
+    CHECK_PARALLEL_TICKING();
+    if (script->_tickInterval > 0.0f)
+    {
+        for (int32 i = 0; i < ScriptsInterval.Count(); i++)
+        {
+            if (ScriptsInterval.Get()[i].Instance == script)
+            {
+                ScriptsInterval.RemoveAtKeepOrder(i);
+                break;
+            }
+        }
+    }
+    else if (_parallel && script->_parallelUpdate)
+        ScriptsParallel.Remove(script);
+    else if (_hasTickGroups)
+        Scripts.RemoveKeepOrder(script);
+    else
+        Scripts.Remove(script);
 #if USE_EDITOR
     if (script->_executeInEditor)
         ScriptsExecuteInEditor.Remove(script);
@@ -42,7 +173,18 @@ void SceneTicking::TickData::RemoveTick(void* callee)
 
 void SceneTicking::TickData::Tick()
 {
-    TickScripts(Scripts);
+    if (ScriptsParallel.HasItems())
+    {
+        PROFILE_CPU_NAMED("Parallel");
+        Function<void(int32)> job;
+        job.Bind<TickData, &TickData::TickScriptsJob>(this);
+        JobSystem::Execute(job, Math::DivideAndRoundUp(ScriptsParallel.Count(), PARALLEL_SCRIPTS_PER_JOB));
+    }
+
+    if (ScriptsInterval.HasItems())
+        TickScriptsInterval();
+    else
+        TickScripts(ToSpan(Scripts));
 
     for (int32 i = 0; i < Ticks.Count(); i++)
         Ticks.Get()[i].Call();
@@ -64,7 +206,7 @@ void SceneTicking::TickData::RemoveTickExecuteInEditor(void* callee)
 
 void SceneTicking::TickData::TickExecuteInEditor()
 {
-    TickScripts(ScriptsExecuteInEditor);
+    TickScripts(ToSpan(ScriptsExecuteInEditor));
 
     for (int32 i = 0; i < TicksExecuteInEditor.Count(); i++)
         TicksExecuteInEditor.Get()[i].Call();
@@ -72,9 +214,88 @@ void SceneTicking::TickData::TickExecuteInEditor()
 
 #endif
 
+void SceneTicking::TickData::TickScriptsJob(int32 index)
+{
+    const int32 start = index * PARALLEL_SCRIPTS_PER_JOB;
+    const int32 count = Math::Min(PARALLEL_SCRIPTS_PER_JOB, ScriptsParallel.Count() - start);
+    Script** scripts = ScriptsParallel.Get() + start;
+#if BUILD_DEBUG
+    // Tick scripts one-by-one to validate the objects access
+    for (int32 i = 0; i < count; i++)
+    {
+        ParallelScriptActor = scripts[i]->GetParent();
+        TickScripts(Span<Script*>(scripts + i, 1));
+    }
+    ParallelScriptActor = nullptr;
+#else
+    TickScripts(Span<Script*>(scripts, count));
+#endif
+}
+
+void SceneTicking::TickData::TickScriptsInterval()
+{
+    // Gather scripts that need to be updated in this frame
+    const Time::TickData* time = Time::GetCurrentSafe();
+    const double timeSeconds = time->Time.GetTotalSeconds();
+    const double timeFrames = (double)time->TicksCount;
+    _scriptsDue.Clear();
+    for (IntervalScript& e : ScriptsInterval)
+    {
+        const Script* script = e.Instance;
+        const double now = script->_tickIntervalFrames ? timeFrames : timeSeconds;
+        if (now < e.NextTick)
+            continue;
+        e.NextTick += script->_tickInterval;
+        if (e.NextTick <= now)
+        {
+            // Skip the missed updates (eg. after a long frame)
+            e.NextTick = now + script->_tickInterval;
+        }
+        _scriptsDue.Add(e.Instance);
+    }
+    if (_scriptsDue.IsEmpty())
+    {
+        TickScripts(ToSpan(Scripts));
+        return;
+    }
+
+    // Merge both lists to keep the order of tick groups (within the same group scripts updated every frame go first)
+    Script** scripts = Scripts.Get();
+    Script** scriptsDue = _scriptsDue.Get();
+    const int32 scriptsCount = Scripts.Count();
+    const int32 scriptsDueCount = _scriptsDue.Count();
+    int32 i = 0, j = 0;
+    while (i < scriptsCount || j < scriptsDueCount)
+    {
+        int32 end = i;
+        const int32 dueGroup = j < scriptsDueCount ? scriptsDue[j]->_tickGroup : MAX_int32;
+        while (end < scriptsCount && scripts[end]->_tickGroup <= dueGroup)
+            end++;
+        if (end != i)
+        {
+            TickScripts(Span<Script*>(scripts + i, end - i));
+            i = end;
+        }
+
+        end = j;
+        const int32 group = i < scriptsCount ? scripts[i]->_tickGroup : MAX_int32;
+        while (end < scriptsDueCount && scriptsDue[end]->_tickGroup < group)
+            end++;
+        if (end != j)
+        {
+            TickScripts(Span<Script*>(scriptsDue + j, end - j));
+            j = end;
+        }
+    }
+}
+
 void SceneTicking::TickData::Clear()
 {
     Scripts.Clear();
+    ScriptsParallel.Clear();
+    ScriptsInterval.Clear();
+    _scriptsDue.Clear();
+    _hasTickGroups = false;
     Ticks.Clear();
 #if USE_EDITOR
     ScriptsExecuteInEditor.Clear();
@@ -87,25 +308,19 @@ SceneTicking::FixedUpdateTickData::FixedUpdateTickData()
 {
 }
 
-void SceneTicking::FixedUpdateTickData::TickScripts(const Array<Script*>& scripts)
+void SceneTicking::FixedUpdateTickData::TickScripts(Span<Script*> scripts)
 {
-    for (auto* script : scripts)
-    {
-        script->OnFixedUpdate();
-    }
+    TickScriptsBatched<&Script::OnFixedUpdate>(scripts, 10);
 }
 
 SceneTicking::UpdateTickData::UpdateTickData()
-    : TickData(1024)
+    : TickData(1024, true)
 {
 }
 
-void SceneTicking::UpdateTickData::TickScripts(const Array<Script*>& scripts)
+void SceneTicking::UpdateTickData::TickScripts(Span<Script*> scripts)
 {
-    for (auto* script : scripts)
-    {
-        script->OnUpdate();
-    }
+    TickScriptsBatched<&Script::OnUpdate>(scripts, 8);
 }
 
 SceneTicking::LateUpdateTickData::LateUpdateTickData()
@@ -113,12 +328,9 @@ SceneTicking::LateUpdateTickData::LateUpdateTickData()
 {
 }
 
-void SceneTicking::LateUpdateTickData::TickScripts(const Array<Script*>& scripts)
+void SceneTicking::LateUpdateTickData::TickScripts(Span<Script*> scripts)
 {
-    for (auto* script : scripts)
-    {
-        script->OnLateUpdate();
-    }
+    TickScriptsBatched<&Script::OnLateUpdate>(scripts, 9);
 }
 
 SceneTicking::LateFixedUpdateTickData::LateFixedUpdateTickData()
@@ -126,12 +338,9 @@ SceneTicking::LateFixedUpdateTickData::LateFixedUpdateTickData()
 {
 }
 
-void SceneTicking::LateFixedUpdateTickData::TickScripts(const Array<Script*>& scripts)
+void SceneTicking::LateFixedUpdateTickData::TickScripts(Span<Script*> scripts)
 {
-    for (auto* script : scripts)
-    {
-        script->OnLateFixedUpdate();
-    }
+    TickScriptsBatched<&Script::OnLateFixedUpdate>(scripts, 11);
 }
 
 void SceneTicking::AddScript(Script* obj)
@@ -167,3 +376,20 @@ void SceneTicking::Clear()
     LateUpdate.Clear();
     LateFixedUpdate.Clear();
 }
+
+#if BUILD_DEBUG
+
+void SceneTicking::CheckParallelAccess(const Actor* actor)
+{
+    const Actor* scriptActor = ParallelScriptActor;
+    if (!scriptActor)
+        return;
+    for (const Actor* e = actor; e; e = e->GetParent())
+    {
+        if (e == scriptActor)
+            return;
+    }
+    LOG(Error, "Script ticked in parallel on '{0}' cannot modify actor '{1}' that is outside its hierarchy.", scriptActor->GetNamePath(), actor->GetNamePath());
+}
+
+#endif
@@ -4,6 +4,7 @@
 
 #include "Engine/Level/Types.h"
 #include "Engine/Core/Collections/Array.h"
+#include "Engine/Core/Types/Span.h"
 
 /// <summary>
 /// Scene gameplay updating helper subsystem that boosts the level ticking by providing efficient objects cache.
@@ -47,16 +48,31 @@ class FLAXENGINE_API SceneTicking
     class FLAXENGINE_API TickData
     {
     public:
+        /// <summary>
+        /// The script updated with a custom interval.
+        /// </summary>
+        struct IntervalScript
+        {
+            Script* Instance;
+            // The time (in seconds or frames) of the next script update.
+            double NextTick;
+        };
+
+        // Scripts sorted by their tick group.
         Array<Script*> Scripts;
+        // Scripts ticked in parallel on Job System before the other scripts (only if ticking stage supports it).
+        Array<Script*> ScriptsParallel;
+        // Scripts updated with a custom interval, sorted by their tick group.
+        Array<IntervalScript> ScriptsInterval;
         Array<Tick> Ticks;
 #if USE_EDITOR
         Array<Script*> ScriptsExecuteInEditor;
         Array<Tick> TicksExecuteInEditor;
 #endif
 
-        TickData(int32 capacity);
+        TickData(int32 capacity, bool parallel = false);
 
-        virtual void TickScripts(const Array<Script*>& scripts) = 0;
+        virtual void TickScripts(Span<Script*> scripts) = 0;
 
         void AddScript(Script* script);
         void RemoveScript(Script* script);
@@ -86,34 +102,42 @@ class FLAXENGINE_API SceneTicking
 #endif
 
         void Clear();
+
+    private:
+        bool _parallel;
+        bool _hasTickGroups = false;
+        Array<Script*> _scriptsDue;
+
+        void TickScriptsJob(int32 index);
+        void TickScriptsInterval();
     };
 
     class FLAXENGINE_API FixedUpdateTickData : public TickData
     {
     public:
         FixedUpdateTickData();
-        void TickScripts(const Array<Script*>& scripts) override;
+        void TickScripts(Span<Script*> scripts) override;
     };
 
     class FLAXENGINE_API UpdateTickData : public TickData
     {
     public:
         UpdateTickData();
-        void TickScripts(const Array<Script*>& scripts) override;
+        void TickScripts(Span<Script*> scripts) override;
     };
 
     class FLAXENGINE_API LateUpdateTickData : public TickData
     {
     public:
         LateUpdateTickData();
-        void TickScripts(const Array<Script*>& scripts) override;
+        void TickScripts(Span<Script*> scripts) override;
     };
 
     class FLAXENGINE_API LateFixedUpdateTickData : public TickData
     {
     public:
         LateFixedUpdateTickData();
-        void TickScripts(const Array<Script*>& scripts) override;
+        void TickScripts(Span<Script*> scripts) override;
     };
 
 public:
@@ -134,6 +158,14 @@ class FLAXENGINE_API SceneTicking
     /// </summary>
     void Clear();
 
+#if BUILD_DEBUG
+    /// <summary>
+    /// Validates that the actor can be modified by the current thread. Scripts ticked in parallel can modify only their own actor (and its children).
+    /// </summary>
+    /// <param name="actor">The modified actor.</param>
+    static void CheckParallelAccess(const Actor* actor);
+#endif
+
 public:
     /// <summary>
     /// The fixed update tick function.
@@ -0,0 +1,444 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "SceneWorldPartition.h"
+#include "Scene.h"
+#include "Engine/Level/SceneObjectsFactory.h"
+#include "Engine/Core/Cache.h"
+#include "Engine/Core/Log.h"
+#include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Debug/Exceptions/JsonParseException.h"
+#include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Scripting/Scripting.h"
+#include "Engine/Serialization/JsonTools.h"
+#include "Engine/Serialization/Serialization.h"
+#include "Engine/Streaming/Streaming.h"
+#include "Engine/Threading/Task.h"
+
+namespace
+{
+    int32 CountObjects(const Actor* actor)
+    {
+        int32 result = 1 + actor->Scripts.Count();
+        for (const Actor* child : actor->Children)
+            result += CountObjects(child);
+        return result;
+    }
+
+#if USE_EDITOR
+    bool HasTag(const rapidjson_flax::Value& obj, const StringAnsi& tag)
+    {
+        if (tag.IsEmpty())
+            return false;
+        const auto tagMember = obj.FindMember("Tag");
+        if (tagMember != obj.MemberEnd())
+            return tagMember->value.IsString() && tag == StringAnsiView(tagMember->value.GetString(), (int32)tagMember->value.GetStringLength());
+        const auto tagsMember = obj.FindMember("Tags");
+        if (tagsMember != obj.MemberEnd() && tagsMember->value.IsArray())
+        {
+            for (rapidjson::SizeType i = 0; i < tagsMember->value.Size(); i++)
+            {
+                const auto& e = tagsMember->value[i];
+                if (e.IsString() && tag == StringAnsiView(e.GetString(), (int32)e.GetStringLength()))
+                    return true;
+            }
+        }
+        return false;
+    }
+#endif
+}
+
+void WorldPartitionSettings::Serialize(SerializeStream& stream, const void* otherObj)
+{
+    SERIALIZE_GET_OTHER_OBJ(WorldPartitionSettings);
+
+    SERIALIZE(Enabled);
+    SERIALIZE(CellSize);
+    SERIALIZE(LoadingRange);
+    SERIALIZE(MaxActivatedObjectsPerFrame);
+    SERIALIZE(AlwaysLoadedTag);
+}
+
+void WorldPartitionSettings::Deserialize(DeserializeStream& stream, ISerializeModifier* modifier)
+{
+    DESERIALIZE(Enabled);
+    DESERIALIZE(CellSize);
+    DESERIALIZE(LoadingRange);
+    DESERIALIZE(MaxActivatedObjectsPerFrame);
+    DESERIALIZE(AlwaysLoadedTag);
+}
+
+SceneWorldPartition::SceneWorldPartition(Scene* scene)
+    : _scene(scene)
+{
+}
+
+SceneWorldPartition::~SceneWorldPartition()
+{
+    Release();
+    _cells.ClearDelete();
+}
+
+int32 SceneWorldPartition::GetActiveCellsCount() const
+{
+    int32 result = 0;
+    for (const Cell* cell : _cells)
+    {
+        if (cell->State == CellState::Active)
+            result++;
+    }
+    return result;
+}
+
+void SceneWorldPartition::Update()
+{
+    if (_cells.IsEmpty())
+        return;
+    PROFILE_CPU_NAMED("WorldPartition.Update");
+
+    // Get the streaming sources in the scene local space (cells are placed relative to the scene)
+    Array<Vector3, InlinedAllocation<8>> sources;
+    Streaming::GetSourcesLocations(sources);
+    if (sources.IsEmpty())
+        return;
+    const Transform& sceneTransform = _scene->GetTransform();
+    for (Vector3& source : sources)
+        source = sceneTransform.WorldToLocal(source);
+
+    const Real cellSize = (Real)Settings.CellSize;
+    const Real loadingRange = (Real)Settings.LoadingRange;
+    const Real unloadingRange = loadingRange + cellSize;
+    int32 budget = Math::Max(Settings.MaxActivatedObjectsPerFrame, 1);
+    for (Cell* cell : _cells)
+    {
+        // Find the closest streaming source (on XZ plane)
+        const Real minX = (Real)cell->Coord.X * cellSize;
+        const Real minZ = (Real)cell->Coord.Y * cellSize;
+        Real distance = MAX_Real;
+        for (const Vector3& source : sources)
+        {
+            const Real dx = Math::Max(Math::Max(minX - source.X, source.X - (minX + cellSize)), (Real)0);
+            const Real dz = Math::Max(Math::Max(minZ - source.Z, source.Z - (minZ + cellSize)), (Real)0);
+            distance = Math::Min(distance, Math::Sqrt(dx * dx + dz * dz));
+        }
+
+        // Update the cell (keep the current state between the loading and unloading ranges)
+        bool wanted = cell->State != CellState::Unloaded && cell->State != CellState::Unloading;
+        if (distance <= loadingRange)
+            wanted = true;
+        else if (distance > unloadingRange)
+            wanted = false;
+        UpdateCell(cell, wanted, budget);
+    }
+}
+
+void SceneWorldPartition::UpdateCell(Cell* cell, bool wanted, int32& budget)
+{
+    switch (cell->State)
+    {
+    case CellState::Unloaded:
+        if (wanted)
+        {
+            // Spawn and deserialize cell objects on a job thread
+            cell->State = CellState::Loading;
+            Platform::AtomicStore(&cell->LoadingDone, 0);
+            Function<void()> action = [this, cell]
+            {
+                LoadCell(cell);
+            };
+            cell->LoadingTask = Task::StartNew(action);
+        }
+        break;
+    case CellState::Loading:
+        if (Platform::AtomicRead(&cell->LoadingDone) == 0)
+            break;
+        cell->LoadingTask = nullptr;
+        cell->State = CellState::Loaded;
+        cell->Progress = 0;
+        break;
+    case CellState::Loaded:
+    {
+        if (!wanted)
+        {
+            cell->State = CellState::Unloading;
+            cell->Progress = 0;
+            break;
+        }
+
+        // Add top-level actors to the scene (spawns and begins play for the whole hierarchy)
+        PROFILE_CPU_NAMED("WorldPartition.ActivateCell");
+        while (cell->Progress < cell->Actors.Count() && budget > 0)
+        {
+            const int32 index = cell->Progress++;
+            Actor* actor = Scripting::FindObject<Actor>(cell->Actors[index]);
+            if (actor && actor->GetParent() == nullptr)
+                actor->SetParent(_scene, false);
+            budget -= cell->ActorsObjectsCount[index];
+        }
+        if (cell->Progress == cell->Actors.Count())
+            cell->State = CellState::Active;
+        break;
+    }
+    case CellState::Active:
+        if (!wanted)
+        {
+            cell->State = CellState::Unloading;
+            cell->Progress = 0;
+        }
+        break;
+    case CellState::Unloading:
+    {
+        // Remove objects immediately so the cell can be loaded again with the same objects ids
+        PROFILE_CPU_NAMED("WorldPartition.UnloadCell");
+        while (cell->Progress < cell->Actors.Count() && budget > 0)
+        {
+            const int32 index = cell->Progress++;
+            Actor* actor = Scripting::FindObject<Actor>(cell->Actors[index]);
+            if (actor)
+                actor->DeleteObjectNow();
+            budget -= cell->ActorsObjectsCount[index];
+        }
+        if (cell->Progress == cell->Actors.Count())
+        {
+            cell->Actors.Clear();
+            cell->ActorsObjectsCount.Clear();
+            cell->State = CellState::Unloaded;
+        }
+        break;
+    }
+    }
+}
+
+void SceneWorldPartition::Release()
+{
+    for (Cell* cell : _cells)
+    {
+        if (cell->LoadingTask && Platform::AtomicRead(&cell->LoadingDone) == 0)
+            cell->LoadingTask->Wait();
+        cell->LoadingTask = nullptr;
+
+        // Actors added to the scene are removed with it
+        for (const Guid& id : cell->Actors)
+        {
+            Actor* actor = Scripting::FindObject<Actor>(id);
+            if (actor && actor->GetParent() == nullptr)
+                actor->DeleteObjectNow();
+        }
+        cell->Actors.Clear();
+        cell->ActorsObjectsCount.Clear();
+        cell->State = CellState::Unloaded;
+    }
+}
+
+void SceneWorldPartition::LoadCell(Cell* cell)
+{
+    PROFILE_CPU_NAMED("WorldPartition.LoadCell");
+    rapidjson_flax::Document document;
+    {
+        PROFILE_CPU_NAMED("Json.Parse");
+        document.Parse((const char*)cell->Data.Get(), cell->Data.Count());
+    }
+    if (document.HasParseError() || !document.IsArray())
+    {
+        Log::JsonParseException(document.GetParseError(), document.GetErrorOffset());
+        Platform::AtomicStore(&cell->LoadingDone, 1);
+        return;
+    }
+    auto modifier = Cache::ISerializeModifier.Get();
+    modifier->EngineBuild = _engineBuild;
+
+    // Spawn all cell objects
+    const int32 dataCount = (int32)document.Size();
+    Array<SceneObject*> sceneObjects;
+    sceneObjects.Resize(dataCount);
+    SceneObjectsFactory::Context context(modifier.Value);
+    for (int32 i = 0; i < dataCount; i++)
+    {
+        auto& stream = document[i];
+        auto obj = SceneObjectsFactory::Spawn(context, stream);
+        sceneObjects[i] = obj;
+        if (obj)
+            obj->RegisterObject();
+        else
+            SceneObjectsFactory::HandleObjectDeserializationError(stream);
+    }
+    SceneObjectsFactory::PrefabSyncData prefabSyncData(sceneObjects, document, modifier.Value);
+    SceneObjectsFactory::SetupPrefabInstances(context, prefabSyncData);
+    SceneObjectsFactory::SynchronizeNewPrefabInstances(context, prefabSyncData);
+
+    // Load all cell objects (top-level actors have no parent so the hierarchy stays outside the scene)
+    Scripting::ObjectsLookupIdMapping.Set(&modifier.Value->IdsMapping);
+    for (int32 i = 0; i < dataCount; i++)
+    {
+        auto obj = sceneObjects[i];
+        if (obj)
+            SceneObjectsFactory::Deserialize(context, obj, document[i]);
+    }
+    Scripting::ObjectsLookupIdMapping.Set(nullptr);
+    SceneObjectsFactory::SynchronizePrefabInstances(context, prefabSyncData);
+
+    // Collect top-level actors
+    for (SceneObject* obj : sceneObjects)
+    {
+        if (!obj || obj->GetParent())
+            continue;
+        Actor* actor = dynamic_cast<Actor*>(obj);
+        if (actor)
+        {
+            cell->Actors.Add(actor->GetID());
+            cell->ActorsObjectsCount.Add(CountObjects(actor));
+        }
+        else
+        {
+            LOG(Warning, "Scene object {0} {1} has missing parent object after load. Removing it.", obj->GetID(), obj->ToString());
+            obj->DeleteObject();
+        }
+    }
+
+    Platform::AtomicStore(&cell->LoadingDone, 1);
+}
+
+void SceneWorldPartition::Deserialize(ISerializable::DeserializeStream& stream, ISerializeModifier* modifier)
+{
+    const auto settingsMember = stream.FindMember("WorldPartition");
+    if (settingsMember != stream.MemberEnd() && settingsMember->value.IsObject())
+        Settings.Deserialize(settingsMember->value, modifier);
+    _engineBuild = modifier->EngineBuild;
+
+    // Cache the cells objects data (created during game cooking)
+    const auto cellsMember = stream.FindMember("WorldPartitionCells");
+    if (cellsMember == stream.MemberEnd() || !cellsMember->value.IsArray())
+        return;
+    PROFILE_CPU_NAMED("WorldPartition.Deserialize");
+    Release();
+    _cells.ClearDelete();
+    auto& cellsData = cellsMember->value;
+    _cells.EnsureCapacity((int32)cellsData.Size());
+    for (rapidjson::SizeType i = 0; i < cellsData.Size(); i++)
+    {
+        auto& cellData = cellsData[i];
+        const auto objectsMember = cellData.FindMember("Objects");
+        if (objectsMember == cellData.MemberEnd() || !objectsMember->value.IsArray())
+            continue;
+        rapidjson_flax::StringBuffer buffer;
+        rapidjson_flax::Writer<rapidjson_flax::StringBuffer> writer(buffer);
+        objectsMember->value.Accept(writer);
+        auto cell = New<Cell>();
+        cell->Coord = Int2(JsonTools::GetInt(cellData, "X", 0), JsonTools::GetInt(cellData, "Y", 0));
+        cell->Data.Set((const byte*)buffer.GetString(), (int32)buffer.GetSize());
+        _cells.Add(cell);
+    }
+}
+
+#if USE_EDITOR
+
+int32 SceneWorldPartition::BuildCells(ISerializable::SerializeDocument& document)
+{
+    const auto dataMember = document.FindMember("Data");
+    if (dataMember == document.MemberEnd() || !dataMember->value.IsArray() || dataMember->value.Size() < 2)
+        return 0;
+    auto& data = dataMember->value;
+    auto& sceneData = data[0];
+    const auto settingsMember = sceneData.FindMember("WorldPartition");
+    if (settingsMember == sceneData.MemberEnd() || !settingsMember->value.IsObject())
+        return 0;
+    WorldPartitionSettings settings;
+    {
+        auto modifier = Cache::ISerializeModifier.Get();
+        settings.Deserialize(settingsMember->value, modifier.Value);
+    }
+    if (!settings.Enabled || settings.CellSize <= ZeroTolerance)
+        return 0;
+    PROFILE_CPU();
+    const int32 count = (int32)data.Size();
+    const StringAnsi alwaysLoadedTag(settings.AlwaysLoadedTag);
+
+    // Find the parent of each object (index 0 is a scene)
+    Dictionary<Guid, int32> idToIndex;
+    idToIndex.EnsureCapacity(count);
+    for (int32 i = 0; i < count; i++)
+        idToIndex[JsonTools::GetGuid(data[i], "ID")] = i;
+    Array<int32> parents;
+    parents.Resize(count);
+    for (int32 i = 0; i < count; i++)
+    {
+        if (!idToIndex.TryGet(JsonTools::GetGuid(data[i], "ParentID"), parents[i]))
+            parents[i] = -1;
+    }
+
+    // Assign the top-level actors to the cells based on their location (actors without transform, eg. prefab instances with default placement, are always loaded)
+    Array<int32> cellIndices;
+    cellIndices.Resize(count);
+    cellIndices.SetAll(-1);
+    Dictionary<Int2, int32> coordToCell;
+    Array<Int2> cellCoords;
+    for (int32 i = 1; i < count; i++)
+    {
+        const auto& obj = data[i];
+        if (parents[i] != 0)
+            continue;
+        const auto transformMember = obj.FindMember("Transform");
+        if (transformMember == obj.MemberEnd() || !transformMember->value.IsObject())
+            continue;
+        const auto translationMember = transformMember->value.FindMember("Translation");
+        if (translationMember == transformMember->value.MemberEnd() || HasTag(obj, alwaysLoadedTag))
+            continue;
+        const Vector3 position = JsonTools::GetVector3(translationMember->value);
+        const Int2 coord((int32)Math::Floor(position.X / settings.CellSize), (int32)Math::Floor(position.Z / settings.CellSize));
+        int32 cellIndex;
+        if (!coordToCell.TryGet(coord, cellIndex))
+        {
+            cellIndex = cellCoords.Count();
+            cellCoords.Add(coord);
+            coordToCell.Add(coord, cellIndex);
+        }
+        cellIndices[i] = cellIndex;
+    }
+    if (cellCoords.IsEmpty())
+        return 0;
+
+    // Objects are partitioned together with their top-level actor
+    for (int32 i = 1; i < count; i++)
+    {
+        int32 root = i;
+        for (int32 depth = 0; depth < count && parents[root] > 0; depth++)
+            root = parents[root];
+        if (parents[root] == 0)
+            cellIndices[i] = cellIndices[root];
+    }
+
+    // Move the objects data into the cells
+    auto& allocator = document.GetAllocator();
+    rapidjson_flax::Value cells(rapidjson::kArrayType);
+    cells.Reserve(cellCoords.Count(), allocator);
+    for (const Int2& coord : cellCoords)
+    {
+        rapidjson_flax::Value cell(rapidjson::kObjectType);
+        cell.AddMember("X", coord.X, allocator);
+        cell.AddMember("Y", coord.Y, allocator);
+        rapidjson_flax::Value objects(rapidjson::kArrayType);
+        cell.AddMember("Objects", objects, allocator);
+        cells.PushBack(cell, allocator);
+    }
+    rapidjson_flax::Value sceneObjects(rapidjson::kArrayType);
+    for (int32 i = 0; i < count; i++)
+    {
+        auto& obj = data[i];
+        const int32 cellIndex = cellIndices[i];
+        if (cellIndex == -1)
+        {
+            sceneObjects.PushBack(obj, allocator);
+            continue;
+        }
+
+        // Top-level actors are added to the scene when the cell gets activated
+        if (parents[i] == 0)
+            obj.RemoveMember("ParentID");
+        cells[cellIndex]["Objects"].PushBack(obj, allocator);
+    }
+    sceneObjects[0].AddMember("WorldPartitionCells", cells, allocator);
+    data = sceneObjects;
+    LOG(Info, "Scene world partition split {0} objects into {1} cells", count - (int32)data.Size(), cellCoords.Count());
+    return cellCoords.Count();
+}
+
+#endif
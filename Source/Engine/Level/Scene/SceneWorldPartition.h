@@ -0,0 +1,165 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Core/ISerializable.h"
+#include "Engine/Core/Types/Guid.h"
+#include "Engine/Core/Types/String.h"
+#include "Engine/Core/Math/Vector2.h"
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Scripting/ScriptingType.h"
+
+class Scene;
+class Task;
+
+/// <summary>
+/// The world partition settings (per scene).
+/// </summary>
+API_STRUCT() struct FLAXENGINE_API WorldPartitionSettings : ISerializable
+{
+DECLARE_SCRIPTING_TYPE_MINIMAL(WorldPartitionSettings);
+
+    /// <summary>
+    /// Enables splitting the scene into the grid cells during game cooking. Cells are streamed in and out around the streaming sources (see Streaming.Sources) at runtime. Not used in Editor.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(0)")
+    bool Enabled = false;
+
+    /// <summary>
+    /// The size of the single grid cell (in world units, on XZ plane). Top-level actors are assigned to the cells based on their position.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(10), Limit(100.0f)")
+    float CellSize = 25600.0f;
+
+    /// <summary>
+    /// The distance from the streaming sources within which the cells are loaded. Cells are unloaded once further away than the loading range increased by the cell size.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(20), Limit(0)")
+    float LoadingRange = 51200.0f;
+
+    /// <summary>
+    /// The maximum amount of scene objects (actors and scripts) added to or removed from the scene per frame. Spreads the cells activation cost over multiple frames.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(30), Limit(1)")
+    int32 MaxActivatedObjectsPerFrame = 500;
+
+    /// <summary>
+    /// The tag of the top-level actors that are always loaded with the scene instead of being partitioned (eg. terrain, sky or game managers).
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(40)")
+    String AlwaysLoadedTag = TEXT("AlwaysLoaded");
+
+public:
+    // [ISerializable]
+    void Serialize(SerializeStream& stream, const void* otherObj) override;
+    void Deserialize(DeserializeStream& stream, ISerializeModifier* modifier) override;
+};
+
+/// <summary>
+/// Scene world partition subsystem. Streams the scene grid cells (created during game cooking) around the streaming sources. Cell objects are loaded on a job thread and added to the scene over multiple frames.
+/// </summary>
+class FLAXENGINE_API SceneWorldPartition
+{
+public:
+    /// <summary>
+    /// The grid cell state.
+    /// </summary>
+    enum class CellState
+    {
+        Unloaded,
+        Loading,
+        Loaded,
+        Active,
+        Unloading,
+    };
+
+    /// <summary>
+    /// The single grid cell.
+    /// </summary>
+    struct Cell
+    {
+        // The cell coordinates (on XZ plane).
+        Int2 Coord;
+        // The serialized scene objects (JSON array).
+        Array<byte> Data;
+        // The current state.
+        CellState State = CellState::Unloaded;
+        // The loading task (valid during loading).
+        Task* LoadingTask = nullptr;
+        // Non-zero if the loading task has finished.
+        volatile int64 LoadingDone = 0;
+        // The loaded top-level actors (ids).
+        Array<Guid> Actors;
+        // The amount of scene objects in the hierarchy of each top-level actor.
+        Array<int32> ActorsObjectsCount;
+        // The amount of top-level actors added to (or removed from) the scene.
+        int32 Progress = 0;
+    };
+
+private:
+    Scene* _scene;
+    int32 _engineBuild = 0;
+    Array<Cell*> _cells;
+
+public:
+    /// <summary>
+    /// Initializes a new instance of the <see cref="SceneWorldPartition"/> class.
+    /// </summary>
+    /// <param name="scene">The parent scene.</param>
+    SceneWorldPartition(Scene* scene);
+
+    /// <summary>
+    /// Finalizes an instance of the <see cref="SceneWorldPartition"/> class.
+    /// </summary>
+    ~SceneWorldPartition();
+
+public:
+    /// <summary>
+    /// The world partition settings.
+    /// </summary>
+    WorldPartitionSettings Settings;
+
+    /// <summary>
+    /// Gets the grid cells.
+    /// </summary>
+    FORCE_INLINE const Array<Cell*>& GetCells() const
+    {
+        return _cells;
+    }
+
+    /// <summary>
+    /// Gets the amount of cells that are loaded and added to the scene.
+    /// </summary>
+    int32 GetActiveCellsCount() const;
+
+public:
+    /// <summary>
+    /// Updates the cells streaming. Called every frame during play.
+    /// </summary>
+    void Update();
+
+    /// <summary>
+    /// Releases the loaded cells objects that have not been added to the scene and resets the cells state.
+    /// </summary>
+    void Release();
+
+    /// <summary>
+    /// Loads the settings and the cells data from the serialized scene.
+    /// </summary>
+    /// <param name="stream">The scene data.</param>
+    /// <param name="modifier">The deserialization modifier.</param>
+    void Deserialize(ISerializable::DeserializeStream& stream, ISerializeModifier* modifier);
+
+#if USE_EDITOR
+    /// <summary>
+    /// Splits the serialized scene objects into the world partition grid cells (if enabled in the scene settings). Used during game cooking.
+    /// </summary>
+    /// <param name="document">The serialized scene asset.</param>
+    /// <returns>The amount of created cells.</returns>
+    static int32 BuildCells(ISerializable::SerializeDocument& document);
+#endif
+
+private:
+    void LoadCell(Cell* cell);
+    void UpdateCell(Cell* cell, bool wanted, int32& budget);
+};
@@ -26,6 +26,8 @@ SceneObject::SceneObject(const SpawnParams& params)
     , _prefabID(Guid::Empty)
     , _prefabObjectID(Guid::Empty)
 {
+    // Objects of types from C# scripts can run user code when deserializing so load them on the main thread
+    _loadNoAsync = GetType().Script.Spawn == &ManagedBinaryModule::ManagedObjectSpawn;
 }
 
 SceneObject::~SceneObject()
@@ -81,6 +81,8 @@ API_CLASS(Abstract, NoSpawn) class FLAXENGINE_API SceneObject : public Scripting
     Actor* _parent;
     Guid _prefabID;
     Guid _prefabObjectID;
+    // Disables deserialization of the object on job threads during async scene loading (set from constructor of types that are not thread-safe to deserialize, eg. calling into C# code)
+    uint8 _loadNoAsync : 1;
 
     /// <summary>
     /// Initializes a new instance of the <see cref="SceneObject"/> class.
@@ -4,8 +4,14 @@
 #include "Engine/Core/Types/String.h"
 #include "Engine/Core/Types/StringView.h"
 #include "Engine/Serialization/SerializationFwd.h"
+#include "Engine/Threading/Threading.h"
 
 Array<String> Tags::List;
+namespace
+{
+    // Tags can be registered from multiple threads (eg. when loading scene objects on job threads)
+    CriticalSection TagsLocker;
+}
 #if !BUILD_RELEASE
 FLAXENGINE_API String* TagsListDebug = nullptr;
 #endif
@@ -43,6 +49,7 @@ Tag Tags::Get(const StringView& tagName)
 {
     if (tagName.IsEmpty())
         return Tag();
+    ScopeLock lock(TagsLocker);
     Tag tag(List.Find(tagName) + 1);
     if (tag.Index == 0 && tagName.HasChars())
     {
@@ -6,20 +6,49 @@
 #include "LocalizationSettings.h"
 #include "Engine/Core/Log.h"
 #include "Engine/Core/Config/GameSettings.h"
+#include "Engine/Core/Collections/Sorting.h"
 #include "Engine/Engine/EngineService.h"
 #include "Engine/Content/Content.h"
 #include "Engine/Profiler/ProfilerCPU.h"
 #include "Engine/Serialization/Serialization.h"
+#include "Engine/Threading/Threading.h"
 #include <locale>
 
 class LocalizationService : public EngineService
 {
 public:
+    struct StringEntry
+    {
+        uint32 Hash;
+        int32 Id; // Index of the message id text
+        int32 First; // Index of the first message text
+        int32 Count; // Amount of messages (plural forms)
+
+        bool operator<(const StringEntry& other) const
+        {
+            return Hash < other.Hash;
+        }
+    };
+
+    struct TextRange
+    {
+        int32 Start;
+        int32 Length;
+    };
+
     CultureInfo CurrentCulture;
     CultureInfo CurrentLanguage;
     Array<AssetReference<LocalizedStringTable>> LocalizedStringTables;
     Array<AssetReference<LocalizedStringTable>> FallbackStringTables;
 
+    // Strings of the current language merged from all tables (including fallbacks) with entries sorted by the id hash and texts interned into a single null-terminated UTF-16 buffer
+    Array<StringEntry> Strings;
+    Array<TextRange> Texts;
+    Array<Char> TextsData;
+    uint32 StringsVersion = 0;
+    bool StringsDirty = true;
+    CriticalSection StringsLocker;
+
     LocalizationService()
         : EngineService(TEXT("Localization"), -500)
         , CurrentCulture(0)
@@ -28,41 +57,76 @@ class LocalizationService : public EngineService
     }
 
     void OnLocalizationChanged();
+    void CompileStrings();
 
-    const String& Get(const String& id, int32 index, const String& fallback) const
+    FORCE_INLINE void EnsureCompiled()
     {
-        if (id.IsEmpty())
-            return fallback;
-
-        // Try current tables
-        for (auto& e : LocalizedStringTables)
+        if (StringsDirty)
         {
-            const auto table = e.Get();
-            const auto messages = table ? table->Entries.TryGet(id) : nullptr;
-            if (messages && messages->Count() > index)
-                return messages->At(index);
+            ScopeLock lock(StringsLocker);
+            if (StringsDirty)
+            {
+                CompileStrings();
+                StringsDirty = false;
+            }
         }
+    }
+
+    FORCE_INLINE StringView GetText(int32 index) const
+    {
+        const TextRange& range = Texts.Get()[index];
+        return StringView(TextsData.Get() + range.Start, range.Length);
+    }
 
-        // Try fallback tables for current tables
-        for (auto& e : LocalizedStringTables)
+    int32 Find(const StringView& id) const
+    {
+        const uint32 hash = GetHash(id);
+        int32 left = 0, right = Strings.Count();
+        while (left < right)
         {
-            const auto table = e.Get();
-            const auto fallbackTable = table ? table->FallbackTable.Get() : nullptr;
-            const auto messages = fallbackTable ? fallbackTable->Entries.TryGet(id) : nullptr;
-            if (messages && messages->Count() > index)
-                return messages->At(index);
+            const int32 middle = (left + right) / 2;
+            if (Strings.Get()[middle].Hash < hash)
+                left = middle + 1;
+            else
+                right = middle;
         }
-
-        // Try fallback language tables
-        for (auto& e : FallbackStringTables)
+        for (; left < Strings.Count() && Strings.Get()[left].Hash == hash; left++)
         {
-            const auto table = e.Get();
-            const auto messages = table ? table->Entries.TryGet(id) : nullptr;
-            if (messages && messages->Count() > index)
-                return messages->At(index);
+            if (GetText(Strings.Get()[left].Id) == id)
+                return left;
         }
+        return -1;
+    }
+
+    FORCE_INLINE StringView Get(int32 entryIndex, int32 index, const StringView& fallback) const
+    {
+        if (entryIndex == -1)
+            return fallback;
+        const StringEntry& entry = Strings.Get()[entryIndex];
+        return index < entry.Count ? GetText(entry.First + index) : fallback;
+    }
+
+    StringView Get(const StringView& id, int32 index, const StringView& fallback)
+    {
+        if (id.IsEmpty())
+            return fallback;
+        EnsureCompiled();
+        return Get(Find(id), index, fallback);
+    }
 
-        return fallback;
+    StringView Get(const LocalizedString& str, int32 index)
+    {
+        if (str.Id.IsEmpty())
+            return str.Value;
+        EnsureCompiled();
+
+        // Resolve the id into the strings entry once and revalidate it only when localization changes or the id gets modified
+        if (str._cacheVersion != StringsVersion || str._cacheIndex == -1 || GetText(Strings[str._cacheIndex].Id) != str.Id)
+        {
+            str._cacheIndex = Find(str.Id);
+            str._cacheVersion = StringsVersion;
+        }
+        return Get(str._cacheIndex, index, str.Value);
     }
 
     bool Init() override;
@@ -73,6 +137,11 @@ namespace
     LocalizationService Instance;
 }
 
+void OnLocalizedStringTableChanged()
+{
+    Instance.StringsDirty = true;
+}
+
 IMPLEMENT_ENGINE_SETTINGS_GETTER(LocalizationSettings, Localization);
 
 void LocalizationSettings::Apply()
@@ -89,12 +158,16 @@ void LocalizationSettings::Deserialize(DeserializeStream& stream, ISerializeModi
 LocalizedString::LocalizedString(const LocalizedString& other)
     : Id(other.Id)
     , Value(other.Value)
+    , _cacheIndex(other._cacheIndex)
+    , _cacheVersion(other._cacheVersion)
 {
 }
 
 LocalizedString::LocalizedString(LocalizedString&& other) noexcept
     : Id(MoveTemp(other.Id))
     , Value(MoveTemp(other.Value))
+    , _cacheIndex(other._cacheIndex)
+    , _cacheVersion(other._cacheVersion)
 {
 }
 
@@ -114,6 +187,8 @@ LocalizedString& LocalizedString::operator=(const LocalizedString& other)
     {
         Id = other.Id;
         Value = other.Value;
+        _cacheIndex = other._cacheIndex;
+        _cacheVersion = other._cacheVersion;
     }
     return *this;
 }
@@ -124,6 +199,8 @@ LocalizedString& LocalizedString::operator=(LocalizedString&& other) noexcept
     {
         Id = MoveTemp(other.Id);
         Value = MoveTemp(other.Value);
+        _cacheIndex = other._cacheIndex;
+        _cacheVersion = other._cacheVersion;
     }
     return *this;
 }
@@ -142,14 +219,21 @@ LocalizedString& LocalizedString::operator=(String&& value) noexcept
     return *this;
 }
 
+StringView LocalizedString::ToStringView() const
+{
+    return Instance.Get(*this, 0);
+}
+
 String LocalizedString::ToString() const
 {
-    return Localization::GetString(Id, Value);
+    return Instance.Get(*this, 0);
 }
 
 String LocalizedString::ToStringPlural(int32 n) const
 {
-    return Localization::GetPluralString(Id, n, Value);
+    CHECK_RETURN(n >= 1, String::Format(Value.GetText(), n));
+    const StringView format = Instance.Get(*this, n - 1);
+    return String::Format(format.GetText(), n);
 }
 
 void LocalizationService::OnLocalizationChanged()
@@ -158,6 +242,7 @@ void LocalizationService::OnLocalizationChanged()
 
     Instance.LocalizedStringTables.Clear();
     Instance.FallbackStringTables.Clear();
+    Instance.StringsDirty = true;
     const StringView en(TEXT("en"));
 
     // Collect all localization tables into mapping locale -> tables
@@ -261,6 +346,56 @@ void LocalizationService::OnLocalizationChanged()
     Localization::LocalizationChanged();
 }
 
+void LocalizationService::CompileStrings()
+{
+    PROFILE_CPU();
+
+    // Merge messages from tables in the lookup order (each plural form is picked from the first table that contains it)
+    Dictionary<StringView, Array<StringView>> merged;
+    const auto mergeTable = [&merged](const LocalizedStringTable* table)
+    {
+        if (!table)
+            return;
+        for (auto& e : table->Entries)
+        {
+            auto& messages = merged[e.Key];
+            for (int32 i = messages.Count(); i < e.Value.Count(); i++)
+                messages.Add(e.Value[i]);
+        }
+    };
+    for (auto& e : LocalizedStringTables)
+        mergeTable(e.Get());
+    for (auto& e : LocalizedStringTables)
+        mergeTable(e ? e->FallbackTable.Get() : nullptr);
+    for (auto& e : FallbackStringTables)
+        mergeTable(e.Get());
+
+    // Intern texts into a single buffer
+    Strings.Clear();
+    Texts.Clear();
+    TextsData.Clear();
+    Strings.EnsureCapacity(merged.Count());
+    const auto addText = [this](const StringView& text)
+    {
+        Texts.Add({ TextsData.Count(), text.Length() });
+        TextsData.Add(text.Get(), text.Length());
+        TextsData.Add(0);
+    };
+    for (auto& e : merged)
+    {
+        StringEntry& entry = Strings.AddOne();
+        entry.Hash = GetHash(e.Key);
+        entry.Id = Texts.Count();
+        addText(e.Key);
+        entry.First = Texts.Count();
+        entry.Count = e.Value.Count();
+        for (const StringView& message : e.Value)
+            addText(message);
+    }
+    Sorting::QuickSort(Strings.Get(), Strings.Count());
+    StringsVersion++;
+}
+
 bool LocalizationService::Init()
 {
     // Use system language as default
@@ -323,6 +458,6 @@ String Localization::GetString(const String& id, const String& fallback)
 String Localization::GetPluralString(const String& id, int32 n, const String& fallback)
 {
     CHECK_RETURN(n >= 1, String::Format(fallback.GetText(), n));
-    const String& format = Instance.Get(id, n - 1, fallback);
+    const StringView format = Instance.Get(id, n - 1, fallback);
     return String::Format(format.GetText(), n);
 }
@@ -11,6 +11,12 @@
 API_CLASS(Sealed) class FLAXENGINE_API LocalizedString
 {
     DECLARE_SCRIPTING_TYPE_MINIMAL(LocalizedString);
+    friend class LocalizationService;
+private:
+    // Cached index of the resolved localized string entry for the current language
+    mutable int32 _cacheIndex = -1;
+    mutable uint32 _cacheVersion = 0;
+
 public:
     /// <summary>
     /// The localized string identifier. Used to lookup text value for a current language (via <see cref="Localization::GetString"/>).
@@ -55,6 +61,13 @@ API_CLASS(Sealed) class FLAXENGINE_API LocalizedString
     }
 
 public:
+    /// <summary>
+    /// Gets the localized text for the current language without allocating a new string. The id lookup is resolved once and cached until localization changes, so it's fast to call every frame.
+    /// </summary>
+    /// <remarks>The returned view is valid until localization or this object gets modified.</remarks>
+    /// <returns>The localized text (or the value if localized string is missing).</returns>
+    StringView ToStringView() const;
+
     String ToString() const;
     String ToStringPlural(int32 n) const;
 };
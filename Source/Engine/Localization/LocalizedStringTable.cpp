@@ -12,6 +12,8 @@
 
 REGISTER_JSON_ASSET(LocalizedStringTable, "FlaxEngine.LocalizedStringTable", true);
 
+extern void OnLocalizedStringTableChanged();
+
 LocalizedStringTable::LocalizedStringTable(const SpawnParams& params, const AssetInfo* info)
     : JsonAssetBase(params, info)
 {
@@ -23,6 +25,7 @@ void LocalizedStringTable::AddString(const StringView& id, const StringView& val
     auto& values = Entries[id];
     values.Resize(1);
     values[0] = value;
+    OnLocalizedStringTableChanged();
 }
 
 void LocalizedStringTable::AddPluralString(const StringView& id, const StringView& value, int32 n)
@@ -31,6 +34,7 @@ void LocalizedStringTable::AddPluralString(const StringView& id, const StringVie
     auto& values = Entries[id];
     values.Resize(Math::Max(values.Count(), n + 1));
     values[n] = value;
+    OnLocalizedStringTableChanged();
 }
 
 String LocalizedStringTable::GetString(const String& id) const
@@ -86,6 +90,7 @@ Asset::LoadResult LocalizedStringTable::loadAsset()
             }
         }
     }
+    OnLocalizedStringTableChanged();
 
     return result;
 }
@@ -98,6 +103,7 @@ void LocalizedStringTable::unload(bool isReloading)
     Locale.Clear();
     FallbackTable = nullptr;
     Entries.Clear();
+    OnLocalizedStringTableChanged();
 }
 
 void LocalizedStringTable::OnGetData(rapidjson_flax::StringBuffer& buffer) const
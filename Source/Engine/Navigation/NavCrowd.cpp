@@ -8,8 +8,20 @@
 #include "Engine/Level/Scene/Scene.h"
 #include "Engine/Profiler/ProfilerCPU.h"
 #include "Engine/Threading/Threading.h"
+#include "Engine/Threading/JobSystem.h"
 #include <ThirdParty/recastnavigation/DetourCrowd.h>
 
+namespace
+{
+    void CrowdParallelFor(void* userData, void (*job)(void* context, int index), void* context, int count)
+    {
+        JobSystem::Execute([job, context](int32 i)
+        {
+            job(context, i);
+        }, count);
+    }
+}
+
 NavCrowd::NavCrowd(const SpawnParams& params)
     : ScriptingObject(params)
 {
@@ -82,7 +94,17 @@ bool NavCrowd::Init(float maxAgentRadius, int32 maxAgents, NavMeshRuntime* navMe
         }
     }
 
-    return !_crowd->init(maxAgents, maxAgentRadius, navMesh->GetNavMesh());
+    if (!_crowd->init(maxAgents, maxAgentRadius, navMesh->GetNavMesh()))
+        return true;
+
+    // Update agents in parallel on a job system (crowd uses a separate navmesh query and obstacle avoidance query per job)
+    const int32 maxWorkers = JobSystem::GetThreadsCount();
+    if (maxWorkers > 1 && !_crowd->setParallelFor(CrowdParallelFor, nullptr, maxWorkers))
+    {
+        LOG(Warning, "Failed to setup crowd parallel update.");
+    }
+
+    return false;
 }
 
 int32 NavCrowd::AddAgent(const Vector3& position, const NavAgentProperties& properties)
@@ -133,6 +155,52 @@ void NavCrowd::SetAgentVelocity(int32 id, const Vector3& velocity)
     }
 }
 
+void NavCrowd::GetAgentsPositions(const Span<int32>& ids, Array<Vector3>& positions) const
+{
+    PROFILE_CPU();
+    positions.Resize(ids.Length());
+    for (int32 i = 0; i < ids.Length(); i++)
+    {
+        const dtCrowdAgent* agent = _crowd->getAgent(ids[i]);
+        positions.Get()[i] = agent ? Vector3(Float3(agent->npos)) : Vector3::Zero;
+    }
+}
+
+void NavCrowd::SetAgentsPositions(const Span<int32>& ids, const Span<Vector3>& positions)
+{
+    PROFILE_CPU();
+    CHECK(ids.Length() == positions.Length());
+    for (int32 i = 0; i < ids.Length(); i++)
+    {
+        dtCrowdAgent* agent = _crowd->getEditableAgent(ids[i]);
+        if (agent)
+            *(Float3*)agent->npos = Float3(positions[i]);
+    }
+}
+
+void NavCrowd::GetAgentsVelocities(const Span<int32>& ids, Array<Vector3>& velocities) const
+{
+    PROFILE_CPU();
+    velocities.Resize(ids.Length());
+    for (int32 i = 0; i < ids.Length(); i++)
+    {
+        const dtCrowdAgent* agent = _crowd->getAgent(ids[i]);
+        velocities.Get()[i] = agent ? Vector3(Float3(agent->vel)) : Vector3::Zero;
+    }
+}
+
+void NavCrowd::SetAgentsVelocities(const Span<int32>& ids, const Span<Vector3>& velocities)
+{
+    PROFILE_CPU();
+    CHECK(ids.Length() == velocities.Length());
+    for (int32 i = 0; i < ids.Length(); i++)
+    {
+        dtCrowdAgent* agent = _crowd->getEditableAgent(ids[i]);
+        if (agent)
+            *(Float3*)agent->vel = Float3(velocities[i]);
+    }
+}
+
 void NavCrowd::SetAgentProperties(int32 id, const NavAgentProperties& properties)
 {
     dtCrowdAgentParams agentParams;
@@ -3,6 +3,8 @@
 #pragma once
 
 #include "Engine/Scripting/ScriptingObject.h"
+#include "Engine/Core/Types/Span.h"
+#include "Engine/Core/Collections/Array.h"
 #include "NavigationTypes.h"
 
 class NavMesh;
@@ -12,6 +14,7 @@ struct dtCrowdAgentParams;
 
 /// <summary>
 /// Navigation steering behaviors system for a group of agents. Handles avoidance between agents by using an adaptive RVO sampling calculation.
+/// Agents are partitioned spatially and updated in parallel on a job system. Use batch functions (eg. GetAgentsPositions) to access many agents at once.
 /// </summary>
 API_CLASS() class FLAXENGINE_API NavCrowd : public ScriptingObject
 {
@@ -84,6 +87,34 @@ API_CLASS() class FLAXENGINE_API NavCrowd : public ScriptingObject
     /// <param name="velocity">The agent velocity (direction * speed).</param>
     API_FUNCTION() void SetAgentVelocity(int32 id, const Vector3& velocity);
 
+    /// <summary>
+    /// Gets the current positions of the agents.
+    /// </summary>
+    /// <param name="ids">The agent IDs.</param>
+    /// <param name="positions">The output agents positions (the same order as IDs).</param>
+    API_FUNCTION() void GetAgentsPositions(const Span<int32>& ids, API_PARAM(Out) Array<Vector3>& positions) const;
+
+    /// <summary>
+    /// Sets the current positions of the agents.
+    /// </summary>
+    /// <param name="ids">The agent IDs.</param>
+    /// <param name="positions">The agents positions (the same order as IDs).</param>
+    API_FUNCTION() void SetAgentsPositions(const Span<int32>& ids, const Span<Vector3>& positions);
+
+    /// <summary>
+    /// Gets the current velocities (direction * speed) of the agents.
+    /// </summary>
+    /// <param name="ids">The agent IDs.</param>
+    /// <param name="velocities">The output agents velocities (the same order as IDs).</param>
+    API_FUNCTION() void GetAgentsVelocities(const Span<int32>& ids, API_PARAM(Out) Array<Vector3>& velocities) const;
+
+    /// <summary>
+    /// Sets the current velocities (direction * speed) of the agents.
+    /// </summary>
+    /// <param name="ids">The agent IDs.</param>
+    /// <param name="velocities">The agents velocities (the same order as IDs).</param>
+    API_FUNCTION() void SetAgentsVelocities(const Span<int32>& ids, const Span<Vector3>& velocities);
+
     /// <summary>
     /// Updates the agent properties.
     /// </summary>
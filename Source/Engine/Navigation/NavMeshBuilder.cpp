@@ -10,6 +10,7 @@
 #include "NavModifierVolume.h"
 #include "NavMeshRuntime.h"
 #include "Engine/Core/Log.h"
+#include "Engine/Core/Collections/Dictionary.h"
 #include "Engine/Core/Math/BoundingBox.h"
 #include "Engine/Core/Math/Vector3.h"
 #include "Engine/Physics/Colliders/BoxCollider.h"
@@ -17,15 +18,22 @@
 #include "Engine/Physics/Colliders/CapsuleCollider.h"
 #include "Engine/Physics/Colliders/MeshCollider.h"
 #include "Engine/Physics/Colliders/SplineCollider.h"
+#include "Engine/Threading/ThreadPool.h"
 #include "Engine/Threading/ThreadPoolTask.h"
+#include "Engine/Streaming/Streaming.h"
 #include "Engine/Terrain/TerrainPatch.h"
 #include "Engine/Terrain/Terrain.h"
 #include "Engine/Profiler/ProfilerCPU.h"
 #include "Engine/Level/Scene/Scene.h"
 #include "Engine/Level/Level.h"
 #include <ThirdParty/recastnavigation/Recast.h>
+#include <ThirdParty/recastnavigation/RecastAlloc.h>
 #include <ThirdParty/recastnavigation/DetourNavMeshBuilder.h>
 #include <ThirdParty/recastnavigation/DetourNavMesh.h>
+#include <ThirdParty/LZ4/lz4.h>
+#if USE_EDITOR
+#include "Editor/Editor.h"
+#endif
 
 int32 BoxTrianglesIndicesCache[] =
 {
@@ -47,6 +55,7 @@ int32 BoxTrianglesIndicesCache[] =
 
 #define NAV_MESH_TILE_MAX_EXTENT 100000000
 #define NAV_MESH_BUILD_DEBUG_DRAW_GEOMETRY 0
+#define NAV_MESH_TILE_CACHE_MAX_SIZE (64 * 1024 * 1024)
 
 #if NAV_MESH_BUILD_DEBUG_DRAW_GEOMETRY
 #include "Engine/Debug/DebugDraw.h"
@@ -383,6 +392,186 @@ bool GetNavMeshTileBounds(Scene* scene, NavMesh* navMesh, int32 x, int32 y, floa
     return foundAnyVolume;
 }
 
+struct TileCacheKey
+{
+    Guid NavMesh;
+    int32 X;
+    int32 Y;
+
+    bool operator==(const TileCacheKey& other) const
+    {
+        return NavMesh == other.NavMesh && X == other.X && Y == other.Y;
+    }
+};
+
+inline uint32 GetHash(const TileCacheKey& key)
+{
+    uint32 hash = GetHash(key.NavMesh);
+    CombineHash(hash, GetHash(key.X));
+    CombineHash(hash, GetHash(key.Y));
+    return hash;
+}
+
+// Cached input of the tile building: compact heightfield with the rasterized scene geometry (eroded but without nav modifiers applied), compressed with LZ4.
+struct TileCacheEntry
+{
+    rcConfig Config;
+    Matrix WorldToNavMesh;
+    int32 DataSize;
+    uint64 LastUsed;
+    Array<byte> Data;
+};
+
+struct TileCacheHeader
+{
+    int32 Width;
+    int32 Height;
+    int32 SpanCount;
+    int32 WalkableHeight;
+    int32 WalkableClimb;
+    int32 BorderSize;
+    Float3 BMin;
+    Float3 BMax;
+    float CellSize;
+    float CellHeight;
+};
+
+CriticalSection NavTileCacheLocker;
+Dictionary<TileCacheKey, TileCacheEntry> NavTileCache;
+int32 NavTileCacheSize = 0;
+uint64 NavTileCacheCounter = 0;
+
+void CacheTileInput(const NavMesh* navMesh, int32 x, int32 y, const rcConfig& config, const Matrix& worldToNavMesh, const rcCompactHeightfield& chf)
+{
+    PROFILE_CPU();
+
+    // Serialize compact heightfield
+    const int32 cellsSize = chf.width * chf.height * sizeof(rcCompactCell);
+    const int32 spansSize = chf.spanCount * sizeof(rcCompactSpan);
+    const int32 areasSize = chf.spanCount * sizeof(unsigned char);
+    const int32 dataSize = sizeof(TileCacheHeader) + cellsSize + spansSize + areasSize;
+    Array<byte> data;
+    data.Resize(dataSize);
+    TileCacheHeader header;
+    header.Width = chf.width;
+    header.Height = chf.height;
+    header.SpanCount = chf.spanCount;
+    header.WalkableHeight = chf.walkableHeight;
+    header.WalkableClimb = chf.walkableClimb;
+    header.BorderSize = chf.borderSize;
+    header.BMin = *(const Float3*)chf.bmin;
+    header.BMax = *(const Float3*)chf.bmax;
+    header.CellSize = chf.cs;
+    header.CellHeight = chf.ch;
+    byte* ptr = data.Get();
+    Platform::MemoryCopy(ptr, &header, sizeof(header));
+    ptr += sizeof(header);
+    Platform::MemoryCopy(ptr, chf.cells, cellsSize);
+    ptr += cellsSize;
+    Platform::MemoryCopy(ptr, chf.spans, spansSize);
+    ptr += spansSize;
+    Platform::MemoryCopy(ptr, chf.areas, areasSize);
+
+    // Compress
+    Array<byte> compressed;
+    compressed.Resize(LZ4_compressBound(dataSize));
+    const int32 compressedSize = LZ4_compress_default((const char*)data.Get(), (char*)compressed.Get(), dataSize, compressed.Count());
+    if (compressedSize <= 0)
+        return;
+
+    ScopeLock lock(NavTileCacheLocker);
+    TileCacheEntry& entry = NavTileCache[TileCacheKey{ navMesh->GetID(), x, y }];
+    NavTileCacheSize -= entry.Data.Count();
+    entry.Config = config;
+    entry.WorldToNavMesh = worldToNavMesh;
+    entry.DataSize = dataSize;
+    entry.LastUsed = ++NavTileCacheCounter;
+    entry.Data.Set(compressed.Get(), compressedSize);
+    NavTileCacheSize += compressedSize;
+
+    // Evict the least recently used tiles to fit into the memory budget
+    while (NavTileCacheSize > NAV_MESH_TILE_CACHE_MAX_SIZE && NavTileCache.Count() > 1)
+    {
+        auto oldest = NavTileCache.Begin();
+        for (auto i = NavTileCache.Begin(); i.IsNotEnd(); ++i)
+        {
+            if (i->Value.LastUsed < oldest->Value.LastUsed)
+                oldest = i;
+        }
+        NavTileCacheSize -= oldest->Value.Data.Count();
+        NavTileCache.Remove(oldest);
+    }
+}
+
+rcCompactHeightfield* LoadTileInput(const NavMesh* navMesh, int32 x, int32 y, const rcConfig& config, const Matrix& worldToNavMesh)
+{
+    PROFILE_CPU();
+
+    // Decompress cached data (skip if tile was built with different settings)
+    Array<byte> data;
+    {
+        ScopeLock lock(NavTileCacheLocker);
+        TileCacheEntry* entry = NavTileCache.TryGet(TileCacheKey{ navMesh->GetID(), x, y });
+        if (!entry || Platform::MemoryCompare(&entry->Config, &config, sizeof(rcConfig)) != 0 || entry->WorldToNavMesh != worldToNavMesh)
+            return nullptr;
+        entry->LastUsed = ++NavTileCacheCounter;
+        data.Resize(entry->DataSize);
+        if (LZ4_decompress_safe((const char*)entry->Data.Get(), (char*)data.Get(), entry->Data.Count(), entry->DataSize) != entry->DataSize)
+            return nullptr;
+    }
+
+    // Deserialize compact heightfield
+    const byte* ptr = data.Get();
+    const TileCacheHeader& header = *(const TileCacheHeader*)ptr;
+    ptr += sizeof(TileCacheHeader);
+    const int32 cellsSize = header.Width * header.Height * sizeof(rcCompactCell);
+    const int32 spansSize = header.SpanCount * sizeof(rcCompactSpan);
+    const int32 areasSize = header.SpanCount * sizeof(unsigned char);
+    rcCompactHeightfield* chf = rcAllocCompactHeightfield();
+    if (!chf)
+        return nullptr;
+    chf->width = header.Width;
+    chf->height = header.Height;
+    chf->spanCount = header.SpanCount;
+    chf->walkableHeight = header.WalkableHeight;
+    chf->walkableClimb = header.WalkableClimb;
+    chf->borderSize = header.BorderSize;
+    chf->maxDistance = 0;
+    chf->maxRegions = 0;
+    *(Float3*)chf->bmin = header.BMin;
+    *(Float3*)chf->bmax = header.BMax;
+    chf->cs = header.CellSize;
+    chf->ch = header.CellHeight;
+    chf->cells = (rcCompactCell*)rcAlloc(cellsSize, RC_ALLOC_PERM);
+    chf->spans = (rcCompactSpan*)rcAlloc(spansSize, RC_ALLOC_PERM);
+    chf->areas = (unsigned char*)rcAlloc(areasSize, RC_ALLOC_PERM);
+    if (!chf->cells || !chf->spans || !chf->areas)
+    {
+        rcFreeCompactHeightfield(chf);
+        return nullptr;
+    }
+    Platform::MemoryCopy(chf->cells, ptr, cellsSize);
+    ptr += cellsSize;
+    Platform::MemoryCopy(chf->spans, ptr, spansSize);
+    ptr += spansSize;
+    Platform::MemoryCopy(chf->areas, ptr, areasSize);
+    return chf;
+}
+
+void ClearTileCache(const NavMesh* navMesh)
+{
+    ScopeLock lock(NavTileCacheLocker);
+    const Guid id = navMesh->GetID();
+    for (auto i = NavTileCache.Begin(); i.IsNotEnd(); ++i)
+    {
+        if (i->Key.NavMesh == id)
+        {
+            NavTileCacheSize -= i->Value.Data.Count();
+            NavTileCache.Remove(i);
+        }
+    }
+}
+
 void RemoveTile(NavMesh* navMesh, NavMeshRuntime* runtime, int32 x, int32 y, int32 layer)
 {
     ScopeLock lock(runtime->Locker);
@@ -403,7 +592,7 @@ void RemoveTile(NavMesh* navMesh, NavMeshRuntime* runtime, int32 x, int32 y, int
     runtime->RemoveTile(x, y, layer);
 }
 
-bool GenerateTile(NavMesh* navMesh, NavMeshRuntime* runtime, int32 x, int32 y, BoundingBox& tileBoundsNavMesh, const Matrix& worldToNavMesh, float tileSize, rcConfig& config)
+bool GenerateTile(NavMesh* navMesh, NavMeshRuntime* runtime, int32 x, int32 y, BoundingBox& tileBoundsNavMesh, const Matrix& worldToNavMesh, float tileSize, rcConfig& config, bool modifiersOnly)
 {
     rcContext context;
     int32 layer = 0;
@@ -416,16 +605,22 @@ bool GenerateTile(NavMesh* navMesh, NavMeshRuntime* runtime, int32 x, int32 y, B
     *(Float3*)&config.bmin = tileBoundsNavMesh.Minimum;
     *(Float3*)&config.bmax = tileBoundsNavMesh.Maximum;
 
-    rcHeightfield* heightfield = rcAllocHeightfield();
-    if (!heightfield)
-    {
-        LOG(Warning, "Could not generate navmesh: Out of memory for heightfield.");
-        return true;
-    }
-    if (!rcCreateHeightfield(&context, *heightfield, config.width, config.height, config.bmin, config.bmax, config.cs, config.ch))
+    // Reuse the cached scene geometry if only nav modifiers have changed (eg. dynamic obstacle moved) to skip voxelization
+    rcCompactHeightfield* compactHeightfield = modifiersOnly ? LoadTileInput(navMesh, x, y, config, worldToNavMesh) : nullptr;
+    rcHeightfield* heightfield = nullptr;
+    if (!compactHeightfield)
     {
-        LOG(Warning, "Could not generate navmesh: Could not create solid heightfield.");
-        return true;
+        heightfield = rcAllocHeightfield();
+        if (!heightfield)
+        {
+            LOG(Warning, "Could not generate navmesh: Out of memory for heightfield.");
+            return true;
+        }
+        if (!rcCreateHeightfield(&context, *heightfield, config.width, config.height, config.bmin, config.bmax, config.cs, config.ch))
+        {
+            LOG(Warning, "Could not generate navmesh: Could not create solid heightfield.");
+            return true;
+        }
     }
 
     Array<OffMeshLink> offMeshLinks;
@@ -443,6 +638,10 @@ bool GenerateTile(NavMesh* navMesh, NavMeshRuntime* runtime, int32 x, int32 y, B
             {
                 for (Actor* actor : scene->Navigation.Actors)
                 {
+                    // Skip scene geometry when using cached heightfield
+                    if (!heightfield && !dynamic_cast<NavModifierVolume*>(actor) && !dynamic_cast<NavLink*>(actor))
+                        continue;
+
                     BoundingBox actorBoxNavMesh;
                     BoundingBox::Transform(actor->GetBox(), rasterizer.WorldToNavMesh, actorBoxNavMesh);
                     if (actorBoxNavMesh.Intersects(rasterizer.TileBoundsNavMesh) &&
@@ -462,35 +661,41 @@ bool GenerateTile(NavMesh* navMesh, NavMeshRuntime* runtime, int32 x, int32 y, B
         }
     }
 
+    if (heightfield)
     {
-        PROFILE_CPU_NAMED("FilterHeightfield");
-        rcFilterLowHangingWalkableObstacles(&context, config.walkableClimb, *heightfield);
-        rcFilterLedgeSpans(&context, config.walkableHeight, config.walkableClimb, *heightfield);
-        rcFilterWalkableLowHeightSpans(&context, config.walkableHeight, *heightfield);
-    }
+        {
+            PROFILE_CPU_NAMED("FilterHeightfield");
+            rcFilterLowHangingWalkableObstacles(&context, config.walkableClimb, *heightfield);
+            rcFilterLedgeSpans(&context, config.walkableHeight, config.walkableClimb, *heightfield);
+            rcFilterWalkableLowHeightSpans(&context, config.walkableHeight, *heightfield);
+        }
 
-    rcCompactHeightfield* compactHeightfield = rcAllocCompactHeightfield();
-    if (!compactHeightfield)
-    {
-        LOG(Warning, "Could not generate navmesh: Out of memory compact heightfield.");
-        return true;
-    }
-    {
-        PROFILE_CPU_NAMED("CompactHeightfield");
-        if (!rcBuildCompactHeightfield(&context, config.walkableHeight, config.walkableClimb, *heightfield, *compactHeightfield))
+        compactHeightfield = rcAllocCompactHeightfield();
+        if (!compactHeightfield)
         {
-            LOG(Warning, "Could not generate navmesh: Could not build compact data.");
+            LOG(Warning, "Could not generate navmesh: Out of memory compact heightfield.");
             return true;
         }
-    }
-    rcFreeHeightField(heightfield);
-    {
-        PROFILE_CPU_NAMED("ErodeWalkableArea");
-        if (!rcErodeWalkableArea(&context, config.walkableRadius, *compactHeightfield))
         {
-            LOG(Warning, "Could not generate navmesh: Could not erode.");
-            return true;
+            PROFILE_CPU_NAMED("CompactHeightfield");
+            if (!rcBuildCompactHeightfield(&context, config.walkableHeight, config.walkableClimb, *heightfield, *compactHeightfield))
+            {
+                LOG(Warning, "Could not generate navmesh: Could not build compact data.");
+                return true;
+            }
         }
+        rcFreeHeightField(heightfield);
+        {
+            PROFILE_CPU_NAMED("ErodeWalkableArea");
+            if (!rcErodeWalkableArea(&context, config.walkableRadius, *compactHeightfield))
+            {
+                LOG(Warning, "Could not generate navmesh: Could not erode.");
+                return true;
+            }
+        }
+
+        // Cache the tile input for the fast rebuilds when nav modifiers change
+        CacheTileInput(navMesh, x, y, config, worldToNavMesh, *compactHeightfield);
     }
 
     // Mark areas
@@ -731,6 +936,7 @@ struct BuildRequest
     ScriptingObjectReference<Scene> Scene;
     DateTime Time;
     BoundingBox DirtyBounds;
+    bool ModifiersOnly;
 };
 
 CriticalSection NavBuildQueueLocker;
@@ -752,6 +958,8 @@ class NavMeshTileBuildTask : public ThreadPoolTask
     int32 Y;
     float TileSize;
     rcConfig Config;
+    bool ModifiersOnly;
+    bool IsStarted = false;
 
 public:
     // [ThreadPoolTask]
@@ -761,7 +969,7 @@ class NavMeshTileBuildTask : public ThreadPoolTask
         const auto navMesh = NavMesh.Get();
         if (!navMesh)
             return false;
-        if (GenerateTile(NavMesh, Runtime, X, Y, TileBoundsNavMesh, WorldToNavMesh, TileSize, Config))
+        if (GenerateTile(NavMesh, Runtime, X, Y, TileBoundsNavMesh, WorldToNavMesh, TileSize, Config, ModifiersOnly))
         {
             LOG(Warning, "Failed to generate navmesh tile at {0}x{1}.", X, Y);
         }
@@ -811,6 +1019,10 @@ void OnSceneUnloading(Scene* scene, const Guid& sceneId)
         }
     }
     NavBuildTasksLocker.Unlock();
+
+    // Free cached tiles input
+    for (NavMesh* navMesh : scene->Navigation.Meshes)
+        ClearTileCache(navMesh);
 }
 
 void NavMeshBuilder::Init()
@@ -840,18 +1052,23 @@ float NavMeshBuilder::GetNavMeshBuildingProgress()
     return result;
 }
 
-void BuildTileAsync(NavMesh* navMesh, const int32 x, const int32 y, const rcConfig& config, const BoundingBox& tileBoundsNavMesh, const Matrix& worldToNavMesh, float tileSize)
+void BuildTileAsync(NavMesh* navMesh, const int32 x, const int32 y, const rcConfig& config, const BoundingBox& tileBoundsNavMesh, const Matrix& worldToNavMesh, float tileSize, bool modifiersOnly)
 {
     NavMeshRuntime* runtime = navMesh->GetRuntime();
-    NavBuildTasksLocker.Lock();
+    ScopeLock lock(NavBuildTasksLocker);
 
-    // Skip if this tile is already during cooking
+    // Update the pending task if this tile is already waiting for cooking (tasks are started in NavMeshBuilder::Update)
     for (int32 i = 0; i < NavBuildTasks.Count(); i++)
     {
         const auto task = NavBuildTasks[i];
-        if (task->X == x && task->Y == y && task->Runtime == runtime)
+        if (task->X == x && task->Y == y && task->Runtime == runtime && !task->IsStarted)
         {
-            NavBuildTasksLocker.Unlock();
+            task->NavMesh = navMesh;
+            task->TileBoundsNavMesh = tileBoundsNavMesh;
+            task->WorldToNavMesh = worldToNavMesh;
+            task->TileSize = tileSize;
+            task->Config = config;
+            task->ModifiersOnly &= modifiersOnly;
             return;
         }
     }
@@ -867,16 +1084,82 @@ void BuildTileAsync(NavMesh* navMesh, const int32 x, const int32 y, const rcConf
     task->WorldToNavMesh = worldToNavMesh;
     task->TileSize = tileSize;
     task->Config = config;
+    task->ModifiersOnly = modifiersOnly;
     NavBuildTasks.Add(task);
     NavBuildTasksMaxCount++;
+}
 
-    NavBuildTasksLocker.Unlock();
+void StartTileBuildTasks()
+{
+    auto settings = NavigationSettings::Get();
+    int32 maxActiveCount = settings->MaxConcurrentTileBuilds;
+    if (maxActiveCount <= 0)
+    {
+        // Leave some threads for the other async work (eg. content streaming) when game is running
+        maxActiveCount = Math::Max(ThreadPool::GetThreadsCount() / 2, 1);
+#if USE_EDITOR
+        if (!Editor::IsPlayMode)
+            maxActiveCount = Math::Max(ThreadPool::GetThreadsCount(), 1);
+#endif
+    }
+    Array<Vector3, InlinedAllocation<8>> sources;
+    Streaming::GetSourcesLocations(sources);
 
-    // Invoke job
-    task->Start();
+    Array<NavMeshTileBuildTask*, InlinedAllocation<32>> activeTasks;
+    Array<NavMeshTileBuildTask*, InlinedAllocation<32>> startTasks;
+    {
+        ScopeLock lock(NavBuildTasksLocker);
+        for (auto task : NavBuildTasks)
+        {
+            if (task->IsStarted)
+                activeTasks.Add(task);
+        }
+        while (activeTasks.Count() < maxActiveCount)
+        {
+            // Pick the pending tile that is the closest to the streaming sources (eg. camera or player) to update navigation near the agents first
+            NavMeshTileBuildTask* best = nullptr;
+            float bestDistance = MAX_float;
+            for (auto task : NavBuildTasks)
+            {
+                if (task->IsStarted)
+                    continue;
+                bool isTileBuilding = false;
+                for (auto activeTask : activeTasks)
+                    isTileBuilding |= activeTask->X == task->X && activeTask->Y == task->Y && activeTask->Runtime == task->Runtime;
+                if (isTileBuilding)
+                    continue;
+                float distance = 0.0f;
+                if (sources.HasItems())
+                {
+                    const Float2 tileCenter((task->TileBoundsNavMesh.Minimum.X + task->TileBoundsNavMesh.Maximum.X) * 0.5f, (task->TileBoundsNavMesh.Minimum.Z + task->TileBoundsNavMesh.Maximum.Z) * 0.5f);
+                    distance = MAX_float;
+                    for (const Vector3& source : sources)
+                    {
+                        Float3 sourceNavMesh;
+                        Float3::Transform((Float3)source, task->WorldToNavMesh, sourceNavMesh);
+                        distance = Math::Min(distance, Float2::DistanceSquared(tileCenter, Float2(sourceNavMesh.X, sourceNavMesh.Z)));
+                    }
+                }
+                if (!best || distance < bestDistance)
+                {
+                    best = task;
+                    bestDistance = distance;
+                }
+            }
+            if (!best)
+                break;
+            best->IsStarted = true;
+            activeTasks.Add(best);
+            startTasks.Add(best);
+        }
+    }
+
+    // Invoke jobs
+    for (auto task : startTasks)
+        task->Start();
 }
 
-void BuildDirtyBounds(Scene* scene, NavMesh* navMesh, const BoundingBox& dirtyBounds, bool rebuild)
+void BuildDirtyBounds(Scene* scene, NavMesh* navMesh, const BoundingBox& dirtyBounds, bool rebuild, bool modifiersOnly)
 {
     const float tileSize = GetTileSize();
     NavMeshRuntime* runtime = navMesh->GetRuntime();
@@ -937,7 +1220,7 @@ void BuildDirtyBounds(Scene* scene, NavMesh* navMesh, const BoundingBox& dirtyBo
                 BoundingBox tileBoundsNavMesh;
                 if (GetNavMeshTileBounds(scene, navMesh, x, y, tileSize, tileBoundsNavMesh, worldToNavMesh))
                 {
-                    BuildTileAsync(navMesh, x, y, config, tileBoundsNavMesh, worldToNavMesh, tileSize);
+                    BuildTileAsync(navMesh, x, y, config, tileBoundsNavMesh, worldToNavMesh, tileSize, modifiersOnly);
                 }
                 else
                 {
@@ -948,7 +1231,7 @@ void BuildDirtyBounds(Scene* scene, NavMesh* navMesh, const BoundingBox& dirtyBo
     }
 }
 
-void BuildDirtyBounds(Scene* scene, const BoundingBox& dirtyBounds, bool rebuild)
+void BuildDirtyBounds(Scene* scene, const BoundingBox& dirtyBounds, bool rebuild, bool modifiersOnly = false)
 {
     auto settings = NavigationSettings::Get();
 
@@ -1007,7 +1290,7 @@ void BuildDirtyBounds(Scene* scene, const BoundingBox& dirtyBounds, bool rebuild
     // Build all navmeshes on the scene
     for (NavMesh* navMesh : scene->Navigation.Meshes)
     {
-        BuildDirtyBounds(scene, navMesh, dirtyBounds, rebuild);
+        BuildDirtyBounds(scene, navMesh, dirtyBounds, rebuild, modifiersOnly);
     }
 
     // Remove unused navmeshes
@@ -1050,6 +1333,7 @@ void ClearNavigation(Scene* scene)
     for (NavMesh* navMesh : scene->Navigation.Meshes)
     {
         navMesh->ClearData();
+        ClearTileCache(navMesh);
         if (autoRemoveMissingNavMeshes)
             navMesh->DeleteObject();
     }
@@ -1085,10 +1369,13 @@ void NavMeshBuilder::Update()
             }
             else
             {
-                BuildDirtyBounds(scene, req.DirtyBounds, false);
+                BuildDirtyBounds(scene, req.DirtyBounds, false, req.ModifiersOnly);
             }
         }
     }
+
+    // Kick the tile building tasks within the concurrency budget
+    StartTileBuildTasks();
 }
 
 void NavMeshBuilder::Build(Scene* scene, float timeoutMs)
@@ -1114,21 +1401,19 @@ void NavMeshBuilder::Build(Scene* scene, float timeoutMs)
     req.Scene = scene;
     req.Time = DateTime::NowUTC() + TimeSpan::FromMilliseconds(timeoutMs);
     req.DirtyBounds = BoundingBox::Empty;
+    req.ModifiersOnly = false;
 
-    for (int32 i = 0; i < NavBuildQueue.Count(); i++)
+    // Whole scene rebuild includes any pending dirty bounds
+    for (int32 i = NavBuildQueue.Count() - 1; i >= 0; i--)
     {
-        auto& e = NavBuildQueue[i];
-        if (e.Scene == scene && e.DirtyBounds == req.DirtyBounds)
-        {
-            e = req;
-            return;
-        }
+        if (NavBuildQueue[i].Scene == scene)
+            NavBuildQueue.RemoveAtKeepOrder(i);
     }
 
     NavBuildQueue.Add(req);
 }
 
-void NavMeshBuilder::Build(Scene* scene, const BoundingBox& dirtyBounds, float timeoutMs)
+void NavMeshBuilder::Build(Scene* scene, const BoundingBox& dirtyBounds, float timeoutMs, bool modifiersOnly)
 {
     if (!scene)
     {
@@ -1151,6 +1436,29 @@ void NavMeshBuilder::Build(Scene* scene, const BoundingBox& dirtyBounds, float t
     req.Scene = scene;
     req.Time = DateTime::NowUTC() + TimeSpan::FromMilliseconds(timeoutMs);
     req.DirtyBounds = dirtyBounds;
+    req.ModifiersOnly = modifiersOnly;
+
+    // Merge with the pending requests for the overlapping area to rebuild each tile once
+    for (int32 i = 0; i < NavBuildQueue.Count(); i++)
+    {
+        auto& e = NavBuildQueue[i];
+        if (e.Scene != scene)
+            continue;
+        if (e.DirtyBounds == BoundingBox::Empty)
+        {
+            // Whole scene rebuild is already pending
+            return;
+        }
+        if (e.DirtyBounds.Intersects(req.DirtyBounds))
+        {
+            BoundingBox::Merge(e.DirtyBounds, req.DirtyBounds, req.DirtyBounds);
+            if (e.Time > req.Time)
+                req.Time = e.Time;
+            req.ModifiersOnly &= e.ModifiersOnly;
+            NavBuildQueue.RemoveAtKeepOrder(i);
+            i = -1;
+        }
+    }
 
     NavBuildQueue.Add(req);
 }
@@ -12,6 +12,7 @@
 #include <ThirdParty/recastnavigation/RecastAlloc.h>
 
 #define MAX_NODES 2048
+#define NAV_MESH_PATH_CACHE_SIZE 64
 #define USE_DATA_LINK 0
 #define USE_NAV_MESH_ALLOC 1
 // TODO: try not using USE_NAV_MESH_ALLOC
@@ -23,21 +24,79 @@ namespace
         Platform::MemoryCopy(filter.m_areaCost, NavMeshRuntime::NavAreasCosts, sizeof(NavMeshRuntime::NavAreasCosts));
         static_assert(sizeof(dtQueryFilter::m_areaCost) == sizeof(NavMeshRuntime::NavAreasCosts), "Invalid navmesh area cost list.");
     }
+
+    bool BuildPath(const NavMeshRuntime* navMesh, const dtNavMeshQuery* query, dtStatus findPathStatus, dtPolyRef startPoly, const Vector3& startPosition, const Float3& startPositionNavMesh, Float3 endPositionNavMesh, const dtPolyRef* path, int32 pathSize, Array<Vector3, HeapAllocation>& resultPath, NavMeshPathFlags& resultFlags)
+    {
+        Quaternion invRotation;
+        Quaternion::Invert(navMesh->Properties.Rotation, invRotation);
+
+        if (pathSize == 1 && dtStatusDetail(findPathStatus, DT_PARTIAL_RESULT))
+        {
+            resultFlags |= NavMeshPathFlags::PartialPath;
+            // TODO: skip adding 2nd end point if it's not reachable (use navmesh raycast check? or physics check? or local Z distance check?)
+            resultPath.Resize(2);
+            resultPath[0] = startPosition;
+            query->closestPointOnPolyBoundary(startPoly, &endPositionNavMesh.X, &endPositionNavMesh.X);
+            resultPath[1] = endPositionNavMesh;
+            Vector3::Transform(resultPath[1], invRotation, resultPath[1]);
+        }
+        else
+        {
+            int pathPointsCount = 0;
+            Float3 pathPoints[NAV_MESH_PATH_MAX_SIZE];
+            const auto findStraightPathStatus = query->findStraightPath(&startPositionNavMesh.X, &endPositionNavMesh.X, path, pathSize, (float*)&pathPoints, nullptr, nullptr, &pathPointsCount, NAV_MESH_PATH_MAX_SIZE, DT_STRAIGHTPATH_AREA_CROSSINGS);
+            if (dtStatusFailed(findStraightPathStatus))
+            {
+                return false;
+            }
+            resultPath.Resize(pathPointsCount);
+            for (int32 i = 0; i < pathPointsCount; i++)
+            {
+                Vector3::Transform(pathPoints[i], invRotation, resultPath[i]);
+            }
+        }
+
+        return true;
+    }
+
+    struct QueryScope
+    {
+        const NavMeshRuntime* Runtime;
+        dtNavMeshQuery* Query;
+
+        QueryScope(const NavMeshRuntime* runtime)
+            : Runtime(runtime)
+            , Query(runtime->AcquireQuery())
+        {
+        }
+
+        ~QueryScope()
+        {
+            if (Query)
+                Runtime->ReleaseQuery(Query);
+        }
+    };
 }
 
 NavMeshRuntime::NavMeshRuntime(const NavMeshProperties& properties)
     : ScriptingObject(SpawnParams(Guid::New(), NavMeshRuntime::TypeInitializer))
+    , Locker("NavMeshRuntime")
     , Properties(properties)
 {
     _navMesh = nullptr;
     _navMeshQuery = dtAllocNavMeshQuery();
     _tileSize = 0;
+    _pathActive.ID = 0;
 }
 
 NavMeshRuntime::~NavMeshRuntime()
 {
     Dispose();
     dtFreeNavMeshQuery(_navMeshQuery);
+    for (dtNavMeshQuery* query : _queriesPool)
+        dtFreeNavMeshQuery(query);
+    if (_pathQuery)
+        dtFreeNavMeshQuery(_pathQuery);
 }
 
 int32 NavMeshRuntime::GetTilesCapacity() const
@@ -45,11 +104,53 @@ int32 NavMeshRuntime::GetTilesCapacity() const
     return _navMesh ? _navMesh->getMaxTiles() : 0;
 }
 
-bool NavMeshRuntime::FindDistanceToWall(const Vector3& startPosition, NavMeshHit& hitInfo, float maxDistance) const
+dtNavMeshQuery* NavMeshRuntime::AcquireQuery() const
 {
+    // Query is registered under the navmesh lock so tiles modification (done with the lock) can wait for all active queries
     ScopeLock lock(Locker);
-    const auto query = GetNavMeshQuery();
-    if (!query || !_navMesh)
+    if (!_navMesh)
+        return nullptr;
+    dtNavMeshQuery* query = nullptr;
+    _queriesLocker.Lock();
+    if (_queriesPool.HasItems())
+        query = _queriesPool.Pop();
+    _queriesLocker.Unlock();
+    if (!query)
+    {
+        query = dtAllocNavMeshQuery();
+        if (dtStatusFailed(query->init(_navMesh, MAX_NODES)))
+        {
+            LOG(Error, "Navmesh query {0} init failed", Properties.Name);
+            dtFreeNavMeshQuery(query);
+            return nullptr;
+        }
+    }
+    Platform::InterlockedIncrement(&_queriesActive);
+    return query;
+}
+
+void NavMeshRuntime::ReleaseQuery(dtNavMeshQuery* query) const
+{
+    ASSERT(query);
+    _queriesLocker.Lock();
+    _queriesPool.Add(query);
+    _queriesLocker.Unlock();
+    Platform::InterlockedDecrement(&_queriesActive);
+}
+
+void NavMeshRuntime::BeginTilesModification()
+{
+    // Locker is held by the caller so no new queries can start
+    while (Platform::AtomicRead(&_queriesActive) != 0)
+        Platform::Sleep(0);
+    _tilesVersion++;
+}
+
+bool NavMeshRuntime::FindDistanceToWall(const Vector3& startPosition, NavMeshHit& hitInfo, float maxDistance) const
+{
+    const QueryScope scope(this);
+    const auto query = scope.Query;
+    if (!query)
         return false;
 
     dtQueryFilter filter;
@@ -79,9 +180,9 @@ bool NavMeshRuntime::FindPath(const Vector3& startPosition, const Vector3& endPo
 {
     resultPath.Clear();
     resultFlags = NavMeshPathFlags::None;
-    ScopeLock lock(Locker);
-    const auto query = GetNavMeshQuery();
-    if (!query || !_navMesh)
+    const QueryScope scope(this);
+    const auto query = scope.Query;
+    if (!query)
         return false;
 
     dtQueryFilter filter;
@@ -107,43 +208,14 @@ bool NavMeshRuntime::FindPath(const Vector3& startPosition, const Vector3& endPo
         return false;
     }
 
-    Quaternion invRotation;
-    Quaternion::Invert(Properties.Rotation, invRotation);
-
-    if (pathSize == 1 && dtStatusDetail(findPathStatus, DT_PARTIAL_RESULT))
-    {
-        resultFlags |= NavMeshPathFlags::PartialPath;
-        // TODO: skip adding 2nd end point if it's not reachable (use navmesh raycast check? or physics check? or local Z distance check?)
-        resultPath.Resize(2);
-        resultPath[0] = startPosition;
-        query->closestPointOnPolyBoundary(startPoly, &endPositionNavMesh.X, &endPositionNavMesh.X);
-        resultPath[1] = endPositionNavMesh;
-        Vector3::Transform(resultPath[1], invRotation, resultPath[1]);
-    }
-    else
-    {
-        int pathPointsCount = 0;
-        Float3 pathPoints[NAV_MESH_PATH_MAX_SIZE];
-        const auto findStraightPathStatus = query->findStraightPath(&startPositionNavMesh.X, &endPositionNavMesh.X, path, pathSize, (float*)&pathPoints, nullptr, nullptr, &pathPointsCount, NAV_MESH_PATH_MAX_SIZE, DT_STRAIGHTPATH_AREA_CROSSINGS);
-        if (dtStatusFailed(findStraightPathStatus))
-        {
-            return false;
-        }
-        resultPath.Resize(pathPointsCount);
-        for (int32 i = 0; i < pathPointsCount; i++)
-        {
-            Vector3::Transform(pathPoints[i], invRotation, resultPath[i]);
-        }
-    }
-
-    return true;
+    return BuildPath(this, query, findPathStatus, startPoly, startPosition, startPositionNavMesh, endPositionNavMesh, path, pathSize, resultPath, resultFlags);
 }
 
 bool NavMeshRuntime::TestPath(const Vector3& startPosition, const Vector3& endPosition) const
 {
-    ScopeLock lock(Locker);
-    const auto query = GetNavMeshQuery();
-    if (!query || !_navMesh)
+    const QueryScope scope(this);
+    const auto query = scope.Query;
+    if (!query)
         return false;
 
     dtQueryFilter filter;
@@ -174,9 +246,9 @@ bool NavMeshRuntime::TestPath(const Vector3& startPosition, const Vector3& endPo
 
 bool NavMeshRuntime::FindClosestPoint(const Vector3& point, Vector3& result) const
 {
-    ScopeLock lock(Locker);
-    const auto query = GetNavMeshQuery();
-    if (!query || !_navMesh)
+    const QueryScope scope(this);
+    const auto query = scope.Query;
+    if (!query)
         return false;
 
     dtQueryFilter filter;
@@ -200,9 +272,9 @@ bool NavMeshRuntime::FindClosestPoint(const Vector3& point, Vector3& result) con
 
 bool NavMeshRuntime::FindRandomPoint(Vector3& result) const
 {
-    ScopeLock lock(Locker);
-    const auto query = GetNavMeshQuery();
-    if (!query || !_navMesh)
+    const QueryScope scope(this);
+    const auto query = scope.Query;
+    if (!query)
         return false;
 
     dtQueryFilter filter;
@@ -222,9 +294,9 @@ bool NavMeshRuntime::FindRandomPoint(Vector3& result) const
 
 bool NavMeshRuntime::FindRandomPointAroundCircle(const Vector3& center, float radius, Vector3& result) const
 {
-    ScopeLock lock(Locker);
-    const auto query = GetNavMeshQuery();
-    if (!query || !_navMesh)
+    const QueryScope scope(this);
+    const auto query = scope.Query;
+    if (!query)
         return false;
 
     dtQueryFilter filter;
@@ -252,9 +324,9 @@ bool NavMeshRuntime::FindRandomPointAroundCircle(const Vector3& center, float ra
 
 bool NavMeshRuntime::RayCast(const Vector3& startPosition, const Vector3& endPosition, NavMeshHit& hitInfo) const
 {
-    ScopeLock lock(Locker);
-    const auto query = GetNavMeshQuery();
-    if (!query || !_navMesh)
+    const QueryScope scope(this);
+    const auto query = scope.Query;
+    if (!query)
         return false;
 
     dtQueryFilter filter;
@@ -288,6 +360,219 @@ bool NavMeshRuntime::RayCast(const Vector3& startPosition, const Vector3& endPos
     return result;
 }
 
+uint32 NavMeshRuntime::FindPathAsync(const Vector3& startPosition, const Vector3& endPosition, const NavMeshPathCallback& callback, int32 priority)
+{
+    ScopeLock lock(_pathRequestsLocker);
+    uint32 id = ++_pathRequestsCounter;
+    if (id == 0)
+        id = ++_pathRequestsCounter;
+    auto& request = _pathRequests.AddOne();
+    request.ID = id;
+    request.Priority = priority;
+    request.StartPosition = startPosition;
+    request.EndPosition = endPosition;
+    request.Callback = callback;
+    return id;
+}
+
+void NavMeshRuntime::CancelPathAsync(uint32 requestId)
+{
+    ScopeLock lock(_pathRequestsLocker);
+    for (int32 i = 0; i < _pathRequests.Count(); i++)
+    {
+        if (_pathRequests[i].ID == requestId)
+        {
+            _pathRequests.RemoveAtKeepOrder(i);
+            return;
+        }
+    }
+    if (_pathActive.ID == requestId)
+        _pathActive.ID = 0;
+}
+
+void NavMeshRuntime::UpdatePathRequests(int32 maxIterations, float cacheTolerance)
+{
+    _pathRequestsLocker.Lock();
+    const bool hasRequests = _pathActive.ID != 0 || _pathRequests.HasItems();
+    _pathRequestsLocker.Unlock();
+    if (!hasRequests)
+        return;
+    PROFILE_CPU();
+    Array<PathResult> results;
+
+    // Register as an active query (tiles cannot be modified during the update)
+    Locker.Lock();
+    if (!_navMesh)
+    {
+        // Fail all requests if there is no navmesh
+        Locker.Unlock();
+        _pathRequestsLocker.Lock();
+        if (_pathActive.ID != 0)
+            _pathRequests.Add(MoveTemp(_pathActive));
+        _pathActive.ID = 0;
+        for (const PathRequest& request : _pathRequests)
+        {
+            auto& result = results.AddOne();
+            result.ID = request.ID;
+            result.Success = false;
+            result.Flags = NavMeshPathFlags::None;
+            result.Callback = request.Callback;
+        }
+        _pathRequests.Clear();
+        _pathRequestsLocker.Unlock();
+        for (const PathResult& result : results)
+        {
+            if (result.Callback.IsBinded())
+                result.Callback(result.ID, result.Success, result.Path, result.Flags);
+        }
+        return;
+    }
+    if (!_pathQuery)
+    {
+        _pathQuery = dtAllocNavMeshQuery();
+        _pathActiveVersion = _tilesVersion - 1;
+    }
+    if (_pathActiveVersion != _tilesVersion)
+    {
+        // Navmesh has been modified so restart the active request and invalidate the cached paths
+        _pathActiveVersion = _tilesVersion;
+        _pathActiveStartPoly = 0;
+        _pathCache.Clear();
+        _pathCacheIndex = 0;
+        if (dtStatusFailed(_pathQuery->init(_navMesh, MAX_NODES)))
+        {
+            LOG(Error, "Navmesh query {0} init failed", Properties.Name);
+            _pathActiveVersion--;
+            Locker.Unlock();
+            return;
+        }
+    }
+    Platform::InterlockedIncrement(&_queriesActive);
+    Locker.Unlock();
+
+    dtQueryFilter filter;
+    InitFilter(filter);
+    Float3 extent = Properties.DefaultQueryExtent;
+    const float cacheToleranceSq = cacheTolerance * cacheTolerance;
+    int32 iterations = Math::Max(maxIterations, 1);
+    while (iterations > 0)
+    {
+        // Pick the next request with the highest priority
+        _pathRequestsLocker.Lock();
+        if (_pathActive.ID == 0)
+        {
+            int32 next = -1;
+            for (int32 i = 0; i < _pathRequests.Count(); i++)
+            {
+                if (next == -1 || _pathRequests[i].Priority > _pathRequests[next].Priority)
+                    next = i;
+            }
+            if (next != -1)
+            {
+                _pathActive = MoveTemp(_pathRequests[next]);
+                _pathRequests.RemoveAtKeepOrder(next);
+                _pathActiveStartPoly = 0;
+            }
+        }
+        const uint32 requestId = _pathActive.ID;
+        _pathRequestsLocker.Unlock();
+        if (requestId == 0)
+            break;
+        const Vector3 startPosition = _pathActive.StartPosition;
+        const Vector3 endPosition = _pathActive.EndPosition;
+        Float3 startPositionNavMesh, endPositionNavMesh;
+        Float3::Transform(startPosition, Properties.Rotation, startPositionNavMesh);
+        Float3::Transform(endPosition, Properties.Rotation, endPositionNavMesh);
+        PathResult* result = nullptr;
+
+        if (_pathActiveStartPoly == 0)
+        {
+            // Reuse the path found for the nearby start and end positions
+            if (cacheToleranceSq > 0.0f)
+            {
+                for (const PathResult& e : _pathCache)
+                {
+                    if (Vector3::DistanceSquared(e.StartPosition, startPosition) <= cacheToleranceSq && Vector3::DistanceSquared(e.EndPosition, endPosition) <= cacheToleranceSq)
+                    {
+                        result = &results.AddOne();
+                        result->Success = true;
+                        result->Flags = e.Flags;
+                        result->Path = e.Path;
+                        result->Path.First() = startPosition;
+                        result->Path.Last() = endPosition;
+                        break;
+                    }
+                }
+            }
+
+            // Start the sliced path finding
+            if (!result)
+            {
+                iterations--;
+                dtPolyRef startPoly = 0, endPoly = 0;
+                if (!dtStatusSucceed(_pathQuery->findNearestPoly(&startPositionNavMesh.X, &extent.X, &filter, &startPoly, nullptr)) ||
+                    !dtStatusSucceed(_pathQuery->findNearestPoly(&endPositionNavMesh.X, &extent.X, &filter, &endPoly, nullptr)) ||
+                    dtStatusFailed(_pathQuery->initSlicedFindPath(startPoly, endPoly, &startPositionNavMesh.X, &endPositionNavMesh.X, &filter)))
+                {
+                    result = &results.AddOne();
+                    result->Success = false;
+                    result->Flags = NavMeshPathFlags::None;
+                }
+                else
+                {
+                    _pathActiveStartPoly = startPoly;
+                }
+            }
+        }
+
+        if (!result)
+        {
+            // Continue path finding within the remaining budget
+            int32 doneIterations = 0;
+            const dtStatus updateStatus = _pathQuery->updateSlicedFindPath(iterations, &doneIterations);
+            iterations -= doneIterations;
+            if (dtStatusInProgress(updateStatus))
+                break;
+            dtPolyRef path[NAV_MESH_PATH_MAX_SIZE];
+            int32 pathSize = 0;
+            const dtStatus status = _pathQuery->finalizeSlicedFindPath(path, &pathSize, NAV_MESH_PATH_MAX_SIZE);
+            result = &results.AddOne();
+            result->Flags = NavMeshPathFlags::None;
+            result->Success = dtStatusSucceed(status) && BuildPath(this, _pathQuery, status, (dtPolyRef)_pathActiveStartPoly, startPosition, startPositionNavMesh, endPositionNavMesh, path, pathSize, result->Path, result->Flags);
+
+            // Cache the complete path for reuse by the nearby requests
+            if (result->Success && cacheToleranceSq > 0.0f && !dtStatusDetail(status, DT_PARTIAL_RESULT) && result->Path.Count() >= 2)
+            {
+                if (_pathCache.Count() < NAV_MESH_PATH_CACHE_SIZE)
+                    _pathCache.AddOne();
+                auto& e = _pathCache[_pathCacheIndex];
+                _pathCacheIndex = (_pathCacheIndex + 1) % NAV_MESH_PATH_CACHE_SIZE;
+                e.StartPosition = startPosition;
+                e.EndPosition = endPosition;
+                e.Flags = result->Flags;
+                e.Path = result->Path;
+            }
+        }
+
+        // Complete the request (skip callback if request was canceled)
+        result->ID = requestId;
+        _pathRequestsLocker.Lock();
+        if (_pathActive.ID == requestId)
+            result->Callback = MoveTemp(_pathActive.Callback);
+        _pathActive.ID = 0;
+        _pathRequestsLocker.Unlock();
+    }
+
+    Platform::InterlockedDecrement(&_queriesActive);
+
+    // Send the results
+    for (const PathResult& result : results)
+    {
+        if (result.Callback.IsBinded())
+            result.Callback(result.ID, result.Success, result.Path, result.Flags);
+    }
+}
+
 void NavMeshRuntime::SetTileSize(float tileSize)
 {
     ScopeLock lock(Locker);
@@ -323,6 +608,7 @@ void NavMeshRuntime::EnsureCapacity(int32 tilesToAddCount)
 
     // Ensure to have size assigned
     ASSERT(_tileSize != 0);
+    BeginTilesModification();
 
     // Prepare parameters
     dtNavMeshParams params;
@@ -347,6 +633,8 @@ void NavMeshRuntime::EnsureCapacity(int32 tilesToAddCount)
     {
         LOG(Error, "Navmesh query {0} init failed", Properties.Name);
     }
+    for (dtNavMeshQuery* query : _queriesPool)
+        query->init(_navMesh, MAX_NODES);
 
     // Prepare tiles container
     _tiles.EnsureCapacity(newCapacity);
@@ -448,6 +736,7 @@ void NavMeshRuntime::RemoveTile(int32 x, int32 y, int32 layer)
     if (!_navMesh)
         return;
     PROFILE_CPU_NAMED("NavMeshRuntime.RemoveTile");
+    BeginTilesModification();
 
     const auto tileRef = _navMesh->getTileRefAt(x, y, layer);
     if (tileRef == 0)
@@ -476,6 +765,7 @@ void NavMeshRuntime::RemoveTiles(bool (*prediction)(const NavMeshRuntime* navMes
     if (!_navMesh)
         return;
     PROFILE_CPU_NAMED("NavMeshRuntime.RemoveTiles");
+    BeginTilesModification();
 
     for (int32 i = 0; i < _tiles.Count(); i++)
     {
@@ -609,8 +899,10 @@ void NavMeshRuntime::DebugDraw()
 
 void NavMeshRuntime::Dispose()
 {
+    ScopeLock lock(Locker);
     if (_navMesh)
     {
+        BeginTilesModification();
         dtFreeNavMesh(_navMesh);
         _navMesh = nullptr;
     }
@@ -619,6 +911,8 @@ void NavMeshRuntime::Dispose()
 
 void NavMeshRuntime::AddTileInternal(NavMesh* navMesh, NavMeshTileData& tileData)
 {
+    BeginTilesModification();
+
     // Check if that tile has been added to navmesh
     NavMeshTile* tile = nullptr;
     const auto tileRef = _navMesh->getTileRefAt(tileData.PosX, tileData.PosY, tileData.Layer);
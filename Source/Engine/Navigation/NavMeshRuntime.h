@@ -3,6 +3,7 @@
 #pragma once
 
 #include "Engine/Core/Types/BaseTypes.h"
+#include "Engine/Core/Delegate.h"
 #include "Engine/Platform/CriticalSection.h"
 #include "Engine/Scripting/ScriptingObject.h"
 #include "NavMeshData.h"
@@ -38,6 +39,11 @@ enum class NavMeshPathFlags
 
 DECLARE_ENUM_OPERATORS(NavMeshPathFlags);
 
+/// <summary>
+/// The asynchronous path request completion callback (called on a main thread). Receives the request identifier, the result (true if found valid path, it may be partial), the path points and the path flags.
+/// </summary>
+typedef Function<void(uint32, bool, const Array<Vector3, HeapAllocation>&, NavMeshPathFlags)> NavMeshPathCallback;
+
 /// <summary>
 /// The navigation mesh runtime object that builds the navmesh from all loaded scenes.
 /// </summary>
@@ -68,6 +74,40 @@ API_CLASS(NoSpawn) class FLAXENGINE_API NavMeshRuntime : public ScriptingObject
     dtNavMeshQuery* _navMeshQuery;
     float _tileSize;
     Array<NavMeshTile> _tiles;
+    CriticalSection _queriesLocker;
+    mutable Array<dtNavMeshQuery*> _queriesPool;
+    mutable volatile int64 _queriesActive = 0;
+    uint32 _tilesVersion = 0;
+
+    struct PathRequest
+    {
+        uint32 ID;
+        int32 Priority;
+        Vector3 StartPosition;
+        Vector3 EndPosition;
+        NavMeshPathCallback Callback;
+    };
+
+    struct PathResult
+    {
+        uint32 ID;
+        bool Success;
+        NavMeshPathFlags Flags;
+        Vector3 StartPosition;
+        Vector3 EndPosition;
+        Array<Vector3, HeapAllocation> Path;
+        NavMeshPathCallback Callback;
+    };
+
+    CriticalSection _pathRequestsLocker;
+    Array<PathRequest> _pathRequests;
+    PathRequest _pathActive;
+    uint64 _pathActiveStartPoly;
+    uint32 _pathActiveVersion;
+    uint32 _pathRequestsCounter = 0;
+    dtNavMeshQuery* _pathQuery = nullptr;
+    Array<PathResult> _pathCache;
+    int32 _pathCacheIndex = 0;
 
 public:
     NavMeshRuntime(const NavMeshProperties& properties);
@@ -75,7 +115,7 @@ API_CLASS(NoSpawn) class FLAXENGINE_API NavMeshRuntime : public ScriptingObject
 
 public:
     /// <summary>
-    /// The object locker.
+    /// The object locker. Navmesh queries run in parallel outside the lock (see AcquireQuery) and tiles modifications done with the lock wait for them to end.
     /// </summary>
     CriticalSection Locker;
 
@@ -104,6 +144,18 @@ API_CLASS(NoSpawn) class FLAXENGINE_API NavMeshRuntime : public ScriptingObject
 
     int32 GetTilesCapacity() const;
 
+    /// <summary>
+    /// Acquires the navmesh query object from the pool. Queries can be used by multiple threads at once without locking the navmesh (tiles modification waits for the active queries to end). Use ReleaseQuery when done.
+    /// </summary>
+    /// <returns>The navmesh query object or null if navmesh is not initialized.</returns>
+    dtNavMeshQuery* AcquireQuery() const;
+
+    /// <summary>
+    /// Releases the navmesh query object acquired with AcquireQuery back to the pool.
+    /// </summary>
+    /// <param name="query">The navmesh query object.</param>
+    void ReleaseQuery(dtNavMeshQuery* query) const;
+
 public:
     /// <summary>
     /// Finds the distance from the specified start position to the nearest polygon wall.
@@ -190,6 +242,30 @@ API_CLASS(NoSpawn) class FLAXENGINE_API NavMeshRuntime : public ScriptingObject
     /// <returns>True if ray hits an matching object, otherwise false.</returns>
     API_FUNCTION() bool RayCast(const Vector3& startPosition, const Vector3& endPosition, API_PARAM(Out) NavMeshHit& hitInfo) const;
 
+public:
+    /// <summary>
+    /// Requests the path finding between the two positions to be performed asynchronously. Requests are processed over multiple frames with a limited amount of navmesh nodes visited per frame (see NavigationSettings) and the results of the recent requests are reused for the requests with nearby start and end positions.
+    /// </summary>
+    /// <param name="startPosition">The start position.</param>
+    /// <param name="endPosition">The end position.</param>
+    /// <param name="callback">The callback invoked on a main thread when the path request is completed.</param>
+    /// <param name="priority">The request priority. Requests with higher priority are processed first.</param>
+    /// <returns>The path request identifier (non-zero).</returns>
+    uint32 FindPathAsync(const Vector3& startPosition, const Vector3& endPosition, const NavMeshPathCallback& callback, int32 priority = 0);
+
+    /// <summary>
+    /// Cancels the asynchronous path request. The request callback won't be called.
+    /// </summary>
+    /// <param name="requestId">The path request identifier returned by FindPathAsync.</param>
+    void CancelPathAsync(uint32 requestId);
+
+    /// <summary>
+    /// Processes the asynchronous path requests. Called by the navigation system every frame on a main thread.
+    /// </summary>
+    /// <param name="maxIterations">The maximum amount of navmesh nodes to visit during the update.</param>
+    /// <param name="cacheTolerance">The maximum distance of the start and end positions to reuse the cached path result. Use 0 to disable path results caching.</param>
+    void UpdatePathRequests(int32 maxIterations, float cacheTolerance);
+
 public:
     /// <summary>
     /// Sets the size of the tile (if not assigned). Disposes the mesh if added tiles have different size.
@@ -247,5 +323,6 @@ API_CLASS(NoSpawn) class FLAXENGINE_API NavMeshRuntime : public ScriptingObject
     void Dispose();
 
 private:
+    void BeginTilesModification();
     void AddTileInternal(NavMesh* navMesh, NavMeshTileData& tileData);
 };
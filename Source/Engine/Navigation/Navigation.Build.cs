@@ -17,6 +17,7 @@ public override void Setup(BuildOptions options)
 
         options.PrivateDependencies.Add("Level");
         options.PrivateDependencies.Add("recastnavigation");
+        options.PrivateDependencies.Add("lz4");
 
         if (options.Target.IsEditor)
         {
@@ -162,15 +162,14 @@ class NavigationService : public EngineService
     NavigationService()
         : EngineService(TEXT("Navigation"), 60)
     {
+        ParallelInit = true;
 #if COMPILE_WITH_NAV_MESH_BUILDER
         NavMeshBuilder::Init();
 #endif
     }
 
     bool Init() override;
-#if COMPILE_WITH_NAV_MESH_BUILDER
     void Update() override;
-#endif
     void Dispose() override;
 };
 
@@ -239,6 +238,7 @@ void NavigationSettings::Deserialize(DeserializeStream& stream, ISerializeModifi
 {
     DESERIALIZE(AutoAddMissingNavMeshes);
     DESERIALIZE(AutoRemoveMissingNavMeshes);
+    DESERIALIZE(MaxConcurrentTileBuilds);
     DESERIALIZE(CellHeight);
     DESERIALIZE(CellSize);
     DESERIALIZE(TileSize);
@@ -248,6 +248,8 @@ void NavigationSettings::Deserialize(DeserializeStream& stream, ISerializeModifi
     DESERIALIZE(MaxEdgeError);
     DESERIALIZE(DetailSamplingDist);
     DESERIALIZE(MaxDetailSamplingError);
+    DESERIALIZE(AsyncPathFindingIterations);
+    DESERIALIZE(AsyncPathCacheTolerance);
     if (modifier->EngineBuild >= 6215)
     {
         DESERIALIZE(NavMeshes);
@@ -283,15 +285,18 @@ bool NavigationService::Init()
     return false;
 }
 
-#if COMPILE_WITH_NAV_MESH_BUILDER
-
 void NavigationService::Update()
 {
+#if COMPILE_WITH_NAV_MESH_BUILDER
     NavMeshBuilder::Update();
-}
-
 #endif
 
+    // Process asynchronous path requests
+    const auto settings = NavigationSettings::Get();
+    for (auto navMesh : NavMeshes)
+        navMesh->UpdatePathRequests(settings->AsyncPathFindingIterations, settings->AsyncPathCacheTolerance);
+}
+
 void NavigationService::Dispose()
 {
     // Release nav meshes
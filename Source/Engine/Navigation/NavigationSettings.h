@@ -26,6 +26,12 @@ API_CLASS(sealed, Namespace="FlaxEditor.Content.Settings", NoConstructor) class
     API_FIELD(Attributes="EditorOrder(110), EditorDisplay(\"Navigation\")")
     bool AutoRemoveMissingNavMeshes = true;
 
+    /// <summary>
+    /// The maximum amount of navmesh tiles built at once on the thread pool (tiles closer to the streaming sources are built first). Use 0 to pick it automatically based on the amount of the CPU threads.
+    /// </summary>
+    API_FIELD(Attributes="Limit(0), EditorOrder(120), EditorDisplay(\"Navigation\")")
+    int32 MaxConcurrentTileBuilds = 0;
+
 public:
     /// <summary>
     /// The height of a grid cell in the navigation mesh building steps using heightfields. A lower number means higher precision on the vertical axis but longer build times.
@@ -81,6 +87,19 @@ API_CLASS(sealed, Namespace="FlaxEditor.Content.Settings", NoConstructor) class
     API_FIELD(Attributes="Limit(0, 3), EditorOrder(290), EditorDisplay(\"Nav Mesh Options\")")
     float MaxDetailSamplingError = 1.0f;
 
+public:
+    /// <summary>
+    /// The maximum amount of navmesh nodes visited per frame (for each navmesh) by the asynchronous path finding requests. Higher values complete requests faster but take more time per frame.
+    /// </summary>
+    API_FIELD(Attributes="Limit(1), EditorOrder(300), EditorDisplay(\"Path Finding\")")
+    int32 AsyncPathFindingIterations = 2000;
+
+    /// <summary>
+    /// The maximum distance between start and end positions of the asynchronous path finding requests to reuse the recently found path. Use 0 to disable paths caching.
+    /// </summary>
+    API_FIELD(Attributes="Limit(0), EditorOrder(310), EditorDisplay(\"Path Finding\")")
+    float AsyncPathCacheTolerance = 50.0f;
+
 public:
     /// <summary>
     /// The configuration for navmeshes.
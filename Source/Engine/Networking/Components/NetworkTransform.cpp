@@ -8,6 +8,7 @@
 #include "Engine/Level/Actor.h"
 #include "Engine/Networking/NetworkManager.h"
 #include "Engine/Networking/NetworkPeer.h"
+#include "Engine/Networking/NetworkPrediction.h"
 #include "Engine/Networking/NetworkReplicator.h"
 #include "Engine/Networking/NetworkStream.h"
 #include "Engine/Networking/NetworkStats.h"
@@ -16,12 +17,16 @@
 
 PACK_STRUCT(struct Data
     {
-    uint8 LocalSpace : 1;
-    uint8 HasSequenceIndex : 1;
-    NetworkTransform::ReplicationComponents Components : 9;
+    uint16 LocalSpace : 1;
+    uint16 HasSequenceIndex : 1;
+    uint16 Components : 9;
+    uint16 QuantizedPosition : 1;
+    uint16 CompressedRotation : 1;
+    uint16 OmitScale : 1;
     });
 
 static_assert((int32)NetworkTransform::ReplicationComponents::All + 1 == 512, "Invalid ReplicationComponents bit count for Data.");
+static_assert(sizeof(Data) == 2, "Invalid Data size.");
 
 namespace
 {
@@ -34,6 +39,47 @@ namespace
         const T targetDeltaMax = targetDelta.GetAbsolute().MaxValue();
         return targetDeltaMax > (T)ZeroTolerance && currentDelta.GetAbsolute().MaxValue() < targetDeltaMax * (T)Precision;
     }
+
+    // Quantized position component is stored as unsigned integer: offset from the origin in precision steps (in range [-halfSteps; halfSteps]) plus halfSteps
+    struct PositionQuantization
+    {
+        double Precision;
+        uint32 HalfSteps;
+        int32 Bits;
+
+        PositionQuantization(float precision, Real range)
+        {
+            Precision = precision;
+            const double halfSteps = precision > 0.0f ? Math::Ceil((double)range / precision) : 0.0;
+            if (halfSteps <= 0.0 || halfSteps >= (double)(MAX_uint32 / 2))
+            {
+                // Invalid or too big range
+                HalfSteps = 0;
+                Bits = 0;
+                return;
+            }
+            HalfSteps = (uint32)halfSteps;
+            const uint64 steps = (uint64)HalfSteps * 2 + 1;
+            Bits = 1;
+            while (((uint64)1 << Bits) < steps)
+                Bits++;
+        }
+
+        bool CanEncode(Real value, Real origin) const
+        {
+            return Bits != 0 && Math::Abs((double)(value - origin)) / Precision <= (double)HalfSteps;
+        }
+
+        void Write(NetworkStream* stream, Real value, Real origin) const
+        {
+            stream->WriteBits((uint32)((double)(value - origin) / Precision + HalfSteps + 0.5), Bits);
+        }
+
+        Real Read(NetworkStream* stream, Real origin) const
+        {
+            return origin + (Real)(((double)stream->ReadBits(Bits) - HalfSteps) * Precision);
+        }
+    };
 }
 
 NetworkTransform::NetworkTransform(const SpawnParams& params)
@@ -52,7 +98,6 @@ void NetworkTransform::SetSequenceIndex(uint16 value)
 void NetworkTransform::OnEnable()
 {
     // Initialize state
-    _bufferHasDeltas = false;
     _currentSequenceIndex = 0;
     _lastFrameTransform = GetActor() ? GetActor()->GetTransform() : Transform::Identity;
     _buffer.Clear();
@@ -65,6 +110,7 @@ void NetworkTransform::OnDisable()
 {
     // Unregister from replication
     NetworkReplicator::RemoveObject(this);
+    NetworkPrediction::RemoveObject(this);
 
     _buffer.Resize(0);
 }
@@ -81,25 +127,25 @@ void NetworkTransform::OnUpdate()
     }
     else if (role == NetworkObjectRole::ReplicatedSimulated && Mode == ReplicationModes::Prediction)
     {
-        // Compute delta of the actor transformation simulated locally
+        // Use engine prediction system to keep the history of local simulation
         const Transform thisFrameTransform = GetActor() ? GetActor()->GetTransform() : Transform::Identity;
-        Transform delta = thisFrameTransform - _lastFrameTransform;
+        if (!NetworkPrediction::HasObject(this))
+        {
+            NetworkPrediction::AddObject(this, sizeof(Transform), sizeof(Transform), GetPredictionState, SetPredictionState, SimulatePrediction);
+            _lastFrameTransform = thisFrameTransform;
+            _buffer.Clear();
+        }
 
+        // Compute delta of the actor transformation simulated locally
+        Transform delta = thisFrameTransform - _lastFrameTransform;
         if (!delta.IsIdentity())
         {
-            // Move to the next input sequence number
-            _currentSequenceIndex++;
-
-            // Add delta to buffer to re-apply after receiving authoritative transform value
-            if (!_bufferHasDeltas)
-            {
-                _buffer.Clear();
-                _bufferHasDeltas = true;
-            }
+            // Add delta to the history to re-apply after receiving authoritative transform value
             delta.Orientation = thisFrameTransform.Orientation; // Store absolute orientation value to prevent jittering when blending rotation deltas
-            _buffer.Add({ 0.0f, _currentSequenceIndex, delta, });
+            NetworkPrediction::SetInput(this, &delta);
 
             // Inform server about sequence number change (add offset to lead before server data)
+            _currentSequenceIndex = (uint16)NetworkPrediction::GetTick();
             SetSequenceIndex(_currentSequenceIndex - 1);
         }
         _lastFrameTransform = thisFrameTransform;
@@ -159,53 +205,77 @@ void NetworkTransform::Serialize(NetworkStream* stream)
     Data data;
     data.LocalSpace = LocalSpace;
     data.HasSequenceIndex = Mode == ReplicationModes::Prediction;
-    data.Components = Components;
+    data.Components = (uint16)Components;
+    const ReplicationComponents components = Components;
+    const PositionQuantization positionQuantization(PositionPrecision, PositionRange);
+    data.QuantizedPosition = EnumHasAnyFlags(components, ReplicationComponents::Position) &&
+            positionQuantization.CanEncode(transform.Translation.X, PositionOrigin.X) &&
+            positionQuantization.CanEncode(transform.Translation.Y, PositionOrigin.Y) &&
+            positionQuantization.CanEncode(transform.Translation.Z, PositionOrigin.Z);
+    data.CompressedRotation = RotationBits > 0 && EnumHasAllFlags(components, ReplicationComponents::Rotation);
+    data.OmitScale = OmitDefaultScale && EnumHasAnyFlags(components, ReplicationComponents::Scale) && transform.Scale == Float3::One;
     stream->Write(data);
-    if (EnumHasAllFlags(data.Components, ReplicationComponents::All))
+    if (EnumHasAllFlags(components, ReplicationComponents::All) && !data.QuantizedPosition && !data.CompressedRotation && !data.OmitScale)
     {
         stream->Write(transform);
     }
     else
     {
-        if (EnumHasAllFlags(data.Components, ReplicationComponents::Position))
+        if (data.QuantizedPosition || data.CompressedRotation)
+        {
+            // Bit-packed components
+            if (data.QuantizedPosition)
+            {
+                if (EnumHasAnyFlags(components, ReplicationComponents::PositionX))
+                    positionQuantization.Write(stream, transform.Translation.X, PositionOrigin.X);
+                if (EnumHasAnyFlags(components, ReplicationComponents::PositionY))
+                    positionQuantization.Write(stream, transform.Translation.Y, PositionOrigin.Y);
+                if (EnumHasAnyFlags(components, ReplicationComponents::PositionZ))
+                    positionQuantization.Write(stream, transform.Translation.Z, PositionOrigin.Z);
+            }
+            if (data.CompressedRotation)
+                stream->WriteQuaternionCompressed(transform.Orientation, RotationBits);
+            stream->FlushBits();
+        }
+        if (!data.QuantizedPosition && EnumHasAllFlags(components, ReplicationComponents::Position))
         {
             stream->Write(transform.Translation);
         }
-        else if (EnumHasAnyFlags(data.Components, ReplicationComponents::Position))
+        else if (!data.QuantizedPosition && EnumHasAnyFlags(components, ReplicationComponents::Position))
         {
-            if (EnumHasAnyFlags(data.Components, ReplicationComponents::PositionX))
+            if (EnumHasAnyFlags(components, ReplicationComponents::PositionX))
                 stream->Write(transform.Translation.X);
-            if (EnumHasAnyFlags(data.Components, ReplicationComponents::PositionY))
+            if (EnumHasAnyFlags(components, ReplicationComponents::PositionY))
                 stream->Write(transform.Translation.Y);
-            if (EnumHasAnyFlags(data.Components, ReplicationComponents::PositionZ))
+            if (EnumHasAnyFlags(components, ReplicationComponents::PositionZ))
                 stream->Write(transform.Translation.Z);
         }
-        if (EnumHasAllFlags(data.Components, ReplicationComponents::Scale))
+        if (!data.OmitScale && EnumHasAllFlags(components, ReplicationComponents::Scale))
         {
             stream->Write(transform.Scale);
         }
-        else if (EnumHasAnyFlags(data.Components, ReplicationComponents::Scale))
+        else if (!data.OmitScale && EnumHasAnyFlags(components, ReplicationComponents::Scale))
         {
-            if (EnumHasAnyFlags(data.Components, ReplicationComponents::ScaleX))
+            if (EnumHasAnyFlags(components, ReplicationComponents::ScaleX))
                 stream->Write(transform.Scale.X);
-            if (EnumHasAnyFlags(data.Components, ReplicationComponents::ScaleY))
+            if (EnumHasAnyFlags(components, ReplicationComponents::ScaleY))
                 stream->Write(transform.Scale.Y);
-            if (EnumHasAnyFlags(data.Components, ReplicationComponents::ScaleZ))
+            if (EnumHasAnyFlags(components, ReplicationComponents::ScaleZ))
                 stream->Write(transform.Scale.Z);
         }
-        if (EnumHasAllFlags(data.Components, ReplicationComponents::Rotation))
+        if (!data.CompressedRotation && EnumHasAllFlags(components, ReplicationComponents::Rotation))
         {
             const Float3 rotation = transform.Orientation.GetEuler();
             stream->Write(rotation);
         }
-        else if (EnumHasAnyFlags(data.Components, ReplicationComponents::Rotation))
+        else if (!data.CompressedRotation && EnumHasAnyFlags(components, ReplicationComponents::Rotation))
         {
             const Float3 rotation = transform.Orientation.GetEuler();
-            if (EnumHasAnyFlags(data.Components, ReplicationComponents::RotationX))
+            if (EnumHasAnyFlags(components, ReplicationComponents::RotationX))
                 stream->Write(rotation.X);
-            if (EnumHasAnyFlags(data.Components, ReplicationComponents::RotationY))
+            if (EnumHasAnyFlags(components, ReplicationComponents::RotationY))
                 stream->Write(rotation.Y);
-            if (EnumHasAnyFlags(data.Components, ReplicationComponents::RotationZ))
+            if (EnumHasAnyFlags(components, ReplicationComponents::RotationZ))
                 stream->Write(rotation.Z);
         }
     }
@@ -226,52 +296,79 @@ void NetworkTransform::Deserialize(NetworkStream* stream)
     // Decode data
     Data data;
     stream->Read(data);
-    if (EnumHasAllFlags(data.Components, ReplicationComponents::All))
+    const ReplicationComponents components = (ReplicationComponents)data.Components;
+    if (EnumHasAllFlags(components, ReplicationComponents::All) && !data.QuantizedPosition && !data.CompressedRotation && !data.OmitScale)
     {
         stream->Read(transform);
     }
     else
     {
-        if (EnumHasAllFlags(data.Components, ReplicationComponents::Position))
+        if (data.QuantizedPosition || data.CompressedRotation)
+        {
+            // Bit-packed components
+            if (data.QuantizedPosition)
+            {
+                const PositionQuantization positionQuantization(PositionPrecision, PositionRange);
+                if (EnumHasAnyFlags(components, ReplicationComponents::PositionX))
+                    transform.Translation.X = positionQuantization.Read(stream, PositionOrigin.X);
+                if (EnumHasAnyFlags(components, ReplicationComponents::PositionY))
+                    transform.Translation.Y = positionQuantization.Read(stream, PositionOrigin.Y);
+                if (EnumHasAnyFlags(components, ReplicationComponents::PositionZ))
+                    transform.Translation.Z = positionQuantization.Read(stream, PositionOrigin.Z);
+            }
+            if (data.CompressedRotation)
+                transform.Orientation = stream->ReadQuaternionCompressed(RotationBits);
+            stream->AlignBits();
+        }
+        if (!data.QuantizedPosition && EnumHasAllFlags(components, ReplicationComponents::Position))
         {
             stream->Read(transform.Translation);
         }
-        else if (EnumHasAnyFlags(data.Components, ReplicationComponents::Position))
+        else if (!data.QuantizedPosition && EnumHasAnyFlags(components, ReplicationComponents::Position))
         {
-            if (EnumHasAnyFlags(data.Components, ReplicationComponents::PositionX))
+            if (EnumHasAnyFlags(components, ReplicationComponents::PositionX))
                 stream->Read(transform.Translation.X);
-            if (EnumHasAnyFlags(data.Components, ReplicationComponents::PositionY))
+            if (EnumHasAnyFlags(components, ReplicationComponents::PositionY))
                 stream->Read(transform.Translation.Y);
-            if (EnumHasAnyFlags(data.Components, ReplicationComponents::PositionZ))
+            if (EnumHasAnyFlags(components, ReplicationComponents::PositionZ))
                 stream->Read(transform.Translation.Z);
         }
-        if (EnumHasAllFlags(data.Components, ReplicationComponents::Scale))
+        if (data.OmitScale)
+        {
+            if (EnumHasAnyFlags(components, ReplicationComponents::ScaleX))
+                transform.Scale.X = 1.0f;
+            if (EnumHasAnyFlags(components, ReplicationComponents::ScaleY))
+                transform.Scale.Y = 1.0f;
+            if (EnumHasAnyFlags(components, ReplicationComponents::ScaleZ))
+                transform.Scale.Z = 1.0f;
+        }
+        else if (EnumHasAllFlags(components, ReplicationComponents::Scale))
         {
             stream->Read(transform.Scale);
         }
-        else if (EnumHasAnyFlags(data.Components, ReplicationComponents::Scale))
+        else if (EnumHasAnyFlags(components, ReplicationComponents::Scale))
         {
-            if (EnumHasAnyFlags(data.Components, ReplicationComponents::ScaleX))
+            if (EnumHasAnyFlags(components, ReplicationComponents::ScaleX))
                 stream->Read(transform.Scale.X);
-            if (EnumHasAnyFlags(data.Components, ReplicationComponents::ScaleY))
+            if (EnumHasAnyFlags(components, ReplicationComponents::ScaleY))
                 stream->Read(transform.Scale.Y);
-            if (EnumHasAnyFlags(data.Components, ReplicationComponents::ScaleZ))
+            if (EnumHasAnyFlags(components, ReplicationComponents::ScaleZ))
                 stream->Read(transform.Scale.Z);
         }
-        if (EnumHasAllFlags(data.Components, ReplicationComponents::Rotation))
+        if (!data.CompressedRotation && EnumHasAllFlags(components, ReplicationComponents::Rotation))
         {
             Float3 rotation;
             stream->Read(rotation);
             transform.Orientation = Quaternion::Euler(rotation);
         }
-        else if (EnumHasAnyFlags(data.Components, ReplicationComponents::Rotation))
+        else if (!data.CompressedRotation && EnumHasAnyFlags(components, ReplicationComponents::Rotation))
         {
             Float3 rotation = transform.Orientation.GetEuler();
-            if (EnumHasAnyFlags(data.Components, ReplicationComponents::RotationX))
+            if (EnumHasAnyFlags(components, ReplicationComponents::RotationX))
                 stream->Read(rotation.X);
-            if (EnumHasAnyFlags(data.Components, ReplicationComponents::RotationY))
+            if (EnumHasAnyFlags(components, ReplicationComponents::RotationY))
                 stream->Read(rotation.Y);
-            if (EnumHasAnyFlags(data.Components, ReplicationComponents::RotationZ))
+            if (EnumHasAnyFlags(components, ReplicationComponents::RotationZ))
                 stream->Read(rotation.Z);
             transform.Orientation = Quaternion::Euler(rotation);
         }
@@ -292,50 +389,22 @@ void NetworkTransform::Deserialize(NetworkStream* stream)
     }
     else if (role == NetworkObjectRole::ReplicatedSimulated && Mode == ReplicationModes::Prediction)
     {
-        const Transform transformAuthoritative = transform;
-        const Transform transformDeltaBefore = transformAuthoritative - transformLocal;
-
-        // Remove any transform deltas from local simulation that happened before the incoming authoritative transform data
-        if (!_bufferHasDeltas)
-        {
-            _buffer.Clear();
-            _bufferHasDeltas = true;
-        }
-        while (_buffer.Count() != 0 && _buffer[0].SequenceIndex < sequenceIndex)
-            _buffer.RemoveAtKeepOrder(0);
-
         // Use received authoritative actor transformation but re-apply all deltas not yet processed by the server due to lag (reconciliation)
-        for (auto& e : _buffer)
+        _authoritativeTransform = transform;
+        const uint32 tick = NetworkPrediction::ExpandTick(sequenceIndex) - 1;
+        if (NetworkPrediction::Correct(this, tick, &transform))
         {
-            transform.Translation = transform.Translation + e.Value.Translation;
-            transform.Scale = transform.Scale * e.Value.Scale;
-        }
-        // TODO: use euler angles or similar to cache/reapply rotation deltas (Quaternion jitters)
-        transform.Orientation = transformLocal.Orientation;
-
-        // If local simulation is very close to the authoritative server value then ignore slight error (based relative delta threshold)
-        const Transform transformDeltaAfter = transformAuthoritative - transform;
-        if (IsWithinPrecision(transformDeltaBefore.Translation, transformDeltaAfter.Translation) &&
-            IsWithinPrecision(transformDeltaBefore.Scale, transformDeltaAfter.Scale)
-        )
-        {
-            return;
+            // Not simulated locally yet
+            Set(transform);
+            _lastFrameTransform = transform;
         }
-
-        // Set to the incoming value with applied local deltas
-        Set(transform);
-        _lastFrameTransform = transform;
     }
     else
     {
         // Add to the interpolation buffer
         const float now = Time::Update.UnscaledTime.GetTotalSeconds();
-        _buffer.Add({ now, 0, transform });
-        if (_bufferHasDeltas)
-        {
-            _buffer.Clear();
-            _bufferHasDeltas = false;
-        }
+        _buffer.Add({ now, transform });
+        NetworkPrediction::RemoveObject(this);
     }
 }
 
@@ -349,3 +418,46 @@ void NetworkTransform::Set(const Transform& transform)
             parent->SetTransform(transform);
     }
 }
+
+Transform NetworkTransform::Get() const
+{
+    if (const auto* parent = GetParent())
+        return LocalSpace ? parent->GetLocalTransform() : parent->GetTransform();
+    return Transform::Identity;
+}
+
+void NetworkTransform::GetPredictionState(ScriptingObject* obj, void* state)
+{
+    *(Transform*)state = ((NetworkTransform*)obj)->Get();
+}
+
+void NetworkTransform::SetPredictionState(ScriptingObject* obj, const void* state)
+{
+    auto* script = (NetworkTransform*)obj;
+    Transform transform = *(const Transform*)state;
+    const Transform transformLocal = script->Get();
+    // TODO: use euler angles or similar to cache/reapply rotation deltas (Quaternion jitters)
+    transform.Orientation = transformLocal.Orientation;
+
+    // If local simulation is very close to the authoritative server value then ignore slight error (based relative delta threshold)
+    const Transform transformDeltaBefore = script->_authoritativeTransform - transformLocal;
+    const Transform transformDeltaAfter = script->_authoritativeTransform - transform;
+    if (IsWithinPrecision(transformDeltaBefore.Translation, transformDeltaAfter.Translation) &&
+        IsWithinPrecision(transformDeltaBefore.Scale, transformDeltaAfter.Scale)
+    )
+    {
+        return;
+    }
+
+    // Set to the incoming value with applied local deltas
+    script->Set(transform);
+    script->_lastFrameTransform = transform;
+}
+
+void NetworkTransform::SimulatePrediction(ScriptingObject* obj, void* state, const void* input)
+{
+    auto& transform = *(Transform*)state;
+    const auto& delta = *(const Transform*)input;
+    transform.Translation = transform.Translation + delta.Translation;
+    transform.Scale = transform.Scale * delta.Scale;
+}
@@ -71,13 +71,12 @@ API_CLASS(Namespace="FlaxEngine.Networking", Attributes="Category(\"Flax Engine\
     struct BufferedItem
     {
         float Timestamp;
-        uint16 SequenceIndex;
         Transform Value;
     };
 
-    bool _bufferHasDeltas;
     uint16 _currentSequenceIndex = 0;
     Transform _lastFrameTransform;
+    Transform _authoritativeTransform;
     Array<BufferedItem> _buffer;
 
 public:
@@ -99,6 +98,36 @@ API_CLASS(Namespace="FlaxEngine.Networking", Attributes="Category(\"Flax Engine\
     API_FIELD(Attributes="EditorOrder(30)")
     ReplicationModes Mode = ReplicationModes::Default;
 
+    /// <summary>
+    /// Position quantization step (in world units). Position components are sent as integers relative to the PositionOrigin using the minimal amount of bits to cover the PositionRange. Set to 0 to send full-precision position. Has to match on all peers.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(40), Limit(0), EditorDisplay(\"Compression\")")
+    float PositionPrecision = 0.0f;
+
+    /// <summary>
+    /// Origin of the position quantization grid. Has to match on all peers.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(41), EditorDisplay(\"Compression\")")
+    Vector3 PositionOrigin = Vector3::Zero;
+
+    /// <summary>
+    /// Maximum distance from the PositionOrigin (per axis) that can be sent using the quantized position. Positions outside this range are sent with full precision. Has to match on all peers.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(42), Limit(0), EditorDisplay(\"Compression\")")
+    Real PositionRange = 100000.0f;
+
+    /// <summary>
+    /// Amount of bits per component of the rotation sent with smallest-three encoding (eg. 9 or 10 result in 29 or 32 bits per rotation). Set to 0 to send full-precision rotation. Used only if all rotation components are replicated. Has to match on all peers.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(43), Limit(0, 15), EditorDisplay(\"Compression\")")
+    int32 RotationBits = 0;
+
+    /// <summary>
+    /// If checked, scale is not sent when it's equal to one.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(44), EditorDisplay(\"Compression\")")
+    bool OmitDefaultScale = false;
+
 private:
     API_FUNCTION(Hidden, NetworkRpc=Server) void SetSequenceIndex(uint16 value);
     
@@ -114,6 +143,10 @@ API_CLASS(Namespace="FlaxEngine.Networking", Attributes="Category(\"Flax Engine\
 
 private:
     void Set(const Transform& transform);
+    Transform Get() const;
+    static void GetPredictionState(ScriptingObject* obj, void* state);
+    static void SetPredictionState(ScriptingObject* obj, const void* state);
+    static void SimulatePrediction(ScriptingObject* obj, void* state, const void* input);
 };
 
 DECLARE_ENUM_OPERATORS(NetworkTransform::ReplicationComponents);
@@ -9,6 +9,7 @@
 #include "Engine/Networking/NetworkPeer.h"
 #include "Engine/Networking/NetworkStats.h"
 #include "Engine/Core/Log.h"
+#include "Engine/Core/Math/Math.h"
 #include "Engine/Core/Collections/Array.h"
 #define ENET_IMPLEMENTATION
 #define _WINSOCK_DEPRECATED_NO_WARNINGS
@@ -44,10 +45,8 @@ void SendPacketToPeer(ENetPeer* peer, const NetworkChannelType channelType, cons
     // the smaller risk.
     ENetPacket* packet = enet_packet_create(message.Buffer, message.Length, flag);
 
-    // And send it!
+    // And send it! (queued packets are sent in Flush)
     enet_peer_send(peer, 0, packet);
-
-    // TODO: To reduce latency, we can use `enet_host_flush` to flush all packets. Maybe some API, like NetworkManager::FlushQueues()?
 }
 
 ENetDriver::ENetDriver(const SpawnParams& params)
@@ -166,7 +165,11 @@ bool ENetDriver::PopEvent(NetworkEvent& eventPtr)
 {
     ASSERT(_host);
     ENetEvent event;
-    const int result = enet_host_service(_host, &event, 0);
+
+    // Dispatch already received events first and service the socket (send and receive all pending packets in one go) only when queue is empty
+    int result = enet_host_check_events(_host, &event);
+    if (result == 0)
+        result = enet_host_service(_host, &event, 0);
     if (result < 0)
         LOG(Error, "Failed to check ENet events!");
     if (result > 0)
@@ -195,8 +198,9 @@ bool ENetDriver::PopEvent(NetworkEvent& eventPtr)
         case ENET_EVENT_TYPE_RECEIVE:
             eventPtr.EventType = NetworkEventType::Message;
             eventPtr.Message = _networkHost->CreateMessage();
-            eventPtr.Message.Length = event.packet->dataLength;
-            Platform::MemoryCopy(eventPtr.Message.Buffer, event.packet->data, event.packet->dataLength);
+            eventPtr.Message.Length = (uint32)Math::Min<size_t>(event.packet->dataLength, eventPtr.Message.BufferSize);
+            Platform::MemoryCopy(eventPtr.Message.Buffer, event.packet->data, eventPtr.Message.Length);
+            enet_packet_destroy(event.packet);
             break;
         default:
             break;
@@ -229,14 +233,27 @@ void ENetDriver::SendMessage(NetworkChannelType channelType, const NetworkMessag
 void ENetDriver::SendMessage(const NetworkChannelType channelType, const NetworkMessage& message, const Array<NetworkConnection, HeapAllocation>& targets)
 {
     ASSERT(IsServer());
+
+    // Share a single packet between all peers (reference counted by ENet)
+    ENetPacket* packet = nullptr;
     ENetPeer* peer;
     for (NetworkConnection target : targets)
     {
         if (_peerMap.TryGet(target.ConnectionId, peer) && peer && peer->state == ENET_PEER_STATE_CONNECTED)
         {
-            SendPacketToPeer(peer, channelType, message);
+            if (!packet)
+                packet = enet_packet_create(message.Buffer, message.Length, ChannelTypeToPacketFlag(channelType));
+            enet_peer_send(peer, 0, packet);
         }
     }
+    if (packet && packet->referenceCount == 0)
+        enet_packet_destroy(packet);
+}
+
+void ENetDriver::Flush()
+{
+    if (_host)
+        enet_host_flush(_host);
 }
 
 NetworkDriverStats ENetDriver::GetStats()
@@ -257,6 +274,7 @@ NetworkDriverStats ENetDriver::GetStats(NetworkConnection target)
         stats.RTT = (float)peer->roundTripTime;
         stats.TotalDataSent = peer->totalDataSent;
         stats.TotalDataReceived = peer->totalDataReceived;
+        stats.PacketLoss = (float)peer->packetLoss / (float)ENET_PEER_PACKET_LOSS_SCALE;
     }
     return stats;
 }
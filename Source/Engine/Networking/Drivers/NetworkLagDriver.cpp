@@ -169,6 +169,13 @@ void NetworkLagDriver::SendMessage(const NetworkChannelType channelType, const N
     msg.MessageData.Set(message.Buffer, message.Length);
 }
 
+void NetworkLagDriver::Flush()
+{
+    if (!_driver)
+        return;
+    _driver->Flush();
+}
+
 NetworkDriverStats NetworkLagDriver::GetStats()
 {
     if (!_driver)
@@ -72,6 +72,7 @@ API_CLASS(Namespace="FlaxEngine.Networking", Sealed) class FLAXENGINE_API Networ
     void SendMessage(NetworkChannelType channelType, const NetworkMessage& message) override;
     void SendMessage(NetworkChannelType channelType, const NetworkMessage& message, NetworkConnection target) override;
     void SendMessage(NetworkChannelType channelType, const NetworkMessage& message, const Array<NetworkConnection, HeapAllocation>& targets) override;
+    void Flush() override;
     NetworkDriverStats GetStats() override;
     NetworkDriverStats GetStats(NetworkConnection target) override;
 
@@ -99,6 +99,13 @@ API_INTERFACE(Namespace="FlaxEngine.Networking") class FLAXENGINE_API INetworkDr
     /// <remarks>Can be used only by the server!</remarks>
     API_FUNCTION() virtual void SendMessage(NetworkChannelType channelType, const NetworkMessage& message, const Array<NetworkConnection, HeapAllocation>& targets) = 0;
 
+    /// <summary>
+    /// Sends all queued messages right away (instead of waiting for the next events processing). Called by the peer once per network update, after sending all messages.
+    /// </summary>
+    API_FUNCTION() virtual void Flush()
+    {
+    }
+
     /// <summary>
     /// Gets the network transport layer stats.
     /// </summary>
@@ -82,6 +82,12 @@ API_STRUCT(Namespace="FlaxEngine.Networking") struct FLAXENGINE_API NetworkConfi
     API_FIELD()
     uint16 MessagePoolSize = 2048;
 
+    /// <summary>
+    /// If checked, small messages sent over the same channel to the same connection are packed together into MTU-sized packets (limited by MessageSize) that are sent on NetworkPeer.Flush. Reduces per-packet overhead when sending many small messages. Both peers need to use the same value. Messages starting with byte 255 are reserved for aggregated packets when this is enabled.
+    /// </summary>
+    API_FIELD()
+    bool MessageAggregation = false;
+
     // Ignore deprecation warnings in defaults
     PRAGMA_DISABLE_DEPRECATION_WARNINGS
     NetworkConfig()
@@ -19,6 +19,9 @@ enum class NetworkMessageIDs : uint8
     ObjectDespawn,
     ObjectRole,
     ObjectRpc,
+    Names,
+    NamesAck,
+    ObjectReplicateAck,
 
     MAX,
 };
@@ -31,6 +34,9 @@ class NetworkInternal
     static void NetworkReplicatorClear();
     static void NetworkReplicatorPreUpdate();
     static void NetworkReplicatorUpdate();
+    static void NetworkPredictionPreUpdate();
+    static void NetworkPredictionUpdate();
+    static void NetworkPredictionClear();
     static void OnNetworkMessageObjectReplicate(NetworkEvent& event, NetworkClient* client, NetworkPeer* peer);
     static void OnNetworkMessageObjectReplicatePart(NetworkEvent& event, NetworkClient* client, NetworkPeer* peer);
     static void OnNetworkMessageObjectSpawn(NetworkEvent& event, NetworkClient* client, NetworkPeer* peer);
@@ -38,6 +44,9 @@ class NetworkInternal
     static void OnNetworkMessageObjectDespawn(NetworkEvent& event, NetworkClient* client, NetworkPeer* peer);
     static void OnNetworkMessageObjectRole(NetworkEvent& event, NetworkClient* client, NetworkPeer* peer);
     static void OnNetworkMessageObjectRpc(NetworkEvent& event, NetworkClient* client, NetworkPeer* peer);
+    static void OnNetworkMessageNames(NetworkEvent& event, NetworkClient* client, NetworkPeer* peer);
+    static void OnNetworkMessageNamesAck(NetworkEvent& event, NetworkClient* client, NetworkPeer* peer);
+    static void OnNetworkMessageObjectReplicateAck(NetworkEvent& event, NetworkClient* client, NetworkPeer* peer);
 
 #if COMPILE_WITH_PROFILER
 
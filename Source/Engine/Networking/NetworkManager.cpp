@@ -7,15 +7,17 @@
 #include "NetworkChannelType.h"
 #include "NetworkSettings.h"
 #include "NetworkInternal.h"
+#include "NetworkTelemetry.h"
 #include "FlaxEngine.Gen.h"
 #include "Engine/Core/Log.h"
 #include "Engine/Core/Collections/Array.h"
 #include "Engine/Engine/EngineService.h"
 #include "Engine/Engine/Time.h"
 #include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Profiler/ProfilerMemory.h"
 #include "Engine/Scripting/Scripting.h"
 
-#define NETWORK_PROTOCOL_VERSION 3
+#define NETWORK_PROTOCOL_VERSION 4
 
 float NetworkManager::NetworkFPS = 60.0f;
 NetworkPeer* NetworkManager::Peer = nullptr;
@@ -120,6 +122,8 @@ void OnNetworkMessageHandshakeReply(NetworkEvent& event, NetworkClient* client,
     NetworkManager::StateChanged();
 }
 
+void OnNetworkMessageNames(NetworkEvent& event, NetworkClient* client, NetworkPeer* peer);
+
 namespace
 {
     // Network message handlers table
@@ -135,9 +139,23 @@ namespace
         NetworkInternal::OnNetworkMessageObjectDespawn,
         NetworkInternal::OnNetworkMessageObjectRole,
         NetworkInternal::OnNetworkMessageObjectRpc,
+        OnNetworkMessageNames,
+        NetworkInternal::OnNetworkMessageNamesAck,
+        NetworkInternal::OnNetworkMessageObjectReplicateAck,
     };
 }
 
+void OnNetworkMessageNames(NetworkEvent& event, NetworkClient* client, NetworkPeer* peer)
+{
+    // Read names definitions and process the message that uses them (placed right after)
+    NetworkInternal::OnNetworkMessageNames(event, client, peer);
+    if (event.Message.Position >= event.Message.Length)
+        return;
+    const uint8 id = event.Message.Buffer[event.Message.Position];
+    if (id > (uint8)NetworkMessageIDs::HandshakeReply && id < (uint8)NetworkMessageIDs::Names)
+        MessageHandlers[id](event, client, peer);
+}
+
 class NetworkManagerService : public EngineService
 {
 public:
@@ -188,6 +206,7 @@ bool StartPeer()
         return true;
     }
     networkConfig.NetworkDriver = ScriptingObject::NewObject(networkDriverType);
+    networkConfig.MessageAggregation = settings.MessageAggregation;
     NetworkManager::Peer = NetworkPeer::CreatePeer(networkConfig);
     if (!NetworkManager::Peer)
     {
@@ -355,6 +374,7 @@ void NetworkManager::Stop()
         LocalClient->State = NetworkConnectionState::Disconnected;
     }
     NetworkInternal::NetworkReplicatorClear();
+    NetworkInternal::NetworkPredictionClear();
     StopPeer();
     if (LocalClient)
     {
@@ -369,9 +389,15 @@ void NetworkManager::Stop()
 
 void NetworkManagerService::Update()
 {
+    PROFILE_MEM(Networking);
     const double currentTime = Time::Update.UnscaledTime.GetTotalSeconds();
     const float minDeltaTime = NetworkManager::NetworkFPS > 0 ? 1.0f / NetworkManager::NetworkFPS : 0.0f;
     auto peer = NetworkManager::Peer;
+    if (NetworkManager::Mode != NetworkManagerMode::Offline)
+    {
+        // Advance the local prediction every game update (independent of the network update rate)
+        NetworkInternal::NetworkPredictionPreUpdate();
+    }
     if (NetworkManager::Mode == NetworkManagerMode::Offline || (float)(currentTime - LastUpdateTime) < minDeltaTime || !peer)
         return;
     PROFILE_CPU();
@@ -461,6 +487,8 @@ void NetworkManagerService::Update()
                     LOG(Error, "Unknown client");
                     break;
                 }
+                if (NetworkTelemetry::Enabled)
+                    NetworkTelemetry::OnClientReceive(client ? event.Sender.ConnectionId : MAX_uint32, event.Message.Length);
                 uint8 id = *event.Message.Buffer;
                 if (id < (uint8)NetworkMessageIDs::MAX)
                 {
@@ -481,4 +509,12 @@ void NetworkManagerService::Update()
 
     // Update replication
     NetworkInternal::NetworkReplicatorUpdate();
+
+    // Reconcile the local prediction with the received authoritative state
+    NetworkInternal::NetworkPredictionUpdate();
+
+    // Send messages aggregated during this update
+    peer->Flush();
+
+    NetworkTelemetry::Update();
 }
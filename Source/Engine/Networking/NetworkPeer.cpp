@@ -5,9 +5,13 @@
 #include "Drivers/ENetDriver.h"
 #include "Engine/Core/Log.h"
 #include "Engine/Core/Math/Math.h"
+#include "Engine/Engine/Replay.h"
 #include "Engine/Platform/CPUInfo.h"
 #include "Engine/Profiler/ProfilerCPU.h"
 
+// Header byte of the packet with multiple aggregated messages (each prefixed with uint16 length)
+#define NETWORK_PEER_AGGREGATED_PACKET 0xFF
+
 Array<NetworkPeer*> NetworkPeer::Peers;
 
 namespace
@@ -75,6 +79,8 @@ bool NetworkPeer::Initialize(const NetworkConfig& config)
 
 void NetworkPeer::Shutdown()
 {
+    MessageBatches.Clear();
+    AggregatedEvent.Message = NetworkMessage();
     NetworkDriver->Dispose();
     Delete(Config.NetworkDriver);
     DisposeMessageBuffers();
@@ -122,19 +128,96 @@ bool NetworkPeer::Connect()
 void NetworkPeer::Disconnect()
 {
     LOG(Info, "Disconnecting...");
+    Flush();
     NetworkDriver->Disconnect();
 }
 
 void NetworkPeer::Disconnect(const NetworkConnection& connection)
 {
     LOG(Info, "Disconnecting connection with id = {0}...", connection.ConnectionId);
+    Flush();
     NetworkDriver->Disconnect(connection);
 }
 
 bool NetworkPeer::PopEvent(NetworkEvent& eventRef)
 {
     PROFILE_CPU();
-    return NetworkDriver->PopEvent(eventRef);
+    if (Replay::IsPlaying())
+        return PopReplayEvent(eventRef);
+    while (true)
+    {
+        // Unpack messages from the aggregated packet one by one
+        if (AggregatedEvent.Message.IsValid() && PopAggregatedEvent(eventRef))
+            break;
+
+        if (!NetworkDriver->PopEvent(eventRef))
+            return false;
+        if (!Config.MessageAggregation || eventRef.EventType != NetworkEventType::Message || eventRef.Message.Length == 0 || eventRef.Message.Buffer[0] != NETWORK_PEER_AGGREGATED_PACKET)
+            break;
+        AggregatedEvent = eventRef;
+        AggregatedEvent.Message.Position = 1;
+    }
+    if (Replay::IsRecording())
+    {
+        // Record event type, sender and message data
+        Array<byte, InlinedAllocation<256>> record;
+        record.Add((byte)eventRef.EventType);
+        record.Add((const byte*)&eventRef.Sender.ConnectionId, sizeof(uint32));
+        if (eventRef.EventType == NetworkEventType::Message)
+            record.Add(eventRef.Message.Buffer, (int32)eventRef.Message.Length);
+        Replay::Write(ReplayRecordType::NetworkEvent, (uint32)HostId, record.Get(), record.Count());
+    }
+    return true;
+}
+
+bool NetworkPeer::PopReplayEvent(NetworkEvent& eventRef)
+{
+    // Drop the real network traffic
+    NetworkEvent e;
+    while (NetworkDriver->PopEvent(e))
+    {
+        if (e.EventType == NetworkEventType::Message)
+            RecycleMessage(e.Message);
+    }
+
+    // Feed the recorded events
+    Span<byte> record;
+    if (!Replay::Read(ReplayRecordType::NetworkEvent, (uint32)HostId, record) || record.Length() < 1 + (int32)sizeof(uint32))
+        return false;
+    eventRef.EventType = (NetworkEventType)record[0];
+    Platform::MemoryCopy(&eventRef.Sender.ConnectionId, record.Get() + 1, sizeof(uint32));
+    eventRef.Message = NetworkMessage();
+    if (eventRef.EventType == NetworkEventType::Message)
+    {
+        eventRef.Message = CreateMessage();
+        eventRef.Message.Length = Math::Min((uint32)(record.Length() - 1 - sizeof(uint32)), eventRef.Message.BufferSize);
+        Platform::MemoryCopy(eventRef.Message.Buffer, record.Get() + 1 + sizeof(uint32), eventRef.Message.Length);
+    }
+    return true;
+}
+
+bool NetworkPeer::PopAggregatedEvent(NetworkEvent& eventRef)
+{
+    NetworkMessage& packet = AggregatedEvent.Message;
+    if (packet.Position + sizeof(uint16) <= packet.Length)
+    {
+        const uint16 length = packet.ReadUInt16();
+        if (length != 0 && packet.Position + length <= packet.Length)
+        {
+            eventRef.EventType = NetworkEventType::Message;
+            eventRef.Sender = AggregatedEvent.Sender;
+            eventRef.Message = CreateMessage();
+            packet.ReadBytes(eventRef.Message.Buffer, length);
+            eventRef.Message.Length = length;
+            return true;
+        }
+        LOG(Warning, "Invalid aggregated message from connection {0}", AggregatedEvent.Sender.ConnectionId);
+    }
+
+    // Packet ended
+    RecycleMessage(packet);
+    packet = NetworkMessage();
+    return false;
 }
 
 NetworkMessage NetworkPeer::CreateMessage()
@@ -170,7 +253,8 @@ bool NetworkPeer::EndSendMessage(const NetworkChannelType channelType, const Net
 {
     ASSERT(message.IsValid());
 
-    NetworkDriver->SendMessage(channelType, message);
+    if (!Config.MessageAggregation || AggregateMessage(channelType, message, MAX_uint32))
+        NetworkDriver->SendMessage(channelType, message);
 
     RecycleMessage(message);
     return false;
@@ -180,7 +264,8 @@ bool NetworkPeer::EndSendMessage(const NetworkChannelType channelType, const Net
 {
     ASSERT(message.IsValid());
 
-    NetworkDriver->SendMessage(channelType, message, target);
+    if (!Config.MessageAggregation || AggregateMessage(channelType, message, target.ConnectionId))
+        NetworkDriver->SendMessage(channelType, message, target);
 
     RecycleMessage(message);
     return false;
@@ -190,12 +275,75 @@ bool NetworkPeer::EndSendMessage(const NetworkChannelType channelType, const Net
 {
     ASSERT(message.IsValid());
 
-    NetworkDriver->SendMessage(channelType, message, targets);
+    if (Config.MessageAggregation)
+    {
+        for (const NetworkConnection& target : targets)
+        {
+            if (AggregateMessage(channelType, message, target.ConnectionId))
+                NetworkDriver->SendMessage(channelType, message, target);
+        }
+    }
+    else
+    {
+        NetworkDriver->SendMessage(channelType, message, targets);
+    }
 
     RecycleMessage(message);
     return false;
 }
 
+void NetworkPeer::Flush()
+{
+    PROFILE_CPU();
+    for (const auto& e : MessageBatches)
+        SendMessageBatch(e.Key, e.Value);
+    MessageBatches.Clear();
+    NetworkDriver->Flush();
+}
+
+bool NetworkPeer::AggregateMessage(NetworkChannelType channelType, const NetworkMessage& message, uint32 connectionId)
+{
+    const uint64 key = (uint64)connectionId << 8 | (uint64)channelType;
+    const uint32 size = sizeof(uint16) + message.Length;
+    const bool sendDirectly = sizeof(uint8) + size > Config.MessageSize || message.Length == 0;
+    NetworkMessage* batch = MessageBatches.TryGet(key);
+    if (batch && (sendDirectly || batch->Length + size > batch->BufferSize))
+    {
+        // Send pending messages first to preserve the order within the channel
+        SendMessageBatch(key, *batch);
+        MessageBatches.Remove(key);
+        batch = nullptr;
+    }
+    if (sendDirectly)
+        return true;
+    if (!batch)
+    {
+        batch = &MessageBatches[key];
+        *batch = CreateMessage();
+        batch->WriteUInt8(NETWORK_PEER_AGGREGATED_PACKET);
+    }
+    batch->WriteUInt16((uint16)message.Length);
+    batch->WriteBytes(message.Buffer, (int32)message.Length);
+    return false;
+}
+
+void NetworkPeer::SendMessageBatch(uint64 key, const NetworkMessage& batch)
+{
+    const NetworkChannelType channelType = (NetworkChannelType)(key & 0xff);
+    const uint32 connectionId = (uint32)(key >> 8);
+    if (connectionId == MAX_uint32)
+    {
+        NetworkDriver->SendMessage(channelType, batch);
+    }
+    else
+    {
+        NetworkConnection target;
+        target.ConnectionId = connectionId;
+        NetworkDriver->SendMessage(channelType, batch, target);
+    }
+    RecycleMessage(batch);
+}
+
 NetworkPeer* NetworkPeer::CreatePeer(const NetworkConfig& config)
 {
     // Validate the address for listen/connect
@@ -4,7 +4,9 @@
 
 #include "Types.h"
 #include "NetworkConfig.h"
+#include "NetworkEvent.h"
 #include "Engine/Core/Collections/Array.h"
+#include "Engine/Core/Collections/Dictionary.h"
 #include "Engine/Scripting/ScriptingType.h"
 #include "Engine/Scripting/ScriptingObjectReference.h"
 
@@ -25,6 +27,11 @@ API_CLASS(sealed, NoSpawn, Namespace = "FlaxEngine.Networking") class FLAXENGINE
     uint8* MessageBuffer = nullptr;
     Array<uint32, HeapAllocation> MessagePool;
 
+    // Packets with aggregated messages pending to send (key is connection id and channel type).
+    Dictionary<uint64, NetworkMessage> MessageBatches;
+    // Received packet with aggregated messages that are being unpacked.
+    NetworkEvent AggregatedEvent;
+
 public:
     /// <summary>
     /// Low-level network transport driver used by this peer.
@@ -130,6 +137,11 @@ API_CLASS(sealed, NoSpawn, Namespace = "FlaxEngine.Networking") class FLAXENGINE
     /// </remarks>
     API_FUNCTION() bool EndSendMessage(NetworkChannelType channelType, const NetworkMessage& message, const Array<NetworkConnection, HeapAllocation>& targets);
 
+    /// <summary>
+    /// Sends all pending messages (including aggregated messages when MessageAggregation is enabled in the peer configuration). Should be called once per network update (after sending all messages).
+    /// </summary>
+    API_FUNCTION() void Flush();
+
     /// <summary>
     /// Creates new peer using given configuration.
     /// </summary>
@@ -172,4 +184,8 @@ API_CLASS(sealed, NoSpawn, Namespace = "FlaxEngine.Networking") class FLAXENGINE
     void Shutdown();
     void CreateMessageBuffers();
     void DisposeMessageBuffers();
+    bool AggregateMessage(NetworkChannelType channelType, const NetworkMessage& message, uint32 connectionId);
+    void SendMessageBatch(uint64 key, const NetworkMessage& batch);
+    bool PopAggregatedEvent(NetworkEvent& eventRef);
+    bool PopReplayEvent(NetworkEvent& eventRef);
 };
@@ -0,0 +1,317 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "NetworkPrediction.h"
+#include "NetworkInternal.h"
+#include "Engine/Core/Math/Math.h"
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Platform/Platform.h"
+#include "Engine/Profiler/ProfilerCPU.h"
+
+// Alignment of the state and input data within the snapshots
+#define NETWORK_PREDICTION_ALIGNMENT 16
+
+// History layout (ring buffers indexed with tick % HistorySize):
+// States: [Slot] Entry0.State, Entry1.State, ...
+// Inputs: [Slot] Entry0.Input, Entry1.Input, ...
+// InputFlags: [Slot] Entry0.HasInput, Entry1.HasInput, ...
+
+uint32 NetworkPrediction::_tick = 0;
+int32 NetworkPrediction::HistorySize = 64;
+
+namespace
+{
+    struct Entry
+    {
+        ScriptingObject* Object;
+        int32 StateSize;
+        int32 StateOffset;
+        int32 InputSize;
+        int32 InputOffset;
+        uint32 FirstTick;
+        NetworkPrediction::GetStateFunc GetState;
+        NetworkPrediction::SetStateFunc SetState;
+        NetworkPrediction::SimulateFunc Simulate;
+    };
+
+    struct Correction
+    {
+        int32 Entry;
+        uint32 Tick;
+        int32 DataOffset;
+    };
+
+    Array<Entry> Entries;
+    Dictionary<const ScriptingObject*, int32> EntriesLookup;
+    int32 History = 0;
+    int32 StateStride = 0;
+    int32 InputStride = 0;
+    Array<byte> States;
+    Array<byte> Inputs;
+    Array<byte> InputFlags;
+    Array<Correction> Corrections;
+    Array<byte> CorrectionsData;
+
+    FORCE_INLINE int32 GetSlot(uint32 tick)
+    {
+        return (int32)(tick % (uint32)History);
+    }
+
+    FORCE_INLINE byte* GetState(uint32 tick, const Entry& e)
+    {
+        return States.Get() + GetSlot(tick) * StateStride + e.StateOffset;
+    }
+
+    // Packs the entries data within the snapshots (entries keep the previous layout offsets, oldIndices maps entry to its previous index or -1 if new). Keeps the existing history unless its size changes.
+    void UpdateLayout(const Array<int32>& oldIndices, int32 oldCount)
+    {
+        const int32 oldStateStride = StateStride, oldInputStride = InputStride;
+        const bool keepHistory = History == Math::Max(NetworkPrediction::HistorySize, 2);
+        History = Math::Max(NetworkPrediction::HistorySize, 2);
+        Array<byte> states, inputs, inputFlags;
+        int32 stateStride = 0, inputStride = 0;
+        for (const Entry& e : Entries)
+        {
+            stateStride += Math::AlignUp(e.StateSize, NETWORK_PREDICTION_ALIGNMENT);
+            inputStride += Math::AlignUp(e.InputSize, NETWORK_PREDICTION_ALIGNMENT);
+        }
+        states.Resize(History * stateStride);
+        inputs.Resize(History * inputStride);
+        inputFlags.Resize(History * Entries.Count());
+        Platform::MemoryClear(inputFlags.Get(), inputFlags.Count());
+        int32 stateOffset = 0, inputOffset = 0;
+        for (int32 i = 0; i < Entries.Count(); i++)
+        {
+            Entry& e = Entries[i];
+            const int32 oldIndex = oldIndices[i];
+            if (keepHistory && oldIndex != -1)
+            {
+                for (int32 slot = 0; slot < History; slot++)
+                {
+                    Platform::MemoryCopy(states.Get() + slot * stateStride + stateOffset, States.Get() + slot * oldStateStride + e.StateOffset, e.StateSize);
+                    Platform::MemoryCopy(inputs.Get() + slot * inputStride + inputOffset, Inputs.Get() + slot * oldInputStride + e.InputOffset, e.InputSize);
+                    inputFlags[slot * Entries.Count() + i] = InputFlags[slot * oldCount + oldIndex];
+                }
+            }
+            else
+            {
+                e.FirstTick = NetworkPrediction::GetTick();
+            }
+            e.StateOffset = stateOffset;
+            e.InputOffset = inputOffset;
+            stateOffset += Math::AlignUp(e.StateSize, NETWORK_PREDICTION_ALIGNMENT);
+            inputOffset += Math::AlignUp(e.InputSize, NETWORK_PREDICTION_ALIGNMENT);
+        }
+        StateStride = stateStride;
+        InputStride = inputStride;
+        States.Swap(states);
+        Inputs.Swap(inputs);
+        InputFlags.Swap(inputFlags);
+    }
+
+    void UpdateLayout()
+    {
+        Array<int32> oldIndices;
+        oldIndices.Resize(Entries.Count());
+        for (int32 i = 0; i < Entries.Count(); i++)
+            oldIndices[i] = i;
+        UpdateLayout(oldIndices, Entries.Count());
+    }
+}
+
+uint32 NetworkPrediction::ExpandTick(uint16 sequenceIndex)
+{
+    const int16 delta = (int16)(uint16)(sequenceIndex - (uint16)_tick);
+    return (uint32)((int64)_tick + delta);
+}
+
+void NetworkPrediction::AddObject(ScriptingObject* obj, int32 stateSize, int32 inputSize, GetStateFunc getState, SetStateFunc setState, SimulateFunc simulate)
+{
+    if (!obj || EntriesLookup.ContainsKey(obj))
+        return;
+    ASSERT(stateSize > 0 && inputSize >= 0 && getState && setState && simulate);
+    Array<int32> oldIndices;
+    oldIndices.Resize(Entries.Count() + 1);
+    for (int32 i = 0; i < Entries.Count(); i++)
+        oldIndices[i] = i;
+    oldIndices.Last() = -1;
+    const int32 oldCount = Entries.Count();
+    EntriesLookup[obj] = Entries.Count();
+    Entry& e = Entries.AddOne();
+    e.Object = obj;
+    e.StateSize = stateSize;
+    e.InputSize = inputSize;
+    e.FirstTick = _tick;
+    e.GetState = getState;
+    e.SetState = setState;
+    e.Simulate = simulate;
+    UpdateLayout(oldIndices, oldCount);
+}
+
+void NetworkPrediction::RemoveObject(ScriptingObject* obj)
+{
+    int32 index;
+    if (!EntriesLookup.TryGet(obj, index))
+        return;
+    EntriesLookup.Remove(obj);
+    Array<int32> oldIndices;
+    oldIndices.Resize(Entries.Count());
+    for (int32 i = 0; i < Entries.Count(); i++)
+        oldIndices[i] = i;
+    const int32 lastIndex = Entries.Count() - 1;
+    for (int32 i = Corrections.Count() - 1; i >= 0; i--)
+    {
+        if (Corrections[i].Entry == index)
+            Corrections.RemoveAt(i);
+        else if (Corrections[i].Entry == lastIndex)
+            Corrections[i].Entry = index;
+    }
+    if (index != lastIndex)
+    {
+        Entries[index] = Entries[lastIndex];
+        oldIndices[index] = lastIndex;
+        EntriesLookup[Entries[index].Object] = index;
+    }
+    Entries.RemoveLast();
+    oldIndices.RemoveLast();
+    UpdateLayout(oldIndices, lastIndex + 1);
+}
+
+bool NetworkPrediction::HasObject(const ScriptingObject* obj)
+{
+    return EntriesLookup.ContainsKey(obj);
+}
+
+void NetworkPrediction::SetInput(ScriptingObject* obj, const void* input)
+{
+    int32 index;
+    if (!EntriesLookup.TryGet(obj, index))
+        return;
+    const Entry& e = Entries[index];
+    const int32 slot = GetSlot(_tick);
+    Platform::MemoryCopy(Inputs.Get() + slot * InputStride + e.InputOffset, input, e.InputSize);
+    InputFlags[slot * Entries.Count() + index] = 1;
+}
+
+bool NetworkPrediction::Correct(ScriptingObject* obj, uint32 tick, const void* state)
+{
+    int32 index;
+    if (!EntriesLookup.TryGet(obj, index))
+        return true;
+    const Entry& e = Entries[index];
+
+    // Keep only the latest correction for each object
+    Correction* correction = nullptr;
+    for (Correction& c : Corrections)
+    {
+        if (c.Entry == index)
+        {
+            correction = &c;
+            break;
+        }
+    }
+    if (correction)
+    {
+        if ((int32)(tick - correction->Tick) < 0)
+            return false;
+    }
+    else
+    {
+        correction = &Corrections.AddOne();
+        correction->Entry = index;
+        correction->DataOffset = CorrectionsData.Count();
+        CorrectionsData.AddUninitialized(e.StateSize);
+    }
+    correction->Tick = tick;
+    Platform::MemoryCopy(CorrectionsData.Get() + correction->DataOffset, state, e.StateSize);
+    return false;
+}
+
+void NetworkInternal::NetworkPredictionPreUpdate()
+{
+    // Finish the current tick by capturing the state of all predicted objects
+    auto& tick = NetworkPrediction::_tick;
+    if (History != Math::Max(NetworkPrediction::HistorySize, 2))
+        UpdateLayout();
+    if (Entries.HasItems())
+    {
+        PROFILE_CPU_NAMED("NetworkPrediction.Capture");
+        for (const Entry& e : Entries)
+            e.GetState(e.Object, GetState(tick, e));
+    }
+
+    // Start the next tick without input
+    tick++;
+    if (Entries.HasItems())
+        Platform::MemoryClear(InputFlags.Get() + GetSlot(tick) * Entries.Count(), Entries.Count());
+}
+
+void NetworkInternal::NetworkPredictionUpdate()
+{
+    if (Corrections.IsEmpty())
+        return;
+    PROFILE_CPU_NAMED("NetworkPrediction.Reconcile");
+    const uint32 tick = NetworkPrediction::_tick;
+    const uint32 lastTick = tick - 1; // The last captured tick
+
+    // Rollback the corrected objects to the authoritative state
+    uint32 minTick = MAX_uint32;
+    for (Correction& c : Corrections)
+    {
+        Entry& e = Entries[c.Entry];
+        const byte* state = CorrectionsData.Get() + c.DataOffset;
+        const int32 age = (int32)(lastTick - c.Tick);
+        if (tick == 0 || age <= 0 || age >= History || (int32)(c.Tick - e.FirstTick) < 0)
+        {
+            // Correction is not older than the local state or it's beyond the history so apply it directly
+            if (tick != 0)
+                Platform::MemoryCopy(GetState(lastTick, e), state, e.StateSize);
+            e.SetState(e.Object, state);
+            c.Entry = -1;
+            continue;
+        }
+        Platform::MemoryCopy(GetState(c.Tick, e), state, e.StateSize);
+        minTick = Math::Min(minTick, c.Tick);
+    }
+
+    // Re-simulate all corrected objects tick-by-tick up to the present in a single pass over the history
+    if (minTick != MAX_uint32)
+    {
+        const int32 entriesCount = Entries.Count();
+        for (uint32 t = minTick + 1; t != tick; t++)
+        {
+            const int32 slot = GetSlot(t);
+            const byte* inputFlags = InputFlags.Get() + slot * entriesCount;
+            const byte* inputs = Inputs.Get() + slot * InputStride;
+            for (const Correction& c : Corrections)
+            {
+                if (c.Entry == -1 || (int32)(t - c.Tick) <= 0)
+                    continue;
+                const Entry& e = Entries[c.Entry];
+                byte* state = GetState(t, e);
+                Platform::MemoryCopy(state, GetState(t - 1, e), e.StateSize);
+                if (inputFlags[c.Entry])
+                    e.Simulate(e.Object, state, inputs + e.InputOffset);
+            }
+        }
+
+        // Apply the reconciled state
+        for (const Correction& c : Corrections)
+        {
+            if (c.Entry != -1)
+            {
+                const Entry& e = Entries[c.Entry];
+                e.SetState(e.Object, GetState(lastTick, e));
+            }
+        }
+    }
+
+    Corrections.Clear();
+    CorrectionsData.Clear();
+}
+
+void NetworkInternal::NetworkPredictionClear()
+{
+    Corrections.Clear();
+    CorrectionsData.Clear();
+}
@@ -0,0 +1,88 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Types.h"
+#include "Engine/Scripting/ScriptingType.h"
+
+class ScriptingObject;
+
+/// <summary>
+/// High-level client-side prediction system. Keeps the bounded history of the local simulation state and input of the registered objects (per-tick snapshots in ring buffers) and reconciles them with the authoritative server state (rollback and re-simulation of the inputs not yet processed by the server).
+/// </summary>
+/// <remarks>
+/// Prediction ticks advance with every game update while networking is active. Objects provide input for the current tick (within the game update), the state gets captured at the end of the tick. Server corrections are queued and processed in a single batched pass over the history for all corrected objects after receiving the network data.
+/// </remarks>
+API_CLASS(static, Namespace="FlaxEngine.Networking") class FLAXENGINE_API NetworkPrediction
+{
+    DECLARE_SCRIPTING_TYPE_MINIMAL(NetworkPrediction);
+    friend class NetworkInternal;
+    typedef void (*GetStateFunc)(ScriptingObject* obj, void* state);
+    typedef void (*SetStateFunc)(ScriptingObject* obj, const void* state);
+    typedef void (*SimulateFunc)(ScriptingObject* obj, void* state, const void* input);
+
+private:
+    static uint32 _tick;
+
+public:
+    /// <summary>
+    /// The size of the prediction history (in ticks). Limits the memory used by the snapshots and the maximum latency of the server corrections that can be reconciled (older corrections are applied directly without re-simulation).
+    /// </summary>
+    API_FIELD() static int32 HistorySize;
+
+    /// <summary>
+    /// Gets the current prediction tick (simulated by the current game update).
+    /// </summary>
+    API_PROPERTY() FORCE_INLINE static uint32 GetTick()
+    {
+        return _tick;
+    }
+
+    /// <summary>
+    /// Converts the 16-bit sequence index (eg. sent over the network) into the full prediction tick closest to the current tick.
+    /// </summary>
+    /// <param name="sequenceIndex">The 16-bit tick sequence index.</param>
+    /// <returns>The prediction tick.</returns>
+    API_FUNCTION() static uint32 ExpandTick(uint16 sequenceIndex);
+
+public:
+    /// <summary>
+    /// Adds the object to the prediction system.
+    /// </summary>
+    /// <param name="obj">The object.</param>
+    /// <param name="stateSize">The size of the object state (in bytes).</param>
+    /// <param name="inputSize">The size of the object simulation input (in bytes).</param>
+    /// <param name="getState">The callback that captures the current object state.</param>
+    /// <param name="setState">The callback that applies the reconciled state to the object.</param>
+    /// <param name="simulate">The callback that advances the state by a single tick with the given input (without modifying the object).</param>
+    static void AddObject(ScriptingObject* obj, int32 stateSize, int32 inputSize, GetStateFunc getState, SetStateFunc setState, SimulateFunc simulate);
+
+    /// <summary>
+    /// Removes the object from the prediction system.
+    /// </summary>
+    /// <param name="obj">The object.</param>
+    API_FUNCTION() static void RemoveObject(ScriptingObject* obj);
+
+    /// <summary>
+    /// Checks if the object has been added to the prediction system.
+    /// </summary>
+    /// <param name="obj">The object.</param>
+    /// <returns>True if object is predicted, otherwise false.</returns>
+    API_FUNCTION() static bool HasObject(const ScriptingObject* obj);
+
+    /// <summary>
+    /// Sets the object simulation input for the current tick. Ticks without input are not simulated (state is kept) during re-simulation.
+    /// </summary>
+    /// <param name="obj">The object.</param>
+    /// <param name="input">The input data (of size specified on object registration).</param>
+    static void SetInput(ScriptingObject* obj, const void* input);
+
+    /// <summary>
+    /// Queues the authoritative state correction for the object. The state gets rolled back to the given tick and the following inputs are re-simulated.
+    /// </summary>
+    /// <param name="obj">The object.</param>
+    /// <param name="tick">The last tick which input has been included in the authoritative state.</param>
+    /// <param name="state">The authoritative state data (of size specified on object registration).</param>
+    /// <returns>True if object is not predicted and correction was not queued, otherwise false.</returns>
+    static bool Correct(ScriptingObject* obj, uint32 tick, const void* state);
+};
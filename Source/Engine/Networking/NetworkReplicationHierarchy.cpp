@@ -2,18 +2,19 @@
 
 #include "NetworkReplicationHierarchy.h"
 #include "NetworkManager.h"
+#include "NetworkClient.h"
 #include "Engine/Level/Actor.h"
 #include "Engine/Level/SceneObject.h"
 
 uint16 NetworkReplicationNodeObjectCounter = 0;
 NetworkClientsMask NetworkClientsMask::All = { MAX_uint64, MAX_uint64 };
 
-Actor* NetworkReplicationHierarchyObject::GetActor() const
+Actor* NetworkReplicationHierarchyObject::GetActor(ScriptingObject* obj)
 {
-    auto* actor = ScriptingObject::Cast<Actor>(Object);
+    auto* actor = ScriptingObject::Cast<Actor>(obj);
     if (!actor)
     {
-        if (const auto* sceneObject = ScriptingObject::Cast<SceneObject>(Object))
+        if (const auto* sceneObject = ScriptingObject::Cast<SceneObject>(obj))
             actor = sceneObject->GetParent();
     }
     return actor;
@@ -97,6 +98,11 @@ bool NetworkReplicationNode::DirtyObject(ScriptingObject* obj)
 void NetworkReplicationNode::Update(NetworkReplicationHierarchyUpdateResult* result)
 {
     CHECK(result);
+    UpdateObjects(result, result->GetClientsMask(), result->_clientsHaveLocation ? result->GetClientsMask() : NetworkClientsMask());
+}
+
+void NetworkReplicationNode::UpdateObjects(NetworkReplicationHierarchyUpdateResult* result, const NetworkClientsMask& targetClients, const NetworkClientsMask& cullClients)
+{
     const float networkFPS = NetworkManager::NetworkFPS / result->ReplicationScale;
     for (NetworkReplicationHierarchyObject& obj : Objects)
     {
@@ -106,14 +112,14 @@ void NetworkReplicationNode::Update(NetworkReplicationHierarchyUpdateResult* res
             {
                 // Marked as dirty to sync manually
                 obj.ReplicationUpdatesLeft = 0;
-                result->AddObject(obj.Object);
+                result->AddObject(obj.Object, targetClients, obj.Priority, obj.CullDistance);
             }
             continue;
         }
         else if (obj.ReplicationFPS < ZeroTolerance) // == 0
         {
             // Always relevant
-            result->AddObject(obj.Object);
+            result->AddObject(obj.Object, targetClients, obj.Priority, obj.CullDistance);
         }
         else if (obj.ReplicationUpdatesLeft > 0)
         {
@@ -122,8 +128,8 @@ void NetworkReplicationNode::Update(NetworkReplicationHierarchyUpdateResult* res
         }
         else
         {
-            NetworkClientsMask targetClients = result->GetClientsMask();
-            if (result->_clientsHaveLocation && obj.CullDistance > 0.0f)
+            NetworkClientsMask objTargetClients = targetClients;
+            if (cullClients && obj.CullDistance > 0.0f)
             {
                 // Cull object against viewers locations
                 if (const Actor* actor = obj.GetActor())
@@ -133,23 +139,23 @@ void NetworkReplicationNode::Update(NetworkReplicationHierarchyUpdateResult* res
                     for (int32 clientIndex = 0; clientIndex < result->_clients.Count(); clientIndex++)
                     {
                         const auto& client = result->_clients[clientIndex];
-                        if (client.HasLocation)
+                        if (client.HasLocation && cullClients.HasBit(clientIndex))
                         {
                             const Real distanceSq = Vector3::DistanceSquared(objPosition, client.Location);
                             // TODO: scale down replication FPS when object is far away from all clients (eg. by 10-50%)
                             if (distanceSq >= cullDistanceSq)
                             {
                                 // Object is too far from this viewer so don't send data to him
-                                targetClients.UnsetBit(clientIndex);
+                                objTargetClients.UnsetBit(clientIndex);
                             }
                         }
                     }
                 }
             }
-            if (targetClients && obj.Object)
+            if (objTargetClients && obj.Object)
             {
                 // Replicate this frame
-                result->AddObject(obj.Object, targetClients);
+                result->AddObject(obj.Object, objTargetClients, obj.Priority, obj.CullDistance);
             }
 
             // Calculate frames until next replication
@@ -170,7 +176,7 @@ void NetworkReplicationGridNode::AddObject(NetworkReplicationHierarchyObject obj
     Int3 coord = Int3::Zero;
     if (const Actor* actor = obj.GetActor())
     {
-        coord = actor->GetPosition() / CellSize;
+        coord = Vector3::Floor(actor->GetPosition() / CellSize);
     }
 
     Cell* cell = _children.TryGet(coord);
@@ -179,13 +185,41 @@ void NetworkReplicationGridNode::AddObject(NetworkReplicationHierarchyObject obj
         // Allocate new cell
         cell = &_children[coord];
         cell->Node = New<NetworkReplicationNode>();
-        cell->MinCullDistance = obj.CullDistance;
+        cell->IsGrid = false;
+        cell->ObjectsCount = 0;
+        cell->MinCullDistance = MAX_float;
+        cell->MaxCullDistance = 0.0f;
+        cell->TargetClients = NetworkClientsMask();
+        cell->CullClients = NetworkClientsMask();
+        _cellsVersion++;
     }
     cell->Node->AddObject(obj);
+    cell->ObjectsCount++;
     _objectToCell[obj.Object.Get()] = coord;
 
-    // Cache minimum culling distance for a whole cell to skip it at once
-    cell->MinCullDistance = Math::Min(cell->MinCullDistance, obj.CullDistance);
+    // Cache culling distance range for a whole cell to skip it at once (0 means no culling)
+    const float cullDistance = obj.CullDistance > 0.0f ? obj.CullDistance : MAX_float;
+    if (cullDistance < cell->MinCullDistance || cullDistance > cell->MaxCullDistance)
+    {
+        cell->MinCullDistance = Math::Min(cell->MinCullDistance, cullDistance);
+        cell->MaxCullDistance = Math::Max(cell->MaxCullDistance, cullDistance);
+        _cellsVersion++;
+    }
+
+    if (!cell->IsGrid && MaxCellObjects > 0 && cell->ObjectsCount > MaxCellObjects && CellSize * 0.5f >= MinCellSize)
+    {
+        // Subdivide dense cell into a nested grid with smaller cells
+        auto grid = New<NetworkReplicationGridNode>();
+        grid->CellSize = CellSize * 0.5f;
+        grid->MaxCellObjects = MaxCellObjects;
+        grid->MinCellSize = MinCellSize;
+        grid->RelevancyHysteresis = RelevancyHysteresis;
+        for (const NetworkReplicationHierarchyObject& e : cell->Node->Objects)
+            grid->AddObject(e);
+        Delete(cell->Node);
+        cell->Node = grid;
+        cell->IsGrid = true;
+    }
 }
 
 bool NetworkReplicationGridNode::RemoveObject(ScriptingObject* obj)
@@ -195,11 +229,17 @@ bool NetworkReplicationGridNode::RemoveObject(ScriptingObject* obj)
     {
         return false;
     }
-    if (_children[coord].Node->RemoveObject(obj))
+    Cell& cell = _children[coord];
+    if (cell.Node->RemoveObject(obj))
     {
         _objectToCell.Remove(obj);
-        // TODO: remove empty cells?
-        // TODO: update MinCullDistance for cell?
+        if (--cell.ObjectsCount <= 0)
+        {
+            // Free empty cell
+            Delete(cell.Node);
+            _children.Remove(coord);
+        }
+        // TODO: update cull distance range for cell?
         return true;
     }
     return false;
@@ -234,21 +274,54 @@ void NetworkReplicationGridNode::Update(NetworkReplicationHierarchyUpdateResult*
     CHECK(result);
     if (result->_clientsHaveLocation)
     {
-        // Update only cells within a range
-        const Real cellRadiusSq = Math::Square(CellSize * 1.414f);
+        // Update cached cells relevancy only for clients that moved (or when grid changed)
+        const int32 clientsCount = result->_clients.Count();
+        if (_clientsRelevancy.Count() != clientsCount)
+        {
+            _clientsRelevancy.Resize(clientsCount);
+            for (auto& relevancy : _clientsRelevancy)
+                relevancy.CellsVersion = 0;
+        }
+        const Real hysteresisSq = Math::Square(RelevancyHysteresis);
+        for (int32 clientIndex = 0; clientIndex < clientsCount; clientIndex++)
+        {
+            const auto& client = result->_clients[clientIndex];
+            const uint32 clientId = clientIndex < NetworkManager::Clients.Count() ? NetworkManager::Clients[clientIndex]->ClientId : clientIndex;
+            ClientRelevancy& relevancy = _clientsRelevancy[clientIndex];
+            if (relevancy.CellsVersion != _cellsVersion ||
+                relevancy.ClientId != clientId ||
+                relevancy.HasLocation != client.HasLocation ||
+                (client.HasLocation && Vector3::DistanceSquared(relevancy.Location, client.Location) > hysteresisSq))
+            {
+                relevancy.ClientId = clientId;
+                relevancy.CellsVersion = _cellsVersion;
+                relevancy.HasLocation = client.HasLocation;
+                relevancy.Location = client.Location;
+                UpdateClientRelevancy(clientIndex, relevancy);
+            }
+        }
+
+        // Update only cells visible by any client
+        const NetworkClientsMask clientsMask = result->GetClientsMask();
         for (const auto& e : _children)
         {
-            const Vector3 cellPosition = (e.Key * CellSize) + (CellSize * 0.5f);
-            Real distanceSq = MAX_Real;
-            for (auto& client : result->_clients)
+            const Cell& cell = e.Value;
+            NetworkClientsMask targetClients;
+            targetClients.Word0 = cell.TargetClients.Word0 & clientsMask.Word0;
+            targetClients.Word1 = cell.TargetClients.Word1 & clientsMask.Word1;
+            if (!targetClients)
+                continue;
+            if (cell.IsGrid)
             {
-                if (client.HasLocation)
-                    distanceSq = Math::Min(distanceSq, Vector3::DistanceSquared(cellPosition, client.Location));
+                // Nested grid caches relevancy of its own cells
+                cell.Node->Update(result);
             }
-            const Real minCullDistanceSq = Math::Square(e.Value.MinCullDistance);
-            if (distanceSq < minCullDistanceSq + cellRadiusSq)
+            else
             {
-                e.Value.Node->Update(result);
+                NetworkClientsMask cullClients;
+                cullClients.Word0 = cell.CullClients.Word0 & targetClients.Word0;
+                cullClients.Word1 = cell.CullClients.Word1 & targetClients.Word1;
+                cell.Node->UpdateObjects(result, targetClients, cullClients);
             }
         }
     }
@@ -261,3 +334,30 @@ void NetworkReplicationGridNode::Update(NetworkReplicationHierarchyUpdateResult*
         }
     }
 }
+
+void NetworkReplicationGridNode::UpdateClientRelevancy(int32 clientIndex, const ClientRelevancy& relevancy)
+{
+    // Cached relevancy is conservative within hysteresis distance from the cached location so it stays valid until client moves further away
+    const Real cellRadius = CellSize * 0.866025f; // Half of the cell diagonal
+    const Real margin = cellRadius + RelevancyHysteresis;
+    for (auto& e : _children)
+    {
+        Cell& cell = e.Value;
+        bool visible = true, cull = false;
+        if (relevancy.HasLocation)
+        {
+            const Vector3 cellPosition = (e.Key * CellSize) + (CellSize * 0.5f);
+            const Real distance = Vector3::Distance(cellPosition, relevancy.Location);
+            visible = distance - margin < cell.MaxCullDistance;
+            cull = distance + margin >= cell.MinCullDistance;
+        }
+        if (visible)
+            cell.TargetClients.SetBit(clientIndex);
+        else
+            cell.TargetClients.UnsetBit(clientIndex);
+        if (visible && cull)
+            cell.CullClients.SetBit(clientIndex);
+        else
+            cell.CullClients.UnsetBit(clientIndex);
+    }
+}
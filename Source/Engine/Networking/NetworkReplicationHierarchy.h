@@ -24,6 +24,8 @@ API_STRUCT(NoDefault, Namespace = "FlaxEngine.Networking") struct FLAXENGINE_API
     API_FIELD() float ReplicationFPS = 60;
     // The minimum distance from the player to the object at which it can process replication. For example, players further away won't receive object data. Use 0 if unused.
     API_FIELD() float CullDistance = 15000;
+    // The replication priority (gameplay importance). Used to order the replication updates when clients bandwidth is limited (see NetworkReplicator::ClientBandwidthLimit) - objects with higher priority (and closer to the viewer) are sent first, while the other ones get delayed (their priority accumulates over time until they are sent).
+    API_FIELD() float Priority = 1.0f;
     // Runtime value for update frames left for the next replication of this object. Matches NetworkManager::NetworkFPS calculated from ReplicationFPS. Set to 1 if ReplicationFPS less than 0 to indicate dirty object.
     API_FIELD(Attributes="HideInEditor") uint16 ReplicationUpdatesLeft = 0;
 
@@ -38,7 +40,13 @@ API_STRUCT(NoDefault, Namespace = "FlaxEngine.Networking") struct FLAXENGINE_API
     }
 
     // Gets the actors context (object itself or parent actor).
-    Actor* GetActor() const;
+    Actor* GetActor() const
+    {
+        return GetActor(Object.Get());
+    }
+
+    // Gets the actors context (object itself or parent actor).
+    static Actor* GetActor(ScriptingObject* obj);
 
     bool operator==(const NetworkReplicationHierarchyObject& other) const
     {
@@ -127,6 +135,8 @@ API_CLASS(Namespace = "FlaxEngine.Networking") class FLAXENGINE_API NetworkRepli
     {
         ScriptingObject* Object;
         NetworkClientsMask TargetClients;
+        float Priority;
+        float CullDistance;
     };
 
     bool _clientsHaveLocation;
@@ -146,6 +156,8 @@ API_CLASS(Namespace = "FlaxEngine.Networking") class FLAXENGINE_API NetworkRepli
         Entry& e = _entries.AddOne();
         e.Object = obj;
         e.TargetClients = NetworkClientsMask::All;
+        e.Priority = 1.0f;
+        e.CullDistance = 0.0f;
     }
 
     // Adds object to the update results. Defines specific clients to receive the update (server-only, unused on client). Mask matches NetworkManager::Clients.
@@ -154,6 +166,18 @@ API_CLASS(Namespace = "FlaxEngine.Networking") class FLAXENGINE_API NetworkRepli
         Entry& e = _entries.AddOne();
         e.Object = obj;
         e.TargetClients = targetClients;
+        e.Priority = 1.0f;
+        e.CullDistance = 0.0f;
+    }
+
+    // Adds object to the update results. Defines specific clients to receive the update (server-only, unused on client) and the replication priority used when clients bandwidth is limited (scaled down with distance from the client location within cull distance, use 0 to skip distance). Mask matches NetworkManager::Clients.
+    API_FUNCTION() void AddObject(ScriptingObject* obj, NetworkClientsMask targetClients, float priority, float cullDistance = 0.0f)
+    {
+        Entry& e = _entries.AddOne();
+        e.Object = obj;
+        e.TargetClients = targetClients;
+        e.Priority = priority;
+        e.CullDistance = cullDistance;
     }
 
     // Gets amount of the clients to use. Matches NetworkManager::Clients.
@@ -220,6 +244,14 @@ API_CLASS(Abstract, Namespace = "FlaxEngine.Networking") class FLAXENGINE_API Ne
     /// </summary>
     /// <param name="result">The update results container.</param>
     API_FUNCTION() virtual void Update(NetworkReplicationHierarchyUpdateResult* result);
+
+    /// <summary>
+    /// Iterates over all objects and adds them to the replication work for the specified clients.
+    /// </summary>
+    /// <param name="result">The update results container.</param>
+    /// <param name="targetClients">The clients to replicate objects to.</param>
+    /// <param name="cullClients">The clients to cull objects against their location (the other target clients receive all objects without distance checks).</param>
+    void UpdateObjects(NetworkReplicationHierarchyUpdateResult* result, const NetworkClientsMask& targetClients, const NetworkClientsMask& cullClients);
 };
 
 inline uint32 GetHash(const Int3& key)
@@ -232,6 +264,7 @@ inline uint32 GetHash(const Int3& key)
 
 /// <summary>
 /// Network replication hierarchy node with 3D grid spatialization. Organizes static objects into chunks to improve performance in large worlds.
+/// Caches cells relevancy for each client (updated only when client moves or grid changes) and subdivides dense cells into nested grids with smaller cells.
 /// </summary>
 API_CLASS(Namespace = "FlaxEngine.Networking") class FLAXENGINE_API NetworkReplicationGridNode : public NetworkReplicationNode
 {
@@ -242,11 +275,30 @@ API_CLASS(Namespace = "FlaxEngine.Networking") class FLAXENGINE_API NetworkRepli
     struct Cell
     {
         NetworkReplicationNode* Node;
+        bool IsGrid;
+        int32 ObjectsCount;
         float MinCullDistance;
+        float MaxCullDistance;
+        // Clients that can see any objects in this cell.
+        NetworkClientsMask TargetClients;
+        // Clients that can see only some objects in this cell (need to cull objects against client location).
+        NetworkClientsMask CullClients;
+    };
+
+    struct ClientRelevancy
+    {
+        uint32 ClientId;
+        uint32 CellsVersion;
+        bool HasLocation;
+        Vector3 Location;
     };
 
     Dictionary<Int3, Cell> _children;
     Dictionary<ScriptingObject*, Int3> _objectToCell;
+    Array<ClientRelevancy> _clientsRelevancy;
+    uint32 _cellsVersion = 1;
+
+    void UpdateClientRelevancy(int32 clientIndex, const ClientRelevancy& relevancy);
 
 public:
     /// <summary>
@@ -254,6 +306,21 @@ API_CLASS(Namespace = "FlaxEngine.Networking") class FLAXENGINE_API NetworkRepli
     /// </summary>
     API_FIELD() float CellSize = 10000.0f;
 
+    /// <summary>
+    /// The maximum amount of objects in a single grid cell. Dense cells get subdivided into a nested grid with smaller cells (down to MinCellSize). Use 0 to disable subdivision.
+    /// </summary>
+    API_FIELD() int32 MaxCellObjects = 256;
+
+    /// <summary>
+    /// The minimum size of the grid cell (in world units) used when subdividing dense cells.
+    /// </summary>
+    API_FIELD() float MinCellSize = 1000.0f;
+
+    /// <summary>
+    /// The distance (in world units) that client viewer can move before its cached cells relevancy gets updated. Higher values reduce relevancy updates but might replicate more objects near the culling range.
+    /// </summary>
+    API_FIELD() float RelevancyHysteresis = 500.0f;
+
     void AddObject(NetworkReplicationHierarchyObject obj) override;
     bool RemoveObject(ScriptingObject* obj) override;
     bool GetObject(ScriptingObject* obj, NetworkReplicationHierarchyObject& result) override;
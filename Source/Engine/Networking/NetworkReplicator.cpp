@@ -13,9 +13,12 @@
 #include "INetworkSerializable.h"
 #include "INetworkObject.h"
 #include "NetworkReplicationHierarchy.h"
+#include "NetworkTelemetry.h"
 #include "Engine/Core/Collections/HashSet.h"
+#include "Engine/Core/Collections/BitArray.h"
 #include "Engine/Core/Collections/Dictionary.h"
 #include "Engine/Core/Collections/ChunkedArray.h"
+#include "Engine/Core/Collections/Sorting.h"
 #include "Engine/Core/Types/DataContainer.h"
 #include "Engine/Platform/CriticalSection.h"
 #include "Engine/Engine/EngineService.h"
@@ -28,6 +31,7 @@
 #include "Engine/Scripting/Scripting.h"
 #include "Engine/Scripting/ScriptingObjectReference.h"
 #include "Engine/Threading/Threading.h"
+#include "Engine/Threading/JobSystem.h"
 #include "Engine/Threading/ThreadLocal.h"
 #if USE_EDITOR
 #include "FlaxEngine.Gen.h"
@@ -43,6 +47,8 @@ bool NetworkReplicator::EnableLog = false;
 #define NETWORK_REPLICATOR_LOG(messageType, format, ...)
 #endif
 
+int32 NetworkReplicator::ClientBandwidthLimit = 0;
+
 #if COMPILE_WITH_PROFILER
 bool NetworkInternal::EnableProfiling = false;
 Dictionary<Pair<ScriptingTypeHandle, StringAnsiView>, NetworkInternal::ProfilerEvent> NetworkInternal::ProfilerEvents;
@@ -52,9 +58,10 @@ PACK_STRUCT(struct NetworkMessageObjectReplicate
     {
     NetworkMessageIDs ID = NetworkMessageIDs::ObjectReplicate;
     uint32 OwnerFrame;
+    uint32 BaselineFrame; // Frame of the state acknowledged by the receiver that data is delta-encoded against (0 if data contains full state)
     Guid ObjectId; // TODO: introduce networked-ids to synchronize unique ids as ushort (less data over network)
     Guid ParentId;
-    char ObjectTypeName[128]; // TODO: introduce networked-name to synchronize unique names as ushort (less data over network)
+    uint16 ObjectTypeNameId;
     uint16 DataSize;
     uint16 PartsCount;
     });
@@ -92,7 +99,7 @@ PACK_STRUCT(struct NetworkMessageObjectSpawnItem
     Guid ObjectId;
     Guid ParentId;
     Guid PrefabObjectID;
-    char ObjectTypeName[128]; // TODO: introduce networked-name to synchronize unique names as ushort (less data over network)
+    uint16 ObjectTypeNameId;
     });
 
 PACK_STRUCT(struct NetworkMessageObjectDespawn
@@ -113,12 +120,41 @@ PACK_STRUCT(struct NetworkMessageObjectRpc
     NetworkMessageIDs ID = NetworkMessageIDs::ObjectRpc;
     Guid ObjectId;
     Guid ParentId;
-    char ObjectTypeName[128]; // TODO: introduce networked-name to synchronize unique names as ushort (less data over network)
-    char RpcTypeName[128]; // TODO: introduce networked-name to synchronize unique names as ushort (less data over network)
-    char RpcName[128]; // TODO: introduce networked-name to synchronize unique names as ushort (less data over network)
+    uint16 ObjectTypeNameId;
+    uint16 RpcNameId;
     uint16 ArgsSize;
     });
 
+// Network names (object types and RPCs) are sent as 16-bit ids assigned by the sender. Messages that use ids not yet acknowledged by the receiver are prefixed with this message containing names definitions, so they can be processed in any order (even over unreliable channels).
+PACK_STRUCT(struct NetworkMessageNames
+    {
+    NetworkMessageIDs ID = NetworkMessageIDs::Names;
+    uint8 Count; // Amount of names definitions that follow (each as: uint16 id, uint8 type name length, type name, uint8 rpc name length, rpc name)
+    });
+
+PACK_STRUCT(struct NetworkMessageNamesAck
+    {
+    NetworkMessageIDs ID = NetworkMessageIDs::NamesAck;
+    uint16 Count; // Amount of uint16 ids that follow
+    });
+
+PACK_STRUCT(struct NetworkMessageObjectReplicateAck
+    {
+    NetworkMessageIDs ID = NetworkMessageIDs::ObjectReplicateAck;
+    uint16 Count; // Amount of acknowledged states that follow (each as: Guid object id, uint32 owner frame, where frame 0 requests full state)
+    });
+
+// Amount of the replicated object states kept in history for delta-encoding (per object)
+#define NETWORK_REPLICATOR_SNAPSHOTS 16
+// Minimum amount of objects with async serialization per Job System worker
+#define NETWORK_REPLICATOR_ASYNC_MIN_OBJECTS 64
+
+struct NetworkReplicatedSnapshot
+{
+    uint32 Frame;
+    Array<byte> Data;
+};
+
 struct NetworkReplicatedObject
 {
     ScriptingObjectReference<ScriptingObject> Object;
@@ -129,13 +165,25 @@ struct NetworkReplicatedObject
     NetworkObjectRole Role;
     uint8 Spawned : 1;
     uint8 Synced : 1;
+    uint8 AsyncSerialization : 1;
     DataContainer<uint32> TargetClientIds;
     INetworkObject* AsNetworkObject;
+    // Serialized states sent by this peer (oldest first, new entry is added only when state changes)
+    Array<NetworkReplicatedSnapshot> SentSnapshots;
+    // Serialized states received by this peer (oldest first, entry per applied frame)
+    Array<NetworkReplicatedSnapshot> ReceivedSnapshots;
+    // Last sent frames acknowledged by the remote peers (per connection)
+    Dictionary<uint32, uint32> AckedFrames;
+    // Priority accumulated by the replication updates delayed due to bandwidth limit (per connection)
+    Dictionary<uint32, float> PriorityAccumulators;
+    float ReplicationPriority = 1.0f;
+    float ReplicationCullDistance = 0.0f;
 
     NetworkReplicatedObject()
     {
         Spawned = 0;
         Synced = 0;
+        AsyncSerialization = 0;
     }
 
     bool operator==(const NetworkReplicatedObject& other) const
@@ -176,10 +224,52 @@ struct ReplicateItem
     Guid ObjectId;
     uint16 PartsLeft;
     uint32 OwnerFrame;
+    uint32 BaselineFrame;
     uint32 OwnerClientId;
+    uint32 SenderKey;
     Array<byte> Data;
 };
 
+struct ReplicateGroup
+{
+    uint32 BaselineFrame;
+    Array<NetworkConnection, InlinedAllocation<8>> Targets;
+    Array<bool, InlinedAllocation<8>> Deferred;
+    Array<byte> Delta;
+};
+
+struct ReplicateJob
+{
+    NetworkReplicatedObject* Item;
+    ScriptingObject* Object;
+    float Priority;
+    float CullDistance;
+    double SerializeTime;
+    bool Async;
+    Array<NetworkConnection, InlinedAllocation<8>> Targets;
+    Array<ReplicateGroup, InlinedAllocation<2>> Groups;
+};
+
+struct ReplicateCandidate
+{
+    float Priority;
+    int32 Job;
+    int32 Group;
+    int32 Target;
+
+    bool operator<(const ReplicateCandidate& other) const
+    {
+        return Priority > other.Priority; // Sort from the highest priority
+    }
+};
+
+struct ClientBandwidthBudget
+{
+    double Bytes = 0.0;
+    double Time = 0.0;
+    uint32 Frame = 0;
+};
+
 struct SpawnItem
 {
     ScriptingObjectReference<ScriptingObject> Object;
@@ -192,13 +282,14 @@ struct SpawnItem
 
 struct SpawnItemParts
 {
+    uint32 SenderKey;
     NetworkMessageObjectSpawn MsgData;
     Array<NetworkMessageObjectSpawnItem> Items;
 };
 
 struct SpawnGroup
 {
-    Array<SpawnItem*, InlinedAllocation<8>> Items;
+    Array<SpawnItem*, InlinedAllocation<8, FrameAllocation>> Items;
 };
 
 struct DespawnItem
@@ -216,6 +307,20 @@ struct RpcItem
     DataContainer<uint32> Targets;
 };
 
+struct NetworkNameInfo
+{
+    ScriptingTypeHandle Type;
+    StringAnsiView RpcName;
+};
+
+struct NetworkReceivedName
+{
+    StringAnsi TypeName;
+    StringAnsi RpcName;
+    ScriptingTypeHandle Type;
+    bool Resolved = false;
+};
+
 namespace
 {
     CriticalSection ObjectsLock;
@@ -227,6 +332,15 @@ namespace
     Array<RpcItem> RpcQueue;
     Dictionary<Guid, Guid> IdsRemappingTable;
     NetworkStream* CachedWriteStream = nullptr;
+    Array<NetworkStream*> CachedWorkerStreams;
+    Array<ReplicateJob> ReplicateJobs;
+    Array<int32> ReplicateAsyncJobs;
+    // Replication bandwidth limits and budgets (per client id and per connection)
+    Dictionary<uint32, int32> ClientBandwidthLimits;
+    Dictionary<uint32, ClientBandwidthBudget> ClientBandwidthBudgets;
+    Dictionary<uint32, int32> CachedClientIndices;
+    Array<ReplicateCandidate> CachedReplicateCandidates;
+    HashSet<Guid> DeferredObjects;
     NetworkStream* CachedReadStream = nullptr;
     NetworkReplicationHierarchyUpdateResult* CachedReplicationResult = nullptr;
     NetworkReplicationHierarchy* Hierarchy = nullptr;
@@ -239,6 +353,19 @@ namespace
     Array<Guid> DespawnedObjects;
     uint32 SpawnId = 0;
 
+    // Network names interned by this peer (index is the id, 0 is invalid)
+    Array<NetworkNameInfo> NetworkNames;
+    Dictionary<ScriptingTypeHandle, uint16> NetworkTypeNameIds;
+    Dictionary<NetworkRpcName, uint16> NetworkRpcNameIds;
+    // Network names acknowledged by the remote peers (per connection)
+    Dictionary<uint32, BitArray<>> NetworkNamesAcked;
+    // Network names received from the remote peers (per connection, indexed by id)
+    Dictionary<uint32, Array<NetworkReceivedName>> NetworkNamesReceived;
+    Dictionary<uint32, Array<uint16>> NetworkNamesPendingAcks;
+    // Received object states to acknowledge to the remote peers (per connection, object id -> frame)
+    Dictionary<uint32, Dictionary<Guid, uint32>> ReplicatePendingAcks;
+    Array<byte> CachedDeltaData;
+
 #if USE_EDITOR
     void OnScriptsReloading()
     {
@@ -263,6 +390,27 @@ namespace
             if (i->Key.First.Module != flaxModule)
                 NetworkRpcInfo::RPCsTable.Remove(i);
         }
+        for (auto i = NetworkTypeNameIds.Begin(); i.IsNotEnd(); ++i)
+        {
+            if (i->Key.Module != flaxModule)
+            {
+                NetworkNames[i->Value] = NetworkNameInfo();
+                NetworkTypeNameIds.Remove(i);
+            }
+        }
+        for (auto i = NetworkRpcNameIds.Begin(); i.IsNotEnd(); ++i)
+        {
+            if (i->Key.First.Module != flaxModule)
+            {
+                NetworkNames[i->Value] = NetworkNameInfo();
+                NetworkRpcNameIds.Remove(i);
+            }
+        }
+        for (auto& e : NetworkNamesReceived)
+        {
+            for (auto& name : e.Value)
+                name.Resolved = false;
+        }
     }
 #endif
 }
@@ -333,7 +481,7 @@ NetworkReplicatedObject* ResolveObject(Guid objectId)
     return it != Objects.End() ? &it->Item : nullptr;
 }
 
-NetworkReplicatedObject* ResolveObject(Guid objectId, Guid parentId, const char objectTypeName[128])
+NetworkReplicatedObject* ResolveObject(Guid objectId, Guid parentId, const ScriptingTypeHandle& objectType)
 {
     // Lookup object
     NetworkReplicatedObject* obj = ResolveObject(objectId);
@@ -342,7 +490,6 @@ NetworkReplicatedObject* ResolveObject(Guid objectId, Guid parentId, const char
 
     // Try to find the object within the same parent (eg. spawned locally on both client and server)
     IdsRemappingTable.TryGet(parentId, parentId);
-    const ScriptingTypeHandle objectType = Scripting::FindScriptingType(StringAnsiView(objectTypeName));
     if (!objectType)
         return nullptr;
     for (auto& e : Objects)
@@ -467,13 +614,617 @@ FORCE_INLINE void BuildCachedTargets(const NetworkReplicatedObject& item, const
     BuildCachedTargets(NetworkManager::Clients, item.TargetClientIds, item.OwnerClientId, clientsMask);
 }
 
-FORCE_INLINE void GetNetworkName(char buffer[128], const StringAnsiView& name)
+// Gets the key of the remote peer used by the network names tables (client connection on server or the server on client)
+FORCE_INLINE uint32 GetNetworkNamesKey(const NetworkClient* client)
+{
+    return client ? client->Connection.ConnectionId : MAX_uint32;
+}
+
+uint16 AddNetworkName(const ScriptingTypeHandle& type, const StringAnsiView& rpcName)
+{
+    if (NetworkNames.IsEmpty())
+        NetworkNames.AddOne(); // Id 0 is invalid
+    ASSERT(NetworkNames.Count() < MAX_uint16);
+    const uint16 id = (uint16)NetworkNames.Count();
+    auto& e = NetworkNames.AddOne();
+    e.Type = type;
+    e.RpcName = rpcName;
+    return id;
+}
+
+uint16 GetNetworkNameId(const ScriptingTypeHandle& type)
+{
+    uint16 id;
+    if (!NetworkTypeNameIds.TryGet(type, id))
+    {
+        id = AddNetworkName(type, StringAnsiView::Empty);
+        NetworkTypeNameIds.Add(type, id);
+    }
+    return id;
+}
+
+uint16 GetNetworkNameId(const NetworkRpcName& name)
+{
+    uint16 id;
+    if (!NetworkRpcNameIds.TryGet(name, id))
+    {
+        id = AddNetworkName(name.First, name.Second);
+        NetworkRpcNameIds.Add(name, id);
+    }
+    return id;
+}
+
+bool IsNetworkNameAcked(uint32 key, uint16 id)
+{
+    const BitArray<>* acked = NetworkNamesAcked.TryGet(key);
+    return acked && id < acked->Count() && acked->Get(id);
+}
+
+NetworkReceivedName* GetNetworkReceivedName(uint32 key, uint16 id)
+{
+    auto* names = NetworkNamesReceived.TryGet(key);
+    if (!names || id >= names->Count())
+        return nullptr;
+    NetworkReceivedName& name = names->Get()[id];
+    if (!name.Resolved)
+    {
+        // Resolve the type once (instead of every message)
+        name.Resolved = true;
+        name.Type = Scripting::FindScriptingType(name.TypeName);
+    }
+    return &name;
+}
+
+FORCE_INLINE ScriptingTypeHandle GetNetworkReceivedType(uint32 key, uint16 id)
+{
+    const NetworkReceivedName* name = GetNetworkReceivedName(key, id);
+    return name ? name->Type : ScriptingTypeHandle();
+}
+
+FORCE_INLINE String GetNetworkReceivedTypeName(uint32 key, uint16 id)
+{
+    const NetworkReceivedName* name = GetNetworkReceivedName(key, id);
+    return name ? String(name->TypeName) : String::Format(TEXT("<{}>"), id);
+}
+
+// Collects the network names used by the message and writes definitions of the ones that are not yet known by the message receivers (server when running as client, otherwise CachedTargets)
+struct NetworkNamesWriter
+{
+    Array<uint16, InlinedAllocation<8>> Defs;
+    uint32 Size = 0;
+
+    FORCE_INLINE uint16 Add(const ScriptingTypeHandle& type)
+    {
+        return Add(GetNetworkNameId(type));
+    }
+
+    FORCE_INLINE uint16 Add(const NetworkRpcName& name)
+    {
+        return Add(GetNetworkNameId(name));
+    }
+
+    uint16 Add(uint16 id)
+    {
+        Size += GetAddSize(id);
+        if (NeedsDefinition(id))
+            Defs.Add(id);
+        return id;
+    }
+
+    // Gets the amount of bytes that adding the name will append to the message.
+    uint32 GetAddSize(uint16 id) const
+    {
+        if (!NeedsDefinition(id))
+            return 0;
+        const NetworkNameInfo& e = NetworkNames[id];
+        uint32 size = sizeof(uint16) + sizeof(uint8) + e.Type.GetType().Fullname.Length() + sizeof(uint8) + e.RpcName.Length();
+        if (Defs.IsEmpty())
+            size += sizeof(NetworkMessageNames);
+        return size;
+    }
+
+    void Write(NetworkMessage& msg) const
+    {
+        if (Defs.IsEmpty())
+            return;
+        ASSERT(Defs.Count() <= MAX_uint8);
+        NetworkMessageNames msgData;
+        msgData.Count = (uint8)Defs.Count();
+        msg.WriteStructure(msgData);
+        for (const uint16 id : Defs)
+        {
+            const NetworkNameInfo& e = NetworkNames[id];
+            msg.WriteUInt16(id);
+            WriteName(msg, e.Type.GetType().Fullname);
+            WriteName(msg, e.RpcName);
+        }
+    }
+
+private:
+    bool NeedsDefinition(uint16 id) const
+    {
+        if (Defs.Contains(id))
+            return false;
+        if (NetworkManager::IsClient())
+            return !IsNetworkNameAcked(MAX_uint32, id);
+        for (const NetworkConnection& target : CachedTargets)
+        {
+            if (!IsNetworkNameAcked(target.ConnectionId, id))
+                return true;
+        }
+        return false;
+    }
+
+    static void WriteName(NetworkMessage& msg, const StringAnsiView& name)
+    {
+        ASSERT(name.Length() <= MAX_uint8);
+        msg.WriteUInt8((uint8)name.Length());
+        msg.WriteBytes((uint8*)name.Get(), name.Length());
+    }
+};
+
+void ReadNetworkName(NetworkMessage& msg, StringAnsi& name)
+{
+    const uint8 length = msg.ReadUInt8();
+    name.Set((const char*)msg.SkipBytes(length), length);
+}
+
+void SendNetworkNamesAcks(NetworkPeer* peer, bool isClient)
 {
-    Platform::MemoryCopy(buffer, name.Get(), name.Length());
-    buffer[name.Length()] = 0;
+    for (const auto& e : NetworkNamesPendingAcks)
+    {
+        const Array<uint16>& ids = e.Value;
+        NetworkConnection target;
+        target.ConnectionId = e.Key;
+        int32 start = 0;
+        while (start < ids.Count())
+        {
+            NetworkMessage msg = peer->BeginSendMessage();
+            NetworkMessageNamesAck msgData;
+            msgData.Count = (uint16)Math::Min<uint32>(ids.Count() - start, (msg.BufferSize - sizeof(msgData)) / sizeof(uint16));
+            msg.WriteStructure(msgData);
+            msg.WriteBytes((uint8*)(ids.Get() + start), msgData.Count * sizeof(uint16));
+            start += msgData.Count;
+            if (isClient)
+                peer->EndSendMessage(NetworkChannelType::Reliable, msg);
+            else
+                peer->EndSendMessage(NetworkChannelType::Reliable, msg, target);
+        }
+    }
+    NetworkNamesPendingAcks.Clear();
 }
 
-void SetupObjectSpawnMessageItem(SpawnItem* e, NetworkMessage& msg)
+FORCE_INLINE void WriteDeltaVarUInt(Array<byte>& output, uint32 value)
+{
+    while (value >= 0x80)
+    {
+        output.Add((byte)(value | 0x80));
+        value >>= 7;
+    }
+    output.Add((byte)value);
+}
+
+FORCE_INLINE bool ReadDeltaVarUInt(const byte*& data, const byte* end, uint32& value)
+{
+    value = 0;
+    for (uint32 shift = 0; shift < 32 && data < end; shift += 7)
+    {
+        const byte b = *data++;
+        value |= (uint32)(b & 0x7f) << shift;
+        if ((b & 0x80) == 0)
+            return false;
+    }
+    return true;
+}
+
+FORCE_INLINE byte GetDeltaBaselineByte(const Array<byte>& baseline, uint32 index)
+{
+    return index < (uint32)baseline.Count() ? baseline.Get()[index] : 0;
+}
+
+// Encodes the object state as a delta against the baseline state (zero-extended): state size followed by the runs of unchanged bytes count, changed bytes count and the changed bytes.
+void EncodeReplicationDelta(const byte* data, uint32 size, const Array<byte>& baseline, Array<byte>& output)
+{
+    output.Clear();
+    WriteDeltaVarUInt(output, size);
+    uint32 start = 0;
+    while (start < size)
+    {
+        uint32 changedStart = start;
+        while (changedStart < size && data[changedStart] == GetDeltaBaselineByte(baseline, changedStart))
+            changedStart++;
+        if (changedStart == size)
+            break; // Rest of the data is unchanged
+        uint32 changedEnd = changedStart;
+        while (changedEnd < size)
+        {
+            if (data[changedEnd] != GetDeltaBaselineByte(baseline, changedEnd))
+            {
+                changedEnd++;
+                continue;
+            }
+
+            // Short unchanged runs are cheaper to include in the changed bytes than to start a new run
+            uint32 unchangedEnd = changedEnd;
+            while (unchangedEnd < size && data[unchangedEnd] == GetDeltaBaselineByte(baseline, unchangedEnd))
+                unchangedEnd++;
+            if (unchangedEnd == size || unchangedEnd - changedEnd > 2)
+                break;
+            changedEnd = unchangedEnd;
+        }
+        WriteDeltaVarUInt(output, changedStart - start);
+        WriteDeltaVarUInt(output, changedEnd - changedStart);
+        output.Add(data + changedStart, (int32)(changedEnd - changedStart));
+        start = changedEnd;
+    }
+}
+
+// Decodes the object state from the delta against the baseline state. Returns true if failed (eg. corrupted data).
+bool DecodeReplicationDelta(const byte* data, uint32 dataSize, const Array<byte>& baseline, Array<byte>& output)
+{
+    const byte* end = data + dataSize;
+    uint32 size;
+    if (ReadDeltaVarUInt(data, end, size) || size > MAX_uint16)
+        return true;
+    output.Resize((int32)size, false);
+    byte* dst = output.Get();
+    uint32 position = 0;
+    while (data < end)
+    {
+        uint32 unchanged, changed;
+        if (ReadDeltaVarUInt(data, end, unchanged) || ReadDeltaVarUInt(data, end, changed))
+            return true;
+        if (unchanged > size - position || changed > size - position - unchanged || changed > (uint32)(end - data))
+            return true;
+        for (const uint32 unchangedEnd = position + unchanged; position < unchangedEnd; position++)
+            dst[position] = GetDeltaBaselineByte(baseline, position);
+        Platform::MemoryCopy(dst + position, data, changed);
+        position += changed;
+        data += changed;
+    }
+    for (; position < size; position++)
+        dst[position] = GetDeltaBaselineByte(baseline, position);
+    return false;
+}
+
+// Gets the sent object state at the given frame (the latest snapshot taken at or before it) or null if it's no longer in the history.
+const NetworkReplicatedSnapshot* GetSentSnapshot(const NetworkReplicatedObject& item, uint32 frame)
+{
+    for (int32 i = item.SentSnapshots.Count() - 1; i >= 0; i--)
+    {
+        const NetworkReplicatedSnapshot& snapshot = item.SentSnapshots.Get()[i];
+        if (snapshot.Frame <= frame)
+            return &snapshot;
+    }
+    return nullptr;
+}
+
+const NetworkReplicatedSnapshot* GetReceivedSnapshot(const NetworkReplicatedObject& item, uint32 frame)
+{
+    for (const NetworkReplicatedSnapshot& snapshot : item.ReceivedSnapshots)
+    {
+        if (snapshot.Frame == frame)
+            return &snapshot;
+    }
+    return nullptr;
+}
+
+void AddSnapshot(Array<NetworkReplicatedSnapshot>& snapshots, uint32 frame, const byte* data, uint32 size)
+{
+    if (snapshots.Count() == NETWORK_REPLICATOR_SNAPSHOTS)
+        snapshots.RemoveAtKeepOrder(0);
+    NetworkReplicatedSnapshot& snapshot = snapshots.AddOne();
+    snapshot.Frame = frame;
+    snapshot.Data.Set(data, (int32)size);
+}
+
+// Invalidates delta-encoding state of the object (eg. on ownership change) so the next replication will use full state.
+void ResetObjectSnapshots(NetworkReplicatedObject& item)
+{
+    item.SentSnapshots.Clear();
+    item.ReceivedSnapshots.Clear();
+    item.AckedFrames.Clear();
+}
+
+void QueueObjectReplicateAck(const NetworkReplicatedObject& item, uint32 senderKey, uint32 frame)
+{
+    Guid objectId = item.ObjectId;
+    if (NetworkManager::IsClient())
+    {
+        // Remap local client object ids into server ids
+        IdsRemappingTable.KeyOf(objectId, &objectId);
+    }
+    ReplicatePendingAcks[senderKey][objectId] = frame;
+}
+
+void SendObjectReplicateAcks(NetworkPeer* peer, bool isClient)
+{
+    const uint32 itemSize = sizeof(Guid) + sizeof(uint32);
+    for (const auto& e : ReplicatePendingAcks)
+    {
+        NetworkConnection target;
+        target.ConnectionId = e.Key;
+        auto it = e.Value.Begin();
+        uint32 left = e.Value.Count();
+        while (left != 0)
+        {
+            NetworkMessage msg = peer->BeginSendMessage();
+            NetworkMessageObjectReplicateAck msgData;
+            msgData.Count = (uint16)Math::Min<uint32>(left, (msg.BufferSize - sizeof(msgData)) / itemSize);
+            msg.WriteStructure(msgData);
+            for (uint16 i = 0; i < msgData.Count; i++, ++it)
+            {
+                msg.WriteGuid(it->Key);
+                msg.WriteUInt32(it->Value);
+            }
+            left -= msgData.Count;
+            if (isClient)
+                peer->EndSendMessage(NetworkChannelType::Unreliable, msg);
+            else
+                peer->EndSendMessage(NetworkChannelType::Unreliable, msg, target);
+        }
+    }
+    ReplicatePendingAcks.Clear();
+}
+
+struct ReplicateTarget
+{
+    uint32 BaselineFrame;
+    NetworkConnection Connection;
+
+    bool operator<(const ReplicateTarget& other) const
+    {
+        return BaselineFrame < other.BaselineFrame;
+    }
+};
+
+void AddReplicateTarget(Array<ReplicateTarget, InlinedAllocation<8, FrameAllocation>>& targets, const NetworkReplicatedObject& item, const NetworkConnection& target, uint32 changedFrame)
+{
+    uint32 baselineFrame = 0;
+    const uint32* acked = item.AckedFrames.TryGet(target.ConnectionId);
+    if (acked && *acked != 0)
+    {
+        if (*acked >= changedFrame)
+            return; // Receiver already has the latest state
+        if (GetSentSnapshot(item, *acked))
+            baselineFrame = *acked;
+    }
+    auto& e = targets.AddOne();
+    e.BaselineFrame = baselineFrame;
+    e.Connection = target;
+}
+
+// Sends object state to the server when running as client, otherwise to CachedTargets (splits data into parts if needed).
+void SendObjectReplicateMessage(NetworkPeer* peer, bool isClient, const NetworkReplicatedObject& item, ScriptingObject* obj, uint32 baselineFrame, const byte* data, uint32 size, uint32& dataSize, uint32& messageSize)
+{
+    ASSERT(size <= MAX_uint16);
+    NetworkMessageObjectReplicate msgData;
+    msgData.OwnerFrame = NetworkManager::Frame;
+    msgData.BaselineFrame = baselineFrame;
+    msgData.ObjectId = item.ObjectId;
+    msgData.ParentId = item.ParentId;
+    if (isClient)
+    {
+        // Remap local client object ids into server ids
+        IdsRemappingTable.KeyOf(msgData.ObjectId, &msgData.ObjectId);
+        IdsRemappingTable.KeyOf(msgData.ParentId, &msgData.ParentId);
+    }
+    NetworkNamesWriter names;
+    msgData.ObjectTypeNameId = names.Add(obj->GetTypeHandle());
+    msgData.DataSize = size;
+    const uint32 msgMaxData = peer->Config.MessageSize - names.Size - sizeof(NetworkMessageObjectReplicate);
+    const uint32 partMaxData = peer->Config.MessageSize - sizeof(NetworkMessageObjectReplicatePart);
+    uint32 partsCount = 1;
+    uint32 dataStart = 0;
+    uint32 msgDataSize = size;
+    if (size > msgMaxData)
+    {
+        // Send msgMaxData within first message
+        msgDataSize = msgMaxData;
+        dataStart += msgMaxData;
+
+        // Send rest of the data in separate parts
+        partsCount += Math::DivideAndRoundUp(size - dataStart, partMaxData);
+    }
+    else
+        dataStart += size;
+    ASSERT(partsCount <= MAX_uint8);
+    msgData.PartsCount = partsCount;
+    NetworkMessage msg = peer->BeginSendMessage();
+    names.Write(msg);
+    msg.WriteStructure(msgData);
+    msg.WriteBytes((uint8*)data, msgDataSize);
+    dataSize += msgDataSize;
+    messageSize += msg.Length;
+    if (isClient)
+        peer->EndSendMessage(NetworkChannelType::Unreliable, msg);
+    else
+        peer->EndSendMessage(NetworkChannelType::Unreliable, msg, CachedTargets);
+
+    // Send all other parts
+    for (uint32 partIndex = 1; partIndex < partsCount; partIndex++)
+    {
+        NetworkMessageObjectReplicatePart msgDataPart;
+        msgDataPart.OwnerFrame = msgData.OwnerFrame;
+        msgDataPart.ObjectId = msgData.ObjectId;
+        msgDataPart.DataSize = msgData.DataSize;
+        msgDataPart.PartsCount = msgData.PartsCount;
+        msgDataPart.PartStart = dataStart;
+        msgDataPart.PartSize = Math::Min(size - dataStart, partMaxData);
+        msg = peer->BeginSendMessage();
+        msg.WriteStructure(msgDataPart);
+        msg.WriteBytes((uint8*)data + msgDataPart.PartStart, msgDataPart.PartSize);
+        messageSize += msg.Length;
+        dataSize += msgDataPart.PartSize;
+        dataStart += msgDataPart.PartSize;
+        if (isClient)
+            peer->EndSendMessage(NetworkChannelType::Unreliable, msg);
+        else
+            peer->EndSendMessage(NetworkChannelType::Unreliable, msg, CachedTargets);
+    }
+    ASSERT_LOW_LAYER(dataStart == size);
+}
+
+// Serializes the object and prepares the data to send for each group of receivers (runs on Job System worker for objects with async serialization).
+void SerializeReplicateJob(ReplicateJob& job, NetworkStream* stream)
+{
+    NetworkReplicatedObject& item = *job.Item;
+    ScriptingObject* obj = job.Object;
+    const double startTime = NetworkTelemetry::Enabled ? Platform::GetTimeSeconds() : 0.0;
+    if (item.AsNetworkObject)
+        item.AsNetworkObject->OnNetworkSerialize();
+
+    // Serialize object
+    stream->Initialize();
+    const bool failed = NetworkReplicator::InvokeSerializer(obj->GetTypeHandle(), obj, stream, true);
+    if (NetworkTelemetry::Enabled)
+        job.SerializeTime = Platform::GetTimeSeconds() - startTime;
+    if (failed)
+    {
+        //NETWORK_REPLICATOR_LOG(Error, "[NetworkReplicator] Cannot serialize object {} of type {} (missing serialization logic)", item.ToString(), obj->GetType().ToString());
+        return;
+    }
+
+    // Store state in the history for delta-encoding (unchanged state reuses the latest snapshot)
+    const uint32 size = stream->GetPosition();
+    ASSERT(size <= MAX_uint16);
+    const byte* data = stream->GetBuffer();
+    auto& snapshots = item.SentSnapshots;
+    if (snapshots.IsEmpty() || snapshots.Last().Data.Count() != size || Platform::MemoryCompare(snapshots.Last().Data.Get(), data, size) != 0)
+    {
+        if (snapshots.HasItems() && snapshots.Last().Frame == NetworkManager::Frame)
+            snapshots.Last().Data.Set(data, (int32)size);
+        else
+            AddSnapshot(snapshots, NetworkManager::Frame, data, size);
+    }
+    const uint32 changedFrame = snapshots.Last().Frame;
+
+    // Group receivers by the last acknowledged state (skip the ones that already have the latest state)
+    Array<ReplicateTarget, InlinedAllocation<8, FrameAllocation>> targets;
+    for (const NetworkConnection& target : job.Targets)
+        AddReplicateTarget(targets, item, target, changedFrame);
+    Sorting::QuickSort(targets.Get(), targets.Count());
+    for (int32 groupStart = 0; groupStart < targets.Count();)
+    {
+        ReplicateGroup& group = job.Groups.AddOne();
+        group.BaselineFrame = targets[groupStart].BaselineFrame;
+        for (; groupStart < targets.Count() && targets[groupStart].BaselineFrame == group.BaselineFrame; groupStart++)
+            group.Targets.Add(targets[groupStart].Connection);
+        if (group.BaselineFrame != 0)
+        {
+            // Use delta only if it's smaller than the full state
+            EncodeReplicationDelta(data, size, GetSentSnapshot(item, group.BaselineFrame)->Data, group.Delta);
+            if ((uint32)group.Delta.Count() >= size)
+                group.BaselineFrame = 0;
+        }
+    }
+}
+
+FORCE_INLINE int32 GetClientBandwidthLimit(uint32 clientId)
+{
+    const int32* limit = ClientBandwidthLimits.TryGet(clientId);
+    return limit ? *limit : NetworkReplicator::ClientBandwidthLimit;
+}
+
+void BuildCachedClientIndices()
+{
+    CachedClientIndices.Clear();
+    for (int32 i = 0; i < NetworkManager::Clients.Count(); i++)
+        CachedClientIndices[NetworkManager::Clients[i]->Connection.ConnectionId] = i;
+}
+
+// Gets the replication budget (in bytes) of the connection refilled for the current update.
+ClientBandwidthBudget& GetClientBandwidthBudget(uint32 key, int32 limit, double time)
+{
+    ClientBandwidthBudget& budget = ClientBandwidthBudgets[key];
+    if (budget.Frame != NetworkManager::Frame)
+    {
+        // Refill budget for the time elapsed since the last update (allow small bursts)
+        const double burst = limit * 0.1;
+        const double refill = budget.Time > 0.0 ? limit * (time - budget.Time) : burst;
+        budget.Bytes = Math::Min(budget.Bytes + refill, Math::Max(refill, burst));
+        budget.Time = time;
+        budget.Frame = NetworkManager::Frame;
+    }
+    return budget;
+}
+
+// Selects the replication updates to send to the clients with limited bandwidth. Updates are sent from the highest priority (importance scaled by the distance from the client and accumulated over time when delayed) until the client budget is used, the rest gets delayed.
+void ApplyReplicationBudget(NetworkReplicationHierarchyUpdateResult* result, int32 jobsCount, bool isClient)
+{
+    PROFILE_CPU();
+    const double time = Platform::GetTimeSeconds();
+    auto& candidates = CachedReplicateCandidates;
+    candidates.Clear();
+    for (int32 jobIndex = 0; jobIndex < jobsCount; jobIndex++)
+    {
+        ReplicateJob& job = ReplicateJobs[jobIndex];
+        const Actor* actor = job.CullDistance > 0.0f && !isClient ? NetworkReplicationHierarchyObject::GetActor(job.Object) : nullptr;
+        for (int32 groupIndex = 0; groupIndex < job.Groups.Count(); groupIndex++)
+        {
+            ReplicateGroup& group = job.Groups[groupIndex];
+            group.Deferred.Resize(group.Targets.Count());
+            for (int32 targetIndex = 0; targetIndex < group.Targets.Count(); targetIndex++)
+            {
+                group.Deferred[targetIndex] = false;
+                const uint32 key = group.Targets[targetIndex].ConnectionId;
+                int32 clientIndex = -1;
+                uint32 clientId = NetworkManager::ServerClientId;
+                if (!isClient)
+                {
+                    if (!CachedClientIndices.TryGet(key, clientIndex))
+                        continue;
+                    clientId = NetworkManager::Clients[clientIndex]->ClientId;
+                }
+                if (GetClientBandwidthLimit(clientId) <= 0)
+                    continue;
+
+                // Scale down priority of the objects far away from the viewer
+                float priority = job.Priority;
+                Vector3 clientLocation;
+                if (actor && result->GetClientLocation(clientIndex, clientLocation))
+                {
+                    const float distance = (float)Vector3::Distance(actor->GetPosition(), clientLocation);
+                    priority *= Math::Lerp(1.0f, 0.1f, Math::Saturate(distance / job.CullDistance));
+                }
+                if (const float* accumulated = job.Item->PriorityAccumulators.TryGet(key))
+                    priority += *accumulated;
+
+                auto& candidate = candidates.AddOne();
+                candidate.Priority = priority;
+                candidate.Job = jobIndex;
+                candidate.Group = groupIndex;
+                candidate.Target = targetIndex;
+            }
+        }
+    }
+    Sorting::QuickSort(candidates.Get(), candidates.Count());
+
+    for (const ReplicateCandidate& candidate : candidates)
+    {
+        ReplicateJob& job = ReplicateJobs[candidate.Job];
+        ReplicateGroup& group = job.Groups[candidate.Group];
+        const uint32 key = group.Targets[candidate.Target].ConnectionId;
+        const uint32 clientId = isClient ? NetworkManager::ServerClientId : NetworkManager::Clients[CachedClientIndices[key]]->ClientId;
+        ClientBandwidthBudget& budget = GetClientBandwidthBudget(key, GetClientBandwidthLimit(clientId), time);
+        if (budget.Bytes > 0.0)
+        {
+            // Send (budget can go below zero to not block large updates, it will be paid off in the next updates)
+            const int32 dataSize = group.BaselineFrame != 0 ? group.Delta.Count() : job.Item->SentSnapshots.Last().Data.Count();
+            budget.Bytes -= dataSize + sizeof(NetworkMessageObjectReplicate);
+            job.Item->PriorityAccumulators.Remove(key);
+        }
+        else
+        {
+            // Delay to the next update
+            group.Deferred[candidate.Target] = true;
+            job.Item->PriorityAccumulators[key] = candidate.Priority;
+            DeferredObjects.Add(job.Item->ObjectId);
+        }
+    }
+}
+
+void SetupObjectSpawnMessageItem(SpawnItem* e, NetworkMessage& msg, NetworkNamesWriter& names)
 {
     ScriptingObject* obj = e->Object.Get();
     auto it = Objects.Find(obj->GetID());
@@ -493,7 +1244,7 @@ void SetupObjectSpawnMessageItem(SpawnItem* e, NetworkMessage& msg)
     auto* objScene = ScriptingObject::Cast<SceneObject>(obj);
     if (objScene && objScene->HasPrefabLink())
         msgDataItem.PrefabObjectID = objScene->GetPrefabObjectID();
-    GetNetworkName(msgDataItem.ObjectTypeName, obj->GetType().Fullname);
+    msgDataItem.ObjectTypeNameId = names.Add(obj->GetTypeHandle());
     msg.WriteStructure(msgDataItem);
 }
 
@@ -502,7 +1253,6 @@ void SendObjectSpawnMessage(const SpawnGroup& group, const Array<NetworkClient*>
     PROFILE_CPU();
     const bool isClient = NetworkManager::IsClient();
     auto* peer = NetworkManager::Peer;
-    NetworkMessage msg = peer->BeginSendMessage();
     NetworkMessageObjectSpawn msgData;
     msgData.ItemsCount = group.Items.Count();
     {
@@ -520,8 +1270,14 @@ void SendObjectSpawnMessage(const SpawnGroup& group, const Array<NetworkClient*>
     }
 
     // Network Peer has fixed size of messages so split spawn message into parts if there are too many objects to fit at once
+    NetworkNamesWriter names;
+    for (SpawnItem* e : group.Items)
+        names.Add(e->Object->GetTypeHandle());
+    NetworkMessage msg = peer->BeginSendMessage();
     msgData.OwnerSpawnId = ++SpawnId;
-    msgData.UseParts = msg.BufferSize - msg.Position < group.Items.Count() * sizeof(NetworkMessageObjectSpawnItem);
+    msgData.UseParts = msg.BufferSize - msg.Position < names.Size + sizeof(NetworkMessageObjectSpawn) + group.Items.Count() * sizeof(NetworkMessageObjectSpawnItem);
+    if (!msgData.UseParts)
+        names.Write(msg);
     msg.WriteStructure(msgData);
     if (msgData.UseParts)
     {
@@ -538,15 +1294,28 @@ void SendObjectSpawnMessage(const SpawnGroup& group, const Array<NetworkClient*>
         constexpr uint32 spawnItemMaxSize = sizeof(uint16) + sizeof(NetworkMessageObjectSpawnItem); // Index + Data
         while (itemIndex < msgData.ItemsCount)
         {
+            // Collect as many items as possible into this message (including names definitions of their types)
+            NetworkNamesWriter partNames;
+            uint32 partSize = sizeof(NetworkMessageObjectSpawnPart);
+            uint16 itemsEnd = itemIndex;
+            while (itemsEnd < msgData.ItemsCount)
+            {
+                const uint16 nameId = GetNetworkNameId(group.Items[itemsEnd]->Object->GetTypeHandle());
+                const uint32 itemSize = spawnItemMaxSize + partNames.GetAddSize(nameId);
+                if (partSize + partNames.Size + itemSize > peer->Config.MessageSize && itemsEnd != itemIndex)
+                    break;
+                partNames.Add(nameId);
+                partSize += spawnItemMaxSize;
+                itemsEnd++;
+            }
+
             msg = peer->BeginSendMessage();
+            partNames.Write(msg);
             msg.WriteStructure(msgDataPart);
-
-            // Write as many items as possible into this message
-            while (msg.Position + spawnItemMaxSize <= msg.BufferSize && itemIndex < msgData.ItemsCount)
+            for (; itemIndex < itemsEnd; itemIndex++)
             {
                 msg.WriteUInt16(itemIndex);
-                SetupObjectSpawnMessageItem(group.Items[itemIndex], msg);
-                itemIndex++;
+                SetupObjectSpawnMessageItem(group.Items[itemIndex], msg, partNames);
             }
 
             if (isClient)
@@ -559,7 +1328,7 @@ void SendObjectSpawnMessage(const SpawnGroup& group, const Array<NetworkClient*>
     {
         // Send all spawn items within the spawn message
         for (SpawnItem* e : group.Items)
-            SetupObjectSpawnMessageItem(e, msg);
+            SetupObjectSpawnMessageItem(e, msg, names);
         if (isClient)
             peer->EndSendMessage(NetworkChannelType::Reliable, msg);
         else
@@ -621,7 +1390,7 @@ SceneObject* FindPrefabObject(Actor* a, const Guid& prefabObjectId)
     return result;
 }
 
-void SetupObjectSpawnGroupItem(ScriptingObject* obj, Array<SpawnGroup, InlinedAllocation<8>>& spawnGroups, SpawnItem& spawnItem)
+void SetupObjectSpawnGroupItem(ScriptingObject* obj, Array<SpawnGroup, InlinedAllocation<8, FrameAllocation>>& spawnGroups, SpawnItem& spawnItem)
 {
     // Check if can fit this object into any of the existing groups (eg. script which can be spawned with parent actor)
     SpawnGroup* group = nullptr;
@@ -696,7 +1465,7 @@ FORCE_INLINE void DirtyObjectImpl(NetworkReplicatedObject& item, ScriptingObject
 }
 
 template<typename MessageType>
-ReplicateItem* AddObjectReplicateItem(NetworkEvent& event, const MessageType& msgData, uint16 partStart, uint16 partSize, uint32 senderClientId)
+ReplicateItem* AddObjectReplicateItem(NetworkEvent& event, const MessageType& msgData, uint16 partStart, uint16 partSize, uint32 senderClientId, uint32 senderKey)
 {
     // Reuse or add part item
     ReplicateItem* replicateItem = nullptr;
@@ -716,7 +1485,9 @@ ReplicateItem* AddObjectReplicateItem(NetworkEvent& event, const MessageType& ms
         replicateItem->ObjectId = msgData.ObjectId;
         replicateItem->PartsLeft = msgData.PartsCount;
         replicateItem->OwnerFrame = msgData.OwnerFrame;
+        replicateItem->BaselineFrame = 0;
         replicateItem->OwnerClientId = senderClientId;
+        replicateItem->SenderKey = senderKey;
         replicateItem->Data.Resize(msgData.DataSize);
     }
 
@@ -730,7 +1501,7 @@ ReplicateItem* AddObjectReplicateItem(NetworkEvent& event, const MessageType& ms
     return replicateItem;
 }
 
-void InvokeObjectReplication(NetworkReplicatedObject& item, uint32 ownerFrame, byte* data, uint32 dataSize, uint32 senderClientId)
+void InvokeObjectReplication(NetworkReplicatedObject& item, uint32 ownerFrame, uint32 baselineFrame, byte* data, uint32 dataSize, uint32 senderClientId, uint32 senderKey)
 {
     ScriptingObject* obj = item.Object.Get();
     if (!obj)
@@ -743,7 +1514,24 @@ void InvokeObjectReplication(NetworkReplicatedObject& item, uint32 ownerFrame, b
     // Drop object replication if it has old data (eg. newer message was already processed due to unordered channel usage)
     if (item.LastOwnerFrame >= ownerFrame)
         return;
+
+    // Reconstruct full state from the delta against the acknowledged state
+    if (baselineFrame != 0)
+    {
+        const NetworkReplicatedSnapshot* baseline = GetReceivedSnapshot(item, baselineFrame);
+        if (!baseline || DecodeReplicationDelta(data, dataSize, baseline->Data, CachedDeltaData))
+        {
+            // Request full state (eg. baseline got lost after ownership change)
+            NETWORK_REPLICATOR_LOG(Warning, "[NetworkReplicator] Missing baseline frame {} for object {}", baselineFrame, item.ToString());
+            QueueObjectReplicateAck(item, senderKey, 0);
+            return;
+        }
+        data = CachedDeltaData.Get();
+        dataSize = CachedDeltaData.Count();
+    }
     item.LastOwnerFrame = ownerFrame;
+    AddSnapshot(item.ReceivedSnapshots, ownerFrame, data, dataSize);
+    QueueObjectReplicateAck(item, senderKey, ownerFrame);
 
     // Setup message reading stream
     if (CachedReadStream == nullptr)
@@ -753,6 +1541,7 @@ void InvokeObjectReplication(NetworkReplicatedObject& item, uint32 ownerFrame, b
     stream->SenderId = senderClientId;
 
     // Deserialize object
+    const double startTime = NetworkTelemetry::Enabled ? Platform::GetTimeSeconds() : 0.0;
     Scripting::ObjectsLookupIdMapping.Set(&IdsRemappingTable);
     const bool failed = NetworkReplicator::InvokeSerializer(obj->GetTypeHandle(), obj, stream, false);
     if (failed)
@@ -769,26 +1558,28 @@ void InvokeObjectReplication(NetworkReplicatedObject& item, uint32 ownerFrame, b
             item.AsNetworkObject->OnNetworkSync();
         }
     }
+    if (NetworkTelemetry::Enabled)
+        NetworkTelemetry::OnReceive(obj->GetTypeHandle(), StringAnsiView::Empty, dataSize, Platform::GetTimeSeconds() - startTime);
 
     // Speed up replication of client-owned objects to other clients from server to reduce lag (data has to go from client to server and then to other clients)
     if (NetworkManager::IsServer())
         DirtyObjectImpl(item, obj);
 }
 
-void InvokeObjectSpawn(const NetworkMessageObjectSpawn& msgData, const NetworkMessageObjectSpawnItem* msgDataItems)
+void InvokeObjectSpawn(const NetworkMessageObjectSpawn& msgData, const NetworkMessageObjectSpawnItem* msgDataItems, uint32 senderKey)
 {
     ScopeLock lock(ObjectsLock);
 
     // Check if that object has been already spawned
     auto& rootItem = msgDataItems[0];
-    NetworkReplicatedObject* root = ResolveObject(rootItem.ObjectId, rootItem.ParentId, rootItem.ObjectTypeName);
+    NetworkReplicatedObject* root = ResolveObject(rootItem.ObjectId, rootItem.ParentId, GetNetworkReceivedType(senderKey, rootItem.ObjectTypeNameId));
     if (root)
     {
         // Object already exists locally so just synchronize the ownership (and mark as spawned)
         for (int32 i = 0; i < msgData.ItemsCount; i++)
         {
             auto& msgDataItem = msgDataItems[i];
-            NetworkReplicatedObject* e = ResolveObject(msgDataItem.ObjectId, msgDataItem.ParentId, msgDataItem.ObjectTypeName);
+            NetworkReplicatedObject* e = ResolveObject(msgDataItem.ObjectId, msgDataItem.ParentId, GetNetworkReceivedType(senderKey, msgDataItem.ObjectTypeNameId));
             auto& item = *e;
             item.Spawned = true;
             if (NetworkManager::IsClient())
@@ -874,7 +1665,7 @@ void InvokeObjectSpawn(const NetworkMessageObjectSpawn& msgData, const NetworkMe
             if (!obj)
             {
                 NETWORK_REPLICATOR_LOG(Error, "[NetworkReplicator] Failed to find object {} in prefab {}", msgDataItem.PrefabObjectID.ToString(), msgData.PrefabId.ToString());
-                Delete(prefabInstance);
+                ScriptingObjectsPool::Delete(prefabInstance);
                 return;
             }
             objects[i] = obj;
@@ -883,11 +1674,11 @@ void InvokeObjectSpawn(const NetworkMessageObjectSpawn& msgData, const NetworkMe
     else if (msgData.ItemsCount == 1)
     {
         // Spawn object
-        const ScriptingTypeHandle objectType = Scripting::FindScriptingType(rootItem.ObjectTypeName);
+        const ScriptingTypeHandle objectType = GetNetworkReceivedType(senderKey, rootItem.ObjectTypeNameId);
         ScriptingObject* obj = ScriptingObject::NewObject(objectType);
         if (!obj)
         {
-            NETWORK_REPLICATOR_LOG(Error, "[NetworkReplicator] Failed to spawn object type {}", String(rootItem.ObjectTypeName));
+            NETWORK_REPLICATOR_LOG(Error, "[NetworkReplicator] Failed to spawn object type {}", GetNetworkReceivedTypeName(senderKey, rootItem.ObjectTypeNameId));
             return;
         }
         objects.Add(obj);
@@ -899,11 +1690,11 @@ void InvokeObjectSpawn(const NetworkMessageObjectSpawn& msgData, const NetworkMe
         for (int32 i = 0; i < msgData.ItemsCount; i++)
         {
             auto& msgDataItem = msgDataItems[i];
-            const ScriptingTypeHandle objectType = Scripting::FindScriptingType(msgDataItem.ObjectTypeName);
+            const ScriptingTypeHandle objectType = GetNetworkReceivedType(senderKey, msgDataItem.ObjectTypeNameId);
             ScriptingObject* obj = ScriptingObject::NewObject(objectType);
             if (!obj)
             {
-                NETWORK_REPLICATOR_LOG(Error, "[NetworkReplicator] Failed to spawn object type {}", String(msgDataItem.ObjectTypeName));
+                NETWORK_REPLICATOR_LOG(Error, "[NetworkReplicator] Failed to spawn object type {}", GetNetworkReceivedTypeName(senderKey, msgDataItem.ObjectTypeNameId));
                 for (ScriptingObject* e : objects)
                     Delete(e);
                 return;
@@ -1441,6 +2232,7 @@ void NetworkReplicator::SetObjectOwnership(ScriptingObject* obj, uint32 ownerCli
                 item.OwnerClientId = ownerClientId;
                 item.LastOwnerFrame = 1;
                 item.Role = localRole;
+                ResetObjectSnapshots(item);
                 SendObjectRoleMessage(item);
             }
         }
@@ -1489,6 +2281,27 @@ void NetworkReplicator::DirtyObject(ScriptingObject* obj)
     DirtyObjectImpl(item, obj);
 }
 
+void NetworkReplicator::SetClientBandwidthLimit(uint32 clientId, int32 bytesPerSecond)
+{
+    ScopeLock lock(ObjectsLock);
+    if (bytesPerSecond < 0)
+        ClientBandwidthLimits.Remove(clientId);
+    else
+        ClientBandwidthLimits[clientId] = bytesPerSecond;
+}
+
+void NetworkReplicator::SetObjectAsyncSerialization(ScriptingObject* obj, bool value)
+{
+    ScopeLock lock(ObjectsLock);
+    const auto it = Objects.Find(obj->GetID());
+    if (it == Objects.End())
+        return;
+    auto& item = it->Item;
+    if (item.Object != obj)
+        return;
+    item.AsyncSerialization = value;
+}
+
 Dictionary<NetworkRpcName, NetworkRpcInfo> NetworkRpcInfo::RPCsTable;
 
 NetworkStream* NetworkReplicator::BeginInvokeRPC()
@@ -1539,12 +2352,22 @@ void NetworkInternal::NetworkReplicatorClientDisconnected(NetworkClient* client)
 {
     ScopeLock lock(ObjectsLock);
     NewClients.Remove(client);
+    const uint32 namesKey = GetNetworkNamesKey(client);
+    NetworkNamesAcked.Remove(namesKey);
+    NetworkNamesReceived.Remove(namesKey);
+    NetworkNamesPendingAcks.Remove(namesKey);
+    ReplicatePendingAcks.Remove(namesKey);
+    ClientBandwidthBudgets.Remove(namesKey);
+    ClientBandwidthLimits.Remove(client->ClientId);
+    NetworkTelemetry::OnClientDisconnected(namesKey);
 
     // Remove any objects owned by that client
     const uint32 clientId = client->ClientId;
     for (auto it = Objects.Begin(); it.IsNotEnd(); ++it)
     {
         auto& item = it->Item;
+        item.AckedFrames.Remove(namesKey);
+        item.PriorityAccumulators.Remove(namesKey);
         ScriptingObject* obj = item.Object.Get();
         if (obj && item.Spawned && item.OwnerClientId == clientId)
         {
@@ -1591,11 +2414,29 @@ void NetworkInternal::NetworkReplicatorClear()
     DespawnQueue.Clear();
     IdsRemappingTable.Clear();
     SAFE_DELETE(CachedWriteStream);
+    for (NetworkStream* e : CachedWorkerStreams)
+        Delete(e);
+    CachedWorkerStreams.Clear();
+    ReplicateJobs.Clear();
+    ReplicateAsyncJobs.Clear();
+    ClientBandwidthLimits.Clear();
+    ClientBandwidthBudgets.Clear();
+    CachedClientIndices.Clear();
+    CachedReplicateCandidates.Clear();
+    DeferredObjects.Clear();
     SAFE_DELETE(CachedReadStream);
     SAFE_DELETE(CachedReplicationResult);
     NewClients.Clear();
     CachedTargets.Clear();
     DespawnedObjects.Clear();
+    NetworkNames.Clear();
+    NetworkTypeNameIds.Clear();
+    NetworkRpcNameIds.Clear();
+    NetworkNamesAcked.Clear();
+    NetworkNamesReceived.Clear();
+    NetworkNamesPendingAcks.Clear();
+    ReplicatePendingAcks.Clear();
+    CachedDeltaData.Resize(0);
 }
 
 void NetworkInternal::NetworkReplicatorPreUpdate()
@@ -1608,6 +2449,10 @@ void NetworkInternal::NetworkReplicatorUpdate()
 {
     PROFILE_CPU();
     ScopeLock lock(ObjectsLock);
+    if (NetworkNamesPendingAcks.HasItems())
+        SendNetworkNamesAcks(NetworkManager::Peer, NetworkManager::IsClient());
+    if (ReplicatePendingAcks.HasItems())
+        SendObjectReplicateAcks(NetworkManager::Peer, NetworkManager::IsClient());
     if (Objects.Count() == 0)
         return;
     const bool isClient = NetworkManager::IsClient();
@@ -1621,7 +2466,7 @@ void NetworkInternal::NetworkReplicatorUpdate()
         PROFILE_CPU_NAMED("NewClients");
         // TODO: try iterative loop over several frames to reduce both server and client perf-spikes in case of large amount of spawned objects
         ChunkedArray<SpawnItem, 256> spawnItems;
-        Array<SpawnGroup, InlinedAllocation<8>> spawnGroups;
+        Array<SpawnGroup, InlinedAllocation<8, FrameAllocation>> spawnGroups;
         for (auto it = Objects.Begin(); it.IsNotEnd(); ++it)
         {
             auto& item = it->Item;
@@ -1700,7 +2545,7 @@ void NetworkInternal::NetworkReplicatorUpdate()
 
         // Batch spawned objects into groups (eg. player actor with scripts and child actors merged as a single spawn message)
         // That's because NetworkReplicator::SpawnObject can be called in separate for different actors/scripts of a single prefab instance but we want to spawn it at once over the network
-        Array<SpawnGroup, InlinedAllocation<8>> spawnGroups;
+        Array<SpawnGroup, InlinedAllocation<8, FrameAllocation>> spawnGroups;
         for (SpawnItem& e : SpawnQueue)
         {
             ScriptingObject* obj = e.Object.Get();
@@ -1781,7 +2626,7 @@ void NetworkInternal::NetworkReplicatorUpdate()
                     auto& item = it->Item;
 
                     // Replicate from all collected parts data
-                    InvokeObjectReplication(item, e.OwnerFrame, e.Data.Get(), e.Data.Count(), e.OwnerClientId);
+                    InvokeObjectReplication(item, e.OwnerFrame, e.BaselineFrame, e.Data.Get(), e.Data.Count(), e.OwnerClientId, e.SenderKey);
                 }
             }
 
@@ -1825,14 +2670,64 @@ void NetworkInternal::NetworkReplicatorUpdate()
             CachedReplicationResult->AddObject(obj);
         }
     }
+    const bool useBandwidthLimit = ClientBandwidthLimit > 0 || ClientBandwidthLimits.HasItems();
+    if (!isClient && (useBandwidthLimit || DeferredObjects.HasItems()))
+        BuildCachedClientIndices();
+    if (DeferredObjects.HasItems())
+    {
+        // Add replication updates delayed due to bandwidth limit (merged with the objects already selected for this update)
+        PROFILE_CPU_NAMED("ReplicationDeferred");
+        auto& entries = CachedReplicationResult->_entries;
+        Dictionary<ScriptingObject*, int32> entriesLookup;
+        for (int32 i = 0; i < entries.Count(); i++)
+            entriesLookup[entries[i].Object] = i;
+        for (auto it = DeferredObjects.Begin(); it.IsNotEnd(); ++it)
+        {
+            auto objectIt = Objects.Find(it->Item);
+            ScriptingObject* obj = objectIt.IsEnd() ? nullptr : objectIt->Item.Object.Get();
+            if (!obj || objectIt->Item.PriorityAccumulators.IsEmpty())
+            {
+                DeferredObjects.Remove(it);
+                continue;
+            }
+            auto& item = objectIt->Item;
+            NetworkClientsMask targetClients = isClient ? NetworkClientsMask::All : NetworkClientsMask();
+            if (!isClient)
+            {
+                for (const auto& e : item.PriorityAccumulators)
+                {
+                    int32 clientIndex;
+                    if (CachedClientIndices.TryGet(e.Key, clientIndex))
+                        targetClients.SetBit(clientIndex);
+                }
+            }
+            int32 entryIndex;
+            if (entriesLookup.TryGet(obj, entryIndex))
+            {
+                auto& entry = entries[entryIndex];
+                entry.TargetClients.Word0 |= targetClients.Word0;
+                entry.TargetClients.Word1 |= targetClients.Word1;
+            }
+            else if (targetClients)
+            {
+                CachedReplicationResult->AddObject(obj, targetClients, item.ReplicationPriority, item.ReplicationCullDistance);
+            }
+        }
+    }
+    NetworkTelemetry::ReplicatedObjects = 0;
+    NetworkTelemetry::DeferredObjects = 0;
     if (CachedReplicationResult->_entries.HasItems())
     {
         PROFILE_CPU_NAMED("Replication");
+        NetworkTelemetry::ReplicatedObjects = CachedReplicationResult->_entries.Count();
         if (CachedWriteStream == nullptr)
             CachedWriteStream = New<NetworkStream>();
         NetworkStream* stream = CachedWriteStream;
         stream->SenderId = NetworkManager::LocalClientId;
-        // TODO: use Job System when replicated objects count is large
+
+        // Collect objects to replicate
+        int32 jobsCount = 0;
+        ReplicateAsyncJobs.Clear();
         for (auto& e : CachedReplicationResult->_entries)
         {
             ScriptingObject* obj = e.Object;
@@ -1849,93 +2744,120 @@ void NetworkInternal::NetworkReplicatorUpdate()
                     continue;
             }
 
-            if (item.AsNetworkObject)
-                item.AsNetworkObject->OnNetworkSerialize();
-
-            // Serialize object
-            stream->Initialize();
-            const bool failed = NetworkReplicator::InvokeSerializer(obj->GetTypeHandle(), obj, stream, true);
-            if (failed)
-            {
-                //NETWORK_REPLICATOR_LOG(Error, "[NetworkReplicator] Cannot serialize object {} of type {} (missing serialization logic)", item.ToString(), obj->GetType().ToString());
-                continue;
-            }
-
-            // Send object to clients
-            const uint32 size = stream->GetPosition();
-            ASSERT(size <= MAX_uint16);
-            NetworkMessageObjectReplicate msgData;
-            msgData.OwnerFrame = NetworkManager::Frame;
-            msgData.ObjectId = item.ObjectId;
-            msgData.ParentId = item.ParentId;
+            if (jobsCount == ReplicateJobs.Count())
+                ReplicateJobs.AddOne();
+            ReplicateJob& job = ReplicateJobs[jobsCount];
+            job.Item = &item;
+            job.Object = obj;
+            job.Priority = item.ReplicationPriority = e.Priority;
+            job.CullDistance = item.ReplicationCullDistance = e.CullDistance;
+            job.SerializeTime = 0.0;
+            job.Async = item.AsyncSerialization && SerializersTable.ContainsKey(obj->GetTypeHandle()); // Serializers table is modified on the first use of the type so it has to happen on the main thread
+            job.Groups.Clear();
             if (isClient)
             {
-                // Remap local client object ids into server ids
-                IdsRemappingTable.KeyOf(msgData.ObjectId, &msgData.ObjectId);
-                IdsRemappingTable.KeyOf(msgData.ParentId, &msgData.ParentId);
+                NetworkConnection server;
+                server.ConnectionId = MAX_uint32;
+                job.Targets.Clear();
+                job.Targets.Add(server);
             }
-            GetNetworkName(msgData.ObjectTypeName, obj->GetType().Fullname);
-            msgData.DataSize = size;
-            const uint32 msgMaxData = peer->Config.MessageSize - sizeof(NetworkMessageObjectReplicate);
-            const uint32 partMaxData = peer->Config.MessageSize - sizeof(NetworkMessageObjectReplicatePart);
-            uint32 partsCount = 1;
-            uint32 dataStart = 0;
-            uint32 msgDataSize = size;
-            if (size > msgMaxData)
+            else
+                job.Targets.Set(CachedTargets.Get(), CachedTargets.Count());
+            if (job.Async)
+                ReplicateAsyncJobs.Add(jobsCount);
+            jobsCount++;
+        }
+
+        // Serialize objects (the ones with thread-safe serialization are spread over the Job System workers when there are many of them)
+        const int32 asyncJobsCount = ReplicateAsyncJobs.Count();
+        const int32 workersCount = Math::Min(asyncJobsCount / NETWORK_REPLICATOR_ASYNC_MIN_OBJECTS, JobSystem::GetThreadsCount());
+        int64 serializeLabel = 0;
+        if (workersCount > 1)
+        {
+            while (CachedWorkerStreams.Count() < workersCount)
+                CachedWorkerStreams.Add(New<NetworkStream>());
+            for (int32 i = 0; i < workersCount; i++)
+                CachedWorkerStreams[i]->SenderId = NetworkManager::LocalClientId;
+            const int32 chunkSize = Math::DivideAndRoundUp(asyncJobsCount, workersCount);
+            const Function<void(int32)> serializeJob = [chunkSize, asyncJobsCount](int32 workerIndex)
             {
-                // Send msgMaxData within first message
-                msgDataSize = msgMaxData;
-                dataStart += msgMaxData;
+                PROFILE_CPU_NAMED("ReplicationSerialize");
+                NetworkStream* workerStream = CachedWorkerStreams[workerIndex];
+                const int32 start = workerIndex * chunkSize;
+                const int32 end = Math::Min(start + chunkSize, asyncJobsCount);
+                for (int32 i = start; i < end; i++)
+                    SerializeReplicateJob(ReplicateJobs[ReplicateAsyncJobs[i]], workerStream);
+            };
+            serializeLabel = JobSystem::Dispatch(serializeJob, workersCount);
+        }
+        for (int32 jobIndex = 0; jobIndex < jobsCount; jobIndex++)
+        {
+            ReplicateJob& job = ReplicateJobs[jobIndex];
+            if (workersCount <= 1 || !job.Async)
+                SerializeReplicateJob(job, stream);
+        }
+        if (workersCount > 1)
+            JobSystem::Wait(serializeLabel);
 
-                // Send rest of the data in separate parts
-                partsCount += Math::DivideAndRoundUp(size - dataStart, partMaxData);
-            }
-            else
-                dataStart += size;
-            ASSERT(partsCount <= MAX_uint8);
-            msgData.PartsCount = partsCount;
-            NetworkMessage msg = peer->BeginSendMessage();
-            msg.WriteStructure(msgData);
-            msg.WriteBytes(stream->GetBuffer(), msgDataSize);
-            uint32 dataSize = msgDataSize, messageSize = msg.Length;
-            if (isClient)
-                peer->EndSendMessage(NetworkChannelType::Unreliable, msg);
-            else
-                peer->EndSendMessage(NetworkChannelType::Unreliable, msg, CachedTargets);
+        // Limit bandwidth usage
+        if (useBandwidthLimit)
+        {
+            ApplyReplicationBudget(CachedReplicationResult, jobsCount, isClient);
+            NetworkTelemetry::DeferredObjects = DeferredObjects.Count();
+        }
 
-            // Send all other parts
-            for (uint32 partIndex = 1; partIndex < partsCount; partIndex++)
+        // Send objects to clients (in order)
+        for (int32 jobIndex = 0; jobIndex < jobsCount; jobIndex++)
+        {
+            const ReplicateJob& job = ReplicateJobs[jobIndex];
+            if (NetworkTelemetry::Enabled)
+                NetworkTelemetry::OnSerialize(job.Object->GetTypeHandle(), job.SerializeTime);
+            if (job.Groups.IsEmpty())
+                continue;
+            const NetworkReplicatedObject& item = *job.Item;
+            const NetworkReplicatedSnapshot& snapshot = item.SentSnapshots.Last();
+            uint32 dataSize = 0, messageSize = 0, receivers = 0;
+            uint64 telemetrySize = 0;
+            for (const ReplicateGroup& group : job.Groups)
             {
-                NetworkMessageObjectReplicatePart msgDataPart;
-                msgDataPart.OwnerFrame = msgData.OwnerFrame;
-                msgDataPart.ObjectId = msgData.ObjectId;
-                msgDataPart.DataSize = msgData.DataSize;
-                msgDataPart.PartsCount = msgData.PartsCount;
-                msgDataPart.PartStart = dataStart;
-                msgDataPart.PartSize = Math::Min(size - dataStart, partMaxData);
-                msg = peer->BeginSendMessage();
-                msg.WriteStructure(msgDataPart);
-                msg.WriteBytes(stream->GetBuffer() + msgDataPart.PartStart, msgDataPart.PartSize);
-                messageSize += msg.Length;
-                dataSize += msgDataPart.PartSize;
-                dataStart += msgDataPart.PartSize;
-                if (isClient)
-                    peer->EndSendMessage(NetworkChannelType::Unreliable, msg);
+                CachedTargets.Set(group.Targets.Get(), group.Targets.Count());
+                if (useBandwidthLimit)
+                {
+                    for (int32 i = group.Deferred.Count() - 1; i >= 0; i--)
+                    {
+                        if (group.Deferred[i])
+                            CachedTargets.RemoveAt(i);
+                    }
+                    if (CachedTargets.IsEmpty())
+                        continue;
+                }
+                receivers += CachedTargets.Count();
+                const uint32 groupMessageSize = messageSize;
+                if (group.BaselineFrame != 0)
+                    SendObjectReplicateMessage(peer, isClient, item, job.Object, group.BaselineFrame, group.Delta.Get(), group.Delta.Count(), dataSize, messageSize);
                 else
-                    peer->EndSendMessage(NetworkChannelType::Unreliable, msg, CachedTargets);
+                    SendObjectReplicateMessage(peer, isClient, item, job.Object, 0, snapshot.Data.Get(), snapshot.Data.Count(), dataSize, messageSize);
+                if (NetworkTelemetry::Enabled)
+                {
+                    const uint32 size = messageSize - groupMessageSize;
+                    telemetrySize += (uint64)size * CachedTargets.Count();
+                    for (const NetworkConnection& target : CachedTargets)
+                        NetworkTelemetry::OnClientSend(target.ConnectionId, size, false);
+                }
             }
-            ASSERT_LOW_LAYER(dataStart == size);
+            if (NetworkTelemetry::Enabled && receivers)
+                NetworkTelemetry::OnSend(job.Object->GetTypeHandle(), StringAnsiView::Empty, telemetrySize);
 
 #if COMPILE_WITH_PROFILER
             // Network stats recording
             if (EnableProfiling)
             {
-                const Pair<ScriptingTypeHandle, StringAnsiView> name(obj->GetTypeHandle(), StringAnsiView::Empty);
+                const Pair<ScriptingTypeHandle, StringAnsiView> name(job.Object->GetTypeHandle(), StringAnsiView::Empty);
                 auto& profileEvent = ProfilerEvents[name];
                 profileEvent.Count++;
                 profileEvent.DataSize += dataSize;
                 profileEvent.MessageSize += messageSize;
-                profileEvent.Receivers += isClient ? 1 : CachedTargets.Count();
+                profileEvent.Receivers += receivers;
             }
 #endif
         }
@@ -1971,32 +2893,55 @@ void NetworkInternal::NetworkReplicatorUpdate()
                 IdsRemappingTable.KeyOf(msgData.ObjectId, &msgData.ObjectId);
                 IdsRemappingTable.KeyOf(msgData.ParentId, &msgData.ParentId);
             }
-            GetNetworkName(msgData.ObjectTypeName, obj->GetType().Fullname);
-            GetNetworkName(msgData.RpcTypeName, e.Name.First.GetType().Fullname);
-            GetNetworkName(msgData.RpcName, e.Name.Second);
-            msgData.ArgsSize = (uint16)e.ArgsData.Length();
-            NetworkMessage msg = peer->BeginSendMessage();
-            msg.WriteStructure(msgData);
-            msg.WriteBytes(e.ArgsData.Get(), e.ArgsData.Length());
-            uint32 dataSize = e.ArgsData.Length(), messageSize = msg.Length, receivers = 0;
-            NetworkChannelType channel = (NetworkChannelType)e.Info.Channel;
-            if (e.Info.Server && isClient)
+            const NetworkChannelType channel = (NetworkChannelType)e.Info.Channel;
+            const bool sendToServer = e.Info.Server && isClient;
+            if (sendToServer)
             {
                 // Client -> Server
 #if USE_NETWORK_REPLICATOR_LOG
                 if (e.Targets.Length() != 0)
                     NETWORK_REPLICATOR_LOG(Error, "[NetworkReplicator] Server RPC '{}::{}' called with non-empty list of targets is not supported (only server will receive it)", e.Name.First.ToString(), e.Name.Second.ToString());
 #endif
-                peer->EndSendMessage(channel, msg);
-                receivers = 1;
             }
             else if (e.Info.Client && (isServer || isHost))
             {
                 // Server -> Client(s)
                 BuildCachedTargets(NetworkManager::Clients, item.TargetClientIds, e.Targets, NetworkManager::LocalClientId);
+            }
+            else
+                continue;
+            NetworkNamesWriter names;
+            msgData.ObjectTypeNameId = names.Add(obj->GetTypeHandle());
+            msgData.RpcNameId = names.Add(e.Name);
+            msgData.ArgsSize = (uint16)e.ArgsData.Length();
+            NetworkMessage msg = peer->BeginSendMessage();
+            names.Write(msg);
+            msg.WriteStructure(msgData);
+            msg.WriteBytes(e.ArgsData.Get(), e.ArgsData.Length());
+            uint32 dataSize = e.ArgsData.Length(), messageSize = msg.Length, receivers;
+            if (sendToServer)
+            {
+                peer->EndSendMessage(channel, msg);
+                receivers = 1;
+            }
+            else
+            {
                 peer->EndSendMessage(channel, msg, CachedTargets);
                 receivers = CachedTargets.Count();
             }
+            if (NetworkTelemetry::Enabled && receivers)
+            {
+                NetworkTelemetry::OnSend(e.Name.First, e.Name.Second, (uint64)messageSize * receivers);
+                if (sendToServer)
+                {
+                    NetworkTelemetry::OnClientSend(MAX_uint32, messageSize, true);
+                }
+                else
+                {
+                    for (const NetworkConnection& target : CachedTargets)
+                        NetworkTelemetry::OnClientSend(target.ConnectionId, messageSize, true);
+                }
+            }
 
 #if COMPILE_WITH_PROFILER
             // Network stats recording
@@ -2010,6 +2955,7 @@ void NetworkInternal::NetworkReplicatorUpdate()
             }
 #endif
         }
+        NetworkTelemetry::SentRpcs = RpcQueue.Count();
         RpcQueue.Clear();
     }
 
@@ -2025,7 +2971,7 @@ void NetworkInternal::OnNetworkMessageObjectReplicate(NetworkEvent& event, Netwo
     ScopeLock lock(ObjectsLock);
     if (DespawnedObjects.Contains(msgData.ObjectId))
         return; // Skip replicating not-existing objects
-    NetworkReplicatedObject* e = ResolveObject(msgData.ObjectId, msgData.ParentId, msgData.ObjectTypeName);
+    NetworkReplicatedObject* e = ResolveObject(msgData.ObjectId, msgData.ParentId, GetNetworkReceivedType(GetNetworkNamesKey(client), msgData.ObjectTypeNameId));
     if (!e)
         return;
     auto& item = *e;
@@ -2035,17 +2981,19 @@ void NetworkInternal::OnNetworkMessageObjectReplicate(NetworkEvent& event, Netwo
         return;
 
     const uint32 senderClientId = client ? client->ClientId : NetworkManager::ServerClientId;
+    const uint32 senderKey = GetNetworkNamesKey(client);
     if (msgData.PartsCount == 1)
     {
         // Replicate
-        InvokeObjectReplication(item, msgData.OwnerFrame, event.Message.Buffer + event.Message.Position, msgData.DataSize, senderClientId);
+        InvokeObjectReplication(item, msgData.OwnerFrame, msgData.BaselineFrame, event.Message.Buffer + event.Message.Position, msgData.DataSize, senderClientId, senderKey);
     }
     else
     {
-        // Add to replication from multiple parts
-        const uint16 msgMaxData = peer->Config.MessageSize - sizeof(NetworkMessageObjectReplicate);
-        ReplicateItem* replicateItem = AddObjectReplicateItem(event, msgData, 0, msgMaxData, senderClientId);
+        // Add to replication from multiple parts (first part data fills the rest of the message)
+        const uint16 msgMaxData = (uint16)(event.Message.Length - event.Message.Position);
+        ReplicateItem* replicateItem = AddObjectReplicateItem(event, msgData, 0, msgMaxData, senderClientId, senderKey);
         replicateItem->Object = e->Object;
+        replicateItem->BaselineFrame = msgData.BaselineFrame;
     }
 }
 
@@ -2059,7 +3007,7 @@ void NetworkInternal::OnNetworkMessageObjectReplicatePart(NetworkEvent& event, N
         return; // Skip replicating not-existing objects
 
     const uint32 senderClientId = client ? client->ClientId : NetworkManager::ServerClientId;
-    AddObjectReplicateItem(event, msgData, msgData.PartStart, msgData.PartSize, senderClientId);
+    AddObjectReplicateItem(event, msgData, msgData.PartStart, msgData.PartSize, senderClientId, GetNetworkNamesKey(client));
 }
 
 void NetworkInternal::OnNetworkMessageObjectSpawn(NetworkEvent& event, NetworkClient* client, NetworkPeer* peer)
@@ -2073,6 +3021,7 @@ void NetworkInternal::OnNetworkMessageObjectSpawn(NetworkEvent& event, NetworkCl
     {
         // Allocate spawn message parts collecting
         auto& parts = SpawnParts.AddOne();
+        parts.SenderKey = GetNetworkNamesKey(client);
         parts.MsgData = msgData;
         parts.Items.Resize(msgData.ItemsCount);
         for (auto& item : parts.Items)
@@ -2081,7 +3030,7 @@ void NetworkInternal::OnNetworkMessageObjectSpawn(NetworkEvent& event, NetworkCl
     else
     {
         const auto* msgDataItems = (NetworkMessageObjectSpawnItem*)event.Message.SkipBytes(msgData.ItemsCount * sizeof(NetworkMessageObjectSpawnItem));
-        InvokeObjectSpawn(msgData, msgDataItems);
+        InvokeObjectSpawn(msgData, msgDataItems, GetNetworkNamesKey(client));
     }
 }
 
@@ -2107,7 +3056,7 @@ void NetworkInternal::OnNetworkMessageObjectSpawnPart(NetworkEvent& event, Netwo
 
     // Read all items from this part
     constexpr uint32 spawnItemMaxSize = sizeof(uint16) + sizeof(NetworkMessageObjectSpawnItem); // Index + Data
-    while (event.Message.Position + spawnItemMaxSize <= event.Message.BufferSize)
+    while (event.Message.Position + spawnItemMaxSize <= event.Message.Length)
     {
         const uint16 itemIndex = event.Message.ReadUInt16();
         event.Message.ReadStructure(spawnParts.Items[itemIndex]);
@@ -2119,7 +3068,7 @@ void NetworkInternal::OnNetworkMessageObjectSpawnPart(NetworkEvent& event, Netwo
         if (!e.ObjectId.IsValid())
             return;
     }
-    InvokeObjectSpawn(spawnParts.MsgData, spawnParts.Items.Get());
+    InvokeObjectSpawn(spawnParts.MsgData, spawnParts.Items.Get(), spawnParts.SenderKey);
     SpawnParts.RemoveAt(spawnPartsIndex);
 }
 
@@ -2178,6 +3127,7 @@ void NetworkInternal::OnNetworkMessageObjectRole(NetworkEvent& event, NetworkCli
         // Update
         item.OwnerClientId = msgData.OwnerClientId;
         item.LastOwnerFrame = 1;
+        ResetObjectSnapshots(item);
         if (item.OwnerClientId == NetworkManager::LocalClientId)
         {
             // Upgrade ownership automatically
@@ -2213,17 +3163,23 @@ void NetworkInternal::OnNetworkMessageObjectRpc(NetworkEvent& event, NetworkClie
     ScopeLock lock(ObjectsLock);
 
     // Find RPC info
+    const uint32 senderKey = GetNetworkNamesKey(client);
+    const NetworkReceivedName* rpcName = GetNetworkReceivedName(senderKey, msgData.RpcNameId);
     NetworkRpcName name;
-    name.First = Scripting::FindScriptingType(msgData.RpcTypeName);
-    name.Second = msgData.RpcName;
-    const NetworkRpcInfo* info = NetworkRpcInfo::RPCsTable.TryGet(name);
-    if (!info)
+    if (rpcName)
+    {
+        name.First = rpcName->Type;
+        name.Second = rpcName->RpcName;
+    }
+    const auto infoIt = NetworkRpcInfo::RPCsTable.Find(name);
+    if (infoIt.IsEnd())
     {
-        NETWORK_REPLICATOR_LOG(Error, "[NetworkReplicator] Unknown RPC {}::{} for object {}", String(msgData.RpcTypeName), String(msgData.RpcName), msgData.ObjectId);
+        NETWORK_REPLICATOR_LOG(Error, "[NetworkReplicator] Unknown RPC {}::{} for object {}", GetNetworkReceivedTypeName(senderKey, msgData.RpcNameId), String(name.Second), msgData.ObjectId);
         return;
     }
+    const NetworkRpcInfo* info = &infoIt->Value;
 
-    NetworkReplicatedObject* e = ResolveObject(msgData.ObjectId, msgData.ParentId, msgData.ObjectTypeName);
+    NetworkReplicatedObject* e = ResolveObject(msgData.ObjectId, msgData.ParentId, GetNetworkReceivedType(senderKey, msgData.ObjectTypeNameId));
     if (e)
     {
         auto& item = *e;
@@ -2234,12 +3190,12 @@ void NetworkInternal::OnNetworkMessageObjectRpc(NetworkEvent& event, NetworkClie
         // Validate RPC
         if (info->Server && NetworkManager::IsClient())
         {
-            NETWORK_REPLICATOR_LOG(Error, "[NetworkReplicator] Cannot invoke server RPC {}::{} on client", String(msgData.RpcTypeName), String(msgData.RpcName));
+            NETWORK_REPLICATOR_LOG(Error, "[NetworkReplicator] Cannot invoke server RPC {}::{} on client", name.First.ToString(), String(name.Second));
             return;
         }
         if (info->Client && NetworkManager::IsServer())
         {
-            NETWORK_REPLICATOR_LOG(Error, "[NetworkReplicator] Cannot invoke client RPC {}::{} on server", String(msgData.RpcTypeName), String(msgData.RpcName));
+            NETWORK_REPLICATOR_LOG(Error, "[NetworkReplicator] Cannot invoke client RPC {}::{} on server", name.First.ToString(), String(name.Second));
             return;
         }
 
@@ -2251,10 +3207,75 @@ void NetworkInternal::OnNetworkMessageObjectRpc(NetworkEvent& event, NetworkClie
         stream->Initialize(event.Message.Buffer + event.Message.Position, msgData.ArgsSize);
 
         // Execute RPC
+        const double startTime = NetworkTelemetry::Enabled ? Platform::GetTimeSeconds() : 0.0;
         info->Execute(obj, stream, info->Tag);
+        if (NetworkTelemetry::Enabled)
+            NetworkTelemetry::OnReceive(infoIt->Key.First, infoIt->Key.Second, msgData.ArgsSize, Platform::GetTimeSeconds() - startTime); // Use RPCs table key (received name memory can be freed)
     }
     else if (info->Channel != static_cast<uint8>(NetworkChannelType::Unreliable) && info->Channel != static_cast<uint8>(NetworkChannelType::UnreliableOrdered))
     {
-        NETWORK_REPLICATOR_LOG(Error, "[NetworkReplicator] Unknown object {} RPC {}::{}", msgData.ObjectId, String(msgData.RpcTypeName), String(msgData.RpcName));
+        NETWORK_REPLICATOR_LOG(Error, "[NetworkReplicator] Unknown object {} RPC {}::{}", msgData.ObjectId, name.First.ToString(), String(name.Second));
+    }
+}
+
+void NetworkInternal::OnNetworkMessageNames(NetworkEvent& event, NetworkClient* client, NetworkPeer* peer)
+{
+    NetworkMessageNames msgData;
+    event.Message.ReadStructure(msgData);
+    ScopeLock lock(ObjectsLock);
+    const uint32 key = GetNetworkNamesKey(client);
+    auto& names = NetworkNamesReceived[key];
+    auto& acks = NetworkNamesPendingAcks[key];
+    for (int32 i = 0; i < msgData.Count; i++)
+    {
+        const uint16 id = event.Message.ReadUInt16();
+        if (id >= names.Count())
+            names.Resize(id + 1);
+        auto& name = names[id];
+        ReadNetworkName(event.Message, name.TypeName);
+        ReadNetworkName(event.Message, name.RpcName);
+        name.Resolved = false;
+        acks.AddUnique(id);
+    }
+}
+
+void NetworkInternal::OnNetworkMessageNamesAck(NetworkEvent& event, NetworkClient* client, NetworkPeer* peer)
+{
+    NetworkMessageNamesAck msgData;
+    event.Message.ReadStructure(msgData);
+    ScopeLock lock(ObjectsLock);
+    auto& acked = NetworkNamesAcked[GetNetworkNamesKey(client)];
+    for (int32 i = 0; i < msgData.Count; i++)
+    {
+        const uint16 id = event.Message.ReadUInt16();
+        if (id >= acked.Count())
+        {
+            const int32 count = acked.Count();
+            acked.Resize(id + 1);
+            for (int32 j = count; j < id; j++)
+                acked.Set(j, false);
+        }
+        acked.Set(id, true);
+    }
+}
+
+void NetworkInternal::OnNetworkMessageObjectReplicateAck(NetworkEvent& event, NetworkClient* client, NetworkPeer* peer)
+{
+    NetworkMessageObjectReplicateAck msgData;
+    event.Message.ReadStructure(msgData);
+    ScopeLock lock(ObjectsLock);
+    const uint32 key = GetNetworkNamesKey(client);
+    for (int32 i = 0; i < msgData.Count; i++)
+    {
+        const Guid objectId = event.Message.ReadGuid();
+        const uint32 frame = event.Message.ReadUInt32();
+        NetworkReplicatedObject* e = ResolveObject(objectId);
+        if (!e)
+            continue;
+        uint32& acked = e->AckedFrames[key];
+        if (frame == 0)
+            acked = 0; // Receiver lost the baseline so send full state
+        else if (frame > acked)
+            acked = frame;
     }
 }
@@ -42,6 +42,18 @@ API_CLASS(static, Namespace = "FlaxEngine.Networking") class FLAXENGINE_API Netw
     API_FIELD() static bool EnableLog;
 #endif
 
+    /// <summary>
+    /// The maximum amount of the replication data (in bytes per second) sent to a single client (or to the server when running as client). When exceeded, the replication updates are sent in order of their priority while the remaining ones get delayed (see NetworkReplicationHierarchyObject.Priority). Use 0 to disable the limit.
+    /// </summary>
+    API_FIELD() static int32 ClientBandwidthLimit;
+
+    /// <summary>
+    /// Sets the replication bandwidth limit for a specific client (overrides ClientBandwidthLimit).
+    /// </summary>
+    /// <param name="clientId">The Client Id.</param>
+    /// <param name="bytesPerSecond">The maximum amount of the replication data (in bytes per second) sent to the client. Use 0 to disable the limit or -1 to use ClientBandwidthLimit.</param>
+    API_FUNCTION() static void SetClientBandwidthLimit(uint32 clientId, int32 bytesPerSecond);
+
     /// <summary>
     /// Gets the network replication hierarchy.
     /// </summary>
@@ -187,6 +199,13 @@ API_CLASS(static, Namespace = "FlaxEngine.Networking") class FLAXENGINE_API Netw
     /// <param name="obj">The network object.</param>
     API_FUNCTION() static void DirtyObject(ScriptingObject* obj);
 
+    /// <summary>
+    /// Sets whether the network object can be serialized for replication off the main thread (on Job System workers, together with OnNetworkSerialize event). Use it only for objects whose serialization doesn't access any shared state that can be modified concurrently.
+    /// </summary>
+    /// <param name="obj">The network object.</param>
+    /// <param name="value">True if object serialization is thread-safe, otherwise false (default).</param>
+    API_FUNCTION() static void SetObjectAsyncSerialization(ScriptingObject* obj, bool value);
+
 public:
     /// <summary>
     /// Begins invoking the RPC and returns the Network Stream to serialize parameters to.
@@ -44,6 +44,12 @@ API_CLASS(sealed, Namespace="FlaxEditor.Content.Settings") class FLAXENGINE_API
     API_FIELD(Attributes="EditorOrder(1010), EditorDisplay(\"Transport\")")
     uint16 Port = 7777;
 
+    /// <summary>
+    /// If checked, small network messages (eg. objects replication, RPCs, spawns) sent to the same connection during a network update are packed together into larger packets to reduce per-packet overhead. Network clients and server have to use the same value.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(1020), EditorDisplay(\"Transport\")")
+    bool MessageAggregation = true;
+
     /// <summary>
     /// The type of the network driver (implements INetworkDriver) that will be used to create, manage, send and receive messages over the network.
     /// </summary>
@@ -26,6 +26,11 @@ API_STRUCT(Namespace="FlaxEngine.Networking", NoDefault) struct FLAXENGINE_API N
     /// Total amount of data bytes received by this client.
     /// </summary>
     API_FIELD() uint32 TotalDataReceived = 0;
+
+    /// <summary>
+    /// The mean packet loss of reliable packets as a ratio (0-1).
+    /// </summary>
+    API_FIELD() float PacketLoss = 0.0f;
 };
 
 template<>
@@ -37,6 +37,8 @@ void NetworkStream::Initialize(uint32 minCapacity)
 
     // Reset pointer to the start
     _position = _buffer;
+    _bits = 0;
+    _bitsCount = 0;
 }
 
 void NetworkStream::Initialize(byte* buffer, uint32 length)
@@ -46,8 +48,114 @@ void NetworkStream::Initialize(byte* buffer, uint32 length)
     _position = _buffer = buffer;
     _length = length;
     _allocated = false;
+    _bits = 0;
+    _bitsCount = 0;
 }
 
+void NetworkStream::WriteBits(uint32 value, int32 bitsCount)
+{
+    ASSERT(bitsCount > 0 && bitsCount <= 32);
+    _bits |= ((uint64)value & (((uint64)1 << bitsCount) - 1)) << _bitsCount;
+    _bitsCount += bitsCount;
+    while (_bitsCount >= 8)
+    {
+        const byte data = (byte)_bits;
+        WriteBytes(&data, 1);
+        _bits >>= 8;
+        _bitsCount -= 8;
+    }
+}
+
+void NetworkStream::FlushBits()
+{
+    if (_bitsCount > 0)
+    {
+        const byte data = (byte)_bits;
+        WriteBytes(&data, 1);
+    }
+    _bits = 0;
+    _bitsCount = 0;
+}
+
+uint32 NetworkStream::ReadBits(int32 bitsCount)
+{
+    ASSERT(bitsCount > 0 && bitsCount <= 32);
+    while (_bitsCount < bitsCount)
+    {
+        byte data;
+        ReadBytes(&data, 1);
+        _bits |= (uint64)data << _bitsCount;
+        _bitsCount += 8;
+    }
+    const uint32 value = (uint32)(_bits & (((uint64)1 << bitsCount) - 1));
+    _bits >>= bitsCount;
+    _bitsCount -= bitsCount;
+    return value;
+}
+
+void NetworkStream::AlignBits()
+{
+    _bits = 0;
+    _bitsCount = 0;
+}
+
+void NetworkStream::WriteQuantized(float value, float min, float max, int32 bitsCount)
+{
+    const uint32 maxValue = (uint32)(((uint64)1 << bitsCount) - 1);
+    const float alpha = max > min ? Math::Saturate((value - min) / (max - min)) : 0.0f;
+    WriteBits((uint32)Math::Min((uint64)(alpha * (double)maxValue + 0.5), (uint64)maxValue), bitsCount);
+}
+
+float NetworkStream::ReadQuantized(float min, float max, int32 bitsCount)
+{
+    const uint32 maxValue = (uint32)(((uint64)1 << bitsCount) - 1);
+    return min + (float)((double)ReadBits(bitsCount) / maxValue) * (max - min);
+}
+
+// Range of the smallest three components of the normalized quaternion
+#define QUATERNION_COMPONENT_MAX 0.707106781f
+
+void NetworkStream::WriteQuaternionCompressed(const Quaternion& value, int32 componentBits)
+{
+    // Find the largest component (it's not sent but reconstructed from the other ones)
+    int32 largest = 0;
+    for (int32 i = 1; i < 4; i++)
+    {
+        if (Math::Abs(value.Raw[i]) > Math::Abs(value.Raw[largest]))
+            largest = i;
+    }
+
+    // Negate the quaternion (the same rotation) so the largest component is positive
+    const float sign = value.Raw[largest] < 0.0f ? -1.0f : 1.0f;
+    WriteBits(largest, 2);
+    for (int32 i = 0; i < 4; i++)
+    {
+        if (i != largest)
+            WriteQuantized(value.Raw[i] * sign, -QUATERNION_COMPONENT_MAX, QUATERNION_COMPONENT_MAX, componentBits);
+    }
+}
+
+Quaternion NetworkStream::ReadQuaternionCompressed(int32 componentBits)
+{
+    Quaternion value;
+    const int32 largest = (int32)ReadBits(2);
+    float sum = 0.0f;
+    for (int32 i = 0; i < 4; i++)
+    {
+        if (i != largest)
+        {
+            const float component = ReadQuantized(-QUATERNION_COMPONENT_MAX, QUATERNION_COMPONENT_MAX, componentBits);
+            value.Raw[i] = component;
+            sum += component * component;
+        }
+    }
+    value.Raw[largest] = Math::Sqrt(Math::Max(1.0f - sum, 0.0f));
+    value.Normalize();
+    return value;
+}
+
+#undef QUATERNION_COMPONENT_MAX
+
 void NetworkStream::Read(INetworkSerializable& obj)
 {
     obj.Deserialize(this);
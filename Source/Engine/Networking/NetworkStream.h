@@ -5,6 +5,7 @@
 #include "Engine/Scripting/ScriptingObject.h"
 #include "Engine/Serialization/ReadStream.h"
 #include "Engine/Serialization/WriteStream.h"
+#include "Engine/Core/Math/Quaternion.h"
 
 class INetworkSerializable;
 
@@ -19,6 +20,8 @@ API_CLASS(sealed, Namespace = "FlaxEngine.Networking") class FLAXENGINE_API Netw
     byte* _position = nullptr;
     uint32 _length = 0;
     bool _allocated = false;
+    uint64 _bits = 0;
+    int32 _bitsCount = 0;
 
 public:
     ~NetworkStream();
@@ -69,6 +72,62 @@ API_CLASS(sealed, Namespace = "FlaxEngine.Networking") class FLAXENGINE_API Netw
         ReadBytes(data, bytes);
     }
 
+    /// <summary>
+    /// Writes the lowest bits of the value to the stream. Bits are packed into bytes so call FlushBits after writing all of them (before writing any other data).
+    /// </summary>
+    /// <param name="value">The value to write.</param>
+    /// <param name="bitsCount">Amount of bits to write (in range 1-32).</param>
+    API_FUNCTION() void WriteBits(uint32 value, int32 bitsCount);
+
+    /// <summary>
+    /// Writes the pending bits to the stream (padded with zeros to the full byte).
+    /// </summary>
+    API_FUNCTION() void FlushBits();
+
+    /// <summary>
+    /// Reads the bits from the stream (written with WriteBits). Call AlignBits after reading all of them (before reading any other data).
+    /// </summary>
+    /// <param name="bitsCount">Amount of bits to read (in range 1-32).</param>
+    /// <returns>The value.</returns>
+    API_FUNCTION() uint32 ReadBits(int32 bitsCount);
+
+    /// <summary>
+    /// Skips the remaining bits of the last byte read with ReadBits (padding written by FlushBits).
+    /// </summary>
+    API_FUNCTION() void AlignBits();
+
+    /// <summary>
+    /// Writes the floating-point value quantized to the given range using the specified amount of bits.
+    /// </summary>
+    /// <param name="value">The value to write (clamped to the range).</param>
+    /// <param name="min">The minimum value of the range.</param>
+    /// <param name="max">The maximum value of the range.</param>
+    /// <param name="bitsCount">Amount of bits to use (in range 1-32).</param>
+    API_FUNCTION() void WriteQuantized(float value, float min, float max, int32 bitsCount);
+
+    /// <summary>
+    /// Reads the floating-point value quantized to the given range using the specified amount of bits (written with WriteQuantized).
+    /// </summary>
+    /// <param name="min">The minimum value of the range.</param>
+    /// <param name="max">The maximum value of the range.</param>
+    /// <param name="bitsCount">Amount of bits to use (in range 1-32).</param>
+    /// <returns>The value.</returns>
+    API_FUNCTION() float ReadQuantized(float min, float max, int32 bitsCount);
+
+    /// <summary>
+    /// Writes the rotation using smallest-three encoding: index of the largest component (2 bits) and the other three components quantized. Uses bits packing (see WriteBits).
+    /// </summary>
+    /// <param name="value">The rotation to write (normalized).</param>
+    /// <param name="componentBits">Amount of bits per component (eg. 9 or 10 result in 29 or 32 bits per rotation).</param>
+    API_FUNCTION() void WriteQuaternionCompressed(const Quaternion& value, int32 componentBits = 10);
+
+    /// <summary>
+    /// Reads the rotation using smallest-three encoding (written with WriteQuaternionCompressed). Uses bits packing (see ReadBits).
+    /// </summary>
+    /// <param name="componentBits">Amount of bits per component.</param>
+    /// <returns>The rotation.</returns>
+    API_FUNCTION() Quaternion ReadQuaternionCompressed(int32 componentBits = 10);
+
     using ReadStream::Read;
     void Read(INetworkSerializable& obj);
     void Read(INetworkSerializable* obj);
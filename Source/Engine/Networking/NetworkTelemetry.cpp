@@ -0,0 +1,268 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "NetworkTelemetry.h"
+#include "NetworkManager.h"
+#include "NetworkClient.h"
+#include "NetworkPeer.h"
+#include "INetworkDriver.h"
+#include "Engine/Core/Log.h"
+#include "Engine/Core/Math/Math.h"
+#include "Engine/Core/Types/Pair.h"
+#include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Platform/Platform.h"
+#include "Engine/Serialization/FileWriteStream.h"
+
+bool NetworkTelemetry::Enabled = false;
+int32 NetworkTelemetry::ReplicatedObjects = 0;
+int32 NetworkTelemetry::DeferredObjects = 0;
+int32 NetworkTelemetry::SentRpcs = 0;
+
+namespace
+{
+    struct TelemetryEntry
+    {
+        uint32 SentCount = 0;
+        uint64 SentBytes = 0;
+        uint32 ReceivedCount = 0;
+        uint64 ReceivedBytes = 0;
+        double SerializeTime = 0.0;
+        double DeserializeTime = 0.0;
+    };
+
+    struct TelemetryClient
+    {
+        uint64 ReplicationBytes = 0;
+        uint64 RpcBytes = 0;
+        uint64 ReceivedBytes = 0;
+    };
+
+    typedef Pair<ScriptingTypeHandle, StringAnsiView> TelemetryKey;
+
+    Dictionary<TelemetryKey, TelemetryEntry> Entries;
+    Dictionary<uint32, TelemetryClient> Clients;
+
+    // Recording state (previous values are used to write stats collected within each interval)
+    FileWriteStream* RecordingFile = nullptr;
+    float RecordingInterval = 1.0f;
+    double RecordingStartTime = 0.0;
+    double RecordingLastTime = 0.0;
+    Dictionary<TelemetryKey, TelemetryEntry> RecordedEntries;
+    Dictionary<uint32, TelemetryClient> RecordedClients;
+
+    String GetEntryName(const TelemetryKey& key)
+    {
+        String name(key.First ? key.First.GetType().Fullname : StringAnsiView("?"));
+        if (key.Second.HasChars())
+        {
+            name += TEXT("::");
+            name += String(key.Second);
+        }
+        return name;
+    }
+
+    bool GetClientInfo(uint32 connectionKey, uint32& clientId, NetworkDriverStats& stats)
+    {
+        const NetworkPeer* peer = NetworkManager::Peer;
+        if (connectionKey == MAX_uint32)
+        {
+            clientId = NetworkManager::ServerClientId;
+            if (peer && peer->NetworkDriver)
+                stats = peer->NetworkDriver->GetStats();
+            return true;
+        }
+        NetworkConnection connection;
+        connection.ConnectionId = connectionKey;
+        const NetworkClient* client = NetworkManager::GetClient(connection);
+        if (!client)
+            return false;
+        clientId = client->ClientId;
+        if (peer && peer->NetworkDriver)
+            stats = peer->NetworkDriver->GetStats(connection);
+        return true;
+    }
+
+    void WriteRecordingLine(const StringAnsi& line)
+    {
+        RecordingFile->WriteBytes(line.Get(), line.Length());
+        RecordingFile->WriteBytes("\n", 1);
+    }
+
+    void WriteRecording(double time)
+    {
+        const double t = time - RecordingStartTime;
+        for (const auto& e : Entries)
+        {
+            TelemetryEntry value = e.Value;
+            if (const TelemetryEntry* prev = RecordedEntries.TryGet(e.Key))
+            {
+                value.SentCount -= prev->SentCount;
+                value.SentBytes -= prev->SentBytes;
+                value.ReceivedCount -= prev->ReceivedCount;
+                value.ReceivedBytes -= prev->ReceivedBytes;
+                value.SerializeTime -= prev->SerializeTime;
+                value.DeserializeTime -= prev->DeserializeTime;
+            }
+            if (value.SentCount == 0 && value.ReceivedCount == 0)
+                continue;
+            WriteRecordingLine(StringAnsi::Format("{0:.3f},{1},{2},{3},{4},{5},{6},{7:.3f},{8:.3f},,",
+                                                  t, e.Key.Second.HasChars() ? "Rpc" : "Type", StringAnsi(GetEntryName(e.Key)),
+                                                  value.SentCount, value.SentBytes, value.ReceivedCount, value.ReceivedBytes, value.SerializeTime, value.DeserializeTime));
+        }
+        for (const auto& e : Clients)
+        {
+            uint32 clientId;
+            NetworkDriverStats stats;
+            if (!GetClientInfo(e.Key, clientId, stats))
+                continue;
+            TelemetryClient value = e.Value;
+            if (const TelemetryClient* prev = RecordedClients.TryGet(e.Key))
+            {
+                value.ReplicationBytes -= prev->ReplicationBytes;
+                value.RpcBytes -= prev->RpcBytes;
+                value.ReceivedBytes -= prev->ReceivedBytes;
+            }
+            WriteRecordingLine(StringAnsi::Format("{0:.3f},Client,{1},,{2},,{3},,,{4:.1f},{5:.3f}",
+                                                  t, clientId, value.ReplicationBytes + value.RpcBytes, value.ReceivedBytes, stats.RTT, stats.PacketLoss));
+        }
+        WriteRecordingLine(StringAnsi::Format("{0:.3f},Queue,ReplicatedObjects,{1},,,,,,,", t, NetworkTelemetry::ReplicatedObjects));
+        WriteRecordingLine(StringAnsi::Format("{0:.3f},Queue,DeferredObjects,{1},,,,,,,", t, NetworkTelemetry::DeferredObjects));
+        WriteRecordingLine(StringAnsi::Format("{0:.3f},Queue,SentRpcs,{1},,,,,,,", t, NetworkTelemetry::SentRpcs));
+        RecordingFile->Flush();
+        RecordedEntries = Entries;
+        RecordedClients = Clients;
+    }
+}
+
+Array<NetworkTelemetryEntry> NetworkTelemetry::GetEntries()
+{
+    Array<NetworkTelemetryEntry> result;
+    result.Resize(Entries.Count());
+    int32 i = 0;
+    for (const auto& e : Entries)
+    {
+        auto& dst = result[i++];
+        dst.Name = GetEntryName(e.Key);
+        dst.SentCount = e.Value.SentCount;
+        dst.SentBytes = e.Value.SentBytes;
+        dst.ReceivedCount = e.Value.ReceivedCount;
+        dst.ReceivedBytes = e.Value.ReceivedBytes;
+        dst.SerializeTime = e.Value.SerializeTime;
+        dst.DeserializeTime = e.Value.DeserializeTime;
+    }
+    return result;
+}
+
+Array<NetworkTelemetryClient> NetworkTelemetry::GetClients()
+{
+    Array<NetworkTelemetryClient> result;
+    result.EnsureCapacity(Clients.Count());
+    for (const auto& e : Clients)
+    {
+        NetworkTelemetryClient client;
+        if (!GetClientInfo(e.Key, client.ClientId, client.DriverStats))
+            continue;
+        client.ReplicationBytes = e.Value.ReplicationBytes;
+        client.RpcBytes = e.Value.RpcBytes;
+        client.ReceivedBytes = e.Value.ReceivedBytes;
+        result.Add(client);
+    }
+    return result;
+}
+
+void NetworkTelemetry::Reset()
+{
+    Entries.Clear();
+    Clients.Clear();
+    RecordedEntries.Clear();
+    RecordedClients.Clear();
+    ReplicatedObjects = 0;
+    DeferredObjects = 0;
+    SentRpcs = 0;
+}
+
+bool NetworkTelemetry::StartRecording(const StringView& path, float interval)
+{
+    StopRecording();
+    RecordingFile = FileWriteStream::Open(path);
+    if (!RecordingFile)
+    {
+        LOG(Error, "Failed to open network telemetry file '{0}'", path);
+        return true;
+    }
+    LOG(Info, "Recording network telemetry to '{0}'", path);
+    Enabled = true;
+    RecordingInterval = Math::Max(interval, 0.01f);
+    RecordingStartTime = RecordingLastTime = Platform::GetTimeSeconds();
+    RecordedEntries = Entries;
+    RecordedClients = Clients;
+    WriteRecordingLine("Time,Category,Name,Count,SentBytes,ReceivedCount,ReceivedBytes,SerializeMs,DeserializeMs,RTT,PacketLoss");
+    return false;
+}
+
+void NetworkTelemetry::StopRecording()
+{
+    if (!RecordingFile)
+        return;
+    WriteRecording(Platform::GetTimeSeconds());
+    Delete(RecordingFile);
+    RecordingFile = nullptr;
+    RecordedEntries.Clear();
+    RecordedClients.Clear();
+}
+
+bool NetworkTelemetry::IsRecording()
+{
+    return RecordingFile != nullptr;
+}
+
+void NetworkTelemetry::OnSend(const ScriptingTypeHandle& type, const StringAnsiView& name, uint64 size)
+{
+    auto& e = Entries[TelemetryKey(type, name)];
+    e.SentCount++;
+    e.SentBytes += size;
+}
+
+void NetworkTelemetry::OnReceive(const ScriptingTypeHandle& type, const StringAnsiView& name, uint32 size, double time)
+{
+    auto& e = Entries[TelemetryKey(type, name)];
+    e.ReceivedCount++;
+    e.ReceivedBytes += size;
+    e.DeserializeTime += time * 1000.0;
+}
+
+void NetworkTelemetry::OnSerialize(const ScriptingTypeHandle& type, double time)
+{
+    auto& e = Entries[TelemetryKey(type, StringAnsiView::Empty)];
+    e.SerializeTime += time * 1000.0;
+}
+
+void NetworkTelemetry::OnClientSend(uint32 connectionKey, uint32 size, bool rpc)
+{
+    auto& e = Clients[connectionKey];
+    if (rpc)
+        e.RpcBytes += size;
+    else
+        e.ReplicationBytes += size;
+}
+
+void NetworkTelemetry::OnClientReceive(uint32 connectionKey, uint32 size)
+{
+    Clients[connectionKey].ReceivedBytes += size;
+}
+
+void NetworkTelemetry::OnClientDisconnected(uint32 connectionKey)
+{
+    Clients.Remove(connectionKey);
+    RecordedClients.Remove(connectionKey);
+}
+
+void NetworkTelemetry::Update()
+{
+    if (!RecordingFile)
+        return;
+    const double time = Platform::GetTimeSeconds();
+    if (time - RecordingLastTime < RecordingInterval)
+        return;
+    RecordingLastTime = time;
+    WriteRecording(time);
+}
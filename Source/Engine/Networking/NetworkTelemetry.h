@@ -0,0 +1,172 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Types.h"
+#include "NetworkStats.h"
+#include "Engine/Core/Types/String.h"
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Scripting/ScriptingType.h"
+
+/// <summary>
+/// The network telemetry statistics of a single replicated object type or RPC.
+/// </summary>
+API_STRUCT(Namespace="FlaxEngine.Networking", NoDefault) struct FLAXENGINE_API NetworkTelemetryEntry
+{
+    DECLARE_SCRIPTING_TYPE_MINIMAL(NetworkTelemetryEntry);
+
+    /// <summary>
+    /// The name of the replicated object type or RPC (in format 'Type::Method').
+    /// </summary>
+    API_FIELD() String Name;
+
+    /// <summary>
+    /// The amount of sent object replication updates or RPC invocations.
+    /// </summary>
+    API_FIELD() uint32 SentCount = 0;
+
+    /// <summary>
+    /// The total size of sent messages (in bytes, including all receivers).
+    /// </summary>
+    API_FIELD() uint64 SentBytes = 0;
+
+    /// <summary>
+    /// The amount of received object replication updates or RPC invocations.
+    /// </summary>
+    API_FIELD() uint32 ReceivedCount = 0;
+
+    /// <summary>
+    /// The total size of received data (in bytes).
+    /// </summary>
+    API_FIELD() uint64 ReceivedBytes = 0;
+
+    /// <summary>
+    /// The total time spent on data serialization (in milliseconds).
+    /// </summary>
+    API_FIELD() double SerializeTime = 0.0;
+
+    /// <summary>
+    /// The total time spent on data deserialization or RPC execution (in milliseconds).
+    /// </summary>
+    API_FIELD() double DeserializeTime = 0.0;
+};
+
+/// <summary>
+/// The network telemetry statistics of a single connection (client on server or server on client).
+/// </summary>
+API_STRUCT(Namespace="FlaxEngine.Networking", NoDefault) struct FLAXENGINE_API NetworkTelemetryClient
+{
+    DECLARE_SCRIPTING_TYPE_MINIMAL(NetworkTelemetryClient);
+
+    /// <summary>
+    /// The Client Id (NetworkManager::ServerClientId for server connection on client).
+    /// </summary>
+    API_FIELD() uint32 ClientId = 0;
+
+    /// <summary>
+    /// The total size of sent object replication messages (in bytes).
+    /// </summary>
+    API_FIELD() uint64 ReplicationBytes = 0;
+
+    /// <summary>
+    /// The total size of sent RPC messages (in bytes).
+    /// </summary>
+    API_FIELD() uint64 RpcBytes = 0;
+
+    /// <summary>
+    /// The total size of received messages (in bytes).
+    /// </summary>
+    API_FIELD() uint64 ReceivedBytes = 0;
+
+    /// <summary>
+    /// The network transport statistics of the connection (eg. round trip time and packet loss).
+    /// </summary>
+    API_FIELD() NetworkDriverStats DriverStats;
+};
+
+/// <summary>
+/// Networking telemetry that tracks bandwidth usage (per replicated type, RPC and client), serialization time, replication queues and connection quality. Can be recorded into a file (eg. on headless servers) to find bandwidth issues in production.
+/// </summary>
+API_CLASS(static, Namespace="FlaxEngine.Networking") class FLAXENGINE_API NetworkTelemetry
+{
+    DECLARE_SCRIPTING_TYPE_MINIMAL(NetworkTelemetry);
+
+public:
+    /// <summary>
+    /// Enables collecting networking telemetry. Has small performance overhead so it's disabled by default.
+    /// </summary>
+    API_FIELD() static bool Enabled;
+
+    /// <summary>
+    /// The amount of objects replicated during the last network update.
+    /// </summary>
+    API_FIELD(ReadOnly) static int32 ReplicatedObjects;
+
+    /// <summary>
+    /// The amount of object replication updates delayed due to bandwidth limit during the last network update.
+    /// </summary>
+    API_FIELD(ReadOnly) static int32 DeferredObjects;
+
+    /// <summary>
+    /// The amount of RPCs sent during the last network update.
+    /// </summary>
+    API_FIELD(ReadOnly) static int32 SentRpcs;
+
+public:
+    /// <summary>
+    /// Gets the statistics of all replicated object types and RPCs (collected since the last reset).
+    /// </summary>
+    /// <returns>The list of entries.</returns>
+    API_FUNCTION() static Array<NetworkTelemetryEntry> GetEntries();
+
+    /// <summary>
+    /// Gets the statistics of all connected clients (or server when running as client).
+    /// </summary>
+    /// <returns>The list of clients.</returns>
+    API_FUNCTION() static Array<NetworkTelemetryClient> GetClients();
+
+    /// <summary>
+    /// Clears all collected statistics.
+    /// </summary>
+    API_FUNCTION() static void Reset();
+
+    /// <summary>
+    /// Starts recording the telemetry into a CSV file. Writes statistics collected during each interval (enables telemetry).
+    /// </summary>
+    /// <param name="path">The output file path.</param>
+    /// <param name="interval">The interval (in seconds) between the recorded samples.</param>
+    /// <returns>True if failed, otherwise false.</returns>
+    API_FUNCTION() static bool StartRecording(const StringView& path, float interval = 1.0f);
+
+    /// <summary>
+    /// Stops the telemetry recording.
+    /// </summary>
+    API_FUNCTION() static void StopRecording();
+
+    /// <summary>
+    /// Checks if telemetry is being recorded into a file.
+    /// </summary>
+    API_PROPERTY() static bool IsRecording();
+
+public:
+    // Records sent object replication (empty name) or RPC message (size includes all receivers).
+    static void OnSend(const ScriptingTypeHandle& type, const StringAnsiView& name, uint64 size);
+
+    // Records received object replication (empty name) or RPC message (time is in seconds).
+    static void OnReceive(const ScriptingTypeHandle& type, const StringAnsiView& name, uint32 size, double time);
+
+    // Records object serialization time (in seconds).
+    static void OnSerialize(const ScriptingTypeHandle& type, double time);
+
+    // Records message sent to the connection (key matches connection id on server, or MAX_uint32 on client).
+    static void OnClientSend(uint32 connectionKey, uint32 size, bool rpc);
+
+    // Records message received from the connection (key matches connection id on server, or MAX_uint32 on client).
+    static void OnClientReceive(uint32 connectionKey, uint32 size);
+
+    // Removes the connection stats.
+    static void OnClientDisconnected(uint32 connectionKey);
+
+    // Updates the recording (called after network update).
+    static void Update();
+};
@@ -0,0 +1,472 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "ParticleEmitterGraph.CPU.h"
+#include "Engine/Visject/GraphUtilities.h"
+
+// ReSharper disable CppCStyleCast
+// ReSharper disable CppClangTidyClangDiagnosticCastAlign
+
+namespace
+{
+    VariantType::Types GetKernelType(ParticleAttribute::ValueTypes type)
+    {
+        switch (type)
+        {
+        case ParticleAttribute::ValueTypes::Float:
+            return VariantType::Float;
+        case ParticleAttribute::ValueTypes::Float2:
+            return VariantType::Float2;
+        case ParticleAttribute::ValueTypes::Float3:
+            return VariantType::Float3;
+        case ParticleAttribute::ValueTypes::Float4:
+            return VariantType::Float4;
+        default:
+            return VariantType::Null;
+        }
+    }
+
+    bool IsKernelMath1(uint16 typeId)
+    {
+        switch (typeId)
+        {
+        case 7:
+        case 8:
+        case 9:
+        case 10:
+        case 13:
+        case 14:
+        case 15:
+        case 16:
+        case 17:
+        case 27:
+        case 28:
+        case 38:
+        case 43:
+        case 44:
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    bool IsKernelMath2(uint16 typeId)
+    {
+        switch (typeId)
+        {
+        case 1:
+        case 2:
+        case 3:
+        case 5:
+        case 21:
+        case 22:
+        case 23:
+        case 40:
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    template<typename Op>
+    FORCE_INLINE void KernelLoop(float* RESTRICT v, const float* RESTRICT a, int32 count, Op op)
+    {
+        for (int32 i = 0; i < count; i++)
+            v[i] = op(a[i]);
+    }
+
+    template<typename Op>
+    FORCE_INLINE void KernelLoop(float* RESTRICT v, const float* RESTRICT a, const float* RESTRICT b, int32 count, Op op)
+    {
+        for (int32 i = 0; i < count; i++)
+            v[i] = op(a[i], b[i]);
+    }
+
+    void KernelMath(uint16 typeId, float* v, const float* a, int32 count)
+    {
+        switch (typeId)
+        {
+        case 7:
+            KernelLoop(v, a, count, [](float a) { return Math::Abs(a); });
+            break;
+        case 8:
+            KernelLoop(v, a, count, [](float a) { return Math::Ceil(a); });
+            break;
+        case 9:
+            KernelLoop(v, a, count, [](float a) { return Math::Cos(a); });
+            break;
+        case 10:
+            KernelLoop(v, a, count, [](float a) { return Math::Floor(a); });
+            break;
+        case 13:
+            KernelLoop(v, a, count, [](float a) { return Math::Round(a); });
+            break;
+        case 14:
+            KernelLoop(v, a, count, [](float a) { return Math::Saturate(a); });
+            break;
+        case 15:
+            KernelLoop(v, a, count, [](float a) { return Math::Sin(a); });
+            break;
+        case 16:
+            KernelLoop(v, a, count, [](float a) { return Math::Sqrt(a); });
+            break;
+        case 17:
+            KernelLoop(v, a, count, [](float a) { return Math::Tan(a); });
+            break;
+        case 27:
+            KernelLoop(v, a, count, [](float a) { return -a; });
+            break;
+        case 28:
+            KernelLoop(v, a, count, [](float a) { return 1 - a; });
+            break;
+        case 38:
+            KernelLoop(v, a, count, [](float a) { return Math::Trunc(a); });
+            break;
+        case 43:
+            KernelLoop(v, a, count, [](float a) { return a * RadiansToDegrees; });
+            break;
+        case 44:
+            KernelLoop(v, a, count, [](float a) { return a * DegreesToRadians; });
+            break;
+        }
+    }
+
+    void KernelMath(uint16 typeId, float* v, const float* a, const float* b, int32 count)
+    {
+        switch (typeId)
+        {
+        case 1:
+            KernelLoop(v, a, b, count, [](float a, float b) { return a + b; });
+            break;
+        case 2:
+            KernelLoop(v, a, b, count, [](float a, float b) { return a - b; });
+            break;
+        case 3:
+            KernelLoop(v, a, b, count, [](float a, float b) { return a * b; });
+            break;
+        case 5:
+            KernelLoop(v, a, b, count, [](float a, float b) { return a / b; });
+            break;
+        case 21:
+            KernelLoop(v, a, b, count, [](float a, float b) { return Math::Max(a, b); });
+            break;
+        case 22:
+            KernelLoop(v, a, b, count, [](float a, float b) { return Math::Min(a, b); });
+            break;
+        case 23:
+            KernelLoop(v, a, b, count, [](float a, float b) { return Math::Pow(a, b); });
+            break;
+        case 40:
+            KernelLoop(v, a, b, count, [](float a, float b) { return Math::Mod(a, b); });
+            break;
+        }
+    }
+}
+
+void ParticleEmitterGraphCPU::CompileKernels()
+{
+    _kernels.Clear();
+    for (int32 stage = 0; stage < 2; stage++)
+    {
+        auto& modules = stage == 0 ? InitModules : UpdateModules;
+        for (int32 i = 0; i < modules.Count(); i++)
+        {
+            const auto module = modules[i];
+            module->KernelIndex = -1;
+
+            // Modules that don't use particle data already evaluate input once for all particles
+            if (!module->UsePerParticleDataResolve())
+                continue;
+            switch (module->TypeID)
+            {
+            // Set Attribute
+            case 200:
+            case 302:
+                CompileKernel(module, 4);
+                break;
+            // Set Position/Lifetime/Age/..
+            case 250:
+            case 251:
+            case 252:
+            case 253:
+            case 254:
+            case 255:
+            case 256:
+            case 257:
+            case 258:
+            case 259:
+            case 260:
+            case 261:
+            case 262:
+            case 263:
+            case 350:
+            case 351:
+            case 352:
+            case 353:
+            case 354:
+            case 355:
+            case 356:
+            case 357:
+            case 358:
+            case 359:
+            case 360:
+            case 361:
+            case 362:
+            case 363:
+                CompileKernel(module, 2);
+                break;
+            }
+        }
+    }
+}
+
+bool ParticleEmitterGraphCPU::CompileKernel(ParticleEmitterGraphCPUNode* module, int32 defaultValueIndex)
+{
+    const VariantType::Types type = GetKernelType(Layout.Attributes[module->Attributes[0]].ValueType);
+    if (type == VariantType::Null || module->Values.Count() <= defaultValueIndex)
+        return true;
+    ParticleEmitterGraphCPUKernel kernel;
+    kernel.Attribute = module->Attributes[0];
+    const int32 result = CompileKernelInput(kernel, module->GetBox(0), module->Values[defaultValueIndex], type);
+    if (result == -1)
+        return true;
+
+    // Vectors of different size are converted by the generic path (only scalar broadcast is supported)
+    const int32 components = kernel.Ops[result].Components;
+    if (components != 1 && components != GraphUtilities::CountComponents(type))
+        return true;
+
+    module->KernelIndex = _kernels.Count();
+    _kernels.Add(kernel);
+    return false;
+}
+
+int32 ParticleEmitterGraphCPU::CompileKernelInput(ParticleEmitterGraphCPUKernel& kernel, ParticleEmitterGraphCPUBox* box, const Variant& defaultValue, VariantType::Types defaultType)
+{
+    if (kernel.Ops.Count() == PARTICLE_EMITTER_MAX_KERNEL_OPS)
+        return -1;
+    ParticleEmitterGraphCPUKernel::Op op;
+    op.MathOp = 0;
+    op.A = op.B = -1;
+    op.Value = Float4::Zero;
+    op.Caller = nullptr;
+    op.Box = nullptr;
+    op.Type = VariantType::Null;
+    if (!box->HasConnection())
+    {
+        // Default value
+        GraphUtilities::FastValue value;
+        if (!GraphUtilities::LoadFastValue(defaultValue, defaultType, value))
+            return -1;
+        op.Code = ParticleEmitterGraphCPUKernel::OpCodes::Constant;
+        op.Components = (byte)GraphUtilities::CountComponents(defaultType);
+        Platform::MemoryCopy(op.Value.Raw, value.Components, op.Components * sizeof(float));
+        kernel.Ops.Add(op);
+        return kernel.Ops.Count() - 1;
+    }
+    const auto source = (ParticleEmitterGraphCPUBox*)box->FirstConnection();
+    const auto node = source->GetParent<ParticleEmitterGraphCPUNode>();
+    if (node->GroupID == 14)
+    {
+        switch (node->TypeID)
+        {
+        // Particle Attribute
+        case 100:
+        // Particle Position/Lifetime/Age/..
+        case 101:
+        case 102:
+        case 103:
+        case 104:
+        case 105:
+        case 106:
+        case 107:
+        case 108:
+        case 109:
+        case 111:
+        case 112:
+        {
+            const VariantType::Types type = GetKernelType(Layout.Attributes[node->Attributes[0]].ValueType);
+            if (type == VariantType::Null)
+                return -1;
+            op.Code = ParticleEmitterGraphCPUKernel::OpCodes::Attribute;
+            op.Components = (byte)GraphUtilities::CountComponents(type);
+            op.A = node->Attributes[0];
+            kernel.Ops.Add(op);
+            return kernel.Ops.Count() - 1;
+        }
+        // Particle Normalized Age
+        case 110:
+            op.Code = ParticleEmitterGraphCPUKernel::OpCodes::NormalizedAge;
+            op.Components = 1;
+            op.A = node->Attributes[0];
+            op.B = node->Attributes[1];
+            kernel.Ops.Add(op);
+            return kernel.Ops.Count() - 1;
+        }
+    }
+    if (!node->UsesParticleData && node->IsConstant)
+    {
+        // Value that is the same for all particles
+        op.Type = GraphUtilities::GetFastMathType(source->Type.Type);
+        if (op.Type == VariantType::Null)
+            return -1;
+        op.Code = ParticleEmitterGraphCPUKernel::OpCodes::Uniform;
+        op.Components = (byte)GraphUtilities::CountComponents(op.Type);
+        op.Caller = box->GetParent<ParticleEmitterGraphCPUNode>();
+        op.Box = source;
+        kernel.Ops.Add(op);
+        return kernel.Ops.Count() - 1;
+    }
+    if (node->GroupID == 3 && node->FastType != VariantType::Null)
+    {
+        // Math node (matches the typed fast-path of the VisjectExecutor::ProcessGroupMath)
+        const int32 components = GraphUtilities::CountComponents(node->FastType);
+        op.MathOp = node->TypeID;
+        op.Components = (byte)components;
+        if (IsKernelMath1(node->TypeID))
+        {
+            op.Code = ParticleEmitterGraphCPUKernel::OpCodes::Math1;
+            op.A = CompileKernelInput(kernel, node->GetBox(0), Variant::Zero, node->FastType);
+            if (op.A == -1 || kernel.Ops[op.A].Components != components)
+                return -1;
+        }
+        else if (IsKernelMath2(node->TypeID))
+        {
+            op.Code = ParticleEmitterGraphCPUKernel::OpCodes::Math2;
+            op.A = CompileKernelInput(kernel, node->GetBox(0), node->Values.Count() > 0 ? node->Values[0] : Variant::Zero, node->FastType);
+            if (op.A == -1)
+                return -1;
+            op.B = CompileKernelInput(kernel, node->GetBox(1), node->Values.Count() > 1 ? node->Values[1] : Variant::Zero, node->FastType);
+            if (op.B == -1)
+                return -1;
+            const int32 componentsA = kernel.Ops[op.A].Components;
+            const int32 componentsB = kernel.Ops[op.B].Components;
+            const int32 componentsMain = node->GetBox(0)->HasConnection() ? componentsA : componentsB;
+            if (componentsMain != components || (componentsA != 1 && componentsA != components) || (componentsB != 1 && componentsB != components))
+                return -1;
+        }
+        else
+        {
+            return -1;
+        }
+        if (kernel.Ops.Count() == PARTICLE_EMITTER_MAX_KERNEL_OPS)
+            return -1;
+        kernel.Ops.Add(op);
+        return kernel.Ops.Count() - 1;
+    }
+    return -1;
+}
+
+bool ParticleEmitterGraphCPUExecutor::ProcessKernel(ParticleEmitterGraphCPUNode* node, int32 particlesStart, int32 particlesEnd)
+{
+    auto& context = *Context.Get();
+    const auto& kernel = _graph._kernels[node->KernelIndex];
+    const auto buffer = context.Data->Buffer;
+    const auto layout = buffer->Layout;
+    const int32 stride = buffer->Stride;
+    const int32 opsCount = kernel.Ops.Count();
+    const int32 registerSize = 4 * PARTICLE_EMITTER_KERNEL_BATCH;
+    context.KernelRegisters.Resize(opsCount * registerSize, false);
+    float* registers = context.KernelRegisters.Get();
+#define REGISTER(index, component) (registers + (index) * registerSize + (component) * PARTICLE_EMITTER_KERNEL_BATCH)
+
+    // Setup registers with values that are the same for all particles
+    context.ParticleIndex = particlesStart;
+    for (int32 i = 0; i < opsCount; i++)
+    {
+        const auto& op = kernel.Ops.Get()[i];
+        GraphUtilities::FastValue value;
+        switch (op.Code)
+        {
+        case ParticleEmitterGraphCPUKernel::OpCodes::Constant:
+            Platform::MemoryCopy(value.Components, op.Value.Raw, sizeof(value.Components));
+            break;
+        case ParticleEmitterGraphCPUKernel::OpCodes::Uniform:
+            if (!GraphUtilities::LoadFastValue(eatBox(op.Caller, op.Box), op.Type, value))
+                return true;
+            break;
+        default:
+            continue;
+        }
+        for (int32 c = 0; c < op.Components; c++)
+        {
+            float* v = REGISTER(i, c);
+            for (int32 j = 0; j < PARTICLE_EMITTER_KERNEL_BATCH; j++)
+                v[j] = value.Components[c];
+        }
+    }
+
+    // Evaluate particles in batches (gather attributes, run operations over whole registers, scatter the result)
+    const auto& result = kernel.Ops.Last();
+    const auto& attribute = layout->Attributes[kernel.Attribute];
+    const int32 attributeComponents = GraphUtilities::CountComponents(GetKernelType(attribute.ValueType));
+    for (int32 batchStart = particlesStart; batchStart < particlesEnd; batchStart += PARTICLE_EMITTER_KERNEL_BATCH)
+    {
+        const int32 count = Math::Min(particlesEnd - batchStart, PARTICLE_EMITTER_KERNEL_BATCH);
+        byte* particles = buffer->GetParticleCPU(batchStart);
+        for (int32 i = 0; i < opsCount; i++)
+        {
+            const auto& op = kernel.Ops.Get()[i];
+            switch (op.Code)
+            {
+            case ParticleEmitterGraphCPUKernel::OpCodes::Attribute:
+            {
+                const byte* src = particles + layout->Attributes[op.A].Offset;
+                for (int32 c = 0; c < op.Components; c++)
+                {
+                    float* v = REGISTER(i, c);
+                    const byte* ptr = src + c * sizeof(float);
+                    for (int32 j = 0; j < count; j++)
+                    {
+                        v[j] = *(const float*)ptr;
+                        ptr += stride;
+                    }
+                }
+                break;
+            }
+            case ParticleEmitterGraphCPUKernel::OpCodes::NormalizedAge:
+            {
+                const byte* agePtr = particles + layout->Attributes[op.A].Offset;
+                const byte* lifetimePtr = particles + layout->Attributes[op.B].Offset;
+                float* v = REGISTER(i, 0);
+                for (int32 j = 0; j < count; j++)
+                {
+                    v[j] = *(const float*)agePtr / Math::Max(*(const float*)lifetimePtr, ZeroTolerance);
+                    agePtr += stride;
+                    lifetimePtr += stride;
+                }
+                break;
+            }
+            case ParticleEmitterGraphCPUKernel::OpCodes::Math1:
+                for (int32 c = 0; c < op.Components; c++)
+                    KernelMath(op.MathOp, REGISTER(i, c), REGISTER(op.A, c), count);
+                break;
+            case ParticleEmitterGraphCPUKernel::OpCodes::Math2:
+            {
+                const bool broadcastA = kernel.Ops.Get()[op.A].Components == 1;
+                const bool broadcastB = kernel.Ops.Get()[op.B].Components == 1;
+                for (int32 c = 0; c < op.Components; c++)
+                    KernelMath(op.MathOp, REGISTER(i, c), REGISTER(op.A, broadcastA ? 0 : c), REGISTER(op.B, broadcastB ? 0 : c), count);
+                break;
+            }
+            default:
+                break;
+            }
+        }
+
+        // Write the result into the particles
+        byte* dst = particles + attribute.Offset;
+        for (int32 c = 0; c < attributeComponents; c++)
+        {
+            const float* v = REGISTER(opsCount - 1, result.Components == 1 ? 0 : c);
+            byte* ptr = dst + c * sizeof(float);
+            for (int32 j = 0; j < count; j++)
+            {
+                *(float*)ptr = v[j];
+                ptr += stride;
+            }
+        }
+    }
+
+#undef REGISTER
+    return false;
+}
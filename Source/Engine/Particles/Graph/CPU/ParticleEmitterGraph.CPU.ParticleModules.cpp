@@ -1,6 +1,7 @@
 // Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
 
 #include "ParticleEmitterGraph.CPU.h"
+#include "Engine/Particles/ParticleEffect.h"
 #include "Engine/Core/Random.h"
 #include "Engine/Utilities/Noise.h"
 #include "Engine/Core/Types/CommonValue.h"
@@ -55,10 +56,8 @@ int32 ParticleEmitterGraphCPUExecutor::ProcessSpawnModule(int32 index)
     auto& context = *Context.Get();
     auto& data = context.Data->SpawnModulesData[index];
 
-    // Accumulate the previous frame fraction
-    float spawnCount = data.SpawnCounter;
-
     // Calculate particles to spawn during this frame
+    float spawnCount = 0.0f;
     switch (node->TypeID)
     {
     // Constant Spawn Rate
@@ -109,6 +108,9 @@ int32 ParticleEmitterGraphCPUExecutor::ProcessSpawnModule(int32 index)
     }
     }
 
+    // Scale by the effect simulation LOD and accumulate the previous frame fraction
+    spawnCount = data.SpawnCounter + spawnCount * context.Effect->GetLODSpawnRate();
+
     // Calculate actual spawn amount
     spawnCount = Math::Max(spawnCount, 0.0f);
     const int32 result = Math::FloorToInt(spawnCount);
@@ -543,6 +545,8 @@ void ParticleEmitterGraphCPUExecutor::ProcessModule(ParticleEmitterGraphCPUNode*
     case 302:
     {
         PARTICLE_EMITTER_MODULE("Set Attribute");
+        if (node->KernelIndex != -1 && !ProcessKernel(node, particlesStart, particlesEnd))
+            break;
         auto& attribute = context.Data->Buffer->Layout->Attributes[node->Attributes[0]];
         byte* dataPtr = start + attribute.Offset;
         int32 dataSize = attribute.GetSize();
@@ -601,6 +605,8 @@ void ParticleEmitterGraphCPUExecutor::ProcessModule(ParticleEmitterGraphCPUNode*
     case 363:
     {
         PARTICLE_EMITTER_MODULE("Set");
+        if (node->KernelIndex != -1 && !ProcessKernel(node, particlesStart, particlesEnd))
+            break;
         auto& attribute = context.Data->Buffer->Layout->Attributes[node->Attributes[0]];
         byte* dataPtr = start + attribute.Offset;
         int32 dataSize = attribute.GetSize();
@@ -7,6 +7,7 @@
 #include "Engine/Particles/ParticleEffect.h"
 #include "Engine/Engine/Time.h"
 #include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Threading/JobSystem.h"
 
 ThreadLocal<ParticleEmitterGraphCPUContext*> ParticleEmitterGraphCPUExecutor::Context;
 
@@ -89,6 +90,36 @@ bool ParticleEmitterGraphCPU::Load(ReadStream* stream, bool loadMeta)
         }
     }
 
+    // Lower modules inputs that are evaluated per-particle into kernels
+    CompileKernels();
+
+    // Check if modules can be processed over particle ranges in parallel
+    _parallelInit = true;
+    _parallelUpdate = true;
+    for (int32 i = 0; i < Nodes.Count(); i++)
+    {
+        const auto& node = Nodes[i];
+        if (node.Used && node.Type == GRAPH_NODE_MAKE_TYPE(14, 303))
+        {
+            // Particle Attribute (by index) reads data of the other particles
+            _parallelInit = false;
+            _parallelUpdate = false;
+        }
+    }
+    for (int32 i = 0; i < InitModules.Count(); i++)
+    {
+        // Position (spiral) progresses the state for each spawned particle
+        if (InitModules[i]->TypeID == 214)
+            _parallelInit = false;
+    }
+    for (int32 i = 0; i < UpdateModules.Count(); i++)
+    {
+        // Kill modules remove particles during the update
+        const int32 typeId = UpdateModules[i]->TypeID;
+        if (typeId == 306 || typeId == 307 || typeId == 308)
+            _parallelUpdate = false;
+    }
+
     return false;
 }
 
@@ -402,6 +433,7 @@ void ParticleEmitterGraphCPUExecutor::Draw(ParticleEmitter* emitter, ParticleEff
         lightData.CastVolumetricShadow = false;
         lightData.RenderedVolumetricFog = 0;
         lightData.ShadowsMode = ShadowsCastingMode::None;
+        lightData.ShadowsLODBias = 0;
         lightData.SourceRadius = 0.0f;
         lightData.SourceLength = 0.0f;
         lightData.IESTexture = nullptr;
@@ -434,77 +466,85 @@ void ParticleEmitterGraphCPUExecutor::Update(ParticleEmitter* emitter, ParticleE
     auto& context = Context.Get();
     auto& cpu = data.Buffer->CPU;
 
-    // Update particles
-    if (cpu.Count > 0)
+    if (_graph._parallelUpdate && cpu.Count >= PARTICLE_EMITTER_PARALLEL_MIN)
     {
-        PROFILE_CPU_NAMED("Update");
-        for (int32 i = 0; i < _graph.UpdateModules.Count(); i++)
-        {
-            ProcessModule(_graph.UpdateModules[i], 0, cpu.Count);
-        }
+        // Split large emitters into particle ranges processed by separate jobs
+        UpdateParallel(emitter, effect, data, dt);
     }
-
-    // Dead particles removal
-    if (_graph._attrAge != -1 && _graph._attrLifetime != -1)
+    else
     {
-        PROFILE_CPU_NAMED("Age kill");
-        byte* agePtr = cpu.Buffer.Get() + data.Buffer->Layout->Attributes[_graph._attrAge].Offset;
-        byte* lifetimePtr = cpu.Buffer.Get() + data.Buffer->Layout->Attributes[_graph._attrLifetime].Offset;
-        for (int32 particleIndex = 0; particleIndex < cpu.Count; particleIndex++)
+        // Update particles
+        if (cpu.Count > 0)
         {
-            if (*(float*)agePtr >= *(float*)lifetimePtr)
+            PROFILE_CPU_NAMED("Update");
+            for (int32 i = 0; i < _graph.UpdateModules.Count(); i++)
             {
-                cpu.Count--;
-                Platform::MemoryCopy(data.Buffer->GetParticleCPU(particleIndex), data.Buffer->GetParticleCPU(cpu.Count), data.Buffer->Stride);
-                particleIndex--;
+                ProcessModule(_graph.UpdateModules[i], 0, cpu.Count);
             }
-            else
+        }
+
+        // Dead particles removal
+        if (_graph._attrAge != -1 && _graph._attrLifetime != -1)
+        {
+            PROFILE_CPU_NAMED("Age kill");
+            byte* agePtr = cpu.Buffer.Get() + data.Buffer->Layout->Attributes[_graph._attrAge].Offset;
+            byte* lifetimePtr = cpu.Buffer.Get() + data.Buffer->Layout->Attributes[_graph._attrLifetime].Offset;
+            for (int32 particleIndex = 0; particleIndex < cpu.Count; particleIndex++)
             {
-                agePtr += data.Buffer->Stride;
-                lifetimePtr += data.Buffer->Stride;
+                if (*(float*)agePtr >= *(float*)lifetimePtr)
+                {
+                    cpu.Count--;
+                    Platform::MemoryCopy(data.Buffer->GetParticleCPU(particleIndex), data.Buffer->GetParticleCPU(cpu.Count), data.Buffer->Stride);
+                    particleIndex--;
+                }
+                else
+                {
+                    agePtr += data.Buffer->Stride;
+                    lifetimePtr += data.Buffer->Stride;
+                }
             }
         }
-    }
 
 #if BUILD_DEBUG && 0
-    // Debug validation for NANs in data
-    if (_graph._attrPosition != -1)
-    {
-        byte* positionPtr = cpu.Buffer.Get() + data.Buffer->Layout->Attributes[_graph._attrPosition].Offset;
-        for (int32 particleIndex = 0; particleIndex < cpu.Count; particleIndex++)
+        // Debug validation for NANs in data
+        if (_graph._attrPosition != -1)
         {
-            Float3 pos = *((Float3*)positionPtr);
-            ASSERT(!pos.IsNanOrInfinity());
-            positionPtr += data.Buffer->Stride;
+            byte* positionPtr = cpu.Buffer.Get() + data.Buffer->Layout->Attributes[_graph._attrPosition].Offset;
+            for (int32 particleIndex = 0; particleIndex < cpu.Count; particleIndex++)
+            {
+                Float3 pos = *((Float3*)positionPtr);
+                ASSERT(!pos.IsNanOrInfinity());
+                positionPtr += data.Buffer->Stride;
+            }
         }
-    }
 #endif
 
-    // Euler integration
-    if (_graph._attrPosition != -1 && _graph._attrVelocity != -1)
-    {
-        PROFILE_CPU_NAMED("Euler Integration");
-        byte* positionPtr = cpu.Buffer.Get() + data.Buffer->Layout->Attributes[_graph._attrPosition].Offset;
-        byte* velocityPtr = cpu.Buffer.Get() + data.Buffer->Layout->Attributes[_graph._attrVelocity].Offset;
-        for (int32 particleIndex = 0; particleIndex < cpu.Count; particleIndex++)
+        // Euler integration
+        if (_graph._attrPosition != -1 && _graph._attrVelocity != -1)
         {
-            *((Float3*)positionPtr) += *((Float3*)velocityPtr) * dt;
-            positionPtr += data.Buffer->Stride;
-            velocityPtr += data.Buffer->Stride;
+            PROFILE_CPU_NAMED("Euler Integration");
+            byte* positionPtr = cpu.Buffer.Get() + data.Buffer->Layout->Attributes[_graph._attrPosition].Offset;
+            byte* velocityPtr = cpu.Buffer.Get() + data.Buffer->Layout->Attributes[_graph._attrVelocity].Offset;
+            for (int32 particleIndex = 0; particleIndex < cpu.Count; particleIndex++)
+            {
+                *((Float3*)positionPtr) += *((Float3*)velocityPtr) * dt;
+                positionPtr += data.Buffer->Stride;
+                velocityPtr += data.Buffer->Stride;
+            }
         }
-    }
 
-    // Angular Euler Integration
-    if (_graph._attrRotation != -1 && _graph._attrAngularVelocity != -1)
-    {
-        PROFILE_CPU_NAMED("Angular Euler Integration");
-        byte* rotationPtr = cpu.Buffer.Get() + data.Buffer->Layout->Attributes[_graph._attrRotation].Offset;
-        byte* angularVelocityPtr = cpu.Buffer.Get() + data.Buffer->Layout->Attributes[_graph._attrAngularVelocity].Offset;
-        for (int32 particleIndex = 0; particleIndex < cpu.Count; particleIndex++)
+        // Angular Euler Integration
+        if (_graph._attrRotation != -1 && _graph._attrAngularVelocity != -1)
         {
-            *((Float3*)rotationPtr) += *((Float3*)angularVelocityPtr) * dt;
-            rotationPtr += data.Buffer->Stride;
-            angularVelocityPtr += data.Buffer->Stride;
+            PROFILE_CPU_NAMED("Angular Euler Integration");
+            byte* rotationPtr = cpu.Buffer.Get() + data.Buffer->Layout->Attributes[_graph._attrRotation].Offset;
+            byte* angularVelocityPtr = cpu.Buffer.Get() + data.Buffer->Layout->Attributes[_graph._attrAngularVelocity].Offset;
+            for (int32 particleIndex = 0; particleIndex < cpu.Count; particleIndex++)
+            {
+                *((Float3*)rotationPtr) += *((Float3*)angularVelocityPtr) * dt;
+                rotationPtr += data.Buffer->Stride;
+                angularVelocityPtr += data.Buffer->Stride;
+            }
         }
     }
 
@@ -534,9 +574,16 @@ void ParticleEmitterGraphCPUExecutor::Update(ParticleEmitter* emitter, ParticleE
                 Platform::MemoryCopy(data.Buffer->GetParticleCPU(countBefore + i), _graph._defaultParticleData.Get(), data.Buffer->Stride);
 
             // Initialize particles
-            for (int32 i = 0; i < _graph.InitModules.Count(); i++)
+            if (_graph._parallelInit && spawnCount >= PARTICLE_EMITTER_PARALLEL_MIN)
             {
-                ProcessModule(_graph.InitModules[i], countBefore, countAfter);
+                InitParallel(emitter, effect, data, dt, countBefore, countAfter);
+            }
+            else
+            {
+                for (int32 i = 0; i < _graph.InitModules.Count(); i++)
+                {
+                    ProcessModule(_graph.InitModules[i], countBefore, countAfter);
+                }
             }
         }
     }
@@ -569,6 +616,110 @@ void ParticleEmitterGraphCPUExecutor::Update(ParticleEmitter* emitter, ParticleE
     }
 }
 
+void ParticleEmitterGraphCPUExecutor::UpdateParallel(ParticleEmitter* emitter, ParticleEffect* effect, ParticleEmitterInstance& data, float dt)
+{
+    PROFILE_CPU_NAMED("Update");
+    auto& cpu = data.Buffer->CPU;
+    const int32 count = cpu.Count;
+    const int32 stride = data.Buffer->Stride;
+    const auto layout = data.Buffer->Layout;
+    const int32 rangesCount = Math::DivideAndRoundUp(count, PARTICLE_EMITTER_PARALLEL_RANGE);
+    const bool ageKill = _graph._attrAge != -1 && _graph._attrLifetime != -1;
+    Array<int32> deadIndices, deadCounts;
+    if (ageKill)
+    {
+        deadIndices.Resize(count, false);
+        deadCounts.Resize(rangesCount, false);
+    }
+
+    // Update particles, integrate them and find the dead ones (each job processes a separate range of particles)
+    JobSystem::Execute([&](int32 rangeIndex)
+    {
+        const int32 particlesStart = rangeIndex * PARTICLE_EMITTER_PARALLEL_RANGE;
+        const int32 particlesEnd = Math::Min(particlesStart + PARTICLE_EMITTER_PARALLEL_RANGE, count);
+        Init(emitter, effect, data, dt);
+        for (int32 i = 0; i < _graph.UpdateModules.Count(); i++)
+        {
+            ProcessModule(_graph.UpdateModules[i], particlesStart, particlesEnd);
+        }
+        byte* start = data.Buffer->GetParticleCPU(particlesStart);
+        if (_graph._attrPosition != -1 && _graph._attrVelocity != -1)
+        {
+            byte* positionPtr = start + layout->Attributes[_graph._attrPosition].Offset;
+            byte* velocityPtr = start + layout->Attributes[_graph._attrVelocity].Offset;
+            for (int32 particleIndex = particlesStart; particleIndex < particlesEnd; particleIndex++)
+            {
+                *((Float3*)positionPtr) += *((Float3*)velocityPtr) * dt;
+                positionPtr += stride;
+                velocityPtr += stride;
+            }
+        }
+        if (_graph._attrRotation != -1 && _graph._attrAngularVelocity != -1)
+        {
+            byte* rotationPtr = start + layout->Attributes[_graph._attrRotation].Offset;
+            byte* angularVelocityPtr = start + layout->Attributes[_graph._attrAngularVelocity].Offset;
+            for (int32 particleIndex = particlesStart; particleIndex < particlesEnd; particleIndex++)
+            {
+                *((Float3*)rotationPtr) += *((Float3*)angularVelocityPtr) * dt;
+                rotationPtr += stride;
+                angularVelocityPtr += stride;
+            }
+        }
+        if (ageKill)
+        {
+            const byte* agePtr = start + layout->Attributes[_graph._attrAge].Offset;
+            const byte* lifetimePtr = start + layout->Attributes[_graph._attrLifetime].Offset;
+            int32* dead = deadIndices.Get() + particlesStart;
+            int32 deadCount = 0;
+            for (int32 particleIndex = particlesStart; particleIndex < particlesEnd; particleIndex++)
+            {
+                if (*(const float*)agePtr >= *(const float*)lifetimePtr)
+                    dead[deadCount++] = particleIndex;
+                agePtr += stride;
+                lifetimePtr += stride;
+            }
+            deadCounts[rangeIndex] = deadCount;
+        }
+    }, rangesCount, 1, JobPriority::High);
+
+    // Dead particles removal (in descending order so the particle moved from the end is always alive)
+    if (ageKill)
+    {
+        PROFILE_CPU_NAMED("Age kill");
+        for (int32 rangeIndex = rangesCount - 1; rangeIndex >= 0; rangeIndex--)
+        {
+            const int32* dead = deadIndices.Get() + rangeIndex * PARTICLE_EMITTER_PARALLEL_RANGE;
+            for (int32 i = deadCounts[rangeIndex] - 1; i >= 0; i--)
+            {
+                cpu.Count--;
+                if (dead[i] != cpu.Count)
+                    Platform::MemoryCopy(data.Buffer->GetParticleCPU(dead[i]), data.Buffer->GetParticleCPU(cpu.Count), stride);
+            }
+        }
+    }
+
+    // Restore context (waiting thread could execute other particles jobs in the meantime)
+    Init(emitter, effect, data, dt);
+}
+
+void ParticleEmitterGraphCPUExecutor::InitParallel(ParticleEmitter* emitter, ParticleEffect* effect, ParticleEmitterInstance& data, float dt, int32 particlesStart, int32 particlesEnd)
+{
+    const int32 rangesCount = Math::DivideAndRoundUp(particlesEnd - particlesStart, PARTICLE_EMITTER_PARALLEL_RANGE);
+    JobSystem::Execute([&](int32 rangeIndex)
+    {
+        const int32 rangeStart = particlesStart + rangeIndex * PARTICLE_EMITTER_PARALLEL_RANGE;
+        const int32 rangeEnd = Math::Min(rangeStart + PARTICLE_EMITTER_PARALLEL_RANGE, particlesEnd);
+        Init(emitter, effect, data, dt);
+        for (int32 i = 0; i < _graph.InitModules.Count(); i++)
+        {
+            ProcessModule(_graph.InitModules[i], rangeStart, rangeEnd);
+        }
+    }, rangesCount, 1, JobPriority::High);
+
+    // Restore context (waiting thread could execute other particles jobs in the meantime)
+    Init(emitter, effect, data, dt);
+}
+
 int32 ParticleEmitterGraphCPUExecutor::UpdateSpawn(ParticleEmitter* emitter, ParticleEffect* effect, ParticleEmitterInstance& data, float dt)
 {
     PROFILE_CPU_NAMED("Spawn");
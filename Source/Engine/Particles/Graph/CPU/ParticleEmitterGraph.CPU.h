@@ -30,6 +30,18 @@ class ParticleEmitterGraphCPUExecutor;
 
 #define PARTICLE_EMITTER_MAX_CALL_STACK 100
 
+// The maximum amount of operations in the compiled particle module kernel
+#define PARTICLE_EMITTER_MAX_KERNEL_OPS 16
+
+// The amount of particles processed at once by the compiled particle module kernel (lanes of the kernel registers)
+#define PARTICLE_EMITTER_KERNEL_BATCH 64
+
+// The minimum amount of particles to split the CPU emitter simulation into particle ranges processed by separate jobs
+#define PARTICLE_EMITTER_PARALLEL_MIN 16384
+
+// The amount of particles processed by a single job when simulating large CPU emitters
+#define PARTICLE_EMITTER_PARALLEL_RANGE 4096
+
 class ParticleEmitterGraphCPUBox : public VisjectGraphBox
 {
 };
@@ -48,6 +60,11 @@ class ParticleEmitterGraphCPUNode : public ParticleEmitterGraphNode<VisjectGraph
         int32 RibbonOrderOffset;
     };
 
+    /// <summary>
+    /// The index of the compiled kernel used to evaluate the module input over particles (see ParticleEmitterGraphCPU::_kernels), or -1 if module uses the generic per-particle graph evaluation.
+    /// </summary>
+    int32 KernelIndex = -1;
+
     /// <summary>
     /// True if this node uses the per-particle data resolve instead of optimized whole-collection fetch.
     /// </summary>
@@ -57,6 +74,55 @@ class ParticleEmitterGraphCPUNode : public ParticleEmitterGraphNode<VisjectGraph
     }
 };
 
+/// <summary>
+/// The particle module input compiled on graph load into a linear program of typed operations evaluated over batches of particles. Attributes are gathered from the particles buffer into the per-component arrays (registers) so the math runs in tight loops over many particles at once (vectorized by the compiler) instead of the per-particle graph evaluation with Variant values.
+/// </summary>
+struct ParticleEmitterGraphCPUKernel
+{
+    enum class OpCodes : byte
+    {
+        // Constant value (default value of the unconnected box).
+        Constant,
+        // Value that is the same for all particles (eg. parameter), evaluated once per module update via graph.
+        Uniform,
+        // Particle attribute read.
+        Attribute,
+        // Particle age divided by lifetime.
+        NormalizedAge,
+        // Math node with a single input.
+        Math1,
+        // Math node with two inputs.
+        Math2,
+    };
+
+    struct Op
+    {
+        OpCodes Code;
+        // The amount of the value components (1-4).
+        byte Components;
+        // The math node type identifier.
+        uint16 MathOp;
+        // The input registers (math) or attribute indices (particle data).
+        int32 A, B;
+        // The constant value.
+        Float4 Value;
+        // The uniform value source node, box and type.
+        ParticleEmitterGraphCPUNode* Caller;
+        ParticleEmitterGraphCPUBox* Box;
+        VariantType::Types Type;
+    };
+
+    /// <summary>
+    /// The kernel operations. Each operation writes to the register of the same index, the last one is the kernel result.
+    /// </summary>
+    Array<Op, FixedAllocation<PARTICLE_EMITTER_MAX_KERNEL_OPS>> Ops;
+
+    /// <summary>
+    /// The particle attribute index to write the result to.
+    /// </summary>
+    int32 Attribute;
+};
+
 /// <summary>
 /// The Particle Emitter Graph used to simulate CPU particles.
 /// </summary>
@@ -75,6 +141,17 @@ class ParticleEmitterGraphCPU : public ParticleEmitterGraph<VisjectGraph<Particl
 
     Array<byte> _defaultParticleData;
 
+    // Compiled modules kernels (see ParticleEmitterGraphCPUNode::KernelIndex).
+    Array<ParticleEmitterGraphCPUKernel> _kernels;
+
+    // True if init/update modules have no cross-particle dependencies (eg. kill modules or reading other particles data) and can be processed over particle ranges in parallel.
+    bool _parallelInit = false;
+    bool _parallelUpdate = false;
+
+    void CompileKernels();
+    bool CompileKernel(ParticleEmitterGraphCPUNode* module, int32 defaultValueIndex);
+    int32 CompileKernelInput(ParticleEmitterGraphCPUKernel& kernel, ParticleEmitterGraphCPUBox* box, const Variant& defaultValue, VariantType::Types defaultType);
+
 public:
     // Size of the custom pre-node data buffer used for state tracking (eg. position on spiral arc progression).
     int32 CustomDataSize = 0;
@@ -122,6 +199,7 @@ struct ParticleEmitterGraphCPUContext
     byte AttributesRemappingTable[PARTICLE_ATTRIBUTES_MAX_COUNT]; // Maps node attribute indices to the current particle layout (used to support accessing particle data from function graph which has different layout).
     int32 CallStackSize = 0;
     VisjectExecutor::Node* CallStack[PARTICLE_EMITTER_MAX_CALL_STACK];
+    Array<float> KernelRegisters;
 };
 
 /// <summary>
@@ -184,6 +262,8 @@ class ParticleEmitterGraphCPUExecutor : public VisjectExecutor
 
 private:
     void Init(ParticleEmitter* emitter, ParticleEffect* effect, ParticleEmitterInstance& data, float dt = 0.0f);
+    void UpdateParallel(ParticleEmitter* emitter, ParticleEffect* effect, ParticleEmitterInstance& data, float dt);
+    void InitParallel(ParticleEmitter* emitter, ParticleEffect* effect, ParticleEmitterInstance& data, float dt, int32 particlesStart, int32 particlesEnd);
     Value eatBox(Node* caller, Box* box) override;
     Graph* GetCurrentGraph() const override;
 
@@ -195,6 +275,7 @@ class ParticleEmitterGraphCPUExecutor : public VisjectExecutor
 
     int32 ProcessSpawnModule(int32 index);
     void ProcessModule(ParticleEmitterGraphCPUNode* node, int32 particlesStart, int32 particlesEnd);
+    bool ProcessKernel(ParticleEmitterGraphCPUNode* node, int32 particlesStart, int32 particlesEnd);
 
     FORCE_INLINE Value GetValue(Box* box, int32 defaultValueBoxIndex)
     {
@@ -10,6 +10,9 @@
 #include "Engine/Engine/Time.h"
 #include "Engine/Engine/Engine.h"
 
+// The maximum simulation level of detail (update every 2^LOD frames)
+#define PARTICLE_EFFECT_MAX_LOD 3
+
 ParticleEffect::ParticleEffect(const SpawnParams& params)
     : Actor(params)
     , _lastUpdateFrame(0)
@@ -275,6 +278,16 @@ void ParticleEffect::UpdateSimulation(bool singleFrame)
 
     // Request update
     _lastUpdateFrame = Engine::UpdateCount;
+    if (_lastMinDstSqr < MAX_Real)
+    {
+        // Estimate the screen size from the closest view distance during the last frames
+        const Real distance = Math::Max(Math::Sqrt(_lastMinDstSqr), (Real)1.0f);
+        _significance = SignificancePriority * (float)(Math::Max(_sphere.Radius, (Real)1.0f) / distance);
+    }
+    else
+    {
+        _significance = 0.0f;
+    }
     _lastMinDstSqr = MAX_Real;
     if (singleFrame)
         Instance.LastUpdateTime = (UseTimeScale ? Time::Update.Time : Time::Update.UnscaledTime).GetTotalSeconds();
@@ -425,6 +438,7 @@ void ParticleEffect::Update()
     {
         // Move update timer forward while paused for correct delta time after unpause
         Instance.LastUpdateTime = (UseTimeScale ? Time::Update.Time : Time::Update.UnscaledTime).GetTotalSeconds();
+        _isCulledByBudget = false;
         return;
     }
 
@@ -432,6 +446,16 @@ void ParticleEffect::Update()
     if (!UpdateWhenOffscreen && _lastMinDstSqr >= MAX_Real)
         return;
 
+    // Reduce the simulation rate of the distant effects
+    _lodSpawnRate = 1.0f;
+    if (LODDistance > 0.0f && _lastMinDstSqr < MAX_Real)
+    {
+        const int32 lod = Math::Min((int32)(Math::Sqrt(_lastMinDstSqr) / LODDistance), PARTICLE_EFFECT_MAX_LOD);
+        if (Engine::UpdateCount - _lastUpdateFrame < (1ull << lod))
+            return;
+        _lodSpawnRate = Math::Pow(Math::Saturate(LODSpawnRateScale), (float)lod);
+    }
+
     if (UpdateMode == SimulationUpdateMode::FixedTimestep)
     {
         // Check if last simulation update was past enough to kick a new on
@@ -541,6 +565,8 @@ void ParticleEffect::Draw(RenderContext& renderContext)
     if (renderContext.View.Pass == DrawPass::GlobalSDF || renderContext.View.Pass == DrawPass::GlobalSurfaceAtlas)
         return;
     _lastMinDstSqr = Math::Min(_lastMinDstSqr, Vector3::DistanceSquared(GetPosition(), renderContext.View.Position));
+    if (_isCulledByBudget)
+        return;
     Particles::DrawParticles(renderContext, this);
 }
 
@@ -620,6 +646,10 @@ void ParticleEffect::Serialize(SerializeStream& stream, const void* otherObj)
     SERIALIZE(IsLooping);
     SERIALIZE(PlayOnStart);
     SERIALIZE(UpdateWhenOffscreen);
+    SERIALIZE(LODDistance);
+    SERIALIZE(LODSpawnRateScale);
+    SERIALIZE(SignificancePriority);
+    SERIALIZE(PrewarmDuration);
     SERIALIZE(DrawModes);
     SERIALIZE(SortOrder);
 }
@@ -721,6 +751,10 @@ void ParticleEffect::Deserialize(DeserializeStream& stream, ISerializeModifier*
     DESERIALIZE(IsLooping);
     DESERIALIZE(PlayOnStart);
     DESERIALIZE(UpdateWhenOffscreen);
+    DESERIALIZE(LODDistance);
+    DESERIALIZE(LODSpawnRateScale);
+    DESERIALIZE(SignificancePriority);
+    DESERIALIZE(PrewarmDuration);
     DESERIALIZE(DrawModes);
     DESERIALIZE(SortOrder);
 
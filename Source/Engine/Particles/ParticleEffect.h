@@ -180,6 +180,9 @@ class FLAXENGINE_API ParticleEffect : public Actor
 private:
     uint64 _lastUpdateFrame;
     Real _lastMinDstSqr;
+    float _lodSpawnRate = 1.0f;
+    float _significance = 0.0f;
+    bool _isCulledByBudget = false;
     int32 _sceneRenderingKey = -1;
     uint32 _parametersVersion = 0; // Version number for _parameters to be in sync with Instance.ParametersVersion
     Array<ParticleEffectParameter> _parameters; // Cached for scripting API
@@ -248,6 +251,30 @@ class FLAXENGINE_API ParticleEffect : public Actor
     API_FIELD(Attributes="EditorDisplay(\"Particle Effect\"), DefaultValue(true), EditorOrder(70)")
     bool UpdateWhenOffscreen = true;
 
+    /// <summary>
+    /// The distance from the view (in world units) at which the simulation level of detail starts to kick in. Every multiple of this distance halves the simulation update rate (up to the 1/8 of the frame rate) and scales the spawn rate by the LODSpawnRateScale. Use 0 to disable simulation LOD.
+    /// </summary>
+    API_FIELD(Attributes="EditorDisplay(\"Particle Effect\", \"LOD Distance\"), DefaultValue(0.0f), EditorOrder(71), Limit(0)")
+    float LODDistance = 0.0f;
+
+    /// <summary>
+    /// The spawn rate scale applied for every simulation level of detail (eg. 0.5 halves the amount of spawned particles at LOD 1 and quarters it at LOD 2). Used only if LODDistance is set.
+    /// </summary>
+    API_FIELD(Attributes="EditorDisplay(\"Particle Effect\", \"LOD Spawn Rate Scale\"), DefaultValue(0.5f), EditorOrder(72), Limit(0, 1, 0.01f)")
+    float LODSpawnRateScale = 0.5f;
+
+    /// <summary>
+    /// The priority of the effect used when the global particles budgets are exceeded (see Particles class). The significance of the effect is its priority multiplied by the screen size, the least significant effects get paused and culled first.
+    /// </summary>
+    API_FIELD(Attributes="EditorDisplay(\"Particle Effect\"), DefaultValue(1.0f), EditorOrder(73), Limit(0)")
+    float SignificancePriority = 1.0f;
+
+    /// <summary>
+    /// The duration (in seconds) of the simulation performed when the effect starts so it begins in the warmed-up state (eg. smoke already filling the area). The prewarmed state is simulated once per particle system with a fixed timestep and cached so other effects copy it instead of re-simulating. Only CPU emitters are prewarmed.
+    /// </summary>
+    API_FIELD(Attributes="EditorDisplay(\"Particle Effect\"), DefaultValue(0.0f), EditorOrder(74), Limit(0)")
+    float PrewarmDuration = 0.0f;
+
     /// <summary>
     /// The draw passes to use for rendering this object.
     /// </summary>
@@ -261,6 +288,39 @@ class FLAXENGINE_API ParticleEffect : public Actor
     int16 SortOrder = 0;
 
 public:
+    /// <summary>
+    /// Gets the spawn rate scale of the current simulation level of detail (see LODDistance).
+    /// </summary>
+    API_PROPERTY() FORCE_INLINE float GetLODSpawnRate() const
+    {
+        return _lodSpawnRate;
+    }
+
+    /// <summary>
+    /// Gets the significance of the effect (priority multiplied by the screen size from the last frame). Zero if the effect is not visible.
+    /// </summary>
+    API_PROPERTY() FORCE_INLINE float GetSignificance() const
+    {
+        return _significance;
+    }
+
+    /// <summary>
+    /// Gets a value indicating whether the effect has been paused and culled due to the global particles budgets.
+    /// </summary>
+    API_PROPERTY() FORCE_INLINE bool IsCulledByBudget() const
+    {
+        return _isCulledByBudget;
+    }
+
+    /// <summary>
+    /// Sets the culled by budget state. Used internally by the particles simulation service.
+    /// </summary>
+    /// <param name="value">True if the effect simulation is paused and drawing is culled.</param>
+    void SetCulledByBudget(bool value)
+    {
+        _isCulledByBudget = value;
+    }
+
     /// <summary>
     /// Gets the effect parameters collection. Those parameters are instanced from the <see cref="ParticleSystem"/> that contains a linear list of emitters and every emitter has a list of own parameters.
     /// </summary>
@@ -96,11 +96,36 @@ struct EmitterCache
     ParticleBuffer* Buffer;
 };
 
+// The simulation rate used to prewarm the particle effects
+#define PARTICLES_PREWARM_FPS 30.0f
+
+struct PrewarmSnapshot
+{
+    struct EmitterData
+    {
+        uint32 Version;
+        float Time;
+        Array<ParticleEmitterInstance::SpawnerData> SpawnModulesData;
+        Array<byte> CustomData;
+        int32 Count;
+        Array<byte> Data;
+    };
+
+    uint32 Version = 0;
+    float Duration = 0.0f;
+    float Time = 0.0f;
+    Array<EmitterData> Emitters;
+};
+
 namespace ParticleManagerImpl
 {
     CriticalSection PoolLocker;
     Dictionary<ParticleEmitter*, Array<EmitterCache>> Pool;
+    Dictionary<ParticleEmitter*, int32> PoolReserve;
+    CriticalSection PrewarmLocker;
+    Dictionary<ParticleSystem*, PrewarmSnapshot> PrewarmSnapshots;
     Array<ParticleEffect*> UpdateList;
+    ParticlesStats Stats;
 #if COMPILE_WITH_GPU_PARTICLES
     CriticalSection GpuUpdateListLocker;
     Array<ParticleEffect*> GpuUpdateList;
@@ -113,6 +138,9 @@ using namespace ParticleManagerImpl;
 TaskGraphSystem* Particles::System = nullptr;
 bool Particles::EnableParticleBufferPooling = true;
 float Particles::ParticleBufferRecycleTimeout = 10.0f;
+int32 Particles::MaxUpdatedEffects = 0;
+int32 Particles::CPUParticlesBudget = 0;
+int32 Particles::GPUParticlesBudget = 0;
 
 SpriteParticleRenderer SpriteRenderer;
 
@@ -140,6 +168,9 @@ class ParticlesSystem : public TaskGraphSystem
 public:
     float DeltaTime, UnscaledDeltaTime, Time, UnscaledTime;
     void Job(int32 index);
+    void UpdateEmitters(ParticleEffect* effect, ParticleSystem* particleSystem, float dt, bool prewarm, bool& updateBounds, bool& updateGpu);
+    void Prewarm(ParticleEffect* effect, ParticleSystem* particleSystem);
+    void ApplyBudgets();
     void Execute(TaskGraph* graph) override;
     void PostExecute(TaskGraph* graph) override;
 };
@@ -151,6 +182,11 @@ void Particles::UpdateEffect(ParticleEffect* effect)
     UpdateList.Add(effect);
 }
 
+ParticlesStats Particles::GetStats()
+{
+    return Stats;
+}
+
 void Particles::OnEffectDestroy(ParticleEffect* effect)
 {
     UpdateList.Remove(effect);
@@ -463,7 +499,7 @@ void DrawEmitterCPU(RenderContext& renderContext, ParticleBuffer* buffer, DrawCa
             for (int32 meshIndex = 0; meshIndex < lod.Meshes.Count(); meshIndex++)
             {
                 Mesh& mesh = lod.Meshes[meshIndex];
-                if (!mesh.IsInitialized())
+                if (!mesh.IsInitialized() || mesh.GetPositionsQuantization().IsValid()) // Particle materials don't decode quantized positions
                     continue;
                 // TODO: include mesh entry transformation, visibility and shadows mode?
 
@@ -577,6 +613,14 @@ PACK_STRUCT(struct GPUParticlesSortingData {
     uint32 PositionOffset;
     uint32 CustomOffset;
     Matrix PositionTransform;
+    Matrix CullingTransform;
+    Float4 CullingPlanes[6];
+    int32 SpriteSizeOffset;
+    int32 ScaleOffset;
+    float ModelRadius;
+    float CullingScale;
+    uint32 CullingEnabled;
+    Float3 Dummy0;
     });
 
 AssetReference<Shader> GPUParticlesSorting;
@@ -604,6 +648,7 @@ void DrawEmitterGPU(RenderContext& renderContext, ParticleBuffer* buffer, DrawCa
     auto emitter = buffer->Emitter;
 
     // Check if need to perform any particles sorting
+    bool culled = false;
     if (emitter->Graph.SortModules.HasItems() && renderContext.View.Pass != DrawPass::Depth)
     {
         PROFILE_GPU_CPU_NAMED("Sort Particles");
@@ -633,7 +678,46 @@ void DrawEmitterGPU(RenderContext& renderContext, ParticleBuffer* buffer, DrawCa
         // Prepare sorting data
         if (!buffer->GPU.SortedIndices)
             buffer->AllocateSortBuffer();
-        ASSERT(buffer->GPU.SortingKeysBuffer);
+        ASSERT(buffer->GPU.SortingKeysBuffer && buffer->GPU.VisibleCounter);
+
+        // Setup per-view culling of the particles (sorting keys are written only for the visible particles)
+        const int32 positionOffset = emitter->Graph.GetPositionAttributeOffset();
+        const int32 spriteSizeOffset = emitter->Graph.Layout.FindAttributeOffset(TEXT("SpriteSize"), ParticleAttribute::ValueTypes::Float2, -1);
+        const int32 scaleOffset = emitter->Graph.Layout.FindAttributeOffset(TEXT("Scale"), ParticleAttribute::ValueTypes::Float3, -1);
+        bool cullingEnabled = positionOffset != -1;
+        float modelRadius = 0.0f;
+        for (int32 index = 0; index < renderModulesIndices.Count(); index++)
+        {
+            auto module = emitter->Graph.RenderModules[renderModulesIndices[index]];
+            if (module->TypeID == 400 && spriteSizeOffset == -1)
+            {
+                // Unknown sprite size
+                cullingEnabled = false;
+            }
+            else if (module->TypeID == 403)
+            {
+                const auto model = (Model*)module->Assets[0].Get();
+                const BoundingBox box = model->GetBox();
+                modelRadius = Math::Max(modelRadius, (float)Math::Max(box.Minimum.Length(), box.Maximum.Length()));
+            }
+        }
+        Matrix cullingTransform;
+        float cullingScale = 1.0f;
+        if (emitter->SimulationSpace == ParticlesSimulationSpace::Local)
+        {
+            Matrix::Transpose(drawCall.World, cullingTransform);
+            cullingScale = drawCall.World.GetScaleVector().GetAbsolute().MaxValue();
+        }
+        else
+        {
+            Matrix::Transpose(Matrix::Identity, cullingTransform);
+        }
+        Float4 cullingPlanes[6];
+        for (int32 i = 0; i < 6; i++)
+        {
+            const Plane plane = renderContext.View.CullingFrustum.GetPlane(i);
+            cullingPlanes[i] = Float4(Float3(plane.Normal), (float)plane.D);
+        }
 
         // Execute all sorting modules
         for (int32 moduleIndex = 0; moduleIndex < emitter->Graph.SortModules.Count(); moduleIndex++)
@@ -646,6 +730,14 @@ void DrawEmitterGPU(RenderContext& renderContext, ParticleBuffer* buffer, DrawCa
             data.ParticleCounterOffset = buffer->GPU.ParticleCounterOffset;
             data.ParticleStride = buffer->Stride;
             data.ParticleCapacity = buffer->Capacity;
+            data.CullingTransform = cullingTransform;
+            Platform::MemoryCopy(data.CullingPlanes, cullingPlanes, sizeof(cullingPlanes));
+            data.SpriteSizeOffset = spriteSizeOffset;
+            data.ScaleOffset = scaleOffset;
+            data.ModelRadius = modelRadius;
+            data.CullingScale = cullingScale;
+            data.CullingEnabled = cullingEnabled ? 1 : 0;
+            data.Dummy0 = Float3::Zero;
             int32 permutationIndex;
             bool sortAscending;
             switch (sortMode)
@@ -654,7 +746,7 @@ void DrawEmitterGPU(RenderContext& renderContext, ParticleBuffer* buffer, DrawCa
             {
                 permutationIndex = 0;
                 sortAscending = false;
-                data.PositionOffset = emitter->Graph.GetPositionAttributeOffset();
+                data.PositionOffset = positionOffset;
                 const Matrix viewProjection = renderContext.View.ViewProjection();
                 if (emitter->SimulationSpace == ParticlesSimulationSpace::Local)
                 {
@@ -672,7 +764,7 @@ void DrawEmitterGPU(RenderContext& renderContext, ParticleBuffer* buffer, DrawCa
             {
                 permutationIndex = 1;
                 sortAscending = false;
-                data.PositionOffset = emitter->Graph.GetPositionAttributeOffset();
+                data.PositionOffset = positionOffset;
                 data.ViewPosition = renderContext.View.Position;
                 if (emitter->SimulationSpace == ParticlesSimulationSpace::Local)
                 {
@@ -692,6 +784,7 @@ void DrawEmitterGPU(RenderContext& renderContext, ParticleBuffer* buffer, DrawCa
                 int32 attributeIdx = module->Attributes[0];
                 if (attributeIdx == -1)
                     break;
+                data.PositionOffset = positionOffset;
                 data.CustomOffset = emitter->Graph.Layout.Attributes[attributeIdx].Offset;
                 break;
             }
@@ -701,17 +794,23 @@ void DrawEmitterGPU(RenderContext& renderContext, ParticleBuffer* buffer, DrawCa
                 return;
 #endif
             }
+            const uint32 visibleCounter = 0;
+            context->UpdateBuffer(buffer->GPU.VisibleCounter, &visibleCounter, sizeof(visibleCounter));
             context->UpdateCB(GPUParticlesSortingCB, &data);
             context->BindCB(0, GPUParticlesSortingCB);
             context->BindSR(0, buffer->GPU.Buffer->View());
             context->BindUA(0, buffer->GPU.SortingKeysBuffer->View());
+            context->BindUA(1, buffer->GPU.VisibleCounter->View());
             // TODO: optimize it by using DispatchIndirect with shared invoke args generated after particles update
             const int32 threadGroupSize = 1024;
             context->Dispatch(GPUParticlesSortingCS[permutationIndex], Math::DivideAndRoundUp(buffer->GPU.ParticlesCountMax, threadGroupSize), 1, 1);
 
-            // Perform sorting
-            BitonicSort::Instance()->Sort(context, buffer->GPU.SortingKeysBuffer, buffer->GPU.Buffer, data.ParticleCounterOffset, sortAscending, buffer->GPU.SortedIndices);
+            context->ResetUA();
+
+            // Perform sorting (of the visible particles only)
+            BitonicSort::Instance()->Sort(context, buffer->GPU.SortingKeysBuffer, buffer->GPU.VisibleCounter, 0, sortAscending, buffer->GPU.SortedIndices);
         }
+        culled = true;
     }
 
     // Count draw calls to perform during this emitter rendering
@@ -764,8 +863,10 @@ void DrawEmitterGPU(RenderContext& renderContext, ParticleBuffer* buffer, DrawCa
     if (drawCalls == 0)
         return;
 
-    // Ensure to have enough space for indirect draw arguments
-    const uint32 minSize = drawCalls * sizeof(GPUDrawIndexedIndirectArgs);
+    // Ensure to have enough space for indirect draw arguments (sorted emitters use a separate region for the views with culled particles)
+    const uint32 culledArgsOffset = drawCalls * sizeof(GPUDrawIndexedIndirectArgs);
+    const uint32 argsOffset = culled ? culledArgsOffset : 0;
+    const uint32 minSize = emitter->Graph.SortModules.HasItems() ? culledArgsOffset * 2 : culledArgsOffset;
     if (buffer->GPU.IndirectDrawArgsBuffer->GetSize() < minSize)
     {
         buffer->GPU.IndirectDrawArgsBuffer->Init(GPUBufferDescription::Argument(minSize));
@@ -783,10 +884,12 @@ void DrawEmitterGPU(RenderContext& renderContext, ParticleBuffer* buffer, DrawCa
         case 400:
         {
             GPUDrawIndexedIndirectArgs indirectArgsBufferInitData{ SpriteParticleRenderer::IndexCount, 1, 0, 0, 0 };
-            const uint32 offset = indirectDrawCallIndex * sizeof(GPUDrawIndexedIndirectArgs);
+            const uint32 offset = argsOffset + indirectDrawCallIndex * sizeof(GPUDrawIndexedIndirectArgs);
             context->UpdateBuffer(buffer->GPU.IndirectDrawArgsBuffer, &indirectArgsBufferInitData, sizeof(indirectArgsBufferInitData), offset);
-            const uint32 counterOffset = buffer->GPU.ParticleCounterOffset;
-            context->CopyBuffer(buffer->GPU.IndirectDrawArgsBuffer, buffer->GPU.Buffer, 4, offset + 4, counterOffset);
+            if (culled)
+                context->CopyBuffer(buffer->GPU.IndirectDrawArgsBuffer, buffer->GPU.VisibleCounter, 4, offset + 4, 0);
+            else
+                context->CopyBuffer(buffer->GPU.IndirectDrawArgsBuffer, buffer->GPU.Buffer, 4, offset + 4, buffer->GPU.ParticleCounterOffset);
             indirectDrawCallIndex++;
             break;
         }
@@ -805,10 +908,12 @@ void DrawEmitterGPU(RenderContext& renderContext, ParticleBuffer* buffer, DrawCa
                     continue;
 
                 GPUDrawIndexedIndirectArgs indirectArgsBufferInitData = { (uint32)mesh.GetTriangleCount() * 3, 1, 0, 0, 0 };
-                const uint32 offset = indirectDrawCallIndex * sizeof(GPUDrawIndexedIndirectArgs);
+                const uint32 offset = argsOffset + indirectDrawCallIndex * sizeof(GPUDrawIndexedIndirectArgs);
                 context->UpdateBuffer(buffer->GPU.IndirectDrawArgsBuffer, &indirectArgsBufferInitData, sizeof(indirectArgsBufferInitData), offset);
-                const uint32 counterOffset = buffer->GPU.ParticleCounterOffset;
-                context->CopyBuffer(buffer->GPU.IndirectDrawArgsBuffer, buffer->GPU.Buffer, 4, offset + 4, counterOffset);
+                if (culled)
+                    context->CopyBuffer(buffer->GPU.IndirectDrawArgsBuffer, buffer->GPU.VisibleCounter, 4, offset + 4, 0);
+                else
+                    context->CopyBuffer(buffer->GPU.IndirectDrawArgsBuffer, buffer->GPU.Buffer, 4, offset + 4, buffer->GPU.ParticleCounterOffset);
                 indirectDrawCallIndex++;
             }
 
@@ -851,7 +956,7 @@ void DrawEmitterGPU(RenderContext& renderContext, ParticleBuffer* buffer, DrawCa
             SpriteRenderer.SetupDrawCall(drawCall);
             drawCall.InstanceCount = 0;
             drawCall.Draw.IndirectArgsBuffer = buffer->GPU.IndirectDrawArgsBuffer;
-            drawCall.Draw.IndirectArgsOffset = indirectDrawCallIndex * sizeof(GPUDrawIndexedIndirectArgs);
+            drawCall.Draw.IndirectArgsOffset = argsOffset + indirectDrawCallIndex * sizeof(GPUDrawIndexedIndirectArgs);
             if (dp != DrawPass::None)
                 renderContext.List->AddDrawCall(renderContext, dp, staticFlags, drawCall, false, sortOrder);
             indirectDrawCallIndex++;
@@ -873,7 +978,7 @@ void DrawEmitterGPU(RenderContext& renderContext, ParticleBuffer* buffer, DrawCa
             for (int32 meshIndex = 0; meshIndex < lod.Meshes.Count(); meshIndex++)
             {
                 Mesh& mesh = lod.Meshes[meshIndex];
-                if (!mesh.IsInitialized())
+                if (!mesh.IsInitialized() || mesh.GetPositionsQuantization().IsValid()) // Particle materials don't decode quantized positions
                     continue;
                 // TODO: include mesh entry transformation, visibility and shadows mode?
 
@@ -881,7 +986,7 @@ void DrawEmitterGPU(RenderContext& renderContext, ParticleBuffer* buffer, DrawCa
                 mesh.GetDrawCallGeometry(drawCall);
                 drawCall.InstanceCount = 0;
                 drawCall.Draw.IndirectArgsBuffer = buffer->GPU.IndirectDrawArgsBuffer;
-                drawCall.Draw.IndirectArgsOffset = indirectDrawCallIndex * sizeof(GPUDrawIndexedIndirectArgs);
+                drawCall.Draw.IndirectArgsOffset = argsOffset + indirectDrawCallIndex * sizeof(GPUDrawIndexedIndirectArgs);
                 if (dp != DrawPass::None)
                     renderContext.List->AddDrawCall(renderContext, dp, staticFlags, drawCall, false, sortOrder);
                 indirectDrawCallIndex++;
@@ -1160,9 +1265,54 @@ void Particles::RecycleParticleBuffer(ParticleBuffer* buffer)
     }
 }
 
+void Particles::Preallocate(ParticleSystem* system, int32 instancesCount)
+{
+    if (!system || system->WaitForLoaded() || instancesCount <= 0 || !EnableParticleBufferPooling)
+        return;
+    PROFILE_CPU();
+    const auto timeSeconds = Platform::GetTimeSeconds();
+    for (const auto& track : system->Tracks)
+    {
+        if (track.Type != ParticleSystem::Track::Types::Emitter || track.Disabled)
+            continue;
+        auto emitter = system->Emitters[track.AsEmitter.Index].Get();
+        if (!emitter || emitter->WaitForLoaded() || !emitter->EnablePooling || emitter->Capacity == 0 || emitter->Graph.Layout.Size == 0)
+            continue;
+
+        // Keep the preallocated buffers in a pool (recycling doesn't release them)
+        PoolLocker.Lock();
+        int32& reserve = PoolReserve[emitter];
+        reserve = Math::Max(reserve, instancesCount);
+        auto& entries = Pool[emitter];
+        int32 count = entries.Count();
+        PoolLocker.Unlock();
+        for (; count < instancesCount; count++)
+        {
+            auto buffer = New<ParticleBuffer>();
+            if (buffer->Init(emitter))
+            {
+                LOG(Error, "Failed to create particle buffer for emitter {0}", emitter->ToString());
+                Delete(buffer);
+                break;
+            }
+#if COMPILE_WITH_GPU_PARTICLES
+            if (buffer->Mode == ParticlesSimulationMode::GPU && emitter->Graph.SortModules.HasItems())
+                buffer->AllocateSortBuffer();
+#endif
+            EmitterCache c;
+            c.LastTimeUsed = timeSeconds;
+            c.Buffer = buffer;
+            PoolLocker.Lock();
+            Pool[emitter].Add(c);
+            PoolLocker.Unlock();
+        }
+    }
+}
+
 void Particles::OnEmitterUnload(ParticleEmitter* emitter)
 {
     PoolLocker.Lock();
+    PoolReserve.Remove(emitter);
     const auto entries = Pool.TryGet(emitter);
     if (entries)
     {
@@ -1175,6 +1325,10 @@ void Particles::OnEmitterUnload(ParticleEmitter* emitter)
     }
     PoolLocker.Unlock();
 
+    PrewarmLocker.Lock();
+    PrewarmSnapshots.Clear();
+    PrewarmLocker.Unlock();
+
 #if COMPILE_WITH_GPU_PARTICLES
     GpuUpdateListLocker.Lock();
     for (int32 i = GpuUpdateList.Count() - 1; i >= 0; i--)
@@ -1224,12 +1378,146 @@ void ParticleManagerService::Dispose()
         entries.Clear();
     }
     Pool.Clear();
+    PoolReserve.Clear();
     PoolLocker.Unlock();
 
     SpriteRenderer.Dispose();
     SAFE_DELETE(Particles::System);
 }
 
+void ParticlesSystem::UpdateEmitters(ParticleEffect* effect, ParticleSystem* particleSystem, float dt, bool prewarm, bool& updateBounds, bool& updateGpu)
+{
+    auto& instance = effect->Instance;
+    const float fps = particleSystem->FramesPerSecond;
+    for (int32 j = 0; j < particleSystem->Tracks.Count(); j++)
+    {
+        const auto& track = particleSystem->Tracks[j];
+        if (track.Type != ParticleSystem::Track::Types::Emitter || track.Disabled)
+            continue;
+        auto emitter = particleSystem->Emitters[track.AsEmitter.Index].Get();
+        auto& data = instance.Emitters[track.AsEmitter.Index];
+        ASSERT(emitter && emitter->IsLoaded());
+        if (emitter->Capacity == 0 || emitter->Graph.Layout.Size == 0 || (prewarm && emitter->SimulationMode != ParticlesSimulationMode::CPU))
+            continue;
+        PROFILE_CPU_ASSET(emitter);
+
+        // Calculate new time position
+        const float startTime = (float)track.AsEmitter.StartFrame / fps;
+        const float durationTime = (float)track.AsEmitter.DurationFrames / fps;
+        const bool canSpawn = startTime <= instance.Time && instance.Time <= startTime + durationTime;
+
+        // Update instance data
+        data.Sync(effect->Instance, particleSystem, track.AsEmitter.Index);
+        if (!data.Buffer)
+        {
+            data.Buffer = Particles::AcquireParticleBuffer(emitter);
+        }
+        data.Time += dt;
+
+        // Update particles simulation
+        switch (emitter->SimulationMode)
+        {
+        case ParticlesSimulationMode::CPU:
+            emitter->GraphExecutorCPU.Update(emitter, effect, data, dt, canSpawn);
+            updateBounds |= emitter->UseAutoBounds;
+            break;
+#if COMPILE_WITH_GPU_PARTICLES
+        case ParticlesSimulationMode::GPU:
+            emitter->GPU.Update(emitter, effect, data, dt, canSpawn);
+            updateGpu = true;
+            break;
+#endif
+        default:
+            break;
+        }
+    }
+}
+
+void ParticlesSystem::Prewarm(ParticleEffect* effect, ParticleSystem* particleSystem)
+{
+    PROFILE_CPU_NAMED("Particles.Prewarm");
+    auto& instance = effect->Instance;
+    const float duration = Math::Min(effect->PrewarmDuration, (float)particleSystem->DurationFrames / particleSystem->FramesPerSecond);
+
+    // Copy the cached snapshot (the effects of the same system share the prewarmed state)
+    PrewarmLocker.Lock();
+    const PrewarmSnapshot* snapshot = PrewarmSnapshots.TryGet(particleSystem);
+    bool valid = snapshot && snapshot->Version == particleSystem->Version && Math::NearEqual(snapshot->Duration, duration) && snapshot->Emitters.Count() == instance.Emitters.Count();
+    for (int32 j = 0; valid && j < particleSystem->Tracks.Count(); j++)
+    {
+        const auto& track = particleSystem->Tracks[j];
+        if (track.Type != ParticleSystem::Track::Types::Emitter || track.Disabled)
+            continue;
+        const auto emitter = particleSystem->Emitters[track.AsEmitter.Index].Get();
+        if (emitter->SimulationMode == ParticlesSimulationMode::CPU)
+            valid = snapshot->Emitters[track.AsEmitter.Index].Version == emitter->Graph.Version;
+    }
+    if (valid)
+    {
+        instance.Time = snapshot->Time;
+        for (int32 j = 0; j < particleSystem->Tracks.Count(); j++)
+        {
+            const auto& track = particleSystem->Tracks[j];
+            if (track.Type != ParticleSystem::Track::Types::Emitter || track.Disabled)
+                continue;
+            auto emitter = particleSystem->Emitters[track.AsEmitter.Index].Get();
+            if (emitter->SimulationMode != ParticlesSimulationMode::CPU || emitter->Capacity == 0 || emitter->Graph.Layout.Size == 0)
+                continue;
+            const auto& e = snapshot->Emitters[track.AsEmitter.Index];
+            auto& data = instance.Emitters[track.AsEmitter.Index];
+            data.Sync(instance, particleSystem, track.AsEmitter.Index);
+            data.Time = e.Time;
+            data.SpawnModulesData = e.SpawnModulesData;
+            data.CustomData = e.CustomData;
+            if (e.Count == 0)
+                continue;
+            if (!data.Buffer)
+                data.Buffer = Particles::AcquireParticleBuffer(emitter);
+            if (!data.Buffer)
+                continue;
+            data.Buffer->CPU.Count = e.Count;
+            Platform::MemoryCopy(data.Buffer->CPU.Buffer.Get(), e.Data.Get(), e.Data.Count());
+        }
+        PrewarmLocker.Unlock();
+        return;
+    }
+    PrewarmLocker.Unlock();
+
+    // Simulate the CPU emitters with a fixed timestep
+    const float dt = 1.0f / PARTICLES_PREWARM_FPS;
+    bool updateBounds = false, updateGpu = false;
+    for (float time = dt; time <= duration; time += dt)
+    {
+        instance.Time += dt;
+        UpdateEmitters(effect, particleSystem, dt, true, updateBounds, updateGpu);
+    }
+
+    // Cache the snapshot
+    PrewarmLocker.Lock();
+    PrewarmSnapshot& result = PrewarmSnapshots[particleSystem];
+    result.Version = particleSystem->Version;
+    result.Duration = duration;
+    result.Time = instance.Time;
+    result.Emitters.Resize(instance.Emitters.Count());
+    for (int32 j = 0; j < instance.Emitters.Count(); j++)
+    {
+        const auto& data = instance.Emitters[j];
+        auto& e = result.Emitters[j];
+        e.Version = data.Version;
+        e.Time = data.Time;
+        e.SpawnModulesData = data.SpawnModulesData;
+        e.CustomData = data.CustomData;
+        e.Count = 0;
+        e.Data.Clear();
+        if (data.Buffer && data.Buffer->Mode == ParticlesSimulationMode::CPU)
+        {
+            e.Count = data.Buffer->CPU.Count;
+            e.Data.Set(data.Buffer->CPU.Buffer.Get(), e.Count * data.Buffer->Stride);
+        }
+    }
+    PrewarmLocker.Unlock();
+}
+
 void ParticlesSystem::Job(int32 index)
 {
     PROFILE_CPU_NAMED("Particles.Job");
@@ -1281,6 +1569,10 @@ void ParticlesSystem::Job(int32 index)
     {
         // Update bounds after first system update
         updateBounds = true;
+
+        // Start from the prewarmed simulation state
+        if (effect->PrewarmDuration > 0.0f)
+            Prewarm(effect, particleSystem);
     }
     // TODO: if using fixed timestep quantize the dt and accumulate remaining part for the next update?
     //if (dt <= 1.0f / 240.0f)
@@ -1326,48 +1618,7 @@ void ParticlesSystem::Job(int32 index)
     instance.LastUpdateTime = t;
 
     // Update all emitter tracks
-    for (int32 j = 0; j < particleSystem->Tracks.Count(); j++)
-    {
-        const auto& track = particleSystem->Tracks[j];
-        if (track.Type != ParticleSystem::Track::Types::Emitter || track.Disabled)
-            continue;
-        auto emitter = particleSystem->Emitters[track.AsEmitter.Index].Get();
-        auto& data = instance.Emitters[track.AsEmitter.Index];
-        ASSERT(emitter && emitter->IsLoaded());
-        if (emitter->Capacity == 0 || emitter->Graph.Layout.Size == 0)
-            continue;
-        PROFILE_CPU_ASSET(emitter);
-
-        // Calculate new time position
-        const float startTime = (float)track.AsEmitter.StartFrame / fps;
-        const float durationTime = (float)track.AsEmitter.DurationFrames / fps;
-        const bool canSpawn = startTime <= instance.Time && instance.Time <= startTime + durationTime;
-
-        // Update instance data
-        data.Sync(effect->Instance, particleSystem, track.AsEmitter.Index);
-        if (!data.Buffer)
-        {
-            data.Buffer = Particles::AcquireParticleBuffer(emitter);
-        }
-        data.Time += dt;
-
-        // Update particles simulation
-        switch (emitter->SimulationMode)
-        {
-        case ParticlesSimulationMode::CPU:
-            emitter->GraphExecutorCPU.Update(emitter, effect, data, dt, canSpawn);
-            updateBounds |= emitter->UseAutoBounds;
-            break;
-#if COMPILE_WITH_GPU_PARTICLES
-        case ParticlesSimulationMode::GPU:
-            emitter->GPU.Update(emitter, effect, data, dt, canSpawn);
-            updateGpu = true;
-            break;
-#endif
-        default:
-            break;
-        }
-    }
+    UpdateEmitters(effect, particleSystem, dt, false, updateBounds, updateGpu);
 
     // Update bounds if any of the emitters uses auto-bounds
     if (updateBounds)
@@ -1385,10 +1636,71 @@ void ParticlesSystem::Job(int32 index)
 #endif
 }
 
+bool SortEffectsBySignificance(ParticleEffect* const& a, ParticleEffect* const& b)
+{
+    return a->GetSignificance() > b->GetSignificance();
+}
+
+void ParticlesSystem::ApplyBudgets()
+{
+    Stats = ParticlesStats();
+    Stats.EffectsCount = UpdateList.Count();
+    Stats.CPUParticlesBudget = Particles::CPUParticlesBudget;
+    Stats.GPUParticlesBudget = Particles::GPUParticlesBudget;
+    const bool useBudgets = Particles::MaxUpdatedEffects > 0 || Particles::CPUParticlesBudget > 0 || Particles::GPUParticlesBudget > 0;
+    if (useBudgets)
+    {
+        PROFILE_CPU_NAMED("Particles.Budgets");
+
+        // Process the most significant effects first
+        Sorting::QuickSort(UpdateList.Get(), UpdateList.Count(), SortEffectsBySignificance);
+    }
+    int32 updatedCount = 0;
+    for (int32 i = 0; i < UpdateList.Count(); i++)
+    {
+        ParticleEffect* effect = UpdateList.Get()[i];
+
+        // Count particles simulated by the effect (from the last update)
+        int32 cpuParticles = 0, gpuParticles = 0;
+        for (const auto& emitterData : effect->Instance.Emitters)
+        {
+            const ParticleBuffer* buffer = emitterData.Buffer;
+            if (!buffer)
+                continue;
+            if (buffer->Mode == ParticlesSimulationMode::CPU)
+                cpuParticles += buffer->CPU.Count;
+            else
+                gpuParticles += buffer->GPU.ParticlesCountMax;
+        }
+
+        // Pause and cull the effects above the budgets (the most significant effect is always simulated)
+        const bool culled = useBudgets && updatedCount != 0 &&
+                ((Particles::MaxUpdatedEffects > 0 && updatedCount >= Particles::MaxUpdatedEffects) ||
+                 (Particles::CPUParticlesBudget > 0 && Stats.CPUParticlesCount + cpuParticles > Particles::CPUParticlesBudget) ||
+                 (Particles::GPUParticlesBudget > 0 && Stats.GPUParticlesCount + gpuParticles > Particles::GPUParticlesBudget));
+        effect->SetCulledByBudget(culled);
+        if (culled)
+        {
+            // Move update timer forward for correct delta time after resume
+            effect->Instance.LastUpdateTime = effect->UseTimeScale ? Time : UnscaledTime;
+            Stats.CulledEffectsCount++;
+            continue;
+        }
+        Stats.CPUParticlesCount += cpuParticles;
+        Stats.GPUParticlesCount += gpuParticles;
+        UpdateList.Get()[updatedCount++] = effect;
+    }
+    UpdateList.Resize(updatedCount);
+    Stats.UpdatedEffectsCount = updatedCount;
+}
+
 void ParticlesSystem::Execute(TaskGraph* graph)
 {
     if (UpdateList.Count() == 0)
+    {
+        Stats = ParticlesStats();
         return;
+    }
 
     // Setup data for async update
     const auto& tickData = Time::Update;
@@ -1397,10 +1709,15 @@ void ParticlesSystem::Execute(TaskGraph* graph)
     Time = tickData.Time.GetTotalSeconds();
     UnscaledTime = tickData.UnscaledTime.GetTotalSeconds();
 
+    // Apply the global particles budgets
+    ApplyBudgets();
+    if (UpdateList.Count() == 0)
+        return;
+
     // Schedule work to update all particles in async
     Function<void(int32)> job;
     job.Bind<ParticlesSystem, &ParticlesSystem::Job>(this);
-    graph->DispatchJob(job, UpdateList.Count());
+    graph->DispatchJob(job, UpdateList.Count(), 1, JobPriority::High);
 }
 
 void ParticlesSystem::PostExecute(TaskGraph* graph)
@@ -1432,10 +1749,11 @@ void ParticlesSystem::PostExecute(TaskGraph* graph)
     for (auto i = Pool.Begin(); i.IsNotEnd(); ++i)
     {
         auto& entries = i->Value;
+        const int32* reserve = PoolReserve.TryGet(i->Key);
         for (int32 j = 0; j < entries.Count(); j++)
         {
             auto& e = entries[j];
-            if (timeSeconds - e.LastTimeUsed >= Particles::ParticleBufferRecycleTimeout)
+            if (timeSeconds - e.LastTimeUsed >= Particles::ParticleBufferRecycleTimeout && (!reserve || entries.Count() > *reserve))
             {
                 Delete(e.Buffer);
                 entries.RemoveAt(j--);
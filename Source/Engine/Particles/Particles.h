@@ -15,6 +15,26 @@ class ParticleBuffer;
 class SceneRenderTask;
 class Actor;
 
+// Particles simulation statistics container (from the last update).
+API_STRUCT(NoDefault) struct FLAXENGINE_API ParticlesStats
+{
+DECLARE_SCRIPTING_TYPE_MINIMAL(ParticlesStats);
+    // Amount of effects that requested the simulation update.
+    API_FIELD() int32 EffectsCount = 0;
+    // Amount of effects that have been simulated.
+    API_FIELD() int32 UpdatedEffectsCount = 0;
+    // Amount of the least significant effects that have been paused and culled due to the particles budgets.
+    API_FIELD() int32 CulledEffectsCount = 0;
+    // Amount of the simulated CPU particles.
+    API_FIELD() int32 CPUParticlesCount = 0;
+    // The budget for the CPU particles. Zero if unlimited.
+    API_FIELD() int32 CPUParticlesBudget = 0;
+    // Amount of the simulated GPU particles (estimated upper bound).
+    API_FIELD() int32 GPUParticlesCount = 0;
+    // The budget for the GPU particles. Zero if unlimited.
+    API_FIELD() int32 GPUParticlesBudget = 0;
+};
+
 /// <summary>
 /// The particles simulation service.
 /// </summary>
@@ -27,6 +47,27 @@ API_CLASS(Static) class FLAXENGINE_API Particles
     /// </summary>
     API_FIELD(ReadOnly) static TaskGraphSystem* System;
 
+public:
+    /// <summary>
+    /// The maximum amount of particle effects simulated during a single update. The least significant effects (based on the priority and the screen size) above the limit get paused and culled. Use 0 for unlimited.
+    /// </summary>
+    API_FIELD() static int32 MaxUpdatedEffects;
+
+    /// <summary>
+    /// The global budget for the amount of particles simulated on a CPU. The least significant effects above the budget get paused and culled. Use 0 for unlimited.
+    /// </summary>
+    API_FIELD() static int32 CPUParticlesBudget;
+
+    /// <summary>
+    /// The global budget for the amount of particles simulated on a GPU (based on the emitters capacity in use). The least significant effects above the budget get paused and culled. Use 0 for unlimited.
+    /// </summary>
+    API_FIELD() static int32 GPUParticlesBudget;
+
+    /// <summary>
+    /// Gets the particles simulation statistics (from the last update).
+    /// </summary>
+    API_PROPERTY() static ParticlesStats GetStats();
+
 public:
     /// <summary>
     /// Updates the effect during next particles simulation tick.
@@ -72,6 +113,13 @@ API_CLASS(Static) class FLAXENGINE_API Particles
     /// <param name="buffer">The particle buffer.</param>
     static void RecycleParticleBuffer(ParticleBuffer* buffer);
 
+    /// <summary>
+    /// Preallocates the particle buffers for the given amount of the particle system instances. Buffers are kept in the pool (they don't get released after recycle timeout) so spawning effects using this system doesn't allocate any memory.
+    /// </summary>
+    /// <param name="system">The particle system.</param>
+    /// <param name="instancesCount">The amount of the effect instances to preallocate.</param>
+    API_FUNCTION() static void Preallocate(ParticleSystem* system, int32 instancesCount);
+
     /// <summary>
     /// Called when emitter gets unloaded. Particle buffers using this emitter has to be cleared.
     /// </summary>
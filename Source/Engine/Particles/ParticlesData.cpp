@@ -17,6 +17,7 @@ ParticleBuffer::~ParticleBuffer()
     SAFE_DELETE_GPU_RESOURCE(GPU.IndirectDrawArgsBuffer);
     SAFE_DELETE_GPU_RESOURCE(GPU.SortingKeysBuffer);
     SAFE_DELETE_GPU_RESOURCE(GPU.SortedIndices);
+    SAFE_DELETE_GPU_RESOURCE(GPU.VisibleCounter);
     SAFE_DELETE(GPU.RibbonIndexBufferDynamic);
     SAFE_DELETE(GPU.RibbonVertexBufferDynamic);
 }
@@ -102,6 +103,9 @@ bool ParticleBuffer::AllocateSortBuffer()
         GPU.SortedIndices = GPUDevice::Instance->CreateBuffer(TEXT("SortedIndices"));
         if (GPU.SortedIndices->Init(GPUBufferDescription::Buffer(sortedIndicesSize, GPUBufferFlags::ShaderResource | GPUBufferFlags::UnorderedAccess, PixelFormat::R32_UInt, nullptr, sizeof(uint32))))
             return true;
+        GPU.VisibleCounter = GPUDevice::Instance->CreateBuffer(TEXT("ParticleVisibleCounter"));
+        if (GPU.VisibleCounter->Init(GPUBufferDescription::Raw(sizeof(uint32), GPUBufferFlags::ShaderResource | GPUBufferFlags::UnorderedAccess)))
+            return true;
         break;
     }
 #endif
@@ -297,6 +297,11 @@ class FLAXENGINE_API ParticleBuffer
         /// </remarks>
         GPUBuffer* SortedIndices = nullptr;
 
+        /// <summary>
+        /// The counter (uint type) of the particles visible in the view. Written during the sorting keys generation that culls particles outside the view frustum and compacts the visible ones (only they are sorted and drawn).
+        /// </summary>
+        GPUBuffer* VisibleCounter = nullptr;
+
         /// <summary>
         /// The ribbon particles rendering index buffer (dynamic GPU access).
         /// </summary>
@@ -6,6 +6,8 @@
 #include "Engine/Physics/PhysicsBackend.h"
 #include "Engine/Physics/PhysicsScene.h"
 #include "Engine/Engine/Time.h"
+#include "Engine/Core/Collections/Sorting.h"
+#include "Engine/Profiler/ProfilerCPU.h"
 
 #define CC_MIN_SIZE 0.001f
 
@@ -168,6 +170,83 @@ CharacterController::CollisionFlags CharacterController::Move(const Vector3& dis
     return result;
 }
 
+namespace
+{
+    struct MoveBatchItem
+    {
+        Guid ID;
+        int32 Index;
+
+        bool operator<(const MoveBatchItem& other) const
+        {
+            if (ID.A != other.ID.A)
+                return ID.A < other.ID.A;
+            if (ID.B != other.ID.B)
+                return ID.B < other.ID.B;
+            if (ID.C != other.ID.C)
+                return ID.C < other.ID.C;
+            return ID.D < other.ID.D;
+        }
+    };
+}
+
+void CharacterController::MoveBatch(const Array<CharacterController*>& controllers, const Array<Vector3>& displacements, Array<CollisionFlags>& results)
+{
+    CHECK(controllers.Count() == displacements.Count());
+    PROFILE_CPU();
+    const int32 count = controllers.Count();
+    results.Resize(count);
+    const float deltaTime = Time::GetCurrentSafe()->DeltaTime.GetTotalSeconds();
+
+    // Sort by the object ID to resolve controller-vs-controller interactions in a deterministic order (independent of the input order)
+    Array<MoveBatchItem, InlinedAllocation<256>> order;
+    order.Resize(count);
+    for (int32 i = 0; i < count; i++)
+    {
+        order[i].ID = controllers[i] ? controllers[i]->GetID() : Guid::Empty;
+        order[i].Index = i;
+    }
+    Sorting::QuickSort(order.Get(), count);
+
+    // Move all controllers
+    for (const MoveBatchItem& item : order)
+    {
+        const int32 i = item.Index;
+        CharacterController* controller = controllers[i];
+        CollisionFlags result = CollisionFlags::None;
+        if (controller && controller->_controller)
+        {
+            result = (CollisionFlags)PhysicsBackend::MoveController(controller->_controller, controller->_shape, displacements[i], controller->_minMoveDistance, deltaTime);
+            controller->_lastFlags = result;
+        }
+        results[i] = result;
+    }
+
+    // Apply the results to the actors
+    for (const MoveBatchItem& item : order)
+    {
+        CharacterController* controller = controllers[item.Index];
+        if (controller && controller->_controller)
+            controller->OnActiveTransformChanged();
+    }
+}
+
+void CharacterController::SimpleMoveBatch(const Array<CharacterController*>& controllers, const Array<Vector3>& speeds, Array<CollisionFlags>& results)
+{
+    CHECK(controllers.Count() == speeds.Count());
+    const float deltaTime = Time::GetCurrentSafe()->DeltaTime.GetTotalSeconds();
+    Array<Vector3> displacements;
+    displacements.Resize(controllers.Count());
+    for (int32 i = 0; i < controllers.Count(); i++)
+    {
+        Vector3 displacement = speeds[i];
+        if (controllers[i] && controllers[i]->GetPhysicsScene())
+            displacement += controllers[i]->GetPhysicsScene()->GetGravity() * deltaTime;
+        displacements[i] = displacement * deltaTime;
+    }
+    MoveBatch(controllers, displacements, results);
+}
+
 #if USE_EDITOR
 
 #include "Engine/Debug/DebugDraw.h"
@@ -178,6 +178,22 @@ class FLAXENGINE_API CharacterController : public Collider, public IPhysicsActor
     /// <returns>The collision flags. It can be used to trigger various character animations.</returns>
     API_FUNCTION() CollisionFlags Move(const Vector3& displacement);
 
+    /// <summary>
+    /// Moves many characters in a single batch (see Move). Controllers are moved in a deterministic order (sorted by the object ID) so controller-vs-controller interactions resolve the same way every time. Actors transformations are updated once after all moves.
+    /// </summary>
+    /// <param name="controllers">The characters to move.</param>
+    /// <param name="displacements">The displacement vectors (in world units) per character.</param>
+    /// <param name="results">The output collision flags per character (in the same order as input).</param>
+    API_FUNCTION() static void MoveBatch(const Array<CharacterController*>& controllers, const Array<Vector3>& displacements, API_PARAM(Out) Array<CollisionFlags>& results);
+
+    /// <summary>
+    /// Moves many characters with the given speeds in a single batch (see SimpleMove). Gravity is automatically applied.
+    /// </summary>
+    /// <param name="controllers">The characters to move.</param>
+    /// <param name="speeds">The movement speeds (in units/s) per character.</param>
+    /// <param name="results">The output collision flags per character (in the same order as input).</param>
+    API_FUNCTION() static void SimpleMoveBatch(const Array<CharacterController*>& controllers, const Array<Vector3>& speeds, API_PARAM(Out) Array<CollisionFlags>& results);
+
 protected:
     /// <summary>
     /// Creates the physics actor.
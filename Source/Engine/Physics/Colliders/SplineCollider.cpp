@@ -16,6 +16,7 @@
 SplineCollider::SplineCollider(const SpawnParams& params)
     : Collider(params)
 {
+    _loadNoAsync = true; // Reads the parent spline
     CollisionData.Changed.Bind<SplineCollider, &SplineCollider::OnCollisionDataChanged>(this);
     CollisionData.Loaded.Bind<SplineCollider, &SplineCollider::OnCollisionDataLoaded>(this);
 }
@@ -273,7 +274,7 @@ void SplineCollider::GetGeometry(CollisionShape& collision)
     cookingInput.IndexData = _indexBuffer.Get();
     cookingInput.Is16bitIndexData = false;
     BytesContainer collisionData;
-    if (!CollisionCooking::CookTriangleMesh(cookingInput, collisionData))
+    if (!CollisionCooking::CookMesh(CollisionDataType::TriangleMesh, cookingInput, collisionData))
     {
         // Create triangle mesh
         if (_triangleMesh)
@@ -9,6 +9,145 @@
 #include "Engine/Threading/Threading.h"
 #include "Engine/Profiler/ProfilerCPU.h"
 #include "Engine/Core/Log.h"
+#include "Engine/Core/Types/Guid.h"
+#include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Platform/File.h"
+#include "Engine/Platform/FileSystem.h"
+#include "Engine/Serialization/MemoryReadStream.h"
+#include "Engine/Serialization/MemoryWriteStream.h"
+
+// Version of the cooked meshes cache (bump to invalidate cache after cooking changes)
+#define COLLISION_CACHE_VERSION 1
+
+// The maximum size of the cooked meshes kept in memory (cache is cleared when exceeded)
+#define COLLISION_CACHE_MEMORY_LIMIT (32 * 1024 * 1024)
+
+String CollisionCooking::CachePath;
+
+namespace
+{
+    CriticalSection CacheLocker;
+    Dictionary<uint64, BytesContainer> CacheEntries;
+    int32 CacheMemory = 0;
+
+    void HashBytes(uint64& hash, const void* data, int32 size)
+    {
+        // FNV-1a
+        const byte* ptr = (const byte*)data;
+        for (int32 i = 0; i < size; i++)
+        {
+            hash ^= ptr[i];
+            hash *= 1099511628211ull;
+        }
+    }
+
+    uint64 GetCacheKey(CollisionDataType type, const CollisionCooking::CookingInput& input)
+    {
+        uint64 hash = 14695981039346656037ull;
+        const int32 header[] = { COLLISION_CACHE_VERSION, (int32)type, (int32)input.ConvexFlags, input.ConvexVertexLimit, input.VertexCount, input.IndexCount, input.Is16bitIndexData ? 1 : 0 };
+        HashBytes(hash, header, sizeof(header));
+        HashBytes(hash, input.VertexData, input.VertexCount * sizeof(Float3));
+        if (type == CollisionDataType::TriangleMesh)
+            HashBytes(hash, input.IndexData, input.IndexCount * (input.Is16bitIndexData ? sizeof(uint16) : sizeof(uint32)));
+        return hash;
+    }
+
+    void AddCacheEntry(uint64 key, const BytesContainer& data)
+    {
+        ScopeLock lock(CacheLocker);
+        if (CacheMemory + data.Length() > COLLISION_CACHE_MEMORY_LIMIT)
+        {
+            CacheEntries.Clear();
+            CacheMemory = 0;
+        }
+        BytesContainer& entry = CacheEntries[key];
+        CacheMemory += data.Length() - entry.Length();
+        entry.Copy(data);
+    }
+
+    bool LoadCacheFile(const String& path, const CollisionCooking::CookingInput& input, BytesContainer& output)
+    {
+        Array<byte> data;
+        if (!FileSystem::FileExists(path) || File::ReadAllBytes(path, data))
+            return true;
+        MemoryReadStream stream(data.Get(), data.Count());
+        int32 version, vertexCount, indexCount, size;
+        stream.ReadInt32(&version);
+        stream.ReadInt32(&vertexCount);
+        stream.ReadInt32(&indexCount);
+        stream.ReadInt32(&size);
+        if (version != COLLISION_CACHE_VERSION || vertexCount != input.VertexCount || indexCount != input.IndexCount || size <= 0 || size > (int32)(stream.GetLength() - stream.GetPosition()))
+            return true;
+        output.Copy(stream.Move<byte>(size), size);
+        return false;
+    }
+
+    void SaveCacheFile(const String& path, const CollisionCooking::CookingInput& input, const BytesContainer& data)
+    {
+        MemoryWriteStream stream(data.Length() + 16);
+        stream.WriteInt32(COLLISION_CACHE_VERSION);
+        stream.WriteInt32(input.VertexCount);
+        stream.WriteInt32(input.IndexCount);
+        stream.WriteInt32(data.Length());
+        stream.WriteBytes(data.Get(), data.Length());
+
+        // Write to the temporary file and move it into the entry location (cache can be used by multiple threads or processes)
+        const String tmpPath = path + TEXT(".") + Guid::New().ToString(Guid::FormatType::N) + TEXT(".tmp");
+        if (File::WriteAllBytes(tmpPath, stream.GetHandle(), stream.GetPosition()))
+            return;
+        if (FileSystem::MoveFile(path, tmpPath, true))
+            FileSystem::DeleteFile(tmpPath);
+    }
+}
+
+bool CollisionCooking::CookMesh(CollisionDataType type, CookingInput& input, BytesContainer& output)
+{
+    PROFILE_CPU();
+    if (type != CollisionDataType::ConvexMesh && type != CollisionDataType::TriangleMesh)
+    {
+        LOG(Warning, "Invalid collision data type.");
+        return true;
+    }
+    const uint64 key = GetCacheKey(type, input);
+
+    // Reuse the mesh cooked before within this session
+    {
+        ScopeLock lock(CacheLocker);
+        const BytesContainer* entry = CacheEntries.TryGet(key);
+        if (entry)
+        {
+            output.Copy(*entry);
+            return false;
+        }
+    }
+
+    // Reuse the mesh cooked by the previous runs
+    String cacheFilePath;
+    if (CachePath.HasChars())
+    {
+        cacheFilePath = CachePath / String::Format(TEXT("{0:016x}.bin"), key);
+        if (!LoadCacheFile(cacheFilePath, input, output))
+        {
+            AddCacheEntry(key, output);
+            return false;
+        }
+    }
+
+    // Cook
+    if (type == CollisionDataType::ConvexMesh ? CookConvexMesh(input, output) : CookTriangleMesh(input, output))
+        return true;
+    AddCacheEntry(key, output);
+    if (cacheFilePath.HasChars())
+        SaveCacheFile(cacheFilePath, input, output);
+    return false;
+}
+
+void CollisionCooking::ClearCache()
+{
+    ScopeLock lock(CacheLocker);
+    CacheEntries.Clear();
+    CacheMemory = 0;
+}
 
 bool CollisionCooking::CookCollision(const Argument& arg, CollisionData::SerializedOptions& outputOptions, BytesContainer& outputData)
 {
@@ -258,21 +397,8 @@ bool CollisionCooking::CookCollision(const Argument& arg, CollisionData::Seriali
     cookingInput.ConvexVertexLimit = convexVertexLimit;
 
     // Cook!
-    if (arg.Type == CollisionDataType::ConvexMesh)
-    {
-        if (CookConvexMesh(cookingInput, outputData))
-            return true;
-    }
-    else if (arg.Type == CollisionDataType::TriangleMesh)
-    {
-        if (CookTriangleMesh(cookingInput, outputData))
-            return true;
-    }
-    else
-    {
-        LOG(Warning, "Invalid collision data type.");
+    if (CookMesh(arg.Type, cookingInput, outputData))
         return true;
-    }
 
     // Setup options
     Platform::MemoryClear(&outputOptions, sizeof(outputOptions));
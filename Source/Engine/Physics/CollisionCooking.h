@@ -62,6 +62,25 @@ class CollisionCooking
     /// <returns>True if failed, otherwise false.</returns>
     static bool CookTriangleMesh(CookingInput& input, BytesContainer& output);
 
+    /// <summary>
+    /// Cooks a convex or triangle mesh using the cooked data cache. The same input (geometry and options) is cooked only once per session (memory cache) and the results are reused across runs (disk cache in CachePath).
+    /// </summary>
+    /// <param name="type">The collision data type (convex or triangle mesh).</param>
+    /// <param name="input">The input.</param>
+    /// <param name="output">The output.</param>
+    /// <returns>True if failed, otherwise false.</returns>
+    static bool CookMesh(CollisionDataType type, CookingInput& input, BytesContainer& output);
+
+    /// <summary>
+    /// The path to the folder with the cooked meshes cache (see CookMesh). Empty to disable disk cache.
+    /// </summary>
+    static String CachePath;
+
+    /// <summary>
+    /// Clears the in-memory cache of the cooked meshes.
+    /// </summary>
+    static void ClearCache();
+
     /// <summary>
     /// Cooks a heightfield. The results are written to the stream. To create a heightfield object there is an option to precompute some of calculations done while loading the heightfield data.
     /// </summary>
@@ -10,6 +10,8 @@
 #include "Engine/Physics/CollisionCooking.h"
 #include "Engine/Profiler/ProfilerCPU.h"
 #include "Engine/Threading/Threading.h"
+#include "Engine/Threading/ThreadPoolTask.h"
+#include "Engine/Content/WeakAssetReference.h"
 
 REGISTER_BINARY_ASSET(CollisionData, "FlaxEngine.CollisionData", true);
 
@@ -22,6 +24,50 @@ CollisionData::CollisionData(const SpawnParams& params, const AssetInfo* info)
 
 #if COMPILE_WITH_PHYSICS_COOKING
 
+/// <summary>
+/// Collision data cooking task (runs on a thread pool).
+/// </summary>
+class CookCollisionTask : public ThreadPoolTask
+{
+private:
+    WeakAssetReference<CollisionData> _asset;
+    CollisionDataType _type;
+    ModelData _modelData;
+    ConvexMeshGenerationFlags _convexFlags;
+    int32 _convexVertexLimit;
+
+public:
+    CookCollisionTask(CollisionData* asset, CollisionDataType type, const Span<Float3>& vertices, const Span<uint32>& triangles, ConvexMeshGenerationFlags convexFlags, int32 convexVertexLimit)
+        : _asset(asset)
+        , _type(type)
+        , _convexFlags(convexFlags)
+        , _convexVertexLimit(convexVertexLimit)
+    {
+        _modelData.LODs.Resize(1);
+        auto meshData = New<MeshData>();
+        _modelData.LODs[0].Meshes.Add(meshData);
+        meshData->Positions.Set(vertices.Get(), vertices.Length());
+        meshData->Indices.Set(triangles.Get(), triangles.Length());
+    }
+
+public:
+    // [ThreadPoolTask]
+    bool HasReference(Object* resource) const override
+    {
+        return _asset == resource;
+    }
+
+protected:
+    // [ThreadPoolTask]
+    bool Run() override
+    {
+        AssetReference<CollisionData> asset = _asset.Get();
+        if (asset == nullptr)
+            return true;
+        return asset->CookCollision(_type, &_modelData, _convexFlags, _convexVertexLimit);
+    }
+};
+
 bool CollisionData::CookCollision(CollisionDataType type, ModelBase* modelObj, int32 modelLodIndex, uint32 materialSlotsMask, ConvexMeshGenerationFlags convexFlags, int32 convexVertexLimit)
 {
     if (!IsVirtual())
@@ -125,6 +171,20 @@ bool CollisionData::CookCollision(CollisionDataType type, ModelData* modelData,
     return false;
 }
 
+Task* CollisionData::CookCollisionAsync(CollisionDataType type, const Span<Float3>& vertices, const Span<uint32>& triangles, ConvexMeshGenerationFlags convexFlags, int32 convexVertexLimit)
+{
+    if (!IsVirtual())
+    {
+        LOG(Warning, "Only virtual assets can be modified at runtime.");
+        return nullptr;
+    }
+    CHECK_RETURN(vertices.Length() != 0, nullptr);
+    CHECK_RETURN(triangles.Length() != 0 && triangles.Length() % 3 == 0, nullptr);
+    auto task = New<CookCollisionTask>(this, type, vertices, triangles, convexFlags, convexVertexLimit);
+    task->Start();
+    return task;
+}
+
 #endif
 
 bool CollisionData::GetModelTriangle(uint32 faceIndex, MeshBase*& mesh, uint32& meshTriangleIndex) const
@@ -9,6 +9,7 @@ class Model;
 class ModelBase;
 class ModelData;
 class MeshBase;
+class Task;
 
 /// <summary>
 /// A <see cref="CollisionData"/> storage data type.
@@ -244,6 +245,20 @@ API_CLASS(NoSpawn) class FLAXENGINE_API CollisionData : public BinaryAsset
     /// <returns>True if failed, otherwise false.</returns>
     bool CookCollision(CollisionDataType type, ModelData* modelData, ConvexMeshGenerationFlags convexFlags, int32 convexVertexLimit);
 
+    /// <summary>
+    /// Cooks the mesh collision data and updates the virtual asset asynchronously on a thread pool. Input geometry is copied so it can be released after this call. Identical geometry is cooked only once (see CollisionCooking::CookMesh cache).
+    /// </summary>
+    /// <remarks>
+    /// Can be used only for virtual assets (see <see cref="Asset.IsVirtual"/> and <see cref="Content.CreateVirtualAsset{T}"/>).
+    /// </remarks>
+    /// <param name="type">The collision data type.</param>
+    /// <param name="vertices">The source geometry vertex buffer with vertices positions. Cannot be empty.</param>
+    /// <param name="triangles">The source data index buffer (triangles list). Uses 32-bit stride buffer. Cannot be empty. Length must be multiple of 3 (as 3 vertices build a triangle).</param>
+    /// <param name="convexFlags">The convex mesh generation flags.</param>
+    /// <param name="convexVertexLimit">The convex mesh vertex limit. Use values in range [8;255]</param>
+    /// <returns>The started cooking task (asset is updated when task ends), or null if failed.</returns>
+    Task* CookCollisionAsync(CollisionDataType type, const Span<Float3>& vertices, const Span<uint32>& triangles, ConvexMeshGenerationFlags convexFlags = ConvexMeshGenerationFlags::None, int32 convexVertexLimit = 255);
+
 #endif
 
     /// <summary>
@@ -21,10 +21,11 @@
 #include "Engine/Physics/Joints/SphericalJoint.h"
 #include "Engine/Physics/Joints/D6Joint.h"
 #include "Engine/Physics/Colliders/Collider.h"
-#include "Engine/Platform/CPUInfo.h"
 #include "Engine/Platform/CriticalSection.h"
 #include "Engine/Profiler/ProfilerCPU.h"
 #include "Engine/Serialization/WriteStream.h"
+#include "Engine/Threading/JobSystem.h"
+#include "Engine/Threading/ConcurrentQueue.h"
 #include <ThirdParty/PhysX/PxPhysicsAPI.h>
 #include <ThirdParty/PhysX/PxQueryFiltering.h>
 #include <ThirdParty/PhysX/extensions/PxFixedJoint.h>
@@ -44,7 +45,6 @@
 #endif
 #if WITH_CLOTH
 #include "Engine/Physics/Actors/Cloth.h"
-#include "Engine/Threading/JobSystem.h"
 #include "Engine/Threading/Threading.h"
 #include <ThirdParty/NvCloth/Callbacks.h>
 #include <ThirdParty/NvCloth/Factory.h>
@@ -81,7 +81,6 @@ struct ActionDataPhysX
 struct ScenePhysX
 {
     PxScene* Scene = nullptr;
-    PxCpuDispatcher* CpuDispatcher = nullptr;
     PxControllerManager* ControllerManager = nullptr;
     void* ScratchMemory = nullptr;
     Vector3 Origin = Vector3::Zero;
@@ -130,6 +129,39 @@ class ErrorPhysX : public PxErrorCallback
     }
 };
 
+class CpuDispatcherPhysX : public PxCpuDispatcher
+{
+private:
+    ConcurrentQueue<PxBaseTask*> _tasks;
+
+    void Job(int32 index)
+    {
+        // Tasks submitted to PhysX dispatcher are ready to run and independent so the order doesn't matter
+        PxBaseTask* task;
+        if (_tasks.try_dequeue(task))
+        {
+            PROFILE_CPU_NAMED("PhysX.Task");
+            task->run();
+            task->release();
+        }
+    }
+
+public:
+    void submitTask(PxBaseTask& task) override
+    {
+        // Run physics simulation tasks on Job System (shared with other engine systems to not oversubscribe CPU)
+        _tasks.enqueue(&task);
+        Function<void(int32)> job;
+        job.Bind<CpuDispatcherPhysX, &CpuDispatcherPhysX::Job>(this);
+        JobSystem::Dispatch(job, 1, 1, JobPriority::High);
+    }
+
+    uint32_t getWorkerCount() const override
+    {
+        return (uint32_t)Math::Max(JobSystem::GetThreadsCount(), 1);
+    }
+};
+
 #if WITH_CLOTH
 
 class AssertPhysX : public nv::cloth::PxAssertHandler
@@ -549,6 +581,7 @@ namespace
     PxMaterial* DefaultMaterial = nullptr;
     AllocatorPhysX AllocatorCallback;
     ErrorPhysX ErrorCallback;
+    CpuDispatcherPhysX CpuDispatcher;
 #if WITH_CLOTH
     AssertPhysX AssertCallback;
     ProfilerPhysX ProfilerCallback;
@@ -1266,11 +1299,7 @@ void* PhysicsBackend::CreateScene(const PhysicsSettings& settings)
         break;
     }
     if (sceneDesc.cpuDispatcher == nullptr)
-    {
-        scenePhysX->CpuDispatcher = PxDefaultCpuDispatcherCreate(Math::Clamp<uint32>(Platform::GetCPUInfo().ProcessorCoreCount - 1, 1, 4));
-        CHECK_INIT(scenePhysX->CpuDispatcher, "PxDefaultCpuDispatcherCreate failed!");
-        sceneDesc.cpuDispatcher = scenePhysX->CpuDispatcher;
-    }
+        sceneDesc.cpuDispatcher = &CpuDispatcher;
     switch (settings.BroadPhaseType)
     {
     case PhysicsBroadPhaseType::SweepAndPrune:
@@ -1331,7 +1360,6 @@ void PhysicsBackend::DestroyScene(void* scene)
     }
 #endif
     RELEASE_PHYSX(scenePhysX->ControllerManager);
-    SAFE_DELETE(scenePhysX->CpuDispatcher);
     Allocator::Free(scenePhysX->ScratchMemory);
     scenePhysX->Scene->release();
 
@@ -1372,6 +1400,12 @@ void PhysicsBackend::StartSimulateScene(void* scene, float dt)
     scenePhysX->Stepper.renderDone();
 }
 
+bool PhysicsBackend::IsSceneSimulationDone(void* scene)
+{
+    auto scenePhysX = (ScenePhysX*)scene;
+    return scenePhysX->Stepper.isDone();
+}
+
 void PhysicsBackend::EndSimulateScene(void* scene)
 {
     auto scenePhysX = (ScenePhysX*)scene;
@@ -25,6 +25,7 @@ class PhysicsStepper
 public:
     virtual bool advance(PxScene* scene, PxReal dt, void* scratchBlock, PxU32 scratchBlockSize) = 0;
     virtual void wait(PxScene* scene) = 0;
+    virtual bool isDone() const = 0;
     virtual void substepStrategy(const PxReal stepSize, PxU32& substepCount, PxReal& substepSize) = 0;
 
     virtual void setSubStepper(const PxReal stepSize, const PxU32 maxSteps)
@@ -115,6 +116,11 @@ class MultiThreadStepper : public PhysicsStepper
             mSync->wait();
     }
 
+    bool isDone() const override
+    {
+        return !mNbSubSteps || !mSync || mSync->wait(0);
+    }
+
     virtual void shutdown();
 
     virtual void reset() = 0;
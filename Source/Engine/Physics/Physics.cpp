@@ -9,8 +9,18 @@
 #include "Engine/Engine/Time.h"
 #include "Engine/Engine/EngineService.h"
 #include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Profiler/ProfilerMemory.h"
 #include "Engine/Serialization/Serialization.h"
 #include "Engine/Threading/Threading.h"
+#include "Engine/Threading/JobSystem.h"
+#if COMPILE_WITH_PHYSICS_COOKING
+#include "CollisionCooking.h"
+#include "Engine/Engine/Globals.h"
+#include "Engine/Platform/FileSystem.h"
+#endif
+
+// The amount of scene queries executed by a single job of the batched queries
+#define PHYSICS_QUERY_BATCH_GRAIN 32
 
 PhysicsScene* Physics::DefaultScene = nullptr;
 Array<PhysicsScene*> Physics::Scenes;
@@ -24,6 +34,8 @@ class PhysicsService : public EngineService
     {
         for (int32 i = 0; i < 32; i++)
             Physics::LayerMasks[i] = MAX_uint32;
+        ParallelInit = true;
+        Dependencies.Add(TEXT("GameSettings"));
     }
 
     bool Init() override;
@@ -33,6 +45,42 @@ class PhysicsService : public EngineService
 
 PhysicsService PhysicsServiceInstance;
 
+namespace
+{
+    bool ExecuteSceneQuery(void* scene, const SceneQuery& query, RayCastHit& hit, Array<PhysicsColliderActor*>& overlaps)
+    {
+        const Vector3 size(query.Size);
+        bool isOverlap = false;
+        switch (query.Type)
+        {
+        case SceneQueryType::RayCast:
+            return PhysicsBackend::RayCast(scene, query.Origin, query.Direction, hit, query.MaxDistance, query.LayerMask, query.HitTriggers);
+        case SceneQueryType::SphereCast:
+            return PhysicsBackend::SphereCast(scene, query.Origin, size.X, query.Direction, hit, query.MaxDistance, query.LayerMask, query.HitTriggers);
+        case SceneQueryType::BoxCast:
+            return PhysicsBackend::BoxCast(scene, query.Origin, size, query.Direction, hit, query.Rotation, query.MaxDistance, query.LayerMask, query.HitTriggers);
+        case SceneQueryType::CapsuleCast:
+            return PhysicsBackend::CapsuleCast(scene, query.Origin, size.X, size.Y, query.Direction, hit, query.Rotation, query.MaxDistance, query.LayerMask, query.HitTriggers);
+        case SceneQueryType::OverlapSphere:
+            isOverlap = PhysicsBackend::OverlapSphere(scene, query.Origin, size.X, overlaps, query.LayerMask, query.HitTriggers);
+            break;
+        case SceneQueryType::OverlapBox:
+            isOverlap = PhysicsBackend::OverlapBox(scene, query.Origin, size, overlaps, query.Rotation, query.LayerMask, query.HitTriggers);
+            break;
+        case SceneQueryType::OverlapCapsule:
+            isOverlap = PhysicsBackend::OverlapCapsule(scene, query.Origin, size.X, size.Y, overlaps, query.Rotation, query.LayerMask, query.HitTriggers);
+            break;
+        default:
+            return false;
+        }
+        if (!isOverlap || overlaps.IsEmpty())
+            return false;
+        hit.Collider = overlaps[0];
+        hit.Point = query.Origin;
+        return true;
+    }
+}
+
 void PhysicsSettings::Apply()
 {
     Time::_physicsMaxDeltaTime = MaxDeltaTime;
@@ -90,6 +138,17 @@ bool PhysicsService::Init()
     if (PhysicsBackend::Init())
         return true;
 
+#if COMPILE_WITH_PHYSICS_COOKING
+    // Setup cooked collision meshes cache
+#if USE_EDITOR
+    CollisionCooking::CachePath = Globals::ProjectCacheFolder / TEXT("Collision");
+#else
+    CollisionCooking::CachePath = Globals::ProductLocalFolder / TEXT("Cache/Collision");
+#endif
+    if (!FileSystem::DirectoryExists(CollisionCooking::CachePath) && FileSystem::CreateDirectory(CollisionCooking::CachePath))
+        CollisionCooking::CachePath.Clear();
+#endif
+
     // Create default scene
     Physics::DefaultScene = Physics::FindOrCreateScene(TEXT("Default"));
     return Physics::DefaultScene == nullptr;
@@ -116,6 +175,10 @@ void PhysicsService::Dispose()
     Physics::Scenes.Resize(0);
     Physics::DefaultScene = nullptr;
 
+#if COMPILE_WITH_PHYSICS_COOKING
+    CollisionCooking::ClearCache();
+#endif
+
     // Dispose backend
     PhysicsBackend::Shutdown();
 }
@@ -189,6 +252,7 @@ void Physics::SetBounceThresholdVelocity(const float value)
 
 void Physics::Simulate(float dt)
 {
+    PROFILE_MEM(Physics);
     for (PhysicsScene* scene : Scenes)
     {
         if (scene->GetAutoSimulation())
@@ -198,10 +262,26 @@ void Physics::Simulate(float dt)
 
 void Physics::CollectResults()
 {
+    // Scenes are simulated concurrently on Job System so collect them in order of completion (results of the finished scenes are processed while the other scenes are still simulated)
+    Array<PhysicsScene*, InlinedAllocation<16>> pending;
     for (PhysicsScene* scene : Scenes)
     {
-        if (scene->GetAutoSimulation())
-            scene->CollectResults();
+        if (scene->GetAutoSimulation() && scene->IsDuringSimulation())
+            pending.Add(scene);
+    }
+    while (pending.HasItems())
+    {
+        int32 index = 0;
+        for (int32 i = 0; i < pending.Count(); i++)
+        {
+            if (pending[i]->IsSimulationDone())
+            {
+                index = i;
+                break;
+            }
+        }
+        pending[index]->CollectResults();
+        pending.RemoveAtKeepOrder(index);
     }
 }
 
@@ -368,6 +448,11 @@ bool Physics::OverlapConvex(const Vector3& center, const CollisionData* convexMe
     return DefaultScene->OverlapConvex(center, convexMesh, scale, results, rotation, layerMask, hitTriggers);
 }
 
+int32 Physics::QueryBatch(const Span<SceneQuery>& queries, Array<RayCastHit>& results)
+{
+    return DefaultScene->QueryBatch(queries, results);
+}
+
 PhysicsScene::PhysicsScene(const SpawnParams& params)
     : ScriptingObject(params)
 {
@@ -467,11 +552,17 @@ bool PhysicsScene::IsDuringSimulation() const
     return _isDuringSimulation;
 }
 
+bool PhysicsScene::IsSimulationDone() const
+{
+    return !_isDuringSimulation || PhysicsBackend::IsSceneSimulationDone(_scene);
+}
+
 void PhysicsScene::CollectResults()
 {
     if (!_isDuringSimulation)
         return;
     ASSERT(IsInMainThread());
+    PROFILE_MEM(Physics);
     PhysicsBackend::EndSimulateScene(_scene);
     _isDuringSimulation = false;
 }
@@ -637,3 +728,47 @@ bool PhysicsScene::OverlapConvex(const Vector3& center, const CollisionData* con
 {
     return PhysicsBackend::OverlapConvex(_scene, center, convexMesh, scale, results, rotation, layerMask, hitTriggers);
 }
+
+int32 PhysicsScene::QueryBatch(const Span<SceneQuery>& queries, Array<RayCastHit>& results)
+{
+    PROFILE_CPU();
+    results.Resize(queries.Length(), false);
+    if (queries.Length() == 0)
+        return 0;
+    int64 hitsCount = 0;
+    void* scene = _scene;
+    const SceneQuery* queriesPtr = queries.Get();
+    RayCastHit* resultsPtr = results.Get();
+    const int32 queriesCount = queries.Length();
+    const Function<void(int32)> job = [scene, queriesPtr, resultsPtr, queriesCount, &hitsCount](int32 jobIndex)
+    {
+        PROFILE_CPU_NAMED("Physics.QueryBatch");
+        const int32 start = jobIndex * PHYSICS_QUERY_BATCH_GRAIN;
+        const int32 end = Math::Min(start + PHYSICS_QUERY_BATCH_GRAIN, queriesCount);
+        Array<PhysicsColliderActor*> overlaps;
+        int64 jobHitsCount = 0;
+        for (int32 i = start; i < end; i++)
+        {
+            RayCastHit& hit = resultsPtr[i];
+            hit.Collider = nullptr;
+            hit.Material = nullptr;
+            hit.Normal = Vector3::Zero;
+            hit.Distance = 0.0f;
+            hit.Point = Vector3::Zero;
+            hit.FaceIndex = 0;
+            hit.UV = Float2::Zero;
+            if (ExecuteSceneQuery(scene, queriesPtr[i], hit, overlaps))
+                jobHitsCount++;
+        }
+        if (jobHitsCount != 0)
+            Platform::InterlockedAdd(&hitsCount, jobHitsCount);
+    };
+
+    // Execute small batches inline, otherwise spread the queries over the job system workers (scene queries are read-only)
+    const int32 jobsCount = Math::DivideAndRoundUp(queriesCount, PHYSICS_QUERY_BATCH_GRAIN);
+    if (jobsCount == 1)
+        job(0);
+    else
+        JobSystem::Execute(job, jobsCount);
+    return (int32)hitsCount;
+}
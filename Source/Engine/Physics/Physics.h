@@ -3,6 +3,7 @@
 #pragma once
 
 #include "Engine/Core/Math/Quaternion.h"
+#include "Engine/Core/Types/Span.h"
 #include "Types.h"
 
 /// <summary>
@@ -471,4 +472,12 @@ API_CLASS(Static) class FLAXENGINE_API Physics
     /// <param name="hitTriggers">If set to <c>true</c> triggers will be hit, otherwise will skip them.</param>
     /// <returns>True if convex mesh overlaps any matching object, otherwise false.</returns>
     API_FUNCTION() static bool OverlapConvex(const Vector3& center, const CollisionData* convexMesh, const Vector3& scale, API_PARAM(Out) Array<PhysicsColliderActor*, HeapAllocation>& results, const Quaternion& rotation = Quaternion::Identity, uint32 layerMask = MAX_uint32, bool hitTriggers = true);
+
+    /// <summary>
+    /// Performs the batch of scene queries (raycasts, shape sweeps and overlap tests). Queries are executed in parallel using Job System workers and the results are written in the same order as queries.
+    /// </summary>
+    /// <param name="queries">The scene queries to execute.</param>
+    /// <param name="results">The results of the queries (one per query). Result with a null Collider means no hit. Overlap queries report only the first overlapping collider.</param>
+    /// <returns>The amount of queries that hit any matching object.</returns>
+    API_FUNCTION() static int32 QueryBatch(const Span<SceneQuery>& queries, API_PARAM(Out) Array<RayCastHit, HeapAllocation>& results);
 };
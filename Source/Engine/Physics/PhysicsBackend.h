@@ -104,6 +104,7 @@ class FLAXENGINE_API PhysicsBackend
     static void* CreateScene(const PhysicsSettings& settings);
     static void DestroyScene(void* scene);
     static void StartSimulateScene(void* scene, float dt);
+    static bool IsSceneSimulationDone(void* scene);
     static void EndSimulateScene(void* scene);
     static Vector3 GetSceneGravity(void* scene);
     static void SetSceneGravity(void* scene, const Vector3& value);
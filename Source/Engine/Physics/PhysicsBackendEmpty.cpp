@@ -76,6 +76,11 @@ void PhysicsBackend::StartSimulateScene(void* scene, float dt)
 {
 }
 
+bool PhysicsBackend::IsSceneSimulationDone(void* scene)
+{
+    return true;
+}
+
 void PhysicsBackend::EndSimulateScene(void* scene)
 {
 }
@@ -5,6 +5,7 @@
 #include "Engine/Core/Math/Vector3.h"
 #include "Engine/Core/Math/Quaternion.h"
 #include "Engine/Scripting/ScriptingObject.h"
+#include "Engine/Core/Types/Span.h"
 #include "Types.h"
 
 struct ActionData;
@@ -127,6 +128,11 @@ API_CLASS() class FLAXENGINE_API PhysicsScene : public ScriptingObject
     /// </summary>
     API_PROPERTY() bool IsDuringSimulation() const;
 
+    /// <summary>
+    /// Checks if physical simulation has finished and results can be collected without waiting (non-blocking). Returns true if scene is not during simulation.
+    /// </summary>
+    API_PROPERTY() bool IsSimulationDone() const;
+
     /// <summary>
     /// Called to collect physic simulation results and apply them as well as fire collision events.
     /// </summary>
@@ -509,4 +515,12 @@ API_CLASS() class FLAXENGINE_API PhysicsScene : public ScriptingObject
     /// <param name="hitTriggers">If set to <c>true</c> triggers will be hit, otherwise will skip them.</param>
     /// <returns>True if convex mesh overlaps any matching object, otherwise false.</returns>
     API_FUNCTION() bool OverlapConvex(const Vector3& center, const CollisionData* convexMesh, const Vector3& scale, API_PARAM(Out) Array<PhysicsColliderActor*, HeapAllocation>& results, const Quaternion& rotation = Quaternion::Identity, uint32 layerMask = MAX_uint32, bool hitTriggers = true);
+
+    /// <summary>
+    /// Performs the batch of scene queries (raycasts, shape sweeps and overlap tests). Queries are executed in parallel using Job System workers and the results are written in the same order as queries.
+    /// </summary>
+    /// <param name="queries">The scene queries to execute.</param>
+    /// <param name="results">The results of the queries (one per query). Result with a null Collider means no hit. Overlap queries report only the first overlapping collider.</param>
+    /// <returns>The amount of queries that hit any matching object.</returns>
+    API_FUNCTION() int32 QueryBatch(const Span<SceneQuery>& queries, API_PARAM(Out) Array<RayCastHit, HeapAllocation>& results);
 };
@@ -5,6 +5,7 @@
 #include "Engine/Core/Config.h"
 #include "Engine/Core/Math/Vector2.h"
 #include "Engine/Core/Math/Vector3.h"
+#include "Engine/Core/Math/Quaternion.h"
 #include "Engine/Scripting/ScriptingType.h"
 
 struct PhysicsStatistics;
@@ -174,6 +175,95 @@ API_STRUCT(NoDefault) struct RayCastHit
     API_FIELD() Float2 UV;
 };
 
+/// <summary>
+/// The type of the scene query used by the batched queries.
+/// </summary>
+API_ENUM() enum class SceneQueryType : byte
+{
+    /// <summary>
+    /// Raycast against the scene (returns the closest hit).
+    /// </summary>
+    RayCast,
+
+    /// <summary>
+    /// Sphere sweep against the scene (returns the closest hit). Uses Size.X as sphere radius.
+    /// </summary>
+    SphereCast,
+
+    /// <summary>
+    /// Box sweep against the scene (returns the closest hit). Uses Size as box half extents.
+    /// </summary>
+    BoxCast,
+
+    /// <summary>
+    /// Capsule sweep against the scene (returns the closest hit). Uses Size.X as capsule radius and Size.Y as capsule height.
+    /// </summary>
+    CapsuleCast,
+
+    /// <summary>
+    /// Sphere overlap test (returns the first overlapping collider). Uses Size.X as sphere radius.
+    /// </summary>
+    OverlapSphere,
+
+    /// <summary>
+    /// Box overlap test (returns the first overlapping collider). Uses Size as box half extents.
+    /// </summary>
+    OverlapBox,
+
+    /// <summary>
+    /// Capsule overlap test (returns the first overlapping collider). Uses Size.X as capsule radius and Size.Y as capsule height.
+    /// </summary>
+    OverlapCapsule,
+};
+
+/// <summary>
+/// The scene query description used by the batched queries (see PhysicsScene::QueryBatch). Contains only plain data so arrays of queries can be passed to the native code without per-query marshalling.
+/// </summary>
+API_STRUCT() struct SceneQuery
+{
+    DECLARE_SCRIPTING_TYPE_MINIMAL(SceneQuery);
+
+    /// <summary>
+    /// The query type.
+    /// </summary>
+    API_FIELD() SceneQueryType Type = SceneQueryType::RayCast;
+
+    /// <summary>
+    /// The hit results filtering mode. If true, trigger colliders will be included in the results.
+    /// </summary>
+    API_FIELD() bool HitTriggers = true;
+
+    /// <summary>
+    /// The layer mask used to filter the results.
+    /// </summary>
+    API_FIELD() uint32 LayerMask = MAX_uint32;
+
+    /// <summary>
+    /// The origin of the ray or the center of the shape (in world space).
+    /// </summary>
+    API_FIELD() Vector3 Origin = Vector3::Zero;
+
+    /// <summary>
+    /// The normalized direction of the ray or the shape sweep. Unused by the overlap queries.
+    /// </summary>
+    API_FIELD() Vector3 Direction = Vector3::Forward;
+
+    /// <summary>
+    /// The maximum distance the ray or the shape should check for collisions. Unused by the overlap queries.
+    /// </summary>
+    API_FIELD() float MaxDistance = MAX_float;
+
+    /// <summary>
+    /// The shape size (see SceneQueryType for the usage per query type).
+    /// </summary>
+    API_FIELD() Float3 Size = Float3::Zero;
+
+    /// <summary>
+    /// The shape rotation.
+    /// </summary>
+    API_FIELD() Quaternion Rotation = Quaternion::Identity;
+};
+
 /// <summary>
 /// Physics collision shape variant for different shapes such as box, sphere, capsule.
 /// </summary>
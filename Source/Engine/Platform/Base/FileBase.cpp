@@ -8,6 +8,19 @@
 #include "Engine/Core/Log.h"
 #include "Engine/Profiler/ProfilerCPU.h"
 
+bool FileBase::MapReadOnly(const StringView& path, const byte*& data, uint64& size, bool shared)
+{
+    return true;
+}
+
+void FileBase::Unmap(const byte* data, uint64 size)
+{
+}
+
+void FileBase::Prefetch(const byte* data, uint64 size)
+{
+}
+
 bool FileBase::ReadAllBytes(const StringView& path, byte* data, int32 length)
 {
     PROFILE_CPU_NAMED("File::ReadAllBytes");
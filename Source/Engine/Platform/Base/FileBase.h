@@ -140,4 +140,30 @@ class FLAXENGINE_API FileBase : public NonCopyable
     static bool WriteAllText(const StringView& path, const String& data, Encoding encoding);
     static bool WriteAllText(const StringView& path, const StringBuilder& data, Encoding encoding);
     static bool WriteAllText(const StringView& path, const Char* data, int32 length, Encoding encoding);
+
+public:
+    /// <summary>
+    /// Maps the whole file contents into the process memory (read-only source, pages are loaded by the system on access). Writes to the mapped memory are private to the process and never go to the file.
+    /// </summary>
+    /// <remarks>The shared mapping is protected against writes (access violation) and doesn't reserve the commit charge for the private page copies, its pages are backed only by the system file cache that is shared by all processes mapping the same file.</remarks>
+    /// <param name="path">The file path.</param>
+    /// <param name="data">The output mapped memory pointer.</param>
+    /// <param name="size">The output mapped memory size (in bytes).</param>
+    /// <param name="shared">True if use the shared read-only mapping, otherwise the private copy-on-write mapping.</param>
+    /// <returns>True if cannot map the file (or platform doesn't support it), otherwise false.</returns>
+    static bool MapReadOnly(const StringView& path, const byte*& data, uint64& size, bool shared = false);
+
+    /// <summary>
+    /// Releases the file memory mapping created with MapReadOnly.
+    /// </summary>
+    /// <param name="data">The mapped memory pointer.</param>
+    /// <param name="size">The mapped memory size (in bytes).</param>
+    static void Unmap(const byte* data, uint64 size);
+
+    /// <summary>
+    /// Hints the system to asynchronously read the range of the memory-mapped file so it's resident once accessed (allows many reads to be in flight at once).
+    /// </summary>
+    /// <param name="data">The mapped memory range start.</param>
+    /// <param name="size">The mapped memory range size (in bytes).</param>
+    static void Prefetch(const byte* data, uint64 size);
 };
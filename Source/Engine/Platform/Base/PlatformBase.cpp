@@ -17,6 +17,7 @@
 #include "Engine/Core/Utilities.h"
 #if COMPILE_WITH_PROFILER
 #include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Profiler/ProfilerMemory.h"
 #endif
 #include "Engine/Threading/Threading.h"
 #include "Engine/Engine/CommandLine.h"
@@ -194,10 +195,16 @@ void PlatformBase::Exit()
 
 #define TRACY_ENABLE_MEMORY (TRACY_ENABLE)
 
+void PlatformBase::SleepMicroseconds(int64 microseconds)
+{
+    Platform::Sleep((int32)(microseconds / 1000));
+}
+
 void PlatformBase::OnMemoryAlloc(void* ptr, uint64 size)
 {
     if (!ptr)
         return;
+    ProfilerMemory::OnAllocate(ptr, size);
 
 #if TRACY_ENABLE_MEMORY
     // Track memory allocation in Tracy
@@ -221,6 +228,7 @@ void PlatformBase::OnMemoryFree(void* ptr)
 {
     if (!ptr)
         return;
+    ProfilerMemory::OnFree(ptr);
 
 #if TRACY_ENABLE_MEMORY
     // Track memory allocation in Tracy
@@ -14,6 +14,13 @@ struct CreateProcessSettings;
 struct CreateWindowSettings;
 struct BatteryInfo;
 
+#if COMPILE_WITH_PROFILER
+// The size of the header placed by the platform allocator before each memory block (used by the memory profiler to track allocations size and tag).
+#define PLATFORM_MEMORY_HEADER_SIZE 16
+#else
+#define PLATFORM_MEMORY_HEADER_SIZE 0
+#endif
+
 // ReSharper disable CppFunctionIsNotImplemented
 
 /// <summary>
@@ -406,6 +413,12 @@ DECLARE_SCRIPTING_TYPE_MINIMAL(PlatformBase);
     /// <param name="milliseconds">The time interval for which execution is to be suspended, in milliseconds.</param>
     static void Sleep(int32 milliseconds) = delete;
 
+    /// <summary>
+    /// Suspends the execution of the current thread until the time-out interval elapses. Uses the high-resolution timer (if supported by the platform) to wait with the sub-millisecond precision.
+    /// </summary>
+    /// <param name="microseconds">The time interval for which execution is to be suspended, in microseconds.</param>
+    static void SleepMicroseconds(int64 microseconds);
+
 public:
     /// <summary>
     /// Gets the current time in seconds.
@@ -46,7 +46,13 @@ class FLAXENGINE_API UnixConditionVariable
     /// <param name="lock">The critical section locked by the current thread.</param>
     void Wait(const UnixCriticalSection& lock)
     {
+#if COMPILE_WITH_LOCK_PROFILER
+        const int32 depth = lock._profiler.BeginSignalWait();
         pthread_cond_wait(&_cond, lock._mutexPtr);
+        lock._profiler.EndSignalWait(depth);
+#else
+        pthread_cond_wait(&_cond, lock._mutexPtr);
+#endif
     }
 
     /// <summary>
@@ -64,7 +70,14 @@ class FLAXENGINE_API UnixConditionVariable
         ts.tv_nsec = tv.tv_usec * 1000 + 1000 * 1000 * (timeout % 1000);
         ts.tv_sec += ts.tv_nsec / (1000 * 1000 * 1000);
         ts.tv_nsec %= (1000 * 1000 * 1000);
+#if COMPILE_WITH_LOCK_PROFILER
+        const int32 depth = lock._profiler.BeginSignalWait();
+        const bool result = pthread_cond_timedwait(&_cond, lock._mutexPtr, &ts) == 0;
+        lock._profiler.EndSignalWait(depth);
+        return result;
+#else
         return pthread_cond_timedwait(&_cond, lock._mutexPtr, &ts) == 0;
+#endif
     }
 
     /// <summary>
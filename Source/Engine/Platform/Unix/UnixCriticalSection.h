@@ -6,6 +6,9 @@
 
 #include "Engine/Platform/Platform.h"
 #include <pthread.h>
+#if COMPILE_WITH_LOCK_PROFILER
+#include "Engine/Profiler/ProfilerLocks.h"
+#endif
 
 class UnixConditionVariable;
 
@@ -22,6 +25,9 @@ class FLAXENGINE_API UnixCriticalSection
 #if BUILD_DEBUG
     pthread_t _owningThreadId;
 #endif
+#if COMPILE_WITH_LOCK_PROFILER
+    mutable ProfilerLockState _profiler;
+#endif
 
     UnixCriticalSection(const UnixCriticalSection&);
     UnixCriticalSection& operator=(const UnixCriticalSection&);
@@ -44,6 +50,18 @@ class FLAXENGINE_API UnixCriticalSection
 #endif
     }
 
+    /// <summary>
+    /// Initializes a new instance of the <see cref="UnixCriticalSection"/> class.
+    /// </summary>
+    /// <param name="name">The lock name used by the lock contention profiler (must be a static string). Locks with the same name share the statistics.</param>
+    explicit UnixCriticalSection(const char* name)
+        : UnixCriticalSection()
+    {
+#if COMPILE_WITH_LOCK_PROFILER
+        _profiler.Stats = ProfilerLocks::GetStats(name);
+#endif
+    }
+
     /// <summary>
     /// Finalizes an instance of the <see cref="UnixCriticalSection"/> class.
     /// </summary>
@@ -59,7 +77,24 @@ class FLAXENGINE_API UnixCriticalSection
     /// </summary>
     NO_SANITIZE_THREAD void Lock() const
     {
+#if COMPILE_WITH_LOCK_PROFILER
+        if (_profiler.Stats)
+        {
+            double waitStart = -1.0;
+            if (pthread_mutex_trylock(_mutexPtr) != 0)
+            {
+                waitStart = ProfilerLocks::GetTime();
+                pthread_mutex_lock(_mutexPtr);
+            }
+            _profiler.OnLocked(waitStart);
+        }
+        else
+        {
+            pthread_mutex_lock(_mutexPtr);
+        }
+#else
         pthread_mutex_lock(_mutexPtr);
+#endif
 #if BUILD_DEBUG
         ((UnixCriticalSection*)this)->_owningThreadId = pthread_self();
 #endif
@@ -71,7 +106,15 @@ class FLAXENGINE_API UnixCriticalSection
     /// <returns>True if calling thread took ownership of the critical section.</returns>
     NO_SANITIZE_THREAD bool TryLock() const
     {
+#if COMPILE_WITH_LOCK_PROFILER
+        if (pthread_mutex_trylock(_mutexPtr) != 0)
+            return false;
+        if (_profiler.Stats)
+            _profiler.OnLocked(-1.0);
+        return true;
+#else
         return pthread_mutex_trylock(_mutexPtr) == 0;
+#endif
     }
 
     /// <summary>
@@ -81,6 +124,10 @@ class FLAXENGINE_API UnixCriticalSection
     {
 #if BUILD_DEBUG
         ((UnixCriticalSection*)this)->_owningThreadId = 0;
+#endif
+#if COMPILE_WITH_LOCK_PROFILER
+        if (_profiler.Stats)
+            _profiler.OnUnlocked();
 #endif
         pthread_mutex_unlock(_mutexPtr);
     }
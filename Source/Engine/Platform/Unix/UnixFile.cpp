@@ -15,6 +15,7 @@
 #endif
 #include <sys/file.h>
 #include <sys/stat.h>
+#include <sys/mman.h>
 #include <fcntl.h>
 #include <unistd.h>
 #include <cerrno>
@@ -84,6 +85,48 @@ UnixFile* UnixFile::Open(const StringView& path, FileMode mode, FileAccess acces
     return New<UnixFile>(handle);
 }
 
+bool UnixFile::MapReadOnly(const StringView& path, const byte*& data, uint64& size, bool shared)
+{
+    const StringAsUTF8<> pathANSI(*path, path.Length());
+    const int32 handle = open(pathANSI.Get(), O_RDONLY | O_CLOEXEC);
+    if (handle == -1)
+        return true;
+    struct stat fileInfo;
+    if (fstat(handle, &fileInfo) != 0 || fileInfo.st_size <= 0)
+    {
+        close(handle);
+        return true;
+    }
+
+    // Private mapping so the file is never modified (mapping stays valid after closing the descriptor)
+    // Shared mapping is read-only so it's not accounted as the committed memory and it always uses the page cache pages
+    void* view = mmap(nullptr, (size_t)fileInfo.st_size, shared ? PROT_READ : PROT_READ | PROT_WRITE, shared ? MAP_SHARED : MAP_PRIVATE, handle, 0);
+    close(handle);
+    if (view == MAP_FAILED)
+    {
+        LOG_UNIX_LAST_ERROR;
+        return true;
+    }
+    data = (const byte*)view;
+    size = (uint64)fileInfo.st_size;
+    return false;
+}
+
+void UnixFile::Unmap(const byte* data, uint64 size)
+{
+    if (data)
+        munmap((void*)data, (size_t)size);
+}
+
+void UnixFile::Prefetch(const byte* data, uint64 size)
+{
+    if (!data || size == 0)
+        return;
+    const uintptr pageSize = (uintptr)sysconf(_SC_PAGESIZE);
+    const uintptr start = (uintptr)data & ~(pageSize - 1);
+    madvise((void*)start, (size_t)((uintptr)data + size - start), MADV_WILLNEED);
+}
+
 bool UnixFile::Read(void* buffer, uint32 bytesToRead, uint32* bytesRead)
 {
     const ssize_t tmp = read(_handle, buffer, bytesToRead);
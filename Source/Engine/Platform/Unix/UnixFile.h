@@ -40,6 +40,11 @@ class FLAXENGINE_API UnixFile : public FileBase
     /// <returns>Opened file handle or null if cannot.</returns>
     static UnixFile* Open(const StringView& path, FileMode mode, FileAccess access = FileAccess::ReadWrite, FileShare share = FileShare::None);
 
+    // [FileBase]
+    static bool MapReadOnly(const StringView& path, const byte*& data, uint64& size, bool shared = false);
+    static void Unmap(const byte* data, uint64 size);
+    static void Prefetch(const byte* data, uint64 size);
+
 public:
 
     // [FileBase]
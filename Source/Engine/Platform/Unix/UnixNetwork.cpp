@@ -12,6 +12,7 @@
 #include <arpa/inet.h>
 #include <unistd.h>
 #include <netdb.h>
+#include <poll.h>
 #include <cerrno>
 
 struct UnixSocketData
@@ -231,6 +232,34 @@ bool UnixNetwork::Accept(NetworkSocket& serverSocket, NetworkSocket& newSocket,
     return false;
 }
 
+bool UnixNetwork::IsReadable(NetworkSocket& socket)
+{
+    pollfd entry;
+    entry.fd = ((UnixSocketData*)&socket.Data)->sockfd;
+    entry.events = POLLIN;
+    if (poll(&entry, 1, 0) < 0)
+    {
+        LOG(Error, "Unable to poll socket! Socket : {0}", entry.fd);
+        LOG_UNIX_LAST_ERROR;
+        return false;
+    }
+    return (entry.revents & POLLIN) != 0;
+}
+
+bool UnixNetwork::IsWritable(NetworkSocket& socket)
+{
+    pollfd entry;
+    entry.fd = ((UnixSocketData*)&socket.Data)->sockfd;
+    entry.events = POLLOUT;
+    if (poll(&entry, 1, 0) < 0)
+    {
+        LOG(Error, "Unable to poll socket! Socket : {0}", entry.fd);
+        LOG_UNIX_LAST_ERROR;
+        return false;
+    }
+    return (entry.revents & POLLOUT) != 0;
+}
+
 int32 UnixNetwork::WriteSocket(NetworkSocket socket, byte* data, uint32 length, NetworkEndPoint* endPoint)
 {
     auto& sock = *(UnixSocketData*)&socket.Data;
@@ -19,6 +19,8 @@ class FLAXENGINE_API UnixNetwork : public NetworkBase
     static bool BindSocket(NetworkSocket& socket, NetworkEndPoint& endPoint);
     static bool Listen(NetworkSocket& socket, uint16 queueSize);
     static bool Accept(NetworkSocket& serverSocket, NetworkSocket& newSocket, NetworkEndPoint& newEndPoint);
+    static bool IsReadable(NetworkSocket& socket);
+    static bool IsWritable(NetworkSocket& socket);
     static int32 WriteSocket(NetworkSocket socket, byte* data, uint32 length, NetworkEndPoint* endPoint = nullptr);
     static int32 ReadSocket(NetworkSocket socket, byte* buffer, uint32 bufferSize, NetworkEndPoint* endPoint = nullptr);
     static bool CreateEndPoint(const String& address, const String& port, NetworkIPVersion ipv, NetworkEndPoint& endPoint, bool bindable = true);
@@ -7,6 +7,7 @@
 #include <unistd.h>
 #include <cstdint>
 #include <stdlib.h>
+#include <time.h>
 
 typedef uint16_t offset_t;
 #define align_mem_up(num, align) (((num) + ((align) - 1)) & ~((align) - 1))
@@ -20,15 +21,15 @@ void* UnixPlatform::Allocate(uint64 size, uint64 alignment)
 
     if (alignment && size)
     {
-        uint32_t pad = sizeof(offset_t) + (alignment - 1);
+        uint32_t pad = sizeof(offset_t) + PLATFORM_MEMORY_HEADER_SIZE + (alignment - 1);
         void* p = malloc(size + pad);
         if (p)
         {
-            // Add the offset size to malloc's pointer
-            ptr = (void*)align_mem_up(((uintptr_t)p + sizeof(offset_t)), alignment);
+            // Add the offset size (and memory profiler header) to malloc's pointer
+            ptr = (void*)align_mem_up(((uintptr_t)p + sizeof(offset_t) + PLATFORM_MEMORY_HEADER_SIZE), alignment);
 
-            // Calculate the offset and store it behind aligned pointer
-            *((offset_t*)ptr - 1) = (offset_t)((uintptr_t)ptr - (uintptr_t)p);
+            // Calculate the offset and store it behind aligned pointer (and memory profiler header)
+            *((offset_t*)((uintptr_t)ptr - PLATFORM_MEMORY_HEADER_SIZE) - 1) = (offset_t)((uintptr_t)ptr - (uintptr_t)p);
         }
 #if COMPILE_WITH_PROFILER
         OnMemoryAlloc(ptr, size);
@@ -45,7 +46,7 @@ void UnixPlatform::Free(void* ptr)
         OnMemoryFree(ptr);
 #endif
         // Walk backwards from the passed-in pointer to get the pointer offset
-        offset_t offset = *((offset_t*)ptr - 1);
+        offset_t offset = *((offset_t*)((uintptr_t)ptr - PLATFORM_MEMORY_HEADER_SIZE) - 1);
 
         // Get original pointer
         void* p = (void*)((uint8_t*)ptr - offset);
@@ -60,4 +61,12 @@ uint64 UnixPlatform::GetCurrentProcessId()
     return getpid();
 }
 
+void UnixPlatform::SleepMicroseconds(int64 microseconds)
+{
+    struct timespec ts;
+    ts.tv_sec = (time_t)(microseconds / 1000000);
+    ts.tv_nsec = (long)(microseconds % 1000000) * 1000;
+    nanosleep(&ts, nullptr);
+}
+
 #endif
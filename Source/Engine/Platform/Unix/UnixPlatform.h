@@ -17,6 +17,7 @@ class FLAXENGINE_API UnixPlatform : public PlatformBase
     static void* Allocate(uint64 size, uint64 alignment);
     static void Free(void* ptr);
     static uint64 GetCurrentProcessId();
+    static void SleepMicroseconds(int64 microseconds);
 };
 
 #endif
@@ -46,7 +46,13 @@ class FLAXENGINE_API Win32ConditionVariable
     /// <param name="lock">The critical section locked by the current thread.</param>
     void Wait(const Win32CriticalSection& lock)
     {
+#if COMPILE_WITH_LOCK_PROFILER
+        const int32 depth = lock._profiler.BeginSignalWait();
         Windows::SleepConditionVariableCS(&_cond, &lock._criticalSection, 0xFFFFFFFF);
+        lock._profiler.EndSignalWait(depth);
+#else
+        Windows::SleepConditionVariableCS(&_cond, &lock._criticalSection, 0xFFFFFFFF);
+#endif
     }
 
     /// <summary>
@@ -57,7 +63,14 @@ class FLAXENGINE_API Win32ConditionVariable
     /// <returns>If the function succeeds, the return value is true, otherwise, if the function fails or the time-out interval elapses, the return value is false.</returns>
     bool Wait(const Win32CriticalSection& lock, const int32 timeout)
     {
+#if COMPILE_WITH_LOCK_PROFILER
+        const int32 depth = lock._profiler.BeginSignalWait();
+        const bool result = !!Windows::SleepConditionVariableCS(&_cond, &lock._criticalSection, timeout);
+        lock._profiler.EndSignalWait(depth);
+        return result;
+#else
         return !!Windows::SleepConditionVariableCS(&_cond, &lock._criticalSection, timeout);
+#endif
     }
 
     /// <summary>
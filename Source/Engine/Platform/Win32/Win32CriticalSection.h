@@ -5,6 +5,9 @@
 #if PLATFORM_WIN32
 
 #include "WindowsMinimal.h"
+#if COMPILE_WITH_LOCK_PROFILER
+#include "Engine/Profiler/ProfilerLocks.h"
+#endif
 
 class Win32ConditionVariable;
 
@@ -17,6 +20,9 @@ class FLAXENGINE_API Win32CriticalSection
 
 private:
     mutable Windows::CRITICAL_SECTION _criticalSection;
+#if COMPILE_WITH_LOCK_PROFILER
+    mutable ProfilerLockState _profiler;
+#endif
 
 private:
     Win32CriticalSection(const Win32CriticalSection&);
@@ -31,6 +37,18 @@ class FLAXENGINE_API Win32CriticalSection
         Windows::InitializeCriticalSectionEx(&_criticalSection, 4000, 0x01000000);
     }
 
+    /// <summary>
+    /// Initializes a new instance of the <see cref="Win32CriticalSection"/> class.
+    /// </summary>
+    /// <param name="name">The lock name used by the lock contention profiler (must be a static string). Locks with the same name share the statistics.</param>
+    explicit Win32CriticalSection(const char* name)
+        : Win32CriticalSection()
+    {
+#if COMPILE_WITH_LOCK_PROFILER
+        _profiler.Stats = ProfilerLocks::GetStats(name);
+#endif
+    }
+
     /// <summary>
     /// Finalizes an instance of the <see cref="Win32CriticalSection"/> class.
     /// </summary>
@@ -45,6 +63,19 @@ class FLAXENGINE_API Win32CriticalSection
     /// </summary>
     void Lock() const
     {
+#if COMPILE_WITH_LOCK_PROFILER
+        if (_profiler.Stats)
+        {
+            double waitStart = -1.0;
+            if (Windows::TryEnterCriticalSection(&_criticalSection) == 0)
+            {
+                waitStart = ProfilerLocks::GetTime();
+                Windows::EnterCriticalSection(&_criticalSection);
+            }
+            _profiler.OnLocked(waitStart);
+            return;
+        }
+#endif
         Windows::EnterCriticalSection(&_criticalSection);
     }
 
@@ -54,7 +85,15 @@ class FLAXENGINE_API Win32CriticalSection
     /// <returns>True if calling thread took ownership of the critical section.</returns>
     bool TryLock() const
     {
+#if COMPILE_WITH_LOCK_PROFILER
+        if (Windows::TryEnterCriticalSection(&_criticalSection) == 0)
+            return false;
+        if (_profiler.Stats)
+            _profiler.OnLocked(-1.0);
+        return true;
+#else
         return Windows::TryEnterCriticalSection(&_criticalSection) != 0;
+#endif
     }
 
     /// <summary>
@@ -62,6 +101,10 @@ class FLAXENGINE_API Win32CriticalSection
     /// </summary>
     void Unlock() const
     {
+#if COMPILE_WITH_LOCK_PROFILER
+        if (_profiler.Stats)
+            _profiler.OnUnlocked();
+#endif
         Windows::LeaveCriticalSection(&_criticalSection);
     }
 };
@@ -34,6 +34,75 @@ Win32File* Win32File::Open(const StringView& path, FileMode mode, FileAccess acc
     return New<Win32File>((void*)handle);
 }
 
+bool Win32File::MapReadOnly(const StringView& path, const byte*& data, uint64& size, bool shared)
+{
+#if PLATFORM_UWP
+    return true;
+#else
+    const HANDLE handle = CreateFileW(*path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (handle == INVALID_HANDLE_VALUE)
+        return true;
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(handle, &fileSize) || fileSize.QuadPart <= 0)
+    {
+        CloseHandle(handle);
+        return true;
+    }
+
+    // Copy-on-write mapping so the file is never modified (view stays valid after closing the handles)
+    // Shared mapping is read-only so the view doesn't charge the commit for the potential page copies
+    const HANDLE mapping = CreateFileMappingW(handle, nullptr, shared ? PAGE_READONLY : PAGE_WRITECOPY, 0, 0, nullptr);
+    CloseHandle(handle);
+    if (!mapping)
+    {
+        LOG_WIN32_LAST_ERROR;
+        return true;
+    }
+    void* view = MapViewOfFile(mapping, shared ? FILE_MAP_READ : FILE_MAP_COPY, 0, 0, 0);
+    CloseHandle(mapping);
+    if (!view)
+    {
+        LOG_WIN32_LAST_ERROR;
+        return true;
+    }
+    data = (const byte*)view;
+    size = (uint64)fileSize.QuadPart;
+    return false;
+#endif
+}
+
+void Win32File::Unmap(const byte* data, uint64 size)
+{
+#if !PLATFORM_UWP
+    if (data)
+        UnmapViewOfFile(data);
+#endif
+}
+
+void Win32File::Prefetch(const byte* data, uint64 size)
+{
+#if !PLATFORM_UWP
+    if (!data || size == 0)
+        return;
+
+    // PrefetchVirtualMemory is available since Windows 8
+    struct MemoryRangeEntry
+    {
+        PVOID VirtualAddress;
+        SIZE_T NumberOfBytes;
+    };
+    typedef BOOL (WINAPI*PrefetchVirtualMemoryProc)(HANDLE, ULONG_PTR, MemoryRangeEntry*, ULONG);
+    static PrefetchVirtualMemoryProc prefetchVirtualMemory = (PrefetchVirtualMemoryProc)GetProcAddress(GetModuleHandleW(L"kernel32.dll"), "PrefetchVirtualMemory");
+    if (prefetchVirtualMemory)
+    {
+        MemoryRangeEntry range;
+        range.VirtualAddress = (PVOID)data;
+        range.NumberOfBytes = (SIZE_T)size;
+        prefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+    }
+#endif
+}
+
 bool Win32File::Read(void* buffer, uint32 bytesToRead, uint32* bytesRead)
 {
     // Try to read data
@@ -248,9 +248,14 @@ void Win32Platform::Prefetch(void const* ptr)
 
 void* Win32Platform::Allocate(uint64 size, uint64 alignment)
 {
-    void* ptr = _aligned_malloc((size_t)size, (size_t)alignment);
 #if COMPILE_WITH_PROFILER
+    // Allocate space for the memory profiler header before the aligned block
+    void* ptr = _aligned_offset_malloc((size_t)size + PLATFORM_MEMORY_HEADER_SIZE, (size_t)alignment, PLATFORM_MEMORY_HEADER_SIZE);
+    if (ptr)
+        ptr = (byte*)ptr + PLATFORM_MEMORY_HEADER_SIZE;
     OnMemoryAlloc(ptr, size);
+#else
+    void* ptr = _aligned_malloc((size_t)size, (size_t)alignment);
 #endif
     return ptr;
 }
@@ -258,7 +263,10 @@ void* Win32Platform::Allocate(uint64 size, uint64 alignment)
 void Win32Platform::Free(void* ptr)
 {
 #if COMPILE_WITH_PROFILER
+    if (!ptr)
+        return;
     OnMemoryFree(ptr);
+    ptr = (byte*)ptr - PLATFORM_MEMORY_HEADER_SIZE;
 #endif
     _aligned_free(ptr);
 }
@@ -369,6 +377,11 @@ void Win32Platform::SetThreadAffinityMask(uint64 affinityMask)
 }
 
 void Win32Platform::Sleep(int32 milliseconds)
+{
+    SleepMicroseconds(int64(milliseconds) * 1000);
+}
+
+void Win32Platform::SleepMicroseconds(int64 microseconds)
 {
     static thread_local HANDLE timer = NULL;
     if (timer == NULL)
@@ -381,7 +394,7 @@ void Win32Platform::Sleep(int32 milliseconds)
 
     // Negative value is relative to current time, minimum waitable time is 10 microseconds
     LARGE_INTEGER dueTime;
-    dueTime.QuadPart = -int64_t(milliseconds) * 10000;
+    dueTime.QuadPart = -microseconds * 10;
 
     SetWaitableTimerEx(timer, &dueTime, 0, NULL, NULL, NULL, 0);
     WaitForSingleObject(timer, INFINITE);
@@ -101,6 +101,7 @@ class FLAXENGINE_API Win32Platform : public PlatformBase
     static void SetThreadPriority(ThreadPriority priority);
     static void SetThreadAffinityMask(uint64 affinityMask);
     static void Sleep(int32 milliseconds);
+    static void SleepMicroseconds(int64 microseconds);
     static double GetTimeSeconds();
     static uint64 GetTimeCycles();
     static uint64 GetClockFrequency();
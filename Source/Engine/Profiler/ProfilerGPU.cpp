@@ -4,6 +4,8 @@
 
 #include "ProfilerGPU.h"
 #include "Engine/Core/Log.h"
+#include "Engine/Core/Types/StringBuilder.h"
+#include "Engine/Platform/File.h"
 #include "Engine/Engine/Engine.h"
 #include "Engine/Graphics/GPUDevice.h"
 #include "Engine/Graphics/GPUTimerQuery.h"
@@ -15,6 +17,7 @@ int32 ProfilerGPU::_depth = 0;
 Array<GPUTimerQuery*> ProfilerGPU::_timerQueriesPool;
 Array<GPUTimerQuery*> ProfilerGPU::_timerQueriesFree;
 bool ProfilerGPU::Enabled = false;
+bool ProfilerGPU::PipelineStatistics = false;
 int32 ProfilerGPU::CurrentBuffer = 0;
 ProfilerGPU::EventBuffer ProfilerGPU::Buffers[PROFILER_GPU_EVENTS_FRAMES];
 
@@ -48,6 +51,15 @@ void ProfilerGPU::EventBuffer::TryResolve()
     {
         auto& e = _data[i];
         e.Time = e.Timer->GetResult();
+        GPUPipelineStatistics stats;
+        if (e.Timer->PipelineStatistics && !e.Timer->GetPipelineStatistics(stats))
+        {
+            e.Stats.InputPrimitives = (int64)stats.InputPrimitives;
+            e.Stats.RasterizedPrimitives = (int64)stats.RasterizedPrimitives;
+            e.Stats.VSInvocations = (int64)stats.VSInvocations;
+            e.Stats.PSInvocations = (int64)stats.PSInvocations;
+            e.Stats.CSInvocations = (int64)stats.CSInvocations;
+        }
         _timerQueriesFree.Add(e.Timer);
         e.Timer = nullptr;
     }
@@ -105,6 +117,7 @@ int32 ProfilerGPU::BeginEvent(const Char* name)
     e.Name = name;
     e.Stats = RenderStatsData::Counter;
     e.Timer = GetTimerQuery();
+    e.Timer->PipelineStatistics = PipelineStatistics;
     e.Timer->Begin();
     e.Depth = _depth++;
 
@@ -173,7 +186,7 @@ void ProfilerGPU::EndFrame()
     buffer.Clear();
 }
 
-bool ProfilerGPU::GetLastFrameData(float& drawTimeMs, float& presentTimeMs, RenderStatsData& statsData)
+int32 ProfilerGPU::GetLastFrameBuffer()
 {
     uint64 maxFrame = 0;
     int32 maxFrameIndex = -1;
@@ -186,9 +199,15 @@ bool ProfilerGPU::GetLastFrameData(float& drawTimeMs, float& presentTimeMs, Rend
             maxFrameIndex = i;
         }
     }
+    return maxFrameIndex;
+}
+
+bool ProfilerGPU::GetLastFrameData(float& drawTimeMs, float& presentTimeMs, RenderStatsData& statsData)
+{
+    const int32 maxFrameIndex = GetLastFrameBuffer();
     if (maxFrameIndex != -1)
     {
-        auto& frame = frames[maxFrameIndex];
+        auto& frame = Buffers[maxFrameIndex];
         const auto root = frame.Get(0);
         drawTimeMs = root->Time;
         presentTimeMs = frame.PresentTime;
@@ -203,6 +222,36 @@ bool ProfilerGPU::GetLastFrameData(float& drawTimeMs, float& presentTimeMs, Rend
     return false;
 }
 
+bool ProfilerGPU::ExportLastFrame(const StringView& path)
+{
+    const int32 maxFrameIndex = GetLastFrameBuffer();
+    if (maxFrameIndex == -1)
+        return true;
+    Array<Event> events;
+    Buffers[maxFrameIndex].Extract(events);
+
+    // Event per row (name is indented with the event depth to preserve the hierarchy)
+    StringBuilder text;
+    text.Append(TEXT("Event,Depth,Time (ms),Draw Calls,Dispatch Calls,Vertices,Triangles,Pipeline State Changes,Resource Barriers,Resource Barriers Size,Input Primitives,Rasterized Primitives,VS Invocations,PS Invocations,CS Invocations\n"));
+    for (const Event& e : events)
+    {
+        text.Append(TEXT('"'));
+        for (int32 i = 0; i < e.Depth; i++)
+            text.Append(TEXT("  "));
+        text.AppendFormat(TEXT("{}\",{},{},{},{},{},{},{},{},{},{},{},{},{},{}\n"),
+                          e.Name, e.Depth, e.Time,
+                          e.Stats.DrawCalls, e.Stats.DispatchCalls, e.Stats.Vertices, e.Stats.Triangles, e.Stats.PipelineStateChanges,
+                          e.Stats.ResourceBarriers, e.Stats.ResourceBarriersSize,
+                          e.Stats.InputPrimitives, e.Stats.RasterizedPrimitives, e.Stats.VSInvocations, e.Stats.PSInvocations, e.Stats.CSInvocations);
+    }
+    if (File::WriteAllText(path, text, Encoding::ANSI))
+    {
+        LOG(Warning, "Failed to export GPU profiler data to {0}", path);
+        return true;
+    }
+    return false;
+}
+
 void ProfilerGPU::Dispose()
 {
     _timerQueriesPool.ClearDelete();
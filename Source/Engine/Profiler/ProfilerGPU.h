@@ -127,6 +127,7 @@ API_CLASS(Static) class FLAXENGINE_API ProfilerGPU
     static Array<GPUTimerQuery*> _timerQueriesFree;
 
     static GPUTimerQuery* GetTimerQuery();
+    static int32 GetLastFrameBuffer();
 
 public:
     /// <summary>
@@ -134,6 +135,11 @@ API_CLASS(Static) class FLAXENGINE_API ProfilerGPU
     /// </summary>
     API_FIELD() static bool Enabled;
 
+    /// <summary>
+    /// True if GPU profiling events should collect the pipeline statistics (primitives and shader invocations counts) in addition to the timings. Adds an overhead to the GPU queries so it's disabled by default. Supported only by some graphics backends. Can be changed during rendering.
+    /// </summary>
+    API_FIELD() static bool PipelineStatistics;
+
     /// <summary>
     /// The current frame buffer to collect events.
     /// </summary>
@@ -167,6 +173,13 @@ API_CLASS(Static) class FLAXENGINE_API ProfilerGPU
     /// <returns>True if got the data, otherwise false.</returns>
     API_FUNCTION() static bool GetLastFrameData(float& drawTimeMs, float& presentTimeMs, RenderStatsData& statsData);
 
+    /// <summary>
+    /// Exports the events of the last frame drawing (that has been resolved and has valid data) into a CSV file (event per row with timings and rendering stats) to be analyzed in external tools.
+    /// </summary>
+    /// <param name="path">The output file path.</param>
+    /// <returns>True if failed to export the data, otherwise false.</returns>
+    API_FUNCTION() static bool ExportLastFrame(const StringView& path);
+
 private:
     static void BeginFrame();
     static void OnPresent();
@@ -0,0 +1,271 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#if COMPILE_WITH_PROFILER
+
+#include "ProfilerHitchDetector.h"
+#include "ProfilerTraceWriter.h"
+#include "Engine/Core/Log.h"
+#include "Engine/Core/Types/DateTime.h"
+#include "Engine/Content/Content.h"
+#include "Engine/Engine/CommandLine.h"
+#include "Engine/Engine/EngineService.h"
+#include "Engine/Engine/Globals.h"
+#include "Engine/Engine/Replay.h"
+#include "Engine/Level/Level.h"
+#include "Engine/Level/Scene/Scene.h"
+#include "Engine/Platform/FileSystem.h"
+#include "Engine/Serialization/MemoryWriteStream.h"
+#include "Engine/Threading/Task.h"
+#include "Engine/Threading/Threading.h"
+
+float ProfilerHitchDetector::ThresholdMs = 50.0f;
+float ProfilerHitchDetector::GCThresholdMs = 10.0f;
+int32 ProfilerHitchDetector::HistoryFrames = 180;
+int32 ProfilerHitchDetector::PostHitchFrames = 10;
+float ProfilerHitchDetector::Cooldown = 10.0f;
+
+namespace
+{
+    struct HistoryFrame
+    {
+        uint64 Index;
+        double TimeMs;
+        Array<ProfilingTools::ThreadStats> Threads;
+        Array<ProfilerGPU::Event> EventsGPU;
+        ProfilingTools::MainStats Stats;
+        int32 JobsQueueDepth;
+    };
+
+    bool Enabled = false;
+    bool WasEnabledCPU = false;
+    Array<HistoryFrame> History;
+    int32 HistoryStart = 0;
+    int32 HistoryCount = 0;
+    uint64 LastFrameGPU = 0;
+    double LastUpdateTime = 0.0;
+    double LastSaveTime = 0.0;
+    String LastCapturePath;
+    volatile int64 Saving = 0;
+    CriticalSection HitchLocker;
+    String HitchReason;
+    double HitchTimeMs = 0.0;
+    int32 HitchFramesLeft = -1;
+
+    void CopyFrame(HistoryFrame& dst, const ProfilerTraceFrame& src)
+    {
+        // Reuse the history frame memory to don't allocate every frame
+        dst.Index = src.Index;
+        dst.TimeMs = src.TimeMs;
+        dst.Threads.Resize(src.ThreadsCount);
+        for (int32 i = 0; i < src.ThreadsCount; i++)
+        {
+            auto& thread = dst.Threads[i];
+            if (thread.Name != src.Threads[i].Name)
+                thread.Name = src.Threads[i].Name;
+            thread.Events.Clear();
+            thread.Events.Add(src.Threads[i].Events.Get(), src.Threads[i].Events.Count());
+        }
+        dst.EventsGPU.Clear();
+        dst.EventsGPU.Add(src.EventsGPU, src.EventsGPUCount);
+        dst.Stats = *src.Stats;
+        dst.JobsQueueDepth = src.JobsQueueDepth;
+    }
+
+    void SaveCapture(const String& reason, double timeMs)
+    {
+        if (Platform::AtomicRead(&Saving) != 0)
+            return;
+        PROFILE_CPU();
+        LastSaveTime = Platform::GetTimeSeconds();
+
+        // Serialize the frames history
+        auto stream = New<MemoryWriteStream>(1024 * 1024);
+        ProfilerTraceWriter writer;
+        writer.WriteHeader(*stream);
+        ProfilerTraceFrame frame;
+        for (int32 i = 0; i < HistoryCount; i++)
+        {
+            const HistoryFrame& e = History[(HistoryStart + i) % History.Count()];
+            frame.Index = e.Index;
+            frame.TimeMs = e.TimeMs;
+            frame.Threads = e.Threads.Get();
+            frame.ThreadsCount = e.Threads.Count();
+            frame.EventsGPU = e.EventsGPU.Get();
+            frame.EventsGPUCount = e.EventsGPU.Count();
+            frame.Stats = &e.Stats;
+            frame.JobsQueueDepth = e.JobsQueueDepth;
+            writer.WriteFrame(*stream, frame);
+        }
+
+        // Add hitch context
+        String scenes;
+        Level::ScenesLock.Lock();
+        for (const Scene* scene : Level::Scenes)
+        {
+            if (scenes.HasChars())
+                scenes += TEXT(", ");
+            scenes += scene->GetName();
+        }
+        Level::ScenesLock.Unlock();
+        const ContentStats content = Content::GetStats();
+        const StreamingStats& streaming = ProfilingTools::Stats.Streaming;
+        String context = String::Format(TEXT("Scenes: {0}; Loading assets: {1}; Streaming resources: {2} (textures: {3}, models: {4}, audio: {5}); Jobs queue depth: {6}"),
+                                              scenes, content.LoadingAssetsCount, streaming.StreamingResourcesCount, streaming.StreamingTexturesCount,
+                                              streaming.StreamingModelsCount + streaming.StreamingSkinnedModelsCount, streaming.StreamingAudioCount, frame.JobsQueueDepth);
+        if (Replay::IsActive())
+            context += String::Format(TEXT("; Replay frame: {0}"), Replay::GetFrame());
+        writer.WriteMarker(*stream, timeMs, TEXT("Hitch: ") + reason);
+        writer.WriteMarker(*stream, timeMs, context);
+
+        // Save file on a background thread
+#if USE_EDITOR
+        const String folder = Globals::ProjectFolder / TEXT("Hitches");
+#else
+        const String folder = Globals::ProductLocalFolder / TEXT("Hitches");
+#endif
+        FileSystem::CreateDirectory(folder);
+        LastCapturePath = folder / TEXT("Hitch_") + DateTime::Now().ToFileNameString() + TEXT(".flaxtrace");
+        LOG(Warning, "Hitch detected: {0}. {1}. Saving the last {2} frames to {3}", reason, context, HistoryCount, LastCapturePath);
+        Platform::AtomicStore(&Saving, 1);
+        const String path = LastCapturePath;
+        Function<void()> action = [stream, path]
+        {
+            if (stream->SaveToFile(path))
+                LOG(Error, "Failed to save hitch capture to {0}", path);
+            Delete(stream);
+            Platform::AtomicStore(&Saving, 0);
+        };
+        Task::StartNew(action);
+    }
+}
+
+class ProfilerHitchDetectorService : public EngineService
+{
+public:
+    ProfilerHitchDetectorService()
+        : EngineService(TEXT("Profiler Hitch Detector"), 1001)
+    {
+    }
+
+    bool Init() override
+    {
+        if (CommandLine::Options.HitchDetector.IsTrue())
+            ProfilerHitchDetector::SetEnabled(true);
+        return false;
+    }
+
+    void Update() override;
+
+    void Dispose() override
+    {
+        ProfilerHitchDetector::SetEnabled(false);
+        while (Platform::AtomicRead(&Saving) != 0)
+            Platform::Sleep(1);
+    }
+};
+
+ProfilerHitchDetectorService ProfilerHitchDetectorServiceInstance;
+
+void ProfilerHitchDetectorService::Update()
+{
+    if (!Enabled)
+        return;
+    PROFILE_CPU();
+    const double time = Platform::GetTimeSeconds();
+    const double frameTimeMs = (time - LastUpdateTime) * 1000.0;
+    const bool isFirstFrame = LastUpdateTime <= 0.0;
+    LastUpdateTime = time;
+
+    // Record the frame into the history
+    const int32 historySize = Math::Max(ProfilerHitchDetector::HistoryFrames, 1);
+    if (History.Count() != historySize)
+    {
+        History.Resize(historySize);
+        HistoryStart = 0;
+        HistoryCount = 0;
+    }
+    ProfilerTraceFrame frame;
+    ProfilerTraceWriter::GetFrame(frame, LastFrameGPU);
+    const int32 index = (HistoryStart + HistoryCount) % historySize;
+    if (HistoryCount == historySize)
+        HistoryStart = (HistoryStart + 1) % historySize;
+    else
+        HistoryCount++;
+    CopyFrame(History[index], frame);
+
+    // Detect long frames
+    if (!isFirstFrame && frameTimeMs > ProfilerHitchDetector::ThresholdMs)
+        ProfilerHitchDetector::ReportHitch(String::Format(TEXT("Frame time {0:.2f} ms"), frameTimeMs));
+
+    // Save the history after recording a few frames past the hitch
+    String reason;
+    double hitchTimeMs = 0.0;
+    HitchLocker.Lock();
+    if (HitchFramesLeft >= 0 && HitchFramesLeft-- == 0)
+    {
+        reason = MoveTemp(HitchReason);
+        hitchTimeMs = HitchTimeMs;
+    }
+    HitchLocker.Unlock();
+    if (reason.HasChars())
+        SaveCapture(reason, hitchTimeMs);
+}
+
+bool ProfilerHitchDetector::GetEnabled()
+{
+    return Enabled;
+}
+
+void ProfilerHitchDetector::SetEnabled(bool value)
+{
+    if (Enabled == value)
+        return;
+    Enabled = value;
+    if (value)
+    {
+        WasEnabledCPU = ProfilerCPU::Enabled;
+        ProfilerCPU::Enabled = true;
+        LastUpdateTime = 0.0;
+    }
+    else
+    {
+        ProfilerCPU::Enabled = WasEnabledCPU;
+        History.Resize(0);
+        History.SetCapacity(0);
+        HistoryStart = HistoryCount = 0;
+        HitchLocker.Lock();
+        HitchFramesLeft = -1;
+        HitchReason.Clear();
+        HitchLocker.Unlock();
+    }
+}
+
+String ProfilerHitchDetector::GetLastCapturePath()
+{
+    return LastCapturePath;
+}
+
+void ProfilerHitchDetector::ReportHitch(const StringView& reason)
+{
+    if (!Enabled)
+        return;
+    const double time = Platform::GetTimeSeconds();
+    ScopeLock lock(HitchLocker);
+    if (HitchFramesLeft >= 0)
+    {
+        // Merge with the pending hitch
+        if (HitchReason.Length() < 1000)
+        {
+            HitchReason += TEXT(", ");
+            HitchReason += reason;
+        }
+        return;
+    }
+    if (LastSaveTime > 0.0 && time - LastSaveTime < ProfilerHitchDetector::Cooldown)
+        return;
+    HitchReason = reason;
+    HitchTimeMs = time * 1000.0;
+    HitchFramesLeft = Math::Max(PostHitchFrames, 0);
+}
+
+#endif
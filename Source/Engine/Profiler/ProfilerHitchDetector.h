@@ -0,0 +1,68 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#if COMPILE_WITH_PROFILER
+
+#include "Engine/Core/Types/String.h"
+#include "Engine/Scripting/ScriptingType.h"
+
+/// <summary>
+/// Automatic hitch detector. Keeps a rolling history of the last frames CPU profiler events and counters and saves it to the trace file (.flaxtrace) when a hitch happens (long frame, blocking garbage collection or asset loading on a main thread).
+/// </summary>
+/// <remarks>
+/// Saved captures contain the hitch context (loaded scenes, loading assets, streaming and jobs queue state) as trace markers. Use ProfilerTrace.ConvertToChromeTrace to view them. Can be enabled with the '-hitchdetector' command line switch.
+/// </remarks>
+API_CLASS(Static) class FLAXENGINE_API ProfilerHitchDetector
+{
+    DECLARE_SCRIPTING_TYPE_NO_SPAWN(ProfilerHitchDetector);
+public:
+    /// <summary>
+    /// The frame duration threshold (in milliseconds) above which the frame is reported as a hitch.
+    /// </summary>
+    API_FIELD() static float ThresholdMs;
+
+    /// <summary>
+    /// The blocking garbage collection duration threshold (in milliseconds) above which it's reported as a hitch.
+    /// </summary>
+    API_FIELD() static float GCThresholdMs;
+
+    /// <summary>
+    /// The amount of the last frames kept in the history (and saved with the hitch). The history memory is reused between frames but grows with the amount of profiler events.
+    /// </summary>
+    API_FIELD() static int32 HistoryFrames;
+
+    /// <summary>
+    /// The amount of frames recorded after the hitch before saving the capture (includes the hitch aftermath and the delayed GPU events).
+    /// </summary>
+    API_FIELD() static int32 PostHitchFrames;
+
+    /// <summary>
+    /// The minimum time (in seconds) between the saved hitch captures.
+    /// </summary>
+    API_FIELD() static float Cooldown;
+
+public:
+    /// <summary>
+    /// Gets a value indicating whether the hitch detector is enabled.
+    /// </summary>
+    API_PROPERTY() static bool GetEnabled();
+
+    /// <summary>
+    /// Sets a value indicating whether the hitch detector is enabled. Enables the CPU profiler while it's active.
+    /// </summary>
+    API_PROPERTY() static void SetEnabled(bool value);
+
+    /// <summary>
+    /// Gets the path of the last saved hitch capture file. Empty if no hitch has been saved.
+    /// </summary>
+    API_PROPERTY() static String GetLastCapturePath();
+
+    /// <summary>
+    /// Reports the hitch to save the frames history. Can be called from any thread.
+    /// </summary>
+    /// <param name="reason">The hitch reason description.</param>
+    API_FUNCTION() static void ReportHitch(const StringView& reason);
+};
+
+#endif
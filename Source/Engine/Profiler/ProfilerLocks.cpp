@@ -0,0 +1,178 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "ProfilerLocks.h"
+
+#if COMPILE_WITH_LOCK_PROFILER
+
+#include "ProfilerCPU.h"
+#include "Engine/Core/Log.h"
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Core/Collections/Sorting.h"
+#include "Engine/Engine/EngineService.h"
+#include "Engine/Platform/StringUtils.h"
+
+float ProfilerLocks::ThresholdMs = 1.0f;
+
+namespace
+{
+    // Registry is used during the static initialization and by the locks so it uses a spin lock and no allocations after registration
+    ProfilerLockStats* LocksFirst = nullptr;
+    int64 volatile LocksSpinLock = 0;
+
+    FORCE_INLINE int64 ToNanoseconds(double seconds)
+    {
+        return (int64)(seconds * 1000000000.0);
+    }
+
+    FORCE_INLINE double ToMilliseconds(int64 nanoseconds)
+    {
+        return (double)nanoseconds / 1000000.0;
+    }
+
+    bool SortByWaitTime(ProfilerLockStats* const& a, ProfilerLockStats* const& b)
+    {
+        return Platform::AtomicRead(&a->WaitTime) > Platform::AtomicRead(&b->WaitTime);
+    }
+
+    void ReportWait(const ProfilerLockStats* stats, double waitStart, double waitEnd)
+    {
+        // Emit the event that covers the whole wait
+        const int32 index = ProfilerCPU::BeginEvent(stats->Name);
+        if (index == -1)
+            return;
+        auto& e = ProfilerCPU::Thread::Current->Buffer.Get(index);
+        e.Start = waitStart * 1000.0;
+        ProfilerCPU::EndEvent(index);
+        e.End = waitEnd * 1000.0;
+    }
+}
+
+class ProfilerLocksService : public EngineService
+{
+public:
+    ProfilerLocksService()
+        : EngineService(TEXT("Profiler Locks"), 1002)
+    {
+    }
+
+    void Dispose() override
+    {
+        ProfilerLocks::Dump();
+    }
+};
+
+ProfilerLocksService ProfilerLocksServiceInstance;
+
+void ProfilerLockState::OnLocked(double waitStart)
+{
+    if (Depth++ != 0)
+        return;
+    const double time = ProfilerLocks::GetTime();
+    LockTime = time;
+    Platform::InterlockedIncrement(&Stats->Acquires);
+    if (waitStart >= 0.0)
+    {
+        const int64 wait = ToNanoseconds(time - waitStart);
+        Platform::InterlockedIncrement(&Stats->Contentions);
+        Platform::InterlockedAdd(&Stats->WaitTime, wait);
+        int64 maxWait = Platform::AtomicRead(&Stats->MaxWaitTime);
+        while (wait > maxWait && Platform::InterlockedCompareExchange(&Stats->MaxWaitTime, wait, maxWait) != maxWait)
+            maxWait = Platform::AtomicRead(&Stats->MaxWaitTime);
+        if ((time - waitStart) * 1000.0 >= ProfilerLocks::ThresholdMs)
+            ReportWait(Stats, waitStart, time);
+    }
+}
+
+void ProfilerLockState::OnUnlocked()
+{
+    if (--Depth != 0)
+        return;
+    Platform::InterlockedAdd(&Stats->HoldTime, ToNanoseconds(ProfilerLocks::GetTime() - LockTime));
+}
+
+int32 ProfilerLockState::BeginSignalWait()
+{
+    if (!Stats)
+        return 0;
+    const int32 depth = Depth;
+    const double time = ProfilerLocks::GetTime();
+    Platform::InterlockedAdd(&Stats->HoldTime, ToNanoseconds(time - LockTime));
+    Depth = 0;
+    LockTime = time;
+    return depth;
+}
+
+void ProfilerLockState::EndSignalWait(int32 depth)
+{
+    if (!Stats)
+        return;
+    const double time = ProfilerLocks::GetTime();
+    Platform::InterlockedIncrement(&Stats->SignalWaits);
+    Platform::InterlockedAdd(&Stats->SignalWaitTime, ToNanoseconds(time - LockTime));
+    Depth = depth;
+    LockTime = time;
+}
+
+ProfilerLockStats* ProfilerLocks::GetStats(const char* name)
+{
+    while (Platform::InterlockedCompareExchange(&LocksSpinLock, 1, 0) != 0)
+        Platform::Sleep(0);
+    ProfilerLockStats* stats = LocksFirst;
+    while (stats && StringUtils::Compare(stats->Name, name) != 0)
+        stats = stats->Next;
+    if (!stats)
+    {
+        // Use the system allocator directly (locks can be created before the engine memory setup)
+        stats = (ProfilerLockStats*)Platform::Allocate(sizeof(ProfilerLockStats), 16);
+        Platform::MemoryClear(stats, sizeof(ProfilerLockStats));
+        stats->Name = name;
+        stats->Next = LocksFirst;
+        LocksFirst = stats;
+    }
+    Platform::AtomicStore(&LocksSpinLock, 0);
+    return stats;
+}
+
+ProfilerLockStats* ProfilerLocks::GetFirst()
+{
+    return LocksFirst;
+}
+
+double ProfilerLocks::GetTime()
+{
+    return Platform::GetTimeSeconds();
+}
+
+void ProfilerLocks::Reset()
+{
+    for (ProfilerLockStats* stats = LocksFirst; stats; stats = stats->Next)
+    {
+        Platform::AtomicStore(&stats->Acquires, 0);
+        Platform::AtomicStore(&stats->Contentions, 0);
+        Platform::AtomicStore(&stats->WaitTime, 0);
+        Platform::AtomicStore(&stats->MaxWaitTime, 0);
+        Platform::AtomicStore(&stats->HoldTime, 0);
+        Platform::AtomicStore(&stats->SignalWaits, 0);
+        Platform::AtomicStore(&stats->SignalWaitTime, 0);
+    }
+}
+
+void ProfilerLocks::Dump()
+{
+    Array<ProfilerLockStats*> locks;
+    for (ProfilerLockStats* stats = LocksFirst; stats; stats = stats->Next)
+        locks.Add(stats);
+    Sorting::QuickSort(locks.Get(), locks.Count(), &SortByWaitTime);
+    LOG(Info, "Locks contention (ranked by the total wait time):");
+    for (ProfilerLockStats* stats : locks)
+    {
+        const int64 acquires = Platform::AtomicRead(&stats->Acquires);
+        const int64 contentions = Platform::AtomicRead(&stats->Contentions);
+        LOG(Info, "  {0}: wait {1:.3f} ms (max {2:.3f} ms), hold {3:.3f} ms, acquires {4}, contentions {5} ({6:.1f}%), signal waits {7} ({8:.3f} ms)",
+            String(stats->Name), ToMilliseconds(Platform::AtomicRead(&stats->WaitTime)), ToMilliseconds(Platform::AtomicRead(&stats->MaxWaitTime)),
+            ToMilliseconds(Platform::AtomicRead(&stats->HoldTime)), acquires, contentions, acquires > 0 ? (double)contentions * 100.0 / (double)acquires : 0.0,
+            Platform::AtomicRead(&stats->SignalWaits), ToMilliseconds(Platform::AtomicRead(&stats->SignalWaitTime)));
+    }
+}
+
+#endif
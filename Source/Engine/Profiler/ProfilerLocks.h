@@ -0,0 +1,99 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Core/Types/BaseTypes.h"
+
+#if COMPILE_WITH_LOCK_PROFILER
+
+/// <summary>
+/// The contention statistics of the named lock (shared by all critical sections with the same name).
+/// </summary>
+struct FLAXENGINE_API ProfilerLockStats
+{
+    // The lock name.
+    const char* Name;
+    // The next lock in the registry list.
+    ProfilerLockStats* Next;
+    // The amount of the lock acquisitions (excluding the recursive ones).
+    int64 volatile Acquires;
+    // The amount of the lock acquisitions that had to wait for another thread.
+    int64 volatile Contentions;
+    // The total time (in nanoseconds) spent on waiting to acquire the lock.
+    int64 volatile WaitTime;
+    // The longest time (in nanoseconds) spent on waiting to acquire the lock.
+    int64 volatile MaxWaitTime;
+    // The total time (in nanoseconds) the lock was held.
+    int64 volatile HoldTime;
+    // The amount of the condition variable waits using the lock.
+    int64 volatile SignalWaits;
+    // The total time (in nanoseconds) spent on waiting for the condition variable signal (lock is released during that time).
+    int64 volatile SignalWaitTime;
+};
+
+/// <summary>
+/// The per-lock state of the lock profiler (embedded in the instrumented critical section). Modified only by the lock owner thread.
+/// </summary>
+struct FLAXENGINE_API ProfilerLockState
+{
+    ProfilerLockStats* Stats = nullptr;
+    int32 Depth = 0;
+    double LockTime = 0.0;
+
+    // Called after acquiring the lock. The wait start time is negative if lock was acquired without waiting.
+    void OnLocked(double waitStart);
+
+    // Called before releasing the lock.
+    void OnUnlocked();
+
+    // Called before waiting for the condition variable signal (the lock gets released). Returns the lock recursion depth to restore.
+    int32 BeginSignalWait();
+
+    // Called after the condition variable wait ends (the lock gets acquired again).
+    void EndSignalWait(int32 depth);
+};
+
+/// <summary>
+/// Lock contention profiler. Records acquire wait time, hold time and contention counts per named lock (see CriticalSection constructor with a name). Emits profiler events for the long waits.
+/// </summary>
+/// <remarks>
+/// Compiled in only when COMPILE_WITH_LOCK_PROFILER is enabled (adds overhead to every named lock). Stats are logged on engine exit ranked by the total wait time.
+/// </remarks>
+class FLAXENGINE_API ProfilerLocks
+{
+public:
+    /// <summary>
+    /// The lock wait duration threshold (in milliseconds) above which the wait is reported as a profiler event.
+    /// </summary>
+    static float ThresholdMs;
+
+public:
+    /// <summary>
+    /// Gets the stats of the lock with the given name (registers it on the first use).
+    /// </summary>
+    /// <param name="name">The lock name. Must be a static string.</param>
+    /// <returns>The lock stats.</returns>
+    static ProfilerLockStats* GetStats(const char* name);
+
+    /// <summary>
+    /// Gets the first lock stats from the registry list (iterate with the Next pointer).
+    /// </summary>
+    static ProfilerLockStats* GetFirst();
+
+    /// <summary>
+    /// Gets the current time (in seconds).
+    /// </summary>
+    static double GetTime();
+
+    /// <summary>
+    /// Resets all the locks statistics.
+    /// </summary>
+    static void Reset();
+
+    /// <summary>
+    /// Logs the locks statistics ranked by the total wait time.
+    /// </summary>
+    static void Dump();
+};
+
+#endif
@@ -0,0 +1,83 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#if COMPILE_WITH_PROFILER
+
+#include "ProfilerMemory.h"
+
+namespace
+{
+    // Header placed by platform allocator before each memory block
+    struct MemoryHeader
+    {
+        uint64 Size;
+        uint32 Tag;
+        uint32 Padding;
+    };
+
+    static_assert(sizeof(MemoryHeader) == PLATFORM_MEMORY_HEADER_SIZE, "Invalid memory tracking header size.");
+
+    THREADLOCAL MemoryTag CurrentTag = MemoryTag::Untagged;
+}
+
+ProfilerMemory::TagStats ProfilerMemory::Tags[(int32)MemoryTag::MAX];
+
+MemoryTag ProfilerMemory::GetCurrentTag()
+{
+    return CurrentTag;
+}
+
+MemoryTag ProfilerMemory::SetCurrentTag(MemoryTag tag)
+{
+    const MemoryTag prev = CurrentTag;
+    CurrentTag = tag;
+    return prev;
+}
+
+const Char* ProfilerMemory::GetTagName(MemoryTag tag)
+{
+    switch (tag)
+    {
+    case MemoryTag::Content:
+        return TEXT("Content");
+    case MemoryTag::Renderer:
+        return TEXT("Renderer");
+    case MemoryTag::Physics:
+        return TEXT("Physics");
+    case MemoryTag::Scripting:
+        return TEXT("Scripting");
+    case MemoryTag::Animation:
+        return TEXT("Animation");
+    case MemoryTag::Audio:
+        return TEXT("Audio");
+    case MemoryTag::Networking:
+        return TEXT("Networking");
+    case MemoryTag::UI:
+        return TEXT("UI");
+    default:
+        return TEXT("Untagged");
+    }
+}
+
+void ProfilerMemory::OnAllocate(void* ptr, uint64 size)
+{
+    const MemoryTag tag = CurrentTag;
+    MemoryHeader* header = (MemoryHeader*)ptr - 1;
+    header->Size = size;
+    header->Tag = (uint32)tag;
+
+    TagStats& stats = Tags[(int32)tag];
+    const int64 current = Platform::InterlockedAdd(&stats.CurrentBytes, (int64)size) + (int64)size;
+    if (current > Platform::AtomicRead(&stats.PeakBytes))
+        Platform::AtomicStore(&stats.PeakBytes, current); // Peak can be slightly off when racing with other threads but it's fine for stats
+    Platform::InterlockedIncrement(&stats.AllocationsCount);
+    Platform::InterlockedAdd(&stats.AllocatedBytes, (int64)size);
+}
+
+void ProfilerMemory::OnFree(void* ptr)
+{
+    const MemoryHeader* header = (const MemoryHeader*)ptr - 1;
+    TagStats& stats = Tags[header->Tag < (uint32)MemoryTag::MAX ? header->Tag : 0];
+    Platform::InterlockedAdd(&stats.CurrentBytes, -(int64)header->Size);
+}
+
+#endif
@@ -0,0 +1,139 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Platform/Platform.h"
+
+/// <summary>
+/// The native memory allocation tags used to attribute allocations to the engine subsystems.
+/// </summary>
+API_ENUM() enum class MemoryTag : byte
+{
+    /// <summary>
+    /// Allocations made outside any tagged scope.
+    /// </summary>
+    Untagged = 0,
+
+    /// <summary>
+    /// Content loading and assets data.
+    /// </summary>
+    Content,
+
+    /// <summary>
+    /// Rendering and graphics.
+    /// </summary>
+    Renderer,
+
+    /// <summary>
+    /// Physics simulation.
+    /// </summary>
+    Physics,
+
+    /// <summary>
+    /// Scripting runtime and scripts update.
+    /// </summary>
+    Scripting,
+
+    /// <summary>
+    /// Animations update and skinning.
+    /// </summary>
+    Animation,
+
+    /// <summary>
+    /// Audio playback and streaming.
+    /// </summary>
+    Audio,
+
+    /// <summary>
+    /// Networking and replication.
+    /// </summary>
+    Networking,
+
+    /// <summary>
+    /// User interface.
+    /// </summary>
+    UI,
+
+    API_ENUM(Attributes="HideInEditor")
+    MAX
+};
+
+#if COMPILE_WITH_PROFILER
+
+/// <summary>
+/// Provides native memory tracking per allocation tag. Each allocation is attributed to the tag active on the calling thread (see PROFILE_MEM) and its size and tag are stored in a small header before the memory block (added by the platform allocator in profiler builds), so freeing is tracked from any thread.
+/// </summary>
+class FLAXENGINE_API ProfilerMemory
+{
+public:
+    /// <summary>
+    /// The allocations stats of a single tag.
+    /// </summary>
+    struct alignas(PLATFORM_CACHE_LINE_SIZE) TagStats
+    {
+        // The amount of currently allocated bytes.
+        volatile int64 CurrentBytes;
+        // The maximum amount of allocated bytes at once.
+        volatile int64 PeakBytes;
+        // The total amount of allocations (incremental).
+        volatile int64 AllocationsCount;
+        // The total amount of allocated bytes (incremental).
+        volatile int64 AllocatedBytes;
+    };
+
+    /// <summary>
+    /// The stats per memory tag (indexed by MemoryTag).
+    /// </summary>
+    static TagStats Tags[(int32)MemoryTag::MAX];
+
+    /// <summary>
+    /// Gets the memory tag used by the current thread for new allocations.
+    /// </summary>
+    static MemoryTag GetCurrentTag();
+
+    /// <summary>
+    /// Sets the memory tag used by the current thread for new allocations.
+    /// </summary>
+    /// <param name="tag">The tag to use.</param>
+    /// <returns>The previous tag.</returns>
+    static MemoryTag SetCurrentTag(MemoryTag tag);
+
+    /// <summary>
+    /// Gets the display name of the memory tag.
+    /// </summary>
+    static const Char* GetTagName(MemoryTag tag);
+
+public:
+    // Called by the platform allocator after allocating the memory block (with the tracking header placed before it).
+    static void OnAllocate(void* ptr, uint64 size);
+
+    // Called by the platform allocator before freeing the memory block.
+    static void OnFree(void* ptr);
+};
+
+/// <summary>
+/// Helper structure used to set the memory tag within a code block.
+/// </summary>
+struct ScopeMemoryTag
+{
+    MemoryTag PrevTag;
+
+    FORCE_INLINE ScopeMemoryTag(MemoryTag tag)
+    {
+        PrevTag = ProfilerMemory::SetCurrentTag(tag);
+    }
+
+    FORCE_INLINE ~ScopeMemoryTag()
+    {
+        ProfilerMemory::SetCurrentTag(PrevTag);
+    }
+};
+
+// Attributes native memory allocated within the current scope to the given tag (eg. PROFILE_MEM(Renderer))
+#define PROFILE_MEM(tag) ScopeMemoryTag ProfileMemoryTag(MemoryTag::tag)
+
+#else
+
+#define PROFILE_MEM(tag)
+
+#endif
@@ -0,0 +1,396 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#if COMPILE_WITH_PROFILER
+
+#include "ProfilerTrace.h"
+#include "ProfilerTraceWriter.h"
+#include "Engine/Core/Log.h"
+#include "Engine/Core/Types/DateTime.h"
+#include "Engine/Engine/CommandLine.h"
+#include "Engine/Engine/EngineService.h"
+#include "Engine/Engine/Globals.h"
+#include "Engine/Input/Input.h"
+#include "Engine/Platform/File.h"
+#include "Engine/Platform/FileSystem.h"
+#include "Engine/Serialization/FileWriteStream.h"
+#include "Engine/Serialization/JsonWriters.h"
+#include "Engine/Serialization/MemoryReadStream.h"
+#include "Engine/Serialization/MemoryWriteStream.h"
+#include "Engine/Threading/Task.h"
+
+// Size of the recorded data chunk after which it gets written to the file (on a background thread)
+#define PROFILER_TRACE_CHUNK_SIZE (1024 * 1024)
+
+// Thread identifier used for the GPU events track in the converted trace
+#define PROFILER_TRACE_GPU_THREAD 0xffff
+
+namespace
+{
+    bool Capturing = false;
+    bool WasEnabledCPU = false;
+    bool WasEnabledGPU = false;
+    String CapturePath;
+    FileWriteStream* TraceFile = nullptr;
+    MemoryWriteStream Chunks[2];
+    int32 ChunkIndex = 0;
+    volatile int64 ChunkWriting = 0;
+    ProfilerTraceWriter Writer;
+    uint64 LastFrameGPU = 0;
+
+    void FlushChunk(bool async)
+    {
+        // Wait for the previous chunk write to end (chunks are double-buffered)
+        while (Platform::AtomicRead(&ChunkWriting) != 0)
+            Platform::Sleep(1);
+
+        MemoryWriteStream* chunk = &Chunks[ChunkIndex];
+        if (chunk->GetPosition() == 0)
+            return;
+        ChunkIndex = (ChunkIndex + 1) % ARRAY_COUNT(Chunks);
+        Platform::AtomicStore(&ChunkWriting, 1);
+        Function<void()> action = [chunk]
+        {
+            TraceFile->WriteBytes(chunk->GetHandle(), chunk->GetPosition());
+            chunk->SetPosition(0);
+            Platform::AtomicStore(&ChunkWriting, 0);
+        };
+        if (async)
+            Task::StartNew(action);
+        else
+            action();
+    }
+
+    void WriteFrame()
+    {
+        PROFILE_CPU();
+        ProfilerTraceFrame frame;
+        ProfilerTraceWriter::GetFrame(frame, LastFrameGPU);
+        MemoryWriteStream& stream = Chunks[ChunkIndex];
+        Writer.WriteFrame(stream, frame);
+        if (stream.GetPosition() >= PROFILER_TRACE_CHUNK_SIZE)
+            FlushChunk(true);
+    }
+
+    const String& GetName(const Array<String>& names, uint32 id)
+    {
+        return id < (uint32)names.Count() ? names[id] : String::Empty;
+    }
+
+    void WriteThreadName(JsonWriter& writer, int32 thread, const StringView& name)
+    {
+        writer.StartObject();
+        writer.JKEY("name");
+        writer.String("thread_name");
+        writer.JKEY("ph");
+        writer.String("M");
+        writer.JKEY("pid");
+        writer.Int(1);
+        writer.JKEY("tid");
+        writer.Int(thread);
+        writer.JKEY("args");
+        writer.StartObject();
+        writer.JKEY("name");
+        writer.String(name);
+        writer.EndObject();
+        writer.EndObject();
+    }
+
+    void WriteInstantEvent(JsonWriter& writer, const StringView& name, double timeMs)
+    {
+        writer.StartObject();
+        writer.JKEY("name");
+        writer.String(name);
+        writer.JKEY("ph");
+        writer.String("i");
+        writer.JKEY("s");
+        writer.String("g");
+        writer.JKEY("pid");
+        writer.Int(1);
+        writer.JKEY("ts");
+        writer.Double(timeMs * 1000.0);
+        writer.EndObject();
+    }
+
+    void WriteEvent(JsonWriter& writer, int32 thread, const StringView& name, double startMs, double durationMs)
+    {
+        writer.StartObject();
+        writer.JKEY("name");
+        writer.String(name);
+        writer.JKEY("ph");
+        writer.String("X");
+        writer.JKEY("pid");
+        writer.Int(1);
+        writer.JKEY("tid");
+        writer.Int(thread);
+        writer.JKEY("ts");
+        writer.Double(startMs * 1000.0);
+        writer.JKEY("dur");
+        writer.Double(durationMs * 1000.0);
+        writer.EndObject();
+    }
+}
+
+class ProfilerTraceService : public EngineService
+{
+public:
+    ProfilerTraceService()
+        : EngineService(TEXT("Profiler Trace"), 1000)
+    {
+    }
+
+    bool Init() override
+    {
+        if (CommandLine::Options.Trace.HasValue())
+            ProfilerTrace::StartCapture(CommandLine::Options.Trace.GetValue());
+        return false;
+    }
+
+    void Update() override
+    {
+        // Ctrl+F11 toggles the capture
+        if (Input::GetKey(KeyboardKeys::Control) && Input::GetKeyDown(KeyboardKeys::F11))
+        {
+            if (Capturing)
+                ProfilerTrace::StopCapture();
+            else
+                ProfilerTrace::StartCapture();
+        }
+
+        if (Capturing)
+            WriteFrame();
+    }
+
+    void Dispose() override
+    {
+        ProfilerTrace::StopCapture();
+        Writer.Reset();
+        for (auto& chunk : Chunks)
+            chunk.Close();
+    }
+};
+
+ProfilerTraceService ProfilerTraceServiceInstance;
+
+bool ProfilerTrace::StartCapture(const StringView& path)
+{
+    if (Capturing)
+    {
+        LOG(Warning, "Profiler trace capture is already active.");
+        return true;
+    }
+
+    // Open the output file
+    if (path.HasChars())
+    {
+        CapturePath = path;
+    }
+    else
+    {
+#if USE_EDITOR
+        const String tracesFolder = Globals::ProjectFolder / TEXT("Traces");
+#else
+        const String tracesFolder = Globals::ProductLocalFolder / TEXT("Traces");
+#endif
+        CapturePath = tracesFolder / TEXT("Trace_") + DateTime::Now().ToFileNameString() + TEXT(".flaxtrace");
+    }
+    FileSystem::CreateDirectory(StringUtils::GetDirectoryName(CapturePath));
+    TraceFile = FileWriteStream::Open(CapturePath);
+    if (!TraceFile)
+    {
+        LOG(Error, "Failed to open profiler trace file {0}", CapturePath);
+        return true;
+    }
+    Writer.WriteHeader(*TraceFile);
+
+    // Start capture
+    LastFrameGPU = 0;
+    WasEnabledCPU = ProfilerCPU::Enabled;
+    WasEnabledGPU = ProfilerGPU::Enabled;
+    ProfilerCPU::Enabled = true;
+    ProfilerGPU::Enabled = true;
+    Capturing = true;
+    LOG(Info, "Started profiler trace capture to {0}", CapturePath);
+    return false;
+}
+
+void ProfilerTrace::StopCapture()
+{
+    if (!Capturing)
+        return;
+    Capturing = false;
+    ProfilerCPU::Enabled = WasEnabledCPU;
+    ProfilerGPU::Enabled = WasEnabledGPU;
+
+    // Write the remaining data (and wait for the pending chunk write)
+    FlushChunk(false);
+    Delete(TraceFile);
+    TraceFile = nullptr;
+    LOG(Info, "Saved profiler trace capture to {0}", CapturePath);
+}
+
+bool ProfilerTrace::IsCapturing()
+{
+    return Capturing;
+}
+
+String ProfilerTrace::GetCapturePath()
+{
+    return CapturePath;
+}
+
+bool ProfilerTrace::ConvertToChromeTrace(const StringView& tracePath, const StringView& outputPath)
+{
+    Array<byte> data;
+    if (File::ReadAllBytes(tracePath, data))
+    {
+        LOG(Error, "Failed to load profiler trace file {0}", tracePath);
+        return true;
+    }
+    MemoryReadStream stream(data);
+    uint32 magic = 0, version = 0;
+    if (data.Count() >= sizeof(uint32) * 2)
+    {
+        stream.ReadUint32(&magic);
+        stream.ReadUint32(&version);
+    }
+    if (magic != PROFILER_TRACE_MAGIC || version != PROFILER_TRACE_VERSION)
+    {
+        LOG(Error, "Invalid profiler trace file {0}", tracePath);
+        return true;
+    }
+    FileWriteStream* output = FileWriteStream::Open(outputPath);
+    if (!output)
+    {
+        LOG(Error, "Failed to open file {0}", outputPath);
+        return true;
+    }
+
+    // Convert records into Trace Event Format (timestamps in microseconds) and write to the file in chunks
+    rapidjson_flax::StringBuffer buffer;
+    CompactJsonWriter writerObj(buffer);
+    JsonWriter& writer = writerObj;
+    writer.StartObject();
+    writer.JKEY("traceEvents");
+    writer.StartArray();
+    WriteThreadName(writer, PROFILER_TRACE_GPU_THREAD, TEXT("GPU"));
+    Array<String> names;
+    String name;
+    double frameTime = 0.0;
+    double gpuTime[64] = {}; // GPU events have no timestamps so lay them out sequentially from the frame marker (per depth level)
+    bool failed = false;
+    while (!failed && stream.GetPosition() < stream.GetLength())
+    {
+        switch ((ProfilerTraceRecord)stream.ReadByte())
+        {
+        case ProfilerTraceRecord::Name:
+        {
+            uint32 id;
+            stream.ReadUint32(&id);
+            stream.Read(name);
+            if (id >= (uint32)names.Count())
+                names.Resize(id + 1);
+            names[id] = name;
+            break;
+        }
+        case ProfilerTraceRecord::Thread:
+        {
+            uint16 thread;
+            uint32 nameId;
+            stream.ReadUint16(&thread);
+            stream.ReadUint32(&nameId);
+            WriteThreadName(writer, thread, GetName(names, nameId));
+            break;
+        }
+        case ProfilerTraceRecord::Frame:
+        {
+            uint64 frame;
+            stream.ReadUint64(&frame);
+            stream.ReadDouble(&frameTime);
+            gpuTime[0] = frameTime;
+            WriteInstantEvent(writer, String::Format(TEXT("Frame {0}"), frame), frameTime);
+            break;
+        }
+        case ProfilerTraceRecord::EventCPU:
+        {
+            uint16 thread, depth;
+            uint32 nameId;
+            double start;
+            float duration;
+            stream.ReadUint16(&thread);
+            stream.ReadUint16(&depth);
+            stream.ReadUint32(&nameId);
+            stream.ReadDouble(&start);
+            stream.ReadFloat(&duration);
+            WriteEvent(writer, thread, GetName(names, nameId), start, duration);
+            break;
+        }
+        case ProfilerTraceRecord::EventGPU:
+        {
+            uint16 depth;
+            uint32 nameId;
+            float duration;
+            int32 drawCalls;
+            stream.ReadUint16(&depth);
+            stream.ReadUint32(&nameId);
+            stream.ReadFloat(&duration);
+            stream.ReadInt32(&drawCalls);
+            depth = Math::Min<uint16>(depth, ARRAY_COUNT(gpuTime) - 2);
+            const double start = gpuTime[depth];
+            gpuTime[depth] += duration;
+            gpuTime[depth + 1] = start;
+            WriteEvent(writer, PROFILER_TRACE_GPU_THREAD, GetName(names, nameId), start, duration);
+            break;
+        }
+        case ProfilerTraceRecord::Counter:
+        {
+            uint32 nameId;
+            double value;
+            stream.ReadUint32(&nameId);
+            stream.ReadDouble(&value);
+            writer.StartObject();
+            writer.JKEY("name");
+            writer.String(GetName(names, nameId));
+            writer.JKEY("ph");
+            writer.String("C");
+            writer.JKEY("pid");
+            writer.Int(1);
+            writer.JKEY("ts");
+            writer.Double(frameTime * 1000.0);
+            writer.JKEY("args");
+            writer.StartObject();
+            writer.JKEY("value");
+            writer.Double(value);
+            writer.EndObject();
+            writer.EndObject();
+            break;
+        }
+        case ProfilerTraceRecord::Marker:
+        {
+            double time;
+            uint32 nameId;
+            stream.ReadDouble(&time);
+            stream.ReadUint32(&nameId);
+            WriteInstantEvent(writer, GetName(names, nameId), time);
+            break;
+        }
+        default:
+            LOG(Error, "Corrupted profiler trace file {0} at offset {1}", tracePath, stream.GetPosition());
+            failed = true;
+            break;
+        }
+        if (buffer.GetSize() >= PROFILER_TRACE_CHUNK_SIZE)
+        {
+            output->WriteBytes(buffer.GetString(), (uint32)buffer.GetSize());
+            buffer.Clear();
+        }
+    }
+    writer.EndArray();
+    writer.JKEY("displayTimeUnit");
+    writer.String("ms");
+    writer.EndObject();
+    output->WriteBytes(buffer.GetString(), (uint32)buffer.GetSize());
+    Delete(output);
+    return failed;
+}
+
+#endif
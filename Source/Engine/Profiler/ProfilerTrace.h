@@ -0,0 +1,51 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#if COMPILE_WITH_PROFILER
+
+#include "Engine/Core/Types/String.h"
+#include "Engine/Scripting/ScriptingType.h"
+
+/// <summary>
+/// Standalone profiler trace capture. Streams the CPU and GPU profiler events, frame markers and the main performance counters into a compact binary trace file (.flaxtrace) without the Editor connected.
+/// </summary>
+/// <remarks>
+/// Capture can be started with the '-trace [path]' command line switch, with the Ctrl+F11 hotkey or from code. Use ConvertToChromeTrace to view the capture in chrome://tracing or Perfetto UI.
+/// </remarks>
+API_CLASS(Static) class FLAXENGINE_API ProfilerTrace
+{
+    DECLARE_SCRIPTING_TYPE_NO_SPAWN(ProfilerTrace);
+public:
+    /// <summary>
+    /// Starts the trace capture. Enables the CPU and GPU profilers for the capture duration.
+    /// </summary>
+    /// <param name="path">The output trace file path. Empty to use the default location with a timestamped file name.</param>
+    /// <returns>True if failed to start the capture, otherwise false.</returns>
+    API_FUNCTION() static bool StartCapture(const StringView& path = StringView::Empty);
+
+    /// <summary>
+    /// Stops the active trace capture and flushes the remaining data to the file.
+    /// </summary>
+    API_FUNCTION() static void StopCapture();
+
+    /// <summary>
+    /// Checks if trace capture is active.
+    /// </summary>
+    API_PROPERTY() static bool IsCapturing();
+
+    /// <summary>
+    /// Gets the path of the active (or the last) trace capture file.
+    /// </summary>
+    API_PROPERTY() static String GetCapturePath();
+
+    /// <summary>
+    /// Converts the binary trace file into the Chrome Trace Event JSON format (supported by chrome://tracing and Perfetto UI).
+    /// </summary>
+    /// <param name="tracePath">The input trace file path.</param>
+    /// <param name="outputPath">The output JSON file path.</param>
+    /// <returns>True if failed to convert the trace, otherwise false.</returns>
+    API_FUNCTION() static bool ConvertToChromeTrace(const StringView& tracePath, const StringView& outputPath);
+};
+
+#endif
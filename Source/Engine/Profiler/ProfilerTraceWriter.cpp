@@ -0,0 +1,144 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#if COMPILE_WITH_PROFILER
+
+#include "ProfilerTraceWriter.h"
+#include "Engine/Engine/Engine.h"
+#include "Engine/Serialization/WriteStream.h"
+
+void ProfilerTraceWriter::GetFrame(ProfilerTraceFrame& frame, uint64& lastFrameGPU)
+{
+    frame.Index = Engine::FrameCount;
+    frame.TimeMs = Platform::GetTimeSeconds() * 1000.0;
+    frame.Threads = ProfilingTools::EventsCPU.Get();
+    frame.ThreadsCount = ProfilingTools::EventsCPU.Count();
+    frame.EventsGPU = nullptr;
+    frame.EventsGPUCount = 0;
+    frame.Stats = &ProfilingTools::Stats;
+    frame.JobsQueueDepth = 0;
+    for (const auto& e : ProfilingTools::WorkersStats)
+        frame.JobsQueueDepth += e.QueueDepth;
+
+    // The last resolved GPU frame gets reported by the profiling tools for a few frames so skip duplicates
+    uint64 frameGPU = 0;
+    for (const auto& buffer : ProfilerGPU::Buffers)
+    {
+        if (buffer.HasData() && buffer.FrameIndex > frameGPU)
+            frameGPU = buffer.FrameIndex;
+    }
+    if (frameGPU > lastFrameGPU)
+    {
+        lastFrameGPU = frameGPU;
+        frame.EventsGPU = ProfilingTools::EventsGPU.Get();
+        frame.EventsGPUCount = ProfilingTools::EventsGPU.Count();
+    }
+}
+
+void ProfilerTraceWriter::Reset()
+{
+    _names.Clear();
+    _threadsCount = 0;
+}
+
+void ProfilerTraceWriter::WriteHeader(WriteStream& stream)
+{
+    Reset();
+    stream.WriteUint32(PROFILER_TRACE_MAGIC);
+    stream.WriteUint32(PROFILER_TRACE_VERSION);
+}
+
+void ProfilerTraceWriter::WriteFrame(WriteStream& stream, const ProfilerTraceFrame& frame)
+{
+    // Frame marker
+    stream.WriteByte((byte)ProfilerTraceRecord::Frame);
+    stream.WriteUint64(frame.Index);
+    stream.WriteDouble(frame.TimeMs);
+
+    // CPU events (threads list is append-only so the index can be used as a thread identifier)
+    for (int32 threadIndex = 0; threadIndex < frame.ThreadsCount; threadIndex++)
+    {
+        const auto& thread = frame.Threads[threadIndex];
+        if (threadIndex >= _threadsCount)
+        {
+            const uint32 nameId = GetNameId(stream, thread.Name);
+            stream.WriteByte((byte)ProfilerTraceRecord::Thread);
+            stream.WriteUint16((uint16)threadIndex);
+            stream.WriteUint32(nameId);
+            _threadsCount = threadIndex + 1;
+        }
+        for (const ProfilerCPU::Event& e : thread.Events)
+        {
+            if (e.End < e.Start)
+                continue;
+            const uint32 nameId = GetNameId(stream, StringView(e.Name));
+            stream.WriteByte((byte)ProfilerTraceRecord::EventCPU);
+            stream.WriteUint16((uint16)threadIndex);
+            stream.WriteUint16((uint16)e.Depth);
+            stream.WriteUint32(nameId);
+            stream.WriteDouble(e.Start);
+            stream.WriteFloat((float)(e.End - e.Start));
+        }
+    }
+
+    // GPU events
+    for (int32 i = 0; i < frame.EventsGPUCount; i++)
+    {
+        const ProfilerGPU::Event& e = frame.EventsGPU[i];
+        const uint32 nameId = GetNameId(stream, StringView(e.Name));
+        stream.WriteByte((byte)ProfilerTraceRecord::EventGPU);
+        stream.WriteUint16((uint16)e.Depth);
+        stream.WriteUint32(nameId);
+        stream.WriteFloat(e.Time);
+        stream.WriteInt32((int32)e.Stats.DrawCalls);
+    }
+
+    // Counters
+    if (frame.Stats)
+    {
+        const auto& stats = *frame.Stats;
+        WriteCounter(stream, TEXT("FPS"), stats.FPS);
+        WriteCounter(stream, TEXT("Update (ms)"), stats.UpdateTimeMs);
+        WriteCounter(stream, TEXT("Physics (ms)"), stats.PhysicsTimeMs);
+        WriteCounter(stream, TEXT("Draw CPU (ms)"), stats.DrawCPUTimeMs);
+        WriteCounter(stream, TEXT("Draw GPU (ms)"), stats.DrawGPUTimeMs);
+        WriteCounter(stream, TEXT("Draw Calls"), (double)stats.DrawStats.DrawCalls);
+        WriteCounter(stream, TEXT("Triangles"), (double)stats.DrawStats.Triangles);
+        WriteCounter(stream, TEXT("CPU Memory (MB)"), (double)stats.ProcessMemory.UsedPhysicalMemory / (1024.0 * 1024.0));
+        WriteCounter(stream, TEXT("GPU Memory (MB)"), (double)stats.MemoryGPU.Used / (1024.0 * 1024.0));
+        WriteCounter(stream, TEXT("Streaming Resources"), stats.Streaming.StreamingResourcesCount);
+    }
+    WriteCounter(stream, TEXT("Jobs Queue Depth"), frame.JobsQueueDepth);
+}
+
+void ProfilerTraceWriter::WriteMarker(WriteStream& stream, double timeMs, const StringView& text)
+{
+    const uint32 nameId = GetNameId(stream, text);
+    stream.WriteByte((byte)ProfilerTraceRecord::Marker);
+    stream.WriteDouble(timeMs);
+    stream.WriteUint32(nameId);
+}
+
+uint32 ProfilerTraceWriter::GetNameId(WriteStream& stream, const StringView& name)
+{
+    const uint32* id = _names.TryGet(name);
+    if (id)
+        return *id;
+
+    // Record the new name once and refer to it by id in the events
+    const uint32 newId = (uint32)_names.Count();
+    _names.Add(String(name), newId);
+    stream.WriteByte((byte)ProfilerTraceRecord::Name);
+    stream.WriteUint32(newId);
+    stream.Write(name);
+    return newId;
+}
+
+void ProfilerTraceWriter::WriteCounter(WriteStream& stream, const StringView& name, double value)
+{
+    const uint32 nameId = GetNameId(stream, name);
+    stream.WriteByte((byte)ProfilerTraceRecord::Counter);
+    stream.WriteUint32(nameId);
+    stream.WriteDouble(value);
+}
+
+#endif
@@ -0,0 +1,67 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#if COMPILE_WITH_PROFILER
+
+#include "ProfilingTools.h"
+
+class WriteStream;
+
+// Binary trace file (.flaxtrace) starts with the magic and version numbers followed by the stream of records (each prefixed with the ProfilerTraceRecord type byte)
+#define PROFILER_TRACE_MAGIC 0x43525446
+#define PROFILER_TRACE_VERSION 1
+
+enum class ProfilerTraceRecord : byte
+{
+    // [uint32 nameId, String name]
+    Name = 1,
+    // [uint16 thread, uint32 nameId]
+    Thread = 2,
+    // [uint64 frame, double timeMs]
+    Frame = 3,
+    // [uint16 thread, uint16 depth, uint32 nameId, double startMs, float durationMs]
+    EventCPU = 4,
+    // [uint16 depth, uint32 nameId, float durationMs, int32 drawCalls]
+    EventGPU = 5,
+    // [uint32 nameId, double value] (sampled at the last frame marker time)
+    Counter = 6,
+    // [double timeMs, uint32 nameId]
+    Marker = 7,
+};
+
+// The view over the single frame profiler data to write into the trace.
+struct ProfilerTraceFrame
+{
+    uint64 Index = 0;
+    double TimeMs = 0.0;
+    const ProfilingTools::ThreadStats* Threads = nullptr;
+    int32 ThreadsCount = 0;
+    const ProfilerGPU::Event* EventsGPU = nullptr;
+    int32 EventsGPUCount = 0;
+    const ProfilingTools::MainStats* Stats = nullptr;
+    int32 JobsQueueDepth = 0;
+};
+
+// Profiler trace data writer. Keeps the names and threads already written to the trace so a single writer has to be used for the whole file.
+class ProfilerTraceWriter
+{
+private:
+    Dictionary<String, uint32> _names;
+    int32 _threadsCount = 0;
+
+public:
+    // Gets the current frame data from the profiling tools. GPU events are included only if a newer GPU frame than the last one got resolved.
+    static void GetFrame(ProfilerTraceFrame& frame, uint64& lastFrameGPU);
+
+    void Reset();
+    void WriteHeader(WriteStream& stream);
+    void WriteFrame(WriteStream& stream, const ProfilerTraceFrame& frame);
+    void WriteMarker(WriteStream& stream, double timeMs, const StringView& text);
+
+private:
+    uint32 GetNameId(WriteStream& stream, const StringView& name);
+    void WriteCounter(WriteStream& stream, const StringView& name, double value);
+};
+
+#endif
@@ -9,11 +9,47 @@
 #include "Engine/Engine/EngineService.h"
 #include "Engine/Graphics/GPUDevice.h"
 #include "Engine/Networking/NetworkInternal.h"
+#include "Engine/Threading/JobSystem.h"
+#include "Engine/Threading/ThreadPool.h"
+#include "Engine/Threading/WorkerStats.h"
 
 ProfilingTools::MainStats ProfilingTools::Stats;
 Array<ProfilingTools::ThreadStats, InlinedAllocation<64>> ProfilingTools::EventsCPU;
 Array<ProfilerGPU::Event> ProfilingTools::EventsGPU;
 Array<ProfilingTools::NetworkEventStat> ProfilingTools::EventsNetwork;
+Array<ProfilingTools::WorkerThreadStats> ProfilingTools::WorkersStats;
+Array<ProfilingTools::MemoryTagStats> ProfilingTools::MemoryTagsStats;
+
+namespace
+{
+    // Accumulated worker threads stats from the previous frame (to calculate per-frame values)
+    Array<WorkerStats> WorkersStatsPrev;
+
+    // Accumulated memory tags allocations from the previous frame (to calculate per-frame values)
+    int64 MemoryTagsAllocationsPrev[(int32)MemoryTag::MAX] = {};
+    int64 MemoryTagsAllocatedBytesPrev[(int32)MemoryTag::MAX] = {};
+
+    void AddWorkerStats(int32& index, const WorkerStats& stats, const Char* name, int32 threadIndex, double cyclesToMs)
+    {
+        if (WorkersStatsPrev.Count() <= index)
+        {
+            WorkersStatsPrev.Resize(index + 1);
+            ProfilingTools::WorkersStats.Resize(index + 1);
+            ProfilingTools::WorkersStats[index].Name = String::Format(TEXT("{0} {1}"), name, threadIndex);
+        }
+        WorkerStats& prev = WorkersStatsPrev[index];
+        auto& dst = ProfilingTools::WorkersStats[index];
+        const int64 jobsCount = stats.JobsCount - prev.JobsCount;
+        dst.BusyTimeMs = (float)((double)(stats.BusyCycles - prev.BusyCycles) * cyclesToMs);
+        dst.IdleTimeMs = (float)((double)(stats.IdleCycles - prev.IdleCycles) * cyclesToMs);
+        dst.LatencyMs = jobsCount > 0 ? (float)((double)(stats.LatencyCycles - prev.LatencyCycles) * cyclesToMs / (double)jobsCount) : 0.0f;
+        dst.JobsCount = (int32)jobsCount;
+        dst.StealsCount = (int32)(stats.StealsCount - prev.StealsCount);
+        dst.QueueDepth = stats.QueueDepth;
+        prev = stats;
+        index++;
+    }
+}
 
 class ProfilingToolsService : public EngineService
 {
@@ -51,6 +87,8 @@ void ProfilingToolsService::Update()
         float presentTime;
         ProfilerGPU::GetLastFrameData(stats.DrawGPUTimeMs, presentTime, stats.DrawStats);
         stats.DrawCPUTimeMs = Math::Max(stats.DrawCPUTimeMs - presentTime, 0.0f); // Remove swapchain present wait time to exclude from drawing on CPU
+        stats.Streaming = Streaming::GetStats();
+        stats.Particles = Particles::GetStats();
     }
 
     // Extract CPU profiler events
@@ -159,6 +197,37 @@ void ProfilingToolsService::Update()
         NetworkInternal::ProfilerEvents.Clear();
     }
 
+    // Get the worker threads stats
+    {
+        const double cyclesToMs = 1000.0 / (double)Math::Max<uint64>(Platform::GetClockFrequency(), 1);
+        WorkerStats stats;
+        int32 index = 0;
+        for (int32 i = 0; JobSystem::GetThreadStats(i, stats); i++)
+            AddWorkerStats(index, stats, TEXT("Job System"), i, cyclesToMs);
+        for (int32 i = 0; ThreadPool::GetThreadStats(i, stats); i++)
+            AddWorkerStats(index, stats, TEXT("Thread Pool"), i, cyclesToMs);
+    }
+
+    // Get the memory tags stats
+    {
+        auto& memoryTags = ProfilingTools::MemoryTagsStats;
+        memoryTags.Resize((int32)MemoryTag::MAX);
+        for (int32 i = 0; i < (int32)MemoryTag::MAX; i++)
+        {
+            const auto& src = ProfilerMemory::Tags[i];
+            auto& dst = memoryTags[i];
+            const int64 allocationsCount = Platform::AtomicRead(&src.AllocationsCount);
+            const int64 allocatedBytes = Platform::AtomicRead(&src.AllocatedBytes);
+            dst.Tag = (MemoryTag)i;
+            dst.CurrentBytes = (uint64)Math::Max<int64>(Platform::AtomicRead(&src.CurrentBytes), 0);
+            dst.PeakBytes = (uint64)Math::Max<int64>(Platform::AtomicRead(&src.PeakBytes), 0);
+            dst.AllocationsCount = (int32)(allocationsCount - MemoryTagsAllocationsPrev[i]);
+            dst.AllocatedBytes = (uint64)(allocatedBytes - MemoryTagsAllocatedBytesPrev[i]);
+            MemoryTagsAllocationsPrev[i] = allocationsCount;
+            MemoryTagsAllocatedBytesPrev[i] = allocatedBytes;
+        }
+    }
+
 #if 0
     // Print CPU events to the log
     {
@@ -213,6 +282,9 @@ void ProfilingToolsService::Dispose()
     ProfilingTools::EventsCPU.SetCapacity(0);
     ProfilingTools::EventsGPU.SetCapacity(0);
     ProfilingTools::EventsNetwork.SetCapacity(0);
+    ProfilingTools::WorkersStats.SetCapacity(0);
+    WorkersStatsPrev.SetCapacity(0);
+    ProfilingTools::MemoryTagsStats.SetCapacity(0);
 }
 
 bool ProfilingTools::GetEnabled()
@@ -8,6 +8,8 @@
 #include "Engine/Platform/MemoryStats.h"
 #include "Engine/Scripting/ScriptingType.h"
 #include "Engine/Profiler/Profiler.h"
+#include "Engine/Streaming/Streaming.h"
+#include "Engine/Particles/Particles.h"
 
 /// <summary>
 /// Profiler tools for development. Allows to gather profiling data and events from the engine.
@@ -85,6 +87,16 @@ API_CLASS(Static) class FLAXENGINE_API ProfilingTools
         /// The last rendered frame stats.
         /// </summary>
         API_FIELD() RenderStatsData DrawStats;
+
+        /// <summary>
+        /// The content streaming stats (from the last update).
+        /// </summary>
+        API_FIELD() StreamingStats Streaming;
+
+        /// <summary>
+        /// The particles simulation stats (from the last update).
+        /// </summary>
+        API_FIELD() ParticlesStats Particles;
     };
 
     /// <summary>
@@ -123,6 +135,82 @@ API_CLASS(Static) class FLAXENGINE_API ProfilingTools
         API_FIELD(Private, NoArray) byte Name[120];
     };
 
+    /// <summary>
+    /// The worker thread stats (of the Job System or Thread Pool). Measured over the last frame.
+    /// </summary>
+    API_STRUCT(NoDefault) struct WorkerThreadStats
+    {
+        DECLARE_SCRIPTING_TYPE_MINIMAL(WorkerThreadStats);
+
+        /// <summary>
+        /// The thread name.
+        /// </summary>
+        API_FIELD() String Name;
+
+        /// <summary>
+        /// The time spent on executing jobs (in milliseconds).
+        /// </summary>
+        API_FIELD() float BusyTimeMs;
+
+        /// <summary>
+        /// The time spent on waiting for jobs (in milliseconds).
+        /// </summary>
+        API_FIELD() float IdleTimeMs;
+
+        /// <summary>
+        /// The average time between job enqueue and start of its execution (in milliseconds).
+        /// </summary>
+        API_FIELD() float LatencyMs;
+
+        /// <summary>
+        /// The amount of executed jobs.
+        /// </summary>
+        API_FIELD() int32 JobsCount;
+
+        /// <summary>
+        /// The amount of jobs stolen from the other threads queues.
+        /// </summary>
+        API_FIELD() int32 StealsCount;
+
+        /// <summary>
+        /// The amount of jobs waiting in the thread queue (or in the shared queue for Thread Pool).
+        /// </summary>
+        API_FIELD() int32 QueueDepth;
+    };
+
+    /// <summary>
+    /// The native memory stats of a single allocation tag.
+    /// </summary>
+    API_STRUCT(NoDefault) struct MemoryTagStats
+    {
+        DECLARE_SCRIPTING_TYPE_MINIMAL(MemoryTagStats);
+
+        /// <summary>
+        /// The memory tag.
+        /// </summary>
+        API_FIELD() MemoryTag Tag;
+
+        /// <summary>
+        /// The amount of currently allocated memory (in bytes).
+        /// </summary>
+        API_FIELD() uint64 CurrentBytes;
+
+        /// <summary>
+        /// The peak amount of allocated memory (in bytes).
+        /// </summary>
+        API_FIELD() uint64 PeakBytes;
+
+        /// <summary>
+        /// The amount of allocations made during the last frame.
+        /// </summary>
+        API_FIELD() int32 AllocationsCount;
+
+        /// <summary>
+        /// The amount of memory allocated during the last frame (in bytes).
+        /// </summary>
+        API_FIELD() uint64 AllocatedBytes;
+    };
+
 public:
     /// <summary>
     /// Controls the engine profiler (CPU, GPU, etc.) usage.
@@ -153,6 +241,16 @@ API_CLASS(Static) class FLAXENGINE_API ProfilingTools
     /// The networking profiler events.
     /// </summary>
     API_FIELD(ReadOnly) static Array<NetworkEventStat> EventsNetwork;
+
+    /// <summary>
+    /// The Job System and Thread Pool worker threads stats. Updated every frame.
+    /// </summary>
+    API_FIELD(ReadOnly) static Array<WorkerThreadStats> WorkersStats;
+
+    /// <summary>
+    /// The native memory stats per allocation tag (indexed by MemoryTag). Updated every frame.
+    /// </summary>
+    API_FIELD(ReadOnly) static Array<MemoryTagStats> MemoryTagsStats;
 };
 
 #endif
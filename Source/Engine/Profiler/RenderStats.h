@@ -38,6 +38,46 @@ API_STRUCT() struct RenderStatsData
     /// </summary>
     API_FIELD() int64 PipelineStateChanges;
 
+    /// <summary>
+    /// The pipeline state objects created during rendering (not prepared ahead, eg. missing in the pipeline states cache). Each one can cause a hitch.
+    /// </summary>
+    API_FIELD() int64 PipelineStateMisses;
+
+    /// <summary>
+    /// The resource barriers (state transitions) count. Counted only by the graphics backends that use explicit barriers.
+    /// </summary>
+    API_FIELD() int64 ResourceBarriers;
+
+    /// <summary>
+    /// The size (in bytes) of the resources memory transitioned by the resource barriers (approximated for the subresource transitions).
+    /// </summary>
+    API_FIELD() int64 ResourceBarriersSize;
+
+    /// <summary>
+    /// The primitives read by the input assembler. Collected from the pipeline statistics queries when <see cref="ProfilerGPU.PipelineStatistics"/> is enabled (otherwise zero).
+    /// </summary>
+    API_FIELD() int64 InputPrimitives;
+
+    /// <summary>
+    /// The primitives that passed the clipping stage and were sent to the rasterizer. Collected from the pipeline statistics queries when <see cref="ProfilerGPU.PipelineStatistics"/> is enabled (otherwise zero).
+    /// </summary>
+    API_FIELD() int64 RasterizedPrimitives;
+
+    /// <summary>
+    /// The vertex shader invocations count. Collected from the pipeline statistics queries when <see cref="ProfilerGPU.PipelineStatistics"/> is enabled (otherwise zero).
+    /// </summary>
+    API_FIELD() int64 VSInvocations;
+
+    /// <summary>
+    /// The pixel shader invocations count. Collected from the pipeline statistics queries when <see cref="ProfilerGPU.PipelineStatistics"/> is enabled (otherwise zero).
+    /// </summary>
+    API_FIELD() int64 PSInvocations;
+
+    /// <summary>
+    /// The compute shader invocations count. Collected from the pipeline statistics queries when <see cref="ProfilerGPU.PipelineStatistics"/> is enabled (otherwise zero).
+    /// </summary>
+    API_FIELD() int64 CSInvocations;
+
     /// <summary>
     /// Initializes a new instance of the <see cref="RenderStatsData"/> struct.
     /// </summary>
@@ -47,6 +87,14 @@ API_STRUCT() struct RenderStatsData
         , Vertices(0)
         , Triangles(0)
         , PipelineStateChanges(0)
+        , PipelineStateMisses(0)
+        , ResourceBarriers(0)
+        , ResourceBarriersSize(0)
+        , InputPrimitives(0)
+        , RasterizedPrimitives(0)
+        , VSInvocations(0)
+        , PSInvocations(0)
+        , CSInvocations(0)
     {
     }
 
@@ -67,12 +115,19 @@ API_STRUCT() struct RenderStatsData
         MIX(Vertices);
         MIX(Triangles);
         MIX(PipelineStateChanges);
+        MIX(PipelineStateMisses);
+        MIX(ResourceBarriers);
+        MIX(ResourceBarriersSize);
 #undef MIX
     }
 };
 
 #define RENDER_STAT_DISPATCH_CALL() Platform::InterlockedIncrement(&RenderStatsData::Counter.DispatchCalls)
 #define RENDER_STAT_PS_STATE_CHANGE() Platform::InterlockedIncrement(&RenderStatsData::Counter.PipelineStateChanges)
+#define RENDER_STAT_PS_STATE_MISS() Platform::InterlockedIncrement(&RenderStatsData::Counter.PipelineStateMisses)
+#define RENDER_STAT_RESOURCE_BARRIER(size) \
+	Platform::InterlockedIncrement(&RenderStatsData::Counter.ResourceBarriers); \
+	Platform::InterlockedAdd(&RenderStatsData::Counter.ResourceBarriersSize, size)
 #define RENDER_STAT_DRAW_CALL(vertices, triangles) \
 	Platform::InterlockedIncrement(&RenderStatsData::Counter.DrawCalls); \
 	Platform::InterlockedAdd(&RenderStatsData::Counter.Vertices, vertices); \
@@ -82,6 +137,8 @@ API_STRUCT() struct RenderStatsData
 
 #define RENDER_STAT_DISPATCH_CALL()
 #define RENDER_STAT_PS_STATE_CHANGE()
+#define RENDER_STAT_PS_STATE_MISS()
+#define RENDER_STAT_RESOURCE_BARRIER(size)
 #define RENDER_STAT_DRAW_CALL(vertices, primitives)
 
 #endif
@@ -4,9 +4,93 @@
 #include "FontAsset.h"
 #include "FontManager.h"
 #include "Engine/Core/Log.h"
+#include "Engine/Core/Collections/Sorting.h"
 #include "Engine/Threading/Threading.h"
 #include "IncludeFreeType.h"
 
+// The maximum amount of the cached text layouts (shared by all fonts)
+#define FONT_TEXT_LAYOUT_CACHE_SIZE 1024
+// The maximum length of the text to cache its layout (long texts are usually edited so caching them would only trash the cache)
+#define FONT_TEXT_LAYOUT_CACHE_MAX_LENGTH 2048
+
+namespace
+{
+    struct TextLayoutKey
+    {
+        const Font* Owner;
+        uint32 TextHash;
+        int32 TextLength;
+        Float2 BoundsSize;
+        float Scale;
+        float BaseLinesGapScale;
+        TextAlignment HorizontalAlignment;
+        TextAlignment VerticalAlignment;
+        TextWrapping TextWrapping;
+
+        bool operator==(const TextLayoutKey& other) const
+        {
+            return Owner == other.Owner
+                    && TextHash == other.TextHash
+                    && TextLength == other.TextLength
+                    && BoundsSize == other.BoundsSize
+                    && Scale == other.Scale
+                    && BaseLinesGapScale == other.BaseLinesGapScale
+                    && HorizontalAlignment == other.HorizontalAlignment
+                    && VerticalAlignment == other.VerticalAlignment
+                    && TextWrapping == other.TextWrapping;
+        }
+    };
+
+    uint32 GetHash(const TextLayoutKey& key)
+    {
+        uint32 hash = GetHash((const void*)key.Owner);
+        CombineHash(hash, key.TextHash);
+        CombineHash(hash, GetHash(key.BoundsSize.X));
+        CombineHash(hash, GetHash(key.BoundsSize.Y));
+        CombineHash(hash, GetHash(key.Scale));
+        CombineHash(hash, GetHash(key.BaseLinesGapScale));
+        CombineHash(hash, (uint32)key.HorizontalAlignment | (uint32)key.VerticalAlignment << 8 | (uint32)key.TextWrapping << 16);
+        return hash;
+    }
+
+    struct TextLayoutEntry
+    {
+        String Text;
+        Array<FontLineCache> Lines;
+        uint64 LastUsed;
+    };
+
+    CriticalSection TextLayoutLocker;
+    Dictionary<TextLayoutKey, TextLayoutEntry> TextLayouts;
+    uint64 TextLayoutsCounter = 0;
+
+    void ClearTextLayouts(const Font* font)
+    {
+        ScopeLock lock(TextLayoutLocker);
+        for (auto i = TextLayouts.Begin(); i.IsNotEnd(); ++i)
+        {
+            if (i->Key.Owner == font)
+                TextLayouts.Remove(i);
+        }
+    }
+
+    void TrimTextLayouts()
+    {
+        // Remove the least recently used quarter of the cache
+        Array<uint64> lastUsed;
+        lastUsed.EnsureCapacity(TextLayouts.Count());
+        for (const auto& e : TextLayouts)
+            lastUsed.Add(e.Value.LastUsed);
+        Sorting::QuickSort(lastUsed);
+        const uint64 threshold = lastUsed[lastUsed.Count() / 4];
+        for (auto i = TextLayouts.Begin(); i.IsNotEnd(); ++i)
+        {
+            if (i->Value.LastUsed <= threshold)
+                TextLayouts.Remove(i);
+        }
+    }
+}
+
 Array<AssetReference<FontAsset>, HeapAllocation> Font::FallbackFonts;
 
 Font::Font(FontAsset* parentAsset, float size)
@@ -30,6 +114,7 @@ Font::Font(FontAsset* parentAsset, float size)
 
 Font::~Font()
 {
+    ClearTextLayouts(this);
     if (_asset)
         _asset->_fonts.Remove(this);
 }
@@ -117,6 +202,7 @@ void Font::Invalidate()
         FontManager::Invalidate(i->Value);
     }
     _characters.Clear();
+    ClearTextLayouts(this);
 }
 
 void Font::ProcessText(const StringView& text, Array<FontLineCache>& outputLines, const TextLayoutOptions& layout)
@@ -124,6 +210,32 @@ void Font::ProcessText(const StringView& text, Array<FontLineCache>& outputLines
     int32 textLength = text.Length();
     if (textLength == 0)
         return;
+
+    // Try to reuse the cached layout of the same text (eg. static labels are measured and drawn every frame)
+    const bool useCache = textLength <= FONT_TEXT_LAYOUT_CACHE_MAX_LENGTH;
+    TextLayoutKey key;
+    if (useCache)
+    {
+        key.Owner = this;
+        key.TextHash = GetHash(text);
+        key.TextLength = textLength;
+        key.BoundsSize = layout.Bounds.Size;
+        key.Scale = layout.Scale / FontManager::FontScale;
+        key.BaseLinesGapScale = layout.BaseLinesGapScale;
+        key.HorizontalAlignment = layout.HorizontalAlignment;
+        key.VerticalAlignment = layout.VerticalAlignment;
+        key.TextWrapping = layout.TextWrapping;
+        ScopeLock lock(TextLayoutLocker);
+        TextLayoutEntry* entry = TextLayouts.TryGet(key);
+        if (entry && text == entry->Text)
+        {
+            entry->LastUsed = ++TextLayoutsCounter;
+            outputLines.Add(entry->Lines);
+            return;
+        }
+    }
+    const int32 outputLinesStart = outputLines.Count();
+
     float cursorX = 0;
     int32 kerning;
     FontLineCache tmpLine;
@@ -301,6 +413,18 @@ void Font::ProcessText(const StringView& text, Array<FontLineCache>& outputLines
 
         line.Location = rootPos;
     }
+
+    // Cache the layout
+    if (useCache)
+    {
+        ScopeLock lock(TextLayoutLocker);
+        if (TextLayouts.Count() >= FONT_TEXT_LAYOUT_CACHE_SIZE)
+            TrimTextLayouts();
+        TextLayoutEntry& entry = TextLayouts[key];
+        entry.Text = text;
+        entry.Lines.Set(outputLines.Get() + outputLinesStart, outputLines.Count() - outputLinesStart);
+        entry.LastUsed = ++TextLayoutsCounter;
+    }
 }
 
 Float2 Font::MeasureText(const StringView& text, const TextLayoutOptions& layout)
@@ -166,6 +166,11 @@ API_STRUCT(NoDefault) struct FLAXENGINE_API FontCharacterEntry
     /// </summary>
     API_FIELD() bool IsValid = false;
 
+    /// <summary>
+    /// True if the glyph texture contains the signed distance field (shared by all font sizes) instead of the coverage bitmap.
+    /// </summary>
+    API_FIELD() bool IsSDF;
+
     /// <summary>
     /// The index to a specific texture in the font cache.
     /// </summary>
@@ -206,6 +211,11 @@ API_STRUCT(NoDefault) struct FLAXENGINE_API FontCharacterEntry
     /// </summary>
     API_FIELD() Float2 UVSize;
 
+    /// <summary>
+    /// The scale of the character quad relative to its size in the texture. Equal to 1 for bitmap glyphs rasterized for the font size.
+    /// </summary>
+    API_FIELD() float Scale;
+
     /// <summary>
     /// The slot in texture atlas, containing the pixel data of the glyph.
     /// </summary>
@@ -341,6 +351,9 @@ API_CLASS(Sealed, NoSpawn) class FLAXENGINE_API Font : public ManagedScriptingOb
     /// <summary>
     /// Processes text to get cached lines for rendering.
     /// </summary>
+    /// <remarks>
+    /// Text layout results are cached (by font, text and layout options) and reused by the following calls (eg. measuring and drawing static labels every frame).
+    /// </remarks>
     /// <param name="text">The input text.</param>
     /// <param name="layout">The layout properties.</param>
     /// <param name="outputLines">The output lines list.</param>
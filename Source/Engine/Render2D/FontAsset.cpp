@@ -58,6 +58,9 @@ void FontAsset::unload(bool isReloading)
         _fonts.Clear();
     }
 
+    // Release shared characters
+    FontManager::Invalidate(this);
+
     // Unload face
     if (_face)
     {
@@ -209,6 +212,7 @@ void FontAsset::Invalidate()
     ScopeLock lock(Locker);
     for (auto font : _fonts)
         font->Invalidate();
+    FontManager::Invalidate(this);
 }
 
 uint64 FontAsset::GetMemoryUsage() const
@@ -64,6 +64,11 @@ API_ENUM(Attributes="Flags") enum class FontFlags : byte
     /// Enables slant effect, emulating italic style.
     /// </summary>
     Italic = 4,
+
+    /// <summary>
+    /// Enables rendering characters from signed distance field glyphs that are rasterized once per font asset and shared by all font sizes. Improves performance and memory usage when using many font sizes (eg. UI scaling or animated text) at the cost of softer corners. Not supported by the custom text materials.
+    /// </summary>
+    SDF = 8,
 };
 
 DECLARE_ENUM_OPERATORS(FontFlags);
@@ -6,6 +6,7 @@
 #include "Font.h"
 #include "Engine/Platform/Platform.h"
 #include "Engine/Core/Log.h"
+#include "Engine/Core/Collections/Dictionary.h"
 #include "Engine/Content/Content.h"
 #include "Engine/Engine/EngineService.h"
 #include "Engine/Threading/Threading.h"
@@ -14,12 +15,30 @@
 #include <ThirdParty/freetype/ftbitmap.h>
 #include <ThirdParty/freetype/internal/ftdrv.h>
 
+// The size (in pixels) of the signed distance field glyphs (shared by all font sizes)
+#define FONT_SDF_SIZE 32
+// The distance range (in pixels) encoded around the signed distance field glyphs
+#define FONT_SDF_SPREAD 4
+
 namespace FontManagerImpl
 {
+    struct SDFGlyph
+    {
+        int16 OffsetX;
+        int16 OffsetY;
+        byte TextureIndex;
+        Float2 UV;
+        Float2 UVSize;
+        const FontTextureAtlasSlot* Slot;
+    };
+
     FT_Library Library;
     CriticalSection Locker;
     Array<AssetReference<FontTextureAtlas>> Atlases;
     Array<byte> GlyphImageData;
+    Dictionary<const FontAsset*, Dictionary<Char, SDFGlyph>> SDFGlyphs;
+    Array<double> SDFOuter, SDFInner, SDFTemp;
+    Array<int32> SDFTempIndices;
 }
 
 using namespace FontManagerImpl;
@@ -30,6 +49,7 @@ class FontManagerService : public EngineService
     FontManagerService()
         : EngineService(TEXT("Font Manager"), -700)
     {
+        ParallelInit = true;
     }
 
     bool Init() override;
@@ -93,6 +113,7 @@ bool FontManagerService::Init()
 void FontManagerService::Dispose()
 {
     // Release font atlases
+    SDFGlyphs.Clear();
     Atlases.Resize(0);
 
     // Clean library
@@ -107,6 +128,235 @@ void FontManagerService::Dispose()
     }
 }
 
+namespace
+{
+    const FontTextureAtlasSlot* AddToAtlas(int32 glyphWidth, int32 glyphHeight, int32& atlasIndex)
+    {
+        // Find atlas for the character texture
+        atlasIndex = 0;
+        const FontTextureAtlasSlot* slot = nullptr;
+        for (; atlasIndex < Atlases.Count(); atlasIndex++)
+        {
+            // Add the character to the texture
+            slot = Atlases[atlasIndex]->AddEntry(glyphWidth, glyphHeight, GlyphImageData);
+
+            // Check result, if not null char has been added
+            if (slot)
+            {
+                break;
+            }
+        }
+
+        // Check if there is no atlas for this character
+        if (!slot)
+        {
+            // Create new atlas
+            auto atlas = Content::CreateVirtualAsset<FontTextureAtlas>();
+            atlas->Setup(PixelFormat::R8_UNorm, FontTextureAtlas::PaddingStyle::PadWithZero);
+            Atlases.Add(atlas);
+
+            // Init atlas
+            const int32 fontAtlasSize = 512; // TODO: make it a configuration variable
+            atlas->Init(fontAtlasSize, fontAtlasSize);
+
+            // Add the character to the texture
+            slot = atlas->AddEntry(glyphWidth, glyphHeight, GlyphImageData);
+        }
+        return slot;
+    }
+
+    // Squared Euclidean distance transform in 1D (Felzenszwalb and Huttenlocher), performed in-place on the grid row or column
+    void DistanceTransform1D(double* grid, int32 offset, int32 stride, int32 length, double* f, double* z, int32* v)
+    {
+        const double inf = 1e20;
+        for (int32 q = 0; q < length; q++)
+            f[q] = grid[offset + q * stride];
+        int32 k = 0;
+        v[0] = 0;
+        z[0] = -inf;
+        z[1] = inf;
+        for (int32 q = 1; q < length; q++)
+        {
+            // Find the lower envelope of the parabolas (z[0] is -inf so the loop always ends)
+            double s = (f[q] - f[v[k]] + (double)q * q - (double)v[k] * v[k]) / (2.0 * (q - v[k]));
+            while (s <= z[k])
+            {
+                k--;
+                s = (f[q] - f[v[k]] + (double)q * q - (double)v[k] * v[k]) / (2.0 * (q - v[k]));
+            }
+            k++;
+            v[k] = q;
+            z[k] = s;
+            z[k + 1] = inf;
+        }
+        k = 0;
+        for (int32 q = 0; q < length; q++)
+        {
+            while (z[k + 1] < q)
+                k++;
+            const int32 r = v[k];
+            grid[offset + q * stride] = (double)(q - r) * (q - r) + f[r];
+        }
+    }
+
+    void DistanceTransform(double* grid, int32 width, int32 height)
+    {
+        const int32 size = Math::Max(width, height);
+        SDFTemp.Resize(size * 2 + 1, false);
+        SDFTempIndices.Resize(size, false);
+        double* f = SDFTemp.Get();
+        double* z = f + size;
+        for (int32 x = 0; x < width; x++)
+            DistanceTransform1D(grid, x, width, height, f, z, SDFTempIndices.Get());
+        for (int32 y = 0; y < height; y++)
+            DistanceTransform1D(grid, y * width, 1, width, f, z, SDFTempIndices.Get());
+    }
+
+    // Converts the glyph coverage bitmap (with the anti-aliased edges) into the signed distance field stored in GlyphImageData (0.5 at the glyph edge, larger inside)
+    void GenerateSDF(const FT_Bitmap* bitmap, int32 width, int32 height)
+    {
+        const double inf = 1e20;
+        SDFOuter.Resize(width * height, false);
+        SDFInner.Resize(width * height, false);
+        for (int32 i = 0; i < width * height; i++)
+        {
+            SDFOuter[i] = inf;
+            SDFInner[i] = 0.0;
+        }
+        for (int32 y = 0; y < (int32)bitmap->rows; y++)
+        {
+            for (int32 x = 0; x < (int32)bitmap->width; x++)
+            {
+                const double coverage = bitmap->buffer[y * bitmap->pitch + x] / (double)(bitmap->num_grays - 1);
+                const int32 i = (y + FONT_SDF_SPREAD) * width + x + FONT_SDF_SPREAD;
+                if (coverage >= 1.0)
+                {
+                    SDFOuter[i] = 0.0;
+                    SDFInner[i] = inf;
+                }
+                else if (coverage > 0.0)
+                {
+                    // Use the coverage of the edge pixels to estimate the sub-pixel distance to the edge
+                    const double outer = Math::Max(0.0, 0.5 - coverage);
+                    const double inner = Math::Max(0.0, coverage - 0.5);
+                    SDFOuter[i] = outer * outer;
+                    SDFInner[i] = inner * inner;
+                }
+            }
+        }
+        DistanceTransform(SDFOuter.Get(), width, height);
+        DistanceTransform(SDFInner.Get(), width, height);
+        GlyphImageData.Resize(width * height);
+        for (int32 i = 0; i < width * height; i++)
+        {
+            const float distance = Math::Sqrt((float)SDFOuter[i]) - Math::Sqrt((float)SDFInner[i]);
+            const float value = 0.5f - distance / (2.0f * FONT_SDF_SPREAD);
+            GlyphImageData[i] = (byte)Math::Clamp(Math::RoundToInt(value * 255.0f), 0, 255);
+        }
+    }
+
+    bool AddNewEntrySDF(Font* font, Char c, FontCharacterEntry& entry)
+    {
+        const FontAsset* asset = font->GetAsset();
+        const FontOptions& options = asset->GetOptions();
+        const FT_Face face = asset->GetFTFace();
+        const FT_UInt glyphIndex = FT_Get_Char_Index(face, c);
+        const uint32 glyphFlags = FT_LOAD_NO_BITMAP | FT_LOAD_NO_HINTING;
+
+        // Init the character data
+        Platform::MemoryClear(&entry, sizeof(entry));
+        entry.Character = c;
+        entry.Font = font;
+        entry.IsValid = false;
+
+        // Rasterize the glyph distance field only once for all font sizes
+        auto& glyphs = SDFGlyphs[asset];
+        SDFGlyph* glyph = glyphs.TryGet(c);
+        if (!glyph)
+        {
+            FT_Set_Char_Size(face, 0, ConvertPixelTo26Dot6<FT_F26Dot6>(FONT_SDF_SIZE), DefaultDPI, DefaultDPI);
+            FT_Error error = FT_Load_Glyph(face, glyphIndex, glyphFlags);
+            if (error)
+            {
+                LOG_FT_ERROR(error);
+                font->FlushFaceSize();
+                return true;
+            }
+            if (EnumHasAnyFlags(options.Flags, FontFlags::Bold))
+                FT_GlyphSlot_Embolden(face->glyph);
+            if (EnumHasAnyFlags(options.Flags, FontFlags::Italic))
+                FT_GlyphSlot_Oblique(face->glyph);
+            FT_Render_Glyph(face->glyph, FT_RENDER_MODE_NORMAL);
+
+            FT_Bitmap* bitmap = &face->glyph->bitmap;
+            FT_Bitmap tmpBitmap;
+            if (bitmap->pixel_mode != FT_PIXEL_MODE_GRAY)
+            {
+                // Convert the bitmap to 8bpp grayscale
+                FT_Bitmap_New(&tmpBitmap);
+                FT_Bitmap_Convert(Library, bitmap, &tmpBitmap, 4);
+                bitmap = &tmpBitmap;
+            }
+
+            SDFGlyph newGlyph;
+            Platform::MemoryClear(&newGlyph, sizeof(newGlyph));
+            newGlyph.TextureIndex = MAX_uint8;
+            newGlyph.OffsetX = (int16)(face->glyph->bitmap_left - FONT_SDF_SPREAD);
+            newGlyph.OffsetY = (int16)(face->glyph->bitmap_top + FONT_SDF_SPREAD);
+            if (bitmap->width != 0 && bitmap->rows != 0)
+            {
+                // Generate distance field with the spread border around the glyph
+                const int32 glyphWidth = bitmap->width + FONT_SDF_SPREAD * 2;
+                const int32 glyphHeight = bitmap->rows + FONT_SDF_SPREAD * 2;
+                GenerateSDF(bitmap, glyphWidth, glyphHeight);
+
+                int32 atlasIndex;
+                const FontTextureAtlasSlot* slot = AddToAtlas(glyphWidth, glyphHeight, atlasIndex);
+                if (slot == nullptr)
+                {
+                    LOG(Error, "Cannot find free space in texture atlases for character '{0}' from font {1} {2}. Size: {3}x{4}", c, String(face->family_name), String(face->style_name), glyphWidth, glyphHeight);
+                }
+                else
+                {
+                    const uint32 padding = Atlases[atlasIndex]->GetPaddingAmount();
+                    newGlyph.TextureIndex = atlasIndex;
+                    newGlyph.UV = Float2((float)(slot->X + padding), (float)(slot->Y + padding));
+                    newGlyph.UVSize = Float2((float)(slot->Width - 2 * padding), (float)(slot->Height - 2 * padding));
+                    newGlyph.Slot = slot;
+                }
+            }
+            if (bitmap == &tmpBitmap)
+                FT_Bitmap_Done(Library, bitmap);
+            glyph = &glyphs.Add(c, newGlyph)->Value;
+        }
+
+        // Get the character metrics for the font size
+        font->FlushFaceSize();
+        const FT_Error error = FT_Load_Glyph(face, glyphIndex, glyphFlags);
+        if (error)
+        {
+            LOG_FT_ERROR(error);
+            return true;
+        }
+        if (EnumHasAnyFlags(options.Flags, FontFlags::Bold))
+            FT_GlyphSlot_Embolden(face->glyph);
+        const float scale = font->GetSize() * FontManager::FontScale / FONT_SDF_SIZE;
+        entry.AdvanceX = Convert26Dot6ToRoundedPixel<int16>(face->glyph->advance.x);
+        entry.OffsetX = (int16)Math::RoundToInt(glyph->OffsetX * scale);
+        entry.OffsetY = (int16)Math::RoundToInt(glyph->OffsetY * scale);
+        entry.BearingY = Convert26Dot6ToRoundedPixel<int16>(face->glyph->metrics.horiBearingY);
+        entry.Height = Convert26Dot6ToRoundedPixel<int16>(face->glyph->metrics.height);
+        entry.IsValid = true;
+        entry.IsSDF = true;
+        entry.Scale = scale;
+        entry.TextureIndex = glyph->TextureIndex;
+        entry.UV = glyph->UV;
+        entry.UVSize = glyph->UVSize;
+        entry.Slot = glyph->Slot;
+        return false;
+    }
+}
+
 FontTextureAtlas* FontManager::GetAtlas(int32 index)
 {
     return index >= 0 && index < Atlases.Count() ? Atlases.Get()[index].Get() : nullptr;
@@ -120,6 +370,8 @@ bool FontManager::AddNewEntry(Font* font, Char c, FontCharacterEntry& entry)
     const FontOptions& options = asset->GetOptions();
     const FT_Face face = asset->GetFTFace();
     ASSERT(face != nullptr);
+    if (EnumHasAnyFlags(options.Flags, FontFlags::SDF))
+        return AddNewEntrySDF(font, c, entry);
     font->FlushFaceSize();
 
     // Set load flags
@@ -166,6 +418,7 @@ bool FontManager::AddNewEntry(Font* font, Char c, FontCharacterEntry& entry)
     entry.Character = c;
     entry.Font = font;
     entry.IsValid = false;
+    entry.Scale = 1.0f;
 
     // Load the glyph
     const FT_Error error = FT_Load_Glyph(face, glyphIndex, glyphFlags);
@@ -249,36 +502,9 @@ bool FontManager::AddNewEntry(Font* font, Char c, FontCharacterEntry& entry)
         bitmap = nullptr;
     }
 
-    // Find atlas for the character texture
-    int32 atlasIndex = 0;
-    const FontTextureAtlasSlot* slot = nullptr;
-    for (; atlasIndex < Atlases.Count(); atlasIndex++)
-    {
-        // Add the character to the texture
-        slot = Atlases[atlasIndex]->AddEntry(glyphWidth, glyphHeight, GlyphImageData);
-
-        // Check result, if not null char has been added
-        if (slot)
-        {
-            break;
-        }
-    }
-
-    // Check if there is no atlas for this character
-    if (!slot)
-    {
-        // Create new atlas
-        auto atlas = Content::CreateVirtualAsset<FontTextureAtlas>();
-        atlas->Setup(PixelFormat::R8_UNorm, FontTextureAtlas::PaddingStyle::PadWithZero);
-        Atlases.Add(atlas);
-
-        // Init atlas
-        const int32 fontAtlasSize = 512; // TODO: make it a configuration variable
-        atlas->Init(fontAtlasSize, fontAtlasSize);
-
-        // Add the character to the texture
-        slot = atlas->AddEntry(glyphWidth, glyphHeight, GlyphImageData);
-    }
+    // Add the character to the texture atlas
+    int32 atlasIndex;
+    const FontTextureAtlasSlot* slot = AddToAtlas(glyphWidth, glyphHeight, atlasIndex);
     if (slot == nullptr)
     {
         LOG(Error, "Cannot find free space in texture atlases for character '{0}' from font {1} {2}. Size: {3}x{4}", c, String(face->family_name), String(face->style_name), glyphWidth, glyphHeight);
@@ -299,7 +525,8 @@ bool FontManager::AddNewEntry(Font* font, Char c, FontCharacterEntry& entry)
 
 void FontManager::Invalidate(FontCharacterEntry& entry)
 {
-    if (entry.TextureIndex == MAX_uint8)
+    // Signed distance field glyphs are shared by all font sizes and released with the font asset
+    if (entry.TextureIndex == MAX_uint8 || entry.IsSDF)
         return;
     auto atlas = Atlases[entry.TextureIndex];
     const uint32 padding = atlas->GetPaddingAmount();
@@ -310,6 +537,24 @@ void FontManager::Invalidate(FontCharacterEntry& entry)
     atlas->Invalidate(slotX, slotY, slotSizeX, slotSizeY);
 }
 
+void FontManager::Invalidate(const FontAsset* asset)
+{
+    ScopeLock lock(Locker);
+    auto* glyphs = SDFGlyphs.TryGet(asset);
+    if (!glyphs)
+        return;
+    for (const auto& e : *glyphs)
+    {
+        const SDFGlyph& glyph = e.Value;
+        if (glyph.TextureIndex == MAX_uint8)
+            continue;
+        auto atlas = Atlases[glyph.TextureIndex];
+        const uint32 padding = atlas->GetPaddingAmount();
+        atlas->Invalidate((uint32)glyph.UV.X - padding, (uint32)glyph.UV.Y - padding, (uint32)glyph.UVSize.X + 2 * padding, (uint32)glyph.UVSize.Y + 2 * padding);
+    }
+    SDFGlyphs.Remove(asset);
+}
+
 void FontManager::Flush()
 {
     for (const auto& atlas : Atlases)
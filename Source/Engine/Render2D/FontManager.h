@@ -50,6 +50,12 @@ class FLAXENGINE_API FontManager
     /// <param name="entry">The font character entry.</param>
     static void Invalidate(FontCharacterEntry& entry);
 
+    /// <summary>
+    /// Invalidates the cached signed distance field characters of the font asset (shared by all font sizes).
+    /// </summary>
+    /// <param name="asset">The font asset.</param>
+    static void Invalidate(const FontAsset* asset);
+
     /// <summary>
     /// Flushes all font atlases.
     /// </summary>
@@ -1,6 +1,7 @@
 // Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
 
 #include "Render2D.h"
+#include "Render2DCache.h"
 #include "Font.h"
 #include "FontManager.h"
 #include "FontTextureAtlas.h"
@@ -46,6 +47,9 @@
 
 #define RENDER2D_BLUR_MAX_SAMPLES 64
 
+// The maximum amount of textures used by a single batch of textured draw calls (must match shader)
+#define RENDER2D_BATCH_MAX_TEXTURES 8
+
 // The format for the blur effect temporary buffer
 #define PS_Blur_Format PixelFormat::R8G8B8A8_UNorm
 
@@ -72,6 +76,7 @@ enum class DrawCallType : byte
     FillTexture,
     FillTexturePoint,
     DrawChar,
+    DrawCharSDF,
     DrawCharMaterial,
     Custom,
     Material,
@@ -149,6 +154,14 @@ struct Render2DVertex
     RotatedRectangle ClipMask;
 };
 
+struct Render2DBatch
+{
+    int32 Start;
+    int32 Count;
+    int32 TexturesCount;
+    GPUTexture* Textures[RENDER2D_BATCH_MAX_TEXTURES];
+};
+
 struct CachedPSO
 {
     bool Inited = false;
@@ -162,6 +175,7 @@ struct CachedPSO
     GPUPipelineState* PS_Color_NoAlpha;
 
     GPUPipelineState* PS_Font;
+    GPUPipelineState* PS_FontSDF;
 
     GPUPipelineState* PS_BlurH;
     GPUPipelineState* PS_BlurV;
@@ -193,6 +207,7 @@ namespace
 
     // Drawing
     Array<Render2DDrawCall> DrawCalls;
+    Array<Render2DBatch> Batches;
     Array<FontLineCache> Lines;
     Array<Float2> Lines2;
     bool IsScissorsRectEmpty;
@@ -220,6 +235,14 @@ namespace
     DynamicIndexBuffer IB(RENDER2D_INITIAL_IB_CAPACITY, sizeof(uint32), TEXT("Render2D.IB"));
     uint32 VBIndex = 0;
     uint32 IBIndex = 0;
+
+    // Retained geometry recording
+    Render2DCache* CacheRecording = nullptr;
+    int32 CacheDrawCallsStart;
+    int32 CacheVBStart;
+    int32 CacheIBStart;
+    uint32 CacheVBIndexStart;
+    uint32 CacheIBIndexStart;
 }
 
 #define RENDER2D_WRITE_IB_QUAD(indices) \
@@ -453,6 +476,7 @@ CanDrawCallCallback CanDrawCallBatch[] =
     CanDrawCallCallbackTexture, // FillTexture,
     CanDrawCallCallbackTexture, // FillTexturePoint,
     CanDrawCallCallbackChar, // DrawChar,
+    CanDrawCallCallbackChar, // DrawCharSDF,
     CanDrawCallCallbackCharMaterial, // DrawCharMaterial,
     CanDrawCallCallbackFalse, // Custom,
     CanDrawCallCallbackMaterial, // Material,
@@ -468,7 +492,80 @@ bool CanBatchDrawCalls(const Render2DDrawCall& d1, const Render2DDrawCall& d2)
     return d1.Type == d2.Type && CanDrawCallBatch[(int32)d1.Type](d1, d2);
 }
 
-void DrawBatch(int32 startIndex, int32 count);
+// Gets the texture of the draw call that can be batched with draw calls using other textures (sampled from the texture slot written into the vertices), otherwise null.
+FORCE_INLINE GPUTexture* GetBatchTexture(const Render2DDrawCall& d)
+{
+    switch (d.Type)
+    {
+    case DrawCallType::FillTexture:
+    case DrawCallType::FillTexturePoint:
+        return d.AsTexture.Ptr;
+    case DrawCallType::DrawChar:
+    case DrawCallType::DrawCharSDF:
+        return d.AsChar.Tex;
+    default:
+        return nullptr;
+    }
+}
+
+void BuildBatches()
+{
+    Batches.Clear();
+    Render2DVertex* vertices = (Render2DVertex*)VB.Data.Get();
+    const uint32* indices = (const uint32*)IB.Data.Get();
+    Render2DBatch* batch = nullptr;
+    for (int32 i = 0; i < DrawCalls.Count(); i++)
+    {
+        const Render2DDrawCall& drawCall = DrawCalls.Get()[i];
+        GPUTexture* texture = GetBatchTexture(drawCall);
+
+        // Check if can add element to the current batch
+        int32 slot = -1;
+        if (batch)
+        {
+            const Render2DDrawCall& first = DrawCalls.Get()[batch->Start];
+            if (texture && first.Type == drawCall.Type)
+            {
+                // Textured draw calls of the same type can use different textures (up to the limit)
+                for (int32 j = 0; j < batch->TexturesCount && slot == -1; j++)
+                {
+                    if (batch->Textures[j] == texture)
+                        slot = j;
+                }
+                if (slot == -1 && batch->TexturesCount < RENDER2D_BATCH_MAX_TEXTURES)
+                {
+                    slot = batch->TexturesCount++;
+                    batch->Textures[slot] = texture;
+                }
+            }
+            else if (CanBatchDrawCalls(first, drawCall))
+            {
+                slot = 0;
+            }
+        }
+        if (slot == -1)
+        {
+            // Start a new batch
+            batch = &Batches.AddOne();
+            batch->Start = i;
+            batch->Count = 0;
+            batch->TexturesCount = texture ? 1 : 0;
+            batch->Textures[0] = texture;
+            slot = 0;
+        }
+        batch->Count++;
+
+        if (texture)
+        {
+            // Write texture slot into the vertices (custom data is not used by the textured geometry)
+            const uint32 endIB = drawCall.StartIB + drawCall.CountIB;
+            for (uint32 j = drawCall.StartIB; j < endIB; j++)
+                vertices[indices[j]].CustomData.X = (float)slot;
+        }
+    }
+}
+
+void DrawBatch(const Render2DBatch& batch);
 
 bool CachedPSO::Init(GPUShader* shader, bool useDepth)
 {
@@ -515,6 +612,11 @@ bool CachedPSO::Init(GPUShader* shader, bool useDepth)
     if (PS_Font->Init(desc))
         return true;
     //
+    desc.PS = shader->GetPS("PS_FontSDF");
+    PS_FontSDF = GPUDevice::Instance->CreatePipelineState();
+    if (PS_FontSDF->Init(desc))
+        return true;
+    //
     desc.PS = shader->GetPS("PS_LineAA");
     PS_LineAA = GPUDevice::Instance->CreatePipelineState();
     if (PS_LineAA->Init(desc))
@@ -552,6 +654,7 @@ void CachedPSO::Dispose()
     SAFE_DELETE_GPU_RESOURCE(PS_Color);
     SAFE_DELETE_GPU_RESOURCE(PS_Color_NoAlpha);
     SAFE_DELETE_GPU_RESOURCE(PS_Font);
+    SAFE_DELETE_GPU_RESOURCE(PS_FontSDF);
     SAFE_DELETE_GPU_RESOURCE(PS_BlurH);
     SAFE_DELETE_GPU_RESOURCE(PS_BlurV);
     SAFE_DELETE_GPU_RESOURCE(PS_Downscale);
@@ -596,6 +699,10 @@ void OnGUIShaderReloading(Asset* obj)
 
 bool Render2DService::Init()
 {
+    // Geometry is rebuilt every frame so it can live in the per-frame upload memory
+    VB.SetTransient(true);
+    IB.SetTransient(true);
+
     // GUI Shader
     GUIShader = Content::LoadAsyncInternal<Shader>(TEXT("Shaders/GUI"));
     if (GUIShader == nullptr)
@@ -696,10 +803,12 @@ void Render2D::Begin(GPUContext* context, GPUTextureView* output, GPUTextureView
     IB.Clear();
     VBIndex = 0;
     IBIndex = 0;
+    CacheRecording = nullptr;
 }
 
 void Render2D::End()
 {
+    PROFILE_MEM(UI);
     RENDER2D_CHECK_RENDERING_STATE;
     ASSERT(Context != nullptr && Output != nullptr);
     ASSERT(GUIShader != nullptr);
@@ -729,6 +838,9 @@ void Render2D::End()
         shader = GUIShader->GetShader();
     }
 
+    // Merge draw calls into batches (before uploading the geometry that stores the per-vertex texture slots)
+    BuildBatches();
+
     // Flush geometry buffers
     VB.Flush(Context);
     IB.Flush(Context);
@@ -755,34 +867,13 @@ void Render2D::End()
     CurrentPso = DepthBuffer ? &PsoDepth : &PsoNoDepth;
 
     // Flush draw calls
-    int32 batchStart = 0, batchSize = 0;
     IsScissorsRectEmpty = false;
-    for (int32 i = 0; i < DrawCalls.Count(); i++)
-    {
-        // Peek draw call
-        const auto& drawCall = DrawCalls[i];
-
-        // Check if cannot add element to the batching
-        if (batchSize != 0 && !CanBatchDrawCalls(DrawCalls[batchStart], drawCall))
-        {
-            // Flush batched elements
-            DrawBatch(batchStart, batchSize);
-            batchStart += batchSize;
-            batchSize = 0;
-        }
-
-        // Add element to batching
-        batchSize++;
-    }
-
-    // Flush end of batched elements
-    if (batchSize != 0)
-    {
-        DrawBatch(batchStart, batchSize);
-    }
+    for (const Render2DBatch& batch : Batches)
+        DrawBatch(batch);
 
     // End
     DrawCalls.Clear();
+    Batches.Clear();
     Context = nullptr;
     Output = nullptr;
 }
@@ -882,6 +973,204 @@ void Render2D::PopTint()
     TintLayersStack.Pop();
 }
 
+// Marks the recorded scissors draw call that restores the clipping of the parent content (outside the cache)
+#define RENDER2D_CACHE_PARENT_SCISSORS MAX_uint32
+
+Render2DCache::Render2DCache(const SpawnParams& params)
+    : ScriptingObject(params)
+{
+}
+
+Render2DCache::~Render2DCache()
+{
+    Invalidate();
+}
+
+int32 Render2DCache::GetVerticesCount() const
+{
+    return _vertices.Count() / sizeof(Render2DVertex);
+}
+
+void Render2DCache::Invalidate()
+{
+    for (GPUTexture* texture : _textures)
+        texture->Deleted.Unbind<Render2DCache, &Render2DCache::OnTextureDeleted>(this);
+    _textures.Clear();
+    _vertices.Clear();
+    _indices.Clear();
+    _drawCalls.Clear();
+    _isValid = false;
+}
+
+void Render2DCache::OnTextureDeleted(ScriptingObject* obj)
+{
+    _textures.Remove((GPUTexture*)obj);
+    Invalidate();
+}
+
+void Render2D::BeginCache(Render2DCache* cache)
+{
+    RENDER2D_CHECK_RENDERING_STATE;
+    if (cache == nullptr || CacheRecording)
+        return;
+    cache->Invalidate();
+
+    // Cache is stored in the local space of the current transformation
+    if (Math::IsZero(TransformCached.GetDeterminant()))
+        return;
+    Matrix3x3::Invert(TransformCached, cache->_invTransform);
+    cache->_clipMask = ClipLayersStack.Peek().Mask;
+    cache->_clipBounds = ClipLayersStack.Peek().Bounds;
+    cache->_tint = TintLayersStack.Peek();
+    cache->_features = (int32)Features;
+
+    CacheRecording = cache;
+    CacheDrawCallsStart = DrawCalls.Count();
+    CacheVBStart = VB.Data.Count();
+    CacheIBStart = IB.Data.Count();
+    CacheVBIndexStart = VBIndex;
+    CacheIBIndexStart = IBIndex;
+}
+
+void Render2D::EndCache(Render2DCache* cache)
+{
+    RENDER2D_CHECK_RENDERING_STATE;
+    if (cache == nullptr || CacheRecording != cache)
+        return;
+    CacheRecording = nullptr;
+    PROFILE_CPU_NAMED("Render2D.EndCache");
+
+    // Copy draw calls (skip caching content that depends on external state that can change every frame)
+    const int32 drawCallsCount = DrawCalls.Count() - CacheDrawCallsStart;
+    cache->_drawCalls.Set((const byte*)(DrawCalls.Get() + CacheDrawCallsStart), drawCallsCount * sizeof(Render2DDrawCall));
+    cache->_hasScissors = false;
+    for (int32 i = 0; i < drawCallsCount; i++)
+    {
+        Render2DDrawCall& drawCall = ((Render2DDrawCall*)cache->_drawCalls.Get())[i];
+        drawCall.StartIB -= CacheIBIndexStart;
+        GPUTexture* texture = nullptr;
+        switch (drawCall.Type)
+        {
+        case DrawCallType::FillRect:
+        case DrawCallType::FillRectNoAlpha:
+        case DrawCallType::LineAA:
+            break;
+        case DrawCallType::FillTexture:
+        case DrawCallType::FillTexturePoint:
+            texture = drawCall.AsTexture.Ptr;
+            break;
+        case DrawCallType::DrawChar:
+        case DrawCallType::DrawCharSDF:
+            texture = drawCall.AsChar.Tex;
+            break;
+        case DrawCallType::Custom:
+            texture = drawCall.AsCustom.Tex;
+            break;
+        case DrawCallType::ClipScissors:
+            cache->_hasScissors = true;
+            drawCall.CountIB = *(Rectangle*)&drawCall.AsClipScissors.X == cache->_clipBounds ? RENDER2D_CACHE_PARENT_SCISSORS : 0;
+            break;
+        default:
+            cache->Invalidate();
+            return;
+        }
+        if (texture && !cache->_textures.Contains(texture))
+        {
+            cache->_textures.Add(texture);
+            texture->Deleted.Bind<Render2DCache, &Render2DCache::OnTextureDeleted>(cache);
+        }
+    }
+
+    // Copy geometry
+    cache->_vertices.Set(VB.Data.Get() + CacheVBStart, VB.Data.Count() - CacheVBStart);
+    cache->_indices.Set((const uint32*)(IB.Data.Get() + CacheIBStart), (IB.Data.Count() - CacheIBStart) / sizeof(uint32));
+    for (uint32& index : cache->_indices)
+        index -= CacheVBIndexStart;
+    cache->_isValid = true;
+}
+
+bool Render2D::TryDrawCache(Render2DCache* cache)
+{
+#if USE_EDITOR
+    if (!IsRendering())
+    {
+        LOG(Error, "Calling Render2D is only valid during rendering.");
+        return false;
+    }
+#endif
+    if (cache == nullptr || !cache->_isValid || cache->_tint != TintLayersStack.Peek() || cache->_features != (int32)Features)
+        return false;
+    PROFILE_CPU_NAMED("Render2D.DrawCache");
+
+    // Transformation from the recording space into the current one
+    Matrix3x3 transform;
+    Matrix3x3::Multiply(cache->_invTransform, TransformCached, transform);
+    const ClipMask& clip = ClipLayersStack.Peek();
+
+    // Write vertices
+    const int32 verticesCount = cache->GetVerticesCount();
+    const Render2DVertex* srcVertices = (const Render2DVertex*)cache->_vertices.Get();
+    Render2DVertex* vertices = VB.WriteReserve<Render2DVertex>(verticesCount);
+    for (int32 i = 0; i < verticesCount; i++)
+    {
+        const Render2DVertex& src = srcVertices[i];
+        Render2DVertex& dst = vertices[i];
+        dst = src;
+        Matrix3x3::Transform2DPoint(src.Position, transform, dst.Position);
+        if (Platform::MemoryCompare(&src.ClipMask, &cache->_clipMask, sizeof(RotatedRectangle)) == 0)
+        {
+            // Content clipped by the parent uses the current parent clipping
+            dst.ClipMask = clip.Mask;
+        }
+        else
+        {
+            Matrix3x3::Transform2DPoint(src.ClipMask.TopLeft, transform, dst.ClipMask.TopLeft);
+            Matrix3x3::Transform2DVector(src.ClipMask.ExtentX, transform, dst.ClipMask.ExtentX);
+            Matrix3x3::Transform2DVector(src.ClipMask.ExtentY, transform, dst.ClipMask.ExtentY);
+        }
+    }
+
+    // Write indices
+    const int32 indicesCount = cache->_indices.Count();
+    uint32* indices = IB.WriteReserve<uint32>(indicesCount);
+    for (int32 i = 0; i < indicesCount; i++)
+        indices[i] = cache->_indices.Get()[i] + VBIndex;
+
+    // Write draw calls
+    const int32 drawCallsCount = cache->_drawCalls.Count() / sizeof(Render2DDrawCall);
+    const int32 drawCallsStart = DrawCalls.Count();
+    DrawCalls.Add((const Render2DDrawCall*)cache->_drawCalls.Get(), drawCallsCount);
+    for (int32 i = drawCallsStart; i < DrawCalls.Count(); i++)
+    {
+        Render2DDrawCall& drawCall = DrawCalls.Get()[i];
+        drawCall.StartIB += IBIndex;
+        if (drawCall.Type == DrawCallType::ClipScissors)
+        {
+            Rectangle& scissors = *(Rectangle*)&drawCall.AsClipScissors.X;
+            if (drawCall.CountIB == RENDER2D_CACHE_PARENT_SCISSORS)
+            {
+                scissors = clip.Bounds;
+            }
+            else
+            {
+                RotatedRectangle rotated(scissors), transformed;
+                Matrix3x3::Transform2DPoint(rotated.TopLeft, transform, transformed.TopLeft);
+                Matrix3x3::Transform2DVector(rotated.ExtentX, transform, transformed.ExtentX);
+                Matrix3x3::Transform2DVector(rotated.ExtentY, transform, transformed.ExtentY);
+                scissors = Rectangle::Shared(transformed.ToBoundingRect(), clip.Bounds);
+            }
+            drawCall.CountIB = 0;
+        }
+    }
+    VBIndex += verticesCount;
+    IBIndex += indicesCount;
+
+    // Restore parent clipping
+    if (cache->_hasScissors)
+        OnClipScissors();
+    return true;
+}
+
 void CalculateKernelSize(float strength, int32& kernelSize, int32& downSample)
 {
     kernelSize = Math::RoundToInt(strength * 3.0f);
@@ -938,14 +1227,14 @@ static uint32 ComputeBlurWeights(int32 kernelSize, float sigma, Float4* outWeigh
     return numSamples;
 }
 
-void DrawBatch(int32 startIndex, int32 count)
+void DrawBatch(const Render2DBatch& batch)
 {
-    const Render2DDrawCall& d = DrawCalls[startIndex];
+    const Render2DDrawCall& d = DrawCalls[batch.Start];
     GPUBuffer* vb = VB.GetBuffer();
     GPUBuffer* ib = IB.GetBuffer();
     uint32 countIb = 0;
-    for (int32 i = 0; i < count; i++)
-        countIb += DrawCalls[startIndex + i].CountIB;
+    for (int32 i = 0; i < batch.Count; i++)
+        countIb += DrawCalls[batch.Start + i].CountIB;
 
     if (d.Type == DrawCallType::ClipScissors)
     {
@@ -970,17 +1259,25 @@ void DrawBatch(int32 startIndex, int32 count)
         Context->SetState(CurrentPso->PS_Image);
         break;
     case DrawCallType::FillTexture:
-        Context->BindSR(0, d.AsTexture.Ptr);
+        for (int32 i = 0; i < batch.TexturesCount; i++)
+            Context->BindSR(i, batch.Textures[i]);
         Context->SetState(CurrentPso->PS_Image);
         break;
     case DrawCallType::FillTexturePoint:
-        Context->BindSR(0, d.AsTexture.Ptr);
+        for (int32 i = 0; i < batch.TexturesCount; i++)
+            Context->BindSR(i, batch.Textures[i]);
         Context->SetState(CurrentPso->PS_ImagePoint);
         break;
     case DrawCallType::DrawChar:
-        Context->BindSR(0, d.AsChar.Tex);
+        for (int32 i = 0; i < batch.TexturesCount; i++)
+            Context->BindSR(i, batch.Textures[i]);
         Context->SetState(CurrentPso->PS_Font);
         break;
+    case DrawCallType::DrawCharSDF:
+        for (int32 i = 0; i < batch.TexturesCount; i++)
+            Context->BindSR(i, batch.Textures[i]);
+        Context->SetState(CurrentPso->PS_FontSDF);
+        break;
     case DrawCallType::DrawCharMaterial:
     {
         // Apply and bind material
@@ -1227,12 +1524,14 @@ void Render2D::DrawText(Font* font, const StringView& text, const Color& color,
                 const float x = pointer.X + entry.OffsetX * scale;
                 const float y = pointer.Y + (font->GetHeight() + font->GetDescender() - entry.OffsetY) * scale;
 
-                Rectangle charRect(x, y, entry.UVSize.X * scale, entry.UVSize.Y * scale);
+                Rectangle charRect(x, y, entry.UVSize.X * entry.Scale * scale, entry.UVSize.Y * entry.Scale * scale);
 
                 Float2 upperLeftUV = entry.UV * invAtlasSize;
                 Float2 rightBottomUV = (entry.UV + entry.UVSize) * invAtlasSize;
 
                 // Add draw call
+                if (!customMaterial)
+                    drawCall.Type = entry.IsSDF ? DrawCallType::DrawCharSDF : DrawCallType::DrawChar;
                 drawCall.StartIB = IBIndex;
                 drawCall.CountIB = 6;
                 DrawCalls.Add(drawCall);
@@ -1349,13 +1648,15 @@ void Render2D::DrawText(Font* font, const StringView& text, const Color& color,
                     const float x = pointer.X + entry.OffsetX * scale;
                     const float y = pointer.Y - entry.OffsetY * scale + Math::Ceil((font->GetHeight() + font->GetDescender()) * scale);
 
-                    Rectangle charRect(x, y, entry.UVSize.X * scale, entry.UVSize.Y * scale);
+                    Rectangle charRect(x, y, entry.UVSize.X * entry.Scale * scale, entry.UVSize.Y * entry.Scale * scale);
                     charRect.Offset(layout.Bounds.Location);
 
                     Float2 upperLeftUV = entry.UV * invAtlasSize;
                     Float2 rightBottomUV = (entry.UV + entry.UVSize) * invAtlasSize;
 
                     // Add draw call
+                    if (!customMaterial)
+                        drawCall.Type = entry.IsSDF ? DrawCallType::DrawCharSDF : DrawCallType::DrawChar;
                     drawCall.StartIB = IBIndex;
                     drawCall.CountIB = 6;
                     DrawCalls.Add(drawCall);
@@ -22,6 +22,7 @@ class GPUContext;
 class RenderTask;
 class MaterialBase;
 class TextureBase;
+class Render2DCache;
 
 /// <summary>
 /// Rendering 2D shapes and text using Graphics Device.
@@ -177,6 +178,26 @@ API_CLASS(Static) class FLAXENGINE_API Render2D
     /// </summary>
     API_FUNCTION() static void PopTint();
 
+public:
+    /// <summary>
+    /// Begins recording the drawn geometry into the retained cache. Recorded content is drawn normally. Nested recording is not supported (inner caches are skipped and their geometry becomes a part of the outer cache).
+    /// </summary>
+    /// <param name="cache">The cache to record.</param>
+    API_FUNCTION() static void BeginCache(Render2DCache* cache);
+
+    /// <summary>
+    /// Ends recording the drawn geometry into the retained cache.
+    /// </summary>
+    /// <param name="cache">The cache to record (the same as used for <see cref="BeginCache"/>).</param>
+    API_FUNCTION() static void EndCache(Render2DCache* cache);
+
+    /// <summary>
+    /// Draws the geometry recorded in the retained cache using the current transformation and clipping.
+    /// </summary>
+    /// <param name="cache">The recorded cache.</param>
+    /// <returns>True if cache has been drawn, otherwise false if it's invalid (or recorded with a different tint or rendering features) and content needs to be drawn (and recorded) again.</returns>
+    API_FUNCTION() static bool TryDrawCache(Render2DCache* cache);
+
 public:
     /// <summary>
     /// Draws a text.
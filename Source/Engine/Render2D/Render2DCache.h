@@ -0,0 +1,59 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "RotatedRectangle.h"
+#include "Engine/Core/Math/Color.h"
+#include "Engine/Core/Math/Matrix3x3.h"
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Scripting/ScriptingObject.h"
+
+class GPUTexture;
+
+/// <summary>
+/// Retained 2D geometry recorded by Render2D (vertices and draw calls) that can be replayed in the following frames with a different transformation without drawing the content again. Used to cache the static GUI subtrees.
+/// </summary>
+/// <remarks>
+/// Cache is recorded with <see cref="Render2D.BeginCache"/> and <see cref="Render2D.EndCache"/> and replayed with <see cref="Render2D.TryDrawCache"/>. Geometry that uses materials, render targets or blur is not cached. Call <see cref="Invalidate"/> when the cached content changes.
+/// </remarks>
+API_CLASS(Sealed) class FLAXENGINE_API Render2DCache : public ScriptingObject
+{
+    DECLARE_SCRIPTING_TYPE(Render2DCache);
+    friend class Render2D;
+    ~Render2DCache();
+
+private:
+    bool _isValid = false;
+    Array<byte> _vertices; // Render2DVertex
+    Array<uint32> _indices; // Relative to the first recorded vertex
+    Array<byte> _drawCalls; // Render2DDrawCall (start index relative to the first recorded index)
+    Array<GPUTexture*> _textures;
+    Matrix3x3 _invTransform; // Inverse of the transformation used during recording
+    RotatedRectangle _clipMask; // Clip mask of the parent content used during recording
+    Rectangle _clipBounds;
+    Color _tint;
+    int32 _features;
+    bool _hasScissors;
+
+public:
+    /// <summary>
+    /// Gets a value indicating whether the cache contains recorded geometry that can be replayed.
+    /// </summary>
+    API_PROPERTY() FORCE_INLINE bool IsValid() const
+    {
+        return _isValid;
+    }
+
+    /// <summary>
+    /// Gets the amount of the recorded vertices.
+    /// </summary>
+    API_PROPERTY() int32 GetVerticesCount() const;
+
+    /// <summary>
+    /// Clears the recorded geometry. The cache needs to be recorded again before replaying it.
+    /// </summary>
+    API_FUNCTION() void Invalidate();
+
+private:
+    void OnTextureDeleted(ScriptingObject* obj);
+};
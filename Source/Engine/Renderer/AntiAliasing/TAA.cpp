@@ -94,11 +94,22 @@ void TAA::Render(const RenderContext& renderContext, GPUTexture* input, GPUTextu
     }
     else if (renderContext.Buffers->TemporalAA->Width() != tempDesc.Width || renderContext.Buffers->TemporalAA->Height() != tempDesc.Height)
     {
-        // Wrong size temporal buffer
-        RenderTargetPool::Release(renderContext.Buffers->TemporalAA);
+        // Wrong size temporal buffer (eg. dynamic resolution change) so rescale the history to keep the accumulated samples
+        const auto prevHistory = renderContext.Buffers->TemporalAA;
         renderContext.Buffers->TemporalAA = RenderTargetPool::Get(tempDesc);
         RENDER_TARGET_POOL_SET_NAME(renderContext.Buffers->TemporalAA, "TemporalAA");
-        resetHistory = true;
+        if (!resetHistory && prevHistory->Format() == tempDesc.Format)
+        {
+            context->SetRenderTarget(renderContext.Buffers->TemporalAA->View());
+            context->SetViewportAndScissors((float)tempDesc.Width, (float)tempDesc.Height);
+            context->Draw(prevHistory);
+            context->ResetRenderTarget();
+        }
+        else
+        {
+            resetHistory = true;
+        }
+        RenderTargetPool::Release(prevHistory);
     }
     auto inputHistory = renderContext.Buffers->TemporalAA;
     const auto outputHistory = RenderTargetPool::Get(tempDesc);
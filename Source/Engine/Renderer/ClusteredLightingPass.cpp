@@ -0,0 +1,184 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "ClusteredLightingPass.h"
+#include "RenderList.h"
+#include "Engine/Content/Content.h"
+#include "Engine/Engine/Engine.h"
+#include "Engine/Graphics/DynamicBuffer.h"
+#include "Engine/Graphics/GPUContext.h"
+#include "Engine/Graphics/GPUDevice.h"
+#include "Engine/Graphics/GPULimits.h"
+#include "Engine/Graphics/RenderTask.h"
+#include "Engine/Graphics/RenderBuffers.h"
+#include "Engine/Graphics/Shaders/GPUShader.h"
+
+// This must match HLSL
+#define CLUSTERED_LIGHTING_TILE_SIZE 64 // Size of the cluster tile on a screen (in pixels)
+#define CLUSTERED_LIGHTING_DEPTH_SLICES 32 // Amount of the depth slices (distributed logarithmically between view near and far planes)
+#define CLUSTERED_LIGHTING_MAX_LIGHTS 32 // Maximum amount of lights per cluster
+#define CLUSTERED_LIGHTING_GROUP_SIZE 4
+
+PACK_STRUCT(struct Data {
+    ClusteredLightingPass::ConstantsData ClusteredLighting;
+    Matrix ViewMatrix;
+    Matrix InvProjectionMatrix;
+    });
+
+// Custom render buffer for the clustered lights grid of the view.
+class ClusteredLightingCustomBuffer : public RenderBuffers::CustomBuffer
+{
+public:
+    DynamicStructuredBuffer Lights;
+    GPUBuffer* Clusters = nullptr;
+    ClusteredLightingPass::BindingData Result;
+
+    ClusteredLightingCustomBuffer()
+        : Lights(0, sizeof(LightData), false, TEXT("ClusteredLighting.Lights"))
+    {
+    }
+
+    ~ClusteredLightingCustomBuffer()
+    {
+        SAFE_DELETE_GPU_RESOURCE(Clusters);
+    }
+};
+
+String ClusteredLightingPass::ToString() const
+{
+    return TEXT("ClusteredLightingPass");
+}
+
+bool ClusteredLightingPass::Init()
+{
+    // Check platform support
+    const auto device = GPUDevice::Instance;
+    _supported = device->GetFeatureLevel() >= FeatureLevel::SM5 && device->Limits.HasCompute;
+    return false;
+}
+
+bool ClusteredLightingPass::setupResources()
+{
+    if (!_supported)
+        return true;
+
+    // Load shader
+    if (!_shader)
+    {
+        _shader = Content::LoadAsyncInternal<Shader>(TEXT("Shaders/ClusteredLighting"));
+        if (_shader == nullptr)
+            return true;
+#if COMPILE_WITH_DEV_ENV
+        _shader.Get()->OnReloading.Bind<ClusteredLightingPass, &ClusteredLightingPass::OnShaderReloading>(this);
+#endif
+    }
+    if (!_shader->IsLoaded())
+        return true;
+    const auto shader = _shader->GetShader();
+
+    // Validate shader constant buffer size
+    _cb = shader->GetCB(0);
+    if (_cb->GetSize() != sizeof(Data))
+    {
+        REPORT_INVALID_SHADER_PASS_CB_SIZE(shader, 0, Data);
+        return true;
+    }
+
+    // Cache compute shaders
+    _csBuild = shader->GetCS("CS_Build");
+
+    return false;
+}
+
+void ClusteredLightingPass::Dispose()
+{
+    // Base
+    RendererPass::Dispose();
+
+    // Cleanup
+    _cb = nullptr;
+    _csBuild = nullptr;
+    _shader = nullptr;
+}
+
+bool ClusteredLightingPass::Get(const RenderBuffers* buffers, BindingData& result)
+{
+    auto* clusteredData = buffers ? buffers->FindCustomBuffer<ClusteredLightingCustomBuffer>(TEXT("ClusteredLighting")) : nullptr;
+    if (clusteredData && clusteredData->LastFrameUsed == Engine::FrameCount) // Lights data is relative to the view so use only the current frame
+    {
+        result = clusteredData->Result;
+        return false;
+    }
+    return true;
+}
+
+void ClusteredLightingPass::Render(RenderContext& renderContext, GPUContext* context)
+{
+    if (checkIfSkipPass())
+        return;
+    PROFILE_GPU_CPU("Clustered Lighting");
+    auto& view = renderContext.View;
+    auto& clusteredData = *renderContext.Buffers->GetCustomBuffer<ClusteredLightingCustomBuffer>(TEXT("ClusteredLighting"));
+    clusteredData.LastFrameUsed = Engine::FrameCount;
+
+    // Setup the grid (screen tiles split into the logarithmic depth slices)
+    const int32 width = renderContext.Buffers->GetWidth();
+    const int32 height = renderContext.Buffers->GetHeight();
+    const uint32 gridSize[3] = { (uint32)Math::DivideAndRoundUp(width, CLUSTERED_LIGHTING_TILE_SIZE), (uint32)Math::DivideAndRoundUp(height, CLUSTERED_LIGHTING_TILE_SIZE), CLUSTERED_LIGHTING_DEPTH_SLICES };
+    const float nearPlane = Math::Max(view.Near, 1.0f);
+    const float farPlane = Math::Max(view.Far, nearPlane + 1.0f);
+    auto& constants = clusteredData.Result.Constants;
+    constants.UVToCluster = Float2((float)width, (float)height) / (float)CLUSTERED_LIGHTING_TILE_SIZE;
+    constants.DepthSliceScale = (float)CLUSTERED_LIGHTING_DEPTH_SLICES / Math::Log2(farPlane / nearPlane);
+    constants.DepthSliceBias = -Math::Log2(nearPlane) * constants.DepthSliceScale;
+    Platform::MemoryCopy(constants.GridSize, gridSize, sizeof(gridSize));
+
+    // Upload the local lights (unused LightData.Dummy0 holds the volumetric fog scattering intensity, zero if light has been already injected into the fog with shadow)
+    auto& lights = clusteredData.Lights;
+    lights.Clear();
+    for (const auto& light : renderContext.List->PointLights)
+    {
+        auto data = lights.WriteReserve<LightData>(1);
+        light.SetupLightData(data, false);
+        data->Dummy0 = light.RenderedVolumetricFog ? 0.0f : light.VolumetricScatteringIntensity;
+    }
+    for (const auto& light : renderContext.List->SpotLights)
+    {
+        auto data = lights.WriteReserve<LightData>(1);
+        light.SetupLightData(data, false);
+        data->Dummy0 = light.RenderedVolumetricFog ? 0.0f : light.VolumetricScatteringIntensity;
+    }
+    constants.LightsCount = lights.Data.Count() / sizeof(LightData);
+    clusteredData.Result.Lights = nullptr;
+    clusteredData.Result.Clusters = nullptr;
+    if (constants.LightsCount == 0)
+        return;
+    lights.Flush(context);
+
+    // Allocate clusters buffer (per-cluster lights count followed by the light indices)
+    const uint32 clustersSize = gridSize[0] * gridSize[1] * gridSize[2] * (CLUSTERED_LIGHTING_MAX_LIGHTS + 1) * sizeof(uint32);
+    if (!clusteredData.Clusters)
+        clusteredData.Clusters = GPUDevice::Instance->CreateBuffer(TEXT("ClusteredLighting.Clusters"));
+    if (clusteredData.Clusters->GetSize() != clustersSize)
+    {
+        const auto desc = GPUBufferDescription::Buffer(clustersSize, GPUBufferFlags::ShaderResource | GPUBufferFlags::UnorderedAccess, PixelFormat::R32_UInt, nullptr, sizeof(uint32));
+        if (clusteredData.Clusters->Init(desc))
+            return;
+    }
+
+    // Cull lights against each cluster
+    Data data;
+    data.ClusteredLighting = constants;
+    Matrix::Transpose(view.View, data.ViewMatrix);
+    Matrix invProjection;
+    Matrix::Invert(view.Projection, invProjection);
+    Matrix::Transpose(invProjection, data.InvProjectionMatrix);
+    context->UpdateCB(_cb, &data);
+    context->BindCB(0, _cb);
+    context->BindSR(0, lights.GetBuffer()->View());
+    context->BindUA(0, clusteredData.Clusters->View());
+    context->Dispatch(_csBuild, Math::DivideAndRoundUp(gridSize[0], (uint32)CLUSTERED_LIGHTING_GROUP_SIZE), Math::DivideAndRoundUp(gridSize[1], (uint32)CLUSTERED_LIGHTING_GROUP_SIZE), Math::DivideAndRoundUp(gridSize[2], (uint32)CLUSTERED_LIGHTING_GROUP_SIZE));
+    context->ResetUA();
+    context->ResetSR();
+    clusteredData.Result.Lights = lights.GetBuffer()->View();
+    clusteredData.Result.Clusters = clusteredData.Clusters->View();
+}
@@ -0,0 +1,71 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "RendererPass.h"
+#include "Engine/Core/Math/Vector2.h"
+#include "Engine/Graphics/GPUBuffer.h"
+
+/// <summary>
+/// Clustered lighting rendering service. Builds the view-space grid of froxels (screen tiles split into depth slices) with the list of local lights (point and spot) affecting each cluster. Used by the forward shading (transparent surfaces and particles) and volumetric fog to iterate only over the relevant lights instead of searching them on a CPU per draw call.
+/// </summary>
+class ClusteredLightingPass : public RendererPass<ClusteredLightingPass>
+{
+public:
+    // Constant buffer data for clustered lighting access on a GPU.
+    PACK_STRUCT(struct ConstantsData
+        {
+        Float2 UVToCluster;
+        float DepthSliceScale;
+        float DepthSliceBias;
+        uint32 GridSize[3];
+        uint32 LightsCount;
+        });
+
+    // Binding data for the GPU.
+    struct BindingData
+    {
+        ConstantsData Constants;
+        GPUBufferView* Lights;
+        GPUBufferView* Clusters;
+    };
+
+private:
+    bool _supported = false;
+    AssetReference<Shader> _shader;
+    GPUConstantBuffer* _cb = nullptr;
+    GPUShaderProgramCS* _csBuild = nullptr;
+
+public:
+    /// <summary>
+    /// Gets the clustered lighting data for the current frame (if built).
+    /// </summary>
+    /// <param name="buffers">The rendering context buffers.</param>
+    /// <param name="result">The result clustered lighting data for binding to the shaders.</param>
+    /// <returns>True if there is no valid clustered lighting (eg. not supported on a platform), otherwise false.</returns>
+    bool Get(const RenderBuffers* buffers, BindingData& result);
+
+    /// <summary>
+    /// Builds the clustered lights grid for the view. Called after the shadows rendering and before volumetric fog and forward pass.
+    /// </summary>
+    /// <param name="renderContext">The rendering context.</param>
+    /// <param name="context">The GPU context.</param>
+    void Render(RenderContext& renderContext, GPUContext* context);
+
+public:
+    // [RendererPass]
+    String ToString() const override;
+    bool Init() override;
+    void Dispose() override;
+#if COMPILE_WITH_DEV_ENV
+    void OnShaderReloading(Asset* obj)
+    {
+        _csBuild = nullptr;
+        invalidateResources();
+    }
+#endif
+
+protected:
+    // [RendererPass]
+    bool setupResources() override;
+};
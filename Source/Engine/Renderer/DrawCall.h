@@ -5,10 +5,14 @@
 #include "Config.h"
 #include "Engine/Core/Math/Rectangle.h"
 #include "Engine/Core/Math/Color.h"
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Graphics/Models/Config.h"
+#include "Engine/Level/Types.h"
 
 struct RenderView;
 struct RenderContext;
 struct DrawCall;
+struct PositionsQuantization;
 class IMaterial;
 class RenderTask;
 class SceneRenderTask;
@@ -139,6 +143,16 @@ struct DrawCall
         /// The geometry vertex buffers byte offsets.
         /// </summary>
         uint32 VertexBuffersOffsets[3];
+
+        /// <summary>
+        /// The geometry triangle clusters buffer (structured buffer with Meshlet elements) used for GPU culling of the parts of the geometry. Optional, can be null.
+        /// </summary>
+        GPUBuffer* Meshlets;
+
+        /// <summary>
+        /// The geometry positions quantization (vertex buffer 0 uses VB0QuantizedElementType layout). Optional, null if positions are not quantized.
+        /// </summary>
+        const PositionsQuantization* Quantization;
     } Geometry;
 
     /// <summary>
@@ -204,6 +218,7 @@ struct DrawCall
             float CurrentLOD;
             float ChunkSizeNextLOD;
             float TerrainChunkSizeLOD0;
+            int32 CachePage; // Index of the terrain material cache page to sample (-1 if unused)
             const class TerrainPatch* Patch;
         } Terrain;
 
@@ -233,15 +248,21 @@ struct DrawCall
 
         struct
         {
-            GPUBuffer* SplineDeformation;
+            GPUBuffer* SplineDeformation; // Buffer with the Bezier curve control points of the spline segments.
             Matrix LocalMatrix; // Geometry transformation applied before deformation.
             Float3 GeometrySize; // Object geometry size in the world (unscaled).
             float Segment;
-            float ChunksPerSegment;
             float MeshMinZ;
             float MeshMaxZ;
         } Deformable;
 
+        struct
+        {
+            GPUBuffer* Instances; // Structured buffer with the per-decal data of all decals drawn in this frame (see DecalInstance in Decal material template).
+            uint32 InstanceOffset; // The index of the first decal instance in the batch.
+            bool IsCameraInside; // True if camera is inside the decals volumes (draws back faces).
+        } DecalBatch;
+
         struct
         {
             byte Raw[96];
@@ -327,6 +348,77 @@ struct TIsPODType<GeometryDrawStateData>
     enum { Value = true };
 };
 
+/// <summary>
+/// Retained draw calls cache for static geometry instances. Mesh draw calls are built once and reused across frames (only culled and added to the render lists) until invalidated by the instance changes.
+/// </summary>
+struct MeshDrawCache
+{
+    /// <summary>
+    /// The cached mesh draw call.
+    /// </summary>
+    struct Entry
+    {
+        // The draw call (per-frame data such as previous world matrix and LOD dither factor is updated before adding it to the render list).
+        DrawCall Call;
+        // The precomputed batching key of the draw call.
+        uint16 BatchKey;
+        // The source data used to build the draw call (compared on use to detect changes such as material change or mesh streaming).
+        const void* EntryMaterial;
+        const void* SlotMaterial;
+        const GPUBuffer* IndexBuffer;
+        const GPUBuffer* VertexBuffers[3];
+    };
+
+    /// <summary>
+    /// The view origin used to build the cached world matrices.
+    /// </summary>
+    Vector3 Origin = Vector3::Zero;
+
+    /// <summary>
+    /// The instance static flags used to build the cached draw calls.
+    /// </summary>
+    StaticFlags Flags = StaticFlags::None;
+
+    /// <summary>
+    /// The lightmap used to build the cached draw calls.
+    /// </summary>
+    const void* Lightmap = nullptr;
+
+    /// <summary>
+    /// The lightmap UVs area used to build the cached draw calls.
+    /// </summary>
+    Rectangle LightmapUVs = Rectangle::Empty;
+
+    /// <summary>
+    /// The cached draw calls per model LOD (indexed by the mesh index). Empty for not-yet-drawn LODs.
+    /// </summary>
+    Array<Entry> LODs[MODEL_MAX_LODS];
+
+    /// <summary>
+    /// Invalidates the cached draw calls (eg. on transform or model change).
+    /// </summary>
+    void Clear()
+    {
+        for (auto& e : LODs)
+            e.Clear();
+    }
+
+    /// <summary>
+    /// Prepares the cache for drawing with the given instance data. Invalidates cached draw calls if any of the shared data has changed.
+    /// </summary>
+    void Prepare(const Vector3& origin, StaticFlags flags, const void* lightmap, const Rectangle& lightmapUVs)
+    {
+        if (Origin != origin || Flags != flags || Lightmap != lightmap || LightmapUVs != lightmapUVs)
+        {
+            Clear();
+            Origin = origin;
+            Flags = flags;
+            Lightmap = lightmap;
+            LightmapUVs = lightmapUVs;
+        }
+    }
+};
+
 #define GEOMETRY_DRAW_STATE_EVENT_BEGIN(drawState, worldMatrix) \
     const auto frame = Engine::FrameCount; \
 	if (drawState.PrevFrame + 1 < frame && !renderContext.View.IsSingleFrame) \
@@ -17,6 +17,7 @@
 #include "Engine/Graphics/RenderBuffers.h"
 #include "Engine/Renderer/DrawCall.h"
 #include "Engine/Renderer/RenderList.h"
+#include "Engine/Renderer/GBufferPass.h"
 #include "Engine/Renderer/Lightmaps.h"
 
 const MaterialInfo& MaterialComplexityMaterialShader::WrapperShader::GetInfo() const
@@ -126,21 +127,19 @@ void MaterialComplexityMaterialShader::Draw(RenderContext& renderContext, GPUCon
     if (decals.HasItems() && boxModel && boxModel->CanBeRendered() && decalsWrapper.IsReady())
     {
         PROFILE_GPU_CPU_NAMED("Decals");
+        Array<bool, RendererAllocation> isCameraInside;
         DrawCall drawCall;
         MaterialBase::BindParameters bindParams(context, renderContext, drawCall);
         bindParams.BindViewData();
         drawCall.WorldDeterminantSign = 1.0f;
+        drawCall.DecalBatch.Instances = GBufferPass::Instance()->UploadDecals(renderContext, context, &isCameraInside);
         context->SetRenderTarget(lightBuffer);
         for (int32 i = 0; i < decals.Count(); i++)
         {
             const auto decal = decals[i];
-            ASSERT(decal && decal->Material);
-            Transform transform = decal->GetTransform();
-            transform.Scale *= decal->GetSize();
-            renderContext.View.GetWorldMatrix(transform, drawCall.World);
-            drawCall.ObjectPosition = drawCall.World.GetTranslation();
             drawCall.Material = decal->Material;
-            drawCall.PerInstanceRandom = decal->GetPerInstanceRandom();
+            drawCall.DecalBatch.InstanceOffset = (uint32)i;
+            drawCall.DecalBatch.IsCameraInside = isCameraInside[i];
             decalsWrapper.Bind(bindParams);
             boxModel->Render(context);
         }
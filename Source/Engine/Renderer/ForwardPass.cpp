@@ -2,6 +2,7 @@
 
 #include "ForwardPass.h"
 #include "RenderList.h"
+#include "VariableRateShadingPass.h"
 #include "Engine/Core/Collections/Sorting.h"
 #include "Engine/Content/Assets/Model.h"
 #include "Engine/Content/Assets/Shader.h"
@@ -135,9 +136,16 @@ void ForwardPass::Render(RenderContext& renderContext, GPUTexture* input, GPUTex
 
     if (!forwardList.IsEmpty())
     {
+        // Use variable rate shading (if enabled)
+        GPUTexture* shadingRateImage = VariableRateShadingPass::Instance()->Get(renderContext.Buffers);
+        context->SetShadingRateImage(shadingRateImage);
+
         // Run forward pass
         view.Pass = DrawPass::Forward;
         context->SetRenderTarget(depthBufferHandle, output->View());
         mainCache->ExecuteDrawCalls(renderContext, forwardList, input->View());
+
+        if (shadingRateImage)
+            context->SetShadingRateImage(nullptr);
     }
 }
@@ -2,6 +2,7 @@
 
 #include "GBufferPass.h"
 #include "RenderList.h"
+#include "VariableRateShadingPass.h"
 #if USE_EDITOR
 #include "Engine/Renderer/Editor/VertexColors.h"
 #include "Engine/Renderer/Editor/LightmapUVsDensity.h"
@@ -9,8 +10,11 @@
 #include "Engine/Renderer/Editor/MaterialComplexity.h"
 #endif
 #include "Engine/Core/Collections/Sorting.h"
+#include "Engine/Core/Math/Matrix3x4.h"
+#include "Engine/Core/Math/OrientedBoundingBox.h"
 #include "Engine/Graphics/GPUDevice.h"
 #include "Engine/Graphics/GPUContext.h"
+#include "Engine/Graphics/DynamicBuffer.h"
 #include "Engine/Graphics/Shaders/GPUShader.h"
 #include "Engine/Graphics/RenderTask.h"
 #include "Engine/Graphics/RenderBuffers.h"
@@ -27,6 +31,13 @@ PACK_STRUCT(struct GBufferPassData{
     int32 ViewMode;
     });
 
+// Per-decal data for the instanced decals drawing (see DecalInstance in Decal material template)
+PACK_STRUCT(struct DecalInstanceData {
+    Matrix3x4 World;
+    Matrix3x4 InvWorld;
+    Float4 Data;
+    });
+
 #if USE_EDITOR
 Dictionary<GPUBuffer*, const ModelLOD*> GBufferPass::IndexBufferToModelLOD;
 CriticalSection GBufferPass::Locker;
@@ -94,6 +105,7 @@ void GBufferPass::Dispose()
 
     // Cleanup
     SAFE_DELETE_GPU_RESOURCE(_psDebug);
+    SAFE_DELETE(_decalsBuffer);
     _gBufferShader = nullptr;
     _skyModel = nullptr;
     _boxModel = nullptr;
@@ -203,6 +215,10 @@ void GBufferPass::Fill(RenderContext& renderContext, GPUTexture* lightBuffer)
     }
 #endif
 
+    // Use variable rate shading (if enabled)
+    GPUTexture* shadingRateImage = VariableRateShadingPass::Instance()->Get(renderContext.Buffers);
+    context->SetShadingRateImage(shadingRateImage);
+
     // Draw objects that can get decals
     context->SetRenderTarget(*renderContext.Buffers->DepthBuffer, ToSpan(targetBuffers, ARRAY_COUNT(targetBuffers)));
     renderContext.List->ExecuteDrawCalls(renderContext, DrawCallsListType::GBuffer);
@@ -222,15 +238,24 @@ void GBufferPass::Fill(RenderContext& renderContext, GPUTexture* lightBuffer)
     {
         PROFILE_GPU_CPU_NAMED("Sky");
         context->SetRenderTarget(*renderContext.Buffers->DepthBuffer, ToSpan(targetBuffers, ARRAY_COUNT(targetBuffers)));
+        if (shadingRateImage)
+            context->SetShadingRate(ShadingRate::Rate2x2);
         DrawSky(renderContext, context);
+        if (shadingRateImage)
+            context->SetShadingRate(ShadingRate::Rate1x1);
     }
 
+    if (shadingRateImage)
+        context->SetShadingRateImage(nullptr);
     context->ResetRenderTarget();
 }
 
 bool SortDecal(Decal* const& a, Decal* const& b)
 {
-    return a->SortOrder < b->SortOrder;
+    // Sort by the order and then by material to batch decals that use the same material
+    if (a->SortOrder != b->SortOrder)
+        return a->SortOrder < b->SortOrder;
+    return a->Material.Get() < b->Material.Get();
 }
 
 void GBufferPass::RenderDebug(RenderContext& renderContext)
@@ -426,6 +451,35 @@ void GBufferPass::DrawSky(RenderContext& renderContext, GPUContext* context)
     model->Render(context);
 }
 
+GPUBuffer* GBufferPass::UploadDecals(RenderContext& renderContext, GPUContext* context, Array<bool, RendererAllocation>* isCameraInside)
+{
+    auto& decals = renderContext.List->Decals;
+    if (!_decalsBuffer)
+        _decalsBuffer = New<DynamicStructuredBuffer>(64u * (uint32)sizeof(DecalInstanceData), (uint32)sizeof(DecalInstanceData), false, TEXT("GBufferPass.Decals"));
+    _decalsBuffer->Clear();
+    auto instances = _decalsBuffer->WriteReserve<DecalInstanceData>(decals.Count());
+    if (isCameraInside)
+        isCameraInside->Resize(decals.Count());
+    for (int32 i = 0; i < decals.Count(); i++)
+    {
+        const auto decal = decals[i];
+        ASSERT(decal && decal->Material);
+        Transform transform = decal->GetTransform();
+        transform.Scale *= decal->GetSize();
+        Matrix world, invWorld;
+        renderContext.View.GetWorldMatrix(transform, world);
+        Matrix::Invert(world, invWorld);
+        auto& instance = instances[i];
+        instance.World.SetMatrixTranspose(world);
+        instance.InvWorld.SetMatrixTranspose(invWorld);
+        instance.Data = Float4(decal->GetPerInstanceRandom(), 0.0f, 0.0f, 0.0f);
+        if (isCameraInside)
+            isCameraInside->Get()[i] = OrientedBoundingBox(Vector3::Half, world).Contains(renderContext.View.Position) == ContainmentType::Contains;
+    }
+    _decalsBuffer->Flush(context);
+    return _decalsBuffer->GetBuffer();
+}
+
 void GBufferPass::DrawDecals(RenderContext& renderContext, GPUTextureView* lightBuffer)
 {
     // Skip if no decals to render
@@ -441,12 +495,12 @@ void GBufferPass::DrawDecals(RenderContext& renderContext, GPUTextureView* light
     auto model = _boxModel.Get();
     auto buffers = renderContext.Buffers;
 
-    // Sort decals from the lowest order to the highest order
+    // Sort decals from the lowest order to the highest order (decals with the same order are grouped by material)
     Sorting::QuickSort(decals.Get(), (int32)decals.Count(), &SortDecal);
 
-    // TODO: batch decals using the same material
-
-    // TODO: sort decals by the blending mode within the same order
+    // Upload the per-decal data for all decals at once
+    Array<bool, RendererAllocation> isCameraInside;
+    GPUBuffer* decalsBuffer = UploadDecals(renderContext, context, &isCameraInside);
 
     // Prepare
     DrawCall drawCall;
@@ -454,47 +508,48 @@ void GBufferPass::DrawDecals(RenderContext& renderContext, GPUTextureView* light
     bindParams.BindViewData();
     drawCall.Material = nullptr;
     drawCall.WorldDeterminantSign = 1.0f;
+    drawCall.DecalBatch.Instances = decalsBuffer;
 
-    // Draw all decals
-    for (int32 i = 0; i < decals.Count(); i++)
+    // Draw decals in batches (subsequent decals using the same material are drawn with a single instanced draw call)
+    for (int32 i = 0; i < decals.Count();)
     {
-        const auto decal = decals[i];
-        ASSERT(decal && decal->Material);
-        Transform transform = decal->GetTransform();
-        transform.Scale *= decal->GetSize();
-        renderContext.View.GetWorldMatrix(transform, drawCall.World);
-        drawCall.ObjectPosition = drawCall.World.GetTranslation();
-        drawCall.ObjectRadius = (float)decal->GetSphere().Radius;
+        MaterialBase* material = decals[i]->Material.Get();
+        int32 count = 1;
+        while (i + count < decals.Count() && decals[i + count]->Material.Get() == material && isCameraInside[i + count] == isCameraInside[i])
+            count++;
+        drawCall.DecalBatch.InstanceOffset = (uint32)i;
+        drawCall.DecalBatch.IsCameraInside = isCameraInside[i];
+        drawCall.InstanceCount = count;
 
         context->ResetRenderTarget();
 
         // Bind output
-        const MaterialInfo& info = decal->Material->GetInfo();
+        const MaterialInfo& info = material->GetInfo();
         switch (info.DecalBlendingMode)
         {
         case MaterialDecalBlendingMode::Translucent:
         {
             GPUTextureView* targetBuffers[4];
-            int32 count = 2;
+            int32 targetsCount = 2;
             targetBuffers[0] = buffers->GBuffer0->View();
             targetBuffers[1] = buffers->GBuffer2->View();
             if (EnumHasAnyFlags(info.UsageFlags, MaterialUsageFlags::UseEmissive))
             {
-                count++;
+                targetsCount++;
                 targetBuffers[2] = lightBuffer;
 
                 if (EnumHasAnyFlags(info.UsageFlags, MaterialUsageFlags::UseNormal))
                 {
-                    count++;
+                    targetsCount++;
                     targetBuffers[3] = buffers->GBuffer1->View();
                 }
             }
             else if (EnumHasAnyFlags(info.UsageFlags, MaterialUsageFlags::UseNormal))
             {
-                count++;
+                targetsCount++;
                 targetBuffers[2] = buffers->GBuffer1->View();
             }
-            context->SetRenderTarget(nullptr, ToSpan(targetBuffers, count));
+            context->SetRenderTarget(nullptr, ToSpan(targetBuffers, targetsCount));
             break;
         }
         case MaterialDecalBlendingMode::Stain:
@@ -514,10 +569,10 @@ void GBufferPass::DrawDecals(RenderContext& renderContext, GPUTextureView* light
         }
         }
 
-        // Draw decal
-        drawCall.PerInstanceRandom = decal->GetPerInstanceRandom();
-        decal->Material->Bind(bindParams);
-        model->Render(context);
+        // Draw decals batch
+        material->Bind(bindParams);
+        model->Render(context, 0, count);
+        i += count;
     }
 
     context->ResetSR();
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "RendererPass.h"
+#include "RendererAllocation.h"
 #if USE_EDITOR
 #include "Engine/Core/Collections/Dictionary.h"
 #endif
@@ -18,6 +19,7 @@ class GBufferPass : public RendererPass<GBufferPass>
     GPUPipelineState* _psDebug = nullptr;
     AssetReference<Model> _skyModel;
     AssetReference<Model> _boxModel;
+    class DynamicStructuredBuffer* _decalsBuffer = nullptr;
 #if USE_EDITOR
     class LightmapUVsDensityMaterialShader* _lightmapUVsDensity = nullptr;
     class VertexColorsMaterialShader* _vertexColors = nullptr;
@@ -48,6 +50,15 @@ class GBufferPass : public RendererPass<GBufferPass>
     /// <returns>Rendered cubemap or null if not ready or failed.</returns>
     GPUTextureView* RenderSkybox(RenderContext& renderContext, GPUContext* context);
 
+    /// <summary>
+    /// Uploads the per-decal data (transformation and random value) of the view decals to the GPU for the instanced decals drawing (see DrawCall::DecalBatch).
+    /// </summary>
+    /// <param name="renderContext">The rendering context.</param>
+    /// <param name="context">The GPU context.</param>
+    /// <param name="isCameraInside">The optional output flags (per decal) telling whether camera is inside the decal volume.</param>
+    /// <returns>The structured buffer with decal instances (in the order of the render list decals).</returns>
+    GPUBuffer* UploadDecals(RenderContext& renderContext, GPUContext* context, Array<bool, RendererAllocation>* isCameraInside = nullptr);
+
 #if USE_EDITOR
     // Temporary cache for faster debug previews drawing (used only during frame rendering).
     static Dictionary<GPUBuffer*, const ModelLOD*> IndexBufferToModelLOD;
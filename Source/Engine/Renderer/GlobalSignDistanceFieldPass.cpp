@@ -4,6 +4,7 @@
 #include "RenderList.h"
 #include "Engine/Core/Math/Vector3.h"
 #include "Engine/Core/Collections/HashSet.h"
+#include "Engine/Core/Collections/Sorting.h"
 #include "Engine/Engine/Engine.h"
 #include "Engine/Content/Content.h"
 #include "Engine/Graphics/GPUContext.h"
@@ -26,6 +27,7 @@
 #define GLOBAL_SDF_RASTERIZE_CHUNK_SIZE 32 // Global SDF chunk size in voxels.
 #define GLOBAL_SDF_RASTERIZE_CHUNK_MARGIN 4 // The margin in voxels around objects for culling. Reduces artifacts but reduces performance.
 #define GLOBAL_SDF_RASTERIZE_MIP_FACTOR 4 // Global SDF mip resolution downscale factor.
+#define GLOBAL_SDF_RASTERIZE_STATIC_CHUNKS_MAX_COUNT 48 // The maximum amount of static chunks to rasterize in a single cascade update (spreads the cascade initialization over multiple frames, chunks closer to the view go first).
 #define GLOBAL_SDF_MIP_GROUP_SIZE 4
 #define GLOBAL_SDF_MIP_FLOODS 5 // Amount of flood fill passes for mip.
 #define GLOBAL_SDF_DEBUG_CHUNKS 0
@@ -129,6 +131,17 @@ uint32 GetHash(const RasterizeChunkKey& key)
     return key.Hash;
 }
 
+struct StaticChunkToRasterize
+{
+    RasterizeChunkKey Key;
+    int32 Distance;
+
+    bool operator<(const StaticChunkToRasterize& other) const
+    {
+        return Distance < other.Distance;
+    }
+};
+
 struct CascadeData
 {
     Float3 Position;
@@ -136,6 +149,7 @@ struct CascadeData
     BoundingBox Bounds;
     HashSet<RasterizeChunkKey> NonEmptyChunks;
     HashSet<RasterizeChunkKey> StaticChunks;
+    bool PendingStaticChunks = false;
 
     FORCE_INLINE void OnSceneRenderingDirty(const BoundingBox& objectBounds)
     {
@@ -181,6 +195,7 @@ class GlobalSignDistanceFieldCustomBuffer : public RenderBuffers::CustomBuffer,
     HashSet<ScriptingTypeHandle> ObjectTypes;
     HashSet<GPUTexture*> SDFTextures;
     GlobalSignDistanceFieldPass::BindingData Result;
+    GPUSyncPoint AsyncComputeSyncPoint = 0;
 
     ~GlobalSignDistanceFieldCustomBuffer()
     {
@@ -259,6 +274,7 @@ namespace
 {
     Dictionary<RasterizeChunkKey, RasterizeChunk> ChunksCache;
     Array<RasterizeObject> RasterizeObjectsCache;
+    Array<StaticChunkToRasterize> StaticChunksToRasterizeCache;
     Dictionary<uint16, uint16> ObjectIndexToDataIndexCache;
 }
 
@@ -380,6 +396,12 @@ bool GlobalSignDistanceFieldPass::Render(RenderContext& renderContext, GPUContex
     const auto currentFrame = Engine::FrameCount;
     if (sdfData.LastFrameUsed == currentFrame)
     {
+        if (sdfData.AsyncComputeSyncPoint)
+        {
+            // Wait for the async compute work before using the Global SDF
+            context->WaitAsyncCompute(sdfData.AsyncComputeSyncPoint);
+            sdfData.AsyncComputeSyncPoint = 0;
+        }
         result = sdfData.Result;
         return false;
     }
@@ -505,10 +527,10 @@ bool GlobalSignDistanceFieldPass::Render(RenderContext& renderContext, GPUContex
         sdfData.FrameIndex = 0;
     for (int32 cascadeIndex = 0; cascadeIndex < cascadesCount; cascadeIndex++)
     {
-        // Reduce frequency of the updates
-        if (useCache && !RenderTools::ShouldUpdateCascade(sdfData.FrameIndex, cascadeIndex, cascadesCount, maxCascadeUpdatesPerFrame, updateEveryFrame))
-            continue;
+        // Reduce frequency of the updates (unless cascade has static chunks not rasterized yet)
         auto& cascade = sdfData.Cascades[cascadeIndex];
+        if (useCache && !cascade.PendingStaticChunks && !RenderTools::ShouldUpdateCascade(sdfData.FrameIndex, cascadeIndex, cascadesCount, maxCascadeUpdatesPerFrame, updateEveryFrame))
+            continue;
         const float cascadeDistance = distanceExtent * cascadesDistanceScales[cascadeIndex];
         const float cascadeMaxDistance = cascadeDistance * 2;
         const float cascadeVoxelSize = cascadeMaxDistance / (float)resolution;
@@ -613,6 +635,8 @@ bool GlobalSignDistanceFieldPass::Render(RenderContext& renderContext, GPUContex
             PROFILE_GPU_CPU_NAMED("Rasterize Chunks");
 
             // Update static chunks
+            auto& staticChunksToRasterize = StaticChunksToRasterizeCache;
+            staticChunksToRasterize.Clear();
             for (auto it = chunks.Begin(); it.IsNotEnd(); ++it)
             {
                 auto& e = *it;
@@ -633,9 +657,37 @@ bool GlobalSignDistanceFieldPass::Render(RenderContext& renderContext, GPUContex
                 else
                 {
                     // Add to cache (render now but skip next frame)
-                    cascade.StaticChunks.Add(e.Key);
+                    const Int3 offset = e.Key.Coord * 2 + 1 - rasterizeChunks;
+                    staticChunksToRasterize.Add({ e.Key, offset.X * offset.X + offset.Y * offset.Y + offset.Z * offset.Z });
                 }
             }
+            if (staticChunksToRasterize.Count() > GLOBAL_SDF_RASTERIZE_STATIC_CHUNKS_MAX_COUNT)
+            {
+                // Defer static chunks far from the view to the next frames to prevent GPU spikes (eg. after teleport or scene load)
+                Sorting::QuickSort(staticChunksToRasterize);
+                for (int32 i = GLOBAL_SDF_RASTERIZE_STATIC_CHUNKS_MAX_COUNT; i < staticChunksToRasterize.Count(); i++)
+                {
+                    auto key = staticChunksToRasterize.Get()[i].Key;
+                    if (cascade.NonEmptyChunks.Remove(key))
+                    {
+                        // Clear outdated chunk
+                        data.ChunkCoord = key.Coord * GLOBAL_SDF_RASTERIZE_CHUNK_SIZE;
+                        context->UpdateCB(_cb1, &data);
+                        context->Dispatch(_csClearChunk, chunkDispatchGroups, chunkDispatchGroups, chunkDispatchGroups);
+                        anyChunkDispatch = true;
+                    }
+                    while (chunks.Remove(key))
+                        key.NextLayer();
+                }
+                staticChunksToRasterize.Resize(GLOBAL_SDF_RASTERIZE_STATIC_CHUNKS_MAX_COUNT);
+                cascade.PendingStaticChunks = true;
+            }
+            else
+            {
+                cascade.PendingStaticChunks = false;
+            }
+            for (const auto& e : staticChunksToRasterize)
+                cascade.StaticChunks.Add(e.Key);
 
             // Send models data to the GPU
             const auto& objectIndexToDataIndex = ObjectIndexToDataIndexCache;
@@ -918,6 +970,30 @@ bool GlobalSignDistanceFieldPass::Render(RenderContext& renderContext, GPUContex
     return false;
 }
 
+bool GlobalSignDistanceFieldPass::CanRenderAsync() const
+{
+    return Graphics::AsyncCompute && GPUDevice::Instance->GetComputeContext() != nullptr;
+}
+
+void GlobalSignDistanceFieldPass::RenderAsync(RenderContext& renderContext, GPUContext* context)
+{
+    BindingData bindingData;
+    GPUContext* computeContext = Graphics::AsyncCompute ? GPUDevice::Instance->GetComputeContext() : nullptr;
+    if (!computeContext)
+    {
+        Render(renderContext, context, bindingData);
+        return;
+    }
+
+    // Record the compute commands (resources used by them are transitioned by the graphics context on submission)
+    computeContext->BeginParallel(context);
+    Render(renderContext, computeContext, bindingData);
+    const GPUSyncPoint syncPoint = context->ExecuteAsyncCompute(computeContext);
+    auto* sdfData = renderContext.Buffers->FindCustomBuffer<GlobalSignDistanceFieldCustomBuffer>(TEXT("GlobalSignDistanceField"));
+    if (sdfData && sdfData->LastFrameUsed == Engine::FrameCount)
+        sdfData->AsyncComputeSyncPoint = syncPoint;
+}
+
 void GlobalSignDistanceFieldPass::RenderDebug(RenderContext& renderContext, GPUContext* context, GPUTexture* output)
 {
     BindingData bindingData;
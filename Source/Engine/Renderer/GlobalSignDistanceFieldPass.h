@@ -71,6 +71,18 @@ class FLAXENGINE_API GlobalSignDistanceFieldPass : public RendererPass<GlobalSig
     /// <returns>True if failed to render (platform doesn't support it, out of video memory, disabled feature or effect is not ready), otherwise false.</returns>
     bool Render(RenderContext& renderContext, GPUContext* context, BindingData& result);
 
+    /// <summary>
+    /// Checks if the Global SDF can be rendered on the async compute queue (enabled in Graphics Settings and supported by the graphics backend).
+    /// </summary>
+    bool CanRenderAsync() const;
+
+    /// <summary>
+    /// Starts the Global SDF rendering on the async compute queue (falls back to the regular rendering if not supported). The graphics work recorded later into the given context runs concurrently to it, thus it cannot use the Global SDF until the next Render call which waits for the async compute work.
+    /// </summary>
+    /// <param name="renderContext">The rendering context.</param>
+    /// <param name="context">The GPU context (graphics).</param>
+    void RenderAsync(RenderContext& renderContext, GPUContext* context);
+
     /// <summary>
     /// Renders the debug view.
     /// </summary>
@@ -0,0 +1,326 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "HiZPass.h"
+#include "Engine/Core/Math/Vector4.h"
+#include "Engine/Content/Content.h"
+#include "Engine/Engine/Engine.h"
+#include "Engine/Graphics/Graphics.h"
+#include "Engine/Graphics/GPUBuffer.h"
+#include "Engine/Graphics/GPUContext.h"
+#include "Engine/Graphics/GPUDevice.h"
+#include "Engine/Graphics/GPULimits.h"
+#include "Engine/Graphics/RenderTask.h"
+#include "Engine/Graphics/RenderBuffers.h"
+#include "Engine/Graphics/RenderTargetPool.h"
+#include "Engine/Graphics/Async/GPUSyncPoint.h"
+#include "Engine/Graphics/Shaders/GPUShader.h"
+
+// The maximum size of the HiZ mip copied to the CPU for the occlusion culling (in texels)
+#define HIZ_READBACK_MAX_SIZE 128
+
+// The amount of readback buffers used to copy HiZ to the CPU without stalling the GPU
+#define HIZ_READBACK_SLOTS (GPU_ASYNC_LATENCY + 1)
+
+// The maximum age of the HiZ (in frames) to be used for the occlusion culling
+#define HIZ_MAX_LATENCY 8
+
+// The maximum amount of the CPU HiZ texels to test per object (larger objects are never culled on a CPU)
+#define HIZ_CPU_MAX_TEXELS 1024
+
+PACK_STRUCT(struct Data {
+    Int2 SrcSize;
+    Int2 DstSize;
+    });
+
+// Custom render buffer for the hierarchical depth buffer of the view.
+class HiZCustomBuffer : public RenderBuffers::CustomBuffer
+{
+public:
+    struct ReadbackSlot
+    {
+        GPUBuffer* Buffer = nullptr;
+        uint64 Frame = 0;
+        Matrix ViewProjection;
+        Vector3 Origin;
+        int32 Width = 0;
+        int32 Height = 0;
+    };
+
+    GPUTexture* HiZ = nullptr;
+    uint64 Frame = 0;
+    Matrix ViewProjection;
+    Vector3 Origin;
+    GPUBuffer* ReadbackOutput = nullptr;
+    ReadbackSlot ReadbackSlots[HIZ_READBACK_SLOTS];
+    HiZOcclusionData Occlusion;
+
+    ~HiZCustomBuffer()
+    {
+        RenderTargetPool::Release(HiZ);
+        SAFE_DELETE_GPU_RESOURCE(ReadbackOutput);
+        for (auto& slot : ReadbackSlots)
+            SAFE_DELETE_GPU_RESOURCE(slot.Buffer);
+    }
+};
+
+bool HiZOcclusionData::IsOccluded(const BoundingSphere& bounds) const
+{
+    // Project the bounds box corners into the depth buffer space
+    const Float3 center = Float3(bounds.Center - Origin);
+    const float radius = (float)bounds.Radius;
+    Float2 rectMin(MAX_float), rectMax(MIN_float);
+    float minDepth = MAX_float;
+    for (int32 i = 0; i < 8; i++)
+    {
+        const Float3 corner = center + Float3(i & 1 ? radius : -radius, i & 2 ? radius : -radius, i & 4 ? radius : -radius);
+        Float4 clip;
+        Float3::Transform(corner, ViewProjection, clip);
+        if (clip.W <= ZeroTolerance)
+            return false; // Intersects with the near plane
+        const float invW = 1.0f / clip.W;
+        const Float2 uv(clip.X * invW * 0.5f + 0.5f, clip.Y * invW * -0.5f + 0.5f);
+        rectMin = Float2::Min(rectMin, uv);
+        rectMax = Float2::Max(rectMax, uv);
+        minDepth = Math::Min(minDepth, clip.Z * invW);
+    }
+    if (rectMax.X < 0.0f || rectMax.Y < 0.0f || rectMin.X > 1.0f || rectMin.Y > 1.0f)
+        return false; // Outside the depth buffer
+
+    // Test the nearest object depth against the farthest depth in the covered texels
+    const int32 x0 = Math::Clamp((int32)(rectMin.X * (float)Width), 0, Width - 1);
+    const int32 x1 = Math::Clamp((int32)(rectMax.X * (float)Width), 0, Width - 1);
+    const int32 y0 = Math::Clamp((int32)(rectMin.Y * (float)Height), 0, Height - 1);
+    const int32 y1 = Math::Clamp((int32)(rectMax.Y * (float)Height), 0, Height - 1);
+    if ((x1 - x0 + 1) * (y1 - y0 + 1) > HIZ_CPU_MAX_TEXELS)
+        return false;
+    const float* depth = Depth.Get();
+    for (int32 y = y0; y <= y1; y++)
+    {
+        for (int32 x = x0; x <= x1; x++)
+        {
+            if (depth[y * Width + x] >= minDepth)
+                return false;
+        }
+    }
+    return true;
+}
+
+String HiZPass::ToString() const
+{
+    return TEXT("HiZPass");
+}
+
+bool HiZPass::Init()
+{
+    // Create pipeline state
+    _psDownsample = GPUDevice::Instance->CreatePipelineState();
+
+    // Load asset
+    _shader = Content::LoadAsyncInternal<Shader>(TEXT("Shaders/HiZ"));
+    if (_shader == nullptr)
+        return true;
+#if COMPILE_WITH_DEV_ENV
+    _shader.Get()->OnReloading.Bind<HiZPass, &HiZPass::OnShaderReloading>(this);
+#endif
+
+    return false;
+}
+
+bool HiZPass::setupResources()
+{
+    // Check if shader has not been loaded
+    if (!_shader || !_shader->IsLoaded())
+        return true;
+    const auto shader = _shader->GetShader();
+
+    // Validate shader constant buffer size
+    _cb = shader->GetCB(0);
+    if (_cb->GetSize() != sizeof(Data))
+    {
+        REPORT_INVALID_SHADER_PASS_CB_SIZE(shader, 0, Data);
+        return true;
+    }
+
+    // Create pipeline state
+    if (!_psDownsample->IsValid())
+    {
+        GPUPipelineState::Description psDesc = GPUPipelineState::Description::DefaultFullscreenTriangle;
+        psDesc.PS = shader->GetPS("PS_Downsample");
+        if (_psDownsample->Init(psDesc))
+            return true;
+    }
+
+    // Cache compute shaders (optional, used for the CPU readback)
+    if (GPUDevice::Instance->Limits.HasCompute)
+        _readbackCS = shader->GetCS("CS_Readback");
+
+    return false;
+}
+
+void HiZPass::Dispose()
+{
+    // Base
+    RendererPass::Dispose();
+
+    // Cleanup
+    SAFE_DELETE_GPU_RESOURCE(_psDownsample);
+    _cb = nullptr;
+    _readbackCS = nullptr;
+    _shader = nullptr;
+}
+
+bool HiZPass::CanUse()
+{
+    return Graphics::OcclusionCulling && !checkIfSkipPass();
+}
+
+bool HiZPass::Get(const RenderContext& renderContext, BindingData& result)
+{
+    if (!Graphics::OcclusionCulling || !renderContext.Buffers || !renderContext.Task || renderContext.Task->IsCameraCut || renderContext.View.IsOfflinePass)
+        return true;
+    const auto hizData = renderContext.Buffers->FindCustomBuffer<HiZCustomBuffer>(TEXT("HiZ"));
+    if (!hizData || !hizData->HiZ || Engine::FrameCount - hizData->Frame > HIZ_MAX_LATENCY)
+        return true;
+
+    // Make the HiZ view-projection relative to the current view origin
+    Matrix originShift;
+    Matrix::Translation(Float3(renderContext.View.Origin - hizData->Origin), originShift);
+    Matrix::Multiply(originShift, hizData->ViewProjection, result.ViewProjection);
+    result.Texture = hizData->HiZ;
+    result.Size = Float2((float)hizData->HiZ->Width(), (float)hizData->HiZ->Height());
+    result.MipLevels = hizData->HiZ->MipLevels();
+    return false;
+}
+
+const HiZOcclusionData* HiZPass::GetOcclusionData(const RenderContext& renderContext)
+{
+    if (!Graphics::OcclusionCulling || !renderContext.Buffers || !renderContext.Task || renderContext.Task->IsCameraCut || renderContext.View.IsOfflinePass)
+        return nullptr;
+    const auto hizData = renderContext.Buffers->FindCustomBuffer<HiZCustomBuffer>(TEXT("HiZ"));
+    if (!hizData || hizData->Occlusion.Depth.IsEmpty() || Engine::FrameCount - hizData->Occlusion.Frame > HIZ_MAX_LATENCY)
+        return nullptr;
+    return &hizData->Occlusion;
+}
+
+void HiZPass::Render(RenderContext& renderContext, GPUContext* context)
+{
+    if (!CanUse() || renderContext.View.IsOfflinePass || renderContext.View.IsSingleFrame)
+        return;
+    PROFILE_GPU_CPU("HiZ");
+    auto& hizData = *renderContext.Buffers->GetCustomBuffer<HiZCustomBuffer>(TEXT("HiZ"));
+    hizData.LastFrameUsed = Engine::FrameCount;
+
+    // Allocate the pyramid (half-resolution of the depth buffer with a full mip chain)
+    const int32 width = Math::Max((renderContext.Buffers->GetWidth() + 1) / 2, 1);
+    const int32 height = Math::Max((renderContext.Buffers->GetHeight() + 1) / 2, 1);
+    if (!hizData.HiZ || hizData.HiZ->Width() != width || hizData.HiZ->Height() != height)
+    {
+        RenderTargetPool::Release(hizData.HiZ);
+        const auto desc = GPUTextureDescription::New2D(width, height, 0, PixelFormat::R32_Float, GPUTextureFlags::ShaderResource | GPUTextureFlags::RenderTarget | GPUTextureFlags::PerMipViews);
+        hizData.HiZ = RenderTargetPool::Get(desc);
+        if (!hizData.HiZ)
+            return;
+        RENDER_TARGET_POOL_SET_NAME(hizData.HiZ, "HiZ");
+    }
+    hizData.Frame = Engine::FrameCount;
+    hizData.ViewProjection = renderContext.View.ViewProjection();
+    hizData.Origin = renderContext.View.Origin;
+
+    // Downsample depth into the mip chain (each mip contains the farthest depth of the previous one)
+    Data data;
+    GPUTextureView* src = renderContext.Buffers->DepthBuffer->View();
+    data.SrcSize = Int2(renderContext.Buffers->GetWidth(), renderContext.Buffers->GetHeight());
+    context->BindCB(0, _cb);
+    context->SetState(_psDownsample);
+    const int32 mipLevels = hizData.HiZ->MipLevels();
+    for (int32 mipIndex = 0; mipIndex < mipLevels; mipIndex++)
+    {
+        data.DstSize = Int2(Math::Max(width >> mipIndex, 1), Math::Max(height >> mipIndex, 1));
+        context->UpdateCB(_cb, &data);
+        context->SetRenderTarget(hizData.HiZ->View(0, mipIndex));
+        context->SetViewportAndScissors((float)data.DstSize.X, (float)data.DstSize.Y);
+        context->BindSR(0, src);
+        context->DrawFullscreenTriangle();
+        context->ResetRenderTarget();
+        context->UnBindSR(0);
+        src = hizData.HiZ->View(0, mipIndex);
+        data.SrcSize = data.DstSize;
+    }
+    context->ResetSR();
+
+    // Copy the coarse mip to the CPU for the occlusion culling of the next frames
+    if (!_readbackCS)
+        return;
+    const uint64 currentFrame = Engine::FrameCount;
+    HiZCustomBuffer::ReadbackSlot* freeSlot = nullptr;
+    HiZCustomBuffer::ReadbackSlot* readySlot = nullptr;
+    for (auto& slot : hizData.ReadbackSlots)
+    {
+        if (slot.Frame == 0)
+            freeSlot = &slot;
+        else if (currentFrame - slot.Frame > GPU_ASYNC_LATENCY && (!readySlot || slot.Frame > readySlot->Frame))
+            readySlot = &slot;
+    }
+    if (readySlot)
+    {
+        // Read the latest data that is ready
+        const auto mapped = (const float*)readySlot->Buffer->Map(GPUResourceMapMode::Read);
+        if (mapped)
+        {
+            auto& occlusion = hizData.Occlusion;
+            occlusion.ViewProjection = readySlot->ViewProjection;
+            occlusion.Origin = readySlot->Origin;
+            occlusion.Frame = readySlot->Frame;
+            occlusion.Width = readySlot->Width;
+            occlusion.Height = readySlot->Height;
+            occlusion.Depth.Set(mapped, readySlot->Width * readySlot->Height);
+            readySlot->Buffer->Unmap();
+        }
+        for (auto& slot : hizData.ReadbackSlots)
+        {
+            // Release slots with older data too
+            if (slot.Frame != 0 && slot.Frame <= readySlot->Frame)
+                slot.Frame = 0;
+        }
+        if (!freeSlot)
+            freeSlot = readySlot;
+    }
+    if (!freeSlot)
+        return;
+    int32 mipIndex = 0;
+    while (mipIndex < mipLevels - 1 && (Math::Max(width >> mipIndex, 1) > HIZ_READBACK_MAX_SIZE || Math::Max(height >> mipIndex, 1) > HIZ_READBACK_MAX_SIZE))
+        mipIndex++;
+    const int32 readbackWidth = Math::Max(width >> mipIndex, 1);
+    const int32 readbackHeight = Math::Max(height >> mipIndex, 1);
+    const uint32 readbackSize = readbackWidth * readbackHeight * sizeof(float);
+    if (!hizData.ReadbackOutput)
+        hizData.ReadbackOutput = GPUDevice::Instance->CreateBuffer(TEXT("HiZ.ReadbackOutput"));
+    if (hizData.ReadbackOutput->GetSize() < readbackSize)
+    {
+        const auto desc = GPUBufferDescription::Buffer(readbackSize, GPUBufferFlags::ShaderResource | GPUBufferFlags::UnorderedAccess, PixelFormat::R32_Float, nullptr, sizeof(float));
+        if (hizData.ReadbackOutput->Init(desc))
+            return;
+    }
+    if (!freeSlot->Buffer)
+        freeSlot->Buffer = GPUDevice::Instance->CreateBuffer(TEXT("HiZ.Readback"));
+    if (freeSlot->Buffer->GetSize() < readbackSize)
+    {
+        const auto desc = GPUBufferDescription::Buffer(readbackSize, GPUBufferFlags::None, PixelFormat::R32_Float, nullptr, sizeof(float), GPUResourceUsage::StagingReadback);
+        if (freeSlot->Buffer->Init(desc))
+            return;
+    }
+    data.DstSize = Int2(readbackWidth, readbackHeight);
+    context->UpdateCB(_cb, &data);
+    context->BindCB(0, _cb);
+    context->BindSR(0, hizData.HiZ->View(0, mipIndex));
+    context->BindUA(0, hizData.ReadbackOutput->View());
+    context->Dispatch(_readbackCS, Math::DivideAndRoundUp(readbackWidth, 8), Math::DivideAndRoundUp(readbackHeight, 8), 1);
+    context->ResetUA();
+    context->ResetSR();
+    context->CopyBuffer(freeSlot->Buffer, hizData.ReadbackOutput, readbackSize);
+    freeSlot->Frame = currentFrame;
+    freeSlot->ViewProjection = hizData.ViewProjection;
+    freeSlot->Origin = hizData.Origin;
+    freeSlot->Width = readbackWidth;
+    freeSlot->Height = readbackHeight;
+}
@@ -0,0 +1,106 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "RendererPass.h"
+#include "Engine/Core/Math/Matrix.h"
+#include "Engine/Core/Math/BoundingSphere.h"
+
+/// <summary>
+/// The CPU-side copy of the coarse hierarchical depth buffer mip (read back from the GPU with a few frames latency). Used for occlusion culling of the objects on a CPU.
+/// </summary>
+struct FLAXENGINE_API HiZOcclusionData
+{
+    // The view-projection matrix of the frame that rendered the depth (relative to the Origin).
+    Matrix ViewProjection;
+    // The view origin of the frame that rendered the depth.
+    Vector3 Origin;
+    // The frame index when depth was rendered.
+    uint64 Frame = 0;
+    // The depth buffer size (in texels).
+    int32 Width = 0;
+    int32 Height = 0;
+    // The maximum (farthest) device depth per texel.
+    Array<float> Depth;
+
+    /// <summary>
+    /// Checks if the given bounds are fully occluded by the depth buffer.
+    /// </summary>
+    /// <param name="bounds">The object bounds (in world-space).</param>
+    /// <returns>True if object is occluded and can be skipped from the main view rendering, otherwise false.</returns>
+    bool IsOccluded(const BoundingSphere& bounds) const;
+};
+
+/// <summary>
+/// Hierarchical-Z buffer (HiZ) rendering service. Builds the mip chain of the farthest depth from the scene depth buffer after GBuffer pass. The pyramid of the previous frame is used for the occlusion culling (on a GPU by GPU-driven culling and on a CPU via the coarse mip read back with a few frames latency).
+/// </summary>
+class HiZPass : public RendererPass<HiZPass>
+{
+public:
+    /// <summary>
+    /// The HiZ binding data for the GPU occlusion culling.
+    /// </summary>
+    struct BindingData
+    {
+        // The HiZ texture (farthest device depth mips, half-resolution of the depth buffer).
+        GPUTexture* Texture;
+        // The view-projection matrix of the frame that rendered HiZ (relative to the current view origin).
+        Matrix ViewProjection;
+        // The size of the first HiZ mip (in texels).
+        Float2 Size;
+        // The amount of HiZ mips.
+        int32 MipLevels;
+    };
+
+private:
+    AssetReference<Shader> _shader;
+    GPUConstantBuffer* _cb = nullptr;
+    GPUPipelineState* _psDownsample = nullptr;
+    GPUShaderProgramCS* _readbackCS = nullptr;
+
+public:
+    /// <summary>
+    /// Checks if occlusion culling can be used (enabled in graphics settings and the pass is ready).
+    /// </summary>
+    bool CanUse();
+
+    /// <summary>
+    /// Gets the HiZ of the previous frame for the GPU occlusion culling of the main view.
+    /// </summary>
+    /// <param name="renderContext">The rendering context.</param>
+    /// <param name="result">The result HiZ data for binding to the shaders.</param>
+    /// <returns>True if there is no valid HiZ (eg. disabled or after camera cut), otherwise false.</returns>
+    bool Get(const RenderContext& renderContext, BindingData& result);
+
+    /// <summary>
+    /// Gets the CPU-side occlusion data for the main view culling.
+    /// </summary>
+    /// <param name="renderContext">The rendering context.</param>
+    /// <returns>The occlusion data or null if not available (eg. disabled, not ready yet or after camera cut).</returns>
+    const HiZOcclusionData* GetOcclusionData(const RenderContext& renderContext);
+
+    /// <summary>
+    /// Builds the HiZ from the scene depth buffer. Called after GBuffer pass.
+    /// </summary>
+    /// <param name="renderContext">The rendering context.</param>
+    /// <param name="context">The GPU context.</param>
+    void Render(RenderContext& renderContext, GPUContext* context);
+
+public:
+    // [RendererPass]
+    String ToString() const override;
+    bool Init() override;
+    void Dispose() override;
+#if COMPILE_WITH_DEV_ENV
+    void OnShaderReloading(Asset* obj)
+    {
+        _psDownsample->ReleaseGPU();
+        _readbackCS = nullptr;
+        invalidateResources();
+    }
+#endif
+
+protected:
+    // [RendererPass]
+    bool setupResources() override;
+};
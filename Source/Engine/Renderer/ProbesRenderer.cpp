@@ -19,6 +19,8 @@
 #include "Engine/Content/AssetReference.h"
 #include "Engine/Graphics/Graphics.h"
 #include "Engine/Graphics/GPUContext.h"
+#include "Engine/Graphics/GPUTimerQuery.h"
+#include "Engine/Graphics/RenderTools.h"
 #include "Engine/Graphics/Textures/GPUTexture.h"
 #include "Engine/Graphics/Textures/TextureData.h"
 #include "Engine/Graphics/RenderTask.h"
@@ -71,7 +73,8 @@ class DownloadProbeTask : public ThreadPoolTask
 
 PACK_STRUCT(struct Data
     {
-    Float2 Dummy0;
+    uint32 MipSize;
+    float Dummy0;
     int32 CubeFace;
     float SourceMipIndex;
     });
@@ -93,6 +96,22 @@ namespace ProbesRendererImpl
     GPUTexture* _skySHIrradianceMap = nullptr;
     uint64 _updateFrameNumber = 0;
 
+    // Realtime probes update is split into steps (6 faces, lower mips filtering and the finish) and spread across frames
+    int32 _step = 0;
+    float _customCullingNear = -1;
+    float _stepCost = 0.0f;
+    int32 _timerIndex = 0;
+    struct
+    {
+        GPUTimerQuery* Query;
+        int32 Steps;
+    } _timers[4] = {};
+
+    // BC6H compression of the realtime probes
+    GPUShaderProgramCS* _csCompress = nullptr;
+    GPUTexture* _compressed = nullptr;
+    Array<GPUTexture*> _compressBlocks;
+
     FORCE_INLINE bool isUpdateSynced()
     {
         return _updateFrameNumber > 0 && _updateFrameNumber + PROBES_RENDERER_LATENCY_FRAMES <= Engine::FrameCount;
@@ -131,7 +150,9 @@ void ProbesRenderer::Bake(EnvironmentProbe* probe, float timeout)
         auto& p = _probesToBake[i];
         if (p.Type == EntryType::EnvProbe && p.Actor == probe)
         {
-            p.Timeout = timeout;
+            // Keep the waiting time of the pending probe (realtime probes are registered every frame and waiting ones get higher priority)
+            if (timeout > 0 || p.Timeout > 0)
+                p.Timeout = timeout;
             return;
         }
     }
@@ -246,6 +267,8 @@ bool ProbesRenderer::Init()
         if (_psFilterFace->Init(psDesc))
             return true;
     }
+    if (GPUDevice::Instance->Limits.HasCompute && EnumHasAllFlags(GPUDevice::Instance->GetFormatFeatures(PixelFormat::BC6H_Uf16).Support, FormatSupport::TextureCube))
+        _csCompress = shader->GetCS("CS_CompressBC6H");
 
     // Init rendering pipeline
     _output = GPUDevice::Instance->CreateTexture(TEXT("Output"));
@@ -310,6 +333,15 @@ void ProbesRenderer::Release()
     SAFE_DELETE_GPU_RESOURCE(_probe);
     SAFE_DELETE_GPU_RESOURCE(_tmpFace);
     SAFE_DELETE_GPU_RESOURCE(_skySHIrradianceMap);
+    SAFE_DELETE_GPU_RESOURCE(_compressed);
+    for (GPUTexture* texture : _compressBlocks)
+        texture->DeleteObjectNow();
+    _compressBlocks.Clear();
+    for (auto& timer : _timers)
+        SAFE_DELETE_GPU_RESOURCE(timer.Query);
+    _csCompress = nullptr;
+    _stepCost = 0.0f;
+    _step = 0;
 
     _isReady = false;
 }
@@ -348,20 +380,33 @@ void ProbesRendererService::Update()
     }
     else if (_current.Type == ProbesRenderer::EntryType::Invalid)
     {
+        // Pick the probe to update (baked probes go first in order, then realtime probes by the distance to the camera reduced by the waiting time)
         int32 firstValidEntryIndex = -1;
+        float firstValidEntryPriority = MAX_float;
         auto dt = (float)Time::Update.UnscaledDeltaTime.GetTotalSeconds();
+        const Vector3 viewPosition = MainRenderTask::Instance ? MainRenderTask::Instance->View.WorldPosition : Vector3::Zero;
         for (int32 i = 0; i < _probesToBake.Count(); i++)
         {
-            _probesToBake[i].Timeout -= dt;
-            if (_probesToBake[i].Timeout <= 0)
+            auto& e = _probesToBake[i];
+            e.Timeout -= dt;
+            if (e.Timeout > 0)
+                continue;
+            float priority = -1.0f;
+            if (!e.UseTextureData() && e.Actor)
+            {
+                const auto envProbe = e.Actor.As<EnvironmentProbe>();
+                const float distance = Math::Max((float)Vector3::Distance(envProbe->GetPosition(), viewPosition) - envProbe->GetScaledRadius(), 0.0f);
+                priority = distance / (1.0f - e.Timeout);
+            }
+            if (priority < firstValidEntryPriority)
             {
                 firstValidEntryIndex = i;
-                break;
+                firstValidEntryPriority = priority;
             }
         }
 
-        // Check if need to update probe
-        if (firstValidEntryIndex >= 0 && timeSinceUpdate > ProbesRenderer::ProbesUpdatedBreak)
+        // Check if need to update probe (realtime probes are limited by the GPU time budget instead)
+        if (firstValidEntryIndex >= 0 && (timeSinceUpdate > ProbesRenderer::ProbesUpdatedBreak || !_probesToBake[firstValidEntryIndex].UseTextureData()))
         {
             // Init service
             if (ProbesRenderer::Init())
@@ -376,6 +421,7 @@ void ProbesRendererService::Update()
             _probesToBake.RemoveAtKeepOrder(firstValidEntryIndex);
             _task->Enabled = true;
             _updateFrameNumber = 0;
+            _step = 0;
 
             // Store time of the last probe update
             _lastProbeUpdate = timeNow;
@@ -407,86 +453,17 @@ bool fixFarPlaneTreeExecute(Actor* actor, const Vector3& position, float& farPla
     return true;
 }
 
-void ProbesRenderer::OnRender(RenderTask* task, GPUContext* context)
+namespace ProbesRendererImpl
 {
-    ASSERT(_current.Type != EntryType::Invalid && _updateFrameNumber == 0);
-    switch (_current.Type)
-    {
-    case EntryType::EnvProbe:
-    case EntryType::SkyLight:
-    {
-        if (_current.Actor == nullptr)
-        {
-            // Probe has been unlinked (or deleted)
-            return;
-        }
-        break;
-    }
-    default:
-        // Canceled
-        return;
-    }
-
-    auto shader = _shader->GetShader();
-    PROFILE_GPU("Render Probe");
-
-    // Init
-    float customCullingNear = -1;
-    const int32 probeResolution = _current.GetResolution();
-    const PixelFormat probeFormat = _current.GetFormat();
-    if (_current.Type == EntryType::EnvProbe)
-    {
-        auto envProbe = (EnvironmentProbe*)_current.Actor.Get();
-        Vector3 position = envProbe->GetPosition();
-        float radius = envProbe->GetScaledRadius();
-        float nearPlane = Math::Max(0.1f, envProbe->CaptureNearPlane);
-
-        // Adjust far plane distance
-        float farPlane = Math::Max(radius, nearPlane + 100.0f);
-        farPlane *= farPlane < 10000 ? 10 : 4;
-        Function<bool(Actor*, const Vector3&, float&)> f(&fixFarPlaneTreeExecute);
-        SceneQuery::TreeExecute<const Vector3&, float&>(f, position, farPlane);
-
-        // Setup view
-        LargeWorlds::UpdateOrigin(_task->View.Origin, position);
-        _task->View.SetUpCube(nearPlane, farPlane, position - _task->View.Origin);
-    }
-    else if (_current.Type == EntryType::SkyLight)
-    {
-        auto skyLight = (SkyLight*)_current.Actor.Get();
-        Vector3 position = skyLight->GetPosition();
-        float nearPlane = 10.0f;
-        float farPlane = Math::Max(nearPlane + 1000.0f, skyLight->SkyDistanceThreshold * 2.0f);
-        customCullingNear = skyLight->SkyDistanceThreshold;
-
-        // Setup view
-        LargeWorlds::UpdateOrigin(_task->View.Origin, position);
-        _task->View.SetUpCube(nearPlane, farPlane, position - _task->View.Origin);
-    }
-    _task->CameraCut();
-
-    // Resize buffers
-    bool resizeFailed = _output->Resize(probeResolution, probeResolution, probeFormat);
-    resizeFailed |= _probe->Resize(probeResolution, probeResolution, probeFormat);
-    resizeFailed |= _tmpFace->Resize(probeResolution, probeResolution, probeFormat);
-    resizeFailed |= _task->Resize(probeResolution, probeResolution);
-    if (resizeFailed)
-        LOG(Error, "Failed to resize probe");
-
-    // Disable actor during baking (it cannot influence own results)
-    const bool isActorActive = _current.Actor->GetIsActive();
-    _current.Actor->SetIsActive(false);
-
-    // Render scene for all faces
-    for (int32 faceIndex = 0; faceIndex < 6; faceIndex++)
+    void RenderFace(GPUContext* context, int32 faceIndex, int32 probeResolution)
     {
         _task->View.SetFace(faceIndex);
 
         // Handle custom frustum for the culling (used to skip objects near the camera)
-        if (customCullingNear > 0)
+        if (_customCullingNear > 0)
         {
             Matrix p;
-            Matrix::PerspectiveFov(PI_OVER_2, 1.0f, customCullingNear, _task->View.Far, p);
+            Matrix::PerspectiveFov(PI_OVER_2, 1.0f, _customCullingNear, _task->View.Far, p);
             _task->View.CullingFrustum.SetMatrix(_task->View.View, p);
         }
 
@@ -504,60 +481,245 @@ void ProbesRenderer::OnRender(RenderTask* task, GPUContext* context)
         }
     }
 
-    // Enable actor back
-    _current.Actor->SetIsActive(isActorActive);
-
-    // Filter all lower mip levels
+    void FilterMip(GPUContext* context, GPUShader* shader, int32 mipIndex)
     {
         PROFILE_GPU("Filtering");
         Data data;
-        int32 mipLevels = _probe->MipLevels();
+        const int32 mipSize = 1 << (_probe->MipLevels() - mipIndex - 1);
+        auto cb = shader->GetCB(0);
+        data.SourceMipIndex = (float)mipIndex - 1.0f;
+        context->SetViewportAndScissors((float)mipSize, (float)mipSize);
+        for (int32 faceIndex = 0; faceIndex < 6; faceIndex++)
+        {
+            context->ResetSR();
+            context->ResetRenderTarget();
+
+            // Filter face
+            data.CubeFace = faceIndex;
+            context->UpdateCB(cb, &data);
+            context->BindCB(0, cb);
+            context->BindSR(0, _probe->ViewArray());
+            context->SetRenderTarget(_tmpFace->View(0, mipIndex));
+            context->SetState(_psFilterFace);
+            context->DrawFullscreenTriangle();
+            context->ResetSR();
+            context->ResetRenderTarget();
+
+            // Copy face back to the cubemap
+            context->SetRenderTarget(_probe->View(faceIndex, mipIndex));
+            context->Draw(_tmpFace->View(0, mipIndex));
+        }
+    }
+
+    GPUTexture* GetCompressBlocks(int32 blocks)
+    {
+        for (GPUTexture* texture : _compressBlocks)
+        {
+            if (texture->Width() == blocks)
+                return texture;
+        }
+        auto texture = GPUDevice::Instance->CreateTexture(TEXT("ProbesUpdate.CompressBlocks"));
+        if (texture->Init(GPUTextureDescription::New2D(blocks, blocks, PixelFormat::R32G32B32A32_UInt, GPUTextureFlags::UnorderedAccess)))
+        {
+            texture->DeleteObjectNow();
+            return nullptr;
+        }
+        _compressBlocks.Add(texture);
+        return texture;
+    }
+
+    bool Compress(GPUContext* context, GPUShader* shader, int32 probeResolution)
+    {
+        if (!_csCompress)
+            return true;
+        PROFILE_GPU("Compress");
+        const int32 mipLevels = _probe->MipLevels();
+        if (!_compressed)
+            _compressed = GPUDevice::Instance->CreateTexture(TEXT("ProbesUpdate.Compressed"));
+        if (_compressed->Width() != probeResolution)
+        {
+            for (GPUTexture* texture : _compressBlocks)
+                texture->DeleteObjectNow();
+            _compressBlocks.Clear();
+            if (_compressed->Init(GPUTextureDescription::NewCube(probeResolution, PixelFormat::BC6H_Uf16, GPUTextureFlags::ShaderResource, mipLevels)))
+                return true;
+        }
+
+        // Encode every face mip into the blocks texture (one texel per 4x4 block) and copy it into the compressed cubemap (the same 128 bits per texel and block)
+        Data data;
         auto cb = shader->GetCB(0);
-        for (int32 mipIndex = 1; mipIndex < mipLevels; mipIndex++)
+        for (int32 mipIndex = 0; mipIndex < mipLevels; mipIndex++)
         {
-            const int32 mipSize = 1 << (mipLevels - mipIndex - 1);
-            data.SourceMipIndex = (float)mipIndex - 1.0f;
-            context->SetViewportAndScissors((float)mipSize, (float)mipSize);
+            const int32 mipSize = Math::Max(probeResolution >> mipIndex, 1);
+            const int32 blocks = (mipSize + 3) / 4;
+            GPUTexture* blocksTexture = GetCompressBlocks(blocks);
+            if (!blocksTexture)
+                return true;
+            const uint32 groups = Math::DivideAndRoundUp((uint32)blocks, 8u);
+            data.MipSize = (uint32)mipSize;
             for (int32 faceIndex = 0; faceIndex < 6; faceIndex++)
             {
-                context->ResetSR();
-                context->ResetRenderTarget();
-
-                // Filter face
                 data.CubeFace = faceIndex;
                 context->UpdateCB(cb, &data);
                 context->BindCB(0, cb);
-                context->BindSR(0, _probe->ViewArray());
-                context->SetRenderTarget(_tmpFace->View(0, mipIndex));
-                context->SetState(_psFilterFace);
-                context->DrawFullscreenTriangle();
+                context->BindSR(1, _probe->View(faceIndex, mipIndex));
+                context->BindUA(0, blocksTexture->View());
+                context->Dispatch(_csCompress, groups, groups, 1);
+                context->ResetUA();
                 context->ResetSR();
-                context->ResetRenderTarget();
-
-                // Copy face back to the cubemap
-                context->SetRenderTarget(_probe->View(faceIndex, mipIndex));
-                context->Draw(_tmpFace->View(0, mipIndex));
+                context->CopyTexture(_compressed, RenderTools::CalcSubresourceIndex(mipIndex, faceIndex, mipLevels), 0, 0, 0, blocksTexture, 0);
             }
         }
+        return false;
     }
+}
 
-    // Cleanup
-    context->ClearState();
+void ProbesRenderer::OnRender(RenderTask* task, GPUContext* context)
+{
+    ASSERT(_current.Type != EntryType::Invalid && _updateFrameNumber == 0);
+    switch (_current.Type)
+    {
+    case EntryType::EnvProbe:
+    case EntryType::SkyLight:
+    {
+        if (_current.Actor == nullptr)
+        {
+            // Probe has been unlinked (or deleted)
+            _task->Enabled = false;
+            _current.Type = EntryType::Invalid;
+            _step = 0;
+            return;
+        }
+        break;
+    }
+    default:
+        // Canceled
+        return;
+    }
 
-    // Mark as rendered
-    _updateFrameNumber = Engine::FrameCount;
-    _task->Enabled = false;
+    auto shader = _shader->GetShader();
+    PROFILE_GPU("Render Probe");
 
-    // Real-time probes don't use TextureData (for streaming) but copy generated probe directly to GPU memory
+    // Init
+    const int32 probeResolution = _current.GetResolution();
+    const PixelFormat probeFormat = _current.GetFormat();
+    if (_step == 0)
+    {
+        _customCullingNear = -1;
+        if (_current.Type == EntryType::EnvProbe)
+        {
+            auto envProbe = (EnvironmentProbe*)_current.Actor.Get();
+            Vector3 position = envProbe->GetPosition();
+            float radius = envProbe->GetScaledRadius();
+            float nearPlane = Math::Max(0.1f, envProbe->CaptureNearPlane);
+
+            // Adjust far plane distance
+            float farPlane = Math::Max(radius, nearPlane + 100.0f);
+            farPlane *= farPlane < 10000 ? 10 : 4;
+            Function<bool(Actor*, const Vector3&, float&)> f(&fixFarPlaneTreeExecute);
+            SceneQuery::TreeExecute<const Vector3&, float&>(f, position, farPlane);
+
+            // Setup view
+            LargeWorlds::UpdateOrigin(_task->View.Origin, position);
+            _task->View.SetUpCube(nearPlane, farPlane, position - _task->View.Origin);
+        }
+        else if (_current.Type == EntryType::SkyLight)
+        {
+            auto skyLight = (SkyLight*)_current.Actor.Get();
+            Vector3 position = skyLight->GetPosition();
+            float nearPlane = 10.0f;
+            float farPlane = Math::Max(nearPlane + 1000.0f, skyLight->SkyDistanceThreshold * 2.0f);
+            _customCullingNear = skyLight->SkyDistanceThreshold;
+
+            // Setup view
+            LargeWorlds::UpdateOrigin(_task->View.Origin, position);
+            _task->View.SetUpCube(nearPlane, farPlane, position - _task->View.Origin);
+        }
+        _task->CameraCut();
+
+        // Resize buffers
+        bool resizeFailed = _output->Resize(probeResolution, probeResolution, probeFormat);
+        resizeFailed |= _probe->Resize(probeResolution, probeResolution, probeFormat);
+        resizeFailed |= _tmpFace->Resize(probeResolution, probeResolution, probeFormat);
+        resizeFailed |= _task->Resize(probeResolution, probeResolution);
+        if (resizeFailed)
+            LOG(Error, "Failed to resize probe");
+    }
+    const int32 finishStep = 6 + _probe->MipLevels() - 1;
+
+    // Realtime probes are updated within the GPU time budget (baked probes are updated at once)
+    int32 stepsCount = finishStep + 1 - _step;
+    GPUTimerQuery* timer = nullptr;
     if (!_current.UseTextureData())
     {
-        if (_current.Type == EntryType::EnvProbe && _current.Actor)
+        // Collect the cost of the previous steps (queries are resolved with a latency)
+        auto& slot = _timers[_timerIndex++ % ARRAY_COUNT(_timers)];
+        if (slot.Query && slot.Query->HasResult())
         {
-            _current.Actor.As<EnvironmentProbe>()->SetProbeData(context, _probe);
+            if (slot.Steps > 0)
+            {
+                const float cost = slot.Query->GetResult() / (float)slot.Steps;
+                _stepCost = _stepCost > 0.0f ? Math::Lerp(_stepCost, cost, 0.2f) : cost;
+            }
         }
+        else if (!slot.Query)
+        {
+            slot.Query = GPUDevice::Instance->CreateTimerQuery();
+        }
+        const float budget = GraphicsSettings::Get()->RealtimeProbesBudget;
+        stepsCount = _stepCost > 0.0f ? Math::Clamp((int32)(budget / _stepCost), 1, stepsCount) : 1;
+        slot.Steps = stepsCount;
+        timer = slot.Query;
+        timer->Begin();
+    }
+    const int32 endStep = _step + stepsCount;
 
-        // Clear flag
-        _updateFrameNumber = 0;
-        _current.Type = EntryType::Invalid;
+    // Render scene faces
+    if (_step < 6)
+    {
+        // Disable actor during baking (it cannot influence own results)
+        const bool isActorActive = _current.Actor->GetIsActive();
+        _current.Actor->SetIsActive(false);
+
+        for (; _step < 6 && _step < endStep; _step++)
+            RenderFace(context, _step, probeResolution);
+
+        // Enable actor back
+        _current.Actor->SetIsActive(isActorActive);
     }
+
+    // Filter lower mip levels
+    for (; _step < finishStep && _step < endStep; _step++)
+        FilterMip(context, shader, _step - 5);
+
+    // Cleanup
+    context->ClearState();
+
+    if (_step == finishStep && _step < endStep)
+    {
+        // Mark as rendered
+        _step = 0;
+        _updateFrameNumber = Engine::FrameCount;
+        _task->Enabled = false;
+
+        // Real-time probes don't use TextureData (for streaming) but copy generated probe directly to GPU memory
+        if (!_current.UseTextureData())
+        {
+            if (_current.Type == EntryType::EnvProbe && _current.Actor)
+            {
+                GPUTexture* probe = _probe;
+                if (GraphicsSettings::Get()->CompressRealtimeProbes && !Compress(context, shader, probeResolution))
+                    probe = _compressed;
+                context->ClearState();
+                _current.Actor.As<EnvironmentProbe>()->SetProbeData(context, probe);
+            }
+
+            // Clear flag
+            _updateFrameNumber = 0;
+            _current.Type = EntryType::Invalid;
+        }
+    }
+
+    if (timer)
+        timer->End();
 }
@@ -10,12 +10,22 @@
 #include "Engine/Graphics/RenderTargetPool.h"
 #include "Engine/Graphics/RenderTools.h"
 #include "Engine/Graphics/Graphics.h"
+#include "Engine/Graphics/Models/BonesPalette.h"
 #include "Engine/Graphics/PostProcessEffect.h"
 #include "Engine/Profiler/Profiler.h"
 #include "Engine/Content/Assets/CubeTexture.h"
 #include "Engine/Core/Log.h"
+#include "Engine/Core/Utilities.h"
 #include "Engine/Level/Scene/Lightmap.h"
 #include "Engine/Level/Actors/PostFxVolume.h"
+#include "Engine/Threading/JobSystem.h"
+#include "Utils/GPUDrivenCulling.h"
+
+// The minimum amount of instances in the draw calls batch to cull it on a GPU (when using GPU-driven culling)
+#define GPU_DRIVEN_CULLING_MIN_BATCH_SIZE 8
+
+// The minimum amount of draw calls batches to record by a single job (when using parallel commands recording)
+#define PARALLEL_RECORDING_MIN_BATCHES 128
 
 static_assert(sizeof(DrawCall) <= 288, "Too big draw call data size.");
 static_assert(sizeof(DrawCall::Surface) >= sizeof(DrawCall::Terrain), "Wrong draw call data size.");
@@ -36,8 +46,52 @@ namespace
         uintptr Size;
     };
 
+    // Big allocations are pooled by size
     Array<MemPoolEntry> MemPool;
     CriticalSection MemPoolLocker;
+
+    // Small allocations are carved from the memory slabs (bump-pointer arena), slab gets reused once all of its allocations are freed (eg. when render lists get returned to the pool at the end of the frame)
+#define RENDERER_SLAB_SIZE (1024 * 1024)
+#define RENDERER_SLAB_MAX_ALLOCATION (RENDERER_SLAB_SIZE / 4)
+    struct MemSlab
+    {
+        // Amount of allocations from this slab that are not yet freed (+1 when slab is current)
+        volatile int64 Refs;
+        uintptr Offset;
+        void* Last;
+        MemSlab* NextFree;
+    };
+
+    struct MemSlabHeader
+    {
+        // Slab that owns the allocation (null if allocation is from the pool)
+        MemSlab* Slab;
+        uintptr Size;
+    };
+
+    static_assert(sizeof(MemSlab) % 16 == 0, "Invalid slab header size.");
+    static_assert(sizeof(MemSlabHeader) == 16, "Invalid slab allocation header size.");
+
+    MemSlab* CurrentSlab = nullptr;
+    MemSlab* FreeSlabs = nullptr;
+    CriticalSection MemSlabLocker;
+
+    FORCE_INLINE uintptr AlignSlabSize(uintptr size)
+    {
+        return (size + 15) & ~(uintptr)15;
+    }
+
+    void ReleaseSlab(MemSlab* slab)
+    {
+        // Only the last reference recycles the slab (slab that is not current can't be referenced again)
+        if (Platform::InterlockedDecrement(&slab->Refs) == 0)
+        {
+            MemSlabLocker.Lock();
+            slab->NextFree = FreeSlabs;
+            FreeSlabs = slab;
+            MemSlabLocker.Unlock();
+        }
+    }
 }
 
 void RendererDirectionalLightData::SetupLightData(LightData* data, bool useShadow) const
@@ -110,30 +164,100 @@ void RendererSkyLightData::SetupLightData(LightData* data, bool useShadow) const
 
 void* RendererAllocation::Allocate(uintptr size)
 {
-    void* result = nullptr;
-    MemPoolLocker.Lock();
-    for (int32 i = 0; i < MemPool.Count(); i++)
+    const uintptr totalSize = AlignSlabSize(size) + sizeof(MemSlabHeader);
+    MemSlabHeader* header = nullptr;
+    if (totalSize > RENDERER_SLAB_MAX_ALLOCATION)
     {
-        if (MemPool[i].Size == size)
+        MemPoolLocker.Lock();
+        for (int32 i = 0; i < MemPool.Count(); i++)
         {
-            result = MemPool[i].Ptr;
-            MemPool.RemoveAt(i);
-            break;
+            if (MemPool[i].Size == totalSize)
+            {
+                header = (MemSlabHeader*)MemPool[i].Ptr;
+                MemPool.RemoveAt(i);
+                break;
+            }
+        }
+        MemPoolLocker.Unlock();
+        if (!header)
+        {
+            header = (MemSlabHeader*)Platform::Allocate(totalSize, 16);
         }
+        header->Slab = nullptr;
+        header->Size = totalSize;
+        return header + 1;
     }
-    MemPoolLocker.Unlock();
-    if (!result)
+
+    MemSlabLocker.Lock();
+    MemSlab* slab = CurrentSlab;
+    if (!slab || slab->Offset + totalSize > RENDERER_SLAB_SIZE)
     {
-        result = Platform::Allocate(size, 16);
+        // Retire the current slab and start a new one
+        MemSlab* prev = slab;
+        slab = FreeSlabs;
+        if (slab)
+            FreeSlabs = slab->NextFree;
+        else
+            slab = (MemSlab*)Platform::Allocate(RENDERER_SLAB_SIZE, 16);
+        slab->Refs = 1;
+        slab->Offset = sizeof(MemSlab);
+        slab->Last = nullptr;
+        slab->NextFree = nullptr;
+        CurrentSlab = slab;
+        if (prev && Platform::InterlockedDecrement(&prev->Refs) == 0)
+        {
+            prev->NextFree = FreeSlabs;
+            FreeSlabs = prev;
+        }
     }
+    header = (MemSlabHeader*)((byte*)slab + slab->Offset);
+    header->Slab = slab;
+    header->Size = totalSize;
+    slab->Offset += totalSize;
+    slab->Last = header + 1;
+    Platform::InterlockedIncrement(&slab->Refs);
+    MemSlabLocker.Unlock();
+    return header + 1;
+}
+
+bool RendererAllocation::Resize(void* ptr, uintptr size)
+{
+    MemSlabHeader* header = (MemSlabHeader*)ptr - 1;
+    MemSlab* slab = header->Slab;
+    if (!slab)
+        return false;
+    const uintptr totalSize = AlignSlabSize(size) + sizeof(MemSlabHeader);
+    bool result = false;
+    MemSlabLocker.Lock();
+    if (slab == CurrentSlab && slab->Last == ptr && totalSize <= RENDERER_SLAB_MAX_ALLOCATION)
+    {
+        // Grow (or shrink) the last allocation in-place
+        const uintptr offset = (uintptr)((byte*)header - (byte*)slab);
+        if (offset + totalSize <= RENDERER_SLAB_SIZE)
+        {
+            slab->Offset = offset + totalSize;
+            header->Size = totalSize;
+            result = true;
+        }
+    }
+    MemSlabLocker.Unlock();
     return result;
 }
 
 void RendererAllocation::Free(void* ptr, uintptr size)
 {
-    MemPoolLocker.Lock();
-    MemPool.Add({ ptr, size });
-    MemPoolLocker.Unlock();
+    MemSlabHeader* header = (MemSlabHeader*)ptr - 1;
+    MemSlab* slab = header->Slab;
+    if (slab)
+    {
+        ReleaseSlab(slab);
+    }
+    else
+    {
+        MemPoolLocker.Lock();
+        MemPool.Add({ header, header->Size });
+        MemPoolLocker.Unlock();
+    }
 }
 
 RenderList* RenderList::GetFromPool()
@@ -170,6 +294,14 @@ void RenderList::CleanupCache()
     for (auto& e : MemPool)
         Platform::Free(e.Ptr);
     MemPool.Clear();
+    MemSlabLocker.Lock();
+    while (FreeSlabs)
+    {
+        MemSlab* slab = FreeSlabs;
+        FreeSlabs = slab->NextFree;
+        Platform::Free(slab);
+    }
+    MemSlabLocker.Unlock();
 }
 
 bool RenderList::BlendableSettings::operator<(const BlendableSettings& other) const
@@ -385,6 +517,11 @@ RenderList::RenderList(const SpawnParams& params)
 {
 }
 
+RenderList::~RenderList()
+{
+    SAFE_DELETE_GPU_RESOURCE(_batchedInstanceBuffer);
+}
+
 void RenderList::Init(RenderContext& renderContext)
 {
     renderContext.View.Frustum.GetCorners(FrustumCornersWs);
@@ -400,6 +537,9 @@ void RenderList::Clear()
     for (auto& list : DrawCallsLists)
         list.Clear();
     ShadowDepthDrawCallsList.Clear();
+    ShadowStaticDepthDrawCallsList.Clear();
+    StaticDepthDrawCallsList.Clear();
+    StaticDepth = StaticDepthMode::Default;
     PointLights.Clear();
     SpotLights.Clear();
     SkyLights.Clear();
@@ -414,6 +554,7 @@ void RenderList::Clear()
     Settings = PostProcessSettings();
     Blendable.Clear();
     _instanceBuffer.Clear();
+    _batchedInstanceCount = 0;
 }
 
 struct PackedSortKey
@@ -431,13 +572,8 @@ struct PackedSortKey
     };
 };
 
-FORCE_INLINE void CalculateSortKey(const RenderContext& renderContext, DrawCall& drawCall, int16 sortOrder)
+uint16 RenderList::GetBatchKey(const DrawCall& drawCall)
 {
-    const Float3 planeNormal = renderContext.View.Direction;
-    const float planePoint = -Float3::Dot(planeNormal, renderContext.View.Position);
-    const float distance = Float3::Dot(planeNormal, drawCall.ObjectPosition) - planePoint;
-    PackedSortKey key;
-    key.DistanceKey = RenderTools::ComputeDistanceSortKey(distance);
     uint32 batchKey = GetHash(drawCall.Material);
     batchKey = (batchKey * 397) ^ GetHash(drawCall.Geometry.VertexBuffers[0]);
     batchKey = (batchKey * 397) ^ GetHash(drawCall.Geometry.VertexBuffers[1]);
@@ -447,11 +583,28 @@ FORCE_INLINE void CalculateSortKey(const RenderContext& renderContext, DrawCall&
     if (drawCall.Material->CanUseInstancing(handler))
         handler.GetHash(drawCall, batchKey);
     batchKey += (int32)(471 * drawCall.WorldDeterminantSign);
+    return (uint16)batchKey;
+}
+
+FORCE_INLINE void CalculateSortKey(const RenderContext& renderContext, DrawCall& drawCall, int16 sortOrder, uint16 batchKey)
+{
+    const Float3 planeNormal = renderContext.View.Direction;
+    const float planePoint = -Float3::Dot(planeNormal, renderContext.View.Position);
+    const float distance = Float3::Dot(planeNormal, drawCall.ObjectPosition) - planePoint;
+    PackedSortKey key;
+    key.DistanceKey = RenderTools::ComputeDistanceSortKey(distance);
     key.SortKey = (uint16)(sortOrder - MIN_int16);
-    key.BatchKey = (uint16)batchKey;
+    key.BatchKey = batchKey;
     drawCall.SortKey = key.Data;
 }
 
+FORCE_INLINE bool IsStaticDepth(StaticFlags staticFlags, const DrawCall& drawCall)
+{
+    // Objects with vertex animation in material can change their shape over time
+    return (staticFlags & StaticFlags::Transform) != StaticFlags::None &&
+           !EnumHasAnyFlags(drawCall.Material->GetInfo().UsageFlags, MaterialUsageFlags::UsePositionOffset | MaterialUsageFlags::UseDisplacement);
+}
+
 void RenderList::AddDrawCall(const RenderContext& renderContext, DrawPass drawModes, StaticFlags staticFlags, DrawCall& drawCall, bool receivesDecals, int16 sortOrder)
 {
 #if ENABLE_ASSERTION_LOW_LAYERS
@@ -461,13 +614,16 @@ void RenderList::AddDrawCall(const RenderContext& renderContext, DrawPass drawMo
 #endif
 
     // Append draw call data
-    CalculateSortKey(renderContext, drawCall, sortOrder);
+    CalculateSortKey(renderContext, drawCall, sortOrder, GetBatchKey(drawCall));
     const int32 index = DrawCalls.Add(drawCall);
 
     // Add draw call to proper draw lists
     if ((drawModes & DrawPass::Depth) != DrawPass::None)
     {
-        DrawCallsLists[(int32)DrawCallsListType::Depth].Indices.Add(index);
+        if (StaticDepth == StaticDepthMode::Default || !IsStaticDepth(staticFlags, drawCall))
+            DrawCallsLists[(int32)DrawCallsListType::Depth].Indices.Add(index);
+        else if (StaticDepth == StaticDepthMode::Split)
+            StaticDepthDrawCallsList.Indices.Add(index);
     }
     if ((drawModes & (DrawPass::GBuffer | DrawPass::GlobalSurfaceAtlas)) != DrawPass::None)
     {
@@ -491,6 +647,11 @@ void RenderList::AddDrawCall(const RenderContext& renderContext, DrawPass drawMo
 }
 
 void RenderList::AddDrawCall(const RenderContextBatch& renderContextBatch, DrawPass drawModes, StaticFlags staticFlags, ShadowsCastingMode shadowsMode, const BoundingSphere& bounds, DrawCall& drawCall, bool receivesDecals, int16 sortOrder)
+{
+    AddDrawCall(renderContextBatch, drawModes, staticFlags, shadowsMode, bounds, drawCall, receivesDecals, sortOrder, GetBatchKey(drawCall));
+}
+
+void RenderList::AddDrawCall(const RenderContextBatch& renderContextBatch, DrawPass drawModes, StaticFlags staticFlags, ShadowsCastingMode shadowsMode, const BoundingSphere& bounds, DrawCall& drawCall, bool receivesDecals, int16 sortOrder, uint16 batchKey, const bool* contextsMask)
 {
 #if ENABLE_ASSERTION_LOW_LAYERS
     // Ensure that draw modes are non-empty and in conjunction with material draw modes
@@ -500,13 +661,13 @@ void RenderList::AddDrawCall(const RenderContextBatch& renderContextBatch, DrawP
     const RenderContext& mainRenderContext = renderContextBatch.Contexts.Get()[0];
 
     // Append draw call data
-    CalculateSortKey(mainRenderContext, drawCall, sortOrder);
+    CalculateSortKey(mainRenderContext, drawCall, sortOrder, batchKey);
     const int32 index = DrawCalls.Add(drawCall);
 
     // Add draw call to proper draw lists
     DrawPass modes = drawModes & mainRenderContext.View.GetShadowsDrawPassMask(shadowsMode);
     drawModes = modes & mainRenderContext.View.Pass;
-    if (drawModes != DrawPass::None && mainRenderContext.View.CullingFrustum.Intersects(bounds))
+    if (drawModes != DrawPass::None && (!contextsMask || contextsMask[0]) && mainRenderContext.View.CullingFrustum.Intersects(bounds))
     {
         if ((drawModes & DrawPass::Depth) != DrawPass::None)
         {
@@ -537,9 +698,13 @@ void RenderList::AddDrawCall(const RenderContextBatch& renderContextBatch, DrawP
         const RenderContext& renderContext = renderContextBatch.Contexts.Get()[i];
         ASSERT_LOW_LAYER(renderContext.View.Pass == DrawPass::Depth);
         drawModes = modes & renderContext.View.Pass;
-        if (drawModes != DrawPass::None && renderContext.View.CullingFrustum.Intersects(bounds))
+        if (drawModes != DrawPass::None && (!contextsMask || contextsMask[i]) && renderContext.View.CullingFrustum.Intersects(bounds))
         {
-            renderContext.List->ShadowDepthDrawCallsList.Indices.Add(index);
+            const StaticDepthMode staticDepth = renderContext.List->StaticDepth;
+            if (staticDepth == StaticDepthMode::Default || !IsStaticDepth(staticFlags, drawCall))
+                renderContext.List->ShadowDepthDrawCallsList.Indices.Add(index);
+            else if (staticDepth == StaticDepthMode::Split)
+                renderContext.List->ShadowStaticDepthDrawCallsList.Indices.Add(index);
         }
     }
 }
@@ -651,6 +816,233 @@ FORCE_INLINE bool CanUseInstancing(DrawPass pass)
     return pass == DrawPass::GBuffer || pass == DrawPass::Depth;
 }
 
+FORCE_INLINE bool CanUseGPUDrivenCulling(const DrawBatch& batch)
+{
+    // Each draw call in the batch has to be a single instance (culled separately)
+    return batch.BatchSize >= GPU_DRIVEN_CULLING_MIN_BATCH_SIZE && batch.InstanceCount == batch.BatchSize;
+}
+
+FORCE_INLINE bool CanUseMeshletCulling(const DrawBatch& batch, const DrawCall& drawCall)
+{
+    // Only not batched draw calls (instances are culled as a whole)
+    return batch.BatchSize == 1 && GPUDrivenCulling::CanCullMeshlets(drawCall);
+}
+
+// The draw calls batches data for drawing
+struct DrawBatchesData
+{
+    const DrawCall* DrawCalls;
+    const int32* Indices;
+    const DrawBatch* Batches;
+    GPUBuffer* InstanceBuffer;
+    bool UseInstancing;
+    bool UseGPUDrivenCulling;
+    bool UseMeshletCulling;
+};
+
+// Advances the instance buffer and culling args offsets by the batch (matches the layout used by DrawBatches)
+FORCE_INLINE void SkipBatch(const DrawBatchesData& data, const DrawBatch& batch, int32& instanceBufferOffset, uint32& cullingArgsOffset, uint32& meshletArgsOffset)
+{
+    if (batch.BatchSize > 1)
+    {
+        if (data.UseInstancing)
+        {
+            if (data.UseGPUDrivenCulling && CanUseGPUDrivenCulling(batch))
+                cullingArgsOffset += sizeof(GPUDrawIndexedIndirectArgs);
+            instanceBufferOffset += batch.BatchSize;
+        }
+    }
+    else if (data.UseMeshletCulling && CanUseMeshletCulling(batch, data.DrawCalls[data.Indices[batch.StartIndex]]))
+    {
+        meshletArgsOffset += sizeof(GPUDrawIndexedIndirectArgs);
+    }
+}
+
+// Draws the range of the draw calls batches
+void DrawBatches(GPUContext* context, MaterialBase::BindParameters& bindParams, const DrawBatchesData& data, int32 start, int32 end, int32& instanceBufferOffset, uint32& cullingArgsOffset, uint32& meshletArgsOffset)
+{
+    const auto* drawCallsData = data.DrawCalls;
+    const auto* listData = data.Indices;
+    const auto* batchesData = data.Batches;
+    const bool useGPUDrivenCulling = data.UseGPUDrivenCulling;
+    const bool useMeshletCulling = data.UseMeshletCulling;
+    if (data.UseInstancing)
+    {
+        GPUBuffer* vb[4];
+        uint32 vbOffsets[4];
+        for (int32 i = start; i < end; i++)
+        {
+            auto& batch = batchesData[i];
+            const DrawCall& drawCall = drawCallsData[listData[batch.StartIndex]];
+
+            int32 vbCount = 0;
+            while (vbCount < ARRAY_COUNT(drawCall.Geometry.VertexBuffers) && drawCall.Geometry.VertexBuffers[vbCount])
+            {
+                vb[vbCount] = drawCall.Geometry.VertexBuffers[vbCount];
+                vbOffsets[vbCount] = drawCall.Geometry.VertexBuffersOffsets[vbCount];
+                vbCount++;
+            }
+            for (int32 j = vbCount; j < ARRAY_COUNT(drawCall.Geometry.VertexBuffers); j++)
+            {
+                vb[vbCount] = nullptr;
+                vbOffsets[vbCount] = 0;
+            }
+
+            bindParams.FirstDrawCall = &drawCall;
+            bindParams.DrawCallsCount = batch.BatchSize;
+            drawCall.Material->Bind(bindParams);
+
+            context->BindIB(drawCall.Geometry.IndexBuffer);
+
+            if (drawCall.InstanceCount == 0)
+            {
+                // No support for batching indirect draw calls
+                ASSERT_LOW_LAYER(batch.BatchSize == 1);
+
+                context->BindVB(ToSpan(vb, vbCount), vbOffsets);
+                context->DrawIndexedInstancedIndirect(drawCall.Draw.IndirectArgsBuffer, drawCall.Draw.IndirectArgsOffset);
+            }
+            else
+            {
+                if (batch.BatchSize == 1)
+                {
+                    context->BindVB(ToSpan(vb, vbCount), vbOffsets);
+                    if (useMeshletCulling && CanUseMeshletCulling(batch, drawCall))
+                    {
+                        // Draw visible triangles compacted by the GPU culling
+                        context->BindIB(GPUDrivenCulling::Instance()->GetMeshletIndexBuffer());
+                        context->DrawIndexedInstancedIndirect(GPUDrivenCulling::Instance()->GetMeshletArgsBuffer(), meshletArgsOffset);
+                        meshletArgsOffset += sizeof(GPUDrawIndexedIndirectArgs);
+                    }
+                    else
+                    {
+                        context->DrawIndexedInstanced(drawCall.Draw.IndicesCount, batch.InstanceCount, 0, 0, drawCall.Draw.StartIndex);
+                    }
+                }
+                else if (useGPUDrivenCulling && CanUseGPUDrivenCulling(batch))
+                {
+                    // Draw visible instances compacted by the GPU culling (args contain the start instance)
+                    vbCount = 3;
+                    vb[vbCount] = GPUDrivenCulling::Instance()->GetInstanceBuffer();
+                    vbOffsets[vbCount] = 0;
+                    vbCount++;
+                    context->BindVB(ToSpan(vb, vbCount), vbOffsets);
+                    context->DrawIndexedInstancedIndirect(GPUDrivenCulling::Instance()->GetArgsBuffer(), cullingArgsOffset);
+                    cullingArgsOffset += sizeof(GPUDrawIndexedIndirectArgs);
+                    instanceBufferOffset += batch.BatchSize;
+                }
+                else
+                {
+                    vbCount = 3;
+                    vb[vbCount] = data.InstanceBuffer;
+                    vbOffsets[vbCount] = 0;
+                    vbCount++;
+                    context->BindVB(ToSpan(vb, vbCount), vbOffsets);
+                    context->DrawIndexedInstanced(drawCall.Draw.IndicesCount, batch.InstanceCount, instanceBufferOffset, 0, drawCall.Draw.StartIndex);
+                    instanceBufferOffset += batch.BatchSize;
+                }
+            }
+        }
+    }
+    else
+    {
+        bindParams.DrawCallsCount = 1;
+        for (int32 i = start; i < end; i++)
+        {
+            auto& batch = batchesData[i];
+
+            for (int32 j = 0; j < batch.BatchSize; j++)
+            {
+                const DrawCall& drawCall = drawCallsData[listData[batch.StartIndex + j]];
+                bindParams.FirstDrawCall = &drawCall;
+                drawCall.Material->Bind(bindParams);
+
+                context->BindIB(drawCall.Geometry.IndexBuffer);
+                context->BindVB(ToSpan(drawCall.Geometry.VertexBuffers, 3), drawCall.Geometry.VertexBuffersOffsets);
+
+                if (drawCall.InstanceCount == 0)
+                {
+                    context->DrawIndexedInstancedIndirect(drawCall.Draw.IndirectArgsBuffer, drawCall.Draw.IndirectArgsOffset);
+                }
+                else if (useMeshletCulling && CanUseMeshletCulling(batch, drawCall))
+                {
+                    context->BindIB(GPUDrivenCulling::Instance()->GetMeshletIndexBuffer());
+                    context->DrawIndexedInstancedIndirect(GPUDrivenCulling::Instance()->GetMeshletArgsBuffer(), meshletArgsOffset);
+                    meshletArgsOffset += sizeof(GPUDrawIndexedIndirectArgs);
+                }
+                else
+                {
+                    context->DrawIndexedInstanced(drawCall.Draw.IndicesCount, drawCall.InstanceCount, 0, 0, drawCall.Draw.StartIndex);
+                }
+            }
+        }
+    }
+}
+
+void RenderList::FlushBatchedInstances(GPUContext* context, const DrawCallsList& list)
+{
+    // Assign instance buffer ranges to the batches that were not used by any other draw pass so far
+    const int32 start = _batchedInstanceCount;
+    for (int32 i = 0; i < list.PreBatchedDrawCalls.Count(); i++)
+    {
+        auto& batch = BatchedDrawCalls.Get()[list.PreBatchedDrawCalls.Get()[i]];
+        if (batch.Instances.Count() > 1 && batch.InstanceOffset == -1)
+        {
+            batch.InstanceOffset = _batchedInstanceCount;
+            _batchedInstanceCount += batch.Instances.Count();
+        }
+    }
+    if (start == _batchedInstanceCount)
+        return;
+    PROFILE_CPU();
+
+    // Ensure to have enough space in the buffer (resizing loses the contents uploaded in the previous frames)
+    const int32 size = _batchedInstanceCount * sizeof(InstanceData);
+    if (!_batchedInstanceBuffer)
+        _batchedInstanceBuffer = GPUDevice::Instance->CreateBuffer(TEXT("Batched Instance Buffer"));
+    if (_batchedInstanceBuffer->GetSize() < (uint32)size)
+    {
+        const uint32 capacity = Math::AlignUp<uint32>((uint32)(_batchedInstanceCount * 1.3f), 1024);
+        if (_batchedInstanceBuffer->Init(GPUBufferDescription::Vertex(sizeof(InstanceData), capacity, GPUResourceUsage::Default)))
+        {
+            LOG(Fatal, "Cannot setup batched instance buffer! Size: {0}", Utilities::BytesToText(capacity * sizeof(InstanceData)));
+            return;
+        }
+        _batchedInstanceValidSize = 0;
+    }
+    if (_batchedInstanceData.Count() < size)
+        _batchedInstanceData.Resize(size);
+
+    // Write the new instances and upload only the range that differs from the buffer contents (static instances are usually the same as in the previous frame)
+    int32 dirtyStart = MAX_int32, dirtyEnd = 0;
+    if (_batchedInstanceValidSize == 0 && start != 0)
+    {
+        // Buffer has been resized so restore instances used by the other draw passes
+        dirtyStart = 0;
+        dirtyEnd = start * sizeof(InstanceData);
+    }
+    for (int32 i = 0; i < list.PreBatchedDrawCalls.Count(); i++)
+    {
+        const auto& batch = BatchedDrawCalls.Get()[list.PreBatchedDrawCalls.Get()[i]];
+        if (batch.InstanceOffset < start)
+            continue;
+        const int32 batchStart = batch.InstanceOffset * sizeof(InstanceData);
+        const int32 batchSize = batch.Instances.Count() * sizeof(InstanceData);
+        byte* dst = _batchedInstanceData.Get() + batchStart;
+        if (batchStart + batchSize > _batchedInstanceValidSize || Platform::MemoryCompare(dst, batch.Instances.Get(), batchSize) != 0)
+        {
+            Platform::MemoryCopy(dst, batch.Instances.Get(), batchSize);
+            dirtyStart = Math::Min(dirtyStart, batchStart);
+            dirtyEnd = Math::Max(dirtyEnd, batchStart + batchSize);
+        }
+    }
+    if (dirtyStart < dirtyEnd)
+    {
+        context->UpdateBuffer(_batchedInstanceBuffer, _batchedInstanceData.Get() + dirtyStart, dirtyEnd - dirtyStart, dirtyStart);
+        _batchedInstanceValidSize = Math::Max(_batchedInstanceValidSize, dirtyEnd);
+    }
+}
+
 void RenderList::ExecuteDrawCalls(const RenderContext& renderContext, DrawCallsList& list, const RenderListBuffer<DrawCall>& drawCalls, GPUTextureView* input)
 {
     if (list.IsEmpty())
@@ -660,7 +1052,9 @@ void RenderList::ExecuteDrawCalls(const RenderContext& renderContext, DrawCallsL
     const auto* listData = list.Indices.Get();
     const auto* batchesData = list.Batches.Get();
     const auto context = GPUDevice::Instance->GetMainContext();
+    BonesPalette::Flush(context);
     bool useInstancing = list.CanUseInstancing && CanUseInstancing(renderContext.View.Pass) && GPUDevice::Instance->Limits.HasInstancing;
+    bool useGPUDrivenCulling = false;
     TaaJitterRemoveContext taaJitterRemove(renderContext.View);
 
     // Clear SR slots to prevent any resources binding issues (leftovers from the previous passes)
@@ -677,21 +1071,30 @@ void RenderList::ExecuteDrawCalls(const RenderContext& renderContext, DrawCallsL
             if (batch.BatchSize > 1)
                 instancedBatchesCount += batch.BatchSize;
         }
-        for (int32 i = 0; i < list.PreBatchedDrawCalls.Count(); i++)
+        bool hasInstancedPreBatches = false;
+        for (int32 i = 0; i < list.PreBatchedDrawCalls.Count() && !hasInstancedPreBatches; i++)
         {
-            auto& batch = BatchedDrawCalls.Get()[list.PreBatchedDrawCalls.Get()[i]];
-            if (batch.Instances.Count() > 1)
-                instancedBatchesCount += batch.Instances.Count();
+            const auto& batch = BatchedDrawCalls.Get()[list.PreBatchedDrawCalls.Get()[i]];
+            hasInstancedPreBatches = batch.Instances.Count() > 1 || batch.InstanceBuffer;
         }
-        if (instancedBatchesCount == 0)
+        if (instancedBatchesCount == 0 && !hasInstancedPreBatches)
         {
             // Faster path if none of the draw batches requires instancing
             useInstancing = false;
             goto DRAW;
         }
+
+        // Pre-batched draw calls use the persistent instance buffer (shared by all draw passes)
+        if (hasInstancedPreBatches)
+            FlushBatchedInstances(context, list);
+        if (instancedBatchesCount == 0)
+            goto DRAW;
         _instanceBuffer.Clear();
         _instanceBuffer.Data.Resize(instancedBatchesCount * sizeof(InstanceData));
         auto instanceData = (InstanceData*)_instanceBuffer.Data.Get();
+        useGPUDrivenCulling = GPUDrivenCulling::Instance()->CanUse();
+        Array<GPUDrivenCulling::InstanceBounds, RendererAllocation> cullingBounds;
+        Array<GPUDrawIndexedIndirectArgs, RendererAllocation> cullingArgs;
 
         // Write to instance buffer
         for (int32 i = 0; i < list.Batches.Count(); i++)
@@ -701,6 +1104,27 @@ void RenderList::ExecuteDrawCalls(const RenderContext& renderContext, DrawCallsL
             {
                 IMaterial::InstancingHandler handler;
                 drawCallsData[listData[batch.StartIndex]].Material->CanUseInstancing(handler);
+                if (useGPUDrivenCulling && CanUseGPUDrivenCulling(batch))
+                {
+                    // Setup batch for culling on a GPU (draw args instance count is accumulated by the culling shader)
+                    const DrawCall& firstDrawCall = drawCallsData[listData[batch.StartIndex]];
+                    const uint32 startInstance = (uint32)(instanceData - (InstanceData*)_instanceBuffer.Data.Get());
+                    auto& args = cullingArgs.AddOne();
+                    args.IndicesCount = firstDrawCall.Draw.IndicesCount;
+                    args.InstanceCount = 0;
+                    args.StartIndex = firstDrawCall.Draw.StartIndex;
+                    args.StartVertex = 0;
+                    args.StartInstance = startInstance;
+                    for (int32 j = 0; j < batch.BatchSize; j++)
+                    {
+                        auto& drawCall = drawCallsData[listData[batch.StartIndex + j]];
+                        auto& bounds = cullingBounds.AddOne();
+                        bounds.Center = drawCall.ObjectPosition;
+                        bounds.Radius = drawCall.ObjectRadius;
+                        bounds.Instance = startInstance + j;
+                        bounds.Batch = cullingArgs.Count() - 1;
+                    }
+                }
                 for (int32 j = 0; j < batch.BatchSize; j++)
                 {
                     auto& drawCall = drawCallsData[listData[batch.StartIndex + j]];
@@ -709,35 +1133,88 @@ void RenderList::ExecuteDrawCalls(const RenderContext& renderContext, DrawCallsL
                 }
             }
         }
-        for (int32 i = 0; i < list.PreBatchedDrawCalls.Count(); i++)
-        {
-            auto& batch = BatchedDrawCalls.Get()[list.PreBatchedDrawCalls.Get()[i]];
-            if (batch.Instances.Count() > 1)
-            {
-                Platform::MemoryCopy(instanceData, batch.Instances.Get(), batch.Instances.Count() * sizeof(InstanceData));
-                instanceData += batch.Instances.Count();
-            }
-        }
 
         // Upload data
         _instanceBuffer.Flush(context);
+
+        // Cull instances on a GPU (fallback to drawing all instances on failure)
+        if (cullingArgs.IsEmpty() || GPUDrivenCulling::Instance()->Cull(context, renderContext, _instanceBuffer.GetBuffer(), instancedBatchesCount, cullingBounds, cullingArgs))
+            useGPUDrivenCulling = false;
     }
 
 DRAW:
 
+    // Cull triangle clusters of the high-poly meshes on a GPU (fallback to drawing whole meshes on failure)
+    bool useMeshletCulling = false;
+    if (CanUseInstancing(renderContext.View.Pass) && GPUDrivenCulling::Instance()->CanUse())
+    {
+        Array<const DrawCall*, RendererAllocation> meshletDrawCalls;
+        for (int32 i = 0; i < list.Batches.Count(); i++)
+        {
+            auto& batch = batchesData[i];
+            const DrawCall& drawCall = drawCallsData[listData[batch.StartIndex]];
+            if (CanUseMeshletCulling(batch, drawCall))
+                meshletDrawCalls.Add(&drawCall);
+        }
+        useMeshletCulling = meshletDrawCalls.HasItems() && !GPUDrivenCulling::Instance()->CullMeshlets(context, renderContext, meshletDrawCalls);
+    }
+
     // Execute draw calls
     MaterialBase::BindParameters bindParams(context, renderContext);
     bindParams.Input = input;
     bindParams.BindViewData();
+    int32 instanceBufferOffset = 0;
+    uint32 cullingArgsOffset = 0;
+    uint32 meshletArgsOffset = 0;
+    const DrawBatchesData drawData = { drawCallsData, listData, batchesData, _instanceBuffer.GetBuffer(), useInstancing, useGPUDrivenCulling, useMeshletCulling };
+    const int32 jobCount = Graphics::ParallelCommandRecording ? Math::Min(Math::Min(list.Batches.Count() / PARALLEL_RECORDING_MIN_BATCHES, JobSystem::GetThreadsCount()), GPU_MAX_PARALLEL_CONTEXTS) : 0;
+    if (jobCount > 1 && GPUDevice::Instance->GetParallelContext(0))
+    {
+        // Record draw calls batches from multiple job threads into the parallel contexts (continuous ranges are submitted in order to preserve the drawing order)
+        PROFILE_CPU_NAMED("Parallel Recording");
+        GPUContext* contexts[GPU_MAX_PARALLEL_CONTEXTS];
+        int32 rangesStart[GPU_MAX_PARALLEL_CONTEXTS + 1];
+        int32 rangesInstanceBufferOffset[GPU_MAX_PARALLEL_CONTEXTS];
+        uint32 rangesCullingArgsOffset[GPU_MAX_PARALLEL_CONTEXTS];
+        uint32 rangesMeshletArgsOffset[GPU_MAX_PARALLEL_CONTEXTS];
+        const int32 rangeSize = list.Batches.Count() / jobCount;
+        for (int32 jobIndex = 0; jobIndex < jobCount; jobIndex++)
+        {
+            rangesStart[jobIndex] = jobIndex * rangeSize;
+            rangesInstanceBufferOffset[jobIndex] = instanceBufferOffset;
+            rangesCullingArgsOffset[jobIndex] = cullingArgsOffset;
+            rangesMeshletArgsOffset[jobIndex] = meshletArgsOffset;
+            const int32 rangeEnd = jobIndex + 1 == jobCount ? list.Batches.Count() : rangesStart[jobIndex] + rangeSize;
+            for (int32 i = rangesStart[jobIndex]; i < rangeEnd && (useInstancing || useMeshletCulling); i++)
+                SkipBatch(drawData, batchesData[i], instanceBufferOffset, cullingArgsOffset, meshletArgsOffset);
+            contexts[jobIndex] = GPUDevice::Instance->GetParallelContext(jobIndex);
+            contexts[jobIndex]->BeginParallel(context);
+        }
+        rangesStart[jobCount] = list.Batches.Count();
+        JobSystem::Execute([&](int32 jobIndex)
+        {
+            MaterialBase::BindParameters jobBindParams(contexts[jobIndex], renderContext);
+            jobBindParams.Input = input;
+            jobBindParams.BindViewData();
+            int32 jobInstanceBufferOffset = rangesInstanceBufferOffset[jobIndex];
+            uint32 jobCullingArgsOffset = rangesCullingArgsOffset[jobIndex];
+            uint32 jobMeshletArgsOffset = rangesMeshletArgsOffset[jobIndex];
+            DrawBatches(contexts[jobIndex], jobBindParams, drawData, rangesStart[jobIndex], rangesStart[jobIndex + 1], jobInstanceBufferOffset, jobCullingArgsOffset, jobMeshletArgsOffset);
+        }, jobCount);
+        context->ExecuteParallel(ToSpan(contexts, jobCount));
+    }
+    else
+    {
+        DrawBatches(context, bindParams, drawData, 0, list.Batches.Count(), instanceBufferOffset, cullingArgsOffset, meshletArgsOffset);
+    }
     if (useInstancing)
     {
-        int32 instanceBufferOffset = 0;
         GPUBuffer* vb[4];
         uint32 vbOffsets[4];
-        for (int32 i = 0; i < list.Batches.Count(); i++)
+        for (int32 i = 0; i < list.PreBatchedDrawCalls.Count(); i++)
         {
-            auto& batch = batchesData[i];
-            const DrawCall& drawCall = drawCallsData[listData[batch.StartIndex]];
+            auto& batch = BatchedDrawCalls.Get()[list.PreBatchedDrawCalls.Get()[i]];
+            auto& drawCall = batch.DrawCall;
 
             int32 vbCount = 0;
             while (vbCount < ARRAY_COUNT(drawCall.Geometry.VertexBuffers) && drawCall.Geometry.VertexBuffers[vbCount])
@@ -753,65 +1230,22 @@ void RenderList::ExecuteDrawCalls(const RenderContext& renderContext, DrawCallsL
             }
 
             bindParams.FirstDrawCall = &drawCall;
-            bindParams.DrawCallsCount = batch.BatchSize;
+            bindParams.DrawCallsCount = batch.InstanceBuffer ? MAX_int32 : batch.Instances.Count();
             drawCall.Material->Bind(bindParams);
 
             context->BindIB(drawCall.Geometry.IndexBuffer);
 
             if (drawCall.InstanceCount == 0)
             {
-                // No support for batching indirect draw calls
-                ASSERT_LOW_LAYER(batch.BatchSize == 1);
-
-                context->BindVB(ToSpan(vb, vbCount), vbOffsets);
-                context->DrawIndexedInstancedIndirect(drawCall.Draw.IndirectArgsBuffer, drawCall.Draw.IndirectArgsOffset);
-            }
-            else
-            {
-                if (batch.BatchSize == 1)
-                {
-                    context->BindVB(ToSpan(vb, vbCount), vbOffsets);
-                    context->DrawIndexedInstanced(drawCall.Draw.IndicesCount, batch.InstanceCount, 0, 0, drawCall.Draw.StartIndex);
-                }
-                else
+                ASSERT_LOW_LAYER(batch.InstanceBuffer || batch.Instances.Count() == 1);
+                if (batch.InstanceBuffer)
                 {
+                    // Instances generated on a GPU
                     vbCount = 3;
-                    vb[vbCount] = _instanceBuffer.GetBuffer();
+                    vb[vbCount] = batch.InstanceBuffer;
                     vbOffsets[vbCount] = 0;
                     vbCount++;
-                    context->BindVB(ToSpan(vb, vbCount), vbOffsets);
-                    context->DrawIndexedInstanced(drawCall.Draw.IndicesCount, batch.InstanceCount, instanceBufferOffset, 0, drawCall.Draw.StartIndex);
-                    instanceBufferOffset += batch.BatchSize;
                 }
-            }
-        }
-        for (int32 i = 0; i < list.PreBatchedDrawCalls.Count(); i++)
-        {
-            auto& batch = BatchedDrawCalls.Get()[list.PreBatchedDrawCalls.Get()[i]];
-            auto& drawCall = batch.DrawCall;
-
-            int32 vbCount = 0;
-            while (vbCount < ARRAY_COUNT(drawCall.Geometry.VertexBuffers) && drawCall.Geometry.VertexBuffers[vbCount])
-            {
-                vb[vbCount] = drawCall.Geometry.VertexBuffers[vbCount];
-                vbOffsets[vbCount] = drawCall.Geometry.VertexBuffersOffsets[vbCount];
-                vbCount++;
-            }
-            for (int32 j = vbCount; j < ARRAY_COUNT(drawCall.Geometry.VertexBuffers); j++)
-            {
-                vb[vbCount] = nullptr;
-                vbOffsets[vbCount] = 0;
-            }
-
-            bindParams.FirstDrawCall = &drawCall;
-            bindParams.DrawCallsCount = batch.Instances.Count();
-            drawCall.Material->Bind(bindParams);
-
-            context->BindIB(drawCall.Geometry.IndexBuffer);
-
-            if (drawCall.InstanceCount == 0)
-            {
-                ASSERT_LOW_LAYER(batch.Instances.Count() == 1);
                 context->BindVB(ToSpan(vb, vbCount), vbOffsets);
                 context->DrawIndexedInstancedIndirect(drawCall.Draw.IndirectArgsBuffer, drawCall.Draw.IndirectArgsOffset);
             }
@@ -825,12 +1259,11 @@ void RenderList::ExecuteDrawCalls(const RenderContext& renderContext, DrawCallsL
                 else
                 {
                     vbCount = 3;
-                    vb[vbCount] = _instanceBuffer.GetBuffer();
+                    vb[vbCount] = _batchedInstanceBuffer;
                     vbOffsets[vbCount] = 0;
                     vbCount++;
                     context->BindVB(ToSpan(vb, vbCount), vbOffsets);
-                    context->DrawIndexedInstanced(drawCall.Draw.IndicesCount, batch.Instances.Count(), instanceBufferOffset, 0, drawCall.Draw.StartIndex);
-                    instanceBufferOffset += batch.Instances.Count();
+                    context->DrawIndexedInstanced(drawCall.Draw.IndicesCount, batch.Instances.Count(), batch.InstanceOffset, 0, drawCall.Draw.StartIndex);
                 }
             }
         }
@@ -838,32 +1271,11 @@ void RenderList::ExecuteDrawCalls(const RenderContext& renderContext, DrawCallsL
     else
     {
         bindParams.DrawCallsCount = 1;
-        for (int32 i = 0; i < list.Batches.Count(); i++)
-        {
-            auto& batch = batchesData[i];
-
-            for (int32 j = 0; j < batch.BatchSize; j++)
-            {
-                const DrawCall& drawCall = drawCalls[listData[batch.StartIndex + j]];
-                bindParams.FirstDrawCall = &drawCall;
-                drawCall.Material->Bind(bindParams);
-
-                context->BindIB(drawCall.Geometry.IndexBuffer);
-                context->BindVB(ToSpan(drawCall.Geometry.VertexBuffers, 3), drawCall.Geometry.VertexBuffersOffsets);
-
-                if (drawCall.InstanceCount == 0)
-                {
-                    context->DrawIndexedInstancedIndirect(drawCall.Draw.IndirectArgsBuffer, drawCall.Draw.IndirectArgsOffset);
-                }
-                else
-                {
-                    context->DrawIndexedInstanced(drawCall.Draw.IndicesCount, drawCall.InstanceCount, 0, 0, drawCall.Draw.StartIndex);
-                }
-            }
-        }
         for (int32 i = 0; i < list.PreBatchedDrawCalls.Count(); i++)
         {
             auto& batch = BatchedDrawCalls.Get()[list.PreBatchedDrawCalls.Get()[i]];
+            if (batch.InstanceBuffer)
+                continue;
             auto drawCall = batch.DrawCall;
             drawCall.ObjectRadius = 0.0f;
             bindParams.FirstDrawCall = &drawCall;
@@ -54,6 +54,8 @@ struct RendererDirectionalLightData
     PartitionMode PartitionMode;
     float ContactShadowsLength;
     ShadowsCastingMode ShadowsMode;
+    int32 ShadowsLODBias;
+    int32 CascadeLODBias;
 
     Guid ID;
 
@@ -89,6 +91,7 @@ struct RendererSpotLightData
     float ContactShadowsLength;
     float IndirectLightingIntensity;
     ShadowsCastingMode ShadowsMode;
+    int32 ShadowsLODBias;
 
     StaticFlags StaticFlags;
     int16 ShadowDataIndex = -1;
@@ -127,6 +130,7 @@ struct RendererPointLightData
     float ContactShadowsLength;
     float IndirectLightingIntensity;
     ShadowsCastingMode ShadowsMode;
+    int32 ShadowsLODBias;
 
     StaticFlags StaticFlags;
     int16 ShadowDataIndex = -1;
@@ -199,6 +203,19 @@ API_ENUM() enum class DrawCallsListType
     MAX,
 };
 
+/// <summary>
+/// The static objects depth drawing mode of the render list (used by shadow projections to cache static geometry depth).
+/// </summary>
+enum class StaticDepthMode : byte
+{
+    // Static objects are drawn into the regular depth draw calls lists.
+    Default,
+    // Static objects are drawn into the separate static depth draw calls lists.
+    Split,
+    // Static objects are skipped (eg. their cached depth is still valid).
+    Skip,
+};
+
 /// <summary>
 /// Represents a patch of draw calls that can be submitted to rendering.
 /// </summary>
@@ -234,6 +251,12 @@ struct BatchedDrawCall
 {
     DrawCall DrawCall;
     Array<struct InstanceData, RendererAllocation> Instances;
+
+    // The offset of the instances data in the list's persistent instance buffer (-1 if not yet uploaded).
+    int32 InstanceOffset = -1;
+
+    // The per-instance vertex buffer (InstanceData elements) for the instances generated on a GPU. Used with the indirect draw arguments (draw call instance count set to 0) instead of the instances list. Optional, can be null.
+    GPUBuffer* InstanceBuffer = nullptr;
 };
 
 /// <summary>
@@ -271,6 +294,7 @@ struct DrawCallsList
 API_CLASS(Sealed) class FLAXENGINE_API RenderList : public ScriptingObject
 {
     DECLARE_SCRIPTING_TYPE(RenderList);
+    ~RenderList();
 
     /// <summary>
     /// Allocates the new renderer list object or reuses already allocated one.
@@ -315,6 +339,21 @@ API_CLASS(Sealed) class FLAXENGINE_API RenderList : public ScriptingObject
     /// </summary>
     DrawCallsList ShadowDepthDrawCallsList;
 
+    /// <summary>
+    /// The additional draw calls list for Depth drawing of the static objects into Shadow Projections that use DrawCalls from main render context. Used only with StaticDepthMode::Split.
+    /// </summary>
+    DrawCallsList ShadowStaticDepthDrawCallsList;
+
+    /// <summary>
+    /// The draw calls list for Depth drawing of the static objects. Used only with StaticDepthMode::Split.
+    /// </summary>
+    DrawCallsList StaticDepthDrawCallsList;
+
+    /// <summary>
+    /// The static objects depth drawing mode. Static objects are the ones with StaticFlags::Transform and materials without vertex animation.
+    /// </summary>
+    StaticDepthMode StaticDepth = StaticDepthMode::Default;
+
     /// <summary>
     /// Light pass members - directional lights
     /// </summary>
@@ -409,6 +448,10 @@ API_CLASS(Sealed) class FLAXENGINE_API RenderList : public ScriptingObject
 
 private:
     DynamicVertexBuffer _instanceBuffer;
+    GPUBuffer* _batchedInstanceBuffer = nullptr;
+    Array<byte> _batchedInstanceData;
+    int32 _batchedInstanceCount = 0;
+    int32 _batchedInstanceValidSize = 0;
 
 public:
     /// <summary>
@@ -511,6 +554,28 @@ API_CLASS(Sealed) class FLAXENGINE_API RenderList : public ScriptingObject
     /// <param name="sortOrder">Object sorting key.</param>
     void AddDrawCall(const RenderContextBatch& renderContextBatch, DrawPass drawModes, StaticFlags staticFlags, ShadowsCastingMode shadowsMode, const BoundingSphere& bounds, DrawCall& drawCall, bool receivesDecals = true, int16 sortOrder = 0);
 
+    /// <summary>
+    /// Adds the draw call to the draw lists and references it in other render contexts. Performs additional per-context frustum culling. Uses the precomputed batching key (eg. from the retained draw calls cache).
+    /// </summary>
+    /// <param name="renderContextBatch">The rendering context batch. This assumes that RenderContextBatch contains main context and shadow projections only.</param>
+    /// <param name="drawModes">The object draw modes.</param>
+    /// <param name="staticFlags">The object static flags.</param>
+    /// <param name="shadowsMode">The object shadows casting mode.</param>
+    /// <param name="bounds">The object bounds.</param>
+    /// <param name="drawCall">The draw call data.</param>
+    /// <param name="receivesDecals">True if the rendered mesh can receive decals.</param>
+    /// <param name="sortOrder">Object sorting key.</param>
+    /// <param name="batchKey">The draw call batching key (see GetBatchKey).</param>
+    /// <param name="contextsMask">The optional per-context mask (array length equal to the render contexts count). Contexts with false value are skipped.</param>
+    void AddDrawCall(const RenderContextBatch& renderContextBatch, DrawPass drawModes, StaticFlags staticFlags, ShadowsCastingMode shadowsMode, const BoundingSphere& bounds, DrawCall& drawCall, bool receivesDecals, int16 sortOrder, uint16 batchKey, const bool* contextsMask = nullptr);
+
+    /// <summary>
+    /// Calculates the draw call batching key (hash of the draw call state that is used to sort draw calls for instancing).
+    /// </summary>
+    /// <param name="drawCall">The draw call data.</param>
+    /// <returns>The batching key.</returns>
+    static uint16 GetBatchKey(const DrawCall& drawCall);
+
     /// <summary>
     /// Sorts the collected draw calls list.
     /// </summary>
@@ -563,6 +628,9 @@ API_CLASS(Sealed) class FLAXENGINE_API RenderList : public ScriptingObject
     /// <param name="drawCalls">The collected draw calls list.</param>
     /// <param name="input">The input scene color. It's optional and used in forward/postFx rendering.</param>
     void ExecuteDrawCalls(const RenderContext& renderContext, DrawCallsList& list, const RenderListBuffer<DrawCall>& drawCalls, GPUTextureView* input);
+
+private:
+    void FlushBatchedInstances(GPUContext* context, const DrawCallsList& list);
 };
 
 /// <summary>
@@ -23,16 +23,24 @@
 #include "HistogramPass.h"
 #include "AtmospherePreCompute.h"
 #include "GlobalSignDistanceFieldPass.h"
+#include "HiZPass.h"
+#include "ClusteredLightingPass.h"
+#include "VariableRateShadingPass.h"
 #include "GI/GlobalSurfaceAtlasPass.h"
 #include "GI/DynamicDiffuseGlobalIllumination.h"
 #include "Utils/MultiScaler.h"
+#include "Utils/HalfResRendering.h"
 #include "Utils/BitonicSort.h"
+#include "Utils/GPUDrivenCulling.h"
+#include "Utils/PreSkinning.h"
+#include "Engine/Graphics/Models/BonesPalette.h"
 #include "AntiAliasing/FXAA.h"
 #include "AntiAliasing/TAA.h"
 #include "AntiAliasing/SMAA.h"
 #include "Engine/Level/Actor.h"
 #include "Engine/Level/Level.h"
 #include "Engine/Level/Scene/SceneRendering.h"
+#include "Engine/Terrain/TerrainMaterialCache.h"
 #include "Engine/Core/Config/GraphicsSettings.h"
 #include "Engine/Threading/JobSystem.h"
 #if USE_EDITOR
@@ -82,7 +90,13 @@ bool RendererService::Init()
     PassList.Add(PostProcessingPass::Instance());
     PassList.Add(MotionBlurPass::Instance());
     PassList.Add(MultiScaler::Instance());
+    PassList.Add(HalfResRendering::Instance());
     PassList.Add(BitonicSort::Instance());
+    PassList.Add(GPUDrivenCulling::Instance());
+    PassList.Add(PreSkinning::Instance());
+    PassList.Add(HiZPass::Instance());
+    PassList.Add(ClusteredLightingPass::Instance());
+    PassList.Add(VariableRateShadingPass::Instance());
     PassList.Add(FXAA::Instance());
     PassList.Add(TAA::Instance());
     PassList.Add(SMAA::Instance());
@@ -120,6 +134,7 @@ void RendererService::Dispose()
     {
         PassList[i]->Dispose();
     }
+    BonesPalette::Dispose();
     SAFE_DELETE_GPU_RESOURCE(IMaterial::BindParameters::PerViewConstants);
 }
 
@@ -166,6 +181,7 @@ bool Renderer::IsReady()
 void Renderer::Render(SceneRenderTask* task)
 {
     PROFILE_GPU_CPU_NAMED("Render Frame");
+    PROFILE_MEM(Renderer);
 
     // Prepare GPU context
     auto context = GPUDevice::Instance->GetMainContext();
@@ -428,6 +444,11 @@ void RenderInner(SceneRenderTask* task, RenderContext& renderContext, RenderCont
             auto& shadowContext = renderContextBatch.Contexts[i];
             shadowContext.List->SortDrawCalls(shadowContext, false, DrawCallsListType::Depth);
             shadowContext.List->SortDrawCalls(shadowContext, false, shadowContext.List->ShadowDepthDrawCallsList, renderContext.List->DrawCalls);
+            if (shadowContext.List->StaticDepth == StaticDepthMode::Split)
+            {
+                shadowContext.List->SortDrawCalls(shadowContext, false, shadowContext.List->StaticDepthDrawCallsList, shadowContext.List->DrawCalls);
+                shadowContext.List->SortDrawCalls(shadowContext, false, shadowContext.List->ShadowStaticDepthDrawCallsList, renderContext.List->DrawCalls);
+            }
         }
     }
 
@@ -454,12 +475,17 @@ void RenderInner(SceneRenderTask* task, RenderContext& renderContext, RenderCont
 #endif
 
     // Global SDF rendering (can be used by materials later on)
-    if (graphicsSettings->EnableGlobalSDF && EnumHasAnyFlags(view.Flags, ViewFlags::GlobalSDF))
+    const bool useGlobalSDF = graphicsSettings->EnableGlobalSDF && EnumHasAnyFlags(view.Flags, ViewFlags::GlobalSDF);
+    const bool asyncGlobalSDF = useGlobalSDF && GlobalSignDistanceFieldPass::Instance()->CanRenderAsync();
+    if (useGlobalSDF && !asyncGlobalSDF)
     {
         GlobalSignDistanceFieldPass::BindingData bindingData;
         GlobalSignDistanceFieldPass::Instance()->Render(renderContext, context, bindingData);
     }
 
+    // Render terrain material cache pages requested during drawing (used by the distant terrain chunks)
+    TerrainMaterialCache::Render(context, renderContext);
+
     // Fill GBuffer
     GBufferPass::Instance()->Fill(renderContext, lightBuffer);
 
@@ -489,6 +515,9 @@ void RenderInner(SceneRenderTask* task, RenderContext& renderContext, RenderCont
     }
 #endif
 
+    // Build hierarchical depth buffer (used for occlusion culling in the next frames)
+    HiZPass::Instance()->Render(renderContext, context);
+
     // Render motion vectors
     MotionBlurPass::Instance()->RenderMotionVectors(renderContext);
 
@@ -506,9 +535,19 @@ void RenderInner(SceneRenderTask* task, RenderContext& renderContext, RenderCont
         return;
     }
 
+    // Global SDF rendering on async compute (overlaps with shadow maps rendering, materials use the previous frame one)
+    if (asyncGlobalSDF)
+        GlobalSignDistanceFieldPass::Instance()->RenderAsync(renderContext, context);
+
     // Render lighting
     renderContextBatch.GetMainContext() = renderContext; // Sync render context in batch with the current value
     LightPass::Instance()->RenderLight(renderContextBatch, *lightBuffer);
+    if (asyncGlobalSDF)
+    {
+        // Wait for the async compute Global SDF (used by GI, reflections and materials later on)
+        GlobalSignDistanceFieldPass::BindingData bindingData;
+        GlobalSignDistanceFieldPass::Instance()->Render(renderContext, context, bindingData);
+    }
     if (EnumHasAnyFlags(renderContext.View.Flags, ViewFlags::GI))
     {
         switch (renderContext.List->Settings.GlobalIllumination.Mode)
@@ -558,6 +597,9 @@ void RenderInner(SceneRenderTask* task, RenderContext& renderContext, RenderCont
     // Material and Custom PostFx
     renderContext.List->RunPostFxPass(context, renderContext, MaterialPostFxLocation::BeforeForwardPass, PostProcessEffectLocation::BeforeForwardPass, lightBuffer);
 
+    // Build local lights grid (used by volumetric fog and forward shading)
+    ClusteredLightingPass::Instance()->Render(renderContext, context);
+
     // Render fog
     context->ResetSR();
     if (renderContext.List->AtmosphericFog)
@@ -613,6 +655,9 @@ void RenderInner(SceneRenderTask* task, RenderContext& renderContext, RenderCont
         Swap(frameBuffer, tempBuffer);
     }
 
+    // Generate shading rate image for the next frame
+    VariableRateShadingPass::Instance()->Render(renderContext, context, frameBuffer);
+
     // Upscaling after scene rendering but before post processing
     bool useUpscaling = task->RenderingPercentage < 1.0f;
     const Viewport outputViewport = task->GetOutputViewport();
@@ -5,10 +5,14 @@
 #include "Engine/Core/Memory/Memory.h"
 #include "Engine/Core/Types/BaseTypes.h"
 
+/// <summary>
+/// The memory allocation policy for the rendering data (eg. draw calls and instances buffers). Small allocations are carved from the large memory slabs (bump-pointer arena) which get reused in bulk once all of their allocations are freed (eg. when render lists are returned to the pool at the end of the frame). Big allocations are pooled by size.
+/// </summary>
 class RendererAllocation
 {
 public:
     static FLAXENGINE_API void* Allocate(uintptr size);
+    static FLAXENGINE_API bool Resize(void* ptr, uintptr size);
     static FLAXENGINE_API void Free(void* ptr, uintptr size);
 
     enum { HasSwap = true };
@@ -56,6 +60,15 @@ class RendererAllocation
 
         FORCE_INLINE void Relocate(uint64 capacity, int32 oldCount, int32 newCount)
         {
+            // Try to resize the last allocation in-place to skip items moving
+            if (_data && capacity != 0 && RendererAllocation::Resize(_data, capacity * sizeof(T)))
+            {
+                if (oldCount > newCount)
+                    Memory::DestructItems(_data + newCount, oldCount - newCount);
+                _size = capacity * sizeof(T);
+                return;
+            }
+
             T* newData = capacity != 0 ? (T*)RendererAllocation::Allocate(capacity * sizeof(T)) : nullptr;
             if (oldCount)
             {
@@ -14,6 +14,7 @@
 #include "Engine/Engine/Time.h"
 #include "Engine/Platform/Window.h"
 #include "Utils/MultiScaler.h"
+#include "Utils/HalfResRendering.h"
 #include "Engine/Engine/Engine.h"
 #include "Engine/Graphics/GPUContext.h"
 #include "Engine/Graphics/RenderTask.h"
@@ -48,6 +49,10 @@ PACK_STRUCT(struct Data
     float Intensity;
     float FadeOutDistance;
 
+    uint32 CheckerboardFrame;
+    float Checkerboard;
+    Float2 Dummy0;
+
     Matrix ViewMatrix;
     Matrix ViewProjectionMatrix;
 
@@ -172,6 +177,7 @@ void ScreenSpaceReflectionsPass::Render(RenderContext& renderContext, GPUTexture
     auto cb = shader->GetCB(0);
     auto& settings = renderContext.List->Settings.ScreenSpaceReflections;
     const bool useTemporal = settings.TemporalEffect && !renderContext.Task->IsCameraCut;
+    const bool useCheckerboard = Graphics::CheckerboardRendering;
 
     // Prepare resolutions for passes
     const int32 width = buffers->GetWidth();
@@ -242,6 +248,9 @@ void ScreenSpaceReflectionsPass::Render(RenderContext& renderContext, GPUTexture
     data.RayTraceStep = static_cast<float>(settings.DepthResolution) / (float)width;
     data.Intensity = settings.Intensity;
     data.FadeOutDistance = Math::Max(settings.FadeOutDistance, 100.0f);
+    data.CheckerboardFrame = HalfResRendering::GetCheckerboardFrame();
+    data.Checkerboard = useCheckerboard ? 1.0f : 0.0f;
+    data.Dummy0 = Float2::Zero;
     data.TemporalScale = settings.TemporalScale;
     data.TemporalResponse = settings.TemporalResponse;
     data.TemporalEffect = useTemporal ? 1.0f : 0.0f;
@@ -374,9 +383,21 @@ void ScreenSpaceReflectionsPass::Render(RenderContext& renderContext, GPUTexture
     context->DrawFullscreenTriangle();
     context->ResetRenderTarget();
 
+    // Checkerboard Reconstruction
+    GPUTexture* traceResult = traceBuffer;
+    if (useCheckerboard)
+    {
+        traceResult = HalfResRendering::Instance()->ReconstructCheckerboard(renderContext, context, TEXT("SSR.Checkerboard"), traceBuffer);
+
+        // Restore state
+        context->SetViewportAndScissors((float)traceWidth, (float)traceHeight);
+        context->BindCB(0, cb);
+        context->BindSR(3, smallerDepthBuffer);
+    }
+
     // Resolve Pass
     context->SetRenderTarget(resolveBuffer->View());
-    context->BindSR(TEXTURE0, traceBuffer->View());
+    context->BindSR(TEXTURE0, traceResult->View());
     context->SetState(_psResolvePass.Get(resolvePassIndex));
     context->DrawFullscreenTriangle();
     context->ResetRenderTarget();
@@ -411,6 +432,22 @@ void ScreenSpaceReflectionsPass::Render(RenderContext& renderContext, GPUTexture
 
     context->UnBindSR(TEXTURE1);
 
+    // Bilateral Upsample (prevents reflections leaking over the geometry edges)
+    GPUTexture* upsampleBuffer = nullptr;
+    if (reflectionsBuffer->Width() * 2 == width && reflectionsBuffer->Height() * 2 == height)
+    {
+        tempDesc = GPUTextureDescription::New2D(width, height, RESOLVE_PASS_OUTPUT_FORMAT);
+        upsampleBuffer = RenderTargetPool::Get(tempDesc);
+        RENDER_TARGET_POOL_SET_NAME(upsampleBuffer, "SSR.Upsample");
+        HalfResRendering::Instance()->Upsample(renderContext, context, reflectionsBuffer, upsampleBuffer->View());
+        reflectionsBuffer = upsampleBuffer;
+
+        // Restore state
+        context->BindCB(0, cb);
+        context->BindSR(1, buffers->GBuffer1);
+        context->BindSR(3, smallerDepthBuffer);
+    }
+
     // Mix Pass
     context->SetViewportAndScissors((float)width, (float)height);
     context->BindSR(TEXTURE0, reflectionsBuffer);
@@ -424,6 +461,7 @@ void ScreenSpaceReflectionsPass::Render(RenderContext& renderContext, GPUTexture
     RenderTargetPool::Release(colorBuffer1);
     RenderTargetPool::Release(traceBuffer);
     RenderTargetPool::Release(resolveBuffer);
+    RenderTargetPool::Release(upsampleBuffer);
 }
 
 #if COMPILE_WITH_DEV_ENV
@@ -3,13 +3,19 @@
 #include "ShadowsPass.h"
 #include "GBufferPass.h"
 #include "VolumetricFogPass.h"
+#include "Engine/Core/Collections/Dictionary.h"
 #include "Engine/Graphics/Graphics.h"
 #include "Engine/Graphics/GPUContext.h"
 #include "Engine/Graphics/RenderTask.h"
 #include "Engine/Graphics/RenderBuffers.h"
 #include "Engine/Graphics/PixelFormatExtensions.h"
+#include "Engine/Graphics/RenderTools.h"
 #include "Engine/Content/Content.h"
+#include "Engine/Engine/Engine.h"
+#include "Engine/Level/Actor.h"
+#include "Engine/Level/Scene/SceneRendering.h"
 #include "Engine/Scripting/Enums.h"
+#include "Engine/Utilities/RectPack.h"
 #if USE_EDITOR
 #include "Engine/Renderer/Lightmaps.h"
 #endif
@@ -17,6 +23,9 @@
 #define NormalOffsetScaleTweak 100.0f
 #define SpotLight_NearPlane 10.0f
 #define PointLight_NearPlane 10.0f
+#define STATIC_CACHE_ATLAS_SCALE 4 // Static shadows cache atlas resolution (relative to the local lights shadow map size)
+#define STATIC_CACHE_TILE_SIZE_MIN 64 // The minimum size of the static shadows cache tile
+#define STATIC_CACHE_LIGHT_LIFETIME 60 // Amount of frames after which unused light releases its cache tiles
 
 PACK_STRUCT(struct Data{
     GBufferData GBuffer;
@@ -29,6 +38,133 @@ PACK_STRUCT(struct Data{
     float ContactShadowsLength;
     });
 
+PACK_STRUCT(struct CopyDepthData{
+    Float4 CopyDepthUV;
+    });
+
+struct ShadowsCacheTile : RectPack<ShadowsCacheTile, uint16>
+{
+    ShadowsCacheTile(uint16 x, uint16 y, uint16 width, uint16 height)
+        : RectPack<ShadowsCacheTile, uint16>(x, y, width, height)
+    {
+    }
+
+    void OnInsert()
+    {
+    }
+
+    void OnFree()
+    {
+    }
+};
+
+struct ShadowsCacheLight
+{
+    uint64 LastFrameUsed = 0;
+    bool StaticValid = false;
+    int32 TileSize = 0;
+    ShadowsCacheTile* Tiles[6] = {};
+    BoundingSphere Bounds;
+    Matrix ShadowVP;
+
+    void FreeTiles()
+    {
+        StaticValid = false;
+        for (auto& tile : Tiles)
+        {
+            if (tile)
+            {
+                tile->Free();
+                tile = nullptr;
+            }
+        }
+    }
+};
+
+class ShadowsCustomBuffer : public RenderBuffers::CustomBuffer, public ISceneRenderingListener
+{
+public:
+    int32 Resolution = 0;
+    uint64 LastFrameAtlasInsertFail = 0;
+    uint64 LastFrameAtlasDefragmentation = 0;
+    GPUTexture* StaticAtlas = nullptr;
+    ShadowsCacheTile* AtlasTiles = nullptr;
+    Dictionary<Guid, ShadowsCacheLight> Lights;
+    Array<SceneRendering*, InlinedAllocation<8>> Scenes;
+
+    void ClearTiles()
+    {
+        for (auto& e : Lights)
+        {
+            e.Value.StaticValid = false;
+            Platform::MemoryClear(e.Value.Tiles, sizeof(e.Value.Tiles));
+            e.Value.TileSize = 0;
+        }
+        SAFE_DELETE(AtlasTiles);
+    }
+
+    void InvalidateAll()
+    {
+        for (auto& e : Lights)
+            e.Value.StaticValid = false;
+    }
+
+    void Listen(SceneRendering* scene)
+    {
+        if (Scenes.Contains(scene))
+            return;
+        Scenes.Add(scene);
+        ListenSceneRendering(scene);
+
+        // Objects added to the scene before are not tracked so redraw all lights
+        InvalidateAll();
+    }
+
+    void Invalidate(const BoundingSphere& bounds)
+    {
+        for (auto& e : Lights)
+        {
+            if (e.Value.StaticValid && e.Value.Bounds.Intersects(bounds))
+                e.Value.StaticValid = false;
+        }
+    }
+
+    ~ShadowsCustomBuffer()
+    {
+        SAFE_DELETE(AtlasTiles);
+        SAFE_DELETE_GPU_RESOURCE(StaticAtlas);
+    }
+
+    // [ISceneRenderingListener]
+    void OnSceneRenderingAddActor(Actor* a) override
+    {
+        if (a->HasStaticFlag(StaticFlags::Transform))
+            Invalidate(a->GetSphere());
+    }
+
+    void OnSceneRenderingUpdateActor(Actor* a, const BoundingSphere& prevBounds) override
+    {
+        // Dirty lights around static objects to redraw when changed (eg. moved in Editor or material modification)
+        if (a->HasStaticFlag(StaticFlags::Transform))
+        {
+            Invalidate(prevBounds);
+            Invalidate(a->GetSphere());
+        }
+    }
+
+    void OnSceneRenderingRemoveActor(Actor* a) override
+    {
+        if (a->HasStaticFlag(StaticFlags::Transform))
+            Invalidate(a->GetSphere());
+    }
+
+    void OnSceneRenderingClear(SceneRendering* scene) override
+    {
+        Scenes.Remove(scene);
+        InvalidateAll();
+    }
+};
+
 ShadowsPass::ShadowsPass()
     : _shader(nullptr)
     , _shadowMapsSizeCSM(0)
@@ -41,18 +177,6 @@ ShadowsPass::ShadowsPass()
 {
 }
 
-uint64 ShadowsPass::GetShadowMapsMemoryUsage() const
-{
-    uint64 result = 0;
-
-    if (_shadowMapCSM)
-        result += _shadowMapCSM->GetMemoryUsage();
-    if (_shadowMapCube)
-        result += _shadowMapCube->GetMemoryUsage();
-
-    return result;
-}
-
 String ShadowsPass::ToString() const
 {
     return TEXT("ShadowsPass");
@@ -64,6 +188,7 @@ bool ShadowsPass::Init()
     _psShadowDir.CreatePipelineStates();
     _psShadowPoint.CreatePipelineStates();
     _psShadowSpot.CreatePipelineStates();
+    _psCopyDepth = GPUDevice::Instance->CreatePipelineState();
 
     // Load assets
     _shader = Content::LoadAsyncInternal<Shader>(TEXT("Shaders/Shadows"));
@@ -76,6 +201,8 @@ bool ShadowsPass::Init()
     // Create shadow maps
     _shadowMapCSM = GPUDevice::Instance->CreateTexture(TEXT("Shadow Map CSM"));
     _shadowMapCube = GPUDevice::Instance->CreateTexture(TEXT("Shadow Map Cube"));
+    _shadowMapCSM->SetCategory(GPUResourceCategory::Shadows);
+    _shadowMapCube->SetCategory(GPUResourceCategory::Shadows);
 
 #if COMPILE_WITH_DEV_ENV
     _shader.Get()->OnReloading.Bind<ShadowsPass, &ShadowsPass::OnShaderReloading>(this);
@@ -116,6 +243,11 @@ bool ShadowsPass::setupResources()
         REPORT_INVALID_SHADER_PASS_CB_SIZE(shader, 0, Data);
         return true;
     }
+    if (shader->GetCB(1)->GetSize() != sizeof(CopyDepthData))
+    {
+        REPORT_INVALID_SHADER_PASS_CB_SIZE(shader, 1, CopyDepthData);
+        return true;
+    }
 
     // Create pipeline stages
     GPUPipelineState::Description psDesc;
@@ -141,6 +273,16 @@ bool ShadowsPass::setupResources()
         if (_psShadowSpot.Create(psDesc, shader, "PS_SpotLight"))
             return true;
     }
+    if (!_psCopyDepth->IsValid())
+    {
+        psDesc = GPUPipelineState::Description::DefaultFullscreenTriangle;
+        psDesc.PS = shader->GetPS("PS_CopyDepth");
+        psDesc.DepthEnable = true;
+        psDesc.DepthWriteEnable = true;
+        psDesc.DepthFunc = ComparisonFunc::Always;
+        if (_psCopyDepth->Init(psDesc))
+            return true;
+    }
 
     return false;
 }
@@ -197,7 +339,7 @@ void ShadowsPass::updateShadowMapSize()
     }
 }
 
-void ShadowsPass::SetupRenderContext(RenderContext& renderContext, RenderContext& shadowContext)
+void ShadowsPass::SetupRenderContext(RenderContext& renderContext, RenderContext& shadowContext, int32 lodBias)
 {
     const auto& view = renderContext.View;
 
@@ -210,7 +352,7 @@ void ShadowsPass::SetupRenderContext(RenderContext& renderContext, RenderContext
     shadowView.StaticFlagsMask = view.StaticFlagsMask;
     shadowView.RenderLayersMask = view.RenderLayersMask;
     shadowView.IsOfflinePass = view.IsOfflinePass;
-    shadowView.ModelLODBias = view.ModelLODBias;
+    shadowView.ModelLODBias = view.ModelLODBias + lodBias;
     shadowView.ModelLODDistanceFactor = view.ModelLODDistanceFactor;
     shadowView.Pass = DrawPass::Depth;
     shadowView.Origin = view.Origin;
@@ -433,7 +575,7 @@ void ShadowsPass::SetupLight(RenderContext& renderContext, RenderContextBatch& r
 
         // Setup context for cascade
         auto& shadowContext = renderContextBatch.Contexts[shadowData.ContextIndex + cascadeIndex];
-        SetupRenderContext(renderContext, shadowContext);
+        SetupRenderContext(renderContext, shadowContext, light.ShadowsLODBias + cascadeIndex * light.CascadeLODBias);
         shadowContext.List->Clear();
         shadowContext.View.Position = -lightDirection * shadowsDistance + view.Position;
         shadowContext.View.Direction = lightDirection;
@@ -474,13 +616,14 @@ void ShadowsPass::SetupLight(RenderContext& renderContext, RenderContextBatch& r
     for (int32 faceIndex = 0; faceIndex < 6; faceIndex++)
     {
         auto& shadowContext = renderContextBatch.Contexts[shadowData.ContextIndex + faceIndex];
-        SetupRenderContext(renderContext, shadowContext);
+        SetupRenderContext(renderContext, shadowContext, light.ShadowsLODBias);
         shadowContext.List->Clear();
         shadowContext.View.SetUpCube(PointLight_NearPlane, light.Radius, light.Position);
         shadowContext.View.SetFace(faceIndex);
         shadowContext.View.PrepareCache(shadowContext, shadowMapsSizeCube, shadowMapsSizeCube, Float2::Zero, &view);
         Matrix::Transpose(shadowContext.View.ViewProjection(), shadowData.Constants.ShadowVP[faceIndex]);
     }
+    SetupStaticCache(renderContext, renderContextBatch, shadowData, light.ID, light.Position, light.Radius);
 
     // Setup constant buffer data
     shadowData.Constants.ShadowMapSize = shadowMapsSizeCube;
@@ -514,12 +657,13 @@ void ShadowsPass::SetupLight(RenderContext& renderContext, RenderContextBatch& r
     constexpr int32 faceIndex = 0;
     {
         auto& shadowContext = renderContextBatch.Contexts[shadowData.ContextIndex + faceIndex];
-        SetupRenderContext(renderContext, shadowContext);
+        SetupRenderContext(renderContext, shadowContext, light.ShadowsLODBias);
         shadowContext.List->Clear();
         shadowContext.View.SetProjector(SpotLight_NearPlane, light.Radius, light.Position, light.Direction, light.UpVector, light.OuterConeAngle * 2.0f);
         shadowContext.View.PrepareCache(shadowContext, shadowMapsSizeCube, shadowMapsSizeCube, Float2::Zero, &view);
         Matrix::Transpose(shadowContext.View.ViewProjection(), shadowData.Constants.ShadowVP[faceIndex]);
     }
+    SetupStaticCache(renderContext, renderContextBatch, shadowData, light.ID, light.Position, light.Radius);
 
     // Setup constant buffer data
     shadowData.Constants.ShadowMapSize = shadowMapsSizeCube;
@@ -541,6 +685,7 @@ void ShadowsPass::Dispose()
     _psShadowDir.Delete();
     _psShadowPoint.Delete();
     _psShadowSpot.Delete();
+    SAFE_DELETE_GPU_RESOURCE(_psCopyDepth);
     _shader = nullptr;
     _sphereModel = nullptr;
     SAFE_DELETE_GPU_RESOURCE(_shadowMapCSM);
@@ -553,6 +698,7 @@ void ShadowsPass::Prepare()
     _shadowData.Clear();
     LastDirLightIndex = -1;
     LastDirLightShadowMap = nullptr;
+    _staticCache = nullptr;
 }
 
 void ShadowsPass::SetupShadows(RenderContext& renderContext, RenderContextBatch& renderContextBatch)
@@ -567,6 +713,60 @@ void ShadowsPass::SetupShadows(RenderContext& renderContext, RenderContextBatch&
     auto shadowsQuality = Graphics::ShadowsQuality;
     maxShadowsQuality = Math::Clamp(Math::Min<int32>(static_cast<int32>(shadowsQuality), static_cast<int32>(view.MaxShadowsQuality)), 0, static_cast<int32>(Quality::MAX) - 1);
 
+    // Prepare static shadows cache for local lights (skipped for custom actors that don't report static objects changes)
+    _staticCache = nullptr;
+    if (Graphics::StaticShadowsCaching &&
+        !view.IsOfflinePass &&
+        renderContext.Buffers &&
+        renderContext.Task &&
+        !EnumHasAnyFlags(renderContext.Task->ActorsSource, ActorsSources::CustomActors) &&
+        _psCopyDepth->IsValid() &&
+        _shadowMapsSizeCube > 0)
+    {
+        auto& cache = *renderContext.Buffers->GetCustomBuffer<ShadowsCustomBuffer>(TEXT("Shadows"));
+        const uint64 currentFrame = Engine::FrameCount;
+        cache.LastFrameUsed = currentFrame;
+        const int32 resolution = _shadowMapsSizeCube * STATIC_CACHE_ATLAS_SCALE;
+        if (cache.Resolution != resolution)
+        {
+            PROFILE_CPU_NAMED("Init");
+            cache.ClearTiles();
+            cache.Resolution = 0;
+            if (!cache.StaticAtlas)
+            {
+                cache.StaticAtlas = GPUDevice::Instance->CreateTexture(TEXT("Shadows.StaticAtlas"));
+                cache.StaticAtlas->SetCategory(GPUResourceCategory::Shadows);
+            }
+            if (cache.StaticAtlas->Init(GPUTextureDescription::New2D(resolution, resolution, _shadowMapFormat, GPUTextureFlags::ShaderResource | GPUTextureFlags::DepthStencil)))
+                LOG(Error, "Cannot setup static shadows cache atlas. Size: {0}, format: {1}.", resolution, ScriptingEnum::ToString(_shadowMapFormat));
+            else
+                cache.Resolution = resolution;
+        }
+        if (cache.Resolution != 0)
+        {
+            // Defragment atlas if it's full
+            if (currentFrame - cache.LastFrameAtlasInsertFail < 10 &&
+                currentFrame - cache.LastFrameAtlasDefragmentation > 60)
+            {
+                cache.LastFrameAtlasDefragmentation = currentFrame;
+                cache.ClearTiles();
+            }
+            if (!cache.AtlasTiles)
+                cache.AtlasTiles = New<ShadowsCacheTile>(0, 0, resolution, resolution);
+
+            // Remove unused lights
+            for (auto it = cache.Lights.Begin(); it.IsNotEnd(); ++it)
+            {
+                if (currentFrame - it->Value.LastFrameUsed > STATIC_CACHE_LIGHT_LIFETIME)
+                {
+                    it->Value.FreeTiles();
+                    cache.Lights.Remove(it);
+                }
+            }
+            _staticCache = &cache;
+        }
+    }
+
     // Create shadow projections for lights
     for (auto& light : renderContext.List->DirectionalLights)
     {
@@ -585,6 +785,63 @@ void ShadowsPass::SetupShadows(RenderContext& renderContext, RenderContextBatch&
     }
 }
 
+void ShadowsPass::SetupStaticCache(RenderContext& renderContext, RenderContextBatch& renderContextBatch, ShadowData& shadowData, const Guid& lightId, const Float3& lightPosition, float lightRadius)
+{
+    if (!_staticCache)
+        return;
+    auto& cache = *_staticCache;
+    const auto& view = renderContext.View;
+    const uint64 currentFrame = Engine::FrameCount;
+    auto& light = cache.Lights[lightId];
+    light.LastFrameUsed = currentFrame;
+
+    // Scale the cached depth resolution by the light size on the screen
+    const int32 shadowMapSize = _shadowMapsSizeCube;
+    const float screenSize = Math::Sqrt(RenderTools::ComputeBoundsScreenRadiusSquared(lightPosition, lightRadius, view)) * 2.0f;
+    const int32 tileSize = Math::Clamp(Math::RoundUpToPowerOf2((int32)((float)shadowMapSize * screenSize)), Math::Min(STATIC_CACHE_TILE_SIZE_MIN, shadowMapSize), shadowMapSize);
+
+    // Invalidate cached depth when light gets changed
+    const Matrix& shadowVP = shadowData.Constants.ShadowVP[0];
+    if (light.TileSize != tileSize)
+    {
+        light.FreeTiles();
+        light.TileSize = tileSize;
+    }
+    if (light.ShadowVP != shadowVP)
+    {
+        light.ShadowVP = shadowVP;
+        light.StaticValid = false;
+    }
+    light.Bounds = BoundingSphere(view.Origin + Vector3(lightPosition), lightRadius);
+
+    // Allocate atlas tiles
+    for (int32 faceIndex = 0; faceIndex < shadowData.ContextCount; faceIndex++)
+    {
+        if (light.Tiles[faceIndex])
+            continue;
+        light.StaticValid = false;
+        light.Tiles[faceIndex] = cache.AtlasTiles->Insert(tileSize, tileSize, 0);
+        if (!light.Tiles[faceIndex])
+        {
+            // Atlas is full so draw light without cache
+            cache.LastFrameAtlasInsertFail = currentFrame;
+            light.FreeTiles();
+            return;
+        }
+    }
+
+    // Static objects get drawn only when cached depth is invalid
+    shadowData.StaticAtlas = cache.StaticAtlas;
+    shadowData.StaticLightId = lightId;
+    shadowData.StaticDirty = !light.StaticValid;
+    for (int32 faceIndex = 0; faceIndex < shadowData.ContextCount; faceIndex++)
+    {
+        const ShadowsCacheTile* tile = light.Tiles[faceIndex];
+        shadowData.StaticTiles[faceIndex] = Float3((float)tile->X, (float)tile->Y, (float)tileSize);
+        renderContextBatch.Contexts[shadowData.ContextIndex + faceIndex].List->StaticDepth = shadowData.StaticDirty ? StaticDepthMode::Split : StaticDepthMode::Skip;
+    }
+}
+
 bool ShadowsPass::CanRenderShadow(const RenderContext& renderContext, const RendererPointLightData& light)
 {
     const Float3 lightPosition = light.Position;
@@ -614,6 +871,81 @@ bool ShadowsPass::CanRenderShadow(const RenderContext& renderContext, const Rend
     return _shadowMapFormat != PixelFormat::Unknown;
 }
 
+void ShadowsPass::RenderShadowMap(GPUContext* context, RenderContextBatch& renderContextBatch, const ShadowData& shadowData, int32 faceIndex)
+{
+    RenderContext& renderContext = renderContextBatch.GetMainContext();
+    auto& shadowContext = renderContextBatch.Contexts[shadowData.ContextIndex + faceIndex];
+    const auto shadowMapsSizeCube = (float)_shadowMapsSizeCube;
+    const auto rt = _shadowMapCube->View(faceIndex);
+    context->ResetSR();
+    if (shadowData.StaticAtlas)
+    {
+        auto shader = _shader->GetShader();
+        const Float3 tile = shadowData.StaticTiles[faceIndex];
+        CopyDepthData data;
+        if (shadowData.StaticDirty)
+        {
+            // Draw static objects depth (at the tile resolution) and copy it into the atlas tile
+            context->SetViewportAndScissors(Viewport(0, 0, tile.Z, tile.Z));
+            context->SetRenderTarget(rt, static_cast<GPUTextureView*>(nullptr));
+            context->ClearDepth(rt);
+            shadowContext.List->ExecuteDrawCalls(shadowContext, shadowContext.List->StaticDepthDrawCallsList, shadowContext.List->DrawCalls, nullptr);
+            shadowContext.List->ExecuteDrawCalls(shadowContext, shadowContext.List->ShadowStaticDepthDrawCallsList, renderContext.List->DrawCalls, nullptr);
+            context->ResetRenderTarget();
+            data.CopyDepthUV = Float4(0, 0, tile.Z / shadowMapsSizeCube, tile.Z / shadowMapsSizeCube);
+            context->UpdateCB(shader->GetCB(1), &data);
+            context->BindCB(1, shader->GetCB(1));
+            context->BindSR(0, rt);
+            context->SetViewportAndScissors(Viewport(tile.X, tile.Y, tile.Z, tile.Z));
+            context->SetRenderTarget(shadowData.StaticAtlas->View(), static_cast<GPUTextureView*>(nullptr));
+            context->SetState(_psCopyDepth);
+            context->DrawFullscreenTriangle();
+            context->ResetRenderTarget();
+            context->UnBindSR(0);
+        }
+
+        // Copy cached static objects depth from the atlas tile
+        const float atlasSizeInv = 1.0f / (float)shadowData.StaticAtlas->Width();
+        data.CopyDepthUV = Float4(tile.X * atlasSizeInv, tile.Y * atlasSizeInv, tile.Z * atlasSizeInv, tile.Z * atlasSizeInv);
+        context->UpdateCB(shader->GetCB(1), &data);
+        context->BindCB(1, shader->GetCB(1));
+        context->BindSR(0, shadowData.StaticAtlas->View());
+        context->SetViewportAndScissors(shadowMapsSizeCube, shadowMapsSizeCube);
+        context->SetRenderTarget(rt, static_cast<GPUTextureView*>(nullptr));
+        context->SetState(_psCopyDepth);
+        context->DrawFullscreenTriangle();
+        context->UnBindSR(0);
+    }
+    else
+    {
+        context->SetViewportAndScissors(shadowMapsSizeCube, shadowMapsSizeCube);
+        context->SetRenderTarget(rt, static_cast<GPUTextureView*>(nullptr));
+        context->ClearDepth(rt);
+    }
+
+    // Draw dynamic objects depth
+    shadowContext.List->ExecuteDrawCalls(shadowContext, DrawCallsListType::Depth);
+    shadowContext.List->ExecuteDrawCalls(shadowContext, shadowContext.List->ShadowDepthDrawCallsList, renderContext.List->DrawCalls, nullptr);
+}
+
+void ShadowsPass::OnStaticCacheRendered(const RenderContext& renderContext, const ShadowData& shadowData)
+{
+    if (!shadowData.StaticAtlas)
+        return;
+
+    // Track static objects changes in the rendered scenes
+    for (SceneRendering* scene : renderContext.List->Scenes)
+        _staticCache->Listen(scene);
+
+    // Static objects depth is now cached (including objects from the scenes that started to be tracked in this frame)
+    if (shadowData.StaticDirty)
+    {
+        ShadowsCacheLight* light = _staticCache->Lights.TryGet(shadowData.StaticLightId);
+        if (light)
+            light->StaticValid = true;
+    }
+}
+
 void ShadowsPass::RenderShadow(RenderContextBatch& renderContextBatch, RendererPointLightData& light, GPUTextureView* shadowMask)
 {
     if (light.ShadowDataIndex == -1)
@@ -629,21 +961,10 @@ void ShadowsPass::RenderShadow(RenderContextBatch& renderContextBatch, RendererP
     // TODO: here we can use lower shadows quality based on light distance to view (LOD switching) and per light setting for max quality
     int32 shadowQuality = maxShadowsQuality;
 
-    // Set up GPU context and render view
-    const auto shadowMapsSizeCube = (float)_shadowMapsSizeCube;
-    context->SetViewportAndScissors(shadowMapsSizeCube, shadowMapsSizeCube);
-
     // Render depth to all 6 faces of the cube map
     for (int32 faceIndex = 0; faceIndex < 6; faceIndex++)
-    {
-        auto rt = _shadowMapCube->View(faceIndex);
-        context->ResetSR();
-        context->SetRenderTarget(rt, static_cast<GPUTextureView*>(nullptr));
-        context->ClearDepth(rt);
-        auto& shadowContext = renderContextBatch.Contexts[shadowData.ContextIndex + faceIndex];
-        shadowContext.List->ExecuteDrawCalls(shadowContext, DrawCallsListType::Depth);
-        shadowContext.List->ExecuteDrawCalls(shadowContext, shadowContext.List->ShadowDepthDrawCallsList, renderContext.List->DrawCalls, nullptr);
-    }
+        RenderShadowMap(context, renderContextBatch, shadowData, faceIndex);
+    OnStaticCacheRendered(renderContext, shadowData);
 
     // Restore GPU context
     context->ResetSR();
@@ -707,21 +1028,10 @@ void ShadowsPass::RenderShadow(RenderContextBatch& renderContextBatch, RendererS
     // TODO: here we can use lower shadows quality based on light distance to view (LOD switching) and per light setting for max quality
     int32 shadowQuality = maxShadowsQuality;
 
-    // Set up GPU context and render view
-    const auto shadowMapsSizeCube = (float)_shadowMapsSizeCube;
-    context->SetViewportAndScissors(shadowMapsSizeCube, shadowMapsSizeCube);
-
     // Render depth to all 1 face of the cube map
     constexpr int32 faceIndex = 0;
-    {
-        auto rt = _shadowMapCube->View(faceIndex);
-        context->ResetSR();
-        context->SetRenderTarget(rt, static_cast<GPUTextureView*>(nullptr));
-        context->ClearDepth(rt);
-        auto& shadowContext = renderContextBatch.Contexts[shadowData.ContextIndex + faceIndex];
-        shadowContext.List->ExecuteDrawCalls(shadowContext, DrawCallsListType::Depth);
-        shadowContext.List->ExecuteDrawCalls(shadowContext, shadowContext.List->ShadowDepthDrawCallsList, renderContext.List->DrawCalls, nullptr);
-    }
+    RenderShadowMap(context, renderContextBatch, shadowData, faceIndex);
+    OnStaticCacheRendered(renderContext, shadowData);
 
     // Restore GPU context
     context->ResetSR();
@@ -47,6 +47,10 @@ class ShadowsPass : public RendererPass<ShadowsPass>
         int32 ContextIndex;
         int32 ContextCount;
         bool BlendCSM;
+        bool StaticDirty = false;
+        GPUTexture* StaticAtlas = nullptr;
+        Guid StaticLightId;
+        Float3 StaticTiles[6]; // X, Y and size of the static depth tiles (in atlas texels)
         LightShadowData Constants;
     };
 
@@ -55,6 +59,7 @@ class ShadowsPass : public RendererPass<ShadowsPass>
     GPUPipelineStatePermutationsPs<static_cast<int32>(Quality::MAX) * 2 * 2> _psShadowDir;
     GPUPipelineStatePermutationsPs<static_cast<int32>(Quality::MAX) * 2> _psShadowPoint;
     GPUPipelineStatePermutationsPs<static_cast<int32>(Quality::MAX) * 2> _psShadowSpot;
+    GPUPipelineState* _psCopyDepth = nullptr;
     PixelFormat _shadowMapFormat;
 
     // Shadow maps stuff
@@ -67,6 +72,7 @@ class ShadowsPass : public RendererPass<ShadowsPass>
     // Shadow map rendering stuff
     AssetReference<Model> _sphereModel;
     Array<ShadowData> _shadowData;
+    class ShadowsCustomBuffer* _staticCache = nullptr;
 
     // Cached state for the current frame rendering (setup via Prepare)
     int32 maxShadowsQuality;
@@ -78,14 +84,6 @@ class ShadowsPass : public RendererPass<ShadowsPass>
     /// </summary>
     ShadowsPass();
 
-public:
-
-    /// <summary>
-    /// Gets current GPU memory usage by the shadow maps
-    /// </summary>
-    /// <returns>GPU memory used in bytes</returns>
-    uint64 GetShadowMapsMemoryUsage() const;
-
 public:
 
     // TODO: use full scene shadow map atlas with dynamic slots allocation
@@ -153,10 +151,13 @@ class ShadowsPass : public RendererPass<ShadowsPass>
 private:
 
     void updateShadowMapSize();
-    void SetupRenderContext(RenderContext& renderContext, RenderContext& shadowContext);
+    void SetupRenderContext(RenderContext& renderContext, RenderContext& shadowContext, int32 lodBias);
     void SetupLight(RenderContext& renderContext, RenderContextBatch& renderContextBatch, RendererDirectionalLightData& light);
     void SetupLight(RenderContext& renderContext, RenderContextBatch& renderContextBatch, RendererPointLightData& light);
     void SetupLight(RenderContext& renderContext, RenderContextBatch& renderContextBatch, RendererSpotLightData& light);
+    void SetupStaticCache(RenderContext& renderContext, RenderContextBatch& renderContextBatch, ShadowData& shadowData, const Guid& lightId, const Float3& lightPosition, float lightRadius);
+    void RenderShadowMap(GPUContext* context, RenderContextBatch& renderContextBatch, const ShadowData& shadowData, int32 faceIndex);
+    void OnStaticCacheRendered(const RenderContext& renderContext, const ShadowData& shadowData);
 
 #if COMPILE_WITH_DEV_ENV
     void OnShaderReloading(Asset* obj)
@@ -164,6 +165,7 @@ class ShadowsPass : public RendererPass<ShadowsPass>
         _psShadowDir.Release();
         _psShadowPoint.Release();
         _psShadowSpot.Release();
+        _psCopyDepth->ReleaseGPU();
         invalidateResources();
     }
 #endif
@@ -0,0 +1,422 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "GPUDrivenCulling.h"
+#include "Engine/Content/Content.h"
+#include "Engine/Content/Assets/Model.h"
+#include "Engine/Graphics/Graphics.h"
+#include "Engine/Graphics/GPUBuffer.h"
+#include "Engine/Graphics/GPUContext.h"
+#include "Engine/Graphics/GPUDevice.h"
+#include "Engine/Graphics/GPULimits.h"
+#include "Engine/Graphics/Shaders/GPUShader.h"
+#include "Engine/Graphics/RenderTask.h"
+#include "Engine/Graphics/Materials/IMaterial.h"
+#include "Engine/Graphics/Models/Types.h"
+#include "Engine/Renderer/RenderList.h"
+#include "Engine/Renderer/HiZPass.h"
+
+#define CULL_INSTANCES_GROUP_SIZE 64
+#define CULL_MESHLETS_MAX_GROUPS_X 65535
+
+static_assert(sizeof(InstanceData) == 64, "Update INSTANCE_DATA_SIZE in GPUDrivenCulling shader.");
+static_assert(sizeof(GPUDrivenCulling::InstanceBounds) == 24, "Update InstanceBounds in GPUDrivenCulling shader.");
+static_assert(sizeof(Meshlet) == 40, "Update Meshlet in GPUDrivenCulling shader.");
+static_assert(sizeof(GPUDrivenCulling::LODInstance) == 80, "Update LODInstance in GPUDrivenCulling shader.");
+static_assert(MODEL_MAX_LODS <= 8, "Update LODScreenRadiusSquared in GPUDrivenCulling shader.");
+
+PACK_STRUCT(struct Data {
+    Float4 FrustumPlanes[6];
+    Matrix HiZViewProjection;
+    Float2 HiZSize;
+    uint32 InstancesCount;
+    uint32 HiZMipLevels;
+    });
+
+PACK_STRUCT(struct MeshletsData {
+    Matrix World;
+    Float3 ViewPositionLocal;
+    float WorldScale;
+    uint32 MeshletsCount;
+    uint32 ArgsOffset;
+    uint32 IndexOffset;
+    uint32 ConeCulling;
+    });
+
+PACK_STRUCT(struct LODInstancesData {
+    Float3 InstancesOffset;
+    uint32 LODInstancesCount;
+    Float3 CullViewPosition;
+    float LODScreenMultiple;
+    Float3 LODViewPosition;
+    float LODDistanceScale;
+    float LODScreenRadiusSquared[8];
+    float MinScreenRadiusSquared;
+    int32 LODBias;
+    uint32 MinLOD;
+    uint32 MaxLOD;
+    uint32 LODsCount;
+    uint32 InstancesStart;
+    uint32 ArgsStart;
+    uint32 ArgsCount;
+    uint32 CountersOffset;
+    float LODDistanceFactor;
+    Float2 Padding;
+    });
+
+namespace
+{
+    bool EnsureBufferSize(GPUBuffer* buffer, uint32 size, GPUBufferFlags flags, uint32 stride)
+    {
+        if (buffer->GetSize() >= size)
+            return false;
+        size = Math::AlignUp<uint32>((uint32)(size * 1.3f), stride * 32);
+        PixelFormat format = PixelFormat::Unknown;
+        if (EnumHasAnyFlags(flags, GPUBufferFlags::RawBuffer))
+            format = PixelFormat::R32_Typeless;
+        else if (EnumHasAnyFlags(flags, GPUBufferFlags::IndexBuffer))
+            format = PixelFormat::R32_UInt;
+        return buffer->Init(GPUBufferDescription::Buffer(size, flags, format, nullptr, stride));
+    }
+}
+
+GPUDrivenCulling::GPUDrivenCulling()
+    : _boundsBuffer(0, sizeof(InstanceBounds), false, TEXT("GPUDrivenCulling.Bounds"))
+{
+}
+
+String GPUDrivenCulling::ToString() const
+{
+    return TEXT("GPUDrivenCulling");
+}
+
+bool GPUDrivenCulling::Init()
+{
+    // Draw indirect and compute shaders support is required for this implementation
+    const auto& limits = GPUDevice::Instance->Limits;
+    if (!limits.HasDrawIndirect || !limits.HasCompute)
+        return false;
+
+    // Create buffers
+    _inputBuffer = GPUDevice::Instance->CreateBuffer(TEXT("GPUDrivenCulling.Input"));
+    _outputBuffer = GPUDevice::Instance->CreateBuffer(TEXT("GPUDrivenCulling.Output"));
+    _instanceBuffer = GPUDevice::Instance->CreateBuffer(TEXT("GPUDrivenCulling.Instances"));
+    _argsBuffer = GPUDevice::Instance->CreateBuffer(TEXT("GPUDrivenCulling.Args"));
+    _meshletIndexBuffer = GPUDevice::Instance->CreateBuffer(TEXT("GPUDrivenCulling.MeshletIndices"));
+    _meshletArgsBuffer = GPUDevice::Instance->CreateBuffer(TEXT("GPUDrivenCulling.MeshletArgs"));
+    _lodSlotsBuffer = GPUDevice::Instance->CreateBuffer(TEXT("GPUDrivenCulling.LODSlots"));
+    _lodCountersBuffer = GPUDevice::Instance->CreateBuffer(TEXT("GPUDrivenCulling.LODCounters"));
+
+    // Load asset
+    _shader = Content::LoadAsyncInternal<Shader>(TEXT("Shaders/GPUDrivenCulling"));
+    if (_shader == nullptr)
+        return true;
+#if COMPILE_WITH_DEV_ENV
+    _shader.Get()->OnReloading.Bind<GPUDrivenCulling, &GPUDrivenCulling::OnShaderReloading>(this);
+#endif
+
+    return false;
+}
+
+bool GPUDrivenCulling::setupResources()
+{
+    // Check if shader has not been loaded
+    if (!_shader || !_shader->IsLoaded())
+        return true;
+    const auto shader = _shader->GetShader();
+
+    // Validate shader constant buffer size
+    _cb = shader->GetCB(0);
+    if (_cb->GetSize() != sizeof(Data))
+    {
+        REPORT_INVALID_SHADER_PASS_CB_SIZE(shader, 0, Data);
+        return true;
+    }
+    _meshletsCB = shader->GetCB(1);
+    if (_meshletsCB->GetSize() != sizeof(MeshletsData))
+    {
+        REPORT_INVALID_SHADER_PASS_CB_SIZE(shader, 1, MeshletsData);
+        return true;
+    }
+    _lodInstancesCB = shader->GetCB(2);
+    if (_lodInstancesCB->GetSize() != sizeof(LODInstancesData))
+    {
+        REPORT_INVALID_SHADER_PASS_CB_SIZE(shader, 2, LODInstancesData);
+        return true;
+    }
+
+    // Cache compute shaders
+    _cullInstancesCS = shader->GetCS("CS_CullInstances");
+    _cullMeshletsCS = shader->GetCS("CS_CullMeshlets");
+    _cullLODInstancesCS = shader->GetCS("CS_CullLODInstances");
+    _lodInstancesArgsCS = shader->GetCS("CS_LODInstancesArgs");
+    _scatterLODInstancesCS = shader->GetCS("CS_ScatterLODInstances");
+
+    return false;
+}
+
+void GPUDrivenCulling::Dispose()
+{
+    // Base
+    RendererPass::Dispose();
+
+    // Cleanup
+    SAFE_DELETE_GPU_RESOURCE(_inputBuffer);
+    SAFE_DELETE_GPU_RESOURCE(_outputBuffer);
+    SAFE_DELETE_GPU_RESOURCE(_instanceBuffer);
+    SAFE_DELETE_GPU_RESOURCE(_argsBuffer);
+    SAFE_DELETE_GPU_RESOURCE(_meshletIndexBuffer);
+    SAFE_DELETE_GPU_RESOURCE(_meshletArgsBuffer);
+    SAFE_DELETE_GPU_RESOURCE(_lodSlotsBuffer);
+    SAFE_DELETE_GPU_RESOURCE(_lodCountersBuffer);
+    _boundsBuffer.Dispose();
+    _cb = nullptr;
+    _meshletsCB = nullptr;
+    _lodInstancesCB = nullptr;
+    _cullInstancesCS = nullptr;
+    _cullMeshletsCS = nullptr;
+    _cullLODInstancesCS = nullptr;
+    _lodInstancesArgsCS = nullptr;
+    _scatterLODInstancesCS = nullptr;
+    _shader = nullptr;
+}
+
+bool GPUDrivenCulling::CanUse()
+{
+    return Graphics::GPUDrivenCulling && _argsBuffer && !checkIfSkipPass();
+}
+
+bool GPUDrivenCulling::Cull(GPUContext* context, const RenderContext& renderContext, GPUBuffer* instances, int32 instancesCount, const Array<InstanceBounds, RendererAllocation>& bounds, const Array<GPUDrawIndexedIndirectArgs, RendererAllocation>& args)
+{
+    ASSERT(context && instances && bounds.HasItems() && args.HasItems());
+    PROFILE_GPU_CPU("GPU-Driven Culling");
+    if (checkIfSkipPass())
+        return true;
+
+    // Prepare buffers (instances are compacted into raw buffer and copied into the vertex buffer because raw views cannot use the per-instance vertex stride)
+    const uint32 instancesSize = instancesCount * sizeof(InstanceData);
+    const uint32 argsSize = args.Count() * sizeof(GPUDrawIndexedIndirectArgs);
+    if (EnsureBufferSize(_inputBuffer, instancesSize, GPUBufferFlags::RawBuffer | GPUBufferFlags::ShaderResource, sizeof(uint32)) ||
+        EnsureBufferSize(_outputBuffer, instancesSize, GPUBufferFlags::RawBuffer | GPUBufferFlags::UnorderedAccess, sizeof(uint32)) ||
+        EnsureBufferSize(_instanceBuffer, instancesSize, GPUBufferFlags::VertexBuffer, sizeof(InstanceData)) ||
+        EnsureBufferSize(_argsBuffer, argsSize, GPUBufferFlags::RawBuffer | GPUBufferFlags::Argument | GPUBufferFlags::UnorderedAccess, sizeof(uint32)))
+    {
+        LOG(Error, "Failed to setup GPU-driven culling buffers.");
+        return true;
+    }
+    context->CopyBuffer(_inputBuffer, instances, instancesSize);
+    context->UpdateBuffer(_argsBuffer, args.Get(), argsSize);
+    _boundsBuffer.Clear();
+    _boundsBuffer.Write(bounds.Get(), bounds.Count() * sizeof(InstanceBounds));
+    _boundsBuffer.Flush(context);
+
+    // Setup constants buffer
+    BindCullingData(context, renderContext, bounds.Count());
+
+    // Cull instances
+    context->BindSR(0, _inputBuffer->View());
+    context->BindSR(1, _boundsBuffer.GetBuffer()->View());
+    context->BindUA(0, _outputBuffer->View());
+    context->BindUA(1, _argsBuffer->View());
+    context->Dispatch(_cullInstancesCS, Math::DivideAndRoundUp<uint32>(bounds.Count(), CULL_INSTANCES_GROUP_SIZE), 1, 1);
+    context->ResetUA();
+    context->ResetSR();
+    context->CopyBuffer(_instanceBuffer, _outputBuffer, instancesSize);
+
+    return false;
+}
+
+bool GPUDrivenCulling::CanCullMeshlets(const DrawCall& drawCall)
+{
+    if (!drawCall.Geometry.Meshlets || drawCall.InstanceCount != 1 || drawCall.Draw.StartIndex != 0)
+        return false;
+
+    // Vertices offset in a material shader can move triangles outside the clusters bounds
+    const MaterialInfo& info = drawCall.Material->GetInfo();
+    return !EnumHasAnyFlags(info.UsageFlags, MaterialUsageFlags::UsePositionOffset | MaterialUsageFlags::UseDisplacement);
+}
+
+bool GPUDrivenCulling::CullMeshlets(GPUContext* context, const RenderContext& renderContext, const Array<const DrawCall*, RendererAllocation>& drawCalls)
+{
+    ASSERT(context && drawCalls.HasItems());
+    PROFILE_GPU_CPU("Meshlets Culling");
+    if (checkIfSkipPass())
+        return true;
+
+    // Prepare buffers (each draw call gets the range of the index buffer for the visible triangles)
+    Array<GPUDrawIndexedIndirectArgs, RendererAllocation> args;
+    args.Resize(drawCalls.Count());
+    uint32 indicesCount = 0;
+    for (int32 i = 0; i < drawCalls.Count(); i++)
+    {
+        auto& drawArgs = args.Get()[i];
+        drawArgs.IndicesCount = 0;
+        drawArgs.InstanceCount = 1;
+        drawArgs.StartIndex = indicesCount;
+        drawArgs.StartVertex = 0;
+        drawArgs.StartInstance = 0;
+        indicesCount += drawCalls.Get()[i]->Draw.IndicesCount;
+    }
+    const uint32 argsSize = args.Count() * sizeof(GPUDrawIndexedIndirectArgs);
+    if (EnsureBufferSize(_meshletIndexBuffer, indicesCount * sizeof(uint32), GPUBufferFlags::IndexBuffer | GPUBufferFlags::UnorderedAccess, sizeof(uint32)) ||
+        EnsureBufferSize(_meshletArgsBuffer, argsSize, GPUBufferFlags::RawBuffer | GPUBufferFlags::Argument | GPUBufferFlags::UnorderedAccess, sizeof(uint32)))
+    {
+        LOG(Error, "Failed to setup GPU-driven culling buffers.");
+        return true;
+    }
+    context->UpdateBuffer(_meshletArgsBuffer, args.Get(), argsSize);
+
+    // Setup constants buffer
+    BindCullingData(context, renderContext, 0);
+
+    // Backface culling is valid only for the perspective views of the geometry rendered with the material culling mode
+    const bool coneCulling = EnumHasAnyFlags(renderContext.View.Pass, DrawPass::GBuffer) && renderContext.View.IsPerspectiveProjection();
+
+    // Cull meshlets of each draw call (a thread group per meshlet)
+    context->BindUA(0, _meshletIndexBuffer->View());
+    context->BindUA(1, _meshletArgsBuffer->View());
+    for (int32 i = 0; i < drawCalls.Count(); i++)
+    {
+        const DrawCall& drawCall = *drawCalls.Get()[i];
+        MeshletsData data;
+        Matrix::Transpose(drawCall.World, data.World);
+        Matrix invWorld;
+        Matrix::Invert(drawCall.World, invWorld);
+        Float3::Transform(renderContext.View.Position, invWorld, data.ViewPositionLocal);
+        data.WorldScale = drawCall.World.GetScaleVector().GetAbsolute().MaxValue();
+        data.MeshletsCount = drawCall.Geometry.Meshlets->GetElementsCount();
+        data.ArgsOffset = i * sizeof(GPUDrawIndexedIndirectArgs);
+        data.IndexOffset = args.Get()[i].StartIndex;
+        data.ConeCulling = coneCulling && drawCall.Material->GetInfo().CullMode == CullMode::Normal ? 1 : 0;
+        context->UpdateCB(_meshletsCB, &data);
+        context->BindCB(1, _meshletsCB);
+        context->BindSR(0, drawCall.Geometry.IndexBuffer->View());
+        context->BindSR(1, drawCall.Geometry.Meshlets->View());
+        const uint32 groupsX = Math::Min<uint32>(data.MeshletsCount, CULL_MESHLETS_MAX_GROUPS_X);
+        context->Dispatch(_cullMeshletsCS, groupsX, Math::DivideAndRoundUp<uint32>(data.MeshletsCount, groupsX), 1);
+    }
+    context->ResetUA();
+    context->ResetSR();
+
+    return false;
+}
+
+bool GPUDrivenCulling::CullLODInstances(GPUContext* context, const RenderContext& renderContext, Array<LODInstances, RendererAllocation>& batches, GPUBuffer* instances, GPUBuffer* args)
+{
+    ASSERT(context && instances && args && batches.HasItems());
+    PROFILE_GPU_CPU("LOD Instances Culling");
+    if (checkIfSkipPass())
+        return true;
+
+    // Prepare draw arguments for each mesh of each LOD (instance count holds the LOD index until the culling writes the visible instances count)
+    Array<GPUDrawIndexedIndirectArgs, RendererAllocation> argsData;
+    uint32 instancesCount = 0;
+    for (LODInstances& batch : batches)
+    {
+        batch.ArgsOffset = argsData.Count() * sizeof(GPUDrawIndexedIndirectArgs);
+        for (int32 lodIndex = 0; lodIndex < batch.Model->LODs.Count(); lodIndex++)
+        {
+            for (const Mesh& mesh : batch.Model->LODs.Get()[lodIndex].Meshes)
+            {
+                auto& drawArgs = argsData.AddOne();
+                drawArgs.IndicesCount = mesh.GetTriangleCount() * 3;
+                drawArgs.InstanceCount = lodIndex;
+                drawArgs.StartIndex = 0;
+                drawArgs.StartVertex = 0;
+                drawArgs.StartInstance = 0;
+            }
+        }
+        instancesCount += batch.InstancesCount;
+    }
+    if (argsData.IsEmpty() || instancesCount == 0)
+        return true;
+
+    // Prepare buffers (instances are written into raw buffer and copied into the vertex buffer because raw views cannot use the per-instance vertex stride)
+    const uint32 instancesSize = instancesCount * sizeof(InstanceData);
+    const uint32 argsSize = argsData.Count() * sizeof(GPUDrawIndexedIndirectArgs);
+    const uint32 countersSize = batches.Count() * MODEL_MAX_LODS * sizeof(uint32);
+    if (EnsureBufferSize(_outputBuffer, instancesSize, GPUBufferFlags::RawBuffer | GPUBufferFlags::UnorderedAccess, sizeof(uint32)) ||
+        EnsureBufferSize(instances, instancesSize, GPUBufferFlags::VertexBuffer, sizeof(InstanceData)) ||
+        EnsureBufferSize(args, argsSize, GPUBufferFlags::RawBuffer | GPUBufferFlags::Argument | GPUBufferFlags::UnorderedAccess, sizeof(uint32)) ||
+        EnsureBufferSize(_lodSlotsBuffer, instancesCount * sizeof(uint32), GPUBufferFlags::RawBuffer | GPUBufferFlags::UnorderedAccess, sizeof(uint32)) ||
+        EnsureBufferSize(_lodCountersBuffer, countersSize, GPUBufferFlags::RawBuffer | GPUBufferFlags::UnorderedAccess, sizeof(uint32)))
+    {
+        LOG(Error, "Failed to setup GPU-driven culling buffers.");
+        return true;
+    }
+    context->UpdateBuffer(args, argsData.Get(), argsSize);
+    Array<uint32, RendererAllocation> counters;
+    counters.Resize(batches.Count() * MODEL_MAX_LODS);
+    Platform::MemoryClear(counters.Get(), countersSize);
+    context->UpdateBuffer(_lodCountersBuffer, counters.Get(), countersSize);
+
+    // Setup constants buffer
+    BindCullingData(context, renderContext, 0);
+    const RenderView& lodView = renderContext.LodProxyView ? *renderContext.LodProxyView : renderContext.View;
+    LODInstancesData data;
+    data.CullViewPosition = renderContext.View.Position;
+    data.LODScreenMultiple = 0.5f * Math::Max(lodView.Projection.Values[0][0], lodView.Projection.Values[1][1]);
+    data.LODViewPosition = lodView.Position;
+    data.LODDistanceScale = lodView.Projection.Values[2][3];
+    data.LODBias = renderContext.View.ModelLODBias;
+    data.LODDistanceFactor = renderContext.View.ModelLODDistanceFactorSqrt;
+    data.Padding = Float2::Zero;
+
+    // Cull instances of each batch and write the visible ones grouped by LOD (instances and arguments ranges follow the batches order)
+    context->BindUA(0, _lodSlotsBuffer->View());
+    context->BindUA(1, _lodCountersBuffer->View());
+    context->BindUA(2, args->View());
+    context->BindUA(3, _outputBuffer->View());
+    data.InstancesStart = 0;
+    for (int32 i = 0; i < batches.Count(); i++)
+    {
+        const LODInstances& batch = batches.Get()[i];
+        const Model* model = batch.Model;
+        data.InstancesOffset = batch.Origin - renderContext.View.Origin;
+        data.LODInstancesCount = batch.InstancesCount;
+        for (int32 lodIndex = 0; lodIndex < ARRAY_COUNT(data.LODScreenRadiusSquared); lodIndex++)
+            data.LODScreenRadiusSquared[lodIndex] = lodIndex < model->LODs.Count() ? Math::Square(model->LODs[lodIndex].ScreenSize * 0.5f) : 0.0f;
+        data.MinScreenRadiusSquared = Math::Square(model->MinScreenSize * 0.5f);
+        data.MinLOD = model->HighestResidentLODIndex();
+        data.MaxLOD = model->LODs.Count() - 1;
+        data.LODsCount = model->LODs.Count();
+        data.ArgsStart = batch.ArgsOffset / sizeof(GPUDrawIndexedIndirectArgs);
+        data.ArgsCount = (i + 1 < batches.Count() ? batches.Get()[i + 1].ArgsOffset : argsSize) / sizeof(GPUDrawIndexedIndirectArgs) - data.ArgsStart;
+        data.CountersOffset = i * MODEL_MAX_LODS * sizeof(uint32);
+        context->UpdateCB(_lodInstancesCB, &data);
+        context->BindCB(2, _lodInstancesCB);
+        context->BindSR(0, batch.Instances->View());
+        const uint32 groups = Math::DivideAndRoundUp<uint32>(batch.InstancesCount, CULL_INSTANCES_GROUP_SIZE);
+        context->Dispatch(_cullLODInstancesCS, groups, 1, 1);
+        context->Dispatch(_lodInstancesArgsCS, Math::DivideAndRoundUp<uint32>(data.ArgsCount, CULL_INSTANCES_GROUP_SIZE), 1, 1);
+        context->Dispatch(_scatterLODInstancesCS, groups, 1, 1);
+        data.InstancesStart += batch.InstancesCount;
+    }
+    context->ResetUA();
+    context->ResetSR();
+    context->CopyBuffer(instances, _outputBuffer, instancesSize);
+
+    return false;
+}
+
+void GPUDrivenCulling::BindCullingData(GPUContext* context, const RenderContext& renderContext, uint32 instancesCount)
+{
+    Data data;
+    for (int32 i = 0; i < 6; i++)
+    {
+        const Plane plane = renderContext.View.CullingFrustum.GetPlane(i);
+        data.FrustumPlanes[i] = Float4(plane.Normal, (float)plane.D);
+    }
+    data.InstancesCount = instancesCount;
+    data.HiZMipLevels = 0;
+    HiZPass::BindingData hiz;
+    if (EnumHasAnyFlags(renderContext.View.Pass, DrawPass::GBuffer) && !HiZPass::Instance()->Get(renderContext, hiz))
+    {
+        // Occlusion culling against the previous frame depth
+        Matrix::Transpose(hiz.ViewProjection, data.HiZViewProjection);
+        data.HiZSize = hiz.Size;
+        data.HiZMipLevels = hiz.MipLevels;
+        context->BindSR(2, hiz.Texture);
+    }
+    context->UpdateCB(_cb, &data);
+    context->BindCB(0, _cb);
+}
@@ -0,0 +1,201 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "../RendererPass.h"
+#include "../RendererAllocation.h"
+#include "Engine/Graphics/DynamicBuffer.h"
+
+struct GPUDrawIndexedIndirectArgs;
+struct DrawCall;
+class Model;
+
+/// <summary>
+/// GPU-driven culling of the instanced draw calls batches. Culls the batch instances using compute shader and compacts the visible instances into the instance buffer with indirect draw arguments per batch, so the CPU doesn't need to cull or submit the individual instances.
+/// Also culls the triangle clusters (meshlets) of the high-poly meshes and compacts the visible triangles into the index buffer, so partially visible meshes are not fully rasterized.
+/// </summary>
+class GPUDrivenCulling : public RendererPass<GPUDrivenCulling>
+{
+public:
+    /// <summary>
+    /// The culled instance description. Matches the shader type.
+    /// </summary>
+    struct InstanceBounds
+    {
+        // The instance bounding sphere center (relative to the view origin).
+        Float3 Center;
+        // The instance bounding sphere radius.
+        float Radius;
+        // The instance index in the source instance buffer.
+        uint32 Instance;
+        // The index of the batch (indirect draw arguments) that contains the instance.
+        uint32 Batch;
+    };
+
+    /// <summary>
+    /// The persistent instance description for the culling with LOD selection (eg. foliage). Matches the shader type.
+    /// </summary>
+    struct LODInstance
+    {
+        // The instance world matrix translation (relative to the instances origin).
+        Float3 Origin;
+        // The instance random value (in range 0-1).
+        float Random;
+        // The instance world matrix first row.
+        Float3 Transform1;
+        // The instance cull distance.
+        float CullDistance;
+        // The instance world matrix second row.
+        Float3 Transform2;
+        // The instance bounding sphere radius.
+        float Radius;
+        // The instance world matrix third row.
+        Float3 Transform3;
+        float Padding0;
+        // The instance bounding sphere center (relative to the instances origin).
+        Float3 Center;
+        float Padding1;
+    };
+
+    /// <summary>
+    /// The persistent instances of the model to cull with LOD selection.
+    /// </summary>
+    struct LODInstances
+    {
+        // The instances buffer (structured buffer with LODInstance elements).
+        GPUBuffer* Instances;
+        // The amount of instances in the buffer.
+        int32 InstancesCount;
+        // The world-space origin of the instances data.
+        Vector3 Origin;
+        // The model to draw. Draw arguments are written for each mesh of each model LOD (in order).
+        const Model* Model;
+        // The offset (in bytes) of the draw arguments of the model first mesh. Set by the culling.
+        uint32 ArgsOffset;
+    };
+
+private:
+    AssetReference<Shader> _shader;
+    GPUConstantBuffer* _cb = nullptr;
+    GPUConstantBuffer* _meshletsCB = nullptr;
+    GPUConstantBuffer* _lodInstancesCB = nullptr;
+    GPUShaderProgramCS* _cullInstancesCS = nullptr;
+    GPUShaderProgramCS* _cullMeshletsCS = nullptr;
+    GPUShaderProgramCS* _cullLODInstancesCS = nullptr;
+    GPUShaderProgramCS* _lodInstancesArgsCS = nullptr;
+    GPUShaderProgramCS* _scatterLODInstancesCS = nullptr;
+    GPUBuffer* _inputBuffer = nullptr;
+    GPUBuffer* _outputBuffer = nullptr;
+    GPUBuffer* _instanceBuffer = nullptr;
+    GPUBuffer* _argsBuffer = nullptr;
+    GPUBuffer* _meshletIndexBuffer = nullptr;
+    GPUBuffer* _meshletArgsBuffer = nullptr;
+    GPUBuffer* _lodSlotsBuffer = nullptr;
+    GPUBuffer* _lodCountersBuffer = nullptr;
+    DynamicStructuredBuffer _boundsBuffer;
+
+public:
+    GPUDrivenCulling();
+
+public:
+    /// <summary>
+    /// Gets the instance buffer with the visible instances (valid after culling). Use as a per-instance vertex buffer with the start instance from the batch indirect draw arguments.
+    /// </summary>
+    FORCE_INLINE GPUBuffer* GetInstanceBuffer() const
+    {
+        return _instanceBuffer;
+    }
+
+    /// <summary>
+    /// Gets the buffer with indirect draw arguments (GPUDrawIndexedIndirectArgs) for each culled batch (valid after culling).
+    /// </summary>
+    FORCE_INLINE GPUBuffer* GetArgsBuffer() const
+    {
+        return _argsBuffer;
+    }
+
+    /// <summary>
+    /// Gets the index buffer with the visible triangles of the draw calls (valid after meshlets culling). Use with the draw call vertex buffers.
+    /// </summary>
+    FORCE_INLINE GPUBuffer* GetMeshletIndexBuffer() const
+    {
+        return _meshletIndexBuffer;
+    }
+
+    /// <summary>
+    /// Gets the buffer with indirect draw arguments (GPUDrawIndexedIndirectArgs) for each draw call with culled meshlets (valid after meshlets culling).
+    /// </summary>
+    FORCE_INLINE GPUBuffer* GetMeshletArgsBuffer() const
+    {
+        return _meshletArgsBuffer;
+    }
+
+    /// <summary>
+    /// Checks if GPU-driven culling can be used (enabled in graphics settings and supported by the device).
+    /// </summary>
+    bool CanUse();
+
+    /// <summary>
+    /// Culls the instances against the view frustum and writes the visible instances and the draw arguments for each batch.
+    /// </summary>
+    /// <param name="context">The GPU context.</param>
+    /// <param name="renderContext">The rendering context.</param>
+    /// <param name="instances">The source instance buffer (InstanceData elements).</param>
+    /// <param name="instancesCount">The amount of instances in the source instance buffer.</param>
+    /// <param name="bounds">The instances to cull.</param>
+    /// <param name="args">The draw arguments for each batch (instance count gets overriden with the visible instances count).</param>
+    /// <returns>True if failed, otherwise false.</returns>
+    bool Cull(GPUContext* context, const RenderContext& renderContext, GPUBuffer* instances, int32 instancesCount, const Array<InstanceBounds, RendererAllocation>& bounds, const Array<GPUDrawIndexedIndirectArgs, RendererAllocation>& args);
+
+    /// <summary>
+    /// Checks if the draw call geometry can be drawn with the triangle clusters culled on a GPU (single instance of the mesh with meshlets generated and material that doesn't offset the vertices).
+    /// </summary>
+    /// <param name="drawCall">The draw call.</param>
+    /// <returns>True if can cull the draw call meshlets, otherwise false.</returns>
+    static bool CanCullMeshlets(const DrawCall& drawCall);
+
+    /// <summary>
+    /// Culls the triangle clusters of the draw calls against the view frustum, the backface cones and the hierarchical depth buffer and writes the visible triangles and the draw arguments for each draw call (in the same order).
+    /// </summary>
+    /// <param name="context">The GPU context.</param>
+    /// <param name="renderContext">The rendering context.</param>
+    /// <param name="drawCalls">The draw calls to cull (see CanCullMeshlets).</param>
+    /// <returns>True if failed, otherwise false.</returns>
+    bool CullMeshlets(GPUContext* context, const RenderContext& renderContext, const Array<const DrawCall*, RendererAllocation>& drawCalls);
+
+    /// <summary>
+    /// Culls the persistent instances against the view cull distance, frustum and the hierarchical depth buffer, selects the model LOD of each visible instance and writes the visible instances grouped by LOD with the draw arguments for each mesh of each LOD.
+    /// </summary>
+    /// <remarks>LOD transitions are not dithered. Visible instances get written into the output buffer in order of the batches.</remarks>
+    /// <param name="context">The GPU context.</param>
+    /// <param name="renderContext">The rendering context.</param>
+    /// <param name="batches">The instances to cull. Draw arguments offset is set for each batch.</param>
+    /// <param name="instances">The output per-instance vertex buffer (InstanceData elements). Resized if needed.</param>
+    /// <param name="args">The output draw arguments buffer (GPUDrawIndexedIndirectArgs elements). Resized if needed.</param>
+    /// <returns>True if failed, otherwise false.</returns>
+    bool CullLODInstances(GPUContext* context, const RenderContext& renderContext, Array<LODInstances, RendererAllocation>& batches, GPUBuffer* instances, GPUBuffer* args);
+
+public:
+    // [RendererPass]
+    String ToString() const override;
+    bool Init() override;
+    void Dispose() override;
+#if COMPILE_WITH_DEV_ENV
+    void OnShaderReloading(Asset* obj)
+    {
+        _cullInstancesCS = nullptr;
+        _cullMeshletsCS = nullptr;
+        _cullLODInstancesCS = nullptr;
+        _lodInstancesArgsCS = nullptr;
+        _scatterLODInstancesCS = nullptr;
+        invalidateResources();
+    }
+#endif
+
+private:
+    void BindCullingData(GPUContext* context, const RenderContext& renderContext, uint32 instancesCount);
+
+protected:
+    // [RendererPass]
+    bool setupResources() override;
+};
@@ -0,0 +1,272 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "HalfResRendering.h"
+#include "../GBufferPass.h"
+#include "Engine/Content/Content.h"
+#include "Engine/Engine/Engine.h"
+#include "Engine/Graphics/GPUContext.h"
+#include "Engine/Graphics/GPUDevice.h"
+#include "Engine/Graphics/RenderTask.h"
+#include "Engine/Graphics/RenderBuffers.h"
+#include "Engine/Graphics/RenderTargetPool.h"
+
+PACK_STRUCT(struct Data {
+    GBufferData GBuffer;
+    Float2 InputSize;
+    Float2 InputTexelSize;
+    uint32 CheckerboardFrame;
+    float HasHistory;
+    Float2 Dummy0;
+    });
+
+// Custom render buffer for the half-res depth and normals shared by effects within a frame.
+class HalfResRenderingCustomBuffer : public RenderBuffers::CustomBuffer
+{
+public:
+    GPUTexture* DepthNormals = nullptr;
+
+    ~HalfResRenderingCustomBuffer()
+    {
+        SAFE_DELETE_GPU_RESOURCE(DepthNormals);
+    }
+};
+
+// Custom render buffer for the checkerboard rendering history of the effect.
+class CheckerboardCustomBuffer : public RenderBuffers::CustomBuffer
+{
+public:
+    GPUTexture* History = nullptr;
+
+    ~CheckerboardCustomBuffer()
+    {
+        SAFE_DELETE_GPU_RESOURCE(History);
+    }
+};
+
+String HalfResRendering::ToString() const
+{
+    return TEXT("HalfResRendering");
+}
+
+bool HalfResRendering::Init()
+{
+    // Create pipeline states
+    _psDepthNormals = GPUDevice::Instance->CreatePipelineState();
+    _psUpsample = GPUDevice::Instance->CreatePipelineState();
+    _psCheckerboardReconstruct = GPUDevice::Instance->CreatePipelineState();
+
+    // Load asset
+    _shader = Content::LoadAsyncInternal<Shader>(TEXT("Shaders/HalfResRendering"));
+    if (_shader == nullptr)
+        return true;
+#if COMPILE_WITH_DEV_ENV
+    _shader.Get()->OnReloading.Bind<HalfResRendering, &HalfResRendering::OnShaderReloading>(this);
+#endif
+
+    return false;
+}
+
+bool HalfResRendering::setupResources()
+{
+    // Check if shader has not been loaded
+    if (!_shader->IsLoaded())
+        return true;
+    const auto shader = _shader->GetShader();
+
+    // Validate shader constant buffer size
+    if (shader->GetCB(0)->GetSize() != sizeof(Data))
+    {
+        REPORT_INVALID_SHADER_PASS_CB_SIZE(shader, 0, Data);
+        return true;
+    }
+
+    // Create pipeline states
+    GPUPipelineState::Description psDesc = GPUPipelineState::Description::DefaultFullscreenTriangle;
+    if (!_psDepthNormals->IsValid())
+    {
+        psDesc.PS = shader->GetPS("PS_DepthNormals");
+        if (_psDepthNormals->Init(psDesc))
+            return true;
+    }
+    if (!_psUpsample->IsValid())
+    {
+        psDesc.PS = shader->GetPS("PS_Upsample");
+        if (_psUpsample->Init(psDesc))
+            return true;
+    }
+    if (!_psCheckerboardReconstruct->IsValid())
+    {
+        psDesc.PS = shader->GetPS("PS_CheckerboardReconstruct");
+        if (_psCheckerboardReconstruct->Init(psDesc))
+            return true;
+    }
+
+    return false;
+}
+
+void HalfResRendering::Dispose()
+{
+    // Base
+    RendererPass::Dispose();
+
+    // Cleanup
+    SAFE_DELETE_GPU_RESOURCE(_psDepthNormals);
+    SAFE_DELETE_GPU_RESOURCE(_psUpsample);
+    SAFE_DELETE_GPU_RESOURCE(_psCheckerboardReconstruct);
+    _shader = nullptr;
+}
+
+uint32 HalfResRendering::GetCheckerboardFrame()
+{
+    return (uint32)(Engine::FrameCount & 1);
+}
+
+GPUTexture* HalfResRendering::RequestDepthNormals(RenderContext& renderContext, GPUContext* context)
+{
+    if (checkIfSkipPass())
+        return nullptr;
+    auto& halfResData = *renderContext.Buffers->GetCustomBuffer<HalfResRenderingCustomBuffer>(TEXT("HalfResRendering"));
+    const uint64 currentFrame = Engine::FrameCount;
+    if (halfResData.LastFrameUsed == currentFrame && halfResData.DepthNormals)
+        return halfResData.DepthNormals;
+    halfResData.LastFrameUsed = currentFrame;
+    PROFILE_GPU_CPU("Half Res Depth Normals");
+
+    // Allocate the half-res target
+    const int32 width = Math::Max(renderContext.Buffers->GetWidth() / 2, 1);
+    const int32 height = Math::Max(renderContext.Buffers->GetHeight() / 2, 1);
+    if (!halfResData.DepthNormals)
+        halfResData.DepthNormals = GPUDevice::Instance->CreateTexture(TEXT("HalfResRendering.DepthNormals"));
+    if (halfResData.DepthNormals->Width() != width || halfResData.DepthNormals->Height() != height)
+    {
+        const auto desc = GPUTextureDescription::New2D(width, height, PixelFormat::R16G16B16A16_Float);
+        if (halfResData.DepthNormals->Init(desc))
+        {
+            SAFE_DELETE_GPU_RESOURCE(halfResData.DepthNormals);
+            return nullptr;
+        }
+    }
+
+    // Downscale depth and normals
+    Data data;
+    GBufferPass::SetInputs(renderContext.View, data.GBuffer);
+    data.InputSize = Float2((float)width, (float)height);
+    data.InputTexelSize = Float2(1.0f / (float)width, 1.0f / (float)height);
+    data.CheckerboardFrame = 0;
+    data.HasHistory = 0.0f;
+    data.Dummy0 = Float2::Zero;
+    const auto cb = _shader->GetShader()->GetCB(0);
+    context->UpdateCB(cb, &data);
+    context->BindCB(0, cb);
+    context->BindSR(1, renderContext.Buffers->GBuffer1);
+    context->BindSR(3, renderContext.Buffers->DepthBuffer);
+    context->SetViewportAndScissors((float)width, (float)height);
+    context->SetRenderTarget(halfResData.DepthNormals->View());
+    context->SetState(_psDepthNormals);
+    context->DrawFullscreenTriangle();
+    context->ResetRenderTarget();
+    context->UnBindSR(1);
+    context->UnBindSR(3);
+
+    return halfResData.DepthNormals;
+}
+
+void HalfResRendering::Upsample(RenderContext& renderContext, GPUContext* context, GPUTexture* input, GPUTextureView* output)
+{
+    PROFILE_GPU_CPU("Bilateral Upsample");
+    const int32 width = renderContext.Buffers->GetWidth();
+    const int32 height = renderContext.Buffers->GetHeight();
+    GPUTexture* depthNormals = RequestDepthNormals(renderContext, context);
+    context->SetViewportAndScissors((float)width, (float)height);
+    context->SetRenderTarget(output);
+    if (!depthNormals || depthNormals->Width() != input->Width() || depthNormals->Height() != input->Height())
+    {
+        // Fallback to the bilinear upsample (eg. input is not half-res)
+        context->Draw(input);
+        context->ResetRenderTarget();
+        return;
+    }
+
+    Data data;
+    GBufferPass::SetInputs(renderContext.View, data.GBuffer);
+    data.InputSize = Float2((float)input->Width(), (float)input->Height());
+    data.InputTexelSize = Float2(1.0f / data.InputSize.X, 1.0f / data.InputSize.Y);
+    data.CheckerboardFrame = 0;
+    data.HasHistory = 0.0f;
+    data.Dummy0 = Float2::Zero;
+    const auto cb = _shader->GetShader()->GetCB(0);
+    context->UpdateCB(cb, &data);
+    context->BindCB(0, cb);
+    context->BindSR(1, renderContext.Buffers->GBuffer1);
+    context->BindSR(3, renderContext.Buffers->DepthBuffer);
+    context->BindSR(4, input);
+    context->BindSR(5, depthNormals);
+    context->SetState(_psUpsample);
+    context->DrawFullscreenTriangle();
+    context->ResetRenderTarget();
+    context->UnBindSR(1);
+    context->UnBindSR(3);
+    context->UnBindSR(4);
+    context->UnBindSR(5);
+}
+
+GPUTexture* HalfResRendering::ReconstructCheckerboard(RenderContext& renderContext, GPUContext* context, const StringView& name, GPUTexture* input)
+{
+    if (checkIfSkipPass())
+        return input;
+    PROFILE_GPU_CPU("Checkerboard Reconstruct");
+    auto& checkerboardData = *renderContext.Buffers->GetCustomBuffer<CheckerboardCustomBuffer>(name);
+    const uint64 currentFrame = Engine::FrameCount;
+    const int32 width = input->Width();
+    const int32 height = input->Height();
+    bool hasHistory = checkerboardData.History && checkerboardData.LastFrameUsed + 1 == currentFrame && !renderContext.Task->IsCameraCut;
+    checkerboardData.LastFrameUsed = currentFrame;
+
+    // Allocate the history
+    if (!checkerboardData.History)
+        checkerboardData.History = GPUDevice::Instance->CreateTexture(TEXT("HalfResRendering.CheckerboardHistory"));
+    if (checkerboardData.History->Width() != width || checkerboardData.History->Height() != height || checkerboardData.History->Format() != input->Format())
+    {
+        const auto desc = GPUTextureDescription::New2D(width, height, input->Format());
+        if (checkerboardData.History->Init(desc))
+        {
+            SAFE_DELETE_GPU_RESOURCE(checkerboardData.History);
+            return input;
+        }
+        hasHistory = false;
+    }
+
+    // Reconstruct the missing pixels
+    auto tempDesc = GPUTextureDescription::New2D(width, height, input->Format());
+    auto result = RenderTargetPool::Get(tempDesc);
+    RENDER_TARGET_POOL_SET_NAME(result, "HalfResRendering.Checkerboard");
+    Data data;
+    GBufferPass::SetInputs(renderContext.View, data.GBuffer);
+    data.InputSize = Float2((float)width, (float)height);
+    data.InputTexelSize = Float2(1.0f / (float)width, 1.0f / (float)height);
+    data.CheckerboardFrame = GetCheckerboardFrame();
+    data.HasHistory = hasHistory ? 1.0f : 0.0f;
+    data.Dummy0 = Float2::Zero;
+    const auto cb = _shader->GetShader()->GetCB(0);
+    const auto motionVectors = renderContext.Buffers->MotionVectors;
+    context->UpdateCB(cb, &data);
+    context->BindCB(0, cb);
+    context->BindSR(3, renderContext.Buffers->DepthBuffer);
+    context->BindSR(4, input);
+    context->BindSR(6, checkerboardData.History);
+    context->BindSR(7, motionVectors && motionVectors->IsAllocated() ? motionVectors->View() : nullptr);
+    context->SetViewportAndScissors((float)width, (float)height);
+    context->SetRenderTarget(result->View());
+    context->SetState(_psCheckerboardReconstruct);
+    context->DrawFullscreenTriangle();
+    context->ResetRenderTarget();
+    context->UnBindSR(3);
+    context->UnBindSR(4);
+    context->UnBindSR(6);
+    context->UnBindSR(7);
+
+    // Keep the result as history for the next frame
+    context->CopyResource(checkerboardData.History, result);
+    RenderTargetPool::Release(result);
+    return checkerboardData.History;
+}
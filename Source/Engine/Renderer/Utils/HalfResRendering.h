@@ -0,0 +1,69 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "../RendererPass.h"
+
+/// <summary>
+/// Shared framework for rendering the screen-space effects at the lower resolution. Provides the depth-aware half-resolution depth and normals (shared by all effects within a frame), the bilateral upsample to the full resolution and the checkerboard rendering (half of the pixels rendered each frame) with the temporal reconstruction.
+/// </summary>
+class HalfResRendering : public RendererPass<HalfResRendering>
+{
+private:
+    AssetReference<Shader> _shader;
+    GPUPipelineState* _psDepthNormals = nullptr;
+    GPUPipelineState* _psUpsample = nullptr;
+    GPUPipelineState* _psCheckerboardReconstruct = nullptr;
+
+public:
+    /// <summary>
+    /// Gets the index of the checkerboard pattern for the current frame (0 or 1). Effects rendered with the checkerboard pattern should render only pixels for which <c>((x + y + frame) &amp; 1) == 0</c> (see IsCheckerboardPixel in HalfResRendering.hlsl).
+    /// </summary>
+    static uint32 GetCheckerboardFrame();
+
+    /// <summary>
+    /// Requests the half-resolution depth and normals to be prepared for the current frame (generated once per frame and shared by all effects). Each pixel picks the closest or the furthest sample of the 2x2 quad (in the checkerboard pattern) to preserve the depth edges.
+    /// </summary>
+    /// <param name="renderContext">The rendering context.</param>
+    /// <param name="context">The GPU context.</param>
+    /// <returns>The half-res texture (RGB: world-space normal, A: linear depth) or null if failed.</returns>
+    GPUTexture* RequestDepthNormals(RenderContext& renderContext, GPUContext* context);
+
+    /// <summary>
+    /// Performs the bilateral (depth and normal aware) upsample of the half-resolution image to the full resolution. Prevents leaking the effect over the geometry edges.
+    /// </summary>
+    /// <param name="renderContext">The rendering context.</param>
+    /// <param name="context">The GPU context.</param>
+    /// <param name="input">The half-res input image.</param>
+    /// <param name="output">The full-res output image.</param>
+    void Upsample(RenderContext& renderContext, GPUContext* context, GPUTexture* input, GPUTextureView* output);
+
+    /// <summary>
+    /// Reconstructs the image rendered with the checkerboard pattern (only half of the pixels rendered in the current frame, see GetCheckerboardFrame). Missing pixels are reprojected from the previous frame result (with motion vectors) or interpolated from the neighbours.
+    /// </summary>
+    /// <param name="renderContext">The rendering context.</param>
+    /// <param name="context">The GPU context.</param>
+    /// <param name="name">The unique name of the effect (used to keep the history between the frames).</param>
+    /// <param name="input">The checkerboard-rendered input image.</param>
+    /// <returns>The reconstructed image (valid until the next frame) or the input image if failed.</returns>
+    GPUTexture* ReconstructCheckerboard(RenderContext& renderContext, GPUContext* context, const StringView& name, GPUTexture* input);
+
+public:
+    // [RendererPass]
+    String ToString() const override;
+    bool Init() override;
+    void Dispose() override;
+#if COMPILE_WITH_DEV_ENV
+    void OnShaderReloading(Asset* obj)
+    {
+        _psDepthNormals->ReleaseGPU();
+        _psUpsample->ReleaseGPU();
+        _psCheckerboardReconstruct->ReleaseGPU();
+        invalidateResources();
+    }
+#endif
+
+protected:
+    // [RendererPass]
+    bool setupResources() override;
+};
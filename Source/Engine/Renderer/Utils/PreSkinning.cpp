@@ -0,0 +1,236 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "PreSkinning.h"
+#include "Engine/Content/Content.h"
+#include "Engine/Graphics/Graphics.h"
+#include "Engine/Graphics/GPUBuffer.h"
+#include "Engine/Graphics/GPUContext.h"
+#include "Engine/Graphics/GPUDevice.h"
+#include "Engine/Graphics/GPULimits.h"
+#include "Engine/Graphics/Shaders/GPUShader.h"
+#include "Engine/Graphics/Models/Types.h"
+#include "Engine/Graphics/Models/SkinnedMesh.h"
+#include "Engine/Graphics/Models/SkinnedMeshDrawData.h"
+#include "Engine/Graphics/Models/BonesPalette.h"
+
+#define PRE_SKIN_GROUP_SIZE 64
+
+static_assert(sizeof(VB0SkinnedElementType) == 36, "Update SKINNED_VERTEX_SIZE in PreSkinning shader.");
+static_assert(sizeof(VB0ElementType) == 12, "Update positions stride in PreSkinning shader.");
+static_assert(sizeof(VB1ElementType) == 16, "Update ATTRIBUTES_VERTEX_SIZE in PreSkinning shader.");
+static_assert(sizeof(BlendShapeVertex) == 28, "Update BLEND_SHAPE_VERTEX_SIZE in PreSkinning shader.");
+
+PACK_STRUCT(struct Data {
+    uint32 VerticesCount;
+    uint32 BonesOffset;
+    Float2 Dummy0;
+    });
+
+PACK_STRUCT(struct BlendShapeData {
+    uint32 ShapeVerticesOffset;
+    uint32 ShapeVerticesCount;
+    float ShapeWeight;
+    uint32 ShapeUseNormals;
+    uint32 MinVertexIndex;
+    uint32 MaxVertexIndex;
+    Float2 Dummy1;
+    });
+
+String PreSkinning::ToString() const
+{
+    return TEXT("PreSkinning");
+}
+
+bool PreSkinning::Init()
+{
+    // Compute shaders support is required for this implementation
+    if (!GPUDevice::Instance->Limits.HasCompute)
+        return false;
+
+    // Load asset
+    _shader = Content::LoadAsyncInternal<Shader>(TEXT("Shaders/PreSkinning"));
+    if (_shader == nullptr)
+        return true;
+#if COMPILE_WITH_DEV_ENV
+    _shader.Get()->OnReloading.Bind<PreSkinning, &PreSkinning::OnShaderReloading>(this);
+#endif
+
+    return false;
+}
+
+bool PreSkinning::setupResources()
+{
+    // Check if shader has not been loaded
+    if (!_shader || !_shader->IsLoaded())
+        return true;
+    const auto shader = _shader->GetShader();
+
+    // Validate shader constant buffer size
+    _cb = shader->GetCB(0);
+    if (_cb->GetSize() != sizeof(Data))
+    {
+        REPORT_INVALID_SHADER_PASS_CB_SIZE(shader, 0, Data);
+        return true;
+    }
+
+    _blendShapeCB = shader->GetCB(1);
+    if (_blendShapeCB->GetSize() != sizeof(BlendShapeData))
+    {
+        REPORT_INVALID_SHADER_PASS_CB_SIZE(shader, 1, BlendShapeData);
+        return true;
+    }
+
+    // Cache compute shaders
+    _cs = shader->GetCS("CS_PreSkin");
+    _blendShapeCS = shader->GetCS("CS_BlendShape");
+    _blendShapesNormalizeCS = shader->GetCS("CS_BlendShapesNormalize");
+
+    return false;
+}
+
+void PreSkinning::Dispose()
+{
+    // Base
+    RendererPass::Dispose();
+
+    // Cleanup
+    _cb = nullptr;
+    _blendShapeCB = nullptr;
+    _cs = nullptr;
+    _blendShapeCS = nullptr;
+    _blendShapesNormalizeCS = nullptr;
+    _shader = nullptr;
+}
+
+bool PreSkinning::CanUse()
+{
+    return Graphics::PreSkinning && _shader && !checkIfSkipPass();
+}
+
+bool PreSkinning::CanPreSkin(const GPUBuffer* vertexBuffer)
+{
+    return vertexBuffer && EnumHasAllFlags(vertexBuffer->GetDescription().Flags, GPUBufferFlags::RawBuffer | GPUBufferFlags::ShaderResource);
+}
+
+bool PreSkinning::GetVertexBuffers(GPUContext* context, const SkinnedMesh* mesh, GPUBuffer* vertexBuffer, SkinnedMeshDrawData& skinning, GPUBuffer*& vertexBuffer0, GPUBuffer*& vertexBuffer1)
+{
+    ASSERT(context && mesh && CanPreSkin(vertexBuffer));
+    if (checkIfSkipPass() || !skinning.IsReady())
+        return true;
+
+    // Get the cached buffers for the mesh
+    const uint64 key = (uint64)mesh->GetLODIndex() << 32 | (uint64)mesh->GetIndex();
+    SkinnedMeshDrawData::PreSkinnedMesh* entry = nullptr;
+    for (auto& e : skinning.PreSkinnedMeshes)
+    {
+        if (e.Key == key)
+        {
+            entry = &e;
+            break;
+        }
+    }
+    if (!entry)
+    {
+        entry = &skinning.PreSkinnedMeshes.AddOne();
+        entry->Key = key;
+        entry->Version = skinning.Version;
+        entry->VertexBuffer0 = GPUDevice::Instance->CreateBuffer(TEXT("PreSkinning.VB0"));
+        entry->VertexBuffer1 = GPUDevice::Instance->CreateBuffer(TEXT("PreSkinning.VB1"));
+    }
+
+    // Prepare buffers (vertex buffers written by the compute shader via raw views)
+    const uint32 verticesCount = mesh->GetVertexCount();
+    bool isDirty = entry->Version != skinning.Version;
+    if (entry->VertexBuffer0->GetSize() != verticesCount * sizeof(VB0ElementType))
+    {
+        const auto flags = GPUBufferFlags::VertexBuffer | GPUBufferFlags::RawBuffer | GPUBufferFlags::UnorderedAccess;
+        if (entry->VertexBuffer0->Init(GPUBufferDescription::Buffer(verticesCount * sizeof(VB0ElementType), flags, PixelFormat::R32_Typeless, nullptr, sizeof(VB0ElementType))) ||
+            entry->VertexBuffer1->Init(GPUBufferDescription::Buffer(verticesCount * sizeof(VB1ElementType), flags, PixelFormat::R32_Typeless, nullptr, sizeof(VB1ElementType))))
+        {
+            LOG(Error, "Failed to setup pre-skinning buffers.");
+            entry->VertexBuffer0->ReleaseGPU();
+            return true;
+        }
+        isDirty = true;
+    }
+
+    // Skin vertices if bones have been modified
+    if (isDirty)
+    {
+        PROFILE_GPU_CPU("Pre-Skinning");
+        entry->Version = skinning.Version;
+        BonesPalette::Flush(context);
+        uint32 bonesOffset;
+        GPUBuffer* boneMatrices = skinning.GetBoneMatrices(bonesOffset);
+        Data data;
+        data.VerticesCount = verticesCount;
+        data.BonesOffset = bonesOffset;
+        data.Dummy0 = Float2::Zero;
+        context->UpdateCB(_cb, &data);
+        context->BindCB(0, _cb);
+        context->BindSR(0, vertexBuffer->View());
+        context->BindSR(1, boneMatrices->View());
+        context->BindUA(0, entry->VertexBuffer0->View());
+        context->BindUA(1, entry->VertexBuffer1->View());
+        context->Dispatch(_cs, Math::DivideAndRoundUp<uint32>(verticesCount, PRE_SKIN_GROUP_SIZE), 1, 1);
+        context->ResetUA();
+        context->ResetSR();
+    }
+
+    vertexBuffer0 = entry->VertexBuffer0;
+    vertexBuffer1 = entry->VertexBuffer1;
+    return false;
+}
+
+bool PreSkinning::ApplyBlendShapes(GPUContext* context, const SkinnedMesh* mesh, const Span<float>& weights, GPUBuffer* vertexBuffer)
+{
+    ASSERT(context && mesh && vertexBuffer && weights.Length() == mesh->BlendShapes.Count());
+    if (checkIfSkipPass())
+        return true;
+    GPUBuffer* blendShapesBuffer = mesh->GetBlendShapesBuffer();
+    if (!blendShapesBuffer)
+        return true;
+    PROFILE_GPU_CPU("Blend Shapes");
+
+    // Apply each active blend shape (dispatches are serialized so shapes can modify the same vertices)
+    BlendShapeData data;
+    data.MinVertexIndex = MAX_uint32;
+    data.MaxVertexIndex = 0;
+    data.Dummy1 = Float2::Zero;
+    bool useNormals = false;
+    uint32 verticesOffset = 0;
+    context->BindSR(0, blendShapesBuffer->View());
+    context->BindUA(0, vertexBuffer->View());
+    for (int32 i = 0; i < mesh->BlendShapes.Count(); i++)
+    {
+        const BlendShape& blendShape = mesh->BlendShapes.Get()[i];
+        const uint32 verticesCount = blendShape.Vertices.Count();
+        const float weight = weights[i];
+        if (verticesCount != 0 && Math::NotNearEqual(weight, 0.0f))
+        {
+            data.ShapeVerticesOffset = verticesOffset;
+            data.ShapeVerticesCount = verticesCount;
+            data.ShapeWeight = weight;
+            data.ShapeUseNormals = blendShape.UseNormals ? 1 : 0;
+            data.MinVertexIndex = Math::Min(data.MinVertexIndex, blendShape.MinVertexIndex);
+            data.MaxVertexIndex = Math::Max(data.MaxVertexIndex, blendShape.MaxVertexIndex);
+            useNormals |= blendShape.UseNormals;
+            context->UpdateCB(_blendShapeCB, &data);
+            context->BindCB(1, _blendShapeCB);
+            context->Dispatch(_blendShapeCS, Math::DivideAndRoundUp<uint32>(verticesCount, PRE_SKIN_GROUP_SIZE), 1, 1);
+        }
+        verticesOffset += verticesCount;
+    }
+
+    // Normalize normal vectors and rebuild tangent frames of the modified vertices
+    if (useNormals)
+    {
+        context->UpdateCB(_blendShapeCB, &data);
+        context->BindCB(1, _blendShapeCB);
+        context->Dispatch(_blendShapesNormalizeCS, Math::DivideAndRoundUp<uint32>(data.MaxVertexIndex - data.MinVertexIndex + 1, PRE_SKIN_GROUP_SIZE), 1, 1);
+    }
+    context->ResetUA();
+    context->ResetSR();
+
+    return false;
+}
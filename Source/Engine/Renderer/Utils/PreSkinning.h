@@ -0,0 +1,78 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "../RendererPass.h"
+#include "Engine/Core/Types/Span.h"
+
+class SkinnedMesh;
+class SkinnedMeshDrawData;
+
+/// <summary>
+/// Compute shader pre-skinning of the skinned meshes. Skins the mesh vertices once per bones update into the cached static mesh vertex buffers (positions and attributes) so all passes (eg. GBuffer, shadow maps) can draw the mesh as a static geometry instead of skinning the vertices in every pass.
+/// Also applies the blend shapes to the skinned mesh vertices on a GPU (before skinning).
+/// </summary>
+class PreSkinning : public RendererPass<PreSkinning>
+{
+private:
+    AssetReference<Shader> _shader;
+    GPUConstantBuffer* _cb = nullptr;
+    GPUConstantBuffer* _blendShapeCB = nullptr;
+    GPUShaderProgramCS* _cs = nullptr;
+    GPUShaderProgramCS* _blendShapeCS = nullptr;
+    GPUShaderProgramCS* _blendShapesNormalizeCS = nullptr;
+
+public:
+    /// <summary>
+    /// Checks if pre-skinning can be used (enabled in graphics settings and supported by the device).
+    /// </summary>
+    bool CanUse();
+
+    /// <summary>
+    /// Checks if the skinned mesh vertex buffer can be read by the pre-skinning compute shader (created with the raw view).
+    /// </summary>
+    /// <param name="vertexBuffer">The skinned mesh vertex buffer.</param>
+    /// <returns>True if can pre-skin mesh, otherwise false.</returns>
+    static bool CanPreSkin(const GPUBuffer* vertexBuffer);
+
+    /// <summary>
+    /// Gets the pre-skinned vertex buffers of the mesh. Skins the mesh vertices if the cached buffers are outdated (bones have been modified since the last update).
+    /// </summary>
+    /// <param name="context">The GPU context.</param>
+    /// <param name="mesh">The skinned mesh.</param>
+    /// <param name="vertexBuffer">The skinned mesh vertex buffer (see CanPreSkin).</param>
+    /// <param name="skinning">The skinning data of the model instance (contains the cached buffers).</param>
+    /// <param name="vertexBuffer0">The result vertex buffer with the positions (layout of VB0ElementType).</param>
+    /// <param name="vertexBuffer1">The result vertex buffer with the attributes (layout of VB1ElementType).</param>
+    /// <returns>True if failed, otherwise false.</returns>
+    bool GetVertexBuffers(GPUContext* context, const SkinnedMesh* mesh, GPUBuffer* vertexBuffer, SkinnedMeshDrawData& skinning, GPUBuffer*& vertexBuffer0, GPUBuffer*& vertexBuffer1);
+
+    /// <summary>
+    /// Applies the blend shapes to the skinned mesh vertices. Blend shapes vertices are stored once per mesh in a GPU buffer (see SkinnedMesh::GetBlendShapesBuffer) and each active blend shape is applied by a compute shader over its vertices, so only the weights are uploaded.
+    /// </summary>
+    /// <param name="context">The GPU context.</param>
+    /// <param name="mesh">The skinned mesh.</param>
+    /// <param name="weights">The weights of the mesh blend shapes (the same order as SkinnedMesh::BlendShapes, zero weight for inactive shapes).</param>
+    /// <param name="vertexBuffer">The vertex buffer with the mesh vertices to deform (created with the raw view and unordered access).</param>
+    /// <returns>True if failed, otherwise false.</returns>
+    bool ApplyBlendShapes(GPUContext* context, const SkinnedMesh* mesh, const Span<float>& weights, GPUBuffer* vertexBuffer);
+
+public:
+    // [RendererPass]
+    String ToString() const override;
+    bool Init() override;
+    void Dispose() override;
+#if COMPILE_WITH_DEV_ENV
+    void OnShaderReloading(Asset* obj)
+    {
+        _cs = nullptr;
+        _blendShapeCS = nullptr;
+        _blendShapesNormalizeCS = nullptr;
+        invalidateResources();
+    }
+#endif
+
+protected:
+    // [RendererPass]
+    bool setupResources() override;
+};
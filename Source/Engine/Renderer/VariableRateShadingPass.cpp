@@ -0,0 +1,152 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "VariableRateShadingPass.h"
+#include "RenderList.h"
+#include "Engine/Content/Content.h"
+#include "Engine/Engine/Engine.h"
+#include "Engine/Graphics/Graphics.h"
+#include "Engine/Graphics/GPUContext.h"
+#include "Engine/Graphics/GPUDevice.h"
+#include "Engine/Graphics/GPULimits.h"
+#include "Engine/Graphics/RenderTask.h"
+#include "Engine/Graphics/RenderBuffers.h"
+#include "Engine/Graphics/Shaders/GPUShader.h"
+
+#define VRS_CONTRAST_THRESHOLD 0.04f // Luminance difference within a tile below which the tile is shaded at the coarser rate
+#define VRS_MOTION_THRESHOLD 6.0f // Motion (in pixels) within a tile above which the tile is shaded at the coarser rate
+
+PACK_STRUCT(struct Data {
+    Float2 ScreenSize;
+    uint32 TileSize;
+    uint32 CoarsestRate;
+    float ContrastThreshold;
+    float MotionThreshold;
+    Float2 Dummy0;
+    });
+
+// Custom render buffer for the shading rate image of the view.
+class VariableRateShadingCustomBuffer : public RenderBuffers::CustomBuffer
+{
+public:
+    GPUTexture* ShadingRate = nullptr;
+
+    ~VariableRateShadingCustomBuffer()
+    {
+        SAFE_DELETE_GPU_RESOURCE(ShadingRate);
+    }
+};
+
+String VariableRateShadingPass::ToString() const
+{
+    return TEXT("VariableRateShadingPass");
+}
+
+bool VariableRateShadingPass::Init()
+{
+    // Check platform support
+    const auto device = GPUDevice::Instance;
+    _supported = device->GetFeatureLevel() >= FeatureLevel::SM5 && device->Limits.HasCompute && device->Limits.HasVariableRateShadingImage && device->Limits.ShadingRateImageTileSize > 0;
+    return false;
+}
+
+bool VariableRateShadingPass::setupResources()
+{
+    if (!_supported)
+        return true;
+
+    // Load shader
+    if (!_shader)
+    {
+        _shader = Content::LoadAsyncInternal<Shader>(TEXT("Shaders/VariableRateShading"));
+        if (_shader == nullptr)
+            return true;
+#if COMPILE_WITH_DEV_ENV
+        _shader.Get()->OnReloading.Bind<VariableRateShadingPass, &VariableRateShadingPass::OnShaderReloading>(this);
+#endif
+    }
+    if (!_shader->IsLoaded())
+        return true;
+    const auto shader = _shader->GetShader();
+
+    // Validate shader constant buffer size
+    _cb = shader->GetCB(0);
+    if (_cb->GetSize() != sizeof(Data))
+    {
+        REPORT_INVALID_SHADER_PASS_CB_SIZE(shader, 0, Data);
+        return true;
+    }
+
+    // Cache compute shaders
+    _csGenerate = shader->GetCS("CS_Generate");
+
+    return false;
+}
+
+void VariableRateShadingPass::Dispose()
+{
+    // Base
+    RendererPass::Dispose();
+
+    // Cleanup
+    _cb = nullptr;
+    _csGenerate = nullptr;
+    _shader = nullptr;
+}
+
+GPUTexture* VariableRateShadingPass::Get(const RenderBuffers* buffers)
+{
+    auto* vrsData = buffers && Graphics::VariableRateShading ? buffers->FindCustomBuffer<VariableRateShadingCustomBuffer>(TEXT("VariableRateShading")) : nullptr;
+    if (vrsData && vrsData->ShadingRate && vrsData->LastFrameUsed + 1 >= Engine::FrameCount)
+    {
+        // Skip if image doesn't match the current resolution (eg. after resize)
+        const int32 tileSize = GPUDevice::Instance->Limits.ShadingRateImageTileSize;
+        if (vrsData->ShadingRate->Width() == Math::DivideAndRoundUp(buffers->GetWidth(), tileSize) && vrsData->ShadingRate->Height() == Math::DivideAndRoundUp(buffers->GetHeight(), tileSize))
+            return vrsData->ShadingRate;
+    }
+    return nullptr;
+}
+
+void VariableRateShadingPass::Render(RenderContext& renderContext, GPUContext* context, GPUTexture* frame)
+{
+    if (!Graphics::VariableRateShading || checkIfSkipPass())
+        return;
+    PROFILE_GPU_CPU("Variable Rate Shading");
+    auto& vrsData = *renderContext.Buffers->GetCustomBuffer<VariableRateShadingCustomBuffer>(TEXT("VariableRateShading"));
+    vrsData.LastFrameUsed = Engine::FrameCount;
+
+    // Allocate the shading rate image (a texel per screen tile)
+    const auto& limits = GPUDevice::Instance->Limits;
+    const int32 tileSize = limits.ShadingRateImageTileSize;
+    const int32 width = renderContext.Buffers->GetWidth();
+    const int32 height = renderContext.Buffers->GetHeight();
+    const int32 tilesX = Math::DivideAndRoundUp(width, tileSize);
+    const int32 tilesY = Math::DivideAndRoundUp(height, tileSize);
+    if (!vrsData.ShadingRate)
+        vrsData.ShadingRate = GPUDevice::Instance->CreateTexture(TEXT("VariableRateShading.ShadingRate"));
+    if (vrsData.ShadingRate->Width() != tilesX || vrsData.ShadingRate->Height() != tilesY)
+    {
+        const auto desc = GPUTextureDescription::New2D(tilesX, tilesY, PixelFormat::R8_UInt, GPUTextureFlags::ShaderResource | GPUTextureFlags::UnorderedAccess);
+        if (vrsData.ShadingRate->Init(desc))
+        {
+            SAFE_DELETE_GPU_RESOURCE(vrsData.ShadingRate);
+            return;
+        }
+    }
+
+    // Generate the shading rate of each tile
+    Data data;
+    data.ScreenSize = Float2((float)width, (float)height);
+    data.TileSize = tileSize;
+    data.CoarsestRate = (uint32)(limits.HasAdditionalShadingRates ? ShadingRate::Rate4x4 : ShadingRate::Rate2x2);
+    data.ContrastThreshold = VRS_CONTRAST_THRESHOLD;
+    data.MotionThreshold = VRS_MOTION_THRESHOLD;
+    data.Dummy0 = Float2::Zero;
+    context->UpdateCB(_cb, &data);
+    context->BindCB(0, _cb);
+    context->BindSR(0, frame);
+    context->BindSR(1, renderContext.List->Setup.UseMotionVectors ? renderContext.Buffers->MotionVectors : nullptr);
+    context->BindUA(0, vrsData.ShadingRate->View());
+    context->Dispatch(_csGenerate, tilesX, tilesY, 1);
+    context->ResetUA();
+    context->ResetSR();
+}
@@ -0,0 +1,50 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "RendererPass.h"
+
+/// <summary>
+/// Variable rate shading service. Generates the screen-space shading rate image from the frame luminance contrast and motion vectors to be used in the next frame by the GBuffer and forward passes (flat or fast moving areas of the screen, such as sky, get shaded at the coarser rate).
+/// </summary>
+class VariableRateShadingPass : public RendererPass<VariableRateShadingPass>
+{
+private:
+    bool _supported = false;
+    AssetReference<Shader> _shader;
+    GPUConstantBuffer* _cb = nullptr;
+    GPUShaderProgramCS* _csGenerate = nullptr;
+
+public:
+    /// <summary>
+    /// Gets the shading rate image for the current frame (generated from the previous frame).
+    /// </summary>
+    /// <param name="buffers">The rendering context buffers.</param>
+    /// <returns>The shading rate image or null if variable rate shading is not used.</returns>
+    GPUTexture* Get(const RenderBuffers* buffers);
+
+    /// <summary>
+    /// Generates the shading rate image for the next frame. Called after the anti-aliasing and before the post processing.
+    /// </summary>
+    /// <param name="renderContext">The rendering context.</param>
+    /// <param name="context">The GPU context.</param>
+    /// <param name="frame">The rendered frame (HDR scene color).</param>
+    void Render(RenderContext& renderContext, GPUContext* context, GPUTexture* frame);
+
+public:
+    // [RendererPass]
+    String ToString() const override;
+    bool Init() override;
+    void Dispose() override;
+#if COMPILE_WITH_DEV_ENV
+    void OnShaderReloading(Asset* obj)
+    {
+        _csGenerate = nullptr;
+        invalidateResources();
+    }
+#endif
+
+protected:
+    // [RendererPass]
+    bool setupResources() override;
+};
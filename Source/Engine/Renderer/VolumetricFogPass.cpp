@@ -473,6 +473,14 @@ void VolumetricFogPass::Render(RenderContext& renderContext)
         }
     }
 
+    // Init local lights data (non-shadowed lights are evaluated directly in the light scattering using clustered lighting)
+    ClusteredLightingPass::BindingData bindingDataClusters;
+    const bool useClusteredLighting = !ClusteredLightingPass::Instance()->Get(renderContext.Buffers, bindingDataClusters);
+    if (useClusteredLighting)
+        _cache.Data.ClusteredLighting = bindingDataClusters.Constants;
+    else
+        _cache.Data.ClusteredLighting.LightsCount = 0;
+
     // Init sky light data
     GPUTexture* skyLightImage = nullptr;
     if (renderContext.List->SkyLights.HasItems() && !useDDGI)
@@ -596,7 +604,7 @@ void VolumetricFogPass::Render(RenderContext& renderContext)
         // Get lights to render
         Array<const RendererPointLightData*, InlinedAllocation<64, RendererAllocation>> pointLights;
         Array<const RendererSpotLightData*, InlinedAllocation<64, RendererAllocation>> spotLights;
-        for (int32 i = 0; i < renderContext.List->PointLights.Count(); i++)
+        for (int32 i = 0; i < renderContext.List->PointLights.Count() && !useClusteredLighting; i++)
         {
             const auto& light = renderContext.List->PointLights[i];
             if (light.VolumetricScatteringIntensity > ZeroTolerance && !light.RenderedVolumetricFog)
@@ -607,7 +615,7 @@ void VolumetricFogPass::Render(RenderContext& renderContext)
                 }
             }
         }
-        for (int32 i = 0; i < renderContext.List->SpotLights.Count(); i++)
+        for (int32 i = 0; i < renderContext.List->SpotLights.Count() && !useClusteredLighting; i++)
         {
             const auto& light = renderContext.List->SpotLights[i];
             if (light.VolumetricScatteringIntensity > ZeroTolerance && !light.RenderedVolumetricFog)
@@ -681,6 +689,11 @@ void VolumetricFogPass::Render(RenderContext& renderContext)
             context->BindSR(5, skyLightImage);
             csIndex = 0;
         }
+        if (useClusteredLighting)
+        {
+            context->BindSR(8, bindingDataClusters.Lights);
+            context->BindSR(9, bindingDataClusters.Clusters);
+        }
         context->Dispatch(_csLightScattering.Get(csIndex), groupCountX, groupCountY, groupCountZ);
 
         context->ResetSR();
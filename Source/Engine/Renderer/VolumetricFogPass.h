@@ -6,6 +6,7 @@
 #include "Engine/Graphics/GPUPipelineStatePermutations.h"
 #include "RendererPass.h"
 #include "GI/DynamicDiffuseGlobalIllumination.h"
+#include "ClusteredLightingPass.h"
 
 struct VolumetricFogOptions;
 struct RendererSpotLightData;
@@ -66,6 +67,7 @@ class VolumetricFogPass : public RendererPass<VolumetricFogPass>
         LightShadowData DirectionalLightShadow;
         SkyLightData SkyLight;
         DynamicDiffuseGlobalIlluminationPass::ConstantsData DDGI;
+        ClusteredLightingPass::ConstantsData ClusteredLighting;
         });
 
     PACK_STRUCT(struct PerLight {
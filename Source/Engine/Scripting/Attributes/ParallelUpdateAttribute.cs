@@ -0,0 +1,20 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+using System;
+
+namespace FlaxEngine
+{
+    /// <summary>
+    /// Makes a script update (OnUpdate) run in parallel with other scripts on Job System threads, before the regular scripts update. Use it only for scripts that modify their own actor (and its children) and don't access any other shared state that can be modified concurrently.
+    /// </summary>
+    [AttributeUsage(AttributeTargets.Class)]
+    public sealed class ParallelUpdateAttribute : Attribute
+    {
+        /// <summary>
+        /// Initializes a new instance of the <see cref="ParallelUpdateAttribute"/> class.
+        /// </summary>
+        public ParallelUpdateAttribute()
+        {
+        }
+    }
+}
@@ -17,6 +17,14 @@
 #include "Scripting.h"
 #include "Events.h"
 #include "Internal/StdTypesContainer.h"
+#include "Engine/Engine/Globals.h"
+#include "Engine/Platform/File.h"
+#include "Engine/Platform/FileSystem.h"
+#include "Engine/Serialization/MemoryReadStream.h"
+#include "Engine/Serialization/MemoryWriteStream.h"
+
+// Version of the managed types metadata cache file (increment it when the cached data or the types scanning logic changes)
+#define MANAGED_TYPES_CACHE_VERSION 1
 
 Dictionary<Pair<ScriptingTypeHandle, StringView>, void(*)(ScriptingObject*, void*, bool)> ScriptingEvents::EventsTable;
 Delegate<ScriptingObject*, Span<Variant>, ScriptingTypeHandle, StringView> ScriptingEvents::Event;
@@ -116,6 +124,7 @@ ScriptingType::ScriptingType()
     Script.SetupScriptVTable = nullptr;
     Script.SetupScriptObjectVTable = nullptr;
     Script.DefaultInstance = nullptr;
+    Script.UsePool = false;
 }
 
 ScriptingType::ScriptingType(const StringAnsiView& fullname, BinaryModule* module, int32 size, InitRuntimeHandler initRuntime, SpawnHandler spawn, const ScriptingTypeHandle& baseType, SetupScriptVTableHandler setupScriptVTable, SetupScriptObjectVTableHandler setupScriptObjectVTable, const InterfaceImplementation* interfaces)
@@ -137,6 +146,7 @@ ScriptingType::ScriptingType(const StringAnsiView& fullname, BinaryModule* modul
     Script.SetupScriptVTable = setupScriptVTable;
     Script.SetupScriptObjectVTable = setupScriptObjectVTable;
     Script.DefaultInstance = nullptr;
+    Script.UsePool = false;
 }
 
 ScriptingType::ScriptingType(const StringAnsiView& fullname, BinaryModule* module, int32 size, InitRuntimeHandler initRuntime, SpawnHandler spawn, ScriptingTypeInitializer* baseType, SetupScriptVTableHandler setupScriptVTable, SetupScriptObjectVTableHandler setupScriptObjectVTable, const InterfaceImplementation* interfaces)
@@ -157,6 +167,7 @@ ScriptingType::ScriptingType(const StringAnsiView& fullname, BinaryModule* modul
     Script.SetupScriptVTable = setupScriptVTable;
     Script.SetupScriptObjectVTable = setupScriptObjectVTable;
     Script.DefaultInstance = nullptr;
+    Script.UsePool = false;
 }
 
 ScriptingType::ScriptingType(const StringAnsiView& fullname, BinaryModule* module, int32 size, InitRuntimeHandler initRuntime, Ctor ctor, Dtor dtor, ScriptingTypeInitializer* baseType, const InterfaceImplementation* interfaces)
@@ -242,6 +253,7 @@ ScriptingType::ScriptingType(const ScriptingType& other)
         Script.SetupScriptVTable = other.Script.SetupScriptVTable;
         Script.SetupScriptObjectVTable = other.Script.SetupScriptObjectVTable;
         Script.DefaultInstance = nullptr;
+        Script.UsePool = other.Script.UsePool;
         break;
     case ScriptingTypes::Structure:
         Struct.Ctor = other.Struct.Ctor;
@@ -295,6 +307,7 @@ ScriptingType::ScriptingType(ScriptingType&& other)
         Script.SetupScriptObjectVTable = other.Script.SetupScriptObjectVTable;
         Script.DefaultInstance = other.Script.DefaultInstance;
         other.Script.DefaultInstance = nullptr;
+        Script.UsePool = other.Script.UsePool;
         break;
     case ScriptingTypes::Structure:
         Struct.Ctor = other.Struct.Ctor;
@@ -327,7 +340,7 @@ ScriptingType::~ScriptingType()
     {
     case ScriptingTypes::Script:
         if (Script.DefaultInstance)
-            Delete(Script.DefaultInstance);
+            ScriptingObjectsPool::Delete(Script.DefaultInstance);
         if (Script.VTable)
             Platform::Free((byte*)Script.VTable - GetVTablePrefix());
         Platform::Free(Script.InterfacesOffsets);
@@ -695,7 +708,7 @@ void BinaryModule::Destroy(bool isReloading)
     {
         if (type.Type == ScriptingTypes::Script && type.Script.DefaultInstance)
         {
-            Delete(type.Script.DefaultInstance);
+            ScriptingObjectsPool::Delete(type.Script.DefaultInstance);
             type.Script.DefaultInstance = nullptr;
         }
     }
@@ -921,6 +934,86 @@ void ManagedBinaryModule::OnLoading(MAssembly* assembly)
     }
 }
 
+#if !COMPILE_WITHOUT_CSHARP
+
+namespace
+{
+    // Metadata of the managed assembly types that is cached between the runs to skip the reflection scanning of all classes on load
+    struct ManagedTypesCache
+    {
+        // The managed-only scripting object types (in the initialization order).
+        Array<StringAnsi> ScriptingTypes;
+        // The static classes with module initializer methods.
+        Array<StringAnsi> ModuleInitializers;
+    };
+
+    String GetManagedTypesCachePath(const MAssembly* assembly)
+    {
+#if USE_EDITOR
+        const String cacheFolder = Globals::ProjectCacheFolder / TEXT("Scripting");
+#else
+        const String cacheFolder = Globals::ProductLocalFolder / TEXT("Cache/Scripting");
+#endif
+        return cacheFolder / String(assembly->GetName()) + TEXT(".types");
+    }
+
+    void WriteAssemblyStamp(WriteStream& stream, const MAssembly* assembly)
+    {
+        const String& path = assembly->GetAssemblyPath();
+        stream.WriteUint64(FileSystem::GetFileSize(path));
+        stream.WriteInt64(FileSystem::GetFileLastEditTime(path).Ticks);
+    }
+
+    bool LoadManagedTypesCache(const MAssembly* assembly, const MAssembly* flaxEngine, ManagedTypesCache& cache)
+    {
+        Array<byte> data;
+        if (File::ReadAllBytes(GetManagedTypesCachePath(assembly), data))
+            return true;
+
+        // Cache is valid only for the same assembly and engine assembly files (types hierarchy depends on both)
+        MemoryWriteStream stamp(64);
+        stamp.WriteInt32(MANAGED_TYPES_CACHE_VERSION);
+        WriteAssemblyStamp(stamp, assembly);
+        WriteAssemblyStamp(stamp, flaxEngine);
+        if ((uint32)data.Count() < stamp.GetPosition() || Platform::MemoryCompare(data.Get(), stamp.GetHandle(), stamp.GetPosition()) != 0)
+            return true;
+
+        MemoryReadStream stream(data.Get() + stamp.GetPosition(), data.Count() - stamp.GetPosition());
+        int32 count;
+        stream.ReadInt32(&count);
+        cache.ScriptingTypes.Resize(Math::Max(count, 0));
+        for (StringAnsi& typeName : cache.ScriptingTypes)
+            stream.Read(typeName);
+        stream.ReadInt32(&count);
+        cache.ModuleInitializers.Resize(Math::Max(count, 0));
+        for (StringAnsi& typeName : cache.ModuleInitializers)
+            stream.Read(typeName);
+        return stream.HasError();
+    }
+
+    void SaveManagedTypesCache(const MAssembly* assembly, const MAssembly* flaxEngine, const ManagedTypesCache& cache)
+    {
+        MemoryWriteStream stream(4096);
+        stream.WriteInt32(MANAGED_TYPES_CACHE_VERSION);
+        WriteAssemblyStamp(stream, assembly);
+        WriteAssemblyStamp(stream, flaxEngine);
+        stream.WriteInt32(cache.ScriptingTypes.Count());
+        for (const StringAnsi& typeName : cache.ScriptingTypes)
+            stream.Write(typeName);
+        stream.WriteInt32(cache.ModuleInitializers.Count());
+        for (const StringAnsi& typeName : cache.ModuleInitializers)
+            stream.Write(typeName);
+        const String path = GetManagedTypesCachePath(assembly);
+        FileSystem::CreateDirectory(StringUtils::GetDirectoryName(path));
+        if (File::WriteAllBytes(path, stream.GetHandle(), (int32)stream.GetPosition()))
+        {
+            LOG(Warning, "Failed to save managed types cache to '{0}'", path);
+        }
+    }
+}
+
+#endif
+
 void ManagedBinaryModule::OnLoaded(MAssembly* assembly)
 {
 #if !COMPILE_WITHOUT_CSHARP
@@ -929,6 +1022,17 @@ void ManagedBinaryModule::OnLoaded(MAssembly* assembly)
     ScopeLock lock(Locker);
 
     const auto& classes = assembly->GetClasses();
+    NativeBinaryModule* flaxEngine = (NativeBinaryModule*)GetBinaryModuleFlaxEngine();
+
+    // Try to use the cached managed types metadata to skip reflection scanning of all classes within the assembly
+    ManagedTypesCache typesCache;
+    const bool canUseTypesCache = this != flaxEngine && flaxEngine->Assembly->IsLoaded() && assembly->GetAssemblyPath().HasChars();
+    const bool useTypesCache = canUseTypesCache && !LoadManagedTypesCache(assembly, flaxEngine->Assembly, typesCache);
+    if (!useTypesCache)
+    {
+        typesCache.ScriptingTypes.Clear();
+        typesCache.ModuleInitializers.Clear();
+    }
 
     // Cache managed types information
     ClassToTypeIndex.EnsureCapacity(Types.Count() * 4);
@@ -960,8 +1064,16 @@ void ManagedBinaryModule::OnLoaded(MAssembly* assembly)
 
     // Cache types for managed-only types that can be used in the engine
     _firstManagedTypeIndex = Types.Count();
-    NativeBinaryModule* flaxEngine = (NativeBinaryModule*)GetBinaryModuleFlaxEngine();
-    if (flaxEngine->Assembly->IsLoaded())
+    if (useTypesCache)
+    {
+        for (const StringAnsi& typeName : typesCache.ScriptingTypes)
+        {
+            MClass* mclass;
+            if (classes.TryGet(typeName, mclass))
+                InitType(mclass);
+        }
+    }
+    else if (flaxEngine->Assembly->IsLoaded())
     {
         // TODO: check only assemblies that references FlaxEngine.CSharp.dll
         MClass* scriptingObjectType = this == flaxEngine ? classes["FlaxEngine.Object"] : ScriptingObject::GetStaticClass();
@@ -982,8 +1094,8 @@ void ManagedBinaryModule::OnLoaded(MAssembly* assembly)
         }
     }
 
-    // Invoke module initializers
-    if (flaxEngine->Assembly->IsLoaded() && this != flaxEngine)
+    // Find module initializers
+    if (!useTypesCache && flaxEngine->Assembly->IsLoaded() && this != flaxEngine)
     {
         const MClass* attribute = flaxEngine->Assembly->GetClass("FlaxEngine.ModuleInitializerAttribute");
         ASSERT_LOW_LAYER(attribute);
@@ -991,22 +1103,37 @@ void ManagedBinaryModule::OnLoaded(MAssembly* assembly)
         {
             MClass* mclass = i->Value;
             if (mclass->IsStatic() && !mclass->IsInterface() && mclass->HasAttribute(attribute))
+                typesCache.ModuleInitializers.Add(mclass->GetFullName());
+        }
+    }
+
+    // Save the types metadata for the next load
+    if (!useTypesCache && canUseTypesCache)
+    {
+        for (int32 typeIndex = _firstManagedTypeIndex; typeIndex < Types.Count(); typeIndex++)
+            typesCache.ScriptingTypes.Add(StringAnsi(Types[typeIndex].Fullname.Get(), Types[typeIndex].Fullname.Length()));
+        SaveManagedTypesCache(assembly, flaxEngine->Assembly, typesCache);
+    }
+
+    // Invoke module initializers
+    for (const StringAnsi& typeName : typesCache.ModuleInitializers)
+    {
+        MClass* mclass;
+        if (!classes.TryGet(typeName, mclass))
+            continue;
+        const auto& methods = mclass->GetMethods();
+        for (const MMethod* method : methods)
+        {
+            if (method->GetParametersCount() == 0)
             {
-                const auto& methods = mclass->GetMethods();
-                for (const MMethod* method : methods)
+                MObject* exception = nullptr;
+                method->Invoke(nullptr, nullptr, &exception);
+                if (exception)
                 {
-                    if (method->GetParametersCount() == 0)
-                    {
-                        MObject* exception = nullptr;
-                        method->Invoke(nullptr, nullptr, &exception);
-                        if (exception)
-                        {
-                            MException ex(exception);
-                            String methodName = String(method->GetName());
-                            ex.Log(LogType::Error, methodName.Get());
-                            LOG(Error, "Failed to call module initializer for class {0} from assembly {1}.", String(mclass->GetFullName()), assembly->ToString());
-                        }
-                    }
+                    MException ex(exception);
+                    String methodName = String(method->GetName());
+                    ex.Log(LogType::Error, methodName.Get());
+                    LOG(Error, "Failed to call module initializer for class {0} from assembly {1}.", String(mclass->GetFullName()), assembly->ToString());
                 }
             }
         }
@@ -41,6 +41,7 @@ void StdTypesContainer::Clear()
     Json_Deserialize = nullptr;
 
     ManagedArrayClass = nullptr;
+    ParallelUpdateAttribute = nullptr;
 
 #if USE_EDITOR
     ExecuteInEditModeAttribute = nullptr;
@@ -91,6 +92,7 @@ bool StdTypesContainer::Gather()
     GET_METHOD(Json_Deserialize, JSON, "Deserialize", 3);
 
     GET_CLASS(FlaxEngine, ManagedArrayClass, "FlaxEngine.Interop.ManagedArray");
+    GET_CLASS(FlaxEngine, ParallelUpdateAttribute, "FlaxEngine.ParallelUpdateAttribute");
 
 #if USE_EDITOR
     GET_CLASS(FlaxEngine, ExecuteInEditModeAttribute, "FlaxEngine.ExecuteInEditModeAttribute");
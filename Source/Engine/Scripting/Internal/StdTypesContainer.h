@@ -46,6 +46,7 @@ class FLAXENGINE_API StdTypesContainer : public Singleton<StdTypesContainer>
     MMethod* Json_Deserialize;
 
     MClass* ManagedArrayClass;
+    MClass* ParallelUpdateAttribute;
 
 #if USE_EDITOR
     MClass* ExecuteInEditModeAttribute;
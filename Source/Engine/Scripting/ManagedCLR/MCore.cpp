@@ -21,6 +21,11 @@ MDomain* MRootDomain = nullptr;
 MDomain* MActiveDomain = nullptr;
 Array<MDomain*, FixedAllocation<4>> MDomains;
 
+#if USE_NETCORE
+THREADLOCAL void* MCore::Scripts::TickObject = nullptr;
+THREADLOCAL int32 MCore::Scripts::TickIndex = -1;
+#endif
+
 MClass* MCore::TypeCache::Void = nullptr;
 MClass* MCore::TypeCache::Object = nullptr;
 MClass* MCore::TypeCache::Byte = nullptr;
@@ -104,6 +104,13 @@ class FLAXENGINE_API MCore
         static MGCHandle NewWeak(MObject* obj, bool trackResurrection = false);
         static MObject* GetTarget(const MGCHandle& handle);
         static void Free(const MGCHandle& handle);
+        static void New(Span<MObject*> objects, MGCHandle* handles, bool pinned = false);
+        static void Free(Span<MGCHandle> handles);
+
+        // Begins the scope (on the current thread) in which the freed handles are collected and released together in batches. Used to reduce interop overhead when deleting many objects at once.
+        static void BeginFreeBatch();
+        // Ends the batched handles releasing scope (frees all the collected handles).
+        static void EndFreeBatch();
     };
 
     /// <summary>
@@ -136,6 +143,22 @@ class FLAXENGINE_API MCore
         static bool IsAttached();
     };
 
+#if USE_NETCORE
+    /// <summary>
+    /// Helper utilities for C# scripts.
+    /// </summary>
+    struct FLAXENGINE_API Scripts
+    {
+        // The native script object which tick method is being invoked by InvokeTick on this thread (set by the managed code). Used by the script managed wrappers to call the native base method when C# script calls its base method.
+        static THREADLOCAL void* TickObject;
+        // The script vtable index of the tick method invoked by InvokeTick on this thread.
+        static THREADLOCAL int32 TickIndex;
+
+        // Invokes the tick method (OnUpdate, OnLateUpdate, OnFixedUpdate or OnLateFixedUpdate matching the script vtable index 8-11) on the given C# scripts with a single call to the managed runtime. The list contains pairs of the managed instance and the native script object.
+        static void InvokeTick(Span<void*> scripts, int32 scriptVTableIndex);
+    };
+#endif
+
     /// <summary>
     /// Helper utilities for C# exceptions throwing.
     /// </summary>
@@ -29,6 +29,7 @@
 #include "Engine/Scripting/BinaryModule.h"
 #include "Engine/Engine/Globals.h"
 #include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Profiler/ProfilerHitchDetector.h"
 #include "Engine/Threading/Threading.h"
 #include "Engine/Debug/Exceptions/CLRInnerException.h"
 #if DOTNET_HOST_CORECLR
@@ -184,6 +185,41 @@ Dictionary<void*, MAssembly*> CachedAssemblyHandles;
 /// </summary>
 void* GetStaticMethodPointer(const String& methodName);
 
+// Function pointers to the frequently called managed methods in NativeInterop class (resolved once on engine load to skip the lookup and the static initialization guard on every call)
+namespace InteropMethods
+{
+    void* NewObject = nullptr;
+    void* ObjectInit = nullptr;
+    void* GetObjectClass = nullptr;
+    void* BoxValue = nullptr;
+    void* UnboxValue = nullptr;
+    void* NewGCHandle = nullptr;
+    void* NewGCHandleWeak = nullptr;
+    void* NewGCHandles = nullptr;
+    void* FreeGCHandle = nullptr;
+    void* FreeGCHandles = nullptr;
+
+    void Init()
+    {
+        NewObject = GetStaticMethodPointer(TEXT("NewObject"));
+        ObjectInit = GetStaticMethodPointer(TEXT("ObjectInit"));
+        GetObjectClass = GetStaticMethodPointer(TEXT("GetObjectClass"));
+        BoxValue = GetStaticMethodPointer(TEXT("BoxValue"));
+        UnboxValue = GetStaticMethodPointer(TEXT("UnboxValue"));
+        NewGCHandle = GetStaticMethodPointer(TEXT("NewGCHandle"));
+        NewGCHandleWeak = GetStaticMethodPointer(TEXT("NewGCHandleWeak"));
+        NewGCHandles = GetStaticMethodPointer(TEXT("NewGCHandles"));
+        FreeGCHandle = GetStaticMethodPointer(TEXT("FreeGCHandle"));
+        FreeGCHandles = GetStaticMethodPointer(TEXT("FreeGCHandles"));
+    }
+}
+
+// Handles freed within the batch scope on this thread (see MCore::GCHandle::BeginFreeBatch)
+#define GC_HANDLE_FREE_BATCH_SIZE 64
+THREADLOCAL int32 GCHandleFreeBatchDepth = 0;
+THREADLOCAL int32 GCHandleFreeBatchCount = 0;
+THREADLOCAL MGCHandle GCHandleFreeBatch[GC_HANDLE_FREE_BATCH_SIZE];
+
 /// <summary>
 /// Calls the managed static method with given parameters.
 /// </summary>
@@ -269,6 +305,7 @@ bool MCore::LoadEngine()
 
     // Prepare managed side
     CallStaticMethod<void>(GetStaticMethodPointer(TEXT("Init")));
+    InteropMethods::Init();
 #ifdef MCORE_MAIN_MODULE_NAME
     // MCORE_MAIN_MODULE_NAME define is injected by Scripting.Build.cs on platforms that use separate shared library for engine symbols
     ::String flaxLibraryPath(Platform::GetMainDirectory() / TEXT(MACRO_TO_STR(MCORE_MAIN_MODULE_NAME)));
@@ -327,33 +364,28 @@ void MCore::ReloadScriptingAssemblyLoadContext()
 
 MObject* MCore::Object::Box(void* value, const MClass* klass)
 {
-    static void* BoxValuePtr = GetStaticMethodPointer(TEXT("BoxValue"));
-    return (MObject*)CallStaticMethod<void*, void*, void*>(BoxValuePtr, klass->_handle, value);
+    return (MObject*)CallStaticMethod<void*, void*, void*>(InteropMethods::BoxValue, klass->_handle, value);
 }
 
 void* MCore::Object::Unbox(MObject* obj)
 {
-    static void* UnboxValuePtr = GetStaticMethodPointer(TEXT("UnboxValue"));
-    return CallStaticMethod<void*, void*>(UnboxValuePtr, obj);
+    return CallStaticMethod<void*, void*>(InteropMethods::UnboxValue, obj);
 }
 
 MObject* MCore::Object::New(const MClass* klass)
 {
-    static void* NewObjectPtr = GetStaticMethodPointer(TEXT("NewObject"));
-    return (MObject*)CallStaticMethod<void*, void*>(NewObjectPtr, klass->_handle);
+    return (MObject*)CallStaticMethod<void*, void*>(InteropMethods::NewObject, klass->_handle);
 }
 
 void MCore::Object::Init(MObject* obj)
 {
-    static void* ObjectInitPtr = GetStaticMethodPointer(TEXT("ObjectInit"));
-    CallStaticMethod<void, void*>(ObjectInitPtr, obj);
+    CallStaticMethod<void, void*>(InteropMethods::ObjectInit, obj);
 }
 
 MClass* MCore::Object::GetClass(MObject* obj)
 {
     ASSERT(obj);
-    static void* GetObjectClassPtr = GetStaticMethodPointer(TEXT("GetObjectClass"));
-    return (MClass*)CallStaticMethod<MClass*, void*>(GetObjectClassPtr, obj);
+    return (MClass*)CallStaticMethod<MClass*, void*>(InteropMethods::GetObjectClass, obj);
 }
 
 MString* MCore::Object::ToString(MObject* obj)
@@ -435,15 +467,13 @@ MArray* MCore::Array::Unbox(MObject* obj)
 MGCHandle MCore::GCHandle::New(MObject* obj, bool pinned)
 {
     ASSERT(obj);
-    static void* NewGCHandlePtr = GetStaticMethodPointer(TEXT("NewGCHandle"));
-    return (MGCHandle)CallStaticMethod<void*, void*, bool>(NewGCHandlePtr, obj, pinned);
+    return (MGCHandle)CallStaticMethod<void*, void*, bool>(InteropMethods::NewGCHandle, obj, pinned);
 }
 
 MGCHandle MCore::GCHandle::NewWeak(MObject* obj, bool trackResurrection)
 {
     ASSERT(obj);
-    static void* NewGCHandleWeakPtr = GetStaticMethodPointer(TEXT("NewGCHandleWeak"));
-    return (MGCHandle)CallStaticMethod<void*, void*, bool>(NewGCHandleWeakPtr, obj, trackResurrection);
+    return (MGCHandle)CallStaticMethod<void*, void*, bool>(InteropMethods::NewGCHandleWeak, obj, trackResurrection);
 }
 
 MObject* MCore::GCHandle::GetTarget(const MGCHandle& handle)
@@ -453,29 +483,80 @@ MObject* MCore::GCHandle::GetTarget(const MGCHandle& handle)
 
 void MCore::GCHandle::Free(const MGCHandle& handle)
 {
-    static void* FreeGCHandlePtr = GetStaticMethodPointer(TEXT("FreeGCHandle"));
-    CallStaticMethod<void, void*>(FreeGCHandlePtr, (void*)handle);
+    if (GCHandleFreeBatchDepth != 0)
+    {
+        // Defer releasing the handle until the batch is full or the scope ends
+        GCHandleFreeBatch[GCHandleFreeBatchCount++] = handle;
+        if (GCHandleFreeBatchCount == GC_HANDLE_FREE_BATCH_SIZE)
+        {
+            Free(Span<MGCHandle>(GCHandleFreeBatch, GCHandleFreeBatchCount));
+            GCHandleFreeBatchCount = 0;
+        }
+        return;
+    }
+    CallStaticMethod<void, void*>(InteropMethods::FreeGCHandle, (void*)handle);
+}
+
+void MCore::GCHandle::New(Span<MObject*> objects, MGCHandle* handles, bool pinned)
+{
+    if (objects.Length() == 0)
+        return;
+    CallStaticMethod<void, void*, void*, int, bool>(InteropMethods::NewGCHandles, objects.Get(), handles, objects.Length(), pinned);
+}
+
+void MCore::GCHandle::Free(Span<MGCHandle> handles)
+{
+    if (handles.Length() == 0)
+        return;
+    CallStaticMethod<void, void*, int>(InteropMethods::FreeGCHandles, (void*)handles.Get(), handles.Length());
+}
+
+void MCore::GCHandle::BeginFreeBatch()
+{
+    GCHandleFreeBatchDepth++;
+}
+
+void MCore::GCHandle::EndFreeBatch()
+{
+    ASSERT_LOW_LAYER(GCHandleFreeBatchDepth > 0);
+    if (--GCHandleFreeBatchDepth == 0 && GCHandleFreeBatchCount != 0)
+    {
+        Free(Span<MGCHandle>(GCHandleFreeBatch, GCHandleFreeBatchCount));
+        GCHandleFreeBatchCount = 0;
+    }
+}
+
+static void GCCollect(int32 generation, MGCCollectionMode collectionMode, bool blocking, bool compacting)
+{
+    static void* GCCollectPtr = GetStaticMethodPointer(TEXT("GCCollect"));
+#if COMPILE_WITH_PROFILER
+    const double startTime = Platform::GetTimeSeconds();
+#endif
+    CallStaticMethod<void, int, int, bool, bool>(GCCollectPtr, generation, (int)collectionMode, blocking, compacting);
+#if COMPILE_WITH_PROFILER
+    // Report long blocking collections as hitches
+    const float timeMs = (float)((Platform::GetTimeSeconds() - startTime) * 1000.0);
+    if (blocking && timeMs >= ProfilerHitchDetector::GCThresholdMs && ProfilerHitchDetector::GetEnabled())
+        ProfilerHitchDetector::ReportHitch(String::Format(TEXT("GC collection {0:.2f} ms"), timeMs));
+#endif
 }
 
 void MCore::GC::Collect()
 {
     PROFILE_CPU();
-    static void* GCCollectPtr = GetStaticMethodPointer(TEXT("GCCollect"));
-    CallStaticMethod<void, int, int, bool, bool>(GCCollectPtr, MaxGeneration(), (int)MGCCollectionMode::Default, true, false);
+    GCCollect(MaxGeneration(), MGCCollectionMode::Default, true, false);
 }
 
 void MCore::GC::Collect(int32 generation)
 {
     PROFILE_CPU();
-    static void* GCCollectPtr = GetStaticMethodPointer(TEXT("GCCollect"));
-    CallStaticMethod<void, int, int, bool, bool>(GCCollectPtr, generation, (int)MGCCollectionMode::Default, true, false);
+    GCCollect(generation, MGCCollectionMode::Default, true, false);
 }
 
 void MCore::GC::Collect(int32 generation, MGCCollectionMode collectionMode, bool blocking, bool compacting)
 {
     PROFILE_CPU();
-    static void* GCCollectPtr = GetStaticMethodPointer(TEXT("GCCollect"));
-    CallStaticMethod<void, int, int, bool, bool>(GCCollectPtr, generation, (int)collectionMode, blocking, compacting);
+    GCCollect(generation, collectionMode, blocking, compacting);
 }
 
 int32 MCore::GC::MaxGeneration()
@@ -528,6 +609,18 @@ void MCore::GC::FreeMemory(void* ptr, bool coTaskMem)
     CallStaticMethod<void, void*, bool>(FreeMemoryPtr, ptr, coTaskMem);
 }
 
+void MCore::Scripts::InvokeTick(Span<void*> scripts, int32 scriptVTableIndex)
+{
+    PROFILE_CPU();
+    static void* InvokeScriptsTickPtr = GetStaticMethodPointer(TEXT("InvokeScriptsTick"));
+    const int32 prevTickIndex = TickIndex;
+    void* prevTickObject = TickObject;
+    TickIndex = scriptVTableIndex;
+    CallStaticMethod<void, void**, int, int, void**>(InvokeScriptsTickPtr, scripts.Get(), scripts.Length() / 2, scriptVTableIndex, &TickObject);
+    TickIndex = prevTickIndex;
+    TickObject = prevTickObject;
+}
+
 void MCore::Thread::Attach()
 {
 #if DOTNET_HOST_MONO
@@ -836,6 +836,26 @@ void MCore::GCHandle::Free(const MGCHandle& handle)
     mono_gchandle_free(handle);
 }
 
+void MCore::GCHandle::New(Span<MObject*> objects, MGCHandle* handles, bool pinned)
+{
+    for (int32 i = 0; i < objects.Length(); i++)
+        handles[i] = mono_gchandle_new(objects[i], pinned);
+}
+
+void MCore::GCHandle::Free(Span<MGCHandle> handles)
+{
+    for (const MGCHandle handle : handles)
+        mono_gchandle_free(handle);
+}
+
+void MCore::GCHandle::BeginFreeBatch()
+{
+}
+
+void MCore::GCHandle::EndFreeBatch()
+{
+}
+
 void MCore::GC::Collect()
 {
     PROFILE_CPU();
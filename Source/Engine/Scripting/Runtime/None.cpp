@@ -169,6 +169,24 @@ void MCore::GCHandle::Free(const MGCHandle& handle)
 {
 }
 
+void MCore::GCHandle::New(Span<MObject*> objects, MGCHandle* handles, bool pinned)
+{
+    for (int32 i = 0; i < objects.Length(); i++)
+        handles[i] = (MGCHandle)(uintptr)objects[i];
+}
+
+void MCore::GCHandle::Free(Span<MGCHandle> handles)
+{
+}
+
+void MCore::GCHandle::BeginFreeBatch()
+{
+}
+
+void MCore::GCHandle::EndFreeBatch()
+{
+}
+
 void MCore::GC::Collect()
 {
 }
@@ -2,9 +2,9 @@
 
 #include "Script.h"
 #include "Engine/Core/Log.h"
-#if USE_EDITOR
 #include "Internal/StdTypesContainer.h"
 #include "ManagedCLR/MClass.h"
+#if USE_EDITOR
 #include "Editor/Editor.h"
 #endif
 #include "Scripting.h"
@@ -30,7 +30,14 @@ Script::Script(const SpawnParams& params)
     , _wasAwakeCalled(false)
     , _wasStartCalled(false)
     , _wasEnableCalled(false)
+    , _tickIntervalFrames(false)
+    , _tickStagger(true)
+    , _tickInterval(0.0f)
+    , _tickGroup(0)
 {
+    const MClass* klass = GetClass();
+    const MClass* parallelUpdateAttribute = StdTypesContainer::Instance()->ParallelUpdateAttribute;
+    _parallelUpdate = klass && parallelUpdateAttribute && klass->HasAttribute(parallelUpdateAttribute);
 #if USE_EDITOR
     _executeInEditor = GetClass()->HasAttribute(StdTypesContainer::Instance()->ExecuteInEditModeAttribute);
 #endif
@@ -189,6 +196,30 @@ void Script::SetupType()
     }
 }
 
+void Script::SetTickInterval(float value)
+{
+    value = Math::Max(value, 0.0f);
+    if (_tickInterval != value)
+        SetTicking(value, _tickIntervalFrames, _tickGroup);
+}
+
+void Script::SetTickIntervalFrames(bool value)
+{
+    if (GetTickIntervalFrames() != value)
+        SetTicking(_tickInterval, value, _tickGroup);
+}
+
+void Script::SetTickStagger(bool value)
+{
+    _tickStagger = value;
+}
+
+void Script::SetTickGroup(int32 value)
+{
+    if (_tickGroup != value)
+        SetTicking(_tickInterval, _tickIntervalFrames, value);
+}
+
 void Script::Start()
 {
     if (_wasStartCalled)
@@ -234,6 +265,19 @@ void Script::Disable()
     }
 }
 
+void Script::SetTicking(float interval, bool intervalFrames, int32 group)
+{
+    // Re-register enabled script in the scene ticking to apply the new settings
+    Scene* scene = _wasEnableCalled && _parent ? _parent->GetScene() : nullptr;
+    if (scene)
+        scene->Ticking.RemoveScript(this);
+    _tickInterval = interval;
+    _tickIntervalFrames = intervalFrames;
+    _tickGroup = group;
+    if (scene)
+        scene->Ticking.AddScript(this);
+}
+
 String Script::ToString() const
 {
     const auto& type = GetType();
@@ -305,12 +349,14 @@ void Script::BeginPlay(SceneBeginData* data)
 
     // Set flag
     Flags |= ObjectFlags::IsDuringPlay;
+    Level::indexScript(this, true);
 }
 
 void Script::EndPlay()
 {
     // Clear flag
     Flags &= ~ObjectFlags::IsDuringPlay;
+    Level::indexScript(this, false);
 
     // Cleanup managed object
     //DestroyManaged();
@@ -326,6 +372,10 @@ void Script::Serialize(SerializeStream& stream, const void* otherObj)
     SERIALIZE_GET_OTHER_OBJ(Script);
 
     SERIALIZE_BIT_MEMBER(Enabled, _enabled);
+    SERIALIZE_MEMBER(TickInterval, _tickInterval);
+    SERIALIZE_BIT_MEMBER(TickIntervalFrames, _tickIntervalFrames);
+    SERIALIZE_BIT_MEMBER(TickStagger, _tickStagger);
+    SERIALIZE_MEMBER(TickGroup, _tickGroup);
 }
 
 void Script::Deserialize(DeserializeStream& stream, ISerializeModifier* modifier)
@@ -334,6 +384,26 @@ void Script::Deserialize(DeserializeStream& stream, ISerializeModifier* modifier
     SceneObject::Deserialize(stream, modifier);
 
     DESERIALIZE_BIT_MEMBER(Enabled, _enabled);
+    DESERIALIZE_BIT_MEMBER(TickStagger, _tickStagger);
+    {
+        const float tickInterval = _tickInterval;
+        const bool tickIntervalFrames = _tickIntervalFrames;
+        const int32 tickGroup = _tickGroup;
+        DESERIALIZE_MEMBER(TickInterval, _tickInterval);
+        DESERIALIZE_BIT_MEMBER(TickIntervalFrames, _tickIntervalFrames);
+        DESERIALIZE_MEMBER(TickGroup, _tickGroup);
+        if (_wasEnableCalled && (tickInterval != _tickInterval || tickIntervalFrames != (bool)_tickIntervalFrames || tickGroup != _tickGroup))
+        {
+            // Update ticking of the enabled script (eg. when applying prefab changes during play)
+            const float newTickInterval = Math::Max(_tickInterval, 0.0f);
+            const bool newTickIntervalFrames = _tickIntervalFrames;
+            const int32 newTickGroup = _tickGroup;
+            _tickInterval = tickInterval;
+            _tickIntervalFrames = tickIntervalFrames;
+            _tickGroup = tickGroup;
+            SetTicking(newTickInterval, newTickIntervalFrames, newTickGroup);
+        }
+    }
     DESERIALIZE_MEMBER(PrefabID, _prefabID);
 
     {
@@ -351,11 +421,14 @@ void Script::Deserialize(DeserializeStream& stream, ISerializeModifier* modifier
                 }
                 else
                 {
+                    // Lock hierarchy when loading scene objects on job threads
+                    Level::ScenesLock.Lock();
                     if (_parent)
                         _parent->Scripts.RemoveKeepOrder(this);
                     _parent = parent;
                     if (_parent)
                         _parent->Scripts.Add(this);
+                    Level::ScenesLock.Unlock();
                 }
             }
             else if (!parent && parentId.IsValid())
@@ -23,9 +23,15 @@ API_CLASS(Abstract) class FLAXENGINE_API Script : public SceneObject
     uint16 _wasAwakeCalled : 1;
     uint16 _wasStartCalled : 1;
     uint16 _wasEnableCalled : 1;
+    // Enables running OnUpdate in parallel with other scripts (set from constructor of native scripts or via ParallelUpdate attribute in C#)
+    uint16 _parallelUpdate : 1;
+    uint16 _tickIntervalFrames : 1;
+    uint16 _tickStagger : 1;
 #if USE_EDITOR
     uint16 _executeInEditor : 1;
 #endif
+    float _tickInterval;
+    int32 _tickGroup;
 
 public:
     /// <summary>
@@ -53,6 +59,64 @@ API_CLASS(Abstract) class FLAXENGINE_API Script : public SceneObject
     /// </summary>
     API_PROPERTY() void SetActor(Actor* value);
 
+    /// <summary>
+    /// Gets the interval between the script updates (in seconds or frames, see TickIntervalFrames). Value 0 updates the script every frame (default). Used by all update events (OnUpdate, OnLateUpdate, OnFixedUpdate and OnLateFixedUpdate).
+    /// </summary>
+    /// <remarks>Time.DeltaTime reports the delta time of the current frame, not the time elapsed since the previous script update.</remarks>
+    API_PROPERTY(Attributes="HideInEditor, NoAnimate")
+    FORCE_INLINE float GetTickInterval() const
+    {
+        return _tickInterval;
+    }
+
+    /// <summary>
+    /// Sets the interval between the script updates (in seconds or frames, see TickIntervalFrames). Value 0 updates the script every frame (default). Used by all update events (OnUpdate, OnLateUpdate, OnFixedUpdate and OnLateFixedUpdate).
+    /// </summary>
+    API_PROPERTY() void SetTickInterval(float value);
+
+    /// <summary>
+    /// Gets value indicating whether TickInterval is specified in frames (of the update event) rather than in seconds of game time.
+    /// </summary>
+    API_PROPERTY(Attributes="HideInEditor, NoAnimate")
+    FORCE_INLINE bool GetTickIntervalFrames() const
+    {
+        return _tickIntervalFrames != 0;
+    }
+
+    /// <summary>
+    /// Sets value indicating whether TickInterval is specified in frames (of the update event) rather than in seconds of game time.
+    /// </summary>
+    API_PROPERTY() void SetTickIntervalFrames(bool value);
+
+    /// <summary>
+    /// Gets value indicating whether the first update of the script using TickInterval is offset by a fraction of the interval. Spreads the updates of many scripts with the same interval across frames (enabled by default).
+    /// </summary>
+    API_PROPERTY(Attributes="HideInEditor, NoAnimate")
+    FORCE_INLINE bool GetTickStagger() const
+    {
+        return _tickStagger != 0;
+    }
+
+    /// <summary>
+    /// Sets value indicating whether the first update of the script using TickInterval is offset by a fraction of the interval. Spreads the updates of many scripts with the same interval across frames (enabled by default).
+    /// </summary>
+    API_PROPERTY() void SetTickStagger(bool value);
+
+    /// <summary>
+    /// Gets the tick group of the script. Scripts with the lower group are updated before the scripts with the higher group (within the same scene and update event). Scripts within the same group are updated in the order they were enabled. Default is 0.
+    /// </summary>
+    /// <remarks>Scripts with ParallelUpdate attribute are updated before all other scripts, regardless of their tick group.</remarks>
+    API_PROPERTY(Attributes="HideInEditor, NoAnimate")
+    FORCE_INLINE int32 GetTickGroup() const
+    {
+        return _tickGroup;
+    }
+
+    /// <summary>
+    /// Sets the tick group of the script. Scripts with the lower group are updated before the scripts with the higher group (within the same scene and update event). Scripts within the same group are updated in the order they were enabled. Default is 0.
+    /// </summary>
+    API_PROPERTY() void SetTickGroup(int32 value);
+
 public:
     /// <summary>
     /// Called after the object is loaded.
@@ -136,6 +200,7 @@ API_CLASS(Abstract) class FLAXENGINE_API Script : public SceneObject
     void Start();
     void Enable();
     void Disable();
+    void SetTicking(float interval, bool intervalFrames, int32 group);
 
 public:
     // [ScriptingObject]
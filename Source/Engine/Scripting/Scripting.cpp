@@ -29,10 +29,12 @@
 #include "Engine/Content/Content.h"
 #include "Engine/Engine/EngineService.h"
 #include "Engine/Engine/Globals.h"
+#include "Engine/Engine/StartupTrace.h"
 #include "Engine/Engine/Time.h"
 #include "Engine/Graphics/RenderTask.h"
 #include "Engine/Serialization/JsonTools.h"
 #include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Profiler/ProfilerMemory.h"
 
 extern void registerFlaxEngineInternalCalls();
 
@@ -58,7 +60,6 @@ namespace
 {
     MDomain* _rootDomain = nullptr;
     MDomain* _scriptsDomain = nullptr;
-    CriticalSection _objectsLocker;
 #define USE_OBJECTS_DISPOSE_CRASHES_DEBUGGING 0
 #if USE_OBJECTS_DISPOSE_CRASHES_DEBUGGING
     struct ScriptingObjectData
@@ -94,10 +95,33 @@ namespace
         }
     };
 
-    Dictionary<Guid, ScriptingObjectData> _objectsDictionary(1024 * 16);
+    typedef ScriptingObjectData ObjectsRegistryValue;
 #else
-    Dictionary<Guid, ScriptingObject*> _objectsDictionary(1024 * 16);
+    typedef ScriptingObject* ObjectsRegistryValue;
 #endif
+
+    // Objects registry is split into shards (by object ID hash), each with its own lock, to reduce contention when objects are searched or registered from many threads (eg. scenes loading or networking)
+#define OBJECTS_REGISTRY_SHARDS_BITS 6
+#define OBJECTS_REGISTRY_SHARDS (1 << OBJECTS_REGISTRY_SHARDS_BITS)
+    struct alignas(PLATFORM_CACHE_LINE_SIZE) ObjectsRegistryShard
+    {
+        CriticalSection Locker;
+        Dictionary<Guid, ObjectsRegistryValue> Objects;
+
+        ObjectsRegistryShard()
+            : Locker("Scripting.ObjectsRegistry")
+            , Objects(1024 * 16 / OBJECTS_REGISTRY_SHARDS)
+        {
+        }
+    };
+
+    ObjectsRegistryShard _objectsRegistry[OBJECTS_REGISTRY_SHARDS];
+
+    FORCE_INLINE ObjectsRegistryShard& GetObjectsRegistryShard(const Guid& id)
+    {
+        // Use the upper bits of the mixed hash (dictionary buckets use the lower bits)
+        return _objectsRegistry[(GetHash(id) * 0x9E3779B1u) >> (32 - OBJECTS_REGISTRY_SHARDS_BITS)];
+    }
     bool _isEngineAssemblyLoaded = false;
     bool _hasGameModulesLoaded = false;
     MMethod* _method_Update = nullptr;
@@ -122,19 +146,22 @@ namespace
 
         // Destroy objects from game assemblies (eg. not released objects that might crash if persist in memory after reload)
         const auto flaxModule = GetBinaryModuleFlaxEngine();
-        _objectsLocker.Lock();
-        for (auto i = _objectsDictionary.Begin(); i.IsNotEnd(); ++i)
+        for (auto& shard : _objectsRegistry)
         {
-            auto obj = i->Value;
-            if (gameOnly && obj->GetTypeHandle().Module == flaxModule)
-                continue;
+            shard.Locker.Lock();
+            for (auto i = shard.Objects.Begin(); i.IsNotEnd(); ++i)
+            {
+                auto obj = i->Value;
+                if (gameOnly && obj->GetTypeHandle().Module == flaxModule)
+                    continue;
 
 #if USE_OBJECTS_DISPOSE_CRASHES_DEBUGGING
-            LOG(Info, "[OnScriptingDispose] obj = 0x{0:x}, {1}", (uint64)obj.Ptr, String(obj.TypeName));
+                LOG(Info, "[OnScriptingDispose] obj = 0x{0:x}, {1}", (uint64)obj.Ptr, String(obj.TypeName));
 #endif
-            obj->OnScriptingDispose();
+                obj->OnScriptingDispose();
+            }
+            shard.Locker.Unlock();
         }
-        _objectsLocker.Unlock();
 
         // Release assets sourced from game assemblies
         Array<Asset*> assets = Content::GetAssets();
@@ -170,10 +197,13 @@ bool ScriptingService::Init()
     Stopwatch stopwatch;
 
     // Initialize managed runtime
-    if (MCore::LoadEngine())
     {
-        LOG(Fatal, "C# runtime initialization failed.");
-        return true;
+        STARTUP_TRACE_SCOPE("C# Runtime");
+        if (MCore::LoadEngine())
+        {
+            LOG(Fatal, "C# runtime initialization failed.");
+            return true;
+        }
     }
 
     // Cache root domain
@@ -232,6 +262,7 @@ bool ScriptingService::Init()
 void ScriptingService::Update()
 {
     PROFILE_CPU_NAMED("Scripting::Update");
+    PROFILE_MEM(Scripting);
     INVOKE_EVENT(Update);
 
 #ifdef USE_NETCORE
@@ -246,24 +277,28 @@ void ScriptingService::Update()
 void ScriptingService::LateUpdate()
 {
     PROFILE_CPU_NAMED("Scripting::LateUpdate");
+    PROFILE_MEM(Scripting);
     INVOKE_EVENT(LateUpdate);
 }
 
 void ScriptingService::FixedUpdate()
 {
     PROFILE_CPU_NAMED("Scripting::FixedUpdate");
+    PROFILE_MEM(Scripting);
     INVOKE_EVENT(FixedUpdate);
 }
 
 void ScriptingService::LateFixedUpdate()
 {
     PROFILE_CPU_NAMED("Scripting::LateFixedUpdate");
+    PROFILE_MEM(Scripting);
     INVOKE_EVENT(LateFixedUpdate);
 }
 
 void ScriptingService::Draw()
 {
     PROFILE_CPU_NAMED("Scripting::Draw");
+    PROFILE_MEM(Scripting);
     INVOKE_EVENT(Draw);
 }
 
@@ -474,6 +509,7 @@ bool Scripting::LoadBinaryModules(const String& path, const String& projectFolde
 bool Scripting::Load()
 {
     PROFILE_CPU();
+    STARTUP_TRACE_SCOPE("Scripting Assemblies");
     // Note: this action can be called from main thread (due to Mono problems with assemblies actions from other threads)
     ASSERT(IsInMainThread());
     ScopeLock lock(BinaryModule::Locker);
@@ -725,9 +761,14 @@ void Scripting::Reload(bool canTriggerSceneReload)
 Array<ScriptingObject*, HeapAllocation> Scripting::GetObjects()
 {
     Array<ScriptingObject*> objects;
-    _objectsLocker.Lock();
-    _objectsDictionary.GetValues(objects);
-    _objectsLocker.Unlock();
+    for (auto& shard : _objectsRegistry)
+    {
+        shard.Locker.Lock();
+        objects.EnsureCapacity(objects.Count() + shard.Objects.Count());
+        for (auto i = shard.Objects.Begin(); i.IsNotEnd(); ++i)
+            objects.Add(i->Value);
+        shard.Locker.Unlock();
+    }
     return objects;
 }
 
@@ -864,17 +905,18 @@ ScriptingObject* Scripting::FindObject(Guid id, const MClass* type)
     }
 
     // Try to find it
+    auto& shard = GetObjectsRegistryShard(id);
 #if USE_OBJECTS_DISPOSE_CRASHES_DEBUGGING
     ScriptingObjectData data;
-    _objectsLocker.Lock();
-    _objectsDictionary.TryGet(id, data);
-    _objectsLocker.Unlock();
+    shard.Locker.Lock();
+    shard.Objects.TryGet(id, data);
+    shard.Locker.Unlock();
     auto result = data.Ptr;
 #else
     ScriptingObject* result = nullptr;
-    _objectsLocker.Lock();
-    _objectsDictionary.TryGet(id, result);
-    _objectsLocker.Unlock();
+    shard.Locker.Lock();
+    shard.Objects.TryGet(id, result);
+    shard.Locker.Unlock();
 #endif
     if (result)
     {
@@ -918,17 +960,18 @@ ScriptingObject* Scripting::TryFindObject(Guid id, const MClass* type)
     }
 
     // Try to find it
+    auto& shard = GetObjectsRegistryShard(id);
 #if USE_OBJECTS_DISPOSE_CRASHES_DEBUGGING
     ScriptingObjectData data;
-    _objectsLocker.Lock();
-    _objectsDictionary.TryGet(id, data);
-    _objectsLocker.Unlock();
+    shard.Locker.Lock();
+    shard.Objects.TryGet(id, data);
+    shard.Locker.Unlock();
     auto result = data.Ptr;
 #else
     ScriptingObject* result = nullptr;
-    _objectsLocker.Lock();
-    _objectsDictionary.TryGet(id, result);
-    _objectsLocker.Unlock();
+    shard.Locker.Lock();
+    shard.Objects.TryGet(id, result);
+    shard.Locker.Unlock();
 #endif
 
     // Check type
@@ -944,12 +987,15 @@ ScriptingObject* Scripting::TryFindObject(const MClass* type)
 {
     if (type == nullptr)
         return nullptr;
-    ScopeLock lock(_objectsLocker);
-    for (auto i = _objectsDictionary.Begin(); i.IsNotEnd(); ++i)
+    for (auto& shard : _objectsRegistry)
     {
-        const auto obj = i->Value;
-        if (obj->GetClass() == type)
-            return obj;
+        ScopeLock lock(shard.Locker);
+        for (auto i = shard.Objects.Begin(); i.IsNotEnd(); ++i)
+        {
+            const auto obj = i->Value;
+            if (obj->GetClass() == type)
+                return obj;
+        }
     }
     return nullptr;
 }
@@ -962,13 +1008,15 @@ ScriptingObject* Scripting::FindObject(const MObject* managedInstance)
 
     // TODO: optimize it by reading the unmanagedPtr or _internalId from managed Object property
 
-    ScopeLock lock(_objectsLocker);
-
-    for (auto i = _objectsDictionary.Begin(); i.IsNotEnd(); ++i)
+    for (auto& shard : _objectsRegistry)
     {
-        const auto obj = i->Value;
-        if (obj->GetManagedInstance() == managedInstance)
-            return obj;
+        ScopeLock lock(shard.Locker);
+        for (auto i = shard.Objects.Begin(); i.IsNotEnd(); ++i)
+        {
+            const auto obj = i->Value;
+            if (obj->GetManagedInstance() == managedInstance)
+                return obj;
+        }
     }
     return nullptr;
 }
@@ -978,20 +1026,20 @@ void Scripting::OnManagedInstanceDeleted(ScriptingObject* obj)
     PROFILE_CPU();
     ASSERT(obj);
 
-    // Validate if object still exists
-    _objectsLocker.Lock();
-    if (_objectsDictionary.ContainsValue(obj))
+    // Validate if object still exists (object might be already deleted so search by pointer, shard lock prevents it from being removed meanwhile)
+    for (auto& shard : _objectsRegistry)
     {
+        ScopeLock lock(shard.Locker);
+        if (shard.Objects.ContainsValue(obj))
+        {
 #if USE_OBJECTS_DISPOSE_CRASHES_DEBUGGING
-        LOG(Info, "[OnManagedInstanceDeleted] obj = 0x{0:x}, {1}", (uint64)obj, String(ScriptingObjectData(obj).TypeName));
+            LOG(Info, "[OnManagedInstanceDeleted] obj = 0x{0:x}, {1}", (uint64)obj, String(ScriptingObjectData(obj).TypeName));
 #endif
-        obj->OnManagedInstanceDeleted();
-    }
-    else
-    {
-        //LOG(Warning, "Object finalization called for already removed object (address={0:x})", (uint64)obj);
+            obj->OnManagedInstanceDeleted();
+            return;
+        }
     }
-    _objectsLocker.Unlock();
+    //LOG(Warning, "Object finalization called for already removed object (address={0:x})", (uint64)obj);
 }
 
 bool Scripting::HasGameModulesLoaded()
@@ -1019,16 +1067,17 @@ bool Scripting::IsTypeFromGameScripts(const MClass* type)
 void Scripting::RegisterObject(ScriptingObject* obj)
 {
     const Guid id = obj->GetID();
-    ScopeLock lock(_objectsLocker);
+    auto& shard = GetObjectsRegistryShard(id);
+    ScopeLock lock(shard.Locker);
 
-    //ASSERT(!_objectsDictionary.ContainsValue(obj));
+    //ASSERT(!shard.Objects.ContainsValue(obj));
 #if ENABLE_ASSERTION
 #if USE_OBJECTS_DISPOSE_CRASHES_DEBUGGING
     ScriptingObjectData other;
-    if (_objectsDictionary.TryGet(id, other))
+    if (shard.Objects.TryGet(id, other))
 #else
     ScriptingObject* other;
-    if (_objectsDictionary.TryGet(id, other))
+    if (shard.Objects.TryGet(id, other))
 #endif
     {
         // Something went wrong...
@@ -1039,33 +1088,43 @@ void Scripting::RegisterObject(ScriptingObject* obj)
 #if USE_OBJECTS_DISPOSE_CRASHES_DEBUGGING
     LOG(Info, "[RegisterObject] obj = 0x{0:x}, {1}", (uint64)obj, String(ScriptingObjectData(obj).TypeName));
 #endif
-    _objectsDictionary[id] = obj;
+    shard.Objects[id] = obj;
 }
 
 void Scripting::UnregisterObject(ScriptingObject* obj)
 {
-    ScopeLock lock(_objectsLocker);
+    const Guid id = obj->GetID();
+    auto& shard = GetObjectsRegistryShard(id);
+    ScopeLock lock(shard.Locker);
 
-    //ASSERT(!obj->_id.IsValid() || _objectsDictionary.ContainsValue(obj));
+    //ASSERT(!obj->_id.IsValid() || shard.Objects.ContainsValue(obj));
 
 #if USE_OBJECTS_DISPOSE_CRASHES_DEBUGGING
     LOG(Info, "[UnregisterObject] obj = 0x{0:x}, {1}", (uint64)obj, String(ScriptingObjectData(obj).TypeName));
 #endif
-    _objectsDictionary.Remove(obj->GetID());
+    shard.Objects.Remove(id);
 }
 
 void Scripting::OnObjectIdChanged(ScriptingObject* obj, const Guid& oldId)
 {
-    ScopeLock lock(_objectsLocker);
-
     ASSERT(obj && oldId.IsValid());
-    ASSERT(obj->GetID() != oldId);
-    ASSERT(_objectsDictionary.ContainsKey(oldId));
-    //ASSERT(_objectsDictionary.ContainsValue(obj));
-    ASSERT(!_objectsDictionary.ContainsKey(obj->GetID()));
-
-    _objectsDictionary.Remove(oldId);
-    _objectsDictionary.Add(obj->GetID(), obj);
+    const Guid id = obj->GetID();
+    ASSERT(id != oldId);
+    auto& oldShard = GetObjectsRegistryShard(oldId);
+    auto& newShard = GetObjectsRegistryShard(id);
+
+    // Lock both shards in the same order to prevent deadlocks
+    auto& firstShard = &oldShard < &newShard ? oldShard : newShard;
+    auto& secondShard = &oldShard < &newShard ? newShard : oldShard;
+    ScopeLock lockFirst(firstShard.Locker);
+    ScopeLock lockSecond(secondShard.Locker);
+
+    ASSERT(oldShard.Objects.ContainsKey(oldId));
+    //ASSERT(oldShard.Objects.ContainsValue(obj));
+    ASSERT(!newShard.Objects.ContainsKey(id));
+
+    oldShard.Objects.Remove(oldId);
+    newShard.Objects.Add(id, obj);
 }
 
 bool initFlaxEngine()
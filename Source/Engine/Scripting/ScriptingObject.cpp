@@ -452,7 +452,10 @@ void ScriptingObject::OnDeleteObject()
         UnregisterObject();
 
     // Base
-    Object::OnDeleteObject();
+    if (EnumHasAnyFlags(Flags, ObjectFlags::IsPooled))
+        ScriptingObjectsPool::Delete(this);
+    else
+        Object::OnDeleteObject();
 }
 
 String ScriptingObject::ToString() const
@@ -593,7 +596,7 @@ DEFINE_INTERNAL_CALL(MObject*) ObjectInternal_Create1(MTypeObject* type)
     if (managedInstance == nullptr)
     {
         LOG(Error, "Cannot create managed instance for type \'{0}\'.", String(typeClass->GetFullName()));
-        Delete(obj);
+        ScriptingObjectsPool::Delete(obj);
     }
 
     return managedInstance;
@@ -631,7 +634,7 @@ DEFINE_INTERNAL_CALL(MObject*) ObjectInternal_Create2(MString* typeNameObj)
     if (managedInstance == nullptr)
     {
         LOG(Error, "Cannot create managed instance for type \'{0}\'.", String(typeName));
-        Delete(obj);
+        ScriptingObjectsPool::Delete(obj);
     }
 
     return managedInstance;
@@ -817,7 +820,7 @@ class ScriptingObjectInternal
 
     static ScriptingObject* Spawn(const ScriptingObjectSpawnParams& params)
     {
-        return New<ScriptingObject>(params);
+        return ScriptingObjectsPool::New<ScriptingObject>(params);
     }
 };
 
@@ -52,7 +52,7 @@ API_CLASS(InBuild) class FLAXENGINE_API ScriptingObject : public Object
         auto obj = NewObject(typeHandle);
         if (obj && !obj->Is<T>())
         {
-            Delete(obj);
+            ScriptingObjectsPool::Delete(obj);
             obj = nullptr;
         }
         return (T*)obj;
@@ -0,0 +1,260 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "ScriptingObjectsPool.h"
+#include "Scripting.h"
+#include "ScriptingObject.h"
+#include "ManagedCLR/MClass.h"
+#include "Engine/Core/Log.h"
+#include "Engine/Platform/CriticalSection.h"
+
+#define POOL_SLAB_SIZE (64 * 1024)
+#define POOL_SIZE_CLASS_GRANULARITY 64
+#define POOL_SIZE_CLASSES 64 // Objects bigger than 4kB use heap
+#define POOL_ALIGNMENT 16
+
+namespace
+{
+    struct PoolSizeClass;
+    struct PoolSlab;
+
+    // Header placed before each pooled object
+    struct PoolBlockHeader
+    {
+        // Slab that owns the object memory (null if allocated from heap)
+        PoolSlab* Slab;
+        uint64 Padding;
+    };
+
+    struct PoolFreeBlock
+    {
+        PoolFreeBlock* Next;
+    };
+
+    // Header placed at the beginning of the slab memory, followed by the blocks
+    struct PoolSlab
+    {
+        PoolSizeClass* Owner;
+        PoolSlab* Prev;
+        PoolSlab* Next;
+        PoolFreeBlock* FreeList;
+        // Amount of blocks carved from the slab memory so far
+        int32 UsedCount;
+        // Amount of blocks allocated and not yet freed
+        int32 LiveCount;
+        uint64 Padding;
+    };
+
+    static_assert(sizeof(PoolBlockHeader) == POOL_ALIGNMENT, "Invalid scripting objects pool block header size.");
+    static_assert(sizeof(PoolSlab) % POOL_ALIGNMENT == 0, "Invalid scripting objects pool slab header size.");
+
+    struct PoolSizeClass
+    {
+        CriticalSection Locker;
+        // Size of the single block (including header)
+        int32 BlockSize = 0;
+        // Amount of blocks in a single slab
+        int32 BlocksPerSlab = 0;
+        // Linked list of slabs with any free blocks
+        PoolSlab* Partial = nullptr;
+        // Cached empty slab (to prevent allocations when spawning and deleting a single object repeatedly)
+        PoolSlab* Empty = nullptr;
+
+        FORCE_INLINE bool IsFull(const PoolSlab* slab) const
+        {
+            return slab->FreeList == nullptr && slab->UsedCount == BlocksPerSlab;
+        }
+
+        void Link(PoolSlab* slab)
+        {
+            slab->Prev = nullptr;
+            slab->Next = Partial;
+            if (Partial)
+                Partial->Prev = slab;
+            Partial = slab;
+        }
+
+        void Unlink(PoolSlab* slab)
+        {
+            if (slab->Prev)
+                slab->Prev->Next = slab->Next;
+            else
+                Partial = slab->Next;
+            if (slab->Next)
+                slab->Next->Prev = slab->Prev;
+            slab->Prev = slab->Next = nullptr;
+        }
+
+        PoolBlockHeader* Allocate()
+        {
+            PoolSlab* slab = Partial;
+            if (!slab)
+            {
+                slab = Empty;
+                Empty = nullptr;
+                if (!slab)
+                {
+                    slab = (PoolSlab*)Allocator::Allocate(POOL_SLAB_SIZE, POOL_ALIGNMENT);
+                    if (!slab)
+                        OUT_OF_MEMORY;
+                    slab->Owner = this;
+                    slab->FreeList = nullptr;
+                    slab->UsedCount = 0;
+                    slab->LiveCount = 0;
+                }
+                Link(slab);
+            }
+
+            // Reuse freed block or carve the next one from the slab
+            PoolBlockHeader* block;
+            if (slab->FreeList)
+            {
+                block = (PoolBlockHeader*)slab->FreeList;
+                slab->FreeList = slab->FreeList->Next;
+            }
+            else
+            {
+                block = (PoolBlockHeader*)((byte*)(slab + 1) + slab->UsedCount * BlockSize);
+                slab->UsedCount++;
+            }
+            slab->LiveCount++;
+            if (IsFull(slab))
+                Unlink(slab);
+            block->Slab = slab;
+            return block;
+        }
+
+        void Free(PoolSlab* slab, PoolBlockHeader* block)
+        {
+            const bool wasFull = IsFull(slab);
+            PoolFreeBlock* freeBlock = (PoolFreeBlock*)block;
+            freeBlock->Next = slab->FreeList;
+            slab->FreeList = freeBlock;
+            slab->LiveCount--;
+            if (wasFull)
+                Link(slab);
+            if (slab->LiveCount == 0)
+            {
+                // Keep a single empty slab cached and release the others
+                Unlink(slab);
+                if (Empty)
+                {
+                    Allocator::Free(slab);
+                }
+                else
+                {
+                    slab->FreeList = nullptr;
+                    slab->UsedCount = 0;
+                    Empty = slab;
+                }
+            }
+        }
+    };
+
+    PoolSizeClass SizeClasses[POOL_SIZE_CLASSES];
+
+    void SetUsePool(const ScriptingTypeHandle& typeHandle, bool value)
+    {
+        if (!typeHandle)
+            return;
+        ScriptingType& type = (ScriptingType&)typeHandle.GetType();
+        if (type.Type != ScriptingTypes::Script)
+        {
+            LOG(Warning, "Cannot use objects pool for type '{0}'.", type.ToString());
+            return;
+        }
+        type.Script.UsePool = value;
+    }
+}
+
+void ScriptingObjectsPool::Register(const MClass* type)
+{
+    CHECK(type);
+    Register(Scripting::FindScriptingType(type->GetFullName()));
+}
+
+void ScriptingObjectsPool::Unregister(const MClass* type)
+{
+    CHECK(type);
+    Unregister(Scripting::FindScriptingType(type->GetFullName()));
+}
+
+void ScriptingObjectsPool::ReleaseUnused()
+{
+    for (PoolSizeClass& sizeClass : SizeClasses)
+    {
+        ScopeLock lock(sizeClass.Locker);
+        if (sizeClass.Empty)
+        {
+            Allocator::Free(sizeClass.Empty);
+            sizeClass.Empty = nullptr;
+        }
+    }
+}
+
+void ScriptingObjectsPool::Register(const ScriptingTypeHandle& type)
+{
+    SetUsePool(type, true);
+}
+
+void ScriptingObjectsPool::Unregister(const ScriptingTypeHandle& type)
+{
+    SetUsePool(type, false);
+}
+
+void* ScriptingObjectsPool::TryAllocate(const ScriptingObjectSpawnParams& params, uint64 size)
+{
+    if (!params.Type || !params.Type.GetType().Script.UsePool)
+        return nullptr;
+    PoolBlockHeader* block;
+    const uint64 sizeClassIndex = (size + POOL_SIZE_CLASS_GRANULARITY - 1) / POOL_SIZE_CLASS_GRANULARITY - 1;
+    if (sizeClassIndex < POOL_SIZE_CLASSES)
+    {
+        PoolSizeClass& sizeClass = SizeClasses[sizeClassIndex];
+        ScopeLock lock(sizeClass.Locker);
+        if (sizeClass.BlockSize == 0)
+        {
+            sizeClass.BlockSize = (int32)((sizeClassIndex + 1) * POOL_SIZE_CLASS_GRANULARITY + sizeof(PoolBlockHeader));
+            sizeClass.BlocksPerSlab = (int32)((POOL_SLAB_SIZE - sizeof(PoolSlab)) / sizeClass.BlockSize);
+        }
+        block = sizeClass.Allocate();
+    }
+    else
+    {
+        block = (PoolBlockHeader*)Allocator::Allocate(size + sizeof(PoolBlockHeader), POOL_ALIGNMENT);
+        if (!block)
+            OUT_OF_MEMORY;
+        block->Slab = nullptr;
+    }
+    return block + 1;
+}
+
+void ScriptingObjectsPool::Free(void* ptr)
+{
+    if (!ptr)
+        return;
+    PoolBlockHeader* block = (PoolBlockHeader*)ptr - 1;
+    PoolSlab* slab = block->Slab;
+    if (!slab)
+    {
+        Allocator::Free(block);
+        return;
+    }
+    PoolSizeClass& sizeClass = *slab->Owner;
+    ScopeLock lock(sizeClass.Locker);
+    sizeClass.Free(slab, block);
+}
+
+void ScriptingObjectsPool::Delete(ScriptingObject* obj)
+{
+    if (!obj)
+        return;
+    if (EnumHasAnyFlags(obj->Flags, ObjectFlags::IsPooled))
+    {
+        Memory::DestructItem(obj);
+        Free(obj);
+    }
+    else
+    {
+        ::Delete(obj);
+    }
+}
@@ -0,0 +1,84 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Types.h"
+#include "Engine/Core/Object.h"
+
+struct ScriptingTypeHandle;
+struct ScriptingObjectSpawnParams;
+
+/// <summary>
+/// The memory pool for scripting objects. Objects of the registered types are allocated from size-class slabs (instead of the general heap) which reduces the spawn/despawn cost and memory fragmentation when many short-lived objects are created (eg. bullets, pickups or effects). Memory of the deleted objects returns to the pool.
+/// </summary>
+/// <remarks>Pooled objects have to be deleted via DeleteObject/DeleteObjectNow (or ScriptingObjectsPool::Delete), not with raw Delete.</remarks>
+API_CLASS(Static) class FLAXENGINE_API ScriptingObjectsPool
+{
+    DECLARE_SCRIPTING_TYPE_MINIMAL(ScriptingObjectsPool);
+
+    /// <summary>
+    /// Enables pooling for the objects of the given type. Applies only to the objects of that exact type (not to the derived types).
+    /// </summary>
+    /// <param name="type">The object type.</param>
+    API_FUNCTION() static void Register(API_PARAM(Attributes="TypeReference(typeof(FlaxEngine.Object))") const MClass* type);
+
+    /// <summary>
+    /// Disables pooling for the objects of the given type. Objects allocated from the pool before will still return their memory to the pool.
+    /// </summary>
+    /// <param name="type">The object type.</param>
+    API_FUNCTION() static void Unregister(API_PARAM(Attributes="TypeReference(typeof(FlaxEngine.Object))") const MClass* type);
+
+    /// <summary>
+    /// Releases the unused (empty) slabs memory back to the system.
+    /// </summary>
+    API_FUNCTION() static void ReleaseUnused();
+
+public:
+    /// <summary>
+    /// Enables pooling for the objects of the given type.
+    /// </summary>
+    /// <param name="type">The object type.</param>
+    static void Register(const ScriptingTypeHandle& type);
+
+    /// <summary>
+    /// Disables pooling for the objects of the given type.
+    /// </summary>
+    /// <param name="type">The object type.</param>
+    static void Unregister(const ScriptingTypeHandle& type);
+
+    /// <summary>
+    /// Allocates the memory for the object from the pool if its type is registered for pooling.
+    /// </summary>
+    /// <param name="params">The object spawn parameters.</param>
+    /// <param name="size">The object size (in bytes).</param>
+    /// <returns>The allocated memory (aligned to 16 bytes) or null if type is not pooled.</returns>
+    static void* TryAllocate(const ScriptingObjectSpawnParams& params, uint64 size);
+
+    /// <summary>
+    /// Frees the object memory allocated from the pool.
+    /// </summary>
+    /// <param name="ptr">The memory pointer.</param>
+    static void Free(void* ptr);
+
+    /// <summary>
+    /// Creates a new object of the given type (from the pool if that type is registered, otherwise from the heap). Used by the scripting types spawn handlers.
+    /// </summary>
+    /// <param name="params">The object spawn parameters.</param>
+    /// <returns>The new object instance.</returns>
+    template<typename T>
+    static T* New(const ScriptingObjectSpawnParams& params)
+    {
+        void* ptr = TryAllocate(params, sizeof(T));
+        if (!ptr)
+            return ::New<T>(params);
+        T* obj = new(ptr) T(params);
+        obj->Flags |= ObjectFlags::IsPooled;
+        return obj;
+    }
+
+    /// <summary>
+    /// Destructs and frees the object (returns memory to the pool if it was allocated from it).
+    /// </summary>
+    /// <param name="obj">The object.</param>
+    static void Delete(ScriptingObject* obj);
+};
@@ -5,6 +5,7 @@
 #include "Types.h"
 #include "Engine/Core/Types/StringView.h"
 #include "Engine/Core/Types/Guid.h"
+#include "ScriptingObjectsPool.h"
 
 class MMethod;
 class BinaryModule;
@@ -227,6 +228,11 @@ struct FLAXENGINE_API ScriptingType
             /// The default instance of the scripting type. Used by serialization system for comparison to save only modified properties of the object.
             /// </summary>
             mutable ScriptingObject* DefaultInstance;
+
+            /// <summary>
+            /// True if objects of this type are allocated from ScriptingObjectsPool.
+            /// </summary>
+            bool UsePool;
         } Script;
 
         struct
@@ -381,7 +387,7 @@ struct ScriptingObjectSpawnParams
 /// </summary>
 #define DECLARE_SCRIPTING_TYPE(type) \
     DECLARE_SCRIPTING_TYPE_NO_SPAWN(type); \
-    static type* Spawn(const SpawnParams& params) { return ::New<type>(params); } \
+    static type* Spawn(const SpawnParams& params) { return ScriptingObjectsPool::New<type>(params); } \
     explicit type() : type(SpawnParams(Guid::New(), type::TypeInitializer)) { } \
     explicit type(const SpawnParams& params)
 
@@ -390,7 +396,7 @@ struct ScriptingObjectSpawnParams
 /// </summary>
 #define DECLARE_SCRIPTING_TYPE_WITH_CONSTRUCTOR_IMPL(type, baseType) \
     DECLARE_SCRIPTING_TYPE_NO_SPAWN(type); \
-    static type* Spawn(const SpawnParams& params) { return ::New<type>(params); } \
+    static type* Spawn(const SpawnParams& params) { return ScriptingObjectsPool::New<type>(params); } \
     explicit type(const SpawnParams& params) : baseType(params) { } \
     explicit type() : baseType(SpawnParams(Guid::New(), type::TypeInitializer)) { }
 
@@ -0,0 +1,313 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "JsonBinary.h"
+#include "Json.h"
+#include "WriteStream.h"
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Core/Types/StringView.h"
+
+// 'FJSB' - Flax Json Binary
+#define JSON_BINARY_MAGIC 0x42534A46
+#define JSON_BINARY_VERSION 2
+#define JSON_BINARY_MAX_DEPTH 512
+
+namespace
+{
+    // Layout: magic, version, keys count, keys (length + chars + null terminator), root value (tag + payload)
+    enum class JsonBinaryTag : byte
+    {
+        Null = 0,
+        False,
+        True,
+        Int,
+        Uint,
+        Int64,
+        Uint64,
+        Double,
+        String,
+        Array,
+        Object,
+    };
+
+    struct JsonBinaryWriter
+    {
+        WriteStream& Stream;
+        Dictionary<StringAnsiView, int32> Keys;
+        Array<StringAnsiView> KeysList;
+
+        JsonBinaryWriter(WriteStream& stream)
+            : Stream(stream)
+        {
+        }
+
+        void CollectKeys(const rapidjson_flax::Value& value)
+        {
+            if (value.IsObject())
+            {
+                for (auto i = value.MemberBegin(); i != value.MemberEnd(); ++i)
+                {
+                    const StringAnsiView key(i->name.GetString(), (int32)i->name.GetStringLength());
+                    if (!Keys.ContainsKey(key))
+                    {
+                        Keys.Add(key, KeysList.Count());
+                        KeysList.Add(key);
+                    }
+                    CollectKeys(i->value);
+                }
+            }
+            else if (value.IsArray())
+            {
+                for (auto i = value.Begin(); i != value.End(); ++i)
+                    CollectKeys(*i);
+            }
+        }
+
+        void WriteString(const char* str, uint32 length)
+        {
+            Stream.WriteUint32(length);
+            Stream.WriteBytes(str, length);
+            Stream.WriteByte(0);
+        }
+
+        void WriteValue(const rapidjson_flax::Value& value)
+        {
+            switch (value.GetType())
+            {
+            case rapidjson::kNullType:
+                Stream.WriteByte((byte)JsonBinaryTag::Null);
+                break;
+            case rapidjson::kFalseType:
+                Stream.WriteByte((byte)JsonBinaryTag::False);
+                break;
+            case rapidjson::kTrueType:
+                Stream.WriteByte((byte)JsonBinaryTag::True);
+                break;
+            case rapidjson::kNumberType:
+                // Use the same number representation as the text parser would produce
+                if (value.IsInt())
+                {
+                    Stream.WriteByte((byte)JsonBinaryTag::Int);
+                    Stream.WriteInt32(value.GetInt());
+                }
+                else if (value.IsUint())
+                {
+                    Stream.WriteByte((byte)JsonBinaryTag::Uint);
+                    Stream.WriteUint32(value.GetUint());
+                }
+                else if (value.IsInt64())
+                {
+                    Stream.WriteByte((byte)JsonBinaryTag::Int64);
+                    Stream.WriteInt64(value.GetInt64());
+                }
+                else if (value.IsUint64())
+                {
+                    Stream.WriteByte((byte)JsonBinaryTag::Uint64);
+                    Stream.WriteUint64(value.GetUint64());
+                }
+                else
+                {
+                    Stream.WriteByte((byte)JsonBinaryTag::Double);
+                    Stream.WriteDouble(value.GetDouble());
+                }
+                break;
+            case rapidjson::kStringType:
+                Stream.WriteByte((byte)JsonBinaryTag::String);
+                WriteString(value.GetString(), value.GetStringLength());
+                break;
+            case rapidjson::kArrayType:
+                Stream.WriteByte((byte)JsonBinaryTag::Array);
+                Stream.WriteUint32(value.Size());
+                for (auto i = value.Begin(); i != value.End(); ++i)
+                    WriteValue(*i);
+                break;
+            case rapidjson::kObjectType:
+                Stream.WriteByte((byte)JsonBinaryTag::Object);
+                Stream.WriteUint32(value.MemberCount());
+                for (auto i = value.MemberBegin(); i != value.MemberEnd(); ++i)
+                {
+                    Stream.WriteUint32(Keys[StringAnsiView(i->name.GetString(), (int32)i->name.GetStringLength())]);
+                    WriteValue(i->value);
+                }
+                break;
+            }
+        }
+    };
+
+    // Generates the SAX events for the document builder
+    struct JsonBinaryReader
+    {
+        const byte* Ptr;
+        const byte* End;
+        Array<StringAnsiView> Keys;
+        uint32 Version;
+        bool CopyStrings;
+
+        template<typename T>
+        bool Read(T& result)
+        {
+            if (End - Ptr < (int64)sizeof(T))
+                return true;
+            Platform::MemoryCopy(&result, Ptr, sizeof(T));
+            Ptr += sizeof(T);
+            return false;
+        }
+
+        bool ReadString(const char*& str, uint32& length)
+        {
+            if (Read(length) || (uint64)(End - Ptr) < length)
+                return true;
+            str = (const char*)Ptr;
+            Ptr += length;
+
+            // Version 1 strings are not null-terminated
+            if (Version >= 2 && (Ptr == End || *Ptr++ != 0))
+                return true;
+            return false;
+        }
+
+        bool ReadKeys()
+        {
+            uint32 magic, count;
+            if (Read(magic) || Read(Version) || Read(count) || magic != JSON_BINARY_MAGIC || Version < 1 || Version > JSON_BINARY_VERSION || count > (uint32)(End - Ptr) / sizeof(uint32))
+                return true;
+            if (Version < 2)
+                CopyStrings = true;
+            Keys.Resize(count);
+            for (uint32 i = 0; i < count; i++)
+            {
+                const char* str;
+                uint32 length;
+                if (ReadString(str, length))
+                    return true;
+                Keys[i] = StringAnsiView(str, (int32)length);
+            }
+            return false;
+        }
+
+        template<typename Handler>
+        bool ReadValue(Handler& handler, int32 depth)
+        {
+            byte tag;
+            if (depth > JSON_BINARY_MAX_DEPTH || Read(tag))
+                return false;
+            switch ((JsonBinaryTag)tag)
+            {
+            case JsonBinaryTag::Null:
+                return handler.Null();
+            case JsonBinaryTag::False:
+                return handler.Bool(false);
+            case JsonBinaryTag::True:
+                return handler.Bool(true);
+            case JsonBinaryTag::Int:
+            {
+                int32 v;
+                return !Read(v) && handler.Int(v);
+            }
+            case JsonBinaryTag::Uint:
+            {
+                uint32 v;
+                return !Read(v) && handler.Uint(v);
+            }
+            case JsonBinaryTag::Int64:
+            {
+                int64 v;
+                return !Read(v) && handler.Int64(v);
+            }
+            case JsonBinaryTag::Uint64:
+            {
+                uint64 v;
+                return !Read(v) && handler.Uint64(v);
+            }
+            case JsonBinaryTag::Double:
+            {
+                double v;
+                return !Read(v) && handler.Double(v);
+            }
+            case JsonBinaryTag::String:
+            {
+                const char* str;
+                uint32 length;
+                return !ReadString(str, length) && handler.String(str, length, CopyStrings);
+            }
+            case JsonBinaryTag::Array:
+            {
+                uint32 count;
+                if (Read(count) || count > (uint32)(End - Ptr) || !handler.StartArray())
+                    return false;
+                for (uint32 i = 0; i < count; i++)
+                {
+                    if (!ReadValue(handler, depth + 1))
+                        return false;
+                }
+                return handler.EndArray(count);
+            }
+            case JsonBinaryTag::Object:
+            {
+                uint32 count;
+                if (Read(count) || count > (uint32)(End - Ptr) / sizeof(uint32) || !handler.StartObject())
+                    return false;
+                for (uint32 i = 0; i < count; i++)
+                {
+                    uint32 keyIndex;
+                    if (Read(keyIndex) || keyIndex >= (uint32)Keys.Count())
+                        return false;
+                    const StringAnsiView& key = Keys[keyIndex];
+                    if (!handler.Key(key.Get(), key.Length(), CopyStrings) || !ReadValue(handler, depth + 1))
+                        return false;
+                }
+                return handler.EndObject(count);
+            }
+            default:
+                return false;
+            }
+        }
+
+        template<typename Handler>
+        bool operator()(Handler& handler)
+        {
+            return ReadValue(handler, 0) && Ptr == End;
+        }
+    };
+}
+
+bool JsonBinary::IsBinary(const byte* data, int32 length)
+{
+    uint32 magic;
+    if (data == nullptr || length < (int32)sizeof(magic))
+        return false;
+    Platform::MemoryCopy(&magic, data, sizeof(magic));
+    return magic == JSON_BINARY_MAGIC;
+}
+
+void JsonBinary::Write(const rapidjson_flax::Value& value, WriteStream& stream)
+{
+    JsonBinaryWriter writer(stream);
+    writer.CollectKeys(value);
+    stream.WriteUint32(JSON_BINARY_MAGIC);
+    stream.WriteUint32(JSON_BINARY_VERSION);
+    stream.WriteUint32(writer.KeysList.Count());
+    for (const StringAnsiView& key : writer.KeysList)
+        writer.WriteString(key.Get(), key.Length());
+    writer.WriteValue(value);
+}
+
+bool JsonBinary::Read(const byte* data, int32 length, rapidjson_flax::Document& document, bool copyStrings)
+{
+    JsonBinaryReader reader;
+    reader.Ptr = data;
+    reader.End = data + length;
+    reader.CopyStrings = copyStrings;
+    if (reader.ReadKeys())
+        return true;
+
+    // Build the document directly from the values (without the text parsing), document is left unchanged on failure
+    bool failed = true;
+    auto generator = [&reader, &failed](rapidjson_flax::Document& handler)
+    {
+        failed = !reader(handler);
+        return !failed;
+    };
+    document.Populate(generator);
+    return failed;
+}
@@ -0,0 +1,40 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "JsonFwd.h"
+#include "Engine/Core/Types/BaseTypes.h"
+
+class WriteStream;
+
+/// <summary>
+/// Compact binary encoding of the Json documents (type-tagged and length-prefixed values with the object keys stored once). Used by the cooked game content to load Json assets and scenes without parsing the text.
+/// </summary>
+class FLAXENGINE_API JsonBinary
+{
+public:
+    /// <summary>
+    /// Checks if the data is a binary-encoded Json document (otherwise it's a Json text).
+    /// </summary>
+    /// <param name="data">The data.</param>
+    /// <param name="length">The data length (in bytes).</param>
+    /// <returns>True if data is in binary format, otherwise false.</returns>
+    static bool IsBinary(const byte* data, int32 length);
+
+    /// <summary>
+    /// Writes the Json value in binary format.
+    /// </summary>
+    /// <param name="value">The Json value (root).</param>
+    /// <param name="stream">The output stream.</param>
+    static void Write(const rapidjson_flax::Value& value, WriteStream& stream);
+
+    /// <summary>
+    /// Reads the binary-encoded Json into the document.
+    /// </summary>
+    /// <param name="data">The data.</param>
+    /// <param name="length">The data length (in bytes).</param>
+    /// <param name="document">The output document.</param>
+    /// <param name="copyStrings">True if copy the strings into the document, otherwise the document string values reference the source data (it has to stay valid and unchanged for the document lifetime, eg. the memory-mapped content). Ignored for the old data version that doesn't store the strings null-terminated.</param>
+    /// <returns>True if failed to read data (invalid or corrupted), otherwise false.</returns>
+    static bool Read(const byte* data, int32 length, rapidjson_flax::Document& document, bool copyStrings = true);
+};
@@ -63,6 +63,11 @@ struct FLAXENGINE_API ShaderCompilationOptions
     /// </summary>
     Array<ShaderMacro> Macros;
 
+    /// <summary>
+    /// The shader permutations to strip from the compilation (eg. quality levels never used by the cooked game). Permutation that defines any of the listed macros with the same value is not compiled and gets written as an empty entry.
+    /// </summary>
+    Array<ShaderMacro> StrippedPermutations;
+
 public:
 
     /// <summary>
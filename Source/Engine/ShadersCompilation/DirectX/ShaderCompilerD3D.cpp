@@ -223,6 +223,14 @@ bool ShaderCompilerD3D::CompileShader(ShaderFunctionMeta& meta, WritePermutation
     // Compile all shader function permutations
     for (int32 permutationIndex = 0; permutationIndex < meta.Permutations.Count(); permutationIndex++)
     {
+        // Skip permutations stripped from the build
+        if (IsPermutationStripped(_context, meta, permutationIndex))
+        {
+            if (WriteShaderFunctionPermutationStripped(_context, meta, permutationIndex))
+                return true;
+            continue;
+        }
+
         _macros.Clear();
 
         // Get function permutation macros
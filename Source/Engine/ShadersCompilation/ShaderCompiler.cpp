@@ -12,10 +12,20 @@
 #include "Engine/Graphics/RenderTools.h"
 #include "Engine/Graphics/Shaders/GPUShader.h"
 #include "Engine/Threading/Threading.h"
+#include "Engine/Threading/JobSystem.h"
 #include "Engine/Profiler/ProfilerCPU.h"
 #include "Engine/Serialization/MemoryWriteStream.h"
 #include "Engine/Utilities/StringConverter.h"
 
+// The minimum amount of shader functions to compile them in async via Job System
+#define SHADER_COMPILER_PARALLEL_MIN_FUNCTIONS 4
+
+#if BUILD_DEBUG
+#define PROFILE_COMPILE_SHADER(s) ZoneTransientN(___tracy_scoped_zone, s.Name.Get(), true);
+#else
+#define PROFILE_COMPILE_SHADER(s)
+#endif
+
 namespace IncludedFiles
 {
     struct File
@@ -31,26 +41,12 @@ namespace IncludedFiles
 
 bool ShaderCompiler::Compile(ShaderCompilationContext* context)
 {
-    // Clear cache
-    _globalMacros.Clear();
-    _macros.Clear();
-    _constantBuffers.Clear();
-    _globalMacros.EnsureCapacity(32);
-    _macros.EnsureCapacity(32);
-    _context = context;
-
     // Prepare
+    if (Setup(context))
+        return true;
     auto output = context->Output;
     auto meta = context->Meta;
     const int32 shadersCount = meta->GetShadersCount();
-    if (OnCompileBegin())
-        return true;
-    _globalMacros.Add({ nullptr, nullptr });
-
-    // Setup constant buffers cache
-    _constantBuffers.EnsureCapacity(meta->CB.Count(), false);
-    for (int32 i = 0; i < meta->CB.Count(); i++)
-        _constantBuffers.Add({ meta->CB[i].Slot, false, 0 });
 
     // [Output] Version number
     output->WriteInt32(GPU_SHADER_CACHE_VERSION);
@@ -93,14 +89,31 @@ bool ShaderCompiler::Compile(ShaderCompilationContext* context)
     *(int32*)(output->GetHandle() + additionalDataStartPos) = output->GetPosition();
 
     // [Output] Includes
-    output->WriteInt32(context->Includes.Count());
-    for (auto& include : context->Includes)
-    {
-        String compactPath = ShadersCompilation::CompactShaderPath(include.Item);
-        output->WriteString(compactPath, 11);
-        const auto date = FileSystem::GetFileLastEditTime(include.Item);
-        output->Write(date);
-    }
+    WriteIncludes(context);
+
+    return false;
+}
+
+bool ShaderCompiler::Setup(ShaderCompilationContext* context)
+{
+    // Clear cache
+    _globalMacros.Clear();
+    _macros.Clear();
+    _constantBuffers.Clear();
+    _globalMacros.EnsureCapacity(32);
+    _macros.EnsureCapacity(32);
+    _context = context;
+
+    // Prepare
+    auto meta = context->Meta;
+    if (OnCompileBegin())
+        return true;
+    _globalMacros.Add({ nullptr, nullptr });
+
+    // Setup constant buffers cache
+    _constantBuffers.EnsureCapacity(meta->CB.Count(), false);
+    for (int32 i = 0; i < meta->CB.Count(); i++)
+        _constantBuffers.Add({ meta->CB[i].Slot, false, 0 });
 
     return false;
 }
@@ -161,97 +174,146 @@ void ShaderCompiler::DisposeIncludedFilesCache()
     IncludedFiles::Files.ClearDelete();
 }
 
+void ShaderCompiler::WriteIncludes(ShaderCompilationContext* context)
+{
+    auto output = context->Output;
+    output->WriteInt32(context->Includes.Count());
+    for (auto& include : context->Includes)
+    {
+        String compactPath = ShadersCompilation::CompactShaderPath(include.Item);
+        output->WriteString(compactPath, 11);
+        const auto date = FileSystem::GetFileLastEditTime(include.Item);
+        output->Write(date);
+    }
+}
+
 bool ShaderCompiler::CompileShaders()
 {
     auto meta = _context->Meta;
-#if BUILD_DEBUG
-#define PROFILE_COMPILE_SHADER(s) ZoneTransientN(___tracy_scoped_zone, s.Name.Get(), true);
-#else
-#define PROFILE_COMPILE_SHADER(s)
-#endif
 
-    // Generate vertex shaders cache
+    // Gather all shader functions (in the order of the output)
+    Array<FunctionToCompile> functions;
+    functions.EnsureCapacity(meta->GetShadersCount());
     for (int32 i = 0; i < meta->VS.Count(); i++)
     {
         auto& shader = meta->VS[i];
         ASSERT(shader.GetStage() == ShaderStage::Vertex && (shader.Flags & ShaderFlags::Hidden) == (ShaderFlags)0);
-        PROFILE_COMPILE_SHADER(shader);
-        if (CompileShader(shader, &WriteCustomDataVS))
-        {
-            LOG(Error, "Failed to compile \'{0}\'", String(shader.Name));
-            return true;
-        }
+        functions.Add({ &shader, &WriteCustomDataVS });
     }
-
-    // Generate hull shaders cache
     for (int32 i = 0; i < meta->HS.Count(); i++)
     {
         auto& shader = meta->HS[i];
         ASSERT(shader.GetStage() == ShaderStage::Hull && (shader.Flags & ShaderFlags::Hidden) == (ShaderFlags)0);
-        PROFILE_COMPILE_SHADER(shader);
-        if (CompileShader(shader, &WriteCustomDataHS))
-        {
-            LOG(Error, "Failed to compile \'{0}\'", String(shader.Name));
-            return true;
-        }
+        functions.Add({ &shader, &WriteCustomDataHS });
     }
-
-    // Generate domain shaders cache
     for (int32 i = 0; i < meta->DS.Count(); i++)
     {
         auto& shader = meta->DS[i];
         ASSERT(shader.GetStage() == ShaderStage::Domain && (shader.Flags & ShaderFlags::Hidden) == (ShaderFlags)0);
-        PROFILE_COMPILE_SHADER(shader);
-        if (CompileShader(shader))
-        {
-            LOG(Error, "Failed to compile \'{0}\'", String(shader.Name));
-            return true;
-        }
+        functions.Add({ &shader, nullptr });
     }
-
-    // Generate geometry shaders cache
     for (int32 i = 0; i < meta->GS.Count(); i++)
     {
         auto& shader = meta->GS[i];
         ASSERT(shader.GetStage() == ShaderStage::Geometry && (shader.Flags & ShaderFlags::Hidden) == (ShaderFlags)0);
-        PROFILE_COMPILE_SHADER(shader);
-        if (CompileShader(shader))
-        {
-            LOG(Error, "Failed to compile \'{0}\'", String(shader.Name));
-            return true;
-        }
+        functions.Add({ &shader, nullptr });
     }
-
-    // Generate pixel shaders cache
     for (int32 i = 0; i < meta->PS.Count(); i++)
     {
         auto& shader = meta->PS[i];
         ASSERT(shader.GetStage() == ShaderStage::Pixel && (shader.Flags & ShaderFlags::Hidden) == (ShaderFlags)0);
-        PROFILE_COMPILE_SHADER(shader);
-        if (CompileShader(shader))
+        functions.Add({ &shader, nullptr });
+    }
+    for (int32 i = 0; i < meta->CS.Count(); i++)
+    {
+        auto& shader = meta->CS[i];
+        ASSERT(shader.GetStage() == ShaderStage::Compute && (shader.Flags & ShaderFlags::Hidden) == (ShaderFlags)0);
+        functions.Add({ &shader, nullptr });
+    }
+
+    // Compile functions in async if there is enough work to spread across the job system threads
+    if (functions.Count() >= SHADER_COMPILER_PARALLEL_MIN_FUNCTIONS && JobSystem::GetThreadsCount() > 1)
+        return CompileShadersParallel(functions);
+
+    // Generate shaders cache
+    for (const FunctionToCompile& function : functions)
+    {
+        PROFILE_COMPILE_SHADER((*function.Meta));
+        if (CompileShader(*function.Meta, function.CustomDataWrite))
         {
-            LOG(Error, "Failed to compile \'{0}\'", String(shader.Name));
+            LOG(Error, "Failed to compile \'{0}\'", String(function.Meta->Name));
             return true;
         }
     }
 
-    // Generate compute shaders cache
-    for (int32 i = 0; i < meta->CS.Count(); i++)
+    return false;
+}
+
+bool ShaderCompiler::CompileShadersParallel(const Array<FunctionToCompile>& functions)
+{
+    PROFILE_CPU();
+
+    // Compile each function with a separate compiler (from the compilers pool) into a separate output
+    struct Result
     {
-        auto& shader = meta->CS[i];
-        ASSERT(shader.GetStage() == ShaderStage::Compute && (shader.Flags & ShaderFlags::Hidden) == (ShaderFlags)0);
-        PROFILE_COMPILE_SHADER(shader);
-        if (CompileShader(shader))
+        bool Failed = true;
+        Array<byte> Output;
+        HashSet<String> Includes;
+        Array<ShaderResourceBuffer> ConstantBuffers;
+    };
+    Array<Result> results;
+    results.Resize(functions.Count());
+    Function<void(int32)> job = [this, &functions, &results](int32 index)
+    {
+        Result& result = results[index];
+        ShaderCompiler* compiler = ShadersCompilation::RequestCompiler(_profile);
+        if (!compiler)
+            return;
+        MemoryWriteStream output(16 * 1024);
+        ShaderCompilationContext context(_context->Options, _context->Meta);
+        context.Output = &output;
+        result.Failed = compiler->CompileFunction(&context, functions[index]);
+        result.Output.Set(output.GetHandle(), output.GetPosition());
+        result.Includes = MoveTemp(context.Includes);
+        result.ConstantBuffers = compiler->_constantBuffers;
+        ShadersCompilation::FreeCompiler(compiler);
+    };
+    JobSystem::Execute(job, functions.Count(), 1, JobPriority::Background);
+
+    // Merge results (in the original order of the functions)
+    auto output = _context->Output;
+    for (int32 i = 0; i < functions.Count(); i++)
+    {
+        const Result& result = results[i];
+        if (result.Failed)
         {
-            LOG(Error, "Failed to compile \'{0}\'", String(shader.Name));
+            LOG(Error, "Failed to compile \'{0}\'", String(functions[i].Meta->Name));
             return true;
         }
+        output->WriteBytes(result.Output.Get(), result.Output.Count());
+        for (const auto& include : result.Includes)
+            _context->Includes.Add(include.Item);
+        ASSERT(result.ConstantBuffers.Count() == _constantBuffers.Count());
+        for (int32 j = 0; j < _constantBuffers.Count(); j++)
+        {
+            const ShaderResourceBuffer& cb = result.ConstantBuffers[j];
+            if (cb.IsUsed)
+            {
+                _constantBuffers[j].IsUsed = true;
+                _constantBuffers[j].Size = cb.Size;
+            }
+        }
     }
 
-#undef PROFILE_COMPILE_SHADER
     return false;
 }
 
+bool ShaderCompiler::CompileFunction(ShaderCompilationContext* context, const FunctionToCompile& function)
+{
+    PROFILE_COMPILE_SHADER((*function.Meta));
+    return Setup(context) || CompileShader(*function.Meta, function.CustomDataWrite);
+}
+
 bool ShaderCompiler::OnCompileBegin()
 {
     // Setup global macros
@@ -321,6 +383,37 @@ bool ShaderCompiler::WriteShaderFunctionPermutation(ShaderCompilationContext* co
     return false;
 }
 
+bool ShaderCompiler::IsPermutationStripped(ShaderCompilationContext* context, ShaderFunctionMeta& meta, int32 permutationIndex)
+{
+    const auto& stripped = context->Options->StrippedPermutations;
+    if (stripped.IsEmpty())
+        return false;
+    for (const ShaderPermutationEntry& e : meta.Permutations[permutationIndex].Entries)
+    {
+        for (const ShaderMacro& macro : stripped)
+        {
+            if (e.Name == macro.Name && e.Value == macro.Definition)
+                return true;
+        }
+    }
+    return false;
+}
+
+bool ShaderCompiler::WriteShaderFunctionPermutationStripped(ShaderCompilationContext* context, ShaderFunctionMeta& meta, int32 permutationIndex)
+{
+    auto output = context->Output;
+
+    // [Output] Write empty shader cache (runtime skips the permutation, no custom data follows)
+    output->WriteUint32(0);
+
+    // [Output] Shader bindings meta
+    ShaderBindings bindings;
+    Platform::MemoryClear(&bindings, sizeof(bindings));
+    output->Write(bindings);
+
+    return false;
+}
+
 bool ShaderCompiler::WriteShaderFunctionEnd(ShaderCompilationContext* context, ShaderFunctionMeta& meta)
 {
     return false;
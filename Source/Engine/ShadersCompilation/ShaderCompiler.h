@@ -84,13 +84,28 @@ class ShaderCompiler
     /// </summary>
     static void DisposeIncludedFilesCache();
 
+    /// <summary>
+    /// Writes the list of the included source files (used by the compilation) to the output shader cache (as additional data at the end of the cache).
+    /// </summary>
+    /// <param name="context">The compilation context.</param>
+    static void WriteIncludes(ShaderCompilationContext* context);
+
 protected:
 
     typedef bool (*WritePermutationData)(ShaderCompilationContext*, ShaderFunctionMeta&, int32, const Array<ShaderMacro>&);
 
     virtual bool CompileShader(ShaderFunctionMeta& meta, WritePermutationData customDataWrite = nullptr) = 0;
 
+    struct FunctionToCompile
+    {
+        ShaderFunctionMeta* Meta;
+        WritePermutationData CustomDataWrite;
+    };
+
     bool CompileShaders();
+    bool CompileShadersParallel(const Array<FunctionToCompile>& functions);
+    bool CompileFunction(ShaderCompilationContext* context, const FunctionToCompile& function);
+    bool Setup(ShaderCompilationContext* context);
 
     virtual bool OnCompileBegin();
     virtual bool OnCompileEnd();
@@ -98,6 +113,8 @@ class ShaderCompiler
     static bool WriteShaderFunctionBegin(ShaderCompilationContext* context, ShaderFunctionMeta& meta);
     static bool WriteShaderFunctionPermutation(ShaderCompilationContext* context, ShaderFunctionMeta& meta, int32 permutationIndex, const ShaderBindings& bindings, const void* header, int32 headerSize, const void* cache, int32 cacheSize);
     static bool WriteShaderFunctionPermutation(ShaderCompilationContext* context, ShaderFunctionMeta& meta, int32 permutationIndex, const ShaderBindings& bindings, const void* cache, int32 cacheSize);
+    static bool IsPermutationStripped(ShaderCompilationContext* context, ShaderFunctionMeta& meta, int32 permutationIndex);
+    static bool WriteShaderFunctionPermutationStripped(ShaderCompilationContext* context, ShaderFunctionMeta& meta, int32 permutationIndex);
     static bool WriteShaderFunctionEnd(ShaderCompilationContext* context, ShaderFunctionMeta& meta);
     static bool WriteCustomDataVS(ShaderCompilationContext* context, ShaderFunctionMeta& meta, int32 permutationIndex, const Array<ShaderMacro>& macros);
     static bool WriteCustomDataHS(ShaderCompilationContext* context, ShaderFunctionMeta& meta, int32 permutationIndex, const Array<ShaderMacro>& macros);
@@ -29,7 +29,12 @@
 #include "Engine/Platform/FileSystemWatcher.h"
 #include "Engine/Platform/FileSystem.h"
 #include "Engine/Platform/File.h"
+#include "Engine/Engine/CommandLine.h"
 #include "Engine/Engine/Globals.h"
+#include "Engine/Serialization/MemoryWriteStream.h"
+#include "Engine/Utilities/Crc.h"
+#include "Engine/Utilities/StringConverter.h"
+#include "FlaxEngine.Gen.h"
 #include "Editor/Editor.h"
 #include "Editor/ProjectInfo.h"
 #endif
@@ -96,11 +101,149 @@ namespace ShadersCompilationImpl
 
         return nullptr;
     }
+
+    // Version of the compiled shaders cache entry format
+    constexpr int32 CacheVersion = 1;
+
+    void HashBytes(uint64& hash, const void* data, int32 length)
+    {
+        // FNV-1a
+        const byte* bytes = (const byte*)data;
+        for (int32 i = 0; i < length; i++)
+        {
+            hash ^= bytes[i];
+            hash *= 1099511628211ull;
+        }
+    }
+
+    String GetCacheEntryPath(const ShaderCompilationOptions& options)
+    {
+        // Address the entry by the shader source and all options that affect the compiled code (included files are validated by the entry itself)
+        uint64 hash = 14695981039346656037ull;
+        const int32 header[] = { CacheVersion, GPU_SHADER_CACHE_VERSION, FLAXENGINE_VERSION_BUILD, (int32)options.Profile, options.NoOptimize ? 1 : 0, options.TreatWarningsAsErrors ? 1 : 0 };
+        HashBytes(hash, header, sizeof(header));
+        for (const ShaderMacro& macro : options.Macros)
+        {
+            if (macro.Name)
+                HashBytes(hash, macro.Name, StringUtils::Length(macro.Name) + 1);
+            if (macro.Definition)
+                HashBytes(hash, macro.Definition, StringUtils::Length(macro.Definition) + 1);
+        }
+        HashBytes(hash, "|", 1);
+        for (const ShaderMacro& macro : options.StrippedPermutations)
+        {
+            if (macro.Name)
+                HashBytes(hash, macro.Name, StringUtils::Length(macro.Name) + 1);
+            if (macro.Definition)
+                HashBytes(hash, macro.Definition, StringUtils::Length(macro.Definition) + 1);
+        }
+        HashBytes(hash, options.Source, options.SourceLength);
+        const uint32 crc = Crc::MemCrc32(options.Source, options.SourceLength);
+        return ShadersCompilation::CachePath / String::Format(TEXT("{0:016x}{1:08x}.bin"), hash, crc);
+    }
+
+    bool GetIncludeHash(ShaderCompilationContext& context, const String& path, uint32& hash)
+    {
+        if (!FileSystem::FileExists(ShadersCompilation::ResolveShaderPath(path)))
+            return true;
+        const StringAsANSI<> pathAnsi(path.Get(), path.Length());
+        const char* source;
+        int32 sourceLength;
+        if (ShaderCompiler::GetIncludedFileSource(&context, "", pathAnsi.Get(), source, sourceLength))
+            return true;
+        hash = Crc::MemCrc32(source, sourceLength);
+        return false;
+    }
+
+    bool TryLoadCache(const String& path, ShaderCompilationContext& context)
+    {
+        PROFILE_CPU();
+        Array<byte> data;
+        if (!FileSystem::FileExists(path) || File::ReadAllBytes(path, data))
+            return false;
+        MemoryReadStream stream(data.Get(), data.Count());
+        int32 version;
+        stream.ReadInt32(&version);
+        if (version != CacheVersion)
+            return false;
+
+        // Validate included files (compare the contents to detect any modifications since the entry was created)
+        int32 includesCount;
+        stream.ReadInt32(&includesCount);
+        String include;
+        for (int32 i = 0; i < includesCount; i++)
+        {
+            uint32 includeHash, hash;
+            stream.ReadString(&include, 11);
+            stream.ReadUint32(&includeHash);
+            if (GetIncludeHash(context, include, hash) || hash != includeHash)
+            {
+                context.Includes.Clear();
+                return false;
+            }
+        }
+
+        // [Output] Compiled shader
+        int32 dataSize;
+        stream.ReadInt32(&dataSize);
+        if (dataSize <= (int32)sizeof(int32) * 2 || dataSize > (int32)(stream.GetLength() - stream.GetPosition()))
+        {
+            context.Includes.Clear();
+            return false;
+        }
+        auto output = context.Output;
+        const uint32 start = output->GetPosition();
+        output->WriteBytes(stream.GetPositionHandle(), dataSize);
+        *(int32*)(output->GetHandle() + start + sizeof(int32)) = output->GetPosition();
+
+        // [Output] Includes (with the current modification dates of the local files)
+        ShaderCompiler::WriteIncludes(&context);
+        return true;
+    }
+
+    void SaveCache(const String& path, ShaderCompilationContext& context, uint32 start)
+    {
+        PROFILE_CPU();
+        auto output = context.Output;
+        const int32 additionalDataStart = *(int32*)(output->GetHandle() + start + sizeof(int32));
+        const int32 dataSize = additionalDataStart - start;
+        MemoryWriteStream stream(dataSize + 1024);
+        stream.WriteInt32(CacheVersion);
+
+        // Included files with their contents hash
+        Array<String> includes;
+        for (const auto& include : context.Includes)
+            includes.Add(include.Item);
+        stream.WriteInt32(includes.Count());
+        for (const String& include : includes)
+        {
+            uint32 hash;
+            if (GetIncludeHash(context, include, hash))
+                return;
+            stream.WriteString(ShadersCompilation::CompactShaderPath(include), 11);
+            stream.WriteUint32(hash);
+        }
+
+        // Compiled shader (without includes)
+        stream.WriteInt32(dataSize);
+        stream.WriteBytes(output->GetHandle() + start, dataSize);
+
+        // Write to the temporary file and move it into the entry location (cache can be shared by multiple processes or machines)
+        const String tmpPath = path + TEXT(".") + Guid::New().ToString(Guid::FormatType::N) + TEXT(".tmp");
+        if (File::WriteAllBytes(tmpPath, stream.GetHandle(), stream.GetPosition()))
+            return;
+        if (FileSystem::MoveFile(path, tmpPath, true))
+            FileSystem::DeleteFile(tmpPath);
+    }
 #endif
 }
 
 using namespace ShadersCompilationImpl;
 
+#if USE_EDITOR
+String ShadersCompilation::CachePath;
+#endif
+
 class ShadersCompilationService : public EngineService
 {
 public:
@@ -148,6 +291,23 @@ bool ShadersCompilation::Compile(ShaderCompilationOptions& options)
     const DateTime startTime = DateTime::NowUTC();
     const FeatureLevel featureLevel = RenderTools::GetFeatureLevel(options.Profile);
 
+#if USE_EDITOR
+    // Try to reuse the compiled shader from cache (debug data is generated only by the actual compilation)
+    String cacheEntryPath;
+    if (CachePath.HasChars() && !options.GenerateDebugData)
+    {
+        cacheEntryPath = GetCacheEntryPath(options);
+        ShaderCompilationContext context(&options, nullptr);
+        if (TryLoadCache(cacheEntryPath, context))
+        {
+            const DateTime endTime = DateTime::NowUTC();
+            LOG(Info, "Shader compilation '{0}' loaded from cache in {1} ms (profile: {2})", options.TargetName, Math::CeilToInt(static_cast<float>((endTime - startTime).GetTotalMilliseconds())), ::ToString(options.Profile));
+            return false;
+        }
+    }
+    const uint32 outputStart = options.Output->GetPosition();
+#endif
+
     // Process shader source to collect metadata
     ShaderMeta meta;
     if (ShaderProcessing::Parser::Process(options.TargetName, options.Source, options.SourceLength, options.Macros, featureLevel, &meta))
@@ -181,6 +341,12 @@ bool ShadersCompilation::Compile(ShaderCompilationOptions& options)
         // Dismiss compiler
         FreeCompiler(compiler);
 
+#if USE_EDITOR
+        // Store the compiled shader in cache
+        if (!result && cacheEntryPath.HasChars())
+            SaveCache(cacheEntryPath, context, outputStart);
+#endif
+
 #if GPU_USE_SHADERS_DEBUG_LAYER
         // Export debug data
         ShaderDebugDataExporter::Export(&context);
@@ -576,6 +742,17 @@ bool ShadersCompilationService::Init()
     // Initialize automatic shaders importing and reloading for all loaded projects (game, engine, plugins)
     HashSet<const ProjectInfo*> projects;
     RegisterShaderWatchers(Editor::Project, projects);
+
+    // Setup compiled shaders cache location
+    if (CommandLine::Options.ShaderCache.HasValue())
+        ShadersCompilation::CachePath = CommandLine::Options.ShaderCache.GetValue();
+    else
+        ShadersCompilation::CachePath = Globals::ProjectCacheFolder / TEXT("Shaders/Compiled");
+    if (ShadersCompilation::CachePath.HasChars() && !FileSystem::DirectoryExists(ShadersCompilation::CachePath) && FileSystem::CreateDirectory(ShadersCompilation::CachePath))
+    {
+        LOG(Warning, "Failed to create compiled shaders cache folder '{0}'", ShadersCompilation::CachePath);
+        ShadersCompilation::CachePath.Clear();
+    }
 #endif
 
     return false;
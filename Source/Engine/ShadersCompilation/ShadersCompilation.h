@@ -13,6 +13,8 @@ class Asset;
 /// </summary>
 class FLAXENGINE_API ShadersCompilation
 {
+    friend ShaderCompiler;
+
 public:
     /// <summary>
     /// Compiles the shader.
@@ -47,6 +49,13 @@ class FLAXENGINE_API ShadersCompilation
     // Compacts the full shader file path into portable format with project name prefix such as './<ProjectName>/ShaderFile.hlsl'.
     static String CompactShaderPath(StringView path);
 
+#if USE_EDITOR
+    /// <summary>
+    /// The path of the folder with the compiled shaders cache (content-addressed by the shader source, options and included files). Can point to a network location to share compiled shaders across the machines. Empty to disable cache. Overriden via '-shadercache !path!' command line argument.
+    /// </summary>
+    static String CachePath;
+#endif
+
 private:
 
     static ShaderCompiler* CreateCompiler(ShaderProfile profile);
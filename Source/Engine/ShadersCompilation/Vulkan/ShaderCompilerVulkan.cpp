@@ -505,6 +505,14 @@ bool ShaderCompilerVulkan::CompileShader(ShaderFunctionMeta& meta, WritePermutat
     // Compile all shader function permutations
     for (int32 permutationIndex = 0; permutationIndex < meta.Permutations.Count(); permutationIndex++)
     {
+        // Skip permutations stripped from the build
+        if (IsPermutationStripped(_context, meta, permutationIndex))
+        {
+            if (WriteShaderFunctionPermutationStripped(_context, meta, permutationIndex))
+                return true;
+            continue;
+        }
+
 #if PRINT_DESCRIPTORS
         LOG(Warning, "VULKAN SHADER {0}: {1}[{2}]", _context->Options->TargetName, String(meta.Name), permutationIndex);
 #endif
@@ -3,15 +3,165 @@
 #include "Builder.h"
 #include "Engine/Level/Scene/Lightmap.h"
 #include "Engine/Level/Scene/Scene.h"
+#include "Engine/Level/Actors/Light.h"
+#include "Engine/Level/Actors/PointLight.h"
+#include "Engine/Level/Actors/SpotLight.h"
+#include "Engine/Level/Actors/Sky.h"
+#include "Engine/Level/Actors/Skybox.h"
+#include "Engine/Terrain/Terrain.h"
+#include "Engine/Foliage/Foliage.h"
+#include "Engine/Serialization/JsonSerializer.h"
+#include "Engine/Utilities/Crc.h"
 #include "Engine/Content/Content.h"
 #include "Engine/ContentImporters/AssetsImportingManager.h"
 #include "Engine/ContentImporters/ImportTexture.h"
 #include "Engine/Core/Log.h"
+#include "Engine/Core/Math/Math.h"
 #include "Engine/Graphics/GPUBuffer.h"
 #include "Engine/Graphics/GPUBufferDescription.h"
 #include "Engine/Graphics/GPUDevice.h"
 #include "Engine/Graphics/PixelFormatExtensions.h"
 
+namespace
+{
+    uint32 GetSettingsHash(const LightmapSettings& settings)
+    {
+        uint32 hash = GetHash(settings.IndirectLightingIntensity);
+        CombineHash(hash, GetHash(settings.GlobalObjectsScale));
+        CombineHash(hash, (uint32)settings.ChartsPadding);
+        CombineHash(hash, (uint32)settings.AtlasSize);
+        CombineHash(hash, (uint32)settings.BounceCount);
+        CombineHash(hash, (uint32)settings.UseGeometryWithNoMaterials);
+        CombineHash(hash, (uint32)settings.Quality);
+        return hash;
+    }
+
+    bool CacheLightsTree(Actor* actor, Dictionary<Guid, ShadowsOfMordor::Builder::SceneBakeCache::Light>* lights)
+    {
+        if (!actor->GetIsActive())
+            return false;
+        if (dynamic_cast<Light*>(actor) || dynamic_cast<Sky*>(actor) || dynamic_cast<Skybox*>(actor))
+        {
+            // Hash all light properties (eg. color, brightness, transformation or linked sky textures)
+            auto& light = (*lights)[actor->GetID()];
+            const Array<byte> data = JsonSerializer::SaveToBytes(actor);
+            light.Hash = Crc::MemCrc32(data.Get(), data.Count());
+            light.Box = actor->GetBox();
+            light.IsGlobal = !dynamic_cast<PointLight*>(actor) && !dynamic_cast<SpotLight*>(actor);
+        }
+        return true;
+    }
+
+#if INCREMENTAL_BAKE
+    // Marks charts affected by the changes since the previous bake and restores the lighting of the unchanged charts. Returns true if the whole scene needs to be baked.
+    bool FindDirtyCharts(ShadowsOfMordor::Builder::SceneBuildCache* scene, const ShadowsOfMordor::Builder::SceneBakeCache* prev)
+    {
+        const auto& cache = scene->BakeCache;
+        if (!prev || !prev->IsLayoutMatching(cache) || prev->LightmapsData.Count() != scene->Lightmaps.Count())
+            return true;
+
+        // Check if lightmap textures were not modified since the last bake
+        Texture* textures[NUM_SH_TARGETS];
+        for (int32 lightmapIndex = 0; lightmapIndex < scene->Lightmaps.Count(); lightmapIndex++)
+        {
+            const auto lightmap = scene->Scene->LightmapsData.GetLightmap(lightmapIndex);
+            if (!lightmap || prev->LightmapsData[lightmapIndex].IsEmpty())
+                return true;
+            lightmap->GetTextures(textures);
+            for (int32 textureIndex = 0; textureIndex < NUM_SH_TARGETS; textureIndex++)
+            {
+                if (!textures[textureIndex] || textures[textureIndex]->GetID() != prev->Textures[lightmapIndex * NUM_SH_TARGETS + textureIndex])
+                    return true;
+            }
+        }
+
+        // Find the changed geometry and lights
+        Array<BoundingBox> changes;
+        for (int32 chartIndex = 0; chartIndex < cache.Charts.Count(); chartIndex++)
+        {
+            const auto& chart = cache.Charts[chartIndex];
+            const auto& prevChart = prev->Charts[chartIndex];
+            scene->Charts[chartIndex].Dirty = chart.Hash != prevChart.Hash;
+            if (scene->Charts[chartIndex].Dirty)
+            {
+                changes.Add(prevChart.Box);
+                changes.Add(chart.Box);
+            }
+        }
+        for (const auto& e : cache.Lights)
+        {
+            const auto prevLight = prev->Lights.TryGet(e.Key);
+            if (prevLight && prevLight->Hash == e.Value.Hash)
+                continue;
+            if (e.Value.IsGlobal || (prevLight && prevLight->IsGlobal))
+                return true;
+            changes.Add(e.Value.Box);
+            if (prevLight)
+                changes.Add(prevLight->Box);
+        }
+        for (const auto& e : prev->Lights)
+        {
+            if (cache.Lights.ContainsKey(e.Key))
+                continue;
+            if (e.Value.IsGlobal)
+                return true;
+            changes.Add(e.Value.Box);
+        }
+
+        // Mark charts nearby the changes (occlusion and indirect lighting)
+        const Vector3 influence(INCREMENTAL_BAKE_INFLUENCE_DISTANCE);
+        for (auto& box : changes)
+        {
+            box.Minimum -= influence;
+            box.Maximum += influence;
+        }
+        for (int32 chartIndex = 0; chartIndex < cache.Charts.Count(); chartIndex++)
+        {
+            auto& chart = scene->Charts[chartIndex];
+            for (int32 i = 0; i < changes.Count() && !chart.Dirty; i++)
+                chart.Dirty = changes[i].Intersects(cache.Charts[chartIndex].Box);
+        }
+
+        // Restore the previous lightmaps data with cleared dirty charts (including padding)
+        const int32 atlasSize = (int32)scene->GetSettings().AtlasSize;
+        const int32 padding = scene->GetSettings().ChartsPadding;
+        const int32 texelSize = PixelFormatExtensions::SizeInBytes(HemispheresFormatToPixelFormat[HEMISPHERES_IRRADIANCE_FORMAT]) * NUM_SH_TARGETS;
+        for (int32 lightmapIndex = 0; lightmapIndex < scene->Lightmaps.Count(); lightmapIndex++)
+            scene->Lightmaps[lightmapIndex].LightmapDataPrev = prev->LightmapsData[lightmapIndex];
+        for (const auto& chart : scene->Charts)
+        {
+            if (!chart.Dirty || chart.Result.TextureIndex == INVALID_INDEX)
+                continue;
+            auto& data = scene->Lightmaps[chart.Result.TextureIndex].LightmapDataPrev;
+            const int32 x = Math::RoundToInt(chart.Result.UVsArea.Location.X * atlasSize);
+            const int32 y = Math::RoundToInt(chart.Result.UVsArea.Location.Y * atlasSize);
+            const int32 minX = Math::Max(x - padding, 0);
+            const int32 maxX = Math::Min(x + chart.Width + padding, atlasSize);
+            const int32 minY = Math::Max(y - padding, 0);
+            const int32 maxY = Math::Min(y + chart.Height + padding, atlasSize);
+            for (int32 row = minY; row < maxY; row++)
+                Platform::MemoryClear(data.Get() + (row * atlasSize + minX) * texelSize, (maxX - minX) * texelSize);
+        }
+
+        return false;
+    }
+#endif
+}
+
+bool ShadowsOfMordor::Builder::SceneBakeCache::IsLayoutMatching(const SceneBakeCache& other) const
+{
+    if (SettingsHash != other.SettingsHash || Charts.Count() != other.Charts.Count())
+        return false;
+    for (int32 i = 0; i < Charts.Count(); i++)
+    {
+        const auto& a = Charts[i];
+        const auto& b = other.Charts[i];
+        if (a.ActorId != b.ActorId || a.SubIndex0 != b.SubIndex0 || a.SubIndex1 != b.SubIndex1 || a.Width != b.Width || a.Height != b.Height)
+            return false;
+    }
+    return true;
+}
+
 ShadowsOfMordor::Builder::LightmapBuildCache::~LightmapBuildCache()
 {
     SAFE_DELETE_GPU_RESOURCE(LightmapData);
@@ -31,6 +181,8 @@ bool ShadowsOfMordor::Builder::LightmapBuildCache::Init(const LightmapSettings*
 ShadowsOfMordor::Builder::SceneBuildCache::SceneBuildCache()
     : Scene(nullptr)
     , TempLightmapData(nullptr)
+    , Incremental(false)
+    , DirtyChartsCount(0)
     , LightmapsCount(0)
     , HemispheresCount(0)
     , MergedHemispheresCount(0)
@@ -96,6 +248,10 @@ void ShadowsOfMordor::Builder::SceneBuildCache::UpdateLightmaps()
     {
         // Cache data
         auto& lightmapEntry = Lightmaps[lightmapIndex];
+#if INCREMENTAL_BAKE
+        if (lightmapEntry.DirtyChartsCount == 0 && lightmapEntry.LightmapDataPrev.HasItems())
+            continue;
+#endif
         auto lightmap = Scene->LightmapsData.GetLightmap(lightmapIndex);
         ASSERT(lightmap);
         lightmap->GetTextures(lightmaps);
@@ -163,6 +319,12 @@ void ShadowsOfMordor::Builder::SceneBuildCache::UpdateLightmaps()
         }
 #endif
 
+#if INCREMENTAL_BAKE
+        // Cache the final lighting for the next bake
+        if (Builder->_giBounceRunningIndex == Builder->_bounceCount - 1)
+            lightmapEntry.LightmapDataBaked.Set(ImportLightmapTextureData.Get(), ImportLightmapTextureData.Length());
+#endif
+
         ImportLightmapTextureData.Release();
     }
 }
@@ -197,6 +359,102 @@ void ShadowsOfMordor::Builder::SceneBuildCache::Release()
     SAFE_DELETE_GPU_RESOURCE(TempLightmapData);
 }
 
+void ShadowsOfMordor::Builder::updateBakeCache()
+{
+    auto scene = _scenes[_workerActiveSceneIndex];
+    ScopeLock lock(scene->EntriesLocker);
+
+    // Cache the bake inputs
+    auto& cache = scene->BakeCache;
+    cache.SettingsHash = GetSettingsHash(scene->GetSettings());
+    cache.Charts.Resize(scene->Charts.Count());
+    for (int32 chartIndex = 0; chartIndex < scene->Charts.Count(); chartIndex++)
+    {
+        const auto& chart = scene->Charts[chartIndex];
+        const auto& entry = scene->Entries[chart.EntryIndex];
+        auto& e = cache.Charts[chartIndex];
+        switch (entry.Type)
+        {
+        case GeometryType::StaticModel:
+            e.ActorId = entry.AsStaticModel.Actor->GetID();
+            e.SubIndex0 = e.SubIndex1 = 0;
+            break;
+        case GeometryType::Terrain:
+            e.ActorId = entry.AsTerrain.Actor->GetID();
+            e.SubIndex0 = entry.AsTerrain.PatchIndex;
+            e.SubIndex1 = entry.AsTerrain.ChunkIndex;
+            break;
+        case GeometryType::Foliage:
+            e.ActorId = entry.AsFoliage.Actor->GetID();
+            e.SubIndex0 = entry.AsFoliage.InstanceIndex;
+            e.SubIndex1 = entry.AsFoliage.MeshIndex;
+            break;
+        }
+        e.Hash = entry.Hash;
+        e.Width = chart.Width;
+        e.Height = chart.Height;
+        e.Box = entry.Box;
+    }
+    cache.Lights.Clear();
+    Function<bool(Actor*, Dictionary<Guid, SceneBakeCache::Light>*)> cacheLights = &CacheLightsTree;
+    for (int32 sceneIndex = 0; sceneIndex < _scenes.Count(); sceneIndex++)
+        _scenes[sceneIndex]->Scene->TreeExecute(cacheLights, &cache.Lights);
+
+    // Find charts that need to be baked
+#if INCREMENTAL_BAKE
+    SceneBakeCache* prev = nullptr;
+    _bakeCache.TryGet(scene->Scene->GetID(), prev);
+    scene->Incremental = !FindDirtyCharts(scene, prev);
+#else
+    scene->Incremental = false;
+#endif
+    scene->DirtyChartsCount = 0;
+    for (auto& chart : scene->Charts)
+    {
+        if (!scene->Incremental)
+            chart.Dirty = true;
+        if (!chart.Dirty)
+            continue;
+        scene->DirtyChartsCount++;
+        if (chart.Result.TextureIndex != INVALID_INDEX)
+            scene->Lightmaps[chart.Result.TextureIndex].DirtyChartsCount++;
+    }
+    if (scene->Incremental)
+        LOG(Info, "Scene \'{0}\': {1} of {2} chart(s) changed since the last bake", scene->Scene->GetName(), scene->DirtyChartsCount, scene->Charts.Count());
+}
+
+void ShadowsOfMordor::Builder::saveBakeCache()
+{
+#if INCREMENTAL_BAKE
+    for (int32 sceneIndex = 0; sceneIndex < _scenes.Count(); sceneIndex++)
+    {
+        auto scene = _scenes[sceneIndex];
+        const Guid sceneId = scene->Scene->GetID();
+        SceneBakeCache* cache;
+        if (!_bakeCache.TryGet(sceneId, cache))
+        {
+            cache = New<SceneBakeCache>();
+            _bakeCache.Add(sceneId, cache);
+        }
+        *cache = MoveTemp(scene->BakeCache);
+
+        // Cache the final lighting (use the previous data for lightmaps that were not baked)
+        Texture* textures[NUM_SH_TARGETS];
+        cache->LightmapsData.Resize(scene->Lightmaps.Count());
+        cache->Textures.Resize(scene->Lightmaps.Count() * NUM_SH_TARGETS);
+        for (int32 lightmapIndex = 0; lightmapIndex < scene->Lightmaps.Count(); lightmapIndex++)
+        {
+            auto& lightmapEntry = scene->Lightmaps[lightmapIndex];
+            auto& data = lightmapEntry.LightmapDataBaked.HasItems() ? lightmapEntry.LightmapDataBaked : lightmapEntry.LightmapDataPrev;
+            cache->LightmapsData[lightmapIndex] = MoveTemp(data);
+            scene->Scene->LightmapsData.GetLightmap(lightmapIndex)->GetTextures(textures);
+            for (int32 textureIndex = 0; textureIndex < NUM_SH_TARGETS; textureIndex++)
+                cache->Textures[lightmapIndex * NUM_SH_TARGETS + textureIndex] = textures[textureIndex] ? textures[textureIndex]->GetID() : Guid::Empty;
+        }
+    }
+#endif
+}
+
 #if COMPILE_WITH_ASSETS_IMPORTER
 
 bool ShadowsOfMordor::Builder::SceneBuildCache::onImportLightmap(TextureData& image)
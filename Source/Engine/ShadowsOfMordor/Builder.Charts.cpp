@@ -33,6 +33,7 @@ void ShadowsOfMordor::Builder::generateCharts()
     {
         LightmapUVsChart chart;
         chart.Result.TextureIndex = INVALID_INDEX;
+        chart.Dirty = true;
 
         GeometryEntry& entry = scene->Entries[i];
         entry.ChartIndex = INVALID_INDEX;
@@ -47,6 +47,8 @@ namespace ShadowsOfMordor
 #define HEMISPHERES_BAKE_STATE_SAVE 1
 #define HEMISPHERES_BAKE_STATE_SAVE_DELAY 300
 #define CACHE_ENTRIES_PER_JOB 10
+#define INCREMENTAL_BAKE 1
+#define INCREMENTAL_BAKE_INFLUENCE_DISTANCE 1000.0f
 #define CACHE_POSITIONS_FORMAT HEMISPHERES_FORMAT_R32G32B32A32
 #define CACHE_NORMALS_FORMAT HEMISPHERES_FORMAT_R16G16B16A16
 
@@ -165,6 +165,7 @@ bool ShadowsOfMordor::Builder::doWorkInner(DateTime buildStart)
         RUN_STEP(generateCharts);
         RUN_STEP(packCharts);
         RUN_STEP(updateLightmaps);
+        RUN_STEP(updateBakeCache);
         RUN_STEP(updateEntries);
     }
 
@@ -216,9 +217,13 @@ bool ShadowsOfMordor::Builder::doWorkInner(DateTime buildStart)
     int32 bounceCount = 0;
     int32 lightmapsCount = 0;
     int32 entriesCount = 0;
+    int32 dirtyChartsCount = 0;
+    bool incremental = true;
     for (int32 sceneIndex = 0; sceneIndex < _scenes.Count(); sceneIndex++)
     {
         auto& scene = *_scenes[sceneIndex];
+        dirtyChartsCount += scene.DirtyChartsCount;
+        incremental &= scene.Incremental;
         hemispheresCount += scene.HemispheresCount;
         mergedHemispheresCount += scene.MergedHemispheresCount;
         lightmapsCount += scene.Lightmaps.Count();
@@ -232,6 +237,13 @@ bool ShadowsOfMordor::Builder::doWorkInner(DateTime buildStart)
             lightmap.Entries.Resize(0);
     }
     _bounceCount = bounceCount;
+    if (incremental && dirtyChartsCount == 0)
+    {
+        LOG(Info, "Lightmaps are up to date");
+        saveBakeCache();
+        reportProgress(BuildProgressStep::RenderHemispheres, 1.0f);
+        return false;
+    }
     LOG(Info, "Rendering {0} hemispheres in {1} bounce(s) (merged: {2})", hemispheresCount, bounceCount, mergedHemispheresCount);
     if (bounceCount <= 0 || hemispheresCount <= 0)
     {
@@ -263,8 +275,8 @@ bool ShadowsOfMordor::Builder::doWorkInner(DateTime buildStart)
         // Render bounce for every scene separately
         for (_workerActiveSceneIndex = 0; _workerActiveSceneIndex < _scenes.Count(); _workerActiveSceneIndex++)
         {
-            // Skip scenes without any lightmaps
-            if (_scenes[_workerActiveSceneIndex]->Lightmaps.IsEmpty())
+            // Skip scenes without any lightmaps or without changes since the last bake
+            if (_scenes[_workerActiveSceneIndex]->Lightmaps.IsEmpty() || _scenes[_workerActiveSceneIndex]->DirtyChartsCount == 0)
                 continue;
 
             // Clear hemispheres target
@@ -292,6 +304,7 @@ bool ShadowsOfMordor::Builder::doWorkInner(DateTime buildStart)
     }
 
     reportProgress(BuildProgressStep::RenderHemispheres, 1.0f);
+    saveBakeCache();
 
 #if DEBUG_EXPORT_HEMISPHERES_PREVIEW
     for (int32 sceneIndex = 0; sceneIndex < _scenes.Count(); sceneIndex++)
@@ -11,6 +11,7 @@
 #include "Engine/Terrain/TerrainPatch.h"
 #include "Engine/Foliage/Foliage.h"
 #include "Engine/Threading/Threading.h"
+#include "Engine/Utilities/Crc.h"
 
 bool canUseMaterialWithLightmap(MaterialBase* material, ShadowsOfMordor::Builder::SceneBuildCache* scene)
 {
@@ -21,6 +22,19 @@ bool canUseMaterialWithLightmap(MaterialBase* material, ShadowsOfMordor::Builder
     return material->CanUseLightmap();
 }
 
+void initEntryHash(ShadowsOfMordor::Builder::GeometryEntry& entry, const Matrix& world, const Guid& assetId)
+{
+    entry.Hash = Crc::MemCrc32(&world, sizeof(world));
+    entry.Hash = Crc::MemCrc32(&entry.Box, sizeof(entry.Box), entry.Hash);
+    CombineHash(entry.Hash, GetHash(assetId));
+    CombineHash(entry.Hash, GetHash(entry.Scale));
+}
+
+void addEntryHash(ShadowsOfMordor::Builder::GeometryEntry& entry, MaterialBase* material)
+{
+    CombineHash(entry.Hash, GetHash(material ? material->GetID() : Guid::Empty));
+}
+
 bool cacheStaticGeometryTree(Actor* actor, ShadowsOfMordor::Builder::SceneBuildCache* scene)
 {
     ShadowsOfMordor::Builder::GeometryEntry entry;
@@ -66,6 +80,13 @@ bool cacheStaticGeometryTree(Actor* actor, ShadowsOfMordor::Builder::SceneBuildC
                 Matrix worldMatrix;
                 staticModel->GetLocalToWorldMatrix(worldMatrix);
                 entry.Box = model->GetBox(worldMatrix);
+                initEntryHash(entry, worldMatrix, model->GetID());
+                for (int32 meshIndex = 0; meshIndex < lod.Meshes.Count(); meshIndex++)
+                {
+                    const auto& mesh = lod.Meshes[meshIndex];
+                    if (staticModel->Entries[mesh.GetMaterialSlotIndex()].Visible)
+                        addEntryHash(entry, staticModel->GetMaterial(meshIndex));
+                }
                 results.Add(entry);
             }
             else
@@ -95,6 +116,10 @@ bool cacheStaticGeometryTree(Actor* actor, ShadowsOfMordor::Builder::SceneBuildC
                 if (canUseLightmap)
                 {
                     entry.Box = chunk.GetBounds();
+                    Matrix world;
+                    chunk.GetTransform().GetWorld(world);
+                    initEntryHash(entry, world, patch->Heightmap.GetID());
+                    addEntryHash(entry, material);
                     results.Add(entry);
                 }
                 else
@@ -123,6 +148,10 @@ bool cacheStaticGeometryTree(Actor* actor, ShadowsOfMordor::Builder::SceneBuildC
             if (canUseLightmap && model && !model->WaitForLoaded())
             {
                 BoundingBox::FromSphere(instance.Bounds, entry.Box);
+                Matrix world;
+                foliage->GetTransform().LocalToWorld(instance.Transform).GetWorld(world);
+                initEntryHash(entry, world, model->GetID());
+                addEntryHash(entry, type.Entries[0].Material);
                 const int32 lodIndex = 0;
                 auto& lod = model->LODs[lodIndex];
                 for (int32 meshIndex = 0; meshIndex < lod.Meshes.Count(); meshIndex++)
@@ -254,8 +283,8 @@ void ShadowsOfMordor::Builder::updateEntries()
         break;
         }
 
-        // Cache entry link
-        if (chart.Result.TextureIndex != INVALID_INDEX)
+        // Cache entry link (only dirty charts are rendered into hemispheres cache)
+        if (chart.Result.TextureIndex != INVALID_INDEX && chart.Dirty)
             scene->Lightmaps[chart.Result.TextureIndex].Entries.Add(i);
 
         reportProgress(BuildProgressStep::UpdateEntries, static_cast<float>(i) / entriesCount);
@@ -47,12 +47,13 @@ void ShadowsOfMordor::Builder::generateHemispheres()
 {
     reportProgress(BuildProgressStep::GenerateHemispheresCache, 0.0f);
 
-    // Clear all lightmaps
+    auto scene = _scenes[_workerActiveSceneIndex];
+
+    // Clear all lightmaps (incremental bake keeps the lighting of unchanged charts)
     _workerStagePosition0 = 0;
-    if (runStage(CleanLightmaps))
+    if (!scene->Incremental && runStage(CleanLightmaps))
         return;
 
-    auto scene = _scenes[_workerActiveSceneIndex];
     auto lightmapsCount = scene->Lightmaps.Count();
     auto& settings = scene->GetSettings();
 
@@ -73,6 +74,8 @@ void ShadowsOfMordor::Builder::generateHemispheres()
         // Prepare
         auto& lightmapEntry = scene->Lightmaps[_workerStagePosition0];
         lightmapEntry.Hemispheres.Clear();
+        if (lightmapEntry.DirtyChartsCount == 0)
+            continue;
         lightmapEntry.Hemispheres.EnsureCapacity(Math::Square(atlasSize / 2));
         Float3 position, normal;
 
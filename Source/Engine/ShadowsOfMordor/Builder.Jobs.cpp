@@ -137,7 +137,8 @@ void ShadowsOfMordor::Builder::onJobRender(GPUContext* context)
                     auto& mesh = lod.Meshes[meshIndex];
                     auto& materialSlot = staticModel->Entries[mesh.GetMaterialSlotIndex()];
 
-                    if (materialSlot.Visible && mesh.HasLightmapUVs())
+                    // Lightmap baking shader doesn't decode quantized positions
+                    if (materialSlot.Visible && mesh.HasLightmapUVs() && !mesh.GetPositionsQuantization().IsValid())
                     {
                         mesh.Render(context);
                     }
@@ -204,7 +205,9 @@ void ShadowsOfMordor::Builder::onJobRender(GPUContext* context)
                 context->UpdateCB(cb, &shaderData);
                 context->BindCB(0, cb);
                 context->SetState(_psRenderCacheModel);
-                type.Model->LODs[0].Meshes[entry.AsFoliage.MeshIndex].Render(context);
+                const auto& mesh = type.Model->LODs[0].Meshes[entry.AsFoliage.MeshIndex];
+                if (!mesh.GetPositionsQuantization().IsValid())
+                    mesh.Render(context);
 
                 break;
             }
@@ -282,11 +285,21 @@ void ShadowsOfMordor::Builder::onJobRender(GPUContext* context)
         // Before hemispheres rendering we have to clear target lightmap data
         // Later we use blur shader to interpolate empty texels (so empty texels should be pure black)
 
-        ASSERT(scene->Lightmaps.Count() > _workerStagePosition0);
-        auto& lightmapEntry = scene->Lightmaps[_workerStagePosition0];
+        for (; _workerStagePosition0 < scene->Lightmaps.Count(); _workerStagePosition0++)
+        {
+            auto& lightmapEntry = scene->Lightmaps[_workerStagePosition0];
+#if INCREMENTAL_BAKE
+            if (lightmapEntry.LightmapDataPrev.HasItems())
+            {
+                // Restore the lighting of the charts that are not baked (dirty charts are cleared)
+                context->UpdateBuffer(lightmapEntry.LightmapData, lightmapEntry.LightmapDataPrev.Get(), lightmapEntry.LightmapDataPrev.Count());
+                continue;
+            }
+#endif
 
-        // All black everything!
-        context->ClearUA(lightmapEntry.LightmapData, Float4::Zero);
+            // All black everything!
+            context->ClearUA(lightmapEntry.LightmapData, Float4::Zero);
+        }
 
         _wasStageDone = true;
         break;
@@ -138,6 +138,9 @@ void ShadowsOfMordor::Builder::Dispose()
     }
 
     releaseResources();
+#if INCREMENTAL_BAKE
+    _bakeCache.ClearDelete();
+#endif
 }
 
 #if HEMISPHERES_BAKE_STATE_SAVE
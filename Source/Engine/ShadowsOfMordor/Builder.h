@@ -12,6 +12,7 @@
 
 #include "Engine/Graphics/RenderTask.h"
 #include "Engine/Core/Singleton.h"
+#include "Engine/Core/Collections/Dictionary.h"
 
 // Forward declarations
 #if COMPILE_WITH_ASSETS_IMPORTER
@@ -51,6 +52,9 @@ namespace ShadowsOfMordor
             LightmapEntry Result;
 
             int32 EntryIndex;
+
+            // True if chart needs to be baked, false if it can reuse the lighting from the previous bake
+            bool Dirty;
         };
 
         struct GeometryEntry
@@ -84,6 +88,9 @@ namespace ShadowsOfMordor
             };
 
             int32 ChartIndex;
+
+            // Hash of the data that affects the baked lighting (geometry, transformation and material)
+            uint32 Hash;
         };
 
         typedef Array<GeometryEntry> GeometryEntriesCollection;
@@ -125,12 +132,59 @@ namespace ShadowsOfMordor
             // Restored data for the lightmap from the loaded state (copied to the LightmapData on first hemispheres render job)
             Array<byte> LightmapDataInit;
 #endif
+#if INCREMENTAL_BAKE
+            // Data for the lightmap from the previous bake with cleared dirty charts (copied to the LightmapData instead of clearing it before each bounce)
+            Array<byte> LightmapDataPrev;
+
+            // Data for the lightmap from the last bounce (cached for the next bake)
+            Array<byte> LightmapDataBaked;
+#endif
+            int32 DirtyChartsCount = 0;
 
             ~LightmapBuildCache();
 
             bool Init(const LightmapSettings* settings);
         };
 
+        /// <summary>
+        /// Per scene bake inputs and results (used to rebake only charts affected by the changes since the last bake)
+        /// </summary>
+        class SceneBakeCache
+        {
+        public:
+
+            struct Chart
+            {
+                Guid ActorId;
+                int32 SubIndex0;
+                int32 SubIndex1;
+                uint32 Hash;
+                int32 Width;
+                int32 Height;
+                BoundingBox Box;
+            };
+
+            struct Light
+            {
+                uint32 Hash;
+                BoundingBox Box;
+                bool IsGlobal;
+            };
+
+            uint32 SettingsHash = 0;
+            Array<Chart> Charts;
+            Dictionary<Guid, Light> Lights;
+            Array<Guid> Textures;
+            Array<Array<byte>> LightmapsData;
+
+            /// <summary>
+            /// Checks if the charts of the other cache are packed into the lightmaps the same way as charts of this cache.
+            /// </summary>
+            /// <param name="other">The other cache.</param>
+            /// <returns>True if charts layout matches, otherwise false.</returns>
+            bool IsLayoutMatching(const SceneBakeCache& other) const;
+        };
+
         /// <summary>
         /// Per scene cache data
         /// </summary>
@@ -150,6 +204,11 @@ namespace ShadowsOfMordor
             Array<LightmapBuildCache> Lightmaps;
             GPUBuffer* TempLightmapData;
 
+            // Incremental baking (lightmaps with no dirty charts are not baked)
+            SceneBakeCache BakeCache;
+            bool Incremental;
+            int32 DirtyChartsCount;
+
             // Stats
             int32 LightmapsCount;
             int32 HemispheresCount;
@@ -225,6 +284,9 @@ namespace ShadowsOfMordor
         volatile int64 _wasBuildCancelled;
 
         Array<SceneBuildCache*> _scenes;
+#if INCREMENTAL_BAKE
+        Dictionary<Guid, SceneBakeCache*> _bakeCache;
+#endif
 
         volatile int64 _wasJobDone;
         BuildingStage _stage;
@@ -326,7 +388,9 @@ namespace ShadowsOfMordor
         void generateCharts();
         void packCharts();
         void updateLightmaps();
+        void updateBakeCache();
         void updateEntries();
+        void saveBakeCache();
         void generateHemispheres();
 
 #if DEBUG_EXPORT_LIGHTMAPS_PREVIEW
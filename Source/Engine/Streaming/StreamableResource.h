@@ -113,6 +113,16 @@ class FLAXENGINE_API StreamableResource
         double LastUpdateTime = 0.0;
         double TargetResidencyChangeTime = 0;
         int32 TargetResidency = 0;
+        // The target residency calculated from the resource quality (before applying the memory budget).
+        int32 QualityResidency = 0;
+        // The maximum residency allowed by the streaming memory budget (-1 if not limited).
+        int32 BudgetResidency = -1;
+        // The maximum screen size (in pixels) of the objects using this resource, reported during drawing.
+        float ScreenSize = 0.0f;
+        // The time of the last screen size report (negative if not reported).
+        double ScreenSizeTime = -1.0;
+        // The time when resource started waiting for the higher residency (negative if not waiting).
+        double WaitStartTime = -1.0;
         bool Error = false;
         SamplesBuffer<float, 5> QualitySamples;
     };
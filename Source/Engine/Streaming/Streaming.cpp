@@ -5,22 +5,51 @@
 #include "StreamingGroup.h"
 #include "StreamingSettings.h"
 #include "Engine/Engine/Engine.h"
+#include "Engine/Engine/CommandLine.h"
 #include "Engine/Engine/EngineService.h"
 #include "Engine/Profiler/ProfilerCPU.h"
 #include "Engine/Threading/Threading.h"
 #include "Engine/Threading/TaskGraph.h"
 #include "Engine/Threading/Task.h"
 #include "Engine/Graphics/GPUDevice.h"
+#include "Engine/Graphics/Async/GPUTasksManager.h"
 #include "Engine/Graphics/Textures/GPUSampler.h"
+#include "Engine/Graphics/Textures/GPUTexture.h"
+#include "Engine/Graphics/Textures/StreamingTexture.h"
+#include "Engine/Graphics/Textures/TextureBase.h"
+#include "Engine/Graphics/RenderTools.h"
+#include "Engine/Graphics/RenderView.h"
+#include "Engine/Content/Content.h"
+#include "Engine/Level/Actors/Camera.h"
+#include "Engine/Content/Assets/MaterialInstance.h"
+#include "Engine/Core/Collections/HashSet.h"
+#include "Engine/Core/Collections/Sorting.h"
 #include "Engine/Serialization/Serialization.h"
 
+// Interval (in seconds) between the streaming memory budget updates
+#define STREAMING_BUDGET_UPDATE_INTERVAL 0.5
+
+// The minimum amount of mip levels that memory budget can leave for the texture (matches the resident mips that are not streamed)
+#define STREAMING_BUDGET_MIN_MIPS 7
+
 namespace StreamingManagerImpl
 {
-    int32 LastUpdateResourcesIndex = 0;
-    CriticalSection ResourcesLock;
+    double UpdateInterval = 0.1;
+    int32 MaxResourceUpdatesPerFrame = 50;
+    int32 MaxStreamingTasksPerFrame = 0;
+    int32 StreamingTasksLeft = -1;
+    StreamingStats Stats;
+    SamplesBuffer<float, 128> ResidencyTimes;
+    bool ResidencyTimesDirty = false;
+    float TimeToResidencyP50 = 0.0f, TimeToResidencyP90 = 0.0f, TimeToResidencyP99 = 0.0f;
+    CriticalSection ResourcesLock("Streaming.Resources");
     Array<StreamableResource*> Resources;
     Array<GPUSampler*, InlinedAllocation<32>> TextureGroupSamplers;
     GPUSampler* FallbackSampler = nullptr;
+    double LastBudgetUpdateTime = 0.0;
+    CriticalSection FeedbackLock;
+    HashSet<Guid> FeedbackMaterials;
+    Array<Guid> FeedbackMaterialsToUpdate;
 }
 
 using namespace StreamingManagerImpl;
@@ -47,21 +76,293 @@ class StreamingSystem : public TaskGraphSystem
 namespace
 {
     TaskGraphSystem* System = nullptr;
+
+    struct BudgetEntry
+    {
+        StreamingTexture* Texture;
+        int32 Group;
+        int32 Residency;
+        int32 MinResidency;
+        double LastRenderTime;
+        uint64 MemoryUsage;
+
+        bool operator<(const BudgetEntry& other) const
+        {
+            // Least important first (not rendered for the longest time), then the bigger ones
+            if (LastRenderTime != other.LastRenderTime)
+                return LastRenderTime < other.LastRenderTime;
+            return MemoryUsage > other.MemoryUsage;
+        }
+    };
+
+    void UpdateFeedback(MaterialBase* material, float screenSize, double currentTime)
+    {
+        const int32 count = material->Params.Count();
+        for (int32 i = 0; i < count; i++)
+        {
+            // Find the material that provides the parameter value (instance uses base material values for non-overriden parameters)
+            const MaterialBase* m = material;
+            const MaterialParameter* param = &m->Params.At(i);
+            while (!param->IsOverride() && m->IsMaterialInstance())
+            {
+                const MaterialBase* baseMaterial = ((const MaterialInstance*)m)->GetBaseMaterial();
+                if (!baseMaterial || baseMaterial->Params.Count() != count)
+                    break;
+                m = baseMaterial;
+                param = &m->Params.At(i);
+            }
+            if (param->GetParameterType() != MaterialParameterType::Texture && param->GetParameterType() != MaterialParameterType::CubeTexture)
+                continue;
+            const auto texture = (TextureBase*)param->GetValueAsset();
+            if (!texture)
+                continue;
+
+            // Keep the maximum screen size reported during the frame
+            auto& streaming = texture->StreamingTexture()->Streaming;
+            if (streaming.ScreenSizeTime != currentTime)
+            {
+                streaming.ScreenSizeTime = currentTime;
+                streaming.ScreenSize = screenSize;
+            }
+            else
+            {
+                streaming.ScreenSize = Math::Max(streaming.ScreenSize, screenSize);
+            }
+        }
+    }
+
+    void UpdateFeedback(double currentTime)
+    {
+        PROFILE_CPU();
+        FeedbackLock.Lock();
+        for (const auto& e : FeedbackMaterials)
+            FeedbackMaterialsToUpdate.Add(e.Item);
+        FeedbackMaterials.Clear();
+        FeedbackLock.Unlock();
+
+        // Pass the objects screen size from the materials to their textures
+        for (const Guid& id : FeedbackMaterialsToUpdate)
+        {
+            const auto material = ScriptingObject::Cast<MaterialBase>(Content::GetAsset(id));
+            if (!material)
+                continue;
+            const float screenSize = material->StreamingScreenSize;
+            material->StreamingScreenSize = 0.0f;
+            UpdateFeedback(material, screenSize, currentTime);
+        }
+        FeedbackMaterialsToUpdate.Clear();
+    }
+
+    struct UpdateEntry
+    {
+        StreamableResource* Resource;
+        float Priority;
+
+        bool operator<(const UpdateEntry& other) const
+        {
+            return Priority > other.Priority;
+        }
+    };
+
+    // Min-heap (by priority) of the most important resources to update this frame
+    Array<UpdateEntry> UpdateQueue;
+
+    void UpdateQueueSiftDown(int32 index)
+    {
+        const int32 count = UpdateQueue.Count();
+        UpdateEntry* heap = UpdateQueue.Get();
+        while (true)
+        {
+            const int32 left = index * 2 + 1;
+            const int32 right = left + 1;
+            int32 smallest = index;
+            if (left < count && heap[left].Priority < heap[smallest].Priority)
+                smallest = left;
+            if (right < count && heap[right].Priority < heap[smallest].Priority)
+                smallest = right;
+            if (smallest == index)
+                break;
+            Swap(heap[index], heap[smallest]);
+            index = smallest;
+        }
+    }
+
+    void UpdateQueueSiftUp(int32 index)
+    {
+        UpdateEntry* heap = UpdateQueue.Get();
+        while (index > 0)
+        {
+            const int32 parent = (index - 1) / 2;
+            if (heap[parent].Priority <= heap[index].Priority)
+                break;
+            Swap(heap[index], heap[parent]);
+            index = parent;
+        }
+    }
+
+    // Gets the resource update importance (higher values are updated first, zero or less if update is not needed yet)
+    float GetUpdatePriority(const StreamableResource* resource, double currentTime)
+    {
+        const auto& streaming = resource->Streaming;
+        if (streaming.LastUpdateTime <= 0.0)
+            return MAX_float; // Requested update
+        const float age = (float)(currentTime - streaming.LastUpdateTime);
+        if (age < (float)UpdateInterval)
+            return 0.0f;
+
+        // Resources waiting longer go first to prevent starvation
+        float priority = age / (float)UpdateInterval;
+
+        // Boost resources that are far from their target residency and the ones visible on the screen (from the render feedback)
+        priority *= (float)(1 + Math::Abs(streaming.TargetResidency - resource->GetCurrentResidency()));
+        if (streaming.ScreenSizeTime >= 0.0 && currentTime - streaming.ScreenSizeTime < 1.0)
+            priority *= 4.0f;
+        return priority;
+    }
+
+    Array<BudgetEntry> BudgetEntries;
+    Array<BudgetEntry*> BudgetGroupEntries;
+
+    // Lowers the residency of the textures (by a single mip in each pass, starting from the least important ones) until memory usage fits into the budget
+    void FitBudget(Array<BudgetEntry*>& entries, uint64& usage, uint64 budget)
+    {
+        bool anyChange = true;
+        while (usage > budget && anyChange)
+        {
+            anyChange = false;
+            for (int32 i = 0; i < entries.Count() && usage > budget; i++)
+            {
+                BudgetEntry& e = *entries[i];
+                if (e.Residency <= e.MinResidency)
+                    continue;
+                e.Residency--;
+                const uint64 memoryUsage = e.Texture->GetMemoryUsage(e.Residency);
+                usage -= e.MemoryUsage - memoryUsage;
+                e.MemoryUsage = memoryUsage;
+                anyChange = true;
+            }
+        }
+    }
+
+    void SetBudgetResidency(StreamableResource* resource, int32 residency)
+    {
+        if (resource->Streaming.BudgetResidency != residency)
+        {
+            resource->Streaming.BudgetResidency = residency;
+            resource->RequestStreamingUpdate();
+        }
+    }
+
+    void UpdateBudget()
+    {
+        PROFILE_CPU();
+        const uint64 budget = Streaming::TexturesMemoryBudget;
+        const auto& groups = Streaming::TextureGroups;
+        bool anyQuota = false;
+        for (const TextureGroup& group : groups)
+            anyQuota |= group.MemoryBudget > 0;
+        const StreamingGroup* texturesGroup = StreamingGroups::Instance()->Textures();
+        if (budget == 0 && !anyQuota)
+        {
+            // Remove limits after disabling budget
+            for (StreamableResource* resource : Resources)
+                SetBudgetResidency(resource, -1);
+            return;
+        }
+
+        // Gather textures with the residency they want to have (based on quality)
+        BudgetEntries.Clear();
+        for (StreamableResource* resource : Resources)
+        {
+            if (resource->GetGroup() != texturesGroup)
+                continue;
+            auto& e = BudgetEntries.AddOne();
+            e.Texture = (StreamingTexture*)resource;
+            e.Group = e.Texture->GetHeader()->TextureGroup;
+            if (e.Group < 0 || e.Group >= groups.Count())
+                e.Group = -1;
+            e.Residency = resource->Streaming.QualityResidency;
+            e.MinResidency = e.Residency;
+            if (resource->IsDynamic())
+            {
+                // Non-dynamic textures are always at full quality but still count into the budget
+                const int32 minMips = e.Group != -1 ? Math::Max(groups[e.Group].MipLevelsMin, STREAMING_BUDGET_MIN_MIPS) : STREAMING_BUDGET_MIN_MIPS;
+                e.MinResidency = Math::Min(minMips, e.Residency);
+            }
+            e.LastRenderTime = e.Texture->GetTexture()->LastRenderTime;
+            e.MemoryUsage = e.Texture->GetMemoryUsage(e.Residency);
+        }
+        Sorting::QuickSort(BudgetEntries);
+
+        // Apply per-group quotas
+        for (int32 groupIndex = 0; groupIndex < groups.Count(); groupIndex++)
+        {
+            const uint64 quota = (uint64)groups[groupIndex].MemoryBudget * 1024 * 1024;
+            if (quota == 0)
+                continue;
+            uint64 usage = 0;
+            BudgetGroupEntries.Clear();
+            for (auto& e : BudgetEntries)
+            {
+                if (e.Group == groupIndex)
+                {
+                    BudgetGroupEntries.Add(&e);
+                    usage += e.MemoryUsage;
+                }
+            }
+            FitBudget(BudgetGroupEntries, usage, quota);
+        }
+
+        // Apply global budget
+        if (budget != 0)
+        {
+            uint64 usage = 0;
+            BudgetGroupEntries.Clear();
+            for (auto& e : BudgetEntries)
+            {
+                BudgetGroupEntries.Add(&e);
+                usage += e.MemoryUsage;
+            }
+            FitBudget(BudgetGroupEntries, usage, budget);
+        }
+
+        // Limit residency of the textures that didn't fit
+        for (const auto& e : BudgetEntries)
+        {
+            const int32 residency = e.Residency < e.Texture->Streaming.QualityResidency ? e.Residency : -1;
+            SetBudgetResidency(e.Texture, residency);
+        }
+    }
 }
 
 StreamingService StreamingServiceInstance;
 
 Array<TextureGroup, InlinedAllocation<32>> Streaming::TextureGroups;
+uint64 Streaming::TexturesMemoryBudget = 0;
+Array<Vector3> Streaming::Sources;
 
 void StreamingSettings::Apply()
 {
     Streaming::TextureGroups = TextureGroups;
+    int32 texturesMemoryBudget = TexturesMemoryBudget;
+    TexturesMemoryBudgetPerPlatform.TryGet(PLATFORM_TYPE, texturesMemoryBudget);
+    Streaming::TexturesMemoryBudget = (uint64)Math::Max(texturesMemoryBudget, 0) * 1024 * 1024;
     SAFE_DELETE_GPU_RESOURCES(TextureGroupSamplers);
     TextureGroupSamplers.Resize(TextureGroups.Count(), false);
+    StreamingManagerImpl::UpdateInterval = Math::Max(ResourceUpdatesInterval, 0.01f);
+    StreamingManagerImpl::MaxResourceUpdatesPerFrame = Math::Max(MaxResourceUpdatesPerFrame, 1);
+    StreamingManagerImpl::MaxStreamingTasksPerFrame = Math::Max(MaxStreamingTasksPerFrame, 0);
+    GPUTasksManager::MaxUploadSizePerFrame = (uint64)Math::Max(MaxUploadSizePerFrame, 0) * 1024 * 1024;
 }
 
 void StreamingSettings::Deserialize(DeserializeStream& stream, ISerializeModifier* modifier)
 {
+    DESERIALIZE(ResourceUpdatesInterval);
+    DESERIALIZE(MaxResourceUpdatesPerFrame);
+    DESERIALIZE(MaxStreamingTasksPerFrame);
+    DESERIALIZE(MaxUploadSizePerFrame);
+    DESERIALIZE(TexturesMemoryBudget);
+    DESERIALIZE(TexturesMemoryBudgetPerPlatform);
     DESERIALIZE(TextureGroups);
 }
 
@@ -94,6 +395,8 @@ void StreamableResource::ResetStreaming(bool error)
 void StreamableResource::StartStreaming(bool isDynamic)
 {
     _isDynamic = isDynamic;
+    if (!::Streaming::IsEnabled())
+        return;
     if (!_isStreaming)
     {
         _isStreaming = true;
@@ -142,6 +445,11 @@ void UpdateResource(StreamableResource* resource, double currentTime)
     auto allocatedResidency = resource->GetAllocatedResidency();
     auto targetResidency = handler->CalculateResidency(resource, targetQuality);
     ASSERT(allocatedResidency >= currentResidency && allocatedResidency >= 0);
+    resource->Streaming.QualityResidency = targetResidency;
+
+    // Limit residency to fit into the memory budget (see UpdateBudget)
+    if (resource->Streaming.BudgetResidency >= 0)
+        targetResidency = Math::Min(targetResidency, resource->Streaming.BudgetResidency);
     resource->Streaming.LastUpdateTime = currentTime;
 
     // Check if a target residency level has been changed
@@ -152,9 +460,29 @@ void UpdateResource(StreamableResource* resource, double currentTime)
         resource->Streaming.TargetResidencyChangeTime = currentTime;
     }
 
+    // Measure time it takes to reach the target residency
+    if (targetResidency > currentResidency)
+    {
+        if (resource->Streaming.WaitStartTime < 0.0)
+            resource->Streaming.WaitStartTime = currentTime;
+    }
+    else if (resource->Streaming.WaitStartTime >= 0.0)
+    {
+        ResidencyTimes.Add((float)((currentTime - resource->Streaming.WaitStartTime) * 1000.0));
+        ResidencyTimesDirty = true;
+        resource->Streaming.WaitStartTime = -1.0;
+    }
+
     // Check if need to change resource current residency
     if (handler->RequiresStreaming(resource, currentResidency, targetResidency))
     {
+        // Skip streaming in when out of the per-frame streaming limit (resource will be updated again next frame)
+        if (StreamingTasksLeft == 0 && targetResidency > currentResidency)
+        {
+            resource->RequestStreamingUpdate();
+            return;
+        }
+
         // Check if need to change allocation for that resource
         if (allocatedResidency != targetResidency)
         {
@@ -183,6 +511,20 @@ void UpdateResource(StreamableResource* resource, double currentTime)
         if (streamingTask != nullptr)
         {
             streamingTask->Start();
+            if (requestedResidency > currentResidency)
+            {
+                if (StreamingTasksLeft > 0)
+                    StreamingTasksLeft--;
+                if (group == StreamingGroups::Instance()->Textures())
+                {
+                    const auto texture = (StreamingTexture*)resource;
+                    Stats.RequestedBytes += texture->GetMemoryUsage(requestedResidency) - texture->GetMemoryUsage(currentResidency);
+                }
+            }
+            else
+            {
+                Stats.EvictionsCount++;
+            }
         }
     }
     else
@@ -191,17 +533,6 @@ void UpdateResource(StreamableResource* resource, double currentTime)
 
         // TODO: deallocate or decrease memory usage after timeout? (timeout should be smaller on low mem)
     }
-
-    // low memory case:
-    // if we are on budget and cannot load everything we have to:
-    // decrease global resources quality scale (per resources group)
-    // decrease asset deallocate timeout
-
-    // low mem detecting:
-    // for low mem we have to get whole memory budget for a group and then
-    // subtract immutable resources mem usage (like render targets or non dynamic resources)
-    // so we get amount of memory we can distribute and we can detect if we are out of the limit
-    // low mem should be updated once per a few frames
 }
 
 bool StreamingService::Init()
@@ -223,44 +554,107 @@ void StreamingSystem::Job(int32 index)
 {
     PROFILE_CPU_NAMED("Streaming.Job");
 
-    // TODO: use streaming settings
-    const double ResourceUpdatesInterval = 0.1;
-    int32 MaxResourcesPerUpdate = 50;
-
     // Start update
     ScopeLock lock(ResourcesLock);
+    const double startTime = Platform::GetTimeSeconds();
     const int32 resourcesCount = Resources.Count();
-    int32 resourcesUpdates = Math::Min(MaxResourcesPerUpdate, resourcesCount);
+    const int32 maxUpdates = Math::Min(MaxResourceUpdatesPerFrame, resourcesCount);
+    StreamingTasksLeft = MaxStreamingTasksPerFrame > 0 ? MaxStreamingTasksPerFrame : -1;
     const double currentTime = Platform::GetTimeSeconds();
 
-    // Update high priority queue and then rest of the resources
-    // Note: resources in the update queue are updated always, while others only between specified intervals
-    int32 resourcesChecks = resourcesCount;
-    while (resourcesUpdates > 0 && resourcesChecks-- > 0)
+    // Update textures screen size feedback from the last frame drawing
+    if (FeedbackMaterials.Count() != 0)
+        UpdateFeedback(currentTime);
+
+    // Update memory budget limits once per a few frames
+    if (currentTime - LastBudgetUpdateTime >= STREAMING_BUDGET_UPDATE_INTERVAL)
     {
-        // Move forward
-        LastUpdateResourcesIndex++;
-        if (LastUpdateResourcesIndex >= resourcesCount)
-            LastUpdateResourcesIndex = 0;
+        LastBudgetUpdateTime = currentTime;
+        UpdateBudget();
+    }
 
-        // Peek resource
-        const auto resource = Resources[LastUpdateResourcesIndex];
+    // Reset stats
+    const StreamingGroups* groups = StreamingGroups::Instance();
+    const StreamingGroup* texturesGroup = groups->Textures();
+    Stats = StreamingStats();
+    Stats.TexturesMemoryBudget = Streaming::TexturesMemoryBudget;
+    if (GPUDevice::Instance->GetTasksManager())
+        Stats.UploadedBytes = GPUDevice::Instance->GetTasksManager()->GetFrameUploadSize();
+
+    // Pick the most important resources to update
+    UpdateQueue.Clear();
+    for (int32 i = 0; i < resourcesCount && maxUpdates > 0; i++)
+    {
+        StreamableResource* resource = Resources.Get()[i];
 
-        // Try to update it
-        if (currentTime - resource->Streaming.LastUpdateTime >= ResourceUpdatesInterval && resource->CanBeUpdated())
+        // Gather stats
+        const StreamingGroup* group = resource->GetGroup();
+        if (resource->Streaming.TargetResidency > resource->GetCurrentResidency())
+        {
+            Stats.StreamingResourcesCount++;
+            if (group == texturesGroup)
+                Stats.StreamingTexturesCount++;
+            else if (group == groups->Models())
+                Stats.StreamingModelsCount++;
+            else if (group == groups->SkinnedModels())
+                Stats.StreamingSkinnedModelsCount++;
+            else if (group == groups->Audio())
+                Stats.StreamingAudioCount++;
+        }
+        if (resource->Streaming.BudgetResidency != -1)
+            Stats.BudgetLimitedResourcesCount++;
+        if (group == texturesGroup)
+            Stats.TexturesMemoryUsage += ((StreamingTexture*)resource)->GetTexture()->GetMemoryUsage();
+
+        const float priority = GetUpdatePriority(resource, currentTime);
+        if (priority <= 0.0f || (UpdateQueue.Count() == maxUpdates && priority <= UpdateQueue[0].Priority) || !resource->CanBeUpdated())
+            continue;
+        if (UpdateQueue.Count() < maxUpdates)
+        {
+            UpdateQueue.Add({ resource, priority });
+            UpdateQueueSiftUp(UpdateQueue.Count() - 1);
+        }
+        else
         {
-            UpdateResource(resource, currentTime);
-            resourcesUpdates--;
+            UpdateQueue[0] = { resource, priority };
+            UpdateQueueSiftDown(0);
         }
     }
 
-    // TODO: add StreamingManager stats, update time per frame, updates per frame, etc.
+    // Update resources (starting from the most important ones)
+    Sorting::QuickSort(UpdateQueue);
+    for (const UpdateEntry& e : UpdateQueue)
+        UpdateResource(e.Resource, currentTime);
+
+    // Update stats
+    if (ResidencyTimesDirty)
+    {
+        ResidencyTimesDirty = false;
+        float times[128];
+        const int32 count = ResidencyTimes.Count();
+        Platform::MemoryCopy(times, ResidencyTimes.Get(), count * sizeof(float));
+        Sorting::QuickSort(times, count);
+        TimeToResidencyP50 = times[count * 50 / 100];
+        TimeToResidencyP90 = times[count * 90 / 100];
+        TimeToResidencyP99 = times[count * 99 / 100];
+    }
+    Stats.ResourcesCount = resourcesCount;
+    Stats.UpdatedResourcesCount = UpdateQueue.Count();
+    Stats.UpdateTimeMs = (float)((Platform::GetTimeSeconds() - startTime) * 1000.0);
+    Stats.TimeToResidencyP50 = TimeToResidencyP50;
+    Stats.TimeToResidencyP90 = TimeToResidencyP90;
+    Stats.TimeToResidencyP99 = TimeToResidencyP99;
 }
 
 void StreamingSystem::Execute(TaskGraph* graph)
 {
     if (Resources.Count() == 0 || GPUDevice::Instance->GetState() != GPUDevice::DeviceState::Ready)
+    {
+        ScopeLock lock(ResourcesLock);
+        Stats = StreamingStats();
+        Stats.ResourcesCount = Resources.Count();
         return;
+    }
 
     // Schedule work to update all storage containers in async
     Function<void(int32)> job;
@@ -268,16 +662,20 @@ void StreamingSystem::Execute(TaskGraph* graph)
     graph->DispatchJob(job, 1);
 }
 
+bool Streaming::IsEnabled()
+{
+    // Dedicated servers don't render nor play audio so skip loading any render-only data
+    if (!Engine::IsHeadless())
+        return true;
+    if (CommandLine::Options.Null.IsTrue())
+        return false;
+    return !GPUDevice::Instance || GPUDevice::Instance->GetRendererType() != RendererType::Null;
+}
+
 StreamingStats Streaming::GetStats()
 {
-    StreamingStats stats;
     ResourcesLock.Lock();
-    stats.ResourcesCount = Resources.Count();
-    for (auto e : Resources)
-    {
-        if (e->Streaming.TargetResidency > e->GetCurrentResidency())
-            stats.StreamingResourcesCount++;
-    }
+    StreamingStats stats = Stats;
     ResourcesLock.Unlock();
     return stats;
 }
@@ -291,6 +689,37 @@ void Streaming::RequestStreamingUpdate()
     ResourcesLock.Unlock();
 }
 
+void Streaming::ReportMaterialScreenSize(MaterialBase* material, const RenderView& view, const Float3& origin, float radius)
+{
+    const float screenRadiusSquared = RenderTools::ComputeBoundsScreenRadiusSquared(origin, radius, view);
+    const float screenSize = 2.0f * Math::Sqrt(screenRadiusSquared) * view.ScreenSize.Y;
+    if (material->StreamingScreenSize < screenSize)
+        material->StreamingScreenSize = screenSize; // Can be slightly off when racing with other threads but it's fine for the feedback
+
+    // Register material once per frame
+    const int64 frame = (int64)Engine::FrameCount;
+    const int64 prevFrame = Platform::AtomicRead(&material->StreamingFrame);
+    if (prevFrame != frame && Platform::InterlockedCompareExchange(&material->StreamingFrame, frame, prevFrame) == prevFrame)
+    {
+        FeedbackLock.Lock();
+        FeedbackMaterials.Add(material->GetID());
+        FeedbackLock.Unlock();
+    }
+}
+
+void Streaming::GetSourcesLocations(Array<Vector3, InlinedAllocation<8>>& result)
+{
+    result.Clear();
+    if (Sources.HasItems())
+    {
+        result.Add(Sources.Get(), Sources.Count());
+        return;
+    }
+    const Camera* camera = Camera::GetMainCamera();
+    if (camera)
+        result.Add(camera->GetPosition());
+}
+
 GPUSampler* Streaming::GetTextureGroupSampler(int32 index)
 {
     GPUSampler* sampler = nullptr;
@@ -3,10 +3,13 @@
 #pragma once
 
 #include "Engine/Core/Collections/Array.h"
+#include "Engine/Core/Math/Vector3.h"
 #include "Engine/Scripting/ScriptingType.h"
 #include "TextureGroup.h"
 
 class GPUSampler;
+class MaterialBase;
+struct RenderView;
 
 // Streaming service statistics container.
 API_STRUCT(NoDefault) struct FLAXENGINE_API StreamingStats
@@ -16,6 +19,36 @@ DECLARE_SCRIPTING_TYPE_MINIMAL(StreamingStats);
     API_FIELD() int32 ResourcesCount = 0;
     // Amount of resources that are during streaming in (target residency is higher that the current). Zero if all resources are streamed in.
     API_FIELD() int32 StreamingResourcesCount = 0;
+    // Amount of resources that have quality lowered due to the streaming memory budget.
+    API_FIELD() int32 BudgetLimitedResourcesCount = 0;
+    // The GPU memory used by the streamed textures (in bytes).
+    API_FIELD() uint64 TexturesMemoryUsage = 0;
+    // The GPU memory budget for the streamed textures (in bytes). Zero if unlimited.
+    API_FIELD() uint64 TexturesMemoryBudget = 0;
+    // Amount of textures that are during streaming in.
+    API_FIELD() int32 StreamingTexturesCount = 0;
+    // Amount of models that are during streaming in.
+    API_FIELD() int32 StreamingModelsCount = 0;
+    // Amount of skinned models that are during streaming in.
+    API_FIELD() int32 StreamingSkinnedModelsCount = 0;
+    // Amount of audio clips that are during streaming in.
+    API_FIELD() int32 StreamingAudioCount = 0;
+    // Amount of resources updated by the streaming during the last frame.
+    API_FIELD() int32 UpdatedResourcesCount = 0;
+    // Amount of resources that started lowering their residency (eg. unloading texture mips) during the last frame.
+    API_FIELD() int32 EvictionsCount = 0;
+    // The estimated amount of data (in bytes) requested to stream in during the last frame (textures only).
+    API_FIELD() uint64 RequestedBytes = 0;
+    // The amount of data (in bytes) uploaded to the GPU by the async tasks during the last frame.
+    API_FIELD() uint64 UploadedBytes = 0;
+    // The time (in milliseconds) spent on the streaming update during the last frame.
+    API_FIELD() float UpdateTimeMs = 0;
+    // The median time (in milliseconds) it took the recently streamed resources to reach their target residency.
+    API_FIELD() float TimeToResidencyP50 = 0;
+    // The 90th percentile of the time (in milliseconds) it took the recently streamed resources to reach their target residency.
+    API_FIELD() float TimeToResidencyP90 = 0;
+    // The 99th percentile of the time (in milliseconds) it took the recently streamed resources to reach their target residency.
+    API_FIELD() float TimeToResidencyP99 = 0;
 };
 
 /// <summary>
@@ -30,6 +63,21 @@ DECLARE_SCRIPTING_TYPE_NO_SPAWN(Streaming);
     /// </summary>
     API_FIELD() static Array<TextureGroup, InlinedAllocation<32>> TextureGroups;
 
+    /// <summary>
+    /// The GPU memory budget (in bytes) for the streamed textures. When exceeded, the least important textures get their quality lowered. Use 0 to disable the limit.
+    /// </summary>
+    API_FIELD() static uint64 TexturesMemoryBudget;
+
+    /// <summary>
+    /// The world-space locations of the streaming sources (eg. players or server-side client positions) used by the distance-based streaming of the world data (eg. terrain collision). If empty, the main camera location is used.
+    /// </summary>
+    API_FIELD() static Array<Vector3> Sources;
+
+    /// <summary>
+    /// Checks if the content streaming is enabled. Disabled on headless servers running with Null renderer (server content profile) that never load render-only data such as texture mips, model LODs or audio samples.
+    /// </summary>
+    API_PROPERTY() static bool IsEnabled();
+
     /// <summary>
     /// Gets streaming statistics.
     /// </summary>
@@ -46,4 +94,20 @@ DECLARE_SCRIPTING_TYPE_NO_SPAWN(Streaming);
     /// <param name="index">The texture group index.</param>
     /// <returns>The texture sampler (always valid).</returns>
     API_FUNCTION() static GPUSampler* GetTextureGroupSampler(int32 index);
+
+public:
+    /// <summary>
+    /// Reports the object drawn with a given material to the textures streaming. Textures used by the material get mip levels selected based on the maximum object size on the screen.
+    /// </summary>
+    /// <param name="material">The material used to draw the object.</param>
+    /// <param name="view">The rendering view.</param>
+    /// <param name="origin">The object bounds center (relative to the view).</param>
+    /// <param name="radius">The object bounds radius.</param>
+    static void ReportMaterialScreenSize(MaterialBase* material, const RenderView& view, const Float3& origin, float radius);
+
+    /// <summary>
+    /// Gets the locations of the streaming sources (the registered sources or the main camera if none).
+    /// </summary>
+    /// <param name="result">The output list with the sources locations (cleared before use).</param>
+    static void GetSourcesLocations(Array<Vector3, InlinedAllocation<8>>& result);
 };
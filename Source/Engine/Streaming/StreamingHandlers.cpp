@@ -11,6 +11,55 @@
 #include "Engine/Audio/Audio.h"
 #include "Engine/Audio/AudioSource.h"
 
+// The scale applied to the objects screen size when selecting texture mips (objects UVs usually cover less than a whole texture)
+#define STREAMING_SCREEN_SIZE_SCALE 2.0f
+
+// The time (in seconds) after which the screen size feedback is ignored if texture is still being rendered (eg. by UI or particles that don't report it)
+#define STREAMING_SCREEN_SIZE_TIMEOUT 1.0
+
+// The scale applied to the models screen size when selecting LODs to stream (loads the more detailed LOD ahead of the camera getting closer)
+#define STREAMING_MODEL_SCREEN_SIZE_SCALE 1.5f
+
+// The time (in seconds) after which model that is not drawn streams out the detailed LODs
+#define STREAMING_MODEL_TIME_TO_INVISIBLE 10.0
+
+namespace
+{
+    template<typename LODsType>
+    float CalculateModelTargetQuality(StreamableResource* resource, const LODsType& lods, double currentTime)
+    {
+        const int32 lodCount = lods.Count();
+        if (lodCount <= 1)
+            return 1.0f;
+        auto& streaming = resource->Streaming;
+
+        // Use the maximum screen size observed during LOD selection since the last update (see RenderTools::ComputeModelLOD)
+        const float screenSize = streaming.ScreenSize;
+        streaming.ScreenSize = 0.0f;
+        if (screenSize <= 0.0f)
+        {
+            // Keep quality for a while after model is not drawn, then leave only the lowest LOD
+            if (streaming.ScreenSizeTime >= 0 && currentTime - streaming.ScreenSizeTime < STREAMING_MODEL_TIME_TO_INVISIBLE && streaming.QualitySamples.HasItems())
+                return streaming.QualitySamples.Last();
+            return 1.0f / (float)lodCount;
+        }
+        streaming.ScreenSizeTime = currentTime;
+
+        // Pick the LOD like during drawing but for the bigger screen size
+        const float prefetchScreenSize = screenSize * STREAMING_MODEL_SCREEN_SIZE_SCALE;
+        int32 lodIndex = 0;
+        for (int32 i = lodCount - 1; i >= 0; i--)
+        {
+            if (lods[i].ScreenSize >= prefetchScreenSize)
+            {
+                lodIndex = i;
+                break;
+            }
+        }
+        return (float)(lodCount - lodIndex) / (float)lodCount;
+    }
+}
+
 float TexturesStreamingHandler::CalculateTargetQuality(StreamableResource* resource, double currentTime)
 {
     ASSERT(resource);
@@ -29,6 +78,18 @@ float TexturesStreamingHandler::CalculateTargetQuality(StreamableResource* resou
         {
             result *= group.QualityIfInvisible;
         }
+        else if (group.UseScreenSize && texture.Streaming.ScreenSizeTime >= 0 && texture.Streaming.ScreenSizeTime + STREAMING_SCREEN_SIZE_TIMEOUT >= lastRenderTime)
+        {
+            // Skip mips bigger than the objects using this texture on the screen
+            const float textureSize = (float)Math::Max(texture.TotalWidth(), texture.TotalHeight());
+            const float requiredSize = Math::Max(texture.Streaming.ScreenSize * STREAMING_SCREEN_SIZE_SCALE, 1.0f);
+            if (requiredSize < textureSize)
+            {
+                const int32 totalMipLevels = texture.TotalMipLevels();
+                const int32 skippedMips = Math::Min((int32)Math::Log2(textureSize / requiredSize), totalMipLevels - 1);
+                result = Math::Min(result, (float)(totalMipLevels - skippedMips) / (float)totalMipLevels);
+            }
+        }
     }
     return result;
 }
@@ -95,8 +156,9 @@ int32 TexturesStreamingHandler::CalculateRequestedResidency(StreamableResource*
 
 float ModelsStreamingHandler::CalculateTargetQuality(StreamableResource* resource, double currentTime)
 {
-    // TODO: calculate a proper quality levels for models based on render time and streaming enable/disable options
-    return 1.0f;
+    ASSERT(resource);
+    auto& model = *(Model*)resource;
+    return CalculateModelTargetQuality(resource, model.LODs, currentTime);
 }
 
 int32 ModelsStreamingHandler::CalculateResidency(StreamableResource* resource, float quality)
@@ -106,7 +168,7 @@ int32 ModelsStreamingHandler::CalculateResidency(StreamableResource* resource, f
     ASSERT(resource);
     const auto& model = *(Model*)resource;
     const int32 lodCount = model.GetLODsCount();
-    const int32 lods = Math::CeilToInt(quality * (float)lodCount);
+    const int32 lods = Math::CeilToInt(quality * (float)lodCount - ZeroTolerance);
     return lods;
 }
 
@@ -134,8 +196,9 @@ int32 ModelsStreamingHandler::CalculateRequestedResidency(StreamableResource* re
 
 float SkinnedModelsStreamingHandler::CalculateTargetQuality(StreamableResource* resource, double currentTime)
 {
-    // TODO: calculate a proper quality levels for models based on render time and streaming enable/disable options
-    return 1.0f;
+    ASSERT(resource);
+    auto& model = *(SkinnedModel*)resource;
+    return CalculateModelTargetQuality(resource, model.LODs, currentTime);
 }
 
 int32 SkinnedModelsStreamingHandler::CalculateResidency(StreamableResource* resource, float quality)
@@ -145,7 +208,7 @@ int32 SkinnedModelsStreamingHandler::CalculateResidency(StreamableResource* reso
     ASSERT(resource);
     const auto& model = *(SkinnedModel*)resource;
     const int32 lodCount = model.GetLODsCount();
-    const int32 lods = Math::CeilToInt(quality * (float)lodCount);
+    const int32 lods = Math::CeilToInt(quality * (float)lodCount - ZeroTolerance);
     return lods;
 }
 
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "Engine/Core/Config/Settings.h"
+#include "Engine/Core/Collections/Dictionary.h"
 #include "TextureGroup.h"
 
 /// <summary>
@@ -13,6 +14,42 @@ API_CLASS(sealed, Namespace="FlaxEditor.Content.Settings", NoConstructor) class
 DECLARE_SCRIPTING_TYPE_MINIMAL(StreamingSettings);
 public:
 
+    /// <summary>
+    /// The minimum time (in seconds) between the streaming updates of a single resource. Resources that requested the update, are far from their target quality or are visible on the screen get updated first.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(0), Limit(0.01f, 10, 0.01f), EditorDisplay(\"Scheduling\")")
+    float ResourceUpdatesInterval = 0.1f;
+
+    /// <summary>
+    /// The maximum amount of resources updated by the streaming per frame (the most important ones first).
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(1), Limit(1), EditorDisplay(\"Scheduling\")")
+    int32 MaxResourceUpdatesPerFrame = 50;
+
+    /// <summary>
+    /// The maximum amount of streaming tasks (data loading to increase the resource quality) started per frame. Can be used to limit the I/O usage and upload spikes. Use 0 to disable the limit.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(2), Limit(0), EditorDisplay(\"Scheduling\")")
+    int32 MaxStreamingTasksPerFrame = 0;
+
+    /// <summary>
+    /// The maximum amount of data (in megabytes) uploaded to the GPU per frame (eg. streamed texture mips or mesh buffers). Spreads big uploads over frames to reduce hitches. Use 0 to disable the limit.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(3), Limit(0), EditorDisplay(\"Scheduling\")")
+    int32 MaxUploadSizePerFrame = 64;
+
+    /// <summary>
+    /// The GPU memory budget (in megabytes) for the streamed textures. When exceeded, the least important textures (not rendered for the longest time) get their quality lowered. Use 0 to disable the limit.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(10), Limit(0), EditorDisplay(\"Budget\")")
+    int32 TexturesMemoryBudget = 0;
+
+    /// <summary>
+    /// The per-platform GPU memory budget (in megabytes) for the streamed textures. Overrides the TexturesMemoryBudget on a given platform.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(20), EditorDisplay(\"Budget\")")
+    Dictionary<PlatformType, int32> TexturesMemoryBudgetPerPlatform;
+
     /// <summary>
     /// Textures streaming configuration (per-group).
     /// </summary>
@@ -53,6 +53,12 @@ DECLARE_SCRIPTING_TYPE_MINIMAL(TextureGroup);
     API_FIELD(Attributes="EditorOrder(26), Limit(0)")
     float TimeToInvisible = 20.0f;
 
+    /// <summary>
+    /// Enables selecting the loaded mip levels based on the size of the objects using textures from this group on the screen. Textures used only by small or distant objects keep less mips loaded. Disable it for textures with high UV tiling (eg. detail maps).
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(27)")
+    bool UseScreenSize = true;
+
     /// <summary>
     /// The minimum amount of loaded mip levels for textures in this group. Defines the amount of the mips that should be always loaded. Higher values decrease streaming usage and keep more mips loaded.
     /// </summary>
@@ -71,6 +77,12 @@ DECLARE_SCRIPTING_TYPE_MINIMAL(TextureGroup);
     API_FIELD(Attributes="EditorOrder(50), Limit(-14, 14)")
     int32 MipLevelsBias = 0;
 
+    /// <summary>
+    /// The GPU memory quota (in megabytes) for textures in this group. When exceeded, the least important textures of this group (not rendered for the longest time) get their quality lowered. Use 0 to disable the limit.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(55), Limit(0)")
+    int32 MemoryBudget = 0;
+
 #if USE_EDITOR
     /// <summary>
     /// The per-platform maximum amount of mip levels for textures in this group. Can be used to strip textures quality when cooking the game for a target platform.
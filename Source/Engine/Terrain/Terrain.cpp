@@ -4,6 +4,7 @@
 #include "TerrainPatch.h"
 #include "Engine/Core/Log.h"
 #include "Engine/Core/Math/Ray.h"
+#include "Engine/Core/Math/CollisionsHelper.h"
 #include "Engine/Level/Scene/SceneRendering.h"
 #include "Engine/Serialization/Serialization.h"
 #include "Engine/Physics/Physics.h"
@@ -17,6 +18,13 @@
 #include "Engine/Profiler/ProfilerCPU.h"
 #include "Engine/Renderer/GlobalSignDistanceFieldPass.h"
 #include "Engine/Renderer/GI/GlobalSurfaceAtlasPass.h"
+#include "Engine/Streaming/Streaming.h"
+
+// Scale of the collision streaming distance at which patches release the collision (prevents recreating it when moving around the streaming distance)
+#define TERRAIN_COLLISION_STREAMING_RELEASE_SCALE 1.2f
+
+// The maximum amount of patches with collision created on job threads at once
+#define TERRAIN_COLLISION_STREAMING_MAX_TASKS 4
 
 Terrain::Terrain(const SpawnParams& params)
     : PhysicsColliderActor(params)
@@ -27,6 +35,8 @@ Terrain::Terrain(const SpawnParams& params)
     , _chunkSize(0)
     , _scaleInLightmap(0.1f)
     , _lodDistribution(0.6f)
+    , _materialCacheDistance(0.0f)
+    , _collisionStreamingDistance(0.0f)
     , _boundsExtent(Vector3::Zero)
     , _cachedScale(1.0f)
 {
@@ -286,6 +296,26 @@ void Terrain::SetCollisionLOD(int32 value)
 #endif
 }
 
+void Terrain::SetCollisionStreamingDistance(float value)
+{
+    value = Math::Max(value, 0.0f);
+    if (Math::NearEqual(value, _collisionStreamingDistance))
+        return;
+    _collisionStreamingDistance = value;
+
+    if (value <= 0.0f && IsDuringPlay())
+    {
+        // Streaming disabled so create collision for all patches
+        for (int32 pathIndex = 0; pathIndex < _patches.Count(); pathIndex++)
+        {
+            const auto patch = _patches[pathIndex];
+            patch->CancelCollisionStreaming();
+            if (!patch->HasCollision())
+                patch->CreateCollision();
+        }
+    }
+}
+
 void Terrain::SetPhysicalMaterials(const Array<JsonAssetReference<PhysicalMaterial>, FixedAllocation<8>>& value)
 {
     _physicalMaterials = value;
@@ -509,6 +539,93 @@ void Terrain::RemovePatch(const Int2& patchCoord)
 
 #endif
 
+void Terrain::Update()
+{
+#if TERRAIN_EDITING
+    FlushHeightData();
+#endif
+    UpdateCollisionStreaming();
+}
+
+#if TERRAIN_EDITING
+
+void Terrain::FlushHeightData()
+{
+    // Apply the heightmap modifications done during the frame (batched per patch)
+    for (int32 pathIndex = 0; pathIndex < _patches.Count(); pathIndex++)
+        _patches[pathIndex]->FlushHeightData();
+}
+
+#endif
+
+void Terrain::UpdateCollisionStreaming()
+{
+    if (_collisionStreamingDistance <= 0.0f)
+        return;
+    PROFILE_CPU();
+    Array<Vector3, InlinedAllocation<8>> sources;
+    Streaming::GetSourcesLocations(sources);
+    if (sources.IsEmpty())
+        return;
+
+    // Finalize patches with height fields created on job threads
+    int32 tasksCount = 0;
+    for (int32 pathIndex = 0; pathIndex < _patches.Count(); pathIndex++)
+    {
+        const auto patch = _patches[pathIndex];
+        if (patch->IsCollisionStreaming())
+        {
+            patch->FinishCollisionStreaming();
+            if (patch->IsCollisionStreaming())
+                tasksCount++;
+        }
+    }
+
+    // Create collision for patches near the streaming sources and release it for patches far away
+    const Real loadDistance = (Real)_collisionStreamingDistance;
+    const Real releaseDistance = loadDistance * TERRAIN_COLLISION_STREAMING_RELEASE_SCALE;
+    for (int32 pathIndex = 0; pathIndex < _patches.Count(); pathIndex++)
+    {
+        const auto patch = _patches[pathIndex];
+        if (patch->IsCollisionStreaming())
+            continue;
+        Real distance = MAX_Real;
+        for (const Vector3& source : sources)
+            distance = Math::Min(distance, CollisionsHelper::DistanceBoxPoint(patch->_bounds, source));
+        if (distance <= loadDistance)
+        {
+            if (!patch->HasCollision() && tasksCount < TERRAIN_COLLISION_STREAMING_MAX_TASKS)
+            {
+                patch->StartCollisionStreaming();
+                if (patch->IsCollisionStreaming())
+                    tasksCount++;
+            }
+        }
+        else if (distance > releaseDistance)
+        {
+            if (patch->HasCollision())
+                patch->DestroyCollision();
+#if TERRAIN_UPDATING
+            // Release CPU data caches (unless modified and not saved yet)
+            bool wasSplatmapModified = false;
+            bool hasSplatmapCache = false;
+            for (int32 i = 0; i < TERRAIN_MAX_SPLATMAPS_COUNT; i++)
+            {
+                wasSplatmapModified |= patch->_wasSplatmapModified[i];
+                hasSplatmapCache |= patch->_cachedSplatMap[i].HasItems();
+            }
+            if (!patch->_wasHeightModified && (patch->_cachedHeightMap.HasItems() || patch->_cachedHolesMask.HasItems()))
+            {
+                patch->ClearHeightmapCache();
+                patch->ClearHolesMaskCache();
+            }
+            if (!wasSplatmapModified && hasSplatmapCache)
+                patch->ClearSplatMapCache();
+#endif
+        }
+    }
+}
+
 void Terrain::Draw(RenderContext& renderContext)
 {
     const DrawPass drawModes = DrawModes & renderContext.View.Pass;
@@ -560,7 +677,9 @@ void Terrain::Draw(RenderContext& renderContext)
     }
 
     // Collect chunks to render and calculate LOD/material for them (required to be done before to gather NeighborLOD)
+    // Chunks that are not prepared within this draw (eg. from culled patches) are detected by the draw index so invisible parts of the terrain are not iterated
     _drawChunks.Clear();
+    _drawIndex++;
 
     // Frustum vs Box culling for patches
     const BoundingFrustum frustum = renderContext.View.CullingFrustum;
@@ -569,35 +688,28 @@ void Terrain::Draw(RenderContext& renderContext)
     {
         const auto patch = _patches[patchIndex];
         BoundingBox bounds(patch->_bounds.Minimum - origin, patch->_bounds.Maximum - origin);
-        if (renderContext.View.IsCullingDisabled || frustum.Intersects(bounds))
-        {
-            // Skip if has no heightmap or it's not loaded
-            if (patch->Heightmap == nullptr || patch->Heightmap->GetTexture()->ResidentMipLevels() == 0)
-                continue;
+        const ContainmentType patchContainment = renderContext.View.IsCullingDisabled ? ContainmentType::Contains : frustum.Contains(bounds);
+        if (patchContainment == ContainmentType::Disjoint)
+            continue;
 
-            // Frustum vs Box culling for chunks
-            for (int32 chunkIndex = 0; chunkIndex < Terrain::ChunksCount; chunkIndex++)
+        // Skip if has no heightmap or it's not loaded
+        if (patch->Heightmap == nullptr || patch->Heightmap->GetTexture()->ResidentMipLevels() == 0)
+            continue;
+
+        // Frustum vs Box culling for chunks (skipped if the whole patch is visible)
+        for (int32 chunkIndex = 0; chunkIndex < Terrain::ChunksCount; chunkIndex++)
+        {
+            auto chunk = &patch->Chunks[chunkIndex];
+            if (patchContainment != ContainmentType::Contains)
             {
-                auto chunk = &patch->Chunks[chunkIndex];
-                chunk->_cachedDrawLOD = 0;
                 bounds = BoundingBox(chunk->_bounds.Minimum - origin, chunk->_bounds.Maximum - origin);
-                if (renderContext.View.IsCullingDisabled || frustum.Intersects(bounds))
-                {
-                    if (chunk->PrepareDraw(renderContext))
-                    {
-                        // Add chunk for drawing
-                        _drawChunks.Add(chunk);
-                    }
-                }
+                if (!frustum.Intersects(bounds))
+                    continue;
             }
-        }
-        else
-        {
-            // Reset cached LOD for chunks (prevent LOD transition from invisible chunks)
-            for (int32 chunkIndex = 0; chunkIndex < Terrain::ChunksCount; chunkIndex++)
+            if (chunk->PrepareDraw(renderContext))
             {
-                auto chunk = &patch->Chunks[chunkIndex];
-                chunk->_cachedDrawLOD = 0;
+                // Add chunk for drawing
+                _drawChunks.Add(chunk);
             }
         }
     }
@@ -670,9 +782,11 @@ void Terrain::Serialize(SerializeStream& stream, const void* otherObj)
     SERIALIZE_MEMBER(LODBias, _lodBias);
     SERIALIZE_MEMBER(ForcedLOD, _forcedLod);
     SERIALIZE_MEMBER(LODDistribution, _lodDistribution);
+    SERIALIZE_MEMBER(MaterialCacheDistance, _materialCacheDistance);
     SERIALIZE_MEMBER(ScaleInLightmap, _scaleInLightmap);
     SERIALIZE_MEMBER(BoundsExtent, _boundsExtent);
     SERIALIZE_MEMBER(CollisionLOD, _collisionLod);
+    SERIALIZE_MEMBER(CollisionStreamingDistance, _collisionStreamingDistance);
     SERIALIZE_MEMBER(PhysicalMaterials, _physicalMaterials);
     SERIALIZE(Material);
     SERIALIZE(DrawModes);
@@ -718,9 +832,11 @@ void Terrain::Deserialize(DeserializeStream& stream, ISerializeModifier* modifie
     }
 
     DESERIALIZE_MEMBER(LODDistribution, _lodDistribution);
+    DESERIALIZE_MEMBER(MaterialCacheDistance, _materialCacheDistance);
     DESERIALIZE_MEMBER(ScaleInLightmap, _scaleInLightmap);
     DESERIALIZE_MEMBER(BoundsExtent, _boundsExtent);
     DESERIALIZE_MEMBER(PhysicalMaterials, _physicalMaterials);
+    DESERIALIZE_MEMBER(CollisionStreamingDistance, _collisionStreamingDistance);
     DESERIALIZE(Material);
     DESERIALIZE(DrawModes);
 
@@ -806,6 +922,10 @@ RigidBody* Terrain::GetAttachedRigidBody() const
 void Terrain::OnEnable()
 {
     GetScene()->Navigation.Actors.Add(this);
+    GetScene()->Ticking.Update.AddTick<Terrain, &Terrain::Update>(this);
+#if USE_EDITOR && TERRAIN_EDITING
+    GetScene()->Ticking.Update.AddTickExecuteInEditor<Terrain, &Terrain::FlushHeightData>(this);
+#endif
     GetSceneRendering()->AddActor(this, _sceneRenderingKey);
 #if TERRAIN_USE_PHYSICS_DEBUG
     GetSceneRendering()->AddPhysicsDebug<Terrain, &Terrain::DrawPhysicsDebug>(this);
@@ -827,6 +947,10 @@ void Terrain::OnEnable()
 void Terrain::OnDisable()
 {
     GetScene()->Navigation.Actors.Remove(this);
+    GetScene()->Ticking.Update.RemoveTick(this);
+#if USE_EDITOR && TERRAIN_EDITING
+    GetScene()->Ticking.Update.RemoveTickExecuteInEditor(this);
+#endif
     GetSceneRendering()->RemoveActor(this, _sceneRenderingKey);
 #if TERRAIN_USE_PHYSICS_DEBUG
     GetSceneRendering()->RemovePhysicsDebug<Terrain, &Terrain::DrawPhysicsDebug>(this);
@@ -902,7 +1026,7 @@ void Terrain::BeginPlay(SceneBeginData* data)
     for (int32 pathIndex = 0; pathIndex < _patches.Count(); pathIndex++)
     {
         const auto patch = _patches[pathIndex];
-        if (!patch->HasCollision())
+        if (!patch->HasCollision() && _collisionStreamingDistance <= 0.0f)
         {
             patch->CreateCollision();
         }
@@ -918,6 +1042,7 @@ void Terrain::EndPlay()
     for (int32 pathIndex = 0; pathIndex < _patches.Count(); pathIndex++)
     {
         const auto patch = _patches[pathIndex];
+        patch->CancelCollisionStreaming();
         if (patch->HasCollision())
         {
             patch->DestroyCollision();
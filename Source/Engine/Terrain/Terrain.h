@@ -67,8 +67,11 @@ API_CLASS(Sealed) class FLAXENGINE_API Terrain : public PhysicsColliderActor
     byte _lodCount;
     uint16 _chunkSize;
     int32 _sceneRenderingKey = -1;
+    uint32 _drawIndex = 0;
     float _scaleInLightmap;
     float _lodDistribution;
+    float _materialCacheDistance;
+    float _collisionStreamingDistance;
     Vector3 _boundsExtent;
     Float3 _cachedScale;
     Array<TerrainPatch*, InlinedAllocation<64>> _patches;
@@ -143,6 +146,23 @@ API_CLASS(Sealed) class FLAXENGINE_API Terrain : public PhysicsColliderActor
     /// </summary>
     API_PROPERTY() void SetLODDistribution(float value);
 
+    /// <summary>
+    /// Gets the distance from the view at which terrain chunks start to use the cached (pre-rendered) material properties instead of evaluating the terrain material with all its layers. Reduces the shading cost of the distant terrain. Works only with opaque, lit materials without emission and position offset. Value 0 disables this feature.
+    /// </summary>
+    API_PROPERTY(Attributes="EditorOrder(80), DefaultValue(0.0f), Limit(0), EditorDisplay(\"Terrain\")")
+    FORCE_INLINE float GetMaterialCacheDistance() const
+    {
+        return _materialCacheDistance;
+    }
+
+    /// <summary>
+    /// Sets the distance from the view at which terrain chunks start to use the cached (pre-rendered) material properties instead of evaluating the terrain material with all its layers. Reduces the shading cost of the distant terrain. Works only with opaque, lit materials without emission and position offset. Value 0 disables this feature.
+    /// </summary>
+    API_PROPERTY() void SetMaterialCacheDistance(float value)
+    {
+        _materialCacheDistance = Math::Max(value, 0.0f);
+    }
+
     /// <summary>
     /// Gets the terrain scale in lightmap (applied to all the chunks). Use value higher than 1 to increase baked lighting resolution.
     /// </summary>
@@ -200,6 +220,20 @@ API_CLASS(Sealed) class FLAXENGINE_API Terrain : public PhysicsColliderActor
     API_PROPERTY()
     void SetPhysicalMaterials(const Array<JsonAssetReference<PhysicalMaterial>, FixedAllocation<8>>& value);
 
+    /// <summary>
+    /// Gets the distance from the streaming sources (see Streaming.Sources) within which the terrain patches have collision and CPU data caches created. Patches further away release them to reduce memory usage. Use 0 to disable streaming and keep collision for all patches.
+    /// </summary>
+    API_PROPERTY(Attributes="EditorOrder(530), DefaultValue(0.0f), Limit(0), EditorDisplay(\"Collision\")")
+    FORCE_INLINE float GetCollisionStreamingDistance() const
+    {
+        return _collisionStreamingDistance;
+    }
+
+    /// <summary>
+    /// Sets the distance from the streaming sources (see Streaming.Sources) within which the terrain patches have collision and CPU data caches created. Patches further away release them to reduce memory usage. Use 0 to disable streaming and keep collision for all patches.
+    /// </summary>
+    API_PROPERTY() void SetCollisionStreamingDistance(float value);
+
     /// <summary>
     /// Gets the terrain Level Of Detail count.
     /// </summary>
@@ -424,6 +458,11 @@ API_CLASS(Sealed) class FLAXENGINE_API Terrain : public PhysicsColliderActor
 #if TERRAIN_USE_PHYSICS_DEBUG
     void DrawPhysicsDebug(RenderView& view);
 #endif
+    void Update();
+    void UpdateCollisionStreaming();
+#if TERRAIN_EDITING
+    void FlushHeightData();
+#endif
 
 public:
     // [PhysicsColliderActor]
@@ -5,6 +5,7 @@
 #include "TerrainPatch.h"
 #include "Terrain.h"
 #include "TerrainManager.h"
+#include "TerrainMaterialCache.h"
 #include "Engine/Graphics/RenderView.h"
 #include "Engine/Graphics/RenderTask.h"
 #include "Engine/Graphics/Textures/GPUTexture.h"
@@ -28,6 +29,8 @@ void TerrainChunk::Init(TerrainPatch* patch, uint16 x, uint16 z)
     _z = z;
     _yOffset = 0;
     _yHeight = 1;
+    _cachedDrawPage = -1;
+    _cachedDrawIndex = 0;
     _heightmapUVScaleBias = Float4(1.0f, 1.0f, _x, _z) * (1.0f / Terrain::ChunksCountEdge);
     _perInstanceRandom = (_patch->_terrain->_id.C ^ _x ^ _z) * (1.0f / (float)MAX_uint32);
     OverrideMaterial = nullptr;
@@ -40,6 +43,10 @@ bool TerrainChunk::PrepareDraw(const RenderContext& renderContext)
     const int32 forcedLod = _patch->_terrain->_forcedLod;
     const int32 lodCount = _patch->Heightmap.Get()->StreamingTexture()->TotalMipLevels();
     const int32 minStreamedLod = lodCount - _patch->Heightmap.Get()->GetTexture()->ResidentMipLevels();
+
+    // Calculate chunk distance to view
+    const auto lodView = (renderContext.LodProxyView ? renderContext.LodProxyView : &renderContext.View);
+    const float distance = Float3::Distance(_sphere.Center - lodView->Origin, lodView->Position);
     if (forcedLod >= 0)
     {
         lod = forcedLod;
@@ -49,10 +56,6 @@ bool TerrainChunk::PrepareDraw(const RenderContext& renderContext)
         const int32 lodBias = _patch->_terrain->_lodBias;
         const float lodDistribution = _patch->_terrain->_lodDistribution;
         const float chunkEdgeSize = (_patch->_terrain->_chunkSize * TERRAIN_UNITS_PER_VERTEX);
-
-        // Calculate chunk distance to view
-        const auto lodView = (renderContext.LodProxyView ? renderContext.LodProxyView : &renderContext.View);
-        const float distance = Float3::Distance(_sphere.Center - lodView->Origin, lodView->Position);
         lod = (int32)Math::Pow(distance / chunkEdgeSize, lodDistribution);
         lod += lodBias;
 
@@ -75,12 +78,26 @@ bool TerrainChunk::PrepareDraw(const RenderContext& renderContext)
     if (!material || !material->IsReady() || !material->IsTerrain())
         return false;
 
+    // Use the pre-rendered material properties for distant chunks
+    int32 page = -1;
+    const float materialCacheDistance = _patch->_terrain->_materialCacheDistance;
+    if (materialCacheDistance > 0.0f && distance >= materialCacheDistance && EnumHasAnyFlags(renderContext.View.Pass, DrawPass::GBuffer) && TerrainMaterialCache::CanUseMaterial(material))
+        page = TerrainMaterialCache::RequestPage(this, material);
+
     // Cache data
+    _cachedDrawIndex = _patch->_terrain->_drawIndex;
     _cachedDrawLOD = lod;
+    _cachedDrawPage = (int16)page;
     _cachedDrawMaterial = material;
     return true;
 }
 
+int32 TerrainChunk::GetDrawLOD() const
+{
+    // Chunks not prepared within the current terrain draw (culled or not ready) use the highest quality LOD to prevent LOD transition from invisible chunks
+    return _cachedDrawIndex == _patch->_terrain->_drawIndex ? _cachedDrawLOD : 0;
+}
+
 void TerrainChunk::Draw(const RenderContext& renderContext) const
 {
     const int32 lod = _cachedDrawLOD;
@@ -104,11 +121,12 @@ void TerrainChunk::Draw(const RenderContext& renderContext) const
     drawCall.Terrain.CurrentLOD = (float)lod;
     drawCall.Terrain.ChunkSizeNextLOD = (float)(((chunkSize + 1) >> (lod + 1)) - 1);
     drawCall.Terrain.TerrainChunkSizeLOD0 = TERRAIN_UNITS_PER_VERTEX * chunkSize;
+    drawCall.Terrain.CachePage = _cachedDrawPage;
     // TODO: try using SIMD clamping for 4 chunks at once
-    drawCall.Terrain.NeighborLOD.X = (float)Math::Clamp<int32>(_neighbors[0]->_cachedDrawLOD, lod, minLod);
-    drawCall.Terrain.NeighborLOD.Y = (float)Math::Clamp<int32>(_neighbors[1]->_cachedDrawLOD, lod, minLod);
-    drawCall.Terrain.NeighborLOD.Z = (float)Math::Clamp<int32>(_neighbors[2]->_cachedDrawLOD, lod, minLod);
-    drawCall.Terrain.NeighborLOD.W = (float)Math::Clamp<int32>(_neighbors[3]->_cachedDrawLOD, lod, minLod);
+    drawCall.Terrain.NeighborLOD.X = (float)Math::Clamp<int32>(_neighbors[0]->GetDrawLOD(), lod, minLod);
+    drawCall.Terrain.NeighborLOD.Y = (float)Math::Clamp<int32>(_neighbors[1]->GetDrawLOD(), lod, minLod);
+    drawCall.Terrain.NeighborLOD.Z = (float)Math::Clamp<int32>(_neighbors[2]->GetDrawLOD(), lod, minLod);
+    drawCall.Terrain.NeighborLOD.W = (float)Math::Clamp<int32>(_neighbors[3]->GetDrawLOD(), lod, minLod);
     const auto scene = _patch->_terrain->GetScene();
     const auto flags = _patch->_terrain->_staticFlags;
     if ((flags & StaticFlags::Lightmap) != StaticFlags::None && scene)
@@ -162,6 +180,7 @@ void TerrainChunk::Draw(const RenderContext& renderContext, MaterialBase* materi
     drawCall.Terrain.CurrentLOD = (float)lod;
     drawCall.Terrain.ChunkSizeNextLOD = (float)(((chunkSize + 1) >> (lod + 1)) - 1);
     drawCall.Terrain.TerrainChunkSizeLOD0 = TERRAIN_UNITS_PER_VERTEX * chunkSize;
+    drawCall.Terrain.CachePage = -1;
     drawCall.Terrain.NeighborLOD.X = (float)lod;
     drawCall.Terrain.NeighborLOD.Y = (float)lod;
     drawCall.Terrain.NeighborLOD.Z = (float)lod;
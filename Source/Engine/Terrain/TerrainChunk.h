@@ -23,6 +23,7 @@ API_CLASS(Sealed, NoSpawn) class FLAXENGINE_API TerrainChunk : public ScriptingO
     friend Terrain;
     friend TerrainPatch;
     friend TerrainChunk;
+    friend class TerrainMaterialCache;
 
 private:
     TerrainPatch* _patch;
@@ -36,6 +37,8 @@ API_CLASS(Sealed, NoSpawn) class FLAXENGINE_API TerrainChunk : public ScriptingO
 
     TerrainChunk* _neighbors[4];
     byte _cachedDrawLOD;
+    int16 _cachedDrawPage;
+    uint32 _cachedDrawIndex;
     IMaterial* _cachedDrawMaterial;
 
     void Init(TerrainPatch* patch, uint16 x, uint16 z);
@@ -124,6 +127,11 @@ API_CLASS(Sealed, NoSpawn) class FLAXENGINE_API TerrainChunk : public ScriptingO
     /// <returns>True if draw chunk, otherwise false.</returns>
     bool PrepareDraw(const RenderContext& renderContext);
 
+    /// <summary>
+    /// Gets the LOD cached by PrepareDraw within the current terrain draw (returns 0 if chunk was not prepared for drawing).
+    /// </summary>
+    int32 GetDrawLOD() const;
+
     /// <summary>
     /// Draws the chunk (adds the draw call). Must be called after PrepareDraw.
     /// </summary>
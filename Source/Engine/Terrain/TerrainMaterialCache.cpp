@@ -0,0 +1,274 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "TerrainMaterialCache.h"
+#include "Terrain.h"
+#include "TerrainPatch.h"
+#include "TerrainChunk.h"
+#include "Engine/Core/Log.h"
+#include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Engine/Engine.h"
+#include "Engine/Engine/EngineService.h"
+#include "Engine/Graphics/GPUContext.h"
+#include "Engine/Graphics/GPUDevice.h"
+#include "Engine/Graphics/RenderBuffers.h"
+#include "Engine/Graphics/RenderTargetPool.h"
+#include "Engine/Graphics/RenderTask.h"
+#include "Engine/Graphics/Textures/GPUTexture.h"
+#include "Engine/Profiler/Profiler.h"
+#include "Engine/Renderer/RenderList.h"
+#include "Engine/Threading/Threading.h"
+
+// The resolution of the single cache page (one page covers a single terrain chunk)
+#define TERRAIN_MATERIAL_CACHE_PAGE_SIZE 256
+
+// The amount of cache pages (GPU memory usage is 3 * 4 bytes per page texel)
+#define TERRAIN_MATERIAL_CACHE_PAGES_COUNT 64
+
+// The maximum amount of pages rendered in a single frame
+#define TERRAIN_MATERIAL_CACHE_MAX_PAGES_PER_FRAME 4
+
+namespace
+{
+    struct CachePage
+    {
+        TerrainChunk* Chunk = nullptr;
+        MaterialBase* Material = nullptr;
+        uint64 LastUsedFrame = 0;
+        bool Ready = false;
+    };
+
+    CriticalSection Locker;
+    CachePage Pages[TERRAIN_MATERIAL_CACHE_PAGES_COUNT];
+    Dictionary<TerrainChunk*, int32> Lookup;
+    Array<int32> PendingPages;
+    GPUTexture* PagesTextures[3] = {};
+    bool PagesTexturesFailed = false;
+
+    void FreePage(int32 pageIndex)
+    {
+        CachePage& page = Pages[pageIndex];
+        if (page.Chunk)
+            Lookup.Remove(page.Chunk);
+        page = CachePage();
+    }
+}
+
+class TerrainMaterialCacheService : public EngineService
+{
+public:
+    TerrainMaterialCacheService()
+        : EngineService(TEXT("Terrain Material Cache"), 41)
+    {
+    }
+
+    void BeforeExit() override
+    {
+        ScopeLock lock(Locker);
+        for (int32 i = 0; i < TERRAIN_MATERIAL_CACHE_PAGES_COUNT; i++)
+            Pages[i] = CachePage();
+        Lookup.Clear();
+        PendingPages.Clear();
+        for (GPUTexture*& texture : PagesTextures)
+            SAFE_DELETE_GPU_RESOURCE(texture);
+    }
+};
+
+TerrainMaterialCacheService TerrainMaterialCacheServiceInstance;
+
+bool TerrainMaterialCache::CanUseMaterial(MaterialBase* material)
+{
+    const MaterialInfo& info = material->GetInfo();
+    return info.BlendMode == MaterialBlendMode::Opaque &&
+            info.ShadingModel == MaterialShadingModel::Lit &&
+            !EnumHasAnyFlags(info.UsageFlags, MaterialUsageFlags::UseEmissive | MaterialUsageFlags::UsePositionOffset) &&
+            !PagesTexturesFailed;
+}
+
+int32 TerrainMaterialCache::RequestPage(TerrainChunk* chunk, MaterialBase* material)
+{
+    ScopeLock lock(Locker);
+    const uint64 frame = Engine::FrameCount;
+    int32 pageIndex;
+    if (Lookup.TryGet(chunk, pageIndex))
+    {
+        CachePage& page = Pages[pageIndex];
+        page.LastUsedFrame = frame;
+        if (page.Material == material)
+            return page.Ready ? pageIndex : -1;
+
+        // Material has been changed so render the page again
+        page.Material = material;
+        page.Ready = false;
+        PendingPages.AddUnique(pageIndex);
+        return -1;
+    }
+
+    // Find a free page or evict the least recently used one (skip pages used during the last frame to prevent thrashing)
+    pageIndex = -1;
+    uint64 oldestFrame = frame > 0 ? frame - 1 : 0;
+    for (int32 i = 0; i < TERRAIN_MATERIAL_CACHE_PAGES_COUNT; i++)
+    {
+        const CachePage& page = Pages[i];
+        if (page.Chunk == nullptr)
+        {
+            pageIndex = i;
+            break;
+        }
+        if (page.LastUsedFrame < oldestFrame)
+        {
+            oldestFrame = page.LastUsedFrame;
+            pageIndex = i;
+        }
+    }
+    if (pageIndex == -1)
+        return -1;
+    FreePage(pageIndex);
+    CachePage& page = Pages[pageIndex];
+    page.Chunk = chunk;
+    page.Material = material;
+    page.LastUsedFrame = frame;
+    Lookup.Add(chunk, pageIndex);
+    PendingPages.AddUnique(pageIndex);
+    return -1;
+}
+
+void TerrainMaterialCache::Invalidate(const TerrainPatch* patch)
+{
+    ScopeLock lock(Locker);
+    if (Lookup.IsEmpty())
+        return;
+    for (int32 i = 0; i < TERRAIN_MATERIAL_CACHE_PAGES_COUNT; i++)
+    {
+        if (Pages[i].Chunk && Pages[i].Chunk->GetPatch() == patch)
+            FreePage(i);
+    }
+}
+
+void TerrainMaterialCache::GetTextures(GPUTexture* textures[3])
+{
+    textures[0] = PagesTextures[0];
+    textures[1] = PagesTextures[1];
+    textures[2] = PagesTextures[2];
+}
+
+void TerrainMaterialCache::Render(GPUContext* context, const RenderContext& renderContext)
+{
+    ScopeLock lock(Locker);
+    if (PendingPages.IsEmpty())
+        return;
+    PROFILE_GPU_CPU("Terrain Material Cache");
+
+    // Lazy-init cache pages
+    if (!PagesTextures[0])
+    {
+        const PixelFormat formats[3] = { GBUFFER0_FORMAT, GBUFFER1_FORMAT, GBUFFER2_FORMAT };
+        const Char* names[3] = { TEXT("TerrainMaterialCache.GBuffer0"), TEXT("TerrainMaterialCache.GBuffer1"), TEXT("TerrainMaterialCache.GBuffer2") };
+        for (int32 i = 0; i < 3; i++)
+        {
+            const auto desc = GPUTextureDescription::New2D(TERRAIN_MATERIAL_CACHE_PAGE_SIZE, TERRAIN_MATERIAL_CACHE_PAGE_SIZE, 1, formats[i], GPUTextureFlags::ShaderResource | GPUTextureFlags::RenderTarget | GPUTextureFlags::PerSliceViews, TERRAIN_MATERIAL_CACHE_PAGES_COUNT);
+            PagesTextures[i] = GPUDevice::Instance->CreateTexture(names[i]);
+            if (PagesTextures[i]->Init(desc))
+            {
+                LOG(Error, "Failed to create terrain material cache.");
+                for (GPUTexture*& texture : PagesTextures)
+                    SAFE_DELETE_GPU_RESOURCE(texture);
+                PagesTexturesFailed = true;
+                for (int32 pageIndex = 0; pageIndex < TERRAIN_MATERIAL_CACHE_PAGES_COUNT; pageIndex++)
+                    FreePage(pageIndex);
+                PendingPages.Clear();
+                return;
+            }
+        }
+    }
+    auto tempDesc = GPUTextureDescription::New2D(TERRAIN_MATERIAL_CACHE_PAGE_SIZE, TERRAIN_MATERIAL_CACHE_PAGE_SIZE, PixelFormat::R11G11B10_Float);
+    GPUTexture* lightBuffer = RenderTargetPool::Get(tempDesc);
+    RENDER_TARGET_POOL_SET_NAME(lightBuffer, "TerrainMaterialCache.Light");
+    tempDesc.Format = PixelFormat::D16_UNorm;
+    tempDesc.Flags = GPUTextureFlags::DepthStencil;
+    GPUTexture* depthBuffer = RenderTargetPool::Get(tempDesc);
+    RENDER_TARGET_POOL_SET_NAME(depthBuffer, "TerrainMaterialCache.Depth");
+
+    // Setup the view for rendering terrain chunks from the top
+    RenderContext renderContextPage = renderContext;
+    renderContextPage.List = RenderList::GetFromPool();
+    renderContextPage.View.Pass = DrawPass::GBuffer;
+    renderContextPage.View.Mode = ViewMode::Default;
+    renderContextPage.View.Flags &= ~ViewFlags::GI;
+    renderContextPage.View.IsSingleFrame = true;
+    renderContextPage.View.IsCullingDisabled = true;
+    renderContextPage.View.Prepare(renderContextPage);
+    auto& drawCallsListGBuffer = renderContextPage.List->DrawCallsLists[(int32)DrawCallsListType::GBuffer];
+    auto& drawCallsListGBufferNoDecals = renderContextPage.List->DrawCallsLists[(int32)DrawCallsListType::GBufferNoDecals];
+    drawCallsListGBuffer.CanUseInstancing = false;
+    drawCallsListGBufferNoDecals.CanUseInstancing = false;
+
+    int32 pagesRendered = 0;
+    while (PendingPages.HasItems() && pagesRendered < TERRAIN_MATERIAL_CACHE_MAX_PAGES_PER_FRAME)
+    {
+        const int32 pageIndex = PendingPages.Last();
+        PendingPages.RemoveLast();
+        CachePage& page = Pages[pageIndex];
+        TerrainChunk* chunk = page.Chunk;
+        if (!chunk || page.Ready)
+            continue;
+        const TerrainPatch* patch = chunk->GetPatch();
+        if (chunk->_cachedDrawMaterial != page.Material || !patch->Heightmap || !patch->Heightmap->IsLoaded())
+        {
+            // Material used by the chunk has changed since the request
+            FreePage(pageIndex);
+            continue;
+        }
+        pagesRendered++;
+
+        // Clear draw calls list
+        renderContextPage.List->DrawCalls.Clear();
+        renderContextPage.List->BatchedDrawCalls.Clear();
+        drawCallsListGBuffer.Indices.Clear();
+        drawCallsListGBufferNoDecals.Indices.Clear();
+        drawCallsListGBuffer.PreBatchedDrawCalls.Clear();
+        drawCallsListGBufferNoDecals.PreBatchedDrawCalls.Clear();
+
+        // Setup orthographic projection that covers the chunk area (page V axis goes along the chunk -Z axis)
+        const Transform& chunkTransform = chunk->_transform;
+        const float chunkSize = TERRAIN_UNITS_PER_VERTEX * (float)patch->GetTerrain()->GetChunkSize();
+        const float radius = (float)chunk->_sphere.Radius;
+        auto& view = renderContextPage.View;
+        const Float3 up = chunkTransform.GetUp();
+        view.Position = chunk->_sphere.Center - view.Origin + up * radius;
+        view.Direction = -up;
+        view.Near = 0.0f;
+        view.Far = radius * 2.0f;
+        Matrix viewMatrix, projectionMatrix;
+        Matrix::LookAt(view.Position, view.Position + view.Direction, chunkTransform.GetForward(), viewMatrix);
+        Matrix::Ortho(chunkSize * chunkTransform.Scale.X, chunkSize * chunkTransform.Scale.Z, view.Near, view.Far, projectionMatrix);
+        view.SetUp(viewMatrix, projectionMatrix);
+
+        // Collect draw calls using the highest streamed-in LOD
+        const int32 lod = patch->Heightmap->StreamingTexture()->TotalMipLevels() - patch->Heightmap->GetTexture()->ResidentMipLevels();
+        chunk->Draw(renderContextPage, page.Material, lod);
+
+        // Draw
+        GPUTextureView* targetBuffers[4] =
+        {
+            lightBuffer->View(),
+            PagesTextures[0]->View(pageIndex),
+            PagesTextures[1]->View(pageIndex),
+            PagesTextures[2]->View(pageIndex),
+        };
+        context->ClearDepth(depthBuffer->View());
+        context->Clear(targetBuffers[1], Color::Transparent);
+        context->Clear(targetBuffers[2], Color::Transparent);
+        context->Clear(targetBuffers[3], Color::Transparent);
+        context->SetRenderTarget(depthBuffer->View(), ToSpan(targetBuffers, ARRAY_COUNT(targetBuffers)));
+        context->SetViewportAndScissors(Viewport(0, 0, TERRAIN_MATERIAL_CACHE_PAGE_SIZE, TERRAIN_MATERIAL_CACHE_PAGE_SIZE));
+        renderContextPage.List->ExecuteDrawCalls(renderContextPage, drawCallsListGBuffer);
+        renderContextPage.List->ExecuteDrawCalls(renderContextPage, drawCallsListGBufferNoDecals);
+        context->ResetRenderTarget();
+        page.Ready = true;
+    }
+    ZoneValue(pagesRendered);
+
+    RenderList::ReturnToPool(renderContextPage.List);
+    RenderTargetPool::Release(lightBuffer);
+    RenderTargetPool::Release(depthBuffer);
+}
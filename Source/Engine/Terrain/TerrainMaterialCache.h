@@ -0,0 +1,53 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Core/Types/BaseTypes.h"
+
+class GPUContext;
+class GPUTexture;
+class MaterialBase;
+class TerrainChunk;
+class TerrainPatch;
+struct RenderContext;
+
+/// <summary>
+/// Terrain material cache that stores the pre-rendered material properties (GBuffer data) of the distant terrain chunks in a fixed pool of texture pages. Cached chunks sample a single page instead of evaluating the terrain material with all its layers so the shading cost and memory stay constant no matter how many layers the terrain uses.
+/// </summary>
+class TerrainMaterialCache
+{
+public:
+    /// <summary>
+    /// Checks if the given material can be used with the material cache (opaque, lit, without emission and position offset).
+    /// </summary>
+    /// <param name="material">The terrain material.</param>
+    /// <returns>True if material properties can be cached, otherwise false.</returns>
+    static bool CanUseMaterial(MaterialBase* material);
+
+    /// <summary>
+    /// Requests the cache page for the chunk rendered with the given material. Allocates (or evicts the least recently used) page and queues it for rendering if chunk is not cached yet. Safe to call from multiple threads.
+    /// </summary>
+    /// <param name="chunk">The terrain chunk.</param>
+    /// <param name="material">The chunk material.</param>
+    /// <returns>The page index to sample or -1 if page is not ready yet.</returns>
+    static int32 RequestPage(TerrainChunk* chunk, MaterialBase* material);
+
+    /// <summary>
+    /// Removes all the cache pages of the given patch chunks (eg. after terrain data modification or on patch removal).
+    /// </summary>
+    /// <param name="patch">The terrain patch.</param>
+    static void Invalidate(const TerrainPatch* patch);
+
+    /// <summary>
+    /// Gets the cache pages textures (GBuffer0, GBuffer1 and GBuffer2 texture arrays).
+    /// </summary>
+    /// <param name="textures">The output textures (can be null if cache is unused).</param>
+    static void GetTextures(GPUTexture* textures[3]);
+
+    /// <summary>
+    /// Renders the pending cache pages. Called by the renderer before filling the GBuffer.
+    /// </summary>
+    /// <param name="context">The GPU commands context.</param>
+    /// <param name="renderContext">The rendering context.</param>
+    static void Render(GPUContext* context, const RenderContext& renderContext);
+};
@@ -2,6 +2,7 @@
 
 #include "TerrainPatch.h"
 #include "Terrain.h"
+#include "TerrainMaterialCache.h"
 #include "Engine/Serialization/Serialization.h"
 #include "Engine/Core/Log.h"
 #include "Engine/Core/Math/Color32.h"
@@ -14,6 +15,7 @@
 #include "Engine/Level/Level.h"
 #include "Engine/Graphics/Async/GPUTask.h"
 #include "Engine/Threading/Threading.h"
+#include "Engine/Threading/Task.h"
 #if TERRAIN_EDITING
 #include "Engine/Core/Math/Packed.h"
 #include "Engine/Graphics/PixelFormatExtensions.h"
@@ -87,6 +89,10 @@ void TerrainPatch::Init(Terrain* terrain, int16 x, int16 z)
     _cachedHeightMap.Resize(0);
     _cachedHolesMask.Resize(0);
     _wasHeightModified = false;
+    _heightDataDirty = false;
+    _heightDataDirtyRange = false;
+    _heightDataDirtyHeight = false;
+    _heightfieldDataDirty = false;
     for (int32 i = 0; i < TERRAIN_MAX_SPLATMAPS_COUNT; i++)
     {
         _cachedSplatMap[i].Resize(0);
@@ -104,6 +110,8 @@ void TerrainPatch::Init(Terrain* terrain, int16 x, int16 z)
 
 TerrainPatch::~TerrainPatch()
 {
+    CancelCollisionStreaming();
+    TerrainMaterialCache::Invalidate(this);
 #if TERRAIN_UPDATING
     SAFE_DELETE(_dataHeightmap);
     for (int32 i = 0; i < TERRAIN_MAX_SPLATMAPS_COUNT; i++)
@@ -804,6 +812,7 @@ bool ModifyCollision(TerrainDataUpdateInfo& info, TextureBase::InitData* initDat
 bool TerrainPatch::SetupHeightMap(int32 heightMapLength, const float* heightMap, const byte* holesMask, bool forceUseVirtualStorage)
 {
     PROFILE_CPU_NAMED("Terrain.Setup");
+    TerrainMaterialCache::Invalidate(this);
     if (heightMap == nullptr)
     {
         LOG(Warning, "Cannot create terrain without a heightmap specified.");
@@ -1007,6 +1016,10 @@ bool TerrainPatch::SetupHeightMap(int32 heightMapLength, const float* heightMap,
     _cachedHeightMap.Resize(0);
     _cachedHolesMask.Resize(0);
     _wasHeightModified = false;
+    _heightDataDirty = false;
+    _heightDataDirtyRange = false;
+    _heightDataDirtyHeight = false;
+    _heightfieldDataDirty = false;
 #endif
 
     return false;
@@ -1015,6 +1028,7 @@ bool TerrainPatch::SetupHeightMap(int32 heightMapLength, const float* heightMap,
 bool TerrainPatch::SetupSplatMap(int32 index, int32 splatMapLength, const Color32* splatMap, bool forceUseVirtualStorage)
 {
     PROFILE_CPU_NAMED("Terrain.SetupSplatMap");
+    TerrainMaterialCache::Invalidate(this);
     CHECK_RETURN(index >= 0 && index < TERRAIN_MAX_SPLATMAPS_COUNT, true);
     if (splatMap == nullptr)
     {
@@ -1215,7 +1229,8 @@ Color32* TerrainPatch::GetSplatMapData(int32 index)
 void TerrainPatch::ClearSplatMapCache()
 {
     PROFILE_CPU_NAMED("Terrain.ClearSplatMapCache");
-    _cachedSplatMap->Clear();
+    for (int32 i = 0; i < TERRAIN_MAX_SPLATMAPS_COUNT; i++)
+        _cachedSplatMap[i].Clear();
 }
 
 void TerrainPatch::ClearCache()
@@ -1360,6 +1375,8 @@ void TerrainPatch::CacheSplatData()
 
 bool TerrainPatch::ModifyHeightMap(const float* samples, const Int2& modifiedOffset, const Int2& modifiedSize)
 {
+    TerrainMaterialCache::Invalidate(this);
+
     // Validate input samples range
     TerrainDataUpdateInfo info(this);
     if (samples == nullptr)
@@ -1454,6 +1471,8 @@ bool TerrainPatch::ModifyHeightMap(const float* samples, const Int2& modifiedOff
 
 bool TerrainPatch::ModifyHolesMask(const byte* samples, const Int2& modifiedOffset, const Int2& modifiedSize)
 {
+    TerrainMaterialCache::Invalidate(this);
+
     // Validate input samples range
     TerrainDataUpdateInfo info(this, _yOffset, _yHeight);
     if (samples == nullptr)
@@ -1520,6 +1539,7 @@ bool TerrainPatch::ModifyHolesMask(const byte* samples, const Int2& modifiedOffs
 bool TerrainPatch::ModifySplatMap(int32 index, const Color32* samples, const Int2& modifiedOffset, const Int2& modifiedSize)
 {
     ASSERT(index >= 0 && index < TERRAIN_MAX_SPLATMAPS_COUNT);
+    TerrainMaterialCache::Invalidate(this);
 
     // Ensure that terrain has a valid heightmap
     if (Heightmap == nullptr)
@@ -1751,14 +1771,56 @@ bool TerrainPatch::UpdateHeightData(TerrainDataUpdateInfo& info, const Int2& mod
         UpdateNormalsAndHoles(info, heightMap, holesMask, mip.Data.Get());
     }
 
+    // Accumulate the modified region and flush it once per frame (multiple edits within a frame cause a single mips update, GPU upload and collision modification)
+    if (_heightDataDirty)
+    {
+        const Int2 dirtyEnd = Int2::Max(_heightDataDirtyOffset + _heightDataDirtySize, modifiedOffset + modifiedSize);
+        _heightDataDirtyOffset = Int2::Min(_heightDataDirtyOffset, modifiedOffset);
+        _heightDataDirtySize = dirtyEnd - _heightDataDirtyOffset;
+    }
+    else
+    {
+        _heightDataDirtyOffset = modifiedOffset;
+        _heightDataDirtySize = modifiedSize;
+    }
+    _heightDataDirty = true;
+    _heightDataDirtyRange |= wasHeightRangeChanged;
+    _heightDataDirtyHeight |= wasHeightChanged;
+
+    // Mark as modified (need to save texture data during scene saving)
+    _wasHeightModified = true;
+
+    // Note: if terrain is using virtual storage then it won't be updated, we could synchronize that data...
+
+    // TODO: disable heightmap dynamic streaming - data on a GPU was modified and we don't want to override it with the old data stored in the asset container
+
+    return false;
+}
+
+void TerrainPatch::FlushHeightData()
+{
+    if (!_heightDataDirty)
+        return;
+    PROFILE_CPU();
+    _heightDataDirty = false;
+    const bool wasHeightRangeChanged = _heightDataDirtyRange;
+    const bool wasHeightChanged = _heightDataDirtyHeight;
+    _heightDataDirtyRange = _heightDataDirtyHeight = false;
+    if (_dataHeightmap == nullptr || Heightmap == nullptr)
+        return;
+    TerrainDataUpdateInfo info(this, _yOffset, _yHeight);
+    const PixelFormat pixelFormat = _dataHeightmap->Format;
+    const int32 pixelStride = PixelFormatExtensions::SizeInBytes(pixelFormat);
+
     // Downscale mip data for all lower LODs
     if (GenerateMips(_dataHeightmap))
-        return true;
+        return;
 
     // Fix generated mip maps to keep the same values for chunk edges (reduce cracks on continuous LOD transitions)
     FixMips(info, _dataHeightmap, pixelStride);
 
     // Update terrain texture (on a GPU)
+    auto texture = Heightmap->GetTexture();
     for (int32 mipIndex = 0; mipIndex < _dataHeightmap->Mips.Count(); mipIndex++)
     {
         auto task = texture->UploadMipMapAsync(_dataHeightmap->Mips[mipIndex].Data, mipIndex);
@@ -1766,53 +1828,24 @@ bool TerrainPatch::UpdateHeightData(TerrainDataUpdateInfo& info, const Int2& mod
             task->Start();
     }
 
-#if 1
-    if (wasHeightRangeChanged)
+    // Modify the height field samples in-place (without cooking collision and recreating the shape), cooked collision data is outdated and will be cooked again when needed (eg. on save or collision creation)
     {
-        // When min-max height range has been changed for the patch let's update it all, it's faster to cook collision and rebuild shape rather than modify all the samples
-        if (_heightfield->WaitForLoaded())
+        ScopeLock lock(_collisionLocker);
+        _heightfieldDataDirty = true;
+        if (HasCollision() && _physicsHeightField)
         {
-            LOG(Error, "Failed to load patch heightfield data.");
-            return true;
+            // When min-max height range has been changed for the patch all samples need to be updated (heights are normalized to the patch range)
+            const Int2 modifiedOffset = wasHeightRangeChanged ? Int2::Zero : _heightDataDirtyOffset;
+            const Int2 modifiedSize = wasHeightRangeChanged ? Int2(info.HeightmapSize) : _heightDataDirtySize;
+            if (ModifyCollision(info, _dataHeightmap, _terrain->_collisionLod, modifiedOffset, modifiedSize, _physicsHeightField))
+                return;
+            if (wasHeightRangeChanged)
+                UpdateCollisionScale();
         }
-        const auto collisionData = &_heightfield->Data;
-        if (CookCollision(info, _dataHeightmap, _terrain->_collisionLod, collisionData))
-            return true;
-        UpdateCollision();
-    }
-    else
-    {
-        ScopeLock lock(_collisionLocker);
-        if (ModifyCollision(info, _dataHeightmap, _terrain->_collisionLod, modifiedOffset, modifiedSize, _physicsHeightField))
-            return true;
-        if (wasHeightChanged)
-            UpdateCollisionScale();
     }
-#else
-	// Modify heightfield samples (without cooking collision which is done on a separate async task)
-	if (HasCollision() && _physicsHeightField)
-	{
-        ScopeLock lock(_collisionLocker);
-		if (wasHeightRangeChanged)
-		{
-			if (ModifyCollision(info, _dataHeightmap, _terrain->_collisionLod, Int2::Zero, Int2(info.HeightmapSize), _physicsHeightField))
-				return true;
-		}
-		else
-		{
-			if (ModifyCollision(info, _dataHeightmap, _terrain->_collisionLod, modifiedOffset, modifiedSize, _physicsHeightField))
-				return true;
-		}
-
-		UpdateCollisionScale();
-	}
-#endif
-
-    // Mark as modified (need to save texture data during scene saving)
-    _wasHeightModified = true;
 
     if (!wasHeightChanged)
-        return false;
+        return;
 
     // Invalidate cache
 #if TERRAIN_USE_PHYSICS_DEBUG
@@ -1822,17 +1855,29 @@ bool TerrainPatch::UpdateHeightData(TerrainDataUpdateInfo& info, const Int2& mod
     _collisionTriangles.Resize(0);
 #endif
     _collisionVertices.Resize(0);
+}
 
-    // Note: if terrain is using virtual storage then it won't be updated, we could synchronize that data...
-
-    // TODO: disable heightmap dynamic streaming - data on a GPU was modified and we don't want to override it with the old data stored in the asset container
-
+bool TerrainPatch::CookHeightfieldData()
+{
+    if (!_heightfieldDataDirty || _dataHeightmap == nullptr || _heightfield == nullptr)
+        return false;
+    if (_heightfield->WaitForLoaded())
+    {
+        LOG(Error, "Failed to load patch heightfield data.");
+        return true;
+    }
+    TerrainDataUpdateInfo info(this, _yOffset, _yHeight);
+    if (CookCollision(info, _dataHeightmap, _terrain->_collisionLod, &_heightfield->Data))
+        return true;
+    _heightfieldDataDirty = false;
     return false;
 }
 
 void TerrainPatch::SaveHeightData()
 {
 #if USE_EDITOR
+    FlushHeightData();
+
     // Skip if was not modified or cannot be saved
     if (!_wasHeightModified ||
         Heightmap == nullptr ||
@@ -1844,7 +1889,6 @@ void TerrainPatch::SaveHeightData()
         return;
     }
     PROFILE_CPU_NAMED("Terrain.Save");
-    TerrainDataUpdateInfo info(this, _yOffset, _yHeight);
 
     // Save heightmap to asset
     if (Heightmap->WaitForLoaded())
@@ -1859,13 +1903,8 @@ void TerrainPatch::SaveHeightData()
     }
 
     // Generate physics backend height field data for the runtime
-    if (_heightfield->WaitForLoaded())
-    {
-        LOG(Error, "Failed to load patch heightfield data.");
-        return;
-    }
-    const auto collisionData = &_heightfield->Data;
-    if (CookCollision(info, _dataHeightmap, _terrain->_collisionLod, collisionData))
+    _heightfieldDataDirty = true;
+    if (CookHeightfieldData())
     {
         return;
     }
@@ -2103,7 +2142,7 @@ void TerrainPatch::CreateCollision()
 {
     PROFILE_CPU();
     ASSERT(!HasCollision());
-    if (CreateHeightField())
+    if (_physicsHeightField == nullptr && CreateHeightField())
         return;
     ASSERT(_physicsHeightField);
 
@@ -2138,6 +2177,10 @@ bool TerrainPatch::CreateHeightField()
     // Skip if height field data is missing but warn on loading failed
     if (_heightfield == nullptr)
         return true;
+#if TERRAIN_UPDATING
+    if (CookHeightfieldData())
+        return true;
+#endif
     if (_heightfield->WaitForLoaded() || _heightfield->Data.IsEmpty())
     {
         LOG(Warning, "Cannot create terrain collision. Failed to load heightfield data for terrain {0} patch {1}x{2}.", _terrain->ToString(), _x, _z);
@@ -2166,6 +2209,86 @@ bool TerrainPatch::CreateHeightField()
     return false;
 }
 
+void TerrainPatch::StartCollisionStreaming()
+{
+    ScopeLock lock(_collisionLocker);
+    if (HasCollision() || _collisionStreamingTask || _heightfield == nullptr)
+        return;
+
+    // Wait for the collision data to be loaded (skip if failed, the warning is logged when creating collision synchronously)
+    if (!_heightfield->IsLoaded())
+        return;
+#if TERRAIN_UPDATING
+    if (CookHeightfieldData())
+        return;
+#endif
+    const int32 dataSize = _heightfield->Data.Count();
+    if (dataSize <= (int32)sizeof(TerrainCollisionDataHeader))
+        return;
+
+    // Outdated collision data has to be cooked again on a main thread
+    auto collisionHeader = (TerrainCollisionDataHeader*)_heightfield->Data.Get();
+    if (collisionHeader->CheckOldMagicNumber != MAX_int32 || collisionHeader->Version != TerrainCollisionDataHeader::CurrentVersion)
+    {
+        CreateCollision();
+        return;
+    }
+
+    // Create height field object on a job thread
+    _collisionScaleXZ = collisionHeader->ScaleXZ * TERRAIN_UNITS_PER_VERTEX;
+    Platform::AtomicStore(&_collisionStreamingReady, 0);
+    _collisionStreamingTask = Task::StartNew<TerrainPatch, &TerrainPatch::CreateStreamedHeightField>(this);
+}
+
+void TerrainPatch::CreateStreamedHeightField()
+{
+    PROFILE_CPU();
+    ScopeLock lock(_collisionLocker);
+    const auto& data = _heightfield->Data;
+    _streamedHeightField = PhysicsBackend::CreateHeightField(data.Get() + sizeof(TerrainCollisionDataHeader), data.Count() - sizeof(TerrainCollisionDataHeader));
+    Platform::AtomicStore(&_collisionStreamingReady, 1);
+}
+
+void TerrainPatch::FinishCollisionStreaming()
+{
+    if (!_collisionStreamingTask || Platform::AtomicRead(&_collisionStreamingReady) == 0)
+        return;
+    PROFILE_CPU();
+    ScopeLock lock(_collisionLocker);
+    _collisionStreamingTask = nullptr;
+    void* heightField = _streamedHeightField;
+    _streamedHeightField = nullptr;
+    if (heightField == nullptr)
+    {
+        LOG(Error, "Failed to create terrain collision height field.");
+        return;
+    }
+    if (HasCollision())
+    {
+        PhysicsBackend::DestroyObject(heightField);
+        return;
+    }
+    ASSERT(_physicsHeightField == nullptr);
+    _physicsHeightField = heightField;
+    CreateCollision();
+}
+
+void TerrainPatch::CancelCollisionStreaming()
+{
+    Task* task = _collisionStreamingTask;
+    if (!task)
+        return;
+    if (Platform::AtomicRead(&_collisionStreamingReady) == 0)
+        task->Wait();
+    ScopeLock lock(_collisionLocker);
+    _collisionStreamingTask = nullptr;
+    if (_streamedHeightField)
+    {
+        PhysicsBackend::DestroyObject(_streamedHeightField);
+        _streamedHeightField = nullptr;
+    }
+}
+
 void TerrainPatch::UpdateCollisionScale() const
 {
     PROFILE_CPU();
@@ -34,11 +34,19 @@ API_CLASS(Sealed, NoSpawn) class FLAXENGINE_API TerrainPatch : public ScriptingO
     void* _physicsHeightField;
     CriticalSection _collisionLocker;
     float _collisionScaleXZ;
+    class Task* _collisionStreamingTask = nullptr;
+    void* _streamedHeightField = nullptr;
+    volatile int64 _collisionStreamingReady = 0;
 #if TERRAIN_UPDATING
     Array<float> _cachedHeightMap;
     Array<byte> _cachedHolesMask;
     Array<Color32> _cachedSplatMap[TERRAIN_MAX_SPLATMAPS_COUNT];
     bool _wasHeightModified;
+    bool _heightDataDirty = false;
+    bool _heightDataDirtyRange = false;
+    bool _heightDataDirtyHeight = false;
+    bool _heightfieldDataDirty = false;
+    Int2 _heightDataDirtyOffset, _heightDataDirtySize;
     bool _wasSplatmapModified[TERRAIN_MAX_SPLATMAPS_COUNT];
     TextureBase::InitData* _dataHeightmap = nullptr;
     TextureBase::InitData* _dataSplatmap[TERRAIN_MAX_SPLATMAPS_COUNT] = {};
@@ -294,6 +302,8 @@ API_CLASS(Sealed, NoSpawn) class FLAXENGINE_API TerrainPatch : public ScriptingO
 
 private:
     bool UpdateHeightData(struct TerrainDataUpdateInfo& info, const Int2& modifiedOffset, const Int2& modifiedSize, bool wasHeightRangeChanged, bool wasHeightChanged);
+    void FlushHeightData();
+    bool CookHeightfieldData();
     void SaveHeightData();
     void CacheHeightData();
     void SaveSplatData();
@@ -401,6 +411,31 @@ API_CLASS(Sealed, NoSpawn) class FLAXENGINE_API TerrainPatch : public ScriptingO
     /// <returns>True if failed, otherwise false.</returns>
     bool CreateHeightField();
 
+    /// <summary>
+    /// Starts the collision creation with the height field object created on a job thread. Collision gets created in FinishCollisionStreaming once the height field is ready.
+    /// </summary>
+    void StartCollisionStreaming();
+
+    /// <summary>
+    /// Creates the collision object if the height field created on a job thread is ready.
+    /// </summary>
+    void FinishCollisionStreaming();
+
+    /// <summary>
+    /// Cancels the pending collision creation (waits for the job thread).
+    /// </summary>
+    void CancelCollisionStreaming();
+
+    /// <summary>
+    /// Determines whether this patch is during the collision creation on a job thread.
+    /// </summary>
+    FORCE_INLINE bool IsCollisionStreaming() const
+    {
+        return _collisionStreamingTask != nullptr;
+    }
+
+    void CreateStreamedHeightField();
+
     /// <summary>
     /// Updates the collision geometry scale for the patch. Called when terrain actor scale gets changed.
     /// </summary>
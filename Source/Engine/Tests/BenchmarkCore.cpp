@@ -0,0 +1,164 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#if FLAX_BENCHMARKS
+
+#include "Engine/Core/RandomStream.h"
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Core/Collections/HashSet.h"
+#include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Core/Collections/Sorting.h"
+#include "Engine/Core/Math/Matrix.h"
+#include "Engine/Core/Math/Quaternion.h"
+#include "Engine/Core/Math/Transform.h"
+#include "Engine/Core/Math/Vector3.h"
+#include <ThirdParty/catch2/catch.hpp>
+
+#define BENCHMARK_ITEMS 10000
+
+TEST_CASE("Benchmark Collections", "[benchmark]")
+{
+    RandomStream rand(101);
+    Array<int32> keys;
+    keys.Resize(BENCHMARK_ITEMS);
+    for (int32 i = 0; i < keys.Count(); i++)
+        keys[i] = (int32)rand.GetUnsignedInt();
+
+    BENCHMARK("Array Add")
+    {
+        Array<int32> a;
+        for (int32 i = 0; i < BENCHMARK_ITEMS; i++)
+            a.Add(i);
+        return a.Count();
+    };
+
+    BENCHMARK("Array Iterate")
+    {
+        int64 sum = 0;
+        for (const int32 e : keys)
+            sum += e;
+        return sum;
+    };
+
+    BENCHMARK("Array RemoveAtKeepOrder")
+    {
+        Array<int32> a(keys.Get(), 1000);
+        while (a.HasItems())
+            a.RemoveAtKeepOrder(0);
+        return a.Count();
+    };
+
+    BENCHMARK("Dictionary Add")
+    {
+        Dictionary<int32, int32> d;
+        for (int32 i = 0; i < BENCHMARK_ITEMS; i++)
+            d[keys[i]] = i;
+        return d.Count();
+    };
+
+    Dictionary<int32, int32> dictionary;
+    for (int32 i = 0; i < BENCHMARK_ITEMS; i++)
+        dictionary[keys[i]] = i;
+    BENCHMARK("Dictionary Find")
+    {
+        int32 found = 0;
+        for (int32 i = 0; i < BENCHMARK_ITEMS; i++)
+            found += dictionary.ContainsKey(keys[i]) ? 1 : 0;
+        return found;
+    };
+
+    BENCHMARK("HashSet Add")
+    {
+        HashSet<int32> s;
+        for (int32 i = 0; i < BENCHMARK_ITEMS; i++)
+            s.Add(keys[i]);
+        return s.Count();
+    };
+
+    HashSet<int32> hashSet;
+    for (int32 i = 0; i < BENCHMARK_ITEMS; i++)
+        hashSet.Add(keys[i]);
+    BENCHMARK("HashSet Contains")
+    {
+        int32 found = 0;
+        for (int32 i = 0; i < BENCHMARK_ITEMS; i++)
+            found += hashSet.Contains(keys[i]) ? 1 : 0;
+        return found;
+    };
+}
+
+TEST_CASE("Benchmark Sorting", "[benchmark]")
+{
+    RandomStream rand(101);
+    Array<uint32> keys;
+    Array<int32> values;
+    keys.Resize(BENCHMARK_ITEMS);
+    values.Resize(BENCHMARK_ITEMS);
+    for (int32 i = 0; i < keys.Count(); i++)
+    {
+        keys[i] = rand.GetUnsignedInt();
+        values[i] = i;
+    }
+
+    // Input data copy is included in the measured time so every run sorts the same unsorted data
+    BENCHMARK("QuickSort")
+    {
+        Array<uint32> data(keys);
+        Sorting::QuickSort(data.Get(), data.Count());
+        return data[0];
+    };
+
+    Array<uint32> dataKeys, tmpKeys;
+    Array<int32> dataValues, tmpValues;
+    dataKeys.Resize(keys.Count());
+    dataValues.Resize(values.Count());
+    tmpKeys.Resize(keys.Count());
+    tmpValues.Resize(values.Count());
+    BENCHMARK("RadixSort")
+    {
+        Platform::MemoryCopy(dataKeys.Get(), keys.Get(), keys.Count() * sizeof(uint32));
+        Platform::MemoryCopy(dataValues.Get(), values.Get(), values.Count() * sizeof(int32));
+        uint32* k = dataKeys.Get();
+        int32* v = dataValues.Get();
+        Sorting::RadixSort(k, v, tmpKeys.Get(), tmpValues.Get(), keys.Count());
+        return k[0];
+    };
+}
+
+TEST_CASE("Benchmark Math", "[benchmark]")
+{
+    RandomStream rand(101);
+    Array<Transform> transforms;
+    transforms.Resize(1000);
+    for (auto& e : transforms)
+        e = Transform(Vector3(rand.GetFraction(), rand.GetFraction(), rand.GetFraction()), Quaternion::Euler(rand.GetFraction() * 360.0f, rand.GetFraction() * 360.0f, 0.0f), Float3(1.0f + rand.GetFraction()));
+
+    BENCHMARK("Transform LocalToWorld")
+    {
+        Transform result = Transform::Identity;
+        for (const Transform& e : transforms)
+            result = result.LocalToWorld(e);
+        return result.Translation;
+    };
+
+    BENCHMARK("Matrix Multiply")
+    {
+        Matrix result = Matrix::Identity;
+        Matrix m;
+        for (const Transform& e : transforms)
+        {
+            e.GetWorld(m);
+            Matrix::Multiply(result, m, result);
+        }
+        return result.M11;
+    };
+
+    BENCHMARK("Vector3 Transform")
+    {
+        Vector3 result = Vector3::Zero;
+        for (const Transform& e : transforms)
+            result += e.LocalToWorld(Vector3::One);
+        return result;
+    };
+}
+
+#endif
@@ -0,0 +1,121 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#if FLAX_BENCHMARKS
+
+#include "Engine/Core/Log.h"
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Core/Types/DateTime.h"
+#include "Engine/Core/Types/StringBuilder.h"
+#include "Engine/Engine/Globals.h"
+#include "Engine/Platform/File.h"
+#include "Engine/Platform/FileSystem.h"
+#include "Engine/Platform/StringUtils.h"
+#include <ThirdParty/catch2/catch.hpp>
+
+// The relative increase of the benchmark mean time (compared to the baseline) reported as a performance regression
+#define BENCHMARK_REGRESSION_THRESHOLD 0.1
+
+namespace
+{
+    struct BenchmarkResult
+    {
+        String Name;
+        double Mean; // In nanoseconds
+        double StandardDeviation; // In nanoseconds
+    };
+
+    String CurrentTestCase;
+    Array<BenchmarkResult> Results;
+}
+
+class BenchmarkResultsListener : public Catch::TestEventListenerBase
+{
+public:
+    using TestEventListenerBase::TestEventListenerBase;
+
+    void testCaseStarting(Catch::TestCaseInfo const& testInfo) override
+    {
+        TestEventListenerBase::testCaseStarting(testInfo);
+        CurrentTestCase.SetUTF8(testInfo.name.c_str(), (int32)testInfo.name.size());
+    }
+
+    void benchmarkEnded(Catch::BenchmarkStats<> const& stats) override
+    {
+        String name;
+        name.SetUTF8(stats.info.name.c_str(), (int32)stats.info.name.size());
+        auto& result = Results.AddOne();
+        result.Name = CurrentTestCase + TEXT('/') + name;
+        result.Mean = stats.mean.point.count();
+        result.StandardDeviation = stats.standardDeviation.point.count();
+    }
+};
+
+CATCH_REGISTER_LISTENER(BenchmarkResultsListener)
+
+// Compares the collected benchmark results with the baseline file and saves them. Returns true if any benchmark got slower than the baseline (above the threshold).
+bool BenchmarkResultsReport()
+{
+    const String folder = Globals::ProjectFolder / TEXT("Benchmarks");
+    const String baselinePath = folder / TEXT("Baseline.txt");
+    const String resultsPath = folder / TEXT("Results_") + DateTime::Now().ToFileNameString() + TEXT(".txt");
+    FileSystem::CreateDirectory(folder);
+
+    // Load baseline (each line contains: name, mean and standard deviation separated with tabs)
+    Dictionary<String, double> baseline;
+    String baselineText;
+    const bool hasBaseline = !File::ReadAllText(baselinePath, baselineText);
+    if (hasBaseline)
+    {
+        Array<String> lines, parts;
+        baselineText.Split('\n', lines);
+        for (String& line : lines)
+        {
+            line = line.TrimTrailing();
+            parts.Clear();
+            line.Split('\t', parts);
+            float mean;
+            if (parts.Count() >= 2 && !StringUtils::Parse(parts[1].Get(), &mean))
+                baseline[parts[0]] = mean;
+        }
+    }
+
+    // Compare results with the baseline
+    Log::Logger::WriteFloor();
+    LOG(Info, "Benchmark results ({0} benchmarks, baseline: {1})", Results.Count(), hasBaseline ? StringView(baselinePath) : StringView(TEXT("none")));
+    int32 regressions = 0;
+    StringBuilder output;
+    for (const BenchmarkResult& result : Results)
+    {
+        output.AppendFormat(TEXT("{0}\t{1:.2f}\t{2:.2f}\n"), result.Name, result.Mean, result.StandardDeviation);
+        const double* baselineMean = baseline.TryGet(result.Name);
+        if (!baselineMean || *baselineMean <= 0.0)
+        {
+            LOG(Info, "{0}: {1:.2f} ns (new)", result.Name, result.Mean);
+            continue;
+        }
+        const double change = result.Mean / *baselineMean - 1.0;
+        if (change > BENCHMARK_REGRESSION_THRESHOLD)
+        {
+            regressions++;
+            LOG(Warning, "{0}: {1:.2f} ns (baseline {2:.2f} ns, {3:+.1f}%) - regression", result.Name, result.Mean, *baselineMean, change * 100.0);
+        }
+        else
+        {
+            LOG(Info, "{0}: {1:.2f} ns (baseline {2:.2f} ns, {3:+.1f}%)", result.Name, result.Mean, *baselineMean, change * 100.0);
+        }
+    }
+    if (regressions != 0)
+        LOG(Error, "{0} benchmarks are slower than the baseline by more than {1}%", regressions, (int32)(BENCHMARK_REGRESSION_THRESHOLD * 100));
+    Log::Logger::WriteFloor();
+
+    // Save results (and use them as a baseline if it's missing)
+    File::WriteAllText(resultsPath, output, Encoding::ANSI);
+    if (!hasBaseline)
+        File::WriteAllText(baselinePath, output, Encoding::ANSI);
+    LOG(Info, "Benchmark results saved to {0}", resultsPath);
+
+    return regressions != 0;
+}
+
+#endif
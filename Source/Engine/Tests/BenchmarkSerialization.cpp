@@ -0,0 +1,91 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#if FLAX_BENCHMARKS
+
+#include "Engine/Core/Types/String.h"
+#include "Engine/Core/Types/Variant.h"
+#include "Engine/Core/Math/Vector3.h"
+#include "Engine/Serialization/JsonWriters.h"
+#include <ThirdParty/catch2/catch.hpp>
+
+TEST_CASE("Benchmark String", "[benchmark]")
+{
+    BENCHMARK("Format")
+    {
+        return String::Format(TEXT("Actor {0} at {1} with {2} children ({3})"), TEXT("Name"), Vector3(1.0f, 2.0f, 3.0f), 10, 0.5f);
+    };
+
+    BENCHMARK("Concatenate")
+    {
+        String result;
+        for (int32 i = 0; i < 100; i++)
+            result += TEXT("Text");
+        return result.Length();
+    };
+
+    const String text(TEXT("The quick brown fox jumps over the lazy dog"));
+    BENCHMARK("Find")
+    {
+        return text.Find(TEXT("lazy")) + text.Find(TEXT("missing"));
+    };
+
+    BENCHMARK("Compare")
+    {
+        return text.Compare(String(TEXT("The quick brown fox jumps over the lazy cat")), StringSearchCase::IgnoreCase);
+    };
+}
+
+TEST_CASE("Benchmark Variant", "[benchmark]")
+{
+    BENCHMARK("Construct")
+    {
+        Variant a(10), b(1.5f), c(Float3::One), d(TEXT("Text"));
+        return a.AsInt + (int32)b.AsFloat;
+    };
+
+    const Variant text(TEXT("The quick brown fox jumps over the lazy dog"));
+    const Variant vector(Vector3(1.0f, 2.0f, 3.0f));
+    BENCHMARK("Copy")
+    {
+        Variant a(text), b(vector);
+        return a.Type.Type == b.Type.Type;
+    };
+
+    BENCHMARK("Compare")
+    {
+        return text == vector;
+    };
+
+    BENCHMARK("Cast")
+    {
+        return (float)Variant(10) + (float)Variant(1.5);
+    };
+}
+
+TEST_CASE("Benchmark JsonWriter", "[benchmark]")
+{
+    BENCHMARK("Write Object")
+    {
+        rapidjson_flax::StringBuffer buffer;
+        CompactJsonWriter writerObj(buffer);
+        JsonWriter& writer = writerObj;
+        writer.StartArray();
+        for (int32 i = 0; i < 100; i++)
+        {
+            writer.StartObject();
+            writer.JKEY("Name");
+            writer.String(TEXT("Actor"));
+            writer.JKEY("Index");
+            writer.Int(i);
+            writer.JKEY("Position");
+            writer.Vector3(Vector3(1.0f, 2.0f, 3.0f));
+            writer.JKEY("Scale");
+            writer.Float(1.5f);
+            writer.EndObject();
+        }
+        writer.EndArray();
+        return buffer.GetSize();
+    };
+}
+
+#endif
@@ -5,6 +5,9 @@
 #include "Engine/Core/Collections/BitArray.h"
 #include "Engine/Core/Collections/HashSet.h"
 #include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Core/Collections/FlatHashSet.h"
+#include "Engine/Core/Collections/FlatDictionary.h"
+#include "Engine/Core/Collections/SoAArray.h"
 #include <ThirdParty/catch2/catch.hpp>
 
 TEST_CASE("Array")
@@ -14,23 +17,55 @@ TEST_CASE("Array")
         Array<int32> a1;
         Array<int32, InlinedAllocation<8>> a2;
         Array<int32, FixedAllocation<8>> a3;
+        Array<int32, FrameAllocation> a4;
         for (int32 i = 0; i < 7; i++)
         {
             a1.Add(i);
             a2.Add(i);
             a3.Add(i);
+            a4.Add(i);
         }
         CHECK(a1.Count() == 7);
         CHECK(a2.Count() == 7);
         CHECK(a3.Count() == 7);
+        CHECK(a4.Count() == 7);
         for (int32 i = 0; i < 7; i++)
         {
             CHECK(a1[i] == i);
             CHECK(a2[i] == i);
             CHECK(a3[i] == i);
+            CHECK(a4[i] == i);
         }
     }
 
+    SECTION("Test Frame Allocation")
+    {
+        // Interleaved growth (in-place resize of the last allocation and relocation of the others)
+        Array<int32, FrameAllocation> a1, a2;
+        Array<int32, InlinedAllocation<8, FrameAllocation>> a3;
+        for (int32 i = 0; i < 10000; i++)
+        {
+            a1.Add(i);
+            if (i % 4 == 0)
+                a2.Add(i);
+            if (i % 100 == 0)
+                a3.Add(i);
+        }
+        CHECK(a1.Count() == 10000);
+        CHECK(a2.Count() == 2500);
+        CHECK(a3.Count() == 100);
+        for (int32 i = 0; i < a1.Count(); i++)
+            CHECK(a1[i] == i);
+        for (int32 i = 0; i < a2.Count(); i++)
+            CHECK(a2[i] == i * 4);
+        for (int32 i = 0; i < a3.Count(); i++)
+            CHECK(a3[i] == i * 100);
+        a1.Resize(10);
+        a1.SetCapacity(10);
+        CHECK(a1.Count() == 10);
+        CHECK(a1[9] == 9);
+    }
+
     // Generate some random data for testing
     Array<uint32> testData;
     testData.Resize(32);
@@ -291,3 +326,221 @@ TEST_CASE("Dictionary")
         CHECK(a1.Capacity() <= DICTIONARY_DEFAULT_CAPACITY);
     }
 }
+
+TEST_CASE("FlatHashSet")
+{
+    SECTION("Test Allocators")
+    {
+        FlatHashSet<int32> a1;
+        FlatHashSet<int32, InlinedAllocation<32>> a2;
+        FlatHashSet<int32, FixedAllocation<32>> a3;
+        for (int32 i = 0; i < 20; i++)
+        {
+            a1.Add(i);
+            a2.Add(i);
+            a3.Add(i);
+        }
+        CHECK(a1.Count() == 20);
+        CHECK(a2.Count() == 20);
+        CHECK(a3.Count() == 20);
+        for (int32 i = 0; i < 20; i++)
+        {
+            CHECK(a1.Contains(i));
+            CHECK(a2.Contains(i));
+            CHECK(a3.Contains(i));
+        }
+        CHECK(!a1.Contains(20));
+        CHECK(!a1.Add(1));
+    }
+
+    SECTION("Test Resizing")
+    {
+        FlatHashSet<int32> a1;
+        for (int32 i = 0; i < 4000; i++)
+            a1.Add(i);
+        CHECK(a1.Count() == 4000);
+        int32 capacity = a1.Capacity();
+        for (int32 i = 0; i < 4000; i++)
+        {
+            CHECK(a1.Contains(i));
+        }
+        a1.Clear();
+        CHECK(a1.Count() == 0);
+        CHECK(a1.Capacity() == capacity);
+        for (int32 i = 0; i < 4000; i++)
+            a1.Add(i);
+        CHECK(a1.Count() == 4000);
+        CHECK(a1.Capacity() == capacity);
+        for (int32 i = 0; i < 4000; i++)
+            a1.Remove(i);
+        CHECK(a1.Count() == 0);
+        CHECK(a1.Capacity() == capacity);
+        for (int32 i = 0; i < 4000; i++)
+            a1.Add(i);
+        CHECK(a1.Count() == 4000);
+        CHECK(a1.Capacity() == capacity);
+    }
+
+    SECTION("Test Add/Remove")
+    {
+        FlatHashSet<int32> a1;
+        for (int32 i = 0; i < 4000; i++)
+        {
+            a1.Add(i);
+            a1.Remove(i);
+        }
+        CHECK(a1.Count() == 0);
+        CHECK(a1.Capacity() <= DICTIONARY_DEFAULT_CAPACITY);
+        for (int32 i = 1; i <= 10; i++)
+            a1.Add(-i);
+        for (int32 i = 0; i < 4000; i++)
+        {
+            a1.Add(i);
+            a1.Remove(i);
+        }
+        CHECK(a1.Count() == 10);
+        CHECK(a1.Capacity() <= DICTIONARY_DEFAULT_CAPACITY);
+        int32 count = 0;
+        for (const auto& e : a1)
+        {
+            CHECK(e.Item < 0);
+            count++;
+        }
+        CHECK(count == 10);
+    }
+}
+
+TEST_CASE("FlatDictionary")
+{
+    SECTION("Test Allocators")
+    {
+        FlatDictionary<int32, int32> a1;
+        FlatDictionary<int32, int32, InlinedAllocation<32>> a2;
+        FlatDictionary<int32, int32, FixedAllocation<32>> a3;
+        for (int32 i = 0; i < 20; i++)
+        {
+            a1.Add(i, i);
+            a2.Add(i, i);
+            a3.Add(i, i);
+        }
+        CHECK(a1.Count() == 20);
+        CHECK(a2.Count() == 20);
+        CHECK(a3.Count() == 20);
+        for (int32 i = 0; i < 20; i++)
+        {
+            CHECK(a1.ContainsKey(i));
+            CHECK(a2.ContainsKey(i));
+            CHECK(a3.ContainsKey(i));
+            CHECK(a1[i] == i);
+            CHECK(a2[i] == i);
+            CHECK(a3[i] == i);
+        }
+    }
+
+    SECTION("Test Copy and Move")
+    {
+        FlatDictionary<int32, int32> a1;
+        for (int32 i = 0; i < 100; i++)
+            a1.Add(i, i * 2);
+        FlatDictionary<int32, int32> a2(a1);
+        CHECK(a2.Count() == 100);
+        FlatDictionary<int32, int32> a3(MoveTemp(a1));
+        CHECK(a1.Count() == 0);
+        CHECK(a3.Count() == 100);
+        for (int32 i = 0; i < 100; i++)
+        {
+            CHECK(a2.At(i) == i * 2);
+            CHECK(a3.At(i) == i * 2);
+        }
+    }
+
+    SECTION("Test Add/Remove")
+    {
+        // Compare against Dictionary with random inserts and removals
+        FlatDictionary<int32, int32> a1;
+        Dictionary<int32, int32> a2;
+        RandomStream rand(101);
+        for (int32 i = 0; i < 20000; i++)
+        {
+            const int32 key = rand.RandRange(0, 1000);
+            if (rand.GetFraction() < 0.5f)
+            {
+                a1[key] = i;
+                a2[key] = i;
+            }
+            else
+            {
+                CHECK(a1.Remove(key) == a2.Remove(key));
+            }
+        }
+        CHECK(a1.Count() == a2.Count());
+        for (auto& e : a2)
+        {
+            int32 value;
+            CHECK(a1.TryGet(e.Key, value));
+            CHECK(value == e.Value);
+        }
+        for (auto i = a1.Begin(); i.IsNotEnd(); ++i)
+        {
+            if (i->Key % 2 == 0)
+                a1.Remove(i);
+        }
+        for (auto& e : a2)
+            CHECK(a1.ContainsKey(e.Key) == (e.Key % 2 != 0));
+    }
+}
+
+TEST_CASE("SoAArray")
+{
+    SECTION("Test Layout")
+    {
+        SoAArray<int32, float, byte> a1;
+        for (int32 i = 0; i < 100; i++)
+            CHECK(a1.Add(i, (float)i * 0.5f, (byte)i) == i);
+        CHECK(a1.Count() == 100);
+        CHECK(a1.Capacity() % SOA_ARRAY_CAPACITY_GRANULARITY == 0);
+        CHECK(((uintptr)a1.Get<0>() % SOA_ARRAY_ALIGNMENT) == 0);
+        CHECK(((uintptr)a1.Get<1>() % SOA_ARRAY_ALIGNMENT) == 0);
+        CHECK(((uintptr)a1.Get<2>() % SOA_ARRAY_ALIGNMENT) == 0);
+        CHECK(a1.GetSpan<1>().Length() == 100);
+        for (int32 i = 0; i < 100; i++)
+        {
+            CHECK(a1.Get<0>(i) == i);
+            CHECK(a1.Get<1>()[i] == (float)i * 0.5f);
+            CHECK(a1.Get<2>(i) == (byte)i);
+        }
+    }
+
+    SECTION("Test Add/Remove")
+    {
+        SoAArray<int32, Array<int32>> a1;
+        for (int32 i = 0; i < 50; i++)
+        {
+            Array<int32> items;
+            items.Add(i);
+            a1.Add(i, MoveTemp(items));
+        }
+        a1.RemoveAt(10);
+        CHECK(a1.Count() == 49);
+        CHECK(a1.Get<0>(10) == 49);
+        CHECK(a1.Get<1>(10)[0] == 49);
+        a1.RemoveAt(a1.Count() - 1);
+        CHECK(a1.Count() == 48);
+        for (int32 i = 0; i < a1.Count(); i++)
+            CHECK(a1.Get<1>(i)[0] == a1.Get<0>(i));
+
+        SoAArray<int32, Array<int32>> a2(a1);
+        CHECK(a2.Count() == 48);
+        SoAArray<int32, Array<int32>> a3(MoveTemp(a1));
+        CHECK(a1.Count() == 0);
+        CHECK(a3.Count() == 48);
+        for (int32 i = 0; i < 48; i++)
+        {
+            CHECK(a2.Get<1>(i)[0] == a2.Get<0>(i));
+            CHECK(a3.Get<0>(i) == a2.Get<0>(i));
+        }
+        a2.Clear();
+        CHECK(a2.IsEmpty());
+        CHECK(a2.Capacity() != 0);
+    }
+}
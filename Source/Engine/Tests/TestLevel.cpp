@@ -1,10 +1,14 @@
 // Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
 
 #include "Engine/Core/Math/Vector3.h"
+#include "Engine/Core/Math/BoundingFrustum.h"
+#include "Engine/Core/Math/Matrix.h"
 #include "Engine/Core/Types/String.h"
 #include "Engine/Core/Types/StringView.h"
 #include "Engine/Level/LargeWorlds.h"
+#include "Engine/Level/Actors/EmptyActor.h"
 #include "Engine/Level/Tags.h"
+#include "Engine/Level/Scene/SceneRenderingTree.h"
 #include <ThirdParty/catch2/catch.hpp>
 
 TEST_CASE("LargeWorlds")
@@ -20,6 +24,79 @@ TEST_CASE("LargeWorlds")
     }
 }
 
+namespace
+{
+    bool CullContains(const SceneRenderingTree& tree, const BoundingFrustum& frustum, int32 key)
+    {
+        Array<Span<int32>> nodes;
+        tree.Cull(&frustum, 1, Vector3::Zero, nodes);
+        for (const Span<int32>& items : nodes)
+        {
+            for (int32 i = 0; i < items.Length(); i++)
+            {
+                if (items[i] == key)
+                    return true;
+            }
+        }
+        return false;
+    }
+
+    int32 CullCount(const SceneRenderingTree& tree, const BoundingFrustum& frustum)
+    {
+        Array<Span<int32>> nodes;
+        tree.Cull(&frustum, 1, Vector3::Zero, nodes);
+        int32 count = 0;
+        for (const Span<int32>& items : nodes)
+            count += items.Length();
+        return count;
+    }
+}
+
+TEST_CASE("SceneRenderingTree")
+{
+    // Orthographic view looking at the area around the world origin
+    Matrix view, projection, viewProjection;
+    Matrix::LookAt(Vector3(0, 0, -500), Vector3(0, 0, 1000), Vector3::Up, view);
+    Matrix::Ortho(1000, 1000, 0, 2000, projection);
+    Matrix::Multiply(view, projection, viewProjection);
+    const BoundingFrustum frustum(viewProjection);
+
+    SceneRenderingTree tree;
+    for (int32 i = 0; i < 1000; i++)
+        tree.Add(i, BoundingSphere(Vector3((Real)(i - 500) * 200.0f, 0, 0), 10.0f));
+    CHECK(tree.Count() == 1000);
+
+    SECTION("Cull")
+    {
+        for (int32 i = 498; i <= 502; i++)
+            CHECK(CullContains(tree, frustum, i));
+        CHECK(CullCount(tree, frustum) < 1000);
+    }
+
+    SECTION("Update")
+    {
+        CHECK(!CullContains(tree, frustum, 0));
+        tree.Update(0, BoundingSphere(Vector3(100, 100, 0), 10.0f));
+        CHECK(CullContains(tree, frustum, 0));
+        tree.Update(500, BoundingSphere(Vector3(90000, 0, 0), 10.0f));
+        CHECK(!CullContains(tree, frustum, 500));
+        CHECK(tree.Count() == 1000);
+    }
+
+    SECTION("Remove")
+    {
+        tree.Remove(500);
+        CHECK(!tree.Contains(500));
+        CHECK(!CullContains(tree, frustum, 500));
+        CHECK(CullContains(tree, frustum, 501));
+        CHECK(tree.Count() == 999);
+        for (int32 i = 0; i < 1000; i++)
+            tree.Remove(i);
+        CHECK(tree.Count() == 0);
+        CHECK(CullCount(tree, frustum) == 0);
+    }
+}
+
 TEST_CASE("Tags")
 {
     SECTION("Tag")
@@ -68,3 +145,38 @@ TEST_CASE("Tags")
         Tags::List = prevTags;
     }
 }
+
+TEST_CASE("ActorTransform")
+{
+    SECTION("Deferred Updates")
+    {
+        EmptyActor* root = EmptyActor::Spawn(ScriptingObject::SpawnParams(Guid::New(), EmptyActor::TypeInitializer));
+        EmptyActor* child = EmptyActor::Spawn(ScriptingObject::SpawnParams(Guid::New(), EmptyActor::TypeInitializer));
+        EmptyActor* leaf = EmptyActor::Spawn(ScriptingObject::SpawnParams(Guid::New(), EmptyActor::TypeInitializer));
+        child->SetParent(root);
+        leaf->SetParent(child);
+        child->SetLocalPosition(Vector3(0, 10, 0));
+        leaf->SetLocalPosition(Vector3(0, 0, 5));
+
+        // Children get updated at the end of the scope
+        Actor::BeginTransformUpdates();
+        root->SetPosition(Vector3(100, 0, 0));
+        root->SetPosition(Vector3(200, 0, 0));
+        CHECK(root->GetPosition() == Vector3(200, 0, 0));
+        CHECK(leaf->GetPosition() == Vector3(0, 10, 5));
+        Actor::EndTransformUpdates();
+        CHECK(child->GetPosition() == Vector3(200, 10, 0));
+        CHECK(leaf->GetPosition() == Vector3(200, 10, 5));
+
+        // World-space change of the child applies pending parent transformation first
+        Actor::BeginTransformUpdates();
+        root->SetPosition(Vector3(300, 0, 0));
+        leaf->SetPosition(Vector3(0, 0, 0));
+        Actor::EndTransformUpdates();
+        CHECK(child->GetPosition() == Vector3(300, 10, 0));
+        CHECK(leaf->GetPosition() == Vector3(0, 0, 0));
+        CHECK(leaf->GetLocalPosition() == Vector3(-300, -10, 0));
+
+        root->DeleteObject();
+    }
+}
@@ -24,6 +24,10 @@ class TestsRunnerService : public EngineService
 
 TestsRunnerService TestsRunnerServiceInstance;
 
+#if FLAX_BENCHMARKS
+extern bool BenchmarkResultsReport();
+#endif
+
 void TestsRunnerService::Update()
 {
     // End if failed to perform a startup
@@ -39,10 +43,20 @@ void TestsRunnerService::Update()
         !Scripting::HasGameModulesLoaded())
         return;
 
+#if FLAX_BENCHMARKS
+    // Runs benchmarks
+    Log::Logger::WriteFloor();
+    LOG(Info, "Running Flax Benchmarks...");
+    const char* args[] = { "FlaxBenchmarks", "[benchmark]" };
+    int result = Catch::Session().run(ARRAY_COUNT(args), args);
+    if (result == 0 && BenchmarkResultsReport())
+        result = 1;
+#else
     // Runs tests
     Log::Logger::WriteFloor();
     LOG(Info, "Running Flax Tests...");
     const int result = Catch::Session().run();
+#endif
     if (result == 0)
         LOG(Info, "Result: {0}", result);
     else
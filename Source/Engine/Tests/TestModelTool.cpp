@@ -1,6 +1,7 @@
 // Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
 
 #include "Engine/Tools/ModelTool/ModelTool.h"
+#include "Engine/Graphics/Models/Types.h"
 #include <ThirdParty/catch2/catch.hpp>
 
 TEST_CASE("ModelTool")
@@ -21,4 +22,26 @@ TEST_CASE("ModelTool")
         CHECK(ModelTool::DetectLodIndex(TEXT("mesh_lod_1")) == 1);
         CHECK(ModelTool::DetectLodIndex(TEXT("mesh lod_2")) == 2);
     }
+
+    SECTION("Test PositionsQuantization")
+    {
+        PositionsQuantization quantization;
+        quantization.Init(Float3(-10.0f, 2.0f, 5.0f), Float3(30.0f, 4.0f, 5.0f));
+        CHECK(quantization.IsValid());
+        const Float3 tolerance = quantization.Scale / (float)MAX_uint16;
+        const Float3 positions[] = { Float3(-10.0f, 2.0f, 5.0f), Float3(30.0f, 4.0f, 5.0f), Float3(1.2345f, 3.3333f, 5.0f) };
+        for (const Float3& position : positions)
+        {
+            VB0QuantizedElementType value;
+            quantization.Encode(position, value);
+            const Float3 decoded = quantization.Decode(value);
+            CHECK(Math::Abs(decoded.X - position.X) <= tolerance.X);
+            CHECK(Math::Abs(decoded.Y - position.Y) <= tolerance.Y);
+            CHECK(Math::Abs(decoded.Z - position.Z) <= tolerance.Z);
+        }
+        VB0QuantizedElementType value;
+        quantization.Encode(Float3(100.0f, -100.0f, 5.0f), value);
+        CHECK(value.Position[0] == MAX_uint16);
+        CHECK(value.Position[1] == 0);
+    }
 }
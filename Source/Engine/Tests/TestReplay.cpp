@@ -0,0 +1,62 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "Engine/Engine/Replay.h"
+#include "Engine/Engine/Globals.h"
+#include "Engine/Core/Types/String.h"
+#include "Engine/Platform/FileSystem.h"
+#include <ThirdParty/catch2/catch.hpp>
+
+TEST_CASE("Replay")
+{
+    SECTION("Test Record And Playback")
+    {
+        FileSystem::CreateDirectory(Globals::TemporaryFolder);
+        const String path = Globals::TemporaryFolder / TEXT("Test.flaxreplay");
+        const int64 tick0 = 166666, tick1 = 333333;
+
+        // Record two frames (empty loop iterations are skipped)
+        REQUIRE(!Replay::StartRecording(path));
+        CHECK(Replay::IsRecording());
+        const uint32 seed = Replay::GetRandomSeed();
+        Replay::OnFrame();
+        Replay::Write(ReplayRecordType::Tick, 0, &tick0, sizeof(tick0));
+        Replay::Write(ReplayRecordType::InputEvent, 1, "a", 1);
+        Replay::Write(ReplayRecordType::InputEvent, 1, "b", 1);
+        Replay::Write(ReplayRecordType::NetworkEvent, 2, nullptr, 0);
+        Replay::OnFrame();
+        Replay::OnFrame();
+        Replay::Write(ReplayRecordType::Tick, 0, &tick1, sizeof(tick1));
+        Replay::Stop();
+        CHECK(!Replay::IsActive());
+        CHECK(Replay::GetFrame() == 2);
+
+        // Play it back
+        REQUIRE(!Replay::StartPlayback(path));
+        CHECK(Replay::IsPlaying());
+        CHECK(Replay::GetRandomSeed() == seed);
+        Span<byte> data;
+        Replay::OnFrame();
+        REQUIRE(Replay::Read(ReplayRecordType::Tick, 0, data));
+        REQUIRE(data.Length() == sizeof(int64));
+        CHECK(*(const int64*)data.Get() == tick0);
+        CHECK(!Replay::Read(ReplayRecordType::Tick, 0, data));
+        CHECK(!Replay::Read(ReplayRecordType::Tick, 1, data));
+        CHECK(!Replay::Read(ReplayRecordType::InputEvent, 0, data));
+        REQUIRE(Replay::Read(ReplayRecordType::InputEvent, 1, data));
+        CHECK(data.Length() == 1);
+        CHECK(data[0] == 'a');
+        REQUIRE(Replay::Read(ReplayRecordType::InputEvent, 1, data));
+        CHECK(data[0] == 'b');
+        CHECK(!Replay::Read(ReplayRecordType::InputEvent, 1, data));
+        REQUIRE(Replay::Read(ReplayRecordType::NetworkEvent, 2, data));
+        CHECK(data.Length() == 0);
+        Replay::OnFrame();
+        REQUIRE(Replay::Read(ReplayRecordType::Tick, 0, data));
+        CHECK(*(const int64*)data.Get() == tick1);
+        CHECK(!Replay::Read(ReplayRecordType::InputEvent, 1, data));
+        Replay::OnFrame();
+        CHECK(!Replay::IsPlaying());
+
+        FileSystem::DeleteFile(path);
+    }
+}
@@ -4,22 +4,164 @@
 
 #include "ConcurrentQueue.h"
 #include "Task.h"
+#include "Engine/Platform/Platform.h"
+#include "Engine/Platform/CriticalSection.h"
+#include "Engine/Platform/ConditionVariable.h"
 
 /// <summary>
-/// Lock-free implementation of thread-safe tasks queue.
+/// Lock-free implementation of thread-safe tasks queue (multi-producer, multi-consumer). Supports blocking wait for the tasks that wakes up a single waiting consumer per added task.
 /// </summary>
-template<typename T = Task>
-class ConcurrentTaskQueue : public ConcurrentQueue<T*>
+/// <remarks>
+/// Uses a bounded ring buffer with per-cell sequence numbers (Vyukov's MPMC queue) so enqueue and dequeue are a single CAS in most cases. When the ring is full, tasks are added to the unbounded overflow queue.
+/// </remarks>
+template<typename T = Task, int32 Capacity = 1024>
+class ConcurrentTaskQueue
 {
+    static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "Queue capacity has to be a power of two.");
+
+private:
+    struct Cell
+    {
+        volatile int64 Sequence;
+        T* Item;
+    };
+
+    volatile int64 _enqueuePos = 0;
+    byte _padding1[PLATFORM_CACHE_LINE_SIZE - sizeof(int64)];
+    volatile int64 _dequeuePos = 0;
+    byte _padding2[PLATFORM_CACHE_LINE_SIZE - sizeof(int64)];
+    volatile int64 _waitingCount = 0;
+    Cell _cells[Capacity];
+    ConcurrentQueue<T*> _overflow;
+    CriticalSection _locker;
+    ConditionVariable _signal;
+
+public:
+    ConcurrentTaskQueue()
+    {
+        for (int32 i = 0; i < Capacity; i++)
+        {
+            _cells[i].Sequence = i;
+            _cells[i].Item = nullptr;
+        }
+    }
+
+    ConcurrentTaskQueue(const ConcurrentTaskQueue&) = delete;
+    ConcurrentTaskQueue& operator=(const ConcurrentTaskQueue&) = delete;
+
 public:
+    /// <summary>
+    /// Gets an estimate of the total number of tasks currently in the queue.
+    /// </summary>
+    int32 Count() const
+    {
+        const int64 count = Platform::AtomicRead(&_enqueuePos) - Platform::AtomicRead(&_dequeuePos);
+        return (int32)(count > 0 ? count : 0) + _overflow.Count();
+    }
 
     /// <summary>
-    /// Adds item to the collection (thread-safe).
+    /// Adds item to the collection (thread-safe). Wakes up one of the waiting consumers.
     /// </summary>
     /// <param name="item">Item to add.</param>
-    FORCE_INLINE void Add(T* item)
+    void Add(T* item)
     {
-        ConcurrentQueue<T*>::enqueue(item);
+        Push(item);
+        Notify(1);
+    }
+
+    /// <summary>
+    /// Adds items to the collection (thread-safe). Wakes up the waiting consumers.
+    /// </summary>
+    /// <param name="items">Items to add.</param>
+    /// <param name="count">The amount of items to add.</param>
+    void Add(T* const* items, int32 count)
+    {
+        for (int32 i = 0; i < count; i++)
+            Push(items[i]);
+        Notify(count);
+    }
+
+    /// <summary>
+    /// Tries to dequeue the item from the collection (thread-safe), doesn't block.
+    /// </summary>
+    /// <param name="item">The result item.</param>
+    /// <returns>True if got item, otherwise false if queue is empty.</returns>
+    bool try_dequeue(T*& item)
+    {
+        int64 pos = Platform::AtomicRead(&_dequeuePos);
+        while (true)
+        {
+            Cell& cell = _cells[pos & (Capacity - 1)];
+            const int64 diff = Platform::AtomicRead(&cell.Sequence) - (pos + 1);
+            if (diff == 0)
+            {
+                const int64 prev = Platform::InterlockedCompareExchange(&_dequeuePos, pos + 1, pos);
+                if (prev == pos)
+                {
+                    item = cell.Item;
+                    Platform::AtomicStore(&cell.Sequence, pos + Capacity);
+                    return true;
+                }
+                pos = prev;
+            }
+            else if (diff < 0)
+            {
+                // Ring is empty
+                return _overflow.try_dequeue(item);
+            }
+            else
+            {
+                pos = Platform::AtomicRead(&_dequeuePos);
+            }
+        }
+    }
+
+    /// <summary>
+    /// Tries to dequeue multiple items from the collection (thread-safe), doesn't block.
+    /// </summary>
+    /// <param name="items">The output items buffer.</param>
+    /// <param name="maxCount">The maximum amount of items to dequeue.</param>
+    /// <returns>The amount of dequeued items.</returns>
+    int32 try_dequeue_bulk(T** items, int32 maxCount)
+    {
+        int32 count = 0;
+        while (count < maxCount && try_dequeue(items[count]))
+            count++;
+        return count;
+    }
+
+    /// <summary>
+    /// Dequeues the item from the collection (thread-safe). Blocks the calling thread until any item gets added or the exit flag gets set (see NotifyAll).
+    /// </summary>
+    /// <param name="item">The result item.</param>
+    /// <param name="exitFlag">The flag that stops the waiting when not zero.</param>
+    /// <returns>True if got item, otherwise false if exit flag has been set.</returns>
+    bool Dequeue(T*& item, const volatile int64& exitFlag)
+    {
+        while (Platform::AtomicRead(&exitFlag) == 0)
+        {
+            if (try_dequeue(item))
+                return true;
+
+            // Check the queue after marking thread as waiting to not miss the notification from Add
+            Platform::InterlockedIncrement(&_waitingCount);
+            _locker.Lock();
+            if (Count() == 0 && Platform::AtomicRead(&exitFlag) == 0)
+                _signal.Wait(_locker);
+            _locker.Unlock();
+            Platform::InterlockedDecrement(&_waitingCount);
+        }
+        return false;
+    }
+
+    /// <summary>
+    /// Wakes up all threads waiting in Dequeue (eg. to check the exit flag).
+    /// </summary>
+    void NotifyAll()
+    {
+        _locker.Lock();
+        _signal.NotifyAll();
+        _locker.Unlock();
     }
 
     /// <summary>
@@ -27,14 +169,53 @@ class ConcurrentTaskQueue : public ConcurrentQueue<T*>
     /// </summary>
     void CancelAll()
     {
-        T* tasks[16];
-        std::size_t count;
-        while ((count = ConcurrentQueue<T*>::try_dequeue_bulk(tasks, ARRAY_COUNT(tasks))) != 0)
+        T* task;
+        while (try_dequeue(task))
+            task->Cancel();
+    }
+
+private:
+    void Push(T* item)
+    {
+        int64 pos = Platform::AtomicRead(&_enqueuePos);
+        while (true)
         {
-            for (std::size_t i = 0; i != count; i++)
+            Cell& cell = _cells[pos & (Capacity - 1)];
+            const int64 diff = Platform::AtomicRead(&cell.Sequence) - pos;
+            if (diff == 0)
             {
-                tasks[i]->Cancel();
+                const int64 prev = Platform::InterlockedCompareExchange(&_enqueuePos, pos + 1, pos);
+                if (prev == pos)
+                {
+                    cell.Item = item;
+                    Platform::AtomicStore(&cell.Sequence, pos + 1);
+                    return;
+                }
+                pos = prev;
+            }
+            else if (diff < 0)
+            {
+                // Ring is full
+                _overflow.enqueue(item);
+                return;
+            }
+            else
+            {
+                pos = Platform::AtomicRead(&_enqueuePos);
             }
         }
     }
+
+    void Notify(int32 count)
+    {
+        // Wake up only if any thread is waiting (interlocked ops order it against thread going to sleep in Dequeue)
+        if (Platform::AtomicRead(&_waitingCount) == 0)
+            return;
+        _locker.Lock();
+        if (count == 1)
+            _signal.NotifyOne();
+        else
+            _signal.NotifyAll();
+        _locker.Unlock();
+    }
 };
@@ -2,33 +2,34 @@
 
 #include "JobSystem.h"
 #include "IRunnable.h"
+#include "ConcurrentQueue.h"
 #include "Engine/Platform/CPUInfo.h"
 #include "Engine/Platform/Thread.h"
 #include "Engine/Platform/ConditionVariable.h"
-#include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Core/Collections/Array.h"
 #include "Engine/Engine/EngineService.h"
 #include "Engine/Profiler/ProfilerCPU.h"
 #if USE_CSHARP
 #include "Engine/Scripting/ManagedCLR/MCore.h"
 #endif
 
-// Jobs storage perf info:
-// (500 jobs, i7 9th gen)
-// JOB_SYSTEM_USE_MUTEX=1, enqueue=130-280 cycles, dequeue=2-6 cycles
-// JOB_SYSTEM_USE_MUTEX=0, enqueue=300-700 cycles, dequeue=10-16 cycles
-// So using RingBuffer+Mutex+Signals is better than moodycamel::ConcurrentQueue
+// Jobs scheduling overview:
+// - each job thread owns a work-stealing deque (owner pushes/pops at the bottom, other threads steal from the top)
+// - jobs dispatched from outside the job system are pushed into the global lock-free queue
+// - job threads process own queue first, then the global queue, then try to steal from other threads
+// - each priority uses separate queues, higher priority queues are processed first and background jobs are run by a limited amount of threads at once
+// - each dispatch uses a context slot with atomic counter of the jobs left (no locks on job completion)
+// - dispatch can depend on other dispatches, its jobs get enqueued by the last job of the last dependency (continuation)
+// - queued job is a range of indices, thread that runs it splits the remaining part in half into own queue whenever that queue is empty (lazy binary splitting)
 
 #define JOB_SYSTEM_ENABLED 1
-#define JOB_SYSTEM_USE_MUTEX 1
-#define JOB_SYSTEM_USE_STATS 0
+#define JOB_SYSTEM_USE_STATS COMPILE_WITH_PROFILER
+#define JOB_SYSTEM_QUEUE_SIZE 1024 // Capacity of the per-thread jobs queue (power of two)
+#define JOB_SYSTEM_CONTEXTS_COUNT 4096 // Max amount of the in-flight dispatches (power of two)
+#define JOB_SYSTEM_PRIORITIES (int32)JobPriority::MAX
 
 #if JOB_SYSTEM_USE_STATS
-#include "Engine/Core/Log.h"
-#endif
-#if JOB_SYSTEM_USE_MUTEX
-#include "Engine/Core/Collections/RingBuffer.h"
-#else
-#include "ConcurrentQueue.h"
+#include "WorkerStats.h"
 #endif
 
 #if JOB_SYSTEM_ENABLED
@@ -46,17 +47,100 @@ class JobSystemService : public EngineService
     void Dispose() override;
 };
 
-struct JobData
+struct JobContext
 {
+    // Label of the dispatch that uses this context (0 if context is free)
+    volatile int64 Label;
+    volatile int64 JobsLeft;
+    // Amount of dependencies that are not yet done (jobs get enqueued when it reaches zero)
+    volatile int64 DependenciesLeft;
+    // Amount of dispatches that are registered (or being registered) as waiting for this context
+    volatile int64 DependantsCount;
+    int32 JobsCount;
+    int32 GrainSize;
+    JobPriority Priority;
     Function<void(int32)> Job;
-    int32 Index;
-    int64 JobKey;
+    Array<JobContext*> Dependants;
+};
+
+struct JobData
+{
+    JobContext* Context;
+    int32 Start;
+    int32 End;
+#if JOB_SYSTEM_USE_STATS
+    uint64 EnqueueTime;
+#endif
 };
 
 template<>
 struct TIsPODType<JobData>
 {
-    enum { Value = false };
+    enum { Value = true };
+};
+
+/// <summary>
+/// Fixed-capacity work-stealing deque (Chase-Lev). Push and Pop can be called only by the owning thread, Steal can be called by any thread.
+/// </summary>
+class JobQueue
+{
+private:
+    volatile int64 _top = 0;
+    byte _padding1[PLATFORM_CACHE_LINE_SIZE - sizeof(int64)];
+    volatile int64 _bottom = 0;
+    byte _padding2[PLATFORM_CACHE_LINE_SIZE - sizeof(int64)];
+    JobData _items[JOB_SYSTEM_QUEUE_SIZE];
+
+public:
+    FORCE_INLINE int64 Count() const
+    {
+        const int64 count = Platform::AtomicRead(&_bottom) - Platform::AtomicRead(&_top);
+        return count > 0 ? count : 0;
+    }
+
+    bool Push(const JobData& data)
+    {
+        const int64 bottom = Platform::AtomicRead(&_bottom);
+        const int64 top = Platform::AtomicRead(&_top);
+        if (bottom - top >= JOB_SYSTEM_QUEUE_SIZE)
+            return false;
+        _items[bottom & (JOB_SYSTEM_QUEUE_SIZE - 1)] = data;
+        Platform::AtomicStore(&_bottom, bottom + 1);
+        return true;
+    }
+
+    bool Pop(JobData& data)
+    {
+        const int64 bottom = Platform::AtomicRead(&_bottom) - 1;
+        Platform::AtomicStore(&_bottom, bottom);
+        Platform::MemoryBarrier();
+        const int64 top = Platform::AtomicRead(&_top);
+        if (top > bottom)
+        {
+            // Empty
+            Platform::AtomicStore(&_bottom, bottom + 1);
+            return false;
+        }
+        data = _items[bottom & (JOB_SYSTEM_QUEUE_SIZE - 1)];
+        if (top != bottom)
+            return true;
+
+        // Last item so race against stealing threads
+        const bool result = Platform::InterlockedCompareExchange(&_top, top + 1, top) == top;
+        Platform::AtomicStore(&_bottom, bottom + 1);
+        return result;
+    }
+
+    bool Steal(JobData& data)
+    {
+        const int64 top = Platform::AtomicRead(&_top);
+        Platform::MemoryBarrier();
+        const int64 bottom = Platform::AtomicRead(&_bottom);
+        if (top >= bottom)
+            return false;
+        data = _items[top & (JOB_SYSTEM_QUEUE_SIZE - 1)];
+        return Platform::InterlockedCompareExchange(&_top, top + 1, top) == top;
+    }
 };
 
 class JobSystemThread : public IRunnable
@@ -79,45 +163,46 @@ class JobSystemThread : public IRunnable
     }
 };
 
-struct JobContext
-{
-    volatile int64 JobsLeft;
-};
-
-template<>
-struct TIsPODType<JobContext>
-{
-    enum { Value = true };
-};
-
 namespace
 {
     JobSystemService JobSystemInstance;
     Thread* Threads[PLATFORM_THREADS_LIMIT / 2] = {};
+    JobQueue* Queues[ARRAY_COUNT(Threads)][JOB_SYSTEM_PRIORITIES] = {};
     int32 ThreadsCount = 0;
+    int32 BackgroundThreadsLimit = 0;
+    volatile int64 BackgroundThreads = 0;
     bool JobStartingOnDispatch = true;
     volatile int64 ExitFlag = 0;
     volatile int64 JobLabel = 0;
-    Dictionary<int64, JobContext> JobContexts;
+    volatile int64 ActiveContexts = 0;
+    volatile int64 SleepingThreads = 0;
+    volatile int64 WaitingThreads = 0;
+    JobContext JobContexts[JOB_SYSTEM_CONTEXTS_COUNT];
+    ConcurrentQueue<JobData> Jobs[JOB_SYSTEM_PRIORITIES];
     ConditionVariable JobsSignal;
-    CriticalSection JobsMutex;
+    CriticalSection JobsMutex("JobSystem.Jobs");
     ConditionVariable WaitSignal;
-    CriticalSection WaitMutex;
-    CriticalSection JobsLocker;
-#if JOB_SYSTEM_USE_MUTEX
-    RingBuffer<JobData> Jobs;
-#else
-    ConcurrentQueue<JobData> Jobs;
-#endif
+    CriticalSection WaitMutex("JobSystem.Wait");
+    CriticalSection DependenciesLocker("JobSystem.Dependencies");
+    THREADLOCAL int32 ThreadQueueIndex = -1;
 #if JOB_SYSTEM_USE_STATS
-    int64 DequeueCount = 0;
-    int64 DequeueSum = 0;
+    struct alignas(PLATFORM_CACHE_LINE_SIZE) JobSystemThreadStats : WorkerStats
+    {
+    };
+
+    JobSystemThreadStats ThreadsStats[ARRAY_COUNT(Threads)];
 #endif
 }
 
 bool JobSystemService::Init()
 {
     ThreadsCount = Math::Min<int32>(Platform::GetCPUInfo().LogicalProcessorCount, ARRAY_COUNT(Threads));
+    BackgroundThreadsLimit = Math::Max(ThreadsCount / 2, 1);
+    for (int32 i = 0; i < ThreadsCount; i++)
+    {
+        for (int32 priority = 0; priority < JOB_SYSTEM_PRIORITIES; priority++)
+            Queues[i][priority] = New<JobQueue>();
+    }
     for (int32 i = 0; i < ThreadsCount; i++)
     {
         auto runnable = New<JobSystemThread>();
@@ -133,13 +218,20 @@ bool JobSystemService::Init()
 void JobSystemService::BeforeExit()
 {
     Platform::AtomicStore(&ExitFlag, 1);
+    JobsMutex.Lock();
     JobsSignal.NotifyAll();
+    JobsMutex.Unlock();
+    WaitMutex.Lock();
+    WaitSignal.NotifyAll();
+    WaitMutex.Unlock();
 }
 
 void JobSystemService::Dispose()
 {
     Platform::AtomicStore(&ExitFlag, 1);
+    JobsMutex.Lock();
     JobsSignal.NotifyAll();
+    JobsMutex.Unlock();
     Platform::Sleep(1);
 
     for (int32 i = 0; i < ThreadsCount; i++)
@@ -151,41 +243,283 @@ void JobSystemService::Dispose()
             Threads[i] = nullptr;
         }
     }
+    for (int32 i = 0; i < ThreadsCount; i++)
+    {
+        for (int32 priority = 0; priority < JOB_SYSTEM_PRIORITIES; priority++)
+        {
+            Delete(Queues[i][priority]);
+            Queues[i][priority] = nullptr;
+        }
+    }
 }
 
-int32 JobSystemThread::Run()
+namespace
 {
-    Platform::SetThreadAffinityMask(1ull << Index);
+    FORCE_INLINE bool CanRunBackgroundJob()
+    {
+        return Platform::AtomicRead(&BackgroundThreads) < BackgroundThreadsLimit;
+    }
 
-    JobData data;
-    bool attachCSharpThread = true;
-#if !JOB_SYSTEM_USE_MUTEX
-    moodycamel::ConsumerToken consumerToken(Jobs);
+    bool HasJobs(int32 priority)
+    {
+        if (Jobs[priority].Count() != 0)
+            return true;
+        for (int32 i = 0; i < ThreadsCount; i++)
+        {
+            if (Queues[i][priority]->Count() != 0)
+                return true;
+        }
+        return false;
+    }
+
+    bool HasJobs(int32 maxPriority, bool backgroundLimit)
+    {
+        for (int32 priority = 0; priority <= maxPriority; priority++)
+        {
+            if (backgroundLimit && priority == (int32)JobPriority::Background && !CanRunBackgroundJob())
+                break;
+            if (HasJobs(priority))
+                return true;
+        }
+        return false;
+    }
+
+    void NotifyJobs(int32 count)
+    {
+        // Wake up only if any thread is sleeping (interlocked ops order it against thread going to sleep in JobSystemThread::Run)
+        if (Platform::AtomicRead(&SleepingThreads) == 0)
+            return;
+        JobsMutex.Lock();
+        if (count == 1)
+            JobsSignal.NotifyOne();
+        else
+            JobsSignal.NotifyAll();
+        JobsMutex.Unlock();
+    }
+
+    bool TryGetJob(int32 threadIndex, int32 priority, JobData& data)
+    {
+        // Own queue
+        if (threadIndex != -1 && Queues[threadIndex][priority]->Pop(data))
+            return true;
+
+        // Global queue
+        if (Jobs[priority].try_dequeue(data))
+            return true;
+
+        // Steal from other threads
+        for (int32 i = 1; i <= ThreadsCount; i++)
+        {
+            const int32 victim = (threadIndex + i) % ThreadsCount;
+            if (victim != threadIndex && Queues[victim][priority]->Steal(data))
+            {
+#if JOB_SYSTEM_USE_STATS
+                if (threadIndex != -1)
+                    ThreadsStats[threadIndex].StealsCount++;
 #endif
-    while (Platform::AtomicRead(&ExitFlag) == 0)
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool TryGetJob(int32 threadIndex, int32 maxPriority, bool backgroundLimit, JobData& data, bool& usesBackgroundSlot)
     {
-        // Try to get a job
+        usesBackgroundSlot = false;
+        for (int32 priority = 0; priority <= maxPriority; priority++)
+        {
+            // Reserve slot for background job before taking it to not exceed the limit
+            const bool limited = backgroundLimit && priority == (int32)JobPriority::Background;
+            if (limited && Platform::InterlockedIncrement(&BackgroundThreads) > BackgroundThreadsLimit)
+            {
+                Platform::InterlockedDecrement(&BackgroundThreads);
+                break;
+            }
+            if (TryGetJob(threadIndex, priority, data))
+            {
+                usesBackgroundSlot = limited;
+                return true;
+            }
+            if (limited)
+                Platform::InterlockedDecrement(&BackgroundThreads);
+        }
+        return false;
+    }
+
+    void EnqueueJob(JobData& data)
+    {
+        // Job threads use own queue (if not full), others go via global queue
+        const int32 priority = (int32)data.Context->Priority;
 #if JOB_SYSTEM_USE_STATS
-        const auto start = Platform::GetTimeCycles();
+        data.EnqueueTime = Platform::GetTimeCycles();
 #endif
-#if JOB_SYSTEM_USE_MUTEX
-        JobsLocker.Lock();
-        if (Jobs.Count() != 0)
+        if (ThreadQueueIndex == -1 || !Queues[ThreadQueueIndex][priority]->Push(data))
+            Jobs[priority].enqueue(data);
+    }
+
+    void StartJobs(JobContext* context)
+    {
+        // Enqueue a few large chunks so all threads can start right away, the rest is subdivided on the fly
+        const int32 jobCount = context->JobsCount;
+        const int32 chunksCount = Math::Min(Math::Max(ThreadsCount, 1), Math::DivideAndRoundUp(jobCount, context->GrainSize));
+        JobData data;
+        data.Context = context;
+        for (int32 i = 0; i < chunksCount; i++)
         {
-            data = Jobs.PeekFront();
-            Jobs.PopFront();
+            data.Start = (int32)((int64)jobCount * i / chunksCount);
+            data.End = (int32)((int64)jobCount * (i + 1) / chunksCount);
+            EnqueueJob(data);
         }
-        JobsLocker.Unlock();
-#else
-        if (!Jobs.try_dequeue(consumerToken, data))
-            data.Job.Unbind();
+
+        if (JobStartingOnDispatch)
+            NotifyJobs(chunksCount);
+    }
+
+    void RunJob(JobData& data)
+    {
+        JobContext* context = data.Context;
+        int32 count = 0;
+        const int32 priority = (int32)context->Priority;
+        JobQueue* queue = ThreadQueueIndex != -1 ? Queues[ThreadQueueIndex][priority] : nullptr;
+#if JOB_SYSTEM_USE_STATS
+        if (ThreadQueueIndex != -1)
+        {
+            auto& stats = ThreadsStats[ThreadQueueIndex];
+            stats.LatencyCycles += (int64)(Platform::GetTimeCycles() - data.EnqueueTime);
+            stats.JobsCount++;
+        }
+#endif
+        for (; data.Start < data.End; data.Start++)
+        {
+            // Split the remaining range to let other threads steal it (threads outside job system use global queue)
+            if (data.End - data.Start > context->GrainSize && (queue ? queue->Count() : Jobs[priority].Count()) == 0)
+            {
+                JobData split = data;
+                split.Start = data.Start + (data.End - data.Start) / 2;
+#if JOB_SYSTEM_USE_STATS
+                split.EnqueueTime = Platform::GetTimeCycles();
+#endif
+                if (queue ? queue->Push(split) : Jobs[priority].enqueue(split))
+                {
+                    data.End = split.Start;
+                    NotifyJobs(1);
+                }
+            }
+
+            context->Job(data.Start);
+            count++;
+        }
+
+        // Last job releases the context
+        if (Platform::InterlockedAdd(&context->JobsLeft, -count) == 0)
+        {
+            // Start dependant dispatches (interlocked ops order it against registration in JobSystem::Dispatch)
+            if (Platform::AtomicRead(&context->DependantsCount) != 0)
+            {
+                DependenciesLocker.Lock();
+                for (JobContext* dependant : context->Dependants)
+                {
+                    if (Platform::InterlockedDecrement(&dependant->DependenciesLeft) == 0)
+                        StartJobs(dependant);
+                }
+                context->Dependants.Clear();
+                DependenciesLocker.Unlock();
+            }
+
+            context->Job.Unbind();
+            Platform::AtomicStore(&context->Label, 0);
+            Platform::InterlockedDecrement(&ActiveContexts);
+
+            // Wake up waiting threads (interlocked ops order it against thread going to sleep in WaitJobs)
+            if (Platform::AtomicRead(&WaitingThreads) != 0)
+            {
+                WaitMutex.Lock();
+                WaitSignal.NotifyAll();
+                WaitMutex.Unlock();
+            }
+        }
+    }
+
+    bool IsJobDone(int64 label)
+    {
+        if (label == 0)
+            return Platform::AtomicRead(&ActiveContexts) <= 0;
+        const JobContext* context = &JobContexts[label & (JOB_SYSTEM_CONTEXTS_COUNT - 1)];
+        return Platform::AtomicRead(&context->Label) != label || Platform::AtomicRead(&context->JobsLeft) <= 0;
+    }
+
+    void EndBackgroundJob()
+    {
+        Platform::InterlockedDecrement(&BackgroundThreads);
+
+        // Wake up thread that might be sleeping due to background jobs limit
+        if (HasJobs((int32)JobPriority::Background))
+            NotifyJobs(1);
+    }
+
+    void WaitJobs(int64 label)
+    {
+        // Help only with jobs of the same or higher priority to not get stuck in a long background job when waiting for frame-critical work
+        int32 maxPriority = (int32)JobPriority::Background;
+        bool backgroundLimit = true;
+        if (label != 0)
+        {
+            const JobContext* context = &JobContexts[label & (JOB_SYSTEM_CONTEXTS_COUNT - 1)];
+            maxPriority = (int32)context->Priority;
+            backgroundLimit = context->Priority != JobPriority::Background;
+        }
+
+        JobData data;
+        bool usesBackgroundSlot;
+#if USE_CSHARP
+        bool attachCSharpThread = ThreadQueueIndex == -1;
 #endif
+        while (!IsJobDone(label) && Platform::AtomicRead(&ExitFlag) == 0)
+        {
+            // Help with processing the jobs while waiting
+            if (TryGetJob(ThreadQueueIndex, maxPriority, backgroundLimit, data, usesBackgroundSlot))
+            {
+#if USE_CSHARP
+                if (attachCSharpThread)
+                {
+                    MCore::Thread::Attach();
+                    attachCSharpThread = false;
+                }
+#endif
+                RunJob(data);
+                if (usesBackgroundSlot)
+                    EndBackgroundJob();
+                continue;
+            }
+
+            // Wait for signal from the last job of the dispatch (check state after marking thread as waiting to not miss the notification)
+            Platform::InterlockedIncrement(&WaitingThreads);
+            WaitMutex.Lock();
+            if (!IsJobDone(label) && !HasJobs(maxPriority, backgroundLimit) && Platform::AtomicRead(&ExitFlag) == 0)
+                WaitSignal.Wait(WaitMutex);
+            WaitMutex.Unlock();
+            Platform::InterlockedDecrement(&WaitingThreads);
+        }
+    }
+}
+
+int32 JobSystemThread::Run()
+{
+    Platform::SetThreadAffinityMask(1ull << Index);
+    ThreadQueueIndex = (int32)Index;
+
+    JobData data;
+    bool usesBackgroundSlot;
+    bool attachCSharpThread = true;
+    while (Platform::AtomicRead(&ExitFlag) == 0)
+    {
+        // Try to get a job
+        const bool hasJob = TryGetJob((int32)Index, JOB_SYSTEM_PRIORITIES - 1, true, data, usesBackgroundSlot);
 #if JOB_SYSTEM_USE_STATS
-        Platform::InterlockedIncrement(&DequeueCount);
-        Platform::InterlockedAdd(&DequeueSum, Platform::GetTimeCycles() - start);
+        const uint64 start = Platform::GetTimeCycles();
 #endif
 
-        if (data.Job.IsBinded())
+        if (hasJob)
         {
 #if USE_CSHARP
             // Ensure to have C# thread attached to this thead (late init due to MCore being initialized after Job System)
@@ -197,28 +531,25 @@ int32 JobSystemThread::Run()
 #endif
 
             // Run job
-            data.Job(data.Index);
-
-            // Move forward with the job queue
-            JobsLocker.Lock();
-            JobContext& context = JobContexts.At(data.JobKey);
-            if (Platform::InterlockedDecrement(&context.JobsLeft) <= 0)
-            {
-                ASSERT_LOW_LAYER(context.JobsLeft <= 0);
-                JobContexts.Remove(data.JobKey);
-            }
-            JobsLocker.Unlock();
-
-            WaitSignal.NotifyAll();
-
-            data.Job.Unbind();
+            RunJob(data);
+            if (usesBackgroundSlot)
+                EndBackgroundJob();
+#if JOB_SYSTEM_USE_STATS
+            ThreadsStats[Index].BusyCycles += (int64)(Platform::GetTimeCycles() - start);
+#endif
         }
         else
         {
-            // Wait for signal
+            // Wait for signal (check for jobs after marking thread as sleeping to not miss the notification)
+            Platform::InterlockedIncrement(&SleepingThreads);
             JobsMutex.Lock();
-            JobsSignal.Wait(JobsMutex);
+            if (!HasJobs(JOB_SYSTEM_PRIORITIES - 1, true) && Platform::AtomicRead(&ExitFlag) == 0)
+                JobsSignal.Wait(JobsMutex);
             JobsMutex.Unlock();
+            Platform::InterlockedDecrement(&SleepingThreads);
+#if JOB_SYSTEM_USE_STATS
+            ThreadsStats[Index].IdleCycles += (int64)(Platform::GetTimeCycles() - start);
+#endif
         }
     }
     return 0;
@@ -226,14 +557,13 @@ int32 JobSystemThread::Run()
 
 #endif
 
-void JobSystem::Execute(const Function<void(int32)>& job, int32 jobCount)
+void JobSystem::Execute(const Function<void(int32)>& job, int32 jobCount, int32 grainSize, JobPriority priority)
 {
 #if JOB_SYSTEM_ENABLED
-    // TODO: disable async if called on job thread? or maybe Wait should handle waiting in job thread to do the processing?
-    if (jobCount > 1)
+    if (jobCount > 1 && jobCount > grainSize)
     {
         // Async
-        const int64 jobWaitHandle = Dispatch(job, jobCount);
+        const int64 jobWaitHandle = Dispatch(job, jobCount, grainSize, priority);
         Wait(jobWaitHandle);
     }
     else
@@ -245,50 +575,59 @@ void JobSystem::Execute(const Function<void(int32)>& job, int32 jobCount)
     }
 }
 
-int64 JobSystem::Dispatch(const Function<void(int32)>& job, int32 jobCount)
+int64 JobSystem::Dispatch(const Function<void(int32)>& job, int32 jobCount, int32 grainSize, JobPriority priority)
+{
+    return Dispatch(job, Span<int64>(), jobCount, grainSize, priority);
+}
+
+int64 JobSystem::Dispatch(const Function<void(int32)>& job, const Span<int64>& dependencies, int32 jobCount, int32 grainSize, JobPriority priority)
 {
     PROFILE_CPU();
     if (jobCount <= 0)
         return 0;
 #if JOB_SYSTEM_ENABLED
-#if JOB_SYSTEM_USE_STATS
-    const auto start = Platform::GetTimeCycles();
-#endif
-    const auto label = Platform::InterlockedAdd(&JobLabel, (int64)jobCount) + jobCount;
-
-    JobData data;
-    data.Job = job;
-    data.JobKey = label;
-
-    JobContext context;
-    context.JobsLeft = jobCount;
-
-#if JOB_SYSTEM_USE_MUTEX
-    JobsLocker.Lock();
-    JobContexts.Add(label, context);
-    for (data.Index = 0; data.Index < jobCount; data.Index++)
-        Jobs.PushBack(data);
-    JobsLocker.Unlock();
-#else
-    JobsLocker.Lock();
-    JobContexts.Add(label, context);
-    JobsLocker.Unlock();
-    for (data.Index = 0; data.Index < jobCount; data.Index++)
-        Jobs.enqueue(data);
-#endif
-
-#if JOB_SYSTEM_USE_STATS
-    LOG(Info, "Job enqueue time: {0} cycles", (int64)(Platform::GetTimeCycles() - start));
-#endif
-
-    if (JobStartingOnDispatch)
+    const int64 label = Platform::InterlockedIncrement(&JobLabel);
+
+    // Acquire context (in-flight dispatches use separate slots, wait if the slot is still used by the old dispatch)
+    JobContext* context = &JobContexts[label & (JOB_SYSTEM_CONTEXTS_COUNT - 1)];
+    while (Platform::AtomicRead(&context->Label) != 0)
+        Platform::Sleep(0);
+    context->Job = job;
+    context->JobsCount = jobCount;
+    context->GrainSize = Math::Max(grainSize, 1);
+    context->Priority = (int32)priority >= 0 && (int32)priority < JOB_SYSTEM_PRIORITIES ? priority : JobPriority::Normal;
+    Platform::AtomicStore(&context->DependantsCount, 0);
+    Platform::AtomicStore(&context->DependenciesLeft, 1);
+    Platform::AtomicStore(&context->JobsLeft, jobCount);
+    Platform::AtomicStore(&context->Label, label);
+    Platform::InterlockedIncrement(&ActiveContexts);
+
+    // Register as a continuation of the dependencies that are not yet done
+    if (dependencies.Length() != 0)
     {
-        if (jobCount == 1)
-            JobsSignal.NotifyOne();
-        else
-            JobsSignal.NotifyAll();
+        DependenciesLocker.Lock();
+        for (int32 i = 0; i < dependencies.Length(); i++)
+        {
+            const int64 dependency = dependencies[i];
+            if (dependency <= 0 || dependency == label)
+                continue;
+            JobContext* dependencyContext = &JobContexts[dependency & (JOB_SYSTEM_CONTEXTS_COUNT - 1)];
+            Platform::InterlockedIncrement(&dependencyContext->DependantsCount);
+            if (IsJobDone(dependency))
+            {
+                Platform::InterlockedDecrement(&dependencyContext->DependantsCount);
+                continue;
+            }
+            dependencyContext->Dependants.Add(context);
+            Platform::InterlockedIncrement(&context->DependenciesLeft);
+        }
+        DependenciesLocker.Unlock();
     }
 
+    // Start jobs unless any dependency is still running (it will start them)
+    if (Platform::InterlockedDecrement(&context->DependenciesLeft) == 0)
+        StartJobs(context);
+
     return label;
 #else
     for (int32 i = 0; i < jobCount; i++)
@@ -300,81 +639,86 @@ int64 JobSystem::Dispatch(const Function<void(int32)>& job, int32 jobCount)
 void JobSystem::Wait()
 {
 #if JOB_SYSTEM_ENABLED
-    JobsLocker.Lock();
-    int32 numJobs = JobContexts.Count();
-    JobsLocker.Unlock();
-
-    while (numJobs > 0)
-    {
-        WaitMutex.Lock();
-        WaitSignal.Wait(WaitMutex, 1);
-        WaitMutex.Unlock();
-
-        JobsLocker.Lock();
-        numJobs = JobContexts.Count();
-        JobsLocker.Unlock();
-    }
+    WaitJobs(0);
 #endif
 }
 
 void JobSystem::Wait(int64 label)
 {
 #if JOB_SYSTEM_ENABLED
+    if (label <= 0)
+        return;
     PROFILE_CPU();
 
-    while (Platform::AtomicRead(&ExitFlag) == 0)
-    {
-        JobsLocker.Lock();
-        const JobContext* context = JobContexts.TryGet(label);
-        JobsLocker.Unlock();
-
-        // Skip if context has been already executed (last job removes it)
-        if (!context)
-            break;
+    WaitJobs(label);
+#endif
+}
 
-        // Wait on signal until input label is not yet done
-        WaitMutex.Lock();
-        WaitSignal.Wait(WaitMutex, 1);
-        WaitMutex.Unlock();
+void JobSystem::SetJobStartingOnDispatch(bool value)
+{
+#if JOB_SYSTEM_ENABLED
+    JobStartingOnDispatch = value;
 
-        // Wake up any thread to prevent stalling in highly multi-threaded environment
-        JobsSignal.NotifyOne();
-    }
+    if (value && HasJobs(JOB_SYSTEM_PRIORITIES - 1, false))
+        NotifyJobs(ThreadsCount);
+#endif
+}
 
-#if JOB_SYSTEM_USE_STATS
-    LOG(Info, "Job average dequeue time: {0} cycles", DequeueSum / DequeueCount);
-    DequeueSum = DequeueCount = 0;
+int32 JobSystem::GetThreadsCount()
+{
+#if JOB_SYSTEM_ENABLED
+    return ThreadsCount;
+#else
+    return 0;
 #endif
+}
+
+int32 JobSystem::GetBackgroundThreadsLimit()
+{
+#if JOB_SYSTEM_ENABLED
+    return BackgroundThreadsLimit;
+#else
+    return 0;
 #endif
 }
 
-void JobSystem::SetJobStartingOnDispatch(bool value)
+void JobSystem::SetBackgroundThreadsLimit(int32 value)
 {
 #if JOB_SYSTEM_ENABLED
-    JobStartingOnDispatch = value;
+    BackgroundThreadsLimit = Math::Clamp(value, 1, Math::Max(ThreadsCount, 1));
+    if (HasJobs((int32)JobPriority::Background))
+        NotifyJobs(ThreadsCount);
+#endif
+}
 
-    if (value)
-    {
-#if JOB_SYSTEM_USE_MUTEX
-        JobsLocker.Lock();
-        const int32 count = Jobs.Count();
-        JobsLocker.Unlock();
+#if COMPILE_WITH_PROFILER
+
+bool JobSystem::GetThreadStats(int32 threadIndex, WorkerStats& stats)
+{
+#if JOB_SYSTEM_ENABLED
+    if (threadIndex < 0 || threadIndex >= ThreadsCount)
+        return false;
+    stats = ThreadsStats[threadIndex];
+    int64 queueDepth = 0;
+    for (int32 priority = 0; priority < JOB_SYSTEM_PRIORITIES; priority++)
+        queueDepth += Queues[threadIndex][priority]->Count();
+    stats.QueueDepth = (int32)queueDepth;
+    return true;
 #else
-        const int32 count = Jobs.Count();
-#endif
-        if (count == 1)
-            JobsSignal.NotifyOne();
-        else if (count != 0)
-            JobsSignal.NotifyAll();
-    }
+    return false;
 #endif
 }
 
-int32 JobSystem::GetThreadsCount()
+int32 JobSystem::GetQueueDepth()
 {
 #if JOB_SYSTEM_ENABLED
-    return ThreadsCount;
+    int32 result = 0;
+    for (int32 priority = 0; priority < JOB_SYSTEM_PRIORITIES; priority++)
+        result += Jobs[priority].Count();
+    return result;
 #else
     return 0;
 #endif
 }
+
+#endif
@@ -3,6 +3,33 @@
 #pragma once
 
 #include "Engine/Core/Delegate.h"
+#include "Engine/Core/Types/Span.h"
+
+struct WorkerStats;
+
+/// <summary>
+/// The job execution priorities. Each priority uses separate jobs queues and higher priority jobs are always picked first.
+/// </summary>
+API_ENUM() enum class JobPriority
+{
+    /// <summary>
+    /// The frame-critical work (eg. animations update or drawing) that should be processed as soon as possible.
+    /// </summary>
+    High = 0,
+
+    /// <summary>
+    /// The default priority.
+    /// </summary>
+    Normal = 1,
+
+    /// <summary>
+    /// The long-running work (eg. asset processing or scene loading) that can be delayed. Executed by a limited amount of threads at once to not starve higher priority jobs.
+    /// </summary>
+    Background = 2,
+
+    API_ENUM(Attributes="HideInEditor")
+    MAX
+};
 
 /// <summary>
 /// Lightweight multi-threaded jobs execution scheduler. Uses a pool of threads and supports work-stealing concept.
@@ -16,15 +43,30 @@ API_CLASS(Static) class FLAXENGINE_API JobSystem
     /// </summary>
     /// <param name="job">The job. Argument is an index of the job execution.</param>
     /// <param name="jobCount">The job executions count.</param>
-    API_FUNCTION() static void Execute(const Function<void(int32)>& job, int32 jobCount = 1);
+    /// <param name="grainSize">The minimum amount of job executions that are processed together by a single thread. The range of executions is split into chunks of at least that size and subdivided adaptively when other threads are idle. Use higher values for very cheap jobs to reduce scheduling overhead.</param>
+    /// <param name="priority">The job execution priority.</param>
+    API_FUNCTION() static void Execute(const Function<void(int32)>& job, int32 jobCount = 1, int32 grainSize = 1, JobPriority priority = JobPriority::Normal);
 
     /// <summary>
     /// Dispatches the job for the execution.
     /// </summary>
     /// <param name="job">The job. Argument is an index of the job execution.</param>
     /// <param name="jobCount">The job executions count.</param>
+    /// <param name="grainSize">The minimum amount of job executions that are processed together by a single thread. The range of executions is split into chunks of at least that size and subdivided adaptively when other threads are idle. Use higher values for very cheap jobs to reduce scheduling overhead.</param>
+    /// <param name="priority">The job execution priority.</param>
     /// <returns>The label identifying this dispatch. Can be used to wait for the execution end.</returns>
-    API_FUNCTION() static int64 Dispatch(const Function<void(int32)>& job, int32 jobCount = 1);
+    API_FUNCTION() static int64 Dispatch(const Function<void(int32)>& job, int32 jobCount = 1, int32 grainSize = 1, JobPriority priority = JobPriority::Normal);
+
+    /// <summary>
+    /// Dispatches the job for the execution after all the given dependencies finish. The job gets started as a continuation of the last finished dependency (without a need to wait for them on the calling thread).
+    /// </summary>
+    /// <param name="job">The job. Argument is an index of the job execution.</param>
+    /// <param name="dependencies">The labels of the dispatches to wait for before starting this job.</param>
+    /// <param name="jobCount">The job executions count.</param>
+    /// <param name="grainSize">The minimum amount of job executions that are processed together by a single thread.</param>
+    /// <param name="priority">The job execution priority.</param>
+    /// <returns>The label identifying this dispatch. Can be used to wait for the execution end.</returns>
+    static int64 Dispatch(const Function<void(int32)>& job, const Span<int64>& dependencies, int32 jobCount = 1, int32 grainSize = 1, JobPriority priority = JobPriority::Normal);
 
     /// <summary>
     /// Waits for all dispatched jobs to finish.
@@ -34,6 +76,7 @@ API_CLASS(Static) class FLAXENGINE_API JobSystem
     /// <summary>
     /// Waits for all dispatched jobs until a given label to finish (i.e. waits for a Dispatch that returned that label).
     /// </summary>
+    /// <remarks>Waiting thread helps with executing jobs of the same or higher priority in the meantime.</remarks>
     /// <param name="label">The label.</param>
     API_FUNCTION() static void Wait(int64 label);
 
@@ -46,4 +89,29 @@ API_CLASS(Static) class FLAXENGINE_API JobSystem
     /// Gets the amount of job system threads.
     /// </summary>
     API_PROPERTY() static int32 GetThreadsCount();
+
+    /// <summary>
+    /// Gets the maximum amount of threads that can execute background priority jobs at once. Remaining threads are reserved for higher priority jobs.
+    /// </summary>
+    API_PROPERTY() static int32 GetBackgroundThreadsLimit();
+
+    /// <summary>
+    /// Sets the maximum amount of threads that can execute background priority jobs at once. Remaining threads are reserved for higher priority jobs.
+    /// </summary>
+    API_PROPERTY() static void SetBackgroundThreadsLimit(int32 value);
+
+#if COMPILE_WITH_PROFILER
+    /// <summary>
+    /// Gets the runtime statistics of the job system thread.
+    /// </summary>
+    /// <param name="threadIndex">The index of the job system thread.</param>
+    /// <param name="stats">The result stats.</param>
+    /// <returns>True if got valid stats, otherwise false.</returns>
+    static bool GetThreadStats(int32 threadIndex, WorkerStats& stats);
+
+    /// <summary>
+    /// Gets the amount of jobs waiting in the global queue (dispatched from outside the job system threads).
+    /// </summary>
+    static int32 GetQueueDepth();
+#endif
 };
@@ -0,0 +1,270 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+// C++20 coroutines support for async tasks. Available only in modules compiled with C++20 (eg. via 'options.CompileEnv.CppVersion = CppVersion.Cpp20' in module build script).
+//
+// Example:
+// TaskCoroutine LoadAndSpawn(AssetReference<Prefab> prefab)
+// {
+//     co_await AwaitTask(prefab->LoadingTask); // Resumes on the thread that ends the task (eg. content loading thread)
+//     co_await ResumeOnJobSystem(); // Continue processing on a job thread
+//     ...
+//     co_await ResumeOnMainThread(); // Continue on a main thread within the next frame update
+//     PrefabManager::SpawnPrefab(prefab);
+// }
+#if defined(__cpp_impl_coroutine) && __cpp_impl_coroutine >= 201902L
+#define COMPILE_WITH_TASK_COROUTINES 1
+#else
+#define COMPILE_WITH_TASK_COROUTINES 0
+#endif
+
+#if COMPILE_WITH_TASK_COROUTINES
+
+#include "Task.h"
+#include "JobSystem.h"
+#include "MainThreadTask.h"
+#include "Engine/Core/Math/Math.h"
+#include "Engine/Core/Types/String.h"
+#include <coroutine>
+
+/// <summary>
+/// The coroutine return type for asynchronous flows that await on tasks, jobs or main thread. Coroutine starts immediately when called and its frame gets released automatically after it ends (fire-and-forget).
+/// </summary>
+struct TaskCoroutine
+{
+    struct promise_type
+    {
+        TaskCoroutine get_return_object() noexcept
+        {
+            return TaskCoroutine();
+        }
+
+        std::suspend_never initial_suspend() noexcept
+        {
+            return {};
+        }
+
+        std::suspend_never final_suspend() noexcept
+        {
+            return {};
+        }
+
+        void return_void() noexcept
+        {
+        }
+
+        void unhandled_exception() noexcept
+        {
+            Platform::Crash(__LINE__, __FILE__);
+        }
+    };
+};
+
+/// <summary>
+/// The awaiter that suspends the coroutine until the given task ends (finished, failed or canceled). Coroutine is resumed on the thread that ended the task.
+/// </summary>
+/// <remarks>The result of co_await is true if task failed or has been canceled, otherwise false (the same as Task::Wait).</remarks>
+class TaskAwaiter
+{
+private:
+    class ResumeTask : public Task
+    {
+    public:
+        std::coroutine_handle<> Handle;
+        volatile int64 Resumed = 0;
+
+        bool TryResume()
+        {
+            return Platform::InterlockedCompareExchange(&Resumed, 1, 0) == 0;
+        }
+
+        // [Task]
+        String ToString() const override
+        {
+            return TEXT("Coroutine Resume Task");
+        }
+
+    protected:
+        bool Run() override
+        {
+            return false;
+        }
+
+        void Enqueue() override
+        {
+            // Called when the awaited task finishes
+            Execute();
+        }
+
+        void OnEnd() override
+        {
+            if (TryResume())
+                Handle.resume();
+            Task::OnEnd();
+        }
+    };
+
+    Task* _task;
+
+public:
+    explicit TaskAwaiter(Task* task)
+        : _task(task)
+    {
+    }
+
+    bool await_ready() const noexcept
+    {
+        return _task == nullptr || _task->IsEnded();
+    }
+
+    bool await_suspend(std::coroutine_handle<> handle) noexcept
+    {
+        // Continuation task is allocated on heap (rather than inside coroutine frame) because awaited task can still access it after the coroutine gets resumed and ends
+        auto resume = New<ResumeTask>();
+        resume->Handle = handle;
+        _task->ContinueWith(resume);
+
+        // Task could end before registering the continuation so check it again (resume only once)
+        // Note: in such case the continuation might be never started and released
+        if (_task->IsEnded() && resume->TryResume())
+            return false;
+        return true;
+    }
+
+    bool await_resume() const noexcept
+    {
+        return _task && !_task->IsFinished();
+    }
+};
+
+/// <summary>
+/// The awaiter that suspends the coroutine until the given Job System dispatch ends. Coroutine is resumed on a job thread (as a continuation job, without blocking any thread).
+/// </summary>
+class JobAwaiter
+{
+private:
+    int64 _label;
+    JobPriority _priority;
+    std::coroutine_handle<> _handle;
+
+    void Job(int32 index)
+    {
+        _handle.resume();
+    }
+
+public:
+    explicit JobAwaiter(int64 label, JobPriority priority = JobPriority::Normal)
+        : _label(label)
+        , _priority(priority)
+    {
+    }
+
+    bool await_ready() const noexcept
+    {
+        return false;
+    }
+
+    void await_suspend(std::coroutine_handle<> handle) noexcept
+    {
+        _handle = handle;
+        Function<void(int32)> job;
+        job.Bind<JobAwaiter, &JobAwaiter::Job>(this);
+        if (_label > 0)
+            JobSystem::Dispatch(job, ToSpan(&_label, 1), 1, 1, _priority);
+        else
+            JobSystem::Dispatch(job, 1, 1, _priority);
+    }
+
+    void await_resume() const noexcept
+    {
+    }
+};
+
+/// <summary>
+/// The awaiter that suspends the coroutine and resumes it on the main thread within the next frame update.
+/// </summary>
+class MainThreadAwaiter : private MainThreadTask
+{
+private:
+    std::coroutine_handle<> _handle;
+
+public:
+    explicit MainThreadAwaiter(float delay)
+    {
+        // Use initial delay to always skip the current frame (tasks with zero delay enqueued during the update would be called within the same frame)
+        InitialDelay = Math::Max(delay, ZeroTolerance * 2.0f);
+    }
+
+    bool await_ready() const noexcept
+    {
+        return false;
+    }
+
+    void await_suspend(std::coroutine_handle<> handle) noexcept
+    {
+        _handle = handle;
+        Start();
+    }
+
+    void await_resume() const noexcept
+    {
+    }
+
+private:
+    // [MainThreadTask]
+    String ToString() const override
+    {
+        return TEXT("Coroutine Main Thread Resume Task");
+    }
+
+    bool Run() override
+    {
+        return false;
+    }
+
+    void OnEnd() override
+    {
+        // Task is stored inside coroutine frame so don't delete it but just resume the coroutine
+        _handle.resume();
+    }
+};
+
+/// <summary>
+/// Suspends the coroutine until the given task ends (eg. content loading task or GPU task). Returns true if task failed or has been canceled.
+/// </summary>
+/// <param name="task">The task to wait for. Can be null to continue without suspending.</param>
+inline TaskAwaiter AwaitTask(Task* task)
+{
+    return TaskAwaiter(task);
+}
+
+/// <summary>
+/// Suspends the coroutine until the given Job System dispatch ends and resumes it on a job thread.
+/// </summary>
+/// <param name="label">The label of the dispatch to wait for (returned by JobSystem::Dispatch).</param>
+/// <param name="priority">The priority of the job that resumes the coroutine.</param>
+inline JobAwaiter AwaitJobs(int64 label, JobPriority priority = JobPriority::Normal)
+{
+    return JobAwaiter(label, priority);
+}
+
+/// <summary>
+/// Suspends the coroutine and resumes it on a job thread.
+/// </summary>
+/// <param name="priority">The priority of the job that resumes the coroutine.</param>
+inline JobAwaiter ResumeOnJobSystem(JobPriority priority = JobPriority::Normal)
+{
+    return JobAwaiter(0, priority);
+}
+
+/// <summary>
+/// Suspends the coroutine and resumes it on the main thread within the next frame update (or after a given delay).
+/// </summary>
+/// <param name="delay">The minimum delay (in seconds) before resuming the coroutine.</param>
+inline MainThreadAwaiter ResumeOnMainThread(float delay = 0.0f)
+{
+    return MainThreadAwaiter(delay);
+}
+
+#endif
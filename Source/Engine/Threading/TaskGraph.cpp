@@ -85,6 +85,9 @@ void TaskGraph::Execute()
     _queue.Clear();
     _remaining.Clear();
     _remaining.Add(_systems);
+    _labels.Clear();
+    for (auto system : _systems)
+        system->_labels.Clear();
 
     while (_remaining.HasItems())
     {
@@ -112,31 +115,36 @@ void TaskGraph::Execute()
         if (_queue.IsEmpty())
             break;
 
-        // Execute in order
+        // Schedule in order (jobs of each system start after jobs of its dependencies, without waiting for them here)
         Sorting::QuickSort(_queue.Get(), _queue.Count(), &SortTaskGraphSystem);
-        JobSystem::SetJobStartingOnDispatch(false);
-        _labels.Clear();
         for (int32 i = 0; i < _queue.Count(); i++)
         {
             _currentSystem = _queue[i];
+            _dependencyLabels.Clear();
+            for (auto d : _currentSystem->_dependencies)
+                _dependencyLabels.Add(d->_labels);
             _currentSystem->Execute(this);
+
+            // Pass dependencies through systems that didn't dispatch any jobs
+            if (_currentSystem->_labels.IsEmpty())
+                _currentSystem->_labels.Add(_dependencyLabels);
         }
         _currentSystem = nullptr;
         _queue.Clear();
-
-        // Wait for async jobs to finish
-        JobSystem::SetJobStartingOnDispatch(true);
-        for (const int64 label : _labels)
-            JobSystem::Wait(label);
     }
 
+    // Wait for async jobs to finish
+    for (const int64 label : _labels)
+        JobSystem::Wait(label);
+
     for (auto system : _systems)
         system->PostExecute(this);
 }
 
-void TaskGraph::DispatchJob(const Function<void(int32)>& job, int32 jobCount)
+void TaskGraph::DispatchJob(const Function<void(int32)>& job, int32 jobCount, int32 grainSize, JobPriority priority)
 {
     ASSERT(_currentSystem);
-    const int64 label = JobSystem::Dispatch(job, jobCount);
+    const int64 label = JobSystem::Dispatch(job, ToSpan(_dependencyLabels), jobCount, grainSize, priority);
+    _currentSystem->_labels.Add(label);
     _labels.Add(label);
 }
@@ -4,6 +4,7 @@
 
 #include "Engine/Scripting/ScriptingObject.h"
 #include "Engine/Core/Collections/Array.h"
+#include "JobSystem.h"
 
 class TaskGraph;
 
@@ -17,6 +18,7 @@ DECLARE_SCRIPTING_TYPE(TaskGraphSystem);
 private:
     Array<TaskGraphSystem*, InlinedAllocation<16>> _dependencies;
     Array<TaskGraphSystem*, InlinedAllocation<16>> _reverseDependencies;
+    Array<int64, InlinedAllocation<8>> _labels;
 
 public:
     /// <summary>
@@ -30,6 +32,7 @@ DECLARE_SCRIPTING_TYPE(TaskGraphSystem);
     /// <summary>
     /// Adds the dependency on the system execution. Before this system can be executed the given dependant system has to be executed first.
     /// </summary>
+    /// <remarks>Jobs dispatched by this system are started once all jobs of the dependant system finish. Note that Execute method only schedules the work so it can be called before the dependant system jobs end.</remarks>
     /// <param name="system">The system to depend on.</param>
     API_FUNCTION() void AddDependency(TaskGraphSystem* system);
 
@@ -69,6 +72,7 @@ DECLARE_SCRIPTING_TYPE(TaskGraph);
     Array<TaskGraphSystem*, InlinedAllocation<64>> _remaining;
     Array<TaskGraphSystem*, InlinedAllocation<64>> _queue;
     Array<int64, InlinedAllocation<64>> _labels;
+    Array<int64, InlinedAllocation<64>> _dependencyLabels;
     TaskGraphSystem* _currentSystem = nullptr;
 
 public:
@@ -100,5 +104,7 @@ DECLARE_SCRIPTING_TYPE(TaskGraph);
     /// <remarks>Call only from system's Execute method to properly schedule job.</remarks>
     /// <param name="job">The job. Argument is an index of the job execution.</param>
     /// <param name="jobCount">The job executions count.</param>
-    API_FUNCTION() void DispatchJob(const Function<void(int32)>& job, int32 jobCount = 1);
+    /// <param name="grainSize">The minimum amount of job executions that are processed together by a single thread (see JobSystem::Dispatch).</param>
+    /// <param name="priority">The job execution priority.</param>
+    API_FUNCTION() void DispatchJob(const Function<void(int32)>& job, int32 jobCount = 1, int32 grainSize = 1, JobPriority priority = JobPriority::Normal);
 };
@@ -11,9 +11,11 @@
 #include "Engine/Core/Collections/Array.h"
 #include "Engine/Engine/Globals.h"
 #include "Engine/Engine/EngineService.h"
-#include "Engine/Platform/ConditionVariable.h"
 #include "Engine/Platform/CPUInfo.h"
 #include "Engine/Platform/Thread.h"
+#if COMPILE_WITH_PROFILER
+#include "WorkerStats.h"
+#endif
 
 FLAXENGINE_API bool IsInMainThread()
 {
@@ -25,8 +27,14 @@ namespace ThreadPoolImpl
     volatile int64 ExitFlag = 0;
     Array<Thread*> Threads;
     ConcurrentTaskQueue<ThreadPoolTask> Jobs; // Hello Steve!
-    ConditionVariable JobsSignal;
-    CriticalSection JobsMutex;
+#if COMPILE_WITH_PROFILER
+    struct alignas(PLATFORM_CACHE_LINE_SIZE) ThreadPoolThreadStats : WorkerStats
+    {
+    };
+
+    volatile int64 ThreadsStarted = 0;
+    ThreadPoolThreadStats ThreadsStats[PLATFORM_THREADS_LIMIT / 2];
+#endif
 }
 
 String ThreadPoolTask::ToString() const
@@ -36,8 +44,10 @@ String ThreadPoolTask::ToString() const
 
 void ThreadPoolTask::Enqueue()
 {
+#if COMPILE_WITH_PROFILER
+    _enqueueTime = Platform::GetTimeCycles();
+#endif
     ThreadPoolImpl::Jobs.Add(this);
-    ThreadPoolImpl::JobsSignal.NotifyOne();
 }
 
 class ThreadPoolService : public EngineService
@@ -84,14 +94,14 @@ void ThreadPoolService::BeforeExit()
 {
     // Set exit flag and wake up threads
     Platform::AtomicStore(&ThreadPoolImpl::ExitFlag, 1);
-    ThreadPoolImpl::JobsSignal.NotifyAll();
+    ThreadPoolImpl::Jobs.NotifyAll();
 }
 
 void ThreadPoolService::Dispose()
 {
     // Set exit flag and wake up threads
     Platform::AtomicStore(&ThreadPoolImpl::ExitFlag, 1);
-    ThreadPoolImpl::JobsSignal.NotifyAll();
+    ThreadPoolImpl::Jobs.NotifyAll();
 
     // Wait some time
     Platform::Sleep(10);
@@ -104,24 +114,50 @@ void ThreadPoolService::Dispose()
     ThreadPoolImpl::Threads.ClearDelete();
 }
 
+int32 ThreadPool::GetThreadsCount()
+{
+    return ThreadPoolImpl::Threads.Count();
+}
+
+#if COMPILE_WITH_PROFILER
+
+bool ThreadPool::GetThreadStats(int32 threadIndex, WorkerStats& stats)
+{
+    if (threadIndex < 0 || threadIndex >= Math::Min<int32>((int32)Platform::AtomicRead(&ThreadPoolImpl::ThreadsStarted), ARRAY_COUNT(ThreadPoolImpl::ThreadsStats)))
+        return false;
+    stats = ThreadPoolImpl::ThreadsStats[threadIndex];
+    stats.QueueDepth = ThreadPoolImpl::Jobs.Count();
+    return true;
+}
+
+#endif
+
 int32 ThreadPool::ThreadProc()
 {
     ThreadPoolTask* task;
-
-    // Work until end
-    while (Platform::AtomicRead(&ThreadPoolImpl::ExitFlag) == 0)
+#if COMPILE_WITH_PROFILER
+    const int32 threadIndex = (int32)Platform::InterlockedIncrement(&ThreadPoolImpl::ThreadsStarted) - 1;
+    WorkerStats dummyStats;
+    WorkerStats& stats = threadIndex < ARRAY_COUNT(ThreadPoolImpl::ThreadsStats) ? ThreadPoolImpl::ThreadsStats[threadIndex] : dummyStats;
+#endif
+
+    // Work until end (wait for a job)
+#if COMPILE_WITH_PROFILER
+    uint64 start = Platform::GetTimeCycles();
+#endif
+    while (ThreadPoolImpl::Jobs.Dequeue(task, ThreadPoolImpl::ExitFlag))
     {
-        // Try to get a job
-        if (ThreadPoolImpl::Jobs.try_dequeue(task))
-        {
-            task->Execute();
-        }
-        else
-        {
-            ThreadPoolImpl::JobsMutex.Lock();
-            ThreadPoolImpl::JobsSignal.Wait(ThreadPoolImpl::JobsMutex);
-            ThreadPoolImpl::JobsMutex.Unlock();
-        }
+#if COMPILE_WITH_PROFILER
+        const uint64 now = Platform::GetTimeCycles();
+        stats.IdleCycles += (int64)(now - start);
+        stats.LatencyCycles += (int64)(now - task->_enqueueTime);
+        stats.JobsCount++;
+#endif
+        task->Execute();
+#if COMPILE_WITH_PROFILER
+        start = Platform::GetTimeCycles();
+        stats.BusyCycles += (int64)(start - now);
+#endif
     }
 
     return 0;
@@ -4,6 +4,8 @@
 
 #include "Engine/Core/Types/BaseTypes.h"
 
+struct WorkerStats;
+
 /// <summary>
 /// Main engine thread pool for threaded tasks system.
 /// </summary>
@@ -11,6 +13,23 @@ class ThreadPool
 {
     friend class ThreadPoolTask;
     friend class ThreadPoolService;
+public:
+
+    /// <summary>
+    /// Gets the amount of thread pool threads.
+    /// </summary>
+    static int32 GetThreadsCount();
+
+#if COMPILE_WITH_PROFILER
+    /// <summary>
+    /// Gets the runtime statistics of the thread pool thread.
+    /// </summary>
+    /// <param name="threadIndex">The index of the thread pool thread.</param>
+    /// <param name="stats">The result stats. Queue depth is the amount of tasks waiting in the shared queue.</param>
+    /// <returns>True if got valid stats, otherwise false.</returns>
+    static bool GetThreadStats(int32 threadIndex, WorkerStats& stats);
+#endif
+
 private:
 
     static int32 ThreadProc();
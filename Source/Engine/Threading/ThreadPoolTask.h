@@ -33,6 +33,11 @@ class ThreadPoolTask : public Task
 
     // [Task]
     void Enqueue() override;
+
+#if COMPILE_WITH_PROFILER
+private:
+    uint64 _enqueueTime = 0;
+#endif
 };
 
 /// <summary>
@@ -0,0 +1,41 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Core/Types/BaseTypes.h"
+
+/// <summary>
+/// The runtime statistics of the worker thread (accumulated since the thread start). Counters are updated only by the worker thread and can be read from any thread (for profiling purposes).
+/// </summary>
+struct WorkerStats
+{
+    /// <summary>
+    /// The time spent on executing jobs (in CPU cycles).
+    /// </summary>
+    volatile int64 BusyCycles = 0;
+
+    /// <summary>
+    /// The time spent on sleeping while waiting for jobs (in CPU cycles).
+    /// </summary>
+    volatile int64 IdleCycles = 0;
+
+    /// <summary>
+    /// The total time between jobs enqueue and start of the execution (in CPU cycles).
+    /// </summary>
+    volatile int64 LatencyCycles = 0;
+
+    /// <summary>
+    /// The amount of executed jobs.
+    /// </summary>
+    volatile int64 JobsCount = 0;
+
+    /// <summary>
+    /// The amount of jobs stolen from the other threads queues.
+    /// </summary>
+    volatile int64 StealsCount = 0;
+
+    /// <summary>
+    /// The amount of jobs waiting in the thread queue (sampled on read).
+    /// </summary>
+    int32 QueueDepth = 0;
+};
@@ -464,10 +464,10 @@ bool MaterialGenerator::Generate(WriteStream& source, MaterialInfo& materialInfo
             srv = 2; // Skinning Bones + Prev Bones
             break;
         case MaterialDomain::Decal:
-            srv = 1; // Depth buffer
+            srv = 2; // Depth buffer + Decal instances
             break;
         case MaterialDomain::Terrain:
-            srv = 3; // Heightmap + 2 splatmaps
+            srv = 6; // Heightmap + 2 splatmaps + 3 material cache pages
             break;
         case MaterialDomain::Particle:
             srv = 2; // Particles data + Sorted indices/Ribbon segments
@@ -3,248 +3,310 @@
 #if COMPILE_WITH_MODEL_TOOL
 
 #include "MeshAccelerationStructure.h"
+#include "Engine/Core/SIMD.h"
 #include "Engine/Core/Math/Math.h"
+#include "Engine/Core/Math/CollisionsHelper.h"
+#include "Engine/Core/Math/Ray.h"
 #include "Engine/Content/Content.h"
 #include "Engine/Content/Assets/Model.h"
 #include "Engine/Graphics/Models/ModelData.h"
 #include "Engine/Profiler/ProfilerCPU.h"
 
-void MeshAccelerationStructure::BuildBVH(int32 node, int32 maxLeafSize, Array<byte>& scratch)
+// The amount of bins per axis used to evaluate Surface Area Heuristic (SAH) splits
+#define BVH_SAH_BINS 16
+
+// The cost of traversing the BVH node relative to the triangle test (used by SAH)
+#define BVH_SAH_TRAVERSAL_COST 1.0f
+
+struct MeshAccelerationStructure::BuildNode
 {
-    auto& root = _bvh[node];
-    ASSERT_LOW_LAYER(root.Leaf.IsLeaf);
-    if (root.Leaf.TriangleCount <= maxLeafSize)
-        return;
+    Float3 Min, Max;
+    int32 Left, Right; // Child nodes (-1 for leaf)
+    int32 Start, Count; // Triangles range
+};
 
-    // Spawn two leaves
-    const int32 childIndex = _bvh.Count();
-    _bvh.AddDefault(2);
-    auto& left = _bvh.Get()[childIndex];
-    auto& right = _bvh.Get()[childIndex + 1];
-    left.Leaf.IsLeaf = 1;
-    right.Leaf.IsLeaf = 1;
-    left.Leaf.MeshIndex = root.Leaf.MeshIndex;
-    right.Leaf.MeshIndex = root.Leaf.MeshIndex;
-
-    // Mid-point splitting based on the largest axis
-    const Float3 boundsSize = root.Bounds.GetSize();
-    int32 axisCount = 0;
-    int32 axis = 0;
-RETRY:
-    if (axisCount == 0)
+struct MeshAccelerationStructure::BuildTriangle
+{
+    Float3 Min, Max, Centroid;
+    int32 Index;
+};
+
+namespace
+{
+    struct BuildBin
     {
-        // Pick the highest axis
-        axis = 0;
-        if (boundsSize.Y > boundsSize.X && boundsSize.Y >= boundsSize.Z)
-            axis = 1;
-        else if (boundsSize.Z > boundsSize.X)
-            axis = 2;
-    }
-    else if (axisCount == 3)
+        Float3 Min = Float3(MAX_float), Max = Float3(-MAX_float);
+        int32 Count = 0;
+    };
+
+    float SurfaceArea(const Float3& min, const Float3& max)
     {
-        // Failed to split
-        _bvh.Resize(childIndex);
-        return;
+        const Float3 size = Float3::Max(max - min, Float3::Zero);
+        return 2.0f * (size.X * size.Y + size.X * size.Z + size.Y * size.Z);
     }
-    else
+
+    template<typename T>
+    FORCE_INLINE int32 GetBin(const T& triangle, int32 axis, float centroidMin, float binScale)
     {
-        // Go to the next axis
-        axis = (axis + 1) % 3;
+        return Math::Min((int32)((triangle.Centroid.Raw[axis] - centroidMin) * binScale), BVH_SAH_BINS - 1);
     }
-    const float midPoint = (float)(root.Bounds.Minimum.Raw[axis] + boundsSize.Raw[axis] * 0.5f);
-    const Mesh& meshData = _meshes[root.Leaf.MeshIndex];
-    const Float3* vb = meshData.VertexBuffer.Get<Float3>();
-    int32 indexStart = root.Leaf.TriangleIndex * 3;
-    int32 indexEnd = indexStart + root.Leaf.TriangleCount * 3;
-    left.Leaf.TriangleCount = 0;
-    right.Leaf.TriangleCount = 0;
-    if (meshData.Use16BitIndexBuffer)
+
+    // Sorts the hit children by distance (descending) so the closest one gets popped from the stack first
+    template<typename T>
+    FORCE_INLINE void PushSorted(T& stack, const int32* children, const uint32* counts, const float* distances, int32 mask)
     {
-        struct Tri
-        {
-            uint16 I0, I1, I2;
-        };
-        scratch.Resize(root.Leaf.TriangleCount * sizeof(Tri));
-        auto dst = (Tri*)scratch.Get();
-        auto ib16 = meshData.IndexBuffer.Get<uint16>();
-        for (int32 i = indexStart; i < indexEnd;)
+        int32 order[4];
+        int32 count = 0;
+        for (int32 i = 0; i < 4; i++)
         {
-            const Tri tri = { ib16[i++], ib16[i++], ib16[i++] };
-            const float v0 = vb[tri.I0].Raw[axis];
-            const float v1 = vb[tri.I1].Raw[axis];
-            const float v2 = vb[tri.I2].Raw[axis];
-            const float centroid = (v0 + v1 + v2) * 0.333f;
-            if (centroid <= midPoint)
-                dst[left.Leaf.TriangleCount++] = tri; // Left
-            else
-                dst[root.Leaf.TriangleCount - ++right.Leaf.TriangleCount] = tri; // Right
+            if (mask & (1 << i))
+            {
+                int32 j = count++;
+                for (; j > 0 && distances[order[j - 1]] < distances[i]; j--)
+                    order[j] = order[j - 1];
+                order[j] = i;
+            }
         }
-        Platform::MemoryCopy(ib16 + indexStart, dst, root.Leaf.TriangleCount * 3 * sizeof(uint16));
-        if (left.Leaf.TriangleCount == 0 || right.Leaf.TriangleCount == 0)
+        for (int32 i = 0; i < count; i++)
         {
-            axisCount++;
-            goto RETRY;
+            const int32 child = order[i];
+            stack.Add({ children[child], counts[child], distances[child] });
         }
+    }
+}
 
-        left.Bounds = BoundingBox(vb[dst[0].I0]);
-        indexStart = 0;
-        indexEnd = left.Leaf.TriangleCount * 3;
-        for (int32 i = indexStart; i < indexEnd; i++)
-            left.Bounds.Merge(vb[((uint16*)scratch.Get())[i]]);
-
-        right.Bounds = BoundingBox(vb[dst[root.Leaf.TriangleCount - 1].I0]);
-        indexStart = left.Leaf.TriangleCount;
-        indexEnd = root.Leaf.TriangleCount * 3;
-        for (int32 i = indexStart; i < indexEnd; i++)
-            right.Bounds.Merge(vb[((uint16*)scratch.Get())[i]]);
+int32 MeshAccelerationStructure::BuildNodeSAH(Array<BuildNode>& build, BuildTriangle* triangles, int32 start, int32 count, int32 maxLeafSize)
+{
+    const int32 index = build.Count();
+    Float3 min = triangles[start].Min, max = triangles[start].Max;
+    Float3 centroidMin = triangles[start].Centroid, centroidMax = centroidMin;
+    for (int32 i = start + 1; i < start + count; i++)
+    {
+        const BuildTriangle& tri = triangles[i];
+        min = Float3::Min(min, tri.Min);
+        max = Float3::Max(max, tri.Max);
+        centroidMin = Float3::Min(centroidMin, tri.Centroid);
+        centroidMax = Float3::Max(centroidMax, tri.Centroid);
     }
-    else
     {
-        struct Tri
+        BuildNode& node = build.AddOne();
+        node.Min = min;
+        node.Max = max;
+        node.Left = node.Right = -1;
+        node.Start = start;
+        node.Count = count;
+    }
+    if (count == 1)
+        return index;
+
+    // Find the best split plane by evaluating SAH cost of the bins along all axes
+    const Float3 centroidSize = centroidMax - centroidMin;
+    int32 bestAxis = -1, bestBin = 0;
+    float bestCost = MAX_float;
+    for (int32 axis = 0; axis < 3; axis++)
+    {
+        if (centroidSize.Raw[axis] <= ZeroTolerance)
+            continue;
+        const float binScale = (float)BVH_SAH_BINS / centroidSize.Raw[axis];
+        BuildBin bins[BVH_SAH_BINS];
+        for (int32 i = start; i < start + count; i++)
         {
-            uint32 I0, I1, I2;
-        };
-        scratch.Resize(root.Leaf.TriangleCount * sizeof(Tri));
-        auto dst = (Tri*)scratch.Get();
-        auto ib32 = meshData.IndexBuffer.Get<uint32>();
-        for (int32 i = indexStart; i < indexEnd;)
+            const BuildTriangle& tri = triangles[i];
+            BuildBin& bin = bins[GetBin(tri, axis, centroidMin.Raw[axis], binScale)];
+            bin.Min = Float3::Min(bin.Min, tri.Min);
+            bin.Max = Float3::Max(bin.Max, tri.Max);
+            bin.Count++;
+        }
+        float rightArea[BVH_SAH_BINS - 1];
+        int32 rightCount[BVH_SAH_BINS - 1];
+        BuildBin right;
+        for (int32 i = BVH_SAH_BINS - 1; i > 0; i--)
         {
-            const Tri tri = { ib32[i++], ib32[i++], ib32[i++] };
-            const float v0 = vb[tri.I0].Raw[axis];
-            const float v1 = vb[tri.I1].Raw[axis];
-            const float v2 = vb[tri.I2].Raw[axis];
-            const float centroid = (v0 + v1 + v2) * 0.333f;
-            if (centroid <= midPoint)
-                dst[left.Leaf.TriangleCount++] = tri; // Left
-            else
-                dst[root.Leaf.TriangleCount - ++right.Leaf.TriangleCount] = tri; // Right
+            right.Min = Float3::Min(right.Min, bins[i].Min);
+            right.Max = Float3::Max(right.Max, bins[i].Max);
+            right.Count += bins[i].Count;
+            rightArea[i - 1] = right.Count != 0 ? SurfaceArea(right.Min, right.Max) : 0.0f;
+            rightCount[i - 1] = right.Count;
         }
-        Platform::MemoryCopy(ib32 + indexStart, dst, root.Leaf.TriangleCount * 3 * sizeof(uint32));
-        if (left.Leaf.TriangleCount == 0 || right.Leaf.TriangleCount == 0)
+        BuildBin left;
+        for (int32 i = 0; i < BVH_SAH_BINS - 1; i++)
         {
-            axisCount++;
-            goto RETRY;
+            left.Min = Float3::Min(left.Min, bins[i].Min);
+            left.Max = Float3::Max(left.Max, bins[i].Max);
+            left.Count += bins[i].Count;
+            if (left.Count == 0 || rightCount[i] == 0)
+                continue;
+            const float cost = SurfaceArea(left.Min, left.Max) * (float)left.Count + rightArea[i] * (float)rightCount[i];
+            if (cost < bestCost)
+            {
+                bestCost = cost;
+                bestAxis = axis;
+                bestBin = i;
+            }
         }
+    }
 
-        left.Bounds = BoundingBox(vb[dst[0].I0]);
-        indexStart = 0;
-        indexEnd = left.Leaf.TriangleCount * 3;
-        for (int32 i = indexStart; i < indexEnd; i++)
-            left.Bounds.Merge(vb[((uint32*)scratch.Get())[i]]);
-
-        right.Bounds = BoundingBox(vb[dst[root.Leaf.TriangleCount - 1].I0]);
-        indexStart = left.Leaf.TriangleCount;
-        indexEnd = root.Leaf.TriangleCount * 3;
-        for (int32 i = indexStart; i < indexEnd; i++)
-            right.Bounds.Merge(vb[((uint32*)scratch.Get())[i]]);
+    // Split triangles
+    int32 mid;
+    if (bestAxis == -1)
+    {
+        // All centroids are in the same place so split in half if the leaf is too big
+        if (count <= maxLeafSize)
+            return index;
+        mid = start + count / 2;
     }
-    ASSERT_LOW_LAYER(left.Leaf.TriangleCount + right.Leaf.TriangleCount == root.Leaf.TriangleCount);
-    left.Leaf.TriangleIndex = root.Leaf.TriangleIndex;
-    right.Leaf.TriangleIndex = left.Leaf.TriangleIndex + left.Leaf.TriangleCount;
-
-    // Convert into a node
-    root.Node.IsLeaf = 0;
-    root.Node.ChildIndex = childIndex;
-    root.Node.ChildrenCount = 2;
-
-    // Split children
-    BuildBVH(childIndex, maxLeafSize, scratch);
-    BuildBVH(childIndex + 1, maxLeafSize, scratch);
+    else
+    {
+        const float parentArea = SurfaceArea(min, max);
+        const float splitCost = BVH_SAH_TRAVERSAL_COST + (parentArea > ZeroTolerance ? bestCost / parentArea : 0.0f);
+        if (count <= maxLeafSize && splitCost >= (float)count)
+            return index;
+        const float binScale = (float)BVH_SAH_BINS / centroidSize.Raw[bestAxis];
+        int32 i = start, j = start + count - 1;
+        while (i <= j)
+        {
+            if (GetBin(triangles[i], bestAxis, centroidMin.Raw[bestAxis], binScale) <= bestBin)
+                i++;
+            else
+                Swap(triangles[i], triangles[j--]);
+        }
+        mid = i;
+    }
+    const int32 left = BuildNodeSAH(build, triangles, start, mid - start, maxLeafSize);
+    const int32 right = BuildNodeSAH(build, triangles, mid, start + count - mid, maxLeafSize);
+    build[index].Left = left;
+    build[index].Right = right;
+    return index;
 }
 
-bool MeshAccelerationStructure::PointQueryBVH(int32 node, const Vector3& point, Real& hitDistance, Vector3& hitPoint, Triangle& hitTriangle) const
+int32 MeshAccelerationStructure::CollapseBVH(const Array<BuildNode>& build, int32 buildIndex)
 {
-    const auto& root = _bvh[node];
-    bool hit = false;
-    if (root.Leaf.IsLeaf)
+    // Pull up the grandchildren of the binary tree (the largest ones first) to fill the 4-wide node
+    int32 children[4];
+    int32 childrenCount = 0;
+    const BuildNode& root = build[buildIndex];
+    if (root.Left == -1)
     {
-        // Find closest triangle
-        Vector3 p;
-        const Mesh& meshData = _meshes[root.Leaf.MeshIndex];
-        const Float3* vb = meshData.VertexBuffer.Get<Float3>();
-        const int32 indexStart = root.Leaf.TriangleIndex * 3;
-        const int32 indexEnd = indexStart + root.Leaf.TriangleCount * 3;
-        if (meshData.Use16BitIndexBuffer)
+        children[childrenCount++] = buildIndex;
+    }
+    else
+    {
+        children[childrenCount++] = root.Left;
+        children[childrenCount++] = root.Right;
+    }
+    while (childrenCount < 4)
+    {
+        int32 best = -1;
+        float bestArea = -1.0f;
+        for (int32 i = 0; i < childrenCount; i++)
         {
-            const uint16* ib16 = meshData.IndexBuffer.Get<uint16>();
-            for (int32 i = indexStart; i < indexEnd;)
+            const BuildNode& child = build[children[i]];
+            const float area = SurfaceArea(child.Min, child.Max);
+            if (child.Left != -1 && area > bestArea)
             {
-                Vector3 v0 = vb[ib16[i++]];
-                Vector3 v1 = vb[ib16[i++]];
-                Vector3 v2 = vb[ib16[i++]];
-                CollisionsHelper::ClosestPointPointTriangle(point, v0, v1, v2, p);
-                const Real distance = Vector3::Distance(point, p);
-                if (distance < hitDistance)
-                {
-                    hitDistance = distance;
-                    hitPoint = p;
-                    hitTriangle = Triangle(v0, v1, v2);
-                    hit = true;
-                }
+                best = i;
+                bestArea = area;
             }
         }
-        else
+        if (best == -1)
+            break;
+        const BuildNode& child = build[children[best]];
+        children[best] = child.Left;
+        children[childrenCount++] = child.Right;
+    }
+
+    // Setup node (unused slots have inverted bounds)
+    const int32 index = _nodes.Count();
+    {
+        Node& node = _nodes.AddOne();
+        node.ChildrenCount = childrenCount;
+        for (int32 i = 0; i < 4; i++)
         {
-            const uint32* ib32 = meshData.IndexBuffer.Get<uint32>();
-            for (int32 i = indexStart; i < indexEnd;)
+            if (i < childrenCount)
             {
-                Vector3 v0 = vb[ib32[i++]];
-                Vector3 v1 = vb[ib32[i++]];
-                Vector3 v2 = vb[ib32[i++]];
-                CollisionsHelper::ClosestPointPointTriangle(point, v0, v1, v2, p);
-                const Real distance = Vector3::Distance(point, p);
-                if (distance < hitDistance)
-                {
-                    hitDistance = distance;
-                    hitPoint = p;
-                    hitTriangle = Triangle(v0, v1, v2);
-                    hit = true;
-                }
+                const BuildNode& child = build[children[i]];
+                node.MinX[i] = child.Min.X;
+                node.MinY[i] = child.Min.Y;
+                node.MinZ[i] = child.Min.Z;
+                node.MaxX[i] = child.Max.X;
+                node.MaxY[i] = child.Max.Y;
+                node.MaxZ[i] = child.Max.Z;
+                node.Children[i] = ~child.Start;
+                node.Counts[i] = child.Count;
+            }
+            else
+            {
+                node.MinX[i] = node.MinY[i] = node.MinZ[i] = MAX_float;
+                node.MaxX[i] = node.MaxY[i] = node.MaxZ[i] = -MAX_float;
+                node.Children[i] = ~0;
+                node.Counts[i] = 0;
             }
         }
     }
-    else
+    for (int32 i = 0; i < childrenCount; i++)
+    {
+        if (build[children[i]].Left == -1)
+            continue;
+        const int32 childIndex = CollapseBVH(build, children[i]);
+        _nodes[index].Children[i] = childIndex;
+        _nodes[index].Counts[i] = 0;
+    }
+    return index;
+}
+
+void MeshAccelerationStructure::FlattenBVH(int32 nodeIndex, Array<GPUNode>& nodes) const
+{
+    const Node& node = _nodes[nodeIndex];
+    for (int32 i = 0; i < node.ChildrenCount; i++)
     {
-        // Check all nested nodes
-        for (uint32 i = 0; i < root.Node.ChildrenCount; i++)
+        const int32 index = nodes.Count();
         {
-            const int32 index = root.Node.ChildIndex + i;
-            if (_bvh[index].Bounds.Distance(point) >= hitDistance)
-                continue;
-            if (PointQueryBVH(index, point, hitDistance, hitPoint, hitTriangle))
-                hit = true;
+            auto& e = nodes.AddOne();
+            e.BoundsMin = Float3(node.MinX[i], node.MinY[i], node.MinZ[i]);
+            e.BoundsMax = Float3(node.MaxX[i], node.MaxY[i], node.MaxZ[i]);
+            e.TrianglesStart = node.Children[i] < 0 ? ~node.Children[i] : 0;
+            e.TrianglesCount = node.Counts[i];
         }
+        if (node.Children[i] >= 0)
+            FlattenBVH(node.Children[i], nodes);
+        nodes[index].MissIndex = nodes.Count();
     }
-    return hit;
 }
 
-bool MeshAccelerationStructure::RayCastBVH(int32 node, const Ray& ray, Real& hitDistance, Vector3& hitNormal, Triangle& hitTriangle) const
+bool MeshAccelerationStructure::PointQueryBVH(const Vector3& point, Real& hitDistance, Vector3& hitPoint, Triangle& hitTriangle, Stack& stack) const
 {
-    const auto& root = _bvh[node];
-    if (!root.Bounds.Intersects(ray))
-        return false;
-    Vector3 normal;
-    Real distance;
+    const Float3 pointFloat = point;
+    const SimdVector4 px = SIMD::Splat(pointFloat.X);
+    const SimdVector4 py = SIMD::Splat(pointFloat.Y);
+    const SimdVector4 pz = SIMD::Splat(pointFloat.Z);
+    const SimdVector4 zero = SIMD::Splat(0.0f);
+    float bestDistanceSqr = hitDistance < MAX_float ? (float)(hitDistance * hitDistance) : MAX_float;
     bool hit = false;
-    if (root.Leaf.IsLeaf)
+    alignas(16) float distances[4];
+    Vector3 p;
+    stack.Clear();
+    stack.Add({ 0, 0, 0.0f });
+    while (stack.HasItems())
     {
-        // Ray cast along triangles in the leaf 
-        const Mesh& meshData = _meshes[root.Leaf.MeshIndex];
-        const Float3* vb = meshData.VertexBuffer.Get<Float3>();
-        const int32 indexStart = root.Leaf.TriangleIndex * 3;
-        const int32 indexEnd = indexStart + root.Leaf.TriangleCount * 3;
-        if (meshData.Use16BitIndexBuffer)
+        const StackEntry e = stack.Pop();
+
+        // Skip too far nodes
+        if (e.Distance >= bestDistanceSqr)
+            continue;
+
+        if (e.Child < 0)
         {
-            const uint16* ib16 = meshData.IndexBuffer.Get<uint16>();
-            for (int32 i = indexStart; i < indexEnd;)
+            // Find closest triangle in the leaf
+            const Float3* vb = _triangles.Get() + ~e.Child * 3;
+            for (uint32 i = 0; i < e.Count; i++, vb += 3)
             {
-                Vector3 v0 = vb[ib16[i++]];
-                Vector3 v1 = vb[ib16[i++]];
-                Vector3 v2 = vb[ib16[i++]];
-                if (CollisionsHelper::RayIntersectsTriangle(ray, v0, v1, v2, distance, normal) && distance < hitDistance)
+                const Vector3 v0 = vb[0], v1 = vb[1], v2 = vb[2];
+                CollisionsHelper::ClosestPointPointTriangle(point, v0, v1, v2, p);
+                const Real distanceSqr = Vector3::DistanceSquared(point, p);
+                if (distanceSqr < bestDistanceSqr)
                 {
-                    hitDistance = distance;
-                    hitNormal = normal;
+                    bestDistanceSqr = (float)distanceSqr;
+                    hitPoint = p;
                     hitTriangle = Triangle(v0, v1, v2);
                     hit = true;
                 }
@@ -252,14 +314,67 @@ bool MeshAccelerationStructure::RayCastBVH(int32 node, const Ray& ray, Real& hit
         }
         else
         {
-            const uint32* ib32 = meshData.IndexBuffer.Get<uint32>();
-            for (int32 i = indexStart; i < indexEnd;)
+            // Test all child bounds at once
+            const Node& node = _nodes.Get()[e.Child];
+            const SimdVector4 dx = SIMD::Max(SIMD::Max(SIMD::Sub(SIMD::Load(node.MinX), px), SIMD::Sub(px, SIMD::Load(node.MaxX))), zero);
+            const SimdVector4 dy = SIMD::Max(SIMD::Max(SIMD::Sub(SIMD::Load(node.MinY), py), SIMD::Sub(py, SIMD::Load(node.MaxY))), zero);
+            const SimdVector4 dz = SIMD::Max(SIMD::Max(SIMD::Sub(SIMD::Load(node.MinZ), pz), SIMD::Sub(pz, SIMD::Load(node.MaxZ))), zero);
+            const SimdVector4 distanceSqr = SIMD::Add(SIMD::Add(SIMD::Mul(dx, dx), SIMD::Mul(dy, dy)), SIMD::Mul(dz, dz));
+            const int32 mask = SIMD::MoveMask(SIMD::Less(distanceSqr, SIMD::Splat(bestDistanceSqr))) & ((1 << node.ChildrenCount) - 1);
+            if (mask == 0)
+                continue;
+            SIMD::Store(distances, distanceSqr);
+            PushSorted(stack, node.Children, node.Counts, distances, mask);
+        }
+    }
+    if (hit)
+        hitDistance = Math::Sqrt((Real)bestDistanceSqr);
+    return hit;
+}
+
+bool MeshAccelerationStructure::RayCastBVH(const Ray& ray, Real& hitDistance, Vector3& hitNormal, Triangle& hitTriangle, Stack& stack) const
+{
+    const Float3 position = ray.Position;
+    const Float3 direction = ray.Direction;
+    Float3 invDirection;
+    for (int32 i = 0; i < 3; i++)
+    {
+        // Prevent NaNs for axis-aligned rays (0 * inf)
+        const float d = direction.Raw[i];
+        invDirection.Raw[i] = Math::Abs(d) > ZeroTolerance ? 1.0f / d : (d < 0.0f ? -1e20f : 1e20f);
+    }
+    const SimdVector4 ox = SIMD::Splat(position.X);
+    const SimdVector4 oy = SIMD::Splat(position.Y);
+    const SimdVector4 oz = SIMD::Splat(position.Z);
+    const SimdVector4 ix = SIMD::Splat(invDirection.X);
+    const SimdVector4 iy = SIMD::Splat(invDirection.Y);
+    const SimdVector4 iz = SIMD::Splat(invDirection.Z);
+    const SimdVector4 zero = SIMD::Splat(0.0f);
+    float bestDistance = hitDistance < MAX_float ? (float)hitDistance : MAX_float;
+    bool hit = false;
+    alignas(16) float distances[4];
+    Vector3 normal;
+    Real distance;
+    stack.Clear();
+    stack.Add({ 0, 0, 0.0f });
+    while (stack.HasItems())
+    {
+        const StackEntry e = stack.Pop();
+
+        // Skip nodes behind the closest hit
+        if (e.Distance > bestDistance)
+            continue;
+
+        if (e.Child < 0)
+        {
+            // Ray cast along triangles in the leaf
+            const Float3* vb = _triangles.Get() + ~e.Child * 3;
+            for (uint32 i = 0; i < e.Count; i++, vb += 3)
             {
-                Vector3 v0 = vb[ib32[i++]];
-                Vector3 v1 = vb[ib32[i++]];
-                Vector3 v2 = vb[ib32[i++]];
-                if (CollisionsHelper::RayIntersectsTriangle(ray, v0, v1, v2, distance, normal) && distance < hitDistance)
+                const Vector3 v0 = vb[0], v1 = vb[1], v2 = vb[2];
+                if (CollisionsHelper::RayIntersectsTriangle(ray, v0, v1, v2, distance, normal) && distance < bestDistance)
                 {
+                    bestDistance = (float)distance;
                     hitDistance = distance;
                     hitNormal = normal;
                     hitTriangle = Triangle(v0, v1, v2);
@@ -267,22 +382,23 @@ bool MeshAccelerationStructure::RayCastBVH(int32 node, const Ray& ray, Real& hit
                 }
             }
         }
-    }
-    else
-    {
-        // Ray cast all child nodes
-        Triangle triangle;
-        for (uint32 i = 0; i < root.Node.ChildrenCount; i++)
+        else
         {
-            const int32 index = root.Node.ChildIndex + i;
-            distance = hitDistance;
-            if (RayCastBVH(index, ray, distance, normal, triangle) && distance < hitDistance)
-            {
-                hitDistance = distance;
-                hitNormal = normal;
-                hitTriangle = triangle;
-                hit = true;
-            }
+            // Test all child bounds at once (slab test)
+            const Node& node = _nodes.Get()[e.Child];
+            const SimdVector4 t0x = SIMD::Mul(SIMD::Sub(SIMD::Load(node.MinX), ox), ix);
+            const SimdVector4 t1x = SIMD::Mul(SIMD::Sub(SIMD::Load(node.MaxX), ox), ix);
+            const SimdVector4 t0y = SIMD::Mul(SIMD::Sub(SIMD::Load(node.MinY), oy), iy);
+            const SimdVector4 t1y = SIMD::Mul(SIMD::Sub(SIMD::Load(node.MaxY), oy), iy);
+            const SimdVector4 t0z = SIMD::Mul(SIMD::Sub(SIMD::Load(node.MinZ), oz), iz);
+            const SimdVector4 t1z = SIMD::Mul(SIMD::Sub(SIMD::Load(node.MaxZ), oz), iz);
+            const SimdVector4 tEnter = SIMD::Max(SIMD::Max(SIMD::Min(t0x, t1x), SIMD::Min(t0y, t1y)), SIMD::Max(SIMD::Min(t0z, t1z), zero));
+            const SimdVector4 tExit = SIMD::Min(SIMD::Min(SIMD::Max(t0x, t1x), SIMD::Max(t0y, t1y)), SIMD::Min(SIMD::Max(t0z, t1z), SIMD::Splat(bestDistance)));
+            const int32 mask = ~SIMD::MoveMask(SIMD::Less(tExit, tEnter)) & ((1 << node.ChildrenCount) - 1);
+            if (mask == 0)
+                continue;
+            SIMD::Store(distances, tEnter);
+            PushSorted(stack, node.Children, node.Counts, distances, mask);
         }
     }
     return hit;
@@ -384,78 +500,81 @@ void MeshAccelerationStructure::Add(Float3* vb, int32 vertices, void* ib, int32
     meshData.Use16BitIndexBuffer = use16BitIndex;
 }
 
+
 void MeshAccelerationStructure::BuildBVH(int32 maxLeafSize)
 {
+    _nodes.Clear();
+    _triangles.Clear();
     if (_meshes.Count() == 0)
         return;
     PROFILE_CPU();
 
-    // Estimate memory usage
+    // Gather triangles from all meshes
     int32 trianglesCount = 0;
     for (const Mesh& meshData : _meshes)
         trianglesCount += meshData.Indices / 3;
-    _bvh.Clear();
-    _bvh.EnsureCapacity(trianglesCount / maxLeafSize);
-
-    // Init with the root node and all meshes as leaves
-    auto& root = _bvh.AddOne();
-    root.Node.IsLeaf = 0;
-    root.Node.ChildIndex = 1;
-    root.Node.ChildrenCount = _meshes.Count();
-    root.Bounds = _meshes[0].Bounds;
-    for (int32 i = 0; i < _meshes.Count(); i++)
+    if (trianglesCount == 0)
+        return;
+    Array<Float3> vertices;
+    vertices.Resize(trianglesCount * 3);
+    Array<BuildTriangle> triangles;
+    triangles.Resize(trianglesCount);
+    Float3* dst = vertices.Get();
+    for (const Mesh& meshData : _meshes)
     {
-        const Mesh& meshData = _meshes[i];
-        auto& child = _bvh.AddOne();
-        child.Leaf.IsLeaf = 1;
-        child.Leaf.MeshIndex = i;
-        child.Leaf.TriangleIndex = 0;
-        child.Leaf.TriangleCount = meshData.Indices / 3;
-        child.Bounds = meshData.Bounds;
-        BoundingBox::Merge(root.Bounds, meshData.Bounds, root.Bounds);
+        const Float3* vb = meshData.VertexBuffer.Get<Float3>();
+        const int32 indices = meshData.Indices / 3 * 3;
+        if (meshData.Use16BitIndexBuffer)
+        {
+            const uint16* ib16 = meshData.IndexBuffer.Get<uint16>();
+            for (int32 i = 0; i < indices; i++)
+                *dst++ = vb[ib16[i]];
+        }
+        else
+        {
+            const uint32* ib32 = meshData.IndexBuffer.Get<uint32>();
+            for (int32 i = 0; i < indices; i++)
+                *dst++ = vb[ib32[i]];
+        }
     }
+    for (int32 i = 0; i < trianglesCount; i++)
+    {
+        const Float3* v = vertices.Get() + i * 3;
+        BuildTriangle& tri = triangles.Get()[i];
+        tri.Min = Float3::Min(Float3::Min(v[0], v[1]), v[2]);
+        tri.Max = Float3::Max(Float3::Max(v[0], v[1]), v[2]);
+        tri.Centroid = (tri.Min + tri.Max) * 0.5f;
+        tri.Index = i;
+    }
+
+    // Build binary tree with binned SAH
+    Array<BuildNode> build;
+    build.EnsureCapacity(trianglesCount / Math::Max(maxLeafSize / 2, 1) * 2 + 1);
+    BuildNodeSAH(build, triangles.Get(), 0, trianglesCount, Math::Max(maxLeafSize, 1));
 
-    // Sub-divide mesh nodes into smaller leaves
-    Array<byte> scratch;
-    for (int32 i = 0; i < _meshes.Count(); i++)
-        BuildBVH(i + 1, maxLeafSize, scratch);
+    // Collapse into 4-wide tree
+    _nodes.EnsureCapacity(build.Count() / 2 + 1);
+    CollapseBVH(build, 0);
+
+    // Store triangles in order of the leaves
+    _triangles.Resize(trianglesCount * 3);
+    for (int32 i = 0; i < trianglesCount; i++)
+        Platform::MemoryCopy(_triangles.Get() + i * 3, vertices.Get() + triangles.Get()[i].Index * 3, sizeof(Float3) * 3);
 }
 
 bool MeshAccelerationStructure::PointQuery(const Vector3& point, Real& hitDistance, Vector3& hitPoint, Triangle& hitTriangle, Real maxDistance) const
 {
-    hitDistance = maxDistance >= MAX_Real ? maxDistance : maxDistance * maxDistance;
-    bool hit = false;
-
     // BVH
-    if (_bvh.Count() != 0)
+    if (_nodes.Count() != 0)
     {
-        Array<int32, InlinedAllocation<32>> stack;
-        stack.Push(0);
-        while (stack.HasItems())
-        {
-            const int32 node = stack.Pop();
-            auto& root = _bvh[node];
-
-            // Skip too far nodes
-            if (root.Bounds.Distance(point) >= hitDistance)
-                continue;
-
-            if (root.Leaf.IsLeaf)
-            {
-                // Check this leaf
-                hit |= PointQueryBVH(node, point, hitDistance, hitPoint, hitTriangle);
-            }
-            else
-            {
-                // Check this node children
-                for (uint32 i = 0; i < root.Node.ChildrenCount; i++)
-                    stack.Push(root.Node.ChildIndex + i);
-            }
-        }
-        //hit = PointQueryBVH(0, point, hitDistance, hitPoint, hitTriangle);
-        return hit;
+        hitDistance = maxDistance;
+        Stack stack;
+        return PointQueryBVH(point, hitDistance, hitPoint, hitTriangle, stack);
     }
 
+    hitDistance = maxDistance >= MAX_Real ? maxDistance : maxDistance * maxDistance;
+    bool hit = false;
+
     // Brute-force
     {
         Vector3 p;
@@ -507,14 +626,16 @@ bool MeshAccelerationStructure::PointQuery(const Vector3& point, Real& hitDistan
     }
 }
 
+
 bool MeshAccelerationStructure::RayCast(const Ray& ray, Real& hitDistance, Vector3& hitNormal, Triangle& hitTriangle, Real maxDistance) const
 {
     hitDistance = maxDistance;
 
     // BVH
-    if (_bvh.Count() != 0)
+    if (_nodes.Count() != 0)
     {
-        return RayCastBVH(0, ray, hitDistance, hitNormal, hitTriangle);
+        Stack stack;
+        return RayCastBVH(ray, hitDistance, hitNormal, hitTriangle, stack);
     }
 
     // Brute-force
@@ -566,4 +687,48 @@ bool MeshAccelerationStructure::RayCast(const Ray& ray, Real& hitDistance, Vecto
     }
 }
 
+void MeshAccelerationStructure::PointQuery(const Span<Vector3>& points, Span<Real> hitDistances, Real maxDistance) const
+{
+    ASSERT(points.Length() == hitDistances.Length());
+    Stack stack;
+    Vector3 hitPoint;
+    Triangle hitTriangle;
+    for (int32 i = 0; i < points.Length(); i++)
+    {
+        Real& hitDistance = hitDistances[i];
+        hitDistance = maxDistance;
+        if (_nodes.Count() != 0)
+            PointQueryBVH(points[i], hitDistance, hitPoint, hitTriangle, stack);
+    }
+}
+
+void MeshAccelerationStructure::RayCast(const Span<Ray>& rays, Span<Real> hitDistances, Span<Vector3> hitNormals, Real maxDistance) const
+{
+    ASSERT(rays.Length() == hitDistances.Length() && rays.Length() == hitNormals.Length());
+    Stack stack;
+    Vector3 hitNormal;
+    Triangle hitTriangle;
+    for (int32 i = 0; i < rays.Length(); i++)
+    {
+        Real& hitDistance = hitDistances[i];
+        hitDistance = maxDistance;
+        if (_nodes.Count() != 0 && RayCastBVH(rays[i], hitDistance, hitNormal, hitTriangle, stack))
+            hitNormals[i] = hitTriangle.GetNormal();
+        else
+            hitNormals[i] = Vector3::Zero;
+    }
+}
+
+void MeshAccelerationStructure::GetGPUData(Array<GPUNode>& nodes, Array<Float3>& triangles) const
+{
+    PROFILE_CPU();
+    nodes.Clear();
+    triangles.Clear();
+    if (_nodes.Count() == 0)
+        return;
+    nodes.EnsureCapacity(_nodes.Count() * 4);
+    triangles.Set(_triangles.Get(), _triangles.Count());
+    FlattenBVH(0, nodes);
+}
+
 #endif
@@ -7,6 +7,7 @@
 #include "Engine/Core/Math/Triangle.h"
 #include "Engine/Core/Math/BoundingBox.h"
 #include "Engine/Core/Types/DataContainer.h"
+#include "Engine/Core/Types/Span.h"
 #include "Engine/Core/Collections/Array.h"
 
 class Model;
@@ -17,6 +18,17 @@ class ModelData;
 /// </summary>
 class FLAXENGINE_API MeshAccelerationStructure
 {
+public:
+    // Flattened BVH node for stackless traversal on a GPU (nodes are in depth-first order, MissIndex points to the next node after the subtree).
+    struct GPUNode
+    {
+        Float3 BoundsMin;
+        uint32 MissIndex;
+        Float3 BoundsMax;
+        uint32 TrianglesStart;
+        uint32 TrianglesCount; // Zero for non-leaf nodes
+    };
+
 private:
     struct Mesh
     {
@@ -26,35 +38,36 @@ class FLAXENGINE_API MeshAccelerationStructure
         BoundingBox Bounds;
     };
 
-    struct BVH
+    // BVH node with bounds of up to 4 children stored in SoA layout for SIMD tests.
+    struct alignas(16) Node
     {
-        BoundingBox Bounds;
+        float MinX[4], MinY[4], MinZ[4];
+        float MaxX[4], MaxY[4], MaxZ[4];
+        int32 Children[4]; // Child node index or bitwise negated start triangle of the leaf (negative value)
+        uint32 Counts[4]; // Triangles count in the leaf (zero for child nodes)
+        int32 ChildrenCount;
+    };
 
-        union
-        {
-            struct
-            {
-                uint32 IsLeaf : 1;
-                uint16 TriangleCount : 15;
-                uint16 MeshIndex : 16;
-                uint32 TriangleIndex;
-            } Leaf;
-
-            struct
-            {
-                uint32 IsLeaf : 1;
-                uint32 ChildrenCount : 31;
-                int32 ChildIndex;
-            } Node;
-        };
+    struct StackEntry
+    {
+        int32 Child;
+        uint32 Count;
+        float Distance;
     };
 
+    struct BuildNode;
+    struct BuildTriangle;
+    typedef Array<StackEntry, InlinedAllocation<64>> Stack;
+
     Array<Mesh, InlinedAllocation<16>> _meshes;
-    Array<BVH> _bvh;
+    Array<Node> _nodes;
+    Array<Float3> _triangles; // Vertices of the triangles (3 per triangle) sorted by the BVH leaves
 
-    void BuildBVH(int32 node, int32 maxLeafSize, Array<byte>& scratch);
-    bool PointQueryBVH(int32 node, const Vector3& point, Real& hitDistance, Vector3& hitPoint, Triangle& hitTriangle) const;
-    bool RayCastBVH(int32 node, const Ray& ray, Real& hitDistance, Vector3& hitNormal, Triangle& hitTriangle) const;
+    static int32 BuildNodeSAH(Array<BuildNode>& build, BuildTriangle* triangles, int32 start, int32 count, int32 maxLeafSize);
+    int32 CollapseBVH(const Array<BuildNode>& build, int32 buildIndex);
+    void FlattenBVH(int32 nodeIndex, Array<GPUNode>& nodes) const;
+    bool PointQueryBVH(const Vector3& point, Real& hitDistance, Vector3& hitPoint, Triangle& hitTriangle, Stack& stack) const;
+    bool RayCastBVH(const Ray& ray, Real& hitDistance, Vector3& hitNormal, Triangle& hitTriangle, Stack& stack) const;
 
 public:
     // Adds the model geometry for the build to the structure.
@@ -66,14 +79,23 @@ class FLAXENGINE_API MeshAccelerationStructure
     // Adds the triangles geometry for the build to the structure.
     void Add(Float3* vb, int32 vertices, void* ib, int32 indices, bool use16BitIndex, bool copy = false);
 
-    // Builds Bounding Volume Hierarchy (BVH) structure for accelerated geometry queries.
-    void BuildBVH(int32 maxLeafSize = 16);
+    // Builds Bounding Volume Hierarchy (BVH) structure for accelerated geometry queries (binned SAH build collapsed into 4-wide nodes).
+    void BuildBVH(int32 maxLeafSize = 8);
 
     // Queries the closest triangle.
     bool PointQuery(const Vector3& point, Real& hitDistance, Vector3& hitPoint, Triangle& hitTriangle, Real maxDistance = MAX_Real) const;
 
     // Ray traces the triangles.
     bool RayCast(const Ray& ray, Real& hitDistance, Vector3& hitNormal, Triangle& hitTriangle, Real maxDistance = MAX_Real) const;
+
+    // Queries the distance to the closest triangle for each point (maxDistance if nothing was found). Requires BuildBVH to be called before.
+    void PointQuery(const Span<Vector3>& points, Span<Real> hitDistances, Real maxDistance = MAX_Real) const;
+
+    // Ray traces the triangles for each ray. Outputs the hit distance (maxDistance if missed) and the normal of the hit triangle (not flipped towards the ray). Requires BuildBVH to be called before.
+    void RayCast(const Span<Ray>& rays, Span<Real> hitDistances, Span<Vector3> hitNormals, Real maxDistance = MAX_Real) const;
+
+    // Flattens the BVH structure and the triangles (3 vertices each, in order of the leaves) for the geometry queries on a GPU. Requires BuildBVH to be called before.
+    void GetGPUData(Array<GPUNode>& nodes, Array<Float3>& triangles) const;
 };
 
 #endif
@@ -10,13 +10,20 @@
 #include "Engine/Core/Math/Ray.h"
 #include "Engine/Profiler/ProfilerCPU.h"
 #include "Engine/Threading/JobSystem.h"
+#include "Engine/Threading/Threading.h"
 #include "Engine/Graphics/RenderTools.h"
+#include "Engine/Graphics/GPUBuffer.h"
+#include "Engine/Graphics/GPUContext.h"
+#include "Engine/Graphics/GPUDevice.h"
+#include "Engine/Graphics/Shaders/GPUShader.h"
 #include "Engine/Graphics/Async/GPUTask.h"
 #include "Engine/Graphics/Textures/GPUTexture.h"
 #include "Engine/Graphics/Textures/TextureData.h"
 #include "Engine/Graphics/Models/ModelData.h"
 #include "Engine/Content/Assets/Model.h"
 #include "Engine/Content/Content.h"
+#include "Engine/Content/AssetReference.h"
+#include "Engine/Content/Assets/Shader.h"
 #include "Engine/Serialization/MemoryWriteStream.h"
 #if USE_EDITOR
 #include "Engine/Core/Utilities.h"
@@ -70,7 +77,150 @@ ModelSDFMip::ModelSDFMip(int32 mipIndex, const TextureMipData& mip)
 {
 }
 
-bool ModelTool::GenerateModelSDF(Model* inputModel, ModelData* modelData, float resolutionScale, int32 lodIndex, ModelBase::SDFData* outputSDF, MemoryWriteStream* outputStream, const StringView& assetName, float backfacesThreshold)
+#define MODEL_SDF_SAMPLES_COUNT 12
+#define MODEL_SDF_GPU_GROUP_SIZE 4
+#define MODEL_SDF_GPU_DISPATCH_SLICES 8
+
+static_assert(sizeof(MeshAccelerationStructure::GPUNode) == 36, "Update BVHNode in ModelSDF shader.");
+
+namespace
+{
+    PACK_STRUCT(struct ModelSDFData {
+        Float3 XyzToLocalMul;
+        float MaxDistance;
+        Float3 XyzToLocalAdd;
+        float BackfacesThreshold;
+        Int3 Resolution;
+        uint32 NodesCount;
+        Float2 EncodeMAD;
+        uint32 ZOffset;
+        float Dummy0;
+        Float4 SampleDirections[MODEL_SDF_SAMPLES_COUNT];
+        });
+
+    class GPUModelSDFTask : public GPUTask
+    {
+    public:
+        ModelSDFData Data;
+        GPUShader* Shader;
+        GPUBuffer* Nodes;
+        GPUBuffer* Triangles;
+        GPUBuffer* Output;
+        GPUBuffer* Staging;
+
+        GPUModelSDFTask()
+            : GPUTask(Type::Custom)
+        {
+        }
+
+    protected:
+        Result run(GPUTasksContext* context) override
+        {
+            GPUContext* gpu = context->GPU;
+            GPUConstantBuffer* cb = Shader->GetCB(0);
+            GPUShaderProgramCS* cs = Shader->GetCS("CS_GenerateSDF");
+            gpu->BindSR(0, Nodes->View());
+            gpu->BindSR(1, Triangles->View());
+            gpu->BindUA(0, Output->View());
+            gpu->BindCB(0, cb);
+
+            // Split work into smaller dispatches to prevent GPU timeouts on large models
+            const int32 groupsX = Math::DivideAndRoundUp(Data.Resolution.X, MODEL_SDF_GPU_GROUP_SIZE);
+            const int32 groupsY = Math::DivideAndRoundUp(Data.Resolution.Y, MODEL_SDF_GPU_GROUP_SIZE);
+            for (int32 z = 0; z < Data.Resolution.Z; z += MODEL_SDF_GPU_DISPATCH_SLICES)
+            {
+                Data.ZOffset = z;
+                gpu->UpdateCB(cb, &Data);
+                const int32 groupsZ = Math::DivideAndRoundUp(Math::Min(Data.Resolution.Z - z, MODEL_SDF_GPU_DISPATCH_SLICES), MODEL_SDF_GPU_GROUP_SIZE);
+                gpu->Dispatch(cs, groupsX, groupsY, groupsZ);
+            }
+
+            gpu->ResetUA();
+            gpu->ResetSR();
+            gpu->ResetCB();
+            gpu->CopyBuffer(Staging, Output, Output->GetSize());
+            return Result::Ok;
+        }
+    };
+
+    GPUBuffer* CreateSDFBuffer(const Char* name, const GPUBufferDescription& desc)
+    {
+        auto* buffer = GPUDevice::Instance->CreateBuffer(name);
+        if (buffer->Init(desc))
+        {
+            SAFE_DELETE_GPU_RESOURCE(buffer);
+        }
+        return buffer;
+    }
+
+    // Generates the SDF voxels (encoded distances, one float per voxel) on a GPU. Returns true if failed or not supported.
+    bool GenerateModelSDFGPU(const MeshAccelerationStructure& scene, ModelSDFData& data, BytesContainer& result)
+    {
+        // GPU tasks are executed on a main thread so it cannot wait for them
+        if (IsInMainThread() || !GPUDevice::Instance || GPUDevice::Instance->GetState() != GPUDevice::DeviceState::Ready || !GPUDevice::Instance->Limits.HasCompute)
+            return true;
+        PROFILE_CPU();
+        AssetReference<Shader> shader = Content::LoadAsyncInternal<Shader>(TEXT("Shaders/ModelSDF"));
+        if (!shader || shader->WaitForLoaded())
+            return true;
+        const GPUConstantBuffer* cb = shader->GetShader()->GetCB(0);
+        if (!cb || cb->GetSize() != sizeof(ModelSDFData) || !shader->GetShader()->GetCS("CS_GenerateSDF"))
+        {
+            LOG(Warning, "Invalid shader {0} for model SDF generation.", shader->ToString());
+            return true;
+        }
+
+        // Upload geometry
+        Array<MeshAccelerationStructure::GPUNode> nodes;
+        Array<Float3> triangles;
+        scene.GetGPUData(nodes, triangles);
+        if (nodes.IsEmpty() || triangles.IsEmpty())
+            return true;
+        data.NodesCount = nodes.Count();
+        const int32 voxelsCount = data.Resolution.X * data.Resolution.Y * data.Resolution.Z;
+        GPUBuffer* nodesBuffer = nullptr;
+        GPUBuffer* trianglesBuffer = nullptr;
+        GPUBuffer* outputBuffer = nullptr;
+        GPUBuffer* stagingBuffer = nullptr;
+        {
+            ScopeLock gpuLock(GPUDevice::Instance->Locker);
+            auto desc = GPUBufferDescription::Structured(nodes.Count(), sizeof(MeshAccelerationStructure::GPUNode));
+            desc.InitData = nodes.Get();
+            nodesBuffer = CreateSDFBuffer(TEXT("ModelSDF.Nodes"), desc);
+            desc = GPUBufferDescription::Structured(triangles.Count(), sizeof(Float3));
+            desc.InitData = triangles.Get();
+            trianglesBuffer = CreateSDFBuffer(TEXT("ModelSDF.Triangles"), desc);
+            outputBuffer = CreateSDFBuffer(TEXT("ModelSDF.Output"), GPUBufferDescription::Typed(voxelsCount, PixelFormat::R32_Float, true));
+            if (outputBuffer)
+                stagingBuffer = outputBuffer->ToStagingReadback();
+        }
+
+        // Run compute shader and download the results
+        bool failed = !nodesBuffer || !trianglesBuffer || !outputBuffer || !stagingBuffer;
+        if (!failed)
+        {
+            auto task = New<GPUModelSDFTask>();
+            task->Data = data;
+            task->Shader = shader->GetShader();
+            task->Nodes = nodesBuffer;
+            task->Triangles = trianglesBuffer;
+            task->Output = outputBuffer;
+            task->Staging = stagingBuffer;
+            task->Start();
+            failed = task->Wait() || stagingBuffer->GetData(result);
+        }
+
+        SAFE_DELETE_GPU_RESOURCE(nodesBuffer);
+        SAFE_DELETE_GPU_RESOURCE(trianglesBuffer);
+        SAFE_DELETE_GPU_RESOURCE(outputBuffer);
+        SAFE_DELETE_GPU_RESOURCE(stagingBuffer);
+        if (failed)
+            LOG(Warning, "Failed to generate model SDF on a GPU.");
+        return failed;
+    }
+}
+
+bool ModelTool::GenerateModelSDF(Model* inputModel, ModelData* modelData, float resolutionScale, int32 lodIndex, ModelBase::SDFData* outputSDF, MemoryWriteStream* outputStream, const StringView& assetName, float backfacesThreshold, bool useGPU)
 {
     PROFILE_CPU();
     auto startTime = Platform::GetTimeSeconds();
@@ -143,8 +293,6 @@ bool ModelTool::GenerateModelSDF(Model* inputModel, ModelData* modelData, float
 #endif
     }
 
-    // TODO: support GPU to generate model SDF on-the-fly (if called during rendering)
-
     // Setup acceleration structure for fast ray tracing the mesh triangles
     MeshAccelerationStructure scene;
     if (inputModel)
@@ -169,7 +317,7 @@ bool ModelTool::GenerateModelSDF(Model* inputModel, ModelData* modelData, float
     // https://www.cse.chalmers.se/~uffe/HighResolutionSparseVoxelDAGs.pdf
 
     // Brute-force for each voxel to calculate distance to the closest triangle with point query and distance sign by raycasting around the voxel
-    const int32 sampleCount = 12;
+    const int32 sampleCount = MODEL_SDF_SAMPLES_COUNT;
     Array<Float3> sampleDirections;
     sampleDirections.Resize(sampleCount);
     {
@@ -186,9 +334,11 @@ bool ModelTool::GenerateModelSDF(Model* inputModel, ModelData* modelData, float
     Function<void(int32)> sdfJob = [&sdf, &resolution, &backfacesThreshold, &sampleDirections, &scene, &voxels, &xyzToLocalMul, &xyzToLocalAdd, &encodeMAD, &formatStride, &formatWrite](int32 z)
     {
         PROFILE_CPU_NAMED("Model SDF Job");
-        Real hitDistance;
-        Vector3 hitNormal, hitPoint;
+        Vector3 hitPoint;
         Triangle hitTriangle;
+        Ray sampleRays[MODEL_SDF_SAMPLES_COUNT];
+        Real sampleHitDistances[MODEL_SDF_SAMPLES_COUNT];
+        Vector3 sampleHitNormals[MODEL_SDF_SAMPLES_COUNT];
         const int32 zAddress = resolution.Y * resolution.X * z;
         for (int32 y = 0; y < resolution.Y; y++)
         {
@@ -199,17 +349,19 @@ bool ModelTool::GenerateModelSDF(Model* inputModel, ModelData* modelData, float
                 Vector3 voxelPos = Float3((float)x, (float)y, (float)z) * xyzToLocalMul + xyzToLocalAdd;
 
                 // Point query to find the distance to the closest surface
-                scene.PointQuery(voxelPos, minDistance, hitPoint, hitTriangle);
+                scene.PointQuery(voxelPos, minDistance, hitPoint, hitTriangle, sdf.MaxDistance);
 
                 // Raycast samples around voxel to count triangle backfaces hit
                 int32 hitBackCount = 0, hitCount = 0;
-                for (int32 sample = 0; sample < sampleDirections.Count(); sample++)
+                for (int32 sample = 0; sample < MODEL_SDF_SAMPLES_COUNT; sample++)
+                    sampleRays[sample] = Ray(voxelPos, sampleDirections[sample]);
+                scene.RayCast(Span<Ray>(sampleRays, MODEL_SDF_SAMPLES_COUNT), Span<Real>(sampleHitDistances, MODEL_SDF_SAMPLES_COUNT), Span<Vector3>(sampleHitNormals, MODEL_SDF_SAMPLES_COUNT));
+                for (int32 sample = 0; sample < MODEL_SDF_SAMPLES_COUNT; sample++)
                 {
-                    Ray sampleRay(voxelPos, sampleDirections[sample]);
-                    if (scene.RayCast(sampleRay, hitDistance, hitNormal, hitTriangle))
+                    if (sampleHitDistances[sample] < MAX_Real)
                     {
                         hitCount++;
-                        const bool backHit = Float3::Dot(sampleRay.Direction, hitTriangle.GetNormal()) > 0;
+                        const bool backHit = Float3::Dot(sampleRays[sample].Direction, sampleHitNormals[sample]) > 0;
                         if (backHit)
                             hitBackCount++;
                     }
@@ -228,7 +380,36 @@ bool ModelTool::GenerateModelSDF(Model* inputModel, ModelData* modelData, float
             }
         }
     };
-    JobSystem::Execute(sdfJob, resolution.Z);
+    BytesContainer gpuVoxels;
+    if (useGPU)
+    {
+        // Compute shader brute-forces all voxels in parallel against the flattened BVH
+        ModelSDFData data;
+        data.XyzToLocalMul = xyzToLocalMul;
+        data.MaxDistance = sdf.MaxDistance;
+        data.XyzToLocalAdd = xyzToLocalAdd;
+        data.BackfacesThreshold = backfacesThreshold;
+        data.Resolution = resolution;
+        data.EncodeMAD = encodeMAD;
+        data.ZOffset = 0;
+        data.Dummy0 = 0;
+        for (int32 i = 0; i < sampleCount; i++)
+            data.SampleDirections[i] = Float4(sampleDirections[i], 0);
+        if (GenerateModelSDFGPU(scene, data, gpuVoxels))
+            useGPU = false;
+    }
+    if (useGPU)
+    {
+        // Convert the encoded distances into the texture format
+        const float* src = gpuVoxels.Get<float>();
+        const int32 voxelsCount = resolution.X * resolution.Y * resolution.Z;
+        for (int32 i = 0; i < voxelsCount; i++)
+            formatWrite((byte*)voxels + i * formatStride, Math::Clamp(src[i], 0.0f, formatMaxValue));
+    }
+    else
+    {
+        JobSystem::Execute(sdfJob, resolution.Z, 1, JobPriority::Background);
+    }
 
     // Cache SDF data on a CPU
     if (outputStream)
@@ -294,7 +475,7 @@ bool ModelTool::GenerateModelSDF(Model* inputModel, ModelData* modelData, float
                 }
             }
         };
-        JobSystem::Execute(mipJob, resolutionMip.Z);
+        JobSystem::Execute(mipJob, resolutionMip.Z, 1, JobPriority::Background);
 
         // Cache SDF data on a CPU
         if (outputStream)
@@ -325,7 +506,7 @@ bool ModelTool::GenerateModelSDF(Model* inputModel, ModelData* modelData, float
 
 #if !BUILD_RELEASE
     auto endTime = Platform::GetTimeSeconds();
-    LOG(Info, "Generated SDF {}x{}x{} ({} kB) in {}ms for {}", resolution.X, resolution.Y, resolution.Z, voxelSizeSum / 1024, (int32)((endTime - startTime) * 1000.0), assetName);
+    LOG(Info, "Generated SDF {}x{}x{} ({} kB) in {}ms for {}{}", resolution.X, resolution.Y, resolution.Z, voxelSizeSum / 1024, (int32)((endTime - startTime) * 1000.0), assetName, useGPU ? TEXT(" (GPU)") : TEXT(""));
 #endif
     return false;
 }
@@ -349,6 +530,8 @@ void ModelTool::Options::Serialize(SerializeStream& stream, const void* otherObj
     SERIALIZE(ImportBlendShapes);
     SERIALIZE(CalculateBoneOffsetMatrices);
     SERIALIZE(LightmapUVsSource);
+    SERIALIZE(GenerateMeshlets);
+    SERIALIZE(QuantizePositions);
     SERIALIZE(CollisionMeshesPrefix);
     SERIALIZE(Scale);
     SERIALIZE(Rotation);
@@ -361,6 +544,8 @@ void ModelTool::Options::Serialize(SerializeStream& stream, const void* otherObj
     SERIALIZE(SamplingRate);
     SERIALIZE(SkipEmptyCurves);
     SERIALIZE(OptimizeKeyframes);
+    SERIALIZE(CompressKeyframes);
+    SERIALIZE(CompressionTolerance);
     SERIALIZE(ImportScaleTracks);
     SERIALIZE(RootMotion);
     SERIALIZE(RootMotionFlags);
@@ -371,6 +556,9 @@ void ModelTool::Options::Serialize(SerializeStream& stream, const void* otherObj
     SERIALIZE(TriangleReduction);
     SERIALIZE(SloppyOptimization);
     SERIALIZE(LODTargetError);
+    SERIALIZE(GenerateShadowProxy);
+    SERIALIZE(ShadowProxyTriangleReduction);
+    SERIALIZE(ShadowProxyLOD);
     SERIALIZE(ImportMaterials);
     SERIALIZE(ImportMaterialsAsInstances);
     SERIALIZE(InstanceToImportAs);
@@ -379,6 +567,7 @@ void ModelTool::Options::Serialize(SerializeStream& stream, const void* otherObj
     SERIALIZE(SkipExistingMaterialsOnReimport);
     SERIALIZE(GenerateSDF);
     SERIALIZE(SDFResolution);
+    SERIALIZE(SDFUseGPU);
     SERIALIZE(SplitObjects);
     SERIALIZE(ObjectIndex);
     SERIALIZE(SubAssetFolder);
@@ -399,6 +588,8 @@ void ModelTool::Options::Deserialize(DeserializeStream& stream, ISerializeModifi
     DESERIALIZE(ImportBlendShapes);
     DESERIALIZE(CalculateBoneOffsetMatrices);
     DESERIALIZE(LightmapUVsSource);
+    DESERIALIZE(GenerateMeshlets);
+    DESERIALIZE(QuantizePositions);
     DESERIALIZE(CollisionMeshesPrefix);
     DESERIALIZE(Scale);
     DESERIALIZE(Rotation);
@@ -411,6 +602,8 @@ void ModelTool::Options::Deserialize(DeserializeStream& stream, ISerializeModifi
     DESERIALIZE(SamplingRate);
     DESERIALIZE(SkipEmptyCurves);
     DESERIALIZE(OptimizeKeyframes);
+    DESERIALIZE(CompressKeyframes);
+    DESERIALIZE(CompressionTolerance);
     DESERIALIZE(ImportScaleTracks);
     DESERIALIZE(RootMotion);
     DESERIALIZE(RootMotionFlags);
@@ -421,6 +614,9 @@ void ModelTool::Options::Deserialize(DeserializeStream& stream, ISerializeModifi
     DESERIALIZE(TriangleReduction);
     DESERIALIZE(SloppyOptimization);
     DESERIALIZE(LODTargetError);
+    DESERIALIZE(GenerateShadowProxy);
+    DESERIALIZE(ShadowProxyTriangleReduction);
+    DESERIALIZE(ShadowProxyLOD);
     DESERIALIZE(ImportMaterials);
     DESERIALIZE(ImportMaterialsAsInstances);
     DESERIALIZE(InstanceToImportAs);
@@ -429,6 +625,7 @@ void ModelTool::Options::Deserialize(DeserializeStream& stream, ISerializeModifi
     DESERIALIZE(SkipExistingMaterialsOnReimport);
     DESERIALIZE(GenerateSDF);
     DESERIALIZE(SDFResolution);
+    DESERIALIZE(SDFUseGPU);
     DESERIALIZE(SplitObjects);
     DESERIALIZE(ObjectIndex);
     DESERIALIZE(SubAssetFolder);
@@ -725,6 +922,53 @@ void MeshOptDeallocate(void* ptr)
     Allocator::Free(ptr);
 }
 
+// Limits of the triangle clusters size (recommended by meshoptimizer for GPU culling)
+#define MESHLET_MAX_VERTICES 64
+#define MESHLET_MAX_TRIANGLES 124
+#define MESHLET_CONE_WEIGHT 0.25f
+#define MESHLET_MIN_TRIANGLES 4096
+
+int32 GenerateMeshlets(MeshData& mesh)
+{
+    // Small meshes are culled as a whole
+    mesh.Meshlets.Clear();
+    const int32 indexCount = mesh.Indices.Count();
+    const int32 vertexCount = mesh.Positions.Count();
+    if (indexCount < MESHLET_MIN_TRIANGLES * 3)
+        return 0;
+
+    // Split mesh into clusters of triangles
+    const size_t maxMeshlets = meshopt_buildMeshletsBound(indexCount, MESHLET_MAX_VERTICES, MESHLET_MAX_TRIANGLES);
+    Array<meshopt_Meshlet> meshlets;
+    Array<unsigned int> meshletVertices;
+    Array<unsigned char> meshletTriangles;
+    meshlets.Resize((int32)maxMeshlets);
+    meshletVertices.Resize((int32)maxMeshlets * MESHLET_MAX_VERTICES);
+    meshletTriangles.Resize((int32)maxMeshlets * MESHLET_MAX_TRIANGLES * 3);
+    const auto positions = (const float*)mesh.Positions.Get();
+    const int32 meshletsCount = (int32)meshopt_buildMeshlets(meshlets.Get(), meshletVertices.Get(), meshletTriangles.Get(), mesh.Indices.Get(), indexCount, positions, vertexCount, sizeof(Float3), MESHLET_MAX_VERTICES, MESHLET_MAX_TRIANGLES, MESHLET_CONE_WEIGHT);
+
+    // Compute clusters bounds and sort the index buffer triangles by clusters
+    mesh.Meshlets.Resize(meshletsCount);
+    int32 index = 0;
+    for (int32 i = 0; i < meshletsCount; i++)
+    {
+        const meshopt_Meshlet& src = meshlets[i];
+        const meshopt_Bounds bounds = meshopt_computeMeshletBounds(&meshletVertices[src.vertex_offset], &meshletTriangles[src.triangle_offset], src.triangle_count, positions, vertexCount, sizeof(Float3));
+        Meshlet& dst = mesh.Meshlets[i];
+        dst.Center = Float3(bounds.center[0], bounds.center[1], bounds.center[2]);
+        dst.Radius = bounds.radius;
+        dst.ConeAxis = Float3(bounds.cone_axis[0], bounds.cone_axis[1], bounds.cone_axis[2]);
+        dst.ConeCutoff = bounds.cone_cutoff;
+        dst.StartIndex = index;
+        dst.IndicesCount = src.triangle_count * 3;
+        for (uint32 j = 0; j < dst.IndicesCount; j++)
+            mesh.Indices[index++] = meshletVertices[src.vertex_offset + meshletTriangles[src.triangle_offset + j]];
+    }
+    ASSERT(index == indexCount);
+    return meshletsCount;
+}
+
 void TrySetupMaterialParameter(MaterialInstance* instance, Span<const Char*> paramNames, const Variant& value, MaterialParameterType type)
 {
     for (const Char* name : paramNames)
@@ -1544,6 +1788,10 @@ bool ModelTool::ImportModel(const String& path, ModelData& data, Options& option
                 const int32 after = animation.GetKeyframesCount();
                 LOG(Info, "Optimized {0} animation keyframe(s). Before: {1}, after: {2}, Ratio: {3}%", before - after, before, after, Utilities::RoundTo2DecimalPlaces((float)after / before));
             }
+
+            // Compress the keyframes (performed when loading the asset)
+            animation.Compress = options.CompressKeyframes;
+            animation.CompressionTolerance = options.CompressionTolerance;
         }
     }
 
@@ -1790,6 +2038,42 @@ bool ModelTool::ImportModel(const String& path, ModelData& data, Options& option
         }
     }
 
+    // Triangle clusters generation
+    if (options.GenerateMeshlets && options.Type != ModelType::SkinnedModel)
+    {
+        auto meshletsStartTime = DateTime::NowUTC();
+        meshopt_setAllocator(MeshOptAllocate, MeshOptDeallocate);
+        int32 meshletsCount = 0, meshesCount = 0;
+        for (auto& lod : data.LODs)
+        {
+            for (auto& mesh : lod.Meshes)
+            {
+                const int32 count = GenerateMeshlets(*mesh);
+                meshletsCount += count;
+                meshesCount += count != 0 ? 1 : 0;
+            }
+        }
+        if (meshletsCount)
+        {
+            auto meshletsEndTime = DateTime::NowUTC();
+            LOG(Info, "Generated {1} meshlets for {2} meshes in {0} ms", static_cast<int32>((meshletsEndTime - meshletsStartTime).GetTotalMilliseconds()), meshletsCount, meshesCount);
+        }
+    }
+
+    // Positions quantization
+    if (options.QuantizePositions && options.Type != ModelType::SkinnedModel)
+    {
+        for (auto& lod : data.LODs)
+        {
+            for (auto& mesh : lod.Meshes)
+            {
+                BoundingBox box;
+                mesh->CalculateBox(box);
+                mesh->Quantization.Init(box.Minimum, box.Maximum);
+            }
+        }
+    }
+
     // Auto calculate LODs transition settings
     data.CalculateLODsScreenSizes();
 
@@ -1799,6 +2083,95 @@ bool ModelTool::ImportModel(const String& path, ModelData& data, Options& option
     return false;
 }
 
+bool ModelTool::SimplifyMesh(MeshData& mesh, float triangleReduction, float targetError, bool sloppy)
+{
+    const int32 srcIndexCount = mesh.Indices.Count();
+    const int32 srcVertexCount = mesh.Positions.Count();
+    const int32 dstIndexCountTarget = int32(srcIndexCount * Math::Saturate(triangleReduction)) / 3 * 3;
+    if (dstIndexCountTarget < 3 || dstIndexCountTarget >= srcIndexCount)
+        return true;
+    PROFILE_CPU();
+    meshopt_setAllocator(MeshOptAllocate, MeshOptDeallocate);
+
+    // Simplify index buffer
+    Array<unsigned int> indices;
+    indices.Resize(srcIndexCount);
+    int32 dstIndexCount;
+    if (sloppy)
+        dstIndexCount = (int32)meshopt_simplifySloppy(indices.Get(), mesh.Indices.Get(), srcIndexCount, (const float*)mesh.Positions.Get(), srcVertexCount, sizeof(Float3), dstIndexCountTarget, targetError);
+    else
+        dstIndexCount = (int32)meshopt_simplify(indices.Get(), mesh.Indices.Get(), srcIndexCount, (const float*)mesh.Positions.Get(), srcVertexCount, sizeof(Float3), dstIndexCountTarget, targetError);
+    if (dstIndexCount <= 0 || dstIndexCount >= srcIndexCount)
+        return true;
+
+    // Remove unused vertices
+    Array<unsigned int> remap;
+    remap.Resize(srcVertexCount);
+    const int32 dstVertexCount = (int32)meshopt_optimizeVertexFetchRemap(remap.Get(), indices.Get(), dstIndexCount, srcVertexCount);
+    mesh.Indices.Resize(dstIndexCount);
+    meshopt_remapIndexBuffer(mesh.Indices.Get(), indices.Get(), dstIndexCount, remap.Get());
+#define REMAP_VERTEX_BUFFER(name, type) \
+    if (mesh.name.Count() == srcVertexCount) \
+    { \
+        meshopt_remapVertexBuffer(mesh.name.Get(), mesh.name.Get(), srcVertexCount, sizeof(type), remap.Get()); \
+        mesh.name.Resize(dstVertexCount); \
+    }
+    REMAP_VERTEX_BUFFER(Positions, Float3);
+    REMAP_VERTEX_BUFFER(UVs, Float2);
+    REMAP_VERTEX_BUFFER(Normals, Float3);
+    REMAP_VERTEX_BUFFER(Tangents, Float3);
+    REMAP_VERTEX_BUFFER(BitangentSigns, float);
+    REMAP_VERTEX_BUFFER(LightmapUVs, Float2);
+    REMAP_VERTEX_BUFFER(Colors, Color);
+    REMAP_VERTEX_BUFFER(BlendIndices, Int4);
+    REMAP_VERTEX_BUFFER(BlendWeights, Float4);
+#undef REMAP_VERTEX_BUFFER
+    mesh.BlendShapes.Clear();
+    mesh.Meshlets.Clear();
+    return false;
+}
+
+bool ModelTool::GenerateShadowProxy(const ModelData& data, float triangleReduction, MeshData& result)
+{
+    if (data.LODs.IsEmpty())
+        return true;
+    PROFILE_CPU();
+    meshopt_setAllocator(MeshOptAllocate, MeshOptDeallocate);
+
+    // Merge all meshes geometry
+    result.Positions.Clear();
+    result.Indices.Clear();
+    for (const MeshData* mesh : data.LODs[0].Meshes)
+    {
+        const uint32 vertexOffset = result.Positions.Count();
+        const int32 indexStart = result.Indices.Count();
+        result.Positions.Add(mesh->Positions);
+        result.Indices.Add(mesh->Indices);
+        for (int32 i = indexStart; i < result.Indices.Count(); i++)
+            result.Indices.Get()[i] += vertexOffset;
+    }
+    const int32 srcIndexCount = result.Indices.Count();
+    const int32 srcVertexCount = result.Positions.Count();
+    if (srcIndexCount < 3 || srcVertexCount == 0)
+        return true;
+
+    // Weld vertices split by the other attributes (eg. UV seams or hard edges) so simplifier can collapse them
+    Array<unsigned int> remap;
+    remap.Resize(srcVertexCount);
+    const int32 vertexCount = (int32)meshopt_generateVertexRemap(remap.Get(), result.Indices.Get(), srcIndexCount, result.Positions.Get(), srcVertexCount, sizeof(Float3));
+    meshopt_remapIndexBuffer(result.Indices.Get(), result.Indices.Get(), srcIndexCount, remap.Get());
+    meshopt_remapVertexBuffer(result.Positions.Get(), result.Positions.Get(), srcVertexCount, sizeof(Float3), remap.Get());
+    result.Positions.Resize(vertexCount);
+
+    // Simplify (use sloppy mode if the topology prevents reaching the target)
+    const int32 dstIndexCountTarget = Math::Max(int32(srcIndexCount * Math::Saturate(triangleReduction)) / 3 * 3, 3);
+    SimplifyMesh(result, triangleReduction, 0.1f, false);
+    if (result.Indices.Count() > dstIndexCountTarget * 2)
+        SimplifyMesh(result, (float)dstIndexCountTarget / (float)result.Indices.Count(), 0.1f, true);
+    meshopt_optimizeVertexCache(result.Indices.Get(), result.Indices.Get(), result.Indices.Count(), result.Positions.Count());
+    return false;
+}
+
 int32 ModelTool::DetectLodIndex(const String& nodeName)
 {
     int32 index = nodeName.FindLast(TEXT("LOD"), StringSearchCase::IgnoreCase);
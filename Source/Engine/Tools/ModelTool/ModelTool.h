@@ -98,7 +98,8 @@ API_CLASS(Namespace="FlaxEngine.Tools", Static) class FLAXENGINE_API ModelTool
 
     // Optional: inputModel or modelData
     // Optional: outputSDF or null, outputStream or null
-    static bool GenerateModelSDF(class Model* inputModel, class ModelData* modelData, float resolutionScale, int32 lodIndex, ModelBase::SDFData* outputSDF, class MemoryWriteStream* outputStream, const StringView& assetName, float backfacesThreshold = 0.6f);
+    // useGPU: generates voxels with a compute shader if possible (otherwise fallbacks to CPU, eg. when called from main thread)
+    static bool GenerateModelSDF(class Model* inputModel, class ModelData* modelData, float resolutionScale, int32 lodIndex, ModelBase::SDFData* outputSDF, class MemoryWriteStream* outputStream, const StringView& assetName, float backfacesThreshold = 0.6f, bool useGPU = true);
 
 #if USE_EDITOR
 
@@ -191,6 +192,12 @@ API_CLASS(Namespace="FlaxEngine.Tools", Static) class FLAXENGINE_API ModelTool
         // The lightmap UVs source.
         API_FIELD(Attributes="EditorOrder(90), EditorDisplay(\"Geometry\", \"Lightmap UVs Source\"), VisibleIf(nameof(ShowModel))")
         ModelLightmapUVsSource LightmapUVsSource = ModelLightmapUVsSource::Disable;
+        // Enable/disable splitting high-poly meshes into small clusters of triangles (meshlets) with bounds and normal cones. Used by the GPU-driven culling to skip drawing of the invisible or backfacing parts of the mesh. Index buffer will be reordered by clusters.
+        API_FIELD(Attributes="EditorOrder(95), EditorDisplay(\"Geometry\"), VisibleIf(nameof(ShowModel))")
+        bool GenerateMeshlets = false;
+        // Enable/disable quantizing vertex positions into 16-bit values relative to the mesh bounds. Reduces the position vertex buffer size from 12 to 8 bytes per vertex (less memory and bandwidth in depth and shadow passes) at the cost of the precision (bounds size / 65535). Meshes with quantized positions can be drawn only with the surface materials (not used by particles, spline models and lightmaps baking).
+        API_FIELD(Attributes="EditorOrder(96), EditorDisplay(\"Geometry\"), VisibleIf(nameof(ShowModel))")
+        bool QuantizePositions = false;
         // If specified, all meshes that name starts with this prefix in the name will be imported as a separate collision data asset (excluded used for rendering).
         API_FIELD(Attributes="EditorOrder(100), EditorDisplay(\"Geometry\"), VisibleIf(nameof(ShowGeometry))")
         String CollisionMeshesPrefix = TEXT("");
@@ -236,6 +243,12 @@ API_CLASS(Namespace="FlaxEngine.Tools", Static) class FLAXENGINE_API ModelTool
         // The imported animation channels will be optimized to remove redundant keyframes.
         API_FIELD(Attributes="EditorOrder(1050), EditorDisplay(\"Animation\"), VisibleIf(nameof(ShowAnimation))")
         bool OptimizeKeyframes = true;
+        // The imported animation channels will be compressed (uniformly resampled and quantized, static tracks stripped). Greatly reduces the animation memory and speeds up the sampling at the cost of the precision (see Compression Tolerance).
+        API_FIELD(Attributes="EditorOrder(1051), EditorDisplay(\"Animation\"), VisibleIf(nameof(ShowAnimation))")
+        bool CompressKeyframes = false;
+        // The maximum error allowed per animation value component (eg. centimeters for position) when compressing the imported animation channels.
+        API_FIELD(Attributes="EditorOrder(1052), EditorDisplay(\"Animation\"), VisibleIf(nameof(ShowAnimation)), Limit(0.000001f, 10.0f, 0.0001f)")
+        float CompressionTolerance = 0.001f;
         // If checked, the importer will import scale animation tracks (otherwise scale animation will be ignored).
         API_FIELD(Attributes="EditorOrder(1055), EditorDisplay(\"Animation\"), VisibleIf(nameof(ShowAnimation))")
         bool ImportScaleTracks = false;
@@ -269,6 +282,15 @@ API_CLASS(Namespace="FlaxEngine.Tools", Static) class FLAXENGINE_API ModelTool
         // Only used if Sloppy is false. Target error is an approximate measure of the deviation from the original mesh using distance normalized to [0..1] range (e.g. 1e-2f means that simplifier will try to maintain the error to be below 1% of the mesh extents).
         API_FIELD(Attributes="EditorOrder(1150), EditorDisplay(\"Level Of Detail\"), VisibleIf(nameof(SloppyOptimization), true), VisibleIf(nameof(ShowGeometry)), Limit(0.01f, 1, 0.001f)")
         float LODTargetError = 0.05f;
+        // If checked, the importer will generate a simplified position-only mesh used to draw the shadows of the model (merged all meshes). Used only by opaque materials without masking, position offset and displacement.
+        API_FIELD(Attributes="EditorOrder(1160), EditorDisplay(\"Level Of Detail\", \"Generate Shadow Proxy\"), VisibleIf(nameof(ShowModel))")
+        bool GenerateShadowProxy = false;
+        // The target amount of triangles for the shadow proxy mesh (based on the LOD0). Normalized to range 0-1. For instance 0.1 cuts the triangle count to 10%.
+        API_FIELD(Attributes="EditorOrder(1170), EditorDisplay(\"Level Of Detail\"), VisibleIf(nameof(GenerateShadowProxy)), VisibleIf(nameof(ShowModel)), Limit(0, 1, 0.001f)")
+        float ShadowProxyTriangleReduction = 0.1f;
+        // The index of the first shadow LOD that uses the shadow proxy mesh (higher quality shadow LODs use model geometry). Shadow LOD is the model LOD with the light shadows LOD bias applied.
+        API_FIELD(Attributes="EditorOrder(1180), EditorDisplay(\"Level Of Detail\", \"Shadow Proxy LOD\"), VisibleIf(nameof(GenerateShadowProxy)), VisibleIf(nameof(ShowModel)), Limit(0, 6)")
+        int32 ShadowProxyLOD = 1;
 
     public: // Materials
 
@@ -299,6 +321,9 @@ API_CLASS(Namespace="FlaxEngine.Tools", Static) class FLAXENGINE_API ModelTool
         // Resolution scale for generated Signed Distance Field (SDF) texture. Higher values improve accuracy but increase memory usage and reduce performance.
         API_FIELD(Attributes="EditorOrder(1510), EditorDisplay(\"SDF\"), VisibleIf(nameof(ShowModel)), Limit(0.0001f, 100.0f)")
         float SDFResolution = 1.0f;
+        // If checked, Signed Distance Field (SDF) is generated on a GPU with compute shader (much faster for large models). Fallbacks to CPU if GPU is not available.
+        API_FIELD(Attributes="EditorOrder(1520), EditorDisplay(\"SDF\", \"Use GPU\"), VisibleIf(nameof(ShowModel))")
+        bool SDFUseGPU = true;
 
     public: // Splitting
 
@@ -356,6 +381,25 @@ API_CLASS(Namespace="FlaxEngine.Tools", Static) class FLAXENGINE_API ModelTool
     /// <returns>True if fails, otherwise false.</returns>
     static bool ImportModel(const String& path, ModelData& data, Options& options, String& errorMsg, const String& autoImportOutput = String::Empty);
 
+    /// <summary>
+    /// Simplifies the mesh geometry by reducing the amount of triangles (unused vertices are removed).
+    /// </summary>
+    /// <param name="mesh">The mesh data.</param>
+    /// <param name="triangleReduction">The target amount of triangles (relative to the input mesh, in range 0-1).</param>
+    /// <param name="targetError">The maximum geometry error (relative to the mesh size, in range 0-1).</param>
+    /// <param name="sloppy">Enables faster simplification that doesn't preserve the mesh topology.</param>
+    /// <returns>True if mesh has not been simplified, otherwise false.</returns>
+    static bool SimplifyMesh(MeshData& mesh, float triangleReduction, float targetError = 0.05f, bool sloppy = false);
+
+    /// <summary>
+    /// Generates the shadow proxy mesh from the model LOD0 (all meshes merged into a single position-only geometry, welded and simplified).
+    /// </summary>
+    /// <param name="data">The model data.</param>
+    /// <param name="triangleReduction">The target amount of triangles (relative to the input model LOD0, in range 0-1).</param>
+    /// <param name="result">The output mesh data (positions and indices only).</param>
+    /// <returns>True if failed, otherwise false.</returns>
+    static bool GenerateShadowProxy(const ModelData& data, float triangleReduction, MeshData& result);
+
 public:
     static int32 DetectLodIndex(const String& nodeName);
     static bool FindTexture(const String& sourcePath, const String& file, String& path);
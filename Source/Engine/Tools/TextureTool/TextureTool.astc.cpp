@@ -9,6 +9,7 @@
 #include "Engine/Graphics/PixelFormatExtensions.h"
 #include "Engine/Graphics/RenderTools.h"
 #include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Threading/JobSystem.h"
 #include <ThirdParty/astc/astcenc.h>
 
 bool TextureTool::ConvertAstc(TextureData& dst, const TextureData& src, const PixelFormat dstFormat)
@@ -38,9 +39,10 @@ bool TextureTool::ConvertAstc(TextureData& dst, const TextureData& src, const Pi
         astcSwizzle.a = ASTCENC_SWZ_1;
     }
 
-    // Allocate working state given config and thread_count
+    // Allocate working state given config and thread_count (each image is compressed by all job system threads at once)
+    const int32 threadsCount = Math::Max(JobSystem::GetThreadsCount(), 1);
     astcenc_context* astcContext;
-    astcError = astcenc_context_alloc(&astcConfig, 1, &astcContext);
+    astcError = astcenc_context_alloc(&astcConfig, threadsCount, &astcContext);
     if (astcError != ASTCENC_SUCCESS)
     {
         LOG(Warning, "Cannot compress image. ASTC failed with error: {}", String(astcenc_get_error_string(astcError)));
@@ -118,19 +120,34 @@ bool TextureTool::ConvertAstc(TextureData& dst, const TextureData& src, const Pi
             astcInput.data_type = isHDR ? ASTCENC_TYPE_F16 : ASTCENC_TYPE_U8;
             void* srcData = (void*)srcMip.Data.Get();
             astcInput.data = &srcData;
-            astcError = astcenc_compress_image(astcContext, &astcInput, &astcSwizzle, dstMip.Data.Get(), dstMip.Data.Length(), 0);
+            const Function<void(int32)> compressImage = [&](int32 threadIndex)
+            {
+                const astcenc_error error = astcenc_compress_image(astcContext, &astcInput, &astcSwizzle, dstMip.Data.Get(), dstMip.Data.Length(), threadIndex);
+                if (error != ASTCENC_SUCCESS)
+                    astcError = error;
+            };
+            const int32 blocksCount = blocksWidth * blocksHeight;
+            if (blocksCount >= threadsCount * 16)
+            {
+                // Encoder schedules blocks across all callers so run it on every thread
+                JobSystem::Execute(compressImage, threadsCount);
+            }
+            else
+            {
+                compressImage(0);
+            }
             if (astcError == ASTCENC_SUCCESS)
                 astcError = astcenc_compress_reset(astcContext);
         }
     }
 
     // Clean up
+    astcenc_context_free(astcContext);
     if (astcError != ASTCENC_SUCCESS)
     {
         LOG(Warning, "Cannot compress image. ASTC failed with error: {}", String(astcenc_get_error_string(astcError)));
         return true;
     }
-    astcenc_context_free(astcContext);
     return astcError != ASTCENC_SUCCESS;
 }
 
@@ -19,10 +19,164 @@
 
 #if USE_EDITOR
 #include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Core/Types/Guid.h"
+#include "Engine/Engine/CommandLine.h"
+#include "Engine/Engine/EngineService.h"
+#include "Engine/Engine/Globals.h"
+#include "Engine/Platform/File.h"
+#include "Engine/Serialization/MemoryReadStream.h"
+#include "Engine/Serialization/MemoryWriteStream.h"
+#include "Engine/Utilities/Crc.h"
+
+// Version of the compressed textures cache (bump to invalidate cache after compression changes)
+#define TEXTURE_CACHE_VERSION 1
+
 namespace
 {
     Dictionary<String, bool> TexturesHasAlphaCache;
+
+    void HashBytes(uint64& hash, const void* data, int32 size)
+    {
+        // FNV-1a
+        const byte* ptr = (const byte*)data;
+        for (int32 i = 0; i < size; i++)
+        {
+            hash ^= ptr[i];
+            hash *= 1099511628211ull;
+        }
+    }
+
+    String GetCacheEntryPath(const TextureData& src, PixelFormat dstFormat)
+    {
+        // Address the entry by the source data and the compression backend (different encoders produce different results)
+#if COMPILE_WITH_DIRECTXTEX
+        const int32 backend = 1;
+#else
+        const int32 backend = 2;
+#endif
+        uint64 hash = 14695981039346656037ull;
+        uint32 crc = 0;
+        const int32 header[] = { TEXTURE_CACHE_VERSION, backend, (int32)src.Format, (int32)dstFormat, src.Width, src.Height, src.Depth, src.GetArraySize() };
+        HashBytes(hash, header, sizeof(header));
+        for (const auto& slice : src.Items)
+        {
+            for (const TextureMipData& mip : slice.Mips)
+            {
+                const uint32 mipHeader[] = { mip.RowPitch, mip.DepthPitch, mip.Lines, (uint32)mip.Data.Length() };
+                HashBytes(hash, mipHeader, sizeof(mipHeader));
+                crc = Crc::MemCrc32(mip.Data.Get(), mip.Data.Length(), crc);
+            }
+        }
+        return TextureTool::CachePath / String::Format(TEXT("{0:016x}{1:08x}.bin"), hash, crc);
+    }
+
+    bool LoadCacheFile(const String& path, const TextureData& src, PixelFormat dstFormat, TextureData& dst)
+    {
+        PROFILE_CPU();
+        Array<byte> data;
+        if (!FileSystem::FileExists(path) || File::ReadAllBytes(path, data))
+            return true;
+        MemoryReadStream stream(data.Get(), data.Count());
+        int32 version, format, width, height, arraySize;
+        stream.ReadInt32(&version);
+        stream.ReadInt32(&format);
+        stream.ReadInt32(&width);
+        stream.ReadInt32(&height);
+        stream.ReadInt32(&arraySize);
+        if (version != TEXTURE_CACHE_VERSION || format != (int32)dstFormat || width != src.Width || height != src.Height || arraySize != src.GetArraySize())
+            return true;
+        dst.Width = width;
+        dst.Height = height;
+        dst.Depth = 1;
+        dst.Format = dstFormat;
+        dst.Items.Resize(arraySize, false);
+        for (int32 arrayIndex = 0; arrayIndex < arraySize; arrayIndex++)
+        {
+            auto& slice = dst.Items[arrayIndex];
+            int32 mipLevels;
+            stream.ReadInt32(&mipLevels);
+            if (mipLevels != src.Items[arrayIndex].Mips.Count())
+                return true;
+            slice.Mips.Resize(mipLevels, false);
+            for (TextureMipData& mip : slice.Mips)
+            {
+                int32 size;
+                stream.ReadUint32(&mip.RowPitch);
+                stream.ReadUint32(&mip.DepthPitch);
+                stream.ReadUint32(&mip.Lines);
+                stream.ReadInt32(&size);
+                if (size <= 0 || size > (int32)(stream.GetLength() - stream.GetPosition()))
+                    return true;
+                mip.Data.Copy(stream.Move<byte>(size), size);
+            }
+        }
+        return false;
+    }
+
+    void SaveCacheFile(const String& path, const TextureData& dst)
+    {
+        PROFILE_CPU();
+        int32 size = 1024;
+        for (const auto& slice : dst.Items)
+        {
+            for (const TextureMipData& mip : slice.Mips)
+                size += mip.Data.Length() + 16;
+        }
+        MemoryWriteStream stream(size);
+        stream.WriteInt32(TEXTURE_CACHE_VERSION);
+        stream.WriteInt32((int32)dst.Format);
+        stream.WriteInt32(dst.Width);
+        stream.WriteInt32(dst.Height);
+        stream.WriteInt32(dst.GetArraySize());
+        for (const auto& slice : dst.Items)
+        {
+            stream.WriteInt32(slice.Mips.Count());
+            for (const TextureMipData& mip : slice.Mips)
+            {
+                stream.WriteUint32(mip.RowPitch);
+                stream.WriteUint32(mip.DepthPitch);
+                stream.WriteUint32(mip.Lines);
+                stream.WriteInt32(mip.Data.Length());
+                stream.WriteBytes(mip.Data.Get(), mip.Data.Length());
+            }
+        }
+
+        // Write to the temporary file and move it into the entry location (cache can be shared by multiple processes or machines)
+        const String tmpPath = path + TEXT(".") + Guid::New().ToString(Guid::FormatType::N) + TEXT(".tmp");
+        if (File::WriteAllBytes(tmpPath, stream.GetHandle(), stream.GetPosition()))
+            return;
+        if (FileSystem::MoveFile(path, tmpPath, true))
+            FileSystem::DeleteFile(tmpPath);
+    }
 }
+
+String TextureTool::CachePath;
+
+class TextureToolService : public EngineService
+{
+public:
+    TextureToolService()
+        : EngineService(TEXT("Texture Tool"))
+    {
+    }
+
+    bool Init() override
+    {
+        // Setup compressed textures cache location
+        if (CommandLine::Options.TextureCache.HasValue())
+            TextureTool::CachePath = CommandLine::Options.TextureCache.GetValue();
+        else
+            TextureTool::CachePath = Globals::ProjectCacheFolder / TEXT("Textures/Compressed");
+        if (TextureTool::CachePath.HasChars() && !FileSystem::DirectoryExists(TextureTool::CachePath) && FileSystem::CreateDirectory(TextureTool::CachePath))
+        {
+            LOG(Warning, "Failed to create compressed textures cache folder '{0}'", TextureTool::CachePath);
+            TextureTool::CachePath.Clear();
+        }
+        return false;
+    }
+};
+
+TextureToolService TextureToolServiceInstance;
 #endif
 
 String TextureTool::Options::ToString() const
@@ -322,14 +476,32 @@ bool TextureTool::Convert(TextureData& dst, const TextureData& src, const PixelF
     }
     PROFILE_CPU();
 
+#if USE_EDITOR
+    // Try to reuse the compressed data from cache
+    String cacheEntryPath;
+    if (CachePath.HasChars() && PixelFormatExtensions::IsCompressed(dstFormat))
+    {
+        cacheEntryPath = GetCacheEntryPath(src, dstFormat);
+        if (!LoadCacheFile(cacheEntryPath, src, dstFormat, dst))
+            return false;
+    }
+#endif
+
 #if COMPILE_WITH_DIRECTXTEX
-    return ConvertDirectXTex(dst, src, dstFormat);
+    const bool result = ConvertDirectXTex(dst, src, dstFormat);
 #elif COMPILE_WITH_STB
-    return ConvertStb(dst, src, dstFormat);
+    const bool result = ConvertStb(dst, src, dstFormat);
 #else
     LOG(Warning, "Converting textures is not supported on this platform.");
-    return true;
+    const bool result = true;
+#endif
+
+#if USE_EDITOR
+    // Store the compressed data in cache
+    if (!result && cacheEntryPath.HasChars())
+        SaveCacheFile(cacheEntryPath, dst);
 #endif
+    return result;
 }
 
 bool TextureTool::Resize(TextureData& dst, const TextureData& src, int32 dstWidth, int32 dstHeight)
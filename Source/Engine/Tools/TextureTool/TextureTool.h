@@ -163,6 +163,13 @@ API_CLASS(Namespace="FlaxEngine.Tools", Static) class FLAXENGINE_API TextureTool
     /// <returns>True if fails, otherwise false.</returns>
     static bool Resize(TextureData& dst, const TextureData& src, int32 dstWidth, int32 dstHeight);
 
+#if USE_EDITOR
+    /// <summary>
+    /// The path to the folder with the compressed textures cache. Conversions into the compressed formats are addressed by the source data hash so unchanged textures are never compressed again (also across machines when using a shared folder via '-texturecache path'). Empty to disable cache.
+    /// </summary>
+    static String CachePath;
+#endif
+
 public:
     typedef Color (*ReadPixel)(const void*);
     typedef void (*WritePixel)(const void*, const Color&);
@@ -10,6 +10,7 @@
 #include "Engine/Graphics/RenderTools.h"
 #include "Engine/Graphics/Textures/TextureData.h"
 #include "Engine/Graphics/PixelFormatExtensions.h"
+#include "Engine/Threading/JobSystem.h"
 #include "Engine/Utilities/AnsiPathTempFile.h"
 #include "Engine/Platform/File.h"
 
@@ -569,7 +570,7 @@ bool TextureTool::ImportTextureStb(ImageType type, const StringView& path, Textu
     // Compress mip maps or convert image
     if (targetFormat != textureDataSrc->Format)
     {
-        if (ConvertStb(*textureDataDst, *textureDataSrc, targetFormat))
+        if (Convert(*textureDataDst, *textureDataSrc, targetFormat))
         {
             errorMsg = String::Format(TEXT("Cannot convert/compress texture."));
             return true;
@@ -625,9 +626,16 @@ bool TextureTool::ConvertStb(TextureData& dst, const TextureData& src, const Pix
         case PixelFormat::BC4_UNorm:
             bytesPerBlock = 8;
             break;
-        default:
+        case PixelFormat::BC3_UNorm:
+        case PixelFormat::BC3_UNorm_sRGB:
+        case PixelFormat::BC5_UNorm:
+        case PixelFormat::BC7_UNorm:
+        case PixelFormat::BC7_UNorm_sRGB:
             bytesPerBlock = 16;
             break;
+        default:
+            LOG(Warning, "Cannot compress image. Unsupported format {0}", static_cast<int32>(dstFormat));
+            return true;
         }
         bool isDstSRGB = PixelFormatExtensions::IsSRGB(dstFormat);
 
@@ -638,6 +646,12 @@ bool TextureTool::ConvertStb(TextureData& dst, const TextureData& src, const Pix
             bc7enc16_compress_block_params_init(&params);
             bc7enc16_compress_block_init();
         }
+        else
+        {
+            // Warm up the lazy-initialized stb_dxt tables before compressing blocks on multiple threads
+            byte dummyBlock[16 * 4] = {}, dummyResult[16];
+            stb_compress_dxt_block(dummyResult, dummyBlock, 0, STB_DXT_HIGHQUAL);
+        }
 
         // Compress all array slices
         for (int32 arrayIndex = 0; arrayIndex < arraySize; arrayIndex++)
@@ -663,8 +677,8 @@ bool TextureTool::ConvertStb(TextureData& dst, const TextureData& src, const Pix
                 dstMip.Lines = blocksHeight;
                 dstMip.Data.Allocate(dstMip.DepthPitch);
 
-                // Compress texture
-                for (int32 yBlock = 0; yBlock < blocksHeight; yBlock++)
+                // Compress texture (block rows are processed in parallel)
+                const Function<void(int32)> compressRow = [&](int32 yBlock)
                 {
                     for (int32 xBlock = 0; xBlock < blocksWidth; xBlock++)
                     {
@@ -708,11 +722,11 @@ bool TextureTool::ConvertStb(TextureData& dst, const TextureData& src, const Pix
                             bc7enc16_compress_block(dstBlock, &srcBlock, &params);
                             break;
                         default:
-                            LOG(Warning, "Cannot compress image. Unsupported format {0}", static_cast<int32>(dstFormat));
-                            return true;
+                            break;
                         }
                     }
-                }
+                };
+                JobSystem::Execute(compressRow, blocksHeight, 4);
             }
         }
     }
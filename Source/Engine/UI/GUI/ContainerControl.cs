@@ -31,6 +31,10 @@ public class ContainerControl : Control
 
         private bool _clipChildren = true;
         private bool _cullChildren = true;
+        private bool _cacheDrawing;
+        private Render2DCache _drawCache;
+        private Rectangle _drawCacheClip;
+        private Float4 _drawCacheScale;
 
         /// <summary>
         /// Initializes a new instance of the <see cref="ContainerControl"/> class.
@@ -115,6 +119,31 @@ public bool CullChildren
             set => _cullChildren = value;
         }
 
+        /// <summary>
+        /// Gets or sets a value indicating whether record the control drawing (including children) once and replay it in the next frames until layout gets changed. Use it for static content only and call <see cref="InvalidateDrawCache"/> when the content changes.
+        /// </summary>
+        [EditorOrder(545), Tooltip("If checked, control will record its drawing (including children) once and replay it in the next frames until layout gets changed. Use it for static content only.")]
+        public bool CacheDrawing
+        {
+            get => _cacheDrawing;
+            set
+            {
+                if (_cacheDrawing == value)
+                    return;
+                _cacheDrawing = value;
+                if (!value)
+                    Object.Destroy(ref _drawCache);
+            }
+        }
+
+        /// <summary>
+        /// Invalidates the recorded drawing of the control (when <see cref="CacheDrawing"/> is enabled) so it will be drawn again in the next frame.
+        /// </summary>
+        public void InvalidateDrawCache()
+        {
+            _drawCache?.Invalidate();
+        }
+
         /// <summary>
         /// Locks all child controls layout and itself.
         /// </summary>
@@ -734,6 +763,7 @@ public override void OnDestroy()
             }
 
             base.OnDestroy();
+            Object.Destroy(ref _drawCache);
 
             // Pass event further
             for (int i = 0; i < _children.Count; i++)
@@ -792,6 +822,32 @@ public override void ClearState()
         /// Draw the control and the children.
         /// </summary>
         public override void Draw()
+        {
+            if (_cacheDrawing)
+            {
+                // Replay the recorded drawing unless the clipping (relative to the control) changed since it can affect children culling
+                Render2D.PeekClip(out var clip);
+                Render2D.PeekTransform(out var transform);
+                var cacheClip = new Rectangle(clip.Location - new Float2(transform.M31, transform.M32), clip.Size);
+                var cacheScale = new Float4(transform.M11, transform.M12, transform.M21, transform.M22);
+                if (_drawCache == null)
+                    _drawCache = new Render2DCache();
+                else if (cacheClip == _drawCacheClip && cacheScale == _drawCacheScale && Render2D.TryDrawCache(_drawCache))
+                    return;
+                _drawCacheClip = cacheClip;
+                _drawCacheScale = cacheScale;
+
+                Render2D.BeginCache(_drawCache);
+                DrawContent();
+                Render2D.EndCache(_drawCache);
+            }
+            else
+            {
+                DrawContent();
+            }
+        }
+
+        private void DrawContent()
         {
             DrawSelf();
 
@@ -863,6 +919,7 @@ public override void PerformLayout(bool force = false)
         {
             if (_isLayoutLocked && !force)
                 return;
+            _drawCache?.Invalidate();
 
             bool wasLocked = _isLayoutLocked;
             if (!wasLocked)
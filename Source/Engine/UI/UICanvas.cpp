@@ -39,6 +39,7 @@ MMethod* UICanvas_ParentChanged = nullptr;
 UICanvas::UICanvas(const SpawnParams& params)
     : Actor(params)
 {
+    _loadNoAsync = true;
 #if !COMPILE_WITHOUT_CSHARP
     Platform::MemoryBarrier();
     if (UICanvas_Serialize == nullptr)
@@ -42,11 +42,20 @@ public enum CanvasRenderMode
     [HideInEditor]
     public sealed class CanvasRenderer : PostProcessEffect
     {
+        private GPUTexture _cache;
+        private float _cacheUpdateTime;
+        private bool _cacheDirty = true;
+
         /// <summary>
         /// The canvas to render.
         /// </summary>
         public UICanvas Canvas;
 
+        /// <summary>
+        /// Gets the texture with the cached canvas contents (null if not used). Used when <see cref="UICanvas.CacheToTexture"/> is enabled.
+        /// </summary>
+        public GPUTexture CacheTexture => _cache;
+
         /// <inheritdoc />
         public CanvasRenderer()
         {
@@ -86,14 +95,113 @@ public override void Render(GPUContext context, ref RenderContext renderContext,
 
             // Render GUI in 3D
             var features = Render2D.Features;
-            if (Canvas.RenderMode == CanvasRenderMode.WorldSpace || Canvas.RenderMode == CanvasRenderMode.WorldSpaceFaceCamera)
+            var isWorldSpace = Canvas.RenderMode == CanvasRenderMode.WorldSpace || Canvas.RenderMode == CanvasRenderMode.WorldSpaceFaceCamera;
+            if (isWorldSpace)
                 Render2D.Features &= ~Render2D.RenderingFeatures.VertexSnapping;
-            Render2D.CallDrawing(Canvas.GUI, context, input, depthBuffer, ref viewProjectionMatrix);
+            if (isWorldSpace && Canvas.CacheToTexture && UpdateCache(context))
+            {
+                // Draw cached canvas as a textured quad
+                Render2D.Begin(context, input, depthBuffer, ref viewProjectionMatrix);
+                try
+                {
+                    Render2D.DrawTexture(_cache, new Rectangle(Float2.Zero, Canvas.Size));
+                }
+                finally
+                {
+                    Render2D.End();
+                }
+            }
+            else
+            {
+                Render2D.CallDrawing(Canvas.GUI, context, input, depthBuffer, ref viewProjectionMatrix);
+            }
             Render2D.Features = features;
 
             Profiler.EndEvent();
             Profiler.EndEventGPU();
         }
+
+        /// <summary>
+        /// Marks the cached canvas texture to be redrawn on the next rendering.
+        /// </summary>
+        public void InvalidateCache()
+        {
+            _cacheDirty = true;
+        }
+
+        /// <summary>
+        /// Releases the cached canvas texture.
+        /// </summary>
+        public void ReleaseCache()
+        {
+            if (_cache)
+                Destroy(ref _cache);
+            _cacheDirty = true;
+        }
+
+        /// <inheritdoc />
+        public override void OnDestroy()
+        {
+            ReleaseCache();
+
+            base.OnDestroy();
+        }
+
+        private bool UpdateCache(GPUContext context)
+        {
+            // Allocate texture with a full mip chain for the canvas size
+            var size = Canvas.Size * Canvas.CacheResolutionScale;
+            var maxSize = GPUDevice.Instance.Limits.MaximumTexture2DSize;
+            var width = Mathf.Clamp(Mathf.CeilToInt(size.X), 1, maxSize);
+            var height = Mathf.Clamp(Mathf.CeilToInt(size.Y), 1, maxSize);
+            if (_cache == null)
+                _cache = GPUDevice.Instance.CreateTexture("UICanvas.Cache");
+            if (!_cache.IsAllocated || _cache.Width != width || _cache.Height != height)
+            {
+                var desc = GPUTextureDescription.New2D(width, height, 0, PixelFormat.R8G8B8A8_UNorm, GPUTextureFlags.ShaderResource | GPUTextureFlags.RenderTarget | GPUTextureFlags.PerMipViews);
+                if (_cache.Init(ref desc))
+                {
+                    ReleaseCache();
+                    return false;
+                }
+                _cacheDirty = true;
+            }
+
+            // Redraw contents when invalidated or limited by the update rate (0 to redraw only when invalidated)
+            var time = Time.UnscaledGameTime;
+            var updateRate = Canvas.CacheUpdateRate;
+            if (!_cacheDirty && (updateRate <= 0.0f || time - _cacheUpdateTime < 1.0f / updateRate))
+                return true;
+            _cacheDirty = false;
+            _cacheUpdateTime = time;
+            Profiler.BeginEventGPU("Cache");
+            context.Clear(_cache.View(), Color.Transparent);
+            Render2D.Begin(context, _cache);
+            try
+            {
+                Matrix3x3.Scaling(Canvas.CacheResolutionScale, out var scale);
+                Render2D.PushTransform(ref scale);
+                Canvas.GUI.Draw();
+                Render2D.PopTransform();
+            }
+            finally
+            {
+                Render2D.End();
+            }
+
+            // Downscale mips for distant viewing
+            for (int mipIndex = 1; mipIndex < _cache.MipLevels; mipIndex++)
+            {
+                context.ResetRenderTarget();
+                context.SetViewportAndScissors(Mathf.Max(width >> mipIndex, 1), Mathf.Max(height >> mipIndex, 1));
+                context.SetRenderTarget(_cache.View(0, mipIndex));
+                context.Draw(_cache.View(0, mipIndex - 1));
+            }
+            context.ResetRenderTarget();
+            context.ResetSR();
+            Profiler.EndEventGPU();
+            return true;
+        }
     }
 
     partial class UICanvas
@@ -163,6 +271,8 @@ public int Order
 
         private bool Editor_IsWorldSpace => _renderMode == CanvasRenderMode.WorldSpace || _renderMode == CanvasRenderMode.WorldSpaceFaceCamera;
 
+        private bool Editor_IsCachedToTexture => Editor_IsWorldSpace && _cacheToTexture;
+
         private bool Editor_IsCameraSpace => _renderMode == CanvasRenderMode.CameraSpace;
 
         private bool Editor_UseRenderCamera => _renderMode == CanvasRenderMode.CameraSpace || _renderMode == CanvasRenderMode.WorldSpaceFaceCamera;
@@ -190,6 +300,38 @@ public Float2 Size
         [EditorOrder(30), EditorDisplay("Canvas"), VisibleIf("Editor_Is3D"), Tooltip("If checked, scene depth will be ignored when rendering the GUI (scene objects won't cover the interface).")]
         public bool IgnoreDepth { get; set; } = false;
 
+        private bool _cacheToTexture;
+
+        /// <summary>
+        /// Gets or sets a value indicating whether render the world-space canvas into a cached texture (with mip maps) that is drawn as a quad in the 3D world. Reduces rendering cost of many in-world screens that change rarely. Used only in <see cref="CanvasRenderMode.WorldSpace"/> or <see cref="CanvasRenderMode.WorldSpaceFaceCamera"/>.
+        /// </summary>
+        [EditorOrder(31), EditorDisplay("Canvas"), VisibleIf("Editor_IsWorldSpace"), Tooltip("If checked, the canvas will be rendered into a cached texture (with mip maps) that is drawn as a quad in the 3D world. Reduces rendering cost of many in-world screens that change rarely.")]
+        public bool CacheToTexture
+        {
+            get => _cacheToTexture;
+            set
+            {
+                if (_cacheToTexture != value)
+                {
+                    _cacheToTexture = value;
+                    if (!value && _renderer)
+                        _renderer.ReleaseCache();
+                }
+            }
+        }
+
+        /// <summary>
+        /// Gets or sets the maximum amount of cached texture updates per second. Use 0 to redraw the texture only when invalidated (see <see cref="InvalidateCache"/>). Used only if <see cref="CacheToTexture"/> is enabled.
+        /// </summary>
+        [EditorOrder(32), Limit(0), EditorDisplay("Canvas"), VisibleIf("Editor_IsCachedToTexture"), Tooltip("The maximum amount of cached texture updates per second. Use 0 to redraw the texture only when invalidated (via InvalidateCache).")]
+        public float CacheUpdateRate { get; set; } = 10.0f;
+
+        /// <summary>
+        /// Gets or sets the cached texture resolution scale (relative to the canvas size). Used only if <see cref="CacheToTexture"/> is enabled.
+        /// </summary>
+        [EditorOrder(33), Limit(0.1f, 4.0f, 0.01f), EditorDisplay("Canvas"), VisibleIf("Editor_IsCachedToTexture"), Tooltip("The cached texture resolution scale (relative to the canvas size).")]
+        public float CacheResolutionScale { get; set; } = 1.0f;
+
         /// <summary>
         /// Gets or sets the camera used to place the GUI when render mode is set to <see cref="CanvasRenderMode.CameraSpace"/> or <see cref="CanvasRenderMode.WorldSpaceFaceCamera"/>.
         /// </summary>
@@ -482,6 +624,15 @@ public void GetWorldMatrix(Vector3 viewOrigin, out Matrix world)
             }
         }
 
+        /// <summary>
+        /// Marks the cached canvas texture to be redrawn on the next rendering. Used if <see cref="CacheToTexture"/> is enabled to update the canvas contents after changes (eg. when <see cref="CacheUpdateRate"/> is 0).
+        /// </summary>
+        public void InvalidateCache()
+        {
+            if (_renderer)
+                _renderer.InvalidateCache();
+        }
+
         private void Setup()
         {
             if (_isLoading)
@@ -620,6 +771,24 @@ internal string Serialize(UICanvas other)
                     jsonWriter.WriteValue(IgnoreDepth);
                 }
 
+                if (noOther || CacheToTexture != other.CacheToTexture)
+                {
+                    jsonWriter.WritePropertyName("CacheToTexture");
+                    jsonWriter.WriteValue(CacheToTexture);
+                }
+
+                if (noOther || !Mathf.NearEqual(CacheUpdateRate, other.CacheUpdateRate))
+                {
+                    jsonWriter.WritePropertyName("CacheUpdateRate");
+                    jsonWriter.WriteValue(CacheUpdateRate);
+                }
+
+                if (noOther || !Mathf.NearEqual(CacheResolutionScale, other.CacheResolutionScale))
+                {
+                    jsonWriter.WritePropertyName("CacheResolutionScale");
+                    jsonWriter.WriteValue(CacheResolutionScale);
+                }
+
                 if (noOther || RenderCamera != other.RenderCamera)
                 {
                     jsonWriter.WritePropertyName("RenderCamera");
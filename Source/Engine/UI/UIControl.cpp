@@ -37,6 +37,7 @@ MMethod* UIControl_EndPlay = nullptr;
 UIControl::UIControl(const SpawnParams& params)
     : Actor(params)
 {
+    _loadNoAsync = true;
 #if !COMPILE_WITHOUT_CSHARP
     Platform::MemoryBarrier();
     if (UIControl_Serialize == nullptr)
@@ -859,3 +859,150 @@ int32 GraphUtilities::CountComponents(VariantType::Types type)
         return 0;
     }
 }
+
+VariantType::Types GraphUtilities::GetFastMathType(VariantType::Types type)
+{
+    switch (type)
+    {
+    case VariantType::Float:
+    case VariantType::Float2:
+    case VariantType::Float3:
+    case VariantType::Float4:
+    case VariantType::Color:
+        return type;
+    default:
+        return VariantType::Null;
+    }
+}
+
+bool GraphUtilities::LoadFastValue(const Variant& v, VariantType::Types type, FastValue& result)
+{
+    result.Type = type;
+    const int32 count = CountComponents(type);
+    if (v.Type.Type == type)
+    {
+        Platform::MemoryCopy(result.Components, v.AsData, count * sizeof(float));
+        return true;
+    }
+    if (v.Type.Type == VariantType::Float)
+    {
+        for (int32 i = 0; i < count; i++)
+            result.Components[i] = v.AsFloat;
+        return true;
+    }
+    return false;
+}
+
+void GraphUtilities::StoreFastValue(const FastValue& v, Variant& result)
+{
+    if (result.Type.Type != v.Type || result.Type.TypeName)
+        result.SetType(VariantType(v.Type));
+    Platform::MemoryCopy(result.AsData, v.Components, CountComponents(v.Type) * sizeof(float));
+}
+
+namespace
+{
+    template<typename Op>
+    FORCE_INLINE void ApplyFast(GraphUtilities::FastValue& v, const GraphUtilities::FastValue& a, Op op)
+    {
+        const int32 count = GraphUtilities::CountComponents(a.Type);
+        for (int32 i = 0; i < count; i++)
+            v.Components[i] = op(a.Components[i]);
+    }
+
+    template<typename Op>
+    FORCE_INLINE void ApplyFast(GraphUtilities::FastValue& v, const GraphUtilities::FastValue& a, const GraphUtilities::FastValue& b, Op op)
+    {
+        const int32 count = GraphUtilities::CountComponents(a.Type);
+        for (int32 i = 0; i < count; i++)
+            v.Components[i] = op(a.Components[i], b.Components[i]);
+    }
+}
+
+bool GraphUtilities::ApplyMathFast(uint16 typeId, FastValue& v, const FastValue& a)
+{
+    v.Type = a.Type;
+    switch (typeId)
+    {
+    case 7:
+        ApplyFast(v, a, [](float a) { return Math::Abs(a); });
+        break;
+    case 8:
+        ApplyFast(v, a, [](float a) { return Math::Ceil(a); });
+        break;
+    case 9:
+        ApplyFast(v, a, [](float a) { return Math::Cos(a); });
+        break;
+    case 10:
+        ApplyFast(v, a, [](float a) { return Math::Floor(a); });
+        break;
+    case 13:
+        ApplyFast(v, a, [](float a) { return Math::Round(a); });
+        break;
+    case 14:
+        ApplyFast(v, a, [](float a) { return Math::Saturate(a); });
+        break;
+    case 15:
+        ApplyFast(v, a, [](float a) { return Math::Sin(a); });
+        break;
+    case 16:
+        ApplyFast(v, a, [](float a) { return Math::Sqrt(a); });
+        break;
+    case 17:
+        ApplyFast(v, a, [](float a) { return Math::Tan(a); });
+        break;
+    case 27:
+        ApplyFast(v, a, [](float a) { return -a; });
+        break;
+    case 28:
+        ApplyFast(v, a, [](float a) { return 1 - a; });
+        break;
+    case 38:
+        ApplyFast(v, a, [](float a) { return Math::Trunc(a); });
+        break;
+    case 43:
+        ApplyFast(v, a, [](float a) { return a * RadiansToDegrees; });
+        break;
+    case 44:
+        ApplyFast(v, a, [](float a) { return a * DegreesToRadians; });
+        break;
+    default:
+        return false;
+    }
+    return true;
+}
+
+bool GraphUtilities::ApplyMathFast(uint16 typeId, FastValue& v, const FastValue& a, const FastValue& b)
+{
+    v.Type = a.Type;
+    switch (typeId)
+    {
+    case 1:
+        ApplyFast(v, a, b, [](float a, float b) { return a + b; });
+        break;
+    case 2:
+        ApplyFast(v, a, b, [](float a, float b) { return a - b; });
+        break;
+    case 3:
+        ApplyFast(v, a, b, [](float a, float b) { return a * b; });
+        break;
+    case 5:
+        ApplyFast(v, a, b, [](float a, float b) { return a / b; });
+        break;
+    case 21:
+        ApplyFast(v, a, b, [](float a, float b) { return Math::Max(a, b); });
+        break;
+    case 22:
+        ApplyFast(v, a, b, [](float a, float b) { return Math::Min(a, b); });
+        break;
+    case 23:
+        ApplyFast(v, a, b, [](float a, float b) { return Math::Pow(a, b); });
+        break;
+    case 40:
+        ApplyFast(v, a, b, [](float a, float b) { return Math::Mod(a, b); });
+        break;
+    default:
+        return false;
+    }
+    return true;
+}
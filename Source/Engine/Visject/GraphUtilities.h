@@ -19,4 +19,26 @@ namespace GraphUtilities
     void ApplySomeMathHere(uint16 typeId, Variant& v, Variant& a, Variant& b);
 
     int32 CountComponents(VariantType::Types type);
+
+    /// <summary>
+    /// Compact typed value of the float vector types used by the graph executors math fast-path (skips Variant type conversions and has no heap allocations).
+    /// </summary>
+    struct FastValue
+    {
+        VariantType::Types Type;
+        float Components[4];
+    };
+
+    // Gets the type used by the math fast-path for values of the given type (Null if type is not supported).
+    VariantType::Types GetFastMathType(VariantType::Types type);
+
+    // Loads the value for the math fast-path converted into the given type (scalars are broadcast as in Variant::Cast). Returns false if value cannot be used by the fast-path.
+    bool LoadFastValue(const Variant& v, VariantType::Types type, FastValue& result);
+
+    // Stores the math fast-path value into the variant.
+    void StoreFastValue(const FastValue& v, Variant& result);
+
+    // Applies the math node operation using the typed values. Returns false if operation is not supported by the fast-path.
+    bool ApplyMathFast(uint16 typeId, FastValue& v, const FastValue& a);
+    bool ApplyMathFast(uint16 typeId, FastValue& v, const FastValue& a, const FastValue& b);
 }
@@ -169,6 +169,19 @@ void VisjectExecutor::ProcessGroupMath(Box* box, Node* node, Value& value)
         auto b1 = node->GetBox(0);
         Value v1 = tryGetValue(b1, 0, Value::Zero);
         Value v2 = tryGetValue(node->GetBox(1), 1, Value::Zero);
+        if (node->FastType != VariantType::Null)
+        {
+            // Fast-path for the float vector types (skips Variant casting)
+            GraphUtilities::FastValue a, b, result;
+            if ((b1->HasConnection() ? v1 : v2).Type.Type == node->FastType &&
+                GraphUtilities::LoadFastValue(v1, node->FastType, a) &&
+                GraphUtilities::LoadFastValue(v2, node->FastType, b) &&
+                GraphUtilities::ApplyMathFast(node->TypeID, result, a, b))
+            {
+                GraphUtilities::StoreFastValue(result, value);
+                break;
+            }
+        }
         if (b1->HasConnection())
             v2 = v2.Cast(v1.Type);
         else
@@ -197,6 +210,16 @@ void VisjectExecutor::ProcessGroupMath(Box* box, Node* node, Value& value)
     case 44:
     {
         Value v1 = tryGetValue(node->GetBox(0), Value::Zero);
+        if (node->FastType != VariantType::Null && v1.Type.Type == node->FastType)
+        {
+            GraphUtilities::FastValue a, result;
+            if (GraphUtilities::LoadFastValue(v1, node->FastType, a) &&
+                GraphUtilities::ApplyMathFast(node->TypeID, result, a))
+            {
+                GraphUtilities::StoreFastValue(result, value);
+                break;
+            }
+        }
         GraphUtilities::ApplySomeMathHere(node->TypeID, value, v1);
         break;
     }
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "Graph.h"
+#include "GraphUtilities.h"
 #include "Engine/Core/Math/Vector2.h"
 #include "Engine/Core/Math/Vector3.h"
 #include "Engine/Core/Math/Vector4.h"
@@ -75,6 +76,11 @@ class VisjectGraphNode : public GraphNode<BoxType>
                 BinaryModule* Module;
                 bool IsStatic;
             } GetSetField;
+
+            struct
+            {
+                int32 Index;
+            } Program;
         };
     };
 
@@ -90,6 +96,11 @@ class VisjectGraphNode : public GraphNode<BoxType>
     /// </summary>
     AdditionalData Data;
 
+    /// <summary>
+    /// The value type used by the math nodes typed fast-path (resolved from the input connections on graph load). Null if node uses only generic Variant evaluation.
+    /// </summary>
+    VariantType::Types FastType = VariantType::Null;
+
     /// <summary>
     /// The asset references. Linked resources such as Animation assets are referenced in graph data as ID. We need to keep valid refs to them at runtime to keep data in memory.
     /// </summary>
@@ -152,6 +163,31 @@ class VisjectGraph : public Graph<NodeType, BoxType, ParameterType>
 
 public:
     // [Graph]
+    bool Load(ReadStream* stream, bool loadMeta) override
+    {
+        if (Base::Load(stream, loadMeta))
+            return true;
+
+        // Resolve value types for the math nodes fast-path (boxes connections are valid after loading the whole graph)
+        for (NodeType& n : Base::Nodes)
+        {
+            n.FastType = VariantType::Null;
+            if (n.GroupID != 3 || n.Boxes.Count() < 2)
+                continue;
+            const BoxType& b0 = n.Boxes[0];
+            const BoxType& b1 = n.Boxes[1];
+            VariantType::Types type = VariantType::Null;
+            if (b0.HasConnection())
+                type = b0.FirstConnection()->Type.Type;
+            else if (b1.HasConnection())
+                type = b1.FirstConnection()->Type.Type;
+            else if (n.Values.Count() > 1)
+                type = n.Values[1].Type.Type;
+            n.FastType = GraphUtilities::GetFastMathType(type);
+        }
+        return false;
+    }
+
     bool onNodeLoaded(NodeType* n) override
     {
         switch (n->GroupID)
@@ -0,0 +1,21 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+using Flax.Build;
+
+/// <summary>
+/// Target that builds standalone, native micro-benchmarks of the engine core (collections, math, strings and serialization). Compares results with the baseline file to catch performance regressions.
+/// </summary>
+public class FlaxBenchmarksTarget : FlaxTestsTarget
+{
+    /// <inheritdoc />
+    public override void Init()
+    {
+        base.Init();
+
+        // Initialize
+        OutputName = "FlaxBenchmarks";
+        ConfigurationName = "Benchmarks";
+        GlobalDefinitions.Add("FLAX_BENCHMARKS");
+        GlobalDefinitions.Add("CATCH_CONFIG_ENABLE_BENCHMARKING");
+    }
+}
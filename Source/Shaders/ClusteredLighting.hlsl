@@ -0,0 +1,34 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#ifndef __CLUSTERED_LIGHTING__
+#define __CLUSTERED_LIGHTING__
+
+#define CLUSTERED_LIGHTING_MAX_LIGHTS 32 // Maximum amount of lights per cluster
+#define CLUSTERED_LIGHTING_STRIDE (CLUSTERED_LIGHTING_MAX_LIGHTS + 1) // Per-cluster lights count followed by the light indices
+
+// Clustered lighting data for a constant buffer
+struct ClusteredLightingData
+{
+    float2 UVToCluster;
+    float DepthSliceScale;
+    float DepthSliceBias;
+    uint3 GridSize;
+    uint LightsCount;
+};
+
+// Gets the index of the depth slice for the given view-space depth
+uint GetClusterSlice(ClusteredLightingData data, float viewDepth)
+{
+    return (uint)clamp(log2(max(viewDepth, 0.0001f)) * data.DepthSliceScale + data.DepthSliceBias, 0, data.GridSize.z - 1);
+}
+
+// Gets the offset of the cluster data in the clusters buffer for the given screen UV and view-space depth
+uint GetClusterOffset(ClusteredLightingData data, float2 uv, float viewDepth)
+{
+    uint3 cluster;
+    cluster.xy = min((uint2)max(uv * data.UVToCluster, 0), data.GridSize.xy - 1);
+    cluster.z = GetClusterSlice(data, viewDepth);
+    return ((cluster.z * data.GridSize.y + cluster.y) * data.GridSize.x + cluster.x) * CLUSTERED_LIGHTING_STRIDE;
+}
+
+#endif
@@ -0,0 +1,75 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "./Flax/Common.hlsl"
+#include "./Flax/LightingCommon.hlsl"
+#include "./Flax/ClusteredLighting.hlsl"
+
+META_CB_BEGIN(0, Data)
+ClusteredLightingData ClusteredLighting;
+float4x4 ViewMatrix;
+float4x4 InvProjectionMatrix;
+META_CB_END
+
+#ifdef _CS_Build
+
+StructuredBuffer<LightData> Lights : register(t0);
+RWBuffer<uint> RWClusters : register(u0);
+
+// Gets the view-space position on the line between near and far plane points at the given depth
+float3 GetPointAtDepth(float3 nearPos, float3 farPos, float viewDepth)
+{
+	return lerp(nearPos, farPos, saturate((viewDepth - nearPos.z) / (farPos.z - nearPos.z)));
+}
+
+// Compute shader for culling local lights against each cluster of the view frustum grid
+META_CS(true, FEATURE_LEVEL_SM5)
+[numthreads(4, 4, 4)]
+void CS_Build(uint3 DispatchThreadId : SV_DispatchThreadID)
+{
+	uint3 cluster = DispatchThreadId;
+	if (any(cluster >= ClusteredLighting.GridSize))
+		return;
+
+	// Calculate the cluster bounds in view-space (from the tile corners between the depth slice planes)
+	float2 uvMin = cluster.xy / ClusteredLighting.UVToCluster;
+	float2 uvMax = (cluster.xy + 1) / ClusteredLighting.UVToCluster;
+	float depthMin = exp2((cluster.z - ClusteredLighting.DepthSliceBias) / ClusteredLighting.DepthSliceScale);
+	float depthMax = exp2((cluster.z + 1 - ClusteredLighting.DepthSliceBias) / ClusteredLighting.DepthSliceScale);
+	if (cluster.z == 0)
+		depthMin = 0;
+	float3 boundsMin = 1e10f;
+	float3 boundsMax = -1e10f;
+	UNROLL
+	for (uint i = 0; i < 4; i++)
+	{
+		float2 uv = float2(i & 1 ? uvMax.x : uvMin.x, i & 2 ? uvMax.y : uvMin.y);
+		float2 ndc = uv * float2(2, -2) + float2(-1, 1);
+		float4 nearPos = mul(float4(ndc, 0, 1), InvProjectionMatrix);
+		float4 farPos = mul(float4(ndc, 1, 1), InvProjectionMatrix);
+		nearPos.xyz /= nearPos.w;
+		farPos.xyz /= farPos.w;
+		float3 p0 = GetPointAtDepth(nearPos.xyz, farPos.xyz, depthMin);
+		float3 p1 = GetPointAtDepth(nearPos.xyz, farPos.xyz, depthMax);
+		boundsMin = min(boundsMin, min(p0, p1));
+		boundsMax = max(boundsMax, max(p0, p1));
+	}
+
+	// Test all lights bounding spheres against the cluster box
+	uint clusterOffset = ((cluster.z * ClusteredLighting.GridSize.y + cluster.y) * ClusteredLighting.GridSize.x + cluster.x) * CLUSTERED_LIGHTING_STRIDE;
+	uint count = 0;
+	LOOP
+	for (uint lightIndex = 0; lightIndex < ClusteredLighting.LightsCount && count < CLUSTERED_LIGHTING_MAX_LIGHTS; lightIndex++)
+	{
+		LightData light = Lights[lightIndex];
+		float3 center = mul(float4(light.Position, 1), ViewMatrix).xyz;
+		float3 delta = center - clamp(center, boundsMin, boundsMax);
+		if (dot(delta, delta) <= light.Radius * light.Radius)
+		{
+			RWClusters[clusterOffset + 1 + count] = lightIndex;
+			count++;
+		}
+	}
+	RWClusters[clusterOffset] = count;
+}
+
+#endif
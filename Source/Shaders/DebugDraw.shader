@@ -29,6 +29,24 @@ VS2PS VS(float3 Position : POSITION, float4 Color : COLOR)
 	return output;
 }
 
+// Vertex shader for instanced template meshes (unit shape transformed by the per-instance 3x4 matrix rows)
+META_VS(true, FEATURE_LEVEL_ES2)
+META_VS_IN_ELEMENT(POSITION,  0, R32G32B32_FLOAT,    0, ALIGN, PER_VERTEX,   0, true)
+META_VS_IN_ELEMENT(ATTRIBUTE, 0, R32G32B32A32_FLOAT, 1, 0,     PER_INSTANCE, 1, true)
+META_VS_IN_ELEMENT(ATTRIBUTE, 1, R32G32B32A32_FLOAT, 1, ALIGN, PER_INSTANCE, 1, true)
+META_VS_IN_ELEMENT(ATTRIBUTE, 2, R32G32B32A32_FLOAT, 1, ALIGN, PER_INSTANCE, 1, true)
+META_VS_IN_ELEMENT(COLOR,     0, R8G8B8A8_UNORM,     1, ALIGN, PER_INSTANCE, 1, true)
+VS2PS VS_Instanced(float3 Position : POSITION, float4 Row0 : ATTRIBUTE0, float4 Row1 : ATTRIBUTE1, float4 Row2 : ATTRIBUTE2, float4 Color : COLOR)
+{
+	float4 localPosition = float4(Position, 1);
+	float3 worldPosition = float3(dot(Row0, localPosition), dot(Row1, localPosition), dot(Row2, localPosition));
+	VS2PS output;
+	output.Position = mul(float4(worldPosition, 1), ViewProjection);
+	output.Position.z += ClipPosZBias;
+	output.Color = Color;
+	return output;
+}
+
 META_PS(true, FEATURE_LEVEL_ES2)
 META_PERMUTATION_2(USE_DEPTH_TEST=0,USE_FAKE_LIGHTING=0)
 META_PERMUTATION_2(USE_DEPTH_TEST=0,USE_FAKE_LIGHTING=1)
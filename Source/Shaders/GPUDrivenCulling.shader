@@ -0,0 +1,359 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "./Flax/Common.hlsl"
+
+// Size of the InstanceData structure (in bytes)
+#define INSTANCE_DATA_SIZE 64
+
+// Size of the draw indexed indirect arguments (in bytes)
+#define DRAW_ARGS_SIZE 20
+
+// Maximum amount of thread groups in a row of the meshlets culling dispatch
+#define MESHLETS_GROUPS_X 65535
+
+struct InstanceBounds
+{
+	float3 Center;
+	float Radius;
+	uint Instance;
+	uint Batch;
+};
+
+struct LODInstance
+{
+	float3 Origin;
+	float Random;
+	float3 Transform1;
+	float CullDistance;
+	float3 Transform2;
+	float Radius;
+	float3 Transform3;
+	float Padding0;
+	float3 Center;
+	float Padding1;
+};
+
+struct Meshlet
+{
+	float3 Center;
+	float Radius;
+	float3 ConeAxis;
+	float ConeCutoff;
+	uint StartIndex;
+	uint IndicesCount;
+};
+
+META_CB_BEGIN(0, Data)
+float4 FrustumPlanes[6];
+float4x4 HiZViewProjection;
+float2 HiZSize;
+uint InstancesCount;
+uint HiZMipLevels;
+META_CB_END
+
+META_CB_BEGIN(1, MeshletsData)
+float4x4 World;
+float3 ViewPositionLocal;
+float WorldScale;
+uint MeshletsCount;
+uint ArgsOffset;
+uint IndexOffset;
+uint ConeCulling;
+META_CB_END
+
+META_CB_BEGIN(2, LODInstancesData)
+float3 InstancesOffset;
+uint LODInstancesCount;
+float3 CullViewPosition;
+float LODScreenMultiple;
+float3 LODViewPosition;
+float LODDistanceScale;
+float4 LODScreenRadiusSquared[2];
+float MinScreenRadiusSquared;
+int LODBias;
+uint MinLOD;
+uint MaxLOD;
+uint LODsCount;
+uint InstancesStart;
+uint ArgsStart;
+uint ArgsCount;
+uint CountersOffset;
+float LODDistanceFactor;
+float2 Padding;
+META_CB_END
+
+// Marks the culled instance in the LOD slots buffer
+#define LOD_SLOT_CULLED 0xffffffff
+
+#if defined(_CS_CullInstances) || defined(_CS_CullMeshlets) || defined(_CS_CullLODInstances)
+
+Texture2D<float> HiZ : register(t2);
+
+// Tests the bounds against the view frustum
+bool IsOutsideFrustum(float3 center, float radius)
+{
+	UNROLL
+	for (uint i = 0; i < 6; i++)
+	{
+		if (dot(FrustumPlanes[i].xyz, center) + FrustumPlanes[i].w < -radius)
+			return true;
+	}
+	return false;
+}
+
+// Tests the bounds against the hierarchical depth buffer of the previous frame
+bool IsOccluded(float3 center, float radius)
+{
+	// Project the bounds box corners into the HiZ space
+	float2 rectMin = 1;
+	float2 rectMax = 0;
+	float minDepth = 1;
+	UNROLL
+	for (uint i = 0; i < 8; i++)
+	{
+		float3 corner = center + radius * float3(i & 1 ? 1 : -1, i & 2 ? 1 : -1, i & 4 ? 1 : -1);
+		float4 clip = mul(float4(corner, 1), HiZViewProjection);
+		if (clip.w <= 0)
+			return false;
+		float3 ndc = clip.xyz / clip.w;
+		float2 uv = ndc.xy * float2(0.5, -0.5) + 0.5;
+		rectMin = min(rectMin, uv);
+		rectMax = max(rectMax, uv);
+		minDepth = min(minDepth, ndc.z);
+	}
+	rectMin = saturate(rectMin);
+	rectMax = saturate(rectMax);
+
+	// Pick the mip where the bounds cover at most 2x2 texels
+	float2 rectSize = (rectMax - rectMin) * HiZSize;
+	uint mip = min((uint)ceil(log2(max(max(rectSize.x, rectSize.y), 1))), HiZMipLevels - 1);
+	uint2 mipSize = max((uint2)HiZSize >> mip, 1);
+	uint2 texelMin = min((uint2)(rectMin * mipSize), mipSize - 1);
+	uint2 texelMax = min((uint2)(rectMax * mipSize), mipSize - 1);
+	if (any(texelMax - texelMin > 1))
+		return false;
+
+	// Test the nearest bounds depth against the farthest depth in the covered texels
+	float maxDepth = HiZ.Load(int3(texelMin, mip));
+	maxDepth = max(maxDepth, HiZ.Load(int3(texelMax.x, texelMin.y, mip)));
+	maxDepth = max(maxDepth, HiZ.Load(int3(texelMin.x, texelMax.y, mip)));
+	maxDepth = max(maxDepth, HiZ.Load(int3(texelMax, mip)));
+	return minDepth > maxDepth;
+}
+
+#endif
+
+#ifdef _CS_CullInstances
+
+ByteAddressBuffer Instances : register(t0);
+StructuredBuffer<InstanceBounds> Bounds : register(t1);
+RWByteAddressBuffer CulledInstances : register(u0);
+RWByteAddressBuffer DrawArgs : register(u1);
+
+// Compute shader for culling the instances and compacting the visible ones into the batches
+META_CS(true, FEATURE_LEVEL_SM5)
+[numthreads(64, 1, 1)]
+void CS_CullInstances(uint3 DispatchThreadId : SV_DispatchThreadID)
+{
+	uint index = DispatchThreadId.x;
+	if (index >= InstancesCount)
+		return;
+	InstanceBounds bounds = Bounds[index];
+
+	// Frustum culling
+	if (IsOutsideFrustum(bounds.Center, bounds.Radius))
+		return;
+
+	// Occlusion culling
+	BRANCH
+	if (HiZMipLevels != 0 && IsOccluded(bounds.Center, bounds.Radius))
+		return;
+
+	// Allocate the instance within the batch (InstanceCount and StartInstance of the draw arguments)
+	uint argsAddress = bounds.Batch * DRAW_ARGS_SIZE;
+	uint slot;
+	DrawArgs.InterlockedAdd(argsAddress + 4, 1, slot);
+	uint startInstance = DrawArgs.Load(argsAddress + 16);
+
+	// Copy instance data
+	uint srcAddress = bounds.Instance * INSTANCE_DATA_SIZE;
+	uint dstAddress = (startInstance + slot) * INSTANCE_DATA_SIZE;
+	UNROLL
+	for (uint j = 0; j < INSTANCE_DATA_SIZE; j += 16)
+		CulledInstances.Store4(dstAddress + j, Instances.Load4(srcAddress + j));
+}
+
+#endif
+
+#ifdef _CS_CullMeshlets
+
+Buffer<uint> Indices : register(t0);
+StructuredBuffer<Meshlet> Meshlets : register(t1);
+RWBuffer<uint> CulledIndices : register(u0);
+RWByteAddressBuffer DrawArgs : register(u1);
+
+groupshared uint MeshletSlot;
+
+// Compute shader for culling the mesh triangle clusters (a thread group per cluster) and compacting the visible triangles into the index buffer
+META_CS(true, FEATURE_LEVEL_SM5)
+[numthreads(64, 1, 1)]
+void CS_CullMeshlets(uint3 GroupId : SV_GroupID, uint GroupIndex : SV_GroupIndex)
+{
+	uint index = GroupId.y * MESHLETS_GROUPS_X + GroupId.x;
+	if (GroupIndex == 0)
+	{
+		uint slot = 0xffffffff;
+		if (index < MeshletsCount)
+		{
+			Meshlet meshlet = Meshlets[index];
+			bool visible = true;
+
+			// Backface culling (normal cone test in mesh local-space)
+			float3 viewToCenter = meshlet.Center - ViewPositionLocal;
+			if (ConeCulling && dot(viewToCenter, meshlet.ConeAxis) >= meshlet.ConeCutoff * length(viewToCenter) + meshlet.Radius)
+				visible = false;
+
+			// Frustum culling
+			float3 center = mul(float4(meshlet.Center, 1), World).xyz;
+			float radius = meshlet.Radius * WorldScale;
+			if (visible && IsOutsideFrustum(center, radius))
+				visible = false;
+
+			// Occlusion culling
+			if (visible && HiZMipLevels != 0 && IsOccluded(center, radius))
+				visible = false;
+
+			// Allocate the triangles within the draw call (IndicesCount of the draw arguments)
+			if (visible)
+				DrawArgs.InterlockedAdd(ArgsOffset, meshlet.IndicesCount, slot);
+		}
+		MeshletSlot = slot;
+	}
+	GroupMemoryBarrierWithGroupSync();
+
+	// Copy triangles of the visible cluster
+	uint slot = MeshletSlot;
+	if (slot == 0xffffffff)
+		return;
+	Meshlet meshlet = Meshlets[index];
+	for (uint i = GroupIndex; i < meshlet.IndicesCount; i += 64)
+		CulledIndices[IndexOffset + slot + i] = Indices[meshlet.StartIndex + i];
+}
+
+#endif
+
+#ifdef _CS_CullLODInstances
+
+StructuredBuffer<LODInstance> LODInstances : register(t0);
+RWByteAddressBuffer LODSlots : register(u0);
+RWByteAddressBuffer LODCounters : register(u1);
+
+// Compute shader for culling the persistent instances and selecting their LOD (instance slot within the LOD is stored with the LOD index in the upper bits)
+META_CS(true, FEATURE_LEVEL_SM5)
+[numthreads(64, 1, 1)]
+void CS_CullLODInstances(uint3 DispatchThreadId : SV_DispatchThreadID)
+{
+	uint index = DispatchThreadId.x;
+	if (index >= LODInstancesCount)
+		return;
+	LODInstance instance = LODInstances[index];
+	float3 center = instance.Center + InstancesOffset;
+	uint slot = LOD_SLOT_CULLED;
+
+	// Distance culling and frustum culling
+	bool visible = distance(CullViewPosition, center) - instance.Radius < instance.CullDistance && !IsOutsideFrustum(center, instance.Radius);
+
+	// Occlusion culling
+	BRANCH
+	if (visible && HiZMipLevels != 0 && IsOccluded(center, instance.Radius))
+		visible = false;
+
+	// Select LOD based on the screen size (see RenderTools::ComputeModelLOD)
+	float3 viewToCenter = center - LODViewPosition;
+	float screenRadius = LODScreenMultiple * instance.Radius;
+	float screenRadiusSquared = screenRadius * screenRadius / max(1.0f, dot(viewToCenter, viewToCenter) * LODDistanceScale) * LODDistanceFactor;
+	if (visible && screenRadiusSquared >= MinScreenRadiusSquared)
+	{
+		int lod = 0;
+		for (int i = (int)LODsCount - 1; i >= 0; i--)
+		{
+			if (LODScreenRadiusSquared[i / 4][i % 4] >= screenRadiusSquared)
+			{
+				lod = i;
+				break;
+			}
+		}
+		lod = clamp(lod + LODBias, (int)MinLOD, (int)MaxLOD);
+
+		// Allocate the instance within the LOD
+		LODCounters.InterlockedAdd(CountersOffset + lod * 4, 1, slot);
+		slot |= (uint)lod << 28;
+	}
+	LODSlots.Store((InstancesStart + index) * 4, slot);
+}
+
+#endif
+
+#if defined(_CS_LODInstancesArgs) || defined(_CS_ScatterLODInstances)
+
+RWByteAddressBuffer LODCounters : register(u1);
+
+// Gets the index of the first instance of the LOD in the output instance buffer
+uint GetLODStart(uint lod)
+{
+	uint start = InstancesStart;
+	for (uint i = 0; i < lod; i++)
+		start += LODCounters.Load(CountersOffset + i * 4);
+	return start;
+}
+
+#endif
+
+#ifdef _CS_LODInstancesArgs
+
+RWByteAddressBuffer DrawArgs : register(u2);
+
+// Compute shader for writing the draw arguments of each mesh of each LOD (instance count holds the mesh LOD index on input)
+META_CS(true, FEATURE_LEVEL_SM5)
+[numthreads(64, 1, 1)]
+void CS_LODInstancesArgs(uint3 DispatchThreadId : SV_DispatchThreadID)
+{
+	uint index = DispatchThreadId.x;
+	if (index >= ArgsCount)
+		return;
+	uint argsAddress = (ArgsStart + index) * DRAW_ARGS_SIZE;
+	uint lod = DrawArgs.Load(argsAddress + 4);
+	DrawArgs.Store(argsAddress + 4, LODCounters.Load(CountersOffset + lod * 4));
+	DrawArgs.Store(argsAddress + 16, GetLODStart(lod));
+}
+
+#endif
+
+#ifdef _CS_ScatterLODInstances
+
+StructuredBuffer<LODInstance> LODInstances : register(t0);
+RWByteAddressBuffer LODSlots : register(u0);
+RWByteAddressBuffer CulledInstances : register(u3);
+
+// Compute shader for writing the visible instances data grouped by LOD
+META_CS(true, FEATURE_LEVEL_SM5)
+[numthreads(64, 1, 1)]
+void CS_ScatterLODInstances(uint3 DispatchThreadId : SV_DispatchThreadID)
+{
+	uint index = DispatchThreadId.x;
+	if (index >= LODInstancesCount)
+		return;
+	uint slot = LODSlots.Load((InstancesStart + index) * 4);
+	if (slot == LOD_SLOT_CULLED)
+		return;
+	LODInstance instance = LODInstances[index];
+
+	// Write InstanceData (without LOD dithering and lightmap)
+	uint dstAddress = (GetLODStart(slot >> 28) + (slot & 0x0fffffff)) * INSTANCE_DATA_SIZE;
+	CulledInstances.Store4(dstAddress, asuint(float4(instance.Origin + InstancesOffset, instance.Random)));
+	CulledInstances.Store4(dstAddress + 16, asuint(float4(instance.Transform1, 0.0f)));
+	CulledInstances.Store4(dstAddress + 32, asuint(float4(instance.Transform2, instance.Transform3.x)));
+	CulledInstances.Store4(dstAddress + 48, uint4(asuint(instance.Transform3.yz), 0, 0));
+}
+
+#endif
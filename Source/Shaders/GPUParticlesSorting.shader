@@ -15,6 +15,14 @@ uint ParticleCapacity;
 uint PositionOffset;
 uint CustomOffset;
 float4x4 PositionTransform;
+float4x4 CullingTransform;
+float4 CullingPlanes[6];
+int SpriteSizeOffset;
+int ScaleOffset;
+float ModelRadius;
+float CullingScale;
+uint CullingEnabled;
+float3 Dummy0;
 META_CB_END
 
 // Particles data buffer
@@ -28,16 +36,53 @@ struct Item
 };
 RWStructuredBuffer<Item> SortingKeys : register(u0);
 
+// Output counter of the visible particles (amount of sorting keys written)
+RWByteAddressBuffer VisibleCounter : register(u1);
+
 float GetParticleFloat(uint particleIndex, int offset)
 {
 	return asfloat(ParticlesData.Load(particleIndex * ParticleStride + offset));
 }
 
+float2 GetParticleVec2(uint particleIndex, int offset)
+{
+	return asfloat(ParticlesData.Load2(particleIndex * ParticleStride + offset));
+}
+
 float3 GetParticleVec3(uint particleIndex, int offset)
 {
 	return asfloat(ParticlesData.Load3(particleIndex * ParticleStride + offset));
 }
 
+// Checks if the particle bounding sphere intersects with the view frustum
+bool IsParticleVisible(uint particleIndex)
+{
+	float3 center = mul(float4(GetParticleVec3(particleIndex, PositionOffset), 1.0f), CullingTransform).xyz;
+	float radius = 0.0f;
+	if (SpriteSizeOffset >= 0)
+	{
+		float2 spriteSize = GetParticleVec2(particleIndex, SpriteSizeOffset);
+		radius = max(spriteSize.x, spriteSize.y) * 0.7072f;
+	}
+	if (ScaleOffset >= 0)
+	{
+		float3 scale = abs(GetParticleVec3(particleIndex, ScaleOffset));
+		radius = max(radius, max(scale.x, max(scale.y, scale.z)) * ModelRadius);
+	}
+	else
+	{
+		radius = max(radius, ModelRadius);
+	}
+	radius *= CullingScale;
+	UNROLL
+	for (int i = 0; i < 6; i++)
+	{
+		if (dot(CullingPlanes[i].xyz, center) + CullingPlanes[i].w < -radius)
+			return false;
+	}
+	return true;
+}
+
 // Sorting keys generation shader
 META_CS(true, FEATURE_LEVEL_SM5)
 META_PERMUTATION_1(SORT_MODE=0)
@@ -51,6 +96,10 @@ void CS_Sort(uint3 dispatchThreadId : SV_DispatchThreadID)
 	if (index >= particlesCount)
 		return;
 
+	// Skip particles outside the view
+	if (CullingEnabled && !IsParticleVisible(index))
+		return;
+
 	// TODO: maybe process more than 1 particle at once and pre-sort them?
 
 #if SORT_MODE == 0
@@ -79,9 +128,11 @@ void CS_Sort(uint3 dispatchThreadId : SV_DispatchThreadID)
 
 #endif
 
-	// Write sorting index-key pair
+	// Write sorting index-key pair (compacted so only visible particles get sorted and drawn)
+	uint slot;
+	VisibleCounter.InterlockedAdd(0, 1, slot);
 	Item item;
 	item.Key = sortKey;
 	item.Value = index;
-	SortingKeys[index] = item;
+	SortingKeys[slot] = item;
 }
@@ -22,6 +22,33 @@ META_CB_END
 
 Texture2D Image : register(t0);
 
+// Textured draw calls are batched with up to 8 textures (slot index is stored per-vertex in custom data)
+Texture2D Image1 : register(t1);
+Texture2D Image2 : register(t2);
+Texture2D Image3 : register(t3);
+Texture2D Image4 : register(t4);
+Texture2D Image5 : register(t5);
+Texture2D Image6 : register(t6);
+Texture2D Image7 : register(t7);
+
+float4 SampleImage(SamplerState imageSampler, float2 uv, float slot)
+{
+	// Use explicit gradients because slot can change between the neighbor pixels (at the edges of the quads)
+	float2 uvDdx = ddx(uv);
+	float2 uvDdy = ddy(uv);
+	switch ((uint)(slot + 0.5f))
+	{
+	case 1: return Image1.SampleGrad(imageSampler, uv, uvDdx, uvDdy);
+	case 2: return Image2.SampleGrad(imageSampler, uv, uvDdx, uvDdy);
+	case 3: return Image3.SampleGrad(imageSampler, uv, uvDdx, uvDdy);
+	case 4: return Image4.SampleGrad(imageSampler, uv, uvDdx, uvDdy);
+	case 5: return Image5.SampleGrad(imageSampler, uv, uvDdx, uvDdy);
+	case 6: return Image6.SampleGrad(imageSampler, uv, uvDdx, uvDdy);
+	case 7: return Image7.SampleGrad(imageSampler, uv, uvDdx, uvDdy);
+	default: return Image.SampleGrad(imageSampler, uv, uvDdx, uvDdy);
+	}
+}
+
 META_VS(true, FEATURE_LEVEL_ES2)
 META_VS_IN_ELEMENT(POSITION, 0, R32G32_FLOAT,       0, ALIGN, PER_VERTEX, 0, true)
 META_VS_IN_ELEMENT(TEXCOORD, 0, R16G16_FLOAT,       0, ALIGN, PER_VERTEX, 0, true)
@@ -51,7 +78,7 @@ float4 PS_Image(VS2PS input) : SV_Target0
 {
 	PerformClipping(input);
 
-	return Image.Sample(SamplerLinearClamp, input.TexCoord) * input.Color;
+	return SampleImage(SamplerLinearClamp, input.TexCoord, input.CustomData.x) * input.Color;
 }
 
 META_PS(true, FEATURE_LEVEL_ES2)
@@ -59,7 +86,7 @@ float4 PS_ImagePoint(VS2PS input) : SV_Target0
 {
 	PerformClipping(input);
 
-	return Image.Sample(SamplerPointClamp, input.TexCoord) * input.Color;
+	return SampleImage(SamplerPointClamp, input.TexCoord, input.CustomData.x) * input.Color;
 }
 
 META_PS(true, FEATURE_LEVEL_ES2)
@@ -97,7 +124,20 @@ float4 PS_Font(VS2PS input) : SV_Target0
 	PerformClipping(input);
 
 	float4 color = input.Color;
-	color.a *= Image.Sample(SamplerLinearClamp, input.TexCoord).r;
+	color.a *= SampleImage(SamplerLinearClamp, input.TexCoord, input.CustomData.x).r;
+	return color;
+}
+
+META_PS(true, FEATURE_LEVEL_ES2)
+float4 PS_FontSDF(VS2PS input) : SV_Target0
+{
+	PerformClipping(input);
+
+	// Signed distance field glyph (0.5 at the glyph edge) anti-aliased over a single screen pixel at any text size
+	float dist = SampleImage(SamplerLinearClamp, input.TexCoord, input.CustomData.x).r - 0.5f;
+	float filterWidth = max(fwidth(dist), 0.0001f);
+	float4 color = input.Color;
+	color.a *= saturate(dist / filterWidth + 0.5f);
 	return color;
 }
 
@@ -0,0 +1,25 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#ifndef __HALF_RES_RENDERING__
+#define __HALF_RES_RENDERING__
+
+// Checks if the pixel is rendered in the given frame when using the checkerboard rendering (every frame renders the other half of the pixels, the rest is reconstructed from the previous frame)
+bool IsCheckerboardPixel(uint2 pixel, uint checkerboardFrame)
+{
+    return ((pixel.x + pixel.y + checkerboardFrame) & 1) == 0;
+}
+
+// Calculates the weight of the sample based on the linear depth similarity (relative difference)
+float GetDepthWeight(float depth, float sampleDepth)
+{
+    return 1.0f / (0.0001f + abs(depth - sampleDepth) / max(depth, 0.0001f));
+}
+
+// Calculates the bilateral weight of the low-resolution sample based on the linear depth and normal similarity to the full-resolution pixel
+float GetBilateralWeight(float depth, float3 normal, float sampleDepth, float3 sampleNormal)
+{
+    float normalWeight = pow(saturate(dot(normal, sampleNormal)), 8.0f);
+    return GetDepthWeight(depth, sampleDepth) * normalWeight + 0.00001f;
+}
+
+#endif
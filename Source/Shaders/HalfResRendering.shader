@@ -0,0 +1,129 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "./Flax/Common.hlsl"
+#include "./Flax/GBuffer.hlsl"
+#include "./Flax/HalfResRendering.hlsl"
+
+META_CB_BEGIN(0, Data)
+GBufferData GBuffer;
+float2 InputSize;
+float2 InputTexelSize;
+uint CheckerboardFrame;
+float HasHistory;
+float2 Dummy0;
+META_CB_END
+
+DECLARE_GBUFFERDATA_ACCESS(GBuffer)
+
+Texture2D Input : register(t4);
+Texture2D DepthNormals : register(t5);
+Texture2D History : register(t6);
+Texture2D MotionVectors : register(t7);
+
+// Pixel Shader for the depth-aware downscale of the depth and normals (to half res)
+META_PS(true, FEATURE_LEVEL_ES2)
+float4 PS_DepthNormals(Quad_VS2PS input) : SV_Target0
+{
+	// Inputs:
+	// Depth - full-res depth buffer
+	// GBuffer1 - full-res normals
+
+	// Pick the closest or the furthest pixel of the 2x2 quad (alternating in the checkerboard pattern) to preserve both sides of the depth edges
+	uint2 pixel = uint2(input.Position.xy);
+	int2 fullResPixel = pixel * 2;
+	int2 offsets[4] = { int2(0, 0), int2(1, 0), int2(0, 1), int2(1, 1) };
+	bool useMin = ((pixel.x + pixel.y) & 1) == 0;
+	float depth = Depth.Load(int3(fullResPixel, 0)).r;
+	int2 offset = offsets[0];
+	UNROLL
+	for (int i = 1; i < 4; i++)
+	{
+		float sampleDepth = Depth.Load(int3(fullResPixel + offsets[i], 0)).r;
+		if (useMin ? sampleDepth < depth : sampleDepth > depth)
+		{
+			depth = sampleDepth;
+			offset = offsets[i];
+		}
+	}
+
+	// Output the normal of the picked pixel and its linear depth
+	GBufferData gBufferData = GetGBufferData();
+	float3 normal = DecodeNormal(GBuffer1.Load(int3(fullResPixel + offset, 0)).rgb);
+	return float4(normal, LinearizeZ(gBufferData, depth));
+}
+
+// Pixel Shader for the bilateral (depth and normal aware) upsample of the half-res image
+META_PS(true, FEATURE_LEVEL_ES2)
+float4 PS_Upsample(Quad_VS2PS input) : SV_Target0
+{
+	// Inputs:
+	// Input - half-res image
+	// DepthNormals - half-res depth and normals
+
+	GBufferData gBufferData = GetGBufferData();
+	float depth = SampleDepth(gBufferData, input.TexCoord);
+	float3 normal = DecodeNormal(SAMPLE_RT(GBuffer1, input.TexCoord).rgb);
+
+	// Weight the 4 nearest half-res pixels by the bilinear footprint and the similarity to the full-res pixel
+	float2 lowResPos = input.TexCoord * InputSize - 0.5f;
+	float2 lowResBase = floor(lowResPos);
+	float2 f = lowResPos - lowResBase;
+	float4 bilinearWeights = float4((1 - f.x) * (1 - f.y), f.x * (1 - f.y), (1 - f.x) * f.y, f.x * f.y);
+	int2 offsets[4] = { int2(0, 0), int2(1, 0), int2(0, 1), int2(1, 1) };
+	int2 maxPos = (int2)InputSize - 1;
+	float4 result = 0;
+	float totalWeight = 0;
+	UNROLL
+	for (int i = 0; i < 4; i++)
+	{
+		int2 samplePos = clamp((int2)lowResBase + offsets[i], int2(0, 0), maxPos);
+		float4 sampleDepthNormal = DepthNormals.Load(int3(samplePos, 0));
+		float weight = bilinearWeights[i] * GetBilateralWeight(depth, normal, sampleDepthNormal.w, sampleDepthNormal.xyz);
+		result += Input.Load(int3(samplePos, 0)) * weight;
+		totalWeight += weight;
+	}
+	return result / totalWeight;
+}
+
+// Pixel Shader for the checkerboard rendering temporal reconstruction
+META_PS(true, FEATURE_LEVEL_ES2)
+float4 PS_CheckerboardReconstruct(Quad_VS2PS input) : SV_Target0
+{
+	// Inputs:
+	// Input - image with only the checkerboard pixels of the current frame rendered
+	// History - reconstructed image from the previous frame
+	// MotionVectors - motion vectors
+
+	int2 pixel = int2(input.Position.xy);
+	float4 current = Input.Load(int3(pixel, 0));
+	if (IsCheckerboardPixel(uint2(pixel), CheckerboardFrame))
+		return current;
+
+	// Missing pixel has all direct neighbours rendered in the current frame
+	int2 maxPixel = (int2)InputSize - 1;
+	float4 n0 = Input.Load(int3(clamp(pixel + int2(-1, 0), int2(0, 0), maxPixel), 0));
+	float4 n1 = Input.Load(int3(clamp(pixel + int2(1, 0), int2(0, 0), maxPixel), 0));
+	float4 n2 = Input.Load(int3(clamp(pixel + int2(0, -1), int2(0, 0), maxPixel), 0));
+	float4 n3 = Input.Load(int3(clamp(pixel + int2(0, 1), int2(0, 0), maxPixel), 0));
+	float4 neighboursMin = min(min(n0, n1), min(n2, n3));
+	float4 neighboursMax = max(max(n0, n1), max(n2, n3));
+
+	// Reproject the pixel from the previous frame (clamped to the neighbourhood to reject the disocclusions)
+	float2 uv = input.TexCoord;
+	float2 velocity = MotionVectors.SampleLevel(SamplerLinearClamp, uv, 0).xy;
+	float2 prevUV = uv - velocity;
+	if (HasHistory > 0 && all(prevUV > 0) && all(prevUV < 1))
+	{
+		float4 history = History.SampleLevel(SamplerLinearClamp, prevUV, 0);
+		return clamp(history, neighboursMin, neighboursMax);
+	}
+
+	// Fallback to the depth-aware interpolation of the neighbours
+	GBufferData gBufferData = GetGBufferData();
+	float depth = SampleDepth(gBufferData, uv);
+	float w0 = GetDepthWeight(depth, SampleDepth(gBufferData, uv - float2(InputTexelSize.x, 0)));
+	float w1 = GetDepthWeight(depth, SampleDepth(gBufferData, uv + float2(InputTexelSize.x, 0)));
+	float w2 = GetDepthWeight(depth, SampleDepth(gBufferData, uv - float2(0, InputTexelSize.y)));
+	float w3 = GetDepthWeight(depth, SampleDepth(gBufferData, uv + float2(0, InputTexelSize.y)));
+	return (n0 * w0 + n1 * w1 + n2 * w2 + n3 * w3) / (w0 + w1 + w2 + w3);
+}
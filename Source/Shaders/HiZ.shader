@@ -0,0 +1,47 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "./Flax/Common.hlsl"
+
+META_CB_BEGIN(0, Data)
+uint2 SrcSize;
+uint2 DstSize;
+META_CB_END
+
+Texture2D<float> Src : register(t0);
+
+// Pixel Shader for downsampling the depth into the next HiZ mip (farthest depth)
+META_PS(true, FEATURE_LEVEL_ES3)
+float PS_Downsample(Quad_VS2PS input) : SV_Target
+{
+	uint2 dst = (uint2)input.Position.xy;
+
+	// Use all source texels covered by the destination texel to stay conservative with odd sizes
+	uint2 srcMin = dst * SrcSize / DstSize;
+	uint2 srcMax = min(((dst + 1) * SrcSize + DstSize - 1) / DstSize, SrcSize) - 1;
+	float depth = 0;
+	LOOP
+	for (uint y = srcMin.y; y <= srcMax.y; y++)
+	{
+		LOOP
+		for (uint x = srcMin.x; x <= srcMax.x; x++)
+			depth = max(depth, Src.Load(int3(x, y, 0)));
+	}
+	return depth;
+}
+
+#ifdef _CS_Readback
+
+RWBuffer<float> Output : register(u0);
+
+// Compute shader for copying the HiZ mip into the linear buffer for the CPU readback
+META_CS(true, FEATURE_LEVEL_SM5)
+[numthreads(8, 8, 1)]
+void CS_Readback(uint3 DispatchThreadId : SV_DispatchThreadID)
+{
+	uint2 texel = DispatchThreadId.xy;
+	if (any(texel >= DstSize))
+		return;
+	Output[texel.y * DstSize.x + texel.x] = Src[texel];
+}
+
+#endif
@@ -0,0 +1,223 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "./Flax/Common.hlsl"
+
+#define MODEL_SDF_GROUP_SIZE 4
+#define MODEL_SDF_SAMPLES_COUNT 12
+
+// Flattened BVH node (MeshAccelerationStructure::GPUNode)
+struct BVHNode
+{
+	float3 BoundsMin;
+	uint MissIndex;
+	float3 BoundsMax;
+	uint TrianglesStart;
+	uint TrianglesCount;
+};
+
+META_CB_BEGIN(0, Data)
+float3 XyzToLocalMul;
+float MaxDistance;
+float3 XyzToLocalAdd;
+float BackfacesThreshold;
+uint3 Resolution;
+uint NodesCount;
+float2 EncodeMAD;
+uint ZOffset;
+float Dummy0;
+float4 SampleDirections[MODEL_SDF_SAMPLES_COUNT];
+META_CB_END
+
+#ifdef _CS_GenerateSDF
+
+StructuredBuffer<BVHNode> Nodes : register(t0);
+StructuredBuffer<float3> Triangles : register(t1);
+RWBuffer<float> Output : register(u0);
+
+// Calculates the distance from the point to the axis-aligned box (zero if inside)
+float DistanceToBox(float3 p, float3 boxMin, float3 boxMax)
+{
+	return length(max(0, max(boxMin - p, p - boxMax)));
+}
+
+// Source: Real-Time Collision Detection by Christer Ericson (page 136)
+float3 ClosestPointOnTriangle(float3 p, float3 a, float3 b, float3 c)
+{
+	float3 ab = b - a;
+	float3 ac = c - a;
+	float3 ap = p - a;
+	float d1 = dot(ab, ap);
+	float d2 = dot(ac, ap);
+	if (d1 <= 0.0f && d2 <= 0.0f)
+		return a;
+	float3 bp = p - b;
+	float d3 = dot(ab, bp);
+	float d4 = dot(ac, bp);
+	if (d3 >= 0.0f && d4 <= d3)
+		return b;
+	float vc = d1 * d4 - d3 * d2;
+	if (vc <= 0.0f && d1 >= 0.0f && d3 <= 0.0f)
+		return a + ab * (d1 / (d1 - d3));
+	float3 cp = p - c;
+	float d5 = dot(ab, cp);
+	float d6 = dot(ac, cp);
+	if (d6 >= 0.0f && d5 <= d6)
+		return c;
+	float vb = d5 * d2 - d1 * d6;
+	if (vb <= 0.0f && d2 >= 0.0f && d6 <= 0.0f)
+		return a + ac * (d2 / (d2 - d6));
+	float va = d3 * d6 - d5 * d4;
+	if (va <= 0.0f && d4 - d3 >= 0.0f && d5 - d6 >= 0.0f)
+		return b + (c - b) * ((d4 - d3) / ((d4 - d3) + (d5 - d6)));
+	float denom = 1.0f / (va + vb + vc);
+	return a + ab * (vb * denom) + ac * (vc * denom);
+}
+
+// Source: Fast Minimum Storage Ray / Triangle Intersection (double-sided)
+bool RayHitTriangle(float3 rayPos, float3 rayDir, float3 a, float3 b, float3 c, out float hitDistance)
+{
+	hitDistance = 0;
+	float3 edge1 = b - a;
+	float3 edge2 = c - a;
+	float3 dirCrossEdge2 = cross(rayDir, edge2);
+	float determinant = dot(edge1, dirCrossEdge2);
+	if (abs(determinant) < 1e-6f)
+		return false;
+	float invDeterminant = 1.0f / determinant;
+	float3 distanceVector = rayPos - a;
+	float u = dot(distanceVector, dirCrossEdge2) * invDeterminant;
+	if (u < 0.0f || u > 1.0f)
+		return false;
+	float3 distanceCrossEdge1 = cross(distanceVector, edge1);
+	float v = dot(rayDir, distanceCrossEdge1) * invDeterminant;
+	if (v < 0.0f || u + v > 1.0f)
+		return false;
+	hitDistance = dot(edge2, distanceCrossEdge1) * invDeterminant;
+	return hitDistance >= 0.0f;
+}
+
+// Calculates the ray distance to the axis-aligned box (returns false if missed)
+bool RayHitBox(float3 rayPos, float3 rayInvDir, float3 boxMin, float3 boxMax, float maxDistance)
+{
+	float3 t0 = (boxMin - rayPos) * rayInvDir;
+	float3 t1 = (boxMax - rayPos) * rayInvDir;
+	float3 tMin = min(t0, t1);
+	float3 tMax = max(t0, t1);
+	float enter = max(max(tMin.x, tMin.y), max(tMin.z, 0.0f));
+	float exit = min(min(tMax.x, tMax.y), tMax.z);
+	return enter <= exit && enter < maxDistance;
+}
+
+// Finds the distance to the closest triangle (stackless BVH traversal with miss links)
+float PointQuery(float3 p)
+{
+	float minDistance = MaxDistance;
+	uint nodeIndex = 0;
+	LOOP
+	while (nodeIndex < NodesCount)
+	{
+		BVHNode node = Nodes[nodeIndex];
+		if (DistanceToBox(p, node.BoundsMin, node.BoundsMax) >= minDistance)
+		{
+			nodeIndex = node.MissIndex;
+			continue;
+		}
+		if (node.TrianglesCount != 0)
+		{
+			uint vertexIndex = node.TrianglesStart * 3;
+			uint vertexEnd = vertexIndex + node.TrianglesCount * 3;
+			LOOP
+			for (; vertexIndex < vertexEnd; vertexIndex += 3)
+			{
+				float3 closest = ClosestPointOnTriangle(p, Triangles[vertexIndex], Triangles[vertexIndex + 1], Triangles[vertexIndex + 2]);
+				minDistance = min(minDistance, distance(p, closest));
+			}
+			nodeIndex = node.MissIndex;
+		}
+		else
+		{
+			nodeIndex++;
+		}
+	}
+	return minDistance;
+}
+
+// Traces the ray against triangles and returns 0 if nothing was hit, 1 if hit front face, 2 if hit back face
+uint RayCast(float3 rayPos, float3 rayDir)
+{
+	float3 rayInvDir = 1.0f / rayDir;
+	float hitDistance = 1e30f;
+	uint result = 0;
+	uint nodeIndex = 0;
+	LOOP
+	while (nodeIndex < NodesCount)
+	{
+		BVHNode node = Nodes[nodeIndex];
+		if (!RayHitBox(rayPos, rayInvDir, node.BoundsMin, node.BoundsMax, hitDistance))
+		{
+			nodeIndex = node.MissIndex;
+			continue;
+		}
+		if (node.TrianglesCount != 0)
+		{
+			uint vertexIndex = node.TrianglesStart * 3;
+			uint vertexEnd = vertexIndex + node.TrianglesCount * 3;
+			LOOP
+			for (; vertexIndex < vertexEnd; vertexIndex += 3)
+			{
+				float3 a = Triangles[vertexIndex];
+				float3 b = Triangles[vertexIndex + 1];
+				float3 c = Triangles[vertexIndex + 2];
+				float triangleDistance;
+				if (RayHitTriangle(rayPos, rayDir, a, b, c, triangleDistance) && triangleDistance < hitDistance)
+				{
+					hitDistance = triangleDistance;
+					result = dot(rayDir, cross(b - a, c - a)) > 0 ? 2 : 1;
+				}
+			}
+			nodeIndex = node.MissIndex;
+		}
+		else
+		{
+			nodeIndex++;
+		}
+	}
+	return result;
+}
+
+// Compute shader for generating the model SDF (matches ModelTool::GenerateModelSDF on a CPU)
+META_CS(true, FEATURE_LEVEL_SM5)
+[numthreads(MODEL_SDF_GROUP_SIZE, MODEL_SDF_GROUP_SIZE, MODEL_SDF_GROUP_SIZE)]
+void CS_GenerateSDF(uint3 DispatchThreadId : SV_DispatchThreadID)
+{
+	uint3 voxelCoord = DispatchThreadId + uint3(0, 0, ZOffset);
+	if (any(voxelCoord >= Resolution))
+		return;
+	float3 voxelPos = (float3)voxelCoord * XyzToLocalMul + XyzToLocalAdd;
+
+	// Point query to find the distance to the closest surface
+	float minDistance = PointQuery(voxelPos);
+
+	// Raycast samples around voxel to count triangle backfaces hit
+	uint hitBackCount = 0, hitCount = 0;
+	for (uint i = 0; i < MODEL_SDF_SAMPLES_COUNT; i++)
+	{
+		uint hit = RayCast(voxelPos, SampleDirections[i].xyz);
+		if (hit != 0)
+		{
+			hitCount++;
+			if (hit == 2)
+				hitBackCount++;
+		}
+	}
+	if ((float)hitBackCount > (float)MODEL_SDF_SAMPLES_COUNT * BackfacesThreshold && hitCount != 0)
+	{
+		// Voxel is inside the geometry so turn it into negative distance to the surface
+		minDistance *= -1;
+	}
+
+	uint index = voxelCoord.x + (voxelCoord.y + voxelCoord.z * Resolution.y) * Resolution.x;
+	Output[index] = minDistance * EncodeMAD.x + EncodeMAD.y;
+}
+
+#endif
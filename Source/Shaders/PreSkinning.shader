@@ -0,0 +1,147 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "./Flax/Common.hlsl"
+
+// Size of the skinned mesh vertex (VB0SkinnedElementType, in bytes)
+#define SKINNED_VERTEX_SIZE 36
+
+// Size of the static mesh vertex attributes (VB1ElementType, in bytes)
+#define ATTRIBUTES_VERTEX_SIZE 16
+
+// Size of the blend shape vertex (BlendShapeVertex, in bytes)
+#define BLEND_SHAPE_VERTEX_SIZE 28
+
+META_CB_BEGIN(0, Data)
+uint VerticesCount;
+uint BonesOffset;
+float2 Dummy0;
+META_CB_END
+
+META_CB_BEGIN(1, BlendShapeData)
+uint ShapeVerticesOffset;
+uint ShapeVerticesCount;
+float ShapeWeight;
+uint ShapeUseNormals;
+uint MinVertexIndex;
+uint MaxVertexIndex;
+float2 Dummy1;
+META_CB_END
+
+// Unpacks the R10G10B10A2_UNORM value
+float4 UnpackUnorm1010102(uint value)
+{
+	return float4(value & 0x3ff, (value >> 10) & 0x3ff, (value >> 20) & 0x3ff, value >> 30) / float4(1023.0f, 1023.0f, 1023.0f, 3.0f);
+}
+
+// Packs the normalized vector into R10G10B10 of the R10G10B10A2_UNORM value (alpha bits are provided as-is)
+uint PackUnorm101010(float3 value, uint alphaBits)
+{
+	uint3 v = (uint3)round(saturate(value * 0.5f + 0.5f) * 1023.0f);
+	return v.x | (v.y << 10) | (v.z << 20) | (alphaBits & 0xc0000000);
+}
+
+#ifdef _CS_PreSkin
+
+ByteAddressBuffer Vertices : register(t0);
+Buffer<float4> BoneMatrices : register(t1);
+RWByteAddressBuffer OutputPositions : register(u0);
+RWByteAddressBuffer OutputAttributes : register(u1);
+
+// Calculates the transposed transform matrix for the given bone index
+float3x4 GetBoneMatrix(uint index)
+{
+	index = BonesOffset + index * 3;
+	float4 a = BoneMatrices[index];
+	float4 b = BoneMatrices[index + 1];
+	float4 c = BoneMatrices[index + 2];
+	return float3x4(a, b, c);
+}
+
+// Compute shader for skinning the mesh vertices into the static mesh vertex buffers (positions and attributes)
+META_CS(true, FEATURE_LEVEL_SM5)
+[numthreads(64, 1, 1)]
+void CS_PreSkin(uint3 DispatchThreadId : SV_DispatchThreadID)
+{
+	uint index = DispatchThreadId.x;
+	if (index >= VerticesCount)
+		return;
+
+	// Load skinned vertex
+	uint address = index * SKINNED_VERTEX_SIZE;
+	float3 position = asfloat(Vertices.Load3(address));
+	uint4 data = Vertices.Load4(address + 12); // TexCoord, Normal, Tangent, BlendIndices
+	uint2 weightsData = Vertices.Load2(address + 28);
+	uint4 blendIndices = uint4(data.w & 0xff, (data.w >> 8) & 0xff, (data.w >> 16) & 0xff, data.w >> 24);
+	float4 blendWeights = float4(f16tof32(weightsData.x), f16tof32(weightsData.x >> 16), f16tof32(weightsData.y), f16tof32(weightsData.y >> 16));
+
+	// Blend bones (the same way as material vertex shader for skinned meshes)
+	float weightsSum = blendWeights.x + blendWeights.y + blendWeights.z + blendWeights.w;
+	float mainWeight = blendWeights.x + (1.0f - weightsSum); // Re-normalize to account for 16-bit weights encoding erros
+	float3x4 boneMatrix = mainWeight * GetBoneMatrix(blendIndices.x);
+	boneMatrix += blendWeights.y * GetBoneMatrix(blendIndices.y);
+	boneMatrix += blendWeights.z * GetBoneMatrix(blendIndices.z);
+	boneMatrix += blendWeights.w * GetBoneMatrix(blendIndices.w);
+
+	// Apply skinning
+	position = mul(boneMatrix, float4(position, 1));
+	float3 normal = UnpackUnorm1010102(data.y).xyz * 2.0f - 1.0f;
+	float3 tangent = UnpackUnorm1010102(data.z).xyz * 2.0f - 1.0f;
+	normal = normalize(mul(boneMatrix, float4(normal, 0)));
+	tangent = normalize(mul(boneMatrix, float4(tangent, 0)));
+
+	// Write static vertex (TexCoord and bitangent sign are copied, lightmap UVs are unused)
+	OutputPositions.Store3(index * 12, asuint(position));
+	OutputAttributes.Store4(index * ATTRIBUTES_VERTEX_SIZE, uint4(data.x, PackUnorm101010(normal, data.y), PackUnorm101010(tangent, data.z), 0));
+}
+
+#endif
+
+#if defined(_CS_BlendShape) || defined(_CS_BlendShapesNormalize)
+
+ByteAddressBuffer BlendShapeVertices : register(t0);
+RWByteAddressBuffer OutputVertices : register(u0);
+
+// Compute shader for applying the blend shape (a thread per shape vertex) to the skinned mesh vertices
+META_CS(true, FEATURE_LEVEL_SM5)
+[numthreads(64, 1, 1)]
+void CS_BlendShape(uint3 DispatchThreadId : SV_DispatchThreadID)
+{
+	uint index = DispatchThreadId.x;
+	if (index >= ShapeVerticesCount)
+		return;
+
+	// Load blend shape vertex
+	uint shapeAddress = (ShapeVerticesOffset + index) * BLEND_SHAPE_VERTEX_SIZE;
+	float3 positionDelta = asfloat(BlendShapeVertices.Load3(shapeAddress));
+	float3 normalDelta = asfloat(BlendShapeVertices.Load3(shapeAddress + 12));
+	uint vertexIndex = BlendShapeVertices.Load(shapeAddress + 24);
+
+	// Blend vertex (vertices within a single shape are unique so there are no write conflicts)
+	uint address = vertexIndex * SKINNED_VERTEX_SIZE;
+	float3 position = asfloat(OutputVertices.Load3(address));
+	OutputVertices.Store3(address, asuint(position + positionDelta * ShapeWeight));
+	if (ShapeUseNormals)
+	{
+		uint normalData = OutputVertices.Load(address + 16);
+		float3 normal = UnpackUnorm1010102(normalData).xyz * 2.0f - 1.0f;
+		OutputVertices.Store(address + 16, PackUnorm101010(normal + normalDelta * ShapeWeight, normalData));
+	}
+}
+
+// Compute shader for normalizing normal vectors and rebuilding tangent frames of the vertices modified by the blend shapes
+META_CS(true, FEATURE_LEVEL_SM5)
+[numthreads(64, 1, 1)]
+void CS_BlendShapesNormalize(uint3 DispatchThreadId : SV_DispatchThreadID)
+{
+	uint vertexIndex = MinVertexIndex + DispatchThreadId.x;
+	if (vertexIndex > MaxVertexIndex)
+		return;
+	uint address = vertexIndex * SKINNED_VERTEX_SIZE;
+	uint2 data = OutputVertices.Load2(address + 16); // Normal, Tangent
+	float3 normal = normalize(UnpackUnorm1010102(data.x).xyz * 2.0f - 1.0f);
+	float3 tangent = UnpackUnorm1010102(data.y).xyz * 2.0f - 1.0f;
+	tangent = normalize(tangent - dot(tangent, normal) * normal);
+	OutputVertices.Store2(address + 16, uint2(PackUnorm101010(normal, data.x), PackUnorm101010(tangent, data.y)));
+}
+
+#endif
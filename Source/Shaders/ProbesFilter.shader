@@ -6,7 +6,8 @@
 #include "./Flax/SH.hlsl"
 
 META_CB_BEGIN(0, Data)
-float2 Dummy0;
+uint MipSize;
+float Dummy0;
 int CubeFace;
 float SourceMipIndex;
 META_CB_END
@@ -76,3 +77,91 @@ float4 PS_FilterFace(Quad_VS2PS input) : SV_Target
 
 	return filteredColor / max(weight, 0.001);
 }
+
+#ifdef _CS_CompressBC6H
+
+Texture2D<float4> Face : register(t1);
+RWTexture2D<uint4> Output : register(u0);
+
+// Quantizes the color into the 10-bit BC6H endpoint (unsigned half float bits)
+float3 QuantizeBC6H(float3 color)
+{
+	return (f32tof16(color) * 1024.0f) / (0x7bff + 1.0f);
+}
+
+// Calculates the 4-bit index of the texel on the endpoints line (positions are in the half float bits space that is close to logarithmic)
+uint GetIndexBC6H(float texelPos, float endPoint0Pos, float endPoint1Pos)
+{
+	float r = (texelPos - endPoint0Pos) / max(endPoint1Pos - endPoint0Pos, 0.0001f);
+	return (uint)clamp(r * 14.93333f + 0.03333f + 0.5f, 0.0f, 15.0f);
+}
+
+// Compute shader for compressing the probe face mip into BC6H blocks (single region mode 11 with 10-bit endpoints, fast enough for realtime probes)
+META_CS(true, FEATURE_LEVEL_SM5)
+[numthreads(8, 8, 1)]
+void CS_CompressBC6H(uint3 DispatchThreadId : SV_DispatchThreadID)
+{
+	uint2 block = DispatchThreadId.xy;
+	if (any(block >= (MipSize + 3) / 4))
+		return;
+
+	// Load block texels (clamped to the mip size that can be smaller than the block)
+	float3 texels[16];
+	float3 blockMin = 65504.0f;
+	float3 blockMax = 0.0f;
+	UNROLL
+	for (uint i = 0; i < 16; i++)
+	{
+		uint2 texel = min(block * 4 + uint2(i % 4, i / 4), MipSize - 1);
+		texels[i] = clamp(Face.Load(int3(texel, 0)).rgb, 0.0f, 65504.0f);
+		blockMin = min(blockMin, texels[i]);
+		blockMax = max(blockMax, texels[i]);
+	}
+
+	// Inset the block bounds (in log space) to reduce the interpolation error
+	float3 logBlockMin = log2(blockMin + 1.0f);
+	float3 logBlockMax = log2(blockMax + 1.0f);
+	float3 inset = (logBlockMax - logBlockMin) * (1.0f / 32.0f);
+	blockMin = exp2(logBlockMin + inset) - 1.0f;
+	blockMax = exp2(logBlockMax - inset) - 1.0f;
+
+	// Project texels on the endpoints line
+	float3 blockDir = blockMax - blockMin;
+	blockDir = blockDir / max(blockDir.x + blockDir.y + blockDir.z, 0.0001f);
+	float3 endpoint0 = QuantizeBC6H(blockMin);
+	float3 endpoint1 = QuantizeBC6H(blockMax);
+	float endPoint0Pos = f32tof16(dot(blockMin, blockDir));
+	float endPoint1Pos = f32tof16(dot(blockMax, blockDir));
+
+	// The first index has an implicit zero MSB so swap endpoints if needed
+	if (GetIndexBC6H(f32tof16(dot(texels[0], blockDir)), endPoint0Pos, endPoint1Pos) > 7)
+	{
+		float3 tmp = endpoint0;
+		endpoint0 = endpoint1;
+		endpoint1 = tmp;
+		float tmpPos = endPoint0Pos;
+		endPoint0Pos = endPoint1Pos;
+		endPoint1Pos = tmpPos;
+	}
+
+	// Encode block (mode bits, endpoints and indices)
+	uint3 e0 = (uint3)endpoint0;
+	uint3 e1 = (uint3)endpoint1;
+	uint4 result;
+	result.x = 0x03 | (e0.x << 5) | (e0.y << 15) | (e0.z << 25);
+	result.y = (e0.z >> 7) | (e1.x << 3) | (e1.y << 13) | (e1.z << 23);
+	result.z = (e1.z >> 9) | (GetIndexBC6H(f32tof16(dot(texels[0], blockDir)), endPoint0Pos, endPoint1Pos) << 1);
+	result.w = 0;
+	UNROLL
+	for (uint j = 1; j < 16; j++)
+	{
+		uint index = GetIndexBC6H(f32tof16(dot(texels[j], blockDir)), endPoint0Pos, endPoint1Pos);
+		if (j < 8)
+			result.z |= index << (j * 4);
+		else
+			result.w |= index << ((j - 8) * 4);
+	}
+	Output[block] = result;
+}
+
+#endif
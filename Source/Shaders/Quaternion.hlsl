@@ -15,4 +15,30 @@ float3 QuaternionRotate(float4 q, float3 v)
     return (v * (q.w * q.w - b2) + b * (dot(v, b) * 2.f) + cross(b, v) * (q.w * 2.f));
 }
 
+float4 QuaternionSlerp(float4 q1, float4 q2, float t)
+{
+    float d = dot(q1, q2);
+    float inverse = 1.0f - t;
+    float opposite = t * sign(d);
+    if (abs(d) <= 0.999999f)
+    {
+        float a = acos(abs(d));
+        float invSin = 1.0f / sin(a);
+        inverse = sin((1.0f - t) * a) * invSin;
+        opposite = sin(t * a) * invSin * sign(d);
+    }
+    return q1 * inverse + q2 * opposite;
+}
+
+// Converts the quaternion into the rotation matrix (rows are the rotated axes, for use with mul(vector, matrix))
+float3x3 QuaternionToMatrix(float4 q)
+{
+    float3 q2 = q.xyz * q.xyz;
+    float xy = q.x * q.y, zw = q.z * q.w, zx = q.z * q.x, yw = q.y * q.w, yz = q.y * q.z, xw = q.x * q.w;
+    return float3x3(
+        1.0f - 2.0f * (q2.y + q2.z), 2.0f * (xy + zw), 2.0f * (zx - yw),
+        2.0f * (xy - zw), 1.0f - 2.0f * (q2.z + q2.x), 2.0f * (yz + xw),
+        2.0f * (zx + yw), 2.0f * (yz - xw), 1.0f - 2.0f * (q2.y + q2.x));
+}
+
 #endif
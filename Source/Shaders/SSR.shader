@@ -7,6 +7,7 @@
 #include "./Flax/GBuffer.hlsl"
 #include "./Flax/GlobalSignDistanceField.hlsl"
 #include "./Flax/GI/GlobalSurfaceAtlas.hlsl"
+#include "./Flax/HalfResRendering.hlsl"
 
 // Enable/disable luminance filter to reduce reflections highlights
 #define SSR_REDUCE_HIGHLIGHTS 1
@@ -37,6 +38,10 @@ float TemporalEffect;
 float Intensity;
 float FadeOutDistance;
 
+uint CheckerboardFrame;
+float Checkerboard;
+float2 Dummy0;
+
 float4x4 ViewMatrix;
 float4x4 ViewProjectionMatrix;
 
@@ -106,6 +111,10 @@ float4 PS_RayTracePass(Quad_VS2PS input) : SV_Target0
     // SRV 7-8 Global SDF
     // SRV 9-13 Global Surface Atlas
 
+    // Skip pixels that are not rendered in this frame (reconstructed from the previous frame)
+    if (Checkerboard > 0 && !IsCheckerboardPixel(uint2(input.Position.xy), CheckerboardFrame))
+        return 0;
+
     // Base layer color with reflections from probes but empty alpha so SSR blur will have valid bacground values to smooth with
     float4 base = float4(Texture0.SampleLevel(SamplerLinearClamp, input.TexCoord, 0).rgb, 0);
 
@@ -18,6 +18,10 @@ float ContactShadowsDistance;
 float ContactShadowsLength;
 META_CB_END
 
+META_CB_BEGIN(1, CopyDepthData)
+float4 CopyDepthUV;
+META_CB_END
+
 DECLARE_GBUFFERDATA_ACCESS(GBuffer)
 DECLARE_LIGHTSHADOWDATA_ACCESS(LightShadow);
 
@@ -191,3 +195,16 @@ float4 PS_SpotLight(Model_VS2PS input) : SV_Target0
 }
 
 #endif
+
+#ifdef _PS_CopyDepth
+
+Texture2D<float> SourceDepth : register(t0);
+
+// Pixel shader for copying the shadow map depth between the shadow map and the static shadows cache atlas tile
+META_PS(true, FEATURE_LEVEL_ES2)
+float PS_CopyDepth(Quad_VS2PS input) : SV_Depth
+{
+	return SourceDepth.SampleLevel(SamplerPointClamp, CopyDepthUV.xy + input.TexCoord * CopyDepthUV.zw, 0);
+}
+
+#endif
@@ -0,0 +1,67 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "./Flax/Common.hlsl"
+
+// Shading rate values (see ShadingRate enum)
+#define SHADING_RATE_1X1 0x0
+#define SHADING_RATE_2X2 0x5
+#define SHADING_RATE_4X4 0xA
+
+META_CB_BEGIN(0, Data)
+float2 ScreenSize;
+uint TileSize;
+uint CoarsestRate;
+float ContrastThreshold;
+float MotionThreshold;
+float2 Dummy0;
+META_CB_END
+
+#ifdef _CS_Generate
+
+Texture2D Frame : register(t0);
+Texture2D MotionVectors : register(t1);
+RWTexture2D<uint> RWShadingRate : register(u0);
+
+groupshared uint MinLuminance;
+groupshared uint MaxLuminance;
+groupshared uint MaxMotion;
+
+// Compute shader for generating the shading rate image (a thread group per tile) from the frame luminance contrast and the motion vectors
+META_CS(true, FEATURE_LEVEL_SM5)
+[numthreads(8, 8, 1)]
+void CS_Generate(uint3 GroupId : SV_GroupID, uint3 GroupThreadId : SV_GroupThreadID, uint GroupIndex : SV_GroupIndex)
+{
+	if (GroupIndex == 0)
+	{
+		MinLuminance = asuint(1.0f);
+		MaxLuminance = 0;
+		MaxMotion = 0;
+	}
+	GroupMemoryBarrierWithGroupSync();
+
+	// Sample the tile area with 8x8 samples (positive floats can be compared as uints)
+	float2 pixel = GroupId.xy * TileSize + (GroupThreadId.xy + 0.5f) * (TileSize / 8.0f);
+	float2 uv = pixel / ScreenSize;
+	float luminance = Luminance(Frame.SampleLevel(SamplerLinearClamp, uv, 0).rgb);
+	luminance = saturate(luminance / (1.0f + luminance));
+	float motion = length(MotionVectors.SampleLevel(SamplerLinearClamp, uv, 0).xy * ScreenSize);
+	InterlockedMin(MinLuminance, asuint(luminance));
+	InterlockedMax(MaxLuminance, asuint(luminance));
+	InterlockedMax(MaxMotion, asuint(motion));
+	GroupMemoryBarrierWithGroupSync();
+
+	// Use coarser shading for flat or fast moving areas
+	if (GroupIndex == 0)
+	{
+		float contrast = asfloat(MaxLuminance) - asfloat(MinLuminance);
+		float maxMotion = asfloat(MaxMotion);
+		uint rate = SHADING_RATE_1X1;
+		if (contrast < ContrastThreshold * 0.25f || maxMotion > MotionThreshold * 2.0f)
+			rate = CoarsestRate;
+		else if (contrast < ContrastThreshold || maxMotion > MotionThreshold)
+			rate = SHADING_RATE_2X2;
+		RWShadingRate[GroupId.xy] = rate;
+	}
+}
+
+#endif
@@ -18,6 +18,7 @@
 #include "./Flax/ShadowsSampling.hlsl"
 #include "./Flax/GBuffer.hlsl"
 #include "./Flax/GI/DDGI.hlsl"
+#include "./Flax/ClusteredLighting.hlsl"
 
 struct SkyLightData
 {
@@ -57,6 +58,7 @@ LightData DirectionalLight;
 LightShadowData DirectionalLightShadow;
 SkyLightData SkyLight;
 DDGIData DDGI;
+ClusteredLightingData ClusteredLighting;
 
 META_CB_END
 
@@ -289,6 +291,8 @@ Texture2D<float4> ProbesIrradiance : register(t7);
 #else
 TextureCube SkyLightImage : register(t5);
 #endif
+StructuredBuffer<LightData> ClusteredLights : register(t8);
+Buffer<uint> ClusteredLightsGrid : register(t9);
 
 META_CS(true, FEATURE_LEVEL_SM5)
 META_PERMUTATION_1(USE_DDGI=0)
@@ -345,10 +349,37 @@ void CS_LightScattering(uint3 GroupId : SV_GroupID, uint3 DispatchThreadId : SV_
 			lightScattering += skyLighting * SkyLight.VolumetricScatteringIntensity;
 		}
 #endif
+
+		// Point and spot lights without shadows (from the cluster containing the voxel)
+		BRANCH
+		if (ClusteredLighting.LightsCount > 0)
+		{
+			float cellRadius = length(positionWS - GetCellPositionWS(gridCoordinate + uint3(1, 1, 1), cellOffset));
+			float distanceBias = max(cellRadius * InverseSquaredLightDistanceBiasScale, 1);
+			float2 volumeUV = (gridCoordinate.xy + cellOffset.xy) / GridSize.xy;
+			uint clusterOffset = GetClusterOffset(ClusteredLighting, volumeUV, sceneDepth * GBuffer.ViewFar);
+			uint clusterLightsCount = ClusteredLightsGrid[clusterOffset];
+			LOOP
+			for (uint clusterLightIndex = 0; clusterLightIndex < clusterLightsCount; clusterLightIndex++)
+			{
+				LightData localLight = ClusteredLights[ClusteredLightsGrid[clusterOffset + 1 + clusterLightIndex]];
+				float scatteringIntensity = localLight.Dummy0; // Volumetric scattering intensity (zero if light was already injected with shadow)
+				if (scatteringIntensity <= 0)
+					continue;
+				bool isSpotLight = localLight.SpotAngles.x > -2.0f;
+				float3 toLight = localLight.Position - positionWS;
+				float distanceSqr = dot(toLight, toLight);
+				float3 L = toLight * rsqrt(distanceSqr);
+				float NoL = 0;
+				float attenuation = 1;
+				GetRadialLightAttenuation(localLight, isSpotLight, float3(0, 0, 1), distanceSqr, distanceBias * distanceBias, toLight, L, NoL, attenuation);
+				lightScattering += localLight.Color * (GetPhase(PhaseG, dot(L, -cameraVectorNormalized)) * attenuation * scatteringIntensity);
+			}
+		}
 	}
 	lightScattering /= (float)samplesCount;
 
-	// Apply scattering from the point and spot lights
+	// Apply scattering from the point and spot lights injected into the volume
 	lightScattering += LocalShadowedLightScattering[gridCoordinate].rgb;
 
 	float4 materialScatteringAndAbsorption = VBufferA[gridCoordinate];
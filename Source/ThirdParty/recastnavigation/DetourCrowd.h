@@ -198,6 +198,14 @@ struct dtCrowdAgentDebugInfo
 	dtObstacleAvoidanceDebugData* vod;
 };
 
+/// Callback used by the crowd to run the agents update jobs in parallel.
+/// Has to invoke job(context, i) for each i in range [0, count) and return once all of them are done.
+/// @ingroup crowd
+/// @see dtCrowd::setParallelFor
+typedef void (*dtCrowdParallelForFunc)(void* userData, void (*job)(void* context, int index), void* context, int count);
+
+struct dtCrowdAgentSortItem;
+
 /// Provides local steering behaviors for a group of agents. 
 /// @ingroup crowd
 class dtCrowd
@@ -227,6 +235,14 @@ class dtCrowd
 
 	dtNavMeshQuery* m_navquery;
 
+	dtCrowdParallelForFunc m_parallelFor;
+	void* m_parallelForUserData;
+	int m_maxWorkers;
+	dtNavMeshQuery** m_workerNavQueries;
+	dtObstacleAvoidanceQuery** m_workerObstacleQueries;
+	int* m_workerSampleCounts;
+	dtCrowdAgentSortItem* m_agentSortItems;
+
 	void updateTopologyOptimization(dtCrowdAgent** agents, const int nagents, const float dt);
 	void updateMoveRequest(const float dt);
 	void checkPathValidity(dtCrowdAgent** agents, const int nagents, const float dt);
@@ -235,6 +251,13 @@ class dtCrowd
 
 	bool requestMoveTargetReplan(const int idx, dtPolyRef ref, const float* pos);
 
+	int getWorkersCount(const int nagents) const;
+	void sortAgentsSpatially(dtCrowdAgent** agents, const int nagents);
+	void runUpdateStep(const int step, dtCrowdAgent** agents, const int nagents, const float dt, dtCrowdAgentDebugInfo* debug);
+	int updateAgents(const int step, const int worker, dtCrowdAgent** agents, const int nagents, const int begin, const int end, const float dt, dtCrowdAgentDebugInfo* debug);
+	static void updateAgentsJob(void* context, int index);
+
+	void freeWorkers();
 	void purge();
 	
 public:
@@ -247,6 +270,15 @@ class dtCrowd
 	///  @param[in]		nav				The navigation mesh to use for planning.
 	/// @return True if the initialization succeeded.
 	bool init(const int maxAgents, const float maxAgentRadius, dtNavMesh* nav);
+
+	/// Sets the callback used to update the agents in parallel (neighbours gathering, steering, velocity planning,
+	/// integration, collisions and movement along the navmesh). Agents are partitioned spatially into batches
+	/// and each batch uses a separate navmesh query and obstacle avoidance query. Has to be called after #init().
+	///  @param[in]		func		The parallel-for callback or null to update all agents on the calling thread.
+	///  @param[in]		userData	The custom data passed to the callback.
+	///  @param[in]		maxWorkers	The maximum number of the agent batches updated at once. [Limit: >= 1]
+	/// @return True if the worker resources have been initialized.
+	bool setParallelFor(dtCrowdParallelForFunc func, void* userData, const int maxWorkers);
 	
 	/// Sets the shared avoidance configuration for the specified index.
 	///  @param[in]		idx		The index. [Limits: 0 <= value < #DT_CROWD_MAX_OBSTAVOIDANCE_PARAMS]
@@ -1469,7 +1469,20 @@ private static void GenerateCppManagedWrapperFunction(BuildData buildData, Strin
             contents.AppendLine("            managedTypeHandle = managedTypePtr->GetBaseType();");
             contents.AppendLine("            managedTypePtr = &managedTypeHandle.GetType();");
             contents.AppendLine("        }");
-            contents.AppendLine("        if (WrapperCallInstance == object)");
+            if (!classInfo.IsInterface && CurrentModule.Module is EngineModule)
+            {
+                // Scripts tick methods can be invoked in batches from C# (see MCore::Scripts::InvokeTick)
+                CppIncludeFiles.Add("Engine/Scripting/ManagedCLR/MCore.h");
+                contents.AppendLine("#if USE_NETCORE");
+                contents.AppendLine($"        if (WrapperCallInstance == object || (MCore::Scripts::TickObject == object && MCore::Scripts::TickIndex == {scriptVTableOffset}))");
+                contents.AppendLine("#else");
+                contents.AppendLine("        if (WrapperCallInstance == object)");
+                contents.AppendLine("#endif");
+            }
+            else
+            {
+                contents.AppendLine("        if (WrapperCallInstance == object)");
+            }
             contents.AppendLine("        {");
             GenerateCppVirtualWrapperCallBaseMethod(buildData, contents, classInfo, functionInfo, "managedTypePtr->Script.ScriptVTableBase", scriptVTableOffset);
             contents.AppendLine("        }");